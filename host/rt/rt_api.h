@@ -0,0 +1,312 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rt_api.h
+ * Description:  Host emulation of the PULP runtime and the XpulpV2 builtins
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86-64 and AArch64 hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The host backend (make host, see the main README.md) builds the library for the machine it runs
+ * on, for the offline evaluation of the fixed-point functions on recorded data. This header takes
+ * the place of the rt/rt_api.h of the pulp-sdk, and provides the subset of the runtime that the
+ * library and the pipelines in test/pipelines use:
+ *
+ * - The calling thread is the fabric controller (rt_cluster_id() is ARCHI_FC_CID), and runs the
+ *   RV32IM kernels. rt_cluster_call runs its entry synchronously as core 0 of the cluster, whose
+ *   glue code calls the XPULPV2 kernels, exactly like on the target.
+ * - rt_team_fork runs the kernel on nPE threads, such that the barriers and the splitting of the
+ *   work among the cores are the same as on the target.
+ * - The DMA transfers are copies, the L1 and L2 allocations use malloc, and the performance
+ *   counters count nanoseconds (rt_freq_get returns 1 GHz), such that the cycles of the profiles
+ *   are nanoseconds on the host.
+ *
+ * The XpulpV2 builtins (__SUMDOTP2, __CLIP, __ROUNDNORM_REG, ...) are emulated with the GCC vector
+ * extensions and 32-bit arithmetic which wraps around like the registers of the cores, such that
+ * the integer and fixed-point kernels compute bit-exactly the same results as on the target. The
+ * emulation is inlined into the kernels, and GCC vectorizes their loops with the SIMD extension of
+ * the host (SSE/AVX2 on x86-64, NEON on AArch64). The floating-point results may differ in the last
+ * bits, since the host contracts multiplications and additions differently and has another libm.
+ */
+
+#ifndef __RT_API_H__
+#define __RT_API_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#if !defined(__GNUC__) || defined(__clang__)
+#error "the host backend needs GCC, for __builtin_shuffle of the XPULPV2 kernels"
+#endif
+
+/* ---------------------------------------------------------------- packed SIMD types */
+
+typedef int16_t v2s __attribute__((vector_size(4)));
+typedef uint16_t v2u __attribute__((vector_size(4)));
+typedef int8_t v4s __attribute__((vector_size(4)));
+typedef uint8_t v4u __attribute__((vector_size(4)));
+
+/* ---------------------------------------------------------------- cluster and cores */
+
+#define ARCHI_FC_CID 32
+
+/** Number of cores of the emulated cluster */
+#define RT_HOST_NB_PE 8
+
+extern __thread int rt_host_cluster_id;
+extern __thread int rt_host_core_id;
+
+static inline int rt_cluster_id(void) { return rt_host_cluster_id; }
+static inline int rt_core_id(void) { return rt_host_core_id; }
+static inline int rt_nb_pe(void) { return RT_HOST_NB_PE; }
+
+void rt_team_fork(int nb_cores, void (*entry)(void *), void *arg);
+void rt_team_barrier(void);
+
+/* barriers of the event unit, for the sub-teams of plp_subteams_run */
+static inline unsigned int eu_bar_addr(int barrier) { return (unsigned int)barrier; }
+void eu_bar_setup(unsigned int barrier, unsigned int coreMask);
+void eu_bar_trig_wait_clr(unsigned int barrier);
+
+typedef struct {
+    int done;
+} rt_event_t;
+
+typedef struct {
+    int id;
+} rt_cluster_call_t;
+
+typedef struct {
+    int id;
+} rt_event_sched_t;
+
+int rt_event_alloc(rt_event_sched_t *sched, int nb_events);
+rt_event_t *rt_event_get_blocking(rt_event_sched_t *sched);
+void rt_event_wait(rt_event_t *event);
+
+void rt_cluster_mount(int mount, int cid, int flags, rt_event_t *event);
+int rt_cluster_call(rt_cluster_call_t *call,
+                    int cid,
+                    void (*entry)(void *arg),
+                    void *arg,
+                    void *stacks,
+                    int master_stack_size,
+                    int slave_stack_size,
+                    int nb_pe,
+                    rt_event_t *event);
+
+/* ---------------------------------------------------------------- memory and DMA */
+
+#define RT_L1_DATA
+#define RT_L2_DATA
+#define RT_CL_DATA
+#define RT_FC_DATA
+
+#define RT_ALLOC_FC_CODE 0
+#define RT_ALLOC_FC_DATA 1
+#define RT_ALLOC_FC_RET_DATA 2
+#define RT_ALLOC_CL_CODE 3
+#define RT_ALLOC_CL_DATA 4
+#define RT_ALLOC_L2_CL_DATA 5
+#define RT_ALLOC_PERIPH 6
+
+static inline void *rt_alloc(int flags, int size) { return malloc(size); }
+static inline void rt_free(int flags, void *chunk, int size) { free(chunk); }
+
+#define RT_DMA_DIR_LOC2EXT 0
+#define RT_DMA_DIR_EXT2LOC 1
+
+typedef struct {
+    int id;
+} rt_dma_copy_t;
+
+static inline void rt_dma_memcpy(uintptr_t ext, uintptr_t loc, int size, int dir, int merge,
+                                 rt_dma_copy_t *copy) {
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        memcpy((void *)loc, (const void *)ext, size);
+    } else {
+        memcpy((void *)ext, (const void *)loc, size);
+    }
+}
+
+/* size bytes in lines of length bytes, which are stride bytes apart in the external memory */
+static inline void rt_dma_memcpy_2d(uintptr_t ext, uintptr_t loc, int size, int stride,
+                                    int length, int dir, int merge, rt_dma_copy_t *copy) {
+    int i;
+    for (i = 0; i < size; i += length) {
+        rt_dma_memcpy(ext, loc + i, length, dir, merge, copy);
+        ext += stride;
+    }
+}
+
+static inline void rt_dma_wait(rt_dma_copy_t *copy) {}
+
+/* ---------------------------------------------------------------- performance counters */
+
+#define RT_PERF_CYCLES 0
+#define RT_PERF_INSTR 1
+#define RT_PERF_ACTIVE_CYCLES 2
+#define RT_PERF_LD_STALL 3
+#define RT_PERF_JR_STALL 4
+#define RT_PERF_IMISS 5
+#define RT_PERF_LD 6
+#define RT_PERF_ST 7
+#define RT_PERF_TCDM_CONT 8
+
+#define RT_FREQ_DOMAIN_FC 0
+#define RT_FREQ_DOMAIN_CL 1
+
+typedef struct {
+    int events;
+} rt_perf_t;
+
+/* the counters of the calling thread, RT_PERF_CYCLES and RT_PERF_ACTIVE_CYCLES count nanoseconds,
+   the others stay 0 */
+void rt_perf_init(rt_perf_t *perf);
+void rt_perf_conf(rt_perf_t *perf, unsigned int events);
+void rt_perf_reset(rt_perf_t *perf);
+void rt_perf_start(rt_perf_t *perf);
+void rt_perf_stop(rt_perf_t *perf);
+unsigned int rt_perf_read(int event);
+
+static inline int rt_freq_get(int domain) { return 1000000000; }
+
+/* the timer of the cluster, counts nanoseconds */
+static inline unsigned int timer_base_cl(int cid, int id, int sub) { return 0; }
+unsigned int timer_count_get(unsigned int base);
+void timer_reset(unsigned int base);
+void timer_start(unsigned int base);
+
+/* ---------------------------------------------------------------- XpulpV2 builtins */
+
+/* The arithmetic of the cores wraps around at 32 bits, so the sums are computed unsigned */
+
+static inline int32_t __MAX(int32_t a, int32_t b) { return (a > b) ? a : b; }
+static inline int32_t __MIN(int32_t a, int32_t b) { return (a < b) ? a : b; }
+
+/* saturation to [-2^precision, 2^precision - 1] (p.clip) */
+static inline int32_t __CLIP(int32_t x, int precision) {
+    int32_t hi = (int32_t)((1U << precision) - 1U);
+    int32_t lo = -hi - 1;
+    return (x > hi) ? hi : ((x < lo) ? lo : x);
+}
+
+/* (x + y + 2^(scale - 1)) >> scale, arithmetic shift (p.addRNr) */
+static inline int32_t __ADDROUNDNORM_REG(int32_t x, int32_t y, uint32_t scale) {
+    uint32_t round = (1U << scale) >> 1;
+    return (int32_t)((uint32_t)x + (uint32_t)y + round) >> scale;
+}
+
+static inline int32_t __ROUNDNORM_REG(int32_t x, uint32_t scale) {
+    return __ADDROUNDNORM_REG(x, 0, scale);
+}
+
+/* (x + y) >> scale, logical shift (p.adduNr) */
+static inline uint32_t __ADDNORMU_REG(uint32_t x, uint32_t y, uint32_t scale) {
+    return (x + y) >> scale;
+}
+
+static inline int32_t __MAC(int32_t acc, int32_t x, int32_t y) {
+    return (int32_t)((uint32_t)acc + (uint32_t)x * (uint32_t)y);
+}
+
+static inline v2s __PACK2(int32_t x, int32_t y) { return (v2s){ (int16_t)x, (int16_t)y }; }
+static inline v4s __PACK4(int32_t x, int32_t y, int32_t z, int32_t t) {
+    return (v4s){ (int8_t)x, (int8_t)y, (int8_t)z, (int8_t)t };
+}
+
+static inline int32_t __SUMDOTP2(v2s a, v2s b, int32_t c) {
+    return (int32_t)((uint32_t)c + (uint32_t)(a[0] * b[0]) + (uint32_t)(a[1] * b[1]));
+}
+
+static inline int32_t __DOTP2(v2s a, v2s b) { return __SUMDOTP2(a, b, 0); }
+
+static inline int32_t __SUMDOTP4(v4s a, v4s b, int32_t c) {
+    return (int32_t)((uint32_t)c + (uint32_t)(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] +
+                                              a[3] * b[3]));
+}
+
+static inline int32_t __DOTP4(v4s a, v4s b) { return __SUMDOTP4(a, b, 0); }
+
+static inline uint32_t __SUMDOTUP2(v2u a, v2u b, uint32_t c) {
+    return c + (uint32_t)a[0] * b[0] + (uint32_t)a[1] * b[1];
+}
+
+static inline uint32_t __SUMDOTUP4(v4u a, v4u b, uint32_t c) {
+    return c + (uint32_t)(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]);
+}
+
+/* element-wise operations, which wrap around in every element */
+
+static inline v2s __ADD2(v2s a, v2s b) { return (v2s)((v2u)a + (v2u)b); }
+static inline v2s __SUB2(v2s a, v2s b) { return (v2s)((v2u)a - (v2u)b); }
+static inline v4s __ADD4(v4s a, v4s b) { return (v4s)((v4u)a + (v4u)b); }
+static inline v4s __SUB4(v4s a, v4s b) { return (v4s)((v4u)a - (v4u)b); }
+
+static inline v2s __AND2(v2s a, v2s b) { return a & b; }
+static inline v4s __AND4(v4s a, v4s b) { return a & b; }
+
+/* the comparisons return -1 in the elements where they hold, and 0 elsewhere */
+
+static inline v2s __MAX2(v2s a, v2s b) {
+    v2s m = a > b;
+    return (a & m) | (b & ~m);
+}
+
+static inline v2s __MIN2(v2s a, v2s b) {
+    v2s m = a < b;
+    return (a & m) | (b & ~m);
+}
+
+static inline v4s __MAX4(v4s a, v4s b) {
+    v4s m = a > b;
+    return (a & m) | (b & ~m);
+}
+
+static inline v4s __MIN4(v4s a, v4s b) {
+    v4s m = a < b;
+    return (a & m) | (b & ~m);
+}
+
+/* |-2^15| and |-2^7| wrap around to themselves, like on the cores */
+static inline v2s __ABS2(v2s a) {
+    v2s m = a >> 15;
+    return (v2s)(((v2u)a ^ (v2u)m) - (v2u)m);
+}
+
+static inline v4s __ABS4(v4s a) {
+    v4s m = a >> 7;
+    return (v4s)(((v4u)a ^ (v4u)m) - (v4u)m);
+}
+
+/* the shift amounts are taken modulo the number of bits of an element */
+
+static inline v2s __SRA2(v2s a, v2s b) { return a >> (b & 15); }
+static inline v2s __SLL2(v2s a, v2s b) { return (v2s)((v2u)a << (v2u)(b & 15)); }
+static inline v4s __SRA4(v4s a, v4s b) { return a >> (b & 7); }
+static inline v4s __SLL4(v4s a, v4s b) { return (v4s)((v4u)a << (v4u)(b & 7)); }
+
+#endif // __RT_API_H__
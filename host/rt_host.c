@@ -0,0 +1,191 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rt_host.c
+ * Description:  Host emulation of the PULP runtime
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86-64 and AArch64 hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rt/rt_api.h"
+#include <time.h>
+
+/* the thread of the application is the fabric controller, see rt_api.h */
+__thread int rt_host_cluster_id = ARCHI_FC_CID;
+__thread int rt_host_core_id = 0;
+
+/* barrier of the forked team, and the barriers of the event unit (0 is the one of the team) */
+static pthread_barrier_t rt_host_team_barrier;
+static pthread_barrier_t rt_host_eu_barriers[RT_HOST_NB_PE];
+static uint32_t rt_host_eu_barriers_init = 0;
+
+typedef struct {
+    void (*entry)(void *);
+    void *arg;
+    int core;
+} rt_host_core;
+
+static void *rt_host_core_main(void *arg) {
+    rt_host_core *core = (rt_host_core *)arg;
+
+    rt_host_cluster_id = 0;
+    rt_host_core_id = core->core;
+    core->entry(core->arg);
+    return NULL;
+}
+
+/* Runs entry on nb_cores cores, all of them if nb_cores is 0. The calling thread is core 0, the
+   others are threads which live as long as the fork, like the cores of the cluster, which sleep
+   between the forks. */
+void rt_team_fork(int nb_cores, void (*entry)(void *), void *arg) {
+    pthread_t threads[RT_HOST_NB_PE];
+    rt_host_core cores[RT_HOST_NB_PE];
+    int core0 = rt_host_core_id;
+    int i;
+
+    if (nb_cores <= 0 || nb_cores > RT_HOST_NB_PE) {
+        nb_cores = RT_HOST_NB_PE;
+    }
+
+    pthread_barrier_init(&rt_host_team_barrier, NULL, nb_cores);
+
+    for (i = 1; i < nb_cores; i++) {
+        cores[i] = (rt_host_core){ .entry = entry, .arg = arg, .core = i };
+        pthread_create(&threads[i], NULL, rt_host_core_main, &cores[i]);
+    }
+
+    rt_host_core_id = 0;
+    entry(arg);
+    rt_host_core_id = core0;
+
+    for (i = 1; i < nb_cores; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_barrier_destroy(&rt_host_team_barrier);
+}
+
+void rt_team_barrier(void) { pthread_barrier_wait(&rt_host_team_barrier); }
+
+void eu_bar_setup(unsigned int barrier, unsigned int coreMask) {
+    if (rt_host_eu_barriers_init & (1U << barrier)) {
+        pthread_barrier_destroy(&rt_host_eu_barriers[barrier]);
+    }
+    pthread_barrier_init(&rt_host_eu_barriers[barrier], NULL, __builtin_popcount(coreMask));
+    rt_host_eu_barriers_init |= 1U << barrier;
+}
+
+void eu_bar_trig_wait_clr(unsigned int barrier) {
+    pthread_barrier_wait(&rt_host_eu_barriers[barrier]);
+}
+
+/* ---------------------------------------------------------------- cluster calls and events */
+
+static rt_event_t rt_host_event;
+
+int rt_event_alloc(rt_event_sched_t *sched, int nb_events) { return 0; }
+
+rt_event_t *rt_event_get_blocking(rt_event_sched_t *sched) { return &rt_host_event; }
+
+void rt_event_wait(rt_event_t *event) {}
+
+void rt_cluster_mount(int mount, int cid, int flags, rt_event_t *event) {}
+
+/* the call returns when entry is finished, an event passed to it is already done */
+int rt_cluster_call(rt_cluster_call_t *call,
+                    int cid,
+                    void (*entry)(void *arg),
+                    void *arg,
+                    void *stacks,
+                    int master_stack_size,
+                    int slave_stack_size,
+                    int nb_pe,
+                    rt_event_t *event) {
+    int clusterId = rt_host_cluster_id;
+    int coreId = rt_host_core_id;
+
+    rt_host_cluster_id = cid;
+    rt_host_core_id = 0;
+    entry(arg);
+    rt_host_cluster_id = clusterId;
+    rt_host_core_id = coreId;
+
+    if (event != NULL) {
+        event->done = 1;
+    }
+    return 0;
+}
+
+/* ---------------------------------------------------------------- performance counters */
+
+static uint64_t rt_host_time(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000U + t.tv_nsec;
+}
+
+static __thread uint64_t rt_host_perf_start;
+static __thread uint64_t rt_host_perf_cycles;
+static __thread int rt_host_perf_running;
+
+void rt_perf_init(rt_perf_t *perf) { perf->events = 0; }
+
+void rt_perf_conf(rt_perf_t *perf, unsigned int events) { perf->events = events; }
+
+void rt_perf_reset(rt_perf_t *perf) {
+    rt_host_perf_cycles = 0;
+    rt_host_perf_start = rt_host_time();
+}
+
+void rt_perf_start(rt_perf_t *perf) {
+    rt_host_perf_start = rt_host_time();
+    rt_host_perf_running = 1;
+}
+
+void rt_perf_stop(rt_perf_t *perf) {
+    if (rt_host_perf_running) {
+        rt_host_perf_cycles += rt_host_time() - rt_host_perf_start;
+        rt_host_perf_running = 0;
+    }
+}
+
+unsigned int rt_perf_read(int event) {
+    uint64_t cycles = rt_host_perf_cycles;
+
+    if (event != RT_PERF_CYCLES && event != RT_PERF_ACTIVE_CYCLES) {
+        return 0;
+    }
+    if (rt_host_perf_running) {
+        cycles += rt_host_time() - rt_host_perf_start;
+    }
+    return (unsigned int)cycles;
+}
+
+static uint64_t rt_host_timer_start;
+
+unsigned int timer_count_get(unsigned int base) {
+    return (unsigned int)(rt_host_time() - rt_host_timer_start);
+}
+
+void timer_reset(unsigned int base) { rt_host_timer_start = rt_host_time(); }
+
+void timer_start(unsigned int base) {}
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""
+Generates plp_direct.h, which maps every glue function that only dispatches between the FC and the
+cluster kernel directly to one of the kernels. Run it after adding functions:
+
+    python3 include/gen_plp_direct.py
+"""
+
+import os
+import re
+
+HERE = os.path.dirname(os.path.realpath(__file__))
+SRC = os.path.join(HERE, '..', 'src')
+
+HEADER = """\
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_direct.h
+ * Description:  Compile-time kernel selection, generated by gen_plp_direct.py
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Include this header after plp_math.h in the application, and build the application with
+ * PLP_TARGET_CLUSTER_ONLY (if the functions are only called from the cluster) or PLP_TARGET_FC_ONLY
+ * (if they are only called from the fabric controller). The glue functions, which only check
+ * rt_cluster_id() and call the kernel, are then replaced by a direct call of the kernel for this
+ * target. This removes the check and one call per function call, which matters for short blocks in
+ * tight loops. All other functions are not changed. The library itself is built without these
+ * options. Calling a function on the other target than the one selected is not supported.
+ */
+
+#ifndef __PLP_DIRECT_H__
+#define __PLP_DIRECT_H__
+
+#include "plp_math.h"
+
+#if defined(PLP_TARGET_CLUSTER_ONLY) && defined(PLP_TARGET_FC_ONLY)
+#error "PLP_TARGET_CLUSTER_ONLY and PLP_TARGET_FC_ONLY must not be defined at the same time"
+#endif
+
+// the profiling wrappers of plp_profile.h need the glue functions
+#if !defined(PLP_PROFILE)
+"""
+
+FOOTER = """
+#endif // !PLP_PROFILE
+
+#endif // __PLP_DIRECT_H__
+"""
+
+SIGNATURE = re.compile(r'^(?:const )?\w+ \*?(plp_\w+)\(([^)]*)\) \{', re.M)
+# the cluster kernel of a function with a kernel per backend is called through PLP_CL_KERNEL
+CALL = r'\s*(?:return )?((?:PLP_CL_KERNEL\()?plp_\w+\)?)\(([^;]*)\);\s*(?:return;)?\s*'
+BACKEND = re.compile(r'^PLP_CL_KERNEL\((plp_\w+)\)$')
+# with PLP_FC_FIXED_POINT, some floating-point functions run a kernel on the FC; the header maps
+# them as in the default build, where the FC only prints an error
+FC_FIXED_POINT = re.compile(r'#if defined\(PLP_FC_FIXED_POINT\)\n.*?#else\n(.*?)#endif\n', re.S)
+# floating-point functions only print an error (or return a dummy result) on the FC
+FC_ERROR = r'(?:\s*(?!plp_)[^;{}]*;)+\s*'
+DISPATCH = re.compile(r'\s*if \(rt_cluster_id\(\) == ARCHI_FC_CID\) \{(?:' + CALL + '|(' + FC_ERROR +
+                      r'))\} else \{' + CALL + r'\}\s*\}')
+
+
+def parse_glue(source):
+    """ returns (name, params, fc_kernel, fc_args, cl_kernel, cl_args), or None """
+    match = SIGNATURE.search(source)
+    if match is None:
+        return None
+    name = match.group(1)
+    params = [p.split()[-1].lstrip('*') for p in split_args(match.group(2)) if p != 'void']
+    source = FC_FIXED_POINT.sub(r'\1', source)
+    body = DISPATCH.match(source, match.end())
+    if body is None:
+        return None
+    fc_kernel, fc_args, _, cl_kernel, cl_args = body.groups()
+    for args in (fc_args, cl_args):
+        if args is not None and not set(CAST.sub('', a) for a in split_args(args)) <= set(params):
+            return None
+    return name, params, fc_kernel, fc_args, cl_kernel, cl_args
+
+
+CAST = re.compile(r'^\([\w ]+\*?\)\s*')
+
+
+def split_args(args):
+    """ returns the list of arguments of a call """
+    return [a.strip() for a in args.split(',')] if args.strip() else []
+
+
+def macro_arg(arg):
+    """ returns the argument, with parentheses around the parameter if it is cast """
+    cast = CAST.match(arg)
+    if cast is None:
+        return arg
+    return '%s(%s)' % (cast.group(0).strip(), arg[cast.end():])
+
+
+def define(name, params, kernel, args):
+    """ returns the macro, which maps the glue function to the kernel """
+    args = ', '.join(macro_arg(a) for a in split_args(args))
+    line = '#define %s(%s) %s(%s)' % (name, ', '.join(params), kernel, args)
+    if len(line) > 100:
+        line = '#define %s(%s) \\\n    %s(%s)' % (name, ', '.join(params), kernel, args)
+    return line
+
+
+def declared_kernel(kernel):
+    """ returns the kernel, which is declared for the default backend """
+    backend = BACKEND.match(kernel)
+    return kernel if backend is None else backend.group(1) + '_xpulpv2'
+
+
+def read_headers():
+    """ returns the declarations of plp_math.h, which includes the header of every module """
+    with open(os.path.join(HERE, 'plp_math.h')) as f:
+        modules = re.findall(r'^#include "(plp_\w+\.h)"', f.read(), re.M)
+    text = ''
+    for name in modules:
+        with open(os.path.join(HERE, name)) as f:
+            text += f.read()
+    return text
+
+
+def main():
+    # kernels which are not declared in plp_math.h cannot be called from the application
+    declared = set(re.findall(r'\b(plp_\w+)\(', read_headers()))
+
+    glues = []
+    for root, dirs, files in os.walk(SRC):
+        dirs[:] = sorted(d for d in dirs if d != 'kernels')
+        for fname in sorted(files):
+            if fname.endswith('.c'):
+                with open(os.path.join(root, fname)) as f:
+                    glue = parse_glue(f.read())
+                if glue is not None:
+                    glues.append(glue)
+    glues.sort()
+
+    cluster = [define(n, p, k, a) for n, p, _, _, k, a in glues if declared_kernel(k) in declared]
+    fc = [define(n, p, k, a) for n, p, k, a, _, _ in glues if k in declared]
+    with open(os.path.join(HERE, 'plp_direct.h'), 'w') as f:
+        f.write(HEADER)
+        f.write('\n#if defined(PLP_TARGET_CLUSTER_ONLY)\n\n')
+        f.write('\n'.join(cluster))
+        f.write('\n\n#endif // PLP_TARGET_CLUSTER_ONLY\n')
+        f.write('\n#if defined(PLP_TARGET_FC_ONLY)\n\n')
+        f.write('\n'.join(fc))
+        f.write('\n\n#endif // PLP_TARGET_FC_ONLY\n')
+        f.write(FOOTER)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+Generates plp_profile.h, which wraps every public (glue) function declared in the module headers of
+plp_math.h with the profiling counters of plp_profile_start and plp_profile_stop. Run it after
+adding functions:
+
+    python3 include/gen_plp_profile.py
+"""
+
+import os
+import re
+
+HERE = os.path.dirname(os.path.realpath(__file__))
+
+# kernels are called by the glue code, and the profiling functions must not wrap themselves
+SKIP = re.compile(r'(_rv32im|_xpulpv2|_xpulpnn)$|^plp_profile_|^plp_scratch_|^plp_auto_|^plp_trace_'
+                  r'|^plp_balance_|^plp_l1_')
+
+HEADER = """\
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.h
+ * Description:  Profiling wrappers for the public functions, generated by gen_plp_profile.py
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Include this header after plp_math.h in the application, and build the application with
+ * PLP_PROFILE defined. Every call to a public function is then measured and accumulated into the
+ * table given to plp_profile_init. The library itself is built without PLP_PROFILE.
+ */
+
+#ifndef __PLP_PROFILE_H__
+#define __PLP_PROFILE_H__
+
+#include "plp_math.h"
+
+#if defined(PLP_PROFILE)
+
+#define PLP_PROFILE_VOID(fn, ...)                                                                  \\
+    do {                                                                                           \\
+        uint32_t plp_profile_id = plp_profile_start(#fn);                                          \\
+        fn(__VA_ARGS__);                                                                           \\
+        plp_profile_stop(plp_profile_id);                                                          \\
+    } while (0)
+
+#define PLP_PROFILE_RET(fn, ...)                                                                   \\
+    ({                                                                                             \\
+        uint32_t plp_profile_id = plp_profile_start(#fn);                                          \\
+        __typeof__(fn(__VA_ARGS__)) plp_profile_ret = fn(__VA_ARGS__);                             \\
+        plp_profile_stop(plp_profile_id);                                                          \\
+        plp_profile_ret;                                                                           \\
+    })
+
+"""
+
+FOOTER = """
+#endif // PLP_PROFILE
+
+#endif // __PLP_PROFILE_H__
+"""
+
+
+def read_headers():
+    """ returns the declarations of plp_math.h, which includes the header of every module """
+    with open(os.path.join(HERE, 'plp_math.h')) as f:
+        modules = re.findall(r'^#include "(plp_\w+\.h)"', f.read(), re.M)
+    text = ''
+    for name in modules:
+        with open(os.path.join(HERE, name)) as f:
+            text += f.read()
+    return text
+
+
+def main():
+    decls = re.findall(r'^((?:const\s+)?[A-Za-z_]\w*\s*\**)\s*(plp_\w+)\(', read_headers(), re.M)
+    lines = []
+    seen = set()
+    for ret, name in decls:
+        if SKIP.search(name) or name in seen:
+            continue
+        seen.add(name)
+        wrapper = 'PLP_PROFILE_VOID' if ret.strip() == 'void' else 'PLP_PROFILE_RET'
+        line = '#define %s(...) %s(%s, __VA_ARGS__)' % (name, wrapper, name)
+        if len(line) > 100:
+            line = '#define %s(...) \\\n    %s(%s, __VA_ARGS__)' % (name, wrapper, name)
+        lines.append(line)
+    with open(os.path.join(HERE, 'plp_profile.h'), 'w') as f:
+        f.write(HEADER + '\n'.join(lines) + '\n' + FOOTER)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,514 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_auto_table.h
+ * Description:  Cost table for choosing the number of cores with PLP_AUTO
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Generated by test/mrWolf/bench.py autotune from a benchmark sweep (PULP_DSP_BENCH=1). For every
+ * function, the table contains the smallest problem size (the number of operations, as n_ops in
+ * the testset) from which 2, 4 and 8 cores are used. 0xFFFFFFFF means never.
+ */
+
+#ifndef __PLP_AUTO_TABLE_H__
+#define __PLP_AUTO_TABLE_H__
+
+#define PLP_AUTO_TABLE(X) \
+    X(plp_abs_f32_parallel, 64, 128, 256)                         \
+    X(plp_abs_i16_parallel, 64, 128, 256)                         \
+    X(plp_abs_i32_parallel, 64, 128, 256)                         \
+    X(plp_abs_i8_parallel, 64, 128, 256)                          \
+    X(plp_add_f32_parallel, 64, 128, 256)                         \
+    X(plp_add_i16_parallel, 64, 128, 256)                         \
+    X(plp_add_i32_parallel, 64, 128, 256)                         \
+    X(plp_add_i8_parallel, 64, 128, 256)                          \
+    X(plp_add_q16_parallel, 64, 128, 256)                         \
+    X(plp_add_q32_parallel, 64, 128, 256)                         \
+    X(plp_add_q8_parallel, 64, 128, 256)                          \
+    X(plp_avgpool_i8_parallel, 64, 128, 256)                      \
+    X(plp_cfar_ca_f32_parallel, 64, 128, 256)                     \
+    X(plp_cfar_ca_q16_parallel, 64, 128, 256)                     \
+    X(plp_cfar_os_f32_parallel, 64, 128, 256)                     \
+    X(plp_cfar_os_q16_parallel, 64, 128, 256)                     \
+    X(plp_clip_f32_parallel, 64, 128, 256)                        \
+    X(plp_clip_i16_parallel, 64, 128, 256)                        \
+    X(plp_clip_i32_parallel, 64, 128, 256)                        \
+    X(plp_clip_i8_parallel, 64, 128, 256)                         \
+    X(plp_cmplx_arg_f32_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_arg_q16_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_arg_q32_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_conj_f32_parallel, 64, 128, 256)                  \
+    X(plp_cmplx_conj_i16_parallel, 64, 128, 256)                  \
+    X(plp_cmplx_conj_i32_parallel, 64, 128, 256)                  \
+    X(plp_cmplx_conj_i8_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_dot_prod_f32_parallel, 64, 128, 256)              \
+    X(plp_cmplx_dot_prod_i16_parallel, 64, 128, 256)              \
+    X(plp_cmplx_dot_prod_i32_parallel, 64, 128, 256)              \
+    X(plp_cmplx_dot_prod_i8_parallel, 64, 128, 256)               \
+    X(plp_cmplx_dot_prod_q16_parallel, 64, 128, 256)              \
+    X(plp_cmplx_dot_prod_q32_parallel, 64, 128, 256)              \
+    X(plp_cmplx_mag_approx_f32_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mag_approx_q16_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mag_approx_q32_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mag_f32_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_mag_i16_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_mag_i32_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_mag_q16_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_mag_q32_parallel, 64, 128, 256)                   \
+    X(plp_cmplx_mag_squared_f32_parallel, 64, 128, 256)           \
+    X(plp_cmplx_mag_squared_i16_parallel, 64, 128, 256)           \
+    X(plp_cmplx_mag_squared_i32_parallel, 64, 128, 256)           \
+    X(plp_cmplx_mag_squared_i8_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mag_squared_q16_parallel, 64, 128, 256)           \
+    X(plp_cmplx_mag_squared_q32_parallel, 64, 128, 256)           \
+    X(plp_cmplx_mag_squared_q8_parallel, 64, 128, 256)            \
+    X(plp_cmplx_merge_f32_parallel, 64, 128, 256)                 \
+    X(plp_cmplx_merge_i16_parallel, 64, 128, 256)                 \
+    X(plp_cmplx_merge_i32_parallel, 64, 128, 256)                 \
+    X(plp_cmplx_mult_cmplx_f32_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mult_cmplx_i16_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mult_cmplx_i32_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mult_cmplx_i8_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_cmplx_q16_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mult_cmplx_q32_parallel, 64, 128, 256)            \
+    X(plp_cmplx_mult_cmplx_q8_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_conj_f32_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_conj_q16_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_conj_q32_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_conj_q8_parallel, 64, 128, 256)              \
+    X(plp_cmplx_mult_real_f32_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_real_i16_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_real_i32_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_real_i8_parallel, 64, 128, 256)              \
+    X(plp_cmplx_mult_real_q16_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_real_q32_parallel, 64, 128, 256)             \
+    X(plp_cmplx_mult_real_q8_parallel, 64, 128, 256)              \
+    X(plp_cmplx_split_f32_parallel, 64, 128, 256)                 \
+    X(plp_cmplx_split_i16_parallel, 64, 128, 256)                 \
+    X(plp_cmplx_split_i32_parallel, 64, 128, 256)                 \
+    X(plp_conv1d_f32_parallel, 64, 128, 256)                      \
+    X(plp_conv1d_i8_parallel, 64, 128, 256)                       \
+    X(plp_conv2d_i16_parallel, 64, 128, 256)                      \
+    X(plp_conv2d_i8_parallel, 64, 128, 256)                       \
+    X(plp_conv_depthwise_i8_parallel, 64, 128, 256)               \
+    X(plp_conv_i16_parallel, 64, 128, 256)                        \
+    X(plp_conv_i32_parallel, 64, 128, 256)                        \
+    X(plp_conv_i8_parallel, 64, 128, 256)                         \
+    X(plp_conv_valid_winograd_f32_parallel, 64, 128, 256)         \
+    X(plp_conv_valid_winograd_i16_parallel, 64, 128, 256)         \
+    X(plp_correlate_i16_parallel, 64, 128, 256)                   \
+    X(plp_correlate_i32_parallel, 64, 128, 256)                   \
+    X(plp_correlate_i8_parallel, 64, 128, 256)                    \
+    X(plp_correlate_q16_parallel, 64, 128, 256)                   \
+    X(plp_correlate_q32_parallel, 64, 128, 256)                   \
+    X(plp_correlate_q8_parallel, 64, 128, 256)                    \
+    X(plp_cos_f32_vec_parallel, 64, 128, 256)                     \
+    X(plp_cos_q16_vec_parallel, 64, 128, 256)                     \
+    X(plp_cos_q32_vec_parallel, 64, 128, 256)                     \
+    X(plp_cov_f32_parallel, 64, 128, 256)                         \
+    X(plp_cumsum_f32_parallel, 64, 128, 256)                      \
+    X(plp_cumsum_i16_parallel, 64, 128, 256)                      \
+    X(plp_cumsum_i32_parallel, 64, 128, 256)                      \
+    X(plp_db_f32_vec_parallel, 64, 128, 256)                      \
+    X(plp_db_q16_vec_parallel, 64, 128, 256)                      \
+    X(plp_deinterleave_f32_parallel, 64, 128, 256)                \
+    X(plp_deinterleave_i16_parallel, 64, 128, 256)                \
+    X(plp_deinterleave_i32_parallel, 64, 128, 256)                \
+    X(plp_dequantize_i32_f32_parallel, 64, 128, 256)              \
+    X(plp_div_q16_parallel, 64, 128, 256)                         \
+    X(plp_div_q32_parallel, 64, 128, 256)                         \
+    X(plp_dot_prod_f32_parallel, 64, 128, 256)                    \
+    X(plp_dot_prod_i16_parallel, 64, 128, 256)                    \
+    X(plp_dot_prod_i32_parallel, 64, 128, 256)                    \
+    X(plp_dot_prod_i8_parallel, 64, 128, 256)                     \
+    X(plp_dot_prod_q16_parallel, 64, 128, 256)                    \
+    X(plp_dot_prod_q32_parallel, 64, 128, 256)                    \
+    X(plp_dot_prod_q8_parallel, 64, 128, 256)                     \
+    X(plp_f32_to_q16_parallel, 64, 128, 256)                      \
+    X(plp_f32_to_q32_parallel, 64, 128, 256)                      \
+    X(plp_f32_to_q8_parallel, 64, 128, 256)                       \
+    X(plp_find_peaks_f32_parallel, 64, 128, 256)                  \
+    X(plp_find_peaks_q16_parallel, 64, 128, 256)                  \
+    X(plp_fir_f32_parallel, 64, 128, 256)                         \
+    X(plp_fir_q16_parallel, 64, 128, 256)                         \
+    X(plp_fir_q32_parallel, 64, 128, 256)                         \
+    X(plp_fir_q8_parallel, 64, 128, 256)                          \
+    X(plp_gemm_cmplx_f32_parallel, 64, 128, 256)                  \
+    X(plp_gemm_f32_parallel, 64, 128, 256)                        \
+    X(plp_gru_cell_i8_parallel, 64, 128, 256)                     \
+    X(plp_gru_cell_q16_parallel, 64, 128, 256)                    \
+    X(plp_histogram_f32_parallel, 64, 128, 256)                   \
+    X(plp_histogram_i16_parallel, 64, 128, 256)                   \
+    X(plp_histogram_i8_parallel, 64, 128, 256)                    \
+    X(plp_i16_to_i32_parallel, 64, 128, 256)                      \
+    X(plp_i16_to_i8_parallel, 64, 128, 256)                       \
+    X(plp_i32_to_i16_parallel, 64, 128, 256)                      \
+    X(plp_i32_to_i8_parallel, 64, 128, 256)                       \
+    X(plp_i8_to_i16_parallel, 64, 128, 256)                       \
+    X(plp_i8_to_i32_parallel, 64, 128, 256)                       \
+    X(plp_im2col_i8_parallel, 64, 128, 256)                       \
+    X(plp_integral_image_f32_parallel, 64, 128, 256)              \
+    X(plp_integral_image_i16_parallel, 64, 128, 256)              \
+    X(plp_integral_image_i32_parallel, 64, 128, 256)              \
+    X(plp_interleave_f32_parallel, 64, 128, 256)                  \
+    X(plp_interleave_i16_parallel, 64, 128, 256)                  \
+    X(plp_interleave_i32_parallel, 64, 128, 256)                  \
+    X(plp_layernorm_f32_parallel, 64, 128, 256)                   \
+    X(plp_layernorm_q16_parallel, 64, 128, 256)                   \
+    X(plp_log2_f32_vec_parallel, 64, 128, 256)                    \
+    X(plp_log2_q16_vec_parallel, 64, 128, 256)                    \
+    X(plp_lstm_cell_i8_parallel, 64, 128, 256)                    \
+    X(plp_lstm_cell_q16_parallel, 64, 128, 256)                   \
+    X(plp_mat_add_f32_parallel, 64, 128, 256)                     \
+    X(plp_mat_add_i16_parallel, 64, 128, 256)                     \
+    X(plp_mat_add_i32_parallel, 64, 128, 256)                     \
+    X(plp_mat_add_i8_parallel, 64, 128, 256)                      \
+    X(plp_mat_add_inplace_f32_parallel, 64, 128, 256)             \
+    X(plp_mat_add_inplace_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_add_inplace_i32_parallel, 64, 128, 256)             \
+    X(plp_mat_add_inplace_i8_parallel, 64, 128, 256)              \
+    X(plp_mat_add_stride_f32_parallel, 64, 128, 256)              \
+    X(plp_mat_add_stride_i16_parallel, 64, 128, 256)              \
+    X(plp_mat_add_stride_i32_parallel, 64, 128, 256)              \
+    X(plp_mat_add_stride_i8_parallel, 64, 128, 256)               \
+    X(plp_mat_cholesky_f32_parallel, 64, 128, 256)                \
+    X(plp_mat_cholesky_q32_parallel, 64, 128, 256)                \
+    X(plp_mat_cholesky_stride_f32_parallel, 64, 128, 256)         \
+    X(plp_mat_cholesky_stride_q32_parallel, 64, 128, 256)         \
+    X(plp_mat_copy_stride_f32_parallel, 64, 128, 256)             \
+    X(plp_mat_copy_stride_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_copy_stride_i32_parallel, 64, 128, 256)             \
+    X(plp_mat_copy_stride_i8_parallel, 64, 128, 256)              \
+    X(plp_mat_eig_sym_f32_parallel, 64, 128, 256)                 \
+    X(plp_mat_fill_I_f32_parallel, 64, 128, 256)                  \
+    X(plp_mat_fill_I_i16_parallel, 64, 128, 256)                  \
+    X(plp_mat_fill_I_i32_parallel, 64, 128, 256)                  \
+    X(plp_mat_fill_I_i8_parallel, 64, 128, 256)                   \
+    X(plp_mat_fill_I_q16_parallel, 64, 128, 256)                  \
+    X(plp_mat_fill_I_q32_parallel, 64, 128, 256)                  \
+    X(plp_mat_fill_I_q8_parallel, 64, 128, 256)                   \
+    X(plp_mat_fill_I_stride_f32_parallel, 64, 128, 256)           \
+    X(plp_mat_fill_I_stride_i16_parallel, 64, 128, 256)           \
+    X(plp_mat_fill_I_stride_i32_parallel, 64, 128, 256)           \
+    X(plp_mat_fill_I_stride_i8_parallel, 64, 128, 256)            \
+    X(plp_mat_fill_I_stride_q16_parallel, 64, 128, 256)           \
+    X(plp_mat_fill_I_stride_q32_parallel, 64, 128, 256)           \
+    X(plp_mat_fill_I_stride_q8_parallel, 64, 128, 256)            \
+    X(plp_mat_fill_stride_f32_parallel, 64, 128, 256)             \
+    X(plp_mat_fill_stride_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_fill_stride_i32_parallel, 64, 128, 256)             \
+    X(plp_mat_fill_stride_i8_parallel, 64, 128, 256)              \
+    X(plp_mat_fma_stride_f32_parallel, 64, 128, 256)              \
+    X(plp_mat_fma_stride_i16_parallel, 64, 128, 256)              \
+    X(plp_mat_fma_stride_i32_parallel, 64, 128, 256)              \
+    X(plp_mat_fma_stride_i8_parallel, 64, 128, 256)               \
+    X(plp_mat_fma_stride_q16_parallel, 64, 128, 256)              \
+    X(plp_mat_fma_stride_q32_parallel, 64, 128, 256)              \
+    X(plp_mat_fma_stride_q8_parallel, 64, 128, 256)               \
+    X(plp_mat_herk_f32_parallel, 64, 128, 256)                    \
+    X(plp_mat_herk_i16_parallel, 64, 128, 256)                    \
+    X(plp_mat_herk_q16_parallel, 64, 128, 256)                    \
+    X(plp_mat_hermitian_f32_parallel, 64, 128, 256)               \
+    X(plp_mat_hermitian_i16_parallel, 64, 128, 256)               \
+    X(plp_mat_hermitian_i32_parallel, 64, 128, 256)               \
+    X(plp_mat_hermitian_q16_parallel, 64, 128, 256)               \
+    X(plp_mat_hermitian_stride_f32_parallel, 64, 128, 256)        \
+    X(plp_mat_hermitian_stride_i16_parallel, 64, 128, 256)        \
+    X(plp_mat_hermitian_stride_i32_parallel, 64, 128, 256)        \
+    X(plp_mat_hermitian_stride_q16_parallel, 64, 128, 256)        \
+    X(plp_mat_kron_f32_parallel, 64, 128, 256)                    \
+    X(plp_mat_kron_i16_parallel, 64, 128, 256)                    \
+    X(plp_mat_kron_i32_parallel, 64, 128, 256)                    \
+    X(plp_mat_kron_i8_parallel, 64, 128, 256)                     \
+    X(plp_mat_lstsq_f32_parallel, 64, 128, 256)                   \
+    X(plp_mat_lu_solve_f32_parallel, 64, 128, 256)                \
+    X(plp_mat_mult_bin_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_cmplx_3m_f32_parallel, 64, 128, 256)           \
+    X(plp_mat_mult_cmplx_f32_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_cmplx_i16_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_cmplx_i32_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_cmplx_i8_parallel, 64, 128, 256)               \
+    X(plp_mat_mult_cmplx_q16_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_cmplx_q32_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_cmplx_q8_parallel, 64, 128, 256)               \
+    X(plp_mat_mult_cmplx_stride_f32_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_cmplx_stride_i16_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_cmplx_stride_i32_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_cmplx_stride_i8_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_cmplx_stride_q16_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_cmplx_stride_q32_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_cmplx_stride_q8_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_f16_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_f32_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_i16_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_i32_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_i8_parallel, 64, 128, 256)                     \
+    X(plp_mat_mult_i8xi16_parallel, 64, 128, 256)                 \
+    X(plp_mat_mult_packed_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_packed_i8_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_q16_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_q32_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_q8_parallel, 64, 128, 256)                     \
+    X(plp_mat_mult_requant_i8_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_requant_q16_parallel, 64, 128, 256)            \
+    X(plp_mat_mult_requant_q32_parallel, 64, 128, 256)            \
+    X(plp_mat_mult_stride_f16_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_stride_f32_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_stride_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_stride_i32_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_stride_i8_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_stride_i8xi16_parallel, 64, 128, 256)          \
+    X(plp_mat_mult_stride_q16_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_stride_q32_parallel, 64, 128, 256)             \
+    X(plp_mat_mult_stride_q8_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_ter_parallel, 64, 128, 256)                    \
+    X(plp_mat_mult_trans_cmplx_f32_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_trans_cmplx_i16_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_trans_cmplx_i32_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_trans_cmplx_i8_parallel, 64, 128, 256)         \
+    X(plp_mat_mult_trans_cmplx_q16_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_trans_cmplx_q32_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_trans_cmplx_q8_parallel, 64, 128, 256)         \
+    X(plp_mat_mult_trans_cmplx_stride_f32_parallel, 64, 128, 256) \
+    X(plp_mat_mult_trans_cmplx_stride_i16_parallel, 64, 128, 256) \
+    X(plp_mat_mult_trans_cmplx_stride_i32_parallel, 64, 128, 256) \
+    X(plp_mat_mult_trans_cmplx_stride_i8_parallel, 64, 128, 256)  \
+    X(plp_mat_mult_trans_cmplx_stride_q16_parallel, 64, 128, 256) \
+    X(plp_mat_mult_trans_cmplx_stride_q32_parallel, 64, 128, 256) \
+    X(plp_mat_mult_trans_cmplx_stride_q8_parallel, 64, 128, 256)  \
+    X(plp_mat_mult_trans_f32_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_trans_i16_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_trans_i32_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_trans_i8_parallel, 64, 128, 256)               \
+    X(plp_mat_mult_trans_q16_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_trans_q32_parallel, 64, 128, 256)              \
+    X(plp_mat_mult_trans_q8_parallel, 64, 128, 256)               \
+    X(plp_mat_mult_trans_stride_f32_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_trans_stride_i16_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_trans_stride_i32_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_trans_stride_i8_parallel, 64, 128, 256)        \
+    X(plp_mat_mult_trans_stride_q16_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_trans_stride_q32_parallel, 64, 128, 256)       \
+    X(plp_mat_mult_trans_stride_q8_parallel, 64, 128, 256)        \
+    X(plp_mat_norm_fro_stride_f32_parallel, 64, 128, 256)         \
+    X(plp_mat_norm_fro_stride_i16_parallel, 64, 128, 256)         \
+    X(plp_mat_norm_fro_stride_i8_parallel, 64, 128, 256)          \
+    X(plp_mat_norm_inf_stride_f32_parallel, 64, 128, 256)         \
+    X(plp_mat_norm_inf_stride_i16_parallel, 64, 128, 256)         \
+    X(plp_mat_norm_inf_stride_i8_parallel, 64, 128, 256)          \
+    X(plp_mat_norm_one_stride_f32_parallel, 64, 128, 256)         \
+    X(plp_mat_norm_one_stride_i16_parallel, 64, 128, 256)         \
+    X(plp_mat_norm_one_stride_i8_parallel, 64, 128, 256)          \
+    X(plp_mat_outer_f32_parallel, 64, 128, 256)                   \
+    X(plp_mat_outer_i16_parallel, 64, 128, 256)                   \
+    X(plp_mat_outer_i32_parallel, 64, 128, 256)                   \
+    X(plp_mat_outer_i8_parallel, 64, 128, 256)                    \
+    X(plp_mat_qr_cmplx_f32_parallel, 64, 128, 256)                \
+    X(plp_mat_qr_f32_parallel, 64, 128, 256)                      \
+    X(plp_mat_rank1_update_f32_parallel, 64, 128, 256)            \
+    X(plp_mat_rank1_update_i16_parallel, 64, 128, 256)            \
+    X(plp_mat_rank1_update_i32_parallel, 64, 128, 256)            \
+    X(plp_mat_rank1_update_i8_parallel, 64, 128, 256)             \
+    X(plp_mat_scale_f32_parallel, 64, 128, 256)                   \
+    X(plp_mat_scale_i16_parallel, 64, 128, 256)                   \
+    X(plp_mat_scale_i32_parallel, 64, 128, 256)                   \
+    X(plp_mat_scale_i8_parallel, 64, 128, 256)                    \
+    X(plp_mat_scale_inplace_f32_parallel, 64, 128, 256)           \
+    X(plp_mat_scale_inplace_i16_parallel, 64, 128, 256)           \
+    X(plp_mat_scale_inplace_i32_parallel, 64, 128, 256)           \
+    X(plp_mat_scale_inplace_i8_parallel, 64, 128, 256)            \
+    X(plp_mat_scale_stride_f32_parallel, 64, 128, 256)            \
+    X(plp_mat_scale_stride_i16_parallel, 64, 128, 256)            \
+    X(plp_mat_scale_stride_i32_parallel, 64, 128, 256)            \
+    X(plp_mat_scale_stride_i8_parallel, 64, 128, 256)             \
+    X(plp_mat_solve_tri_lower_f32_parallel, 64, 128, 256)         \
+    X(plp_mat_solve_tri_lower_q32_parallel, 64, 128, 256)         \
+    X(plp_mat_solve_tri_lower_stride_f32_parallel, 64, 128, 256)  \
+    X(plp_mat_solve_tri_lower_stride_q32_parallel, 64, 128, 256)  \
+    X(plp_mat_solve_tri_upper_f32_parallel, 64, 128, 256)         \
+    X(plp_mat_solve_tri_upper_q32_parallel, 64, 128, 256)         \
+    X(plp_mat_solve_tri_upper_stride_f32_parallel, 64, 128, 256)  \
+    X(plp_mat_solve_tri_upper_stride_q32_parallel, 64, 128, 256)  \
+    X(plp_mat_sub_f32_parallel, 64, 128, 256)                     \
+    X(plp_mat_sub_i16_parallel, 64, 128, 256)                     \
+    X(plp_mat_sub_i32_parallel, 64, 128, 256)                     \
+    X(plp_mat_sub_i8_parallel, 64, 128, 256)                      \
+    X(plp_mat_sub_inplace_f32_parallel, 64, 128, 256)             \
+    X(plp_mat_sub_inplace_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_sub_inplace_i32_parallel, 64, 128, 256)             \
+    X(plp_mat_sub_inplace_i8_parallel, 64, 128, 256)              \
+    X(plp_mat_sub_stride_f32_parallel, 64, 128, 256)              \
+    X(plp_mat_sub_stride_i16_parallel, 64, 128, 256)              \
+    X(plp_mat_sub_stride_i32_parallel, 64, 128, 256)              \
+    X(plp_mat_sub_stride_i8_parallel, 64, 128, 256)               \
+    X(plp_mat_syrk_f32_parallel, 64, 128, 256)                    \
+    X(plp_mat_syrk_i16_parallel, 64, 128, 256)                    \
+    X(plp_mat_syrk_q16_parallel, 64, 128, 256)                    \
+    X(plp_mat_trans_cmplx_f32_parallel, 64, 128, 256)             \
+    X(plp_mat_trans_cmplx_i16_parallel, 64, 128, 256)             \
+    X(plp_mat_trans_cmplx_i32_parallel, 64, 128, 256)             \
+    X(plp_mat_trans_cmplx_q16_parallel, 64, 128, 256)             \
+    X(plp_mat_trans_cmplx_stride_f32_parallel, 64, 128, 256)      \
+    X(plp_mat_trans_cmplx_stride_i16_parallel, 64, 128, 256)      \
+    X(plp_mat_trans_cmplx_stride_i32_parallel, 64, 128, 256)      \
+    X(plp_mat_trans_cmplx_stride_q16_parallel, 64, 128, 256)      \
+    X(plp_mat_trans_f32_parallel, 64, 128, 256)                   \
+    X(plp_mat_trans_i16_parallel, 64, 128, 256)                   \
+    X(plp_mat_trans_i32_parallel, 64, 128, 256)                   \
+    X(plp_mat_trans_i8_parallel, 64, 128, 256)                    \
+    X(plp_mat_trans_stride_f32_parallel, 64, 128, 256)            \
+    X(plp_mat_trans_stride_i16_parallel, 64, 128, 256)            \
+    X(plp_mat_trans_stride_i32_parallel, 64, 128, 256)            \
+    X(plp_mat_trans_stride_i8_parallel, 64, 128, 256)             \
+    X(plp_mat_trans_vec_mult_f32_parallel, 64, 128, 256)          \
+    X(plp_mat_trans_vec_mult_i16_parallel, 64, 128, 256)          \
+    X(plp_mat_trans_vec_mult_i32_parallel, 64, 128, 256)          \
+    X(plp_mat_trans_vec_mult_i8_parallel, 64, 128, 256)           \
+    X(plp_mat_trans_vec_mult_q16_parallel, 64, 128, 256)          \
+    X(plp_mat_trans_vec_mult_q32_parallel, 64, 128, 256)          \
+    X(plp_mat_trans_vec_mult_q8_parallel, 64, 128, 256)           \
+    X(plp_mat_vec_mult_cmplx_f32_parallel, 64, 128, 256)          \
+    X(plp_mat_vec_mult_cmplx_q16_parallel, 64, 128, 256)          \
+    X(plp_mat_vec_mult_compressed_i8_parallel, 64, 128, 256)      \
+    X(plp_mat_vec_mult_f32_parallel, 64, 128, 256)                \
+    X(plp_mat_vec_mult_i16_parallel, 64, 128, 256)                \
+    X(plp_mat_vec_mult_i32_parallel, 64, 128, 256)                \
+    X(plp_mat_vec_mult_i8_parallel, 64, 128, 256)                 \
+    X(plp_mat_vec_mult_i8xi16_parallel, 64, 128, 256)             \
+    X(plp_mat_vec_mult_q16_parallel, 64, 128, 256)                \
+    X(plp_mat_vec_mult_q32_parallel, 64, 128, 256)                \
+    X(plp_mat_vec_mult_q8_parallel, 64, 128, 256)                 \
+    X(plp_max_f32_parallel, 64, 128, 256)                         \
+    X(plp_max_i16_parallel, 64, 128, 256)                         \
+    X(plp_max_i32_parallel, 64, 128, 256)                         \
+    X(plp_max_i8_parallel, 64, 128, 256)                          \
+    X(plp_max_idx_f32_parallel, 64, 128, 256)                     \
+    X(plp_max_idx_i16_parallel, 64, 128, 256)                     \
+    X(plp_max_idx_i32_parallel, 64, 128, 256)                     \
+    X(plp_max_idx_i8_parallel, 64, 128, 256)                      \
+    X(plp_maxpool_i8_parallel, 64, 128, 256)                      \
+    X(plp_mean_f32_parallel, 64, 128, 256)                        \
+    X(plp_mean_i16_parallel, 64, 128, 256)                        \
+    X(plp_mean_i32_parallel, 64, 128, 256)                        \
+    X(plp_mean_i8_parallel, 64, 128, 256)                         \
+    X(plp_median_filter_f32_parallel, 64, 128, 256)               \
+    X(plp_median_filter_i16_parallel, 64, 128, 256)               \
+    X(plp_min_f32_parallel, 64, 128, 256)                         \
+    X(plp_min_i16_parallel, 64, 128, 256)                         \
+    X(plp_min_i32_parallel, 64, 128, 256)                         \
+    X(plp_min_i8_parallel, 64, 128, 256)                          \
+    X(plp_min_idx_f32_parallel, 64, 128, 256)                     \
+    X(plp_min_idx_i16_parallel, 64, 128, 256)                     \
+    X(plp_min_idx_i32_parallel, 64, 128, 256)                     \
+    X(plp_min_idx_i8_parallel, 64, 128, 256)                      \
+    X(plp_mult_f32_parallel, 64, 128, 256)                        \
+    X(plp_mult_i16_parallel, 64, 128, 256)                        \
+    X(plp_mult_i32_parallel, 64, 128, 256)                        \
+    X(plp_mult_i8_parallel, 64, 128, 256)                         \
+    X(plp_mult_q16_parallel, 64, 128, 256)                        \
+    X(plp_mult_q32_parallel, 64, 128, 256)                        \
+    X(plp_mult_q8_parallel, 64, 128, 256)                         \
+    X(plp_ncc_f32_parallel, 64, 128, 256)                         \
+    X(plp_ncc_i16_parallel, 64, 128, 256)                         \
+    X(plp_negate_f32_parallel, 64, 128, 256)                      \
+    X(plp_negate_i16_parallel, 64, 128, 256)                      \
+    X(plp_negate_i32_parallel, 64, 128, 256)                      \
+    X(plp_negate_i8_parallel, 64, 128, 256)                       \
+    X(plp_normalize_l2_rows_f32_parallel, 64, 128, 256)           \
+    X(plp_normalize_l2_rows_q16_parallel, 64, 128, 256)           \
+    X(plp_offset_f32_parallel, 64, 128, 256)                      \
+    X(plp_offset_i16_parallel, 64, 128, 256)                      \
+    X(plp_offset_i32_parallel, 64, 128, 256)                      \
+    X(plp_offset_i8_parallel, 64, 128, 256)                       \
+    X(plp_pow2_f32_vec_parallel, 64, 128, 256)                    \
+    X(plp_pow2_q16_vec_parallel, 64, 128, 256)                    \
+    X(plp_power_f32_parallel, 64, 128, 256)                       \
+    X(plp_power_i16_parallel, 64, 128, 256)                       \
+    X(plp_power_i32_parallel, 64, 128, 256)                       \
+    X(plp_power_i8_parallel, 64, 128, 256)                        \
+    X(plp_power_q16_parallel, 64, 128, 256)                       \
+    X(plp_power_q32_parallel, 64, 128, 256)                       \
+    X(plp_power_q8_parallel, 64, 128, 256)                        \
+    X(plp_q16_to_f32_parallel, 64, 128, 256)                      \
+    X(plp_q32_to_f32_parallel, 64, 128, 256)                      \
+    X(plp_q8_to_f32_parallel, 64, 128, 256)                       \
+    X(plp_quantize_f32_i8_parallel, 64, 128, 256)                 \
+    X(plp_recip_q16_parallel, 64, 128, 256)                       \
+    X(plp_recip_q32_parallel, 64, 128, 256)                       \
+    X(plp_requantize_i32_i8_parallel, 64, 128, 256)               \
+    X(plp_rms_f32_parallel, 64, 128, 256)                         \
+    X(plp_rms_q16_parallel, 64, 128, 256)                         \
+    X(plp_rms_q32_parallel, 64, 128, 256)                         \
+    X(plp_rms_q8_parallel, 64, 128, 256)                          \
+    X(plp_scale_f32_parallel, 64, 128, 256)                       \
+    X(plp_scale_i16_parallel, 64, 128, 256)                       \
+    X(plp_scale_i32_parallel, 64, 128, 256)                       \
+    X(plp_scale_i8_parallel, 64, 128, 256)                        \
+    X(plp_scale_q16_parallel, 64, 128, 256)                       \
+    X(plp_scale_q32_parallel, 64, 128, 256)                       \
+    X(plp_scale_q8_parallel, 64, 128, 256)                        \
+    X(plp_shift_i16_parallel, 64, 128, 256)                       \
+    X(plp_shift_i32_parallel, 64, 128, 256)                       \
+    X(plp_shift_i8_parallel, 64, 128, 256)                        \
+    X(plp_sin_f32_vec_parallel, 64, 128, 256)                     \
+    X(plp_sin_q16_vec_parallel, 64, 128, 256)                     \
+    X(plp_sin_q32_vec_parallel, 64, 128, 256)                     \
+    X(plp_sincos_f32_parallel, 64, 128, 256)                      \
+    X(plp_sincos_q16_parallel, 64, 128, 256)                      \
+    X(plp_sincos_q32_parallel, 64, 128, 256)                      \
+    X(plp_softmax_f32_parallel, 64, 128, 256)                     \
+    X(plp_softmax_q16_parallel, 64, 128, 256)                     \
+    X(plp_sort_f32_parallel, 64, 128, 256)                        \
+    X(plp_sort_i16_parallel, 64, 128, 256)                        \
+    X(plp_sort_i32_parallel, 64, 128, 256)                        \
+    X(plp_spmv_f32_parallel, 64, 128, 256)                        \
+    X(plp_spmv_i16_parallel, 64, 128, 256)                        \
+    X(plp_spmv_i8_parallel, 64, 128, 256)                         \
+    X(plp_stats_summary_f32_parallel, 64, 128, 256)               \
+    X(plp_stats_summary_i16_parallel, 64, 128, 256)               \
+    X(plp_stats_summary_i32_parallel, 64, 128, 256)               \
+    X(plp_stats_summary_i8_parallel, 64, 128, 256)                \
+    X(plp_std_f32_parallel, 64, 128, 256)                         \
+    X(plp_std_q16_parallel, 64, 128, 256)                         \
+    X(plp_std_q32_parallel, 64, 128, 256)                         \
+    X(plp_std_q8_parallel, 64, 128, 256)                          \
+    X(plp_stream_apply_binary, 64, 128, 256)                      \
+    X(plp_stream_apply_unary, 64, 128, 256)                       \
+    X(plp_sub_f32_parallel, 64, 128, 256)                         \
+    X(plp_sub_i16_parallel, 64, 128, 256)                         \
+    X(plp_sub_i32_parallel, 64, 128, 256)                         \
+    X(plp_sub_i8_parallel, 64, 128, 256)                          \
+    X(plp_sub_q16_parallel, 64, 128, 256)                         \
+    X(plp_sub_q32_parallel, 64, 128, 256)                         \
+    X(plp_sub_q8_parallel, 64, 128, 256)                          \
+    X(plp_var_f32_parallel, 64, 128, 256)                         \
+    X(plp_var_q16_parallel, 64, 128, 256)                         \
+    X(plp_var_q32_parallel, 64, 128, 256)                         \
+    X(plp_var_q8_parallel, 64, 128, 256)                          \
+    X(plp_vq_nearest_f32_parallel, 64, 128, 256)                  \
+    X(plp_vq_nearest_i16_parallel, 64, 128, 256)                  \
+    X(plp_vq_nearest_i8_parallel, 64, 128, 256)
+
+#endif // __PLP_AUTO_TABLE_H__
@@ -0,0 +1,6088 @@
+/** ==========================================================================
+ * @file     plp_basic_math.h
+ * @brief    Basic math functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_BASIC_MATH_H__
+#define __PLP_BASIC_MATH_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @struct plp_dot_prod_instance_i32
+    @brief Instance structure for integer parallel dot product.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer
+*/
+typedef struct {
+    int32_t *pSrcA;     // pointer to the first vector
+    int32_t *pSrcB;     // pointer to the second vector
+    uint32_t blkSizePE; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+    int32_t *resBuffer; // pointer to result vector
+} plp_dot_prod_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for fixed point parallel dot product.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer
+*/
+typedef struct {
+    int32_t *pSrcA;     // pointer to the first vector
+    int32_t *pSrcB;     // pointer to the second vector
+    uint32_t blkSizePE; // number of samples in each vector
+    uint32_t deciPoint; // decimal point for right shift
+    uint32_t nPE;       // number of processing units
+    int32_t *resBuffer; // pointer to result vector
+} plp_dot_prod_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_dot_prod_instance_f32
+    @brief Instance structure for float parallel dot product.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first vector
+    const float32_t *pSrcB; // pointer to the second vector
+    uint32_t blkSizePE;     // number of samples in each vector
+    uint32_t nPE;           // number of processing units
+    float32_t *resBuffer;   // pointer to result vector
+} plp_dot_prod_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_dot_prod_instance_i16
+    @brief Instance structure for the parallel dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  points to the buffer of the partial results
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first vector
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *resBuffer;   // pointer to the partial results
+} plp_dot_prod_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_dot_prod_instance_q16
+    @brief Instance structure for the parallel dot product of 16-bit fixed-point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  points to the buffer of the partial results
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first vector
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t nPE;         // number of processing units
+    int32_t *resBuffer;   // pointer to the partial results
+} plp_dot_prod_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_dot_prod_instance_i8
+    @brief Instance structure for the parallel dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  points to the buffer of the partial results
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first vector
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *resBuffer;  // pointer to the partial results
+} plp_dot_prod_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_dot_prod_instance_q8
+    @brief Instance structure for the parallel dot product of 8-bit fixed-point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  points to the buffer of the partial results
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first vector
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t deciPoint;  // decimal point for right shift
+    uint32_t nPE;        // number of processing units
+    int32_t *resBuffer;  // pointer to the partial results
+} plp_dot_prod_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_abs_instance_i8
+    @brief Instance structure for the parallel element-by-element absolute value of 8-bit integer
+           vectors.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_abs_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_abs_instance_i16
+    @brief Instance structure for the parallel element-by-element absolute value of 16-bit integer
+           vectors.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_abs_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_abs_instance_i32
+    @brief Instance structure for the parallel element-by-element absolute value of 32-bit integer
+           vectors.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_abs_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_abs_instance_f32
+    @brief Instance structure for the parallel element-by-element absolute value of 32-bit
+           floating-point vectors.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_abs_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_i8
+    @brief Instance structure for the parallel element-by-element addition of 8-bit integer vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first input vector
+    const int8_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_add_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_i16
+    @brief Instance structure for the parallel element-by-element addition of 16-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first input vector
+    const int16_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_add_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_i32
+    @brief Instance structure for the parallel element-by-element addition of 32-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first input vector
+    const int32_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_add_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_f32
+    @brief Instance structure for the parallel element-by-element addition of 32-bit floating-point
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first input vector
+    const float32_t *pSrcB; // pointer to the second input vector
+    float32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;     // number of samples in each vector
+    uint32_t nPE;           // number of processing units
+} plp_add_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_i8
+    @brief Instance structure for the parallel element-by-element multiplication of 8-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first input vector
+    const int8_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_mult_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_i16
+    @brief Instance structure for the parallel element-by-element multiplication of 16-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first input vector
+    const int16_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_mult_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_i32
+    @brief Instance structure for the parallel element-by-element multiplication of 32-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first input vector
+    const int32_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_mult_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_f32
+    @brief Instance structure for the parallel element-by-element multiplication of 32-bit
+           floating-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first input vector
+    const float32_t *pSrcB; // pointer to the second input vector
+    float32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;     // number of samples in each vector
+    uint32_t nPE;           // number of processing units
+} plp_mult_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_i8
+    @brief Instance structure for the parallel element-by-element subtraction of 8-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first input vector
+    const int8_t *pSrcB; // pointer to the second input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_sub_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_i16
+    @brief Instance structure for the parallel element-by-element subtraction of 16-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first input vector
+    const int16_t *pSrcB; // pointer to the second input vector
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_sub_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_i32
+    @brief Instance structure for the parallel element-by-element subtraction of 32-bit integer
+           vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first input vector
+    const int32_t *pSrcB; // pointer to the second input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_sub_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_f32
+    @brief Instance structure for the parallel element-by-element subtraction of 32-bit
+           floating-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first input vector
+    const float32_t *pSrcB; // pointer to the second input vector
+    float32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;     // number of samples in each vector
+    uint32_t nPE;           // number of processing units
+} plp_sub_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_i8
+    @brief Instance structure for the parallel scaling of an 8-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int8_t scaleFactor; // scale factor
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_scale_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_i16
+    @brief Instance structure for the parallel scaling of a 16-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t scaleFactor; // scale factor
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_scale_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_i32
+    @brief Instance structure for the parallel scaling of a 32-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t scaleFactor; // scale factor
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_scale_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_f32
+    @brief Instance structure for the parallel scaling of a 32-bit floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t scaleFactor; // scale factor
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_scale_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_q8
+    @brief Instance structure for the parallel scaling of an 8-bit fixed-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int8_t scaleFactor; // scale factor
+    uint32_t deciPoint; // decimal point for right shift
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_scale_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_q16
+    @brief Instance structure for the parallel scaling of a 16-bit fixed-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t scaleFactor; // scale factor
+    uint32_t deciPoint;  // decimal point for right shift
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_scale_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_q32
+    @brief Instance structure for the parallel scaling of a 32-bit fixed-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  scaleFactor value the input vector is multiplied with
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t scaleFactor; // scale factor
+    uint32_t deciPoint;  // decimal point for right shift
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_scale_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_negate_instance_i8
+    @brief Instance structure for the parallel negation of an 8-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_negate_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_negate_instance_i16
+    @brief Instance structure for the parallel negation of a 16-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_negate_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_negate_instance_i32
+    @brief Instance structure for the parallel negation of a 32-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_negate_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_negate_instance_f32
+    @brief Instance structure for the parallel negation of a 32-bit floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_negate_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_offset_instance_i8
+    @brief Instance structure for the parallel offset of an 8-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  offset      value added to each sample
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int8_t offset;      // offset
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_offset_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_offset_instance_i16
+    @brief Instance structure for the parallel offset of a 16-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  offset      value added to each sample
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t offset;      // offset
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_offset_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_offset_instance_i32
+    @brief Instance structure for the parallel offset of a 32-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  offset      value added to each sample
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t offset;      // offset
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_offset_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_offset_instance_f32
+    @brief Instance structure for the parallel offset of a 32-bit floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  offset      value added to each sample
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t offset;      // offset
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_offset_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cumsum_instance_i16
+    @brief Instance structure for the parallel cumulative sum of a 16-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pPartial    sums of the blocks of the cores, one element per core
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pPartial;   // sums of the blocks
+} plp_cumsum_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cumsum_instance_i32
+    @brief Instance structure for the parallel cumulative sum of a 32-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pPartial    sums of the blocks of the cores, one element per core
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pPartial;   // sums of the blocks
+} plp_cumsum_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cumsum_instance_f32
+    @brief Instance structure for the parallel cumulative sum of a 32-bit floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pPartial    sums of the blocks of the cores, one element per core
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+    float32_t *pPartial;   // sums of the blocks
+} plp_cumsum_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_integral_image_instance_i16
+    @brief Instance structure for the parallel integral image of a 16-bit integer image.
+    @param[in]  pSrc        points to the input image
+    @param[in]  M           number of rows of the image
+    @param[in]  N           number of columns of the image
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output integral image
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input image
+    uint32_t M;          // number of rows
+    uint32_t N;          // number of columns
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output integral image
+} plp_integral_image_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_integral_image_instance_i32
+    @brief Instance structure for the parallel integral image of a 32-bit integer image.
+    @param[in]  pSrc        points to the input image
+    @param[in]  M           number of rows of the image
+    @param[in]  N           number of columns of the image
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output integral image
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input image
+    uint32_t M;          // number of rows
+    uint32_t N;          // number of columns
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output integral image
+} plp_integral_image_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_integral_image_instance_f32
+    @brief Instance structure for the parallel integral image of a 32-bit floating-point image.
+    @param[in]  pSrc        points to the input image
+    @param[in]  M           number of rows of the image
+    @param[in]  N           number of columns of the image
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output integral image
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input image
+    uint32_t M;            // number of rows
+    uint32_t N;            // number of columns
+    uint32_t nPE;          // number of processing units
+    float32_t *pDst;       // pointer to the output integral image
+} plp_integral_image_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_shift_instance_i8
+    @brief Instance structure for the parallel shift of an 8-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shiftBits   number of bits to shift, left if positive, right if negative
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int32_t shiftBits;  // number of bits to shift
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_shift_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_shift_instance_i16
+    @brief Instance structure for the parallel shift of a 16-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shiftBits   number of bits to shift, left if positive, right if negative
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int32_t shiftBits;   // number of bits to shift
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_shift_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_shift_instance_i32
+    @brief Instance structure for the parallel shift of a 32-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shiftBits   number of bits to shift, left if positive, right if negative
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t shiftBits;   // number of bits to shift
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_shift_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_clip_instance_i8
+    @brief Instance structure for the parallel clipping of an 8-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  low         lower bound of the output
+    @param[in]  high        upper bound of the output
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    int8_t low;         // lower bound
+    int8_t high;        // upper bound
+    int8_t *pDst;       // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_clip_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_clip_instance_i16
+    @brief Instance structure for the parallel clipping of a 16-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  low         lower bound of the output
+    @param[in]  high        upper bound of the output
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t low;         // lower bound
+    int16_t high;        // upper bound
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_clip_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_clip_instance_i32
+    @brief Instance structure for the parallel clipping of a 32-bit integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  low         lower bound of the output
+    @param[in]  high        upper bound of the output
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t low;         // lower bound
+    int32_t high;        // upper bound
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_clip_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_clip_instance_f32
+    @brief Instance structure for the parallel clipping of a 32-bit floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  low         lower bound of the output
+    @param[in]  high        upper bound of the output
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t low;         // lower bound
+    float32_t high;        // upper bound
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_clip_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_q8
+    @brief Instance structure for the parallel element-by-element saturating addition of 8-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first input vector
+    const int8_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;  // decimal point for right shift
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_add_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_q16
+    @brief Instance structure for the parallel element-by-element saturating addition of 16-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first input vector
+    const int16_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;   // decimal point for right shift
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_add_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_q32
+    @brief Instance structure for the parallel element-by-element saturating addition of 32-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first input vector
+    const int32_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;   // decimal point for right shift
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_add_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_q8
+    @brief Instance structure for the parallel element-by-element saturating subtraction of 8-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first input vector
+    const int8_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;  // decimal point for right shift
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_sub_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_q16
+    @brief Instance structure for the parallel element-by-element saturating subtraction of 16-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first input vector
+    const int16_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;   // decimal point for right shift
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_sub_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_sub_instance_q32
+    @brief Instance structure for the parallel element-by-element saturating subtraction of 32-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first input vector
+    const int32_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;   // decimal point for right shift
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_sub_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_q8
+    @brief Instance structure for the parallel element-by-element saturating multiplication of 8-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first input vector
+    const int8_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;  // decimal point for right shift
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_mult_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_q16
+    @brief Instance structure for the parallel element-by-element saturating multiplication of
+           16-bit fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first input vector
+    const int16_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;   // decimal point for right shift
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_mult_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_mult_instance_q32
+    @brief Instance structure for the parallel element-by-element saturating multiplication of
+           32-bit fixed-point vectors.
+    @param[in]  pSrcA       points to first input vector
+    @param[in]  pSrcB       points to second input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first input vector
+    const int32_t *pSrcB; // pointer to the second input vector
+    uint32_t deciPoint;   // decimal point for right shift
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+} plp_mult_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 32-bit integer vectors kernel for XPULPV2
+    extension.
+    @param[in]  S     points to the instance structure for integer parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 32-bit fixed point vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for fixed point parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_q32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 32-bit float vectors kernel for XPULPV2
+    extension.
+    @param[in]  S     points to the instance structure for float parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 16-bit integer vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for the parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 16-bit fixed point vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for the parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_q16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 8-bit integer vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for the parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 8-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_q8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with contiguous chunks of 8-bit fixed point vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for the parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_q8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
+                      const float32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Dot product of 32-bit float vectors kernel for RV32IM extension, in fixed point (see
+           PLP_FC_FIXED_POINT).
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_rv32im(const float32_t *__restrict__ pSrcA,
+                              const float32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+void plp_dot_prod_i16(const int16_t *pSrcA,
+                      const int16_t *pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors.
+*/
+
+void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
+   extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8] bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of an 8-bit with a 16-bit integer vector, e.g. of 8-bit
+           weights with 16-bit activations.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i8xi16(const int8_t *__restrict__ pSrcA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of an 8-bit with a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i8xi16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                 const int16_t *__restrict__ pSrcB,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of an 8-bit with a 16-bit integer vector kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are sign-extended to vectors of 2 halfwords in registers and multiplied with
+    the 16-bit dot product instructions, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 4-bit integer vectors, packed 2 values per
+           byte (see plp_get_i4).
+    @param[in]  pSrcA      points to the first input vector [4 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [4 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i4(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 4-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [4 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [4 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i4s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 4-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [4 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [4 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i4s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+#if defined(PLP_XPULPNN)
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 4-bit integer vectors kernel for XpulpNN extension.
+    @param[in]  pSrcA      points to the first input vector [4 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [4 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i4s_xpulpnn(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+#endif // PLP_XPULPNN
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 2-bit integer vectors, packed 4 values per
+           byte (see plp_get_i2).
+    @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i2(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 2-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i2s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 2-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i2s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+#if defined(PLP_XPULPNN)
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 2-bit integer vectors kernel for XpulpNN extension.
+    @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_i2s_xpulpnn(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+#endif // PLP_XPULPNN
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of binary vectors.
+    @param[in]  pSrcA      points to the first input vector [1 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [1 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_bin(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of binary vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [1 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [1 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_bins_rv32im(const uint32_t *__restrict__ pSrcA,
+                              const uint32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of binary vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [1 bit, packed]
+    @param[in]  pSrcB      points to the second input vector [1 bit, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_bins_xpulpv2(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of ternary vectors.
+    @param[in]  pSrcA      points to the first input vector [2 bitplanes, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bitplanes, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_ter(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of ternary vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [2 bitplanes, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bitplanes, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_ters_rv32im(const uint32_t *__restrict__ pSrcA,
+                              const uint32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of ternary vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [2 bitplanes, packed]
+    @param[in]  pSrcB      points to the second input vector [2 bitplanes, packed]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+*/
+
+void plp_dot_prod_ters_xpulpv2(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     uint32_t deciPoint,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 32-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32(const int32_t * pSrc,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_rv32im(const int32_t * pSrc,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 16-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16(const int16_t * pSrc,
+                 int16_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_rv32im(const int16_t * pSrc,
+                         int16_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
+                          int16_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 8-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8(const int8_t * pSrc,
+                 int8_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_rv32im(const int8_t * pSrc,
+                         int8_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
+                          int8_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element absolute value of 8-bit integer vectors.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_abs_i8_parallel(const int8_t *pSrc,
+                         int8_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_abs_instance_i8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_abs_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element absolute value of 16-bit integer vectors.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_abs_i16_parallel(const int16_t *pSrc,
+                          int16_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_abs_instance_i16 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_abs_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element absolute value of 32-bit integer vectors.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_abs_i32_parallel(const int32_t *pSrc,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_abs_instance_i32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_abs_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element absolute value of 32-bit floating-point vectors.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_abs_f32(const float32_t *pSrc,
+                 float32_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element absolute value of 32-bit floating-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_abs_f32s_xpulpv2(const float32_t *pSrc,
+                          float32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element absolute value of 32-bit floating-point
+           vectors.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_abs_f32_parallel(const float32_t *pSrc,
+                          float32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element absolute value of 32-bit floating-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     args       points to the plp_abs_instance_f32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_abs_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element addition of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_i8_parallel(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element addition of 8-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_add_instance_i8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element addition of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_i16_parallel(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element addition of 16-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_add_instance_i16 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element addition of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_i32_parallel(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element addition of 32-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_add_instance_i32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the element-by-element addition of 8-bit integer vectors, which is split
+           between the cluster and the fabric controller.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of cluster cores, or PLP_AUTO
+    @param[in]     fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @return        none
+*/
+
+void plp_add_i8_hetero(const int8_t *pSrcA,
+                       const int8_t *pSrcB,
+                       int32_t *pDst,
+                       uint32_t blockSize,
+                       uint32_t nPE,
+                       uint32_t fcShare);
+
+/** -------------------------------------------------------
+    @brief Glue code for the element-by-element addition of 16-bit integer vectors, which is split
+           between the cluster and the fabric controller.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of cluster cores, or PLP_AUTO
+    @param[in]     fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @return        none
+*/
+
+void plp_add_i16_hetero(const int16_t *pSrcA,
+                        const int16_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        uint32_t fcShare);
+
+/** -------------------------------------------------------
+    @brief Glue code for the element-by-element addition of 32-bit integer vectors, which is split
+           between the cluster and the fabric controller.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of cluster cores, or PLP_AUTO
+    @param[in]     fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @return        none
+*/
+
+void plp_add_i32_hetero(const int32_t *pSrcA,
+                        const int32_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        uint32_t fcShare);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 32-bit floating-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_f32(const float32_t *pSrcA,
+                 const float32_t *pSrcB,
+                 float32_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit floating-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_f32s_xpulpv2(const float32_t *pSrcA,
+                          const float32_t *pSrcB,
+                          float32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element addition of 32-bit floating-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_f32_parallel(const float32_t *pSrcA,
+                          const float32_t *pSrcB,
+                          float32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element addition of 32-bit floating-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_add_instance_f32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element multiplication of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_i8_parallel(const int8_t *pSrcA,
+                          const int8_t *pSrcB,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_mult_instance_i8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element multiplication of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_i16_parallel(const int16_t *pSrcA,
+                           const int16_t *pSrcB,
+                           int32_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_mult_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element multiplication of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_i32_parallel(const int32_t *pSrcA,
+                           const int32_t *pSrcB,
+                           int32_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_mult_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit floating-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_f32(const float32_t *pSrcA,
+                  const float32_t *pSrcB,
+                  float32_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit floating-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_f32s_xpulpv2(const float32_t *pSrcA,
+                           const float32_t *pSrcB,
+                           float32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element multiplication of 32-bit floating-point
+           vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_f32_parallel(const float32_t *pSrcA,
+                           const float32_t *pSrcB,
+                           float32_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element multiplication of 32-bit floating-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     args       points to the plp_mult_instance_f32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element subtraction of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i8(const int8_t *pSrcA,
+                const int8_t *pSrcB,
+                int8_t *pDst,
+                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i8s_rv32im(const int8_t *pSrcA,
+                        const int8_t *pSrcB,
+                        int8_t *pDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i8s_xpulpv2(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         int8_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element subtraction of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_i8_parallel(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         int8_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element subtraction of 8-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_sub_instance_i8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element subtraction of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i16(const int16_t *pSrcA,
+                 const int16_t *pSrcB,
+                 int16_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i16s_rv32im(const int16_t *pSrcA,
+                         const int16_t *pSrcB,
+                         int16_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i16s_xpulpv2(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          int16_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element subtraction of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_i16_parallel(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          int16_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element subtraction of 16-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_sub_instance_i16 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element subtraction of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i32(const int32_t *pSrcA,
+                 const int32_t *pSrcB,
+                 int32_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i32s_rv32im(const int32_t *pSrcA,
+                         const int32_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_i32s_xpulpv2(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          int32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element subtraction of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_i32_parallel(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element subtraction of 32-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]     args       points to the plp_sub_instance_i32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element subtraction of 32-bit floating-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_f32(const float32_t *pSrcA,
+                 const float32_t *pSrcB,
+                 float32_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element subtraction of 32-bit floating-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_f32s_xpulpv2(const float32_t *pSrcA,
+                          const float32_t *pSrcB,
+                          float32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element subtraction of 32-bit floating-point
+           vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_f32_parallel(const float32_t *pSrcA,
+                          const float32_t *pSrcB,
+                          float32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element subtraction of 32-bit floating-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     args       points to the plp_sub_instance_f32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i8(const int8_t *pSrc,
+                  int8_t scaleFactor,
+                  int8_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of an 8-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i8s_rv32im(const int8_t *pSrc,
+                          int8_t scaleFactor,
+                          int8_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i8s_xpulpv2(const int8_t *pSrc,
+                           int8_t scaleFactor,
+                           int8_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_i8_parallel(const int8_t *pSrc,
+                           int8_t scaleFactor,
+                           int8_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_i8 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i16(const int16_t *pSrc,
+                   int16_t scaleFactor,
+                   int16_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i16s_rv32im(const int16_t *pSrc,
+                           int16_t scaleFactor,
+                           int16_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i16s_xpulpv2(const int16_t *pSrc,
+                            int16_t scaleFactor,
+                            int16_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_i16_parallel(const int16_t *pSrc,
+                            int16_t scaleFactor,
+                            int16_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i32(const int32_t *pSrc,
+                   int32_t scaleFactor,
+                   int32_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i32s_rv32im(const int32_t *pSrc,
+                           int32_t scaleFactor,
+                           int32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_i32s_xpulpv2(const int32_t *pSrc,
+                            int32_t scaleFactor,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_i32_parallel(const int32_t *pSrc,
+                            int32_t scaleFactor,
+                            int32_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_f32(const float32_t *pSrc,
+                   float32_t scaleFactor,
+                   float32_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_f32s_xpulpv2(const float32_t *pSrc,
+                            float32_t scaleFactor,
+                            float32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_f32_parallel(const float32_t *pSrc,
+                            float32_t scaleFactor,
+                            float32_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_f32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of an 8-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q8(const int8_t *pSrc,
+                  int8_t scaleFactor,
+                  uint32_t deciPoint,
+                  int8_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of an 8-bit fixed-point vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q8s_rv32im(const int8_t *pSrc,
+                          int8_t scaleFactor,
+                          uint32_t deciPoint,
+                          int8_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of an 8-bit fixed-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q8s_xpulpv2(const int8_t *pSrc,
+                           int8_t scaleFactor,
+                           uint32_t deciPoint,
+                           int8_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of an 8-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_q8_parallel(const int8_t *pSrc,
+                           int8_t scaleFactor,
+                           uint32_t deciPoint,
+                           int8_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of an 8-bit fixed-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_q8 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of a 16-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q16(const int16_t *pSrc,
+                   int16_t scaleFactor,
+                   uint32_t deciPoint,
+                   int16_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 16-bit fixed-point vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q16s_rv32im(const int16_t *pSrc,
+                           int16_t scaleFactor,
+                           uint32_t deciPoint,
+                           int16_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 16-bit fixed-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q16s_xpulpv2(const int16_t *pSrc,
+                            int16_t scaleFactor,
+                            uint32_t deciPoint,
+                            int16_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of a 16-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_q16_parallel(const int16_t *pSrc,
+                            int16_t scaleFactor,
+                            uint32_t deciPoint,
+                            int16_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of a 16-bit fixed-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_q16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for scaling of a 32-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q32(const int32_t *pSrc,
+                   int32_t scaleFactor,
+                   uint32_t deciPoint,
+                   int32_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 32-bit fixed-point vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q32s_rv32im(const int32_t *pSrc,
+                           int32_t scaleFactor,
+                           uint32_t deciPoint,
+                           int32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Scaling of a 32-bit fixed-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_scale_q32s_xpulpv2(const int32_t *pSrc,
+                            int32_t scaleFactor,
+                            uint32_t deciPoint,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel scaling of a 32-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     scaleFactor value the input vector is multiplied with
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_scale_q32_parallel(const int32_t *pSrc,
+                            int32_t scaleFactor,
+                            uint32_t deciPoint,
+                            int32_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of a 32-bit fixed-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_scale_instance_q32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_scale_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for negation of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i8(const int8_t *pSrc,
+                   int8_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of an 8-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i8s_rv32im(const int8_t *pSrc,
+                           int8_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i8s_xpulpv2(const int8_t *pSrc,
+                            int8_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel negation of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_negate_i8_parallel(const int8_t *pSrc,
+                            int8_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_negate_instance_i8 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_negate_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for negation of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i16(const int16_t *pSrc,
+                    int16_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i16s_rv32im(const int16_t *pSrc,
+                            int16_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i16s_xpulpv2(const int16_t *pSrc,
+                             int16_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel negation of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_negate_i16_parallel(const int16_t *pSrc,
+                             int16_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_negate_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_negate_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for negation of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i32(const int32_t *pSrc,
+                    int32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i32s_rv32im(const int32_t *pSrc,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_i32s_xpulpv2(const int32_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel negation of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_negate_i32_parallel(const int32_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_negate_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_negate_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for negation of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_f32(const float32_t *pSrc,
+                    float32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Negation of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_negate_f32s_xpulpv2(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel negation of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_negate_f32_parallel(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_negate_instance_f32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_negate_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for offset of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i8(const int8_t *pSrc,
+                   int8_t offset,
+                   int8_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of an 8-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i8s_rv32im(const int8_t *pSrc,
+                           int8_t offset,
+                           int8_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i8s_xpulpv2(const int8_t *pSrc,
+                            int8_t offset,
+                            int8_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel offset of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_offset_i8_parallel(const int8_t *pSrc,
+                            int8_t offset,
+                            int8_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_offset_instance_i8 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_offset_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for offset of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i16(const int16_t *pSrc,
+                    int16_t offset,
+                    int16_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i16s_rv32im(const int16_t *pSrc,
+                            int16_t offset,
+                            int16_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i16s_xpulpv2(const int16_t *pSrc,
+                             int16_t offset,
+                             int16_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel offset of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_offset_i16_parallel(const int16_t *pSrc,
+                             int16_t offset,
+                             int16_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_offset_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_offset_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for offset of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i32(const int32_t *pSrc,
+                    int32_t offset,
+                    int32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i32s_rv32im(const int32_t *pSrc,
+                            int32_t offset,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_i32s_xpulpv2(const int32_t *pSrc,
+                             int32_t offset,
+                             int32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel offset of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_offset_i32_parallel(const int32_t *pSrc,
+                             int32_t offset,
+                             int32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_offset_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_offset_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for offset of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_f32(const float32_t *pSrc,
+                    float32_t offset,
+                    float32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Offset of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_offset_f32s_xpulpv2(const float32_t *pSrc,
+                             float32_t offset,
+                             float32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel offset of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     offset     value added to each sample
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_offset_f32_parallel(const float32_t *pSrc,
+                             float32_t offset,
+                             float32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_offset_instance_f32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_offset_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the cumulative sum of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, 32-bit
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_i16(const int16_t *pSrc,
+                    int32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Cumulative sum of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, 32-bit
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_i16s_rv32im(const int16_t *pSrc,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Cumulative sum of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, 32-bit
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_i16s_xpulpv2(const int16_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel cumulative sum of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, 32-bit
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_cumsum_i16_parallel(const int16_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel cumulative sum of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_cumsum_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_cumsum_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the cumulative sum of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_i32(const int32_t *pSrc,
+                    int32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Cumulative sum of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_i32s_rv32im(const int32_t *pSrc,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Cumulative sum of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_i32s_xpulpv2(const int32_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel cumulative sum of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_cumsum_i32_parallel(const int32_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel cumulative sum of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_cumsum_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_cumsum_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the cumulative sum of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_f32(const float32_t *pSrc,
+                    float32_t *pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Cumulative sum of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_cumsum_f32s_xpulpv2(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel cumulative sum of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector, may be equal to pSrc
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_cumsum_f32_parallel(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel cumulative sum of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_cumsum_instance_f32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_cumsum_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the integral image of a 16-bit integer image.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), 32-bit
+    @return        none
+*/
+
+void plp_integral_image_i16(const int16_t *pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Integral image of a 16-bit integer image kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), 32-bit
+    @return        none
+*/
+
+void plp_integral_image_i16s_rv32im(const int16_t *pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Integral image of a 16-bit integer image kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), 32-bit
+    @return        none
+*/
+
+void plp_integral_image_i16s_xpulpv2(const int16_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel integral image of a 16-bit integer image.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[in]     nPE        number of parallel processing units
+    @param[out]    pDst       points to the output integral image (M x N), 32-bit
+    @return        none
+*/
+
+void plp_integral_image_i16_parallel(const int16_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t nPE,
+                                     int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel integral image of a 16-bit integer image kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_integral_image_instance_i16 struct
+                              initialized by the glue code
+    @return        none
+*/
+
+void plp_integral_image_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the integral image of a 32-bit integer image.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_i32(const int32_t *pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Integral image of a 32-bit integer image kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_i32s_rv32im(const int32_t *pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Integral image of a 32-bit integer image kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_i32s_xpulpv2(const int32_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel integral image of a 32-bit integer image.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[in]     nPE        number of parallel processing units
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_i32_parallel(const int32_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t nPE,
+                                     int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel integral image of a 32-bit integer image kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_integral_image_instance_i32 struct
+                              initialized by the glue code
+    @return        none
+*/
+
+void plp_integral_image_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the integral image of a 32-bit floating-point image.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_f32(const float32_t *pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Integral image of a 32-bit floating-point image kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_f32s_xpulpv2(const float32_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel integral image of a 32-bit floating-point image.
+    @param[in]     pSrc       points to the input image (M x N)
+    @param[in]     M          number of rows of the image
+    @param[in]     N          number of columns of the image
+    @param[in]     nPE        number of parallel processing units
+    @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+    @return        none
+*/
+
+void plp_integral_image_f32_parallel(const float32_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t nPE,
+                                     float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel integral image of a 32-bit floating-point image kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_integral_image_instance_f32 struct
+                              initialized by the glue code
+    @return        none
+*/
+
+void plp_integral_image_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for shift of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i8(const int8_t *pSrc,
+                  int32_t shiftBits,
+                  int8_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Shift of an 8-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i8s_rv32im(const int8_t *pSrc,
+                          int32_t shiftBits,
+                          int8_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Shift of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i8s_xpulpv2(const int8_t *pSrc,
+                           int32_t shiftBits,
+                           int8_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel shift of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_shift_i8_parallel(const int8_t *pSrc,
+                           int32_t shiftBits,
+                           int8_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel shift of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_shift_instance_i8 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_shift_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for shift of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i16(const int16_t *pSrc,
+                   int32_t shiftBits,
+                   int16_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Shift of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i16s_rv32im(const int16_t *pSrc,
+                           int32_t shiftBits,
+                           int16_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Shift of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i16s_xpulpv2(const int16_t *pSrc,
+                            int32_t shiftBits,
+                            int16_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel shift of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_shift_i16_parallel(const int16_t *pSrc,
+                            int32_t shiftBits,
+                            int16_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel shift of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_shift_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_shift_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for shift of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i32(const int32_t *pSrc,
+                   int32_t shiftBits,
+                   int32_t *pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Shift of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i32s_rv32im(const int32_t *pSrc,
+                           int32_t shiftBits,
+                           int32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Shift of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_shift_i32s_xpulpv2(const int32_t *pSrc,
+                            int32_t shiftBits,
+                            int32_t *pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel shift of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_shift_i32_parallel(const int32_t *pSrc,
+                            int32_t shiftBits,
+                            int32_t *pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel shift of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_shift_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_shift_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for clipping of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i8(const int8_t *pSrc,
+                 int8_t low,
+                 int8_t high,
+                 int8_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of an 8-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i8s_rv32im(const int8_t *pSrc,
+                         int8_t low,
+                         int8_t high,
+                         int8_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i8s_xpulpv2(const int8_t *pSrc,
+                          int8_t low,
+                          int8_t high,
+                          int8_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel clipping of an 8-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_clip_i8_parallel(const int8_t *pSrc,
+                          int8_t low,
+                          int8_t high,
+                          int8_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel clipping of an 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_clip_instance_i8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_clip_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for clipping of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i16(const int16_t *pSrc,
+                  int16_t low,
+                  int16_t high,
+                  int16_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i16s_rv32im(const int16_t *pSrc,
+                          int16_t low,
+                          int16_t high,
+                          int16_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i16s_xpulpv2(const int16_t *pSrc,
+                           int16_t low,
+                           int16_t high,
+                           int16_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel clipping of a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_clip_i16_parallel(const int16_t *pSrc,
+                           int16_t low,
+                           int16_t high,
+                           int16_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel clipping of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_clip_instance_i16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_clip_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for clipping of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i32(const int32_t *pSrc,
+                  int32_t low,
+                  int32_t high,
+                  int32_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i32s_rv32im(const int32_t *pSrc,
+                          int32_t low,
+                          int32_t high,
+                          int32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_i32s_xpulpv2(const int32_t *pSrc,
+                           int32_t low,
+                           int32_t high,
+                           int32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel clipping of a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_clip_i32_parallel(const int32_t *pSrc,
+                           int32_t low,
+                           int32_t high,
+                           int32_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel clipping of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_clip_instance_i32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_clip_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for clipping of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_f32(const float32_t *pSrc,
+                  float32_t low,
+                  float32_t high,
+                  float32_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Clipping of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_clip_f32s_xpulpv2(const float32_t *pSrc,
+                           float32_t low,
+                           float32_t high,
+                           float32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel clipping of a 32-bit floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     low        lower bound of the output
+    @param[in]     high       upper bound of the output
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_clip_f32_parallel(const float32_t *pSrc,
+                           float32_t low,
+                           float32_t high,
+                           float32_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel clipping of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_clip_instance_f32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_clip_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating addition of 8-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q8(const int8_t *pSrcA,
+                const int8_t *pSrcB,
+                uint32_t deciPoint,
+                int8_t *pDst,
+                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating addition of 8-bit fixed-point vectors kernel for RV32IM
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q8s_rv32im(const int8_t *pSrcA,
+                        const int8_t *pSrcB,
+                        uint32_t deciPoint,
+                        int8_t *pDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating addition of 8-bit fixed-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q8s_xpulpv2(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating addition of 8-bit fixed-point
+           vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_q8_parallel(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating addition of 8-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     args       points to the plp_add_instance_q8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating addition of 16-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q16(const int16_t *pSrcA,
+                 const int16_t *pSrcB,
+                 uint32_t deciPoint,
+                 int16_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating addition of 16-bit fixed-point vectors kernel for RV32IM
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q16s_rv32im(const int16_t *pSrcA,
+                         const int16_t *pSrcB,
+                         uint32_t deciPoint,
+                         int16_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating addition of 16-bit fixed-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q16s_xpulpv2(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t deciPoint,
+                          int16_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating addition of 16-bit fixed-point
+           vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_q16_parallel(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t deciPoint,
+                          int16_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating addition of 16-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     args       points to the plp_add_instance_q16 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating addition of 32-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q32(const int32_t *pSrcA,
+                 const int32_t *pSrcB,
+                 uint32_t deciPoint,
+                 int32_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating addition of 32-bit fixed-point vectors kernel for RV32IM
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q32s_rv32im(const int32_t *pSrcA,
+                         const int32_t *pSrcB,
+                         uint32_t deciPoint,
+                         int32_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating addition of 32-bit fixed-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_q32s_xpulpv2(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t deciPoint,
+                          int32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating addition of 32-bit fixed-point
+           vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_add_q32_parallel(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t deciPoint,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating addition of 32-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     args       points to the plp_add_instance_q32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_add_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating subtraction of 8-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q8(const int8_t *pSrcA,
+                const int8_t *pSrcB,
+                uint32_t deciPoint,
+                int8_t *pDst,
+                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating subtraction of 8-bit fixed-point vectors kernel for RV32IM
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q8s_rv32im(const int8_t *pSrcA,
+                        const int8_t *pSrcB,
+                        uint32_t deciPoint,
+                        int8_t *pDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating subtraction of 8-bit fixed-point vectors kernel for XPULPV2
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q8s_xpulpv2(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating subtraction of 8-bit fixed-point
+           vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_q8_parallel(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating subtraction of 8-bit fixed-point vectors kernel
+           for XPULPV2 extension.
+    @param[in]     args       points to the plp_sub_instance_q8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating subtraction of 16-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q16(const int16_t *pSrcA,
+                 const int16_t *pSrcB,
+                 uint32_t deciPoint,
+                 int16_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating subtraction of 16-bit fixed-point vectors kernel for RV32IM
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q16s_rv32im(const int16_t *pSrcA,
+                         const int16_t *pSrcB,
+                         uint32_t deciPoint,
+                         int16_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating subtraction of 16-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q16s_xpulpv2(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t deciPoint,
+                          int16_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating subtraction of 16-bit
+           fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_q16_parallel(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t deciPoint,
+                          int16_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating subtraction of 16-bit fixed-point vectors kernel
+           for XPULPV2 extension.
+    @param[in]     args       points to the plp_sub_instance_q16 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating subtraction of 32-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q32(const int32_t *pSrcA,
+                 const int32_t *pSrcB,
+                 uint32_t deciPoint,
+                 int32_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating subtraction of 32-bit fixed-point vectors kernel for RV32IM
+           extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q32s_rv32im(const int32_t *pSrcA,
+                         const int32_t *pSrcB,
+                         uint32_t deciPoint,
+                         int32_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating subtraction of 32-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_sub_q32s_xpulpv2(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t deciPoint,
+                          int32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating subtraction of 32-bit
+           fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_sub_q32_parallel(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t deciPoint,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating subtraction of 32-bit fixed-point vectors kernel
+           for XPULPV2 extension.
+    @param[in]     args       points to the plp_sub_instance_q32 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_sub_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating multiplication of 8-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q8(const int8_t *pSrcA,
+                 const int8_t *pSrcB,
+                 uint32_t deciPoint,
+                 int8_t *pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating multiplication of 8-bit fixed-point vectors kernel for
+           RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q8s_rv32im(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating multiplication of 8-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q8s_xpulpv2(const int8_t *pSrcA,
+                          const int8_t *pSrcB,
+                          uint32_t deciPoint,
+                          int8_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating multiplication of 8-bit
+           fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_q8_parallel(const int8_t *pSrcA,
+                          const int8_t *pSrcB,
+                          uint32_t deciPoint,
+                          int8_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating multiplication of 8-bit fixed-point vectors kernel
+           for XPULPV2 extension.
+    @param[in]     args       points to the plp_mult_instance_q8 struct initialized by the glue code
+    @return        none
+*/
+
+void plp_mult_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating multiplication of 16-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q16(const int16_t *pSrcA,
+                  const int16_t *pSrcB,
+                  uint32_t deciPoint,
+                  int16_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating multiplication of 16-bit fixed-point vectors kernel for
+           RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q16s_rv32im(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t deciPoint,
+                          int16_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating multiplication of 16-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q16s_xpulpv2(const int16_t *pSrcA,
+                           const int16_t *pSrcB,
+                           uint32_t deciPoint,
+                           int16_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating multiplication of 16-bit
+           fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_q16_parallel(const int16_t *pSrcA,
+                           const int16_t *pSrcB,
+                           uint32_t deciPoint,
+                           int16_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating multiplication of 16-bit fixed-point vectors
+           kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_mult_instance_q16 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_mult_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element saturating multiplication of 32-bit fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q32(const int32_t *pSrcA,
+                  const int32_t *pSrcB,
+                  uint32_t deciPoint,
+                  int32_t *pDst,
+                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating multiplication of 32-bit fixed-point vectors kernel for
+           RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q32s_rv32im(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t deciPoint,
+                          int32_t *pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element saturating multiplication of 32-bit fixed-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_q32s_xpulpv2(const int32_t *pSrcA,
+                           const int32_t *pSrcB,
+                           uint32_t deciPoint,
+                           int32_t *pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel element-by-element saturating multiplication of 32-bit
+           fixed-point vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[in]     deciPoint  decimal point for right shift
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_mult_q32_parallel(const int32_t *pSrcA,
+                           const int32_t *pSrcB,
+                           uint32_t deciPoint,
+                           int32_t *pDst,
+                           uint32_t blockSize,
+                           uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief Parallel element-by-element saturating multiplication of 32-bit fixed-point vectors
+           kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_mult_instance_q32 struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_mult_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i8(const int8_t *__restrict__ pSrcA,
+                            uint32_t strideA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t strideB,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                    uint32_t strideA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t strideB,
+                                    uint32_t blockSize,
+                                    int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     uint32_t strideA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t strideB,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i16(const int16_t *__restrict__ pSrcA,
+                             uint32_t strideA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t strideB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     uint32_t strideA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t strideB,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      uint32_t strideA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t strideB,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i32(const int32_t *__restrict__ pSrcA,
+                             uint32_t strideA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t strideB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                     uint32_t strideA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t strideB,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                      uint32_t strideA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t strideB,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided dot product of 32-bit floating-point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_f32(const float32_t *__restrict__ pSrcA,
+                             uint32_t strideA,
+                             const float32_t *__restrict__ pSrcB,
+                             uint32_t strideB,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided dot product of 32-bit floating-point vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                      uint32_t strideA,
+                                      const float32_t *__restrict__ pSrcB,
+                                      uint32_t strideB,
+                                      uint32_t blockSize,
+                                      float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element addition of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i8(const int8_t *__restrict__ pSrcA,
+                       uint32_t strideA,
+                       const int8_t *__restrict__ pSrcB,
+                       uint32_t strideB,
+                       int32_t *__restrict__ pDst,
+                       uint32_t strideDst,
+                       uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                               uint32_t strideA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t strideB,
+                               int32_t *__restrict__ pDst,
+                               uint32_t strideDst,
+                               uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 8-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                uint32_t strideA,
+                                const int8_t *__restrict__ pSrcB,
+                                uint32_t strideB,
+                                int32_t *__restrict__ pDst,
+                                uint32_t strideDst,
+                                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element addition of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i16(const int16_t *__restrict__ pSrcA,
+                        uint32_t strideA,
+                        const int16_t *__restrict__ pSrcB,
+                        uint32_t strideB,
+                        int32_t *__restrict__ pDst,
+                        uint32_t strideDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 16-bit integer vectors kernel for RV32IM
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                uint32_t strideA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t strideB,
+                                int32_t *__restrict__ pDst,
+                                uint32_t strideDst,
+                                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 16-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const int16_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element addition of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i32(const int32_t *__restrict__ pSrcA,
+                        uint32_t strideA,
+                        const int32_t *__restrict__ pSrcB,
+                        uint32_t strideB,
+                        int32_t *__restrict__ pDst,
+                        uint32_t strideDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 32-bit integer vectors kernel for RV32IM
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                uint32_t strideA,
+                                const int32_t *__restrict__ pSrcB,
+                                uint32_t strideB,
+                                int32_t *__restrict__ pDst,
+                                uint32_t strideDst,
+                                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 32-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const int32_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element addition of 32-bit floating-point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_f32(const float32_t *__restrict__ pSrcA,
+                        uint32_t strideA,
+                        const float32_t *__restrict__ pSrcB,
+                        uint32_t strideB,
+                        float32_t *__restrict__ pDst,
+                        uint32_t strideDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element addition of 32-bit floating-point vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_add_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const float32_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element multiplication of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i8(const int8_t *__restrict__ pSrcA,
+                        uint32_t strideA,
+                        const int8_t *__restrict__ pSrcB,
+                        uint32_t strideB,
+                        int32_t *__restrict__ pDst,
+                        uint32_t strideDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 8-bit integer vectors kernel for RV32IM
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                uint32_t strideA,
+                                const int8_t *__restrict__ pSrcB,
+                                uint32_t strideB,
+                                int32_t *__restrict__ pDst,
+                                uint32_t strideDst,
+                                uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element multiplication of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i16(const int16_t *__restrict__ pSrcA,
+                         uint32_t strideA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t strideB,
+                         int32_t *__restrict__ pDst,
+                         uint32_t strideDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 16-bit integer vectors kernel for RV32IM
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const int16_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                  uint32_t strideA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t strideB,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t strideDst,
+                                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element multiplication of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i32(const int32_t *__restrict__ pSrcA,
+                         uint32_t strideA,
+                         const int32_t *__restrict__ pSrcB,
+                         uint32_t strideB,
+                         int32_t *__restrict__ pDst,
+                         uint32_t strideDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 32-bit integer vectors kernel for RV32IM
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const int32_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2
+           extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                  uint32_t strideA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t strideB,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t strideDst,
+                                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided element-by-element multiplication of 32-bit floating-point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_f32(const float32_t *__restrict__ pSrcA,
+                         uint32_t strideA,
+                         const float32_t *__restrict__ pSrcB,
+                         uint32_t strideB,
+                         float32_t *__restrict__ pDst,
+                         uint32_t strideDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Strided element-by-element multiplication of 32-bit floating-point vectors kernel for
+           XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  strideA    stride of the first input vector (elements between two samples)
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  strideB    stride of the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  strideDst  stride of the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_mult_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                  uint32_t strideA,
+                                  const float32_t *__restrict__ pSrcB,
+                                  uint32_t strideB,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t strideDst,
+                                  uint32_t blockSize);
+
+#endif // __PLP_BASIC_MATH_H__
@@ -27,6 +27,24 @@
 
 #include "plp_math.h"
 
+/*
+ * The tables of the fast math functions (sin, cos, exp, log, tanh, atan and rsqrt) are in L2 by
+ * default. If the library is built with PLP_L1_FAST_MATH_TABLES (make PLP_L1_FAST_MATH_TABLES=1),
+ * they are placed into the L1 memory of the cluster instead (about 11 kB), which saves the L2
+ * latency of every table lookup on the cluster. The FC can then use these functions only while the
+ * cluster is on. Other tables can be copied into L1 at run time with plp_table_to_l1.
+ */
+#if defined(PLP_L1_FAST_MATH_TABLES)
+#define PLP_FAST_MATH_TABLE PLP_L1_DATA
+#else
+#define PLP_FAST_MATH_TABLE
+#endif
+
+/*
+ * With PLP_QUARTER_WAVE_TABLES, the twiddle factors twiddleCoef_N_q16 and the sine tables are
+ * derived from sinTable_quarter_q32 instead, see plp_fast_math.h.
+ */
+#if !defined(PLP_QUARTER_WAVE_TABLES)
 extern const int16_t twiddleCoef_16_q16[24];
 extern const int16_t twiddleCoef_32_q16[48];
 extern const int16_t twiddleCoef_64_q16[96];
@@ -36,6 +54,7 @@ extern const int16_t twiddleCoef_512_q16[768];
 extern const int16_t twiddleCoef_1024_q16[1536];
 extern const int16_t twiddleCoef_2048_q16[3072];
 extern const int16_t twiddleCoef_4096_q16[6144];
+#endif
 
 #define PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH ((uint16_t)12)
 #define PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH ((uint16_t)24)
@@ -57,12 +76,32 @@ extern const uint16_t plpBitRevIndexTable_fixed_1024[PLPBITREVINDEXTABLE_FIXED_1
 extern const uint16_t plpBitRevIndexTable_fixed_2048[PLPBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
 extern const uint16_t plpBitRevIndexTable_fixed_4096[PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
 
+#if defined(PLP_QUARTER_WAVE_TABLES)
+extern const int32_t sinTable_quarter_q32[PLP_QUARTER_WAVE_SIZE + 1];
+#else
 extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1];
 extern const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1];
+#endif
+extern const int16_t rsqrtTable_q16[FAST_MATH_RSQRT_TABLE_SIZE];
+extern const int16_t recipTable_q16[FAST_MATH_RECIP_TABLE_SIZE];
+extern const float32_t expTable_f32[FAST_MATH_EXP_TABLE_SIZE + 1];
+extern const uint32_t expTable_q32[FAST_MATH_EXP_TABLE_SIZE + 1];
+extern const uint16_t expTable_q16[FAST_MATH_EXP_TABLE_SIZE + 1];
+extern const float32_t logTable_f32[FAST_MATH_LOG_TABLE_SIZE + 1];
+extern const uint32_t logTable_q32[FAST_MATH_LOG_TABLE_SIZE + 1];
+extern const uint16_t logTable_q16[FAST_MATH_LOG_TABLE_SIZE + 1];
+extern const float32_t tanhTable_f32[FAST_MATH_TANH_TABLE_SIZE + 1];
+extern const int32_t tanhTable_q32[FAST_MATH_TANH_TABLE_SIZE + 1];
+extern const int16_t tanhTable_q16[FAST_MATH_TANH_TABLE_SIZE + 1];
+extern const int32_t atanTable_q32[FAST_MATH_ATAN_TABLE_SIZE];
 
 extern const Complex_type_f32 twiddleCoef_rfft_2048[1024];
 
 extern short bit_rev_radix2_LUT[2048];
 
+#define PLPBITREVINDEXTABLE_RFFT_2048_TABLE_LENGTH ((uint16_t)1984)
+
+extern const uint16_t plpBitRevIndexTable_rfft_2048[PLPBITREVINDEXTABLE_RFFT_2048_TABLE_LENGTH];
+
 #endif // PLP_COMMON_TABLES_H
\ No newline at end of file
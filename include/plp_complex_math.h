@@ -0,0 +1,4281 @@
+/** ==========================================================================
+ * @file     plp_complex_math.h
+ * @brief    Complex math functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_COMPLEX_MATH_H__
+#define __PLP_COMPLEX_MATH_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_arg_instance_q16
+    @brief Instance structure for the parallel complex argument of a 16-bit fixed point vector.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc;   // pointer to the complex input vector
+    int16_t *pDst;         // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_arg_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_arg_instance_q32
+    @brief Instance structure for the parallel complex argument of a 32-bit fixed point vector.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc;   // pointer to the complex input vector
+    int32_t *pDst;         // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_arg_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_arg_instance_f32
+    @brief Instance structure for the parallel complex argument of a 32-bit floating point vector.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc;   // pointer to the complex input vector
+    float32_t *pDst;         // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_arg_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_f32
+    @brief Instance structure for the parallel complex-by-complex multiplication of 32-bit
+           floating-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first complex input vector
+    const float32_t *pSrcB; // pointer to the second complex input vector
+    float32_t *pDst;        // pointer to the output vector
+    uint32_t numSamples;    // number of complex samples
+    uint32_t nPE;           // number of processing units
+} plp_cmplx_mult_cmplx_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_i32
+    @brief Instance structure for the parallel complex-by-complex multiplication of 32-bit integer
+           vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first complex input vector
+    const int32_t *pSrcB; // pointer to the second complex input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_mult_cmplx_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_i16
+    @brief Instance structure for the parallel complex-by-complex multiplication of 16-bit integer
+           vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first complex input vector
+    const int16_t *pSrcB; // pointer to the second complex input vector
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_mult_cmplx_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_i8
+    @brief Instance structure for the parallel complex-by-complex multiplication of 8-bit integer
+           vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first complex input vector
+    const int8_t *pSrcB; // pointer to the second complex input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mult_cmplx_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_q32
+    @brief Instance structure for the parallel complex-by-complex multiplication of 32-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first complex input vector
+    const int32_t *pSrcB; // pointer to the second complex input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_mult_cmplx_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_q16
+    @brief Instance structure for the parallel complex-by-complex multiplication of 16-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first complex input vector
+    const int16_t *pSrcB; // pointer to the second complex input vector
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_mult_cmplx_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_cmplx_instance_q8
+    @brief Instance structure for the parallel complex-by-complex multiplication of 8-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first complex input vector
+    const int8_t *pSrcB; // pointer to the second complex input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;  // decimal point for right shift
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mult_cmplx_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_f32
+    @brief Instance structure for the parallel complex-by-real multiplication of 32-bit
+           floating-point vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrcCmplx; // pointer to the complex input vector
+    const float32_t *pSrcReal;  // pointer to the real input vector
+    float32_t *pDst;            // pointer to the output vector
+    uint32_t numSamples;        // number of complex samples
+    uint32_t nPE;               // number of processing units
+} plp_cmplx_mult_real_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_i32
+    @brief Instance structure for the parallel complex-by-real multiplication of 32-bit integer
+           vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcCmplx; // pointer to the complex input vector
+    const int32_t *pSrcReal;  // pointer to the real input vector
+    int32_t *pDst;            // pointer to the output vector
+    uint32_t numSamples;      // number of complex samples
+    uint32_t nPE;             // number of processing units
+} plp_cmplx_mult_real_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_i16
+    @brief Instance structure for the parallel complex-by-real multiplication of 16-bit integer
+           vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcCmplx; // pointer to the complex input vector
+    const int16_t *pSrcReal;  // pointer to the real input vector
+    int16_t *pDst;            // pointer to the output vector
+    uint32_t numSamples;      // number of complex samples
+    uint32_t nPE;             // number of processing units
+} plp_cmplx_mult_real_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_i8
+    @brief Instance structure for the parallel complex-by-real multiplication of 8-bit integer
+           vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcCmplx; // pointer to the complex input vector
+    const int8_t *pSrcReal;  // pointer to the real input vector
+    int8_t *pDst;            // pointer to the output vector
+    uint32_t numSamples;     // number of complex samples
+    uint32_t nPE;            // number of processing units
+} plp_cmplx_mult_real_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_q32
+    @brief Instance structure for the parallel complex-by-real multiplication of 32-bit fixed-point
+           vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcCmplx; // pointer to the complex input vector
+    const int32_t *pSrcReal;  // pointer to the real input vector
+    int32_t *pDst;            // pointer to the output vector
+    uint32_t deciPoint;       // decimal point for right shift
+    uint32_t numSamples;      // number of complex samples
+    uint32_t nPE;             // number of processing units
+} plp_cmplx_mult_real_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_q16
+    @brief Instance structure for the parallel complex-by-real multiplication of 16-bit fixed-point
+           vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcCmplx; // pointer to the complex input vector
+    const int16_t *pSrcReal;  // pointer to the real input vector
+    int16_t *pDst;            // pointer to the output vector
+    uint32_t deciPoint;       // decimal point for right shift
+    uint32_t numSamples;      // number of complex samples
+    uint32_t nPE;             // number of processing units
+} plp_cmplx_mult_real_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_real_instance_q8
+    @brief Instance structure for the parallel complex-by-real multiplication of 8-bit fixed-point
+           vectors.
+    @param[in]  pSrcCmplx   points to the complex input vector
+    @param[in]  pSrcReal    points to the real input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcCmplx; // pointer to the complex input vector
+    const int8_t *pSrcReal;  // pointer to the real input vector
+    int8_t *pDst;            // pointer to the output vector
+    uint32_t deciPoint;      // decimal point for right shift
+    uint32_t numSamples;     // number of complex samples
+    uint32_t nPE;            // number of processing units
+} plp_cmplx_mult_real_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_conj_instance_f32
+    @brief Instance structure for the parallel complex conjugate of 32-bit floating-point vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the complex input vector
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t numSamples;   // number of complex samples
+    uint32_t nPE;          // number of processing units
+} plp_cmplx_conj_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_conj_instance_i32
+    @brief Instance structure for the parallel complex conjugate of 32-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the complex input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_conj_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_conj_instance_i16
+    @brief Instance structure for the parallel complex conjugate of 16-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the complex input vector
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_conj_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_conj_instance_i8
+    @brief Instance structure for the parallel complex conjugate of 8-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc;  // pointer to the complex input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_conj_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_f32
+    @brief Instance structure for the parallel complex magnitude squared of 32-bit floating-point
+           vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the complex input vector
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t numSamples;   // number of complex samples
+    uint32_t nPE;          // number of processing units
+} plp_cmplx_mag_squared_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_i32
+    @brief Instance structure for the parallel complex magnitude squared of 32-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the complex input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_squared_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_i16
+    @brief Instance structure for the parallel complex magnitude squared of 16-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the complex input vector
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_squared_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_i8
+    @brief Instance structure for the parallel complex magnitude squared of 8-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc;  // pointer to the complex input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_squared_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_q32
+    @brief Instance structure for the parallel complex magnitude squared of 32-bit fixed-point
+           vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the complex input vector
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t deciPoint;  // decimal point for right shift
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_squared_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_q16
+    @brief Instance structure for the parallel complex magnitude squared of 16-bit fixed-point
+           vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the complex input vector
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t deciPoint;  // decimal point for right shift
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_squared_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_squared_instance_q8
+    @brief Instance structure for the parallel complex magnitude squared of 8-bit fixed-point
+           vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc;  // pointer to the complex input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;  // decimal point for right shift
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_squared_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_instance_f32
+    @brief Instance structure for the parallel complex magnitude of 32-bit floating-point vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pRes        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the complex input vector
+    float32_t *pRes;       // pointer to the output vector
+    uint32_t numSamples;   // number of complex samples
+    uint32_t nPE;          // number of processing units
+} plp_cmplx_mag_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_instance_i32
+    @brief Instance structure for the parallel complex magnitude of 32-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pRes        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the complex input vector
+    int32_t *pRes;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_instance_i16
+    @brief Instance structure for the parallel complex magnitude of 16-bit integer vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[out] pRes        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the complex input vector
+    int16_t *pRes;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_instance_q32
+    @brief Instance structure for the parallel complex magnitude of 32-bit fixed-point vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pRes        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the complex input vector
+    uint32_t deciPoint;  // decimal point for right shift
+    int32_t *pRes;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mag_instance_q16
+    @brief Instance structure for the parallel complex magnitude of 16-bit fixed-point vectors.
+    @param[in]  pSrc        points to the complex input vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[out] pRes        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the complex input vector
+    uint32_t deciPoint;  // decimal point for right shift
+    int16_t *pRes;       // pointer to the output vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mag_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_dot_prod_instance_f32
+    @brief Instance structure for the parallel complex dot product of 32-bit floating-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] resBuffer   points to the buffer of the partial results
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first complex input vector
+    const float32_t *pSrcB; // pointer to the second complex input vector
+    uint32_t numSamples;    // number of complex samples
+    uint32_t nPE;           // number of processing units
+    float32_t *resBuffer;   // pointer to the partial results
+} plp_cmplx_dot_prod_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_dot_prod_instance_i32
+    @brief Instance structure for the parallel complex dot product of 32-bit integer vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] resBuffer   points to the buffer of the partial results
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first complex input vector
+    const int32_t *pSrcB; // pointer to the second complex input vector
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+    int32_t *resBuffer;   // pointer to the partial results
+} plp_cmplx_dot_prod_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_dot_prod_instance_i16
+    @brief Instance structure for the parallel complex dot product of 16-bit integer vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] resBuffer   points to the buffer of the partial results
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first complex input vector
+    const int16_t *pSrcB; // pointer to the second complex input vector
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+    int16_t *resBuffer;   // pointer to the partial results
+} plp_cmplx_dot_prod_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_dot_prod_instance_i8
+    @brief Instance structure for the parallel complex dot product of 8-bit integer vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] resBuffer   points to the buffer of the partial results
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first complex input vector
+    const int8_t *pSrcB; // pointer to the second complex input vector
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+    int8_t *resBuffer;   // pointer to the partial results
+} plp_cmplx_dot_prod_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_dot_prod_instance_q32
+    @brief Instance structure for the parallel complex dot product of 32-bit fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  nPE         number of parallel processing units
+    @param[out] resBuffer   points to the buffer of the partial results
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first complex input vector
+    const int32_t *pSrcB; // pointer to the second complex input vector
+    uint32_t numSamples;  // number of complex samples
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t nPE;         // number of processing units
+    int32_t *resBuffer;   // pointer to the partial results
+} plp_cmplx_dot_prod_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_dot_prod_instance_q16
+    @brief Instance structure for the parallel complex dot product of 16-bit fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  nPE         number of parallel processing units
+    @param[out] resBuffer   points to the buffer of the partial results
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first complex input vector
+    const int16_t *pSrcB; // pointer to the second complex input vector
+    uint32_t numSamples;  // number of complex samples
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t nPE;         // number of processing units
+    int16_t *resBuffer;   // pointer to the partial results
+} plp_cmplx_dot_prod_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_conj_instance_q8
+    @brief Instance structure for the parallel complex-by-conjugate multiplication of 8-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first complex input vector
+    const int8_t *pSrcB; // pointer to the second complex input vector
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;  // decimal point for right shift
+    uint32_t numSamples; // number of complex samples
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_mult_conj_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_conj_instance_q16
+    @brief Instance structure for the parallel complex-by-conjugate multiplication of 16-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first complex input vector
+    const int16_t *pSrcB; // pointer to the second complex input vector
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_mult_conj_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_conj_instance_q32
+    @brief Instance structure for the parallel complex-by-conjugate multiplication of 32-bit
+           fixed-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  deciPoint   decimal point for right shift
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first complex input vector
+    const int32_t *pSrcB; // pointer to the second complex input vector
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t deciPoint;   // decimal point for right shift
+    uint32_t numSamples;  // number of complex samples
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_mult_conj_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_mult_conj_instance_f32
+    @brief Instance structure for the parallel complex-by-conjugate multiplication of 32-bit
+           floating-point vectors.
+    @param[in]  pSrcA       points to the first complex input vector
+    @param[in]  pSrcB       points to the second complex input vector
+    @param[out] pDst        points to the output vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrcA; // pointer to the first complex input vector
+    const float32_t *pSrcB; // pointer to the second complex input vector
+    float32_t *pDst;        // pointer to the output vector
+    uint32_t numSamples;    // number of complex samples
+    uint32_t nPE;           // number of processing units
+} plp_cmplx_mult_conj_instance_f32;
+
+/**
+ * @brief Number of CORDIC rotation angles for the arctangent approximation
+ */
+
+#define FAST_MATH_ATAN_TABLE_SIZE 30
+
+/**
+  @brief Glue code for complex conjugate of 32-bit float vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_conj_f32(const float32_t *__restrict__ pSrc,
+                        float32_t *__restrict__ pDst,
+                        uint32_t numSamples);
+
+/**
+  @brief         Floating-point complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst,
+                                uint32_t numSamples);
+
+/**
+  @brief Glue code for complex conjugate of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_conj_i32(const int32_t *__restrict__ pSrc,
+                        int32_t *__restrict__ pDst,
+                        uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDst,
+                                uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i32_rv32im(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief Glue code for complex conjugate of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_conj_i16(const int16_t *__restrict__ pSrc,
+                        int16_t *__restrict__ pDst,
+                        uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i16_xpulpv2(const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i16_rv32im(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief Glue code for complex conjugate of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_conj_i8(const int8_t *__restrict__ pSrc,
+                       int8_t *__restrict__ pDst,
+                       uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i8_xpulpv2(const int8_t *__restrict__ pSrc,
+                               int8_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i8_rv32im(const int8_t *__restrict__ pSrc,
+                              int8_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief Glue code for complex dot product of 32-bit float vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_dot_prod_f32(const float32_t *pSrcA,
+                            const float32_t *pSrcB,
+                            uint32_t numSamples,
+                            float32_t *realResult,
+                            float32_t *imagResult);
+
+/**
+  @brief         Floating-point complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_f32_xpulpv2(const float32_t *pSrcA,
+                                    const float32_t *pSrcB,
+                                    uint32_t numSamples,
+                                    float32_t *realResult,
+                                    float32_t *imagResult);
+
+/**
+  @brief Glue code for complex dot product of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_dot_prod_i32(const int32_t *pSrcA,
+                            const int32_t *pSrcB,
+                            uint32_t numSamples,
+                            int32_t *realResult,
+                            int32_t *imagResult);
+
+/**
+  @brief         32-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i32_xpulpv2(const int32_t *pSrcA,
+                                    const int32_t *pSrcB,
+                                    uint32_t numSamples,
+                                    int32_t *realResult,
+                                    int32_t *imagResult);
+
+/**
+  @brief         32-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i32_rv32im(const int32_t *pSrcA,
+                                   const int32_t *pSrcB,
+                                   uint32_t numSamples,
+                                   int32_t *realResult,
+                                   int32_t *imagResult);
+
+/**
+  @brief Glue code for complex dot product of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_dot_prod_i16(const int16_t *pSrcA,
+                            const int16_t *pSrcB,
+                            uint32_t numSamples,
+                            int16_t *realResult,
+                            int16_t *imagResult);
+
+/**
+  @brief         16-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16_xpulpv2(const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
+                                    uint32_t numSamples,
+                                    int16_t *realResult,
+                                    int16_t *imagResult);
+
+/**
+  @brief         16-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16_rv32im(const int16_t *pSrcA,
+                                   const int16_t *pSrcB,
+                                   uint32_t numSamples,
+                                   int16_t *realResult,
+                                   int16_t *imagResult);
+
+/**
+  @brief Glue code for complex dot product of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_dot_prod_i8(const int8_t *pSrcA,
+                           const int8_t *pSrcB,
+                           uint32_t numSamples,
+                           int8_t *realResult,
+                           int8_t *imagResult);
+
+/**
+  @brief         8-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i8_xpulpv2(const int8_t *pSrcA,
+                                   const int8_t *pSrcB,
+                                   uint32_t numSamples,
+                                   int8_t *realResult,
+                                   int8_t *imagResult);
+
+/**
+  @brief         8-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i8_rv32im(const int8_t *pSrcA,
+                                  const int8_t *pSrcB,
+                                  uint32_t numSamples,
+                                  int8_t *realResult,
+                                  int8_t *imagResult);
+
+/**
+  @brief Glue code for complex dot product of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_dot_prod_q32(const int32_t *pSrcA,
+                            const int32_t *pSrcB,
+                            uint32_t numSamples,
+                            uint32_t deciPoint,
+                            int32_t *realResult,
+                            int32_t *imagResult);
+
+/**
+  @brief         32-bit fixed-point complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32_xpulpv2(const int32_t *pSrcA,
+                                    const int32_t *pSrcB,
+                                    uint32_t numSamples,
+                                    uint32_t deciPoint,
+                                    int32_t *realResult,
+                                    int32_t *imagResult);
+
+/**
+  @brief         32-bit integer complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32_rv32im(const int32_t *pSrcA,
+                                   const int32_t *pSrcB,
+                                   uint32_t numSamples,
+                                   uint32_t deciPoint,
+                                   int32_t *realResult,
+                                   int32_t *imagResult);
+
+/**
+  @brief Glue code for complex dot product of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_dot_prod_q16(const int16_t *pSrcA,
+                            const int16_t *pSrcB,
+                            uint32_t numSamples,
+                            uint32_t deciPoint,
+                            int16_t *realResult,
+                            int16_t *imagResult);
+
+/**
+  @brief         16-bit fixed-point complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16_xpulpv2(const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
+                                    uint32_t numSamples,
+                                    uint32_t deciPoint,
+                                    int16_t *realResult,
+                                    int16_t *imagResult);
+
+/**
+  @brief         16-bit fixed-point complex dot product.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16_rv32im(const int16_t *pSrcA,
+                                   const int16_t *pSrcB,
+                                   uint32_t numSamples,
+                                   uint32_t deciPoint,
+                                   int16_t *realResult,
+                                   int16_t *imagResult);
+
+/**
+  @brief Glue code for complex multiplied with real of 32-bit float vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_f32(const float32_t *__restrict__ pSrcCmplx,
+                             const float32_t *__restrict__ pSrcReal,
+                             float32_t *__restrict__ pDst,
+                             uint32_t numSamples);
+
+/**
+  @brief         Floating-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_f32_xpulpv2(const float32_t *__restrict__ pSrcCmplx,
+                                     const float32_t *__restrict__ pSrcReal,
+                                     float32_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32(const int32_t *__restrict__ pSrcCmplx,
+                             const int32_t *__restrict__ pSrcReal,
+                             int32_t *__restrict__ pDst,
+                             uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32_xpulpv2(const int32_t *__restrict__ pSrcCmplx,
+                                     const int32_t *__restrict__ pSrcReal,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32_rv32im(const int32_t *__restrict__ pSrcCmplx,
+                                    const int32_t *__restrict__ pSrcReal,
+                                    int32_t *__restrict__ pDst,
+                                    uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16(const int16_t *__restrict__ pSrcCmplx,
+                             const int16_t *__restrict__ pSrcReal,
+                             int16_t *__restrict__ pDst,
+                             uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16_xpulpv2(const int16_t *__restrict__ pSrcCmplx,
+                                     const int16_t *__restrict__ pSrcReal,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16_rv32im(const int16_t *__restrict__ pSrcCmplx,
+                                    const int16_t *__restrict__ pSrcReal,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8(const int8_t *__restrict__ pSrcCmplx,
+                            const int8_t *__restrict__ pSrcReal,
+                            int8_t *__restrict__ pDst,
+                            uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8_xpulpv2(const int8_t *__restrict__ pSrcCmplx,
+                                    const int8_t *__restrict__ pSrcReal,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8_rv32im(const int8_t *__restrict__ pSrcCmplx,
+                                   const int8_t *__restrict__ pSrcReal,
+                                   int8_t *__restrict__ pDst,
+                                   uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q32(const int32_t *__restrict__ pSrcCmplx,
+                             const int32_t *__restrict__ pSrcReal,
+                             int32_t *__restrict__ pDst,
+                             uint32_t deciPoint,
+                             uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q32_xpulpv2(const int32_t *__restrict__ pSrcCmplx,
+                                     const int32_t *__restrict__ pSrcReal,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q32_rv32im(const int32_t *__restrict__ pSrcCmplx,
+                                    const int32_t *__restrict__ pSrcReal,
+                                    int32_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16(const int16_t *__restrict__ pSrcCmplx,
+                             const int16_t *__restrict__ pSrcReal,
+                             int16_t *__restrict__ pDst,
+                             uint32_t deciPoint,
+                             uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16_xpulpv2(const int16_t *__restrict__ pSrcCmplx,
+                                     const int16_t *__restrict__ pSrcReal,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16_rv32im(const int16_t *__restrict__ pSrcCmplx,
+                                    const int16_t *__restrict__ pSrcReal,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 8-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8(const int8_t *__restrict__ pSrcCmplx,
+                            const int8_t *__restrict__ pSrcReal,
+                            int8_t *__restrict__ pDst,
+                            uint32_t deciPoint,
+                            uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8_xpulpv2(const int8_t *__restrict__ pSrcCmplx,
+                                    const int8_t *__restrict__ pSrcReal,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8_rv32im(const int8_t *__restrict__ pSrcCmplx,
+                                   const int8_t *__restrict__ pSrcReal,
+                                   int8_t *__restrict__ pDst,
+                                   uint32_t deciPoint,
+                                   uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 32-bit float vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_f32(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         Floating-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                       float32_t *__restrict__ pDst,
+                                       uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16_rv32im(const int16_t *__restrict__ pSrc,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief         16 bit Integer complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32_rv32im(const int32_t *__restrict__ pSrc,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                       int32_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8(const int8_t *__restrict__ pSrc,
+                              int8_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8_rv32im(const int8_t *__restrict__ pSrc,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief         8 bit Integer complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t deciPoint,
+                               uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32_rv32im(const int32_t *__restrict__ pSrc,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples);
+
+/**
+  @brief         32 bit fixed-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t deciPoint,
+                               uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16_rv32im(const int16_t *__restrict__ pSrc,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples);
+
+/**
+  @brief         16 bit fixed-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples);
+
+/**
+  @brief Glue code for complex squared magnitude of 8-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8(const int8_t *__restrict__ pSrc,
+                              int8_t *__restrict__ pDst,
+                              uint32_t deciPoint,
+                              uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8_rv32im(const int8_t *__restrict__ pSrc,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         8 bit fixed-point complex squared magnitude.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples);
+
+/**
+  @brief         Glue code for the complex argument of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q16(const int16_t *__restrict__ pSrc,
+                       int16_t *__restrict__ pDst,
+                       uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex argument kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q16_rv32im(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex argument kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q16_xpulpv2(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex argument of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_arg_q16_parallel(const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex argument kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_arg_instance_q16 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_arg_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the complex argument of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q32(const int32_t *__restrict__ pSrc,
+                       int32_t *__restrict__ pDst,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex argument kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q32_rv32im(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex argument kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex argument of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_arg_q32_parallel(const int32_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDst,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex argument kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_arg_instance_q32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_arg_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the complex argument of 32-bit floating-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_f32(const float32_t *__restrict__ pSrc,
+                       float32_t *__restrict__ pDst,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point complex argument kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex argument of 32-bit floating-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_arg_f32_parallel(const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex argument kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_arg_instance_f32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_arg_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for complex magnitude of 32-bit floating-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_f32(const float32_t *__restrict__ pSrc,
+                       float32_t *__restrict__ pRes,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pRes,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for complex magnitude of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i32(const int32_t *__restrict__ pSrc,
+                       int32_t *__restrict__ pRes,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i32_rv32im(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i32_xpulpv2(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pRes,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for complex magnitude of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i16(const int16_t *__restrict__ pSrc,
+                       int16_t *__restrict__ pRes,
+                       uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i16_rv32im(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i16_xpulpv2(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pRes,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for complex magnitude of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q32(const int32_t *__restrict__ pSrc,
+                       const uint32_t deciPoint,
+                       int32_t *__restrict__ pRes,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q32_rv32im(const int32_t *__restrict__ pSrc,
+                              const uint32_t deciPoint,
+                              int32_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                               const uint32_t deciPoint,
+                               int32_t *__restrict__ pRes,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for complex magnitude of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q16(const int16_t *__restrict__ pSrc,
+                       const uint32_t deciPoint,
+                       int16_t *__restrict__ pRes,
+                       uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q16_rv32im(const int16_t *__restrict__ pSrc,
+                              const uint32_t deciPoint,
+                              int16_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q16_xpulpv2(const int16_t *__restrict__ pSrc,
+                               const uint32_t deciPoint,
+                               int16_t *__restrict__ pRes,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for approximate complex magnitude of 32-bit floating-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_f32(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point approximate complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                      float32_t *__restrict__ pRes,
+                                      uint32_t numSamples);
+
+/**
+  @brief         Glue code for approximate complex magnitude of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q32(const int32_t *__restrict__ pSrc,
+                              const uint32_t deciPoint,
+                              int32_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point approximate complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q32_rv32im(const int32_t *__restrict__ pSrc,
+                                     const uint32_t deciPoint,
+                                     int32_t *__restrict__ pRes,
+                                     uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point approximate complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                      const uint32_t deciPoint,
+                                      int32_t *__restrict__ pRes,
+                                      uint32_t numSamples);
+
+/**
+  @brief         Glue code for approximate complex magnitude of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q16(const int16_t *__restrict__ pSrc,
+                              const uint32_t deciPoint,
+                              int16_t *__restrict__ pRes,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point approximate complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q16_rv32im(const int16_t *__restrict__ pSrc,
+                                     const uint32_t deciPoint,
+                                     int16_t *__restrict__ pRes,
+                                     uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point approximate complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q16_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      const uint32_t deciPoint,
+                                      int16_t *__restrict__ pRes,
+                                      uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 32-bit float vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_f32(const float32_t *__restrict__ pSrcA,
+                              const float32_t *__restrict__ pSrcB,
+                              float32_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         Floating-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_f32_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                      const float32_t *__restrict__ pSrcB,
+                                      float32_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 32-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              int32_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief         32-bit integer complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32_rv32im(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 16-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              int16_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 8-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             int8_t *__restrict__ pDst,
+                             uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 32-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              int32_t *__restrict__ pDst,
+                              uint32_t deciPoint,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32_rv32im(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 16-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              int16_t *__restrict__ pDst,
+                              uint32_t deciPoint,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied by complex of 8-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             int8_t *__restrict__ pDst,
+                             uint32_t deciPoint,
+                             uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex multiplied by complex.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 32-bit
+                 floating-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_f32_parallel(const float32_t *__restrict__ pSrcA,
+                                       const float32_t *__restrict__ pSrcB,
+                                       float32_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_f32 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 32-bit integer
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit integer complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_i32 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 16-bit integer
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit integer complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_i16 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 8-bit integer
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit integer complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_i8 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_q32 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_q16 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-complex multiplication of 8-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit fixed-point complex-by-complex multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_cmplx_instance_q8 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 32-bit floating-point
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_f32_parallel(const float32_t *__restrict__ pSrcCmplx,
+                                      const float32_t *__restrict__ pSrcReal,
+                                      float32_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex-by-real multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_f32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 32-bit integer
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32_parallel(const int32_t *__restrict__ pSrcCmplx,
+                                      const int32_t *__restrict__ pSrcReal,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit integer complex-by-real multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_i32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 16-bit integer
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16_parallel(const int16_t *__restrict__ pSrcCmplx,
+                                      const int16_t *__restrict__ pSrcReal,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit integer complex-by-real multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_i16 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 8-bit integer vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8_parallel(const int8_t *__restrict__ pSrcCmplx,
+                                     const int8_t *__restrict__ pSrcReal,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t numSamples,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit integer complex-by-real multiplication kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_i8 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q32_parallel(const int32_t *__restrict__ pSrcCmplx,
+                                      const int32_t *__restrict__ pSrcReal,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex-by-real multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_q32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16_parallel(const int16_t *__restrict__ pSrcCmplx,
+                                      const int16_t *__restrict__ pSrcReal,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex-by-real multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_q16 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex-by-real multiplication of 8-bit fixed-point
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8_parallel(const int8_t *__restrict__ pSrcCmplx,
+                                     const int8_t *__restrict__ pSrcReal,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit fixed-point complex-by-real multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_real_instance_q8 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex conjugate of 32-bit floating-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_conj_f32_parallel(const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex conjugate kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_conj_instance_f32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_conj_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex conjugate of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_conj_i32_parallel(const int32_t *__restrict__ pSrc,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit integer complex conjugate kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_conj_instance_i32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_conj_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex conjugate of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_conj_i16_parallel(const int16_t *__restrict__ pSrc,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit integer complex conjugate kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_conj_instance_i16 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_conj_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex conjugate of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_conj_i8_parallel(const int8_t *__restrict__ pSrc,
+                                int8_t *__restrict__ pDst,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit integer complex conjugate kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_conj_instance_i8 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_conj_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 32-bit floating-point
+                 vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_f32_parallel(const float32_t *__restrict__ pSrc,
+                                        float32_t *__restrict__ pDst,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex magnitude squared kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_f32 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32_parallel(const int32_t *__restrict__ pSrc,
+                                        int32_t *__restrict__ pDst,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit integer complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_i32 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16_parallel(const int16_t *__restrict__ pSrc,
+                                        int16_t *__restrict__ pDst,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit integer complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_i16 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8_parallel(const int8_t *__restrict__ pSrc,
+                                       int8_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit integer complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_i8 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32_parallel(const int32_t *__restrict__ pSrc,
+                                        int32_t *__restrict__ pDst,
+                                        uint32_t deciPoint,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_q32 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16_parallel(const int16_t *__restrict__ pSrc,
+                                        int16_t *__restrict__ pDst,
+                                        uint32_t deciPoint,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_q16 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude squared of 8-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8_parallel(const int8_t *__restrict__ pSrc,
+                                       int8_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit fixed-point complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_squared_instance_q8 struct initialized by the
+                       glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude of 32-bit floating-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_f32_parallel(const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_f32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_i32_parallel(const int32_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit integer complex magnitude kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_i32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_i16_parallel(const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit integer complex magnitude kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_i16 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_q32_parallel(const int32_t *__restrict__ pSrc,
+                                uint32_t deciPoint,
+                                int32_t *__restrict__ pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_q32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex magnitude of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_q16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_q16 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel approximate complex magnitude of 32-bit floating-point
+                 vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_f32_parallel(const float32_t *__restrict__ pSrc,
+                                       float32_t *__restrict__ pRes,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point approximate complex magnitude kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_f32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel approximate complex magnitude of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q32_parallel(const int32_t *__restrict__ pSrc,
+                                       uint32_t deciPoint,
+                                       int32_t *__restrict__ pRes,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point approximate complex magnitude kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_q32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel approximate complex magnitude of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q16_parallel(const int16_t *__restrict__ pSrc,
+                                       uint32_t deciPoint,
+                                       int16_t *__restrict__ pRes,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point approximate complex magnitude kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_q16 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex dot product of 32-bit floating-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
+                                     const float32_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     float32_t *__restrict__ realResult,
+                                     float32_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_f32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex dot product of 32-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     int32_t *__restrict__ realResult,
+                                     int32_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit integer complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_i32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex dot product of 16-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     int16_t *__restrict__ realResult,
+                                     int16_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit integer complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_i16 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex dot product of 8-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t numSamples,
+                                    int8_t *__restrict__ realResult,
+                                    int8_t *__restrict__ imagResult,
+                                    uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit integer complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_i8 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex dot product of 32-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     uint32_t deciPoint,
+                                     int32_t *__restrict__ realResult,
+                                     int32_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_q32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the parallel complex dot product of 16-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     uint32_t deciPoint,
+                                     int16_t *__restrict__ realResult,
+                                     int16_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_q16 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the complex multiply-accumulate of 16-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q16(const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcB,
+                       int16_t *__restrict__ pDst,
+                       uint32_t deciPoint,
+                       uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiply-accumulate kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q16_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              int16_t *__restrict__ pDst,
+                              uint32_t deciPoint,
+                              uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiply-accumulate kernel for XPULPV2 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               int16_t *__restrict__ pDst,
+                               uint32_t deciPoint,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for the complex multiply-accumulate of 32-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q32(const int32_t *__restrict__ pSrcA,
+                       const int32_t *__restrict__ pSrcB,
+                       int32_t *__restrict__ pDst,
+                       uint32_t deciPoint,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex multiply-accumulate kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q32_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              int32_t *__restrict__ pDst,
+                              uint32_t deciPoint,
+                              uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex multiply-accumulate kernel for XPULPV2 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q32_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               int32_t *__restrict__ pDst,
+                               uint32_t deciPoint,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for the complex multiply-accumulate of 32-bit floating-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_f32(const float32_t *__restrict__ pSrcA,
+                       const float32_t *__restrict__ pSrcB,
+                       float32_t *__restrict__ pDst,
+                       uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point complex multiply-accumulate kernel for XPULPV2 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_f32_xpulpv2(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               float32_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         Glue code for the batched complex multiply-accumulate of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q16(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               int16_t *__restrict__ pDst,
+                               uint32_t deciPoint,
+                               uint32_t numSamples,
+                               uint32_t numChannels);
+
+/**
+  @brief         16-bit fixed-point batched complex multiply-accumulate kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q16_rv32im(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t numChannels);
+
+/**
+  @brief         16-bit fixed-point batched complex multiply-accumulate kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t numChannels);
+
+/**
+  @brief         Glue code for the batched complex multiply-accumulate of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q32(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               int32_t *__restrict__ pDst,
+                               uint32_t deciPoint,
+                               uint32_t numSamples,
+                               uint32_t numChannels);
+
+/**
+  @brief         32-bit fixed-point batched complex multiply-accumulate kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q32_rv32im(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t numChannels);
+
+/**
+  @brief         32-bit fixed-point batched complex multiply-accumulate kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q32_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t numChannels);
+
+/**
+  @brief         Glue code for the batched complex multiply-accumulate of 32-bit floating-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_f32(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               float32_t *__restrict__ pDst,
+                               uint32_t numSamples,
+                               uint32_t numChannels);
+
+/**
+  @brief         32-bit floating-point batched complex multiply-accumulate kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_f32_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                       const float32_t *__restrict__ pSrcB,
+                                       float32_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t numChannels);
+
+/**
+  @brief         Glue code for the complex-by-conjugate multiplication of 8-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q8(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            int8_t *__restrict__ pDst,
+                            uint32_t deciPoint,
+                            uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex-by-conjugate multiplication kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q8_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   int8_t *__restrict__ pDst,
+                                   uint32_t deciPoint,
+                                   uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q8_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex-by-conjugate multiplication of 8-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel 8-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_conj_instance_q8 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the complex-by-conjugate multiplication of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q16(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcB,
+                             int16_t *__restrict__ pDst,
+                             uint32_t deciPoint,
+                             uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex-by-conjugate multiplication kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q16_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex-by-conjugate multiplication of 16-bit
+                 fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 16-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_conj_instance_q16 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the complex-by-conjugate multiplication of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q32(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcB,
+                             int32_t *__restrict__ pDst,
+                             uint32_t deciPoint,
+                             uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex-by-conjugate multiplication kernel for RV32IM extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q32_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    int32_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief         32-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q32_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex-by-conjugate multiplication of 32-bit
+                 fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mult_conj_instance_q32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the complex-by-conjugate multiplication of 32-bit floating-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_f32(const float32_t *__restrict__ pSrcA,
+                             const float32_t *__restrict__ pSrcB,
+                             float32_t *__restrict__ pDst,
+                             uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_f32_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                     const float32_t *__restrict__ pSrcB,
+                                     float32_t *__restrict__ pDst,
+                                     uint32_t numSamples);
+
+/**
+  @brief         Glue code for the parallel complex-by-conjugate multiplication of 32-bit
+                 floating-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_f32_parallel(const float32_t *__restrict__ pSrcA,
+                                      const float32_t *__restrict__ pSrcB,
+                                      float32_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel 32-bit floating-point complex-by-conjugate multiplication kernel for
+                 XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mult_conj_instance_f32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for the planar complex-by-complex multiplication of 32-bit floating-point
+                vectors.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_f32(const float32_t *__restrict__ pSrcARe,
+                                     const float32_t *__restrict__ pSrcAIm,
+                                     const float32_t *__restrict__ pSrcBRe,
+                                     const float32_t *__restrict__ pSrcBIm,
+                                     float32_t *__restrict__ pDstRe,
+                                     float32_t *__restrict__ pDstIm,
+                                     uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point planar complex-by-complex multiplication kernel for XPULPV2
+                extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_f32_xpulpv2(const float32_t *__restrict__ pSrcARe,
+                                             const float32_t *__restrict__ pSrcAIm,
+                                             const float32_t *__restrict__ pSrcBRe,
+                                             const float32_t *__restrict__ pSrcBIm,
+                                             float32_t *__restrict__ pDstRe,
+                                             float32_t *__restrict__ pDstIm,
+                                             uint32_t numSamples);
+
+/**
+  @brief         Glue code for the planar complex-by-complex multiplication of 16-bit fixed-point
+                vectors.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16(const int16_t *__restrict__ pSrcARe,
+                                     const int16_t *__restrict__ pSrcAIm,
+                                     const int16_t *__restrict__ pSrcBRe,
+                                     const int16_t *__restrict__ pSrcBIm,
+                                     int16_t *__restrict__ pDstRe,
+                                     int16_t *__restrict__ pDstIm,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point planar complex-by-complex multiplication kernel for RV32IM
+                extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16_rv32im(const int16_t *__restrict__ pSrcARe,
+                                            const int16_t *__restrict__ pSrcAIm,
+                                            const int16_t *__restrict__ pSrcBRe,
+                                            const int16_t *__restrict__ pSrcBIm,
+                                            int16_t *__restrict__ pDstRe,
+                                            int16_t *__restrict__ pDstIm,
+                                            uint32_t deciPoint,
+                                            uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point planar complex-by-complex multiplication kernel for XPULPV2
+                extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16_xpulpv2(const int16_t *__restrict__ pSrcARe,
+                                             const int16_t *__restrict__ pSrcAIm,
+                                             const int16_t *__restrict__ pSrcBRe,
+                                             const int16_t *__restrict__ pSrcBIm,
+                                             int16_t *__restrict__ pDstRe,
+                                             int16_t *__restrict__ pDstIm,
+                                             uint32_t deciPoint,
+                                             uint32_t numSamples);
+
+/**
+  @brief         Glue code for the planar complex magnitude squared of a 32-bit floating-point
+                vector.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_f32(const float32_t *__restrict__ pSrcRe,
+                                      const float32_t *__restrict__ pSrcIm,
+                                      float32_t *__restrict__ pDst,
+                                      uint32_t numSamples);
+
+/**
+  @brief         32-bit floating-point planar complex magnitude squared kernel for XPULPV2
+                extension.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_f32_xpulpv2(const float32_t *__restrict__ pSrcRe,
+                                              const float32_t *__restrict__ pSrcIm,
+                                              float32_t *__restrict__ pDst,
+                                              uint32_t numSamples);
+
+/**
+  @brief         Glue code for the planar complex magnitude squared of a 16-bit fixed-point vector.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q16(const int16_t *__restrict__ pSrcRe,
+                                      const int16_t *__restrict__ pSrcIm,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point planar complex magnitude squared kernel for RV32IM extension.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q16_rv32im(const int16_t *__restrict__ pSrcRe,
+                                             const int16_t *__restrict__ pSrcIm,
+                                             int16_t *__restrict__ pDst,
+                                             uint32_t deciPoint,
+                                             uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point planar complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q16_xpulpv2(const int16_t *__restrict__ pSrcRe,
+                                              const int16_t *__restrict__ pSrcIm,
+                                              int16_t *__restrict__ pDst,
+                                              uint32_t deciPoint,
+                                              uint32_t numSamples);
+
+/**
+  @brief         Glue code for the planar complex dot product of 32-bit floating-point vectors.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_f32(const float32_t *pSrcARe,
+                                   const float32_t *pSrcAIm,
+                                   const float32_t *pSrcBRe,
+                                   const float32_t *pSrcBIm,
+                                   uint32_t numSamples,
+                                   float32_t *realResult,
+                                   float32_t *imagResult);
+
+/**
+  @brief         32-bit floating-point planar complex dot product kernel for XPULPV2 extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_f32_xpulpv2(const float32_t *pSrcARe,
+                                           const float32_t *pSrcAIm,
+                                           const float32_t *pSrcBRe,
+                                           const float32_t *pSrcBIm,
+                                           uint32_t numSamples,
+                                           float32_t *realResult,
+                                           float32_t *imagResult);
+
+/**
+  @brief         Glue code for the planar complex dot product of 16-bit fixed-point vectors.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_q16(const int16_t *pSrcARe,
+                                   const int16_t *pSrcAIm,
+                                   const int16_t *pSrcBRe,
+                                   const int16_t *pSrcBIm,
+                                   uint32_t numSamples,
+                                   uint32_t deciPoint,
+                                   int16_t *realResult,
+                                   int16_t *imagResult);
+
+/**
+  @brief         16-bit fixed-point planar complex dot product kernel for RV32IM extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_q16_rv32im(const int16_t *pSrcARe,
+                                          const int16_t *pSrcAIm,
+                                          const int16_t *pSrcBRe,
+                                          const int16_t *pSrcBIm,
+                                          uint32_t numSamples,
+                                          uint32_t deciPoint,
+                                          int16_t *realResult,
+                                          int16_t *imagResult);
+
+/**
+  @brief         16-bit fixed-point planar complex dot product kernel for XPULPV2 extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_q16_xpulpv2(const int16_t *pSrcARe,
+                                           const int16_t *pSrcAIm,
+                                           const int16_t *pSrcBRe,
+                                           const int16_t *pSrcBIm,
+                                           uint32_t numSamples,
+                                           uint32_t deciPoint,
+                                           int16_t *realResult,
+                                           int16_t *imagResult);
+
+#endif // __PLP_COMPLEX_MATH_H__
@@ -0,0 +1,408 @@
+/** ==========================================================================
+ * @file     plp_controller.h
+ * @brief    Controller functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_CONTROLLER_H__
+#define __PLP_CONTROLLER_H__
+
+#include "plp_math_common.h"
+#include "plp_fast_math.h"
+
+/* declared here as well, since plp_common_tables.h includes plp_math.h */
+#if !defined(PLP_QUARTER_WAVE_TABLES)
+extern const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1];
+#endif
+
+/*
+ * The transforms of a single axis and the PID controller are static inline functions, since a
+ * control loop calls them once per period, where the call of a library function costs as much as
+ * the work itself. They are plain C and can be used on the FC and the cluster. The functions for
+ * arrays of axes are library functions, with kernels for RV32IM and XPULPV2.
+ *
+ * All values are in Q1.31 format. Angles in Q1.31 map [-1, 1) to [-pi, pi), such that they wrap
+ * around with the integer overflow. If the library is built with PLP_L1_FAST_MATH_TABLES, the
+ * sine table is in L1 and the FC can use plp_sin_cos_q32 only while the cluster is on.
+ */
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point PID controller, in the incremental form
+           y[n] = y[n-1] + A0 * e[n] + A1 * e[n-1] + A2 * e[n-2].
+    @param[in]  A0      Kp + Ki + Kd
+    @param[in]  A1      -(Kp + 2 * Kd)
+    @param[in]  A2      Kd
+    @param[in]  state   e[n-1], e[n-2] and y[n-1]
+    @param[in]  outMin  lower limit of the output
+    @param[in]  outMax  upper limit of the output
+*/
+typedef struct {
+    int32_t A0;
+    int32_t A1;
+    int32_t A2;
+    int32_t state[3];
+    int32_t outMin;
+    int32_t outMax;
+} plp_pid_instance_q32;
+
+/** -------------------------------------------------------
+    @brief         Saturates a 64-bit value to 32 bits.
+    @param[in]     x  value to saturate
+    @return        x, saturated to [-2^31, 2^31 - 1]
+*/
+
+static inline int32_t plp_sat_q32_inline(int64_t x) {
+    return (int32_t)((x > 0x7FFFFFFF) ? 0x7FFFFFFF : ((x < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : x));
+}
+
+/** -------------------------------------------------------
+    @brief         Sine and cosine of an angle with a single table lookup.
+    @param[in]     theta  angle in Q1.31, [-1, 1) is mapped to [-pi, pi)
+    @param[out]    pSin   points to sin(theta) in Q1.31
+    @param[out]    pCos   points to cos(theta) in Q1.31
+    @return        none
+
+    @par
+    The index in sinTable_q32 and the interpolation weight are computed once, with
+    CONTROLLER_Q32_SHIFT, and the cosine is read a quarter period further in the table.
+*/
+
+static inline void plp_sin_cos_q32(int32_t theta, int32_t *pSin, int32_t *pCos) {
+    uint32_t x = (uint32_t)theta;
+    uint32_t index = x >> CONTROLLER_Q32_SHIFT;
+    int32_t fract = (int32_t)((x - (index << CONTROLLER_Q32_SHIFT)) << 8);
+    int32_t a, b, val;
+
+    a = PLP_SIN_TABLE_Q32(index);
+    b = PLP_SIN_TABLE_Q32(index + 1);
+    val = (int64_t)(0x80000000 - fract) * a >> 32;
+    val = (int32_t)((((int64_t)val << 32) + ((int64_t)fract * b)) >> 32);
+    *pSin = val << 1;
+
+    index = (index + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+    a = PLP_SIN_TABLE_Q32(index);
+    b = PLP_SIN_TABLE_Q32(index + 1);
+    val = (int64_t)(0x80000000 - fract) * a >> 32;
+    val = (int32_t)((((int64_t)val << 32) + ((int64_t)fract * b)) >> 32);
+    *pCos = val << 1;
+}
+
+/** -------------------------------------------------------
+    @brief         Clarke transform of the phase currents a and b of a balanced three-phase system.
+    @param[in]     Ia       phase current a
+    @param[in]     Ib       phase current b
+    @param[out]    pIalpha  points to Ialpha = Ia
+    @param[out]    pIbeta   points to Ibeta = (Ia + 2 * Ib) / sqrt(3), saturated
+    @return        none
+*/
+
+static inline void plp_clarke_q32(int32_t Ia, int32_t Ib, int32_t *pIalpha, int32_t *pIbeta) {
+    /* 1 / sqrt(3) in Q1.31 */
+    int64_t sum = (int64_t)Ia + 2 * (int64_t)Ib;
+
+    *pIalpha = Ia;
+    *pIbeta = plp_sat_q32_inline((sum * 0x49E69D16) >> 31);
+}
+
+/** -------------------------------------------------------
+    @brief         Inverse Clarke transform.
+    @param[in]     Ialpha  alpha component
+    @param[in]     Ibeta   beta component
+    @param[out]    pIa     points to the phase current Ia = Ialpha
+    @param[out]    pIb     points to the phase current Ib = (-Ialpha + sqrt(3) * Ibeta) / 2
+    @return        none
+*/
+
+static inline void plp_clarke_inv_q32(int32_t Ialpha, int32_t Ibeta, int32_t *pIa, int32_t *pIb) {
+    /* sqrt(3) / 2 in Q1.31 */
+    int64_t acc = (int64_t)Ibeta * 0x6ED9EBA1 - ((int64_t)Ialpha << 30);
+
+    *pIa = Ialpha;
+    *pIb = plp_sat_q32_inline(acc >> 31);
+}
+
+/** -------------------------------------------------------
+    @brief         Park transform into the frame rotating with the angle, whose sine and cosine
+                   are computed with plp_sin_cos_q32.
+    @param[in]     Ialpha  alpha component
+    @param[in]     Ibeta   beta component
+    @param[out]    pId     points to Id = Ialpha * cos + Ibeta * sin, saturated
+    @param[out]    pIq     points to Iq = -Ialpha * sin + Ibeta * cos, saturated
+    @param[in]     sinVal  sine of the angle
+    @param[in]     cosVal  cosine of the angle
+    @return        none
+*/
+
+static inline void plp_park_q32(int32_t Ialpha,
+                                int32_t Ibeta,
+                                int32_t *pId,
+                                int32_t *pIq,
+                                int32_t sinVal,
+                                int32_t cosVal) {
+    *pId = plp_sat_q32_inline(((int64_t)Ialpha * cosVal + (int64_t)Ibeta * sinVal) >> 31);
+    *pIq = plp_sat_q32_inline(((int64_t)Ibeta * cosVal - (int64_t)Ialpha * sinVal) >> 31);
+}
+
+/** -------------------------------------------------------
+    @brief         Inverse Park transform.
+    @param[in]     Id       direct component
+    @param[in]     Iq       quadrature component
+    @param[out]    pIalpha  points to Ialpha = Id * cos - Iq * sin, saturated
+    @param[out]    pIbeta   points to Ibeta = Id * sin + Iq * cos, saturated
+    @param[in]     sinVal   sine of the angle
+    @param[in]     cosVal   cosine of the angle
+    @return        none
+*/
+
+static inline void plp_park_inv_q32(int32_t Id,
+                                    int32_t Iq,
+                                    int32_t *pIalpha,
+                                    int32_t *pIbeta,
+                                    int32_t sinVal,
+                                    int32_t cosVal) {
+    *pIalpha = plp_sat_q32_inline(((int64_t)Id * cosVal - (int64_t)Iq * sinVal) >> 31);
+    *pIbeta = plp_sat_q32_inline(((int64_t)Id * sinVal + (int64_t)Iq * cosVal) >> 31);
+}
+
+/** -------------------------------------------------------
+    @brief         One step of the 32-bit fixed point PID controller.
+    @param[in,out] S   points to an instance initialized by plp_pid_init_q32
+    @param[in]     in  error e[n]
+    @return        output y[n], limited to [outMin, outMax]
+
+    @par
+    In the incremental form, limiting the output also limits the integral part (anti-windup).
+*/
+
+static inline int32_t plp_pid_q32(plp_pid_instance_q32 *S, int32_t in) {
+    int64_t acc = ((int64_t)S->state[2] << 31) + (int64_t)S->A0 * in +
+                  (int64_t)S->A1 * S->state[0] + (int64_t)S->A2 * S->state[1];
+    int32_t out = plp_sat_q32_inline(acc >> 31);
+
+    out = (out > S->outMax) ? S->outMax : ((out < S->outMin) ? S->outMin : out);
+
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    return out;
+}
+
+/** -------------------------------------------------------
+ * @brief      Initialization of the 32-bit fixed point PID controller.
+ *
+ * @param[out] S       points to an instance of the PID controller
+ * @param[in]  Kp      proportional gain in Q1.31
+ * @param[in]  Ki      integral gain in Q1.31
+ * @param[in]  Kd      derivative gain in Q1.31
+ * @param[in]  outMin  lower limit of the output
+ * @param[in]  outMax  upper limit of the output
+ *
+ * @return     none
+ */
+
+void plp_pid_init_q32(plp_pid_instance_q32 *S,
+                      int32_t Kp,
+                      int32_t Ki,
+                      int32_t Kd,
+                      int32_t outMin,
+                      int32_t outMax);
+
+/** -------------------------------------------------------
+ * @brief      Clears the state of the 32-bit fixed point PID controller.
+ *
+ * @param[in,out] S  points to an instance of the PID controller
+ *
+ * @return     none
+ */
+
+void plp_pid_reset_q32(plp_pid_instance_q32 *S);
+
+/** -------------------------------------------------------
+ * @brief      Glue code for the Clarke and Park transform of several axes
+ *
+ * @param[in]  pIa      points to the phase currents a
+ * @param[in]  pIb      points to the phase currents b
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pId      points to the direct components
+ * @param[out] pIq      points to the quadrature components
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_clarke_park_q32_vec(const int32_t *__restrict__ pIa,
+                             const int32_t *__restrict__ pIb,
+                             const int32_t *__restrict__ pTheta,
+                             int32_t *__restrict__ pId,
+                             int32_t *__restrict__ pIq,
+                             uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      Clarke and Park transform of several axes for RV32IM
+ *
+ * @param[in]  pIa      points to the phase currents a
+ * @param[in]  pIb      points to the phase currents b
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pId      points to the direct components
+ * @param[out] pIq      points to the quadrature components
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_clarke_park_vec_q32s_rv32im(const int32_t *__restrict__ pIa,
+                                     const int32_t *__restrict__ pIb,
+                                     const int32_t *__restrict__ pTheta,
+                                     int32_t *__restrict__ pId,
+                                     int32_t *__restrict__ pIq,
+                                     uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      Clarke and Park transform of several axes for XPULPV2
+ *
+ * @param[in]  pIa      points to the phase currents a
+ * @param[in]  pIb      points to the phase currents b
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pId      points to the direct components
+ * @param[out] pIq      points to the quadrature components
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_clarke_park_vec_q32s_xpulpv2(const int32_t *__restrict__ pIa,
+                                      const int32_t *__restrict__ pIb,
+                                      const int32_t *__restrict__ pTheta,
+                                      int32_t *__restrict__ pId,
+                                      int32_t *__restrict__ pIq,
+                                      uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      Glue code for the inverse Park and Clarke transform of several axes
+ *
+ * @param[in]  pId      points to the direct components
+ * @param[in]  pIq      points to the quadrature components
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pIa      points to the phase values a
+ * @param[out] pIb      points to the phase values b
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_park_clarke_inv_q32_vec(const int32_t *__restrict__ pId,
+                                 const int32_t *__restrict__ pIq,
+                                 const int32_t *__restrict__ pTheta,
+                                 int32_t *__restrict__ pIa,
+                                 int32_t *__restrict__ pIb,
+                                 uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      Inverse Park and Clarke transform of several axes for RV32IM
+ *
+ * @param[in]  pId      points to the direct components
+ * @param[in]  pIq      points to the quadrature components
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pIa      points to the phase values a
+ * @param[out] pIb      points to the phase values b
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_park_clarke_inv_vec_q32s_rv32im(const int32_t *__restrict__ pId,
+                                         const int32_t *__restrict__ pIq,
+                                         const int32_t *__restrict__ pTheta,
+                                         int32_t *__restrict__ pIa,
+                                         int32_t *__restrict__ pIb,
+                                         uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      Inverse Park and Clarke transform of several axes for XPULPV2
+ *
+ * @param[in]  pId      points to the direct components
+ * @param[in]  pIq      points to the quadrature components
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pIa      points to the phase values a
+ * @param[out] pIb      points to the phase values b
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_park_clarke_inv_vec_q32s_xpulpv2(const int32_t *__restrict__ pId,
+                                          const int32_t *__restrict__ pIq,
+                                          const int32_t *__restrict__ pTheta,
+                                          int32_t *__restrict__ pIa,
+                                          int32_t *__restrict__ pIb,
+                                          uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      Glue code for one step of several 32-bit fixed point PID controllers
+ *
+ * @param[in,out] S        points to an array of numAxes PID instances
+ * @param[in]     pIn      points to the errors, one per controller
+ * @param[out]    pOut     points to the outputs, one per controller
+ * @param[in]     numAxes  number of controllers
+ *
+ * @return     none
+ */
+
+void plp_pid_q32_vec(plp_pid_instance_q32 *__restrict__ S,
+                     const int32_t *__restrict__ pIn,
+                     int32_t *__restrict__ pOut,
+                     uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      One step of several 32-bit fixed point PID controllers for RV32IM
+ *
+ * @param[in,out] S        points to an array of numAxes PID instances
+ * @param[in]     pIn      points to the errors, one per controller
+ * @param[out]    pOut     points to the outputs, one per controller
+ * @param[in]     numAxes  number of controllers
+ *
+ * @return     none
+ */
+
+void plp_pid_vec_q32s_rv32im(plp_pid_instance_q32 *__restrict__ S,
+                             const int32_t *__restrict__ pIn,
+                             int32_t *__restrict__ pOut,
+                             uint32_t numAxes);
+
+/** -------------------------------------------------------
+ * @brief      One step of several 32-bit fixed point PID controllers for XPULPV2
+ *
+ * @param[in,out] S        points to an array of numAxes PID instances
+ * @param[in]     pIn      points to the errors, one per controller
+ * @param[out]    pOut     points to the outputs, one per controller
+ * @param[in]     numAxes  number of controllers
+ *
+ * @return     none
+ */
+
+void plp_pid_vec_q32s_xpulpv2(plp_pid_instance_q32 *__restrict__ S,
+                              const int32_t *__restrict__ pIn,
+                              int32_t *__restrict__ pOut,
+                              uint32_t numAxes);
+
+#endif // __PLP_CONTROLLER_H__
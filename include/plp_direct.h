@@ -0,0 +1,1882 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_direct.h
+ * Description:  Compile-time kernel selection, generated by gen_plp_direct.py
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Include this header after plp_math.h in the application, and build the application with
+ * PLP_TARGET_CLUSTER_ONLY (if the functions are only called from the cluster) or PLP_TARGET_FC_ONLY
+ * (if they are only called from the fabric controller). The glue functions, which only check
+ * rt_cluster_id() and call the kernel, are then replaced by a direct call of the kernel for this
+ * target. This removes the check and one call per function call, which matters for short blocks in
+ * tight loops. All other functions are not changed. The library itself is built without these
+ * options. Calling a function on the other target than the one selected is not supported.
+ */
+
+#ifndef __PLP_DIRECT_H__
+#define __PLP_DIRECT_H__
+
+#include "plp_math.h"
+
+#if defined(PLP_TARGET_CLUSTER_ONLY) && defined(PLP_TARGET_FC_ONLY)
+#error "PLP_TARGET_CLUSTER_ONLY and PLP_TARGET_FC_ONLY must not be defined at the same time"
+#endif
+
+// the profiling wrappers of plp_profile.h need the glue functions
+#if !defined(PLP_PROFILE)
+
+#if defined(PLP_TARGET_CLUSTER_ONLY)
+
+#define plp_abs_f32(pSrc, pDst, blockSize) plp_abs_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_abs_i16(pSrc, pDst, blockSize) plp_abs_i16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_abs_i32(pSrc, pDst, blockSize) plp_abs_i32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_abs_i8(pSrc, pDst, blockSize) plp_abs_i8s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_add_f32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_add_f32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_i16(pSrcA, pSrcB, pDst, blockSize) \
+    plp_add_i16s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_i32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_add_i32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_i8(pSrcA, pSrcB, pDst, blockSize) plp_add_i8s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_q16(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_add_q16s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_add_q32(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_add_q32s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_add_q8(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_add_q8s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_analytic_f32(S, pSrc, pDst) plp_analytic_f32s_xpulpv2(S, pSrc, pDst)
+#define plp_atan2_f32(y, x) plp_atan2_f32s_xpulpv2(y, x)
+#define plp_atan2_q16(y, x) plp_atan2_q16s_xpulpv2(y, x)
+#define plp_atan2_q32(y, x) plp_atan2_q32s_xpulpv2(y, x)
+#define plp_autocorr_f32(pSrc, blockSize, numLags, pRes) \
+    plp_autocorr_f32s_xpulpv2(pSrc, blockSize, numLags, pRes)
+#define plp_autocorr_q16(pSrc, blockSize, numLags, fracBits, pRes) \
+    plp_autocorr_q16s_xpulpv2(pSrc, blockSize, numLags, fracBits, pRes)
+#define plp_autocorr_q32(pSrc, blockSize, numLags, fracBits, pRes) \
+    plp_autocorr_q32s_xpulpv2(pSrc, blockSize, numLags, fracBits, pRes)
+#define plp_avgpool_i8(pSrc, H, W, C, kH, kW, stride, pDst) \
+    plp_avgpool_i8s_xpulpv2(pSrc, H, W, C, kH, kW, stride, pDst)
+#define plp_bf16_to_f32(pSrc, pDst, blockSize) plp_bf16_to_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_biquad_cascade_df1_q16(S, pSrc, blockSize, pDst) \
+    plp_biquad_cascade_df1_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_biquad_cascade_df1_q32(S, pSrc, blockSize, pDst) \
+    plp_biquad_cascade_df1_q32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_biquad_cascade_df2T_f32(S, pSrc, blockSize, pDst) \
+    plp_biquad_cascade_df2T_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_cfft_bfp_q16(S, p1, ifftFlag, bitReverseFlag) \
+    plp_cfft_bfp_q16s_xpulpv2(S, p1, ifftFlag, bitReverseFlag)
+#define plp_cfft_mr_f32(S, p1, pScratch, ifftFlag) \
+    plp_cfft_mr_f32s_xpulpv2(S, p1, pScratch, ifftFlag)
+#define plp_cfft_mr_q16(S, p1, pScratch, ifftFlag) \
+    plp_cfft_mr_q16s_xpulpv2(S, p1, pScratch, ifftFlag)
+#define plp_cfft_q32(S, p1, ifftFlag, bitReverseFlag) \
+    plp_cfft_q32s_xpulpv2(S, p1, ifftFlag, bitReverseFlag)
+#define plp_cic_decimate_i32(S, pSrc, blockSize, pDst) \
+    plp_cic_decimate_i32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_cic_decimate_q32(S, pSrc, blockSize, pDst) \
+    plp_cic_decimate_q32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_cic_interpolate_i32(S, pSrc, blockSize, pDst) \
+    plp_cic_interpolate_i32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_cic_interpolate_q32(S, pSrc, blockSize, pDst) \
+    plp_cic_interpolate_q32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_clarke_park_q32_vec(pIa, pIb, pTheta, pId, pIq, numAxes) \
+    plp_clarke_park_vec_q32s_xpulpv2(pIa, pIb, pTheta, pId, pIq, numAxes)
+#define plp_clip_f32(pSrc, low, high, pDst, blockSize) \
+    plp_clip_f32s_xpulpv2(pSrc, low, high, pDst, blockSize)
+#define plp_clip_i16(pSrc, low, high, pDst, blockSize) \
+    plp_clip_i16s_xpulpv2(pSrc, low, high, pDst, blockSize)
+#define plp_clip_i32(pSrc, low, high, pDst, blockSize) \
+    plp_clip_i32s_xpulpv2(pSrc, low, high, pDst, blockSize)
+#define plp_clip_i8(pSrc, low, high, pDst, blockSize) \
+    plp_clip_i8s_xpulpv2(pSrc, low, high, pDst, blockSize)
+#define plp_cmplx_arg_f32(pSrc, pDst, numSamples) plp_cmplx_arg_f32_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_arg_q16(pSrc, pDst, numSamples) plp_cmplx_arg_q16_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_arg_q32(pSrc, pDst, numSamples) plp_cmplx_arg_q32_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_f32(pSrc, pDst, numSamples) \
+    plp_cmplx_conj_f32_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_i16(pSrc, pDst, numSamples) \
+    plp_cmplx_conj_i16_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_i32(pSrc, pDst, numSamples) \
+    plp_cmplx_conj_i32_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_i8(pSrc, pDst, numSamples) plp_cmplx_conj_i8_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_dot_prod_f32(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_f32_xpulpv2(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_i16(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_i16_xpulpv2(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_i32(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_i32_xpulpv2(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_i8(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_i8_xpulpv2(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_planar_f32(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_planar_f32_xpulpv2(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_planar_q16(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples, deciPoint, realResult, imagResult) \
+    plp_cmplx_dot_prod_planar_q16_xpulpv2(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples, deciPoint, realResult, imagResult)
+#define plp_cmplx_dot_prod_q16(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult) \
+    plp_cmplx_dot_prod_q16_xpulpv2(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult)
+#define plp_cmplx_dot_prod_q32(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult) \
+    plp_cmplx_dot_prod_q32_xpulpv2(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult)
+#define plp_cmplx_mac_batched_f32(pSrcA, pSrcB, pDst, numSamples, numChannels) \
+    plp_cmplx_mac_batched_f32_xpulpv2(pSrcA, pSrcB, pDst, numSamples, numChannels)
+#define plp_cmplx_mac_batched_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels) \
+    plp_cmplx_mac_batched_q16_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels)
+#define plp_cmplx_mac_batched_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels) \
+    plp_cmplx_mac_batched_q32_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels)
+#define plp_cmplx_mac_f32(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mac_f32_xpulpv2(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mac_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mac_q16_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mac_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mac_q32_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_approx_f32(pSrc, pRes, numSamples) \
+    plp_cmplx_mag_approx_f32_xpulpv2(pSrc, pRes, numSamples)
+#define plp_cmplx_mag_approx_q16(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_approx_q16_xpulpv2(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_approx_q32(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_approx_q32_xpulpv2(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_f32(pSrc, pRes, numSamples) plp_cmplx_mag_f32_xpulpv2(pSrc, pRes, numSamples)
+#define plp_cmplx_mag_i16(pSrc, pRes, numSamples) plp_cmplx_mag_i16_xpulpv2(pSrc, pRes, numSamples)
+#define plp_cmplx_mag_i32(pSrc, pRes, numSamples) plp_cmplx_mag_i32_xpulpv2(pSrc, pRes, numSamples)
+#define plp_cmplx_mag_q16(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_q16_xpulpv2(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_q32(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_q32_xpulpv2(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_squared_f32(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_f32_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_i16(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_i16_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_i32(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_i32_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_i8(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_i8_xpulpv2(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_planar_f32(pSrcRe, pSrcIm, pDst, numSamples) \
+    plp_cmplx_mag_squared_planar_f32_xpulpv2(pSrcRe, pSrcIm, pDst, numSamples)
+#define plp_cmplx_mag_squared_planar_q16(pSrcRe, pSrcIm, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_planar_q16_xpulpv2(pSrcRe, pSrcIm, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_squared_q16(pSrc, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_q16_xpulpv2(pSrc, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_squared_q32(pSrc, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_q32_xpulpv2(pSrc, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_squared_q8(pSrc, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_q8_xpulpv2(pSrc, pDst, deciPoint, numSamples)
+#define plp_cmplx_merge_f32(pRe, pIm, pDst, numSamples) \
+    plp_cmplx_merge_f32s_xpulpv2(pRe, pIm, pDst, numSamples)
+#define plp_cmplx_merge_i16(pRe, pIm, pDst, numSamples) \
+    plp_cmplx_merge_i16s_xpulpv2(pRe, pIm, pDst, numSamples)
+#define plp_cmplx_merge_i32(pRe, pIm, pDst, numSamples) \
+    plp_cmplx_merge_i32s_xpulpv2(pRe, pIm, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_f32(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_f32_xpulpv2(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_i16(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_i16_xpulpv2(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_i32(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_i32_xpulpv2(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_i8(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_i8_xpulpv2(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_planar_f32(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm, numSamples) \
+    plp_cmplx_mult_cmplx_planar_f32_xpulpv2(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm, numSamples)
+#define plp_cmplx_mult_cmplx_planar_q16(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_planar_q16_xpulpv2(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm, deciPoint, numSamples)
+#define plp_cmplx_mult_cmplx_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_q16_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_cmplx_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_q32_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_cmplx_q8(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_q8_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_conj_f32(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_conj_f32_xpulpv2(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_conj_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_conj_q16_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_conj_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_conj_q32_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_conj_q8(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_conj_q8_xpulpv2(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_real_f32(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_f32_xpulpv2(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_i16(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_i16_xpulpv2(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_i32(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_i32_xpulpv2(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_i8(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_i8_xpulpv2(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_q16(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_real_q16_xpulpv2(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_real_q32(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_real_q32_xpulpv2(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_real_q8(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_real_q8_xpulpv2(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples)
+#define plp_cmplx_split_f32(pSrc, pRe, pIm, numSamples) \
+    plp_cmplx_split_f32s_xpulpv2(pSrc, pRe, pIm, numSamples)
+#define plp_cmplx_split_i16(pSrc, pRe, pIm, numSamples) \
+    plp_cmplx_split_i16s_xpulpv2(pSrc, pRe, pIm, numSamples)
+#define plp_cmplx_split_i32(pSrc, pRe, pIm, numSamples) \
+    plp_cmplx_split_i32s_xpulpv2(pSrc, pRe, pIm, numSamples)
+#define plp_conv1d_f32(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    plp_conv1d_f32s_xpulpv2(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv1d_i2(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    PLP_CL_KERNEL(plp_conv1d_i2s)(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv1d_i4(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    PLP_CL_KERNEL(plp_conv1d_i4s)(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv1d_i8(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    plp_conv1d_i8s_xpulpv2(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv2d_i16(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst) \
+    plp_conv2d_i16s_xpulpv2(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst)
+#define plp_conv2d_i8(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst) \
+    plp_conv2d_i8s_xpulpv2(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst)
+#define plp_conv_depthwise_i8(pSrc, H, W, C, pKernel, kH, kW, stride, pad, pDst) \
+    plp_conv_depthwise_i8s_xpulpv2(pSrc, H, W, C, pKernel, kH, kW, stride, pad, pDst)
+#define plp_conv_valid_winograd_f32(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst) \
+    plp_conv_valid_winograd_f32s_xpulpv2(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst)
+#define plp_conv_valid_winograd_i16(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst) \
+    plp_conv_valid_winograd_i16s_xpulpv2(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst)
+#define plp_correlate_i16(pSrcA, srcALen, pSrcB, srcBLen, pRes) \
+    plp_correlate_i16s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, pRes)
+#define plp_correlate_i32(pSrcA, srcALen, pSrcB, srcBLen, pRes) \
+    plp_correlate_i32s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, pRes)
+#define plp_correlate_i8(pSrcA, srcALen, pSrcB, srcBLen, pRes) \
+    plp_correlate_i8s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, pRes)
+#define plp_cos_f32(x) plp_cos_f32s_xpulpv2(x)
+#define plp_cos_f32_vec(pSrc, pDst, blockSize) plp_cos_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_cos_q16(x) plp_cos_q16s_xpulpv2(x)
+#define plp_cos_q16_vec(pSrc, pDst, blockSize) plp_cos_vec_q16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_cos_q32(x) plp_cos_q32s_xpulpv2(x)
+#define plp_cos_q32_vec(pSrc, pDst, blockSize) plp_cos_vec_q32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_cumsum_f32(pSrc, pDst, blockSize) plp_cumsum_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_cumsum_i16(pSrc, pDst, blockSize) plp_cumsum_i16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_cumsum_i32(pSrc, pDst, blockSize) plp_cumsum_i32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_czt_f32(S, pSrc, pDst, pScratch) plp_czt_f32s_xpulpv2(S, pSrc, pDst, pScratch)
+#define plp_db_f32_vec(pSrc, pDst, blockSize) plp_db_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_db_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_db_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_dct4_q16(S, pSrc, pScratch, pDst) plp_dct4_q16s_xpulpv2(S, pSrc, pScratch, pDst)
+#define plp_deinterleave_f32(pSrc, numChannels, numSamples, pDst) \
+    plp_deinterleave_f32s_xpulpv2(pSrc, numChannels, numSamples, pDst)
+#define plp_deinterleave_i16(pSrc, numChannels, numSamples, pDst) \
+    plp_deinterleave_i16s_xpulpv2(pSrc, numChannels, numSamples, pDst)
+#define plp_deinterleave_i32(pSrc, numChannels, numSamples, pDst) \
+    plp_deinterleave_i32s_xpulpv2(pSrc, numChannels, numSamples, pDst)
+#define plp_dequantize_i32_f32(pSrc, blockSize, scale, zeroPoint, pDst) \
+    plp_dequantize_i32_f32s_xpulpv2(pSrc, blockSize, scale, zeroPoint, pDst)
+#define plp_div_q16(pSrcA, pSrcB, fracBits, pDst, blockSize) \
+    plp_div_q16s_xpulpv2(pSrcA, pSrcB, fracBits, pDst, blockSize)
+#define plp_div_q32(pSrcA, pSrcB, fracBits, pDst, blockSize) \
+    plp_div_q32s_xpulpv2(pSrcA, pSrcB, fracBits, pDst, blockSize)
+#define plp_dot_prod_bin(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_bins_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_f32(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_f32s_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i16(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i16s_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i2(pSrcA, pSrcB, blockSize, pRes) \
+    PLP_CL_KERNEL(plp_dot_prod_i2s)(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i32(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i32s_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i4(pSrcA, pSrcB, blockSize, pRes) \
+    PLP_CL_KERNEL(plp_dot_prod_i4s)(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i8(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i8s_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i8xi16(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i8xi16s_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_q16(pSrcA, pSrcB, blockSize, deciPoint, pRes) \
+    plp_dot_prod_q16s_xpulpv2(pSrcA, pSrcB, blockSize, deciPoint, pRes)
+#define plp_dot_prod_q32(pSrcA, pSrcB, blockSize, deciPoint, pRes) \
+    plp_dot_prod_q32s_xpulpv2(pSrcA, pSrcB, blockSize, deciPoint, pRes)
+#define plp_dot_prod_q8(pSrcA, pSrcB, blockSize, deciPoint, pRes) \
+    plp_dot_prod_q8s_xpulpv2(pSrcA, pSrcB, blockSize, deciPoint, pRes)
+#define plp_dot_prod_ter(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_ters_xpulpv2(pSrcA, pSrcB, blockSize, pRes)
+#define plp_exp_f32(x) plp_exp_f32s_xpulpv2(x)
+#define plp_exp_f32_vec(pSrc, pDst, blockSize) plp_exp_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_exp_q16(x, fracBits) plp_exp_q16s_xpulpv2(x, fracBits)
+#define plp_exp_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_exp_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_exp_q32(x, fracBits) plp_exp_q32s_xpulpv2(x, fracBits)
+#define plp_exp_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_exp_vec_q32s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_f16_to_f32(pSrc, pDst, blockSize) plp_f16_to_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_f32_to_bf16(pSrc, pDst, blockSize) plp_f32_to_bf16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_f32_to_f16(pSrc, pDst, blockSize) plp_f32_to_f16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_f32_to_q16(pSrc, deciPoint, pDst, blockSize) \
+    plp_f32_to_q16s_xpulpv2(pSrc, deciPoint, pDst, blockSize)
+#define plp_f32_to_q32(pSrc, deciPoint, pDst, blockSize) \
+    plp_f32_to_q32s_xpulpv2(pSrc, deciPoint, pDst, blockSize)
+#define plp_f32_to_q8(pSrc, deciPoint, pDst, blockSize) \
+    plp_f32_to_q8s_xpulpv2(pSrc, deciPoint, pDst, blockSize)
+#define plp_fir_decimate_f32(S, pSrc, blockSize, pDst) \
+    plp_fir_decimate_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_decimate_q16(S, pSrc, blockSize, pDst) \
+    plp_fir_decimate_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_decimate_q32(S, pSrc, blockSize, pDst) \
+    plp_fir_decimate_q32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_f32(S, pSrc, blockSize, pDst) plp_fir_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_interpolate_f32(S, pSrc, blockSize, pDst) \
+    plp_fir_interpolate_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_interpolate_q16(S, pSrc, blockSize, pDst) \
+    plp_fir_interpolate_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_interpolate_q32(S, pSrc, blockSize, pDst) \
+    plp_fir_interpolate_q32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_q16(S, pSrc, blockSize, pDst) plp_fir_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_q32(S, pSrc, blockSize, pDst) plp_fir_q32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_fir_q8(S, pSrc, blockSize, pDst) plp_fir_q8s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_gemm_cmplx_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, transA, transB, pAlpha, pBeta, pDstC) \
+    plp_gemm_cmplx_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, transA, transB, pAlpha, pBeta, pDstC)
+#define plp_gemm_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, transA, transB, alpha, beta, pDstC) \
+    plp_gemm_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, transA, transB, alpha, beta, pDstC)
+#define plp_goertzel_f32(S, pSrc, blockSize, pDst) \
+    plp_goertzel_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_goertzel_q16(S, pSrc, blockSize, pDst) \
+    plp_goertzel_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_gru_cell_i8(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH) \
+    plp_gru_cell_i8s_xpulpv2(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH)
+#define plp_gru_cell_q16(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH) \
+    plp_gru_cell_q16s_xpulpv2(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH)
+#define plp_hilbert_fir_q16(S, pSrc, blockSize, pDst) \
+    plp_hilbert_fir_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_histogram_f32(pSrc, blockSize, minValue, binWidth, nBins, pHist) \
+    plp_histogram_f32s_xpulpv2(pSrc, blockSize, minValue, binWidth, nBins, pHist)
+#define plp_histogram_i16(pSrc, blockSize, minValue, binShift, nBins, pHist) \
+    plp_histogram_i16s_xpulpv2(pSrc, blockSize, minValue, binShift, nBins, pHist)
+#define plp_histogram_i8(pSrc, blockSize, minValue, binShift, nBins, pHist) \
+    plp_histogram_i8s_xpulpv2(pSrc, blockSize, minValue, binShift, nBins, pHist)
+#define plp_i16_to_i32(pSrc, shift, pDst, blockSize) \
+    plp_i16_to_i32s_xpulpv2(pSrc, shift, pDst, blockSize)
+#define plp_i16_to_i8(pSrc, shift, pDst, blockSize) \
+    plp_i16_to_i8s_xpulpv2(pSrc, shift, pDst, blockSize)
+#define plp_i32_to_i16(pSrc, shift, pDst, blockSize) \
+    plp_i32_to_i16s_xpulpv2(pSrc, shift, pDst, blockSize)
+#define plp_i32_to_i8(pSrc, shift, pDst, blockSize) \
+    plp_i32_to_i8s_xpulpv2(pSrc, shift, pDst, blockSize)
+#define plp_i8_to_i16(pSrc, shift, pDst, blockSize) \
+    plp_i8_to_i16s_xpulpv2(pSrc, shift, pDst, blockSize)
+#define plp_i8_to_i32(pSrc, shift, pDst, blockSize) \
+    plp_i8_to_i32s_xpulpv2(pSrc, shift, pDst, blockSize)
+#define plp_im2col_i8(pSrc, H, W, C, kH, kW, stride, pad, pDst) \
+    plp_im2col_i8s_xpulpv2(pSrc, H, W, C, kH, kW, stride, pad, pDst)
+#define plp_integral_image_f32(pSrc, M, N, pDst) plp_integral_image_f32s_xpulpv2(pSrc, M, N, pDst)
+#define plp_integral_image_i16(pSrc, M, N, pDst) plp_integral_image_i16s_xpulpv2(pSrc, M, N, pDst)
+#define plp_integral_image_i32(pSrc, M, N, pDst) plp_integral_image_i32s_xpulpv2(pSrc, M, N, pDst)
+#define plp_interleave_f32(pSrc, numChannels, numSamples, pDst) \
+    plp_interleave_f32s_xpulpv2(pSrc, numChannels, numSamples, pDst)
+#define plp_interleave_i16(pSrc, numChannels, numSamples, pDst) \
+    plp_interleave_i16s_xpulpv2(pSrc, numChannels, numSamples, pDst)
+#define plp_interleave_i32(pSrc, numChannels, numSamples, pDst) \
+    plp_interleave_i32s_xpulpv2(pSrc, numChannels, numSamples, pDst)
+#define plp_kalman_predict_f32(S) plp_kalman_predict_f32s_xpulpv2(S)
+#define plp_kalman_update_f32(S, pZ) plp_kalman_update_f32s_xpulpv2(S, pZ)
+#define plp_layernorm_f32(pSrc, nRows, rowLen, pGamma, pBeta, eps, pDst) \
+    plp_layernorm_f32s_xpulpv2(pSrc, nRows, rowLen, pGamma, pBeta, eps, pDst)
+#define plp_layernorm_q16(pSrc, nRows, rowLen, pGamma, pBeta, eps, fracBits, pDst) \
+    plp_layernorm_q16s_xpulpv2(pSrc, nRows, rowLen, pGamma, pBeta, eps, fracBits, pDst)
+#define plp_levinson_durbin_f32(pPhi, order, pA, pRefl, pErr) \
+    plp_levinson_durbin_f32s_xpulpv2(pPhi, order, pA, pRefl, pErr)
+#define plp_levinson_durbin_q32(pPhi, order, fracBits, pA, pRefl, pErr) \
+    plp_levinson_durbin_q32s_xpulpv2(pPhi, order, fracBits, pA, pRefl, pErr)
+#define plp_lms_f32(S, pSrc, pRef, pOut, pErr, blockSize) \
+    plp_lms_f32s_xpulpv2(S, pSrc, pRef, pOut, pErr, blockSize)
+#define plp_lms_norm_f32(S, pSrc, pRef, pOut, pErr, blockSize) \
+    plp_lms_norm_f32s_xpulpv2(S, pSrc, pRef, pOut, pErr, blockSize)
+#define plp_lms_norm_q16(S, pSrc, pRef, pOut, pErr, blockSize) \
+    plp_lms_norm_q16s_xpulpv2(S, pSrc, pRef, pOut, pErr, blockSize)
+#define plp_lms_q16(S, pSrc, pRef, pOut, pErr, blockSize) \
+    plp_lms_q16s_xpulpv2(S, pSrc, pRef, pOut, pErr, blockSize)
+#define plp_log2_f32_vec(pSrc, pDst, blockSize) plp_log2_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_log2_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_log2_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_log_f32(x) plp_log_f32s_xpulpv2(x)
+#define plp_log_f32_vec(pSrc, pDst, blockSize) plp_log_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_log_q16(x, fracBits) plp_log_q16s_xpulpv2(x, fracBits)
+#define plp_log_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_log_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_log_q32(x, fracBits) plp_log_q32s_xpulpv2(x, fracBits)
+#define plp_log_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_log_vec_q32s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_lstm_cell_i8(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC) \
+    plp_lstm_cell_i8s_xpulpv2(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC)
+#define plp_lstm_cell_q16(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC) \
+    plp_lstm_cell_q16s_xpulpv2(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC)
+#define plp_lut_interp_f32(S, x) plp_lut_interp_f32s_xpulpv2(S, x)
+#define plp_lut_interp_f32_vec(S, pSrc, pDst, blockSize) \
+    plp_lut_interp_vec_f32s_xpulpv2(S, pSrc, pDst, blockSize)
+#define plp_lut_interp_q16(S, x) plp_lut_interp_q16s_xpulpv2(S, x)
+#define plp_lut_interp_q16_vec(S, pSrc, pDst, blockSize) \
+    plp_lut_interp_vec_q16s_xpulpv2(S, pSrc, pDst, blockSize)
+#define plp_lut_interp_q32(S, x) plp_lut_interp_q32s_xpulpv2(S, x)
+#define plp_lut_interp_q32_vec(S, pSrc, pDst, blockSize) \
+    plp_lut_interp_vec_q32s_xpulpv2(S, pSrc, pDst, blockSize)
+#define plp_mat_add_f32(pSrcA, pSrcB, M, N, pDst) plp_mat_add_f32s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_i16(pSrcA, pSrcB, M, N, pDst) plp_mat_add_i16s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_i32(pSrcA, pSrcB, M, N, pDst) plp_mat_add_i32s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_i8(pSrcA, pSrcB, M, N, pDst) plp_mat_add_i8s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_inplace_f32(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_f32s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_inplace_i16(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_i16s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_inplace_i32(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_i32s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_inplace_i8(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_i8s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_stride_f32(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_add_stride_i16(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_add_stride_i32(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_add_stride_i8(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_cholesky_f32(pSrc, N, pDst) \
+    plp_mat_cholesky_stride_f32s_xpulpv2(pSrc, N, N, N, pDst)
+#define plp_mat_cholesky_q32(pSrc, N, fracBits, pDst) \
+    plp_mat_cholesky_stride_q32s_xpulpv2(pSrc, N, N, N, fracBits, pDst)
+#define plp_mat_cholesky_stride_f32(pSrc, N, strideSrc, strideDst, pDst) \
+    plp_mat_cholesky_stride_f32s_xpulpv2(pSrc, N, strideSrc, strideDst, pDst)
+#define plp_mat_cholesky_stride_q32(pSrc, N, strideSrc, strideDst, fracBits, pDst) \
+    plp_mat_cholesky_stride_q32s_xpulpv2(pSrc, N, strideSrc, strideDst, fracBits, pDst)
+#define plp_mat_copy_stride_f32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_f32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_copy_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_i16s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_copy_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_i32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_copy_stride_i8(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_i8s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_det_small_f32(pSrc, N, pDet) plp_mat_det_small_f32s_xpulpv2(pSrc, N, pDet)
+#define plp_mat_fill_I_f32(N, pDst) plp_mat_fill_I_f32s_xpulpv2(N, pDst)
+#define plp_mat_fill_I_i16(N, pDst) plp_mat_fill_I_i16s_xpulpv2(N, pDst)
+#define plp_mat_fill_I_i32(N, pDst) plp_mat_fill_I_i32s_xpulpv2(N, pDst)
+#define plp_mat_fill_I_i8(N, pDst) plp_mat_fill_I_i8s_xpulpv2(N, pDst)
+#define plp_mat_fill_I_q16(N, fracBits, pDst) plp_mat_fill_I_q16s_xpulpv2(N, fracBits, pDst)
+#define plp_mat_fill_I_q32(N, fracBits, pDst) plp_mat_fill_I_q32s_xpulpv2(N, fracBits, pDst)
+#define plp_mat_fill_I_q8(N, fracBits, pDst) plp_mat_fill_I_q8s_xpulpv2(N, fracBits, pDst)
+#define plp_mat_fill_I_stride_f32(N, stride, pDst) \
+    plp_mat_fill_I_stride_f32s_xpulpv2(N, stride, pDst)
+#define plp_mat_fill_I_stride_i16(N, stride, pDst) \
+    plp_mat_fill_I_stride_i16s_xpulpv2(N, stride, pDst)
+#define plp_mat_fill_I_stride_i32(N, stride, pDst) \
+    plp_mat_fill_I_stride_i32s_xpulpv2(N, stride, pDst)
+#define plp_mat_fill_I_stride_i8(N, stride, pDst) plp_mat_fill_I_stride_i8s_xpulpv2(N, stride, pDst)
+#define plp_mat_fill_I_stride_q16(N, stride, fracBits, pDst) \
+    plp_mat_fill_I_stride_q16s_xpulpv2(N, stride, fracBits, pDst)
+#define plp_mat_fill_I_stride_q32(N, stride, fracBits, pDst) \
+    plp_mat_fill_I_stride_q32s_xpulpv2(N, stride, fracBits, pDst)
+#define plp_mat_fill_I_stride_q8(N, stride, fracBits, pDst) \
+    plp_mat_fill_I_stride_q8s_xpulpv2(N, stride, fracBits, pDst)
+#define plp_mat_fill_stride_f32(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_f32s_xpulpv2(M, N, stride, value, pDst)
+#define plp_mat_fill_stride_i16(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_i16s_xpulpv2(M, N, stride, value, pDst)
+#define plp_mat_fill_stride_i32(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_i32s_xpulpv2(M, N, stride, value, pDst)
+#define plp_mat_fill_stride_i8(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_i8s_xpulpv2(M, N, stride, value, pDst)
+#define plp_mat_fma_stride_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC) \
+    plp_mat_fma_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC)
+#define plp_mat_fma_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC) \
+    plp_mat_fma_stride_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC)
+#define plp_mat_fma_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC) \
+    plp_mat_fma_stride_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC)
+#define plp_mat_herk_f32(pSrcA, M, N, pDstC) plp_mat_herk_f32s_xpulpv2(pSrcA, M, N, pDstC)
+#define plp_mat_herk_i16(pSrcA, M, N, pDstC) plp_mat_herk_i16s_xpulpv2(pSrcA, M, N, pDstC)
+#define plp_mat_herk_q16(pSrcA, M, N, shift, pDstC) \
+    plp_mat_herk_q16s_xpulpv2(pSrcA, M, N, shift, pDstC)
+#define plp_mat_hermitian_f32(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_f32s_xpulpv2(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_i16(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_i16s_xpulpv2(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_i32(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_i32s_xpulpv2(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_q16(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_i16s_xpulpv2(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_stride_f32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_f32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_hermitian_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_i16s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_hermitian_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_i32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_hermitian_stride_q16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_i16s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_inv_f32(pSrc, N, pDst) plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst)
+#define plp_mat_inv_q16(pSrc, N, fracBits, pDst) plp_mat_inv_q16s_xpulpv2(pSrc, N, fracBits, pDst)
+#define plp_mat_inv_q32(pSrc, N, fracBits, pDst) plp_mat_inv_q32s_xpulpv2(pSrc, N, fracBits, pDst)
+#define plp_mat_inv_small_f32(pSrc, N, pDst, pDet) \
+    plp_mat_inv_small_f32s_xpulpv2(pSrc, N, pDst, pDet)
+#define plp_mat_kron_f32(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_f32s_xpulpv2(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_kron_i16(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_i16s_xpulpv2(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_kron_i32(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_i32s_xpulpv2(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_kron_i8(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_i8s_xpulpv2(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_lu_f32(pSrc, N, pLU, pPerm) plp_mat_lu_f32s_xpulpv2(pSrc, N, pLU, pPerm)
+#define plp_mat_lu_solve_f32(pLU, pPerm, pSrcB, N, O, pDstX) \
+    plp_mat_lu_solve_f32s_xpulpv2(pLU, pPerm, pSrcB, N, O, pDstX)
+#define plp_mat_mult_bin(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_bins_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_f32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_cmplx_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_cmplx_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_cmplx_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_cmplx_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_cmplx_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_cmplx_stride_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_cmplx_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_cmplx_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_cmplx_stride_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_cmplx_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_cmplx_stride_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_f16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_f16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_f32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i2(pSrcA, pSrcB, M, N, O, pDstC) \
+    PLP_CL_KERNEL(plp_mat_mult_i2s)(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i4(pSrcA, pSrcB, M, N, O, pDstC) \
+    PLP_CL_KERNEL(plp_mat_mult_i4s)(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i8xi16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_stride_i8xi16s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pDstC)
+#define plp_mat_mult_packed_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_packed_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_packed_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_packed_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_requant_i8(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC) \
+    plp_mat_mult_requant_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC)
+#define plp_mat_mult_requant_q16(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC) \
+    plp_mat_mult_requant_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC)
+#define plp_mat_mult_requant_q32(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC) \
+    plp_mat_mult_requant_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC)
+#define plp_mat_mult_stride_f16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_f16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i8xi16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i8xi16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_stride_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_stride_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_ter(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_ters_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_f32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_f32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_stride_f32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_stride_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_stride_q8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_norm_fro_stride_f32(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_fro_stride_f32s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_fro_stride_i16(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_fro_stride_i16s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_fro_stride_i8(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_fro_stride_i8s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_inf_stride_f32(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_inf_stride_f32s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_inf_stride_i16(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_inf_stride_i16s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_inf_stride_i8(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_inf_stride_i8s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_one_stride_f32(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_one_stride_f32s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_one_stride_i16(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_one_stride_i16s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_one_stride_i8(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_one_stride_i8s_xpulpv2(pSrc, M, N, stride, pRes)
+#define plp_mat_outer_f32(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_f32s_xpulpv2(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_outer_i16(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_i16s_xpulpv2(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_outer_i32(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_i32s_xpulpv2(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_outer_i8(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_i8s_xpulpv2(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_rank1_update_f32(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_f32s_xpulpv2(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_rank1_update_i16(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_i16s_xpulpv2(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_rank1_update_i32(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_i32s_xpulpv2(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_rank1_update_i8(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_i8s_xpulpv2(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_scale_f32(pSrc, M, N, scaleFactor, pDst) \
+    plp_mat_scale_f32s_xpulpv2(pSrc, M, N, scaleFactor, pDst)
+#define plp_mat_scale_i16(pSrc, M, N, scaleFactor, shift, pDst) \
+    plp_mat_scale_i16s_xpulpv2(pSrc, M, N, scaleFactor, shift, pDst)
+#define plp_mat_scale_i32(pSrc, M, N, scaleFactor, shift, pDst) \
+    plp_mat_scale_i32s_xpulpv2(pSrc, M, N, scaleFactor, shift, pDst)
+#define plp_mat_scale_i8(pSrc, M, N, scaleFactor, shift, pDst) \
+    plp_mat_scale_i8s_xpulpv2(pSrc, M, N, scaleFactor, shift, pDst)
+#define plp_mat_scale_inplace_f32(pSrcDst, M, N, scaleFactor) \
+    plp_mat_scale_inplace_f32s_xpulpv2(pSrcDst, M, N, scaleFactor)
+#define plp_mat_scale_inplace_i16(pSrcDst, M, N, scaleFactor, shift) \
+    plp_mat_scale_inplace_i16s_xpulpv2(pSrcDst, M, N, scaleFactor, shift)
+#define plp_mat_scale_inplace_i32(pSrcDst, M, N, scaleFactor, shift) \
+    plp_mat_scale_inplace_i32s_xpulpv2(pSrcDst, M, N, scaleFactor, shift)
+#define plp_mat_scale_inplace_i8(pSrcDst, M, N, scaleFactor, shift) \
+    plp_mat_scale_inplace_i8s_xpulpv2(pSrcDst, M, N, scaleFactor, shift)
+#define plp_mat_scale_stride_f32(pSrc, M, N, strideSrc, strideDst, scaleFactor, pDst) \
+    plp_mat_scale_stride_f32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, scaleFactor, pDst)
+#define plp_mat_scale_stride_i16(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst) \
+    plp_mat_scale_stride_i16s_xpulpv2(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst)
+#define plp_mat_scale_stride_i32(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst) \
+    plp_mat_scale_stride_i32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst)
+#define plp_mat_scale_stride_i8(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst) \
+    plp_mat_scale_stride_i8s_xpulpv2(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst)
+#define plp_mat_solve_tri_lower_f32(pSrcA, pSrcB, N, O, pDstC) \
+    plp_mat_solve_tri_lower_stride_f32s_xpulpv2(pSrcA, pSrcB, N, O, N, O, O, pDstC)
+#define plp_mat_solve_tri_lower_q32(pSrcA, pSrcB, N, O, fracBits, pDstC) \
+    plp_mat_solve_tri_lower_stride_q32s_xpulpv2(pSrcA, pSrcB, N, O, N, O, O, fracBits, pDstC)
+#define plp_mat_solve_tri_lower_stride_f32(pSrcA, pSrcB, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_solve_tri_lower_stride_f32s_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_solve_tri_lower_stride_q32(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC) \
+    plp_mat_solve_tri_lower_stride_q32s_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC)
+#define plp_mat_solve_tri_upper_f32(pSrcA, pSrcB, N, O, pDstC) \
+    plp_mat_solve_tri_upper_stride_f32s_xpulpv2(pSrcA, pSrcB, N, O, N, O, O, pDstC)
+#define plp_mat_solve_tri_upper_q32(pSrcA, pSrcB, N, O, fracBits, pDstC) \
+    plp_mat_solve_tri_upper_stride_q32s_xpulpv2(pSrcA, pSrcB, N, O, N, O, O, fracBits, pDstC)
+#define plp_mat_solve_tri_upper_stride_f32(pSrcA, pSrcB, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_solve_tri_upper_stride_f32s_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_solve_tri_upper_stride_q32(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC) \
+    plp_mat_solve_tri_upper_stride_q32s_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC)
+#define plp_mat_sub_f32(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_f32s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_i16(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_i16s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_i32(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_i32s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_i8(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_i8s_xpulpv2(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_inplace_f32(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_f32s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_inplace_i16(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_i16s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_inplace_i32(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_i32s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_inplace_i8(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_i8s_xpulpv2(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_stride_f32(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_sub_stride_i16(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_sub_stride_i32(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_sub_stride_i8(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_i8s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_syrk_f32(pSrcA, M, N, pDstC) plp_mat_syrk_f32s_xpulpv2(pSrcA, M, N, pDstC)
+#define plp_mat_syrk_i16(pSrcA, M, N, pDstC) plp_mat_syrk_i16s_xpulpv2(pSrcA, M, N, pDstC)
+#define plp_mat_syrk_q16(pSrcA, M, N, shift, pDstC) \
+    plp_mat_syrk_q16s_xpulpv2(pSrcA, M, N, shift, pDstC)
+#define plp_mat_trace_stride_f32(pSrc, N, stride, pRes) \
+    plp_mat_trace_stride_f32s_xpulpv2(pSrc, N, stride, pRes)
+#define plp_mat_trace_stride_i16(pSrc, N, stride, pRes) \
+    plp_mat_trace_stride_i16s_xpulpv2(pSrc, N, stride, pRes)
+#define plp_mat_trace_stride_i8(pSrc, N, stride, pRes) \
+    plp_mat_trace_stride_i8s_xpulpv2(pSrc, N, stride, pRes)
+#define plp_mat_trans_cmplx_f32(pSrc, M, N, pDst) \
+    plp_mat_trans_cmplx_stride_i32s_xpulpv2((const int32_t *)(pSrc), M, N, N, M, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_i16(pSrc, M, N, pDst) \
+    plp_mat_trans_stride_i32s_xpulpv2((const int32_t *)(pSrc), M, N, N, M, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_i32(pSrc, M, N, pDst) \
+    plp_mat_trans_cmplx_stride_i32s_xpulpv2(pSrc, M, N, N, M, pDst)
+#define plp_mat_trans_cmplx_q16(pSrc, M, N, pDst) \
+    plp_mat_trans_stride_i32s_xpulpv2((const int32_t *)(pSrc), M, N, N, M, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_stride_f32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_cmplx_stride_i32s_xpulpv2((const int32_t *)(pSrc), M, N, strideSrc, strideDst, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_xpulpv2((const int32_t *)(pSrc), M, N, strideSrc, strideDst, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_cmplx_stride_i32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_cmplx_stride_q16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_xpulpv2((const int32_t *)(pSrc), M, N, strideSrc, strideDst, (int32_t *)(pDst))
+#define plp_mat_trans_f32(pSrc, M, N, pDst) \
+    plp_mat_trans_i32s_xpulpv2((int32_t *)(pSrc), M, N, (int32_t *)(pDst))
+#define plp_mat_trans_i16(pSrc, M, N, pDst) plp_mat_trans_i16s_xpulpv2(pSrc, M, N, pDst)
+#define plp_mat_trans_i32(pSrc, M, N, pDst) plp_mat_trans_i32s_xpulpv2(pSrc, M, N, pDst)
+#define plp_mat_trans_i8(pSrc, M, N, pDst) plp_mat_trans_i8s_xpulpv2(pSrc, M, N, pDst)
+#define plp_mat_trans_stride_f32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_xpulpv2((int32_t *)(pSrc), M, N, strideSrc, strideDst, (int32_t *)(pDst))
+#define plp_mat_trans_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i16s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_stride_i8(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i8s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_vec_mult_f32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_f32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_i16(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_i16s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_i32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_i32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_i8(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_i8s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_q16(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_trans_vec_mult_q16s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_trans_vec_mult_q32(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_trans_vec_mult_q32s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_trans_vec_mult_q8(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_trans_vec_mult_q8s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_cmplx_f32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_cmplx_f32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_cmplx_q16(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_cmplx_q16s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_compressed_i8(pSrcA, pCodebook, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_compressed_i8s_xpulpv2(pSrcA, pCodebook, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_f32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_f32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i16(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i16s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i8(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i8s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i8xi16(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i8xi16s_xpulpv2(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_q16(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_q16s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_q32(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_q32s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_q8(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_q8s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_max_f32(pSrc, blockSize, pRes) plp_max_f32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_max_i16(pSrc, blockSize, pRes) plp_max_i16s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_max_i32(pSrc, blockSize, pRes) plp_max_i32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_max_i8(pSrc, blockSize, pRes) plp_max_i8s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_max_idx_f32(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_f32s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_max_idx_i16(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_i16s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_max_idx_i32(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_i32s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_max_idx_i8(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_i8s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_maxpool_i8(pSrc, H, W, C, kH, kW, stride, pDst) \
+    plp_maxpool_i8s_xpulpv2(pSrc, H, W, C, kH, kW, stride, pDst)
+#define plp_mean_f32(pSrc, blockSize, pRes) plp_mean_f32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_mean_i16(pSrc, blockSize, pRes) plp_mean_i16s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_mean_i32(pSrc, blockSize, pRes) plp_mean_i32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_mean_i8(pSrc, blockSize, pRes) plp_mean_i8s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_min_f32(pSrc, blockSize, pRes) plp_min_f32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_min_i16(pSrc, blockSize, pRes) plp_min_i16s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_min_i32(pSrc, blockSize, pRes) plp_min_i32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_min_i8(pSrc, blockSize, pRes) plp_min_i8s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_min_idx_f32(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_f32s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_min_idx_i16(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_i16s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_min_idx_i32(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_i32s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_min_idx_i8(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_i8s_xpulpv2(pSrc, blockSize, pRes, pIndex)
+#define plp_moving_avg_f32(S, pSrc, pDst, blockSize) \
+    plp_moving_avg_f32s_xpulpv2(S, pSrc, pDst, blockSize)
+#define plp_moving_avg_i16(S, pSrc, pDst, blockSize) \
+    plp_moving_avg_i16s_xpulpv2(S, pSrc, pDst, blockSize)
+#define plp_mult_f32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_f32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_i16(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_i16s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_i32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_i32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_i8(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_i8s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_q16(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_mult_q16s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_mult_q32(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_mult_q32s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_mult_q8(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_mult_q8s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_ncc_f32(pSrc, srcLen, pTmpl, tmplLen, pRes) \
+    plp_ncc_f32s_xpulpv2(pSrc, srcLen, pTmpl, tmplLen, pRes)
+#define plp_ncc_i16(pSrc, srcLen, pTmpl, tmplLen, pRes) \
+    plp_ncc_i16s_xpulpv2(pSrc, srcLen, pTmpl, tmplLen, pRes)
+#define plp_nco_mix_q16(S, pSrc, blockSize, pDstI, pDstQ) \
+    plp_nco_mix_q16s_xpulpv2(S, pSrc, blockSize, pDstI, pDstQ)
+#define plp_negate_f32(pSrc, pDst, blockSize) plp_negate_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_negate_i16(pSrc, pDst, blockSize) plp_negate_i16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_negate_i32(pSrc, pDst, blockSize) plp_negate_i32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_negate_i8(pSrc, pDst, blockSize) plp_negate_i8s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_normalize_l2_f32(pSrc, blockSize, pDst) \
+    plp_normalize_l2_f32s_xpulpv2(pSrc, blockSize, pDst)
+#define plp_normalize_l2_q16(pSrc, blockSize, pDst) \
+    plp_normalize_l2_q16s_xpulpv2(pSrc, blockSize, pDst)
+#define plp_offset_f32(pSrc, offset, pDst, blockSize) \
+    plp_offset_f32s_xpulpv2(pSrc, offset, pDst, blockSize)
+#define plp_offset_i16(pSrc, offset, pDst, blockSize) \
+    plp_offset_i16s_xpulpv2(pSrc, offset, pDst, blockSize)
+#define plp_offset_i32(pSrc, offset, pDst, blockSize) \
+    plp_offset_i32s_xpulpv2(pSrc, offset, pDst, blockSize)
+#define plp_offset_i8(pSrc, offset, pDst, blockSize) \
+    plp_offset_i8s_xpulpv2(pSrc, offset, pDst, blockSize)
+#define plp_park_clarke_inv_q32_vec(pId, pIq, pTheta, pIa, pIb, numAxes) \
+    plp_park_clarke_inv_vec_q32s_xpulpv2(pId, pIq, pTheta, pIa, pIb, numAxes)
+#define plp_pid_q32_vec(S, pIn, pOut, numAxes) plp_pid_vec_q32s_xpulpv2(S, pIn, pOut, numAxes)
+#define plp_pow2_f32_vec(pSrc, pDst, blockSize) plp_pow2_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_pow2_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_pow2_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_power64_i32(pSrc, blockSize, pRes) plp_power64_i32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_power64_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_power64_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_power_i16(pSrc, blockSize, pRes) plp_power_i16s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_power_i32(pSrc, blockSize, pRes) plp_power_i32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_power_i8(pSrc, blockSize, pRes) plp_power_i8s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_power_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_power_q16s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_power_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_power_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_power_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_power_q8s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_q16_to_f32(pSrc, deciPoint, pDst, blockSize) \
+    plp_q16_to_f32s_xpulpv2(pSrc, deciPoint, pDst, blockSize)
+#define plp_q32_to_f32(pSrc, deciPoint, pDst, blockSize) \
+    plp_q32_to_f32s_xpulpv2(pSrc, deciPoint, pDst, blockSize)
+#define plp_q8_to_f32(pSrc, deciPoint, pDst, blockSize) \
+    plp_q8_to_f32s_xpulpv2(pSrc, deciPoint, pDst, blockSize)
+#define plp_quantize_f32_i8(pSrc, blockSize, pDst, pScale, pZeroPoint) \
+    plp_quantize_f32_i8s_xpulpv2(pSrc, blockSize, pDst, pScale, pZeroPoint)
+#define plp_recip_q16(pSrc, fracBits, pDst, blockSize) \
+    plp_recip_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_recip_q32(pSrc, fracBits, pDst, blockSize) \
+    plp_recip_q32s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_requantize_i32_i8(pSrc, nPixels, nChannels, pMult, pShift, pDst) \
+    plp_requantize_i32_i8s_xpulpv2(pSrc, nPixels, nChannels, pMult, pShift, pDst)
+#define plp_resample_f32(S, pSrc, blockSize, pDst) \
+    plp_resample_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_resample_q16(S, pSrc, blockSize, pDst) \
+    plp_resample_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_rfft_q16(S, pSrc, pDst) plp_rfft_q16s_xpulpv2(S, pSrc, pDst)
+#define plp_rfft_q32(S, pSrc, pDst) plp_rfft_q32s_xpulpv2(S, pSrc, pDst)
+#define plp_ringbuf_read_f32(S, blockSize, pDst) plp_ringbuf_read_f32s_xpulpv2(S, blockSize, pDst)
+#define plp_ringbuf_read_i16(S, blockSize, pDst) plp_ringbuf_read_i16s_xpulpv2(S, blockSize, pDst)
+#define plp_ringbuf_read_i32(S, blockSize, pDst) plp_ringbuf_read_i32s_xpulpv2(S, blockSize, pDst)
+#define plp_ringbuf_write_f32(S, pSrc, blockSize) plp_ringbuf_write_f32s_xpulpv2(S, pSrc, blockSize)
+#define plp_ringbuf_write_i16(S, pSrc, blockSize) plp_ringbuf_write_i16s_xpulpv2(S, pSrc, blockSize)
+#define plp_ringbuf_write_i32(S, pSrc, blockSize) plp_ringbuf_write_i32s_xpulpv2(S, pSrc, blockSize)
+#define plp_rms_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_rms_q16s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_rms_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_rms_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_rms_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_rms_q8s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_rsqrt_f32(pSrc, pDst, blockSize) plp_rsqrt_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_rsqrt_q16(pSrc, fracBits, pDst, blockSize) \
+    plp_rsqrt_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_scale_f32(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_f32s_xpulpv2(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_i16(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_i16s_xpulpv2(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_i32(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_i32s_xpulpv2(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_i8(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_i8s_xpulpv2(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_q16(pSrc, scaleFactor, deciPoint, pDst, blockSize) \
+    plp_scale_q16s_xpulpv2(pSrc, scaleFactor, deciPoint, pDst, blockSize)
+#define plp_scale_q32(pSrc, scaleFactor, deciPoint, pDst, blockSize) \
+    plp_scale_q32s_xpulpv2(pSrc, scaleFactor, deciPoint, pDst, blockSize)
+#define plp_scale_q8(pSrc, scaleFactor, deciPoint, pDst, blockSize) \
+    plp_scale_q8s_xpulpv2(pSrc, scaleFactor, deciPoint, pDst, blockSize)
+#define plp_sdft_f32(S, pSrc, blockSize, pDst) plp_sdft_f32s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_sdft_q16(S, pSrc, blockSize, pDst) plp_sdft_q16s_xpulpv2(S, pSrc, blockSize, pDst)
+#define plp_shift_i16(pSrc, shiftBits, pDst, blockSize) \
+    plp_shift_i16s_xpulpv2(pSrc, shiftBits, pDst, blockSize)
+#define plp_shift_i32(pSrc, shiftBits, pDst, blockSize) \
+    plp_shift_i32s_xpulpv2(pSrc, shiftBits, pDst, blockSize)
+#define plp_shift_i8(pSrc, shiftBits, pDst, blockSize) \
+    plp_shift_i8s_xpulpv2(pSrc, shiftBits, pDst, blockSize)
+#define plp_sigmoid_f32(x) plp_sigmoid_f32s_xpulpv2(x)
+#define plp_sigmoid_f32_vec(pSrc, pDst, blockSize) \
+    plp_sigmoid_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_sigmoid_q16(x, fracBits) plp_sigmoid_q16s_xpulpv2(x, fracBits)
+#define plp_sigmoid_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_sigmoid_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_sigmoid_q32(x, fracBits) plp_sigmoid_q32s_xpulpv2(x, fracBits)
+#define plp_sigmoid_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_sigmoid_vec_q32s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_sin_f32(x) plp_sin_f32s_xpulpv2(x)
+#define plp_sin_f32_vec(pSrc, pDst, blockSize) plp_sin_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_sin_q16(x) plp_sin_q16s_xpulpv2(x)
+#define plp_sin_q16_fast(x) plp_sin_fast_q16s_xpulpv2(x)
+#define plp_sin_q16_precise(x) plp_sin_precise_q16s_xpulpv2(x)
+#define plp_sin_q16_vec(pSrc, pDst, blockSize) plp_sin_vec_q16s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_sin_q32(x) plp_sin_q32s_xpulpv2(x)
+#define plp_sin_q32_fast(x) plp_sin_fast_q32s_xpulpv2(x)
+#define plp_sin_q32_precise(x) plp_sin_precise_q32s_xpulpv2(x)
+#define plp_sin_q32_vec(pSrc, pDst, blockSize) plp_sin_vec_q32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_sincos_f32(pSrc, pSin, pCos, blockSize) \
+    plp_sincos_f32s_xpulpv2(pSrc, pSin, pCos, blockSize)
+#define plp_sincos_q16(pSrc, pSin, pCos, blockSize) \
+    plp_sincos_q16s_xpulpv2(pSrc, pSin, pCos, blockSize)
+#define plp_sincos_q32(pSrc, pSin, pCos, blockSize) \
+    plp_sincos_q32s_xpulpv2(pSrc, pSin, pCos, blockSize)
+#define plp_sliding_stats_update_q16(S, pNew, pOld, hopSize) \
+    plp_sliding_stats_update_q16s_xpulpv2(S, pNew, pOld, hopSize)
+#define plp_softmax_f32(pSrc, nRows, rowLen, pDst) \
+    plp_softmax_f32s_xpulpv2(pSrc, nRows, rowLen, pDst)
+#define plp_softmax_q16(pSrc, nRows, rowLen, fracBits, pDst) \
+    plp_softmax_q16s_xpulpv2(pSrc, nRows, rowLen, fracBits, pDst)
+#define plp_sort_f32(pSrcDst, blockSize) plp_sort_f32s_xpulpv2(pSrcDst, blockSize)
+#define plp_sort_i16(pSrcDst, blockSize) plp_sort_i16s_xpulpv2(pSrcDst, blockSize)
+#define plp_sort_i32(pSrcDst, blockSize) plp_sort_i32s_xpulpv2(pSrcDst, blockSize)
+#define plp_spmv_f32(pSrcA, pSrcX, pDstY) plp_spmv_f32s_xpulpv2(pSrcA, pSrcX, pDstY)
+#define plp_spmv_i16(pSrcA, pSrcX, pDstY) plp_spmv_i16s_xpulpv2(pSrcA, pSrcX, pDstY)
+#define plp_spmv_i8(pSrcA, pSrcX, pDstY) plp_spmv_i8s_xpulpv2(pSrcA, pSrcX, pDstY)
+#define plp_sqrt_f32_vec(pSrc, pDst, blockSize) plp_sqrt_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_sqrt_q16(pSrc, fracBits, pRes) plp_sqrt_q16s_xpulpv2(pSrc, fracBits, pRes)
+#define plp_sqrt_q32(pSrc, fracBits, pRes) plp_sqrt_q32s_xpulpv2(pSrc, fracBits, pRes)
+#define plp_stats_summary_f32(pSrc, blockSize, pRes) \
+    plp_stats_summary_f32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_stats_summary_i16(pSrc, blockSize, pRes) \
+    plp_stats_summary_i16s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_stats_summary_i32(pSrc, blockSize, pRes) \
+    plp_stats_summary_i32s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_stats_summary_i8(pSrc, blockSize, pRes) \
+    plp_stats_summary_i8s_xpulpv2(pSrc, blockSize, pRes)
+#define plp_std_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_std_q16s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_std_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_std_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_std_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_std_q8s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_sub_f32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_sub_f32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_i16(pSrcA, pSrcB, pDst, blockSize) \
+    plp_sub_i16s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_i32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_sub_i32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_i8(pSrcA, pSrcB, pDst, blockSize) plp_sub_i8s_xpulpv2(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_q16(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_sub_q16s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_sub_q32(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_sub_q32s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_sub_q8(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_sub_q8s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_tanh_f32(x) plp_tanh_f32s_xpulpv2(x)
+#define plp_tanh_f32_vec(pSrc, pDst, blockSize) plp_tanh_vec_f32s_xpulpv2(pSrc, pDst, blockSize)
+#define plp_tanh_q16(x, fracBits) plp_tanh_q16s_xpulpv2(x, fracBits)
+#define plp_tanh_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_tanh_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_tanh_q32(x, fracBits) plp_tanh_q32s_xpulpv2(x, fracBits)
+#define plp_tanh_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_tanh_vec_q32s_xpulpv2(pSrc, fracBits, pDst, blockSize)
+#define plp_topk_f32(pSrc, blockSize, k, largest, pDstVal, pDstIdx) \
+    plp_topk_f32s_xpulpv2(pSrc, blockSize, k, largest, pDstVal, pDstIdx)
+#define plp_topk_i16(pSrc, blockSize, k, largest, pDstVal, pDstIdx) \
+    plp_topk_i16s_xpulpv2(pSrc, blockSize, k, largest, pDstVal, pDstIdx)
+#define plp_topk_i32(pSrc, blockSize, k, largest, pDstVal, pDstIdx) \
+    plp_topk_i32s_xpulpv2(pSrc, blockSize, k, largest, pDstVal, pDstIdx)
+#define plp_var64_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_var64_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_var_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_var_q16s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_var_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_var_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_var_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_var_q8s_xpulpv2(pSrc, blockSize, fracBits, pRes)
+#define plp_vq_nearest_f32(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist) \
+    plp_vq_nearest_f32s_xpulpv2(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist)
+#define plp_vq_nearest_i16(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist) \
+    plp_vq_nearest_i16s_xpulpv2(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist)
+#define plp_vq_nearest_i8(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist) \
+    plp_vq_nearest_i8s_xpulpv2(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist)
+#define plp_window_apply_f32(S, pSrc, pDst) plp_window_apply_f32s_xpulpv2(S, pSrc, pDst)
+#define plp_window_apply_q16(S, pSrc, pDst) plp_window_apply_q16s_xpulpv2(S, pSrc, pDst)
+#define plp_zoom_fft_f32(S, pSrc, pDst, pScratch) plp_zoom_fft_f32s_xpulpv2(S, pSrc, pDst, pScratch)
+
+#endif // PLP_TARGET_CLUSTER_ONLY
+
+#if defined(PLP_TARGET_FC_ONLY)
+
+#define plp_abs_i16(pSrc, pDst, blockSize) plp_abs_i16s_rv32im(pSrc, pDst, blockSize)
+#define plp_abs_i32(pSrc, pDst, blockSize) plp_abs_i32s_rv32im(pSrc, pDst, blockSize)
+#define plp_abs_i8(pSrc, pDst, blockSize) plp_abs_i8s_rv32im(pSrc, pDst, blockSize)
+#define plp_add_i16(pSrcA, pSrcB, pDst, blockSize) \
+    plp_add_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_i32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_add_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_i8(pSrcA, pSrcB, pDst, blockSize) plp_add_i8s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_add_q16(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_add_q16s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_add_q32(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_add_q32s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_add_q8(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_add_q8s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_atan2_q16(y, x) plp_atan2_q16s_rv32im(y, x)
+#define plp_atan2_q32(y, x) plp_atan2_q32s_rv32im(y, x)
+#define plp_autocorr_q16(pSrc, blockSize, numLags, fracBits, pRes) \
+    plp_autocorr_q16s_rv32im(pSrc, blockSize, numLags, fracBits, pRes)
+#define plp_autocorr_q32(pSrc, blockSize, numLags, fracBits, pRes) \
+    plp_autocorr_q32s_rv32im(pSrc, blockSize, numLags, fracBits, pRes)
+#define plp_avgpool_i8(pSrc, H, W, C, kH, kW, stride, pDst) \
+    plp_avgpool_i8s_rv32im(pSrc, H, W, C, kH, kW, stride, pDst)
+#define plp_biquad_cascade_df1_q16(S, pSrc, blockSize, pDst) \
+    plp_biquad_cascade_df1_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_biquad_cascade_df1_q32(S, pSrc, blockSize, pDst) \
+    plp_biquad_cascade_df1_q32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_cfft_bfp_q16(S, p1, ifftFlag, bitReverseFlag) \
+    plp_cfft_bfp_q16s_rv32im(S, p1, ifftFlag, bitReverseFlag)
+#define plp_cfft_mr_q16(S, p1, pScratch, ifftFlag) \
+    plp_cfft_mr_q16s_rv32im(S, p1, pScratch, ifftFlag)
+#define plp_cfft_q32(S, p1, ifftFlag, bitReverseFlag) \
+    plp_cfft_q32s_rv32im(S, p1, ifftFlag, bitReverseFlag)
+#define plp_cic_decimate_i32(S, pSrc, blockSize, pDst) \
+    plp_cic_decimate_i32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_cic_decimate_q32(S, pSrc, blockSize, pDst) \
+    plp_cic_decimate_q32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_cic_interpolate_i32(S, pSrc, blockSize, pDst) \
+    plp_cic_interpolate_i32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_cic_interpolate_q32(S, pSrc, blockSize, pDst) \
+    plp_cic_interpolate_q32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_clarke_park_q32_vec(pIa, pIb, pTheta, pId, pIq, numAxes) \
+    plp_clarke_park_vec_q32s_rv32im(pIa, pIb, pTheta, pId, pIq, numAxes)
+#define plp_clip_i16(pSrc, low, high, pDst, blockSize) \
+    plp_clip_i16s_rv32im(pSrc, low, high, pDst, blockSize)
+#define plp_clip_i32(pSrc, low, high, pDst, blockSize) \
+    plp_clip_i32s_rv32im(pSrc, low, high, pDst, blockSize)
+#define plp_clip_i8(pSrc, low, high, pDst, blockSize) \
+    plp_clip_i8s_rv32im(pSrc, low, high, pDst, blockSize)
+#define plp_cmplx_arg_q16(pSrc, pDst, numSamples) plp_cmplx_arg_q16_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_arg_q32(pSrc, pDst, numSamples) plp_cmplx_arg_q32_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_i16(pSrc, pDst, numSamples) plp_cmplx_conj_i16_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_i32(pSrc, pDst, numSamples) plp_cmplx_conj_i32_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_conj_i8(pSrc, pDst, numSamples) plp_cmplx_conj_i8_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_dot_prod_i16(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_i16_rv32im(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_i32(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_i32_rv32im(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_i8(pSrcA, pSrcB, numSamples, realResult, imagResult) \
+    plp_cmplx_dot_prod_i8_rv32im(pSrcA, pSrcB, numSamples, realResult, imagResult)
+#define plp_cmplx_dot_prod_planar_q16(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples, deciPoint, realResult, imagResult) \
+    plp_cmplx_dot_prod_planar_q16_rv32im(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples, deciPoint, realResult, imagResult)
+#define plp_cmplx_dot_prod_q16(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult) \
+    plp_cmplx_dot_prod_q16_rv32im(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult)
+#define plp_cmplx_dot_prod_q32(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult) \
+    plp_cmplx_dot_prod_q32_rv32im(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult)
+#define plp_cmplx_mac_batched_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels) \
+    plp_cmplx_mac_batched_q16_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels)
+#define plp_cmplx_mac_batched_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels) \
+    plp_cmplx_mac_batched_q32_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples, numChannels)
+#define plp_cmplx_mac_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mac_q16_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mac_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mac_q32_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_approx_q16(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_approx_q16_rv32im(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_approx_q32(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_approx_q32_rv32im(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_i16(pSrc, pRes, numSamples) plp_cmplx_mag_i16_rv32im(pSrc, pRes, numSamples)
+#define plp_cmplx_mag_i32(pSrc, pRes, numSamples) plp_cmplx_mag_i32_rv32im(pSrc, pRes, numSamples)
+#define plp_cmplx_mag_q16(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_q16_rv32im(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_q32(pSrc, deciPoint, pRes, numSamples) \
+    plp_cmplx_mag_q32_rv32im(pSrc, deciPoint, pRes, numSamples)
+#define plp_cmplx_mag_squared_i16(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_i16_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_i32(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_i32_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_i8(pSrc, pDst, numSamples) \
+    plp_cmplx_mag_squared_i8_rv32im(pSrc, pDst, numSamples)
+#define plp_cmplx_mag_squared_planar_q16(pSrcRe, pSrcIm, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_planar_q16_rv32im(pSrcRe, pSrcIm, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_squared_q16(pSrc, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_q16_rv32im(pSrc, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_squared_q32(pSrc, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_q32_rv32im(pSrc, pDst, deciPoint, numSamples)
+#define plp_cmplx_mag_squared_q8(pSrc, pDst, deciPoint, numSamples) \
+    plp_cmplx_mag_squared_q8_rv32im(pSrc, pDst, deciPoint, numSamples)
+#define plp_cmplx_merge_i16(pRe, pIm, pDst, numSamples) \
+    plp_cmplx_merge_i16s_rv32im(pRe, pIm, pDst, numSamples)
+#define plp_cmplx_merge_i32(pRe, pIm, pDst, numSamples) \
+    plp_cmplx_merge_i32s_rv32im(pRe, pIm, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_i16(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_i16_rv32im(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_i32(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_i32_rv32im(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_i8(pSrcA, pSrcB, pDst, numSamples) \
+    plp_cmplx_mult_cmplx_i8_rv32im(pSrcA, pSrcB, pDst, numSamples)
+#define plp_cmplx_mult_cmplx_planar_q16(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_planar_q16_rv32im(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm, deciPoint, numSamples)
+#define plp_cmplx_mult_cmplx_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_q16_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_cmplx_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_q32_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_cmplx_q8(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_cmplx_q8_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_conj_q16(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_conj_q16_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_conj_q32(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_conj_q32_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_conj_q8(pSrcA, pSrcB, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_conj_q8_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_real_i16(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_i16_rv32im(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_i32(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_i32_rv32im(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_i8(pSrcCmplx, pSrcReal, pDst, numSamples) \
+    plp_cmplx_mult_real_i8_rv32im(pSrcCmplx, pSrcReal, pDst, numSamples)
+#define plp_cmplx_mult_real_q16(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_real_q16_rv32im(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_real_q32(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_real_q32_rv32im(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples)
+#define plp_cmplx_mult_real_q8(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples) \
+    plp_cmplx_mult_real_q8_rv32im(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples)
+#define plp_cmplx_split_i16(pSrc, pRe, pIm, numSamples) \
+    plp_cmplx_split_i16s_rv32im(pSrc, pRe, pIm, numSamples)
+#define plp_cmplx_split_i32(pSrc, pRe, pIm, numSamples) \
+    plp_cmplx_split_i32s_rv32im(pSrc, pRe, pIm, numSamples)
+#define plp_conv1d_i2(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    plp_conv1d_i2s_rv32im(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv1d_i4(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    plp_conv1d_i4s_rv32im(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv1d_i8(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst) \
+    plp_conv1d_i8s_rv32im(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst)
+#define plp_conv2d_i16(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst) \
+    plp_conv2d_i16s_rv32im(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst)
+#define plp_conv2d_i8(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst) \
+    plp_conv2d_i8s_rv32im(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst)
+#define plp_conv_depthwise_i8(pSrc, H, W, C, pKernel, kH, kW, stride, pad, pDst) \
+    plp_conv_depthwise_i8s_rv32im(pSrc, H, W, C, pKernel, kH, kW, stride, pad, pDst)
+#define plp_conv_valid_winograd_i16(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst) \
+    plp_conv_valid_winograd_i16s_rv32im(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst)
+#define plp_correlate_i16(pSrcA, srcALen, pSrcB, srcBLen, pRes) \
+    plp_correlate_i16s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes)
+#define plp_correlate_i32(pSrcA, srcALen, pSrcB, srcBLen, pRes) \
+    plp_correlate_i32s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes)
+#define plp_correlate_i8(pSrcA, srcALen, pSrcB, srcBLen, pRes) \
+    plp_correlate_i8s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes)
+#define plp_cos_q16(x) plp_cos_q16s_rv32im(x)
+#define plp_cos_q16_vec(pSrc, pDst, blockSize) plp_cos_vec_q16s_rv32im(pSrc, pDst, blockSize)
+#define plp_cos_q32(x) plp_cos_q32s_rv32im(x)
+#define plp_cos_q32_vec(pSrc, pDst, blockSize) plp_cos_vec_q32s_rv32im(pSrc, pDst, blockSize)
+#define plp_cumsum_i16(pSrc, pDst, blockSize) plp_cumsum_i16s_rv32im(pSrc, pDst, blockSize)
+#define plp_cumsum_i32(pSrc, pDst, blockSize) plp_cumsum_i32s_rv32im(pSrc, pDst, blockSize)
+#define plp_db_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_db_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_dct4_q16(S, pSrc, pScratch, pDst) plp_dct4_q16s_rv32im(S, pSrc, pScratch, pDst)
+#define plp_deinterleave_i16(pSrc, numChannels, numSamples, pDst) \
+    plp_deinterleave_i16s_rv32im(pSrc, numChannels, numSamples, pDst)
+#define plp_deinterleave_i32(pSrc, numChannels, numSamples, pDst) \
+    plp_deinterleave_i32s_rv32im(pSrc, numChannels, numSamples, pDst)
+#define plp_div_q16(pSrcA, pSrcB, fracBits, pDst, blockSize) \
+    plp_div_q16s_rv32im(pSrcA, pSrcB, fracBits, pDst, blockSize)
+#define plp_div_q32(pSrcA, pSrcB, fracBits, pDst, blockSize) \
+    plp_div_q32s_rv32im(pSrcA, pSrcB, fracBits, pDst, blockSize)
+#define plp_dot_prod_bin(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_bins_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i16(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i16s_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i2(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i2s_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i32(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i32s_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i4(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i4s_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i8(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i8s_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_i8xi16(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_i8xi16s_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_dot_prod_q16(pSrcA, pSrcB, blockSize, deciPoint, pRes) \
+    plp_dot_prod_q16s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes)
+#define plp_dot_prod_q32(pSrcA, pSrcB, blockSize, deciPoint, pRes) \
+    plp_dot_prod_q32s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes)
+#define plp_dot_prod_q8(pSrcA, pSrcB, blockSize, deciPoint, pRes) \
+    plp_dot_prod_q8s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes)
+#define plp_dot_prod_ter(pSrcA, pSrcB, blockSize, pRes) \
+    plp_dot_prod_ters_rv32im(pSrcA, pSrcB, blockSize, pRes)
+#define plp_exp_q16(x, fracBits) plp_exp_q16s_rv32im(x, fracBits)
+#define plp_exp_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_exp_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_exp_q32(x, fracBits) plp_exp_q32s_rv32im(x, fracBits)
+#define plp_exp_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_exp_vec_q32s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_fir_decimate_q16(S, pSrc, blockSize, pDst) \
+    plp_fir_decimate_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_fir_decimate_q32(S, pSrc, blockSize, pDst) \
+    plp_fir_decimate_q32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_fir_interpolate_q16(S, pSrc, blockSize, pDst) \
+    plp_fir_interpolate_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_fir_interpolate_q32(S, pSrc, blockSize, pDst) \
+    plp_fir_interpolate_q32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_fir_q16(S, pSrc, blockSize, pDst) plp_fir_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_fir_q32(S, pSrc, blockSize, pDst) plp_fir_q32s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_fir_q8(S, pSrc, blockSize, pDst) plp_fir_q8s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_goertzel_q16(S, pSrc, blockSize, pDst) \
+    plp_goertzel_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_gru_cell_i8(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH) \
+    plp_gru_cell_i8s_rv32im(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH)
+#define plp_gru_cell_q16(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH) \
+    plp_gru_cell_q16s_rv32im(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH)
+#define plp_hilbert_fir_q16(S, pSrc, blockSize, pDst) \
+    plp_hilbert_fir_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_histogram_i16(pSrc, blockSize, minValue, binShift, nBins, pHist) \
+    plp_histogram_i16s_rv32im(pSrc, blockSize, minValue, binShift, nBins, pHist)
+#define plp_histogram_i8(pSrc, blockSize, minValue, binShift, nBins, pHist) \
+    plp_histogram_i8s_rv32im(pSrc, blockSize, minValue, binShift, nBins, pHist)
+#define plp_i16_to_i32(pSrc, shift, pDst, blockSize) \
+    plp_i16_to_i32s_rv32im(pSrc, shift, pDst, blockSize)
+#define plp_i16_to_i8(pSrc, shift, pDst, blockSize) \
+    plp_i16_to_i8s_rv32im(pSrc, shift, pDst, blockSize)
+#define plp_i32_to_i16(pSrc, shift, pDst, blockSize) \
+    plp_i32_to_i16s_rv32im(pSrc, shift, pDst, blockSize)
+#define plp_i32_to_i8(pSrc, shift, pDst, blockSize) \
+    plp_i32_to_i8s_rv32im(pSrc, shift, pDst, blockSize)
+#define plp_i8_to_i16(pSrc, shift, pDst, blockSize) \
+    plp_i8_to_i16s_rv32im(pSrc, shift, pDst, blockSize)
+#define plp_i8_to_i32(pSrc, shift, pDst, blockSize) \
+    plp_i8_to_i32s_rv32im(pSrc, shift, pDst, blockSize)
+#define plp_im2col_i8(pSrc, H, W, C, kH, kW, stride, pad, pDst) \
+    plp_im2col_i8s_rv32im(pSrc, H, W, C, kH, kW, stride, pad, pDst)
+#define plp_integral_image_i16(pSrc, M, N, pDst) plp_integral_image_i16s_rv32im(pSrc, M, N, pDst)
+#define plp_integral_image_i32(pSrc, M, N, pDst) plp_integral_image_i32s_rv32im(pSrc, M, N, pDst)
+#define plp_interleave_i16(pSrc, numChannels, numSamples, pDst) \
+    plp_interleave_i16s_rv32im(pSrc, numChannels, numSamples, pDst)
+#define plp_interleave_i32(pSrc, numChannels, numSamples, pDst) \
+    plp_interleave_i32s_rv32im(pSrc, numChannels, numSamples, pDst)
+#define plp_layernorm_q16(pSrc, nRows, rowLen, pGamma, pBeta, eps, fracBits, pDst) \
+    plp_layernorm_q16s_rv32im(pSrc, nRows, rowLen, pGamma, pBeta, eps, fracBits, pDst)
+#define plp_levinson_durbin_q32(pPhi, order, fracBits, pA, pRefl, pErr) \
+    plp_levinson_durbin_q32s_rv32im(pPhi, order, fracBits, pA, pRefl, pErr)
+#define plp_lms_norm_q16(S, pSrc, pRef, pOut, pErr, blockSize) \
+    plp_lms_norm_q16s_rv32im(S, pSrc, pRef, pOut, pErr, blockSize)
+#define plp_lms_q16(S, pSrc, pRef, pOut, pErr, blockSize) \
+    plp_lms_q16s_rv32im(S, pSrc, pRef, pOut, pErr, blockSize)
+#define plp_log2_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_log2_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_log_q16(x, fracBits) plp_log_q16s_rv32im(x, fracBits)
+#define plp_log_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_log_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_log_q32(x, fracBits) plp_log_q32s_rv32im(x, fracBits)
+#define plp_log_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_log_vec_q32s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_lstm_cell_i8(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC) \
+    plp_lstm_cell_i8s_rv32im(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC)
+#define plp_lstm_cell_q16(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC) \
+    plp_lstm_cell_q16s_rv32im(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits, pDstH, pDstC)
+#define plp_lut_interp_q16(S, x) plp_lut_interp_q16s_rv32im(S, x)
+#define plp_lut_interp_q16_vec(S, pSrc, pDst, blockSize) \
+    plp_lut_interp_vec_q16s_rv32im(S, pSrc, pDst, blockSize)
+#define plp_lut_interp_q32(S, x) plp_lut_interp_q32s_rv32im(S, x)
+#define plp_lut_interp_q32_vec(S, pSrc, pDst, blockSize) \
+    plp_lut_interp_vec_q32s_rv32im(S, pSrc, pDst, blockSize)
+#define plp_mat_add_i16(pSrcA, pSrcB, M, N, pDst) plp_mat_add_i16s_rv32im(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_i32(pSrcA, pSrcB, M, N, pDst) plp_mat_add_i32s_rv32im(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_i8(pSrcA, pSrcB, M, N, pDst) plp_mat_add_i8s_rv32im(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_add_inplace_i16(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_i16s_rv32im(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_inplace_i32(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_i32s_rv32im(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_inplace_i8(pSrcDstA, pSrcB, M, N) \
+    plp_mat_add_inplace_i8s_rv32im(pSrcDstA, pSrcB, M, N)
+#define plp_mat_add_stride_i16(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_i16s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_add_stride_i32(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_i32s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_add_stride_i8(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_add_stride_i8s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_cholesky_q32(pSrc, N, fracBits, pDst) \
+    plp_mat_cholesky_stride_q32s_rv32im(pSrc, N, N, N, fracBits, pDst)
+#define plp_mat_cholesky_stride_q32(pSrc, N, strideSrc, strideDst, fracBits, pDst) \
+    plp_mat_cholesky_stride_q32s_rv32im(pSrc, N, strideSrc, strideDst, fracBits, pDst)
+#define plp_mat_copy_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_copy_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_i32s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_copy_stride_i8(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_copy_stride_i8s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_fill_I_i16(N, pDst) plp_mat_fill_I_i16s_rv32im(N, pDst)
+#define plp_mat_fill_I_i32(N, pDst) plp_mat_fill_I_i32s_rv32im(N, pDst)
+#define plp_mat_fill_I_i8(N, pDst) plp_mat_fill_I_i8s_rv32im(N, pDst)
+#define plp_mat_fill_I_q16(N, fracBits, pDst) plp_mat_fill_I_q16s_rv32im(N, fracBits, pDst)
+#define plp_mat_fill_I_q32(N, fracBits, pDst) plp_mat_fill_I_q32s_rv32im(N, fracBits, pDst)
+#define plp_mat_fill_I_q8(N, fracBits, pDst) plp_mat_fill_I_q8s_rv32im(N, fracBits, pDst)
+#define plp_mat_fill_I_stride_i16(N, stride, pDst) \
+    plp_mat_fill_I_stride_i16s_rv32im(N, stride, pDst)
+#define plp_mat_fill_I_stride_i32(N, stride, pDst) \
+    plp_mat_fill_I_stride_i32s_rv32im(N, stride, pDst)
+#define plp_mat_fill_I_stride_i8(N, stride, pDst) plp_mat_fill_I_stride_i8s_rv32im(N, stride, pDst)
+#define plp_mat_fill_I_stride_q16(N, stride, fracBits, pDst) \
+    plp_mat_fill_I_stride_q16s_rv32im(N, stride, fracBits, pDst)
+#define plp_mat_fill_I_stride_q32(N, stride, fracBits, pDst) \
+    plp_mat_fill_I_stride_q32s_rv32im(N, stride, fracBits, pDst)
+#define plp_mat_fill_I_stride_q8(N, stride, fracBits, pDst) \
+    plp_mat_fill_I_stride_q8s_rv32im(N, stride, fracBits, pDst)
+#define plp_mat_fill_stride_i16(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_i16s_rv32im(M, N, stride, value, pDst)
+#define plp_mat_fill_stride_i32(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_i32s_rv32im(M, N, stride, value, pDst)
+#define plp_mat_fill_stride_i8(M, N, stride, value, pDst) \
+    plp_mat_fill_stride_i8s_rv32im(M, N, stride, value, pDst)
+#define plp_mat_fma_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_i16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_i32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC) \
+    plp_mat_fma_stride_i8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, pDstC)
+#define plp_mat_fma_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC) \
+    plp_mat_fma_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC)
+#define plp_mat_fma_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC) \
+    plp_mat_fma_stride_q32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC)
+#define plp_mat_fma_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC) \
+    plp_mat_fma_stride_q8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, alpha, beta, shift, pDstC)
+#define plp_mat_herk_i16(pSrcA, M, N, pDstC) plp_mat_herk_i16s_rv32im(pSrcA, M, N, pDstC)
+#define plp_mat_herk_q16(pSrcA, M, N, shift, pDstC) \
+    plp_mat_herk_q16s_rv32im(pSrcA, M, N, shift, pDstC)
+#define plp_mat_hermitian_i16(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_i16s_rv32im(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_i32(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_i32s_rv32im(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_q16(pSrc, M, N, pDst) \
+    plp_mat_hermitian_stride_i16s_rv32im(pSrc, M, N, N, M, pDst)
+#define plp_mat_hermitian_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_hermitian_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_i32s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_hermitian_stride_q16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_hermitian_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_inv_q16(pSrc, N, fracBits, pDst) plp_mat_inv_q16s_rv32im(pSrc, N, fracBits, pDst)
+#define plp_mat_inv_q32(pSrc, N, fracBits, pDst) plp_mat_inv_q32s_rv32im(pSrc, N, fracBits, pDst)
+#define plp_mat_kron_i16(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_i16s_rv32im(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_kron_i32(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_i32s_rv32im(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_kron_i8(pSrcA, pSrcB, M, N, P, Q, pDstC) \
+    plp_mat_kron_i8s_rv32im(pSrcA, pSrcB, M, N, P, Q, pDstC)
+#define plp_mat_mult_bin(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_bins_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_i32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_cmplx_i8s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_cmplx_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_cmplx_q16s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_cmplx_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_cmplx_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_cmplx_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_cmplx_q8s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_cmplx_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_i16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_i32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_cmplx_stride_i8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_cmplx_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_cmplx_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_cmplx_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_cmplx_stride_q32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_cmplx_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_cmplx_stride_q8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i2(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i2s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i4(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i4s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_i8s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_i8xi16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_stride_i8xi16s_rv32im(pSrcA, pSrcB, M, N, O, N, O, O, pDstC)
+#define plp_mat_mult_packed_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_packed_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_packed_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_packed_i8s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_q16s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_q8s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_requant_i8(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC) \
+    plp_mat_mult_requant_i8s_rv32im(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC)
+#define plp_mat_mult_requant_q16(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC) \
+    plp_mat_mult_requant_q16s_rv32im(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC)
+#define plp_mat_mult_requant_q32(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC) \
+    plp_mat_mult_requant_q32s_rv32im(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC)
+#define plp_mat_mult_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_i8xi16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_stride_i8xi16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_stride_q32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_stride_q8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_ter(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_ters_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_i32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_cmplx_i8s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_cmplx_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_q16s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_q8s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_i16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_i32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_i8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_q32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_cmplx_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_cmplx_stride_q8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_i16(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_i32(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_i32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_i8(pSrcA, pSrcB, M, N, O, pDstC) \
+    plp_mat_mult_trans_i8s_rv32im(pSrcA, pSrcB, M, N, O, pDstC)
+#define plp_mat_mult_trans_q16(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_q16s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_q32(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_q8(pSrcA, pSrcB, M, N, O, shift, pDstC) \
+    plp_mat_mult_trans_q8s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC)
+#define plp_mat_mult_trans_stride_i16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_i16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_i32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC) \
+    plp_mat_mult_trans_stride_i8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC)
+#define plp_mat_mult_trans_stride_q16(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_stride_q32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_mult_trans_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC) \
+    plp_mat_mult_trans_stride_q8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC)
+#define plp_mat_norm_fro_stride_i16(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_fro_stride_i16s_rv32im(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_fro_stride_i8(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_fro_stride_i8s_rv32im(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_inf_stride_i16(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_inf_stride_i16s_rv32im(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_inf_stride_i8(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_inf_stride_i8s_rv32im(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_one_stride_i16(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_one_stride_i16s_rv32im(pSrc, M, N, stride, pRes)
+#define plp_mat_norm_one_stride_i8(pSrc, M, N, stride, pRes) \
+    plp_mat_norm_one_stride_i8s_rv32im(pSrc, M, N, stride, pRes)
+#define plp_mat_outer_i16(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_i16s_rv32im(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_outer_i32(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_i32s_rv32im(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_outer_i8(pSrcX, pSrcY, M, N, pDstC) \
+    plp_mat_outer_i8s_rv32im(pSrcX, pSrcY, M, N, pDstC)
+#define plp_mat_rank1_update_i16(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_i16s_rv32im(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_rank1_update_i32(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_i32s_rv32im(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_rank1_update_i8(pSrcX, pSrcY, M, N, pSrcDstA) \
+    plp_mat_rank1_update_i8s_rv32im(pSrcX, pSrcY, M, N, pSrcDstA)
+#define plp_mat_scale_i16(pSrc, M, N, scaleFactor, shift, pDst) \
+    plp_mat_scale_i16s_rv32im(pSrc, M, N, scaleFactor, shift, pDst)
+#define plp_mat_scale_i32(pSrc, M, N, scaleFactor, shift, pDst) \
+    plp_mat_scale_i32s_rv32im(pSrc, M, N, scaleFactor, shift, pDst)
+#define plp_mat_scale_i8(pSrc, M, N, scaleFactor, shift, pDst) \
+    plp_mat_scale_i8s_rv32im(pSrc, M, N, scaleFactor, shift, pDst)
+#define plp_mat_scale_inplace_i16(pSrcDst, M, N, scaleFactor, shift) \
+    plp_mat_scale_inplace_i16s_rv32im(pSrcDst, M, N, scaleFactor, shift)
+#define plp_mat_scale_inplace_i32(pSrcDst, M, N, scaleFactor, shift) \
+    plp_mat_scale_inplace_i32s_rv32im(pSrcDst, M, N, scaleFactor, shift)
+#define plp_mat_scale_inplace_i8(pSrcDst, M, N, scaleFactor, shift) \
+    plp_mat_scale_inplace_i8s_rv32im(pSrcDst, M, N, scaleFactor, shift)
+#define plp_mat_scale_stride_i16(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst) \
+    plp_mat_scale_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst)
+#define plp_mat_scale_stride_i32(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst) \
+    plp_mat_scale_stride_i32s_rv32im(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst)
+#define plp_mat_scale_stride_i8(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst) \
+    plp_mat_scale_stride_i8s_rv32im(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst)
+#define plp_mat_solve_tri_lower_q32(pSrcA, pSrcB, N, O, fracBits, pDstC) \
+    plp_mat_solve_tri_lower_stride_q32s_rv32im(pSrcA, pSrcB, N, O, N, O, O, fracBits, pDstC)
+#define plp_mat_solve_tri_lower_stride_q32(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC) \
+    plp_mat_solve_tri_lower_stride_q32s_rv32im(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC)
+#define plp_mat_solve_tri_upper_q32(pSrcA, pSrcB, N, O, fracBits, pDstC) \
+    plp_mat_solve_tri_upper_stride_q32s_rv32im(pSrcA, pSrcB, N, O, N, O, O, fracBits, pDstC)
+#define plp_mat_solve_tri_upper_stride_q32(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC) \
+    plp_mat_solve_tri_upper_stride_q32s_rv32im(pSrcA, pSrcB, N, O, strideA, strideB, strideC, fracBits, pDstC)
+#define plp_mat_sub_i16(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_i16s_rv32im(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_i32(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_i32s_rv32im(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_i8(pSrcA, pSrcB, M, N, pDst) plp_mat_sub_i8s_rv32im(pSrcA, pSrcB, M, N, pDst)
+#define plp_mat_sub_inplace_i16(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_i16s_rv32im(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_inplace_i32(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_i32s_rv32im(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_inplace_i8(pSrcDstA, pSrcB, M, N) \
+    plp_mat_sub_inplace_i8s_rv32im(pSrcDstA, pSrcB, M, N)
+#define plp_mat_sub_stride_i16(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_i16s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_sub_stride_i32(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_i32s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_sub_stride_i8(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst) \
+    plp_mat_sub_stride_i8s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst)
+#define plp_mat_syrk_i16(pSrcA, M, N, pDstC) plp_mat_syrk_i16s_rv32im(pSrcA, M, N, pDstC)
+#define plp_mat_syrk_q16(pSrcA, M, N, shift, pDstC) \
+    plp_mat_syrk_q16s_rv32im(pSrcA, M, N, shift, pDstC)
+#define plp_mat_trace_stride_i16(pSrc, N, stride, pRes) \
+    plp_mat_trace_stride_i16s_rv32im(pSrc, N, stride, pRes)
+#define plp_mat_trace_stride_i8(pSrc, N, stride, pRes) \
+    plp_mat_trace_stride_i8s_rv32im(pSrc, N, stride, pRes)
+#define plp_mat_trans_cmplx_i16(pSrc, M, N, pDst) \
+    plp_mat_trans_stride_i32s_rv32im((const int32_t *)(pSrc), M, N, N, M, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_i32(pSrc, M, N, pDst) \
+    plp_mat_trans_cmplx_stride_i32s_rv32im(pSrc, M, N, N, M, pDst)
+#define plp_mat_trans_cmplx_q16(pSrc, M, N, pDst) \
+    plp_mat_trans_stride_i32s_rv32im((const int32_t *)(pSrc), M, N, N, M, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_rv32im((const int32_t *)(pSrc), M, N, strideSrc, strideDst, (int32_t *)(pDst))
+#define plp_mat_trans_cmplx_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_cmplx_stride_i32s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_cmplx_stride_q16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_rv32im((const int32_t *)(pSrc), M, N, strideSrc, strideDst, (int32_t *)(pDst))
+#define plp_mat_trans_i16(pSrc, M, N, pDst) plp_mat_trans_i16s_rv32im(pSrc, M, N, pDst)
+#define plp_mat_trans_i32(pSrc, M, N, pDst) plp_mat_trans_i32s_rv32im(pSrc, M, N, pDst)
+#define plp_mat_trans_i8(pSrc, M, N, pDst) plp_mat_trans_i8s_rv32im(pSrc, M, N, pDst)
+#define plp_mat_trans_stride_i16(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i32s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_stride_i8(pSrc, M, N, strideSrc, strideDst, pDst) \
+    plp_mat_trans_stride_i8s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst)
+#define plp_mat_trans_vec_mult_i16(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_i16s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_i32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_i32s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_i8(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_trans_vec_mult_i8s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_trans_vec_mult_q16(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_trans_vec_mult_q16s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_trans_vec_mult_q32(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_trans_vec_mult_q32s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_trans_vec_mult_q8(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_trans_vec_mult_q8s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_cmplx_q16(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_cmplx_q16s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_compressed_i8(pSrcA, pCodebook, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_compressed_i8s_rv32im(pSrcA, pCodebook, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i16(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i16s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i32(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i32s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i8(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i8s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_i8xi16(pSrcA, pSrcX, M, N, pDstY) \
+    plp_mat_vec_mult_i8xi16s_rv32im(pSrcA, pSrcX, M, N, pDstY)
+#define plp_mat_vec_mult_q16(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_q16s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_q32(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_q32s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_mat_vec_mult_q8(pSrcA, pSrcX, M, N, shift, pDstY) \
+    plp_mat_vec_mult_q8s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY)
+#define plp_max_i16(pSrc, blockSize, pRes) plp_max_i16s_rv32im(pSrc, blockSize, pRes)
+#define plp_max_i32(pSrc, blockSize, pRes) plp_max_i32s_rv32im(pSrc, blockSize, pRes)
+#define plp_max_i8(pSrc, blockSize, pRes) plp_max_i8s_rv32im(pSrc, blockSize, pRes)
+#define plp_max_idx_i16(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_i16s_rv32im(pSrc, blockSize, pRes, pIndex)
+#define plp_max_idx_i32(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_i32s_rv32im(pSrc, blockSize, pRes, pIndex)
+#define plp_max_idx_i8(pSrc, blockSize, pRes, pIndex) \
+    plp_max_idx_i8s_rv32im(pSrc, blockSize, pRes, pIndex)
+#define plp_maxpool_i8(pSrc, H, W, C, kH, kW, stride, pDst) \
+    plp_maxpool_i8s_rv32im(pSrc, H, W, C, kH, kW, stride, pDst)
+#define plp_mean_i16(pSrc, blockSize, pRes) plp_mean_i16s_rv32im(pSrc, blockSize, pRes)
+#define plp_mean_i32(pSrc, blockSize, pRes) plp_mean_i32s_rv32im(pSrc, blockSize, pRes)
+#define plp_mean_i8(pSrc, blockSize, pRes) plp_mean_i8s_rv32im(pSrc, blockSize, pRes)
+#define plp_min_i16(pSrc, blockSize, pRes) plp_min_i16s_rv32im(pSrc, blockSize, pRes)
+#define plp_min_i32(pSrc, blockSize, pRes) plp_min_i32s_rv32im(pSrc, blockSize, pRes)
+#define plp_min_i8(pSrc, blockSize, pRes) plp_min_i8s_rv32im(pSrc, blockSize, pRes)
+#define plp_min_idx_i16(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_i16s_rv32im(pSrc, blockSize, pRes, pIndex)
+#define plp_min_idx_i32(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_i32s_rv32im(pSrc, blockSize, pRes, pIndex)
+#define plp_min_idx_i8(pSrc, blockSize, pRes, pIndex) \
+    plp_min_idx_i8s_rv32im(pSrc, blockSize, pRes, pIndex)
+#define plp_moving_avg_i16(S, pSrc, pDst, blockSize) \
+    plp_moving_avg_i16s_rv32im(S, pSrc, pDst, blockSize)
+#define plp_mult_i16(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_i32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_i8(pSrcA, pSrcB, pDst, blockSize) \
+    plp_mult_i8s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_mult_q16(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_mult_q16s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_mult_q32(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_mult_q32s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_mult_q8(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_mult_q8s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_ncc_i16(pSrc, srcLen, pTmpl, tmplLen, pRes) \
+    plp_ncc_i16s_rv32im(pSrc, srcLen, pTmpl, tmplLen, pRes)
+#define plp_nco_mix_q16(S, pSrc, blockSize, pDstI, pDstQ) \
+    plp_nco_mix_q16s_rv32im(S, pSrc, blockSize, pDstI, pDstQ)
+#define plp_negate_i16(pSrc, pDst, blockSize) plp_negate_i16s_rv32im(pSrc, pDst, blockSize)
+#define plp_negate_i32(pSrc, pDst, blockSize) plp_negate_i32s_rv32im(pSrc, pDst, blockSize)
+#define plp_negate_i8(pSrc, pDst, blockSize) plp_negate_i8s_rv32im(pSrc, pDst, blockSize)
+#define plp_normalize_l2_q16(pSrc, blockSize, pDst) \
+    plp_normalize_l2_q16s_rv32im(pSrc, blockSize, pDst)
+#define plp_offset_i16(pSrc, offset, pDst, blockSize) \
+    plp_offset_i16s_rv32im(pSrc, offset, pDst, blockSize)
+#define plp_offset_i32(pSrc, offset, pDst, blockSize) \
+    plp_offset_i32s_rv32im(pSrc, offset, pDst, blockSize)
+#define plp_offset_i8(pSrc, offset, pDst, blockSize) \
+    plp_offset_i8s_rv32im(pSrc, offset, pDst, blockSize)
+#define plp_park_clarke_inv_q32_vec(pId, pIq, pTheta, pIa, pIb, numAxes) \
+    plp_park_clarke_inv_vec_q32s_rv32im(pId, pIq, pTheta, pIa, pIb, numAxes)
+#define plp_pid_q32_vec(S, pIn, pOut, numAxes) plp_pid_vec_q32s_rv32im(S, pIn, pOut, numAxes)
+#define plp_pow2_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_pow2_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_power64_i32(pSrc, blockSize, pRes) plp_power64_i32s_rv32im(pSrc, blockSize, pRes)
+#define plp_power64_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_power64_q32s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_power_i16(pSrc, blockSize, pRes) plp_power_i16s_rv32im(pSrc, blockSize, pRes)
+#define plp_power_i32(pSrc, blockSize, pRes) plp_power_i32s_rv32im(pSrc, blockSize, pRes)
+#define plp_power_i8(pSrc, blockSize, pRes) plp_power_i8s_rv32im(pSrc, blockSize, pRes)
+#define plp_power_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_power_q16s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_power_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_power_q32s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_power_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_power_q8s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_recip_q16(pSrc, fracBits, pDst, blockSize) \
+    plp_recip_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_recip_q32(pSrc, fracBits, pDst, blockSize) \
+    plp_recip_q32s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_requantize_i32_i8(pSrc, nPixels, nChannels, pMult, pShift, pDst) \
+    plp_requantize_i32_i8s_rv32im(pSrc, nPixels, nChannels, pMult, pShift, pDst)
+#define plp_resample_q16(S, pSrc, blockSize, pDst) \
+    plp_resample_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_rfft_q16(S, pSrc, pDst) plp_rfft_q16s_rv32im(S, pSrc, pDst)
+#define plp_rfft_q32(S, pSrc, pDst) plp_rfft_q32s_rv32im(S, pSrc, pDst)
+#define plp_ringbuf_read_i16(S, blockSize, pDst) plp_ringbuf_read_i16s_rv32im(S, blockSize, pDst)
+#define plp_ringbuf_read_i32(S, blockSize, pDst) plp_ringbuf_read_i32s_rv32im(S, blockSize, pDst)
+#define plp_ringbuf_write_i16(S, pSrc, blockSize) plp_ringbuf_write_i16s_rv32im(S, pSrc, blockSize)
+#define plp_ringbuf_write_i32(S, pSrc, blockSize) plp_ringbuf_write_i32s_rv32im(S, pSrc, blockSize)
+#define plp_rms_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_rms_q16s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_rms_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_rms_q32s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_rms_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_rms_q8s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_rsqrt_q16(pSrc, fracBits, pDst, blockSize) \
+    plp_rsqrt_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_scale_i16(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_i16s_rv32im(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_i32(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_i32s_rv32im(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_i8(pSrc, scaleFactor, pDst, blockSize) \
+    plp_scale_i8s_rv32im(pSrc, scaleFactor, pDst, blockSize)
+#define plp_scale_q16(pSrc, scaleFactor, deciPoint, pDst, blockSize) \
+    plp_scale_q16s_rv32im(pSrc, scaleFactor, deciPoint, pDst, blockSize)
+#define plp_scale_q32(pSrc, scaleFactor, deciPoint, pDst, blockSize) \
+    plp_scale_q32s_rv32im(pSrc, scaleFactor, deciPoint, pDst, blockSize)
+#define plp_scale_q8(pSrc, scaleFactor, deciPoint, pDst, blockSize) \
+    plp_scale_q8s_rv32im(pSrc, scaleFactor, deciPoint, pDst, blockSize)
+#define plp_sdft_q16(S, pSrc, blockSize, pDst) plp_sdft_q16s_rv32im(S, pSrc, blockSize, pDst)
+#define plp_shift_i16(pSrc, shiftBits, pDst, blockSize) \
+    plp_shift_i16s_rv32im(pSrc, shiftBits, pDst, blockSize)
+#define plp_shift_i32(pSrc, shiftBits, pDst, blockSize) \
+    plp_shift_i32s_rv32im(pSrc, shiftBits, pDst, blockSize)
+#define plp_shift_i8(pSrc, shiftBits, pDst, blockSize) \
+    plp_shift_i8s_rv32im(pSrc, shiftBits, pDst, blockSize)
+#define plp_sigmoid_q16(x, fracBits) plp_sigmoid_q16s_rv32im(x, fracBits)
+#define plp_sigmoid_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_sigmoid_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_sigmoid_q32(x, fracBits) plp_sigmoid_q32s_rv32im(x, fracBits)
+#define plp_sigmoid_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_sigmoid_vec_q32s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_sin_q16(x) plp_sin_q16s_rv32im(x)
+#define plp_sin_q16_fast(x) plp_sin_fast_q16s_rv32im(x)
+#define plp_sin_q16_precise(x) plp_sin_precise_q16s_rv32im(x)
+#define plp_sin_q16_vec(pSrc, pDst, blockSize) plp_sin_vec_q16s_rv32im(pSrc, pDst, blockSize)
+#define plp_sin_q32(x) plp_sin_q32s_rv32im(x)
+#define plp_sin_q32_fast(x) plp_sin_fast_q32s_rv32im(x)
+#define plp_sin_q32_precise(x) plp_sin_precise_q32s_rv32im(x)
+#define plp_sin_q32_vec(pSrc, pDst, blockSize) plp_sin_vec_q32s_rv32im(pSrc, pDst, blockSize)
+#define plp_sincos_q16(pSrc, pSin, pCos, blockSize) \
+    plp_sincos_q16s_rv32im(pSrc, pSin, pCos, blockSize)
+#define plp_sincos_q32(pSrc, pSin, pCos, blockSize) \
+    plp_sincos_q32s_rv32im(pSrc, pSin, pCos, blockSize)
+#define plp_sliding_stats_update_q16(S, pNew, pOld, hopSize) \
+    plp_sliding_stats_update_q16s_rv32im(S, pNew, pOld, hopSize)
+#define plp_softmax_q16(pSrc, nRows, rowLen, fracBits, pDst) \
+    plp_softmax_q16s_rv32im(pSrc, nRows, rowLen, fracBits, pDst)
+#define plp_sort_i16(pSrcDst, blockSize) plp_sort_i16s_rv32im(pSrcDst, blockSize)
+#define plp_sort_i32(pSrcDst, blockSize) plp_sort_i32s_rv32im(pSrcDst, blockSize)
+#define plp_spmv_i16(pSrcA, pSrcX, pDstY) plp_spmv_i16s_rv32im(pSrcA, pSrcX, pDstY)
+#define plp_spmv_i8(pSrcA, pSrcX, pDstY) plp_spmv_i8s_rv32im(pSrcA, pSrcX, pDstY)
+#define plp_sqrt_q16(pSrc, fracBits, pRes) plp_sqrt_q16s_rv32im(pSrc, fracBits, pRes)
+#define plp_sqrt_q32(pSrc, fracBits, pRes) plp_sqrt_q32s_rv32im(pSrc, fracBits, pRes)
+#define plp_stats_summary_i16(pSrc, blockSize, pRes) \
+    plp_stats_summary_i16s_rv32im(pSrc, blockSize, pRes)
+#define plp_stats_summary_i32(pSrc, blockSize, pRes) \
+    plp_stats_summary_i32s_rv32im(pSrc, blockSize, pRes)
+#define plp_stats_summary_i8(pSrc, blockSize, pRes) \
+    plp_stats_summary_i8s_rv32im(pSrc, blockSize, pRes)
+#define plp_std_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_std_q16s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_std_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_std_q32s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_std_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_std_q8s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_sub_i16(pSrcA, pSrcB, pDst, blockSize) \
+    plp_sub_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_i32(pSrcA, pSrcB, pDst, blockSize) \
+    plp_sub_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_i8(pSrcA, pSrcB, pDst, blockSize) plp_sub_i8s_rv32im(pSrcA, pSrcB, pDst, blockSize)
+#define plp_sub_q16(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_sub_q16s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_sub_q32(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_sub_q32s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_sub_q8(pSrcA, pSrcB, deciPoint, pDst, blockSize) \
+    plp_sub_q8s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize)
+#define plp_tanh_q16(x, fracBits) plp_tanh_q16s_rv32im(x, fracBits)
+#define plp_tanh_q16_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_tanh_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_tanh_q32(x, fracBits) plp_tanh_q32s_rv32im(x, fracBits)
+#define plp_tanh_q32_vec(pSrc, fracBits, pDst, blockSize) \
+    plp_tanh_vec_q32s_rv32im(pSrc, fracBits, pDst, blockSize)
+#define plp_topk_i16(pSrc, blockSize, k, largest, pDstVal, pDstIdx) \
+    plp_topk_i16s_rv32im(pSrc, blockSize, k, largest, pDstVal, pDstIdx)
+#define plp_topk_i32(pSrc, blockSize, k, largest, pDstVal, pDstIdx) \
+    plp_topk_i32s_rv32im(pSrc, blockSize, k, largest, pDstVal, pDstIdx)
+#define plp_var64_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_var64_q32s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_var_q16(pSrc, blockSize, fracBits, pRes) \
+    plp_var_q16s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_var_q32(pSrc, blockSize, fracBits, pRes) \
+    plp_var_q32s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_var_q8(pSrc, blockSize, fracBits, pRes) \
+    plp_var_q8s_rv32im(pSrc, blockSize, fracBits, pRes)
+#define plp_vq_nearest_i16(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist) \
+    plp_vq_nearest_i16s_rv32im(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist)
+#define plp_vq_nearest_i8(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist) \
+    plp_vq_nearest_i8s_rv32im(pSrc, numVectors, pCodebook, numCentroids, dim, pNorms, pIdx, pDist)
+#define plp_window_apply_q16(S, pSrc, pDst) plp_window_apply_q16s_rv32im(S, pSrc, pDst)
+
+#endif // PLP_TARGET_FC_ONLY
+
+#endif // !PLP_PROFILE
+
+#endif // __PLP_DIRECT_H__
@@ -0,0 +1,3952 @@
+/** ==========================================================================
+ * @file     plp_fast_math.h
+ * @brief    Fast math functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_FAST_MATH_H__
+#define __PLP_FAST_MATH_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @struct plp_sincos_instance_q16
+    @brief Instance structure for the parallel sine and cosine of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[out] pSin       points to the output vector of the sines, NULL if not computed
+    @param[out] pCos       points to the output vector of the cosines, NULL if not computed
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc;   // pointer to the input vector
+    int16_t *pSin;         // pointer to the sines
+    int16_t *pCos;         // pointer to the cosines
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_sincos_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_sincos_instance_q32
+    @brief Instance structure for the parallel sine and cosine of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[out] pSin       points to the output vector of the sines, NULL if not computed
+    @param[out] pCos       points to the output vector of the cosines, NULL if not computed
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc;   // pointer to the input vector
+    int32_t *pSin;         // pointer to the sines
+    int32_t *pCos;         // pointer to the cosines
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_sincos_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_sincos_instance_f32
+    @brief Instance structure for the parallel sine and cosine of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[out] pSin       points to the output vector of the sines, NULL if not computed
+    @param[out] pCos       points to the output vector of the cosines, NULL if not computed
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t *pSin;       // pointer to the sines
+    float32_t *pCos;       // pointer to the cosines
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_sincos_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_log2_instance_q16
+    @brief Instance structure for the parallel base 2 logarithm and power of two of a 16-bit
+           fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  fracBits   decimal point of the input of the logarithm, of the output of the power
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc;   // pointer to the input vector
+    uint32_t fracBits;     // decimal point of the fixed point values
+    int16_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_log2_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_db_instance_q16
+    @brief Instance structure for the parallel decibel conversion of a 32-bit fixed point power.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  fracBits   decimal point of the input
+    @param[out] pDst       points to the output vector, in Q8.8 dB
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc;   // pointer to the input vector
+    uint32_t fracBits;     // decimal point of the input
+    int16_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_db_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_log2_instance_f32
+    @brief Instance structure for the parallel base 2 logarithm, decibel conversion and power of
+           two of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_log2_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_lut_interp_instance_q16
+    @brief Instance structure of a 16-bit fixed point piecewise-linear table.
+    @param[in]  pTable      points to the table of output values
+    @param[in]  numPoints   number of entries of the table
+    @param[in]  xMin        input value of the first entry
+    @param[in]  shift       log2 of the input distance of two neighboring entries
+*/
+typedef struct {
+    const int16_t *pTable; // pointer to the table
+    uint32_t numPoints;    // number of entries
+    int16_t xMin;          // input value of the first entry
+    uint32_t shift;        // log2 of the distance of the entries
+} plp_lut_interp_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_lut_interp_instance_q32
+    @brief Instance structure of a 32-bit fixed point piecewise-linear table.
+    @param[in]  pTable      points to the table of output values
+    @param[in]  numPoints   number of entries of the table
+    @param[in]  xMin        input value of the first entry
+    @param[in]  shift       log2 of the input distance of two neighboring entries
+*/
+typedef struct {
+    const int32_t *pTable; // pointer to the table
+    uint32_t numPoints;    // number of entries
+    int32_t xMin;          // input value of the first entry
+    uint32_t shift;        // log2 of the distance of the entries
+} plp_lut_interp_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_lut_interp_instance_f32
+    @brief Instance structure of a 32-bit floating-point piecewise-linear table.
+    @param[in]  pTable      points to the table of output values
+    @param[in]  numPoints   number of entries of the table
+    @param[in]  xMin        input value of the first entry
+    @param[in]  invStep     reciprocal of the input distance of two neighboring entries
+*/
+typedef struct {
+    const float32_t *pTable; // pointer to the table
+    uint32_t numPoints;      // number of entries
+    float32_t xMin;          // input value of the first entry
+    float32_t invStep;       // reciprocal of the distance of the entries
+} plp_lut_interp_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_recip_instance_q16
+    @brief Instance structure for the parallel reciprocal of 16-bit fixed point vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  fracBits   decimal point of the inputs and of the output
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc;   // pointer to the input vector
+    uint32_t fracBits;     // decimal point of the fixed point values
+    int16_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_recip_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_recip_instance_q32
+    @brief Instance structure for the parallel reciprocal of 32-bit fixed point vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  fracBits   decimal point of the inputs and of the output
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc;   // pointer to the input vector
+    uint32_t fracBits;     // decimal point of the fixed point values
+    int32_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_recip_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_div_instance_q16
+    @brief Instance structure for the parallel division of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the dividends
+    @param[in]  pSrcB      points to the divisors
+    @param[in]  fracBits   decimal point of the inputs and of the output
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrcA;  // pointer to the dividends
+    const int16_t *pSrcB;  // pointer to the divisors
+    uint32_t fracBits;     // decimal point of the fixed point values
+    int16_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_div_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_div_instance_q32
+    @brief Instance structure for the parallel division of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the dividends
+    @param[in]  pSrcB      points to the divisors
+    @param[in]  fracBits   decimal point of the inputs and of the output
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in the vectors
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrcA;  // pointer to the dividends
+    const int32_t *pSrcB;  // pointer to the divisors
+    uint32_t fracBits;     // decimal point of the fixed point values
+    int32_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in the vectors
+    uint32_t nPE;          // number of processing units
+} plp_div_instance_q32;
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 32-bit fixed point number.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 16-bit fixed point number.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 32-bit floating point number.
+    @param[in]  pSrc  points to the input value
+    @param[out] pRes  Square root returned here
+    @return     none
+*/
+
+void plp_sqrt_f32(const float *__restrict__ pSrc, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  pSrc  points to the input value
+    @param[out] pRes  Square root returned here
+    @return     none
+*/
+
+void plp_sqrt_f32s_xpulpv2(const float *__restrict__ pSrc, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the square roots of a 32-bit float vector.
+     @param[in]  pSrc       points to the input vector
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    If the FPU implements fsqrt (__riscv_fsqrt), the square roots are computed in hardware. Otherwise,
+    the square root is computed as x * rsqrt(x), with the Newton refined inverse square root of
+    plp_rsqrt_f32. Non-positive inputs result in 0.
+*/
+
+void plp_sqrt_f32_vec(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the inverse square roots of a 32-bit float vector.
+     @param[in]  pSrc       points to the input vector
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    The initial approximation is computed from the bit pattern of the input, and refined with two
+    Newton iterations (the first one with the optimized coefficients of Moroz et al.), which results
+    in a relative error below 1e-6. The iterations only need multiplications, which are pipelined
+    in the FPU, and are faster than the fdiv and fsqrt instructions even where those are available.
+    Non-positive inputs result in 0.
+*/
+
+void plp_rsqrt_f32(const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the inverse square roots of a 16-bit fixed point vector.
+     @param[in]  pSrc       points to the input vector
+     @param[in]  fracBits   decimal point of the input and of the output, format Q(16-fracBits).fracBits
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    The input is normalized to a mantissa in [0.25, 1) and an even exponent. The inverse square root
+    of the mantissa is looked up in rsqrtTable_q16 and refined with two Newton iterations in Q2.14,
+    then shifted by half the exponent. Results which cannot be represented are saturated, and
+    non-positive inputs result in 0. The kernel only needs integer operations.
+*/
+
+void plp_rsqrt_q16(const int16_t *__restrict__ pSrc,
+                   const uint32_t fracBits,
+                   int16_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Square roots of a 32-bit float vector for XPULPV2 extension.
+     @param[in]  pSrc       points to the input vector
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    If the FPU implements fsqrt (__riscv_fsqrt), the square roots are computed in hardware. Otherwise,
+    the square root is computed as x * rsqrt(x), with the Newton refined inverse square root of
+    plp_rsqrt_f32. Non-positive inputs result in 0.
+*/
+
+void plp_sqrt_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Inverse square roots of a 32-bit float vector for XPULPV2 extension.
+     @param[in]  pSrc       points to the input vector
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    The initial approximation is computed from the bit pattern of the input, and refined with two
+    Newton iterations (the first one with the optimized coefficients of Moroz et al.), which results
+    in a relative error below 1e-6. The iterations only need multiplications, which are pipelined
+    in the FPU, and are faster than the fdiv and fsqrt instructions even where those are available.
+    Non-positive inputs result in 0.
+*/
+
+void plp_rsqrt_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Inverse square roots of a 16-bit fixed point vector for RV32IM extension.
+     @param[in]  pSrc       points to the input vector
+     @param[in]  fracBits   decimal point of the input and of the output, format Q(16-fracBits).fracBits
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    The input is normalized to a mantissa in [0.25, 1) and an even exponent. The inverse square root
+    of the mantissa is looked up in rsqrtTable_q16 and refined with two Newton iterations in Q2.14,
+    then shifted by half the exponent. Results which cannot be represented are saturated, and
+    non-positive inputs result in 0. The kernel only needs integer operations.
+*/
+
+void plp_rsqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Inverse square roots of a 16-bit fixed point vector for XPULPV2 extension.
+     @param[in]  pSrc       points to the input vector
+     @param[in]  fracBits   decimal point of the input and of the output, format Q(16-fracBits).fracBits
+     @param[out] pDst       points to the output vector
+     @param[in]  blockSize  number of samples in the vectors
+     @return     none
+
+    @par
+    The input is normalized to a mantissa in [0.25, 1) and an even exponent. The inverse square root
+    of the mantissa is looked up in rsqrtTable_q16 and refined with two Newton iterations in Q2.14,
+    then shifted by half the exponent. Results which cannot be represented are saturated, and
+    non-positive inputs result in 0. The kernel only needs integer operations.
+*/
+
+void plp_rsqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            const uint32_t fracBits,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief Macros required for SINE and COSINE Fast math approximations
+ */
+
+#define FAST_MATH_TABLE_SIZE 512
+#define FAST_MATH_Q32_SHIFT (32 - 10)
+#define FAST_MATH_Q16_SHIFT (16 - 10)
+#define CONTROLLER_Q32_SHIFT (32 - 9)
+#define TABLE_SPACING_Q32 0x400000
+#define TABLE_SPACING_Q16 0x80
+
+/**
+ * @brief Size of the table for the inverse square root approximation
+ */
+
+#define FAST_MATH_RSQRT_TABLE_SIZE 24
+
+/**
+ * @brief Size of the table for the reciprocal approximation
+ */
+
+#define FAST_MATH_RECIP_TABLE_SIZE 32
+
+/**
+ * @brief Sizes of the tables for the exponential, logarithm, tanh and sigmoid approximations
+ */
+
+#define FAST_MATH_EXP_TABLE_SIZE 128
+#define FAST_MATH_LOG_TABLE_SIZE 128
+#define FAST_MATH_TANH_TABLE_SIZE 256
+
+/**
+ * @brief Number of steps of the quarter period in sinTable_quarter_q32
+ */
+
+#define PLP_QUARTER_WAVE_SIZE 1024
+
+/*
+ * The kernels read entry i of the sine tables, sin(2 * pi * i / FAST_MATH_TABLE_SIZE) for
+ * 0 <= i <= FAST_MATH_TABLE_SIZE, with PLP_SIN_TABLE_F32(i), PLP_SIN_TABLE_Q32(i) and
+ * PLP_SIN_TABLE_Q16(i). If the library is built with PLP_QUARTER_WAVE_TABLES
+ * (make PLP_QUARTER_WAVE_TABLES=1), sinTable_f32, sinTable_q32 and sinTable_q16 as well as the
+ * twiddle factor tables twiddleCoef_N_q16 of the fixed-point FFTs are left out, which saves about
+ * 25 kB of L2. All of them are then derived from the single table sinTable_quarter_q32, which holds
+ * the first quarter period of the sine in Q1.31 (4 kB), with the symmetries of the sine. The
+ * derived values are the same as the ones of the full tables, apart from the floating-point sine,
+ * which is only as precise as Q1.31, and every lookup takes a few instructions more. Together with
+ * PLP_L1_FAST_MATH_TABLES, the quarter-wave table is in L1 and the FFTs read no table from L2.
+ */
+#if defined(PLP_QUARTER_WAVE_TABLES)
+
+extern const int32_t sinTable_quarter_q32[PLP_QUARTER_WAVE_SIZE + 1];
+
+/** sin(2 * pi * k / (4 * PLP_QUARTER_WAVE_SIZE)) in Q1.31, for any k */
+static inline int32_t plp_quarter_sin_q32(uint32_t k) {
+    uint32_t i = k & (PLP_QUARTER_WAVE_SIZE - 1);
+    int32_t v;
+
+    if (k & PLP_QUARTER_WAVE_SIZE) {
+        i = PLP_QUARTER_WAVE_SIZE - i;
+    }
+    v = sinTable_quarter_q32[i];
+    return (k & (2 * PLP_QUARTER_WAVE_SIZE)) ? -v : v;
+}
+
+/** sin(2 * pi * k / (4 * PLP_QUARTER_WAVE_SIZE)) in Q1.15, rounded to nearest, for any k */
+static inline int16_t plp_quarter_sin_q16(uint32_t k) {
+    int32_t v = plp_quarter_sin_q32(k);
+    int32_t r = (v >> 16) + ((v >> 15) & 1);
+    return (int16_t)((r > 0x7FFF) ? 0x7FFF : r);
+}
+
+/** sin(2 * pi * k / (4 * PLP_QUARTER_WAVE_SIZE)), for any k */
+static inline float32_t plp_quarter_sin_f32(uint32_t k) {
+    return (float32_t)plp_quarter_sin_q32(k) * (1.0f / 2147483648.0f);
+}
+
+#define PLP_SIN_TABLE_STEP (4 * PLP_QUARTER_WAVE_SIZE / FAST_MATH_TABLE_SIZE)
+#define PLP_SIN_TABLE_F32(i) plp_quarter_sin_f32((uint32_t)(i)*PLP_SIN_TABLE_STEP)
+#define PLP_SIN_TABLE_Q32(i) plp_quarter_sin_q32((uint32_t)(i)*PLP_SIN_TABLE_STEP)
+#define PLP_SIN_TABLE_Q16(i) plp_quarter_sin_q16((uint32_t)(i)*PLP_SIN_TABLE_STEP)
+
+#else
+
+#define PLP_SIN_TABLE_F32(i) (sinTable_f32[i])
+#define PLP_SIN_TABLE_Q32(i) (sinTable_q32[i])
+#define PLP_SIN_TABLE_Q16(i) (sinTable_q16[i])
+
+#endif
+
+/**
+ * @brief      Glue code for q32 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32(int32_t x);
+
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16(int16_t x);
+
+/**
+ * @brief      q16 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for f32 cosine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32(float32_t x);
+
+/**
+ * @brief      F32 cosine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for q32 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32(int32_t x);
+
+/**
+ * @brief      q32 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16(int16_t x);
+
+/**
+ * @brief      q16 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for q32 sine function with nearest-entry table lookup
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int32_t plp_sin_q32_fast(int32_t x);
+
+/**
+ * @brief      q32 sine function with nearest-entry table lookup for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int32_t plp_sin_fast_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 sine function with nearest-entry table lookup for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int32_t plp_sin_fast_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q32 cosine function with nearest-entry table lookup
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int32_t plp_cos_q32_fast(int32_t x);
+
+/**
+ * @brief      Glue code for q32 sine function with cubic interpolation
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table. The error is a few LSBs, compared to about 16 bits of accuracy of the linear
+ * interpolation of plp_sin_q32.
+ */
+
+int32_t plp_sin_q32_precise(int32_t x);
+
+/**
+ * @brief      q32 sine function with cubic interpolation for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table. The error is a few LSBs, compared to about 16 bits of accuracy of the linear
+ * interpolation of plp_sin_q32.
+ */
+
+int32_t plp_sin_precise_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 sine function with cubic interpolation for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table. The error is a few LSBs, compared to about 16 bits of accuracy of the linear
+ * interpolation of plp_sin_q32.
+ */
+
+int32_t plp_sin_precise_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q32 cosine function with cubic interpolation
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table. The error is a few LSBs, compared to about 16 bits of accuracy of the linear
+ * interpolation of plp_cos_q32.
+ */
+
+int32_t plp_cos_q32_precise(int32_t x);
+
+/**
+ * @brief      Glue code for q16 sine function with nearest-entry table lookup
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int16_t plp_sin_q16_fast(int16_t x);
+
+/**
+ * @brief      q16 sine function with nearest-entry table lookup for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int16_t plp_sin_fast_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 sine function with nearest-entry table lookup for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int16_t plp_sin_fast_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for q16 cosine function with nearest-entry table lookup
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int16_t plp_cos_q16_fast(int16_t x);
+
+/**
+ * @brief      Glue code for q16 sine function with cubic interpolation
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table, which are read from sinTable_q32 for additional precision. The error is at most
+ * one LSB, compared to a few LSBs of the linear interpolation of plp_sin_q16.
+ */
+
+int16_t plp_sin_q16_precise(int16_t x);
+
+/**
+ * @brief      q16 sine function with cubic interpolation for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table, which are read from sinTable_q32 for additional precision. The error is at most
+ * one LSB, compared to a few LSBs of the linear interpolation of plp_sin_q16.
+ */
+
+int16_t plp_sin_precise_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 sine function with cubic interpolation for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table, which are read from sinTable_q32 for additional precision. The error is at most
+ * one LSB, compared to a few LSBs of the linear interpolation of plp_sin_q16.
+ */
+
+int16_t plp_sin_precise_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for q16 cosine function with cubic interpolation
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table, which are read from sinTable_q32 for additional precision. The error is at most
+ * one LSB, compared to a few LSBs of the linear interpolation of plp_cos_q16.
+ */
+
+int16_t plp_cos_q16_precise(int16_t x);
+
+/**
+ * @brief      Glue code for f32 sine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32(float32_t x);
+
+/**
+ * @brief      F32 sine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      q16 sine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q16 sine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel q16 sine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_sin_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q16 sine function on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_q16_vec(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q16 sine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_sin_q16_vec_parallel(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      q16 cosine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q16 cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel q16 cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_cos_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q16 cosine function on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_q16_vec(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q16 cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_cos_q16_vec_parallel(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      q16 sine and cosine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q16 and plp_cos_q16.
+ */
+
+void plp_sincos_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                            int16_t *__restrict__ pSin,
+                            int16_t *__restrict__ pCos,
+                            uint32_t blockSize);
+
+/**
+ * @brief      q16 sine and cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q16 and plp_cos_q16.
+ */
+
+void plp_sincos_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pSin,
+                             int16_t *__restrict__ pCos,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Parallel q16 sine and cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_sincos_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q16 sine and cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q16 and plp_cos_q16.
+ */
+
+void plp_sincos_q16(const int16_t *__restrict__ pSrc,
+                    int16_t *__restrict__ pSin,
+                    int16_t *__restrict__ pCos,
+                    uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q16 sine and cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_sincos_q16_parallel(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pSin,
+                             int16_t *__restrict__ pCos,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/**
+ * @brief      q32 sine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q32 sine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel q32 sine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_sin_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q32 sine function on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_q32_vec(const int32_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q32 sine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_sin_q32_vec_parallel(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q32 cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel q32 cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_cos_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q32 cosine function on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_q32_vec(const int32_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q32 cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_cos_q32_vec_parallel(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      q32 sine and cosine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q32 and plp_cos_q32.
+ */
+
+void plp_sincos_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                            int32_t *__restrict__ pSin,
+                            int32_t *__restrict__ pCos,
+                            uint32_t blockSize);
+
+/**
+ * @brief      q32 sine and cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q32 and plp_cos_q32.
+ */
+
+void plp_sincos_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pSin,
+                             int32_t *__restrict__ pCos,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Parallel q32 sine and cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_sincos_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q32 sine and cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q32 and plp_cos_q32.
+ */
+
+void plp_sincos_q32(const int32_t *__restrict__ pSrc,
+                    int32_t *__restrict__ pSin,
+                    int32_t *__restrict__ pCos,
+                    uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q32 sine and cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_sincos_q32_parallel(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pSin,
+                             int32_t *__restrict__ pCos,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/**
+ * @brief      f32 sine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel f32 sine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_f32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_sin_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the f32 sine function on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sin_f32_vec(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel f32 sine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_sin_f32_vec_parallel(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      f32 cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel f32 cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_f32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_cos_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the f32 cosine function on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_f32_vec(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel f32 cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_cos_f32_vec_parallel(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      f32 sine and cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The cosines therefore can differ from plp_cos_f32 in the last bits.
+ */
+
+void plp_sincos_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pSin,
+                             float32_t *__restrict__ pCos,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Parallel f32 sine and cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_f32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_sincos_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the f32 sine and cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The cosines therefore can differ from plp_cos_f32 in the last bits.
+ */
+
+void plp_sincos_f32(const float32_t *__restrict__ pSrc,
+                    float32_t *__restrict__ pSin,
+                    float32_t *__restrict__ pCos,
+                    uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel f32 sine and cosine of a vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ */
+
+void plp_sincos_f32_parallel(const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pSin,
+                             float32_t *__restrict__ pCos,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/**
+ * @brief      Glue code for q16 exponential function
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_exp_q16(int16_t x,
+                    uint32_t fracBits);
+
+/**
+ * @brief      q16 exponential function for RV32IM
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_exp_q16s_rv32im(int16_t x,
+                            uint32_t fracBits);
+
+/**
+ * @brief      q16 exponential function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_exp_q16s_xpulpv2(int16_t x,
+                             uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q16 exponential function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_q16_vec(const int16_t *__restrict__ pSrc,
+                     uint32_t fracBits,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      q16 exponential function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q16 exponential function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q32 exponential function
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int32_t plp_exp_q32(int32_t x,
+                    uint32_t fracBits);
+
+/**
+ * @brief      q32 exponential function for RV32IM
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int32_t plp_exp_q32s_rv32im(int32_t x,
+                            uint32_t fracBits);
+
+/**
+ * @brief      q32 exponential function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int32_t plp_exp_q32s_xpulpv2(int32_t x,
+                             uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q32 exponential function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_q32_vec(const int32_t *__restrict__ pSrc,
+                     uint32_t fracBits,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      q32 exponential function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q32 exponential function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Glue code for f32 exponential function
+ *
+ * @param[in]  x         input value
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied to the exponent bits.
+ */
+
+float32_t plp_exp_f32(float32_t x);
+
+/**
+ * @brief      f32 exponential function for XPULPV2
+ *
+ * @param[in]  x         input value
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied to the exponent bits.
+ */
+
+float32_t plp_exp_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for the f32 exponential function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_f32_vec(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      f32 exponential function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q16 natural logarithm function
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in the most negative value.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_log_q16(int16_t x,
+                    uint32_t fracBits);
+
+/**
+ * @brief      q16 natural logarithm function for RV32IM
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in the most negative value.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_log_q16s_rv32im(int16_t x,
+                            uint32_t fracBits);
+
+/**
+ * @brief      q16 natural logarithm function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in the most negative value.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_log_q16s_xpulpv2(int16_t x,
+                             uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q16 natural logarithm function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_q16_vec(const int16_t *__restrict__ pSrc,
+                     uint32_t fracBits,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      q16 natural logarithm function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q16 natural logarithm function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q32 natural logarithm function
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in the most negative value.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int32_t plp_log_q32(int32_t x,
+                    uint32_t fracBits);
+
+/**
+ * @brief      q32 natural logarithm function for RV32IM
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in the most negative value.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int32_t plp_log_q32s_rv32im(int32_t x,
+                            uint32_t fracBits);
+
+/**
+ * @brief      q32 natural logarithm function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in the most negative value.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int32_t plp_log_q32s_xpulpv2(int32_t x,
+                             uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q32 natural logarithm function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_q32_vec(const int32_t *__restrict__ pSrc,
+                     uint32_t fracBits,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      q32 natural logarithm function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      q32 natural logarithm function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Glue code for f32 natural logarithm function
+ *
+ * @param[in]  x         input value
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in -inf.
+ */
+
+float32_t plp_log_f32(float32_t x);
+
+/**
+ * @brief      f32 natural logarithm function for XPULPV2
+ *
+ * @param[in]  x         input value
+ *
+ * @return     ln(x)
+ *
+ * ln(x) is computed as (e + log2(m)) * ln(2), with x = m * 2^e and log2(m) interpolated in
+ * logTable. Non-positive inputs result in -inf.
+ */
+
+float32_t plp_log_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for the f32 natural logarithm function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_f32_vec(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      f32 natural logarithm function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the q16 base 2 logarithm on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * log2(x) is computed as e + log2(m), with x = m * 2^e, where e is the position of the leading
+ * one and log2(m) is interpolated in logTable. The output is in Q6.10, which holds the logarithm
+ * of every positive input. Non-positive inputs result in the most negative value.
+ */
+
+void plp_log2_q16_vec(const int16_t *__restrict__ pSrc,
+                      uint32_t fracBits,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      q16 base 2 logarithm on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * log2(x) is computed as e + log2(m), with x = m * 2^e, where e is the position of the leading
+ * one and log2(m) is interpolated in logTable. The output is in Q6.10, which holds the logarithm
+ * of every positive input. Non-positive inputs result in the most negative value.
+ */
+
+void plp_log2_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      q16 base 2 logarithm on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * log2(x) is computed as e + log2(m), with x = m * 2^e, where e is the position of the leading
+ * one and log2(m) is interpolated in logTable. The output is in Q6.10, which holds the logarithm
+ * of every positive input. Non-positive inputs result in the most negative value.
+ */
+
+void plp_log2_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Parallel q16 base 2 logarithm kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_log2_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_log2_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the parallel q16 base 2 logarithm on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ * @param[in]  nPE       number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_log2_q16_vec.
+ */
+
+void plp_log2_q16_vec_parallel(const int16_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               uint32_t nPE);
+
+/**
+ * @brief      Glue code for the q16 power to decibel conversion on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is a power, e.g. a power spectrum, and the output 10 * log10(x) in Q8.8 dB. It is
+ * computed as (e + log2(m)) * 10 * log10(2), with x = m * 2^e, where e is the position of the
+ * leading one and log2(m) is interpolated in logTable. Non-positive inputs result in the most
+ * negative value.
+ */
+
+void plp_db_q16_vec(const int32_t *__restrict__ pSrc,
+                    uint32_t fracBits,
+                    int16_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/**
+ * @brief      q16 power to decibel conversion on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is a power, e.g. a power spectrum, and the output 10 * log10(x) in Q8.8 dB. It is
+ * computed as (e + log2(m)) * 10 * log10(2), with x = m * 2^e, where e is the position of the
+ * leading one and log2(m) is interpolated in logTable. Non-positive inputs result in the most
+ * negative value.
+ */
+
+void plp_db_vec_q16s_rv32im(const int32_t *__restrict__ pSrc,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief      q16 power to decibel conversion on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is a power, e.g. a power spectrum, and the output 10 * log10(x) in Q8.8 dB. It is
+ * computed as (e + log2(m)) * 10 * log10(2), with x = m * 2^e, where e is the position of the
+ * leading one and log2(m) is interpolated in logTable. Non-positive inputs result in the most
+ * negative value.
+ */
+
+void plp_db_vec_q16s_xpulpv2(const int32_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Parallel q16 power to decibel conversion kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_db_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_db_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the parallel q16 power to decibel conversion on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ * @param[in]  nPE       number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_db_q16_vec.
+ */
+
+void plp_db_q16_vec_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/**
+ * @brief      Glue code for the q16 power of two on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is in Q6.10, like the output of plp_log2_q16_vec. 2^x is computed as 2^n * 2^fr,
+ * with the fractional power of two interpolated in expTable and the integer one applied as a
+ * shift. The output is in Q(16-fracBits).fracBits, and saturated if it cannot be represented.
+ */
+
+void plp_pow2_q16_vec(const int16_t *__restrict__ pSrc,
+                      uint32_t fracBits,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      q16 power of two on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is in Q6.10, like the output of plp_log2_q16_vec. 2^x is computed as 2^n * 2^fr,
+ * with the fractional power of two interpolated in expTable and the integer one applied as a
+ * shift. The output is in Q(16-fracBits).fracBits, and saturated if it cannot be represented.
+ */
+
+void plp_pow2_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      q16 power of two on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is in Q6.10, like the output of plp_log2_q16_vec. 2^x is computed as 2^n * 2^fr,
+ * with the fractional power of two interpolated in expTable and the integer one applied as a
+ * shift. The output is in Q(16-fracBits).fracBits, and saturated if it cannot be represented.
+ */
+
+void plp_pow2_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Parallel q16 power of two kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_log2_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_pow2_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the parallel q16 power of two on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ * @param[in]  nPE       number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_pow2_q16_vec.
+ */
+
+void plp_pow2_q16_vec_parallel(const int16_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               uint32_t nPE);
+
+/**
+ * @brief      Glue code for the f32 base 2 logarithm on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * log2(x) is computed as e + log2(m), with x = m * 2^e read from the exponent and mantissa bits
+ * and log2(m) interpolated in logTable. Non-positive inputs result in -inf.
+ */
+
+void plp_log2_f32_vec(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      f32 base 2 logarithm on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * log2(x) is computed as e + log2(m), with x = m * 2^e read from the exponent and mantissa bits
+ * and log2(m) interpolated in logTable. Non-positive inputs result in -inf.
+ */
+
+void plp_log2_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Parallel f32 base 2 logarithm kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_log2_instance_f32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_log2_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the parallel f32 base 2 logarithm on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ * @param[in]  nPE       number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_log2_f32_vec.
+ */
+
+void plp_log2_f32_vec_parallel(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               uint32_t nPE);
+
+/**
+ * @brief      Glue code for the f32 power to decibel conversion on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is a power, e.g. a power spectrum, and the output 10 * log10(x) in dB. It is
+ * computed as (e + log2(m)) * 10 * log10(2), with x = m * 2^e read from the exponent and mantissa
+ * bits and log2(m) interpolated in logTable. Non-positive inputs result in -inf.
+ */
+
+void plp_db_f32_vec(const float32_t *__restrict__ pSrc,
+                    float32_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/**
+ * @brief      f32 power to decibel conversion on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is a power, e.g. a power spectrum, and the output 10 * log10(x) in dB. It is
+ * computed as (e + log2(m)) * 10 * log10(2), with x = m * 2^e read from the exponent and mantissa
+ * bits and log2(m) interpolated in logTable. Non-positive inputs result in -inf.
+ */
+
+void plp_db_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Parallel f32 power to decibel conversion kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_log2_instance_f32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_db_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the parallel f32 power to decibel conversion on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ * @param[in]  nPE       number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_db_f32_vec.
+ */
+
+void plp_db_f32_vec_parallel(const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/**
+ * @brief      Glue code for the f32 power of two on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * 2^x is computed as 2^n * 2^fr, with the fractional power of two interpolated in expTable and
+ * 2^n written into the exponent bits. Inputs of 128 and above result in +inf, the ones below -126
+ * in 0.
+ */
+
+void plp_pow2_f32_vec(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      f32 power of two on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * 2^x is computed as 2^n * 2^fr, with the fractional power of two interpolated in expTable and
+ * 2^n written into the exponent bits. Inputs of 128 and above result in +inf, the ones below -126
+ * in 0.
+ */
+
+void plp_pow2_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Parallel f32 power of two kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_log2_instance_f32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_pow2_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the parallel f32 power of two on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ * @param[in]  nPE       number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_pow2_f32_vec.
+ */
+
+void plp_pow2_f32_vec_parallel(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               uint32_t nPE);
+
+/**
+ * @brief      Glue code for q16 hyperbolic tangent function
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_tanh_q16(int16_t x,
+                     uint32_t fracBits);
+
+/**
+ * @brief      q16 hyperbolic tangent function for RV32IM
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_tanh_q16s_rv32im(int16_t x,
+                             uint32_t fracBits);
+
+/**
+ * @brief      q16 hyperbolic tangent function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_tanh_q16s_xpulpv2(int16_t x,
+                              uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q16 hyperbolic tangent function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_q16_vec(const int16_t *__restrict__ pSrc,
+                      uint32_t fracBits,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      q16 hyperbolic tangent function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      q16 hyperbolic tangent function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q32 hyperbolic tangent function
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_tanh_q32(int32_t x,
+                     uint32_t fracBits);
+
+/**
+ * @brief      q32 hyperbolic tangent function for RV32IM
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_tanh_q32s_rv32im(int32_t x,
+                             uint32_t fracBits);
+
+/**
+ * @brief      q32 hyperbolic tangent function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_tanh_q32s_xpulpv2(int32_t x,
+                              uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q32 hyperbolic tangent function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_q32_vec(const int32_t *__restrict__ pSrc,
+                      uint32_t fracBits,
+                      int32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      q32 hyperbolic tangent function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      q32 hyperbolic tangent function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Glue code for f32 hyperbolic tangent function
+ *
+ * @param[in]  x         input value
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ */
+
+float32_t plp_tanh_f32(float32_t x);
+
+/**
+ * @brief      f32 hyperbolic tangent function for XPULPV2
+ *
+ * @param[in]  x         input value
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ */
+
+float32_t plp_tanh_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for the f32 hyperbolic tangent function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_f32_vec(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      f32 hyperbolic tangent function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q16 sigmoid (logistic) function
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_sigmoid_q16(int16_t x,
+                        uint32_t fracBits);
+
+/**
+ * @brief      q16 sigmoid (logistic) function for RV32IM
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_sigmoid_q16s_rv32im(int16_t x,
+                                uint32_t fracBits);
+
+/**
+ * @brief      q16 sigmoid (logistic) function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_sigmoid_q16s_xpulpv2(int16_t x,
+                                 uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q16 sigmoid (logistic) function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_q16_vec(const int16_t *__restrict__ pSrc,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pDst,
+                         uint32_t blockSize);
+
+/**
+ * @brief      q16 sigmoid (logistic) function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                 uint32_t fracBits,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t blockSize);
+
+/**
+ * @brief      q16 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  uint32_t fracBits,
+                                  int16_t *__restrict__ pDst,
+                                  uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q32 sigmoid (logistic) function
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_sigmoid_q32(int32_t x,
+                        uint32_t fracBits);
+
+/**
+ * @brief      q32 sigmoid (logistic) function for RV32IM
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_sigmoid_q32s_rv32im(int32_t x,
+                                uint32_t fracBits);
+
+/**
+ * @brief      q32 sigmoid (logistic) function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_sigmoid_q32s_xpulpv2(int32_t x,
+                                 uint32_t fracBits);
+
+/**
+ * @brief      Glue code for the q32 sigmoid (logistic) function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_q32_vec(const int32_t *__restrict__ pSrc,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pDst,
+                         uint32_t blockSize);
+
+/**
+ * @brief      q32 sigmoid (logistic) function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 uint32_t fracBits,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t blockSize);
+
+/**
+ * @brief      q32 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t blockSize);
+
+/**
+ * @brief      Glue code for f32 sigmoid (logistic) function
+ *
+ * @param[in]  x         input value
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ */
+
+float32_t plp_sigmoid_f32(float32_t x);
+
+/**
+ * @brief      f32 sigmoid (logistic) function for XPULPV2
+ *
+ * @param[in]  x         input value
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ */
+
+float32_t plp_sigmoid_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for the f32 sigmoid (logistic) function on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_f32_vec(const float32_t *__restrict__ pSrc,
+                         float32_t *__restrict__ pDst,
+                         uint32_t blockSize);
+
+/**
+ * @brief      f32 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t blockSize);
+
+/**
+ * @brief      Glue code for q16 four quadrant arctangent
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.15 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q16
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int16_t plp_atan2_q16(int16_t y,
+                      int16_t x);
+
+/**
+ * @brief      q16 four quadrant arctangent for RV32IM
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.15 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q16
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int16_t plp_atan2_q16s_rv32im(int16_t y,
+                              int16_t x);
+
+/**
+ * @brief      q16 four quadrant arctangent for XPULPV2
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.15 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q16
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int16_t plp_atan2_q16s_xpulpv2(int16_t y,
+                               int16_t x);
+
+/**
+ * @brief      Glue code for q32 four quadrant arctangent
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.31 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q32
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int32_t plp_atan2_q32(int32_t y,
+                      int32_t x);
+
+/**
+ * @brief      q32 four quadrant arctangent for RV32IM
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.31 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q32
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int32_t plp_atan2_q32s_rv32im(int32_t y,
+                              int32_t x);
+
+/**
+ * @brief      q32 four quadrant arctangent for XPULPV2
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.31 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q32
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int32_t plp_atan2_q32s_xpulpv2(int32_t y,
+                               int32_t x);
+
+/**
+ * @brief      Glue code for f32 four quadrant arctangent
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), angle in radians, in range [-PI, PI]
+ *
+ * The ratio of the smaller and the larger magnitude is computed with a Newton refined reciprocal
+ * (no division is needed), and its arctangent with a polynomial. atan2(0, 0) is 0.
+ */
+
+float32_t plp_atan2_f32(float32_t y,
+                        float32_t x);
+
+/**
+ * @brief      f32 four quadrant arctangent for XPULPV2
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), angle in radians, in range [-PI, PI]
+ *
+ * The ratio of the smaller and the larger magnitude is computed with a Newton refined reciprocal
+ * (no division is needed), and its arctangent with a polynomial. atan2(0, 0) is 0.
+ */
+
+float32_t plp_atan2_f32s_xpulpv2(float32_t y,
+                                 float32_t x);
+
+/**
+ * @brief      Initialization of the 16-bit fixed point piecewise-linear table instance
+ *
+ * @param[out] S          points to an instance of the 16-bit fixed point table structure
+ * @param[in]  pTable     points to the table of numPoints output values
+ * @param[in]  numPoints  number of entries of the table, at least 2
+ * @param[in]  xMin       input value of the first entry
+ * @param[in]  shift      log2 of the input distance of two neighboring entries, at most 15
+ *
+ * @return     none
+ *
+ * Entry i of the table is the output at the input xMin + (i << shift). The distance of the
+ * entries is a power of two, such that the kernels find the entry and the interpolation weight
+ * with a shift and a mask.
+ */
+
+void plp_lut_interp_init_q16(plp_lut_interp_instance_q16 *S,
+                             const int16_t *pTable,
+                             uint32_t numPoints,
+                             int16_t xMin,
+                             uint32_t shift);
+
+/**
+ * @brief      Glue code for the q16 piecewise-linear table interpolation
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int16_t plp_lut_interp_q16(const plp_lut_interp_instance_q16 *S,
+                           int16_t x);
+
+/**
+ * @brief      q16 piecewise-linear table interpolation for RV32IM
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int16_t plp_lut_interp_q16s_rv32im(const plp_lut_interp_instance_q16 *S,
+                                   int16_t x);
+
+/**
+ * @brief      q16 piecewise-linear table interpolation for XPULPV2
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int16_t plp_lut_interp_q16s_xpulpv2(const plp_lut_interp_instance_q16 *S,
+                                    int16_t x);
+
+/**
+ * @brief      Glue code for the q16 piecewise-linear table interpolation on vectors
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_q16_vec(const plp_lut_interp_instance_q16 *S,
+                            const int16_t *__restrict__ pSrc,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief      q16 piecewise-linear table interpolation on vectors for RV32IM
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_q16s_rv32im(const plp_lut_interp_instance_q16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t blockSize);
+
+/**
+ * @brief      q16 piecewise-linear table interpolation on vectors for XPULPV2
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The samples are loaded two per 32-bit word, and both of them are clamped to the domain of
+ * the table and turned into distances to its first entry with one pv.max.h, pv.min.h and
+ * pv.sub.h. Samples before the first word-aligned one of pSrc are interpolated one by one.
+ */
+
+void plp_lut_interp_vec_q16s_xpulpv2(const plp_lut_interp_instance_q16 *S,
+                                     const int16_t *__restrict__ pSrc,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t blockSize);
+
+/**
+ * @brief      Initialization of the 32-bit fixed point piecewise-linear table instance
+ *
+ * @param[out] S          points to an instance of the 32-bit fixed point table structure
+ * @param[in]  pTable     points to the table of numPoints output values
+ * @param[in]  numPoints  number of entries of the table, at least 2
+ * @param[in]  xMin       input value of the first entry
+ * @param[in]  shift      log2 of the input distance of two neighboring entries, at most 31
+ *
+ * @return     none
+ *
+ * Entry i of the table is the output at the input xMin + (i << shift). The distance of the
+ * entries is a power of two, such that the kernels find the entry and the interpolation weight
+ * with a shift and a mask.
+ */
+
+void plp_lut_interp_init_q32(plp_lut_interp_instance_q32 *S,
+                             const int32_t *pTable,
+                             uint32_t numPoints,
+                             int32_t xMin,
+                             uint32_t shift);
+
+/**
+ * @brief      Glue code for the q32 piecewise-linear table interpolation
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int32_t plp_lut_interp_q32(const plp_lut_interp_instance_q32 *S,
+                           int32_t x);
+
+/**
+ * @brief      q32 piecewise-linear table interpolation for RV32IM
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int32_t plp_lut_interp_q32s_rv32im(const plp_lut_interp_instance_q32 *S,
+                                   int32_t x);
+
+/**
+ * @brief      q32 piecewise-linear table interpolation for XPULPV2
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int32_t plp_lut_interp_q32s_xpulpv2(const plp_lut_interp_instance_q32 *S,
+                                    int32_t x);
+
+/**
+ * @brief      Glue code for the q32 piecewise-linear table interpolation on vectors
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_q32_vec(const plp_lut_interp_instance_q32 *S,
+                            const int32_t *__restrict__ pSrc,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief      q32 piecewise-linear table interpolation on vectors for RV32IM
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_q32s_rv32im(const plp_lut_interp_instance_q32 *S,
+                                    const int32_t *__restrict__ pSrc,
+                                    int32_t *__restrict__ pDst,
+                                    uint32_t blockSize);
+
+/**
+ * @brief      q32 piecewise-linear table interpolation on vectors for XPULPV2
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_q32s_xpulpv2(const plp_lut_interp_instance_q32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t blockSize);
+
+/**
+ * @brief      Initialization of the 32-bit floating-point piecewise-linear table instance
+ *
+ * @param[out] S          points to an instance of the 32-bit floating-point table structure
+ * @param[in]  pTable     points to the table of numPoints output values
+ * @param[in]  numPoints  number of entries of the table, at least 2
+ * @param[in]  xMin       input value of the first entry
+ * @param[in]  step       input distance of two neighboring entries, larger than 0
+ *
+ * @return     none
+ *
+ * Entry i of the table is the output at the input xMin + i * step. The reciprocal of the step
+ * is stored, such that the kernels need no division.
+ */
+
+void plp_lut_interp_init_f32(plp_lut_interp_instance_f32 *S,
+                             const float32_t *pTable,
+                             uint32_t numPoints,
+                             float32_t xMin,
+                             float32_t step);
+
+/**
+ * @brief      Glue code for the f32 piecewise-linear table interpolation
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries.
+ */
+
+float32_t plp_lut_interp_f32(const plp_lut_interp_instance_f32 *S,
+                             float32_t x);
+
+/**
+ * @brief      f32 piecewise-linear table interpolation for XPULPV2
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries.
+ */
+
+float32_t plp_lut_interp_f32s_xpulpv2(const plp_lut_interp_instance_f32 *S,
+                                      float32_t x);
+
+/**
+ * @brief      Glue code for the f32 piecewise-linear table interpolation on vectors
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_f32_vec(const plp_lut_interp_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief      f32 piecewise-linear table interpolation on vectors for XPULPV2
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_f32s_xpulpv2(const plp_lut_interp_instance_f32 *S,
+                                     const float32_t *__restrict__ pSrc,
+                                     float32_t *__restrict__ pDst,
+                                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the q16 reciprocal on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t fracBits,
+                   int16_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/**
+ * @brief      q16 reciprocal on vectors for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t fracBits,
+                           int16_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/**
+ * @brief      q16 reciprocal on vectors for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q16 reciprocal on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_recip_q16.
+ */
+
+void plp_recip_q16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/**
+ * @brief      Parallel q16 reciprocal kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_recip_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_recip_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q32 reciprocal on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/**
+ * @brief      q32 reciprocal on vectors for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/**
+ * @brief      q32 reciprocal on vectors for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q32 reciprocal on vectors
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_recip_q32.
+ */
+
+void plp_recip_q32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/**
+ * @brief      Parallel q32 reciprocal kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_recip_instance_q32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_recip_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q16 division on vectors
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q16(const int16_t *__restrict__ pSrcA,
+                 const int16_t *__restrict__ pSrcB,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pDst,
+                 uint32_t blockSize);
+
+/**
+ * @brief      q16 division on vectors for RV32IM
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pDst,
+                         uint32_t blockSize);
+
+/**
+ * @brief      q16 division on vectors for XPULPV2
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcB,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pDst,
+                          uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q16 division on vectors
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_div_q16.
+ */
+
+void plp_div_q16_parallel(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcB,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/**
+ * @brief      Parallel q16 division kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_div_instance_q16 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_div_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the q32 division on vectors
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q32(const int32_t *__restrict__ pSrcA,
+                 const int32_t *__restrict__ pSrcB,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pDst,
+                 uint32_t blockSize);
+
+/**
+ * @brief      q32 division on vectors for RV32IM
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                         const int32_t *__restrict__ pSrcB,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pDst,
+                         uint32_t blockSize);
+
+/**
+ * @brief      q32 division on vectors for XPULPV2
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                          const int32_t *__restrict__ pSrcB,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pDst,
+                          uint32_t blockSize);
+
+/**
+ * @brief      Glue code for the parallel q32 division on vectors
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ * @param[in]  nPE        number of parallel processing units
+ *
+ * @return     none
+ *
+ * The results are identical to the ones of plp_div_q32.
+ */
+
+void plp_div_q32_parallel(const int32_t *__restrict__ pSrcA,
+                          const int32_t *__restrict__ pSrcB,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE);
+
+/**
+ * @brief      Parallel q32 division kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_div_instance_q32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_div_q32p_xpulpv2(void *args);
+
+#endif // __PLP_FAST_MATH_H__
@@ -0,0 +1,4785 @@
+/** ==========================================================================
+ * @file     plp_filtering.h
+ * @brief    Filtering functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_FILTERING_H__
+#define __PLP_FILTERING_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @brief Instance structure for basic integer convolution.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int32_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in each vector
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_conv_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for basic integer convolution.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in each vector
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_conv_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for basic integer convolution.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;    // number of samples in each vector
+    uint8_t nPE;         // number of processing units
+    int32_t *pRes;       // pointer to result vector
+} plp_conv_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for basic integer convolution.
+    @param[in]  addOffset
+    @param[in]  addLengthfirst
+    @param[in]  addLengthsecond
+    @param[in]  numVectors
+    @param[in]  blockOffset
+    @param[out] pRes       output result returned here
+    @param[in]  coresPerVector
+*/
+typedef struct {
+    uint32_t addOffset;
+    uint32_t addLengthfirst;
+    uint32_t addLengthsecond;
+    uint32_t numVectors;
+    uint32_t blockOffset;
+    int32_t *pRes;
+    uint8_t coresPerVector;
+} plp_conv_tree_add_instance;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel correlation of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int32_t *pSrcA;
+    uint32_t srcALen;
+    const int32_t *pSrcB;
+    uint32_t srcBLen;
+    uint8_t nPE;
+    int32_t *pRes;
+} plp_correlate_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel correlation of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int16_t *pSrcA;
+    uint32_t srcALen;
+    const int16_t *pSrcB;
+    uint32_t srcBLen;
+    uint8_t nPE;
+    int32_t *pRes;
+} plp_correlate_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel correlation of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int8_t *pSrcA;
+    uint32_t srcALen;
+    const int8_t *pSrcB;
+    uint32_t srcBLen;
+    uint8_t nPE;
+    int32_t *pRes;
+} plp_correlate_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel correlation of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  fracBits   fixed point position of the result
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int32_t *pSrcA;
+    uint32_t srcALen;
+    const int32_t *pSrcB;
+    uint32_t srcBLen;
+    uint32_t fracBits;
+    uint8_t nPE;
+    int32_t *pRes;
+} plp_correlate_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel correlation of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  fracBits   fixed point position of the result
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int16_t *pSrcA;
+    uint32_t srcALen;
+    const int16_t *pSrcB;
+    uint32_t srcBLen;
+    uint32_t fracBits;
+    uint8_t nPE;
+    int32_t *pRes;
+} plp_correlate_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel correlation of 8-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  fracBits   fixed point position of the result
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int8_t *pSrcA;
+    uint32_t srcALen;
+    const int8_t *pSrcB;
+    uint32_t srcBLen;
+    uint32_t fracBits;
+    uint8_t nPE;
+    int32_t *pRes;
+} plp_correlate_instance_q8;
+
+/** -------------------------------------------------------
+    @brief Padding modes of the 2D convolution (plp_conv2d_i16, plp_conv2d_i8)
+*/
+#define PLP_CONV2D_VALID 0 // output only where the kernel lies inside the image
+#define PLP_CONV2D_SAME 1  // zero-padded, output has the size of the input image
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 2D convolution of 16-bit integer images.
+    @param[in]  pSrc       points to the input image
+    @param[in]  srcH       height of the input image
+    @param[in]  srcW       width of the input image
+    @param[in]  strideSrc  stride of the input image
+    @param[in]  pKernel    points to the filter kernel
+    @param[in]  kH         height of the filter kernel
+    @param[in]  kW         width of the filter kernel
+    @param[in]  padding    PLP_CONV2D_VALID or PLP_CONV2D_SAME
+    @param[in]  strideDst  stride of the output image
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output image
+*/
+typedef struct {
+    const int16_t *pSrc;
+    uint32_t srcH;
+    uint32_t srcW;
+    uint32_t strideSrc;
+    const int16_t *pKernel;
+    uint32_t kH;
+    uint32_t kW;
+    uint32_t padding;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_conv2d_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 2D convolution of 8-bit integer images.
+    @param[in]  pSrc       points to the input image
+    @param[in]  srcH       height of the input image
+    @param[in]  srcW       width of the input image
+    @param[in]  strideSrc  stride of the input image
+    @param[in]  pKernel    points to the filter kernel
+    @param[in]  kH         height of the filter kernel
+    @param[in]  kW         width of the filter kernel
+    @param[in]  padding    PLP_CONV2D_VALID or PLP_CONV2D_SAME
+    @param[in]  strideDst  stride of the output image
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output image
+*/
+typedef struct {
+    const int8_t *pSrc;
+    uint32_t srcH;
+    uint32_t srcW;
+    uint32_t strideSrc;
+    const int8_t *pKernel;
+    uint32_t kH;
+    uint32_t kW;
+    uint32_t padding;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_conv2d_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit integer Winograd convolution (see
+           plp_conv_winograd_init_i16).
+    @param[in]  kH       height of the filter kernel, 1 (3 taps) or 3 (3x3)
+    @param[in]  pKernel  points to the filter kernel of size kH x 3
+    @param[in]  pCoeffs  points to the transformed filter kernel, 4 or 16 values
+*/
+typedef struct {
+    uint32_t kH;
+    const int16_t *pKernel;
+    const int32_t *pCoeffs;
+} plp_conv_winograd_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point Winograd convolution (see
+           plp_conv_winograd_init_f32).
+    @param[in]  kH       height of the filter kernel, 1 (3 taps) or 3 (3x3)
+    @param[in]  pKernel  points to the filter kernel of size kH x 3
+    @param[in]  pCoeffs  points to the transformed filter kernel, 4 or 16 values
+*/
+typedef struct {
+    uint32_t kH;
+    const float32_t *pKernel;
+    const float32_t *pCoeffs;
+} plp_conv_winograd_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 16-bit integer Winograd convolution.
+    @param[in]  S          points to the Winograd convolution instance
+    @param[in]  pSrc       points to the input image
+    @param[in]  srcH       height of the input image
+    @param[in]  srcW       width of the input image
+    @param[in]  strideSrc  stride of the input image
+    @param[in]  strideDst  stride of the output image
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output image
+*/
+typedef struct {
+    const plp_conv_winograd_instance_i16 *S;
+    const int16_t *pSrc;
+    uint32_t srcH;
+    uint32_t srcW;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_conv_valid_winograd_parallel_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit floating-point Winograd convolution.
+    @param[in]  S          points to the Winograd convolution instance
+    @param[in]  pSrc       points to the input image
+    @param[in]  srcH       height of the input image
+    @param[in]  srcW       width of the input image
+    @param[in]  strideSrc  stride of the input image
+    @param[in]  strideDst  stride of the output image
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output image
+*/
+typedef struct {
+    const plp_conv_winograd_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t srcH;
+    uint32_t srcW;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_conv_valid_winograd_parallel_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t numTaps;
+    int32_t *pState;
+    const int32_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t numTaps;
+    int16_t *pState;
+    const int16_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 8-bit fixed point FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t numTaps;
+    int8_t *pState;
+    const int8_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_instance_q8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+*/
+typedef struct {
+    uint32_t numTaps;
+    float *pState;
+    const float *pCoeffs;
+} plp_fir_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit fixed point FIR filter.
+    @param[in]  S          points to the FIR filter instance
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the block of output samples
+*/
+typedef struct {
+    const plp_fir_instance_q32 *S;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_fir_parallel_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 16-bit fixed point FIR filter.
+    @param[in]  S          points to the FIR filter instance
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the block of output samples
+*/
+typedef struct {
+    const plp_fir_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_fir_parallel_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 8-bit fixed point FIR filter.
+    @param[in]  S          points to the FIR filter instance
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the block of output samples
+*/
+typedef struct {
+    const plp_fir_instance_q8 *S;
+    const int8_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int8_t *pDst;
+} plp_fir_parallel_instance_q8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit floating-point FIR filter.
+    @param[in]  S          points to the FIR filter instance
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the block of output samples
+*/
+typedef struct {
+    const plp_fir_instance_f32 *S;
+    const float *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    float *pDst;
+} plp_fir_parallel_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point biquad cascade IIR filter (direct form I).
+    @param[in]  numStages  number of second order stages
+    @param[in]  pState     points to the state buffer of size 4 * numStages
+    @param[in]  pCoeffs    points to the coefficients of size 5 * numStages
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t numStages;
+    int32_t *pState;
+    const int32_t *pCoeffs;
+    uint32_t fracBits;
+} plp_biquad_cascade_df1_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point biquad cascade IIR filter (direct form I).
+    @param[in]  numStages  number of second order stages
+    @param[in]  pState     points to the state buffer of size 4 * numStages
+    @param[in]  pCoeffs    points to the coefficients of size 5 * numStages
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t numStages;
+    int16_t *pState;
+    const int16_t *pCoeffs;
+    uint32_t fracBits;
+} plp_biquad_cascade_df1_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point biquad cascade IIR filter (transposed
+           direct form II).
+    @param[in]  numStages  number of second order stages
+    @param[in]  pState     points to the state buffer of size 2 * numStages
+    @param[in]  pCoeffs    points to the coefficients of size 5 * numStages
+*/
+typedef struct {
+    uint32_t numStages;
+    float *pState;
+    const float *pCoeffs;
+} plp_biquad_cascade_df2T_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 32-bit fixed point biquad cascade IIR
+           filter.
+    @param[in]  S            points to the array of filter instances, one per channel
+    @param[in]  numChannels  number of channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_biquad_cascade_df1_instance_q32 *S;
+    uint32_t numChannels;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_biquad_cascade_df1_parallel_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 16-bit fixed point biquad cascade IIR
+           filter.
+    @param[in]  S            points to the array of filter instances, one per channel
+    @param[in]  numChannels  number of channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_biquad_cascade_df1_instance_q16 *S;
+    uint32_t numChannels;
+    const int16_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_biquad_cascade_df1_parallel_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 32-bit floating-point biquad cascade
+           IIR filter.
+    @param[in]  S            points to the array of filter instances, one per channel
+    @param[in]  numChannels  number of channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_biquad_cascade_df2T_instance_f32 *S;
+    uint32_t numChannels;
+    const float *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    float *pDst;
+} plp_biquad_cascade_df2T_parallel_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point FIR decimator.
+    @param[in]  M          decimation factor
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t M;
+    uint32_t numTaps;
+    int32_t *pState;
+    const int32_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_decimate_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point FIR decimator.
+    @param[in]  M          decimation factor
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t M;
+    uint32_t numTaps;
+    int16_t *pState;
+    const int16_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_decimate_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point FIR decimator.
+    @param[in]  M          decimation factor
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order
+*/
+typedef struct {
+    uint32_t M;
+    uint32_t numTaps;
+    float *pState;
+    const float *pCoeffs;
+} plp_fir_decimate_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point FIR interpolator.
+    @param[in]  L           interpolation factor
+    @param[in]  phaseLength number of coefficients per phase, numTaps / L
+    @param[in]  pState      points to the state buffer of size phaseLength + blockSize - 1
+    @param[in]  pCoeffs     points to the coefficients, in time-reversed order
+    @param[in]  fracBits    fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t L;
+    uint32_t phaseLength;
+    int32_t *pState;
+    const int32_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_interpolate_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point FIR interpolator.
+    @param[in]  L           interpolation factor
+    @param[in]  phaseLength number of coefficients per phase, numTaps / L
+    @param[in]  pState      points to the state buffer of size phaseLength + blockSize - 1
+    @param[in]  pCoeffs     points to the coefficients, in time-reversed order
+    @param[in]  fracBits    fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t L;
+    uint32_t phaseLength;
+    int16_t *pState;
+    const int16_t *pCoeffs;
+    uint32_t fracBits;
+} plp_fir_interpolate_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point FIR interpolator.
+    @param[in]  L           interpolation factor
+    @param[in]  phaseLength number of coefficients per phase, numTaps / L
+    @param[in]  pState      points to the state buffer of size phaseLength + blockSize - 1
+    @param[in]  pCoeffs     points to the coefficients, in time-reversed order
+*/
+typedef struct {
+    uint32_t L;
+    uint32_t phaseLength;
+    float *pState;
+    const float *pCoeffs;
+} plp_fir_interpolate_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point polyphase resampler.
+    @param[in]  L           interpolation factor
+    @param[in]  M           decimation factor
+    @param[in]  phaseLength number of coefficients per phase, numTaps / L
+    @param[in]  phase       phase accumulator, position of the next output relative to the next
+                            block, in units of 1 / L input samples
+    @param[in]  pBank       points to the coefficient bank, L phases of phaseLength coefficients
+    @param[in]  pState      points to the state buffer of size phaseLength + blockSize - 1
+    @param[in]  fracBits    fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t L;
+    uint32_t M;
+    uint32_t phaseLength;
+    uint32_t phase;
+    const int16_t *pBank;
+    int16_t *pState;
+    uint32_t fracBits;
+} plp_resample_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point polyphase resampler.
+    @param[in]  L           interpolation factor
+    @param[in]  M           decimation factor
+    @param[in]  phaseLength number of coefficients per phase, numTaps / L
+    @param[in]  phase       phase accumulator, position of the next output relative to the next
+                            block, in units of 1 / L input samples
+    @param[in]  pBank       points to the coefficient bank, L phases of phaseLength coefficients
+    @param[in]  pState      points to the state buffer of size phaseLength + blockSize - 1
+*/
+typedef struct {
+    uint32_t L;
+    uint32_t M;
+    uint32_t phaseLength;
+    uint32_t phase;
+    const float *pBank;
+    float *pState;
+} plp_resample_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point Hilbert FIR filter.
+    @param[in]  numTaps    length of the filter, including the zero coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1, whose first
+                           part is the delay line of the even samples
+    @param[in]  pStateOdd  points to the delay line of the odd samples within the state buffer
+    @param[in]  pCoeffs    points to the (numTaps + 1) / 2 nonzero coefficients, in time-reversed
+                           order
+    @param[in]  fracBits   fixed point position of the coefficients
+*/
+typedef struct {
+    uint32_t numTaps;
+    int16_t *pState;
+    int16_t *pStateOdd;
+    const int16_t *pCoeffs;
+    uint32_t fracBits;
+} plp_hilbert_fir_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point NCO mixer.
+    @param[in]  phaseInc   phase increment per sample, where 2^32 corresponds to 2 * pi
+    @param[in]  phase      phase accumulator, phase of the next input sample
+*/
+typedef struct {
+    uint32_t phaseInc;
+    uint32_t phase;
+} plp_nco_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point digital down-converter.
+    @param[in]  pNco       points to the NCO mixer, which is advanced by every call
+    @param[in]  pDecI      points to the FIR decimator of the in-phase component
+    @param[in]  pDecQ      points to the FIR decimator of the quadrature component
+*/
+typedef struct {
+    plp_nco_instance_q16 *pNco;
+    const plp_fir_decimate_instance_q16 *pDecI;
+    const plp_fir_decimate_instance_q16 *pDecQ;
+} plp_ddc_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit integer CIC decimator.
+    @param[in]  order      number of integrator and comb stages
+    @param[in]  M          decimation factor
+    @param[in]  pState     points to the state buffer of 2 * order values, the integrators followed
+                           by the delays of the combs
+    @param[in]  shift      right shift of the output samples
+*/
+typedef struct {
+    uint32_t order;
+    uint32_t M;
+    int32_t *pState;
+    uint32_t shift;
+} plp_cic_decimate_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point CIC decimator.
+    @param[in]  order      number of integrator and comb stages
+    @param[in]  M          decimation factor
+    @param[in]  pState     points to the state buffer of 2 * order values, the integrators followed
+                           by the delays of the combs
+    @param[in]  shift      right shift of the output samples, which compensates the gain
+*/
+typedef struct {
+    uint32_t order;
+    uint32_t M;
+    int64_t *pState;
+    uint32_t shift;
+} plp_cic_decimate_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit integer CIC interpolator.
+    @param[in]  order      number of integrator and comb stages
+    @param[in]  L          interpolation factor
+    @param[in]  pState     points to the state buffer of 2 * order values, the delays of the combs
+                           followed by the integrators
+    @param[in]  shift      right shift of the output samples
+*/
+typedef struct {
+    uint32_t order;
+    uint32_t L;
+    int32_t *pState;
+    uint32_t shift;
+} plp_cic_interpolate_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit fixed point CIC interpolator.
+    @param[in]  order      number of integrator and comb stages
+    @param[in]  L          interpolation factor
+    @param[in]  pState     points to the state buffer of 2 * order values, the delays of the combs
+                           followed by the integrators
+    @param[in]  shift      right shift of the output samples, which compensates the gain
+*/
+typedef struct {
+    uint32_t order;
+    uint32_t L;
+    int64_t *pState;
+    uint32_t shift;
+} plp_cic_interpolate_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 32-bit integer CIC decimator.
+    @param[in]  S            points to an array of numChannels instances
+    @param[in]  numChannels  number of independent channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of input samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_cic_decimate_instance_i32 *S;
+    uint32_t numChannels;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_cic_decimate_parallel_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 32-bit fixed point CIC decimator.
+    @param[in]  S            points to an array of numChannels instances
+    @param[in]  numChannels  number of independent channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of input samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_cic_decimate_instance_q32 *S;
+    uint32_t numChannels;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_cic_decimate_parallel_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 32-bit integer CIC interpolator.
+    @param[in]  S            points to an array of numChannels instances
+    @param[in]  numChannels  number of independent channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of input samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_cic_interpolate_instance_i32 *S;
+    uint32_t numChannels;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_cic_interpolate_parallel_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel multi-channel 32-bit fixed point CIC interpolator.
+    @param[in]  S            points to an array of numChannels instances
+    @param[in]  numChannels  number of independent channels
+    @param[in]  pSrc         points to the input samples
+    @param[in]  blockSize    number of input samples to process per channel
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output samples
+*/
+typedef struct {
+    const plp_cic_interpolate_instance_q32 *S;
+    uint32_t numChannels;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_cic_interpolate_parallel_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point LMS filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order, adapted in place
+    @param[in]  mu         step size of the coefficient update
+    @param[in]  fracBits   fixed point position of the coefficients, inputs and mu
+*/
+typedef struct {
+    uint32_t numTaps;
+    int16_t *pState;
+    int16_t *pCoeffs;
+    int16_t mu;
+    uint32_t fracBits;
+} plp_lms_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point LMS filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order, adapted in place
+    @param[in]  mu         step size of the coefficient update
+*/
+typedef struct {
+    uint32_t numTaps;
+    float32_t *pState;
+    float32_t *pCoeffs;
+    float32_t mu;
+} plp_lms_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit fixed point normalized LMS filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order, adapted in place
+    @param[in]  mu         step size of the coefficient update
+    @param[in]  fracBits   fixed point position of the coefficients, inputs and mu
+*/
+typedef struct {
+    uint32_t numTaps;
+    int16_t *pState;
+    int16_t *pCoeffs;
+    int16_t mu;
+    uint32_t fracBits;
+} plp_lms_norm_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point normalized LMS filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize - 1
+    @param[in]  pCoeffs    points to the coefficients, in time-reversed order, adapted in place
+    @param[in]  mu         step size of the coefficient update
+*/
+typedef struct {
+    uint32_t numTaps;
+    float32_t *pState;
+    float32_t *pCoeffs;
+    float32_t mu;
+} plp_lms_norm_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 16-bit integer moving-average filter.
+    @param[in]  length     length of the averaging window
+    @param[in]  pState     points to the circular state buffer of size length
+    @param[in]  index      position of the oldest sample in the state buffer
+    @param[in]  sum        running sum of the samples in the state buffer
+    @param[in]  recip      2^30 / length, rounded
+*/
+typedef struct {
+    uint32_t length;
+    int16_t *pState;
+    uint32_t index;
+    int32_t sum;
+    int32_t recip;
+} plp_moving_avg_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the 32-bit floating-point moving-average filter.
+    @param[in]  length     length of the averaging window
+    @param[in]  pState     points to the circular state buffer of size length
+    @param[in]  index      position of the oldest sample in the state buffer
+    @param[in]  sum        running sum of the samples in the state buffer
+    @param[in]  invLength  1 / length
+*/
+typedef struct {
+    uint32_t length;
+    float32_t *pState;
+    uint32_t index;
+    float32_t sum;
+    float32_t invLength;
+} plp_moving_avg_instance_f32;
+
+/** Maximum window length of the median filters (plp_median_filter_i16, plp_median_filter_f32) */
+#define PLP_MEDIAN_FILTER_MAX_TAPS 25
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 16-bit integer median filter.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of input (and output) samples
+    @param[in]  numTaps    length of the window
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const int16_t *pSrc;
+    uint32_t blockSize;
+    uint32_t numTaps;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_median_filter_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit floating-point median filter.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of input (and output) samples
+    @param[in]  numTaps    length of the window
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const float32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t numTaps;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_median_filter_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 16-bit integer normalized cross-correlation.
+    @param[in]  pSrc       points to the input signal
+    @param[in]  srcLen     length of the input signal
+    @param[in]  pTmpl      points to the template
+    @param[in]  tmplLen    length of the template
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       points to the output vector
+*/
+typedef struct {
+    const int16_t *pSrc;
+    uint32_t srcLen;
+    const int16_t *pTmpl;
+    uint32_t tmplLen;
+    uint8_t nPE;
+    int16_t *pRes;
+} plp_ncc_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit floating-point normalized cross-correlation.
+    @param[in]  pSrc       points to the input signal
+    @param[in]  srcLen     length of the input signal
+    @param[in]  pTmpl      points to the template
+    @param[in]  tmplLen    length of the template
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       points to the output vector
+*/
+typedef struct {
+    const float32_t *pSrc;
+    uint32_t srcLen;
+    const float32_t *pTmpl;
+    uint32_t tmplLen;
+    uint8_t nPE;
+    float32_t *pRes;
+} plp_ncc_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
+*/
+
+void plp_correlate_i32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
+*/
+
+void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
+
+void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    result returned here
+  @return     none
+ */
+
+void plp_correlate_i16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_i8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+                      int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_valid_i8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel correlation of 32-bit integer vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here
+   @return     none
+*/
+void plp_correlate_i32_parallel(const int32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                uint8_t nPE,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_i32 struct initialized by
+                          plp_correlate_i32_parallel
+   @return     none
+*/
+void plp_correlate_i32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel correlation of 16-bit integer vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here
+   @return     none
+*/
+void plp_correlate_i16_parallel(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                uint8_t nPE,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_i16 struct initialized by
+                          plp_correlate_i16_parallel
+   @return     none
+*/
+void plp_correlate_i16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel correlation of 8-bit integer vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here
+   @return     none
+*/
+void plp_correlate_i8_parallel(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               uint8_t nPE,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_i8 struct initialized by
+                          plp_correlate_i8_parallel
+   @return     none
+*/
+void plp_correlate_i8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel correlation of 32-bit fixed point vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  fracBits Fixed point position of the result
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here
+   @return     none
+*/
+void plp_correlate_q32_parallel(const int32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint32_t fracBits,
+                                uint8_t nPE,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel correlation of 32-bit fixed point vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_q32 struct initialized by
+                          plp_correlate_q32_parallel
+   @return     none
+*/
+void plp_correlate_q32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel correlation of 16-bit fixed point vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  fracBits Fixed point position of the result
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here
+   @return     none
+*/
+void plp_correlate_q16_parallel(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint32_t fracBits,
+                                uint8_t nPE,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel correlation of 16-bit fixed point vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_q16 struct initialized by
+                          plp_correlate_q16_parallel
+   @return     none
+*/
+void plp_correlate_q16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel correlation of 8-bit fixed point vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  fracBits Fixed point position of the result
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here
+   @return     none
+*/
+void plp_correlate_q8_parallel(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               const uint32_t fracBits,
+                               uint8_t nPE,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel correlation of 8-bit fixed point vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_q8 struct initialized by
+                          plp_correlate_q8_parallel
+   @return     none
+*/
+void plp_correlate_q8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the autocorrelation of a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_q16(const int16_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t numLags,
+                      uint32_t fracBits,
+                      int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Autocorrelation of a 16-bit fixed point vector kernel for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t numLags,
+                              uint32_t fracBits,
+                              int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Autocorrelation of a 16-bit fixed point vector kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t numLags,
+                               uint32_t fracBits,
+                               int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the autocorrelation of a 32-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_q32(const int32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t numLags,
+                      uint32_t fracBits,
+                      int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Autocorrelation of a 32-bit fixed point vector kernel for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t numLags,
+                              uint32_t fracBits,
+                              int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Autocorrelation of a 32-bit fixed point vector kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t numLags,
+                               uint32_t fracBits,
+                               int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the autocorrelation of a 32-bit floating-point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_f32(const float32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t numLags,
+                      float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Autocorrelation of a 32-bit float vector kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+void plp_autocorr_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t numLags,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the Levinson-Durbin recursion of 32-bit fixed point values.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[in]  fracBits   number of fractional bits of the coefficients, 0 to 31
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy, in the format of pPhi
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+int plp_levinson_durbin_q32(const int64_t *__restrict__ pPhi,
+                            uint32_t order,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pA,
+                            int32_t *__restrict__ pRefl,
+                            int64_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+   @brief      Levinson-Durbin recursion of 32-bit fixed point values kernel for RV32IM extension.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[in]  fracBits   number of fractional bits of the coefficients, 0 to 31
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy, in the format of pPhi
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+int plp_levinson_durbin_q32s_rv32im(const int64_t *__restrict__ pPhi,
+                                    uint32_t order,
+                                    uint32_t fracBits,
+                                    int32_t *__restrict__ pA,
+                                    int32_t *__restrict__ pRefl,
+                                    int64_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+   @brief      Levinson-Durbin recursion of 32-bit fixed point values kernel for XPULPV2 extension.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[in]  fracBits   number of fractional bits of the coefficients, 0 to 31
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy, in the format of pPhi
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+int plp_levinson_durbin_q32s_xpulpv2(const int64_t *__restrict__ pPhi,
+                                     uint32_t order,
+                                     uint32_t fracBits,
+                                     int32_t *__restrict__ pA,
+                                     int32_t *__restrict__ pRefl,
+                                     int64_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the Levinson-Durbin recursion of 32-bit floating-point values.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+int plp_levinson_durbin_f32(const float32_t *__restrict__ pPhi,
+                            uint32_t order,
+                            float32_t *__restrict__ pA,
+                            float32_t *__restrict__ pRefl,
+                            float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+   @brief      Levinson-Durbin recursion of 32-bit floating-point values kernel for XPULPV2
+               extension.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+int plp_levinson_durbin_f32s_xpulpv2(const float32_t *__restrict__ pPhi,
+                                     uint32_t order,
+                                     float32_t *__restrict__ pA,
+                                     float32_t *__restrict__ pRefl,
+                                     float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the normalized cross-correlation of 16-bit integer vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients in Q15
+   @return     none
+*/
+void plp_ncc_i16(const int16_t *__restrict__ pSrc,
+                 uint32_t srcLen,
+                 const int16_t *__restrict__ pTmpl,
+                 uint32_t tmplLen,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel normalized cross-correlation of 16-bit integer vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients in Q15
+   @return     none
+*/
+void plp_ncc_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const int16_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          uint8_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Normalized cross-correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients in Q15
+   @return     none
+*/
+void plp_ncc_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t srcLen,
+                         const int16_t *__restrict__ pTmpl,
+                         uint32_t tmplLen,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Normalized cross-correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients in Q15
+   @return     none
+*/
+void plp_ncc_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const int16_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel normalized cross-correlation of 16-bit integer vectors kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_ncc_instance_i16 struct initialized by plp_ncc_i16_parallel
+   @return     none
+*/
+void plp_ncc_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the normalized cross-correlation of 32-bit floating-point vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients
+   @return     none
+*/
+void plp_ncc_f32(const float32_t *__restrict__ pSrc,
+                 uint32_t srcLen,
+                 const float32_t *__restrict__ pTmpl,
+                 uint32_t tmplLen,
+                 float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel normalized cross-correlation of 32-bit floating-point
+               vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients
+   @return     none
+*/
+void plp_ncc_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const float32_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          uint8_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Normalized cross-correlation of 32-bit floating-point vectors kernel for XPULPV2
+               extension.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients
+   @return     none
+*/
+void plp_ncc_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const float32_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Parallel normalized cross-correlation of 32-bit floating-point vectors kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_ncc_instance_f32 struct initialized by plp_ncc_f32_parallel
+   @return     none
+*/
+void plp_ncc_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 32-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[out] pRes     result returned here
+  @return     none
+ */
+
+void plp_conv_i32(const int32_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int32_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i32(const int32_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int32_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i32s_rv32im(const int32_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int32_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *__restrict__ pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
+
+void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                 const uint32_t srcALen,
+                                 const int32_t *__restrict__ pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
+
+void plp_conv_valid_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i16(const int16_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int16_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i16(const int16_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int16_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_rep_i16(const int16_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int16_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with replication) of a 16-bit integer vector with a
+         bank of filters, with the input streamed through L1 by the DMA (double buffered).
+  @param[in]  pSrcA      points to the input vector, must be on L2
+  @param[in]  srcALen    Length of the input vector
+  @param[in]  pSrcB      points to the filters, numFilters vectors of srcBLen elements each
+  @param[in]  srcBLen    Length of each filter, at least 2 and not larger than srcALen
+  @param[in]  numFilters Number of filters
+  @param[in]  blockSize  Number of outputs computed per segment of the input
+  @param[out] pRes       output result returned here, numFilters vectors of
+                         srcALen - srcBLen + 1 elements each
+  @return     none
+ */
+
+void plp_conv_valid_rep_bank_i16(const int16_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const int16_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 const uint32_t numFilters,
+                                 const uint32_t blockSize,
+                                 int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const int16_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
+
+void plp_conv_valid_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
+                                     const uint32_t srcALen,
+                                     const uint32_t srcAMem,
+                                     const int16_t *pSrcB,
+                                     const uint32_t srcBLen,
+                                     int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i16s_rv32im(const int16_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i8(const int8_t *pSrcA,
+                 const uint32_t srcALen,
+                 const int8_t *pSrcB,
+                 const uint32_t srcBLen,
+                 int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i8(const int8_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int8_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here (preferably in L1)
+  @return     none
+ */
+
+void plp_conv_valid_rep_i8(const int8_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int8_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with replication) of a 8-bit integer vector with a
+         bank of filters, with the input streamed through L1 by the DMA (double buffered).
+  @param[in]  pSrcA      points to the input vector, must be on L2
+  @param[in]  srcALen    Length of the input vector
+  @param[in]  pSrcB      points to the filters, numFilters vectors of srcBLen elements each
+  @param[in]  srcBLen    Length of each filter, at least 2 and not larger than srcALen
+  @param[in]  numFilters Number of filters
+  @param[in]  blockSize  Number of outputs computed per segment of the input
+  @param[out] pRes       output result returned here, numFilters vectors of
+                         srcALen - srcBLen + 1 elements each
+  @return     none
+ */
+
+void plp_conv_valid_rep_bank_i8(const int8_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int8_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint32_t numFilters,
+                                const uint32_t blockSize,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int8_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
+
+void plp_conv_valid_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *__restrict__ pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
+                                    const uint32_t srcALen,
+                                    const uint32_t srcAMem,
+                                    const int8_t *pSrcB,
+                                    const uint32_t srcBLen,
+                                    int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i8s_rv32im(const int8_t *pSrcA,
+                         const uint32_t srcALen,
+                         const int8_t *pSrcB,
+                         const uint32_t srcBLen,
+                         int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for 2D convolution of 16-bit integer images.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t srcH,
+                    uint32_t srcW,
+                    uint32_t strideSrc,
+                    const int16_t *__restrict__ pKernel,
+                    uint32_t kH,
+                    uint32_t kW,
+                    uint32_t padding,
+                    uint32_t strideDst,
+                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel 2D convolution of 16-bit integer images.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t srcH,
+                             uint32_t srcW,
+                             uint32_t strideSrc,
+                             const int16_t *__restrict__ pKernel,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t padding,
+                             uint32_t strideDst,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      2D convolution of 16-bit integer images kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t srcH,
+                            uint32_t srcW,
+                            uint32_t strideSrc,
+                            const int16_t *__restrict__ pKernel,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t padding,
+                            uint32_t strideDst,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      2D convolution of 16-bit integer images kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t srcH,
+                             uint32_t srcW,
+                             uint32_t strideSrc,
+                             const int16_t *__restrict__ pKernel,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t padding,
+                             uint32_t strideDst,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 2D convolution of 16-bit integer images kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv2d_instance_i16 struct initialized by
+                          plp_conv2d_i16_parallel
+   @return     none
+*/
+
+void plp_conv2d_i16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for 2D convolution of 8-bit integer images.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t srcH,
+                   uint32_t srcW,
+                   uint32_t strideSrc,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t kH,
+                   uint32_t kW,
+                   uint32_t padding,
+                   uint32_t strideDst,
+                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel 2D convolution of 8-bit integer images.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t srcH,
+                            uint32_t srcW,
+                            uint32_t strideSrc,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t padding,
+                            uint32_t strideDst,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      2D convolution of 8-bit integer images kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t srcH,
+                           uint32_t srcW,
+                           uint32_t strideSrc,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kH,
+                           uint32_t kW,
+                           uint32_t padding,
+                           uint32_t strideDst,
+                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      2D convolution of 8-bit integer images kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t srcH,
+                            uint32_t srcW,
+                            uint32_t strideSrc,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t padding,
+                            uint32_t strideDst,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 2D convolution of 8-bit integer images kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv2d_instance_i8 struct initialized by
+                          plp_conv2d_i8_parallel
+   @return     none
+*/
+
+void plp_conv2d_i8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit integer Winograd convolution instance.
+   @param[out] S         points to an instance of the Winograd convolution structure
+   @param[in]  pKernel   points to the filter kernel of size kH x 3 (dense), which must stay
+                         valid while the instance is used
+   @param[in]  kH        height of the filter kernel, 1 (3 taps) or 3 (3x3)
+   @param[out] pCoeffs   points to the transformed filter kernel, 4 (kH = 1) or 16 (kH = 3) values
+   @return     none
+*/
+
+void plp_conv_winograd_init_i16(plp_conv_winograd_instance_i16 *S,
+                                const int16_t *pKernel,
+                                uint32_t kH,
+                                int32_t *pCoeffs);
+
+/** -------------------------------------------------------
+   @brief      Glue code for valid 2D convolution of 16-bit integer images with a 3-tap or 3x3
+               filter kernel with the Winograd algorithm.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_i16
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_i16(const plp_conv_winograd_instance_i16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t srcH,
+                                 uint32_t srcW,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel valid 2D convolution of 16-bit integer images with a
+               3-tap or 3x3 filter kernel with the Winograd algorithm.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_i16
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_i16_parallel(const plp_conv_winograd_instance_i16 *S,
+                                          const int16_t *__restrict__ pSrc,
+                                          uint32_t srcH,
+                                          uint32_t srcW,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Valid 2D convolution of 16-bit integer images with the Winograd algorithm kernel
+               for RV32IM extension.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_i16
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_i16s_rv32im(const plp_conv_winograd_instance_i16 *S,
+                                         const int16_t *__restrict__ pSrc,
+                                         uint32_t srcH,
+                                         uint32_t srcW,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Valid 2D convolution of 16-bit integer images with the Winograd algorithm kernel
+               for XPULPV2 extension.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_i16
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_i16s_xpulpv2(const plp_conv_winograd_instance_i16 *S,
+                                          const int16_t *__restrict__ pSrc,
+                                          uint32_t srcH,
+                                          uint32_t srcW,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel valid 2D convolution of 16-bit integer images with the Winograd
+               algorithm kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv_valid_winograd_parallel_instance_i16 struct
+                          initialized by plp_conv_valid_winograd_i16_parallel
+   @return     none
+*/
+
+void plp_conv_valid_winograd_i16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point Winograd convolution instance.
+   @param[out] S         points to an instance of the Winograd convolution structure
+   @param[in]  pKernel   points to the filter kernel of size kH x 3 (dense), which must stay
+                         valid while the instance is used
+   @param[in]  kH        height of the filter kernel, 1 (3 taps) or 3 (3x3)
+   @param[out] pCoeffs   points to the transformed filter kernel, 4 (kH = 1) or 16 (kH = 3) values
+   @return     none
+*/
+
+void plp_conv_winograd_init_f32(plp_conv_winograd_instance_f32 *S,
+                                const float32_t *pKernel,
+                                uint32_t kH,
+                                float32_t *pCoeffs);
+
+/** -------------------------------------------------------
+   @brief      Glue code for valid 2D convolution of 32-bit floating-point images with a 3-tap or 3x3
+               filter kernel with the Winograd algorithm.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_f32
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_f32(const plp_conv_winograd_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 uint32_t srcH,
+                                 uint32_t srcW,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel valid 2D convolution of 32-bit floating-point images with a
+               3-tap or 3x3 filter kernel with the Winograd algorithm.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_f32
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_f32_parallel(const plp_conv_winograd_instance_f32 *S,
+                                          const float32_t *__restrict__ pSrc,
+                                          uint32_t srcH,
+                                          uint32_t srcW,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          uint32_t nPE,
+                                          float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Valid 2D convolution of 32-bit floating-point images with the Winograd algorithm kernel
+               for XPULPV2 extension.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_f32
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_f32s_xpulpv2(const plp_conv_winograd_instance_f32 *S,
+                                          const float32_t *__restrict__ pSrc,
+                                          uint32_t srcH,
+                                          uint32_t srcW,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel valid 2D convolution of 32-bit floating-point images with the Winograd
+               algorithm kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv_valid_winograd_parallel_instance_f32 struct
+                          initialized by plp_conv_valid_winograd_f32_parallel
+   @return     none
+*/
+
+void plp_conv_valid_winograd_f32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i32_parallel(const int32_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *pSrcB,
+                           const uint32_t srcBLen,
+                           uint8_t nPE,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 32-bit integer vectors.
+  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
+                             plp_conv_i32_parallel
+  @return     none
+ */
+
+void plp_conv_i32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i16_parallel(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           uint8_t nPE,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 16-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
+                         plp_conv_i16_parallel
+  @return     none
+ */
+
+void plp_conv_i16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i8_parallel(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          uint8_t nPE,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 8-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
+                         plp_conv_i8_parallel
+  @return     none
+ */
+
+void plp_conv_i8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] nPE Number of processing cores
+   @param[in] srcALen Length of the first original input vector
+   @param[in] srcBLen Length of the second original input vector
+   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
+   @return none
+*/
+
+void plp_conv_parallel_OLA(uint32_t nPE,
+                           uint32_t srcALen,
+                           uint32_t srcBLen,
+                           int32_t *resultsBuffer);
+
+/** -------------------------------------------------------
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
+   @return none
+*/
+void plp_conv_parallel_OLA_kernel(void *task_args);
+
+/** -------------------------------------------------------
+   @brief Range of output samples of the convolution, which is computed by one core.
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  srcBLen  Length of the shorter input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[in]  coreId   Id of the core
+   @param[out] pStart   First output sample of the core
+   @param[out] pEnd     One after the last output sample of the core
+   @return     none
+*/
+
+void plp_conv_parallel_range(uint32_t srcALen,
+                             uint32_t srcBLen,
+                             uint32_t nPE,
+                             uint32_t coreId,
+                             uint32_t *pStart,
+                             uint32_t *pEnd);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the convolution of 16-bit fixed point vectors, which uses the FFT for
+               long vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  fracBits Fixed point position of the result, the result is shifted right by fracBits
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     0: Success, 1: Not enough memory for the FFT buffers
+*/
+
+int plp_conv_fft_q16(const int16_t *pSrcA,
+                     uint32_t srcALen,
+                     const int16_t *pSrcB,
+                     uint32_t srcBLen,
+                     uint32_t fracBits,
+                     int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the convolution of 32-bit floating-point vectors, which uses the FFT
+               for long vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     0: Success, 1: Not enough memory for the FFT buffers, 2: operation not supported
+*/
+
+int plp_conv_fft_f32(const float32_t *pSrcA,
+                     uint32_t srcALen,
+                     const float32_t *pSrcB,
+                     uint32_t srcBLen,
+                     float32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Overlap-add convolution of 16-bit fixed point vectors with the 16-bit fixed point
+               CFFT.
+   @param[in]  pSrcA    points to the longer input vector
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  pSrcB    points to the shorter input vector (the filter kernel)
+   @param[in]  srcBLen  Length of the shorter input vector, at most fftLen / 2
+   @param[in]  fracBits Fixed point position of the result, the result is shifted right by fracBits
+   @param[in]  fftLen   FFT length, power of two between 16 and 4096
+   @param[in]  pScratch points to a scratch buffer of 4 * fftLen elements
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+*/
+
+void plp_conv_fft_OLA_q16(const int16_t *pSrcA,
+                          uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          uint32_t srcBLen,
+                          uint32_t fracBits,
+                          uint32_t fftLen,
+                          int16_t *pScratch,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Overlap-add convolution of 32-bit floating-point vectors with the real FFT.
+   @param[in]  pSrcA    points to the longer input vector
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  pSrcB    points to the shorter input vector (the filter kernel)
+   @param[in]  srcBLen  Length of the shorter input vector, at most fftLen / 2
+   @param[in]  fftLen   FFT length, power of two between 16 and 2048
+   @param[in]  pScratch points to a scratch buffer of 6 * fftLen elements
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+*/
+
+void plp_conv_fft_OLA_f32(const float32_t *pSrcA,
+                          uint32_t srcALen,
+                          const float32_t *pSrcB,
+                          uint32_t srcBLen,
+                          uint32_t fftLen,
+                          float32_t *pScratch,
+                          float32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Convolution of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+*/
+
+void plp_conv_f32s_xpulpv2(const float32_t *pSrcA,
+                           uint32_t srcALen,
+                           const float32_t *pSrcB,
+                           uint32_t srcBLen,
+                           float32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit fixed point FIR filter instance.
+   @param[out] S         points to an instance of the 32-bit fixed point FIR filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_init_q32(plp_fir_instance_q32 *S,
+                      uint32_t numTaps,
+                      const int32_t *pCoeffs,
+                      int32_t *pState,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q32(const plp_fir_instance_q32 *S,
+                 const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point FIR filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q32s_rv32im(const plp_fir_instance_q32 *S,
+                         const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point FIR filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q32s_xpulpv2(const plp_fir_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel 32-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q32_parallel(const plp_fir_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 32-bit fixed point FIR filter kernel for XPULPV2 extension.
+   @param[in]  task_args points to the plp_fir_parallel_instance_q32 struct initialized by
+                         plp_fir_q32_parallel
+   @return     none
+*/
+
+void plp_fir_q32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point FIR filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point FIR filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_init_q16(plp_fir_instance_q16 *S,
+                      uint32_t numTaps,
+                      const int16_t *pCoeffs,
+                      int16_t *pState,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q16(const plp_fir_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point FIR filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q16s_rv32im(const plp_fir_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point FIR filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q16s_xpulpv2(const plp_fir_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel 16-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q16_parallel(const plp_fir_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 16-bit fixed point FIR filter kernel for XPULPV2 extension.
+   @param[in]  task_args points to the plp_fir_parallel_instance_q16 struct initialized by
+                         plp_fir_q16_parallel
+   @return     none
+*/
+
+void plp_fir_q16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 8-bit fixed point FIR filter instance.
+   @param[out] S         points to an instance of the 8-bit fixed point FIR filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_init_q8(plp_fir_instance_q8 *S,
+                     uint32_t numTaps,
+                     const int8_t *pCoeffs,
+                     int8_t *pState,
+                     uint32_t blockSize,
+                     uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 8-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 8-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q8(const plp_fir_instance_q8 *S,
+                const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      8-bit fixed point FIR filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 8-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q8s_rv32im(const plp_fir_instance_q8 *S,
+                        const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      8-bit fixed point FIR filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 8-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q8s_xpulpv2(const plp_fir_instance_q8 *S,
+                         const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel 8-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 8-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q8_parallel(const plp_fir_instance_q8 *S,
+                         const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 8-bit fixed point FIR filter kernel for XPULPV2 extension.
+   @param[in]  task_args points to the plp_fir_parallel_instance_q8 struct initialized by
+                         plp_fir_q8_parallel
+   @return     none
+*/
+
+void plp_fir_q8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point FIR filter instance.
+   @param[out] S         points to an instance of the 32-bit floating-point FIR filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @return     none
+*/
+
+void plp_fir_init_f32(plp_fir_instance_f32 *S,
+                      uint32_t numTaps,
+                      const float *pCoeffs,
+                      float *pState,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point FIR filter.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_f32(const plp_fir_instance_f32 *S,
+                 const float *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point FIR filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_f32s_xpulpv2(const plp_fir_instance_f32 *S,
+                          const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel 32-bit floating-point FIR filter.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_f32_parallel(const plp_fir_instance_f32 *S,
+                          const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 32-bit floating-point FIR filter kernel for XPULPV2 extension.
+   @param[in]  task_args points to the plp_fir_parallel_instance_f32 struct initialized by
+                         plp_fir_f32_parallel
+   @return     none
+*/
+
+void plp_fir_f32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit fixed point biquad cascade IIR filter (direct form I)
+               instance.
+   @param[out] S         points to an instance of the 32-bit fixed point biquad cascade structure
+   @param[in]  numStages Number of second order stages
+   @param[in]  pCoeffs   points to the filter coefficients, 5 * numStages values
+   @param[in]  pState    points to the state buffer, 4 * numStages values
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_init_q32(plp_biquad_cascade_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit fixed point biquad cascade IIR filter (direct form I).
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q32(const plp_biquad_cascade_df1_instance_q32 *S,
+                                const int32_t *pSrc,
+                                uint32_t blockSize,
+                                int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point biquad cascade IIR filter (direct form I) kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q32s_rv32im(const plp_biquad_cascade_df1_instance_q32 *S,
+                                        const int32_t *pSrc,
+                                        uint32_t blockSize,
+                                        int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point biquad cascade IIR filter (direct form I) kernel for XPULPV2
+               extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q32s_xpulpv2(const plp_biquad_cascade_df1_instance_q32 *S,
+                                         const int32_t *pSrc,
+                                         uint32_t blockSize,
+                                         int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 32-bit fixed point biquad cascade IIR filter
+               (direct form I).
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of samples to process per channel
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the output samples, channel c starts at pDst + c * blockSize
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q32_parallel(const plp_biquad_cascade_df1_instance_q32 *S,
+                                         uint32_t numChannels,
+                                         const int32_t *pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t nPE,
+                                         int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel multi-channel 32-bit fixed point biquad cascade IIR filter kernel for
+               XPULPV2 extension.
+   @param[in]  task_args points to the plp_biquad_cascade_df1_parallel_instance_q32 struct
+                         initialized
+               by plp_biquad_cascade_df1_q32_parallel
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point biquad cascade IIR filter (direct form I)
+               instance.
+   @param[out] S         points to an instance of the 16-bit fixed point biquad cascade structure
+   @param[in]  numStages Number of second order stages
+   @param[in]  pCoeffs   points to the filter coefficients, 5 * numStages values
+   @param[in]  pState    points to the state buffer, 4 * numStages values
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_init_q16(plp_biquad_cascade_df1_instance_q16 *S,
+                                     uint32_t numStages,
+                                     const int16_t *pCoeffs,
+                                     int16_t *pState,
+                                     uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point biquad cascade IIR filter (direct form I).
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q16(const plp_biquad_cascade_df1_instance_q16 *S,
+                                const int16_t *pSrc,
+                                uint32_t blockSize,
+                                int16_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point biquad cascade IIR filter (direct form I) kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q16s_rv32im(const plp_biquad_cascade_df1_instance_q16 *S,
+                                        const int16_t *pSrc,
+                                        uint32_t blockSize,
+                                        int16_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point biquad cascade IIR filter (direct form I) kernel for XPULPV2
+               extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q16s_xpulpv2(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         int16_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 16-bit fixed point biquad cascade IIR filter
+               (direct form I).
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of samples to process per channel
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the output samples, channel c starts at pDst + c * blockSize
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q16_parallel(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         uint32_t numChannels,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t nPE,
+                                         int16_t *pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel multi-channel 16-bit fixed point biquad cascade IIR filter kernel for
+               XPULPV2 extension.
+   @param[in]  task_args points to the plp_biquad_cascade_df1_parallel_instance_q16 struct
+                         initialized
+               by plp_biquad_cascade_df1_q16_parallel
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point biquad cascade IIR filter (transposed
+               direct form II) instance.
+   @param[out] S         points to an instance of the 32-bit floating-point biquad cascade structure
+   @param[in]  numStages Number of second order stages
+   @param[in]  pCoeffs   points to the filter coefficients, 5 * numStages values
+   @param[in]  pState    points to the state buffer, 2 * numStages values
+   @return     none
+*/
+
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_cascade_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float *pCoeffs,
+                                      float *pState);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point biquad cascade IIR filter (transposed direct
+               form II).
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point biquad
+                         cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df2T_f32(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                 const float *pSrc,
+                                 uint32_t blockSize,
+                                 float *pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point biquad cascade IIR filter (transposed direct form II) kernel
+               for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point biquad
+                         cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df2T_f32s_xpulpv2(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          const float *pSrc,
+                                          uint32_t blockSize,
+                                          float *pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 32-bit floating-point biquad cascade IIR
+               filter (transposed direct form II).
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of samples to process per channel
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the output samples, channel c starts at pDst + c * blockSize
+   @return     none
+*/
+
+void plp_biquad_cascade_df2T_f32_parallel(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          uint32_t numChannels,
+                                          const float *pSrc,
+                                          uint32_t blockSize,
+                                          uint32_t nPE,
+                                          float *pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel multi-channel 32-bit floating-point biquad cascade IIR filter kernel for
+               XPULPV2 extension.
+   @param[in]  task_args points to the plp_biquad_cascade_df2T_parallel_instance_f32 struct
+                         initialized
+               by plp_biquad_cascade_df2T_f32_parallel
+   @return     none
+*/
+
+void plp_biquad_cascade_df2T_f32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit fixed point FIR decimator instance.
+   @param[out] S         points to an instance of the 32-bit fixed point FIR decimator structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  M         Decimation factor
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call, a multiple
+                         of M
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_decimate_init_q32(plp_fir_decimate_instance_q32 *S,
+                               uint32_t numTaps,
+                               uint32_t M,
+                               const int32_t *pCoeffs,
+                               int32_t *pState,
+                               uint32_t blockSize,
+                               uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit fixed point FIR decimator.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M and at most the
+                         blockSize passed to the init
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q32(const plp_fir_decimate_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point FIR decimator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q32s_rv32im(const plp_fir_decimate_instance_q32 *S,
+                                  const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point FIR decimator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q32s_xpulpv2(const plp_fir_decimate_instance_q32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point FIR decimator instance.
+   @param[out] S         points to an instance of the 16-bit fixed point FIR decimator structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  M         Decimation factor
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call, a multiple
+                         of M
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_decimate_init_q16(plp_fir_decimate_instance_q16 *S,
+                               uint32_t numTaps,
+                               uint32_t M,
+                               const int16_t *pCoeffs,
+                               int16_t *pState,
+                               uint32_t blockSize,
+                               uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point FIR decimator.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M and at most the
+                         blockSize passed to the init
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q16(const plp_fir_decimate_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point FIR decimator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q16s_rv32im(const plp_fir_decimate_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point FIR decimator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q16s_xpulpv2(const plp_fir_decimate_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point FIR decimator instance.
+   @param[out] S         points to an instance of the 32-bit floating-point FIR decimator structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  M         Decimation factor
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call, a multiple
+                         of M
+   @return     none
+*/
+
+void plp_fir_decimate_init_f32(plp_fir_decimate_instance_f32 *S,
+                               uint32_t numTaps,
+                               uint32_t M,
+                               const float *pCoeffs,
+                               float *pState,
+                               uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point FIR decimator.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR
+                         decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M and at most the
+                         blockSize passed to the init
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_f32(const plp_fir_decimate_instance_f32 *S,
+                          const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point FIR decimator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR
+                         decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_f32s_xpulpv2(const plp_fir_decimate_instance_f32 *S,
+                                   const float *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit fixed point FIR interpolator instance.
+   @param[out] S         points to an instance of the 32-bit fixed point FIR interpolator structure
+   @param[in]  L         Interpolation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                  uint32_t L,
+                                  uint32_t numTaps,
+                                  const int32_t *pCoeffs,
+                                  int32_t *pState,
+                                  uint32_t blockSize,
+                                  uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit fixed point FIR interpolator.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q32(const plp_fir_interpolate_instance_q32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point FIR interpolator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q32s_rv32im(const plp_fir_interpolate_instance_q32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point FIR interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q32s_xpulpv2(const plp_fir_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point FIR interpolator instance.
+   @param[out] S         points to an instance of the 16-bit fixed point FIR interpolator structure
+   @param[in]  L         Interpolation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_fir_interpolate_init_q16(plp_fir_interpolate_instance_q16 *S,
+                                  uint32_t L,
+                                  uint32_t numTaps,
+                                  const int16_t *pCoeffs,
+                                  int16_t *pState,
+                                  uint32_t blockSize,
+                                  uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point FIR interpolator.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q16(const plp_fir_interpolate_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point FIR interpolator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q16s_rv32im(const plp_fir_interpolate_instance_q16 *S,
+                                     const int16_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point FIR interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q16s_xpulpv2(const plp_fir_interpolate_instance_q16 *S,
+                                      const int16_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point FIR interpolator instance.
+   @param[out] S         points to an instance of the 32-bit floating-point FIR interpolator
+                         structure
+   @param[in]  L         Interpolation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @return     none
+*/
+
+void plp_fir_interpolate_init_f32(plp_fir_interpolate_instance_f32 *S,
+                                  uint32_t L,
+                                  uint32_t numTaps,
+                                  const float *pCoeffs,
+                                  float *pState,
+                                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point FIR interpolator.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_f32(const plp_fir_interpolate_instance_f32 *S,
+                             const float *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point FIR interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_f32s_xpulpv2(const plp_fir_interpolate_instance_f32 *S,
+                                      const float *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point resampler instance.
+   @param[out] S         points to an instance of the 16-bit fixed point resampler structure
+   @param[in]  L         Interpolation factor
+   @param[in]  M         Decimation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[out] pBank     points to the coefficient bank of size numTaps, which is filled with the
+                         L phases of the filter
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_resample_init_q16(plp_resample_instance_q16 *S,
+                           uint32_t L,
+                           uint32_t M,
+                           uint32_t numTaps,
+                           const int16_t *pCoeffs,
+                           int16_t *pBank,
+                           int16_t *pState,
+                           uint32_t blockSize,
+                           uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point polyphase resampler.
+   @param[in,out] S      points to an initialized instance of the 16-bit fixed point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_q16(plp_resample_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point polyphase resampler kernel for RV32IM.
+   @param[in,out] S      points to an initialized instance of the 16-bit fixed point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_q16s_rv32im(plp_resample_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point polyphase resampler kernel for XPULPV2 extension.
+   @param[in,out] S      points to an initialized instance of the 16-bit fixed point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_q16s_xpulpv2(plp_resample_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point resampler instance.
+   @param[out] S         points to an instance of the 32-bit floating-point resampler structure
+   @param[in]  L         Interpolation factor
+   @param[in]  M         Decimation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[out] pBank     points to the coefficient bank of size numTaps, which is filled with the
+                         L phases of the filter
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @return     none
+*/
+
+void plp_resample_init_f32(plp_resample_instance_f32 *S,
+                           uint32_t L,
+                           uint32_t M,
+                           uint32_t numTaps,
+                           const float *pCoeffs,
+                           float *pBank,
+                           float *pState,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point polyphase resampler.
+   @param[in,out] S      points to an initialized instance of the 32-bit floating-point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_f32(plp_resample_instance_f32 *S,
+                          const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point polyphase resampler kernel for XPULPV2 extension.
+   @param[in,out] S      points to an initialized instance of the 32-bit floating-point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_f32s_xpulpv2(plp_resample_instance_f32 *S,
+                                   const float *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point Hilbert FIR filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point Hilbert FIR filter
+                         structure
+   @param[in]  numTaps   Length of the filter, including the zero coefficients, numTaps = 3 (mod 4)
+   @param[in]  pCoeffs   points to the (numTaps + 1) / 2 nonzero filter coefficients, in
+                         time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of samples that are processed per call, even
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+*/
+
+void plp_hilbert_fir_init_q16(plp_hilbert_fir_instance_q16 *S,
+                              uint32_t numTaps,
+                              const int16_t *pCoeffs,
+                              int16_t *pState,
+                              uint32_t blockSize,
+                              uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point Hilbert FIR filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point Hilbert FIR
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process, even and at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_hilbert_fir_q16(const plp_hilbert_fir_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point Hilbert FIR filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point Hilbert FIR
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process, even
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_hilbert_fir_q16s_rv32im(const plp_hilbert_fir_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point Hilbert FIR filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point Hilbert FIR
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process, even
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_hilbert_fir_q16s_xpulpv2(const plp_hilbert_fir_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point NCO mixer instance.
+   @param[out] S         points to an instance of the 16-bit fixed point NCO mixer structure
+   @param[in]  phaseInc  Phase increment per sample, round(f / fs * 2^32)
+   @param[in]  phase     Initial phase, where 2^32 corresponds to 2 * pi
+   @return     none
+*/
+
+void plp_nco_init_q16(plp_nco_instance_q16 *S,
+                      uint32_t phaseInc,
+                      uint32_t phase);
+
+/** -------------------------------------------------------
+   @brief         Glue code for the 16-bit fixed point NCO mixer.
+   @param[in,out] S         points to an initialized instance of the 16-bit fixed point NCO mixer
+   @param[in]     pSrc      points to the block of input samples
+   @param[in]     blockSize Number of samples to process
+   @param[out]    pDstI     points to the block of in-phase output samples
+   @param[out]    pDstQ     points to the block of quadrature output samples
+   @return        none
+*/
+
+void plp_nco_mix_q16(plp_nco_instance_q16 *S,
+                     const int16_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int16_t *__restrict__ pDstI,
+                     int16_t *__restrict__ pDstQ);
+
+/** -------------------------------------------------------
+   @brief         16-bit fixed point NCO mixer kernel for RV32IM.
+   @param[in,out] S         points to an initialized instance of the 16-bit fixed point NCO mixer
+   @param[in]     pSrc      points to the block of input samples
+   @param[in]     blockSize Number of samples to process
+   @param[out]    pDstI     points to the block of in-phase output samples
+   @param[out]    pDstQ     points to the block of quadrature output samples
+   @return        none
+*/
+
+void plp_nco_mix_q16s_rv32im(plp_nco_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDstI,
+                             int16_t *__restrict__ pDstQ);
+
+/** -------------------------------------------------------
+   @brief         16-bit fixed point NCO mixer kernel for XPULPV2 extension.
+   @param[in,out] S         points to an initialized instance of the 16-bit fixed point NCO mixer
+   @param[in]     pSrc      points to the block of input samples
+   @param[in]     blockSize Number of samples to process
+   @param[out]    pDstI     points to the block of in-phase output samples
+   @param[out]    pDstQ     points to the block of quadrature output samples
+   @return        none
+*/
+
+void plp_nco_mix_q16s_xpulpv2(plp_nco_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pDstI,
+                              int16_t *__restrict__ pDstQ);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point digital down-converter instance.
+   @param[out] S      points to an instance of the 16-bit fixed point DDC structure
+   @param[in]  pNco   points to an initialized NCO mixer, which is advanced by every call
+   @param[in]  pDecI  points to an initialized FIR decimator of the in-phase component
+   @param[in]  pDecQ  points to an initialized FIR decimator of the quadrature component, with the
+                      same decimation factor as pDecI
+   @return     none
+*/
+
+void plp_ddc_init_q16(plp_ddc_instance_q16 *S,
+                      plp_nco_instance_q16 *pNco,
+                      const plp_fir_decimate_instance_q16 *pDecI,
+                      const plp_fir_decimate_instance_q16 *pDecQ);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point digital down-converter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point DDC
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor M
+                         and at most the blockSize passed to the init of the decimators
+   @param[in]  pScratch  points to a scratch buffer of 2 * blockSize samples
+   @param[out] pDstI     points to the block of blockSize / M in-phase output samples
+   @param[out] pDstQ     points to the block of blockSize / M quadrature output samples
+   @return     none
+*/
+
+void plp_ddc_q16(const plp_ddc_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pScratch,
+                 int16_t *__restrict__ pDstI,
+                 int16_t *__restrict__ pDstQ);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit integer CIC decimator instance.
+   @param[out] S      points to an instance of the 32-bit integer CIC decimator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  M      Decimation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @param[in]  shift  Right shift of the output samples
+   @return     none
+*/
+
+void plp_cic_decimate_init_i32(plp_cic_decimate_instance_i32 *S,
+                               uint32_t order,
+                               uint32_t M,
+                               int32_t *pState,
+                               uint32_t shift);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit integer CIC decimator.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_i32(const plp_cic_decimate_instance_i32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit integer CIC decimator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_i32s_rv32im(const plp_cic_decimate_instance_i32 *S,
+                                  const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit integer CIC decimator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_i32s_xpulpv2(const plp_cic_decimate_instance_i32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 32-bit integer CIC decimator.
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel,
+                           all with the same factor M
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of input samples to process per channel, a multiple of M
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the outputs, channel c starts at pDst + c * blockSize / M
+   @return     none
+*/
+
+void plp_cic_decimate_i32_parallel(const plp_cic_decimate_instance_i32 *S,
+                                   uint32_t numChannels,
+                                   const int32_t *pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief     Parallel multi-channel 32-bit integer CIC decimator kernel for XPULPV2 extension.
+   @param[in] task_args points to the plp_cic_decimate_parallel_instance_i32 struct initialized by
+                        plp_cic_decimate_i32_parallel
+   @return    none
+*/
+
+void plp_cic_decimate_i32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit fixed point CIC decimator instance.
+   @param[out] S      points to an instance of the 32-bit fixed point CIC decimator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  M      Decimation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @return     none
+*/
+
+void plp_cic_decimate_init_q32(plp_cic_decimate_instance_q32 *S,
+                               uint32_t order,
+                               uint32_t M,
+                               int64_t *pState);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit fixed point CIC decimator.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_q32(const plp_cic_decimate_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point CIC decimator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_q32s_rv32im(const plp_cic_decimate_instance_q32 *S,
+                                  const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point CIC decimator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_q32s_xpulpv2(const plp_cic_decimate_instance_q32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 32-bit fixed point CIC decimator.
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel,
+                           all with the same factor M
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of input samples to process per channel, a multiple of M
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the outputs, channel c starts at pDst + c * blockSize / M
+   @return     none
+*/
+
+void plp_cic_decimate_q32_parallel(const plp_cic_decimate_instance_q32 *S,
+                                   uint32_t numChannels,
+                                   const int32_t *pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief     Parallel multi-channel 32-bit fixed point CIC decimator kernel for XPULPV2 extension.
+   @param[in] task_args points to the plp_cic_decimate_parallel_instance_q32 struct initialized by
+                        plp_cic_decimate_q32_parallel
+   @return    none
+*/
+
+void plp_cic_decimate_q32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit integer CIC interpolator instance.
+   @param[out] S      points to an instance of the 32-bit integer CIC interpolator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  L      Interpolation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @param[in]  shift  Right shift of the output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_init_i32(plp_cic_interpolate_instance_i32 *S,
+                                  uint32_t order,
+                                  uint32_t L,
+                                  int32_t *pState,
+                                  uint32_t shift);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit integer CIC interpolator.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_i32(const plp_cic_interpolate_instance_i32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit integer CIC interpolator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_i32s_rv32im(const plp_cic_interpolate_instance_i32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit integer CIC interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_i32s_xpulpv2(const plp_cic_interpolate_instance_i32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 32-bit integer CIC interpolator.
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel,
+                           all with the same factor L
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of input samples to process per channel
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the outputs, channel c starts at pDst + c * blockSize * L
+   @return     none
+*/
+
+void plp_cic_interpolate_i32_parallel(const plp_cic_interpolate_instance_i32 *S,
+                                      uint32_t numChannels,
+                                      const int32_t *pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief     Parallel multi-channel 32-bit integer CIC interpolator kernel for XPULPV2 extension.
+   @param[in] task_args points to the plp_cic_interpolate_parallel_instance_i32 struct initialized
+                        by plp_cic_interpolate_i32_parallel
+   @return    none
+*/
+
+void plp_cic_interpolate_i32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit fixed point CIC interpolator instance.
+   @param[out] S      points to an instance of the 32-bit fixed point CIC interpolator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  L      Interpolation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @return     none
+*/
+
+void plp_cic_interpolate_init_q32(plp_cic_interpolate_instance_q32 *S,
+                                  uint32_t order,
+                                  uint32_t L,
+                                  int64_t *pState);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit fixed point CIC interpolator.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point CIC
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_q32(const plp_cic_interpolate_instance_q32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point CIC interpolator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point CIC
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_q32s_rv32im(const plp_cic_interpolate_instance_q32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit fixed point CIC interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point CIC
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_q32s_xpulpv2(const plp_cic_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel multi-channel 32-bit fixed point CIC interpolator.
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel,
+                           all with the same factor L
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of input samples to process per channel
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the outputs, channel c starts at pDst + c * blockSize * L
+   @return     none
+*/
+
+void plp_cic_interpolate_q32_parallel(const plp_cic_interpolate_instance_q32 *S,
+                                      uint32_t numChannels,
+                                      const int32_t *pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      int32_t *pDst);
+
+/** -------------------------------------------------------
+   @brief     Parallel multi-channel 32-bit fixed point CIC interpolator kernel for XPULPV2
+              extension.
+   @param[in] task_args points to the plp_cic_interpolate_parallel_instance_q32 struct initialized
+                        by plp_cic_interpolate_q32_parallel
+   @return    none
+*/
+
+void plp_cic_interpolate_q32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point LMS filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point LMS filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the initial filter coefficients, in time-reversed order. The
+                         coefficients are adapted in place.
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  mu        Step size of the coefficient update, with fracBits fractional bits
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients, inputs and mu
+   @return     none
+*/
+
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint32_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point LMS filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples, pRef - pOut
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @return     none
+*/
+
+void plp_lms_q16(const plp_lms_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 const int16_t *__restrict__ pRef,
+                 int16_t *__restrict__ pOut,
+                 int16_t *__restrict__ pErr,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point LMS filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_q16s_rv32im(const plp_lms_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         const int16_t *__restrict__ pRef,
+                         int16_t *__restrict__ pOut,
+                         int16_t *__restrict__ pErr,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point LMS filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_q16s_xpulpv2(const plp_lms_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          const int16_t *__restrict__ pRef,
+                          int16_t *__restrict__ pOut,
+                          int16_t *__restrict__ pErr,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point LMS filter instance.
+   @param[out] S         points to an instance of the 32-bit floating-point LMS filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the initial filter coefficients, in time-reversed order. The
+                         coefficients are adapted in place.
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  mu        Step size of the coefficient update
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @return     none
+*/
+
+void plp_lms_init_f32(plp_lms_instance_f32 *S,
+                      uint32_t numTaps,
+                      float32_t *pCoeffs,
+                      float32_t *pState,
+                      float32_t mu,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point LMS filter.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples, pRef - pOut
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @return     none
+*/
+
+void plp_lms_f32(const plp_lms_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 const float32_t *__restrict__ pRef,
+                 float32_t *__restrict__ pOut,
+                 float32_t *__restrict__ pErr,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point LMS filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_f32s_xpulpv2(const plp_lms_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          const float32_t *__restrict__ pRef,
+                          float32_t *__restrict__ pOut,
+                          float32_t *__restrict__ pErr,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit fixed point normalized LMS filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point normalized LMS filter
+                         structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the initial filter coefficients, in time-reversed order. The
+                         coefficients are adapted in place.
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  mu        Step size of the coefficient update, with fracBits fractional bits
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients, inputs and mu
+   @return     none
+*/
+
+void plp_lms_norm_init_q16(plp_lms_norm_instance_q16 *S,
+                           uint32_t numTaps,
+                           int16_t *pCoeffs,
+                           int16_t *pState,
+                           int16_t mu,
+                           uint32_t blockSize,
+                           uint32_t fracBits);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit fixed point normalized LMS filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point normalized LMS
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples, pRef - pOut
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @return     none
+*/
+
+void plp_lms_norm_q16(const plp_lms_norm_instance_q16 *S,
+                      const int16_t *__restrict__ pSrc,
+                      const int16_t *__restrict__ pRef,
+                      int16_t *__restrict__ pOut,
+                      int16_t *__restrict__ pErr,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point normalized LMS filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point normalized LMS
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_norm_q16s_rv32im(const plp_lms_norm_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              const int16_t *__restrict__ pRef,
+                              int16_t *__restrict__ pOut,
+                              int16_t *__restrict__ pErr,
+                              uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      16-bit fixed point normalized LMS filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point normalized LMS
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_norm_q16s_xpulpv2(const plp_lms_norm_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               const int16_t *__restrict__ pRef,
+                               int16_t *__restrict__ pOut,
+                               int16_t *__restrict__ pErr,
+                               uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point normalized LMS filter instance.
+   @param[out] S         points to an instance of the 32-bit floating-point normalized LMS filter
+                         structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the initial filter coefficients, in time-reversed order. The
+                         coefficients are adapted in place.
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  mu        Step size of the coefficient update
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @return     none
+*/
+
+void plp_lms_norm_init_f32(plp_lms_norm_instance_f32 *S,
+                           uint32_t numTaps,
+                           float32_t *pCoeffs,
+                           float32_t *pState,
+                           float32_t mu,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point normalized LMS filter.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point normalized
+                         LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples, pRef - pOut
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @return     none
+*/
+
+void plp_lms_norm_f32(const plp_lms_norm_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      const float32_t *__restrict__ pRef,
+                      float32_t *__restrict__ pOut,
+                      float32_t *__restrict__ pErr,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point normalized LMS filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point normalized
+                         LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_norm_f32s_xpulpv2(const plp_lms_norm_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               const float32_t *__restrict__ pRef,
+                               float32_t *__restrict__ pOut,
+                               float32_t *__restrict__ pErr,
+                               uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 16-bit integer moving-average filter instance.
+   @param[out] S       points to an instance of the 16-bit integer moving-average filter structure
+   @param[in]  length  Length L of the averaging window, at least 1
+   @param[in]  pState  points to the state buffer of size length
+   @return     none
+*/
+
+void plp_moving_avg_init_i16(plp_moving_avg_instance_i16 *S, uint32_t length, int16_t *pState);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit integer moving-average filter.
+   @param[in,out] S         points to an initialized instance of the 16-bit integer moving-average
+                            filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+*/
+
+void plp_moving_avg_i16(plp_moving_avg_instance_i16 *S,
+                        const int16_t *__restrict__ pSrc,
+                        int16_t *__restrict__ pDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      16-bit integer moving-average filter kernel for RV32IM extension.
+   @param[in,out] S         points to an initialized instance of the 16-bit integer moving-average
+                            filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+*/
+
+void plp_moving_avg_i16s_rv32im(plp_moving_avg_instance_i16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      16-bit integer moving-average filter kernel for XPULPV2 extension.
+   @param[in,out] S         points to an initialized instance of the 16-bit integer moving-average
+                            filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+*/
+
+void plp_moving_avg_i16s_xpulpv2(plp_moving_avg_instance_i16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Initialization of the 32-bit floating-point moving-average filter instance.
+   @param[out] S       points to an instance of the 32-bit floating-point moving-average filter
+                       structure
+   @param[in]  length  Length L of the averaging window, at least 1
+   @param[in]  pState  points to the state buffer of size length
+   @return     none
+*/
+
+void plp_moving_avg_init_f32(plp_moving_avg_instance_f32 *S, uint32_t length, float32_t *pState);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point moving-average filter.
+   @param[in,out] S         points to an initialized instance of the 32-bit floating-point
+                            moving-average filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+*/
+
+void plp_moving_avg_f32(plp_moving_avg_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        float32_t *__restrict__ pDst,
+                        uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point moving-average filter kernel for XPULPV2 extension.
+   @param[in,out] S         points to an initialized instance of the 32-bit floating-point
+                            moving-average filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+*/
+
+void plp_moving_avg_f32s_xpulpv2(plp_moving_avg_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 16-bit integer median filter.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[out] pDst      points to the output vector of length blockSize
+   @return     none
+*/
+
+void plp_median_filter_i16(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t numTaps,
+                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit integer median filter kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  start     First output sample to compute
+   @param[in]  end       One after the last output sample to compute
+   @param[out] pDst      points to the output vector, of which pDst[start] to pDst[end - 1] are
+                         written
+   @return     none
+*/
+
+void plp_median_filter_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t numTaps,
+                                   uint32_t start,
+                                   uint32_t end,
+                                   int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      16-bit integer median filter kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  start     First output sample to compute
+   @param[in]  end       One after the last output sample to compute
+   @param[out] pDst      points to the output vector, of which pDst[start] to pDst[end - 1] are
+                         written
+   @return     none
+*/
+
+void plp_median_filter_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t numTaps,
+                                    uint32_t start,
+                                    uint32_t end,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel 16-bit integer median filter.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  nPE       Number of cores to compute on
+   @param[out] pDst      points to the output vector of length blockSize
+   @return     none
+*/
+
+void plp_median_filter_i16_parallel(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t numTaps,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 16-bit integer median filter kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_median_filter_instance_i16 struct initialized by
+                     plp_median_filter_i16_parallel
+   @return     none
+*/
+
+void plp_median_filter_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the 32-bit floating-point median filter.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[out] pDst      points to the output vector of length blockSize
+   @return     none
+*/
+
+void plp_median_filter_f32(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t numTaps,
+                           float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      32-bit floating-point median filter kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  start     First output sample to compute
+   @param[in]  end       One after the last output sample to compute
+   @param[out] pDst      points to the output vector, of which pDst[start] to pDst[end - 1] are
+                         written
+   @return     none
+*/
+
+void plp_median_filter_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t numTaps,
+                                    uint32_t start,
+                                    uint32_t end,
+                                    float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel 32-bit floating-point median filter.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  nPE       Number of cores to compute on
+   @param[out] pDst      points to the output vector of length blockSize
+   @return     none
+*/
+
+void plp_median_filter_f32_parallel(const float32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t numTaps,
+                                    uint32_t nPE,
+                                    float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Parallel 32-bit floating-point median filter kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_median_filter_instance_f32 struct initialized by
+                     plp_median_filter_f32_parallel
+   @return     none
+*/
+
+void plp_median_filter_f32p_xpulpv2(void *args);
+
+#endif // __PLP_FILTERING_H__
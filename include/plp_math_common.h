@@ -0,0 +1,243 @@
+/** ==========================================================================
+ * @file     plp_math_common.h
+ * @brief    Common types and configuration of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MATH_COMMON_H__
+#define __PLP_MATH_COMMON_H__
+
+#include "math.h"
+#include "rt/rt_api.h"
+
+typedef float float32_t;
+
+/** IEEE 754 half-precision value, stored as its bit pattern (1 sign, 5 exponent and 10 mantissa) */
+typedef uint16_t float16_t;
+
+/** bfloat16 value, stored as its bit pattern (the upper half of a float32_t) */
+typedef uint16_t bfloat16_t;
+
+#define PLP_MATH_IBEX // previously called zero-riscy
+//#define PLP_MATH_RISCY
+#define PLP_MATH_LOOPUNROLL
+
+/*
+ * Tuning parameters of the XPULPV2 kernels. They are set when the library is built, e.g. with
+ * make PLP_DOTPROD_UNROLL=4, and otherwise take the defaults below.
+ *
+ * PLP_DOTPROD_UNROLL: number of independent partial sums, which the dot products of 32-bit vectors
+ * accumulate per loop iteration with PLP_MATH_LOOPUNROLL.
+ *
+ * PLP_MATMUL_BLOCK_M, PLP_MATMUL_BLOCK_O: height and width of the block of the output matrix,
+ * which the matrix multiplications of 32-bit matrices keep in registers. Without them, the integer
+ * kernels use 2x2 blocks and the floating-point kernels, which have more registers left, 4x4.
+ */
+#ifndef PLP_DOTPROD_UNROLL
+#define PLP_DOTPROD_UNROLL 2
+#endif
+
+#ifdef PLP_MATMUL_BLOCK_M
+#define PLP_MATMUL_I32_BLOCK_M PLP_MATMUL_BLOCK_M
+#define PLP_MATMUL_F32_BLOCK_M PLP_MATMUL_BLOCK_M
+#else
+#define PLP_MATMUL_I32_BLOCK_M 2
+#define PLP_MATMUL_F32_BLOCK_M 4
+#endif
+
+#ifdef PLP_MATMUL_BLOCK_O
+#define PLP_MATMUL_I32_BLOCK_O PLP_MATMUL_BLOCK_O
+#define PLP_MATMUL_F32_BLOCK_O PLP_MATMUL_BLOCK_O
+#else
+#define PLP_MATMUL_I32_BLOCK_O 2
+#define PLP_MATMUL_F32_BLOCK_O 4
+#endif
+
+#if PLP_DOTPROD_UNROLL < 1 || PLP_MATMUL_I32_BLOCK_M < 1 || PLP_MATMUL_I32_BLOCK_O < 1
+#error "PLP_DOTPROD_UNROLL, PLP_MATMUL_BLOCK_M and PLP_MATMUL_BLOCK_O must be at least 1"
+#endif
+
+/*
+ * PLP_XPULPNN: build the cluster kernels of the sub-byte functions (e.g. plp_dot_prod_i4) for cores
+ * with the XpulpNN extension, e.g. with make PLP_BACKEND=xpulpnn (or PLP_XPULPNN=1), whose dot
+ * product instructions work on 8 packed 4-bit (pv.sdotsp.n) and 16 packed 2-bit values
+ * (pv.sdotsp.c). The toolchain must target XpulpNN as well. Without it, the XPULPV2 kernels unpack
+ * the values to bytes in registers.
+ *
+ * The glue code of a function with a kernel per backend calls its cluster kernel as
+ * PLP_CL_KERNEL(plp_dot_prod_i4s)(...), which is plp_dot_prod_i4s_xpulpnn or
+ * plp_dot_prod_i4s_xpulpv2 depending on the backend. The FC always runs the RV32IM kernels.
+ */
+#if defined(PLP_XPULPNN)
+#define PLP_SUMDOTP8(a, b, c) __builtin_pulp_sdotsp8((a), (b), (c))
+#define PLP_SUMDOTP16(a, b, c) __builtin_pulp_sdotsp16((a), (b), (c))
+#define PLP_CL_KERNEL(name) name##_xpulpnn
+#else
+#define PLP_CL_KERNEL(name) name##_xpulpv2
+#endif
+
+/*
+ * PLP_FC_FIXED_POINT: run some of the single-precision functions (plp_mean_f32, plp_dot_prod_f32
+ * and plp_mat_mult_f32) on the FC as well, e.g. with make PLP_FC_FIXED_POINT=1, instead of
+ * refusing the call. The FC has no FPU, so their RV32IM kernels convert the inputs to fixed point
+ * with a common exponent per vector or matrix (block floating point), compute with integer
+ * instructions only and convert the result back, without soft-float calls. Values much smaller
+ * than the largest one of their block lose precision, infinities and NaNs are not supported.
+ */
+
+/*
+ * PLP_DETERMINISTIC: build the library for bounded execution times, e.g. with
+ * make PLP_DETERMINISTIC=1. The library then never allocates memory at run time, all temporary
+ * buffers are taken from the scratch arena (see plp_scratch_init). PLP_AUTO always uses all cores
+ * of the cluster, such that every call forks the same team, and kernels with data-dependent
+ * shortcuts (e.g. the pivoting of the matrix inversion) take the same path for all values. The
+ * cycle bounds per function and size are measured with test/mrWolf/bench.py wcet.
+ */
+
+/** Value of nPE, for which the parallel functions choose the number of cores themselves */
+#define PLP_AUTO 0
+
+/** Places a variable into the L1 memory (TCDM) of the cluster */
+#define PLP_L1_DATA RT_L1_DATA
+
+/** Largest number of cores of a cluster */
+#define PLP_MAX_PE 8
+
+/** Number of word-interleaved banks of the L1 memory (TCDM) of the cluster, a power of two. Word i
+    of the L1 memory is in bank i % PLP_L1_BANKS (see plp_l1_alloc). */
+#ifndef PLP_L1_BANKS
+#define PLP_L1_BANKS 16
+#endif
+
+/** Largest number of sub-teams, which run concurrently (see plp_subteams_run) */
+#define PLP_SUBTEAMS_MAX 4
+
+/** Sub-team of a cluster core: its first core and its event unit barrier, 0 for the whole team */
+typedef struct {
+    uint8_t firstCore;
+    uint8_t barrier;
+} plp_subteam_core;
+
+extern PLP_L1_DATA plp_subteam_core plp_subteam_cores[PLP_MAX_PE];
+
+/** Index of the calling core among the cores of a parallel kernel, from 0 to nPE - 1. This is
+    rt_core_id(), unless the kernel runs in a sub-team of plp_subteams_run. */
+static inline uint32_t plp_core_id(void) {
+    uint32_t core = rt_core_id();
+    return core - plp_subteam_cores[core].firstCore;
+}
+
+/*
+ * Timeline trace of the parallel functions (see plp_trace_init). With PLP_TRACE defined when the
+ * library is built, every rt_team_fork records the fork and the join on the calling core, and the
+ * start and the end of the kernel and every barrier (plp_team_barrier) on each core of the team.
+ */
+
+/** Events of the trace */
+#define PLP_TRACE_FORK 0
+#define PLP_TRACE_JOIN 1
+#define PLP_TRACE_START 2
+#define PLP_TRACE_END 3
+#define PLP_TRACE_BARRIER 4 // arrival at the barrier
+#define PLP_TRACE_RELEASE 5 // all cores arrived
+
+void plp_trace_record(uint32_t type, const char *name);
+void plp_trace_fork(int nPE, void (*kernel)(void *), void *arg, const char *name);
+
+#if defined(PLP_TRACE)
+#define rt_team_fork(nPE, kernel, arg) plp_trace_fork((nPE), (kernel), (arg), #kernel)
+#endif
+
+/** Waits until all cores of a parallel kernel reach the barrier, like rt_team_barrier(), but only
+    for the cores of the sub-team if the kernel runs in one */
+static inline void plp_team_barrier(void) {
+    uint32_t barrier = plp_subteam_cores[rt_core_id()].barrier;
+
+#if defined(PLP_TRACE)
+    plp_trace_record(PLP_TRACE_BARRIER, NULL);
+#endif
+
+    if (barrier == 0) {
+        rt_team_barrier();
+    } else {
+        eu_bar_trig_wait_clr(eu_bar_addr(barrier));
+    }
+
+#if defined(PLP_TRACE)
+    plp_trace_record(PLP_TRACE_RELEASE, NULL);
+#endif
+}
+
+/** TCDM bank of the word at p, see PLP_L1_BANKS */
+static inline uint32_t plp_l1_bank(const void *p) {
+    return ((uintptr_t)p >> 2) & (PLP_L1_BANKS - 1);
+}
+
+/** Number of samples of elemSize bytes at p, at most n, which precede the first word-aligned one */
+static inline uint32_t plp_align_head(const void *p, uint32_t elemSize, uint32_t n) {
+    uint32_t head = ((-(uintptr_t)p) & 0x3U) / elemSize;
+    return (head < n) ? head : n;
+}
+
+/*
+ * Sub-byte vectors (e.g. of plp_dot_prod_i4) are packed into bytes in two's complement, element k
+ * in the bits 4k to 4k+3 (4-bit) or 2k to 2k+1 (2-bit) of the vector, i.e. starting with the least
+ * significant bits of the first byte.
+ */
+
+/** Element k of a packed vector of 4-bit values, sign-extended */
+static inline int32_t plp_get_i4(const int8_t *p, uint32_t k) {
+    return (int8_t)((uint8_t)p[k >> 1] << (4 * (~k & 0x1U))) >> 4;
+}
+
+/** Element k of a packed vector of 2-bit values, sign-extended */
+static inline int32_t plp_get_i2(const int8_t *p, uint32_t k) {
+    return (int8_t)((uint8_t)p[k >> 2] << (2 * (~k & 0x3U))) >> 6;
+}
+
+/** Elements 2j + r (j = 0..3, r = 0 or 1) of a word of 8 packed 4-bit values, sign-extended to a
+    vector of 4 bytes */
+static inline v4s plp_unpack_i4(v4s w, uint32_t r) {
+    return ((v4s)((uint32_t)w << (4 - 4 * r))) >> 4;
+}
+
+/** Elements 4j + r (j = 0..3, r = 0 to 3) of a word of 16 packed 2-bit values, sign-extended to a
+    vector of 4 bytes */
+static inline v4s plp_unpack_i2(v4s w, uint32_t r) {
+    return ((v4s)((uint32_t)w << (6 - 2 * r))) >> 6;
+}
+
+/** Elements 2j + r (j = 0, 1; r = 0 or 1) of a vector of 4 bytes, sign-extended to a vector of 2
+    halfwords */
+static inline v2s plp_unpack_i8(v4s w, uint32_t r) {
+    return ((v2s)w << (8 - 8 * r)) >> 8;
+}
+
+/** Number of set bits of x, for the FC kernels of the binary functions (e.g. plp_dot_prod_bin).
+    The cluster kernels use the p.cnt instruction of XPULPV2 (__builtin_popcount) instead. */
+static inline uint32_t plp_popcount(uint32_t x) {
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    x = (x + (x >> 4)) & 0x0F0F0F0FU;
+    return (x * 0x01010101U) >> 24;
+}
+
+#endif // __PLP_MATH_COMMON_H__
@@ -0,0 +1,850 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_math_inline.h
+ * Description:  Static inline versions of short-vector kernels
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Static inline versions of the most common short-vector kernels, for calls with a few samples
+ * (e.g. 4 to 16) in tight loops, where the call of the library function costs more than the work
+ * itself. They compute the same results as the library functions, but are written in plain C, so
+ * they can be used on the FC and the cluster, and the compiler can unroll them completely when the
+ * length is a compile-time constant and schedule them together with the surrounding code. For long
+ * vectors, the library functions are faster.
+ */
+
+#ifndef __PLP_MATH_INLINE_H__
+#define __PLP_MATH_INLINE_H__
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/** -------------------------------------------------------
+    @brief         Rounds and shifts a fixed-point value, like __ROUNDNORM_REG.
+    @param[in]     x           value to normalize
+    @param[in]     deciPoint   decimal point for right shift
+    @return        x rounded to the nearest value and shifted right by deciPoint
+*/
+
+static inline int32_t plp_roundnorm_inline(int32_t x, uint32_t deciPoint) {
+    return (deciPoint > 0) ? (x + (1 << (deciPoint - 1))) >> deciPoint : x;
+}
+
+/** -------------------------------------------------------
+    @brief         Requantizes a 32-bit accumulator to 16 bits, see plp_mat_mult_requant_q16.
+    @param[in]     acc         accumulator
+    @param[in]     mult        multiplier
+    @param[in]     shift       right shift, at most 62
+    @return        acc * mult * 2^-shift, rounded to the nearest value and saturated to 16 bits
+*/
+
+static inline int16_t plp_requant_q16_inline(int32_t acc, int32_t mult, uint32_t shift) {
+    int64_t y = (int64_t)acc * mult;
+
+    if (shift > 0) {
+        y = (y + ((int64_t)1 << (shift - 1))) >> shift;
+    }
+
+    return (int16_t)((y > 0x7FFF) ? 0x7FFF : ((y < -0x8000) ? -0x8000 : y));
+}
+
+/** -------------------------------------------------------
+    @brief         Requantizes a 64-bit accumulator to 32 bits, see plp_mat_mult_requant_q32.
+    @param[in]     acc         accumulator
+    @param[in]     mult        multiplier
+    @param[in]     shift       right shift, at most 63
+    @return        acc * mult * 2^-shift, rounded to the nearest value and saturated to 32 bits
+
+    @par
+    The 96-bit product acc * mult is computed exactly as hi * 2^32 + lo, with two 32x32-bit
+    multiplications.
+*/
+
+static inline int32_t plp_requant_q32_inline(int64_t acc, int32_t mult, uint32_t shift) {
+    int64_t p = (int64_t)(uint32_t)acc * mult;
+    int64_t hi = (acc >> 32) * mult + (p >> 32);
+    uint32_t lo = (uint32_t)p;
+    uint64_t t;
+
+    // add 2^(shift - 1) to round to the nearest value
+    if (shift > 32) {
+        hi += (int64_t)1 << (shift - 33);
+    } else if (shift > 0) {
+        t = (uint64_t)lo + ((uint64_t)1 << (shift - 1));
+        hi += (int64_t)(t >> 32);
+        lo = (uint32_t)t;
+    }
+
+    if (shift >= 32) {
+        hi >>= shift - 32;
+    } else if (hi > 0x7FFFFFFF) {
+        return 0x7FFFFFFF;
+    } else if (hi < -0x7FFFFFFF - 1) {
+        return -0x7FFFFFFF - 1;
+    } else {
+        hi = hi * ((int64_t)1 << (32 - shift)) + (lo >> shift);
+    }
+
+    if (hi > 0x7FFFFFFF) {
+        hi = 0x7FFFFFFF;
+    } else if (hi < -0x7FFFFFFF - 1) {
+        hi = -0x7FFFFFFF - 1;
+    }
+
+    return (int32_t)hi;
+}
+
+/** -------------------------------------------------------
+    @brief         Inline dot product of 32-bit integer vectors, see plp_dot_prod_i32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[in]     blockSize   number of samples in each vector
+    @param[out]    pRes        output result returned here
+    @return        none
+*/
+
+static inline void plp_dot_prod_i32_inline(const int32_t *pSrcA,
+                                           const int32_t *pSrcB,
+                                           uint32_t blockSize,
+                                           int32_t *pRes) {
+    int32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        sum += pSrcA[i] * pSrcB[i];
+    }
+
+    *pRes = sum;
+}
+
+/** -------------------------------------------------------
+    @brief         Inline dot product of 16-bit integer vectors, see plp_dot_prod_i16.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[in]     blockSize   number of samples in each vector
+    @param[out]    pRes        output result returned here
+    @return        none
+*/
+
+static inline void plp_dot_prod_i16_inline(const int16_t *pSrcA,
+                                           const int16_t *pSrcB,
+                                           uint32_t blockSize,
+                                           int32_t *pRes) {
+    int32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        sum += (int32_t)pSrcA[i] * pSrcB[i];
+    }
+
+    *pRes = sum;
+}
+
+/** -------------------------------------------------------
+    @brief         Inline dot product of 8-bit integer vectors, see plp_dot_prod_i8.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[in]     blockSize   number of samples in each vector
+    @param[out]    pRes        output result returned here
+    @return        none
+*/
+
+static inline void plp_dot_prod_i8_inline(const int8_t *pSrcA,
+                                          const int8_t *pSrcB,
+                                          uint32_t blockSize,
+                                          int32_t *pRes) {
+    int32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        sum += (int32_t)pSrcA[i] * pSrcB[i];
+    }
+
+    *pRes = sum;
+}
+
+/** -------------------------------------------------------
+    @brief         Inline dot product of 32-bit floating-point vectors, see plp_dot_prod_f32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[in]     blockSize   number of samples in each vector
+    @param[out]    pRes        output result returned here
+    @return        none
+*/
+
+static inline void plp_dot_prod_f32_inline(const float32_t *pSrcA,
+                                           const float32_t *pSrcB,
+                                           uint32_t blockSize,
+                                           float32_t *pRes) {
+    float32_t sum = 0.0f;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        sum += pSrcA[i] * pSrcB[i];
+    }
+
+    *pRes = sum;
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element addition of 32-bit integer vectors, see plp_add_i32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_add_i32_inline(const int32_t *pSrcA,
+                                      const int32_t *pSrcB,
+                                      int32_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] + pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element addition of 16-bit integer vectors, see plp_add_i16.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_add_i16_inline(const int16_t *pSrcA,
+                                      const int16_t *pSrcB,
+                                      int32_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (int32_t)pSrcA[i] + pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element addition of 8-bit integer vectors, see plp_add_i8.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_add_i8_inline(const int8_t *pSrcA,
+                                     const int8_t *pSrcB,
+                                     int32_t *pDst,
+                                     uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (int32_t)pSrcA[i] + pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element addition of 32-bit floating-point vectors, see
+                   plp_add_f32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_add_f32_inline(const float32_t *pSrcA,
+                                      const float32_t *pSrcB,
+                                      float32_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] + pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element subtraction of 32-bit integer vectors, see plp_sub_i32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_sub_i32_inline(const int32_t *pSrcA,
+                                      const int32_t *pSrcB,
+                                      int32_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] - pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element subtraction of 16-bit integer vectors, see plp_sub_i16.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_sub_i16_inline(const int16_t *pSrcA,
+                                      const int16_t *pSrcB,
+                                      int16_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (int16_t)(pSrcA[i] - pSrcB[i]);
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element subtraction of 8-bit integer vectors, see plp_sub_i8.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_sub_i8_inline(const int8_t *pSrcA,
+                                     const int8_t *pSrcB,
+                                     int8_t *pDst,
+                                     uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (int8_t)(pSrcA[i] - pSrcB[i]);
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element subtraction of 32-bit floating-point vectors, see
+                   plp_sub_f32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_sub_f32_inline(const float32_t *pSrcA,
+                                      const float32_t *pSrcB,
+                                      float32_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] - pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element multiplication of 32-bit integer vectors, see
+                   plp_mult_i32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_mult_i32_inline(const int32_t *pSrcA,
+                                       const int32_t *pSrcB,
+                                       int32_t *pDst,
+                                       uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] * pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element multiplication of 16-bit integer vectors, see
+                   plp_mult_i16.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_mult_i16_inline(const int16_t *pSrcA,
+                                       const int16_t *pSrcB,
+                                       int32_t *pDst,
+                                       uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (int32_t)pSrcA[i] * pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element multiplication of 8-bit integer vectors, see
+                   plp_mult_i8.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_mult_i8_inline(const int8_t *pSrcA,
+                                      const int8_t *pSrcB,
+                                      int32_t *pDst,
+                                      uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (int32_t)pSrcA[i] * pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline element-by-element multiplication of 32-bit floating-point vectors, see
+                   plp_mult_f32.
+    @param[in]     pSrcA       points to the first input vector
+    @param[in]     pSrcB       points to the second input vector
+    @param[out]    pDst        points to the output vector
+    @param[in]     blockSize   number of samples in each vector
+    @return        none
+*/
+
+static inline void plp_mult_f32_inline(const float32_t *pSrcA,
+                                       const float32_t *pSrcB,
+                                       float32_t *pDst,
+                                       uint32_t blockSize) {
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] * pSrcB[i];
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline complex-by-complex multiplication of 16-bit integer vectors, see
+                   plp_cmplx_mult_cmplx_i16.
+    @param[in]     pSrcA       points to the first complex input vector
+    @param[in]     pSrcB       points to the second complex input vector
+    @param[out]    pDst        points to the complex output vector
+    @param[in]     numSamples  number of complex samples in each vector
+    @return        none
+*/
+
+static inline void plp_cmplx_mult_cmplx_i16_inline(const int16_t *pSrcA,
+                                                   const int16_t *pSrcB,
+                                                   int16_t *pDst,
+                                                   uint32_t numSamples) {
+    int32_t a, b, c, d;
+    uint32_t i;
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+
+        pDst[2 * i] = (int16_t)(a * c - b * d);
+        pDst[2 * i + 1] = (int16_t)(a * d + b * c);
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline complex-by-complex multiplication of 16-bit fixed-point vectors, see
+                   plp_cmplx_mult_cmplx_q16.
+    @param[in]     pSrcA       points to the first complex input vector
+    @param[in]     pSrcB       points to the second complex input vector
+    @param[out]    pDst        points to the complex output vector
+    @param[in]     deciPoint   decimal point for right shift
+    @param[in]     numSamples  number of complex samples in each vector
+    @return        none
+*/
+
+static inline void plp_cmplx_mult_cmplx_q16_inline(const int16_t *pSrcA,
+                                                   const int16_t *pSrcB,
+                                                   int16_t *pDst,
+                                                   uint32_t deciPoint,
+                                                   uint32_t numSamples) {
+    int32_t a, b, c, d;
+    uint32_t i;
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+
+        pDst[2 * i] = (int16_t)(plp_roundnorm_inline(a * c, deciPoint) -
+                                plp_roundnorm_inline(b * d, deciPoint));
+        pDst[2 * i + 1] = (int16_t)(plp_roundnorm_inline(a * d, deciPoint) +
+                                    plp_roundnorm_inline(b * c, deciPoint));
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Inline complex-by-complex multiplication of 32-bit floating-point vectors, see
+                   plp_cmplx_mult_cmplx_f32.
+    @param[in]     pSrcA       points to the first complex input vector
+    @param[in]     pSrcB       points to the second complex input vector
+    @param[out]    pDst        points to the complex output vector
+    @param[in]     numSamples  number of complex samples in each vector
+    @return        none
+*/
+
+static inline void plp_cmplx_mult_cmplx_f32_inline(const float32_t *pSrcA,
+                                                   const float32_t *pSrcB,
+                                                   float32_t *pDst,
+                                                   uint32_t numSamples) {
+    float32_t a, b, c, d;
+    uint32_t i;
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+
+        pDst[2 * i] = a * c - b * d;
+        pDst[2 * i + 1] = a * d + b * c;
+    }
+}
+
+/** -------------------------------------------------------
+    @brief         Converts a half-precision value to single precision. The conversion is exact,
+                   including subnormals, infinities and NaNs.
+    @param[in]     x           half-precision value
+    @return        x as single-precision value
+*/
+
+static inline float32_t plp_f16_to_f32_inline(float16_t x) {
+    union {
+        uint32_t u;
+        float32_t f;
+    } v;
+    uint32_t exp;
+
+    v.u = (uint32_t)(x & 0x7fffU) << 13;
+    exp = v.u & 0x0f800000U;
+    v.u += (127U - 15U) << 23; /* rebias the exponent */
+
+    if (exp == 0x0f800000U) {
+        v.u += (128U - 16U) << 23; /* infinity or NaN */
+    } else if (exp == 0) {
+        v.u += 1U << 23; /* subnormal, renormalize with a subtraction of 2^-14 */
+        v.f -= 6.103515625e-05f;
+    }
+
+    v.u |= (uint32_t)(x & 0x8000U) << 16;
+    return v.f;
+}
+
+/** -------------------------------------------------------
+    @brief         Converts a single-precision value to half precision, rounded to the nearest
+                   even value. Values beyond the half-precision range become infinity.
+    @param[in]     x           single-precision value
+    @return        x as half-precision value
+*/
+
+static inline float16_t plp_f32_to_f16_inline(float32_t x) {
+    union {
+        uint32_t u;
+        float32_t f;
+    } v, magic;
+    uint32_t sign;
+    uint32_t res;
+
+    v.f = x;
+    sign = v.u & 0x80000000U;
+    v.u ^= sign;
+
+    if (v.u >= ((127U + 16U) << 23)) {
+        res = (v.u > 0x7f800000U) ? 0x7e00U : 0x7c00U; /* NaN or infinity */
+    } else if (v.u < ((127U - 14U) << 23)) {
+        /* subnormal result: the addition rounds the mantissa to the nearest even value */
+        magic.u = (127U - 15U + 23U - 10U + 1U) << 23;
+        v.f += magic.f;
+        res = v.u - magic.u;
+    } else {
+        /* rebias the exponent and round the mantissa to the nearest even value */
+        uint32_t odd = (v.u >> 13) & 1U;
+        v.u += ((uint32_t)(15 - 127) << 23) + 0xfffU + odd;
+        res = v.u >> 13;
+    }
+
+    return (float16_t)(res | (sign >> 16));
+}
+
+/** -------------------------------------------------------
+    @brief         Converts a bfloat16 value to single precision. The conversion is exact.
+    @param[in]     x           bfloat16 value
+    @return        x as single-precision value
+*/
+
+static inline float32_t plp_bf16_to_f32_inline(bfloat16_t x) {
+    union {
+        uint32_t u;
+        float32_t f;
+    } v;
+
+    v.u = (uint32_t)x << 16;
+    return v.f;
+}
+
+/** -------------------------------------------------------
+    @brief         Converts a single-precision value to bfloat16, rounded to the nearest even value.
+    @param[in]     x           single-precision value
+    @return        x as bfloat16 value
+*/
+
+static inline bfloat16_t plp_f32_to_bf16_inline(float32_t x) {
+    union {
+        uint32_t u;
+        float32_t f;
+    } v;
+
+    v.f = x;
+
+    if ((v.u & 0x7fffffffU) > 0x7f800000U) {
+        return (bfloat16_t)((v.u >> 16) | 0x40U); /* keep NaNs quiet */
+    }
+
+    v.u += 0x7fffU + ((v.u >> 16) & 1U);
+    return (bfloat16_t)(v.u >> 16);
+}
+
+/** -------------------------------------------------------
+    @brief         Reciprocal of a normalized mantissa, see plp_recip_q16 and plp_div_q16.
+    @param[in]     m           mantissa in Q0.32 in [0.5, 1), i.e. with the most significant bit set
+    @param[in]     iterations  number of Newton iterations, 2 for 16-bit and 3 for 32-bit results
+    @return        1 / m in Q2.30, slightly below the exact value
+
+    @par
+    The initial guess is looked up in recipTable_q16 with the 5 bits following the leading one of
+    m, with a relative error below 2^-6. Every Newton iteration y = y * (2 - m * y) squares the
+    relative error, up to the truncation of the Q2.30 arithmetic.
+*/
+
+static inline uint32_t plp_recip_norm_inline(uint32_t m, uint32_t iterations) {
+    uint32_t y = (uint32_t)recipTable_q16[(m >> 26) - 32] << 16;
+    uint32_t e;
+
+    while (iterations > 0) {
+        e = 0x80000000U - (uint32_t)(((uint64_t)m * y) >> 32);
+        y = (uint32_t)(((uint64_t)y * e) >> 30);
+        iterations--;
+    }
+
+    return y;
+}
+
+/** -------------------------------------------------------
+    @brief         Inverse square root of a normalized mantissa, see plp_normalize_l2_q16.
+    @param[in]     m           mantissa in Q0.32 in [0.25, 1), i.e. with one of the two most
+                               significant bits set
+    @param[in]     iterations  number of Newton iterations, 2 for 16-bit results
+    @return        1 / sqrt(m) in Q2.30, slightly below the exact value
+
+    @par
+    The initial guess is looked up in rsqrtTable_q16, with a relative error below 2^-5. Every
+    Newton iteration y = y * (3 - m * y^2) / 2 about squares the relative error, up to the
+    truncation of the Q2.30 arithmetic.
+*/
+
+static inline uint32_t plp_rsqrt_norm_inline(uint32_t m, uint32_t iterations) {
+    uint32_t y = (uint32_t)rsqrtTable_q16[(m >> 27) - 8] << 16;
+    uint32_t t;
+
+    while (iterations > 0) {
+        t = (uint32_t)(((uint64_t)m * y) >> 32);
+        t = (uint32_t)(((uint64_t)t * y) >> 30);
+        y = (uint32_t)(((uint64_t)y * (0xC0000000U - t)) >> 31);
+        iterations--;
+    }
+
+    return y;
+}
+
+/** -------------------------------------------------------
+    @brief         Integer square root of a 64-bit unsigned value, see plp_mat_norm_fro_stride_i16.
+    @param[in]     x           input value
+    @return        floor(sqrt(x))
+
+    @par
+    The root is computed bit by bit from the most significant one, with shifts, additions and
+    comparisons only (32 iterations at most).
+*/
+
+static inline uint32_t plp_isqrt_u64_inline(uint64_t x) {
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+/** -------------------------------------------------------
+    @brief         Inverse square root of a positive single-precision value, see plp_rsqrt_f32.
+    @param[in]     x           positive input value
+    @return        1 / sqrt(x) with a relative error below 1e-6
+
+    @par
+    The initial approximation is computed from the bit pattern of the input, and refined with two
+    Newton iterations, the first one with the optimized coefficients of Moroz et al.
+*/
+
+static inline float32_t plp_rsqrt_f32_inline(float32_t x) {
+    union {
+        float32_t f;
+        int32_t i;
+    } y;
+
+    y.f = x;
+    y.i = 0x5F1FFFF9 - (y.i >> 1);
+    y.f = 0.703952253f * y.f * (2.38924456f - x * y.f * y.f);
+    y.f = y.f * (1.5f - 0.5f * x * y.f * y.f);
+    return y.f;
+}
+
+/** -------------------------------------------------------
+    @brief         Biased exponent of a single-precision value, computed with integer instructions
+                   only. Subnormals and zero have the exponent 1.
+    @param[in]     x           single-precision value, not infinite or NaN
+    @return        biased exponent of x, from 1 to 254
+*/
+
+static inline int32_t plp_f32_exp_inline(float32_t x) {
+    union {
+        float32_t f;
+        uint32_t u;
+    } v;
+    int32_t exp;
+
+    v.f = x;
+    exp = (v.u >> 23) & 0xff;
+    return (exp == 0) ? 1 : exp;
+}
+
+/** -------------------------------------------------------
+    @brief         Converts a single-precision value to a fixed-point value of a block with a
+                   common exponent, with integer instructions only, see PLP_FC_FIXED_POINT.
+    @param[in]     x           single-precision value, not infinite or NaN
+    @param[in]     blockExp    largest biased exponent of the block (see plp_f32_exp_inline)
+    @return        x * 2^(150 - blockExp), truncated towards zero, below 2^24 in magnitude
+*/
+
+static inline int32_t plp_f32_to_fix_inline(float32_t x, int32_t blockExp) {
+    union {
+        float32_t f;
+        uint32_t u;
+    } v;
+    int32_t exp, mant;
+
+    v.f = x;
+    exp = (v.u >> 23) & 0xff;
+    mant = v.u & 0x7fffff;
+    if (exp == 0) {
+        exp = 1;
+    } else {
+        mant |= 0x800000;
+    }
+
+    mant = (blockExp - exp < 24) ? mant >> (blockExp - exp) : 0;
+    return (v.u & 0x80000000U) ? -mant : mant;
+}
+
+/** -------------------------------------------------------
+    @brief         Converts a fixed-point value to single precision, rounded to the nearest value,
+                   with integer instructions only, see PLP_FC_FIXED_POINT.
+    @param[in]     x           fixed-point value
+    @param[in]     exp         exponent of the fixed-point value
+    @return        x * 2^exp, infinity on overflow and zero on underflow
+*/
+
+static inline float32_t plp_fix_to_f32_inline(int64_t x, int32_t exp) {
+    union {
+        float32_t f;
+        uint32_t u;
+    } v;
+    uint32_t sign = 0;
+    uint64_t a = (uint64_t)x;
+    uint32_t mant;
+    int32_t msb;
+
+    if (x < 0) {
+        sign = 0x80000000U;
+        a = -a;
+    }
+    if (a == 0) {
+        v.u = sign;
+        return v.f;
+    }
+
+    msb = 63 - (int32_t)__builtin_clzll(a);
+    if (msb > 23) {
+        mant = (uint32_t)(((a >> (msb - 24)) + 1) >> 1);
+        if (mant == 0x1000000U) {
+            mant >>= 1;
+            msb++;
+        }
+    } else {
+        mant = (uint32_t)a << (23 - msb);
+    }
+
+    exp += msb + 127;
+    if (exp >= 255) {
+        v.u = sign | 0x7f800000U;
+    } else if (exp <= 0) {
+        v.u = sign;
+    } else {
+        v.u = sign | ((uint32_t)exp << 23) | (mant & 0x7fffffU);
+    }
+    return v.f;
+}
+
+#endif // __PLP_MATH_INLINE_H__
@@ -0,0 +1,12997 @@
+/** ==========================================================================
+ * @file     plp_matrix.h
+ * @brief    Matrix functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MATRIX_H__
+#define __PLP_MATRIX_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @brief Tile of the output matrix assigned to one core by plp_mat_partition.
+    @param[in]  mStart  first row of the tile
+    @param[in]  mEnd    one past the last row of the tile
+    @param[in]  oStart  first column of the tile
+    @param[in]  oEnd    one past the last column of the tile
+*/
+typedef struct {
+    uint32_t mStart;
+    uint32_t mEnd;
+    uint32_t oStart;
+    uint32_t oEnd;
+} plp_mat_tile;
+
+/** -------------------------------------------------------
+    @brief Element type of the matrices of a plan.
+*/
+typedef enum {
+    PLP_MAT_I8,  // 8-bit integer inputs, 32-bit integer output
+    PLP_MAT_I16, // 16-bit integer inputs, 32-bit integer output
+    PLP_MAT_I32, // 32-bit integer inputs and output
+    PLP_MAT_F32  // 32-bit floating-point inputs and output
+} plp_mat_type;
+
+/** -------------------------------------------------------
+    @brief Plan of a matrix multiplication of fixed shape, created by plp_mat_mult_plan_create
+           and run by plp_mat_mult_execute.
+    @param[in]  type    element type of the matrices
+    @param[in]  M       height of the first input matrix
+    @param[in]  N       width of the first input matrix and height of the second
+    @param[in]  O       width of the second input matrix
+    @param[in]  nPE     number of cores, after resolving PLP_AUTO
+    @param[in]  kernel  parallel kernel of the cluster, NULL if the serial kernel is used
+    @param[in]  tiles   tile of the output matrix of every core
+*/
+typedef struct {
+    plp_mat_type type;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    void (*kernel)(void *);
+    plp_mat_tile tiles[PLP_MAX_PE];
+} plp_mat_mult_plan;
+
+/** -------------------------------------------------------
+    @brief Sparse 8-bit integer matrix in compressed sparse row (CSR) format.
+    @param[in]  M        number of rows
+    @param[in]  N        number of columns
+    @param[in]  pRowPtr  M + 1 offsets into pColIdx and pData, the nonzeros of row m are
+                         pRowPtr[m] to pRowPtr[m + 1] - 1 and pRowPtr[M] is their number
+    @param[in]  pColIdx  column index of every nonzero
+    @param[in]  pData    value of every nonzero, ordered by row
+*/
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    const uint32_t *pRowPtr;
+    const uint16_t *pColIdx;
+    const int8_t *pData;
+} plp_csr_matrix_i8;
+
+/** -------------------------------------------------------
+    @brief Sparse 16-bit integer matrix in compressed sparse row (CSR) format.
+    @param[in]  M        number of rows
+    @param[in]  N        number of columns
+    @param[in]  pRowPtr  M + 1 offsets into pColIdx and pData, the nonzeros of row m are
+                         pRowPtr[m] to pRowPtr[m + 1] - 1 and pRowPtr[M] is their number
+    @param[in]  pColIdx  column index of every nonzero
+    @param[in]  pData    value of every nonzero, ordered by row
+*/
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    const uint32_t *pRowPtr;
+    const uint16_t *pColIdx;
+    const int16_t *pData;
+} plp_csr_matrix_i16;
+
+/** -------------------------------------------------------
+    @brief Sparse 32-bit floating-point matrix in compressed sparse row (CSR) format.
+    @param[in]  M        number of rows
+    @param[in]  N        number of columns
+    @param[in]  pRowPtr  M + 1 offsets into pColIdx and pData, the nonzeros of row m are
+                         pRowPtr[m] to pRowPtr[m + 1] - 1 and pRowPtr[M] is their number
+    @param[in]  pColIdx  column index of every nonzero
+    @param[in]  pData    value of every nonzero, ordered by row
+*/
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    const uint32_t *pRowPtr;
+    const uint16_t *pColIdx;
+    const float *pData;
+} plp_csr_matrix_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+    const plp_mat_tile *pTiles; // tile of every core, NULL to compute it in the kernel
+} plp_mat_mult_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+    const plp_mat_tile *pTiles; // tile of every core, NULL to compute it in the kernel
+} plp_mat_mult_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+    const plp_mat_tile *pTiles; // tile of every core, NULL to compute it in the kernel
+} plp_mat_mult_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+    const plp_mat_tile *pTiles; // tile of every core, NULL to compute it in the kernel
+} plp_mat_mult_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for half-precision floating-point parallel matrix multiplication.
+ */
+typedef struct {
+    const float16_t *__restrict__ pSrcA;
+    const float16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    float16_t *__restrict__ pDstC;
+} plp_mat_mult_instance_f16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex matrix matrix multiplication with
+ *        the 3M algorithm.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    float *__restrict__ pTmp;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_3m_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix addition.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_add_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix addition.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_add_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix addition.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_add_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel matrix addition.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_add_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_sub_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_sub_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_sub_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel matrix subtraction.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_sub_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix scale.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    int8_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_scale_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix scale.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    int16_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_scale_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix scale.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_scale_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel matrix scale.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    float scaleFactor;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_scale_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix addition.
+ */
+typedef struct {
+    int32_t *__restrict__ pSrcDstA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_add_inplace_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix addition.
+ */
+typedef struct {
+    int16_t *__restrict__ pSrcDstA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_add_inplace_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix addition.
+ */
+typedef struct {
+    int8_t *__restrict__ pSrcDstA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_add_inplace_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel in-place matrix addition.
+ */
+typedef struct {
+    float *__restrict__ pSrcDstA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_add_inplace_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix subtraction.
+ */
+typedef struct {
+    int32_t *__restrict__ pSrcDstA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_sub_inplace_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix subtraction.
+ */
+typedef struct {
+    int16_t *__restrict__ pSrcDstA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_sub_inplace_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix subtraction.
+ */
+typedef struct {
+    int8_t *__restrict__ pSrcDstA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_sub_inplace_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel in-place matrix subtraction.
+ */
+typedef struct {
+    float *__restrict__ pSrcDstA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_sub_inplace_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix scale.
+ */
+typedef struct {
+    int32_t *__restrict__ pSrcDst;
+    uint32_t M;
+    uint32_t N;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+} plp_mat_scale_inplace_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix scale.
+ */
+typedef struct {
+    int16_t *__restrict__ pSrcDst;
+    uint32_t M;
+    uint32_t N;
+    int16_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+} plp_mat_scale_inplace_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix scale.
+ */
+typedef struct {
+    int8_t *__restrict__ pSrcDst;
+    uint32_t M;
+    uint32_t N;
+    int8_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+} plp_mat_scale_inplace_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel in-place matrix scale.
+ */
+typedef struct {
+    float *__restrict__ pSrcDst;
+    uint32_t M;
+    uint32_t N;
+    float scaleFactor;
+    uint32_t nPE;
+} plp_mat_scale_inplace_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel matrix inversion.
+ */
+typedef struct {
+    float *__restrict__ pSrc;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+    int status;
+} plp_mat_inv_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for the parallel closed-form inversion of a batch of small
+ *        floating-point matrices.
+ */
+typedef struct {
+    const float *pSrc;
+    uint32_t N;
+    uint32_t batchCount;
+    uint32_t nPE;
+    float *pDst;
+    float *pDet;
+    int status;
+} plp_mat_inv_small_batched_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel solving with the LU decomposition.
+ */
+typedef struct {
+    const float *__restrict__ pLU;
+    const uint32_t *__restrict__ pPerm;
+    const float *__restrict__ pSrcB;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    float *__restrict__ pDstX;
+    int status;
+} plp_mat_lu_solve_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel QR decomposition, real and complex.
+ */
+typedef struct {
+    float *__restrict__ pR;
+    uint32_t M;
+    uint32_t N;
+    uint32_t K;
+    uint32_t nPE;
+    float *__restrict__ pTmp;
+    float *__restrict__ pQ;
+    float beta;
+} plp_mat_qr_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel symmetric eigenvalue decomposition.
+ */
+typedef struct {
+    float *__restrict__ pA;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pTmp;
+    float *__restrict__ pEigVal;
+    float *__restrict__ pEigVec;
+    int status;
+} plp_mat_eig_sym_instance_f32;
+
+/** Maximum number of sweeps of the symmetric eigenvalue decomposition (plp_mat_eig_sym_f32) */
+#define PLP_MAT_EIG_SYM_MAX_SWEEPS 20
+
+/** Relative tolerance of the sum of squares of the off-diagonal elements (plp_mat_eig_sym_f32) */
+#define PLP_MAT_EIG_SYM_TOL 1e-12f
+
+/** Size of the temporary buffer of the Kalman filter with n states and m measurements */
+#define PLP_KALMAN_TMP_SIZE(n, m)                                                                  \
+    (((n) * (n) > (m) * ((m) + 2 * (n) + 1)) ? (n) * (n) : (m) * ((m) + 2 * (n) + 1))
+
+/** -------------------------------------------------------
+ * @brief Instance structure for the floating-point Kalman filter with n states and m
+ *        measurements. pX points to the state vector of size n and pP to its covariance (nxn),
+ *        pF to the state transition (nxn), pQ to the process noise covariance (nxn), pH to the
+ *        observation matrix (mxn), pR to the measurement noise covariance (mxm) and pTmp to a
+ *        buffer of PLP_KALMAN_TMP_SIZE(n, m) values.
+ */
+typedef struct {
+    uint32_t n;
+    uint32_t m;
+    float *__restrict__ pX;
+    float *__restrict__ pP;
+    const float *__restrict__ pF;
+    const float *__restrict__ pQ;
+    const float *__restrict__ pH;
+    const float *__restrict__ pR;
+    float *__restrict__ pTmp;
+} plp_kalman_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel matrix vector multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel matrix vector multiplication with a palettized 4-bit
+ *        matrix.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pCodebook;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_mult_compressed_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel matrix vector multiplication of an 8-bit integer matrix
+ *        with a 16-bit integer vector.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_i8xi16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel matrix vector multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel matrix vector multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel matrix vector multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel matrix vector multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel matrix vector multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel matrix vector multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDstY;
+} plp_mat_vec_mult_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel batched complex matrix vector
+ *        multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t batchCount;
+    uint32_t strideA;
+    uint32_t strideX;
+    uint32_t strideY;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstY;
+} plp_mat_vec_mult_cmplx_batched_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel batched complex matrix vector
+ *        multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t batchCount;
+    uint32_t strideA;
+    uint32_t strideX;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDstY;
+} plp_mat_vec_mult_cmplx_batched_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel outer product.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcX;
+    const int32_t *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_outer_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel outer product.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcX;
+    const int16_t *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_outer_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel outer product.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcX;
+    const int8_t *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_outer_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel outer product.
+ */
+typedef struct {
+    const float *__restrict__ pSrcX;
+    const float *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_outer_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel rank-1 update.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcX;
+    const int32_t *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pSrcDstA;
+} plp_mat_rank1_update_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel rank-1 update.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcX;
+    const int16_t *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pSrcDstA;
+} plp_mat_rank1_update_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel rank-1 update.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcX;
+    const int8_t *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pSrcDstA;
+} plp_mat_rank1_update_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel rank-1 update.
+ */
+typedef struct {
+    const float *__restrict__ pSrcX;
+    const float *__restrict__ pSrcY;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pSrcDstA;
+} plp_mat_rank1_update_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel Kronecker product.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t P;
+    uint32_t Q;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_kron_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel Kronecker product.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t P;
+    uint32_t Q;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_kron_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel Kronecker product.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t P;
+    uint32_t Q;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_kron_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel Kronecker product.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t P;
+    uint32_t Q;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_kron_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel sparse matrix vector multiplication.
+ */
+typedef struct {
+    const plp_csr_matrix_i8 *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_spmv_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel sparse matrix vector multiplication.
+ */
+typedef struct {
+    const plp_csr_matrix_i16 *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_spmv_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel sparse matrix vector multiplication.
+ */
+typedef struct {
+    const plp_csr_matrix_f32 *__restrict__ pSrcA;
+    const float *__restrict__ pSrcX;
+    uint32_t nPE;
+    float *__restrict__ pDstY;
+} plp_spmv_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix transpose.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_trans_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix transpose.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_trans_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix transpose.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_trans_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    int32_t fracBits;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    int32_t *pBufA[2];
+    int32_t *pBufB[2];
+    int32_t *pBufC[2];
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_tiled_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    int16_t *pBufA[2];
+    int16_t *pBufB[2];
+    int32_t *pBufC[2];
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_tiled_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    int8_t *pBufA[2];
+    int8_t *pBufB[2];
+    int32_t *pBufC[2];
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_tiled_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    float *pBufA[2];
+    float *pBufB[2];
+    float *pBufC[2];
+    float *__restrict__ pDstC;
+} plp_mat_mult_tiled_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Arguments of one cluster of the integer tiled matrix multiplication across clusters.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_tiled_multi_arg_i32;
+
+/** -------------------------------------------------------
+ * @brief Arguments of one cluster of the integer tiled matrix multiplication across clusters.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_tiled_multi_arg_i16;
+
+/** -------------------------------------------------------
+ * @brief Arguments of one cluster of the integer tiled matrix multiplication across clusters.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_tiled_multi_arg_i8;
+
+/** -------------------------------------------------------
+ * @brief Arguments of one cluster of the floating-point tiled matrix multiplication across
+ *        clusters.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM;
+    uint32_t tileO;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_tiled_multi_arg_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel packed matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_packed_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel packed matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_packed_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for binary parallel matrix multiplication.
+ */
+typedef struct {
+    const uint32_t *__restrict__ pSrcA;
+    const uint32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_bin;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for ternary parallel matrix multiplication.
+ */
+typedef struct {
+    const uint32_t *__restrict__ pSrcA;
+    const uint32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_ter;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel matrix multiplication with requantization.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    const int32_t *__restrict__ pMult;
+    const uint32_t *__restrict__ pShift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel matrix multiplication with
+ *        requantization.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    const int32_t *__restrict__ pMult;
+    const uint32_t *__restrict__ pShift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel matrix multiplication with
+ *        requantization.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    const int32_t *__restrict__ pMult;
+    const uint32_t *__restrict__ pShift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel batched matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t batchCount;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_batched_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel batched matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t batchCount;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_batched_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel batched matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t batchCount;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_batched_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel symmetric (plp_mat_syrk) and Hermitian
+ *        (plp_mat_herk) rank-k product.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_syrk_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel symmetric (plp_mat_syrk) and Hermitian
+ *        (plp_mat_herk) rank-k product.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    uint32_t M;
+    uint32_t N;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_syrk_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel symmetric (plp_mat_syrk) and
+ *        Hermitian (plp_mat_herk) rank-k product.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_syrk_instance_f32;
+
+/** -------------------------------------------------------
+   @brief      Compute the tile of the output matrix assigned to one core. Depending on M, O and
+               nPE, the output is split by rows, by columns or into a 2D grid of tiles, such that
+               all cores are used whatever the shape of the output is.
+   @param[in]  M      Height of the output matrix
+   @param[in]  O      Width of the output matrix
+   @param[in]  nPE    Number of cores used for the computation
+   @param[in]  coreId Id of the core for which the tile is computed
+   @param[out] pTile  The tile is written here (empty if the core has no work)
+   @return     none
+*/
+
+void plp_mat_partition(
+    uint32_t M, uint32_t O, uint32_t nPE, uint32_t coreId, plp_mat_tile *__restrict__ pTile);
+
+/** -------------------------------------------------------
+   @brief      Creates the plan of a matrix multiplication of fixed shape, which is then run with
+               plp_mat_mult_execute. The number of cores (PLP_AUTO is resolved here), the kernel
+               and the tiles of the cores are chosen once instead of in every call.
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and height of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  nPE    Number of cores to use, or PLP_AUTO
+   @param[in]  type   Element type of the matrices
+   @param[out] pPlan  The plan is written here
+   @return     none
+*/
+
+void plp_mat_mult_plan_create(
+    uint32_t M, uint32_t N, uint32_t O, uint32_t nPE, plp_mat_type type, plp_mat_mult_plan *pPlan);
+
+/** -------------------------------------------------------
+   @brief      Runs a matrix multiplication planned with plp_mat_mult_plan_create. The result is
+               the same as the one of plp_mat_mult_<type>_parallel (of plp_mat_mult_<type> on the
+               fabric controller).
+   @param[in]  pPlan  points to the plan
+   @param[in]  pSrcA  points to the first input matrix, of the type of the plan
+   @param[in]  pSrcB  points to the second input matrix, of the type of the plan
+   @param[out] pDstC  Output is written here, int32_t for the integer types
+   @return     none
+*/
+
+void plp_mat_mult_execute(const plp_mat_mult_plan *pPlan,
+                          const void *__restrict__ pSrcA,
+                          const void *__restrict__ pSrcB,
+                          void *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                      plp_mat_mult_i16_parallel
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for RV32IM
+               extension, in fixed point (see PLP_FC_FIXED_POINT).
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32s_rv32im(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
+   matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of half-precision floating-point
+               matrices. The products are accumulated in single precision.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f16(const float16_t *__restrict__ pSrcA,
+                      const float16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of half-precision floating-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f16s_xpulpv2(const float16_t *__restrict__ pSrcA,
+                               const float16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of half-precision
+               floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f16_parallel(const float16_t *__restrict__ pSrcA,
+                               const float16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Starts the parallel matrix multiplication of 32-bit integer matrices on the cluster,
+               and returns without waiting for it.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and height of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  nPE    Number of cores to use
+   @param[out] pDstC  Output is written here, valid after plp_async_wait
+   @param[out] handle handle of the call, wait for it with plp_async_wait
+   @return     none
+*/
+
+void plp_mat_mult_i32_async(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC,
+                            plp_async_handle *handle);
+
+/** -------------------------------------------------------
+   @brief      Starts the parallel matrix multiplication of 16-bit integer matrices on the cluster,
+               and returns without waiting for it.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and height of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  nPE    Number of cores to use
+   @param[out] pDstC  Output is written here, valid after plp_async_wait
+   @param[out] handle handle of the call, wait for it with plp_async_wait
+   @return     none
+*/
+
+void plp_mat_mult_i16_async(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC,
+                            plp_async_handle *handle);
+
+/** -------------------------------------------------------
+   @brief      Starts the parallel matrix multiplication of 8-bit integer matrices on the cluster,
+               and returns without waiting for it.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and height of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  nPE    Number of cores to use
+   @param[out] pDstC  Output is written here, valid after plp_async_wait
+   @param[out] handle handle of the call, wait for it with plp_async_wait
+   @return     none
+*/
+
+void plp_mat_mult_i8_async(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDstC,
+                           plp_async_handle *handle);
+
+/** -------------------------------------------------------
+   @brief      Starts the parallel matrix multiplication of 32-bit floating-point matrices on the
+               cluster, and returns without waiting for it.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and height of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  nPE    Number of cores to use
+   @param[out] pDstC  Output is written here, valid after plp_async_wait
+   @param[out] handle handle of the call, wait for it with plp_async_wait
+   @return     none
+*/
+
+void plp_mat_mult_f32_async(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t nPE,
+                            float *__restrict__ pDstC,
+                            plp_async_handle *handle);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix multiplication of half-precision floating-point matrices kernel for
+                XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f16 struct initialized by
+                      plp_mat_mult_f16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_f16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of an 8-bit with a 16-bit integer matrix. The
+               kernels are the ones of plp_mat_mult_stride_i8xi16.
+   @param[in]  pSrcA     points to the first input matrix [8 bit]
+   @param[in]  pSrcB     points to the second input matrix [16 bit]
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and hight of the second
+   @param[in]  O         width of the second input matrix
+   @param[out] pDstC     points to the output matrix [32 bit]
+   @return     none
+*/
+
+void plp_mat_mult_i8xi16(const int8_t *__restrict__ pSrcA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t M,
+                         uint32_t N,
+                         uint32_t O,
+                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of an 8-bit with a 16-bit integer
+               matrix.
+   @param[in]  pSrcA     points to the first input matrix [8 bit]
+   @param[in]  pSrcB     points to the second input matrix [16 bit]
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and hight of the second
+   @param[in]  O         width of the second input matrix
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDstC     points to the output matrix [32 bit]
+   @return     none
+*/
+
+void plp_mat_mult_i8xi16_parallel(const int8_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
+  matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_cmplx_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_cmplx_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_cmplx_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats with the 3M
+              algorithm, which uses three real multiplications per complex product
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+*/
+
+int plp_mat_mult_cmplx_3m_f32(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit floats with the 3M algorithm on
+              XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  pTmp  Points to a temporary buffer of N * O + N floats
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_3m_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                        const float *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        float *__restrict__ pTmp,
+                                        float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats with the
+              3M algorithm, which uses three real multiplications per complex product
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+*/
+
+int plp_mat_mult_cmplx_3m_f32_parallel(const float *__restrict__ pSrcA,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t nPE,
+                                       float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit floats with the 3M algorithm
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_3m_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_3m_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_3m_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
+               RV32IM extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                     plp_mat_mult_i16_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_trans_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_trans_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_trans_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_trans_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_trans_cmplx_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_trans_cmplx_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_trans_cmplx_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_trans_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_trans_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_trans_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t shift,
+                                 int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          uint32_t nPE,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_trans_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix addition of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_instance_i32 struct initialized by
+                    plp_mat_add_i32_parallel
+  @return     none
+*/
+
+void plp_mat_add_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix addition of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_instance_i16 struct initialized by
+                    plp_mat_add_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i8(const int8_t *__restrict__ pSrcA,
+                    const int8_t *__restrict__ pSrcB,
+                    uint32_t M,
+                    uint32_t N,
+                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_i8_parallel(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix addition of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_instance_i8 struct initialized by
+                    plp_mat_add_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_f32(const float *__restrict__ pSrcA,
+                     const float *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_f32_parallel(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix addition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_instance_f32 struct initialized by
+                    plp_mat_add_f32_parallel
+  @return     none
+*/
+
+void plp_mat_add_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix subtraction of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_sub_instance_i32 struct initialized by
+                    plp_mat_sub_i32_parallel
+  @return     none
+*/
+
+void plp_mat_sub_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix subtraction of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_sub_instance_i16 struct initialized by
+                    plp_mat_sub_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i8(const int8_t *__restrict__ pSrcA,
+                    const int8_t *__restrict__ pSrcB,
+                    uint32_t M,
+                    uint32_t N,
+                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_i8_parallel(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix subtraction of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_sub_instance_i8 struct initialized by
+                    plp_mat_sub_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_f32(const float *__restrict__ pSrcA,
+                     const float *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_f32_parallel(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix subtraction of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_sub_instance_f32 struct initialized by
+                    plp_mat_sub_f32_parallel
+  @return     none
+*/
+
+void plp_mat_sub_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief   Glue code for matrix scale of a 32-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return  none
+*/
+
+void plp_mat_scale_i32(const int32_t *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t scaleFactor,
+                       int32_t shift,
+                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief   matrix scale of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return  none
+*/
+
+void plp_mat_scale_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t scaleFactor,
+                               int32_t shift,
+                               int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix scale of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t scaleFactor,
+                                int32_t shift,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix scale of a 32-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i32_parallel(const int32_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t scaleFactor,
+                                int32_t shift,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix scale of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_instance_i32 struct initialized by
+                    plp_mat_scale_i32_parallel
+  @return     none
+*/
+
+void plp_mat_scale_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix scale of a 16-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i16(const int16_t *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       int16_t scaleFactor,
+                       int32_t shift,
+                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix scale of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int16_t scaleFactor,
+                               int32_t shift,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix scale of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                int16_t scaleFactor,
+                                int32_t shift,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix scale of a 16-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                int16_t scaleFactor,
+                                int32_t shift,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix scale of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_instance_i16 struct initialized by
+                    plp_mat_scale_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix scale of a 8-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i8(const int8_t *__restrict__ pSrc,
+                      uint32_t M,
+                      uint32_t N,
+                      int8_t scaleFactor,
+                      int32_t shift,
+                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix scale of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              int8_t scaleFactor,
+                              int32_t shift,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix scale of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int8_t scaleFactor,
+                               int32_t shift,
+                               int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix scale of a 8-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_i8_parallel(const int8_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int8_t scaleFactor,
+                               int32_t shift,
+                               uint32_t nPE,
+                               int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix scale of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_instance_i8 struct initialized by
+                    plp_mat_scale_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix scale of a 32-bit floating-point matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_f32(const float *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       float scaleFactor,
+                       float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix scale of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                float scaleFactor,
+                                float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix scale of a 32-bit floating-point matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  scaleFactor Factor to mulitply all elements
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_f32_parallel(const float *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                float scaleFactor,
+                                uint32_t nPE,
+                                float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix scale of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_instance_f32 struct initialized by
+                    plp_mat_scale_f32_parallel
+  @return  none
+*/
+
+void plp_mat_scale_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix addition of 32-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i32(int32_t *__restrict__ pSrcDstA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 32-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i32s_rv32im(int32_t *__restrict__ pSrcDstA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i32s_xpulpv2(int32_t *__restrict__ pSrcDstA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix addition of 32-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_add_inplace_i32_parallel(int32_t *__restrict__ pSrcDstA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix addition of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_inplace_instance_i32 struct initialized by
+                    plp_mat_add_inplace_i32_parallel
+  @return     none
+*/
+
+void plp_mat_add_inplace_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix addition of 16-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i16(int16_t *__restrict__ pSrcDstA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i16s_rv32im(int16_t *__restrict__ pSrcDstA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i16s_xpulpv2(int16_t *__restrict__ pSrcDstA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix addition of 16-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_add_inplace_i16_parallel(int16_t *__restrict__ pSrcDstA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix addition of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_inplace_instance_i16 struct initialized by
+                    plp_mat_add_inplace_i16_parallel
+  @return     none
+*/
+
+void plp_mat_add_inplace_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix addition of 8-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i8(int8_t *__restrict__ pSrcDstA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 8-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i8s_rv32im(int8_t *__restrict__ pSrcDstA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_i8s_xpulpv2(int8_t *__restrict__ pSrcDstA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix addition of 8-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_add_inplace_i8_parallel(int8_t *__restrict__ pSrcDstA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix addition of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_inplace_instance_i8 struct initialized by
+                    plp_mat_add_inplace_i8_parallel
+  @return     none
+*/
+
+void plp_mat_add_inplace_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix addition of 32-bit floating-point matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_f32(float *__restrict__ pSrcDstA,
+                             const float *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix addition of 32-bit floating-point matrices kernel for XPULPV2
+              extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_add_inplace_f32s_xpulpv2(float *__restrict__ pSrcDstA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix addition of 32-bit floating-point matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_add_inplace_f32_parallel(float *__restrict__ pSrcDstA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix addition of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_add_inplace_instance_f32 struct initialized by
+                    plp_mat_add_inplace_f32_parallel
+  @return     none
+*/
+
+void plp_mat_add_inplace_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix subtraction of 32-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i32(int32_t *__restrict__ pSrcDstA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 32-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i32s_rv32im(int32_t *__restrict__ pSrcDstA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i32s_xpulpv2(int32_t *__restrict__ pSrcDstA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix subtraction of 32-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i32_parallel(int32_t *__restrict__ pSrcDstA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix subtraction of 32-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_sub_inplace_instance_i32 struct initialized by
+                    plp_mat_sub_inplace_i32_parallel
+  @return     none
+*/
+
+void plp_mat_sub_inplace_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix subtraction of 16-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i16(int16_t *__restrict__ pSrcDstA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i16s_rv32im(int16_t *__restrict__ pSrcDstA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i16s_xpulpv2(int16_t *__restrict__ pSrcDstA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix subtraction of 16-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i16_parallel(int16_t *__restrict__ pSrcDstA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix subtraction of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_sub_inplace_instance_i16 struct initialized by
+                    plp_mat_sub_inplace_i16_parallel
+  @return     none
+*/
+
+void plp_mat_sub_inplace_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix subtraction of 8-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i8(int8_t *__restrict__ pSrcDstA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 8-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i8s_rv32im(int8_t *__restrict__ pSrcDstA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i8s_xpulpv2(int8_t *__restrict__ pSrcDstA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix subtraction of 8-bit integer matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_sub_inplace_i8_parallel(int8_t *__restrict__ pSrcDstA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix subtraction of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_sub_inplace_instance_i8 struct initialized by
+                    plp_mat_sub_inplace_i8_parallel
+  @return     none
+*/
+
+void plp_mat_sub_inplace_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix subtraction of 32-bit floating-point matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_f32(float *__restrict__ pSrcDstA,
+                             const float *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix subtraction of 32-bit floating-point matrices kernel for XPULPV2
+              extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+*/
+
+void plp_mat_sub_inplace_f32s_xpulpv2(float *__restrict__ pSrcDstA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix subtraction of 32-bit floating-point matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_sub_inplace_f32_parallel(float *__restrict__ pSrcDstA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix subtraction of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_sub_inplace_instance_f32 struct initialized by
+                    plp_mat_sub_inplace_f32_parallel
+  @return     none
+*/
+
+void plp_mat_sub_inplace_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix scale of 32-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i32(int32_t *__restrict__ pSrcDst,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t scaleFactor,
+                               int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 32-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i32s_rv32im(int32_t *__restrict__ pSrcDst,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int32_t scaleFactor,
+                                       int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i32s_xpulpv2(int32_t *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int32_t scaleFactor,
+                                        int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix scale of 32-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @param[in]     nPE         Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i32_parallel(int32_t *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int32_t scaleFactor,
+                                        int32_t shift,
+                                        uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix scale of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_inplace_instance_i32 struct initialized by
+                    plp_mat_scale_inplace_i32_parallel
+  @return     none
+*/
+
+void plp_mat_scale_inplace_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix scale of 16-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i16(int16_t *__restrict__ pSrcDst,
+                               uint32_t M,
+                               uint32_t N,
+                               int16_t scaleFactor,
+                               int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i16s_rv32im(int16_t *__restrict__ pSrcDst,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int16_t scaleFactor,
+                                       int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i16s_xpulpv2(int16_t *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int16_t scaleFactor,
+                                        int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix scale of 16-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @param[in]     nPE         Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i16_parallel(int16_t *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int16_t scaleFactor,
+                                        int32_t shift,
+                                        uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix scale of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_inplace_instance_i16 struct initialized by
+                    plp_mat_scale_inplace_i16_parallel
+  @return     none
+*/
+
+void plp_mat_scale_inplace_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix scale of 8-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i8(int8_t *__restrict__ pSrcDst,
+                              uint32_t M,
+                              uint32_t N,
+                              int8_t scaleFactor,
+                              int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 8-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i8s_rv32im(int8_t *__restrict__ pSrcDst,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      int8_t scaleFactor,
+                                      int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i8s_xpulpv2(int8_t *__restrict__ pSrcDst,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int8_t scaleFactor,
+                                       int32_t shift);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix scale of 8-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @param[in]     nPE         Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_scale_inplace_i8_parallel(int8_t *__restrict__ pSrcDst,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int8_t scaleFactor,
+                                       int32_t shift,
+                                       uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix scale of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_scale_inplace_instance_i8 struct initialized by
+                    plp_mat_scale_inplace_i8_parallel
+  @return     none
+*/
+
+void plp_mat_scale_inplace_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place matrix scale of 32-bit floating-point matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements
+  @return        none
+*/
+
+void plp_mat_scale_inplace_f32(float *__restrict__ pSrcDst,
+                               uint32_t M,
+                               uint32_t N,
+                               float scaleFactor);
+
+/** -------------------------------------------------------
+  @brief      In-place matrix scale of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements
+  @return        none
+*/
+
+void plp_mat_scale_inplace_f32s_xpulpv2(float *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        float scaleFactor);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place matrix scale of 32-bit floating-point matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements
+  @param[in]     nPE         Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_scale_inplace_f32_parallel(float *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        float scaleFactor,
+                                        uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place matrix scale of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_scale_inplace_instance_f32 struct initialized by
+                    plp_mat_scale_inplace_f32_parallel
+  @return     none
+*/
+
+void plp_mat_scale_inplace_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief   Glue code for matrix transpose of a 32-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return  none
+*/
+
+void plp_mat_trans_i32(const int32_t *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief   matrix transpose of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return  none
+*/
+
+void plp_mat_trans_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix transpose of a 32-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i32_parallel(const int32_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix transpose of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_instance_i32 struct initialized by
+                    plp_mat_trans_i32_parallel
+  @return     none
+*/
+
+void plp_mat_trans_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix transpose of a 16-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i16(const int16_t *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix transpose of a 16-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix transpose of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_instance_i16 struct initialized by
+                    plp_mat_trans_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_trans_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix transpose of a 8-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i8(const int8_t *__restrict__ pSrc,
+                      uint32_t M,
+                      uint32_t N,
+                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix transpose of a 8-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i8_parallel(const int8_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix transpose of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_trans_instance_i8 struct initialized by
+  plp_mat_trans_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_trans_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix transpose of a 32-bit float*ing-point matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_i32s_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_f32(const float *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix transpose of a 32-bit float*ing-point matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_f32_parallel(
+    const float *__restrict__ pSrc, uint32_t M, uint32_t N, uint32_t nPE, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_stride_i32 for its computation.
+*/
+
+void plp_mat_trans_cmplx_i16(const int16_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_stride_i32 for its computation.
+*/
+
+void plp_mat_trans_cmplx_q16(const int16_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_cmplx_i32(const int32_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_cmplx_stride_i32 for its computation.
+*/
+
+void plp_mat_trans_cmplx_f32(const float *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_cmplx_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_cmplx_f32_parallel(const float *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE,
+                                      float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for conjugate transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_i16(const int16_t *__restrict__ pSrc,
+                           uint32_t M,
+                           uint32_t N,
+                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel conjugate transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_i16_parallel(const int16_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for conjugate transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_q16(const int16_t *__restrict__ pSrc,
+                           uint32_t M,
+                           uint32_t N,
+                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel conjugate transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_q16_parallel(const int16_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for conjugate transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_i32(const int32_t *__restrict__ pSrc,
+                           uint32_t M,
+                           uint32_t N,
+                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel conjugate transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_i32_parallel(const int32_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for conjugate transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_f32(const float *__restrict__ pSrc,
+                           uint32_t M,
+                           uint32_t N,
+                           float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel conjugate transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_f32_parallel(const float *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix inverse of a 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the first input matrix. pSrc is modified by this funciton
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the output matrix
+  @return     none
+*/
+
+int plp_mat_inv_f32(float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix inverse of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrc Points to the first input matrix. pSrc is modified by this funciton
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the output matrix
+  @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_inv_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix inverse of a 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the first input matrix. pSrc is modified by this funciton
+  @param[in]  N    Width and height of both matrices
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
+                             uint32_t N,
+                             uint32_t nPE,
+                             float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix inverse of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
+                    plp_mat_inv_f32_parallel. The status field is set to 0 on success,
+                    and to 1 if the matrix is singular.
+  @return     none
+*/
+
+void plp_mat_inv_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix inversion of 32-bit fixed-point matrices.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 31
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_q32(int32_t *__restrict__ pSrc,
+                    uint32_t N,
+                    uint32_t fracBits,
+                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Matrix inversion of 32-bit fixed-point matrices kernel for RV32IM extension.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 31
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_q32s_rv32im(int32_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Matrix inversion of 32-bit fixed-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 31
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_q32s_xpulpv2(int32_t *__restrict__ pSrc,
+                             uint32_t N,
+                             uint32_t fracBits,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix inversion of 16-bit fixed-point matrices.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 15
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_q16(int16_t *__restrict__ pSrc,
+                    uint32_t N,
+                    uint32_t fracBits,
+                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Matrix inversion of 16-bit fixed-point matrices kernel for RV32IM extension.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 15
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_q16s_rv32im(int16_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Matrix inversion of 16-bit fixed-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 15
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_q16s_xpulpv2(int16_t *__restrict__ pSrc,
+                             uint32_t N,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the closed-form inversion of 32-bit floating-point matrices of size 1x1
+              to 4x4.
+  @param[in]  pSrc Points to the input matrix, which is not modified
+  @param[in]  N    Width and height of both matrices, 1 to 4
+  @param[out] pDst Points to the output matrix, which may be the input matrix
+  @param[out] pDet Points to the determinant of the input matrix, or NULL
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_small_f32(const float *pSrc, uint32_t N, float *pDst, float *pDet);
+
+/** -------------------------------------------------------
+  @brief      Closed-form inversion of 32-bit floating-point matrices of size 1x1 to 4x4 kernel for
+              XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix, which is not modified
+  @param[in]  N    Width and height of both matrices, 1 to 4
+  @param[out] pDst Points to the output matrix, which may be the input matrix
+  @param[out] pDet Points to the determinant of the input matrix, or NULL
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_small_f32s_xpulpv2(const float *pSrc, uint32_t N, float *pDst, float *pDet);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the closed-form determinant of 32-bit floating-point matrices of size
+              1x1 to 4x4.
+  @param[in]  pSrc Points to the input matrix
+  @param[in]  N    Width and height of the matrix, 1 to 4
+  @param[out] pDet Points to the determinant
+  @return     0: Success, 2: operation not supported
+*/
+
+int plp_mat_det_small_f32(const float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDet);
+
+/** -------------------------------------------------------
+  @brief      Closed-form determinant of 32-bit floating-point matrices of size 1x1 to 4x4 kernel
+              for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix
+  @param[in]  N    Width and height of the matrix, 1 to 4
+  @param[out] pDet Points to the determinant
+  @return     0: Success, 2: operation not supported
+*/
+
+int plp_mat_det_small_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                   uint32_t N,
+                                   float *__restrict__ pDet);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel closed-form inversion of a batch of 32-bit floating-point
+              matrices of size 1x1 to 4x4. Whole matrices of the batch are distributed onto the
+              cores.
+  @param[in]  pSrc       Points to the first matrix of the input batch, which is not modified
+  @param[in]  N          Width and height of every matrix, 1 to 4
+  @param[in]  batchCount Number of matrices, which are stored one after the other
+  @param[in]  nPE        Number of cores to use
+  @param[out] pDst       Points to the first matrix of the output batch, which may be pSrc
+  @param[out] pDet       Points to the batchCount determinants of the input matrices, or NULL
+  @return     0: Success, 1: At least one matrix is singular (see pDet), 2: operation not
+              supported
+*/
+
+int plp_mat_inv_small_batched_f32(const float *pSrc,
+                                  uint32_t N,
+                                  uint32_t batchCount,
+                                  uint32_t nPE,
+                                  float *pDst,
+                                  float *pDet);
+
+/** -------------------------------------------------------
+  @brief      Parallel closed-form inversion of a batch of 32-bit floating-point matrices of size
+              1x1 to 4x4 kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_inv_small_batched_instance_f32 struct initialized by
+                    plp_mat_inv_small_batched_f32. The status field is set to 1 if a matrix is
+                    singular.
+  @return     none
+*/
+
+void plp_mat_inv_small_batched_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for LU decomposition with partial pivoting of 32-bit floating-point
+              matrices.
+  @param[in]  pSrc  Points to the input matrix A of shape NxN
+  @param[in]  N     Width and height of the matrices
+  @param[out] pLU   Points to the output matrix of shape NxN, with L below and U on and above the
+                    diagonal
+  @param[out] pPerm Points to the output permutation vector of length N
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_f32(const float *__restrict__ pSrc,
+                   uint32_t N,
+                   float *__restrict__ pLU,
+                   uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief      LU decomposition with partial pivoting of 32-bit floating-point matrices kernel for
+              XPULPV2 extension.
+  @param[in]  pSrc  Points to the input matrix A of shape NxN
+  @param[in]  N     Width and height of the matrices
+  @param[out] pLU   Points to the output matrix of shape NxN, with L below and U on and above the
+                    diagonal
+  @param[out] pPerm Points to the output permutation vector of length N
+  @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_f32s_xpulpv2(const float *__restrict__ pSrc,
+                            uint32_t N,
+                            float *__restrict__ pLU,
+                            uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief      Glue code for solving linear systems A * X = B of 32-bit floating-point matrices
+              with the LU decomposition of A.
+  @param[in]  pLU   Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm Points to the permutation vector, computed by plp_mat_lu_f32
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+  @param[in]  N     Width and height of A, height of B and X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_solve_f32(const float *__restrict__ pLU,
+                         const uint32_t *__restrict__ pPerm,
+                         const float *__restrict__ pSrcB,
+                         uint32_t N,
+                         uint32_t O,
+                         float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+  @brief      Solving linear systems A * X = B of 32-bit floating-point matrices with the LU
+              decomposition of A kernel for XPULPV2 extension.
+  @param[in]  pLU   Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm Points to the permutation vector, computed by plp_mat_lu_f32
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+  @param[in]  N     Width and height of A, height of B and X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_solve_f32s_xpulpv2(const float *__restrict__ pLU,
+                                  const uint32_t *__restrict__ pPerm,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel solving of linear systems A * X = B of 32-bit floating-point
+              matrices with the LU decomposition of A.
+  @param[in]  pLU   Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm Points to the permutation vector, computed by plp_mat_lu_f32
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+  @param[in]  N     Width and height of A, height of B and X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_solve_f32_parallel(const float *__restrict__ pLU,
+                                  const uint32_t *__restrict__ pPerm,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+  @brief Parallel solving of linear systems A * X = B of 32-bit floating-point matrices with the LU
+         decomposition of A kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_lu_solve_instance_f32 struct initialized by
+                    plp_mat_lu_solve_f32_parallel. The status field is set to 0 on success,
+                    and to 1 if the matrix is singular.
+  @return     none
+*/
+
+void plp_mat_lu_solve_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for QR decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the input matrix A of shape MxN
+  @param[in]  M    Height of A, width and height of Q
+  @param[in]  N    Width of A
+  @param[out] pQ   Points to the output matrix Q of shape MxM, or NULL if Q is not needed
+  @param[out] pR   Points to the output matrix R of shape MxN
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported
+*/
+
+int plp_mat_qr_f32(const float *__restrict__ pSrc,
+                   uint32_t M,
+                   uint32_t N,
+                   float *__restrict__ pQ,
+                   float *__restrict__ pR);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel QR decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the input matrix A of shape MxN
+  @param[in]  M    Height of A, width and height of Q
+  @param[in]  N    Width of A
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pQ   Points to the output matrix Q of shape MxM, or NULL if Q is not needed
+  @param[out] pR   Points to the output matrix R of shape MxN
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported
+*/
+
+int plp_mat_qr_f32_parallel(const float *__restrict__ pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t nPE,
+                            float *__restrict__ pQ,
+                            float *__restrict__ pR);
+
+/** -------------------------------------------------------
+  @brief      In-place QR decomposition of 32-bit floating-point matrices kernel for XPULPV2
+              extension.
+  @param[in,out] pR   Points to the matrix of shape MxN, which is replaced by R
+  @param[in]     M    Height of R, width and height of Q
+  @param[in]     N    Width of R
+  @param[in]     K    Number of columns to reflect (the first K columns of R become upper
+                      triangular)
+  @param[in]     pTmp Points to a temporary buffer of 2 * M + N floats
+  @param[in,out] pQ   Points to the matrix Q of shape MxM, which is multiplied with the
+                      reflections, or NULL
+  @return     none
+*/
+
+void plp_mat_qr_f32s_xpulpv2(float *__restrict__ pR,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t K,
+                             float *__restrict__ pTmp,
+                             float *__restrict__ pQ);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place QR decomposition of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_qr_instance_f32 struct initialized by
+                    plp_mat_qr_f32_parallel
+  @return     none
+*/
+
+void plp_mat_qr_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for QR decomposition of complex 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the complex input matrix A of shape MxN
+  @param[in]  M    Height of A, width and height of Q
+  @param[in]  N    Width of A
+  @param[out] pQ   Points to the complex output matrix Q of shape MxM, or NULL if Q is not needed
+  @param[out] pR   Points to the complex output matrix R of shape MxN
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported
+*/
+
+int plp_mat_qr_cmplx_f32(const float *__restrict__ pSrc,
+                         uint32_t M,
+                         uint32_t N,
+                         float *__restrict__ pQ,
+                         float *__restrict__ pR);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel QR decomposition of complex 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the complex input matrix A of shape MxN
+  @param[in]  M    Height of A, width and height of Q
+  @param[in]  N    Width of A
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pQ   Points to the complex output matrix Q of shape MxM, or NULL if Q is not needed
+  @param[out] pR   Points to the complex output matrix R of shape MxN
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported
+*/
+
+int plp_mat_qr_cmplx_f32_parallel(const float *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t nPE,
+                                  float *__restrict__ pQ,
+                                  float *__restrict__ pR);
+
+/** -------------------------------------------------------
+  @brief      In-place QR decomposition of complex 32-bit floating-point matrices kernel for XPULPV2
+              extension.
+  @param[in,out] pR   Points to the complex matrix of shape MxN, which is replaced by R
+  @param[in]     M    Height of R, width and height of Q
+  @param[in]     N    Width of R
+  @param[in]     K    Number of columns to reflect (the first K columns of R become upper
+                      triangular)
+  @param[in]     pTmp Points to a temporary buffer of 2 * (3 * M + N) floats
+  @param[in,out] pQ   Points to the complex matrix Q of shape MxM, which is multiplied with the
+                      reflections, or NULL
+  @return     none
+*/
+
+void plp_mat_qr_cmplx_f32s_xpulpv2(float *__restrict__ pR,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t K,
+                                   float *__restrict__ pTmp,
+                                   float *__restrict__ pQ);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place QR decomposition of complex 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_qr_instance_f32 struct initialized by
+                    plp_mat_qr_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_qr_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for eigenvalue decomposition of symmetric 32-bit floating-point matrices.
+  @param[in]  pSrc     Points to the symmetric input matrix A of shape NxN
+  @param[in]  N        Width and height of A
+  @param[out] pEigVal  Points to the N eigenvalues, in ascending order
+  @param[out] pEigVec  Points to the output matrix V of shape NxN, whose column i is the
+                       eigenvector of pEigVal[i], or NULL if the eigenvectors are not needed
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported, 3: No convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps
+*/
+
+int plp_mat_eig_sym_f32(const float *__restrict__ pSrc,
+                        uint32_t N,
+                        float *__restrict__ pEigVal,
+                        float *__restrict__ pEigVec);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel eigenvalue decomposition of symmetric 32-bit floating-point
+              matrices.
+  @param[in]  pSrc     Points to the symmetric input matrix A of shape NxN
+  @param[in]  N        Width and height of A
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pEigVal  Points to the N eigenvalues, in ascending order
+  @param[out] pEigVec  Points to the output matrix V of shape NxN, whose column i is the
+                       eigenvector of pEigVal[i], or NULL if the eigenvectors are not needed
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported, 3: No convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps
+*/
+
+int plp_mat_eig_sym_f32_parallel(const float *__restrict__ pSrc,
+                                 uint32_t N,
+                                 uint32_t nPE,
+                                 float *__restrict__ pEigVal,
+                                 float *__restrict__ pEigVec);
+
+/** -------------------------------------------------------
+  @brief      In-place eigenvalue decomposition of symmetric 32-bit floating-point matrices kernel
+              for XPULPV2 extension.
+  @param[in,out] pA       Points to the symmetric matrix of shape NxN, which is diagonalized
+  @param[in]     N        Width and height of A
+  @param[out]    pEigVal  Points to the N eigenvalues, in ascending order
+  @param[in,out] pEigVec  Points to the matrix V of shape NxN, which must be initialized to the
+                          identity matrix, or NULL. Column i is replaced by the eigenvector of
+                          pEigVal[i].
+  @return     0: Success, 3: No convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps
+*/
+
+int plp_mat_eig_sym_f32s_xpulpv2(float *__restrict__ pA,
+                                 uint32_t N,
+                                 float *__restrict__ pEigVal,
+                                 float *__restrict__ pEigVec);
+
+/** -------------------------------------------------------
+  @brief Parallel in-place eigenvalue decomposition of symmetric 32-bit floating-point matrices
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_eig_sym_instance_f32 struct initialized by
+                    plp_mat_eig_sym_f32_parallel. The status field is set to 0 on success, and to
+                    3 if there is no convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps.
+  @return     none
+*/
+
+void plp_mat_eig_sym_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the prediction step of the 32-bit floating-point Kalman filter.
+  @param[in,out] S  points to the instance of the Kalman filter, whose state pX and covariance pP
+                    are updated
+  @return     none
+*/
+
+void plp_kalman_predict_f32(plp_kalman_instance_f32 *S);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the measurement update of the 32-bit floating-point Kalman filter.
+  @param[in,out] S   points to the instance of the Kalman filter, whose state pX and covariance pP
+                     are updated
+  @param[in]     pZ  points to the measurement vector of size m
+  @return     0: Success, 1: Innovation covariance is not positive definite, 2: operation not
+              supported
+*/
+
+int plp_kalman_update_f32(plp_kalman_instance_f32 *S, const float *__restrict__ pZ);
+
+/** -------------------------------------------------------
+  @brief      Prediction step of the 32-bit floating-point Kalman filter for XPULPV2 extension.
+  @param[in,out] S  points to the instance of the Kalman filter, whose state pX and covariance pP
+                    are updated
+  @return     none
+*/
+
+void plp_kalman_predict_f32s_xpulpv2(plp_kalman_instance_f32 *S);
+
+/** -------------------------------------------------------
+  @brief      Measurement update of the 32-bit floating-point Kalman filter for XPULPV2 extension.
+  @param[in,out] S   points to the instance of the Kalman filter, whose state pX and covariance pP
+                     are updated
+  @param[in]     pZ  points to the measurement vector of size m
+  @return     0: Success, 1: Innovation covariance is not positive definite
+*/
+
+int plp_kalman_update_f32s_xpulpv2(plp_kalman_instance_f32 *S, const float *__restrict__ pZ);
+
+/** -------------------------------------------------------
+  @brief      Glue code for least-squares solution of A * X = B of 32-bit floating-point matrices.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape MxO
+  @param[in]  M     Height of A and B
+  @param[in]  N     Width of A, height of X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: A does not have full column rank or M < N, 2: operation not supported
+              or not enough memory for the temporary buffer
+*/
+
+int plp_mat_lstsq_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel least-squares solution of A * X = B of 32-bit floating-point
+              matrices.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape MxO
+  @param[in]  M     Height of A and B
+  @param[in]  N     Width of A, height of X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: A does not have full column rank or M < N, 2: operation not supported
+              or not enough memory for the temporary buffer
+*/
+
+int plp_mat_lstsq_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 8-bit integer matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8(const int8_t *__restrict__ pSrcA,
+                         const int8_t *__restrict__ pSrcX,
+                         uint32_t M,
+                         uint32_t N,
+                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 8-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcX,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 8-bit integer matrices, y = A *
+         x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i8 struct initialized by
+                    plp_mat_vec_mult_i8_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication with a palettized 4-bit matrix, y = A * x.
+              Every value of A is one of the 16 entries of the codebook, of which A stores the
+              4-bit index, packed like the sub-byte matrices: a row takes ceil(N / 8) words.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_compressed_i8(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pCodebook,
+                                    const int8_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication with a palettized 4-bit matrix kernel for RV32IM
+              extension.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_compressed_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                            const int8_t *__restrict__ pCodebook,
+                                            const int8_t *__restrict__ pSrcX,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication with a palettized 4-bit matrix kernel for XPULPV2
+              extension.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_compressed_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                             const int8_t *__restrict__ pCodebook,
+                                             const int8_t *__restrict__ pSrcX,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication with a palettized 4-bit matrix,
+              y = A * x.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_compressed_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                             const int8_t *__restrict__ pCodebook,
+                                             const int8_t *__restrict__ pSrcX,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t nPE,
+                                             int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication with a palettized 4-bit matrix kernel for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_compressed_instance_i8 struct initialized by
+                    plp_mat_vec_mult_compressed_i8_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_compressed_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of an 8-bit integer matrix with a 16-bit
+              integer vector, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN [8 bit]
+  @param[in]  pSrcX Points to the input vector x of length N [16 bit]
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8xi16(const int8_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of an 8-bit integer matrix with a 16-bit integer vector
+              kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN [8 bit]
+  @param[in]  pSrcX Points to the input vector x of length N [16 bit]
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8xi16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcX,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of an 8-bit integer matrix with a 16-bit integer vector
+              kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN [8 bit]
+  @param[in]  pSrcX Points to the input vector x of length N [16 bit]
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of an 8-bit integer matrix with a
+              16-bit integer vector, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN [8 bit]
+  @param[in]  pSrcX Points to the input vector x of length N [16 bit]
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8xi16_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of an 8-bit integer matrix with a 16-bit integer
+              vector kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i8xi16 struct initialized by
+                    plp_mat_vec_mult_i8xi16_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_i8xi16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 16-bit integer matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i16(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 16-bit integer matrices, y = A
+         * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i16 struct initialized by
+                    plp_mat_vec_mult_i16_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 32-bit integer matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i32(const int32_t *__restrict__ pSrcA,
+                          const int32_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 32-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 32-bit integer matrices, y = A
+         * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 32-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i32 struct initialized by
+                    plp_mat_vec_mult_i32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 8-bit fix-point matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q8(const int8_t *__restrict__ pSrcA,
+                         const int8_t *__restrict__ pSrcX,
+                         uint32_t M,
+                         uint32_t N,
+                         uint32_t shift,
+                         int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 8-bit fix-point matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcX,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t shift,
+                                 int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t shift,
+                                  int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 8-bit fix-point matrices, y = A
+         * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t shift,
+                                  uint32_t nPE,
+                                  int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 8-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q8 struct initialized by
+                    plp_mat_vec_mult_q8_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 16-bit fix-point matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q16(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t shift,
+                          int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 16-bit fix-point matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 16-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 16-bit fix-point matrices, y =
+         A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 16-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q16 struct initialized by
+                    plp_mat_vec_mult_q16_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 32-bit fix-point matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q32(const int32_t *__restrict__ pSrcA,
+                          const int32_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t shift,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 32-bit fix-point matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t shift,
+                                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 32-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 32-bit fix-point matrices, y =
+         A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_vec_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 32-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q32 struct initialized by
+                    plp_mat_vec_mult_q32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of 32-bit floating-point matrices, y = A *
+         x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_f32(const float *__restrict__ pSrcA,
+                          const float *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of 32-bit floating-point matrices,
+         y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_f32_parallel(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t nPE,
+                                   float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_f32 struct initialized by
+                    plp_mat_vec_mult_f32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of complex 16-bit fix-point matrices,
+         y = A * x.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+*/
+
+void plp_mat_vec_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t shift,
+                                int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of complex 16-bit fix-point matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+*/
+
+void plp_mat_vec_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of complex 16-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+*/
+
+void plp_mat_vec_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of complex 16-bit fix-point
+         matrices, y = A * x.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+*/
+
+void plp_mat_vec_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         uint32_t nPE,
+                                         int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of complex 16-bit fix-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q16 struct initialized by
+                    plp_mat_vec_mult_cmplx_q16_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix vector multiplication of complex 32-bit floating-point matrices,
+         y = A * x.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_f32(const float *__restrict__ pSrcA,
+                                const float *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Matrix vector multiplication of complex 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix vector multiplication of complex 32-bit floating-point
+         matrices, y = A * x.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix vector multiplication of complex 32-bit floating-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_f32 struct initialized by
+                    plp_mat_vec_mult_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix vector multiplication of complex 16-bit fix-point
+         matrices, y_b = A_b * x_b for b = 0 to batchCount - 1.
+  @param[in]  pSrcA      points to the first matrix of the batch, each of shape MxN
+  @param[in]  pSrcX      points to the first input vector of the batch, each of length N
+  @param[in]  M          Height of each matrix, length of each output vector
+  @param[in]  N          Width of each matrix, length of each input vector
+  @param[in]  batchCount number of matrix vector multiplications
+  @param[in]  strideA    number of complex elements between two matrices (may be 0)
+  @param[in]  strideX    number of complex elements between two input vectors
+  @param[in]  strideY    number of complex elements between two output vectors
+  @param[in]  shift      Amount to shift the partial sums to the right
+  @param[in]  nPE        Number of cores to use for computation
+  @param[out] pDstY      points to the first output vector of the batch
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+*/
+
+void plp_mat_vec_mult_cmplx_batched_q16(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t batchCount,
+                                        uint32_t strideA,
+                                        uint32_t strideX,
+                                        uint32_t strideY,
+                                        uint32_t shift,
+                                        uint32_t nPE,
+                                        int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix vector multiplication of complex 16-bit fix-point matrices
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_cmplx_batched_instance_q16 struct initialized by
+                    plp_mat_vec_mult_cmplx_batched_q16
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_batched_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix vector multiplication of complex 32-bit floating-point
+         matrices, y_b = A_b * x_b for b = 0 to batchCount - 1.
+  @param[in]  pSrcA      points to the first matrix of the batch, each of shape MxN
+  @param[in]  pSrcX      points to the first input vector of the batch, each of length N
+  @param[in]  M          Height of each matrix, length of each output vector
+  @param[in]  N          Width of each matrix, length of each input vector
+  @param[in]  batchCount number of matrix vector multiplications
+  @param[in]  strideA    number of complex elements between two matrices (may be 0)
+  @param[in]  strideX    number of complex elements between two input vectors
+  @param[in]  strideY    number of complex elements between two output vectors
+  @param[in]  nPE        Number of cores to use for computation
+  @param[out] pDstY      points to the first output vector of the batch
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_batched_f32(const float *__restrict__ pSrcA,
+                                        const float *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t batchCount,
+                                        uint32_t strideA,
+                                        uint32_t strideX,
+                                        uint32_t strideY,
+                                        uint32_t nPE,
+                                        float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix vector multiplication of complex 32-bit floating-point
+         matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_cmplx_batched_instance_f32 struct initialized by
+                    plp_mat_vec_mult_cmplx_batched_f32
+  @return     none
+*/
+
+void plp_mat_vec_mult_cmplx_batched_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 8-bit integer matrices, y =
+         A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i8(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 8-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                       const int8_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 8-bit integer
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t nPE,
+                                        int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 8-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i8 struct initialized by
+                    plp_mat_trans_vec_mult_i8_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 16-bit integer matrices, y =
+         A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i16(const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 16-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 16-bit integer
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 16-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i16 struct initialized by
+                    plp_mat_trans_vec_mult_i16_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 32-bit integer matrices, y =
+         A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i32(const int32_t *__restrict__ pSrcA,
+                                const int32_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 32-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                        const int32_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 32-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 32-bit integer
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 32-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i32 struct initialized by
+                    plp_mat_trans_vec_mult_i32_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 8-bit fix-point matrices, y =
+         A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q8(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t shift,
+                               int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 8-bit fix-point matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                       const int8_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t shift,
+                                       int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 8-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 8-bit fix-point
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of four, as computed by one SIMD dot product, and every group
+  is rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q8. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        uint32_t nPE,
+                                        int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 8-bit fix-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q8 struct initialized by
+                    plp_mat_trans_vec_mult_q8_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the outer product of 32-bit integer vectors, C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i32(const int32_t *__restrict__ pSrcX,
+                       const int32_t *__restrict__ pSrcY,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 32-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i32s_rv32im(const int32_t *__restrict__ pSrcX,
+                               const int32_t *__restrict__ pSrcY,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i32s_xpulpv2(const int32_t *__restrict__ pSrcX,
+                                const int32_t *__restrict__ pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel outer product of 32-bit integer vectors, C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i32_parallel(const int32_t *__restrict__ pSrcX,
+                                const int32_t *__restrict__ pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel outer product of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_outer_instance_i32 struct initialized by
+                    plp_mat_outer_i32_parallel
+  @return     none
+*/
+
+void plp_mat_outer_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the outer product of 16-bit integer vectors with 32-bit output, C = x *
+               y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i16(const int16_t *__restrict__ pSrcX,
+                       const int16_t *__restrict__ pSrcY,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 16-bit integer vectors with 32-bit output kernel for RV32IM
+               extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i16s_rv32im(const int16_t *__restrict__ pSrcX,
+                               const int16_t *__restrict__ pSrcY,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 16-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                                const int16_t *__restrict__ pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel outer product of 16-bit integer vectors with 32-bit output,
+               C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i16_parallel(const int16_t *__restrict__ pSrcX,
+                                const int16_t *__restrict__ pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel outer product of 16-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  args  pointer to plp_mat_outer_instance_i16 struct initialized by
+                    plp_mat_outer_i16_parallel
+  @return     none
+*/
+
+void plp_mat_outer_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the outer product of 8-bit integer vectors with 32-bit output, C = x *
+               y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i8(const int8_t *__restrict__ pSrcX,
+                      const int8_t *__restrict__ pSrcY,
+                      uint32_t M,
+                      uint32_t N,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 8-bit integer vectors with 32-bit output kernel for RV32IM extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i8s_rv32im(const int8_t *__restrict__ pSrcX,
+                              const int8_t *__restrict__ pSrcY,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 8-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i8s_xpulpv2(const int8_t *__restrict__ pSrcX,
+                               const int8_t *__restrict__ pSrcY,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel outer product of 8-bit integer vectors with 32-bit output,
+               C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_i8_parallel(const int8_t *__restrict__ pSrcX,
+                               const int8_t *__restrict__ pSrcY,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel outer product of 8-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  args  pointer to plp_mat_outer_instance_i8 struct initialized by
+                    plp_mat_outer_i8_parallel
+  @return     none
+*/
+
+void plp_mat_outer_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the outer product of 32-bit floating-point vectors, C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_f32(const float *__restrict__ pSrcX,
+                       const float *__restrict__ pSrcY,
+                       uint32_t M,
+                       uint32_t N,
+                       float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Outer product of 32-bit floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_f32s_xpulpv2(const float *__restrict__ pSrcX,
+                                const float *__restrict__ pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel outer product of 32-bit floating-point vectors, C = x *
+               y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+*/
+
+void plp_mat_outer_f32_parallel(const float *__restrict__ pSrcX,
+                                const float *__restrict__ pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t nPE,
+                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel outer product of 32-bit floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_outer_instance_f32 struct initialized by
+                    plp_mat_outer_f32_parallel
+  @return     none
+*/
+
+void plp_mat_outer_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the rank-1 update of 32-bit integer vectors, A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i32(const int32_t *__restrict__ pSrcX,
+                              const int32_t *__restrict__ pSrcY,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 32-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i32s_rv32im(const int32_t *__restrict__ pSrcX,
+                                      const int32_t *__restrict__ pSrcY,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i32s_xpulpv2(const int32_t *__restrict__ pSrcX,
+                                       const int32_t *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel rank-1 update of 32-bit integer vectors, A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in]  nPE   Number of cores to use for computation
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i32_parallel(const int32_t *__restrict__ pSrcX,
+                                       const int32_t *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Parallel rank-1 update of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_rank1_update_instance_i32 struct initialized by
+                    plp_mat_rank1_update_i32_parallel
+  @return     none
+*/
+
+void plp_mat_rank1_update_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the rank-1 update of 16-bit integer vectors with 32-bit output, A += x *
+               y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i16(const int16_t *__restrict__ pSrcX,
+                              const int16_t *__restrict__ pSrcY,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 16-bit integer vectors with 32-bit output kernel for RV32IM
+               extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i16s_rv32im(const int16_t *__restrict__ pSrcX,
+                                      const int16_t *__restrict__ pSrcY,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 16-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                                       const int16_t *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel rank-1 update of 16-bit integer vectors with 32-bit output,
+               A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in]  nPE   Number of cores to use for computation
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i16_parallel(const int16_t *__restrict__ pSrcX,
+                                       const int16_t *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Parallel rank-1 update of 16-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  args  pointer to plp_mat_rank1_update_instance_i16 struct initialized by
+                    plp_mat_rank1_update_i16_parallel
+  @return     none
+*/
+
+void plp_mat_rank1_update_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the rank-1 update of 8-bit integer vectors with 32-bit output, A += x *
+               y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i8(const int8_t *__restrict__ pSrcX,
+                             const int8_t *__restrict__ pSrcY,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 8-bit integer vectors with 32-bit output kernel for RV32IM extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i8s_rv32im(const int8_t *__restrict__ pSrcX,
+                                     const int8_t *__restrict__ pSrcY,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 8-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i8s_xpulpv2(const int8_t *__restrict__ pSrcX,
+                                      const int8_t *__restrict__ pSrcY,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel rank-1 update of 8-bit integer vectors with 32-bit output,
+               A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in]  nPE   Number of cores to use for computation
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_i8_parallel(const int8_t *__restrict__ pSrcX,
+                                      const int8_t *__restrict__ pSrcY,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Parallel rank-1 update of 8-bit integer vectors with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  args  pointer to plp_mat_rank1_update_instance_i8 struct initialized by
+                    plp_mat_rank1_update_i8_parallel
+  @return     none
+*/
+
+void plp_mat_rank1_update_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the rank-1 update of 32-bit floating-point vectors, A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_f32(const float *__restrict__ pSrcX,
+                              const float *__restrict__ pSrcY,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Rank-1 update of 32-bit floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_f32s_xpulpv2(const float *__restrict__ pSrcX,
+                                       const float *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       float *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel rank-1 update of 32-bit floating-point vectors, A += x *
+               y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in]  nPE   Number of cores to use for computation
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+*/
+
+void plp_mat_rank1_update_f32_parallel(const float *__restrict__ pSrcX,
+                                       const float *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t nPE,
+                                       float *__restrict__ pSrcDstA);
+
+/** -------------------------------------------------------
+  @brief      Parallel rank-1 update of 32-bit floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_rank1_update_instance_f32 struct initialized by
+                    plp_mat_rank1_update_f32_parallel
+  @return     none
+*/
+
+void plp_mat_rank1_update_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the Kronecker product of 32-bit integer matrices, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t P,
+                      uint32_t Q,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 32-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t P,
+                              uint32_t Q,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t P,
+                               uint32_t Q,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel Kronecker product of 32-bit integer matrices, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t P,
+                               uint32_t Q,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel Kronecker product of 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_kron_instance_i32 struct initialized by
+                    plp_mat_kron_i32_parallel
+  @return     none
+*/
+
+void plp_mat_kron_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the Kronecker product of 16-bit integer matrices with 32-bit output, C =
+               A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t P,
+                      uint32_t Q,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 16-bit integer matrices with 32-bit output kernel for RV32IM
+               extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t P,
+                              uint32_t Q,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 16-bit integer matrices with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t P,
+                               uint32_t Q,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel Kronecker product of 16-bit integer matrices with 32-bit
+               output, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t P,
+                               uint32_t Q,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel Kronecker product of 16-bit integer matrices with 32-bit output kernel for
+               XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_kron_instance_i16 struct initialized by
+                    plp_mat_kron_i16_parallel
+  @return     none
+*/
+
+void plp_mat_kron_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the Kronecker product of 8-bit integer matrices with 32-bit output, C =
+               A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t P,
+                     uint32_t Q,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 8-bit integer matrices with 32-bit output kernel for RV32IM
+               extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t P,
+                             uint32_t Q,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 8-bit integer matrices with 32-bit output kernel for XPULPV2
+               extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t P,
+                              uint32_t Q,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel Kronecker product of 8-bit integer matrices with 32-bit
+               output, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t P,
+                              uint32_t Q,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel Kronecker product of 8-bit integer matrices with 32-bit output kernel for
+               XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_kron_instance_i8 struct initialized by
+                    plp_mat_kron_i8_parallel
+  @return     none
+*/
+
+void plp_mat_kron_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the Kronecker product of 32-bit floating-point matrices, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t P,
+                      uint32_t Q,
+                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Kronecker product of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t P,
+                               uint32_t Q,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for the parallel Kronecker product of 32-bit floating-point matrices, C = A
+               (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+*/
+
+void plp_mat_kron_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t P,
+                               uint32_t Q,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel Kronecker product of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+  @param[in]  args  pointer to plp_mat_kron_instance_f32 struct initialized by
+                    plp_mat_kron_f32_parallel
+  @return     none
+*/
+
+void plp_mat_kron_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 16-bit fix-point matrices, y
+         = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q16(const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t shift,
+                                int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 16-bit fix-point matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 16-bit fix-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 16-bit fix-point
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         uint32_t nPE,
+                                         int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 16-bit fix-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q16 struct initialized by
+                    plp_mat_trans_vec_mult_q16_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 32-bit fix-point matrices, y
+         = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q32(const int32_t *__restrict__ pSrcA,
+                                const int32_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t shift,
+                                int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 32-bit fix-point matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                        const int32_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 32-bit fix-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 32-bit fix-point
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+*/
+
+void plp_mat_trans_vec_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 32-bit fix-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q32 struct initialized by
+                    plp_mat_trans_vec_mult_q32_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix vector multiplication of 32-bit floating-point
+         matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_f32(const float *__restrict__ pSrcA,
+                                const float *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Transposed matrix vector multiplication of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix vector multiplication of 32-bit
+         floating-point matrices, y = A^T * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_f32_parallel(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix vector multiplication of 32-bit floating-point matrices
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_f32 struct initialized by
+                    plp_mat_trans_vec_mult_f32_parallel
+  @return     none
+*/
+
+void plp_mat_trans_vec_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Compute the rows of a CSR matrix assigned to one core, such that all cores get about
+               the same number of nonzeros.
+   @param[in]  pRowPtr Row offsets of the CSR matrix (M + 1 entries)
+   @param[in]  M       Number of rows
+   @param[in]  nPE     Number of cores used for the computation
+   @param[in]  coreId  Id of the core for which the rows are computed
+   @param[out] pStart  First row of the block is written here
+   @param[out] pEnd    One past the last row of the block is written here
+   @return     none
+*/
+
+void plp_spmv_partition(const uint32_t *__restrict__ pRowPtr,
+                        uint32_t M,
+                        uint32_t nPE,
+                        uint32_t coreId,
+                        uint32_t *__restrict__ pStart,
+                        uint32_t *__restrict__ pEnd);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix vector multiplication of 8-bit integer matrices, y = A *
+         x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i8(const plp_csr_matrix_i8 *__restrict__ pSrcA,
+                 const int8_t *__restrict__ pSrcX,
+                 int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix vector multiplication of 8-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i8s_rv32im(const plp_csr_matrix_i8 *__restrict__ pSrcA,
+                         const int8_t *__restrict__ pSrcX,
+                         int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix vector multiplication of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i8s_xpulpv2(const plp_csr_matrix_i8 *__restrict__ pSrcA,
+                          const int8_t *__restrict__ pSrcX,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix vector multiplication of 8-bit integer matrices,
+         y = A * x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i8_parallel(const plp_csr_matrix_i8 *__restrict__ pSrcA,
+                          const int8_t *__restrict__ pSrcX,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix vector multiplication of 8-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance_i8 struct initialized by
+                    plp_spmv_i8_parallel
+  @return     none
+*/
+
+void plp_spmv_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix vector multiplication of 16-bit integer matrices, y = A *
+         x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i16(const plp_csr_matrix_i16 *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcX,
+                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix vector multiplication of 16-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i16s_rv32im(const plp_csr_matrix_i16 *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcX,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix vector multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i16s_xpulpv2(const plp_csr_matrix_i16 *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcX,
+                           int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix vector multiplication of 16-bit integer matrices,
+         y = A * x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_i16_parallel(const plp_csr_matrix_i16 *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcX,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix vector multiplication of 16-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance_i16 struct initialized by
+                    plp_spmv_i16_parallel
+  @return     none
+*/
+
+void plp_spmv_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix vector multiplication of 32-bit floating-point matrices, y
+         = A * x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_f32(const plp_csr_matrix_f32 *__restrict__ pSrcA,
+                  const float *__restrict__ pSrcX,
+                  float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix vector multiplication of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_f32s_xpulpv2(const plp_csr_matrix_f32 *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcX,
+                           float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix vector multiplication of 32-bit floating-point
+         matrices, y = A * x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+*/
+
+void plp_spmv_f32_parallel(const plp_csr_matrix_f32 *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcX,
+                           uint32_t nPE,
+                           float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix vector multiplication of 32-bit floating-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance_f32 struct initialized by
+                    plp_spmv_f32_parallel
+  @return     none
+*/
+
+void plp_spmv_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 32-bit integer identity matrix
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i32(uint32_t N, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit integer identity matrix on RV32IM
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i32s_rv32im(uint32_t N, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit integer identity matrix on XpulpV2
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i32s_xpulpv2(uint32_t N, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 32-bit integer identity matrix in parallel
+  @param[in]  N    Width and height of the matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i32_parallel(uint32_t N, uint32_t nPE, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit integer identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_i32 struct initialized by
+                    plp_mat_fill_I_i32_parallel
+  @return     none
+*/
+
+void plp_mat_fill_I_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 16-bit integer identity matrix
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i16(uint32_t N, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 16-bit integer identity matrix on RV32IM
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i16s_rv32im(uint32_t N, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 16-bit integer identity matrix on XpulpV2
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_i16s_xpulpv2(uint32_t N, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 16-bit integer identity matrix in parallel
+  @param[in]  N    Width and height of the matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i16_parallel(uint32_t N, uint32_t nPE, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 16-bit integer identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_i16 struct initialized by
+                    plp_mat_fill_I_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 8-bit integer identity matrix
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i8(uint32_t N, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 8-bit integer identity matrix on RV32IM
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i8s_rv32im(uint32_t N, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 8-bit integer identity matrix on XpulpV2
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_i8s_xpulpv2(uint32_t N, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 8-bit integer identity matrix in parallel
+  @param[in]  N    Width and height of the matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_i8_parallel(uint32_t N, uint32_t nPE, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 8-bit integer identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_i8 struct initialized by
+                    plp_mat_fill_I_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 32-bit float identity matrix
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_f32(uint32_t N, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit float identity matrix on XpulpV2
+  @param[in]  N    Width and height of the matrix
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_f32s_xpulpv2(uint32_t N, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 32-bit float identity matrix in parallel
+  @param[in]  N    Width and height of the matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_f32_parallel(uint32_t N, uint32_t nPE, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit float identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_f32 struct initialized by
+                    plp_mat_fill_I_f32_parallel
+  @return     none
+*/
+
+void plp_mat_fill_I_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 32-bit fix-point identity matrix
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q32(uint32_t N, int32_t fracBits, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit fix-point identity matrix on RV32IM
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q32s_rv32im(uint32_t N, int32_t fracBits, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit fix-point identity matrix on XpulpV2
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q32s_xpulpv2(uint32_t N, int32_t fracBits, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 32-bit fix-point identity matrix in parallel
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q32_parallel(uint32_t N,
+                                 int32_t fracBits,
+                                 uint32_t nPE,
+                                 int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 32-bit fix-point identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_q32 struct initialized by
+                    plp_mat_fill_I_q32_parallel
+  @return     none
+*/
+
+void plp_mat_fill_I_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 16-bit fix-point identity matrix
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q16(uint32_t N, int32_t fracBits, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 16-bit fix-point identity matrix on RV32IM
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q16s_rv32im(uint32_t N, int32_t fracBits, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 16-bit fix-point identity matrix on XpulpV2
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_q16s_xpulpv2(uint32_t N, int32_t fracBits, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 16-bit fix-point identity matrix in parallel
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q16_parallel(uint32_t N,
+                                 int32_t fracBits,
+                                 uint32_t nPE,
+                                 int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 16-bit fix-point identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_q16 struct initialized by
+                    plp_mat_fill_I_q16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 8-bit fix-point identity matrix
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q8(uint32_t N, int32_t fracBits, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 8-bit fix-point identity matrix on RV32IM
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q8s_rv32im(uint32_t N, int32_t fracBits, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 8-bit fix-point identity matrix on XpulpV2
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_q8s_xpulpv2(uint32_t N, int32_t fracBits, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a 8-bit fix-point identity matrix in parallel
+  @param[in]  N         Width and height of the matrix
+  @param[in]  fracBits  decimal point for the appropriate scale
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxN
+  @return     none
+*/
+
+void plp_mat_fill_I_q8_parallel(uint32_t N,
+                                int32_t fracBits,
+                                uint32_t nPE,
+                                int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a 8-bit fix-point identity matrix in parallel on XpulpV2
+  @param[in]  args  pointer to plp_mat_fill_I_instance_q8 struct initialized by
+                    plp_mat_fill_I_q8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for tiled parallel matrix multiplication of 32-bit integer matrices stored
+               in L2. Tiles of the matrices are copied into L1 with the cluster DMA, using double
+               buffering to overlap the transfers with the computation.
+   @param[in]  pSrcA points to first the input matrix (in L2)
+   @param[in]  pSrcB points to second the input matrix (in L2)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  tileM Number of rows of each output tile
+   @param[in]  tileO Number of columns of each output tile
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_i32_tiled(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t tileM,
+                            uint32_t tileO,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 32-bit integer matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i32 struct initialized by
+                      plp_mat_mult_i32_tiled
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for tiled parallel matrix multiplication of 16-bit integer matrices stored
+               in L2. Tiles of the matrices are copied into L1 with the cluster DMA, using double
+               buffering to overlap the transfers with the computation.
+   @param[in]  pSrcA points to first the input matrix (in L2)
+   @param[in]  pSrcB points to second the input matrix (in L2)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  tileM Number of rows of each output tile
+   @param[in]  tileO Number of columns of each output tile
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_i16_tiled(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t tileM,
+                            uint32_t tileO,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i16 struct initialized by
+                      plp_mat_mult_i16_tiled
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for tiled parallel matrix multiplication of 8-bit integer matrices stored
+               in L2. Tiles of the matrices are copied into L1 with the cluster DMA, using double
+               buffering to overlap the transfers with the computation.
+   @param[in]  pSrcA points to first the input matrix (in L2)
+   @param[in]  pSrcB points to second the input matrix (in L2)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  tileM Number of rows of each output tile
+   @param[in]  tileO Number of columns of each output tile
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_i8_tiled(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t tileM,
+                           uint32_t tileO,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i8 struct initialized by
+                      plp_mat_mult_i8_tiled
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for tiled parallel matrix multiplication of 32-bit floating-point matrices
+          stored
+               in L2. Tiles of the matrices are copied into L1 with the cluster DMA, using double
+               buffering to overlap the transfers with the computation.
+   @param[in]  pSrcA points to first the input matrix (in L2)
+   @param[in]  pSrcB points to second the input matrix (in L2)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  tileM Number of rows of each output tile
+   @param[in]  tileO Number of columns of each output tile
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_f32_tiled(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t tileM,
+                            uint32_t tileO,
+                            uint32_t nPE,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 32-bit floating-point matrices kernel for
+           XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_f32 struct initialized by
+                      plp_mat_mult_f32_tiled
+    @return     none
+*/
+
+void plp_mat_mult_tiled_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the tiled matrix multiplication of 32-bit integer matrices stored in
+               L2, which is split across several clusters. Every cluster computes a contiguous
+               block of rows of the output with plp_mat_mult_i32_tiled, in its own L1.
+   @param[in]  pSrcA     points to the first input matrix (in L2)
+   @param[in]  pSrcB     points to the second input matrix (in L2)
+   @param[in]  M         Height of first matrix
+   @param[in]  N         Width of first and height of second matrix
+   @param[in]  O         Width of second matrix
+   @param[in]  tileM     Number of rows of each output tile
+   @param[in]  tileO     Number of columns of each output tile
+   @param[in]  nClusters Number of clusters, which must be mounted
+   @param[in]  nPE       Number of cores to use on every cluster
+   @param[out] pDstC     Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_i32_tiled_multi(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t tileM,
+                                  uint32_t tileO,
+                                  uint32_t nClusters,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the tiled matrix multiplication of 16-bit integer matrices stored in
+               L2, which is split across several clusters. Every cluster computes a contiguous
+               block of rows of the output with plp_mat_mult_i16_tiled, in its own L1.
+   @param[in]  pSrcA     points to the first input matrix (in L2)
+   @param[in]  pSrcB     points to the second input matrix (in L2)
+   @param[in]  M         Height of first matrix
+   @param[in]  N         Width of first and height of second matrix
+   @param[in]  O         Width of second matrix
+   @param[in]  tileM     Number of rows of each output tile
+   @param[in]  tileO     Number of columns of each output tile
+   @param[in]  nClusters Number of clusters, which must be mounted
+   @param[in]  nPE       Number of cores to use on every cluster
+   @param[out] pDstC     Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_i16_tiled_multi(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t tileM,
+                                  uint32_t tileO,
+                                  uint32_t nClusters,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the tiled matrix multiplication of 8-bit integer matrices stored in
+               L2, which is split across several clusters. Every cluster computes a contiguous
+               block of rows of the output with plp_mat_mult_i8_tiled, in its own L1.
+   @param[in]  pSrcA     points to the first input matrix (in L2)
+   @param[in]  pSrcB     points to the second input matrix (in L2)
+   @param[in]  M         Height of first matrix
+   @param[in]  N         Width of first and height of second matrix
+   @param[in]  O         Width of second matrix
+   @param[in]  tileM     Number of rows of each output tile
+   @param[in]  tileO     Number of columns of each output tile
+   @param[in]  nClusters Number of clusters, which must be mounted
+   @param[in]  nPE       Number of cores to use on every cluster
+   @param[out] pDstC     Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_i8_tiled_multi(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t tileM,
+                                 uint32_t tileO,
+                                 uint32_t nClusters,
+                                 uint32_t nPE,
+                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the tiled matrix multiplication of 32-bit floating-point matrices
+               stored in L2, which is split across several clusters. Every cluster computes a
+               contiguous block of rows of the output with plp_mat_mult_f32_tiled, in its own L1.
+   @param[in]  pSrcA     points to the first input matrix (in L2)
+   @param[in]  pSrcB     points to the second input matrix (in L2)
+   @param[in]  M         Height of first matrix
+   @param[in]  N         Width of first and height of second matrix
+   @param[in]  O         Width of second matrix
+   @param[in]  tileM     Number of rows of each output tile
+   @param[in]  tileO     Number of columns of each output tile
+   @param[in]  nClusters Number of clusters, which must be mounted
+   @param[in]  nPE       Number of cores to use on every cluster
+   @param[out] pDstC     Output is written here (in L2)
+   @return     none
+*/
+
+void plp_mat_mult_f32_tiled_multi(const float *__restrict__ pSrcA,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t tileM,
+                                  uint32_t tileO,
+                                  uint32_t nClusters,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Pack the second 16-bit integer matrix of a matrix multiplication for
+               plp_mat_mult_packed_i16. The matrix is transposed, and each column is zero padded
+               to a multiple of 2 elements.
+   @param[in]  pSrcB points to the matrix of shape NxO
+   @param[in]  N     Height of the matrix
+   @param[in]  O     Width of the matrix
+   @param[out] pDstB Packed matrix of size O * ceil(N / 2) * 2, aligned to 4 bytes
+   @return     none
+*/
+
+void plp_mat_mult_i16_packB(const int16_t *__restrict__ pSrcB,
+                            uint32_t N,
+                            uint32_t O,
+                            int16_t *__restrict__ pDstB);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 16-bit integer matrices with packed second
+          matrix.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i16_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i16(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 16-bit integer matrices with packed second matrix kernel for
+          RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i16_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 16-bit integer matrices with packed second matrix kernel for
+          XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i16_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of 16-bit integer matrices with packed
+          second
+               matrix.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i16_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix multiplication of 16-bit integer matrices with packed second matrix
+           kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_packed_instance_i16 struct initialized by
+                      plp_mat_mult_packed_i16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_packed_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Pack the second 8-bit integer matrix of a matrix multiplication for
+               plp_mat_mult_packed_i8. The matrix is transposed, and each column is zero padded
+               to a multiple of 4 elements.
+   @param[in]  pSrcB points to the matrix of shape NxO
+   @param[in]  N     Height of the matrix
+   @param[in]  O     Width of the matrix
+   @param[out] pDstB Packed matrix of size O * ceil(N / 4) * 4, aligned to 4 bytes
+   @return     none
+*/
+
+void plp_mat_mult_i8_packB(const int8_t *__restrict__ pSrcB,
+                           uint32_t N,
+                           uint32_t O,
+                           int8_t *__restrict__ pDstB);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 8-bit integer matrices with packed second
+          matrix.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i8_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i8(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 8-bit integer matrices with packed second matrix kernel for
+          RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i8_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 8-bit integer matrices with packed second matrix kernel for
+          XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i8_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of 8-bit integer matrices with packed
+          second
+               matrix.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix, packed by plp_mat_mult_i8_packB
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_packed_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix multiplication of 8-bit integer matrices with packed second matrix
+           kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_packed_instance_i8 struct initialized by
+                      plp_mat_mult_packed_i8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_packed_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 4-bit integer matrices, packed
+               2 values per byte (see MatMultSubByte).
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i4(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 4-bit integer matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i4s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 4-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i4s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+#if defined(PLP_XPULPNN)
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 4-bit integer matrices kernel for XpulpNN
+               extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i4s_xpulpnn(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+#endif // PLP_XPULPNN
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 2-bit integer matrices, packed
+               4 values per byte (see MatMultSubByte).
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i2(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 2-bit integer matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i2s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 2-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i2s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+#if defined(PLP_XPULPNN)
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 2-bit integer matrices kernel for XpulpNN
+               extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i2s_xpulpnn(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+#endif // PLP_XPULPNN
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of binary matrices.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_bin(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of binary matrices.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_bin_parallel(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of binary matrices kernel for RV32IM extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_bins_rv32im(const uint32_t *__restrict__ pSrcA,
+                              const uint32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of binary matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_bins_xpulpv2(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of binary matrices kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_bin struct initialized by
+                     plp_mat_mult_bin_parallel
+   @return     none
+*/
+
+void plp_mat_mult_binp_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of ternary matrices.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_ter(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of ternary matrices.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_ter_parallel(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of ternary matrices kernel for RV32IM extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_ters_rv32im(const uint32_t *__restrict__ pSrcA,
+                              const uint32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of ternary matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcA points to the first input matrix, packed (MxN)
+   @param[in]  pSrcB points to the second input matrix, transposed and packed (OxN)
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_ters_xpulpv2(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of ternary matrices kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_ter struct initialized by
+                     plp_mat_mult_ter_parallel
+   @return     none
+*/
+
+void plp_mat_mult_terp_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 8-bit integer matrices with requantization
+               of the output to 8 bits.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_i8(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             const int32_t *__restrict__ pMult,
+                             const uint32_t *__restrict__ pShift,
+                             int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 8-bit integer matrices with requantization kernel for
+               RV32IM extension.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     const int32_t *__restrict__ pMult,
+                                     const uint32_t *__restrict__ pShift,
+                                     int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 8-bit integer matrices with requantization kernel for
+               XPULPV2 extension.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of 8-bit integer matrices with
+               requantization of the output to 8 bits.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of 8-bit integer matrices with requantization kernel
+               for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_requant_instance_i8 struct initialized by
+                     plp_mat_mult_requant_i8_parallel
+   @return     none
+*/
+
+void plp_mat_mult_requant_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 16-bit fix-point matrices with
+               per-column requantization of the output.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q16(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              const int32_t *__restrict__ pMult,
+                              const uint32_t *__restrict__ pShift,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 16-bit fix-point matrices with requantization kernel
+               for RV32IM extension.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 16-bit fix-point matrices with requantization kernel
+               for XPULPV2 extension.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const uint32_t *__restrict__ pShift,
+                                       int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of 16-bit fix-point matrices with
+               per-column requantization of the output.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const uint32_t *__restrict__ pShift,
+                                       uint32_t nPE,
+                                       int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of 16-bit fix-point matrices with requantization
+               kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_requant_instance_q16 struct initialized by
+                     plp_mat_mult_requant_q16_parallel
+   @return     none
+*/
+
+void plp_mat_mult_requant_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix multiplication of 32-bit fix-point matrices with
+               per-column requantization of the output.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q32(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              const int32_t *__restrict__ pMult,
+                              const uint32_t *__restrict__ pShift,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 32-bit fix-point matrices with requantization kernel
+               for RV32IM extension.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix multiplication of 32-bit fix-point matrices with requantization kernel
+               for XPULPV2 extension.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const uint32_t *__restrict__ pShift,
+                                       int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix multiplication of 32-bit fix-point matrices with
+               per-column requantization of the output.
+   @param[in]  pSrcA  points to the first input matrix
+   @param[in]  pSrcB  points to the second input matrix
+   @param[in]  M      Height of first matrix
+   @param[in]  N      Width of first and heigt of second matrix
+   @param[in]  O      Width of second matrix
+   @param[in]  pMult  points to the multipliers, one per column of the output, or NULL
+   @param[in]  pShift points to the right shifts, one per column of the output
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pDstC  Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_requant_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const uint32_t *__restrict__ pShift,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of 32-bit fix-point matrices with requantization
+               kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_requant_instance_q32 struct initialized by
+                     plp_mat_mult_requant_q32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_requant_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for batched matrix multiplication of 32-bit floating-point matrices. Whole
+          matrices
+               of the batch are distributed onto the cores.
+   @param[in]  pSrcA      points to the first matrix of the first input batch
+   @param[in]  pSrcB      points to the first matrix of the second input batch
+   @param[in]  M          Height of each matrix of A
+   @param[in]  N          Width of each matrix of A and height of each matrix of B
+   @param[in]  O          Width of each matrix of B
+   @param[in]  batchCount Number of matrix multiplications
+   @param[in]  strideA    Number of elements between two consecutive matrices of A
+   @param[in]  strideB    Number of elements between two consecutive matrices of B (may be 0)
+   @param[in]  strideC    Number of elements between two consecutive matrices of C
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      points to the first matrix of the output batch
+   @return     none
+*/
+
+void plp_mat_mult_batched_f32(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t batchCount,
+                              uint32_t strideA,
+                              uint32_t strideB,
+                              uint32_t strideC,
+                              uint32_t nPE,
+                              float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel batched matrix multiplication of 32-bit floating-point matrices kernel for
+           XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_batched_instance_f32 struct initialized by
+                      plp_mat_mult_batched_f32
+    @return     none
+*/
+
+void plp_mat_mult_batched_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for batched matrix multiplication of 16-bit integer matrices. Whole
+          matrices
+               of the batch are distributed onto the cores.
+   @param[in]  pSrcA      points to the first matrix of the first input batch
+   @param[in]  pSrcB      points to the first matrix of the second input batch
+   @param[in]  M          Height of each matrix of A
+   @param[in]  N          Width of each matrix of A and height of each matrix of B
+   @param[in]  O          Width of each matrix of B
+   @param[in]  batchCount Number of matrix multiplications
+   @param[in]  strideA    Number of elements between two consecutive matrices of A
+   @param[in]  strideB    Number of elements between two consecutive matrices of B (may be 0)
+   @param[in]  strideC    Number of elements between two consecutive matrices of C
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      points to the first matrix of the output batch
+   @return     none
+*/
+
+void plp_mat_mult_batched_i16(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t batchCount,
+                              uint32_t strideA,
+                              uint32_t strideB,
+                              uint32_t strideC,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel batched matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_batched_instance_i16 struct initialized by
+                      plp_mat_mult_batched_i16
+    @return     none
+*/
+
+void plp_mat_mult_batched_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for batched matrix multiplication of 16-bit fix-point matrices. Whole
+          matrices
+               of the batch are distributed onto the cores.
+   @param[in]  pSrcA      points to the first matrix of the first input batch
+   @param[in]  pSrcB      points to the first matrix of the second input batch
+   @param[in]  M          Height of each matrix of A
+   @param[in]  N          Width of each matrix of A and height of each matrix of B
+   @param[in]  O          Width of each matrix of B
+   @param[in]  batchCount Number of matrix multiplications
+   @param[in]  strideA    Number of elements between two consecutive matrices of A
+   @param[in]  strideB    Number of elements between two consecutive matrices of B (may be 0)
+   @param[in]  strideC    Number of elements between two consecutive matrices of C
+   @param[in]  shift      Amount to shift the result of each multiplication
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      points to the first matrix of the output batch
+   @return     none
+*/
+
+void plp_mat_mult_batched_q16(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t batchCount,
+                              uint32_t strideA,
+                              uint32_t strideB,
+                              uint32_t strideC,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel batched matrix multiplication of 16-bit fix-point matrices kernel for
+           XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_batched_instance_q16 struct initialized by
+                      plp_mat_mult_batched_q16
+    @return     none
+*/
+
+void plp_mat_mult_batched_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 32-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_i32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t alpha,
+                     int32_t beta,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 32-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_i32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t alpha,
+                              int32_t beta,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 16-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_i16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t alpha,
+                     int32_t beta,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 16-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_i16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t alpha,
+                              int32_t beta,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 8-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_i8(const int8_t *__restrict__ pSrcA,
+                    const int8_t *__restrict__ pSrcB,
+                    uint32_t M,
+                    uint32_t N,
+                    uint32_t O,
+                    int32_t alpha,
+                    int32_t beta,
+                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 8-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_i8_parallel(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t alpha,
+                             int32_t beta,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 32-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_q32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t alpha,
+                     int32_t beta,
+                     uint32_t shift,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 32-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_q32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t alpha,
+                              int32_t beta,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 16-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_q16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t alpha,
+                     int32_t beta,
+                     uint32_t shift,
+                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 16-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_q16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t alpha,
+                              int32_t beta,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 8-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_q8(const int8_t *__restrict__ pSrcA,
+                    const int8_t *__restrict__ pSrcB,
+                    uint32_t M,
+                    uint32_t N,
+                    uint32_t O,
+                    int32_t alpha,
+                    int32_t beta,
+                    uint32_t shift,
+                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 8-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_q8_parallel(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t alpha,
+                             int32_t beta,
+                             uint32_t shift,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix fused multiply accumulate of 32-bit floating-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_f32(const float *__restrict__ pSrcA,
+                     const float *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     float alpha,
+                     float beta,
+                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix fused multiply accumulate of 32-bit floating-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_f32_parallel(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float alpha,
+                              float beta,
+                              uint32_t nPE,
+                              float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for Cholesky decomposition of 32-bit floating-point matrices.
+   @param[in]  pSrc Points to the input matrix, only the lower triangle is read
+   @param[in]  N    Width and height of both matrices
+   @param[out] pDst Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc,
+                         uint32_t N,
+                         float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel Cholesky decomposition of 32-bit floating-point matrices.
+   @param[in]  pSrc Points to the input matrix, only the lower triangle is read
+   @param[in]  N    Width and height of both matrices
+   @param[in]  nPE  Number of cores to use for computation
+   @param[out] pDst Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_f32_parallel(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for Cholesky decomposition of 32-bit fix-point matrices.
+   @param[in]  pSrc     Points to the input matrix, only the lower triangle is read
+   @param[in]  N        Width and height of both matrices
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDst     Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_q32(const int32_t *__restrict__ pSrc,
+                         uint32_t N,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel Cholesky decomposition of 32-bit fix-point matrices.
+   @param[in]  pSrc     Points to the input matrix, only the lower triangle is read
+   @param[in]  N        Width and height of both matrices
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[in]  nPE      Number of cores to use for computation
+   @param[out] pDst     Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_q32_parallel(const int32_t *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t fracBits,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for lower triangular solve of 32-bit floating-point matrices.
+   @param[in]  pSrcA Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+   @param[in]  N     Width and height of A, height of B and X
+   @param[in]  O     Width of B and X (number of right-hand sides)
+   @param[out] pDstC Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_f32(const float *__restrict__ pSrcA,
+                                const float *__restrict__ pSrcB,
+                                uint32_t N,
+                                uint32_t O,
+                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel lower triangular solve of 32-bit floating-point matrices.
+   @param[in]  pSrcA Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+   @param[in]  N     Width and height of A, height of B and X
+   @param[in]  O     Width of B and X (number of right-hand sides)
+   @param[in]  nPE   Number of cores to use for computation
+   @param[out] pDstC Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_f32_parallel(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for lower triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_q32(const int32_t *__restrict__ pSrcA,
+                                const int32_t *__restrict__ pSrcB,
+                                uint32_t N,
+                                uint32_t O,
+                                uint32_t fracBits,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel lower triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[in]  nPE      Number of cores to use for computation
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t fracBits,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for upper triangular solve of 32-bit floating-point matrices.
+   @param[in]  pSrcA Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+   @param[in]  N     Width and height of A, height of B and X
+   @param[in]  O     Width of B and X (number of right-hand sides)
+   @param[out] pDstC Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_f32(const float *__restrict__ pSrcA,
+                                const float *__restrict__ pSrcB,
+                                uint32_t N,
+                                uint32_t O,
+                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel upper triangular solve of 32-bit floating-point matrices.
+   @param[in]  pSrcA Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+   @param[in]  N     Width and height of A, height of B and X
+   @param[in]  O     Width of B and X (number of right-hand sides)
+   @param[in]  nPE   Number of cores to use for computation
+   @param[out] pDstC Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_f32_parallel(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for upper triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_q32(const int32_t *__restrict__ pSrcA,
+                                const int32_t *__restrict__ pSrcB,
+                                uint32_t N,
+                                uint32_t O,
+                                uint32_t fracBits,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel upper triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[in]  nPE      Number of cores to use for computation
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t fracBits,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for symmetric rank-k product of 16-bit integer matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_i16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel symmetric rank-k product of 16-bit integer matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Symmetric rank-k product of 16-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Symmetric rank-k product of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel symmetric rank-k product of 16-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_i16 struct initialized by
+                     plp_mat_syrk_i16_parallel
+   @return     none
+*/
+
+void plp_mat_syrk_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for symmetric rank-k product of 16-bit fixed-point matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_q16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel symmetric rank-k product of 16-bit fixed-point matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Symmetric rank-k product of 16-bit fixed-point matrices kernel for RV32IM extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Symmetric rank-k product of 16-bit fixed-point matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel symmetric rank-k product of 16-bit fixed-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_q16 struct initialized by
+                     plp_mat_syrk_q16_parallel
+   @return     none
+*/
+
+void plp_mat_syrk_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for symmetric rank-k product of 32-bit floating-point matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_f32(const float *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel symmetric rank-k product of 32-bit floating-point matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_f32_parallel(const float *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Symmetric rank-k product of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM
+   @return     none
+*/
+
+void plp_mat_syrk_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel symmetric rank-k product of 32-bit floating-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_f32 struct initialized by
+                     plp_mat_syrk_f32_parallel
+   @return     none
+*/
+
+void plp_mat_syrk_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for Hermitian rank-k product of complex 16-bit integer matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_i16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel Hermitian rank-k product of complex 16-bit integer matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Hermitian rank-k product of complex 16-bit integer matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Hermitian rank-k product of complex 16-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel Hermitian rank-k product of complex 16-bit integer matrices kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_i16 struct initialized by
+                     plp_mat_herk_i16_parallel
+   @return     none
+*/
+
+void plp_mat_herk_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for Hermitian rank-k product of complex 16-bit fixed-point matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_q16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel Hermitian rank-k product of complex 16-bit fixed-point
+               matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Hermitian rank-k product of complex 16-bit fixed-point matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Hermitian rank-k product of complex 16-bit fixed-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  shift Amount to shift the result of each multiplication
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel Hermitian rank-k product of complex 16-bit fixed-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_q16 struct initialized by
+                     plp_mat_herk_q16_parallel
+   @return     none
+*/
+
+void plp_mat_herk_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for Hermitian rank-k product of complex 32-bit floating-point matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_f32(const float *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel Hermitian rank-k product of complex 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_f32_parallel(const float *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Hermitian rank-k product of complex 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA points to the input matrix of shape MxN, complex
+   @param[in]  M     height of the input matrix, height and width of the output matrix
+   @param[in]  N     width of the input matrix
+   @param[out] pDstC points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel Hermitian rank-k product of complex 32-bit floating-point matrices kernel
+               for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_f32 struct initialized by
+                     plp_mat_herk_f32_parallel
+   @return     none
+*/
+
+void plp_mat_herk_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the covariance matrix of 32-bit floating-point vectors.
+   @param[in]  pSrc  points to the M input vectors of length N, as rows of a matrix of MxN
+   @param[in]  M     number of vectors, height and width of the output matrix
+   @param[in]  N     length of the vectors (number of observations), at least 2
+   @param[out] pDst  points to the output matrix of shape MxM, the sample covariances
+   @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+*/
+
+int plp_cov_f32(const float *__restrict__ pSrc,
+                uint32_t M,
+                uint32_t N,
+                float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel covariance matrix of 32-bit floating-point vectors.
+   @param[in]  pSrc  points to the M input vectors of length N, as rows of a matrix of MxN
+   @param[in]  M     number of vectors, height and width of the output matrix
+   @param[in]  N     length of the vectors (number of observations), at least 2
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDst  points to the output matrix of shape MxM, the sample covariances
+   @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+*/
+
+int plp_cov_f32_parallel(const float *__restrict__ pSrc,
+                         uint32_t M,
+                         uint32_t N,
+                         uint32_t nPE,
+                         float *__restrict__ pDst);
+
+#endif // __PLP_MATRIX_H__
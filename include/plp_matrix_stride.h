@@ -0,0 +1,10525 @@
+/** ==========================================================================
+ * @file     plp_matrix_stride.h
+ * @brief    Strided matrix functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MATRIX_STRIDE_H__
+#define __PLP_MATRIX_STRIDE_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @brief Range of elements of a matrix assigned to one core by plp_mat_split. The range starts
+           at element (mStart, nStart) and ends at element (mEnd - 1, nEnd - 1), in row-major order.
+    @param[in]  mStart  first row of the range
+    @param[in]  mEnd    one past the last row of the range
+    @param[in]  nStart  first column in the first row of the range
+    @param[in]  nEnd    one past the last column in the last row of the range
+*/
+typedef struct {
+    uint32_t mStart;
+    uint32_t mEnd;
+    uint32_t nStart;
+    uint32_t nEnd;
+} plp_mat_range;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided parallel matrix multiplication of an 8-bit with a 16-bit
+ *        integer matrix.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i8xi16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided half-precision floating-point parallel matrix
+ *        multiplication.
+ */
+typedef struct {
+    const float16_t *__restrict__ pSrcA;
+    const float16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float16_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_f16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    int32_t alpha;
+    int32_t beta;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    int32_t alpha;
+    int32_t beta;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    int32_t alpha;
+    int32_t beta;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    int32_t alpha;
+    int32_t beta;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    int32_t alpha;
+    int32_t beta;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    int32_t alpha;
+    int32_t beta;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided matrix fused multiply accumulate.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    float alpha;
+    float beta;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_fma_stride_instance_f32;
+
+/** Operations on the input matrices of plp_gemm_f32 and plp_gemm_cmplx_f32: op(X) is X, its
+    transpose or its conjugate transpose (the transpose for real matrices) */
+#define PLP_GEMM_NO_TRANS 0
+#define PLP_GEMM_TRANS 1
+#define PLP_GEMM_CONJ_TRANS 2
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel general matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t transA;
+    uint32_t transB;
+    float alpha;
+    float beta;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_gemm_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for complex floating-point parallel general matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t transA;
+    uint32_t transB;
+    float alphaRe;
+    float alphaIm;
+    float betaRe;
+    float betaIm;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_gemm_instance_cmplx_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix addition.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_add_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_sub_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int8_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int16_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix scale.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    float scaleFactor;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_scale_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int8_t value;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int16_t value;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int32_t value;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling a floating-point matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    float value;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided matrix copy.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_copy_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel strided matrix transpose.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_trans_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel strided matrix transpose.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_trans_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit integer parallel strided matrix transpose.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_trans_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit integer parallel strided complex matrix transpose.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_trans_cmplx_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel strided complex matrix transpose.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_trans_cmplx_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel strided complex matrix transpose.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_trans_cmplx_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit floating-point parallel Cholesky decomposition.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+    int status;
+} plp_mat_cholesky_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit fix-point parallel Cholesky decomposition.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+    int status;
+} plp_mat_cholesky_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit floating-point parallel triangular solve.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+    int status;
+} plp_mat_solve_tri_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit fix-point parallel triangular solve.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+    int status;
+} plp_mat_solve_tri_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit floating-point parallel matrix norms.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    float *__restrict__ resBuffer;
+} plp_mat_norm_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 16-bit integer parallel matrix norms.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    uint64_t *__restrict__ resBuffer;
+} plp_mat_norm_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 8-bit integer parallel matrix norms.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    uint64_t *__restrict__ resBuffer;
+} plp_mat_norm_stride_instance_i8;
+
+/** -------------------------------------------------------
+   @brief      Compute the range of elements of an MxN matrix assigned to one core, such that all
+               cores get the same number of elements (up to one), independent of the shape.
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  nPE    Number of cores used for the computation
+   @param[in]  coreId Id of the core for which the range is computed
+   @param[out] pRange The range is written here (empty if the core has no work)
+   @return     none
+*/
+
+void plp_mat_split(
+    uint32_t M, uint32_t N, uint32_t nPE, uint32_t coreId, plp_mat_range *__restrict__ pRange);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i32(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t strideA,
+                             uint32_t strideB,
+                             uint32_t strideC,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 32-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i16(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t strideA,
+                             uint32_t strideB,
+                             uint32_t strideC,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 16-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 16-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 8-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 8-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel strided matrix matrix multiplication of a 32-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args      pointer to plp_mat_mult_stride_instance_i32 struct initialized by
+                         plp_mat_mult_stride_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_stride_instance_i16 struct initialized by
+                      plp_mat_mult_stride_i16_parallel
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 8-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_f32(const float *__restrict__ pSrcA,
+                             const float *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t strideA,
+                             uint32_t strideB,
+                             uint32_t strideC,
+                             float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 32-bit floating-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t nPE,
+                                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+           extension.
+    @param[in]  args pointer to plp_mat_mult_stride_instance_f32 struct initialized by
+                     plp_mat_mult_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of half-precision floating-point
+               matrices. The products are accumulated in single precision.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_f16(const float16_t *__restrict__ pSrcA,
+                             const float16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t strideA,
+                             uint32_t strideB,
+                             uint32_t strideC,
+                             float16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of half-precision floating-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_f16s_xpulpv2(const float16_t *__restrict__ pSrcA,
+                                      const float16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      float16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of half-precision
+               floating-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_stride_f16_parallel(const float16_t *__restrict__ pSrcA,
+                                      const float16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t nPE,
+                                      float16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of half-precision floating-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_mult_stride_instance_f16 struct initialized by
+                     plp_mat_mult_stride_f16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_stride_f16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  args pointer to plp_mat_mult_stride_instance_i8 struct initialized by
+                    plp_mat_mult_stride_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for strided matrix multiplication of an 8-bit with a 16-bit integer matrix,
+          e.g. of 8-bit weights with 16-bit activations.
+   @param[in]  pSrcA     points to the first input matrix [8 bit]
+   @param[in]  pSrcB     points to the second input matrix [16 bit]
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and hight of the second
+   @param[in]  O         width of the second input matrix
+   @param[in]  strideA   Stride of matrix A (elements between each row)
+   @param[in]  strideB   Stride of matrix B (elements between each row)
+   @param[in]  strideC   Stride of output matrix (elements between each row)
+   @param[out] pDstC     points to the output matrix [32 bit]
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8xi16(const int8_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t O,
+                                uint32_t strideA,
+                                uint32_t strideB,
+                                uint32_t strideC,
+                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Strided matrix multiplication of an 8-bit with a 16-bit integer matrix kernel for RV32IM
+          extension.
+   @param[in]  pSrcA     points to the first input matrix [8 bit]
+   @param[in]  pSrcB     points to the second input matrix [16 bit]
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and hight of the second
+   @param[in]  O         width of the second input matrix
+   @param[in]  strideA   Stride of matrix A (elements between each row)
+   @param[in]  strideB   Stride of matrix B (elements between each row)
+   @param[in]  strideC   Stride of output matrix (elements between each row)
+   @param[out] pDstC     points to the output matrix [32 bit]
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8xi16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        uint32_t strideA,
+                                        uint32_t strideB,
+                                        uint32_t strideC,
+                                        int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Strided matrix multiplication of an 8-bit with a 16-bit integer matrix kernel for
+          XPULPV2 extension.
+   @param[in]  pSrcA     points to the first input matrix [8 bit]
+   @param[in]  pSrcB     points to the second input matrix [16 bit]
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and hight of the second
+   @param[in]  O         width of the second input matrix
+   @param[in]  strideA   Stride of matrix A (elements between each row)
+   @param[in]  strideB   Stride of matrix B (elements between each row)
+   @param[in]  strideC   Stride of output matrix (elements between each row)
+   @param[out] pDstC     points to the output matrix [32 bit]
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are sign-extended to vectors of 2 halfwords in registers and multiplied with
+   the 16-bit dot product instructions, with 32 bit accumulators.
+*/
+
+void plp_mat_mult_stride_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel strided matrix multiplication of an 8-bit with a 16-bit integer
+          matrix.
+   @param[in]  pSrcA     points to the first input matrix [8 bit]
+   @param[in]  pSrcB     points to the second input matrix [16 bit]
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and hight of the second
+   @param[in]  O         width of the second input matrix
+   @param[in]  strideA   Stride of matrix A (elements between each row)
+   @param[in]  strideB   Stride of matrix B (elements between each row)
+   @param[in]  strideC   Stride of output matrix (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDstC     points to the output matrix [32 bit]
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8xi16_parallel(const int8_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Parallel strided matrix multiplication of an 8-bit with a 16-bit integer matrix kernel
+          for XPULPV2 extension.
+   @param[in]  args pointer to plp_mat_mult_stride_instance_i8xi16 struct initialized by
+                    plp_mat_mult_stride_i8xi16_parallel
+   @return     none
+*/
+
+void plp_mat_mult_stride_i8xi16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 32-bit fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_stride_q32(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t strideA,
+                             uint32_t strideB,
+                             uint32_t strideC,
+                             uint32_t shift,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t shift,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t shift,
+                                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_mult_stride_instance_q32 struct initialized by
+                     plp_mat_mult_stride_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 16-bit fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+  The output of the matrix multiplication will also be stored as an 16-bit array.
+  Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_stride_q16(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t strideA,
+                             uint32_t strideB,
+                             uint32_t strideC,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 16-bit fix-point
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t shift,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_stride_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      uint32_t shift,
+                                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args      pointer to plp_mat_mult_stride_instance_q16 struct initialized by
+   plp_mat_mult_stride_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_stride_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_stride_q8(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 8-bit fix-point
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_stride_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_stride_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     uint32_t shift,
+                                     int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_mult_stride_instance_q8 struct initialized by
+                     plp_mat_mult_stride_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_stride_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 32-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            int32_t alpha,
+                            int32_t beta,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 32-bit integer matrices kernel for RV32IM
+               extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 32-bit integer matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 32-bit integer
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 32-bit integer matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_i32 struct initialized by
+                      plp_mat_fma_stride_i32_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 16-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            int32_t alpha,
+                            int32_t beta,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 16-bit integer matrices kernel for RV32IM
+               extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 16-bit integer matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 16-bit integer
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 16-bit integer matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_i16 struct initialized by
+                      plp_mat_fma_stride_i16_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 8-bit integer matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           int32_t alpha,
+                           int32_t beta,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 8-bit integer matrices kernel for RV32IM
+               extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   int32_t alpha,
+                                   int32_t beta,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 8-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 8-bit integer
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 8-bit integer matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_i8 struct initialized by
+                      plp_mat_fma_stride_i8_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 32-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            int32_t alpha,
+                            int32_t beta,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 32-bit fix-point matrices kernel for
+               RV32IM extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 32-bit fix-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 32-bit fix-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 32-bit fix-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_q32 struct initialized by
+                      plp_mat_fma_stride_q32_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 16-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            int32_t alpha,
+                            int32_t beta,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 16-bit fix-point matrices kernel for
+               RV32IM extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 16-bit fix-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 16-bit fix-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     int32_t alpha,
+                                     int32_t beta,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 16-bit fix-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_q16 struct initialized by
+                      plp_mat_fma_stride_q16_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 8-bit fix-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           int32_t alpha,
+                           int32_t beta,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 8-bit fix-point matrices kernel for
+               RV32IM extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   int32_t alpha,
+                                   int32_t beta,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 8-bit fix-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 8-bit fix-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     shift     Amount to shift the result of each multiplication.
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 8-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_q8 struct initialized by
+                      plp_mat_fma_stride_q8_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix fused multiply accumulate of 32-bit floating-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            float alpha,
+                            float beta,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix fused multiply accumulate of 32-bit floating-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     float alpha,
+                                     float beta,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix fused multiply accumulate of 32-bit
+               floating-point matrices.
+   @param[in]     pSrcA     points to the first input matrix
+   @param[in]     pSrcB     points to the second input matrix
+   @param[in]     M         height of the first input matrix
+   @param[in]     N         width of the first input matrix and hight of the second
+   @param[in]     O         width of the second input matrix
+   @param[in]     strideA   Stride of matrix A (elements between each row)
+   @param[in]     strideB   Stride of matrix B (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_mat_fma_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     float alpha,
+                                     float beta,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix fused multiply accumulate of 32-bit floating-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_fma_stride_instance_f32 struct initialized by
+                      plp_mat_fma_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_fma_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i32(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 32-bit integer matrices for
+               RV32IM extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 32-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i16(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 16-bit integer matrices for
+               RV32IM extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 16-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 8-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i8(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t strideA,
+                                  uint32_t strideB,
+                                  uint32_t strideC,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 8-bit integer matrices for
+               RV32IM extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t strideA,
+                                          uint32_t strideB,
+                                          uint32_t strideC,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 8-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t nPE,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel strided matrix transposed matrix multiplication of a 32-bit integer
+               matrices for RV32IM extension.
+   @param[in]  args  pointer to plp_mat_mult_stride_instance_i32 struct initialized by
+                     plp_mat_mult_stride_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix transposed matrix multiplication of a 16-bit
+               integer matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t nPE,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel strided matrix transposed matrix multiplication of a 16-bit integer
+               matrices for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_stride_instance_i16 struct initialized by
+                     plp_mat_mult_stride_i16_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix transposed matrix multiplication of a 8-bit
+               integer matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel strided matrix transposed matrix multiplication of a 8-bit integer
+               matrices for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_stride_instance_i8 struct initialized by
+                     plp_mat_mult_stride_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 32-bit
+               fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_stride_q32(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   uint32_t shift,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix transposed matrix multiplication of a 32-bit
+               fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            uint32_t nPE,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 32-bit fix-point matrices for
+               RV32IM extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 32-bit fix-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix transposed matrix multiplication of 32-bit fix-point
+                matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_stride_instance_q32 struct initialized by
+                      plp_mat_mult_trans_stride_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 16-bit
+               fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_stride_q16(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix transposed matrix multiplication of a 16-bit
+               fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            uint32_t nPE,
+                                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 16-bit fix-point matrices for
+               RV32IM extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_stride_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 16-bit fix-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix transposed matrix multiplication of 16-bit fix-point
+   matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_stride_instance_q16 struct initialized by
+                      plp_mat_mult_trans_stride_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_stride_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 8-bit fix-point
+               matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_stride_q8(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t strideA,
+                                  uint32_t strideB,
+                                  uint32_t strideC,
+                                  uint32_t shift,
+                                  int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix transposed matrix multiplication of a 8-bit
+               fix-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_stride_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 8-bit fix-point matrices for
+               RV32IM extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_stride_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t strideA,
+                                          uint32_t strideB,
+                                          uint32_t strideC,
+                                          uint32_t shift,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 8-bit fix-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  shift      Amount to shift the result of each multiplication.
+   @param[out] pDstC      Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix transposed matrix multiplication of 8-bit fix-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_stride_instance_q8 struct initialized by
+                      plp_mat_mult_trans_stride_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_stride_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided matrix transposed matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_f32(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      strided matrix transposed matrix multiplication of a 32-bit floating-point
+               matrices for XPULPV2 extension.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                            const float *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided matrix transposed matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA      points to first the input matrix
+   @param[in]  pSrcB      points to second the input matrix
+   @param[in]  M          Height of first matrix
+   @param[in]  N          Width of first and heigt of second matrix
+   @param[in]  O          Width of second matrix
+   @param[in]  strideA    Stride of matrix A (elements between each row)
+   @param[in]  strideB    Stride of matrix B (elements between each row)
+   @param[in]  strudeY    Stride of output matrix (elements between each row)
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDstC      Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                            const float *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t nPE,
+                                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel strided matrix transposed matrix multiplication of 32-bit floating-point
+                matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_stride_instance_f32 struct initialized by
+                      plp_mat_mult_trans_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i32(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t nPE,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_i32 struct initialized by
+                    plp_mat_mult_cmplx_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i16(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t nPE,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_i16 struct initialized by
+                    plp_mat_mult_cmplx_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i8(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t strideA,
+                                  uint32_t strideB,
+                                  uint32_t strideC,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t strideA,
+                                          uint32_t strideB,
+                                          uint32_t strideC,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_i8 struct initialized by
+                    plp_mat_mult_cmplx_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_f32(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                            const float *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                            const float *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t nPE,
+                                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_stride_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q32(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   uint32_t shift,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 32-bit
+              fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                            const int32_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            uint32_t nPE,
+                                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_q32 struct initialized by
+                    plp_mat_mult_cmplx_stride_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q16(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideC,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                            const int16_t *__restrict__ pSrcB,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t O,
+                                            uint32_t strideA,
+                                            uint32_t strideB,
+                                            uint32_t strideC,
+                                            uint32_t shift,
+                                            uint32_t nPE,
+                                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_q16 struct initialized by
+                    plp_mat_mult_cmplx_stride_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q8(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t strideA,
+                                  uint32_t strideB,
+                                  uint32_t strideC,
+                                  uint32_t shift,
+                                  int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t strideA,
+                                          uint32_t strideB,
+                                          uint32_t strideC,
+                                          uint32_t shift,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Strided strided matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape NxO
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O       Width of matrix SrcB and DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_stride_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                           const int8_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t strideA,
+                                           uint32_t strideB,
+                                           uint32_t strideC,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_q8 struct initialized by
+                    plp_mat_mult_cmplx_stride_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_stride_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 32-bit
+              integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i32(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                                 const int32_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                                  const int32_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex
+              32-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                                  const int32_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t nPE,
+                                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 32-bit integers on
+              XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_i32 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i16(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                                 const int16_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                                  const int16_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex
+              16-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                                  const int16_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t nPE,
+                                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 16-bit integers on
+              XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_i16 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i8(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        uint32_t strideA,
+                                        uint32_t strideB,
+                                        uint32_t strideC,
+                                        int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                                const int8_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                                 const int8_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex 8-bit
+              integers
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                                 const int8_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 uint32_t nPE,
+                                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 8-bit integers on
+              XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_i8 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_f32(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                                  const float *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex
+              32-bit floats
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                                  const float *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t nPE,
+                                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 32-bit floats on
+              XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_f32 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 32-bit
+              fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q32(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         uint32_t shift,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                                 const int32_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 uint32_t shift,
+                                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                                  const int32_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t shift,
+                                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex
+              32-bit fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                                  const int32_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t shift,
+                                                  uint32_t nPE,
+                                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 32-bit fix-point
+              on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_q32 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q16(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                                 const int16_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 uint32_t shift,
+                                                 int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                                  const int16_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t shift,
+                                                  int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex
+              16-bit fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                                  const int16_t *__restrict__ pSrcB,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t O,
+                                                  uint32_t strideA,
+                                                  uint32_t strideB,
+                                                  uint32_t strideC,
+                                                  uint32_t shift,
+                                                  uint32_t nPE,
+                                                  int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 16-bit fix-point
+              on XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_q16 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of strided matrix transpose matrix multiplication for complex 8-bit
+              fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q8(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        uint32_t strideA,
+                                        uint32_t strideB,
+                                        uint32_t strideC,
+                                        uint32_t shift,
+                                        int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                                const int8_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t shift,
+                                                int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      strided matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                                 const int8_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 uint32_t shift,
+                                                 int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel strided matrix transpose matrix multiplication for complex 8-bit
+              fix-point
+  @param[in]  pSrcA   Points to the first input matrix of shape MxN
+  @param[in]  pSrcB   Points to the second input matrix of shape OxN
+  @param[in]  M       Height of matrix SrcA and DstC
+  @param[in]  N       Width of matrix SrcA and SrcB
+  @param[in]  O       Height of matrix SrcB and width of matrix DstC
+  @param[in]  strideA Stride of input matrix A (elements between each row)
+  @param[in]  strideB Stride of input matrix B (elements between each row)
+  @param[in]  strideC Stride of output matrix C (Elements between each row)
+  @param[in]  shift   Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDstC   Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                                 const int8_t *__restrict__ pSrcB,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t O,
+                                                 uint32_t strideA,
+                                                 uint32_t strideB,
+                                                 uint32_t strideC,
+                                                 uint32_t shift,
+                                                 uint32_t nPE,
+                                                 int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel strided matrix transpose matrix multiplication for complex 8-bit fix-point on
+              XpulpV2
+  @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_q8 struct initialized by
+                    plp_mat_mult_trans_cmplx_stride_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_stride_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief   Glue code for matrix addition of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideY,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief   matrix addition of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix addition of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_add_stride_instance_i32 struct initialized by
+                        plp_mat_add_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_add_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideY,
+                            int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix addition of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_add_stride_instance_i16 struct initialized by
+                        plp_mat_add_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideY,
+                           int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideY,
+                                   int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix addition of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_add_stride_instance_i8 struct initialized by
+                        plp_mat_add_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_add_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideY,
+                            float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix addition of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix addition of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_add_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix addition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_add_stride_instance_f32 struct initialized by
+                        plp_mat_add_stride_f32_parallel
+  @return     none
+*/
+
+void plp_mat_add_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief   Glue code for matrix subtraction of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideY,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief   matrix subtraction of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel matrix subtraction of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_sub_stride_instance_i32 struct initialized by
+                        plp_mat_sub_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_sub_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideY,
+                            int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 16-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix subtraction of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_sub_stride_instance_i16 struct initialized by
+                        plp_mat_sub_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideY,
+                           int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   uint32_t strideY,
+                                   int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 8-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideY,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix subtraction of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_sub_stride_instance_i8 struct initialized by
+                        plp_mat_sub_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_sub_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix subtraction of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideY,
+                            float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix subtraction of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix subtraction of a 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideY Stride of output matrix (elements between each row)
+  @param[in]  nPE     Number of cores to use
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_sub_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideY,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix subtraction of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_sub_stride_instance_f32 struct initialized by
+                        plp_mat_sub_stride_f32_parallel
+  @return     none
+*/
+
+void plp_mat_sub_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief   Glue code for strided matrix scale of a 32-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  strideSrc   Stride of input matrix (elements between each row)
+  @param[in]  strideDst   Stride of output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return  none
+*/
+
+void plp_mat_scale_stride_i32(const int32_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int32_t scaleFactor,
+                              int32_t shift,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief   strided matrix scale of a 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return  none
+*/
+
+void plp_mat_scale_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int32_t scaleFactor,
+                                      int32_t shift,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      strided matrix scale of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int32_t scaleFactor,
+                                       int32_t shift,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided matrix scale of a 32-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i32_parallel(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int32_t scaleFactor,
+                                       int32_t shift,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel strided matrix scale of a 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_scale_stride_instance_i32 struct initialized by
+                        plp_mat_scale_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_scale_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided matrix scale of a 16-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i16(const int16_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int16_t scaleFactor,
+                              int32_t shift,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      strided matrix scale of a 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int16_t scaleFactor,
+                                      int32_t shift,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      strided matrix scale of a 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t scaleFactor,
+                                       int32_t shift,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided matrix scale of a 16-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t scaleFactor,
+                                       int32_t shift,
+                                       uint32_t nPE,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel strided matrix scale of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_scale_stride_instance_i16 struct initialized by
+                        plp_mat_scale_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided matrix scale of a 8-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i8(const int8_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t strideSrc,
+                             uint32_t strideDst,
+                             int8_t scaleFactor,
+                             int32_t shift,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      strided matrix scale of a 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     int8_t scaleFactor,
+                                     int32_t shift,
+                                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      strided matrix scale of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[out] pDst        Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t scaleFactor,
+                                      int32_t shift,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided matrix scale of a 8-bit integer matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements before shifting
+  @param[in]  shift       Amount to shift each element
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t scaleFactor,
+                                      int32_t shift,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel strided matrix scale of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_scale_stride_instance_i8 struct initialized by
+                        plp_mat_scale_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_scale_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided matrix scale of a 32-bit floating-point matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_f32(const float *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              float scaleFactor,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      strided matrix scale of a 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       float scaleFactor,
+                                       float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided matrix scale of a 32-bit floating-point matrices.
+  @param[in]  pSrc        Points to the input matrix
+  @param[in]  M           Height of both matrices
+  @param[in]  N           Width of both matrices
+  @param[in]  strideSrc   Stride for input matrix (elements between each row)
+  @param[in]  strideDst   Stride for output matrix (elements between each row)
+  @param[in]  scaleFactor Factor to mulitply all elements
+  @param[in]  nPE         Number of cores to use for computation
+  @param[out] pDst        Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_scale_stride_f32_parallel(const float *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       float scaleFactor,
+                                       uint32_t nPE,
+                                       float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel strided matrix scale of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args      pointer to plp_mat_scale_stride_instance_f32 struct initialized by
+                        plp_mat_scale_stride_f32_parallel
+  @return  none
+*/
+
+void plp_mat_scale_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 32-bit integers identity matrix
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i32(uint32_t N, uint32_t stride, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit integers identity matrix on RV32IM
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i32s_rv32im(uint32_t N, uint32_t stride, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit integers identity matrix on XpulpV2
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i32s_xpulpv2(uint32_t N, uint32_t stride, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 32-bit integers identity matrix in parallel
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i32_parallel(uint32_t N,
+                                        uint32_t stride,
+                                        uint32_t nPE,
+                                        int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit integers identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_i32 struct initialized by
+                    plp_mat_fill_I_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 16-bit integers identity matrix
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i16(uint32_t N, uint32_t stride, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 16-bit integers identity matrix on RV32IM
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i16s_rv32im(uint32_t N, uint32_t stride, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 16-bit integers identity matrix on XpulpV2
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_i16s_xpulpv2(uint32_t N, uint32_t stride, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 16-bit integers identity matrix in parallel
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i16_parallel(uint32_t N,
+                                        uint32_t stride,
+                                        uint32_t nPE,
+                                        int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 16-bit integers identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_i16 struct initialized by
+                    plp_mat_fill_I_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 8-bit integers identity matrix
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i8(uint32_t N, uint32_t stride, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 8-bit integers identity matrix on RV32IM
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i8s_rv32im(uint32_t N, uint32_t stride, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 8-bit integers identity matrix on XpulpV2
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_i8s_xpulpv2(uint32_t N, uint32_t stride, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 8-bit integers identity matrix in parallel
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_i8_parallel(uint32_t N,
+                                       uint32_t stride,
+                                       uint32_t nPE,
+                                       int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 8-bit integers identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_i8 struct initialized by
+                    plp_mat_fill_I_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 32-bit floats identity matrix
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_f32(uint32_t N, uint32_t stride, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit floats identity matrix on XpulpV2
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_f32s_xpulpv2(uint32_t N, uint32_t stride, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 32-bit floats identity matrix in parallel
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_f32_parallel(uint32_t N,
+                                        uint32_t stride,
+                                        uint32_t nPE,
+                                        float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit floats identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_f32 struct initialized by
+                    plp_mat_fill_I_stride_f32_parallel
+  @return     none
+*/
+
+void plp_mat_fill_I_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 32-bit fix-point identity matrix
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q32(uint32_t N,
+                               uint32_t stride,
+                               int32_t fracBits,
+                               int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit fix-point identity matrix on RV32IM
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q32s_rv32im(uint32_t N,
+                                       uint32_t stride,
+                                       int32_t fracBits,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit fix-point identity matrix on XpulpV2
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q32s_xpulpv2(uint32_t N,
+                                        uint32_t stride,
+                                        int32_t fracBits,
+                                        int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 32-bit fix-point identity matrix in parallel
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q32_parallel(
+    uint32_t N, uint32_t stride, int32_t fracBits, uint32_t nPE, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 32-bit fix-point identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_q32 struct initialized by
+                    plp_mat_fill_I_stride_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 16-bit fix-point identity matrix
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q16(uint32_t N,
+                               uint32_t stride,
+                               int32_t fracBits,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 16-bit fix-point identity matrix on RV32IM
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q16s_rv32im(uint32_t N,
+                                       uint32_t stride,
+                                       int32_t fracBits,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 16-bit fix-point identity matrix on XpulpV2
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_q16s_xpulpv2(uint32_t N,
+                                        uint32_t stride,
+                                        int32_t fracBits,
+                                        int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 16-bit fix-point identity matrix in parallel
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q16_parallel(
+    uint32_t N, uint32_t stride, int32_t fracBits, uint32_t nPE, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 16-bit fix-point identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_q16 struct initialized by
+                    plp_mat_fill_I_stride_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 8-bit fix-point identity matrix
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q8(uint32_t N,
+                              uint32_t stride,
+                              int32_t fracBits,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 8-bit fix-point identity matrix on RV32IM
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q8s_rv32im(uint32_t N,
+                                      uint32_t stride,
+                                      int32_t fracBits,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 8-bit fix-point identity matrix on XpulpV2
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_q8s_xpulpv2(uint32_t N,
+                                       uint32_t stride,
+                                       int32_t fracBits,
+                                       int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for creating a strided 8-bit fix-point identity matrix in parallel
+  @param[in]  N        Width and height of the matrix
+  @param[in]  stride   Stride of the matrix (elements between each row)
+  @param[in]  fracBits Decimal point for the appropriate scale
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the output matrix
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+*/
+
+void plp_mat_fill_I_stride_q8_parallel(
+    uint32_t N, uint32_t stride, int32_t fracBits, uint32_t nPE, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Create a strided 8-bit fix-point identity matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_I_stride_instance_q8 struct initialized by
+                    plp_mat_fill_I_stride_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  The diagonal elements will be filled with the value: `1 << fracBits`.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_I_stride_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 32-bit integers matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return  none
+*/
+
+void plp_mat_fill_stride_i32(
+    uint32_t M, uint32_t N, uint32_t stride, int32_t value, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 32-bit integers matrix on RV32IM
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return  none
+*/
+
+void plp_mat_fill_stride_i32s_rv32im(
+    uint32_t M, uint32_t N, uint32_t stride, int32_t value, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 32-bit integers matrix on XpulpV2
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i32s_xpulpv2(
+    uint32_t M, uint32_t N, uint32_t stride, int32_t value, int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 32-bit integers matrix in parallel
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for processing
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i32_parallel(uint32_t M,
+                                      uint32_t N,
+                                      uint32_t stride,
+                                      int32_t value,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 32-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_stride_instance_i32 struct initialized by
+                    plp_mat_fill_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_fill_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 16-bit integers matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i16(
+    uint32_t M, uint32_t N, uint32_t stride, int16_t value, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 16-bit integers matrix on RV32IM
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i16s_rv32im(
+    uint32_t M, uint32_t N, uint32_t stride, int16_t value, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 16-bit integers matrix on XpulpV2
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_stride_i16s_xpulpv2(
+    uint32_t M, uint32_t N, uint32_t stride, int16_t value, int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 16-bit integers matrix in parallel
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for processing
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i16_parallel(uint32_t M,
+                                      uint32_t N,
+                                      uint32_t stride,
+                                      int16_t value,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 16-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_stride_instance_i16 struct initialized by
+                    plp_mat_fill_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 8-bit integers matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i8(
+    uint32_t M, uint32_t N, uint32_t stride, int8_t value, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 8-bit integers matrix on RV32IM
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i8s_rv32im(
+    uint32_t M, uint32_t N, uint32_t stride, int8_t value, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 8-bit integers matrix on XpulpV2
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_stride_i8s_xpulpv2(
+    uint32_t M, uint32_t N, uint32_t stride, int8_t value, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 8-bit integers matrix in parallel
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for processing
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_i8_parallel(
+    uint32_t M, uint32_t N, uint32_t stride, int8_t value, uint32_t nPE, int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 8-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_stride_instance_i8 struct initialized by
+                    plp_mat_fill_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_fill_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 32-bit floats matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_f32(
+    uint32_t M, uint32_t N, uint32_t stride, float value, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 32-bit floats matrix on XpulpV2
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_f32s_xpulpv2(
+    uint32_t M, uint32_t N, uint32_t stride, float value, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for filling an MxN strided 32-bit floats matrix in parallel
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for processing
+  @param[out] pSrc   Points to the output matrix
+  @return     none
+*/
+
+void plp_mat_fill_stride_f32_parallel(
+    uint32_t M, uint32_t N, uint32_t stride, float value, uint32_t nPE, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Fill an MxN strided 32-bit floats matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_fill_stride_instance_f32 struct initialized by
+                    plp_mat_fill_stride_f32_parallel
+  @return  none
+*/
+
+void plp_mat_fill_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 32-bit integers matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return  none
+*/
+
+void plp_mat_copy_stride_i32(const int32_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t strideSrc,
+                             uint32_t strideDst,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 32-bit integers matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return  none
+*/
+
+void plp_mat_copy_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 32-bit integers matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 32-bit integers matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i32_parallel(const int32_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 32-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_copy_stride_instance_i32 struct initialized by
+                    plp_mat_copy_stride_i32_parallel
+  @return     none
+*/
+
+void plp_mat_copy_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 16-bit integers matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i16(const int16_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t strideSrc,
+                             uint32_t strideDst,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 16-bit integers matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 16-bit integers matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_copy_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 16-bit integers matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 16-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_copy_stride_instance_i16 struct initialized by
+                    plp_mat_copy_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_copy_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 8-bit integers matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i8(const int8_t *__restrict__ pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t strideSrc,
+                            uint32_t strideDst,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 8-bit integers matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideSrc,
+                                    uint32_t strideDst,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 8-bit integers matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_copy_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 8-bit integers matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     uint32_t nPE,
+                                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 8-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_copy_stride_instance_i8 struct initialized by
+                    plp_mat_copy_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_copy_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 32-bit floats matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_f32(const float *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t strideSrc,
+                             uint32_t strideDst,
+                             float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 32-bit floats matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to copy an MxN strided 32-bit floats matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+*/
+
+void plp_mat_copy_stride_f32_parallel(const float *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      uint32_t nPE,
+                                      float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Copy an MxN strided 32-bit floats matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_copy_stride_instance_f32 struct initialized by
+                    plp_mat_copy_stride_f32_parallel
+  @return  none
+*/
+
+void plp_mat_copy_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Starts the DMA transfer of an MxN strided 8-bit integers matrix between L2 and L1
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @param[out] copy      Handle of the transfer, wait for it with rt_dma_wait
+  @return     none
+*/
+
+void plp_mat_copy_stride_i8_dma_async(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t *__restrict__ pDst,
+                                      int dir,
+                                      rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+  @brief      Copies an MxN strided 8-bit integers matrix between L2 and L1 with the DMA and waits
+              until it is done
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @return     none
+*/
+
+void plp_mat_copy_stride_i8_dma(const int8_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t strideSrc,
+                                uint32_t strideDst,
+                                int8_t *__restrict__ pDst,
+                                int dir);
+
+/** -------------------------------------------------------
+  @brief      Fills an MxN strided 8-bit integers matrix in L2 with the DMA
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  value  Value to fill the matrix with
+  @param[out] pDst   Points to the output matrix in L2
+  @return     none
+*/
+
+void plp_mat_fill_stride_i8_dma(uint32_t M,
+                                uint32_t N,
+                                uint32_t stride,
+                                int8_t value,
+                                int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Starts the DMA transfer of an MxN strided 16-bit integers matrix between L2 and L1
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @param[out] copy      Handle of the transfer, wait for it with rt_dma_wait
+  @return     none
+*/
+
+void plp_mat_copy_stride_i16_dma_async(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t *__restrict__ pDst,
+                                       int dir,
+                                       rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+  @brief      Copies an MxN strided 16-bit integers matrix between L2 and L1 with the DMA and waits
+              until it is done
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @return     none
+*/
+
+void plp_mat_copy_stride_i16_dma(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 int16_t *__restrict__ pDst,
+                                 int dir);
+
+/** -------------------------------------------------------
+  @brief      Fills an MxN strided 16-bit integers matrix in L2 with the DMA
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  value  Value to fill the matrix with
+  @param[out] pDst   Points to the output matrix in L2
+  @return     none
+*/
+
+void plp_mat_fill_stride_i16_dma(uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 int16_t value,
+                                 int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Starts the DMA transfer of an MxN strided 32-bit integers matrix between L2 and L1
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @param[out] copy      Handle of the transfer, wait for it with rt_dma_wait
+  @return     none
+*/
+
+void plp_mat_copy_stride_i32_dma_async(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int32_t *__restrict__ pDst,
+                                       int dir,
+                                       rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+  @brief      Copies an MxN strided 32-bit integers matrix between L2 and L1 with the DMA and waits
+              until it is done
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @return     none
+*/
+
+void plp_mat_copy_stride_i32_dma(const int32_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 int32_t *__restrict__ pDst,
+                                 int dir);
+
+/** -------------------------------------------------------
+  @brief      Fills an MxN strided 32-bit integers matrix in L2 with the DMA
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  value  Value to fill the matrix with
+  @param[out] pDst   Points to the output matrix in L2
+  @return     none
+*/
+
+void plp_mat_fill_stride_i32_dma(uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 int32_t value,
+                                 int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Starts the DMA transfer of an MxN strided 32-bit floats matrix between L2 and L1
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @param[out] copy      Handle of the transfer, wait for it with rt_dma_wait
+  @return     none
+*/
+
+void plp_mat_copy_stride_f32_dma_async(const float *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       float *__restrict__ pDst,
+                                       int dir,
+                                       rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+  @brief      Copies an MxN strided 32-bit floats matrix between L2 and L1 with the DMA and waits
+              until it is done
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @return     none
+*/
+
+void plp_mat_copy_stride_f32_dma(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 float *__restrict__ pDst,
+                                 int dir);
+
+/** -------------------------------------------------------
+  @brief      Fills an MxN strided 32-bit floats matrix in L2 with the DMA
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  value  Value to fill the matrix with
+  @param[out] pDst   Points to the output matrix in L2
+  @return     none
+*/
+
+void plp_mat_fill_stride_f32_dma(uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 float value,
+                                 float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit integer matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i32(const int32_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+*/
+
+void plp_mat_trans_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit integer matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i32_parallel(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i32 struct initialized by
+                    plp_mat_trans_stride_i32_parallel
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead. Each core
+  works on every nPE-th block row of the input, which makes the cores write to neighbouring words
+  (hence to different memory banks) of the output rows.
+*/
+
+void plp_mat_trans_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 16-bit integer matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i16(const int16_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 16-bit integer matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 2x2 elements. Two rows of a block are loaded as 16 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word.
+*/
+
+void plp_mat_trans_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 16-bit integer matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       uint32_t nPE,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i16 struct initialized by
+                    plp_mat_trans_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 2x2 elements. Two rows of a block are loaded as 16 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word. Each core works on every nPE-th block row of the input, which makes
+  the cores write to neighbouring words (hence to different memory banks) of the output rows.
+*/
+
+void plp_mat_trans_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 8-bit integer matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i8(const int8_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t strideSrc,
+                             uint32_t strideDst,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 8-bit integer matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 8-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 4x4 elements. Four rows of a block are loaded as 8 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word.
+*/
+
+void plp_mat_trans_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 8-bit integer matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 8-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i8 struct initialized by
+                    plp_mat_trans_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 4x4 elements. Four rows of a block are loaded as 8 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word. Each core works on every nPE-th block row of the input, which makes
+  the cores write to neighbouring words (hence to different memory banks) of the output rows.
+*/
+
+void plp_mat_trans_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit floating-point matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32s_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_stride_f32(const float *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit floating-point matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_stride_f32_parallel(const float *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       uint32_t nPE,
+                                       float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_stride_i32 for its computation.
+*/
+
+void plp_mat_trans_cmplx_stride_i16(const int16_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideSrc,
+                                    uint32_t strideDst,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_cmplx_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t strideSrc,
+                                             uint32_t strideDst,
+                                             uint32_t nPE,
+                                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_stride_i32 for its computation.
+*/
+
+void plp_mat_trans_cmplx_stride_q16(const int16_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideSrc,
+                                    uint32_t strideDst,
+                                    int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_cmplx_stride_q16_parallel(const int16_t *__restrict__ pSrc,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t strideSrc,
+                                             uint32_t strideDst,
+                                             uint32_t nPE,
+                                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_cmplx_stride_i32(const int32_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideSrc,
+                                    uint32_t strideDst,
+                                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer complex matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_cmplx_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t strideSrc,
+                                            uint32_t strideDst,
+                                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer complex matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+*/
+
+void plp_mat_trans_cmplx_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t strideSrc,
+                                             uint32_t strideDst,
+                                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_cmplx_stride_i32_parallel(const int32_t *__restrict__ pSrc,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t strideSrc,
+                                             uint32_t strideDst,
+                                             uint32_t nPE,
+                                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel transpose of an MxN strided 32-bit integer complex matrix on XpulpV2
+  @param[in]  args  pointer to plp_mat_trans_cmplx_stride_instance_i32 struct initialized by
+                    plp_mat_trans_cmplx_stride_i32_parallel
+  @return     none
+
+  @par Work distribution
+  Every core transposes a contiguous block of rows of the input, or of columns if the matrix is
+  wider than high, with the single-core kernel. This way, also matrices with few rows use all
+  cores.
+*/
+
+void plp_mat_trans_cmplx_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_cmplx_stride_i32 for its computation.
+*/
+
+void plp_mat_trans_cmplx_stride_f32(const float *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideSrc,
+                                    uint32_t strideDst,
+                                    float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_cmplx_stride_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_cmplx_stride_f32_parallel(const float *__restrict__ pSrc,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t strideSrc,
+                                             uint32_t strideDst,
+                                             uint32_t nPE,
+                                             float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided conjugate transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_i16(const int16_t *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t strideSrc,
+                                  uint32_t strideDst,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Conjugate transpose of an MxN strided 16-bit integer complex matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Conjugate transpose of an MxN strided 16-bit integer complex matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every complex element is moved as a single word, and conjugated in the register with 3 SIMD
+  instructions. The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+*/
+
+void plp_mat_hermitian_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided conjugate transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           uint32_t nPE,
+                                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel conjugate transpose of an MxN strided 16-bit complex matrix on XpulpV2
+  @param[in]  args  pointer to plp_mat_trans_cmplx_stride_instance_i16 struct initialized by
+                    plp_mat_hermitian_stride_i16_parallel
+  @return     none
+
+  @par Work distribution
+  Every core transposes a contiguous block of rows of the input, or of columns if the matrix is
+  wider than high, with the single-core kernel. This way, also matrices with few rows use all
+  cores.
+*/
+
+void plp_mat_hermitian_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided conjugate transpose of 16-bit fixed-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_q16(const int16_t *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t strideSrc,
+                                  uint32_t strideDst,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+@brief      Glue code for parallel strided conjugate transpose of 16-bit fixed-point complex
+              matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_q16_parallel(const int16_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           uint32_t nPE,
+                                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided conjugate transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_i32(const int32_t *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t strideSrc,
+                                  uint32_t strideDst,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Conjugate transpose of an MxN strided 32-bit integer complex matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Conjugate transpose of an MxN strided 32-bit integer complex matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+  The imaginary parts are negated on the fly, with saturation (p.max).
+*/
+
+void plp_mat_hermitian_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel strided conjugate transpose of 32-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_i32_parallel(const int32_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel conjugate transpose of an MxN strided 32-bit complex matrix on XpulpV2
+  @param[in]  args  pointer to plp_mat_trans_cmplx_stride_instance_i32 struct initialized by
+                    plp_mat_hermitian_stride_i32_parallel
+  @return     none
+
+  @par Work distribution
+  Every core transposes a contiguous block of rows of the input, or of columns if the matrix is
+  wider than high, with the single-core kernel. This way, also matrices with few rows use all
+  cores.
+*/
+
+void plp_mat_hermitian_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for strided conjugate transpose of 32-bit floating-point complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_f32(const float *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t strideSrc,
+                                  uint32_t strideDst,
+                                  float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Conjugate transpose of an MxN strided 32-bit floating-point complex matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+  The imaginary parts are negated on the fly.
+*/
+
+void plp_mat_hermitian_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+@brief      Glue code for parallel strided conjugate transpose of 32-bit floating-point complex
+              matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_hermitian_stride_f32_parallel(const float *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           uint32_t nPE,
+                                           float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel conjugate transpose of an MxN strided float complex matrix on XpulpV2
+  @param[in]  args  pointer to plp_mat_trans_cmplx_stride_instance_f32 struct initialized by
+                    plp_mat_hermitian_stride_f32_parallel
+  @return     none
+
+  @par Work distribution
+  Every core transposes a contiguous block of rows of the input, or of columns if the matrix is
+  wider than high, with the single-core kernel. This way, also matrices with few rows use all
+  cores.
+*/
+
+void plp_mat_hermitian_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided Cholesky decomposition of 32-bit floating-point matrices.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_stride_f32(const float *__restrict__ pSrc,
+                                uint32_t N,
+                                uint32_t strideSrc,
+                                uint32_t strideDst,
+                                float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided Cholesky decomposition of 32-bit floating-point
+               matrices.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_stride_f32_parallel(const float *__restrict__ pSrc,
+                                         uint32_t N,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Strided Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                         uint32_t N,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel strided Cholesky decomposition of 32-bit floating-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_cholesky_stride_instance_f32 struct initialized by
+                     plp_mat_cholesky_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_cholesky_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided Cholesky decomposition of 32-bit fix-point matrices.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[in]  fracBits  Number of fractional bits of all matrices
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_stride_q32(const int32_t *__restrict__ pSrc,
+                                uint32_t N,
+                                uint32_t strideSrc,
+                                uint32_t strideDst,
+                                uint32_t fracBits,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided Cholesky decomposition of 32-bit fix-point matrices.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[in]  fracBits  Number of fractional bits of all matrices
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_stride_q32_parallel(const int32_t *__restrict__ pSrc,
+                                         uint32_t N,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         uint32_t fracBits,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Strided Cholesky decomposition of 32-bit fix-point matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[in]  fracBits  Number of fractional bits of all matrices
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_stride_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                        uint32_t N,
+                                        uint32_t strideSrc,
+                                        uint32_t strideDst,
+                                        uint32_t fracBits,
+                                        int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief      Strided Cholesky decomposition of 32-bit fix-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+   @param[in]  N         Width and height of both matrices
+   @param[in]  strideSrc Stride of input matrix (elements between each row)
+   @param[in]  strideDst Stride of output matrix (elements between each row)
+   @param[in]  fracBits  Number of fractional bits of all matrices
+   @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+   @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                         uint32_t N,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         uint32_t fracBits,
+                                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel strided Cholesky decomposition of 32-bit fix-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_cholesky_stride_instance_q32 struct initialized by
+                     plp_mat_cholesky_stride_q32_parallel
+    @return     none
+*/
+
+void plp_mat_cholesky_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided lower triangular solve of 32-bit floating-point matrices.
+   @param[in]  pSrcA   Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+   @param[in]  N       Width and height of A, height of B and X
+   @param[in]  O       Width of B and X (number of right-hand sides)
+   @param[in]  strideA Stride of matrix A (elements between each row)
+   @param[in]  strideB Stride of matrix B (elements between each row)
+   @param[in]  strideC Stride of the output matrix (elements between each row)
+   @param[out] pDstC   Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_stride_f32(const float *__restrict__ pSrcA,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t strideA,
+                                       uint32_t strideB,
+                                       uint32_t strideC,
+                                       float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided lower triangular solve of 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA   Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+   @param[in]  N       Width and height of A, height of B and X
+   @param[in]  O       Width of B and X (number of right-hand sides)
+   @param[in]  strideA Stride of matrix A (elements between each row)
+   @param[in]  strideB Stride of matrix B (elements between each row)
+   @param[in]  strideC Stride of the output matrix (elements between each row)
+   @param[in]  nPE     Number of cores to use for computation
+   @param[out] pDstC   Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t nPE,
+                                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided lower triangular solve of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA   Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+   @param[in]  N       Width and height of A, height of B and X
+   @param[in]  O       Width of B and X (number of right-hand sides)
+   @param[in]  strideA Stride of matrix A (elements between each row)
+   @param[in]  strideB Stride of matrix B (elements between each row)
+   @param[in]  strideC Stride of the output matrix (elements between each row)
+   @param[out] pDstC   Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_tri_lower_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel strided lower triangular solve of 32-bit floating-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_solve_tri_stride_instance_f32 struct initialized by
+                     plp_mat_solve_tri_lower_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_solve_tri_lower_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided lower triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_stride_q32(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t strideA,
+                                       uint32_t strideB,
+                                       uint32_t strideC,
+                                       uint32_t fracBits,
+                                       int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided lower triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[in]  nPE      Number of cores to use for computation
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_lower_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t fracBits,
+                                                uint32_t nPE,
+                                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided lower triangular solve of 32-bit fix-point matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_tri_lower_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                               const int32_t *__restrict__ pSrcB,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               uint32_t strideA,
+                                               uint32_t strideB,
+                                               uint32_t strideC,
+                                               uint32_t fracBits,
+                                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided lower triangular solve of 32-bit fix-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_tri_lower_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t fracBits,
+                                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel strided lower triangular solve of 32-bit fix-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_solve_tri_stride_instance_q32 struct initialized by
+                     plp_mat_solve_tri_lower_stride_q32_parallel
+    @return     none
+*/
+
+void plp_mat_solve_tri_lower_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided upper triangular solve of 32-bit floating-point matrices.
+   @param[in]  pSrcA   Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+   @param[in]  N       Width and height of A, height of B and X
+   @param[in]  O       Width of B and X (number of right-hand sides)
+   @param[in]  strideA Stride of matrix A (elements between each row)
+   @param[in]  strideB Stride of matrix B (elements between each row)
+   @param[in]  strideC Stride of the output matrix (elements between each row)
+   @param[out] pDstC   Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_stride_f32(const float *__restrict__ pSrcA,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t strideA,
+                                       uint32_t strideB,
+                                       uint32_t strideC,
+                                       float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided upper triangular solve of 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA   Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+   @param[in]  N       Width and height of A, height of B and X
+   @param[in]  O       Width of B and X (number of right-hand sides)
+   @param[in]  strideA Stride of matrix A (elements between each row)
+   @param[in]  strideB Stride of matrix B (elements between each row)
+   @param[in]  strideC Stride of the output matrix (elements between each row)
+   @param[in]  nPE     Number of cores to use for computation
+   @param[out] pDstC   Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_stride_f32_parallel(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t nPE,
+                                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided upper triangular solve of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA   Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+   @param[in]  N       Width and height of A, height of B and X
+   @param[in]  O       Width of B and X (number of right-hand sides)
+   @param[in]  strideA Stride of matrix A (elements between each row)
+   @param[in]  strideB Stride of matrix B (elements between each row)
+   @param[in]  strideC Stride of the output matrix (elements between each row)
+   @param[out] pDstC   Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_tri_upper_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel strided upper triangular solve of 32-bit floating-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_solve_tri_stride_instance_f32 struct initialized by
+                     plp_mat_solve_tri_upper_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_solve_tri_upper_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for strided upper triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_stride_q32(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t strideA,
+                                       uint32_t strideB,
+                                       uint32_t strideC,
+                                       uint32_t fracBits,
+                                       int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel strided upper triangular solve of 32-bit fix-point matrices.
+   @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[in]  nPE      Number of cores to use for computation
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_tri_upper_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t fracBits,
+                                                uint32_t nPE,
+                                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided upper triangular solve of 32-bit fix-point matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_tri_upper_stride_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                               const int32_t *__restrict__ pSrcB,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               uint32_t strideA,
+                                               uint32_t strideB,
+                                               uint32_t strideC,
+                                               uint32_t fracBits,
+                                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided upper triangular solve of 32-bit fix-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+   @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+   @param[in]  N        Width and height of A, height of B and X
+   @param[in]  O        Width of B and X (number of right-hand sides)
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of the output matrix (elements between each row)
+   @param[in]  fracBits Number of fractional bits of all matrices
+   @param[out] pDstC    Points to the output matrix X of shape NxO
+   @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_tri_upper_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t fracBits,
+                                                int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel strided upper triangular solve of 32-bit fix-point matrices kernel for
+           XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_solve_tri_stride_instance_q32 struct initialized by
+                     plp_mat_solve_tri_upper_stride_q32_parallel
+    @return     none
+*/
+
+void plp_mat_solve_tri_upper_stride_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for general matrix multiplication of 32-bit floating-point matrices.
+   @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+   @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+   @param[in]     M         height of op(A) and of the output matrix
+   @param[in]     N         width of op(A) and height of op(B)
+   @param[in]     O         width of op(B) and of the output matrix
+   @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+   @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_gemm_f32(const float *__restrict__ pSrcA,
+                  const float *__restrict__ pSrcB,
+                  uint32_t M,
+                  uint32_t N,
+                  uint32_t O,
+                  uint32_t strideA,
+                  uint32_t strideB,
+                  uint32_t strideC,
+                  uint32_t transA,
+                  uint32_t transB,
+                  float alpha,
+                  float beta,
+                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel general matrix multiplication of 32-bit floating-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+   @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+   @param[in]     M         height of op(A) and of the output matrix
+   @param[in]     N         width of op(A) and height of op(B)
+   @param[in]     O         width of op(B) and of the output matrix
+   @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+   @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_gemm_f32_parallel(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           uint32_t transA,
+                           uint32_t transB,
+                           float alpha,
+                           float beta,
+                           uint32_t nPE,
+                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      General matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+   @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+   @param[in]     M         height of op(A) and of the output matrix
+   @param[in]     N         width of op(A) and height of op(B)
+   @param[in]     O         width of op(B) and of the output matrix
+   @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+   @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     alpha     scaling factor of the matrix product
+   @param[in]     beta      scaling factor of the existing output matrix
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_gemm_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           uint32_t transA,
+                           uint32_t transB,
+                           float alpha,
+                           float beta,
+                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel general matrix multiplication of 32-bit floating-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_gemm_instance_f32 struct initialized by
+                     plp_gemm_f32_parallel
+   @return     none
+*/
+
+void plp_gemm_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for general matrix multiplication of complex 32-bit floating-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+   @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+   @param[in]     M         height of op(A) and of the output matrix
+   @param[in]     N         width of op(A) and height of op(B)
+   @param[in]     O         width of op(B) and of the output matrix
+   @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+   @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     pAlpha    points to the complex scaling factor of the matrix product
+   @param[in]     pBeta     points to the complex scaling factor of the existing output
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_gemm_cmplx_f32(const float *__restrict__ pSrcA,
+                        const float *__restrict__ pSrcB,
+                        uint32_t M,
+                        uint32_t N,
+                        uint32_t O,
+                        uint32_t strideA,
+                        uint32_t strideB,
+                        uint32_t strideC,
+                        uint32_t transA,
+                        uint32_t transB,
+                        const float *__restrict__ pAlpha,
+                        const float *__restrict__ pBeta,
+                        float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel general matrix multiplication of complex 32-bit floating-point
+               matrices.
+   @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+   @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+   @param[in]     M         height of op(A) and of the output matrix
+   @param[in]     N         width of op(A) and height of op(B)
+   @param[in]     O         width of op(B) and of the output matrix
+   @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+   @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     pAlpha    points to the complex scaling factor of the matrix product
+   @param[in]     pBeta     points to the complex scaling factor of the existing output
+   @param[in]     nPE       Number of cores to use
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_gemm_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                 const float *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t strideA,
+                                 uint32_t strideB,
+                                 uint32_t strideC,
+                                 uint32_t transA,
+                                 uint32_t transB,
+                                 const float *__restrict__ pAlpha,
+                                 const float *__restrict__ pBeta,
+                                 uint32_t nPE,
+                                 float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      General matrix multiplication of complex 32-bit floating-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+   @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+   @param[in]     M         height of op(A) and of the output matrix
+   @param[in]     N         width of op(A) and height of op(B)
+   @param[in]     O         width of op(B) and of the output matrix
+   @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+   @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+   @param[in]     strideC   Stride of matrix C (elements between each row)
+   @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+   @param[in]     pAlpha    points to the complex scaling factor of the matrix product
+   @param[in]     pBeta     points to the complex scaling factor of the existing output
+   @param[in,out] pDstC     points to the output matrix, which is updated in place
+   @return        none
+*/
+
+void plp_gemm_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                 const float *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t strideA,
+                                 uint32_t strideB,
+                                 uint32_t strideC,
+                                 uint32_t transA,
+                                 uint32_t transB,
+                                 const float *__restrict__ pAlpha,
+                                 const float *__restrict__ pBeta,
+                                 float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel general matrix multiplication of complex 32-bit floating-point matrices
+               kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_gemm_instance_cmplx_f32 struct initialized by
+                     plp_gemm_cmplx_f32_parallel
+   @return     none
+*/
+
+void plp_gemm_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided Frobenius norm of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_f32(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided Frobenius norm of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_f32_parallel(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided Frobenius norm of 32-bit floating-point matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided Frobenius norm of 32-bit floating-point matrices kernel for XPULPV2
+           extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_f32 struct initialized by
+                     plp_mat_norm_fro_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_norm_fro_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided Frobenius norm of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i16(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided Frobenius norm of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided Frobenius norm of 16-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided Frobenius norm of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided Frobenius norm of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_i16 struct initialized by
+                     plp_mat_norm_fro_stride_i16_parallel
+    @return     none
+*/
+
+void plp_mat_norm_fro_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided Frobenius norm of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i8(const int8_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t stride,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided Frobenius norm of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided Frobenius norm of 8-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t stride,
+                                        int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided Frobenius norm of 8-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the Frobenius norm
+   @return     none
+*/
+
+void plp_mat_norm_fro_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided Frobenius norm of 8-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_i8 struct initialized by
+                     plp_mat_norm_fro_stride_i8_parallel
+    @return     none
+*/
+
+void plp_mat_norm_fro_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided infinity norm of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_f32(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided infinity norm of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_f32_parallel(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided infinity norm of 32-bit floating-point matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided infinity norm of 32-bit floating-point matrices kernel for XPULPV2
+           extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_f32 struct initialized by
+                     plp_mat_norm_inf_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_norm_inf_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided infinity norm of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i16(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided infinity norm of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided infinity norm of 16-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided infinity norm of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided infinity norm of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_i16 struct initialized by
+                     plp_mat_norm_inf_stride_i16_parallel
+    @return     none
+*/
+
+void plp_mat_norm_inf_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided infinity norm of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i8(const int8_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t stride,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided infinity norm of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided infinity norm of 8-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t stride,
+                                        int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided infinity norm of 8-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the infinity norm
+   @return     none
+*/
+
+void plp_mat_norm_inf_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided infinity norm of 8-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_i8 struct initialized by
+                     plp_mat_norm_inf_stride_i8_parallel
+    @return     none
+*/
+
+void plp_mat_norm_inf_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided one norm of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_f32(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided one norm of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_f32_parallel(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided one norm of 32-bit floating-point matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided one norm of 32-bit floating-point matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_f32 struct initialized by
+                     plp_mat_norm_one_stride_f32_parallel
+    @return     none
+*/
+
+void plp_mat_norm_one_stride_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided one norm of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i16(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided one norm of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided one norm of 16-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided one norm of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided one norm of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_i16 struct initialized by
+                     plp_mat_norm_one_stride_i16_parallel
+    @return     none
+*/
+
+void plp_mat_norm_one_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided one norm of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i8(const int8_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t stride,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the parallel strided one norm of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[in]  nPE    Number of cores to use for computation
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided one norm of 8-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t stride,
+                                        int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided one norm of 8-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  M      Height of the matrix
+   @param[in]  N      Width of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the one norm
+   @return     none
+*/
+
+void plp_mat_norm_one_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel strided one norm of 8-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args pointer to plp_mat_norm_stride_instance_i8 struct initialized by
+                     plp_mat_norm_one_stride_i8_parallel
+    @return     none
+*/
+
+void plp_mat_norm_one_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided trace of 32-bit floating-point matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_f32(const float *__restrict__ pSrc,
+                              uint32_t N,
+                              uint32_t stride,
+                              float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided trace of 32-bit floating-point matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                       uint32_t N,
+                                       uint32_t stride,
+                                       float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided trace of 16-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_i16(const int16_t *__restrict__ pSrc,
+                              uint32_t N,
+                              uint32_t stride,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided trace of 16-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                      uint32_t N,
+                                      uint32_t stride,
+                                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided trace of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t N,
+                                       uint32_t stride,
+                                       int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Glue code for the strided trace of 8-bit integer matrices.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_i8(const int8_t *__restrict__ pSrc,
+                             uint32_t N,
+                             uint32_t stride,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided trace of 8-bit integer matrices kernel for RV32IM extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                     uint32_t N,
+                                     uint32_t stride,
+                                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief      Strided trace of 8-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrc   Points to the input matrix
+   @param[in]  N      Width and height of the matrix
+   @param[in]  stride Stride of the matrix (elements between each row)
+   @param[out] pRes   Points to the trace
+   @return     none
+*/
+
+void plp_mat_trace_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      uint32_t N,
+                                      uint32_t stride,
+                                      int32_t *__restrict__ pRes);
+
+#endif // __PLP_MATRIX_STRIDE_H__
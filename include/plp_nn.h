@@ -0,0 +1,2339 @@
+/** ==========================================================================
+ * @file     plp_nn.h
+ * @brief    Neural network functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_NN_H__
+#define __PLP_NN_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel requantization of a 32-bit feature map to 8 bits.
+    @param[in]  pSrc      points to the input feature map
+    @param[in]  nPixels   number of pixels of the feature map
+    @param[in]  nChannels number of channels of the feature map
+    @param[in]  pMult     points to the multipliers, one per channel
+    @param[in]  pShift    points to the right shifts, one per channel
+    @param[in]  nPE       number of processing units
+    @param[out] pDst      points to the output feature map
+*/
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t nPixels;
+    uint32_t nChannels;
+    const int32_t *__restrict__ pMult;
+    const uint32_t *__restrict__ pShift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_requantize_instance_i32_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel im2col of 8-bit feature maps.
+    @param[in]  pSrc   points to the input image
+    @param[in]  H      height of the input image
+    @param[in]  W      width of the input image
+    @param[in]  C      number of channels of the input image
+    @param[in]  kH     height of the filter kernel
+    @param[in]  kW     width of the filter kernel
+    @param[in]  stride stride of the kernel in both directions
+    @param[in]  pad    number of zero rows and columns on each side
+    @param[in]  nPE    number of processing units
+    @param[out] pDst   points to the output matrix
+*/
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t H;
+    uint32_t W;
+    uint32_t C;
+    uint32_t kH;
+    uint32_t kW;
+    uint32_t stride;
+    uint32_t pad;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_im2col_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel depthwise convolution of 8-bit feature maps.
+    @param[in]  pSrc    points to the input image
+    @param[in]  H       height of the input image
+    @param[in]  W       width of the input image
+    @param[in]  C       number of channels
+    @param[in]  pKernel points to the filter kernels
+    @param[in]  kH      height of the filter kernels
+    @param[in]  kW      width of the filter kernels
+    @param[in]  stride  stride of the kernel in both directions
+    @param[in]  pad     number of zero rows and columns on each side
+    @param[in]  nPE     number of processing units
+    @param[out] pDst    points to the output image
+*/
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t H;
+    uint32_t W;
+    uint32_t C;
+    const int8_t *__restrict__ pKernel;
+    uint32_t kH;
+    uint32_t kW;
+    uint32_t stride;
+    uint32_t pad;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_conv_depthwise_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 1D convolution of 8-bit sequences.
+    @param[in]  pSrc     points to the input sequence
+    @param[in]  L        length of the input sequence
+    @param[in]  Cin      number of input channels
+    @param[in]  pKernel  points to the filter kernels
+    @param[in]  Cout     number of output channels
+    @param[in]  K        number of taps of the filter kernels
+    @param[in]  dilation distance between two taps
+    @param[in]  stride   distance between two output samples
+    @param[in]  padL     number of zero samples before the input sequence
+    @param[in]  padR     number of zero samples after the input sequence
+    @param[in]  nPE      number of processing units
+    @param[out] pDst     points to the output sequence
+*/
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t L;
+    uint32_t Cin;
+    const int8_t *__restrict__ pKernel;
+    uint32_t Cout;
+    uint32_t K;
+    uint32_t dilation;
+    uint32_t stride;
+    uint32_t padL;
+    uint32_t padR;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_conv1d_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 1D convolution of 32-bit floating-point sequences.
+    @param[in]  pSrc     points to the input sequence
+    @param[in]  L        length of the input sequence
+    @param[in]  Cin      number of input channels
+    @param[in]  pKernel  points to the filter kernels
+    @param[in]  Cout     number of output channels
+    @param[in]  K        number of taps of the filter kernels
+    @param[in]  dilation distance between two taps
+    @param[in]  stride   distance between two output samples
+    @param[in]  padL     number of zero samples before the input sequence
+    @param[in]  padR     number of zero samples after the input sequence
+    @param[in]  nPE      number of processing units
+    @param[out] pDst     points to the output sequence
+*/
+typedef struct {
+    const float32_t *__restrict__ pSrc;
+    uint32_t L;
+    uint32_t Cin;
+    const float32_t *__restrict__ pKernel;
+    uint32_t Cout;
+    uint32_t K;
+    uint32_t dilation;
+    uint32_t stride;
+    uint32_t padL;
+    uint32_t padR;
+    uint32_t nPE;
+    float32_t *__restrict__ pDst;
+} plp_conv1d_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for a parallel time step of a 16-bit fixed-point LSTM cell.
+    @param[in]  pSrcX    points to the input vector
+    @param[in]  pSrcH    points to the previous hidden state
+    @param[in]  pSrcC    points to the previous cell state
+    @param[in]  pWeights points to the stacked weights of the gates
+    @param[in]  pBias    points to the biases of the gates
+    @param[in]  I        length of the input vector
+    @param[in]  H        number of hidden units
+    @param[in]  shift    amount to shift the products to the right
+    @param[in]  fracBits decimal point of the pre-activations
+    @param[in]  nPE      number of processing units
+    @param[out] pDstH    points to the new hidden state
+    @param[out] pDstC    points to the new cell state
+*/
+typedef struct {
+    const int16_t *__restrict__ pSrcX;
+    const int16_t *__restrict__ pSrcH;
+    const int16_t *__restrict__ pSrcC;
+    const int16_t *__restrict__ pWeights;
+    const int16_t *__restrict__ pBias;
+    uint32_t I;
+    uint32_t H;
+    uint32_t shift;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstH;
+    int16_t *__restrict__ pDstC;
+} plp_lstm_cell_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for a parallel time step of an 8-bit LSTM cell.
+    @param[in]  pSrcX    points to the input vector
+    @param[in]  pSrcH    points to the previous hidden state
+    @param[in]  pSrcC    points to the previous cell state
+    @param[in]  pWeights points to the stacked weights of the gates
+    @param[in]  pBias    points to the biases of the gates
+    @param[in]  I        length of the input vector
+    @param[in]  H        number of hidden units
+    @param[in]  shift    amount to shift the products to the right
+    @param[in]  fracBits decimal point of the pre-activations
+    @param[in]  nPE      number of processing units
+    @param[out] pDstH    points to the new hidden state
+    @param[out] pDstC    points to the new cell state
+*/
+typedef struct {
+    const int8_t *__restrict__ pSrcX;
+    const int8_t *__restrict__ pSrcH;
+    const int16_t *__restrict__ pSrcC;
+    const int8_t *__restrict__ pWeights;
+    const int16_t *__restrict__ pBias;
+    uint32_t I;
+    uint32_t H;
+    uint32_t shift;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstH;
+    int16_t *__restrict__ pDstC;
+} plp_lstm_cell_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for a parallel time step of a 16-bit fixed-point GRU cell.
+    @param[in]  pSrcX    points to the input vector
+    @param[in]  pSrcH    points to the previous hidden state
+    @param[in]  pWeights points to the stacked weights of the gates
+    @param[in]  pBias    points to the biases of the gates
+    @param[in]  I        length of the input vector
+    @param[in]  H        number of hidden units
+    @param[in]  shift    amount to shift the products to the right
+    @param[in]  fracBits decimal point of the pre-activations
+    @param[in]  nPE      number of processing units
+    @param[out] pDstH    points to the new hidden state
+*/
+typedef struct {
+    const int16_t *__restrict__ pSrcX;
+    const int16_t *__restrict__ pSrcH;
+    const int16_t *__restrict__ pWeights;
+    const int16_t *__restrict__ pBias;
+    uint32_t I;
+    uint32_t H;
+    uint32_t shift;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstH;
+} plp_gru_cell_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for a parallel time step of an 8-bit GRU cell.
+    @param[in]  pSrcX    points to the input vector
+    @param[in]  pSrcH    points to the previous hidden state
+    @param[in]  pWeights points to the stacked weights of the gates
+    @param[in]  pBias    points to the biases of the gates
+    @param[in]  I        length of the input vector
+    @param[in]  H        number of hidden units
+    @param[in]  shift    amount to shift the products to the right
+    @param[in]  fracBits decimal point of the pre-activations
+    @param[in]  nPE      number of processing units
+    @param[out] pDstH    points to the new hidden state
+*/
+typedef struct {
+    const int8_t *__restrict__ pSrcX;
+    const int8_t *__restrict__ pSrcH;
+    const int8_t *__restrict__ pWeights;
+    const int16_t *__restrict__ pBias;
+    uint32_t I;
+    uint32_t H;
+    uint32_t shift;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstH;
+} plp_gru_cell_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel max and average pooling of 8-bit feature maps.
+    @param[in]  pSrc   points to the input image
+    @param[in]  H      height of the input image
+    @param[in]  W      width of the input image
+    @param[in]  C      number of channels
+    @param[in]  kH     height of the pooling window
+    @param[in]  kW     width of the pooling window
+    @param[in]  stride stride of the window in both directions
+    @param[in]  nPE    number of processing units
+    @param[out] pDst   points to the output image
+*/
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t H;
+    uint32_t W;
+    uint32_t C;
+    uint32_t kH;
+    uint32_t kW;
+    uint32_t stride;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_pool_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel softmax of a 32-bit floating-point matrix.
+    @param[in]  pSrc   points to the input matrix
+    @param[in]  nRows  number of rows
+    @param[in]  rowLen number of elements of a row
+    @param[in]  nPE    number of processing units
+    @param[out] pDst   points to the output matrix
+*/
+typedef struct {
+    const float32_t *__restrict__ pSrc;
+    uint32_t nRows;
+    uint32_t rowLen;
+    uint32_t nPE;
+    float32_t *__restrict__ pDst;
+} plp_softmax_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel softmax of a 16-bit fixed-point matrix.
+    @param[in]  pSrc     points to the input matrix
+    @param[in]  nRows    number of rows
+    @param[in]  rowLen   number of elements of a row
+    @param[in]  fracBits decimal point of the input and output
+    @param[in]  nPE      number of processing units
+    @param[out] pDst     points to the output matrix
+*/
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t nRows;
+    uint32_t rowLen;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_softmax_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel layer normalization of a 32-bit
+           floating-point matrix.
+    @param[in]  pSrc   points to the input matrix
+    @param[in]  nRows  number of rows
+    @param[in]  rowLen number of elements of a row
+    @param[in]  pGamma points to the scales
+    @param[in]  pBeta  points to the offsets
+    @param[in]  eps    added to the variance
+    @param[in]  nPE    number of processing units
+    @param[out] pDst   points to the output matrix
+*/
+typedef struct {
+    const float32_t *__restrict__ pSrc;
+    uint32_t nRows;
+    uint32_t rowLen;
+    const float32_t *__restrict__ pGamma;
+    const float32_t *__restrict__ pBeta;
+    float32_t eps;
+    uint32_t nPE;
+    float32_t *__restrict__ pDst;
+} plp_layernorm_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel layer normalization of a 16-bit fixed-point
+           matrix.
+    @param[in]  pSrc     points to the input matrix
+    @param[in]  nRows    number of rows
+    @param[in]  rowLen   number of elements of a row
+    @param[in]  pGamma   points to the scales
+    @param[in]  pBeta    points to the offsets
+    @param[in]  eps      added to the variance
+    @param[in]  fracBits decimal point of the input and output
+    @param[in]  nPE      number of processing units
+    @param[out] pDst     points to the output matrix
+*/
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t nRows;
+    uint32_t rowLen;
+    const int16_t *__restrict__ pGamma;
+    const int16_t *__restrict__ pBeta;
+    uint32_t eps;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_layernorm_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel quantization of a 32-bit floating-point vector to
+           8 bits.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of processing units
+    @param[in]  pMin       buffer for the partial minima, one per core
+    @param[in]  pMax       buffer for the partial maxima, one per core
+    @param[out] pDst       points to the output vector
+    @param[out] pScale     scale of the quantization returned here
+    @param[out] pZeroPoint zero point of the quantization returned here
+*/
+typedef struct {
+    const float32_t *__restrict__ pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    float32_t *__restrict__ pMin;
+    float32_t *__restrict__ pMax;
+    int8_t *__restrict__ pDst;
+    float32_t *__restrict__ pScale;
+    int32_t *__restrict__ pZeroPoint;
+} plp_quantize_instance_f32_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel dequantization of a 32-bit integer vector to
+           32-bit floating-point.
+    @param[in]  pSrc      points to the input vector
+    @param[in]  blockSize number of samples in the input vector
+    @param[in]  scale     scale of the quantization
+    @param[in]  zeroPoint zero point of the quantization
+    @param[in]  nPE       number of processing units
+    @param[out] pDst      points to the output vector
+*/
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t blockSize;
+    float32_t scale;
+    int32_t zeroPoint;
+    uint32_t nPE;
+    float32_t *__restrict__ pDst;
+} plp_dequantize_instance_i32_f32;
+
+/** -------------------------------------------------------
+   @brief Glue code for the requantization of a 32-bit feature map to 8 bits.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8(const int32_t *__restrict__ pSrc,
+                           uint32_t nPixels,
+                           uint32_t nChannels,
+                           const int32_t *__restrict__ pMult,
+                           const uint32_t *__restrict__ pShift,
+                           int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Requantization of a 32-bit feature map to 8 bits kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8s_rv32im(const int32_t *__restrict__ pSrc,
+                                   uint32_t nPixels,
+                                   uint32_t nChannels,
+                                   const int32_t *__restrict__ pMult,
+                                   const uint32_t *__restrict__ pShift,
+                                   int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Requantization of a 32-bit feature map to 8 bits kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                    uint32_t nPixels,
+                                    uint32_t nChannels,
+                                    const int32_t *__restrict__ pMult,
+                                    const uint32_t *__restrict__ pShift,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel requantization of a 32-bit feature map to 8 bits.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8_parallel(const int32_t *__restrict__ pSrc,
+                                    uint32_t nPixels,
+                                    uint32_t nChannels,
+                                    const int32_t *__restrict__ pMult,
+                                    const uint32_t *__restrict__ pShift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel requantization of a 32-bit feature map to 8 bits kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_requantize_instance_i32_i8 struct initialized by
+                     plp_requantize_i32_i8_parallel
+   @return     none
+*/
+
+void plp_requantize_i32_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for im2col of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+*/
+
+void plp_im2col_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t H,
+                   uint32_t W,
+                   uint32_t C,
+                   uint32_t kH,
+                   uint32_t kW,
+                   uint32_t stride,
+                   uint32_t pad,
+                   int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief im2col of an 8-bit image kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+*/
+
+void plp_im2col_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t H,
+                           uint32_t W,
+                           uint32_t C,
+                           uint32_t kH,
+                           uint32_t kW,
+                           uint32_t stride,
+                           uint32_t pad,
+                           int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief im2col of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+*/
+
+void plp_im2col_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            uint32_t pad,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel im2col of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+*/
+
+void plp_im2col_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            uint32_t pad,
+                            uint32_t nPE,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel im2col of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_im2col_instance_i8 struct initialized by
+                     plp_im2col_i8_parallel
+   @return     none
+*/
+
+void plp_im2col_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for depthwise 2D convolution of 8-bit images.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  pKernel   points to the filter kernels (kH x kW x C, channel last)
+   @param[in]  kH        height of the filter kernels
+   @param[in]  kW        width of the filter kernels
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_conv_depthwise_i8(const int8_t *__restrict__ pSrc,
+                           uint32_t H,
+                           uint32_t W,
+                           uint32_t C,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kH,
+                           uint32_t kW,
+                           uint32_t stride,
+                           uint32_t pad,
+                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Depthwise 2D convolution of 8-bit images kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  pKernel   points to the filter kernels (kH x kW x C, channel last)
+   @param[in]  kH        height of the filter kernels
+   @param[in]  kW        width of the filter kernels
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_conv_depthwise_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                   uint32_t H,
+                                   uint32_t W,
+                                   uint32_t C,
+                                   const int8_t *__restrict__ pKernel,
+                                   uint32_t kH,
+                                   uint32_t kW,
+                                   uint32_t stride,
+                                   uint32_t pad,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Depthwise 2D convolution of 8-bit images kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  pKernel   points to the filter kernels (kH x kW x C, channel last)
+   @param[in]  kH        height of the filter kernels
+   @param[in]  kW        width of the filter kernels
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_conv_depthwise_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                    uint32_t H,
+                                    uint32_t W,
+                                    uint32_t C,
+                                    const int8_t *__restrict__ pKernel,
+                                    uint32_t kH,
+                                    uint32_t kW,
+                                    uint32_t stride,
+                                    uint32_t pad,
+                                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel depthwise 2D convolution of 8-bit images.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  pKernel   points to the filter kernels (kH x kW x C, channel last)
+   @param[in]  kH        height of the filter kernels
+   @param[in]  kW        width of the filter kernels
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_conv_depthwise_i8_parallel(const int8_t *__restrict__ pSrc,
+                                    uint32_t H,
+                                    uint32_t W,
+                                    uint32_t C,
+                                    const int8_t *__restrict__ pKernel,
+                                    uint32_t kH,
+                                    uint32_t kW,
+                                    uint32_t stride,
+                                    uint32_t pad,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel depthwise 2D convolution of 8-bit images kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_conv_depthwise_instance_i8 struct initialized by
+                     plp_conv_depthwise_i8_parallel
+   @return     none
+*/
+
+void plp_conv_depthwise_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for dilated and strided 1D convolution of 8-bit sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t L,
+                   uint32_t Cin,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t Cout,
+                   uint32_t K,
+                   uint32_t dilation,
+                   uint32_t stride,
+                   uint32_t padL,
+                   uint32_t padR,
+                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 8-bit sequences kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t L,
+                           uint32_t Cin,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t Cout,
+                           uint32_t K,
+                           uint32_t dilation,
+                           uint32_t stride,
+                           uint32_t padL,
+                           uint32_t padR,
+                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 8-bit sequences kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel dilated and strided 1D convolution of 8-bit sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel dilated and strided 1D convolution of 8-bit sequences kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_conv1d_instance_i8 struct initialized by
+                     plp_conv1d_i8_parallel
+   @return     none
+*/
+
+void plp_conv1d_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for dilated and strided 1D convolution of 4-bit sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i4(const int8_t *__restrict__ pSrc,
+                   uint32_t L,
+                   uint32_t Cin,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t Cout,
+                   uint32_t K,
+                   uint32_t dilation,
+                   uint32_t stride,
+                   uint32_t padL,
+                   uint32_t padR,
+                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 4-bit sequences kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i4s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t L,
+                           uint32_t Cin,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t Cout,
+                           uint32_t K,
+                           uint32_t dilation,
+                           uint32_t stride,
+                           uint32_t padL,
+                           uint32_t padR,
+                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 4-bit sequences kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i4s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst);
+
+#if defined(PLP_XPULPNN)
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 4-bit sequences kernel for XpulpNN extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i4s_xpulpnn(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst);
+
+#endif // PLP_XPULPNN
+
+/** -------------------------------------------------------
+   @brief Glue code for dilated and strided 1D convolution of 2-bit sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i2(const int8_t *__restrict__ pSrc,
+                   uint32_t L,
+                   uint32_t Cin,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t Cout,
+                   uint32_t K,
+                   uint32_t dilation,
+                   uint32_t stride,
+                   uint32_t padL,
+                   uint32_t padR,
+                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 2-bit sequences kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i2s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t L,
+                           uint32_t Cin,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t Cout,
+                           uint32_t K,
+                           uint32_t dilation,
+                           uint32_t stride,
+                           uint32_t padL,
+                           uint32_t padR,
+                           int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 2-bit sequences kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i2s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst);
+
+#if defined(PLP_XPULPNN)
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 2-bit sequences kernel for XpulpNN extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i2s_xpulpnn(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst);
+
+#endif // PLP_XPULPNN
+
+/** -------------------------------------------------------
+   @brief Glue code for dilated and strided 1D convolution of 32-bit floating-point sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t L,
+                    uint32_t Cin,
+                    const float32_t *__restrict__ pKernel,
+                    uint32_t Cout,
+                    uint32_t K,
+                    uint32_t dilation,
+                    uint32_t stride,
+                    uint32_t padL,
+                    uint32_t padR,
+                    float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dilated and strided 1D convolution of 32-bit floating-point sequences kernel for XPULPV2
+          extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t L,
+                             uint32_t Cin,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t Cout,
+                             uint32_t K,
+                             uint32_t dilation,
+                             uint32_t stride,
+                             uint32_t padL,
+                             uint32_t padR,
+                             float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel dilated and strided 1D convolution of 32-bit floating-point
+          sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t L,
+                             uint32_t Cin,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t Cout,
+                             uint32_t K,
+                             uint32_t dilation,
+                             uint32_t stride,
+                             uint32_t padL,
+                             uint32_t padR,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel dilated and strided 1D convolution of 32-bit floating-point sequences kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_conv1d_instance_f32 struct initialized by
+                     plp_conv1d_f32_parallel
+   @return     none
+*/
+
+void plp_conv1d_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for one time step of a 16-bit fixed-point LSTM cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_q16(const int16_t *__restrict__ pSrcX,
+                       const int16_t *__restrict__ pSrcH,
+                       const int16_t *__restrict__ pSrcC,
+                       const int16_t *__restrict__ pWeights,
+                       const int16_t *__restrict__ pBias,
+                       uint32_t I,
+                       uint32_t H,
+                       uint32_t shift,
+                       uint32_t fracBits,
+                       int16_t *__restrict__ pDstH,
+                       int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief One time step of a 16-bit fixed-point LSTM cell kernel for RV32IM extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_q16s_rv32im(const int16_t *__restrict__ pSrcX,
+                               const int16_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pSrcC,
+                               const int16_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDstH,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief One time step of a 16-bit fixed-point LSTM cell kernel for XPULPV2 extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_q16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                                const int16_t *__restrict__ pSrcH,
+                                const int16_t *__restrict__ pSrcC,
+                                const int16_t *__restrict__ pWeights,
+                                const int16_t *__restrict__ pBias,
+                                uint32_t I,
+                                uint32_t H,
+                                uint32_t shift,
+                                uint32_t fracBits,
+                                int16_t *__restrict__ pDstH,
+                                int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Glue code for one parallel time step of a 16-bit fixed-point LSTM cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_q16_parallel(const int16_t *__restrict__ pSrcX,
+                                const int16_t *__restrict__ pSrcH,
+                                const int16_t *__restrict__ pSrcC,
+                                const int16_t *__restrict__ pWeights,
+                                const int16_t *__restrict__ pBias,
+                                uint32_t I,
+                                uint32_t H,
+                                uint32_t shift,
+                                uint32_t fracBits,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pDstH,
+                                int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Parallel time step of a 16-bit fixed-point LSTM cell kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_lstm_cell_instance_q16 struct initialized by
+                     plp_lstm_cell_q16_parallel
+   @return     none
+*/
+
+void plp_lstm_cell_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for one time step of an 8-bit LSTM cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_i8(const int8_t *__restrict__ pSrcX,
+                      const int8_t *__restrict__ pSrcH,
+                      const int16_t *__restrict__ pSrcC,
+                      const int8_t *__restrict__ pWeights,
+                      const int16_t *__restrict__ pBias,
+                      uint32_t I,
+                      uint32_t H,
+                      uint32_t shift,
+                      uint32_t fracBits,
+                      int8_t *__restrict__ pDstH,
+                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief One time step of an 8-bit LSTM cell kernel for RV32IM extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_i8s_rv32im(const int8_t *__restrict__ pSrcX,
+                              const int8_t *__restrict__ pSrcH,
+                              const int16_t *__restrict__ pSrcC,
+                              const int8_t *__restrict__ pWeights,
+                              const int16_t *__restrict__ pBias,
+                              uint32_t I,
+                              uint32_t H,
+                              uint32_t shift,
+                              uint32_t fracBits,
+                              int8_t *__restrict__ pDstH,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief One time step of an 8-bit LSTM cell kernel for XPULPV2 extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_i8s_xpulpv2(const int8_t *__restrict__ pSrcX,
+                               const int8_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pSrcC,
+                               const int8_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               int8_t *__restrict__ pDstH,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Glue code for one parallel time step of an 8-bit LSTM cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_i8_parallel(const int8_t *__restrict__ pSrcX,
+                               const int8_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pSrcC,
+                               const int8_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               uint32_t nPE,
+                               int8_t *__restrict__ pDstH,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief Parallel time step of an 8-bit LSTM cell kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_lstm_cell_instance_i8 struct initialized by
+                     plp_lstm_cell_i8_parallel
+   @return     none
+*/
+
+void plp_lstm_cell_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for one time step of a 16-bit fixed-point GRU cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_q16(const int16_t *__restrict__ pSrcX,
+                      const int16_t *__restrict__ pSrcH,
+                      const int16_t *__restrict__ pWeights,
+                      const int16_t *__restrict__ pBias,
+                      uint32_t I,
+                      uint32_t H,
+                      uint32_t shift,
+                      uint32_t fracBits,
+                      int16_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief One time step of a 16-bit fixed-point GRU cell kernel for RV32IM extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_q16s_rv32im(const int16_t *__restrict__ pSrcX,
+                              const int16_t *__restrict__ pSrcH,
+                              const int16_t *__restrict__ pWeights,
+                              const int16_t *__restrict__ pBias,
+                              uint32_t I,
+                              uint32_t H,
+                              uint32_t shift,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief One time step of a 16-bit fixed-point GRU cell kernel for XPULPV2 extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_q16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                               const int16_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief Glue code for one parallel time step of a 16-bit fixed-point GRU cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_q16_parallel(const int16_t *__restrict__ pSrcX,
+                               const int16_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief Parallel time step of a 16-bit fixed-point GRU cell kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_gru_cell_instance_q16 struct initialized by
+                     plp_gru_cell_q16_parallel
+   @return     none
+*/
+
+void plp_gru_cell_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for one time step of an 8-bit GRU cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_i8(const int8_t *__restrict__ pSrcX,
+                     const int8_t *__restrict__ pSrcH,
+                     const int8_t *__restrict__ pWeights,
+                     const int16_t *__restrict__ pBias,
+                     uint32_t I,
+                     uint32_t H,
+                     uint32_t shift,
+                     uint32_t fracBits,
+                     int8_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief One time step of an 8-bit GRU cell kernel for RV32IM extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_i8s_rv32im(const int8_t *__restrict__ pSrcX,
+                             const int8_t *__restrict__ pSrcH,
+                             const int8_t *__restrict__ pWeights,
+                             const int16_t *__restrict__ pBias,
+                             uint32_t I,
+                             uint32_t H,
+                             uint32_t shift,
+                             uint32_t fracBits,
+                             int8_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief One time step of an 8-bit GRU cell kernel for XPULPV2 extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_i8s_xpulpv2(const int8_t *__restrict__ pSrcX,
+                              const int8_t *__restrict__ pSrcH,
+                              const int8_t *__restrict__ pWeights,
+                              const int16_t *__restrict__ pBias,
+                              uint32_t I,
+                              uint32_t H,
+                              uint32_t shift,
+                              uint32_t fracBits,
+                              int8_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief Glue code for one parallel time step of an 8-bit GRU cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_i8_parallel(const int8_t *__restrict__ pSrcX,
+                              const int8_t *__restrict__ pSrcH,
+                              const int8_t *__restrict__ pWeights,
+                              const int16_t *__restrict__ pBias,
+                              uint32_t I,
+                              uint32_t H,
+                              uint32_t shift,
+                              uint32_t fracBits,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDstH);
+
+/** -------------------------------------------------------
+   @brief Parallel time step of an 8-bit GRU cell kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_gru_cell_instance_i8 struct initialized by
+                     plp_gru_cell_i8_parallel
+   @return     none
+*/
+
+void plp_gru_cell_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for max pooling of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_maxpool_i8(const int8_t *__restrict__ pSrc,
+                    uint32_t H,
+                    uint32_t W,
+                    uint32_t C,
+                    uint32_t kH,
+                    uint32_t kW,
+                    uint32_t stride,
+                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Max pooling of an 8-bit image kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_maxpool_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Max pooling of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_maxpool_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                             uint32_t H,
+                             uint32_t W,
+                             uint32_t C,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t stride,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel max pooling of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_maxpool_i8_parallel(const int8_t *__restrict__ pSrc,
+                             uint32_t H,
+                             uint32_t W,
+                             uint32_t C,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t stride,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel max pooling of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_pool_instance_i8 struct initialized by
+                     plp_maxpool_i8_parallel
+   @return     none
+*/
+
+void plp_maxpool_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for average pooling of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_avgpool_i8(const int8_t *__restrict__ pSrc,
+                    uint32_t H,
+                    uint32_t W,
+                    uint32_t C,
+                    uint32_t kH,
+                    uint32_t kW,
+                    uint32_t stride,
+                    int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Average pooling of an 8-bit image kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_avgpool_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Average pooling of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_avgpool_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                             uint32_t H,
+                             uint32_t W,
+                             uint32_t C,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t stride,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for parallel average pooling of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_avgpool_i8_parallel(const int8_t *__restrict__ pSrc,
+                             uint32_t H,
+                             uint32_t W,
+                             uint32_t C,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t stride,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel average pooling of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_pool_instance_i8 struct initialized by
+                     plp_avgpool_i8_parallel
+   @return     none
+*/
+
+void plp_avgpool_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for the softmax of the rows of a 32-bit floating-point matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_f32(const float32_t *__restrict__ pSrc,
+                     uint32_t nRows,
+                     uint32_t rowLen,
+                     float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Softmax of the rows of a 32-bit floating-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel softmax of the rows of a 32-bit floating-point matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_f32_parallel(const float32_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel softmax of the rows of a 32-bit floating-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_softmax_instance_f32 struct initialized by
+                     plp_softmax_f32_parallel
+   @return     none
+*/
+
+void plp_softmax_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for the softmax of the rows of a 16-bit fixed-point matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  fracBits  decimal point of the input and of the output, format
+                         Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_q16(const int16_t *__restrict__ pSrc,
+                     uint32_t nRows,
+                     uint32_t rowLen,
+                     uint32_t fracBits,
+                     int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Softmax of the rows of a 16-bit fixed-point matrix kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  fracBits  decimal point of the input and of the output, format
+                         Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t nRows,
+                             uint32_t rowLen,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Softmax of the rows of a 16-bit fixed-point matrix kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  fracBits  decimal point of the input and of the output, format
+                         Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel softmax of the rows of a 16-bit fixed-point matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  fracBits  decimal point of the input and of the output, format
+                         Q(16-fracBits).fracBits
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_q16_parallel(const int16_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              uint32_t fracBits,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel softmax of the rows of a 16-bit fixed-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_softmax_instance_q16 struct initialized by
+                     plp_softmax_q16_parallel
+   @return     none
+*/
+
+void plp_softmax_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for the layer normalization of the rows of a 32-bit floating-point
+          matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, e.g. 1e-5
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_f32(const float32_t *__restrict__ pSrc,
+                       uint32_t nRows,
+                       uint32_t rowLen,
+                       const float32_t *__restrict__ pGamma,
+                       const float32_t *__restrict__ pBeta,
+                       float32_t eps,
+                       float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Layer normalization of the rows of a 32-bit floating-point matrix kernel for
+          XPULPV2 extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, e.g. 1e-5
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const float32_t *__restrict__ pGamma,
+                                const float32_t *__restrict__ pBeta,
+                                float32_t eps,
+                                float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel layer normalization of the rows of a 32-bit floating-point
+          matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, e.g. 1e-5
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_f32_parallel(const float32_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const float32_t *__restrict__ pGamma,
+                                const float32_t *__restrict__ pBeta,
+                                float32_t eps,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel layer normalization of the rows of a 32-bit floating-point matrix
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_layernorm_instance_f32 struct initialized by
+                     plp_layernorm_f32_parallel
+   @return     none
+*/
+
+void plp_layernorm_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for the layer normalization of the rows of a 16-bit fixed-point
+          matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, in Q(32-2*fracBits).(2*fracBits)
+   @param[in]  fracBits  decimal point of the input, the scales, the offsets and the output,
+                         format Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_q16(const int16_t *__restrict__ pSrc,
+                       uint32_t nRows,
+                       uint32_t rowLen,
+                       const int16_t *__restrict__ pGamma,
+                       const int16_t *__restrict__ pBeta,
+                       uint32_t eps,
+                       uint32_t fracBits,
+                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Layer normalization of the rows of a 16-bit fixed-point matrix kernel for RV32IM
+          extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, in Q(32-2*fracBits).(2*fracBits)
+   @param[in]  fracBits  decimal point of the input, the scales, the offsets and the output,
+                         format Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                               uint32_t nRows,
+                               uint32_t rowLen,
+                               const int16_t *__restrict__ pGamma,
+                               const int16_t *__restrict__ pBeta,
+                               uint32_t eps,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Layer normalization of the rows of a 16-bit fixed-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, in Q(32-2*fracBits).(2*fracBits)
+   @param[in]  fracBits  decimal point of the input, the scales, the offsets and the output,
+                         format Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const int16_t *__restrict__ pGamma,
+                                const int16_t *__restrict__ pBeta,
+                                uint32_t eps,
+                                uint32_t fracBits,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel layer normalization of the rows of a 16-bit fixed-point
+          matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, in Q(32-2*fracBits).(2*fracBits)
+   @param[in]  fracBits  decimal point of the input, the scales, the offsets and the output,
+                         format Q(16-fracBits).fracBits
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_q16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const int16_t *__restrict__ pGamma,
+                                const int16_t *__restrict__ pBeta,
+                                uint32_t eps,
+                                uint32_t fracBits,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel layer normalization of the rows of a 16-bit fixed-point matrix
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_layernorm_instance_q16 struct initialized by
+                     plp_layernorm_q16_parallel
+   @return     none
+*/
+
+void plp_layernorm_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Computes the scale and the zero point of the 8-bit quantization of the range
+          [min, max], which is extended to contain 0, such that 0 is represented exactly.
+   @param[in]  min        smallest value to be quantized
+   @param[in]  max        largest value to be quantized
+   @param[out] pScale     scale returned here, (max - min) / 255, or 1 for an empty range
+   @param[out] pZeroPoint zero point returned here, in [-128, 127]
+   @return     none
+*/
+
+static inline void plp_quantize_params_f32_i8(float32_t min,
+                                              float32_t max,
+                                              float32_t *pScale,
+                                              int32_t *pZeroPoint) {
+    float32_t scale, zp;
+
+    min = (min < 0.0f) ? min : 0.0f;
+    max = (max > 0.0f) ? max : 0.0f;
+    scale = (max - min) * (1.0f / 255.0f);
+
+    if (scale == 0.0f) {
+        *pScale = 1.0f;
+        *pZeroPoint = 0;
+        return;
+    }
+
+    // min is mapped to -128, rounded half away from zero
+    zp = -128.0f - min / scale;
+    zp += (zp < 0.0f) ? -0.5f : 0.5f;
+
+    *pScale = scale;
+    *pZeroPoint = ((int32_t)zp > 127) ? 127 : (int32_t)zp;
+}
+
+/** -------------------------------------------------------
+   @brief Quantizes a single value, x / scale + zeroPoint rounded half away from zero and
+          saturated to [-128, 127].
+   @param[in]  x          value to be quantized
+   @param[in]  invScale   inverse of the scale
+   @param[in]  zeroPoint  zero point, in [-128, 127]
+   @return     quantized value
+*/
+
+static inline int32_t plp_quantize_f32_i8_value(float32_t x,
+                                                float32_t invScale,
+                                                int32_t zeroPoint) {
+    x = x * invScale + (float32_t)zeroPoint;
+    x += (x < 0.0f) ? -0.5f : 0.5f;
+    if (x >= 127.0f) {
+        return 127;
+    } else if (x <= -128.0f) {
+        return -128;
+    }
+    return (int32_t)x;
+}
+
+/** -------------------------------------------------------
+   @brief Glue code for the quantization of a 32-bit floating-point vector to 8 bits, with the
+          scale and the zero point computed from the range of the vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[out] pDst       points to the output vector
+   @param[out] pScale     scale of the quantization returned here
+   @param[out] pZeroPoint zero point of the quantization returned here
+   @return     none
+*/
+
+void plp_quantize_f32_i8(const float32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pDst,
+                         float32_t *__restrict__ pScale,
+                         int32_t *__restrict__ pZeroPoint);
+
+/** -------------------------------------------------------
+   @brief Quantization of a 32-bit floating-point vector to 8 bits kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[out] pDst       points to the output vector
+   @param[out] pScale     scale of the quantization returned here
+   @param[out] pZeroPoint zero point of the quantization returned here
+   @return     none
+*/
+
+void plp_quantize_f32_i8s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int8_t *__restrict__ pDst,
+                                  float32_t *__restrict__ pScale,
+                                  int32_t *__restrict__ pZeroPoint);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel quantization of a 32-bit floating-point vector to 8 bits,
+          with the scale and the zero point computed from the range of the vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output vector
+   @param[out] pScale     scale of the quantization returned here
+   @param[out] pZeroPoint zero point of the quantization returned here
+   @return     none
+*/
+
+void plp_quantize_f32_i8_parallel(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  uint32_t nPE,
+                                  int8_t *__restrict__ pDst,
+                                  float32_t *__restrict__ pScale,
+                                  int32_t *__restrict__ pZeroPoint);
+
+/** -------------------------------------------------------
+   @brief Parallel quantization of a 32-bit floating-point vector to 8 bits kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_quantize_instance_f32_i8 struct initialized by
+                     plp_quantize_f32_i8_parallel
+   @return     none
+*/
+
+void plp_quantize_f32_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief Glue code for the dequantization of a 32-bit integer vector to 32-bit floating-point.
+   @param[in]  pSrc       points to the input vector, e.g. the accumulators of plp_mat_mult_i8
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  scale      scale of the quantization
+   @param[in]  zeroPoint  zero point of the quantization
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_dequantize_i32_f32(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            float32_t scale,
+                            int32_t zeroPoint,
+                            float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Dequantization of a 32-bit integer vector to 32-bit floating-point kernel for XPULPV2
+          extension.
+   @param[in]  pSrc       points to the input vector, e.g. the accumulators of plp_mat_mult_i8
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  scale      scale of the quantization
+   @param[in]  zeroPoint  zero point of the quantization
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_dequantize_i32_f32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     float32_t scale,
+                                     int32_t zeroPoint,
+                                     float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Glue code for the parallel dequantization of a 32-bit integer vector to 32-bit
+          floating-point.
+   @param[in]  pSrc       points to the input vector, e.g. the accumulators of plp_mat_mult_i8
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  scale      scale of the quantization
+   @param[in]  zeroPoint  zero point of the quantization
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_dequantize_i32_f32_parallel(const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     float32_t scale,
+                                     int32_t zeroPoint,
+                                     uint32_t nPE,
+                                     float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+   @brief Parallel dequantization of a 32-bit integer vector to 32-bit floating-point kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_dequantize_instance_i32_f32 struct initialized by
+                     plp_dequantize_i32_f32_parallel
+   @return     none
+*/
+
+void plp_dequantize_i32_f32p_xpulpv2(void *args);
+
+#endif // __PLP_NN_H__
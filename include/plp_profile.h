@@ -0,0 +1,1738 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.h
+ * Description:  Profiling wrappers for the public functions, generated by gen_plp_profile.py
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Include this header after plp_math.h in the application, and build the application with
+ * PLP_PROFILE defined. Every call to a public function is then measured and accumulated into the
+ * table given to plp_profile_init. The library itself is built without PLP_PROFILE.
+ */
+
+#ifndef __PLP_PROFILE_H__
+#define __PLP_PROFILE_H__
+
+#include "plp_math.h"
+
+#if defined(PLP_PROFILE)
+
+#define PLP_PROFILE_VOID(fn, ...)                                                                  \
+    do {                                                                                           \
+        uint32_t plp_profile_id = plp_profile_start(#fn);                                          \
+        fn(__VA_ARGS__);                                                                           \
+        plp_profile_stop(plp_profile_id);                                                          \
+    } while (0)
+
+#define PLP_PROFILE_RET(fn, ...)                                                                   \
+    ({                                                                                             \
+        uint32_t plp_profile_id = plp_profile_start(#fn);                                          \
+        __typeof__(fn(__VA_ARGS__)) plp_profile_ret = fn(__VA_ARGS__);                             \
+        plp_profile_stop(plp_profile_id);                                                          \
+        plp_profile_ret;                                                                           \
+    })
+
+#define plp_fill_i32(...) PLP_PROFILE_VOID(plp_fill_i32, __VA_ARGS__)
+#define plp_i8_to_i16(...) PLP_PROFILE_VOID(plp_i8_to_i16, __VA_ARGS__)
+#define plp_i8_to_i16_parallel(...) PLP_PROFILE_VOID(plp_i8_to_i16_parallel, __VA_ARGS__)
+#define plp_i8_to_i32(...) PLP_PROFILE_VOID(plp_i8_to_i32, __VA_ARGS__)
+#define plp_i8_to_i32_parallel(...) PLP_PROFILE_VOID(plp_i8_to_i32_parallel, __VA_ARGS__)
+#define plp_i16_to_i8(...) PLP_PROFILE_VOID(plp_i16_to_i8, __VA_ARGS__)
+#define plp_i16_to_i8_parallel(...) PLP_PROFILE_VOID(plp_i16_to_i8_parallel, __VA_ARGS__)
+#define plp_i16_to_i32(...) PLP_PROFILE_VOID(plp_i16_to_i32, __VA_ARGS__)
+#define plp_i16_to_i32_parallel(...) PLP_PROFILE_VOID(plp_i16_to_i32_parallel, __VA_ARGS__)
+#define plp_i32_to_i8(...) PLP_PROFILE_VOID(plp_i32_to_i8, __VA_ARGS__)
+#define plp_i32_to_i8_parallel(...) PLP_PROFILE_VOID(plp_i32_to_i8_parallel, __VA_ARGS__)
+#define plp_i32_to_i16(...) PLP_PROFILE_VOID(plp_i32_to_i16, __VA_ARGS__)
+#define plp_i32_to_i16_parallel(...) PLP_PROFILE_VOID(plp_i32_to_i16_parallel, __VA_ARGS__)
+#define plp_q8_to_f32(...) PLP_PROFILE_VOID(plp_q8_to_f32, __VA_ARGS__)
+#define plp_q8_to_f32_parallel(...) PLP_PROFILE_VOID(plp_q8_to_f32_parallel, __VA_ARGS__)
+#define plp_q16_to_f32(...) PLP_PROFILE_VOID(plp_q16_to_f32, __VA_ARGS__)
+#define plp_q16_to_f32_parallel(...) PLP_PROFILE_VOID(plp_q16_to_f32_parallel, __VA_ARGS__)
+#define plp_q32_to_f32(...) PLP_PROFILE_VOID(plp_q32_to_f32, __VA_ARGS__)
+#define plp_q32_to_f32_parallel(...) PLP_PROFILE_VOID(plp_q32_to_f32_parallel, __VA_ARGS__)
+#define plp_f32_to_q8(...) PLP_PROFILE_VOID(plp_f32_to_q8, __VA_ARGS__)
+#define plp_f32_to_q8_parallel(...) PLP_PROFILE_VOID(plp_f32_to_q8_parallel, __VA_ARGS__)
+#define plp_f32_to_q16(...) PLP_PROFILE_VOID(plp_f32_to_q16, __VA_ARGS__)
+#define plp_f32_to_q16_parallel(...) PLP_PROFILE_VOID(plp_f32_to_q16_parallel, __VA_ARGS__)
+#define plp_f32_to_q32(...) PLP_PROFILE_VOID(plp_f32_to_q32, __VA_ARGS__)
+#define plp_f32_to_q32_parallel(...) PLP_PROFILE_VOID(plp_f32_to_q32_parallel, __VA_ARGS__)
+#define plp_f16_to_f32(...) PLP_PROFILE_VOID(plp_f16_to_f32, __VA_ARGS__)
+#define plp_f32_to_f16(...) PLP_PROFILE_VOID(plp_f32_to_f16, __VA_ARGS__)
+#define plp_bf16_to_f32(...) PLP_PROFILE_VOID(plp_bf16_to_f32, __VA_ARGS__)
+#define plp_f32_to_bf16(...) PLP_PROFILE_VOID(plp_f32_to_bf16, __VA_ARGS__)
+#define plp_copy_i32(...) PLP_PROFILE_VOID(plp_copy_i32, __VA_ARGS__)
+#define plp_copy_f32(...) PLP_PROFILE_VOID(plp_copy_f32, __VA_ARGS__)
+#define plp_copy_i8_dma_async(...) PLP_PROFILE_VOID(plp_copy_i8_dma_async, __VA_ARGS__)
+#define plp_copy_i8_dma(...) PLP_PROFILE_VOID(plp_copy_i8_dma, __VA_ARGS__)
+#define plp_copy_i8_dma_2d_async(...) PLP_PROFILE_VOID(plp_copy_i8_dma_2d_async, __VA_ARGS__)
+#define plp_fill_i8_dma(...) PLP_PROFILE_VOID(plp_fill_i8_dma, __VA_ARGS__)
+#define plp_copy_i16_dma_async(...) PLP_PROFILE_VOID(plp_copy_i16_dma_async, __VA_ARGS__)
+#define plp_copy_i16_dma(...) PLP_PROFILE_VOID(plp_copy_i16_dma, __VA_ARGS__)
+#define plp_copy_i16_dma_2d_async(...) PLP_PROFILE_VOID(plp_copy_i16_dma_2d_async, __VA_ARGS__)
+#define plp_fill_i16_dma(...) PLP_PROFILE_VOID(plp_fill_i16_dma, __VA_ARGS__)
+#define plp_copy_i32_dma_async(...) PLP_PROFILE_VOID(plp_copy_i32_dma_async, __VA_ARGS__)
+#define plp_copy_i32_dma(...) PLP_PROFILE_VOID(plp_copy_i32_dma, __VA_ARGS__)
+#define plp_copy_i32_dma_2d_async(...) PLP_PROFILE_VOID(plp_copy_i32_dma_2d_async, __VA_ARGS__)
+#define plp_fill_i32_dma(...) PLP_PROFILE_VOID(plp_fill_i32_dma, __VA_ARGS__)
+#define plp_copy_f32_dma_async(...) PLP_PROFILE_VOID(plp_copy_f32_dma_async, __VA_ARGS__)
+#define plp_copy_f32_dma(...) PLP_PROFILE_VOID(plp_copy_f32_dma, __VA_ARGS__)
+#define plp_copy_f32_dma_2d_async(...) PLP_PROFILE_VOID(plp_copy_f32_dma_2d_async, __VA_ARGS__)
+#define plp_fill_f32_dma(...) PLP_PROFILE_VOID(plp_fill_f32_dma, __VA_ARGS__)
+#define plp_deinterleave_i32(...) PLP_PROFILE_VOID(plp_deinterleave_i32, __VA_ARGS__)
+#define plp_deinterleave_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_deinterleave_i32_parallel, __VA_ARGS__)
+#define plp_deinterleave_i16(...) PLP_PROFILE_VOID(plp_deinterleave_i16, __VA_ARGS__)
+#define plp_deinterleave_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_deinterleave_i16_parallel, __VA_ARGS__)
+#define plp_deinterleave_f32(...) PLP_PROFILE_VOID(plp_deinterleave_f32, __VA_ARGS__)
+#define plp_deinterleave_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_deinterleave_f32_parallel, __VA_ARGS__)
+#define plp_interleave_i32(...) PLP_PROFILE_VOID(plp_interleave_i32, __VA_ARGS__)
+#define plp_interleave_i32_parallel(...) PLP_PROFILE_VOID(plp_interleave_i32_parallel, __VA_ARGS__)
+#define plp_interleave_i16(...) PLP_PROFILE_VOID(plp_interleave_i16, __VA_ARGS__)
+#define plp_interleave_i16_parallel(...) PLP_PROFILE_VOID(plp_interleave_i16_parallel, __VA_ARGS__)
+#define plp_interleave_f32(...) PLP_PROFILE_VOID(plp_interleave_f32, __VA_ARGS__)
+#define plp_interleave_f32_parallel(...) PLP_PROFILE_VOID(plp_interleave_f32_parallel, __VA_ARGS__)
+#define plp_sort_i32(...) PLP_PROFILE_VOID(plp_sort_i32, __VA_ARGS__)
+#define plp_sort_i32_parallel(...) PLP_PROFILE_VOID(plp_sort_i32_parallel, __VA_ARGS__)
+#define plp_sort_i16(...) PLP_PROFILE_VOID(plp_sort_i16, __VA_ARGS__)
+#define plp_sort_i16_parallel(...) PLP_PROFILE_VOID(plp_sort_i16_parallel, __VA_ARGS__)
+#define plp_sort_f32(...) PLP_PROFILE_VOID(plp_sort_f32, __VA_ARGS__)
+#define plp_sort_f32_parallel(...) PLP_PROFILE_VOID(plp_sort_f32_parallel, __VA_ARGS__)
+#define plp_topk_i32(...) PLP_PROFILE_VOID(plp_topk_i32, __VA_ARGS__)
+#define plp_topk_i16(...) PLP_PROFILE_VOID(plp_topk_i16, __VA_ARGS__)
+#define plp_topk_f32(...) PLP_PROFILE_VOID(plp_topk_f32, __VA_ARGS__)
+#define plp_ringbuf_init_i32(...) PLP_PROFILE_VOID(plp_ringbuf_init_i32, __VA_ARGS__)
+#define plp_ringbuf_view_i32(...) PLP_PROFILE_RET(plp_ringbuf_view_i32, __VA_ARGS__)
+#define plp_ringbuf_write_i32(...) PLP_PROFILE_VOID(plp_ringbuf_write_i32, __VA_ARGS__)
+#define plp_ringbuf_read_i32(...) PLP_PROFILE_VOID(plp_ringbuf_read_i32, __VA_ARGS__)
+#define plp_ringbuf_init_i16(...) PLP_PROFILE_VOID(plp_ringbuf_init_i16, __VA_ARGS__)
+#define plp_ringbuf_view_i16(...) PLP_PROFILE_RET(plp_ringbuf_view_i16, __VA_ARGS__)
+#define plp_ringbuf_write_i16(...) PLP_PROFILE_VOID(plp_ringbuf_write_i16, __VA_ARGS__)
+#define plp_ringbuf_read_i16(...) PLP_PROFILE_VOID(plp_ringbuf_read_i16, __VA_ARGS__)
+#define plp_ringbuf_init_f32(...) PLP_PROFILE_VOID(plp_ringbuf_init_f32, __VA_ARGS__)
+#define plp_ringbuf_view_f32(...) PLP_PROFILE_RET(plp_ringbuf_view_f32, __VA_ARGS__)
+#define plp_ringbuf_write_f32(...) PLP_PROFILE_VOID(plp_ringbuf_write_f32, __VA_ARGS__)
+#define plp_ringbuf_read_f32(...) PLP_PROFILE_VOID(plp_ringbuf_read_f32, __VA_ARGS__)
+#define plp_udma_stream_init(...) PLP_PROFILE_VOID(plp_udma_stream_init, __VA_ARGS__)
+#define plp_udma_stream_dst(...) PLP_PROFILE_RET(plp_udma_stream_dst, __VA_ARGS__)
+#define plp_udma_stream_take(...) PLP_PROFILE_RET(plp_udma_stream_take, __VA_ARGS__)
+#define plp_udma_stream_view(...) PLP_PROFILE_RET(plp_udma_stream_view, __VA_ARGS__)
+#define plp_cmplx_split_i32(...) PLP_PROFILE_VOID(plp_cmplx_split_i32, __VA_ARGS__)
+#define plp_cmplx_split_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_split_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_split_i16(...) PLP_PROFILE_VOID(plp_cmplx_split_i16, __VA_ARGS__)
+#define plp_cmplx_split_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_split_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_split_f32(...) PLP_PROFILE_VOID(plp_cmplx_split_f32, __VA_ARGS__)
+#define plp_cmplx_split_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_split_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_merge_i32(...) PLP_PROFILE_VOID(plp_cmplx_merge_i32, __VA_ARGS__)
+#define plp_cmplx_merge_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_merge_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_merge_i16(...) PLP_PROFILE_VOID(plp_cmplx_merge_i16, __VA_ARGS__)
+#define plp_cmplx_merge_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_merge_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_merge_f32(...) PLP_PROFILE_VOID(plp_cmplx_merge_f32, __VA_ARGS__)
+#define plp_cmplx_merge_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_merge_f32_parallel, __VA_ARGS__)
+#define plp_team_begin(...) PLP_PROFILE_VOID(plp_team_begin, __VA_ARGS__)
+#define plp_team_add(...) PLP_PROFILE_VOID(plp_team_add, __VA_ARGS__)
+#define plp_team_end(...) PLP_PROFILE_VOID(plp_team_end, __VA_ARGS__)
+#define plp_subteams_run(...) PLP_PROFILE_VOID(plp_subteams_run, __VA_ARGS__)
+#define plp_pipeline_run(...) PLP_PROFILE_VOID(plp_pipeline_run, __VA_ARGS__)
+#define plp_stream_apply_unary(...) PLP_PROFILE_VOID(plp_stream_apply_unary, __VA_ARGS__)
+#define plp_stream_apply_binary(...) PLP_PROFILE_VOID(plp_stream_apply_binary, __VA_ARGS__)
+#define plp_async_call(...) PLP_PROFILE_VOID(plp_async_call, __VA_ARGS__)
+#define plp_async_call_cluster(...) PLP_PROFILE_VOID(plp_async_call_cluster, __VA_ARGS__)
+#define plp_async_wait(...) PLP_PROFILE_VOID(plp_async_wait, __VA_ARGS__)
+#define plp_hetero_share(...) PLP_PROFILE_RET(plp_hetero_share, __VA_ARGS__)
+#define plp_hetero_split(...) PLP_PROFILE_RET(plp_hetero_split, __VA_ARGS__)
+#define plp_table_to_l1(...) PLP_PROFILE_RET(plp_table_to_l1, __VA_ARGS__)
+#define plp_table_free_l1(...) PLP_PROFILE_VOID(plp_table_free_l1, __VA_ARGS__)
+#define plp_dot_prod_i32_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_i32_parallel, __VA_ARGS__)
+#define plp_dot_prod_q32_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_q32_parallel, __VA_ARGS__)
+#define plp_dot_prod_f32_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_f32_parallel, __VA_ARGS__)
+#define plp_dot_prod_i16_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_i16_parallel, __VA_ARGS__)
+#define plp_dot_prod_q16_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_q16_parallel, __VA_ARGS__)
+#define plp_dot_prod_i8_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_i8_parallel, __VA_ARGS__)
+#define plp_dot_prod_q8_parallel(...) PLP_PROFILE_VOID(plp_dot_prod_q8_parallel, __VA_ARGS__)
+#define plp_dot_prod_i32(...) PLP_PROFILE_VOID(plp_dot_prod_i32, __VA_ARGS__)
+#define plp_dot_prod_q32(...) PLP_PROFILE_VOID(plp_dot_prod_q32, __VA_ARGS__)
+#define plp_dot_prod_f32(...) PLP_PROFILE_VOID(plp_dot_prod_f32, __VA_ARGS__)
+#define plp_dot_prod_i16(...) PLP_PROFILE_VOID(plp_dot_prod_i16, __VA_ARGS__)
+#define plp_dot_prod_q16(...) PLP_PROFILE_VOID(plp_dot_prod_q16, __VA_ARGS__)
+#define plp_dot_prod_i8(...) PLP_PROFILE_VOID(plp_dot_prod_i8, __VA_ARGS__)
+#define plp_dot_prod_i8xi16(...) PLP_PROFILE_VOID(plp_dot_prod_i8xi16, __VA_ARGS__)
+#define plp_dot_prod_i4(...) PLP_PROFILE_VOID(plp_dot_prod_i4, __VA_ARGS__)
+#define plp_dot_prod_i2(...) PLP_PROFILE_VOID(plp_dot_prod_i2, __VA_ARGS__)
+#define plp_dot_prod_bin(...) PLP_PROFILE_VOID(plp_dot_prod_bin, __VA_ARGS__)
+#define plp_dot_prod_ter(...) PLP_PROFILE_VOID(plp_dot_prod_ter, __VA_ARGS__)
+#define plp_dot_prod_q8(...) PLP_PROFILE_VOID(plp_dot_prod_q8, __VA_ARGS__)
+#define plp_abs_i32(...) PLP_PROFILE_VOID(plp_abs_i32, __VA_ARGS__)
+#define plp_abs_i16(...) PLP_PROFILE_VOID(plp_abs_i16, __VA_ARGS__)
+#define plp_abs_i8(...) PLP_PROFILE_VOID(plp_abs_i8, __VA_ARGS__)
+#define plp_add_i32(...) PLP_PROFILE_VOID(plp_add_i32, __VA_ARGS__)
+#define plp_add_i16(...) PLP_PROFILE_VOID(plp_add_i16, __VA_ARGS__)
+#define plp_add_i8(...) PLP_PROFILE_VOID(plp_add_i8, __VA_ARGS__)
+#define plp_mult_i32(...) PLP_PROFILE_VOID(plp_mult_i32, __VA_ARGS__)
+#define plp_mult_i16(...) PLP_PROFILE_VOID(plp_mult_i16, __VA_ARGS__)
+#define plp_mult_i8(...) PLP_PROFILE_VOID(plp_mult_i8, __VA_ARGS__)
+#define plp_abs_i8_parallel(...) PLP_PROFILE_VOID(plp_abs_i8_parallel, __VA_ARGS__)
+#define plp_abs_i16_parallel(...) PLP_PROFILE_VOID(plp_abs_i16_parallel, __VA_ARGS__)
+#define plp_abs_i32_parallel(...) PLP_PROFILE_VOID(plp_abs_i32_parallel, __VA_ARGS__)
+#define plp_abs_f32(...) PLP_PROFILE_VOID(plp_abs_f32, __VA_ARGS__)
+#define plp_abs_f32_parallel(...) PLP_PROFILE_VOID(plp_abs_f32_parallel, __VA_ARGS__)
+#define plp_add_i8_parallel(...) PLP_PROFILE_VOID(plp_add_i8_parallel, __VA_ARGS__)
+#define plp_add_i16_parallel(...) PLP_PROFILE_VOID(plp_add_i16_parallel, __VA_ARGS__)
+#define plp_add_i32_parallel(...) PLP_PROFILE_VOID(plp_add_i32_parallel, __VA_ARGS__)
+#define plp_add_i8_hetero(...) PLP_PROFILE_VOID(plp_add_i8_hetero, __VA_ARGS__)
+#define plp_add_i16_hetero(...) PLP_PROFILE_VOID(plp_add_i16_hetero, __VA_ARGS__)
+#define plp_add_i32_hetero(...) PLP_PROFILE_VOID(plp_add_i32_hetero, __VA_ARGS__)
+#define plp_add_f32(...) PLP_PROFILE_VOID(plp_add_f32, __VA_ARGS__)
+#define plp_add_f32_parallel(...) PLP_PROFILE_VOID(plp_add_f32_parallel, __VA_ARGS__)
+#define plp_mult_i8_parallel(...) PLP_PROFILE_VOID(plp_mult_i8_parallel, __VA_ARGS__)
+#define plp_mult_i16_parallel(...) PLP_PROFILE_VOID(plp_mult_i16_parallel, __VA_ARGS__)
+#define plp_mult_i32_parallel(...) PLP_PROFILE_VOID(plp_mult_i32_parallel, __VA_ARGS__)
+#define plp_mult_f32(...) PLP_PROFILE_VOID(plp_mult_f32, __VA_ARGS__)
+#define plp_mult_f32_parallel(...) PLP_PROFILE_VOID(plp_mult_f32_parallel, __VA_ARGS__)
+#define plp_sub_i8(...) PLP_PROFILE_VOID(plp_sub_i8, __VA_ARGS__)
+#define plp_sub_i8_parallel(...) PLP_PROFILE_VOID(plp_sub_i8_parallel, __VA_ARGS__)
+#define plp_sub_i16(...) PLP_PROFILE_VOID(plp_sub_i16, __VA_ARGS__)
+#define plp_sub_i16_parallel(...) PLP_PROFILE_VOID(plp_sub_i16_parallel, __VA_ARGS__)
+#define plp_sub_i32(...) PLP_PROFILE_VOID(plp_sub_i32, __VA_ARGS__)
+#define plp_sub_i32_parallel(...) PLP_PROFILE_VOID(plp_sub_i32_parallel, __VA_ARGS__)
+#define plp_sub_f32(...) PLP_PROFILE_VOID(plp_sub_f32, __VA_ARGS__)
+#define plp_sub_f32_parallel(...) PLP_PROFILE_VOID(plp_sub_f32_parallel, __VA_ARGS__)
+#define plp_scale_i8(...) PLP_PROFILE_VOID(plp_scale_i8, __VA_ARGS__)
+#define plp_scale_i8_parallel(...) PLP_PROFILE_VOID(plp_scale_i8_parallel, __VA_ARGS__)
+#define plp_scale_i16(...) PLP_PROFILE_VOID(plp_scale_i16, __VA_ARGS__)
+#define plp_scale_i16_parallel(...) PLP_PROFILE_VOID(plp_scale_i16_parallel, __VA_ARGS__)
+#define plp_scale_i32(...) PLP_PROFILE_VOID(plp_scale_i32, __VA_ARGS__)
+#define plp_scale_i32_parallel(...) PLP_PROFILE_VOID(plp_scale_i32_parallel, __VA_ARGS__)
+#define plp_scale_f32(...) PLP_PROFILE_VOID(plp_scale_f32, __VA_ARGS__)
+#define plp_scale_f32_parallel(...) PLP_PROFILE_VOID(plp_scale_f32_parallel, __VA_ARGS__)
+#define plp_scale_q8(...) PLP_PROFILE_VOID(plp_scale_q8, __VA_ARGS__)
+#define plp_scale_q8_parallel(...) PLP_PROFILE_VOID(plp_scale_q8_parallel, __VA_ARGS__)
+#define plp_scale_q16(...) PLP_PROFILE_VOID(plp_scale_q16, __VA_ARGS__)
+#define plp_scale_q16_parallel(...) PLP_PROFILE_VOID(plp_scale_q16_parallel, __VA_ARGS__)
+#define plp_scale_q32(...) PLP_PROFILE_VOID(plp_scale_q32, __VA_ARGS__)
+#define plp_scale_q32_parallel(...) PLP_PROFILE_VOID(plp_scale_q32_parallel, __VA_ARGS__)
+#define plp_negate_i8(...) PLP_PROFILE_VOID(plp_negate_i8, __VA_ARGS__)
+#define plp_negate_i8_parallel(...) PLP_PROFILE_VOID(plp_negate_i8_parallel, __VA_ARGS__)
+#define plp_negate_i16(...) PLP_PROFILE_VOID(plp_negate_i16, __VA_ARGS__)
+#define plp_negate_i16_parallel(...) PLP_PROFILE_VOID(plp_negate_i16_parallel, __VA_ARGS__)
+#define plp_negate_i32(...) PLP_PROFILE_VOID(plp_negate_i32, __VA_ARGS__)
+#define plp_negate_i32_parallel(...) PLP_PROFILE_VOID(plp_negate_i32_parallel, __VA_ARGS__)
+#define plp_negate_f32(...) PLP_PROFILE_VOID(plp_negate_f32, __VA_ARGS__)
+#define plp_negate_f32_parallel(...) PLP_PROFILE_VOID(plp_negate_f32_parallel, __VA_ARGS__)
+#define plp_offset_i8(...) PLP_PROFILE_VOID(plp_offset_i8, __VA_ARGS__)
+#define plp_offset_i8_parallel(...) PLP_PROFILE_VOID(plp_offset_i8_parallel, __VA_ARGS__)
+#define plp_offset_i16(...) PLP_PROFILE_VOID(plp_offset_i16, __VA_ARGS__)
+#define plp_offset_i16_parallel(...) PLP_PROFILE_VOID(plp_offset_i16_parallel, __VA_ARGS__)
+#define plp_offset_i32(...) PLP_PROFILE_VOID(plp_offset_i32, __VA_ARGS__)
+#define plp_offset_i32_parallel(...) PLP_PROFILE_VOID(plp_offset_i32_parallel, __VA_ARGS__)
+#define plp_offset_f32(...) PLP_PROFILE_VOID(plp_offset_f32, __VA_ARGS__)
+#define plp_offset_f32_parallel(...) PLP_PROFILE_VOID(plp_offset_f32_parallel, __VA_ARGS__)
+#define plp_cumsum_i16(...) PLP_PROFILE_VOID(plp_cumsum_i16, __VA_ARGS__)
+#define plp_cumsum_i16_parallel(...) PLP_PROFILE_VOID(plp_cumsum_i16_parallel, __VA_ARGS__)
+#define plp_cumsum_i32(...) PLP_PROFILE_VOID(plp_cumsum_i32, __VA_ARGS__)
+#define plp_cumsum_i32_parallel(...) PLP_PROFILE_VOID(plp_cumsum_i32_parallel, __VA_ARGS__)
+#define plp_cumsum_f32(...) PLP_PROFILE_VOID(plp_cumsum_f32, __VA_ARGS__)
+#define plp_cumsum_f32_parallel(...) PLP_PROFILE_VOID(plp_cumsum_f32_parallel, __VA_ARGS__)
+#define plp_integral_image_i16(...) PLP_PROFILE_VOID(plp_integral_image_i16, __VA_ARGS__)
+#define plp_integral_image_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_integral_image_i16_parallel, __VA_ARGS__)
+#define plp_integral_image_i32(...) PLP_PROFILE_VOID(plp_integral_image_i32, __VA_ARGS__)
+#define plp_integral_image_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_integral_image_i32_parallel, __VA_ARGS__)
+#define plp_integral_image_f32(...) PLP_PROFILE_VOID(plp_integral_image_f32, __VA_ARGS__)
+#define plp_integral_image_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_integral_image_f32_parallel, __VA_ARGS__)
+#define plp_shift_i8(...) PLP_PROFILE_VOID(plp_shift_i8, __VA_ARGS__)
+#define plp_shift_i8_parallel(...) PLP_PROFILE_VOID(plp_shift_i8_parallel, __VA_ARGS__)
+#define plp_shift_i16(...) PLP_PROFILE_VOID(plp_shift_i16, __VA_ARGS__)
+#define plp_shift_i16_parallel(...) PLP_PROFILE_VOID(plp_shift_i16_parallel, __VA_ARGS__)
+#define plp_shift_i32(...) PLP_PROFILE_VOID(plp_shift_i32, __VA_ARGS__)
+#define plp_shift_i32_parallel(...) PLP_PROFILE_VOID(plp_shift_i32_parallel, __VA_ARGS__)
+#define plp_clip_i8(...) PLP_PROFILE_VOID(plp_clip_i8, __VA_ARGS__)
+#define plp_clip_i8_parallel(...) PLP_PROFILE_VOID(plp_clip_i8_parallel, __VA_ARGS__)
+#define plp_clip_i16(...) PLP_PROFILE_VOID(plp_clip_i16, __VA_ARGS__)
+#define plp_clip_i16_parallel(...) PLP_PROFILE_VOID(plp_clip_i16_parallel, __VA_ARGS__)
+#define plp_clip_i32(...) PLP_PROFILE_VOID(plp_clip_i32, __VA_ARGS__)
+#define plp_clip_i32_parallel(...) PLP_PROFILE_VOID(plp_clip_i32_parallel, __VA_ARGS__)
+#define plp_clip_f32(...) PLP_PROFILE_VOID(plp_clip_f32, __VA_ARGS__)
+#define plp_clip_f32_parallel(...) PLP_PROFILE_VOID(plp_clip_f32_parallel, __VA_ARGS__)
+#define plp_add_q8(...) PLP_PROFILE_VOID(plp_add_q8, __VA_ARGS__)
+#define plp_add_q8_parallel(...) PLP_PROFILE_VOID(plp_add_q8_parallel, __VA_ARGS__)
+#define plp_add_q16(...) PLP_PROFILE_VOID(plp_add_q16, __VA_ARGS__)
+#define plp_add_q16_parallel(...) PLP_PROFILE_VOID(plp_add_q16_parallel, __VA_ARGS__)
+#define plp_add_q32(...) PLP_PROFILE_VOID(plp_add_q32, __VA_ARGS__)
+#define plp_add_q32_parallel(...) PLP_PROFILE_VOID(plp_add_q32_parallel, __VA_ARGS__)
+#define plp_sub_q8(...) PLP_PROFILE_VOID(plp_sub_q8, __VA_ARGS__)
+#define plp_sub_q8_parallel(...) PLP_PROFILE_VOID(plp_sub_q8_parallel, __VA_ARGS__)
+#define plp_sub_q16(...) PLP_PROFILE_VOID(plp_sub_q16, __VA_ARGS__)
+#define plp_sub_q16_parallel(...) PLP_PROFILE_VOID(plp_sub_q16_parallel, __VA_ARGS__)
+#define plp_sub_q32(...) PLP_PROFILE_VOID(plp_sub_q32, __VA_ARGS__)
+#define plp_sub_q32_parallel(...) PLP_PROFILE_VOID(plp_sub_q32_parallel, __VA_ARGS__)
+#define plp_mult_q8(...) PLP_PROFILE_VOID(plp_mult_q8, __VA_ARGS__)
+#define plp_mult_q8_parallel(...) PLP_PROFILE_VOID(plp_mult_q8_parallel, __VA_ARGS__)
+#define plp_mult_q16(...) PLP_PROFILE_VOID(plp_mult_q16, __VA_ARGS__)
+#define plp_mult_q16_parallel(...) PLP_PROFILE_VOID(plp_mult_q16_parallel, __VA_ARGS__)
+#define plp_mult_q32(...) PLP_PROFILE_VOID(plp_mult_q32, __VA_ARGS__)
+#define plp_mult_q32_parallel(...) PLP_PROFILE_VOID(plp_mult_q32_parallel, __VA_ARGS__)
+#define plp_dot_prod_stride_i8(...) PLP_PROFILE_VOID(plp_dot_prod_stride_i8, __VA_ARGS__)
+#define plp_dot_prod_stride_i16(...) PLP_PROFILE_VOID(plp_dot_prod_stride_i16, __VA_ARGS__)
+#define plp_dot_prod_stride_i32(...) PLP_PROFILE_VOID(plp_dot_prod_stride_i32, __VA_ARGS__)
+#define plp_dot_prod_stride_f32(...) PLP_PROFILE_VOID(plp_dot_prod_stride_f32, __VA_ARGS__)
+#define plp_add_stride_i8(...) PLP_PROFILE_VOID(plp_add_stride_i8, __VA_ARGS__)
+#define plp_add_stride_i16(...) PLP_PROFILE_VOID(plp_add_stride_i16, __VA_ARGS__)
+#define plp_add_stride_i32(...) PLP_PROFILE_VOID(plp_add_stride_i32, __VA_ARGS__)
+#define plp_add_stride_f32(...) PLP_PROFILE_VOID(plp_add_stride_f32, __VA_ARGS__)
+#define plp_mult_stride_i8(...) PLP_PROFILE_VOID(plp_mult_stride_i8, __VA_ARGS__)
+#define plp_mult_stride_i16(...) PLP_PROFILE_VOID(plp_mult_stride_i16, __VA_ARGS__)
+#define plp_mult_stride_i32(...) PLP_PROFILE_VOID(plp_mult_stride_i32, __VA_ARGS__)
+#define plp_mult_stride_f32(...) PLP_PROFILE_VOID(plp_mult_stride_f32, __VA_ARGS__)
+#define plp_sqrt_q32(...) PLP_PROFILE_VOID(plp_sqrt_q32, __VA_ARGS__)
+#define plp_sqrt_q16(...) PLP_PROFILE_VOID(plp_sqrt_q16, __VA_ARGS__)
+#define plp_sqrt_f32(...) PLP_PROFILE_VOID(plp_sqrt_f32, __VA_ARGS__)
+#define plp_sqrt_f32_vec(...) PLP_PROFILE_VOID(plp_sqrt_f32_vec, __VA_ARGS__)
+#define plp_rsqrt_f32(...) PLP_PROFILE_VOID(plp_rsqrt_f32, __VA_ARGS__)
+#define plp_rsqrt_q16(...) PLP_PROFILE_VOID(plp_rsqrt_q16, __VA_ARGS__)
+#define plp_cos_q32(...) PLP_PROFILE_RET(plp_cos_q32, __VA_ARGS__)
+#define plp_cos_q16(...) PLP_PROFILE_RET(plp_cos_q16, __VA_ARGS__)
+#define plp_cos_f32(...) PLP_PROFILE_RET(plp_cos_f32, __VA_ARGS__)
+#define plp_sin_q32(...) PLP_PROFILE_RET(plp_sin_q32, __VA_ARGS__)
+#define plp_sin_q16(...) PLP_PROFILE_RET(plp_sin_q16, __VA_ARGS__)
+#define plp_sin_q32_fast(...) PLP_PROFILE_RET(plp_sin_q32_fast, __VA_ARGS__)
+#define plp_cos_q32_fast(...) PLP_PROFILE_RET(plp_cos_q32_fast, __VA_ARGS__)
+#define plp_sin_q32_precise(...) PLP_PROFILE_RET(plp_sin_q32_precise, __VA_ARGS__)
+#define plp_cos_q32_precise(...) PLP_PROFILE_RET(plp_cos_q32_precise, __VA_ARGS__)
+#define plp_sin_q16_fast(...) PLP_PROFILE_RET(plp_sin_q16_fast, __VA_ARGS__)
+#define plp_cos_q16_fast(...) PLP_PROFILE_RET(plp_cos_q16_fast, __VA_ARGS__)
+#define plp_sin_q16_precise(...) PLP_PROFILE_RET(plp_sin_q16_precise, __VA_ARGS__)
+#define plp_cos_q16_precise(...) PLP_PROFILE_RET(plp_cos_q16_precise, __VA_ARGS__)
+#define plp_sin_f32(...) PLP_PROFILE_RET(plp_sin_f32, __VA_ARGS__)
+#define plp_sin_q16_vec(...) PLP_PROFILE_VOID(plp_sin_q16_vec, __VA_ARGS__)
+#define plp_sin_q16_vec_parallel(...) PLP_PROFILE_VOID(plp_sin_q16_vec_parallel, __VA_ARGS__)
+#define plp_cos_q16_vec(...) PLP_PROFILE_VOID(plp_cos_q16_vec, __VA_ARGS__)
+#define plp_cos_q16_vec_parallel(...) PLP_PROFILE_VOID(plp_cos_q16_vec_parallel, __VA_ARGS__)
+#define plp_sincos_q16(...) PLP_PROFILE_VOID(plp_sincos_q16, __VA_ARGS__)
+#define plp_sincos_q16_parallel(...) PLP_PROFILE_VOID(plp_sincos_q16_parallel, __VA_ARGS__)
+#define plp_sin_q32_vec(...) PLP_PROFILE_VOID(plp_sin_q32_vec, __VA_ARGS__)
+#define plp_sin_q32_vec_parallel(...) PLP_PROFILE_VOID(plp_sin_q32_vec_parallel, __VA_ARGS__)
+#define plp_cos_q32_vec(...) PLP_PROFILE_VOID(plp_cos_q32_vec, __VA_ARGS__)
+#define plp_cos_q32_vec_parallel(...) PLP_PROFILE_VOID(plp_cos_q32_vec_parallel, __VA_ARGS__)
+#define plp_sincos_q32(...) PLP_PROFILE_VOID(plp_sincos_q32, __VA_ARGS__)
+#define plp_sincos_q32_parallel(...) PLP_PROFILE_VOID(plp_sincos_q32_parallel, __VA_ARGS__)
+#define plp_sin_f32_vec(...) PLP_PROFILE_VOID(plp_sin_f32_vec, __VA_ARGS__)
+#define plp_sin_f32_vec_parallel(...) PLP_PROFILE_VOID(plp_sin_f32_vec_parallel, __VA_ARGS__)
+#define plp_cos_f32_vec(...) PLP_PROFILE_VOID(plp_cos_f32_vec, __VA_ARGS__)
+#define plp_cos_f32_vec_parallel(...) PLP_PROFILE_VOID(plp_cos_f32_vec_parallel, __VA_ARGS__)
+#define plp_sincos_f32(...) PLP_PROFILE_VOID(plp_sincos_f32, __VA_ARGS__)
+#define plp_sincos_f32_parallel(...) PLP_PROFILE_VOID(plp_sincos_f32_parallel, __VA_ARGS__)
+#define plp_exp_q16(...) PLP_PROFILE_RET(plp_exp_q16, __VA_ARGS__)
+#define plp_exp_q16_vec(...) PLP_PROFILE_VOID(plp_exp_q16_vec, __VA_ARGS__)
+#define plp_exp_q32(...) PLP_PROFILE_RET(plp_exp_q32, __VA_ARGS__)
+#define plp_exp_q32_vec(...) PLP_PROFILE_VOID(plp_exp_q32_vec, __VA_ARGS__)
+#define plp_exp_f32(...) PLP_PROFILE_RET(plp_exp_f32, __VA_ARGS__)
+#define plp_exp_f32_vec(...) PLP_PROFILE_VOID(plp_exp_f32_vec, __VA_ARGS__)
+#define plp_log_q16(...) PLP_PROFILE_RET(plp_log_q16, __VA_ARGS__)
+#define plp_log_q16_vec(...) PLP_PROFILE_VOID(plp_log_q16_vec, __VA_ARGS__)
+#define plp_log_q32(...) PLP_PROFILE_RET(plp_log_q32, __VA_ARGS__)
+#define plp_log_q32_vec(...) PLP_PROFILE_VOID(plp_log_q32_vec, __VA_ARGS__)
+#define plp_log_f32(...) PLP_PROFILE_RET(plp_log_f32, __VA_ARGS__)
+#define plp_log_f32_vec(...) PLP_PROFILE_VOID(plp_log_f32_vec, __VA_ARGS__)
+#define plp_log2_q16_vec(...) PLP_PROFILE_VOID(plp_log2_q16_vec, __VA_ARGS__)
+#define plp_log2_q16_vec_parallel(...) PLP_PROFILE_VOID(plp_log2_q16_vec_parallel, __VA_ARGS__)
+#define plp_db_q16_vec(...) PLP_PROFILE_VOID(plp_db_q16_vec, __VA_ARGS__)
+#define plp_db_q16_vec_parallel(...) PLP_PROFILE_VOID(plp_db_q16_vec_parallel, __VA_ARGS__)
+#define plp_pow2_q16_vec(...) PLP_PROFILE_VOID(plp_pow2_q16_vec, __VA_ARGS__)
+#define plp_pow2_q16_vec_parallel(...) PLP_PROFILE_VOID(plp_pow2_q16_vec_parallel, __VA_ARGS__)
+#define plp_log2_f32_vec(...) PLP_PROFILE_VOID(plp_log2_f32_vec, __VA_ARGS__)
+#define plp_log2_f32_vec_parallel(...) PLP_PROFILE_VOID(plp_log2_f32_vec_parallel, __VA_ARGS__)
+#define plp_db_f32_vec(...) PLP_PROFILE_VOID(plp_db_f32_vec, __VA_ARGS__)
+#define plp_db_f32_vec_parallel(...) PLP_PROFILE_VOID(plp_db_f32_vec_parallel, __VA_ARGS__)
+#define plp_pow2_f32_vec(...) PLP_PROFILE_VOID(plp_pow2_f32_vec, __VA_ARGS__)
+#define plp_pow2_f32_vec_parallel(...) PLP_PROFILE_VOID(plp_pow2_f32_vec_parallel, __VA_ARGS__)
+#define plp_tanh_q16(...) PLP_PROFILE_RET(plp_tanh_q16, __VA_ARGS__)
+#define plp_tanh_q16_vec(...) PLP_PROFILE_VOID(plp_tanh_q16_vec, __VA_ARGS__)
+#define plp_tanh_q32(...) PLP_PROFILE_RET(plp_tanh_q32, __VA_ARGS__)
+#define plp_tanh_q32_vec(...) PLP_PROFILE_VOID(plp_tanh_q32_vec, __VA_ARGS__)
+#define plp_tanh_f32(...) PLP_PROFILE_RET(plp_tanh_f32, __VA_ARGS__)
+#define plp_tanh_f32_vec(...) PLP_PROFILE_VOID(plp_tanh_f32_vec, __VA_ARGS__)
+#define plp_sigmoid_q16(...) PLP_PROFILE_RET(plp_sigmoid_q16, __VA_ARGS__)
+#define plp_sigmoid_q16_vec(...) PLP_PROFILE_VOID(plp_sigmoid_q16_vec, __VA_ARGS__)
+#define plp_sigmoid_q32(...) PLP_PROFILE_RET(plp_sigmoid_q32, __VA_ARGS__)
+#define plp_sigmoid_q32_vec(...) PLP_PROFILE_VOID(plp_sigmoid_q32_vec, __VA_ARGS__)
+#define plp_sigmoid_f32(...) PLP_PROFILE_RET(plp_sigmoid_f32, __VA_ARGS__)
+#define plp_sigmoid_f32_vec(...) PLP_PROFILE_VOID(plp_sigmoid_f32_vec, __VA_ARGS__)
+#define plp_atan2_q16(...) PLP_PROFILE_RET(plp_atan2_q16, __VA_ARGS__)
+#define plp_atan2_q32(...) PLP_PROFILE_RET(plp_atan2_q32, __VA_ARGS__)
+#define plp_atan2_f32(...) PLP_PROFILE_RET(plp_atan2_f32, __VA_ARGS__)
+#define plp_lut_interp_init_q16(...) PLP_PROFILE_VOID(plp_lut_interp_init_q16, __VA_ARGS__)
+#define plp_lut_interp_q16(...) PLP_PROFILE_RET(plp_lut_interp_q16, __VA_ARGS__)
+#define plp_lut_interp_q16_vec(...) PLP_PROFILE_VOID(plp_lut_interp_q16_vec, __VA_ARGS__)
+#define plp_lut_interp_init_q32(...) PLP_PROFILE_VOID(plp_lut_interp_init_q32, __VA_ARGS__)
+#define plp_lut_interp_q32(...) PLP_PROFILE_RET(plp_lut_interp_q32, __VA_ARGS__)
+#define plp_lut_interp_q32_vec(...) PLP_PROFILE_VOID(plp_lut_interp_q32_vec, __VA_ARGS__)
+#define plp_lut_interp_init_f32(...) PLP_PROFILE_VOID(plp_lut_interp_init_f32, __VA_ARGS__)
+#define plp_lut_interp_f32(...) PLP_PROFILE_RET(plp_lut_interp_f32, __VA_ARGS__)
+#define plp_lut_interp_f32_vec(...) PLP_PROFILE_VOID(plp_lut_interp_f32_vec, __VA_ARGS__)
+#define plp_recip_q16(...) PLP_PROFILE_VOID(plp_recip_q16, __VA_ARGS__)
+#define plp_recip_q16_parallel(...) PLP_PROFILE_VOID(plp_recip_q16_parallel, __VA_ARGS__)
+#define plp_recip_q32(...) PLP_PROFILE_VOID(plp_recip_q32, __VA_ARGS__)
+#define plp_recip_q32_parallel(...) PLP_PROFILE_VOID(plp_recip_q32_parallel, __VA_ARGS__)
+#define plp_div_q16(...) PLP_PROFILE_VOID(plp_div_q16, __VA_ARGS__)
+#define plp_div_q16_parallel(...) PLP_PROFILE_VOID(plp_div_q16_parallel, __VA_ARGS__)
+#define plp_div_q32(...) PLP_PROFILE_VOID(plp_div_q32, __VA_ARGS__)
+#define plp_div_q32_parallel(...) PLP_PROFILE_VOID(plp_div_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_conj_f32(...) PLP_PROFILE_VOID(plp_cmplx_conj_f32, __VA_ARGS__)
+#define plp_cmplx_conj_i32(...) PLP_PROFILE_VOID(plp_cmplx_conj_i32, __VA_ARGS__)
+#define plp_cmplx_conj_i16(...) PLP_PROFILE_VOID(plp_cmplx_conj_i16, __VA_ARGS__)
+#define plp_cmplx_conj_i8(...) PLP_PROFILE_VOID(plp_cmplx_conj_i8, __VA_ARGS__)
+#define plp_cmplx_dot_prod_f32(...) PLP_PROFILE_VOID(plp_cmplx_dot_prod_f32, __VA_ARGS__)
+#define plp_cmplx_dot_prod_i32(...) PLP_PROFILE_VOID(plp_cmplx_dot_prod_i32, __VA_ARGS__)
+#define plp_cmplx_dot_prod_i16(...) PLP_PROFILE_VOID(plp_cmplx_dot_prod_i16, __VA_ARGS__)
+#define plp_cmplx_dot_prod_i8(...) PLP_PROFILE_VOID(plp_cmplx_dot_prod_i8, __VA_ARGS__)
+#define plp_cmplx_dot_prod_q32(...) PLP_PROFILE_VOID(plp_cmplx_dot_prod_q32, __VA_ARGS__)
+#define plp_cmplx_dot_prod_q16(...) PLP_PROFILE_VOID(plp_cmplx_dot_prod_q16, __VA_ARGS__)
+#define plp_cmplx_mult_real_f32(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_f32, __VA_ARGS__)
+#define plp_cmplx_mult_real_i32(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_i32, __VA_ARGS__)
+#define plp_cmplx_mult_real_i16(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_i16, __VA_ARGS__)
+#define plp_cmplx_mult_real_i8(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_i8, __VA_ARGS__)
+#define plp_cmplx_mult_real_q32(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_q32, __VA_ARGS__)
+#define plp_cmplx_mult_real_q16(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_q16, __VA_ARGS__)
+#define plp_cmplx_mult_real_q8(...) PLP_PROFILE_VOID(plp_cmplx_mult_real_q8, __VA_ARGS__)
+#define plp_cmplx_mag_squared_f32(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_f32, __VA_ARGS__)
+#define plp_cmplx_mag_squared_i16(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_i16, __VA_ARGS__)
+#define plp_cmplx_mag_squared_i32(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_i32, __VA_ARGS__)
+#define plp_cmplx_mag_squared_i8(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_i8, __VA_ARGS__)
+#define plp_cmplx_mag_squared_q32(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_q32, __VA_ARGS__)
+#define plp_cmplx_mag_squared_q16(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_q16, __VA_ARGS__)
+#define plp_cmplx_mag_squared_q8(...) PLP_PROFILE_VOID(plp_cmplx_mag_squared_q8, __VA_ARGS__)
+#define plp_cmplx_arg_q16(...) PLP_PROFILE_VOID(plp_cmplx_arg_q16, __VA_ARGS__)
+#define plp_cmplx_arg_q16_parallel(...) PLP_PROFILE_VOID(plp_cmplx_arg_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_arg_q32(...) PLP_PROFILE_VOID(plp_cmplx_arg_q32, __VA_ARGS__)
+#define plp_cmplx_arg_q32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_arg_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_arg_f32(...) PLP_PROFILE_VOID(plp_cmplx_arg_f32, __VA_ARGS__)
+#define plp_cmplx_arg_f32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_arg_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_f32(...) PLP_PROFILE_VOID(plp_cmplx_mag_f32, __VA_ARGS__)
+#define plp_cmplx_mag_i32(...) PLP_PROFILE_VOID(plp_cmplx_mag_i32, __VA_ARGS__)
+#define plp_cmplx_mag_i16(...) PLP_PROFILE_VOID(plp_cmplx_mag_i16, __VA_ARGS__)
+#define plp_cmplx_mag_q32(...) PLP_PROFILE_VOID(plp_cmplx_mag_q32, __VA_ARGS__)
+#define plp_cmplx_mag_q16(...) PLP_PROFILE_VOID(plp_cmplx_mag_q16, __VA_ARGS__)
+#define plp_cmplx_mag_approx_f32(...) PLP_PROFILE_VOID(plp_cmplx_mag_approx_f32, __VA_ARGS__)
+#define plp_cmplx_mag_approx_q32(...) PLP_PROFILE_VOID(plp_cmplx_mag_approx_q32, __VA_ARGS__)
+#define plp_cmplx_mag_approx_q16(...) PLP_PROFILE_VOID(plp_cmplx_mag_approx_q16, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_f32(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_f32, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_i32(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_i32, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_i16(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_i16, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_i8(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_i8, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_q32(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_q32, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_q16(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_q16, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_q8(...) PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_q8, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_i8_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_q8_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_i8_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_real_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_real_q8_parallel, __VA_ARGS__)
+#define plp_cmplx_conj_f32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_conj_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_conj_i32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_conj_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_conj_i16_parallel(...) PLP_PROFILE_VOID(plp_cmplx_conj_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_conj_i8_parallel(...) PLP_PROFILE_VOID(plp_cmplx_conj_i8_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_i8_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_squared_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_q8_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_f32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_mag_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_i32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_mag_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_i16_parallel(...) PLP_PROFILE_VOID(plp_cmplx_mag_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_q32_parallel(...) PLP_PROFILE_VOID(plp_cmplx_mag_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_q16_parallel(...) PLP_PROFILE_VOID(plp_cmplx_mag_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_approx_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_approx_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_approx_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_approx_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_mag_approx_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_approx_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_dot_prod_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_dot_prod_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_i32_parallel, __VA_ARGS__)
+#define plp_cmplx_dot_prod_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_i16_parallel, __VA_ARGS__)
+#define plp_cmplx_dot_prod_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_i8_parallel, __VA_ARGS__)
+#define plp_cmplx_dot_prod_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_dot_prod_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_mac_q16(...) PLP_PROFILE_VOID(plp_cmplx_mac_q16, __VA_ARGS__)
+#define plp_cmplx_mac_q32(...) PLP_PROFILE_VOID(plp_cmplx_mac_q32, __VA_ARGS__)
+#define plp_cmplx_mac_f32(...) PLP_PROFILE_VOID(plp_cmplx_mac_f32, __VA_ARGS__)
+#define plp_cmplx_mac_batched_q16(...) PLP_PROFILE_VOID(plp_cmplx_mac_batched_q16, __VA_ARGS__)
+#define plp_cmplx_mac_batched_q32(...) PLP_PROFILE_VOID(plp_cmplx_mac_batched_q32, __VA_ARGS__)
+#define plp_cmplx_mac_batched_f32(...) PLP_PROFILE_VOID(plp_cmplx_mac_batched_f32, __VA_ARGS__)
+#define plp_cmplx_mult_conj_q8(...) PLP_PROFILE_VOID(plp_cmplx_mult_conj_q8, __VA_ARGS__)
+#define plp_cmplx_mult_conj_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_conj_q8_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_conj_q16(...) PLP_PROFILE_VOID(plp_cmplx_mult_conj_q16, __VA_ARGS__)
+#define plp_cmplx_mult_conj_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_conj_q16_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_conj_q32(...) PLP_PROFILE_VOID(plp_cmplx_mult_conj_q32, __VA_ARGS__)
+#define plp_cmplx_mult_conj_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_conj_q32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_conj_f32(...) PLP_PROFILE_VOID(plp_cmplx_mult_conj_f32, __VA_ARGS__)
+#define plp_cmplx_mult_conj_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_conj_f32_parallel, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_planar_f32(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_planar_f32, __VA_ARGS__)
+#define plp_cmplx_mult_cmplx_planar_q16(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mult_cmplx_planar_q16, __VA_ARGS__)
+#define plp_cmplx_mag_squared_planar_f32(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_planar_f32, __VA_ARGS__)
+#define plp_cmplx_mag_squared_planar_q16(...) \
+    PLP_PROFILE_VOID(plp_cmplx_mag_squared_planar_q16, __VA_ARGS__)
+#define plp_cmplx_dot_prod_planar_f32(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_planar_f32, __VA_ARGS__)
+#define plp_cmplx_dot_prod_planar_q16(...) \
+    PLP_PROFILE_VOID(plp_cmplx_dot_prod_planar_q16, __VA_ARGS__)
+#define plp_mean_f32(...) PLP_PROFILE_VOID(plp_mean_f32, __VA_ARGS__)
+#define plp_mean_i32(...) PLP_PROFILE_VOID(plp_mean_i32, __VA_ARGS__)
+#define plp_mean_i16(...) PLP_PROFILE_VOID(plp_mean_i16, __VA_ARGS__)
+#define plp_mean_i8(...) PLP_PROFILE_VOID(plp_mean_i8, __VA_ARGS__)
+#define plp_max_f32(...) PLP_PROFILE_VOID(plp_max_f32, __VA_ARGS__)
+#define plp_max_i32(...) PLP_PROFILE_VOID(plp_max_i32, __VA_ARGS__)
+#define plp_max_i16(...) PLP_PROFILE_VOID(plp_max_i16, __VA_ARGS__)
+#define plp_max_i8(...) PLP_PROFILE_VOID(plp_max_i8, __VA_ARGS__)
+#define plp_min_f32(...) PLP_PROFILE_VOID(plp_min_f32, __VA_ARGS__)
+#define plp_min_i32(...) PLP_PROFILE_VOID(plp_min_i32, __VA_ARGS__)
+#define plp_min_i16(...) PLP_PROFILE_VOID(plp_min_i16, __VA_ARGS__)
+#define plp_min_i8(...) PLP_PROFILE_VOID(plp_min_i8, __VA_ARGS__)
+#define plp_power_f32(...) PLP_PROFILE_VOID(plp_power_f32, __VA_ARGS__)
+#define plp_power_i32(...) PLP_PROFILE_VOID(plp_power_i32, __VA_ARGS__)
+#define plp_power_i16(...) PLP_PROFILE_VOID(plp_power_i16, __VA_ARGS__)
+#define plp_power_i8(...) PLP_PROFILE_VOID(plp_power_i8, __VA_ARGS__)
+#define plp_power_q32(...) PLP_PROFILE_VOID(plp_power_q32, __VA_ARGS__)
+#define plp_power_q16(...) PLP_PROFILE_VOID(plp_power_q16, __VA_ARGS__)
+#define plp_power_q8(...) PLP_PROFILE_VOID(plp_power_q8, __VA_ARGS__)
+#define plp_var_f32(...) PLP_PROFILE_VOID(plp_var_f32, __VA_ARGS__)
+#define plp_var_q32(...) PLP_PROFILE_VOID(plp_var_q32, __VA_ARGS__)
+#define plp_power64_i32(...) PLP_PROFILE_VOID(plp_power64_i32, __VA_ARGS__)
+#define plp_power64_q32(...) PLP_PROFILE_VOID(plp_power64_q32, __VA_ARGS__)
+#define plp_var64_q32(...) PLP_PROFILE_VOID(plp_var64_q32, __VA_ARGS__)
+#define plp_var_q16(...) PLP_PROFILE_VOID(plp_var_q16, __VA_ARGS__)
+#define plp_var_q8(...) PLP_PROFILE_VOID(plp_var_q8, __VA_ARGS__)
+#define plp_std_f32(...) PLP_PROFILE_VOID(plp_std_f32, __VA_ARGS__)
+#define plp_std_q32(...) PLP_PROFILE_VOID(plp_std_q32, __VA_ARGS__)
+#define plp_std_q16(...) PLP_PROFILE_VOID(plp_std_q16, __VA_ARGS__)
+#define plp_std_q8(...) PLP_PROFILE_VOID(plp_std_q8, __VA_ARGS__)
+#define plp_rms_f32(...) PLP_PROFILE_VOID(plp_rms_f32, __VA_ARGS__)
+#define plp_rms_q32(...) PLP_PROFILE_VOID(plp_rms_q32, __VA_ARGS__)
+#define plp_rms_q16(...) PLP_PROFILE_VOID(plp_rms_q16, __VA_ARGS__)
+#define plp_rms_q8(...) PLP_PROFILE_VOID(plp_rms_q8, __VA_ARGS__)
+#define plp_stats_parallel_range(...) PLP_PROFILE_VOID(plp_stats_parallel_range, __VA_ARGS__)
+#define plp_stats_tree_reduce_i32(...) PLP_PROFILE_VOID(plp_stats_tree_reduce_i32, __VA_ARGS__)
+#define plp_stats_tree_reduce_f32(...) PLP_PROFILE_VOID(plp_stats_tree_reduce_f32, __VA_ARGS__)
+#define plp_stats_summary_combine_i32(...) \
+    PLP_PROFILE_VOID(plp_stats_summary_combine_i32, __VA_ARGS__)
+#define plp_stats_summary_combine_f32(...) \
+    PLP_PROFILE_VOID(plp_stats_summary_combine_f32, __VA_ARGS__)
+#define plp_mean_i32_parallel(...) PLP_PROFILE_VOID(plp_mean_i32_parallel, __VA_ARGS__)
+#define plp_mean_i16_parallel(...) PLP_PROFILE_VOID(plp_mean_i16_parallel, __VA_ARGS__)
+#define plp_mean_i8_parallel(...) PLP_PROFILE_VOID(plp_mean_i8_parallel, __VA_ARGS__)
+#define plp_mean_f32_parallel(...) PLP_PROFILE_VOID(plp_mean_f32_parallel, __VA_ARGS__)
+#define plp_power_i32_parallel(...) PLP_PROFILE_VOID(plp_power_i32_parallel, __VA_ARGS__)
+#define plp_power_i16_parallel(...) PLP_PROFILE_VOID(plp_power_i16_parallel, __VA_ARGS__)
+#define plp_power_i8_parallel(...) PLP_PROFILE_VOID(plp_power_i8_parallel, __VA_ARGS__)
+#define plp_power_i32_hetero(...) PLP_PROFILE_VOID(plp_power_i32_hetero, __VA_ARGS__)
+#define plp_power_i16_hetero(...) PLP_PROFILE_VOID(plp_power_i16_hetero, __VA_ARGS__)
+#define plp_power_i8_hetero(...) PLP_PROFILE_VOID(plp_power_i8_hetero, __VA_ARGS__)
+#define plp_power_f32_parallel(...) PLP_PROFILE_VOID(plp_power_f32_parallel, __VA_ARGS__)
+#define plp_power_q32_parallel(...) PLP_PROFILE_VOID(plp_power_q32_parallel, __VA_ARGS__)
+#define plp_power_q16_parallel(...) PLP_PROFILE_VOID(plp_power_q16_parallel, __VA_ARGS__)
+#define plp_power_q8_parallel(...) PLP_PROFILE_VOID(plp_power_q8_parallel, __VA_ARGS__)
+#define plp_min_i32_parallel(...) PLP_PROFILE_VOID(plp_min_i32_parallel, __VA_ARGS__)
+#define plp_min_i16_parallel(...) PLP_PROFILE_VOID(plp_min_i16_parallel, __VA_ARGS__)
+#define plp_min_i8_parallel(...) PLP_PROFILE_VOID(plp_min_i8_parallel, __VA_ARGS__)
+#define plp_min_f32_parallel(...) PLP_PROFILE_VOID(plp_min_f32_parallel, __VA_ARGS__)
+#define plp_max_i32_parallel(...) PLP_PROFILE_VOID(plp_max_i32_parallel, __VA_ARGS__)
+#define plp_max_i16_parallel(...) PLP_PROFILE_VOID(plp_max_i16_parallel, __VA_ARGS__)
+#define plp_max_i8_parallel(...) PLP_PROFILE_VOID(plp_max_i8_parallel, __VA_ARGS__)
+#define plp_max_f32_parallel(...) PLP_PROFILE_VOID(plp_max_f32_parallel, __VA_ARGS__)
+#define plp_var_q32_parallel(...) PLP_PROFILE_VOID(plp_var_q32_parallel, __VA_ARGS__)
+#define plp_var_q16_parallel(...) PLP_PROFILE_VOID(plp_var_q16_parallel, __VA_ARGS__)
+#define plp_var_q8_parallel(...) PLP_PROFILE_VOID(plp_var_q8_parallel, __VA_ARGS__)
+#define plp_var_f32_parallel(...) PLP_PROFILE_VOID(plp_var_f32_parallel, __VA_ARGS__)
+#define plp_std_q32_parallel(...) PLP_PROFILE_VOID(plp_std_q32_parallel, __VA_ARGS__)
+#define plp_std_q16_parallel(...) PLP_PROFILE_VOID(plp_std_q16_parallel, __VA_ARGS__)
+#define plp_std_q8_parallel(...) PLP_PROFILE_VOID(plp_std_q8_parallel, __VA_ARGS__)
+#define plp_std_f32_parallel(...) PLP_PROFILE_VOID(plp_std_f32_parallel, __VA_ARGS__)
+#define plp_rms_q32_parallel(...) PLP_PROFILE_VOID(plp_rms_q32_parallel, __VA_ARGS__)
+#define plp_rms_q16_parallel(...) PLP_PROFILE_VOID(plp_rms_q16_parallel, __VA_ARGS__)
+#define plp_rms_q8_parallel(...) PLP_PROFILE_VOID(plp_rms_q8_parallel, __VA_ARGS__)
+#define plp_rms_f32_parallel(...) PLP_PROFILE_VOID(plp_rms_f32_parallel, __VA_ARGS__)
+#define plp_stats_summary_i32(...) PLP_PROFILE_VOID(plp_stats_summary_i32, __VA_ARGS__)
+#define plp_stats_summary_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_stats_summary_i32_parallel, __VA_ARGS__)
+#define plp_stats_summary_i16(...) PLP_PROFILE_VOID(plp_stats_summary_i16, __VA_ARGS__)
+#define plp_stats_summary_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_stats_summary_i16_parallel, __VA_ARGS__)
+#define plp_stats_summary_i8(...) PLP_PROFILE_VOID(plp_stats_summary_i8, __VA_ARGS__)
+#define plp_stats_summary_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_stats_summary_i8_parallel, __VA_ARGS__)
+#define plp_stats_summary_f32(...) PLP_PROFILE_VOID(plp_stats_summary_f32, __VA_ARGS__)
+#define plp_stats_summary_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_stats_summary_f32_parallel, __VA_ARGS__)
+#define plp_max_idx_i32(...) PLP_PROFILE_VOID(plp_max_idx_i32, __VA_ARGS__)
+#define plp_max_idx_i32_parallel(...) PLP_PROFILE_VOID(plp_max_idx_i32_parallel, __VA_ARGS__)
+#define plp_max_idx_i16(...) PLP_PROFILE_VOID(plp_max_idx_i16, __VA_ARGS__)
+#define plp_max_idx_i16_parallel(...) PLP_PROFILE_VOID(plp_max_idx_i16_parallel, __VA_ARGS__)
+#define plp_max_idx_i8(...) PLP_PROFILE_VOID(plp_max_idx_i8, __VA_ARGS__)
+#define plp_max_idx_i8_parallel(...) PLP_PROFILE_VOID(plp_max_idx_i8_parallel, __VA_ARGS__)
+#define plp_max_idx_f32(...) PLP_PROFILE_VOID(plp_max_idx_f32, __VA_ARGS__)
+#define plp_max_idx_f32_parallel(...) PLP_PROFILE_VOID(plp_max_idx_f32_parallel, __VA_ARGS__)
+#define plp_argmax_i32(...) PLP_PROFILE_VOID(plp_argmax_i32, __VA_ARGS__)
+#define plp_argmax_i32_parallel(...) PLP_PROFILE_VOID(plp_argmax_i32_parallel, __VA_ARGS__)
+#define plp_argmax_i16(...) PLP_PROFILE_VOID(plp_argmax_i16, __VA_ARGS__)
+#define plp_argmax_i16_parallel(...) PLP_PROFILE_VOID(plp_argmax_i16_parallel, __VA_ARGS__)
+#define plp_argmax_i8(...) PLP_PROFILE_VOID(plp_argmax_i8, __VA_ARGS__)
+#define plp_argmax_i8_parallel(...) PLP_PROFILE_VOID(plp_argmax_i8_parallel, __VA_ARGS__)
+#define plp_argmax_f32(...) PLP_PROFILE_VOID(plp_argmax_f32, __VA_ARGS__)
+#define plp_argmax_f32_parallel(...) PLP_PROFILE_VOID(plp_argmax_f32_parallel, __VA_ARGS__)
+#define plp_min_idx_i32(...) PLP_PROFILE_VOID(plp_min_idx_i32, __VA_ARGS__)
+#define plp_min_idx_i32_parallel(...) PLP_PROFILE_VOID(plp_min_idx_i32_parallel, __VA_ARGS__)
+#define plp_min_idx_i16(...) PLP_PROFILE_VOID(plp_min_idx_i16, __VA_ARGS__)
+#define plp_min_idx_i16_parallel(...) PLP_PROFILE_VOID(plp_min_idx_i16_parallel, __VA_ARGS__)
+#define plp_min_idx_i8(...) PLP_PROFILE_VOID(plp_min_idx_i8, __VA_ARGS__)
+#define plp_min_idx_i8_parallel(...) PLP_PROFILE_VOID(plp_min_idx_i8_parallel, __VA_ARGS__)
+#define plp_min_idx_f32(...) PLP_PROFILE_VOID(plp_min_idx_f32, __VA_ARGS__)
+#define plp_min_idx_f32_parallel(...) PLP_PROFILE_VOID(plp_min_idx_f32_parallel, __VA_ARGS__)
+#define plp_argmin_i32(...) PLP_PROFILE_VOID(plp_argmin_i32, __VA_ARGS__)
+#define plp_argmin_i32_parallel(...) PLP_PROFILE_VOID(plp_argmin_i32_parallel, __VA_ARGS__)
+#define plp_argmin_i16(...) PLP_PROFILE_VOID(plp_argmin_i16, __VA_ARGS__)
+#define plp_argmin_i16_parallel(...) PLP_PROFILE_VOID(plp_argmin_i16_parallel, __VA_ARGS__)
+#define plp_argmin_i8(...) PLP_PROFILE_VOID(plp_argmin_i8, __VA_ARGS__)
+#define plp_argmin_i8_parallel(...) PLP_PROFILE_VOID(plp_argmin_i8_parallel, __VA_ARGS__)
+#define plp_argmin_f32(...) PLP_PROFILE_VOID(plp_argmin_f32, __VA_ARGS__)
+#define plp_argmin_f32_parallel(...) PLP_PROFILE_VOID(plp_argmin_f32_parallel, __VA_ARGS__)
+#define plp_running_stats_init_f32(...) PLP_PROFILE_VOID(plp_running_stats_init_f32, __VA_ARGS__)
+#define plp_running_stats_update_f32(...) \
+    PLP_PROFILE_VOID(plp_running_stats_update_f32, __VA_ARGS__)
+#define plp_running_stats_get_f32(...) PLP_PROFILE_VOID(plp_running_stats_get_f32, __VA_ARGS__)
+#define plp_sliding_stats_init_q16(...) PLP_PROFILE_VOID(plp_sliding_stats_init_q16, __VA_ARGS__)
+#define plp_sliding_stats_update_q16(...) \
+    PLP_PROFILE_VOID(plp_sliding_stats_update_q16, __VA_ARGS__)
+#define plp_sliding_stats_get_q16(...) PLP_PROFILE_VOID(plp_sliding_stats_get_q16, __VA_ARGS__)
+#define plp_sliding_stats_init_f32(...) PLP_PROFILE_VOID(plp_sliding_stats_init_f32, __VA_ARGS__)
+#define plp_sliding_stats_update_f32(...) \
+    PLP_PROFILE_VOID(plp_sliding_stats_update_f32, __VA_ARGS__)
+#define plp_sliding_stats_get_f32(...) PLP_PROFILE_VOID(plp_sliding_stats_get_f32, __VA_ARGS__)
+#define plp_histogram_i8(...) PLP_PROFILE_VOID(plp_histogram_i8, __VA_ARGS__)
+#define plp_histogram_i8_parallel(...) PLP_PROFILE_VOID(plp_histogram_i8_parallel, __VA_ARGS__)
+#define plp_histogram_i16(...) PLP_PROFILE_VOID(plp_histogram_i16, __VA_ARGS__)
+#define plp_histogram_i16_parallel(...) PLP_PROFILE_VOID(plp_histogram_i16_parallel, __VA_ARGS__)
+#define plp_histogram_f32(...) PLP_PROFILE_VOID(plp_histogram_f32, __VA_ARGS__)
+#define plp_histogram_f32_parallel(...) PLP_PROFILE_VOID(plp_histogram_f32_parallel, __VA_ARGS__)
+#define plp_percentile_i8(...) PLP_PROFILE_VOID(plp_percentile_i8, __VA_ARGS__)
+#define plp_percentile_i16(...) PLP_PROFILE_VOID(plp_percentile_i16, __VA_ARGS__)
+#define plp_percentile_f32(...) PLP_PROFILE_VOID(plp_percentile_f32, __VA_ARGS__)
+#define plp_vq_norms_i8(...) PLP_PROFILE_VOID(plp_vq_norms_i8, __VA_ARGS__)
+#define plp_vq_nearest_i8(...) PLP_PROFILE_VOID(plp_vq_nearest_i8, __VA_ARGS__)
+#define plp_vq_nearest_i8_parallel(...) PLP_PROFILE_VOID(plp_vq_nearest_i8_parallel, __VA_ARGS__)
+#define plp_vq_norms_i16(...) PLP_PROFILE_VOID(plp_vq_norms_i16, __VA_ARGS__)
+#define plp_vq_nearest_i16(...) PLP_PROFILE_VOID(plp_vq_nearest_i16, __VA_ARGS__)
+#define plp_vq_nearest_i16_parallel(...) PLP_PROFILE_VOID(plp_vq_nearest_i16_parallel, __VA_ARGS__)
+#define plp_vq_norms_f32(...) PLP_PROFILE_VOID(plp_vq_norms_f32, __VA_ARGS__)
+#define plp_vq_nearest_f32(...) PLP_PROFILE_VOID(plp_vq_nearest_f32, __VA_ARGS__)
+#define plp_vq_nearest_f32_parallel(...) PLP_PROFILE_VOID(plp_vq_nearest_f32_parallel, __VA_ARGS__)
+#define plp_mean_stride_i8(...) PLP_PROFILE_VOID(plp_mean_stride_i8, __VA_ARGS__)
+#define plp_mean_stride_i16(...) PLP_PROFILE_VOID(plp_mean_stride_i16, __VA_ARGS__)
+#define plp_mean_stride_i32(...) PLP_PROFILE_VOID(plp_mean_stride_i32, __VA_ARGS__)
+#define plp_mean_stride_f32(...) PLP_PROFILE_VOID(plp_mean_stride_f32, __VA_ARGS__)
+#define plp_power_stride_i8(...) PLP_PROFILE_VOID(plp_power_stride_i8, __VA_ARGS__)
+#define plp_power_stride_i16(...) PLP_PROFILE_VOID(plp_power_stride_i16, __VA_ARGS__)
+#define plp_power_stride_i32(...) PLP_PROFILE_VOID(plp_power_stride_i32, __VA_ARGS__)
+#define plp_power_stride_f32(...) PLP_PROFILE_VOID(plp_power_stride_f32, __VA_ARGS__)
+#define plp_max_stride_i8(...) PLP_PROFILE_VOID(plp_max_stride_i8, __VA_ARGS__)
+#define plp_max_stride_i16(...) PLP_PROFILE_VOID(plp_max_stride_i16, __VA_ARGS__)
+#define plp_max_stride_i32(...) PLP_PROFILE_VOID(plp_max_stride_i32, __VA_ARGS__)
+#define plp_max_stride_f32(...) PLP_PROFILE_VOID(plp_max_stride_f32, __VA_ARGS__)
+#define plp_min_stride_i8(...) PLP_PROFILE_VOID(plp_min_stride_i8, __VA_ARGS__)
+#define plp_min_stride_i16(...) PLP_PROFILE_VOID(plp_min_stride_i16, __VA_ARGS__)
+#define plp_min_stride_i32(...) PLP_PROFILE_VOID(plp_min_stride_i32, __VA_ARGS__)
+#define plp_min_stride_f32(...) PLP_PROFILE_VOID(plp_min_stride_f32, __VA_ARGS__)
+#define plp_mean_interleaved_i16(...) PLP_PROFILE_VOID(plp_mean_interleaved_i16, __VA_ARGS__)
+#define plp_max_interleaved_i16(...) PLP_PROFILE_VOID(plp_max_interleaved_i16, __VA_ARGS__)
+#define plp_min_interleaved_i16(...) PLP_PROFILE_VOID(plp_min_interleaved_i16, __VA_ARGS__)
+#define plp_rms_interleaved_q16(...) PLP_PROFILE_VOID(plp_rms_interleaved_q16, __VA_ARGS__)
+#define plp_normalize_l2_q16(...) PLP_PROFILE_VOID(plp_normalize_l2_q16, __VA_ARGS__)
+#define plp_normalize_l2_f32(...) PLP_PROFILE_VOID(plp_normalize_l2_f32, __VA_ARGS__)
+#define plp_normalize_l2_rows_q16(...) PLP_PROFILE_VOID(plp_normalize_l2_rows_q16, __VA_ARGS__)
+#define plp_normalize_l2_rows_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_normalize_l2_rows_q16_parallel, __VA_ARGS__)
+#define plp_normalize_l2_rows_f32(...) PLP_PROFILE_VOID(plp_normalize_l2_rows_f32, __VA_ARGS__)
+#define plp_normalize_l2_rows_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_normalize_l2_rows_f32_parallel, __VA_ARGS__)
+#define plp_cfar_ca_q16(...) PLP_PROFILE_VOID(plp_cfar_ca_q16, __VA_ARGS__)
+#define plp_cfar_ca_q16_parallel(...) PLP_PROFILE_VOID(plp_cfar_ca_q16_parallel, __VA_ARGS__)
+#define plp_cfar_ca_f32(...) PLP_PROFILE_VOID(plp_cfar_ca_f32, __VA_ARGS__)
+#define plp_cfar_ca_f32_parallel(...) PLP_PROFILE_VOID(plp_cfar_ca_f32_parallel, __VA_ARGS__)
+#define plp_cfar_os_q16(...) PLP_PROFILE_VOID(plp_cfar_os_q16, __VA_ARGS__)
+#define plp_cfar_os_q16_parallel(...) PLP_PROFILE_VOID(plp_cfar_os_q16_parallel, __VA_ARGS__)
+#define plp_cfar_os_f32(...) PLP_PROFILE_VOID(plp_cfar_os_f32, __VA_ARGS__)
+#define plp_cfar_os_f32_parallel(...) PLP_PROFILE_VOID(plp_cfar_os_f32_parallel, __VA_ARGS__)
+#define plp_find_peaks_q16(...) PLP_PROFILE_VOID(plp_find_peaks_q16, __VA_ARGS__)
+#define plp_find_peaks_q16_parallel(...) PLP_PROFILE_VOID(plp_find_peaks_q16_parallel, __VA_ARGS__)
+#define plp_find_peaks_f32(...) PLP_PROFILE_VOID(plp_find_peaks_f32, __VA_ARGS__)
+#define plp_find_peaks_f32_parallel(...) PLP_PROFILE_VOID(plp_find_peaks_f32_parallel, __VA_ARGS__)
+#define plp_mat_partition(...) PLP_PROFILE_VOID(plp_mat_partition, __VA_ARGS__)
+#define plp_mat_mult_plan_create(...) PLP_PROFILE_VOID(plp_mat_mult_plan_create, __VA_ARGS__)
+#define plp_mat_mult_execute(...) PLP_PROFILE_VOID(plp_mat_mult_execute, __VA_ARGS__)
+#define plp_mat_mult_i32(...) PLP_PROFILE_VOID(plp_mat_mult_i32, __VA_ARGS__)
+#define plp_mat_mult_i16(...) PLP_PROFILE_VOID(plp_mat_mult_i16, __VA_ARGS__)
+#define plp_mat_mult_i8(...) PLP_PROFILE_VOID(plp_mat_mult_i8, __VA_ARGS__)
+#define plp_mat_mult_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_f32(...) PLP_PROFILE_VOID(plp_mat_mult_f32, __VA_ARGS__)
+#define plp_mat_mult_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_f16(...) PLP_PROFILE_VOID(plp_mat_mult_f16, __VA_ARGS__)
+#define plp_mat_mult_f16_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_f16_parallel, __VA_ARGS__)
+#define plp_mat_mult_i32_async(...) PLP_PROFILE_VOID(plp_mat_mult_i32_async, __VA_ARGS__)
+#define plp_mat_mult_i16_async(...) PLP_PROFILE_VOID(plp_mat_mult_i16_async, __VA_ARGS__)
+#define plp_mat_mult_i8_async(...) PLP_PROFILE_VOID(plp_mat_mult_i8_async, __VA_ARGS__)
+#define plp_mat_mult_f32_async(...) PLP_PROFILE_VOID(plp_mat_mult_f32_async, __VA_ARGS__)
+#define plp_mat_mult_i8xi16(...) PLP_PROFILE_VOID(plp_mat_mult_i8xi16, __VA_ARGS__)
+#define plp_mat_mult_i8xi16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_i8xi16_parallel, __VA_ARGS__)
+#define plp_mat_mult_q32(...) PLP_PROFILE_VOID(plp_mat_mult_q32, __VA_ARGS__)
+#define plp_mat_mult_q32_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_q16(...) PLP_PROFILE_VOID(plp_mat_mult_q16, __VA_ARGS__)
+#define plp_mat_mult_q16_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_q8(...) PLP_PROFILE_VOID(plp_mat_mult_q8, __VA_ARGS__)
+#define plp_mat_mult_q8_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_q8_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_i32(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_i32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_i16(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_i16, __VA_ARGS__)
+#define plp_mat_mult_cmplx_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_i8(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_i8, __VA_ARGS__)
+#define plp_mat_mult_cmplx_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_f32(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_f32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_3m_f32(...) PLP_PROFILE_RET(plp_mat_mult_cmplx_3m_f32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_3m_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_mult_cmplx_3m_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_q32(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_q32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_q16(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_q16, __VA_ARGS__)
+#define plp_mat_mult_cmplx_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_q8(...) PLP_PROFILE_VOID(plp_mat_mult_cmplx_q8, __VA_ARGS__)
+#define plp_mat_mult_cmplx_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_q8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_i32(...) PLP_PROFILE_VOID(plp_mat_mult_trans_i32, __VA_ARGS__)
+#define plp_mat_mult_trans_i16(...) PLP_PROFILE_VOID(plp_mat_mult_trans_i16, __VA_ARGS__)
+#define plp_mat_mult_trans_i8(...) PLP_PROFILE_VOID(plp_mat_mult_trans_i8, __VA_ARGS__)
+#define plp_mat_mult_trans_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_q32(...) PLP_PROFILE_VOID(plp_mat_mult_trans_q32, __VA_ARGS__)
+#define plp_mat_mult_trans_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_q16(...) PLP_PROFILE_VOID(plp_mat_mult_trans_q16, __VA_ARGS__)
+#define plp_mat_mult_trans_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_q8(...) PLP_PROFILE_VOID(plp_mat_mult_trans_q8, __VA_ARGS__)
+#define plp_mat_mult_trans_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_q8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_f32(...) PLP_PROFILE_VOID(plp_mat_mult_trans_f32, __VA_ARGS__)
+#define plp_mat_mult_trans_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_i32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_i32, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_i16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_i16, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_i8(...) PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_i8, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_f32, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_q32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_q32, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_q16, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_q8(...) PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_q8, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_q8_parallel, __VA_ARGS__)
+#define plp_mat_add_i32(...) PLP_PROFILE_VOID(plp_mat_add_i32, __VA_ARGS__)
+#define plp_mat_add_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_add_i32_parallel, __VA_ARGS__)
+#define plp_mat_add_i16(...) PLP_PROFILE_VOID(plp_mat_add_i16, __VA_ARGS__)
+#define plp_mat_add_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_add_i16_parallel, __VA_ARGS__)
+#define plp_mat_add_i8(...) PLP_PROFILE_VOID(plp_mat_add_i8, __VA_ARGS__)
+#define plp_mat_add_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_add_i8_parallel, __VA_ARGS__)
+#define plp_mat_add_f32(...) PLP_PROFILE_VOID(plp_mat_add_f32, __VA_ARGS__)
+#define plp_mat_add_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_add_f32_parallel, __VA_ARGS__)
+#define plp_mat_sub_i32(...) PLP_PROFILE_VOID(plp_mat_sub_i32, __VA_ARGS__)
+#define plp_mat_sub_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_sub_i32_parallel, __VA_ARGS__)
+#define plp_mat_sub_i16(...) PLP_PROFILE_VOID(plp_mat_sub_i16, __VA_ARGS__)
+#define plp_mat_sub_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_sub_i16_parallel, __VA_ARGS__)
+#define plp_mat_sub_i8(...) PLP_PROFILE_VOID(plp_mat_sub_i8, __VA_ARGS__)
+#define plp_mat_sub_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_sub_i8_parallel, __VA_ARGS__)
+#define plp_mat_sub_f32(...) PLP_PROFILE_VOID(plp_mat_sub_f32, __VA_ARGS__)
+#define plp_mat_sub_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_sub_f32_parallel, __VA_ARGS__)
+#define plp_mat_scale_i32(...) PLP_PROFILE_VOID(plp_mat_scale_i32, __VA_ARGS__)
+#define plp_mat_scale_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_scale_i32_parallel, __VA_ARGS__)
+#define plp_mat_scale_i16(...) PLP_PROFILE_VOID(plp_mat_scale_i16, __VA_ARGS__)
+#define plp_mat_scale_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_scale_i16_parallel, __VA_ARGS__)
+#define plp_mat_scale_i8(...) PLP_PROFILE_VOID(plp_mat_scale_i8, __VA_ARGS__)
+#define plp_mat_scale_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_scale_i8_parallel, __VA_ARGS__)
+#define plp_mat_scale_f32(...) PLP_PROFILE_VOID(plp_mat_scale_f32, __VA_ARGS__)
+#define plp_mat_scale_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_scale_f32_parallel, __VA_ARGS__)
+#define plp_mat_add_inplace_i32(...) PLP_PROFILE_VOID(plp_mat_add_inplace_i32, __VA_ARGS__)
+#define plp_mat_add_inplace_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_inplace_i32_parallel, __VA_ARGS__)
+#define plp_mat_add_inplace_i16(...) PLP_PROFILE_VOID(plp_mat_add_inplace_i16, __VA_ARGS__)
+#define plp_mat_add_inplace_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_inplace_i16_parallel, __VA_ARGS__)
+#define plp_mat_add_inplace_i8(...) PLP_PROFILE_VOID(plp_mat_add_inplace_i8, __VA_ARGS__)
+#define plp_mat_add_inplace_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_inplace_i8_parallel, __VA_ARGS__)
+#define plp_mat_add_inplace_f32(...) PLP_PROFILE_VOID(plp_mat_add_inplace_f32, __VA_ARGS__)
+#define plp_mat_add_inplace_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_inplace_f32_parallel, __VA_ARGS__)
+#define plp_mat_sub_inplace_i32(...) PLP_PROFILE_VOID(plp_mat_sub_inplace_i32, __VA_ARGS__)
+#define plp_mat_sub_inplace_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_inplace_i32_parallel, __VA_ARGS__)
+#define plp_mat_sub_inplace_i16(...) PLP_PROFILE_VOID(plp_mat_sub_inplace_i16, __VA_ARGS__)
+#define plp_mat_sub_inplace_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_inplace_i16_parallel, __VA_ARGS__)
+#define plp_mat_sub_inplace_i8(...) PLP_PROFILE_VOID(plp_mat_sub_inplace_i8, __VA_ARGS__)
+#define plp_mat_sub_inplace_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_inplace_i8_parallel, __VA_ARGS__)
+#define plp_mat_sub_inplace_f32(...) PLP_PROFILE_VOID(plp_mat_sub_inplace_f32, __VA_ARGS__)
+#define plp_mat_sub_inplace_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_inplace_f32_parallel, __VA_ARGS__)
+#define plp_mat_scale_inplace_i32(...) PLP_PROFILE_VOID(plp_mat_scale_inplace_i32, __VA_ARGS__)
+#define plp_mat_scale_inplace_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_inplace_i32_parallel, __VA_ARGS__)
+#define plp_mat_scale_inplace_i16(...) PLP_PROFILE_VOID(plp_mat_scale_inplace_i16, __VA_ARGS__)
+#define plp_mat_scale_inplace_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_inplace_i16_parallel, __VA_ARGS__)
+#define plp_mat_scale_inplace_i8(...) PLP_PROFILE_VOID(plp_mat_scale_inplace_i8, __VA_ARGS__)
+#define plp_mat_scale_inplace_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_inplace_i8_parallel, __VA_ARGS__)
+#define plp_mat_scale_inplace_f32(...) PLP_PROFILE_VOID(plp_mat_scale_inplace_f32, __VA_ARGS__)
+#define plp_mat_scale_inplace_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_inplace_f32_parallel, __VA_ARGS__)
+#define plp_mat_trans_i32(...) PLP_PROFILE_VOID(plp_mat_trans_i32, __VA_ARGS__)
+#define plp_mat_trans_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_trans_i32_parallel, __VA_ARGS__)
+#define plp_mat_trans_i16(...) PLP_PROFILE_VOID(plp_mat_trans_i16, __VA_ARGS__)
+#define plp_mat_trans_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_trans_i16_parallel, __VA_ARGS__)
+#define plp_mat_trans_i8(...) PLP_PROFILE_VOID(plp_mat_trans_i8, __VA_ARGS__)
+#define plp_mat_trans_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_trans_i8_parallel, __VA_ARGS__)
+#define plp_mat_trans_f32(...) PLP_PROFILE_VOID(plp_mat_trans_f32, __VA_ARGS__)
+#define plp_mat_trans_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_trans_f32_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_i16(...) PLP_PROFILE_VOID(plp_mat_trans_cmplx_i16, __VA_ARGS__)
+#define plp_mat_trans_cmplx_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_i16_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_q16(...) PLP_PROFILE_VOID(plp_mat_trans_cmplx_q16, __VA_ARGS__)
+#define plp_mat_trans_cmplx_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_q16_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_i32(...) PLP_PROFILE_VOID(plp_mat_trans_cmplx_i32, __VA_ARGS__)
+#define plp_mat_trans_cmplx_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_i32_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_f32(...) PLP_PROFILE_VOID(plp_mat_trans_cmplx_f32, __VA_ARGS__)
+#define plp_mat_trans_cmplx_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_i16(...) PLP_PROFILE_VOID(plp_mat_hermitian_i16, __VA_ARGS__)
+#define plp_mat_hermitian_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_i16_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_q16(...) PLP_PROFILE_VOID(plp_mat_hermitian_q16, __VA_ARGS__)
+#define plp_mat_hermitian_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_q16_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_i32(...) PLP_PROFILE_VOID(plp_mat_hermitian_i32, __VA_ARGS__)
+#define plp_mat_hermitian_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_i32_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_f32(...) PLP_PROFILE_VOID(plp_mat_hermitian_f32, __VA_ARGS__)
+#define plp_mat_hermitian_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_f32_parallel, __VA_ARGS__)
+#define plp_mat_inv_f32(...) PLP_PROFILE_RET(plp_mat_inv_f32, __VA_ARGS__)
+#define plp_mat_inv_f32_parallel(...) PLP_PROFILE_RET(plp_mat_inv_f32_parallel, __VA_ARGS__)
+#define plp_mat_inv_q32(...) PLP_PROFILE_RET(plp_mat_inv_q32, __VA_ARGS__)
+#define plp_mat_inv_q16(...) PLP_PROFILE_RET(plp_mat_inv_q16, __VA_ARGS__)
+#define plp_mat_inv_small_f32(...) PLP_PROFILE_RET(plp_mat_inv_small_f32, __VA_ARGS__)
+#define plp_mat_det_small_f32(...) PLP_PROFILE_RET(plp_mat_det_small_f32, __VA_ARGS__)
+#define plp_mat_inv_small_batched_f32(...) \
+    PLP_PROFILE_RET(plp_mat_inv_small_batched_f32, __VA_ARGS__)
+#define plp_mat_lu_f32(...) PLP_PROFILE_RET(plp_mat_lu_f32, __VA_ARGS__)
+#define plp_mat_lu_solve_f32(...) PLP_PROFILE_RET(plp_mat_lu_solve_f32, __VA_ARGS__)
+#define plp_mat_lu_solve_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_lu_solve_f32_parallel, __VA_ARGS__)
+#define plp_mat_qr_f32(...) PLP_PROFILE_RET(plp_mat_qr_f32, __VA_ARGS__)
+#define plp_mat_qr_f32_parallel(...) PLP_PROFILE_RET(plp_mat_qr_f32_parallel, __VA_ARGS__)
+#define plp_mat_qr_cmplx_f32(...) PLP_PROFILE_RET(plp_mat_qr_cmplx_f32, __VA_ARGS__)
+#define plp_mat_qr_cmplx_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_qr_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_mat_eig_sym_f32(...) PLP_PROFILE_RET(plp_mat_eig_sym_f32, __VA_ARGS__)
+#define plp_mat_eig_sym_f32_parallel(...) PLP_PROFILE_RET(plp_mat_eig_sym_f32_parallel, __VA_ARGS__)
+#define plp_kalman_predict_f32(...) PLP_PROFILE_VOID(plp_kalman_predict_f32, __VA_ARGS__)
+#define plp_kalman_update_f32(...) PLP_PROFILE_RET(plp_kalman_update_f32, __VA_ARGS__)
+#define plp_mat_lstsq_f32(...) PLP_PROFILE_RET(plp_mat_lstsq_f32, __VA_ARGS__)
+#define plp_mat_lstsq_f32_parallel(...) PLP_PROFILE_RET(plp_mat_lstsq_f32_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_i8(...) PLP_PROFILE_VOID(plp_mat_vec_mult_i8, __VA_ARGS__)
+#define plp_mat_vec_mult_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_i8_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_compressed_i8(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_compressed_i8, __VA_ARGS__)
+#define plp_mat_vec_mult_compressed_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_compressed_i8_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_i8xi16(...) PLP_PROFILE_VOID(plp_mat_vec_mult_i8xi16, __VA_ARGS__)
+#define plp_mat_vec_mult_i8xi16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_i8xi16_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_i16(...) PLP_PROFILE_VOID(plp_mat_vec_mult_i16, __VA_ARGS__)
+#define plp_mat_vec_mult_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_i16_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_i32(...) PLP_PROFILE_VOID(plp_mat_vec_mult_i32, __VA_ARGS__)
+#define plp_mat_vec_mult_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_i32_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_q8(...) PLP_PROFILE_VOID(plp_mat_vec_mult_q8, __VA_ARGS__)
+#define plp_mat_vec_mult_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_q8_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_q16(...) PLP_PROFILE_VOID(plp_mat_vec_mult_q16, __VA_ARGS__)
+#define plp_mat_vec_mult_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_q16_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_q32(...) PLP_PROFILE_VOID(plp_mat_vec_mult_q32, __VA_ARGS__)
+#define plp_mat_vec_mult_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_q32_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_f32(...) PLP_PROFILE_VOID(plp_mat_vec_mult_f32, __VA_ARGS__)
+#define plp_mat_vec_mult_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_f32_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_cmplx_q16(...) PLP_PROFILE_VOID(plp_mat_vec_mult_cmplx_q16, __VA_ARGS__)
+#define plp_mat_vec_mult_cmplx_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_cmplx_q16_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_cmplx_f32(...) PLP_PROFILE_VOID(plp_mat_vec_mult_cmplx_f32, __VA_ARGS__)
+#define plp_mat_vec_mult_cmplx_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_mat_vec_mult_cmplx_batched_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_cmplx_batched_q16, __VA_ARGS__)
+#define plp_mat_vec_mult_cmplx_batched_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_vec_mult_cmplx_batched_f32, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_i8(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_i8, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_i8_parallel, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_i16(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_i16, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_i16_parallel, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_i32(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_i32, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_i32_parallel, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_q8(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_q8, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_q8_parallel, __VA_ARGS__)
+#define plp_mat_outer_i32(...) PLP_PROFILE_VOID(plp_mat_outer_i32, __VA_ARGS__)
+#define plp_mat_outer_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_outer_i32_parallel, __VA_ARGS__)
+#define plp_mat_outer_i16(...) PLP_PROFILE_VOID(plp_mat_outer_i16, __VA_ARGS__)
+#define plp_mat_outer_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_outer_i16_parallel, __VA_ARGS__)
+#define plp_mat_outer_i8(...) PLP_PROFILE_VOID(plp_mat_outer_i8, __VA_ARGS__)
+#define plp_mat_outer_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_outer_i8_parallel, __VA_ARGS__)
+#define plp_mat_outer_f32(...) PLP_PROFILE_VOID(plp_mat_outer_f32, __VA_ARGS__)
+#define plp_mat_outer_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_outer_f32_parallel, __VA_ARGS__)
+#define plp_mat_rank1_update_i32(...) PLP_PROFILE_VOID(plp_mat_rank1_update_i32, __VA_ARGS__)
+#define plp_mat_rank1_update_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_rank1_update_i32_parallel, __VA_ARGS__)
+#define plp_mat_rank1_update_i16(...) PLP_PROFILE_VOID(plp_mat_rank1_update_i16, __VA_ARGS__)
+#define plp_mat_rank1_update_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_rank1_update_i16_parallel, __VA_ARGS__)
+#define plp_mat_rank1_update_i8(...) PLP_PROFILE_VOID(plp_mat_rank1_update_i8, __VA_ARGS__)
+#define plp_mat_rank1_update_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_rank1_update_i8_parallel, __VA_ARGS__)
+#define plp_mat_rank1_update_f32(...) PLP_PROFILE_VOID(plp_mat_rank1_update_f32, __VA_ARGS__)
+#define plp_mat_rank1_update_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_rank1_update_f32_parallel, __VA_ARGS__)
+#define plp_mat_kron_i32(...) PLP_PROFILE_VOID(plp_mat_kron_i32, __VA_ARGS__)
+#define plp_mat_kron_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_kron_i32_parallel, __VA_ARGS__)
+#define plp_mat_kron_i16(...) PLP_PROFILE_VOID(plp_mat_kron_i16, __VA_ARGS__)
+#define plp_mat_kron_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_kron_i16_parallel, __VA_ARGS__)
+#define plp_mat_kron_i8(...) PLP_PROFILE_VOID(plp_mat_kron_i8, __VA_ARGS__)
+#define plp_mat_kron_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_kron_i8_parallel, __VA_ARGS__)
+#define plp_mat_kron_f32(...) PLP_PROFILE_VOID(plp_mat_kron_f32, __VA_ARGS__)
+#define plp_mat_kron_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_kron_f32_parallel, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_q16(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_q16, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_q16_parallel, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_q32(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_q32, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_q32_parallel, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_f32(...) PLP_PROFILE_VOID(plp_mat_trans_vec_mult_f32, __VA_ARGS__)
+#define plp_mat_trans_vec_mult_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_vec_mult_f32_parallel, __VA_ARGS__)
+#define plp_spmv_partition(...) PLP_PROFILE_VOID(plp_spmv_partition, __VA_ARGS__)
+#define plp_spmv_i8(...) PLP_PROFILE_VOID(plp_spmv_i8, __VA_ARGS__)
+#define plp_spmv_i8_parallel(...) PLP_PROFILE_VOID(plp_spmv_i8_parallel, __VA_ARGS__)
+#define plp_spmv_i16(...) PLP_PROFILE_VOID(plp_spmv_i16, __VA_ARGS__)
+#define plp_spmv_i16_parallel(...) PLP_PROFILE_VOID(plp_spmv_i16_parallel, __VA_ARGS__)
+#define plp_spmv_f32(...) PLP_PROFILE_VOID(plp_spmv_f32, __VA_ARGS__)
+#define plp_spmv_f32_parallel(...) PLP_PROFILE_VOID(plp_spmv_f32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_i32(...) PLP_PROFILE_VOID(plp_mat_fill_I_i32, __VA_ARGS__)
+#define plp_mat_fill_I_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_i32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_i16(...) PLP_PROFILE_VOID(plp_mat_fill_I_i16, __VA_ARGS__)
+#define plp_mat_fill_I_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_i16_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_i8(...) PLP_PROFILE_VOID(plp_mat_fill_I_i8, __VA_ARGS__)
+#define plp_mat_fill_I_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_i8_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_f32(...) PLP_PROFILE_VOID(plp_mat_fill_I_f32, __VA_ARGS__)
+#define plp_mat_fill_I_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_f32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_q32(...) PLP_PROFILE_VOID(plp_mat_fill_I_q32, __VA_ARGS__)
+#define plp_mat_fill_I_q32_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_q32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_q16(...) PLP_PROFILE_VOID(plp_mat_fill_I_q16, __VA_ARGS__)
+#define plp_mat_fill_I_q16_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_q16_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_q8(...) PLP_PROFILE_VOID(plp_mat_fill_I_q8, __VA_ARGS__)
+#define plp_mat_fill_I_q8_parallel(...) PLP_PROFILE_VOID(plp_mat_fill_I_q8_parallel, __VA_ARGS__)
+#define plp_mat_mult_i32_tiled(...) PLP_PROFILE_VOID(plp_mat_mult_i32_tiled, __VA_ARGS__)
+#define plp_mat_mult_i16_tiled(...) PLP_PROFILE_VOID(plp_mat_mult_i16_tiled, __VA_ARGS__)
+#define plp_mat_mult_i8_tiled(...) PLP_PROFILE_VOID(plp_mat_mult_i8_tiled, __VA_ARGS__)
+#define plp_mat_mult_f32_tiled(...) PLP_PROFILE_VOID(plp_mat_mult_f32_tiled, __VA_ARGS__)
+#define plp_mat_mult_i32_tiled_multi(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_i32_tiled_multi, __VA_ARGS__)
+#define plp_mat_mult_i16_tiled_multi(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_i16_tiled_multi, __VA_ARGS__)
+#define plp_mat_mult_i8_tiled_multi(...) PLP_PROFILE_VOID(plp_mat_mult_i8_tiled_multi, __VA_ARGS__)
+#define plp_mat_mult_f32_tiled_multi(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_f32_tiled_multi, __VA_ARGS__)
+#define plp_mat_mult_i16_packB(...) PLP_PROFILE_VOID(plp_mat_mult_i16_packB, __VA_ARGS__)
+#define plp_mat_mult_packed_i16(...) PLP_PROFILE_VOID(plp_mat_mult_packed_i16, __VA_ARGS__)
+#define plp_mat_mult_packed_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_packed_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_i8_packB(...) PLP_PROFILE_VOID(plp_mat_mult_i8_packB, __VA_ARGS__)
+#define plp_mat_mult_packed_i8(...) PLP_PROFILE_VOID(plp_mat_mult_packed_i8, __VA_ARGS__)
+#define plp_mat_mult_packed_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_packed_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_i4(...) PLP_PROFILE_VOID(plp_mat_mult_i4, __VA_ARGS__)
+#define plp_mat_mult_i2(...) PLP_PROFILE_VOID(plp_mat_mult_i2, __VA_ARGS__)
+#define plp_mat_mult_bin(...) PLP_PROFILE_VOID(plp_mat_mult_bin, __VA_ARGS__)
+#define plp_mat_mult_bin_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_bin_parallel, __VA_ARGS__)
+#define plp_mat_mult_ter(...) PLP_PROFILE_VOID(plp_mat_mult_ter, __VA_ARGS__)
+#define plp_mat_mult_ter_parallel(...) PLP_PROFILE_VOID(plp_mat_mult_ter_parallel, __VA_ARGS__)
+#define plp_mat_mult_requant_i8(...) PLP_PROFILE_VOID(plp_mat_mult_requant_i8, __VA_ARGS__)
+#define plp_mat_mult_requant_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_requant_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_requant_q16(...) PLP_PROFILE_VOID(plp_mat_mult_requant_q16, __VA_ARGS__)
+#define plp_mat_mult_requant_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_requant_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_requant_q32(...) PLP_PROFILE_VOID(plp_mat_mult_requant_q32, __VA_ARGS__)
+#define plp_mat_mult_requant_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_requant_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_batched_f32(...) PLP_PROFILE_VOID(plp_mat_mult_batched_f32, __VA_ARGS__)
+#define plp_mat_mult_batched_i16(...) PLP_PROFILE_VOID(plp_mat_mult_batched_i16, __VA_ARGS__)
+#define plp_mat_mult_batched_q16(...) PLP_PROFILE_VOID(plp_mat_mult_batched_q16, __VA_ARGS__)
+#define plp_mat_fma_i32(...) PLP_PROFILE_VOID(plp_mat_fma_i32, __VA_ARGS__)
+#define plp_mat_fma_i32_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_i32_parallel, __VA_ARGS__)
+#define plp_mat_fma_i16(...) PLP_PROFILE_VOID(plp_mat_fma_i16, __VA_ARGS__)
+#define plp_mat_fma_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_i16_parallel, __VA_ARGS__)
+#define plp_mat_fma_i8(...) PLP_PROFILE_VOID(plp_mat_fma_i8, __VA_ARGS__)
+#define plp_mat_fma_i8_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_i8_parallel, __VA_ARGS__)
+#define plp_mat_fma_q32(...) PLP_PROFILE_VOID(plp_mat_fma_q32, __VA_ARGS__)
+#define plp_mat_fma_q32_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_q32_parallel, __VA_ARGS__)
+#define plp_mat_fma_q16(...) PLP_PROFILE_VOID(plp_mat_fma_q16, __VA_ARGS__)
+#define plp_mat_fma_q16_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_q16_parallel, __VA_ARGS__)
+#define plp_mat_fma_q8(...) PLP_PROFILE_VOID(plp_mat_fma_q8, __VA_ARGS__)
+#define plp_mat_fma_q8_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_q8_parallel, __VA_ARGS__)
+#define plp_mat_fma_f32(...) PLP_PROFILE_VOID(plp_mat_fma_f32, __VA_ARGS__)
+#define plp_mat_fma_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_fma_f32_parallel, __VA_ARGS__)
+#define plp_mat_cholesky_f32(...) PLP_PROFILE_RET(plp_mat_cholesky_f32, __VA_ARGS__)
+#define plp_mat_cholesky_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_cholesky_f32_parallel, __VA_ARGS__)
+#define plp_mat_cholesky_q32(...) PLP_PROFILE_RET(plp_mat_cholesky_q32, __VA_ARGS__)
+#define plp_mat_cholesky_q32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_cholesky_q32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_f32(...) PLP_PROFILE_RET(plp_mat_solve_tri_lower_f32, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_lower_f32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_q32(...) PLP_PROFILE_RET(plp_mat_solve_tri_lower_q32, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_q32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_lower_q32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_f32(...) PLP_PROFILE_RET(plp_mat_solve_tri_upper_f32, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_upper_f32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_q32(...) PLP_PROFILE_RET(plp_mat_solve_tri_upper_q32, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_q32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_upper_q32_parallel, __VA_ARGS__)
+#define plp_mat_syrk_i16(...) PLP_PROFILE_VOID(plp_mat_syrk_i16, __VA_ARGS__)
+#define plp_mat_syrk_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_syrk_i16_parallel, __VA_ARGS__)
+#define plp_mat_syrk_q16(...) PLP_PROFILE_VOID(plp_mat_syrk_q16, __VA_ARGS__)
+#define plp_mat_syrk_q16_parallel(...) PLP_PROFILE_VOID(plp_mat_syrk_q16_parallel, __VA_ARGS__)
+#define plp_mat_syrk_f32(...) PLP_PROFILE_VOID(plp_mat_syrk_f32, __VA_ARGS__)
+#define plp_mat_syrk_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_syrk_f32_parallel, __VA_ARGS__)
+#define plp_mat_herk_i16(...) PLP_PROFILE_VOID(plp_mat_herk_i16, __VA_ARGS__)
+#define plp_mat_herk_i16_parallel(...) PLP_PROFILE_VOID(plp_mat_herk_i16_parallel, __VA_ARGS__)
+#define plp_mat_herk_q16(...) PLP_PROFILE_VOID(plp_mat_herk_q16, __VA_ARGS__)
+#define plp_mat_herk_q16_parallel(...) PLP_PROFILE_VOID(plp_mat_herk_q16_parallel, __VA_ARGS__)
+#define plp_mat_herk_f32(...) PLP_PROFILE_VOID(plp_mat_herk_f32, __VA_ARGS__)
+#define plp_mat_herk_f32_parallel(...) PLP_PROFILE_VOID(plp_mat_herk_f32_parallel, __VA_ARGS__)
+#define plp_cov_f32(...) PLP_PROFILE_RET(plp_cov_f32, __VA_ARGS__)
+#define plp_cov_f32_parallel(...) PLP_PROFILE_RET(plp_cov_f32_parallel, __VA_ARGS__)
+#define plp_mat_split(...) PLP_PROFILE_VOID(plp_mat_split, __VA_ARGS__)
+#define plp_mat_mult_stride_i32(...) PLP_PROFILE_VOID(plp_mat_mult_stride_i32, __VA_ARGS__)
+#define plp_mat_mult_stride_i16(...) PLP_PROFILE_VOID(plp_mat_mult_stride_i16, __VA_ARGS__)
+#define plp_mat_mult_stride_i8(...) PLP_PROFILE_VOID(plp_mat_mult_stride_i8, __VA_ARGS__)
+#define plp_mat_mult_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_f32(...) PLP_PROFILE_VOID(plp_mat_mult_stride_f32, __VA_ARGS__)
+#define plp_mat_mult_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_f16(...) PLP_PROFILE_VOID(plp_mat_mult_stride_f16, __VA_ARGS__)
+#define plp_mat_mult_stride_f16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_f16_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_i8xi16(...) PLP_PROFILE_VOID(plp_mat_mult_stride_i8xi16, __VA_ARGS__)
+#define plp_mat_mult_stride_i8xi16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_i8xi16_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_q32(...) PLP_PROFILE_VOID(plp_mat_mult_stride_q32, __VA_ARGS__)
+#define plp_mat_mult_stride_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_q16(...) PLP_PROFILE_VOID(plp_mat_mult_stride_q16, __VA_ARGS__)
+#define plp_mat_mult_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_stride_q8(...) PLP_PROFILE_VOID(plp_mat_mult_stride_q8, __VA_ARGS__)
+#define plp_mat_mult_stride_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_stride_q8_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_i32(...) PLP_PROFILE_VOID(plp_mat_fma_stride_i32, __VA_ARGS__)
+#define plp_mat_fma_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_i16(...) PLP_PROFILE_VOID(plp_mat_fma_stride_i16, __VA_ARGS__)
+#define plp_mat_fma_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_i8(...) PLP_PROFILE_VOID(plp_mat_fma_stride_i8, __VA_ARGS__)
+#define plp_mat_fma_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_q32(...) PLP_PROFILE_VOID(plp_mat_fma_stride_q32, __VA_ARGS__)
+#define plp_mat_fma_stride_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_q16(...) PLP_PROFILE_VOID(plp_mat_fma_stride_q16, __VA_ARGS__)
+#define plp_mat_fma_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_q8(...) PLP_PROFILE_VOID(plp_mat_fma_stride_q8, __VA_ARGS__)
+#define plp_mat_fma_stride_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_q8_parallel, __VA_ARGS__)
+#define plp_mat_fma_stride_f32(...) PLP_PROFILE_VOID(plp_mat_fma_stride_f32, __VA_ARGS__)
+#define plp_mat_fma_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fma_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_i32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_i32, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_i16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_i16, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_i8(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_i8, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_q32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_q32, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_q16, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_q8(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_q8, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_q8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_f32, __VA_ARGS__)
+#define plp_mat_mult_trans_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_i32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_i32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_i16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_i16, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_i8(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_i8, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_f32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_q32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_q32, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_q16, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_q8(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_q8, __VA_ARGS__)
+#define plp_mat_mult_cmplx_stride_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_cmplx_stride_q8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_i32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_i32, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_i16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_i16, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_i8(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_i8, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_f32, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_q32(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_q32, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_q16, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_q8(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_q8, __VA_ARGS__)
+#define plp_mat_mult_trans_cmplx_stride_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_mult_trans_cmplx_stride_q8_parallel, __VA_ARGS__)
+#define plp_mat_add_stride_i32(...) PLP_PROFILE_VOID(plp_mat_add_stride_i32, __VA_ARGS__)
+#define plp_mat_add_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_add_stride_i16(...) PLP_PROFILE_VOID(plp_mat_add_stride_i16, __VA_ARGS__)
+#define plp_mat_add_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_add_stride_i8(...) PLP_PROFILE_VOID(plp_mat_add_stride_i8, __VA_ARGS__)
+#define plp_mat_add_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_add_stride_f32(...) PLP_PROFILE_VOID(plp_mat_add_stride_f32, __VA_ARGS__)
+#define plp_mat_add_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_add_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_sub_stride_i32(...) PLP_PROFILE_VOID(plp_mat_sub_stride_i32, __VA_ARGS__)
+#define plp_mat_sub_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_sub_stride_i16(...) PLP_PROFILE_VOID(plp_mat_sub_stride_i16, __VA_ARGS__)
+#define plp_mat_sub_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_sub_stride_i8(...) PLP_PROFILE_VOID(plp_mat_sub_stride_i8, __VA_ARGS__)
+#define plp_mat_sub_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_sub_stride_f32(...) PLP_PROFILE_VOID(plp_mat_sub_stride_f32, __VA_ARGS__)
+#define plp_mat_sub_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_sub_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_scale_stride_i32(...) PLP_PROFILE_VOID(plp_mat_scale_stride_i32, __VA_ARGS__)
+#define plp_mat_scale_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_scale_stride_i16(...) PLP_PROFILE_VOID(plp_mat_scale_stride_i16, __VA_ARGS__)
+#define plp_mat_scale_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_scale_stride_i8(...) PLP_PROFILE_VOID(plp_mat_scale_stride_i8, __VA_ARGS__)
+#define plp_mat_scale_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_scale_stride_f32(...) PLP_PROFILE_VOID(plp_mat_scale_stride_f32, __VA_ARGS__)
+#define plp_mat_scale_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_scale_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_i32(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_i32, __VA_ARGS__)
+#define plp_mat_fill_I_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_i16(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_i16, __VA_ARGS__)
+#define plp_mat_fill_I_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_i8(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_i8, __VA_ARGS__)
+#define plp_mat_fill_I_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_f32(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_f32, __VA_ARGS__)
+#define plp_mat_fill_I_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_q32(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_q32, __VA_ARGS__)
+#define plp_mat_fill_I_stride_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_q16(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_q16, __VA_ARGS__)
+#define plp_mat_fill_I_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_fill_I_stride_q8(...) PLP_PROFILE_VOID(plp_mat_fill_I_stride_q8, __VA_ARGS__)
+#define plp_mat_fill_I_stride_q8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_I_stride_q8_parallel, __VA_ARGS__)
+#define plp_mat_fill_stride_i32(...) PLP_PROFILE_VOID(plp_mat_fill_stride_i32, __VA_ARGS__)
+#define plp_mat_fill_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_fill_stride_i16(...) PLP_PROFILE_VOID(plp_mat_fill_stride_i16, __VA_ARGS__)
+#define plp_mat_fill_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_fill_stride_i8(...) PLP_PROFILE_VOID(plp_mat_fill_stride_i8, __VA_ARGS__)
+#define plp_mat_fill_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_fill_stride_f32(...) PLP_PROFILE_VOID(plp_mat_fill_stride_f32, __VA_ARGS__)
+#define plp_mat_fill_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_fill_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_copy_stride_i32(...) PLP_PROFILE_VOID(plp_mat_copy_stride_i32, __VA_ARGS__)
+#define plp_mat_copy_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_copy_stride_i16(...) PLP_PROFILE_VOID(plp_mat_copy_stride_i16, __VA_ARGS__)
+#define plp_mat_copy_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_copy_stride_i8(...) PLP_PROFILE_VOID(plp_mat_copy_stride_i8, __VA_ARGS__)
+#define plp_mat_copy_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_copy_stride_f32(...) PLP_PROFILE_VOID(plp_mat_copy_stride_f32, __VA_ARGS__)
+#define plp_mat_copy_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_copy_stride_i8_dma_async(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_i8_dma_async, __VA_ARGS__)
+#define plp_mat_copy_stride_i8_dma(...) PLP_PROFILE_VOID(plp_mat_copy_stride_i8_dma, __VA_ARGS__)
+#define plp_mat_fill_stride_i8_dma(...) PLP_PROFILE_VOID(plp_mat_fill_stride_i8_dma, __VA_ARGS__)
+#define plp_mat_copy_stride_i16_dma_async(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_i16_dma_async, __VA_ARGS__)
+#define plp_mat_copy_stride_i16_dma(...) PLP_PROFILE_VOID(plp_mat_copy_stride_i16_dma, __VA_ARGS__)
+#define plp_mat_fill_stride_i16_dma(...) PLP_PROFILE_VOID(plp_mat_fill_stride_i16_dma, __VA_ARGS__)
+#define plp_mat_copy_stride_i32_dma_async(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_i32_dma_async, __VA_ARGS__)
+#define plp_mat_copy_stride_i32_dma(...) PLP_PROFILE_VOID(plp_mat_copy_stride_i32_dma, __VA_ARGS__)
+#define plp_mat_fill_stride_i32_dma(...) PLP_PROFILE_VOID(plp_mat_fill_stride_i32_dma, __VA_ARGS__)
+#define plp_mat_copy_stride_f32_dma_async(...) \
+    PLP_PROFILE_VOID(plp_mat_copy_stride_f32_dma_async, __VA_ARGS__)
+#define plp_mat_copy_stride_f32_dma(...) PLP_PROFILE_VOID(plp_mat_copy_stride_f32_dma, __VA_ARGS__)
+#define plp_mat_fill_stride_f32_dma(...) PLP_PROFILE_VOID(plp_mat_fill_stride_f32_dma, __VA_ARGS__)
+#define plp_mat_trans_stride_i32(...) PLP_PROFILE_VOID(plp_mat_trans_stride_i32, __VA_ARGS__)
+#define plp_mat_trans_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_trans_stride_i16(...) PLP_PROFILE_VOID(plp_mat_trans_stride_i16, __VA_ARGS__)
+#define plp_mat_trans_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_trans_stride_i8(...) PLP_PROFILE_VOID(plp_mat_trans_stride_i8, __VA_ARGS__)
+#define plp_mat_trans_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_trans_stride_f32(...) PLP_PROFILE_VOID(plp_mat_trans_stride_f32, __VA_ARGS__)
+#define plp_mat_trans_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_i16(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_i16, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_q16, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_i32(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_i32, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_f32, __VA_ARGS__)
+#define plp_mat_trans_cmplx_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_trans_cmplx_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_stride_i16(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_i16, __VA_ARGS__)
+#define plp_mat_hermitian_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_stride_q16(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_q16, __VA_ARGS__)
+#define plp_mat_hermitian_stride_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_q16_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_stride_i32(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_i32, __VA_ARGS__)
+#define plp_mat_hermitian_stride_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_i32_parallel, __VA_ARGS__)
+#define plp_mat_hermitian_stride_f32(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_f32, __VA_ARGS__)
+#define plp_mat_hermitian_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_hermitian_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_cholesky_stride_f32(...) PLP_PROFILE_RET(plp_mat_cholesky_stride_f32, __VA_ARGS__)
+#define plp_mat_cholesky_stride_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_cholesky_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_cholesky_stride_q32(...) PLP_PROFILE_RET(plp_mat_cholesky_stride_q32, __VA_ARGS__)
+#define plp_mat_cholesky_stride_q32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_cholesky_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_stride_f32(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_lower_stride_f32, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_stride_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_lower_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_stride_q32(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_lower_stride_q32, __VA_ARGS__)
+#define plp_mat_solve_tri_lower_stride_q32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_lower_stride_q32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_stride_f32(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_upper_stride_f32, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_stride_f32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_upper_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_stride_q32(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_upper_stride_q32, __VA_ARGS__)
+#define plp_mat_solve_tri_upper_stride_q32_parallel(...) \
+    PLP_PROFILE_RET(plp_mat_solve_tri_upper_stride_q32_parallel, __VA_ARGS__)
+#define plp_gemm_f32(...) PLP_PROFILE_VOID(plp_gemm_f32, __VA_ARGS__)
+#define plp_gemm_f32_parallel(...) PLP_PROFILE_VOID(plp_gemm_f32_parallel, __VA_ARGS__)
+#define plp_gemm_cmplx_f32(...) PLP_PROFILE_VOID(plp_gemm_cmplx_f32, __VA_ARGS__)
+#define plp_gemm_cmplx_f32_parallel(...) PLP_PROFILE_VOID(plp_gemm_cmplx_f32_parallel, __VA_ARGS__)
+#define plp_mat_norm_fro_stride_f32(...) PLP_PROFILE_VOID(plp_mat_norm_fro_stride_f32, __VA_ARGS__)
+#define plp_mat_norm_fro_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_fro_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_norm_fro_stride_i16(...) PLP_PROFILE_VOID(plp_mat_norm_fro_stride_i16, __VA_ARGS__)
+#define plp_mat_norm_fro_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_fro_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_norm_fro_stride_i8(...) PLP_PROFILE_VOID(plp_mat_norm_fro_stride_i8, __VA_ARGS__)
+#define plp_mat_norm_fro_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_fro_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_norm_inf_stride_f32(...) PLP_PROFILE_VOID(plp_mat_norm_inf_stride_f32, __VA_ARGS__)
+#define plp_mat_norm_inf_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_inf_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_norm_inf_stride_i16(...) PLP_PROFILE_VOID(plp_mat_norm_inf_stride_i16, __VA_ARGS__)
+#define plp_mat_norm_inf_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_inf_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_norm_inf_stride_i8(...) PLP_PROFILE_VOID(plp_mat_norm_inf_stride_i8, __VA_ARGS__)
+#define plp_mat_norm_inf_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_inf_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_norm_one_stride_f32(...) PLP_PROFILE_VOID(plp_mat_norm_one_stride_f32, __VA_ARGS__)
+#define plp_mat_norm_one_stride_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_one_stride_f32_parallel, __VA_ARGS__)
+#define plp_mat_norm_one_stride_i16(...) PLP_PROFILE_VOID(plp_mat_norm_one_stride_i16, __VA_ARGS__)
+#define plp_mat_norm_one_stride_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_one_stride_i16_parallel, __VA_ARGS__)
+#define plp_mat_norm_one_stride_i8(...) PLP_PROFILE_VOID(plp_mat_norm_one_stride_i8, __VA_ARGS__)
+#define plp_mat_norm_one_stride_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_mat_norm_one_stride_i8_parallel, __VA_ARGS__)
+#define plp_mat_trace_stride_f32(...) PLP_PROFILE_VOID(plp_mat_trace_stride_f32, __VA_ARGS__)
+#define plp_mat_trace_stride_i16(...) PLP_PROFILE_VOID(plp_mat_trace_stride_i16, __VA_ARGS__)
+#define plp_mat_trace_stride_i8(...) PLP_PROFILE_VOID(plp_mat_trace_stride_i8, __VA_ARGS__)
+#define plp_cfft_q16(...) PLP_PROFILE_VOID(plp_cfft_q16, __VA_ARGS__)
+#define plp_cfft_bfp_q16(...) PLP_PROFILE_RET(plp_cfft_bfp_q16, __VA_ARGS__)
+#define plp_cfft_q16_parallel(...) PLP_PROFILE_VOID(plp_cfft_q16_parallel, __VA_ARGS__)
+#define plp_cfft_q16_batch(...) PLP_PROFILE_VOID(plp_cfft_q16_batch, __VA_ARGS__)
+#define plp_cfft_q16_batch_multi(...) PLP_PROFILE_VOID(plp_cfft_q16_batch_multi, __VA_ARGS__)
+#define plp_cfft_f32(...) PLP_PROFILE_VOID(plp_cfft_f32, __VA_ARGS__)
+#define plp_cfft_f32_parallel(...) PLP_PROFILE_VOID(plp_cfft_f32_parallel, __VA_ARGS__)
+#define plp_analytic_f32(...) PLP_PROFILE_VOID(plp_analytic_f32, __VA_ARGS__)
+#define plp_fft2d_q16(...) PLP_PROFILE_VOID(plp_fft2d_q16, __VA_ARGS__)
+#define plp_fft2d_f32(...) PLP_PROFILE_VOID(plp_fft2d_f32, __VA_ARGS__)
+#define plp_cfft_mr_init_q16(...) PLP_PROFILE_RET(plp_cfft_mr_init_q16, __VA_ARGS__)
+#define plp_cfft_mr_q16(...) PLP_PROFILE_VOID(plp_cfft_mr_q16, __VA_ARGS__)
+#define plp_cfft_mr_init_f32(...) PLP_PROFILE_RET(plp_cfft_mr_init_f32, __VA_ARGS__)
+#define plp_cfft_mr_f32(...) PLP_PROFILE_VOID(plp_cfft_mr_f32, __VA_ARGS__)
+#define plp_czt_init_f32(...) PLP_PROFILE_RET(plp_czt_init_f32, __VA_ARGS__)
+#define plp_czt_f32(...) PLP_PROFILE_VOID(plp_czt_f32, __VA_ARGS__)
+#define plp_zoom_fft_init_f32(...) PLP_PROFILE_VOID(plp_zoom_fft_init_f32, __VA_ARGS__)
+#define plp_zoom_fft_f32(...) PLP_PROFILE_VOID(plp_zoom_fft_f32, __VA_ARGS__)
+#define plp_rfft_init_f32(...) PLP_PROFILE_VOID(plp_rfft_init_f32, __VA_ARGS__)
+#define plp_rfft_f32(...) PLP_PROFILE_VOID(plp_rfft_f32, __VA_ARGS__)
+#define plp_rfft_f32_parallel(...) PLP_PROFILE_VOID(plp_rfft_f32_parallel, __VA_ARGS__)
+#define plp_irfft_f32(...) PLP_PROFILE_VOID(plp_irfft_f32, __VA_ARGS__)
+#define plp_irfft_f32_parallel(...) PLP_PROFILE_VOID(plp_irfft_f32_parallel, __VA_ARGS__)
+#define plp_rfft_f32_batch(...) PLP_PROFILE_VOID(plp_rfft_f32_batch, __VA_ARGS__)
+#define plp_rfft_f32_batch_multi(...) PLP_PROFILE_VOID(plp_rfft_f32_batch_multi, __VA_ARGS__)
+#define plp_rfft_f32_xpulpv2_parallel(...) \
+    PLP_PROFILE_VOID(plp_rfft_f32_xpulpv2_parallel, __VA_ARGS__)
+#define plp_irfft_f32_xpulpv2_parallel(...) \
+    PLP_PROFILE_VOID(plp_irfft_f32_xpulpv2_parallel, __VA_ARGS__)
+#define plp_rfft_init_q16(...) PLP_PROFILE_VOID(plp_rfft_init_q16, __VA_ARGS__)
+#define plp_rfft_q16(...) PLP_PROFILE_VOID(plp_rfft_q16, __VA_ARGS__)
+#define plp_rfft_init_q32(...) PLP_PROFILE_VOID(plp_rfft_init_q32, __VA_ARGS__)
+#define plp_rfft_q32(...) PLP_PROFILE_VOID(plp_rfft_q32, __VA_ARGS__)
+#define plp_cfft_init_q32(...) PLP_PROFILE_VOID(plp_cfft_init_q32, __VA_ARGS__)
+#define plp_cfft_q32(...) PLP_PROFILE_RET(plp_cfft_q32, __VA_ARGS__)
+#define plp_stft_init_f32(...) PLP_PROFILE_VOID(plp_stft_init_f32, __VA_ARGS__)
+#define plp_stft_f32(...) PLP_PROFILE_VOID(plp_stft_f32, __VA_ARGS__)
+#define plp_stft_frame_f32(...) PLP_PROFILE_VOID(plp_stft_frame_f32, __VA_ARGS__)
+#define plp_stft_init_q16(...) PLP_PROFILE_VOID(plp_stft_init_q16, __VA_ARGS__)
+#define plp_stft_q16(...) PLP_PROFILE_VOID(plp_stft_q16, __VA_ARGS__)
+#define plp_stft_frame_q16(...) PLP_PROFILE_VOID(plp_stft_frame_q16, __VA_ARGS__)
+#define plp_window_init_q16(...) PLP_PROFILE_VOID(plp_window_init_q16, __VA_ARGS__)
+#define plp_window_apply_q16(...) PLP_PROFILE_VOID(plp_window_apply_q16, __VA_ARGS__)
+#define plp_window_init_f32(...) PLP_PROFILE_VOID(plp_window_init_f32, __VA_ARGS__)
+#define plp_window_apply_f32(...) PLP_PROFILE_VOID(plp_window_apply_f32, __VA_ARGS__)
+#define plp_psd_welch_init_q16(...) PLP_PROFILE_VOID(plp_psd_welch_init_q16, __VA_ARGS__)
+#define plp_psd_welch_q16(...) PLP_PROFILE_VOID(plp_psd_welch_q16, __VA_ARGS__)
+#define plp_psd_welch_q16_parallel(...) PLP_PROFILE_VOID(plp_psd_welch_q16_parallel, __VA_ARGS__)
+#define plp_psd_welch_init_f32(...) PLP_PROFILE_VOID(plp_psd_welch_init_f32, __VA_ARGS__)
+#define plp_psd_welch_f32(...) PLP_PROFILE_VOID(plp_psd_welch_f32, __VA_ARGS__)
+#define plp_psd_welch_f32_parallel(...) PLP_PROFILE_VOID(plp_psd_welch_f32_parallel, __VA_ARGS__)
+#define plp_mel_filterbank_init_f32(...) PLP_PROFILE_VOID(plp_mel_filterbank_init_f32, __VA_ARGS__)
+#define plp_mel_filterbank_f32(...) PLP_PROFILE_VOID(plp_mel_filterbank_f32, __VA_ARGS__)
+#define plp_mel_filterbank_init_q16(...) PLP_PROFILE_VOID(plp_mel_filterbank_init_q16, __VA_ARGS__)
+#define plp_mel_filterbank_q16(...) PLP_PROFILE_VOID(plp_mel_filterbank_q16, __VA_ARGS__)
+#define plp_mfcc_init_f32(...) PLP_PROFILE_VOID(plp_mfcc_init_f32, __VA_ARGS__)
+#define plp_mfcc_f32(...) PLP_PROFILE_VOID(plp_mfcc_f32, __VA_ARGS__)
+#define plp_mfcc_init_q16(...) PLP_PROFILE_VOID(plp_mfcc_init_q16, __VA_ARGS__)
+#define plp_mfcc_q16(...) PLP_PROFILE_VOID(plp_mfcc_q16, __VA_ARGS__)
+#define plp_dct2_init_f32(...) PLP_PROFILE_VOID(plp_dct2_init_f32, __VA_ARGS__)
+#define plp_dct2_f32(...) PLP_PROFILE_VOID(plp_dct2_f32, __VA_ARGS__)
+#define plp_dct4_init_q16(...) PLP_PROFILE_VOID(plp_dct4_init_q16, __VA_ARGS__)
+#define plp_dct4_q16(...) PLP_PROFILE_VOID(plp_dct4_q16, __VA_ARGS__)
+#define plp_goertzel_init_q16(...) PLP_PROFILE_VOID(plp_goertzel_init_q16, __VA_ARGS__)
+#define plp_goertzel_q16(...) PLP_PROFILE_VOID(plp_goertzel_q16, __VA_ARGS__)
+#define plp_goertzel_init_f32(...) PLP_PROFILE_VOID(plp_goertzel_init_f32, __VA_ARGS__)
+#define plp_goertzel_f32(...) PLP_PROFILE_VOID(plp_goertzel_f32, __VA_ARGS__)
+#define plp_sdft_init_q16(...) PLP_PROFILE_VOID(plp_sdft_init_q16, __VA_ARGS__)
+#define plp_sdft_q16(...) PLP_PROFILE_VOID(plp_sdft_q16, __VA_ARGS__)
+#define plp_sdft_init_f32(...) PLP_PROFILE_VOID(plp_sdft_init_f32, __VA_ARGS__)
+#define plp_sdft_f32(...) PLP_PROFILE_VOID(plp_sdft_f32, __VA_ARGS__)
+#define plp_correlate_i32(...) PLP_PROFILE_VOID(plp_correlate_i32, __VA_ARGS__)
+#define plp_correlate_i16(...) PLP_PROFILE_VOID(plp_correlate_i16, __VA_ARGS__)
+#define plp_correlate_i8(...) PLP_PROFILE_VOID(plp_correlate_i8, __VA_ARGS__)
+#define plp_correlate_valid_i8(...) PLP_PROFILE_VOID(plp_correlate_valid_i8, __VA_ARGS__)
+#define plp_correlate_i32_parallel(...) PLP_PROFILE_VOID(plp_correlate_i32_parallel, __VA_ARGS__)
+#define plp_correlate_i16_parallel(...) PLP_PROFILE_VOID(plp_correlate_i16_parallel, __VA_ARGS__)
+#define plp_correlate_i8_parallel(...) PLP_PROFILE_VOID(plp_correlate_i8_parallel, __VA_ARGS__)
+#define plp_correlate_q32_parallel(...) PLP_PROFILE_VOID(plp_correlate_q32_parallel, __VA_ARGS__)
+#define plp_correlate_q16_parallel(...) PLP_PROFILE_VOID(plp_correlate_q16_parallel, __VA_ARGS__)
+#define plp_correlate_q8_parallel(...) PLP_PROFILE_VOID(plp_correlate_q8_parallel, __VA_ARGS__)
+#define plp_autocorr_q16(...) PLP_PROFILE_VOID(plp_autocorr_q16, __VA_ARGS__)
+#define plp_autocorr_q32(...) PLP_PROFILE_VOID(plp_autocorr_q32, __VA_ARGS__)
+#define plp_autocorr_f32(...) PLP_PROFILE_VOID(plp_autocorr_f32, __VA_ARGS__)
+#define plp_levinson_durbin_q32(...) PLP_PROFILE_RET(plp_levinson_durbin_q32, __VA_ARGS__)
+#define plp_levinson_durbin_f32(...) PLP_PROFILE_RET(plp_levinson_durbin_f32, __VA_ARGS__)
+#define plp_ncc_i16(...) PLP_PROFILE_VOID(plp_ncc_i16, __VA_ARGS__)
+#define plp_ncc_i16_parallel(...) PLP_PROFILE_VOID(plp_ncc_i16_parallel, __VA_ARGS__)
+#define plp_ncc_f32(...) PLP_PROFILE_VOID(plp_ncc_f32, __VA_ARGS__)
+#define plp_ncc_f32_parallel(...) PLP_PROFILE_VOID(plp_ncc_f32_parallel, __VA_ARGS__)
+#define plp_conv_i32(...) PLP_PROFILE_VOID(plp_conv_i32, __VA_ARGS__)
+#define plp_conv_valid_i32(...) PLP_PROFILE_VOID(plp_conv_valid_i32, __VA_ARGS__)
+#define plp_conv_i16(...) PLP_PROFILE_VOID(plp_conv_i16, __VA_ARGS__)
+#define plp_conv_valid_i16(...) PLP_PROFILE_VOID(plp_conv_valid_i16, __VA_ARGS__)
+#define plp_conv_valid_rep_i16(...) PLP_PROFILE_VOID(plp_conv_valid_rep_i16, __VA_ARGS__)
+#define plp_conv_valid_rep_bank_i16(...) PLP_PROFILE_VOID(plp_conv_valid_rep_bank_i16, __VA_ARGS__)
+#define plp_conv_i8(...) PLP_PROFILE_VOID(plp_conv_i8, __VA_ARGS__)
+#define plp_conv_valid_i8(...) PLP_PROFILE_VOID(plp_conv_valid_i8, __VA_ARGS__)
+#define plp_conv_valid_rep_i8(...) PLP_PROFILE_VOID(plp_conv_valid_rep_i8, __VA_ARGS__)
+#define plp_conv_valid_rep_bank_i8(...) PLP_PROFILE_VOID(plp_conv_valid_rep_bank_i8, __VA_ARGS__)
+#define plp_conv2d_i16(...) PLP_PROFILE_VOID(plp_conv2d_i16, __VA_ARGS__)
+#define plp_conv2d_i16_parallel(...) PLP_PROFILE_VOID(plp_conv2d_i16_parallel, __VA_ARGS__)
+#define plp_conv2d_i8(...) PLP_PROFILE_VOID(plp_conv2d_i8, __VA_ARGS__)
+#define plp_conv2d_i8_parallel(...) PLP_PROFILE_VOID(plp_conv2d_i8_parallel, __VA_ARGS__)
+#define plp_conv_winograd_init_i16(...) PLP_PROFILE_VOID(plp_conv_winograd_init_i16, __VA_ARGS__)
+#define plp_conv_valid_winograd_i16(...) PLP_PROFILE_VOID(plp_conv_valid_winograd_i16, __VA_ARGS__)
+#define plp_conv_valid_winograd_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_conv_valid_winograd_i16_parallel, __VA_ARGS__)
+#define plp_conv_winograd_init_f32(...) PLP_PROFILE_VOID(plp_conv_winograd_init_f32, __VA_ARGS__)
+#define plp_conv_valid_winograd_f32(...) PLP_PROFILE_VOID(plp_conv_valid_winograd_f32, __VA_ARGS__)
+#define plp_conv_valid_winograd_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_conv_valid_winograd_f32_parallel, __VA_ARGS__)
+#define plp_conv_i32_parallel(...) PLP_PROFILE_VOID(plp_conv_i32_parallel, __VA_ARGS__)
+#define plp_conv_i16_parallel(...) PLP_PROFILE_VOID(plp_conv_i16_parallel, __VA_ARGS__)
+#define plp_conv_i8_parallel(...) PLP_PROFILE_VOID(plp_conv_i8_parallel, __VA_ARGS__)
+#define plp_conv_parallel_OLA(...) PLP_PROFILE_VOID(plp_conv_parallel_OLA, __VA_ARGS__)
+#define plp_conv_parallel_OLA_kernel(...) \
+    PLP_PROFILE_VOID(plp_conv_parallel_OLA_kernel, __VA_ARGS__)
+#define plp_conv_parallel_range(...) PLP_PROFILE_VOID(plp_conv_parallel_range, __VA_ARGS__)
+#define plp_conv_fft_q16(...) PLP_PROFILE_RET(plp_conv_fft_q16, __VA_ARGS__)
+#define plp_conv_fft_f32(...) PLP_PROFILE_RET(plp_conv_fft_f32, __VA_ARGS__)
+#define plp_conv_fft_OLA_q16(...) PLP_PROFILE_VOID(plp_conv_fft_OLA_q16, __VA_ARGS__)
+#define plp_conv_fft_OLA_f32(...) PLP_PROFILE_VOID(plp_conv_fft_OLA_f32, __VA_ARGS__)
+#define plp_fir_init_q32(...) PLP_PROFILE_VOID(plp_fir_init_q32, __VA_ARGS__)
+#define plp_fir_q32(...) PLP_PROFILE_VOID(plp_fir_q32, __VA_ARGS__)
+#define plp_fir_q32_parallel(...) PLP_PROFILE_VOID(plp_fir_q32_parallel, __VA_ARGS__)
+#define plp_fir_init_q16(...) PLP_PROFILE_VOID(plp_fir_init_q16, __VA_ARGS__)
+#define plp_fir_q16(...) PLP_PROFILE_VOID(plp_fir_q16, __VA_ARGS__)
+#define plp_fir_q16_parallel(...) PLP_PROFILE_VOID(plp_fir_q16_parallel, __VA_ARGS__)
+#define plp_fir_init_q8(...) PLP_PROFILE_VOID(plp_fir_init_q8, __VA_ARGS__)
+#define plp_fir_q8(...) PLP_PROFILE_VOID(plp_fir_q8, __VA_ARGS__)
+#define plp_fir_q8_parallel(...) PLP_PROFILE_VOID(plp_fir_q8_parallel, __VA_ARGS__)
+#define plp_fir_init_f32(...) PLP_PROFILE_VOID(plp_fir_init_f32, __VA_ARGS__)
+#define plp_fir_f32(...) PLP_PROFILE_VOID(plp_fir_f32, __VA_ARGS__)
+#define plp_fir_f32_parallel(...) PLP_PROFILE_VOID(plp_fir_f32_parallel, __VA_ARGS__)
+#define plp_biquad_cascade_df1_init_q32(...) \
+    PLP_PROFILE_VOID(plp_biquad_cascade_df1_init_q32, __VA_ARGS__)
+#define plp_biquad_cascade_df1_q32(...) PLP_PROFILE_VOID(plp_biquad_cascade_df1_q32, __VA_ARGS__)
+#define plp_biquad_cascade_df1_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_biquad_cascade_df1_q32_parallel, __VA_ARGS__)
+#define plp_biquad_cascade_df1_init_q16(...) \
+    PLP_PROFILE_VOID(plp_biquad_cascade_df1_init_q16, __VA_ARGS__)
+#define plp_biquad_cascade_df1_q16(...) PLP_PROFILE_VOID(plp_biquad_cascade_df1_q16, __VA_ARGS__)
+#define plp_biquad_cascade_df1_q16_parallel(...) \
+    PLP_PROFILE_VOID(plp_biquad_cascade_df1_q16_parallel, __VA_ARGS__)
+#define plp_biquad_cascade_df2T_init_f32(...) \
+    PLP_PROFILE_VOID(plp_biquad_cascade_df2T_init_f32, __VA_ARGS__)
+#define plp_biquad_cascade_df2T_f32(...) PLP_PROFILE_VOID(plp_biquad_cascade_df2T_f32, __VA_ARGS__)
+#define plp_biquad_cascade_df2T_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_biquad_cascade_df2T_f32_parallel, __VA_ARGS__)
+#define plp_fir_decimate_init_q32(...) PLP_PROFILE_VOID(plp_fir_decimate_init_q32, __VA_ARGS__)
+#define plp_fir_decimate_q32(...) PLP_PROFILE_VOID(plp_fir_decimate_q32, __VA_ARGS__)
+#define plp_fir_decimate_init_q16(...) PLP_PROFILE_VOID(plp_fir_decimate_init_q16, __VA_ARGS__)
+#define plp_fir_decimate_q16(...) PLP_PROFILE_VOID(plp_fir_decimate_q16, __VA_ARGS__)
+#define plp_fir_decimate_init_f32(...) PLP_PROFILE_VOID(plp_fir_decimate_init_f32, __VA_ARGS__)
+#define plp_fir_decimate_f32(...) PLP_PROFILE_VOID(plp_fir_decimate_f32, __VA_ARGS__)
+#define plp_fir_interpolate_init_q32(...) \
+    PLP_PROFILE_VOID(plp_fir_interpolate_init_q32, __VA_ARGS__)
+#define plp_fir_interpolate_q32(...) PLP_PROFILE_VOID(plp_fir_interpolate_q32, __VA_ARGS__)
+#define plp_fir_interpolate_init_q16(...) \
+    PLP_PROFILE_VOID(plp_fir_interpolate_init_q16, __VA_ARGS__)
+#define plp_fir_interpolate_q16(...) PLP_PROFILE_VOID(plp_fir_interpolate_q16, __VA_ARGS__)
+#define plp_fir_interpolate_init_f32(...) \
+    PLP_PROFILE_VOID(plp_fir_interpolate_init_f32, __VA_ARGS__)
+#define plp_fir_interpolate_f32(...) PLP_PROFILE_VOID(plp_fir_interpolate_f32, __VA_ARGS__)
+#define plp_resample_init_q16(...) PLP_PROFILE_VOID(plp_resample_init_q16, __VA_ARGS__)
+#define plp_resample_q16(...) PLP_PROFILE_RET(plp_resample_q16, __VA_ARGS__)
+#define plp_resample_init_f32(...) PLP_PROFILE_VOID(plp_resample_init_f32, __VA_ARGS__)
+#define plp_resample_f32(...) PLP_PROFILE_RET(plp_resample_f32, __VA_ARGS__)
+#define plp_hilbert_fir_init_q16(...) PLP_PROFILE_VOID(plp_hilbert_fir_init_q16, __VA_ARGS__)
+#define plp_hilbert_fir_q16(...) PLP_PROFILE_VOID(plp_hilbert_fir_q16, __VA_ARGS__)
+#define plp_nco_init_q16(...) PLP_PROFILE_VOID(plp_nco_init_q16, __VA_ARGS__)
+#define plp_nco_mix_q16(...) PLP_PROFILE_VOID(plp_nco_mix_q16, __VA_ARGS__)
+#define plp_ddc_init_q16(...) PLP_PROFILE_VOID(plp_ddc_init_q16, __VA_ARGS__)
+#define plp_ddc_q16(...) PLP_PROFILE_VOID(plp_ddc_q16, __VA_ARGS__)
+#define plp_cic_decimate_init_i32(...) PLP_PROFILE_VOID(plp_cic_decimate_init_i32, __VA_ARGS__)
+#define plp_cic_decimate_i32(...) PLP_PROFILE_VOID(plp_cic_decimate_i32, __VA_ARGS__)
+#define plp_cic_decimate_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cic_decimate_i32_parallel, __VA_ARGS__)
+#define plp_cic_decimate_init_q32(...) PLP_PROFILE_VOID(plp_cic_decimate_init_q32, __VA_ARGS__)
+#define plp_cic_decimate_q32(...) PLP_PROFILE_VOID(plp_cic_decimate_q32, __VA_ARGS__)
+#define plp_cic_decimate_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cic_decimate_q32_parallel, __VA_ARGS__)
+#define plp_cic_interpolate_init_i32(...) \
+    PLP_PROFILE_VOID(plp_cic_interpolate_init_i32, __VA_ARGS__)
+#define plp_cic_interpolate_i32(...) PLP_PROFILE_VOID(plp_cic_interpolate_i32, __VA_ARGS__)
+#define plp_cic_interpolate_i32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cic_interpolate_i32_parallel, __VA_ARGS__)
+#define plp_cic_interpolate_init_q32(...) \
+    PLP_PROFILE_VOID(plp_cic_interpolate_init_q32, __VA_ARGS__)
+#define plp_cic_interpolate_q32(...) PLP_PROFILE_VOID(plp_cic_interpolate_q32, __VA_ARGS__)
+#define plp_cic_interpolate_q32_parallel(...) \
+    PLP_PROFILE_VOID(plp_cic_interpolate_q32_parallel, __VA_ARGS__)
+#define plp_lms_init_q16(...) PLP_PROFILE_VOID(plp_lms_init_q16, __VA_ARGS__)
+#define plp_lms_q16(...) PLP_PROFILE_VOID(plp_lms_q16, __VA_ARGS__)
+#define plp_lms_init_f32(...) PLP_PROFILE_VOID(plp_lms_init_f32, __VA_ARGS__)
+#define plp_lms_f32(...) PLP_PROFILE_VOID(plp_lms_f32, __VA_ARGS__)
+#define plp_lms_norm_init_q16(...) PLP_PROFILE_VOID(plp_lms_norm_init_q16, __VA_ARGS__)
+#define plp_lms_norm_q16(...) PLP_PROFILE_VOID(plp_lms_norm_q16, __VA_ARGS__)
+#define plp_lms_norm_init_f32(...) PLP_PROFILE_VOID(plp_lms_norm_init_f32, __VA_ARGS__)
+#define plp_lms_norm_f32(...) PLP_PROFILE_VOID(plp_lms_norm_f32, __VA_ARGS__)
+#define plp_moving_avg_init_i16(...) PLP_PROFILE_VOID(plp_moving_avg_init_i16, __VA_ARGS__)
+#define plp_moving_avg_i16(...) PLP_PROFILE_VOID(plp_moving_avg_i16, __VA_ARGS__)
+#define plp_moving_avg_init_f32(...) PLP_PROFILE_VOID(plp_moving_avg_init_f32, __VA_ARGS__)
+#define plp_moving_avg_f32(...) PLP_PROFILE_VOID(plp_moving_avg_f32, __VA_ARGS__)
+#define plp_median_filter_i16(...) PLP_PROFILE_VOID(plp_median_filter_i16, __VA_ARGS__)
+#define plp_median_filter_i16_parallel(...) \
+    PLP_PROFILE_VOID(plp_median_filter_i16_parallel, __VA_ARGS__)
+#define plp_median_filter_f32(...) PLP_PROFILE_VOID(plp_median_filter_f32, __VA_ARGS__)
+#define plp_median_filter_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_median_filter_f32_parallel, __VA_ARGS__)
+#define plp_requantize_i32_i8(...) PLP_PROFILE_VOID(plp_requantize_i32_i8, __VA_ARGS__)
+#define plp_requantize_i32_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_requantize_i32_i8_parallel, __VA_ARGS__)
+#define plp_im2col_i8(...) PLP_PROFILE_VOID(plp_im2col_i8, __VA_ARGS__)
+#define plp_im2col_i8_parallel(...) PLP_PROFILE_VOID(plp_im2col_i8_parallel, __VA_ARGS__)
+#define plp_conv_depthwise_i8(...) PLP_PROFILE_VOID(plp_conv_depthwise_i8, __VA_ARGS__)
+#define plp_conv_depthwise_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_conv_depthwise_i8_parallel, __VA_ARGS__)
+#define plp_conv1d_i8(...) PLP_PROFILE_VOID(plp_conv1d_i8, __VA_ARGS__)
+#define plp_conv1d_i8_parallel(...) PLP_PROFILE_VOID(plp_conv1d_i8_parallel, __VA_ARGS__)
+#define plp_conv1d_i4(...) PLP_PROFILE_VOID(plp_conv1d_i4, __VA_ARGS__)
+#define plp_conv1d_i2(...) PLP_PROFILE_VOID(plp_conv1d_i2, __VA_ARGS__)
+#define plp_conv1d_f32(...) PLP_PROFILE_VOID(plp_conv1d_f32, __VA_ARGS__)
+#define plp_conv1d_f32_parallel(...) PLP_PROFILE_VOID(plp_conv1d_f32_parallel, __VA_ARGS__)
+#define plp_lstm_cell_q16(...) PLP_PROFILE_VOID(plp_lstm_cell_q16, __VA_ARGS__)
+#define plp_lstm_cell_q16_parallel(...) PLP_PROFILE_VOID(plp_lstm_cell_q16_parallel, __VA_ARGS__)
+#define plp_lstm_cell_i8(...) PLP_PROFILE_VOID(plp_lstm_cell_i8, __VA_ARGS__)
+#define plp_lstm_cell_i8_parallel(...) PLP_PROFILE_VOID(plp_lstm_cell_i8_parallel, __VA_ARGS__)
+#define plp_gru_cell_q16(...) PLP_PROFILE_VOID(plp_gru_cell_q16, __VA_ARGS__)
+#define plp_gru_cell_q16_parallel(...) PLP_PROFILE_VOID(plp_gru_cell_q16_parallel, __VA_ARGS__)
+#define plp_gru_cell_i8(...) PLP_PROFILE_VOID(plp_gru_cell_i8, __VA_ARGS__)
+#define plp_gru_cell_i8_parallel(...) PLP_PROFILE_VOID(plp_gru_cell_i8_parallel, __VA_ARGS__)
+#define plp_maxpool_i8(...) PLP_PROFILE_VOID(plp_maxpool_i8, __VA_ARGS__)
+#define plp_maxpool_i8_parallel(...) PLP_PROFILE_VOID(plp_maxpool_i8_parallel, __VA_ARGS__)
+#define plp_avgpool_i8(...) PLP_PROFILE_VOID(plp_avgpool_i8, __VA_ARGS__)
+#define plp_avgpool_i8_parallel(...) PLP_PROFILE_VOID(plp_avgpool_i8_parallel, __VA_ARGS__)
+#define plp_softmax_f32(...) PLP_PROFILE_VOID(plp_softmax_f32, __VA_ARGS__)
+#define plp_softmax_f32_parallel(...) PLP_PROFILE_VOID(plp_softmax_f32_parallel, __VA_ARGS__)
+#define plp_softmax_q16(...) PLP_PROFILE_VOID(plp_softmax_q16, __VA_ARGS__)
+#define plp_softmax_q16_parallel(...) PLP_PROFILE_VOID(plp_softmax_q16_parallel, __VA_ARGS__)
+#define plp_layernorm_f32(...) PLP_PROFILE_VOID(plp_layernorm_f32, __VA_ARGS__)
+#define plp_layernorm_f32_parallel(...) PLP_PROFILE_VOID(plp_layernorm_f32_parallel, __VA_ARGS__)
+#define plp_layernorm_q16(...) PLP_PROFILE_VOID(plp_layernorm_q16, __VA_ARGS__)
+#define plp_layernorm_q16_parallel(...) PLP_PROFILE_VOID(plp_layernorm_q16_parallel, __VA_ARGS__)
+#define plp_quantize_f32_i8(...) PLP_PROFILE_VOID(plp_quantize_f32_i8, __VA_ARGS__)
+#define plp_quantize_f32_i8_parallel(...) \
+    PLP_PROFILE_VOID(plp_quantize_f32_i8_parallel, __VA_ARGS__)
+#define plp_dequantize_i32_f32(...) PLP_PROFILE_VOID(plp_dequantize_i32_f32, __VA_ARGS__)
+#define plp_dequantize_i32_f32_parallel(...) \
+    PLP_PROFILE_VOID(plp_dequantize_i32_f32_parallel, __VA_ARGS__)
+#define plp_pid_init_q32(...) PLP_PROFILE_VOID(plp_pid_init_q32, __VA_ARGS__)
+#define plp_pid_reset_q32(...) PLP_PROFILE_VOID(plp_pid_reset_q32, __VA_ARGS__)
+#define plp_clarke_park_q32_vec(...) PLP_PROFILE_VOID(plp_clarke_park_q32_vec, __VA_ARGS__)
+#define plp_park_clarke_inv_q32_vec(...) PLP_PROFILE_VOID(plp_park_clarke_inv_q32_vec, __VA_ARGS__)
+#define plp_pid_q32_vec(...) PLP_PROFILE_VOID(plp_pid_q32_vec, __VA_ARGS__)
+
+#endif // PLP_PROFILE
+
+#endif // __PLP_PROFILE_H__
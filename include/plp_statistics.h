@@ -0,0 +1,5748 @@
+/** ==========================================================================
+ * @file     plp_statistics.h
+ * @brief    Statistics functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_STATISTICS_H__
+#define __PLP_STATISTICS_H__
+
+#include "plp_math_common.h"
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_i32
+    @brief Instance structure for integer and fixed point parallel statistics.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  fracBits   decimal point for right shift (0 for integer vectors)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer, one element per core
+*/
+typedef struct {
+    const int32_t *pSrc;   // pointer to the input vector
+    uint32_t blockSize;    // number of samples in the input vector
+    uint32_t fracBits;     // decimal point for right shift
+    uint32_t nPE;          // number of processing units
+    int32_t *resBuffer;    // pointer to result buffer
+} plp_stats_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_i16
+    @brief Instance structure for integer and fixed point parallel statistics.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  fracBits   decimal point for right shift (0 for integer vectors)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer, one element per core
+*/
+typedef struct {
+    const int16_t *pSrc;   // pointer to the input vector
+    uint32_t blockSize;    // number of samples in the input vector
+    uint32_t fracBits;     // decimal point for right shift
+    uint32_t nPE;          // number of processing units
+    int32_t *resBuffer;    // pointer to result buffer
+} plp_stats_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_i8
+    @brief Instance structure for integer and fixed point parallel statistics.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  fracBits   decimal point for right shift (0 for integer vectors)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer, one element per core
+*/
+typedef struct {
+    const int8_t *pSrc;    // pointer to the input vector
+    uint32_t blockSize;    // number of samples in the input vector
+    uint32_t fracBits;     // decimal point for right shift
+    uint32_t nPE;          // number of processing units
+    int32_t *resBuffer;    // pointer to result buffer
+} plp_stats_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_f32
+    @brief Instance structure for floating point parallel statistics.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] resBuffer  pointer to the result buffer, one element per core
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    uint32_t blockSize;    // number of samples in the input vector
+    uint32_t nPE;          // number of processing units
+    float32_t *resBuffer;  // pointer to result buffer
+} plp_stats_instance_f32;
+
+/** Operations of the parallel statistics tree reduction */
+#define PLP_STATS_SUM 0
+#define PLP_STATS_MIN 1
+#define PLP_STATS_MAX 2
+
+/** -------------------------------------------------------
+    @struct plp_stats_summary_result_i32
+    @brief Result of the integer summary statistics (plp_stats_summary_i8, _i16 and _i32).
+    @param[out] mean    mean value, truncated towards zero
+    @param[out] var     variance
+    @param[out] min     minimum value
+    @param[out] max     maximum value
+    @param[out] argmin  index of the first occurrence of the minimum
+    @param[out] argmax  index of the first occurrence of the maximum
+*/
+typedef struct {
+    int32_t mean;    // mean value
+    int32_t var;     // variance
+    int32_t min;     // minimum value
+    int32_t max;     // maximum value
+    uint32_t argmin; // index of the minimum
+    uint32_t argmax; // index of the maximum
+} plp_stats_summary_result_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_summary_result_f32
+    @brief Result of the floating point summary statistics.
+    @param[out] mean    mean value
+    @param[out] var     variance
+    @param[out] min     minimum value
+    @param[out] max     maximum value
+    @param[out] argmin  index of the first occurrence of the minimum
+    @param[out] argmax  index of the first occurrence of the maximum
+*/
+typedef struct {
+    float32_t mean;  // mean value
+    float32_t var;   // variance
+    float32_t min;   // minimum value
+    float32_t max;   // maximum value
+    uint32_t argmin; // index of the minimum
+    uint32_t argmax; // index of the maximum
+} plp_stats_summary_result_f32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_partial_i32
+    @brief Partial integer summary of one core, used by the parallel summary statistics.
+*/
+typedef struct {
+    int32_t sum;     // sum of the samples
+    int32_t sumSq;   // sum of squares of the samples
+    int32_t min;     // minimum value
+    int32_t max;     // maximum value
+    uint32_t argmin; // index of the minimum
+    uint32_t argmax; // index of the maximum
+} plp_stats_partial_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_partial_f32
+    @brief Partial floating point summary of one core, used by the parallel summary statistics.
+*/
+typedef struct {
+    float32_t sum;   // sum of the samples
+    float32_t sumSq; // sum of squares of the samples
+    float32_t min;   // minimum value
+    float32_t max;   // maximum value
+    uint32_t argmin; // index of the minimum
+    uint32_t argmax; // index of the maximum
+} plp_stats_partial_f32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_summary_instance_i32
+    @brief Instance structure for the parallel summary statistics of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   partial summaries, one element per core
+*/
+typedef struct {
+    const int32_t *pSrc;            // pointer to the input vector
+    uint32_t blockSize;             // number of samples in the input vector
+    uint32_t nPE;                   // number of processing units
+    plp_stats_partial_i32 *pPartial;// partial results
+} plp_stats_summary_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_summary_instance_i16
+    @brief Instance structure for the parallel summary statistics of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   partial summaries, one element per core
+*/
+typedef struct {
+    const int16_t *pSrc;            // pointer to the input vector
+    uint32_t blockSize;             // number of samples in the input vector
+    uint32_t nPE;                   // number of processing units
+    plp_stats_partial_i32 *pPartial;// partial results
+} plp_stats_summary_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_stats_summary_instance_i8
+    @brief Instance structure for the parallel summary statistics of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   partial summaries, one element per core
+*/
+typedef struct {
+    const int8_t *pSrc;             // pointer to the input vector
+    uint32_t blockSize;             // number of samples in the input vector
+    uint32_t nPE;                   // number of processing units
+    plp_stats_partial_i32 *pPartial;// partial results
+} plp_stats_summary_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_stats_summary_instance_f32
+    @brief Instance structure for the parallel summary statistics of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   partial summaries, one element per core
+*/
+typedef struct {
+    const float32_t *pSrc;          // pointer to the input vector
+    uint32_t blockSize;             // number of samples in the input vector
+    uint32_t nPE;                   // number of processing units
+    plp_stats_partial_f32 *pPartial;// partial results
+} plp_stats_summary_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_idx_instance_i32
+    @brief Instance structure for the parallel minimum or maximum with index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pValue     minimum or maximum of each core
+    @param[out] pIndex     index of the minimum or maximum of each core
+*/
+typedef struct {
+    const int32_t *pSrc;     // pointer to the input vector
+    uint32_t blockSize;      // number of samples in the input vector
+    uint32_t nPE;            // number of processing units
+    int32_t *pValue;         // result value of each core
+    uint32_t *pIndex;        // result index of each core
+} plp_stats_idx_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_idx_instance_i16
+    @brief Instance structure for the parallel minimum or maximum with index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pValue     minimum or maximum of each core
+    @param[out] pIndex     index of the minimum or maximum of each core
+*/
+typedef struct {
+    const int16_t *pSrc;     // pointer to the input vector
+    uint32_t blockSize;      // number of samples in the input vector
+    uint32_t nPE;            // number of processing units
+    int32_t *pValue;         // result value of each core
+    uint32_t *pIndex;        // result index of each core
+} plp_stats_idx_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_stats_idx_instance_i8
+    @brief Instance structure for the parallel minimum or maximum with index of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pValue     minimum or maximum of each core
+    @param[out] pIndex     index of the minimum or maximum of each core
+*/
+typedef struct {
+    const int8_t *pSrc;      // pointer to the input vector
+    uint32_t blockSize;      // number of samples in the input vector
+    uint32_t nPE;            // number of processing units
+    int32_t *pValue;         // result value of each core
+    uint32_t *pIndex;        // result index of each core
+} plp_stats_idx_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_stats_idx_instance_f32
+    @brief Instance structure for the parallel minimum or maximum with index of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pValue     minimum or maximum of each core
+    @param[out] pIndex     index of the minimum or maximum of each core
+*/
+typedef struct {
+    const float32_t *pSrc;   // pointer to the input vector
+    uint32_t blockSize;      // number of samples in the input vector
+    uint32_t nPE;            // number of processing units
+    float32_t *pValue;       // result value of each core
+    uint32_t *pIndex;        // result index of each core
+} plp_stats_idx_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_running_stats_instance_f32
+    @brief State of the floating point running statistics (Welford's algorithm).
+    @param[in,out] count  number of samples seen so far
+    @param[in,out] mean   mean of all samples seen so far
+    @param[in,out] m2     sum of the squared differences to the mean
+*/
+typedef struct {
+    uint32_t count; // number of samples seen so far
+    float32_t mean; // running mean
+    float32_t m2;   // sum of squared differences to the mean
+} plp_running_stats_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_sliding_stats_instance_q16
+    @brief State of the 16-bit fixed point sliding window statistics.
+    @param[in,out] count     number of samples in the window
+    @param[in]     fracBits  decimal point of the samples
+    @param[in,out] sum       sum of the samples in the window
+    @param[in,out] sumSq     sum of squares of the samples in the window, shifted by fracBits
+*/
+typedef struct {
+    uint32_t count;    // number of samples in the window
+    uint32_t fracBits; // decimal point of the samples
+    int32_t sum;       // sum of the samples in the window
+    int32_t sumSq;     // sum of squares of the samples in the window
+} plp_sliding_stats_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_sliding_stats_instance_f32
+    @brief State of the floating point sliding window statistics.
+    @param[in,out] count  number of samples in the window
+    @param[in,out] sum    sum of the samples in the window
+    @param[in,out] sumSq  sum of squares of the samples in the window
+*/
+typedef struct {
+    uint32_t count;  // number of samples in the window
+    float32_t sum;   // sum of the samples in the window
+    float32_t sumSq; // sum of squares of the samples in the window
+} plp_sliding_stats_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_histogram_instance_i8
+    @brief Instance structure for the parallel histogram of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pTmp       private bins of the cores 1 to nPE - 1
+    @param[out] pHist      histogram with nBins entries
+*/
+typedef struct {
+    const int8_t *pSrc;     // pointer to the input vector
+    uint32_t blockSize;     // number of samples in the input vector
+    int8_t minValue;        // lower edge of the first bin
+    uint32_t binShift;      // width of the bins is 1 << binShift
+    uint32_t nBins;         // number of bins
+    uint32_t nPE;           // number of processing units
+    uint32_t *pTmp;         // private bins of the cores 1 to nPE - 1
+    uint32_t *pHist;        // resulting histogram
+} plp_histogram_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_histogram_instance_i16
+    @brief Instance structure for the parallel histogram of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pTmp       private bins of the cores 1 to nPE - 1
+    @param[out] pHist      histogram with nBins entries
+*/
+typedef struct {
+    const int16_t *pSrc;    // pointer to the input vector
+    uint32_t blockSize;     // number of samples in the input vector
+    int16_t minValue;       // lower edge of the first bin
+    uint32_t binShift;      // width of the bins is 1 << binShift
+    uint32_t nBins;         // number of bins
+    uint32_t nPE;           // number of processing units
+    uint32_t *pTmp;         // private bins of the cores 1 to nPE - 1
+    uint32_t *pHist;        // resulting histogram
+} plp_histogram_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_histogram_instance_f32
+    @brief Instance structure for the parallel histogram of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binWidth   width of the bins
+    @param[in]  nBins      number of bins
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pTmp       private bins of the cores 1 to nPE - 1
+    @param[out] pHist      histogram with nBins entries
+*/
+typedef struct {
+    const float32_t *pSrc;  // pointer to the input vector
+    uint32_t blockSize;     // number of samples in the input vector
+    float32_t minValue;     // lower edge of the first bin
+    float32_t binWidth;     // width of the bins
+    uint32_t nBins;         // number of bins
+    uint32_t nPE;           // number of processing units
+    uint32_t *pTmp;         // private bins of the cores 1 to nPE - 1
+    uint32_t *pHist;        // resulting histogram
+} plp_histogram_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_vq_nearest_instance_i8
+    @brief Instance structure for the parallel nearest centroid search of 8-bit integer vectors.
+    @param[in]  pSrc          points to the query vectors, numVectors x dim
+    @param[in]  numVectors    number of query vectors
+    @param[in]  pCodebook     points to the centroids, numCentroids x dim
+    @param[in]  numCentroids  number of centroids
+    @param[in]  dim           number of elements of every vector
+    @param[in]  pNorms        points to the squared norms of the centroids
+    @param[in]  nPE           number of parallel processing units
+    @param[out] pIdx          index of the nearest centroid of every query vector
+    @param[out] pDist         squared distance to the nearest centroid, or NULL
+*/
+typedef struct {
+    const int8_t *pSrc;      // pointer to the query vectors
+    uint32_t numVectors;     // number of query vectors
+    const int8_t *pCodebook; // pointer to the centroids
+    uint32_t numCentroids;   // number of centroids
+    uint32_t dim;            // number of elements of every vector
+    const int32_t *pNorms;   // squared norms of the centroids
+    uint32_t nPE;            // number of processing units
+    uint32_t *pIdx;          // index of the nearest centroids
+    int32_t *pDist;          // squared distances, or NULL
+} plp_vq_nearest_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_vq_nearest_instance_i16
+    @brief Instance structure for the parallel nearest centroid search of 16-bit integer vectors.
+    @param[in]  pSrc          points to the query vectors, numVectors x dim
+    @param[in]  numVectors    number of query vectors
+    @param[in]  pCodebook     points to the centroids, numCentroids x dim
+    @param[in]  numCentroids  number of centroids
+    @param[in]  dim           number of elements of every vector
+    @param[in]  pNorms        points to the squared norms of the centroids
+    @param[in]  nPE           number of parallel processing units
+    @param[out] pIdx          index of the nearest centroid of every query vector
+    @param[out] pDist         squared distance to the nearest centroid, or NULL
+*/
+typedef struct {
+    const int16_t *pSrc;      // pointer to the query vectors
+    uint32_t numVectors;      // number of query vectors
+    const int16_t *pCodebook; // pointer to the centroids
+    uint32_t numCentroids;    // number of centroids
+    uint32_t dim;             // number of elements of every vector
+    const int32_t *pNorms;    // squared norms of the centroids
+    uint32_t nPE;             // number of processing units
+    uint32_t *pIdx;           // index of the nearest centroids
+    int32_t *pDist;           // squared distances, or NULL
+} plp_vq_nearest_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_vq_nearest_instance_f32
+    @brief Instance structure for the parallel nearest centroid search of 32-bit float vectors.
+    @param[in]  pSrc          points to the query vectors, numVectors x dim
+    @param[in]  numVectors    number of query vectors
+    @param[in]  pCodebook     points to the centroids, numCentroids x dim
+    @param[in]  numCentroids  number of centroids
+    @param[in]  dim           number of elements of every vector
+    @param[in]  pNorms        points to the squared norms of the centroids
+    @param[in]  nPE           number of parallel processing units
+    @param[out] pIdx          index of the nearest centroid of every query vector
+    @param[out] pDist         squared distance to the nearest centroid, or NULL
+*/
+typedef struct {
+    const float32_t *pSrc;      // pointer to the query vectors
+    uint32_t numVectors;        // number of query vectors
+    const float32_t *pCodebook; // pointer to the centroids
+    uint32_t numCentroids;      // number of centroids
+    uint32_t dim;               // number of elements of every vector
+    const float32_t *pNorms;    // squared norms of the centroids
+    uint32_t nPE;               // number of processing units
+    uint32_t *pIdx;             // index of the nearest centroids
+    float32_t *pDist;           // squared distances, or NULL
+} plp_vq_nearest_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_normalize_l2_rows_instance_q16
+    @brief Instance structure for the parallel row-wise L2 normalization of a 16-bit fixed point
+           matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output matrix
+*/
+typedef struct {
+    const int16_t *pSrc;       // pointer to the input matrix
+    uint32_t numRows;          // number of rows
+    uint32_t numCols;          // number of columns
+    uint32_t nPE;              // number of processing units
+    int16_t *pDst;             // pointer to the output matrix
+} plp_normalize_l2_rows_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_normalize_l2_rows_instance_f32
+    @brief Instance structure for the parallel row-wise L2 normalization of a 32-bit float
+           matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output matrix
+*/
+typedef struct {
+    const float32_t *pSrc;     // pointer to the input matrix
+    uint32_t numRows;          // number of rows
+    uint32_t numCols;          // number of columns
+    uint32_t nPE;              // number of processing units
+    float32_t *pDst;           // pointer to the output matrix
+} plp_normalize_l2_rows_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cfar_ca_instance_q16
+    @brief Instance structure for the parallel row-wise cell averaging CFAR detection of a 16-bit
+           fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map
+*/
+typedef struct {
+    const int16_t *pSrc;       // points to the input matrix
+    uint32_t numRows;          // number of rows of the matrix
+    uint32_t numCols;          // number of columns of the matrix
+    uint32_t nGuard;           // number of guard cells on each side of the cell under test
+    uint32_t nTrain;           // number of training cells on each side
+    int32_t scale;             // threshold factor
+    uint32_t deciPoint;        // number of fractional bits of scale
+    uint32_t nPE;              // number of parallel processing units
+    uint8_t *pDst;             // points to the output map
+} plp_cfar_ca_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cfar_ca_instance_f32
+    @brief Instance structure for the parallel row-wise cell averaging CFAR detection of a 32-bit
+           floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map
+*/
+typedef struct {
+    const float32_t *pSrc;     // points to the input matrix
+    uint32_t numRows;          // number of rows of the matrix
+    uint32_t numCols;          // number of columns of the matrix
+    uint32_t nGuard;           // number of guard cells on each side of the cell under test
+    uint32_t nTrain;           // number of training cells on each side
+    float32_t scale;           // threshold factor
+    uint32_t nPE;              // number of parallel processing units
+    uint8_t *pDst;             // points to the output map
+} plp_cfar_ca_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cfar_os_instance_q16
+    @brief Instance structure for the parallel row-wise ordered statistic CFAR detection of a
+           16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pTmp       scratch buffer with nPE * 2 * nTrain entries
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map
+*/
+typedef struct {
+    const int16_t *pSrc;       // points to the input matrix
+    uint32_t numRows;          // number of rows of the matrix
+    uint32_t numCols;          // number of columns of the matrix
+    uint32_t nGuard;           // number of guard cells on each side of the cell under test
+    uint32_t nTrain;           // number of training cells on each side
+    uint32_t rank;             // rank of the noise estimate among the 2 * nTrain training cells
+    int32_t scale;             // threshold factor
+    uint32_t deciPoint;        // number of fractional bits of scale
+    int16_t *pTmp;             // scratch buffer with nPE * 2 * nTrain entries
+    uint32_t nPE;              // number of parallel processing units
+    uint8_t *pDst;             // points to the output map
+} plp_cfar_os_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cfar_os_instance_f32
+    @brief Instance structure for the parallel row-wise ordered statistic CFAR detection of a
+           32-bit floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells
+    @param[in]  scale      threshold factor
+    @param[out] pTmp       scratch buffer with nPE * 2 * nTrain entries
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map
+*/
+typedef struct {
+    const float32_t *pSrc;     // points to the input matrix
+    uint32_t numRows;          // number of rows of the matrix
+    uint32_t numCols;          // number of columns of the matrix
+    uint32_t nGuard;           // number of guard cells on each side of the cell under test
+    uint32_t nTrain;           // number of training cells on each side
+    uint32_t rank;             // rank of the noise estimate among the 2 * nTrain training cells
+    float32_t scale;           // threshold factor
+    float32_t *pTmp;           // scratch buffer with nPE * 2 * nTrain entries
+    uint32_t nPE;              // number of parallel processing units
+    uint8_t *pDst;             // points to the output map
+} plp_cfar_os_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_find_peaks_instance_q16
+    @brief Instance structure for the parallel row-wise peak finding of a 16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map
+*/
+typedef struct {
+    const int16_t *pSrc;       // points to the input matrix
+    uint32_t numRows;          // number of rows of the matrix
+    uint32_t numCols;          // number of columns of the matrix
+    int16_t threshold;         // minimum height of a peak
+    uint32_t minDist;          // minimum distance between two peaks
+    uint32_t nPE;              // number of parallel processing units
+    uint8_t *pDst;             // points to the output map
+} plp_find_peaks_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_find_peaks_instance_f32
+    @brief Instance structure for the parallel row-wise peak finding of a 32-bit floating-point
+           matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map
+*/
+typedef struct {
+    const float32_t *pSrc;     // points to the input matrix
+    uint32_t numRows;          // number of rows of the matrix
+    uint32_t numCols;          // number of columns of the matrix
+    float32_t threshold;       // minimum height of a peak
+    uint32_t minDist;          // minimum distance between two peaks
+    uint32_t nPE;              // number of parallel processing units
+    uint8_t *pDst;             // points to the output map
+} plp_find_peaks_instance_f32;
+
+/** Number of histogram bins used by plp_percentile, and size of its scratch buffer */
+#define PLP_PERCENTILE_BINS 256
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit float vector for RV32IM extension, in fixed point (see
+                PLP_FC_FIXED_POINT).
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32s_rv32im(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_f32_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the 64-bit sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+
+    @par
+   Every square is accumulated in 64 bits (mul and mulh), such that long vectors can be processed in a
+   single call. The sum is only limited by the magnitude of the samples: with
+   samples below 2^b in magnitude, up to 2^(63 - 2b) samples can be accumulated.
+*/
+
+void plp_power64_i32(const int32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      64-bit sum of squares of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power64_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      64-bit sum of squares of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power64_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the 64-bit sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[out] pRes       sum of squares returned here
+    @return     none
+
+    @par
+   Every square is accumulated in 64 bits (mul and mulh), such that long vectors can be processed in a
+   single call. Every square is shifted by fracBits before accumulating it, like
+   in plp_power_q32, hence the result is equal to the one of plp_power_q32 as long as the 32-bit
+   sum of plp_power_q32 does not overflow.
+*/
+
+void plp_power64_q32(const int32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     uint32_t fracBits,
+                     int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      64-bit sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power64_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t fracBits,
+                             int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      64-bit sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power64_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int64_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the variance of a 32-bit fixed point vector with 64-bit accumulation.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[out] pRes       variance returned here, saturated to 32 bits
+    @return     none
+
+    @par
+   The sum and the sum of squares are accumulated in 64 bits in a single pass, hence the result is
+   not limited by the block size. It is equal to the result of plp_var_q32, as long as the 32-bit
+   sums of plp_var_q32 do not overflow.
+*/
+
+void plp_var64_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Variance of a 32-bit fixed point vector with 64-bit accumulation for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[out] pRes       variance returned here, saturated to 32 bits
+    @return     none
+*/
+
+void plp_var64_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Variance of a 32-bit fixed point vector with 64-bit accumulation for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[out] pRes       variance returned here, saturated to 32 bits
+    @return     none
+*/
+
+void plp_var64_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_f32_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Computes the chunk of the input vector processed by a core.
+    @param[in]  blockSize  number of samples in the input vector
+    @param[in]  align      number of samples packed in one SIMD word (1, 2 or 4)
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  coreId     id of the current core
+    @param[out] pStart     first sample of the chunk
+    @param[out] pEnd       one past the last sample of the chunk
+    @return     none
+*/
+
+void plp_stats_parallel_range(uint32_t blockSize,
+                              uint32_t align,
+                              uint32_t nPE,
+                              uint32_t coreId,
+                              uint32_t *pStart,
+                              uint32_t *pEnd);
+
+/** -------------------------------------------------------
+    @brief      Combines the partial integer results of all cores in a tree.
+    @param[in,out] pBuffer  buffer with one partial result per core, result stored to pBuffer[0]
+    @param[in]     nPE      number of parallel processing units
+    @param[in]     coreId   id of the current core
+    @param[in]     op       PLP_STATS_SUM, PLP_STATS_MIN or PLP_STATS_MAX
+    @return        none
+*/
+
+void plp_stats_tree_reduce_i32(int32_t *pBuffer, uint32_t nPE, uint32_t coreId, uint32_t op);
+
+/** -------------------------------------------------------
+    @brief      Combines the partial float results of all cores in a tree.
+    @param[in,out] pBuffer  buffer with one partial result per core, result stored to pBuffer[0]
+    @param[in]     nPE      number of parallel processing units
+    @param[in]     coreId   id of the current core
+    @param[in]     op       PLP_STATS_SUM, PLP_STATS_MIN or PLP_STATS_MAX
+    @return        none
+*/
+
+void plp_stats_tree_reduce_f32(float32_t *pBuffer, uint32_t nPE, uint32_t coreId, uint32_t op);
+
+/** -------------------------------------------------------
+    @brief      Combines the partial integer summaries of all cores.
+    @param[in]  pPartial   partial summaries, one per core
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  blockSize  number of samples in the input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_combine_i32(const plp_stats_partial_i32 *pPartial,
+                                   uint32_t nPE,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_i32 *pRes);
+
+/** -------------------------------------------------------
+    @brief      Combines the partial float summaries of all cores.
+    @param[in]  pPartial   partial summaries, one per core
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  blockSize  number of samples in the input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_combine_f32(const plp_stats_partial_f32 *pPartial,
+                                   uint32_t nPE,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_f32 *pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel mean value of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_mean_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32_parallel(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel mean value of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_mean_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16_parallel(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel mean value of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_mean_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8_parallel(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel mean value of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_mean_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32_parallel(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_power_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_power_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_power_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the sum of squares of a 32-bit integer vector, which is split
+                between the cluster and the fabric controller.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of cluster cores, or PLP_AUTO
+    @param[in]  fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32_hetero(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          uint32_t fcShare,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the sum of squares of a 16-bit integer vector, which is split
+                between the cluster and the fabric controller.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of cluster cores, or PLP_AUTO
+    @param[in]  fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16_hetero(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          uint32_t fcShare,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the sum of squares of a 8-bit integer vector, which is split
+                between the cluster and the fabric controller.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of cluster cores, or PLP_AUTO
+    @param[in]  fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8_hetero(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         uint32_t fcShare,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_power_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32_parallel(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel minimum value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @return     none
+*/
+
+void plp_min_i32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel minimum value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @return     none
+*/
+
+void plp_min_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel minimum value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @return     none
+*/
+
+void plp_min_i8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel minimum value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @return     none
+*/
+
+void plp_min_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel maximum value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @return     none
+*/
+
+void plp_max_i32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel maximum value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @return     none
+*/
+
+void plp_max_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel maximum value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @return     none
+*/
+
+void plp_max_i8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel maximum value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @return     none
+*/
+
+void plp_max_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel rms value of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       rms value returned here
+    @return     none
+*/
+
+void plp_rms_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel rms value of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       rms value returned here
+    @return     none
+*/
+
+void plp_rms_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel rms value of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       rms value returned here
+    @return     none
+*/
+
+void plp_rms_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel rms value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       rms value returned here
+    @return     none
+*/
+
+void plp_rms_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the summary statistics of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i32(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel summary statistics of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i32_parallel(const int32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t nPE,
+                                    plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel summary statistics of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_summary_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_stats_summary_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the summary statistics of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i16(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel summary statistics of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i16_parallel(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t nPE,
+                                    plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel summary statistics of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_summary_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_stats_summary_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the summary statistics of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i8(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel summary statistics of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_i8_parallel(const int8_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   plp_stats_summary_result_i32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel summary statistics of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_summary_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_stats_summary_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the summary statistics of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_f32(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_summary_result_f32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Summary statistics of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    plp_stats_summary_result_f32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel summary statistics of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+    @return     none
+*/
+
+void plp_stats_summary_f32_parallel(const float32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t nPE,
+                                    plp_stats_summary_result_f32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel summary statistics of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_summary_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_stats_summary_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the maximum value and its index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i32(const int32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes,
+                     uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel maximum value and its index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i32_parallel(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value and its index of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_idx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the maximum value and its index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i16(const int16_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int16_t *__restrict__ pRes,
+                     uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel maximum value and its index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i16_parallel(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value and its index of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_idx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the maximum value and its index of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i8(const int8_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int8_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int8_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel maximum value and its index of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_i8_parallel(const int8_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value and its index of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_idx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the maximum value and its index of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_f32(const float32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     float32_t *__restrict__ pRes,
+                     uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Maximum value and its index of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel maximum value and its index of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_max_idx_f32_parallel(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel maximum value and its index of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_max_idx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the maximum of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_i32(const int32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the maximum of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_i32_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the maximum of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the maximum of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the maximum of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the maximum of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the maximum of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the maximum of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
+*/
+
+void plp_argmax_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the minimum value and its index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i32(const int32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes,
+                     uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel minimum value and its index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i32_parallel(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value and its index of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_i32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_idx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the minimum value and its index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i16(const int16_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int16_t *__restrict__ pRes,
+                     uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel minimum value and its index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i16_parallel(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value and its index of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_i16 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_idx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the minimum value and its index of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i8(const int8_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int8_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int8_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel minimum value and its index of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_i8_parallel(const int8_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value and its index of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_i8 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_idx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the minimum value and its index of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_f32(const float32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     float32_t *__restrict__ pRes,
+                     uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Minimum value and its index of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel minimum value and its index of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_min_idx_f32_parallel(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Parallel minimum value and its index of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_stats_idx_instance_f32 struct initialized by the glue code
+    @return     none
+*/
+
+void plp_min_idx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the minimum of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_i32(const int32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the minimum of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_i32_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the minimum of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the minimum of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the minimum of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the minimum of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the index of the minimum of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel index of the minimum of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
+
+void plp_argmin_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      Resets the floating point running statistics.
+    @param[out] S  points to the running statistics instance
+    @return     none
+*/
+
+void plp_running_stats_init_f32(plp_running_stats_instance_f32 *S);
+
+/** -------------------------------------------------------
+    @brief      Merges a block of samples into the floating point running statistics.
+    @param[in,out] S          points to the running statistics instance
+    @param[in]     pSrc       points to the new block of samples
+    @param[in]     blockSize  number of samples in the new block
+    @return        none
+*/
+
+void plp_running_stats_update_f32(plp_running_stats_instance_f32 *S,
+                                  const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Reads the mean and the variance from the floating point running statistics.
+    @param[in]  S      points to the running statistics instance
+    @param[out] pMean  mean of all samples seen so far, may be NULL
+    @param[out] pVar   variance of all samples seen so far, may be NULL
+    @return     none
+*/
+
+void plp_running_stats_get_f32(const plp_running_stats_instance_f32 *S,
+                               float32_t *pMean,
+                               float32_t *pVar);
+
+/** -------------------------------------------------------
+    @brief      Resets the 16-bit fixed point sliding statistics to an empty window.
+    @param[out] S         points to the sliding statistics instance
+    @param[in]  fracBits  decimal point of the samples
+    @return     none
+*/
+
+void plp_sliding_stats_init_q16(plp_sliding_stats_instance_q16 *S,
+                                uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for adding a hop of samples to the 16-bit fixed point sliding statistics, and
+                removing the samples leaving the window.
+    @param[in,out] S        points to the sliding statistics instance
+    @param[in]     pNew     points to the samples entering the window
+    @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+    @param[in]     hopSize  number of samples in pNew (and pOld)
+    @return        none
+*/
+
+void plp_sliding_stats_update_q16(plp_sliding_stats_instance_q16 *S,
+                                  const int16_t *__restrict__ pNew,
+                                  const int16_t *__restrict__ pOld,
+                                  uint32_t hopSize);
+
+/** -------------------------------------------------------
+    @brief      Reads the mean, the variance and the rms value of the current window.
+    @param[in]  S      points to the sliding statistics instance
+    @param[out] pMean  mean value of the window, may be NULL
+    @param[out] pVar   variance of the window, may be NULL
+    @param[out] pRms   rms value of the window, may be NULL
+    @return     none
+*/
+
+void plp_sliding_stats_get_q16(const plp_sliding_stats_instance_q16 *S,
+                               int16_t *pMean,
+                               int16_t *pVar,
+                               int16_t *pRms);
+
+/** -------------------------------------------------------
+    @brief      Resets the floating point sliding statistics to an empty window.
+    @param[out] S         points to the sliding statistics instance
+    @return     none
+*/
+
+void plp_sliding_stats_init_f32(plp_sliding_stats_instance_f32 *S);
+
+/** -------------------------------------------------------
+    @brief      Adds a hop of samples to the floating point sliding statistics, and removes the samples
+                leaving the window.
+    @param[in,out] S        points to the sliding statistics instance
+    @param[in]     pNew     points to the samples entering the window
+    @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+    @param[in]     hopSize  number of samples in pNew (and pOld)
+    @return        none
+*/
+
+void plp_sliding_stats_update_f32(plp_sliding_stats_instance_f32 *S,
+                                  const float32_t *__restrict__ pNew,
+                                  const float32_t *__restrict__ pOld,
+                                  uint32_t hopSize);
+
+/** -------------------------------------------------------
+    @brief      Reads the mean, the variance and the rms value of the current window.
+    @param[in]  S      points to the sliding statistics instance
+    @param[out] pMean  mean value of the window, may be NULL
+    @param[out] pVar   variance of the window, may be NULL
+    @param[out] pRms   rms value of the window, may be NULL
+    @return     none
+*/
+
+void plp_sliding_stats_get_f32(const plp_sliding_stats_instance_f32 *S,
+                               float32_t *pMean,
+                               float32_t *pVar,
+                               float32_t *pRms);
+
+/** -------------------------------------------------------
+    @brief      Adds a hop of samples to the 16-bit fixed point sliding statistics, and removes the
+                samples leaving the window, for RV32IM extension.
+    @param[in,out] S        points to the sliding statistics instance
+    @param[in]     pNew     points to the samples entering the window
+    @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+    @param[in]     hopSize  number of samples in pNew (and pOld)
+    @return        none
+*/
+
+void plp_sliding_stats_update_q16s_rv32im(plp_sliding_stats_instance_q16 *S,
+                                          const int16_t *__restrict__ pNew,
+                                          const int16_t *__restrict__ pOld,
+                                          uint32_t hopSize);
+
+/** -------------------------------------------------------
+    @brief      Adds a hop of samples to the 16-bit fixed point sliding statistics, and removes the
+                samples leaving the window, for XPULPV2 extension.
+    @param[in,out] S        points to the sliding statistics instance
+    @param[in]     pNew     points to the samples entering the window
+    @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+    @param[in]     hopSize  number of samples in pNew (and pOld)
+    @return        none
+*/
+
+void plp_sliding_stats_update_q16s_xpulpv2(plp_sliding_stats_instance_q16 *S,
+                                           const int16_t *__restrict__ pNew,
+                                           const int16_t *__restrict__ pOld,
+                                           uint32_t hopSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the histogram of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+*/
+
+void plp_histogram_i8(const int8_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      int8_t minValue,
+                      uint32_t binShift,
+                      uint32_t nBins,
+                      uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel histogram of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pTmp       scratch buffer for the private bins of the cores, (nPE - 1) * nBins entries
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+
+    @par
+   Core 0 counts its chunk directly in pHist, all other cores count their chunk in their own slice
+   of pTmp. After a barrier, every core sums up the private counts of a slice of the bins.
+*/
+
+void plp_histogram_i8_parallel(const int8_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               int8_t minValue,
+                               uint32_t binShift,
+                               uint32_t nBins,
+                               uint32_t nPE,
+                               uint32_t *__restrict__ pTmp,
+                               uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the histogram of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+*/
+
+void plp_histogram_i16(const int16_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       int16_t minValue,
+                       uint32_t binShift,
+                       uint32_t nBins,
+                       uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel histogram of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pTmp       scratch buffer for the private bins of the cores, (nPE - 1) * nBins entries
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+
+    @par
+   Core 0 counts its chunk directly in pHist, all other cores count their chunk in their own slice
+   of pTmp. After a barrier, every core sums up the private counts of a slice of the bins.
+*/
+
+void plp_histogram_i16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int16_t minValue,
+                                uint32_t binShift,
+                                uint32_t nBins,
+                                uint32_t nPE,
+                                uint32_t *__restrict__ pTmp,
+                                uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the histogram of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binWidth   width of the bins, must be larger than 0
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+*/
+
+void plp_histogram_f32(const float32_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       float32_t minValue,
+                       float32_t binWidth,
+                       uint32_t nBins,
+                       uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel histogram of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binWidth   width of the bins, must be larger than 0
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pTmp       scratch buffer for the private bins of the cores, (nPE - 1) * nBins entries
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+
+    @par
+   Core 0 counts its chunk directly in pHist, all other cores count their chunk in their own slice
+   of pTmp. After a barrier, every core sums up the private counts of a slice of the bins.
+*/
+
+void plp_histogram_f32_parallel(const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                float32_t minValue,
+                                float32_t binWidth,
+                                uint32_t nBins,
+                                uint32_t nPE,
+                                uint32_t *__restrict__ pTmp,
+                                uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Histogram of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+*/
+
+void plp_histogram_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int8_t minValue,
+                              uint32_t binShift,
+                              uint32_t nBins,
+                              uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Histogram of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+
+    @par
+   The bins of two samples are computed before their counts are loaded, and both counts are loaded
+   before they are stored back, which hides the load-use latency of the read-modify-write. If both
+   samples fall into the same bin, the second store writes the count incremented by two.
+*/
+
+void plp_histogram_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               int8_t minValue,
+                               uint32_t binShift,
+                               uint32_t nBins,
+                               uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Parallel histogram of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_histogram_instance_i8 struct initialized by the glue code
+    @return     none
+
+    @par
+   Every core counts a contiguous chunk of the vector in private bins: core 0 in pHist, core i in
+   pTmp[(i - 1) * nBins]. After a barrier, every core sums up the private counts of its slice of
+   the bins into pHist.
+*/
+
+void plp_histogram_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Histogram of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+*/
+
+void plp_histogram_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               int16_t minValue,
+                               uint32_t binShift,
+                               uint32_t nBins,
+                               uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Histogram of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binShift   width of the bins is 1 << binShift
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+
+    @par
+   The bins of two samples are computed before their counts are loaded, and both counts are loaded
+   before they are stored back, which hides the load-use latency of the read-modify-write. If both
+   samples fall into the same bin, the second store writes the count incremented by two.
+*/
+
+void plp_histogram_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int16_t minValue,
+                                uint32_t binShift,
+                                uint32_t nBins,
+                                uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Parallel histogram of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_histogram_instance_i16 struct initialized by the glue code
+    @return     none
+
+    @par
+   Every core counts a contiguous chunk of the vector in private bins: core 0 in pHist, core i in
+   pTmp[(i - 1) * nBins]. After a barrier, every core sums up the private counts of its slice of
+   the bins into pHist.
+*/
+
+void plp_histogram_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Histogram of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  minValue   lower edge of the first bin
+    @param[in]  binWidth   width of the bins, must be larger than 0
+    @param[in]  nBins      number of bins, must be larger than 0
+    @param[out] pHist      histogram with nBins entries, overwritten
+    @return     none
+
+    @par
+   The bins of two samples are computed before their counts are loaded, and both counts are loaded
+   before they are stored back, which hides the load-use latency of the read-modify-write. If both
+   samples fall into the same bin, the second store writes the count incremented by two.
+*/
+
+void plp_histogram_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                float32_t minValue,
+                                float32_t binWidth,
+                                uint32_t nBins,
+                                uint32_t *__restrict__ pHist);
+
+/** -------------------------------------------------------
+    @brief      Parallel histogram of a 32-bit float vector kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_histogram_instance_f32 struct initialized by the glue code
+    @return     none
+
+    @par
+   Every core counts a contiguous chunk of the vector in private bins: core 0 in pHist, core i in
+   pTmp[(i - 1) * nBins]. After a barrier, every core sums up the private counts of its slice of
+   the bins into pHist.
+*/
+
+void plp_histogram_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Percentile of a 8-bit integer vector, computed from its histogram without sorting.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  percent    percentile to compute, between 0 and 100
+    @param[out] pTmp       scratch buffer with PLP_PERCENTILE_BINS entries
+    @param[out] pRes       percentile returned here
+    @return     none
+*/
+
+void plp_percentile_i8(const int8_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       uint32_t percent,
+                       uint32_t *__restrict__ pTmp,
+                       int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Percentile of a 16-bit integer vector, computed from its histogram without sorting.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  percent    percentile to compute, between 0 and 100
+    @param[out] pTmp       scratch buffer with PLP_PERCENTILE_BINS entries
+    @param[out] pRes       percentile returned here
+    @return     none
+*/
+
+void plp_percentile_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t percent,
+                        uint32_t *__restrict__ pTmp,
+                        int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Percentile of a 32-bit float vector, computed from its histogram without sorting.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector, must be larger than 0
+    @param[in]  percent    percentile to compute, between 0 and 100
+    @param[out] pTmp       scratch buffer with PLP_PERCENTILE_BINS entries
+    @param[out] pRes       percentile returned here
+    @return     none
+*/
+
+void plp_percentile_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t percent,
+                        uint32_t *__restrict__ pTmp,
+                        float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief           Squared norms of the centroids of a 8-bit integer codebook.
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids
+   @param[in]  dim           number of elements of every centroid
+   @param[out] pNorms        squared norm of every centroid
+   @return     none
+*/
+
+void plp_vq_norms_i8(const int8_t *__restrict__ pCodebook,
+                     uint32_t numCentroids,
+                     uint32_t dim,
+                     int32_t *__restrict__ pNorms);
+
+/** -------------------------------------------------------
+   @brief           Glue code for the nearest centroid search of 8-bit integer vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i8)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i8(const int8_t *__restrict__ pSrc,
+                       uint32_t numVectors,
+                       const int8_t *__restrict__ pCodebook,
+                       uint32_t numCentroids,
+                       uint32_t dim,
+                       const int32_t *__restrict__ pNorms,
+                       uint32_t *__restrict__ pIdx,
+                       int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Nearest centroid search of 8-bit integer vectors for RV32IM extension.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i8)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                               uint32_t numVectors,
+                               const int8_t *__restrict__ pCodebook,
+                               uint32_t numCentroids,
+                               uint32_t dim,
+                               const int32_t *__restrict__ pNorms,
+                               uint32_t *__restrict__ pIdx,
+                               int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Nearest centroid search of 8-bit integer vectors for XPULPV2 extension.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i8)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                uint32_t numVectors,
+                                const int8_t *__restrict__ pCodebook,
+                                uint32_t numCentroids,
+                                uint32_t dim,
+                                const int32_t *__restrict__ pNorms,
+                                uint32_t *__restrict__ pIdx,
+                                int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Glue code for the parallel nearest centroid search of 8-bit integer vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i8)
+   @param[in]  nPE           number of parallel processing units
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i8_parallel(const int8_t *__restrict__ pSrc,
+                                uint32_t numVectors,
+                                const int8_t *__restrict__ pCodebook,
+                                uint32_t numCentroids,
+                                uint32_t dim,
+                                const int32_t *__restrict__ pNorms,
+                                uint32_t nPE,
+                                uint32_t *__restrict__ pIdx,
+                                int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Parallel nearest centroid search of 8-bit integer vectors kernel for XPULPV2
+               extension.
+   @param[in]  args  points to the plp_vq_nearest_instance_i8 struct initialized by the glue code
+   @return     none
+*/
+
+void plp_vq_nearest_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief           Squared norms of the centroids of a 16-bit integer codebook.
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids
+   @param[in]  dim           number of elements of every centroid
+   @param[out] pNorms        squared norm of every centroid
+   @return     none
+*/
+
+void plp_vq_norms_i16(const int16_t *__restrict__ pCodebook,
+                      uint32_t numCentroids,
+                      uint32_t dim,
+                      int32_t *__restrict__ pNorms);
+
+/** -------------------------------------------------------
+   @brief           Glue code for the nearest centroid search of 16-bit integer vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i16)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t numVectors,
+                        const int16_t *__restrict__ pCodebook,
+                        uint32_t numCentroids,
+                        uint32_t dim,
+                        const int32_t *__restrict__ pNorms,
+                        uint32_t *__restrict__ pIdx,
+                        int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Nearest centroid search of 16-bit integer vectors for RV32IM extension.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i16)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t numVectors,
+                                const int16_t *__restrict__ pCodebook,
+                                uint32_t numCentroids,
+                                uint32_t dim,
+                                const int32_t *__restrict__ pNorms,
+                                uint32_t *__restrict__ pIdx,
+                                int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Nearest centroid search of 16-bit integer vectors for XPULPV2 extension.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i16)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t numVectors,
+                                 const int16_t *__restrict__ pCodebook,
+                                 uint32_t numCentroids,
+                                 uint32_t dim,
+                                 const int32_t *__restrict__ pNorms,
+                                 uint32_t *__restrict__ pIdx,
+                                 int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Glue code for the parallel nearest centroid search of 16-bit integer vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i16)
+   @param[in]  nPE           number of parallel processing units
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i16_parallel(const int16_t *__restrict__ pSrc,
+                                 uint32_t numVectors,
+                                 const int16_t *__restrict__ pCodebook,
+                                 uint32_t numCentroids,
+                                 uint32_t dim,
+                                 const int32_t *__restrict__ pNorms,
+                                 uint32_t nPE,
+                                 uint32_t *__restrict__ pIdx,
+                                 int32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Parallel nearest centroid search of 16-bit integer vectors kernel for XPULPV2
+               extension.
+   @param[in]  args  points to the plp_vq_nearest_instance_i16 struct initialized by the glue code
+   @return     none
+*/
+
+void plp_vq_nearest_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief           Squared norms of the centroids of a 32-bit float codebook.
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids
+   @param[in]  dim           number of elements of every centroid
+   @param[out] pNorms        squared norm of every centroid
+   @return     none
+*/
+
+void plp_vq_norms_f32(const float32_t *__restrict__ pCodebook,
+                      uint32_t numCentroids,
+                      uint32_t dim,
+                      float32_t *__restrict__ pNorms);
+
+/** -------------------------------------------------------
+   @brief           Glue code for the nearest centroid search of 32-bit float vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_f32)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t numVectors,
+                        const float32_t *__restrict__ pCodebook,
+                        uint32_t numCentroids,
+                        uint32_t dim,
+                        const float32_t *__restrict__ pNorms,
+                        uint32_t *__restrict__ pIdx,
+                        float32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Nearest centroid search of 32-bit float vectors for XPULPV2 extension.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_f32)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t numVectors,
+                                 const float32_t *__restrict__ pCodebook,
+                                 uint32_t numCentroids,
+                                 uint32_t dim,
+                                 const float32_t *__restrict__ pNorms,
+                                 uint32_t *__restrict__ pIdx,
+                                 float32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Glue code for the parallel nearest centroid search of 32-bit float vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_f32)
+   @param[in]  nPE           number of parallel processing units
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_f32_parallel(const float32_t *__restrict__ pSrc,
+                                 uint32_t numVectors,
+                                 const float32_t *__restrict__ pCodebook,
+                                 uint32_t numCentroids,
+                                 uint32_t dim,
+                                 const float32_t *__restrict__ pNorms,
+                                 uint32_t nPE,
+                                 uint32_t *__restrict__ pIdx,
+                                 float32_t *__restrict__ pDist);
+
+/** -------------------------------------------------------
+   @brief           Parallel nearest centroid search of 32-bit float vectors kernel for XPULPV2
+               extension.
+   @param[in]  args  points to the plp_vq_nearest_instance_f32 struct initialized by the glue code
+   @return     none
+*/
+
+void plp_vq_nearest_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i8(const int8_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 8-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i16(const int16_t *__restrict__ pSrc,
+                         uint32_t stride,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i32(const int32_t *__restrict__ pSrc,
+                         uint32_t stride,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided mean value of a 32-bit floating-point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_f32(const float32_t *__restrict__ pSrc,
+                         uint32_t stride,
+                         uint32_t blockSize,
+                         float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided mean value of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i8(const int8_t *__restrict__ pSrc,
+                         uint32_t stride,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 8-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i16(const int16_t *__restrict__ pSrc,
+                          uint32_t stride,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   uint32_t stride,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i32(const int32_t *__restrict__ pSrc,
+                          uint32_t stride,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                   uint32_t stride,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided sum of squares of a 32-bit floating-point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_f32(const float32_t *__restrict__ pSrc,
+                          uint32_t stride,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided sum of squares of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                   uint32_t stride,
+                                   uint32_t blockSize,
+                                   float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided max value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i8(const int8_t *__restrict__ pSrc,
+                       uint32_t stride,
+                       uint32_t blockSize,
+                       int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 8-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                               uint32_t stride,
+                               uint32_t blockSize,
+                               int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i32(const int32_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided max value of a 32-bit floating-point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided max value of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided min value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i8(const int8_t *__restrict__ pSrc,
+                       uint32_t stride,
+                       uint32_t blockSize,
+                       int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 8-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                               uint32_t stride,
+                               uint32_t blockSize,
+                               int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 8-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 16-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 16-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i32(const int32_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 32-bit integer vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 32-bit integer vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for strided min value of a 32-bit floating-point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t stride,
+                        uint32_t blockSize,
+                        float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Strided min value of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  stride     stride of the input vector (elements between two samples)
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for mean value of every channel of an interleaved 16-bit integer buffer.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       mean values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_mean_interleaved_i16(const int16_t *__restrict__ pSrc,
+                              uint32_t nChannels,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Mean value of every channel of an interleaved 16-bit integer buffer kernel for RV32IM
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       mean values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_mean_interleaved_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                      uint32_t nChannels,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Mean value of every channel of an interleaved 16-bit integer buffer kernel for XPULPV2
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       mean values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_mean_interleaved_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t nChannels,
+                                       uint32_t blockSize,
+                                       int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for max value of every channel of an interleaved 16-bit integer buffer.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       max values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_max_interleaved_i16(const int16_t *__restrict__ pSrc,
+                             uint32_t nChannels,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Max value of every channel of an interleaved 16-bit integer buffer kernel for RV32IM
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       max values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_max_interleaved_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                     uint32_t nChannels,
+                                     uint32_t blockSize,
+                                     int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Max value of every channel of an interleaved 16-bit integer buffer kernel for XPULPV2
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       max values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_max_interleaved_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t nChannels,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for min value of every channel of an interleaved 16-bit integer buffer.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       min values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_min_interleaved_i16(const int16_t *__restrict__ pSrc,
+                             uint32_t nChannels,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Min value of every channel of an interleaved 16-bit integer buffer kernel for RV32IM
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       min values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_min_interleaved_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                     uint32_t nChannels,
+                                     uint32_t blockSize,
+                                     int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Min value of every channel of an interleaved 16-bit integer buffer kernel for XPULPV2
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[out] pRes       min values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_min_interleaved_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t nChannels,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for RMS value of every channel of an interleaved 16-bit fixed point buffer.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  fracBits   decimal point of the input
+    @param[out] pRes       RMS values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_rms_interleaved_q16(const int16_t *__restrict__ pSrc,
+                             uint32_t nChannels,
+                             uint32_t blockSize,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief RMS value of every channel of an interleaved 16-bit fixed point buffer kernel for RV32IM
+           extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  fracBits   decimal point of the input
+    @param[out] pRes       RMS values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_rms_interleaved_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                     uint32_t nChannels,
+                                     uint32_t blockSize,
+                                     uint32_t fracBits,
+                                     int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief RMS value of every channel of an interleaved 16-bit fixed point buffer kernel for
+           XPULPV2 extension.
+    @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+    @param[in]  nChannels  number of interleaved channels
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  fracBits   decimal point of the input
+    @param[out] pRes       RMS values of the channels (nChannels) returned here
+    @return     none
+*/
+
+void plp_rms_interleaved_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t nChannels,
+                                      uint32_t blockSize,
+                                      uint32_t fracBits,
+                                      int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for the L2 normalization of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, in Q1.15, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_q16(const int16_t *pSrc,
+                          uint32_t blockSize,
+                          int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief L2 normalization of a 16-bit fixed point vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, in Q1.15, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_q16s_rv32im(const int16_t *pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief L2 normalization of a 16-bit fixed point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, in Q1.15, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_q16s_xpulpv2(const int16_t *pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the L2 normalization of a 32-bit floating-point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_f32(const float32_t *pSrc,
+                          uint32_t blockSize,
+                          float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief L2 normalization of a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_f32s_xpulpv2(const float32_t *pSrc,
+                                   uint32_t blockSize,
+                                   float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise L2 normalization of a 16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[out] pDst       points to the output matrix, in Q1.15, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_rows_q16(const int16_t *pSrc,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise L2 normalization of a 16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output matrix, in Q1.15, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_rows_q16_parallel(const int16_t *pSrc,
+                                        uint32_t numRows,
+                                        uint32_t numCols,
+                                        uint32_t nPE,
+                                        int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise L2 normalization of a 16-bit fixed point matrix kernel for XPULPV2
+           extension.
+    @param[in]  args       points to the plp_normalize_l2_rows_instance_q16 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_normalize_l2_rows_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise L2 normalization of a 32-bit floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[out] pDst       points to the output matrix, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_rows_f32(const float32_t *pSrc,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise L2 normalization of a 32-bit floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output matrix, may be equal to pSrc
+    @return     none
+*/
+
+void plp_normalize_l2_rows_f32_parallel(const float32_t *pSrc,
+                                        uint32_t numRows,
+                                        uint32_t numCols,
+                                        uint32_t nPE,
+                                        float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise L2 normalization of a 32-bit floating-point matrix kernel for XPULPV2
+           extension.
+    @param[in]  args       points to the plp_normalize_l2_rows_instance_f32 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_normalize_l2_rows_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise cell averaging CFAR detection of a 16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_q16(const int16_t *pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t nGuard,
+                     uint32_t nTrain,
+                     int32_t scale,
+                     uint32_t deciPoint,
+                     uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Cell averaging CFAR detection of a 16-bit fixed point vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nGuard,
+                             uint32_t nTrain,
+                             int32_t scale,
+                             uint32_t deciPoint,
+                             uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Cell averaging CFAR detection of a 16-bit fixed point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              int32_t scale,
+                              uint32_t deciPoint,
+                              uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise cell averaging CFAR detection of a 16-bit fixed
+           point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_q16_parallel(const int16_t *pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              int32_t scale,
+                              uint32_t deciPoint,
+                              uint32_t nPE,
+                              uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise cell averaging CFAR detection of a 16-bit fixed point matrix kernel for
+           XPULPV2 extension.
+    @param[in]  args       points to the plp_cfar_ca_instance_q16 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_cfar_ca_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise cell averaging CFAR detection of a 32-bit floating-point
+           matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_f32(const float32_t *pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t nGuard,
+                     uint32_t nTrain,
+                     float32_t scale,
+                     uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Cell averaging CFAR detection of a 32-bit floating-point vector kernel for XPULPV2
+           extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor
+    @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              float32_t scale,
+                              uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise cell averaging CFAR detection of a 32-bit
+           floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  scale      threshold factor
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_ca_f32_parallel(const float32_t *pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              float32_t scale,
+                              uint32_t nPE,
+                              uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise cell averaging CFAR detection of a 32-bit floating-point matrix kernel
+           for XPULPV2 extension.
+    @param[in]  args       points to the plp_cfar_ca_instance_f32 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_cfar_ca_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise ordered statistic CFAR detection of a 16-bit fixed point
+           matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pTmp       scratch buffer with 2 * nTrain entries
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_q16(const int16_t *pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t nGuard,
+                     uint32_t nTrain,
+                     uint32_t rank,
+                     int32_t scale,
+                     uint32_t deciPoint,
+                     int16_t *pTmp,
+                     uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Ordered statistic CFAR detection of a 16-bit fixed point vector kernel for RV32IM
+           extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pTmp       scratch buffer with 2 * nTrain entries
+    @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nGuard,
+                             uint32_t nTrain,
+                             uint32_t rank,
+                             int32_t scale,
+                             uint32_t deciPoint,
+                             int16_t *__restrict__ pTmp,
+                             uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Ordered statistic CFAR detection of a 16-bit fixed point vector kernel for XPULPV2
+           extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pTmp       scratch buffer with 2 * nTrain entries
+    @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              uint32_t rank,
+                              int32_t scale,
+                              uint32_t deciPoint,
+                              int16_t *__restrict__ pTmp,
+                              uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise ordered statistic CFAR detection of a 16-bit fixed
+           point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+    @param[in]  deciPoint  number of fractional bits of scale
+    @param[out] pTmp       scratch buffer with nPE * 2 * nTrain entries
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_q16_parallel(const int16_t *pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              uint32_t rank,
+                              int32_t scale,
+                              uint32_t deciPoint,
+                              int16_t *pTmp,
+                              uint32_t nPE,
+                              uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise ordered statistic CFAR detection of a 16-bit fixed point matrix kernel
+           for XPULPV2 extension.
+    @param[in]  args       points to the plp_cfar_os_instance_q16 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_cfar_os_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise ordered statistic CFAR detection of a 32-bit floating-point
+           matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor
+    @param[out] pTmp       scratch buffer with 2 * nTrain entries
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_f32(const float32_t *pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t nGuard,
+                     uint32_t nTrain,
+                     uint32_t rank,
+                     float32_t scale,
+                     float32_t *pTmp,
+                     uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Ordered statistic CFAR detection of a 32-bit floating-point vector kernel for XPULPV2
+           extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor
+    @param[out] pTmp       scratch buffer with 2 * nTrain entries
+    @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              uint32_t rank,
+                              float32_t scale,
+                              float32_t *__restrict__ pTmp,
+                              uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise ordered statistic CFAR detection of a 32-bit
+           floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  nGuard     number of guard cells on each side of the cell under test
+    @param[in]  nTrain     number of training cells on each side, must be larger than 0
+    @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                           (smallest) to 2 * nTrain
+    @param[in]  scale      threshold factor
+    @param[out] pTmp       scratch buffer with nPE * 2 * nTrain entries
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                           0 otherwise
+    @return     none
+*/
+
+void plp_cfar_os_f32_parallel(const float32_t *pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              uint32_t rank,
+                              float32_t scale,
+                              float32_t *pTmp,
+                              uint32_t nPE,
+                              uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise ordered statistic CFAR detection of a 32-bit floating-point matrix
+           kernel for XPULPV2 extension.
+    @param[in]  args       points to the plp_cfar_os_instance_f32 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_cfar_os_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise peak finding of a 16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for peaks, 0
+                           otherwise
+    @return     none
+*/
+
+void plp_find_peaks_q16(const int16_t *pSrc,
+                        uint32_t numRows,
+                        uint32_t numCols,
+                        int16_t threshold,
+                        uint32_t minDist,
+                        uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Peak finding in a 16-bit fixed point vector kernel for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[out] pDst       points to the output vector, 1 for peaks, 0 otherwise
+    @return     none
+*/
+
+void plp_find_peaks_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int16_t threshold,
+                                uint32_t minDist,
+                                uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Peak finding in a 16-bit fixed point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[out] pDst       points to the output vector, 1 for peaks, 0 otherwise
+    @return     none
+*/
+
+void plp_find_peaks_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int16_t threshold,
+                                 uint32_t minDist,
+                                 uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise peak finding of a 16-bit fixed point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for peaks, 0
+                           otherwise
+    @return     none
+*/
+
+void plp_find_peaks_q16_parallel(const int16_t *pSrc,
+                                 uint32_t numRows,
+                                 uint32_t numCols,
+                                 int16_t threshold,
+                                 uint32_t minDist,
+                                 uint32_t nPE,
+                                 uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise peak finding of a 16-bit fixed point matrix kernel for XPULPV2 extension.
+    @param[in]  args       points to the plp_find_peaks_instance_q16 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_find_peaks_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for the row-wise peak finding of a 32-bit floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for peaks, 0
+                           otherwise
+    @return     none
+*/
+
+void plp_find_peaks_f32(const float32_t *pSrc,
+                        uint32_t numRows,
+                        uint32_t numCols,
+                        float32_t threshold,
+                        uint32_t minDist,
+                        uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Peak finding in a 32-bit floating-point vector kernel for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[out] pDst       points to the output vector, 1 for peaks, 0 otherwise
+    @return     none
+*/
+
+void plp_find_peaks_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 float32_t threshold,
+                                 uint32_t minDist,
+                                 uint8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for the parallel row-wise peak finding of a 32-bit floating-point matrix.
+    @param[in]  pSrc       points to the input matrix, one vector per row
+    @param[in]  numRows    number of rows of the matrix
+    @param[in]  numCols    number of columns of the matrix
+    @param[in]  threshold  minimum height of a peak
+    @param[in]  minDist    minimum distance between two peaks, in samples
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output map of shape numRows x numCols, 1 for peaks, 0
+                           otherwise
+    @return     none
+*/
+
+void plp_find_peaks_f32_parallel(const float32_t *pSrc,
+                                 uint32_t numRows,
+                                 uint32_t numCols,
+                                 float32_t threshold,
+                                 uint32_t minDist,
+                                 uint32_t nPE,
+                                 uint8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel row-wise peak finding of a 32-bit floating-point matrix kernel for XPULPV2
+           extension.
+    @param[in]  args       points to the plp_find_peaks_instance_f32 struct initialized
+                           by the glue code
+    @return     none
+*/
+
+void plp_find_peaks_f32p_xpulpv2(void *args);
+
+#endif // __PLP_STATISTICS_H__
@@ -0,0 +1,3781 @@
+/** ==========================================================================
+ * @file     plp_support.h
+ * @brief    Support functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_SUPPORT_H__
+#define __PLP_SUPPORT_H__
+
+#include "plp_math_common.h"
+#include "plp_auto_table.h"
+
+/** -------------------------------------------------------
+    @struct plp_i8_to_i16_instance
+    @brief Instance structure for the parallel widening of an 8-bit integer vector to a 16-bit
+           integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shift       number of bits to shift the values left, at most 8
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    uint32_t shift;     // number of bits to shift
+    int16_t *pDst;      // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_i8_to_i16_instance;
+
+/** -------------------------------------------------------
+    @struct plp_i8_to_i32_instance
+    @brief Instance structure for the parallel widening of an 8-bit integer vector to a 32-bit
+           integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shift       number of bits to shift the values left, at most 24
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    uint32_t shift;     // number of bits to shift
+    int32_t *pDst;      // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_i8_to_i32_instance;
+
+/** -------------------------------------------------------
+    @struct plp_i16_to_i8_instance
+    @brief Instance structure for the parallel narrowing of a 16-bit integer vector to an 8-bit
+           integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shift       number of bits to shift the values right, at most 15
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    uint32_t shift;      // number of bits to shift
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_i16_to_i8_instance;
+
+/** -------------------------------------------------------
+    @struct plp_i16_to_i32_instance
+    @brief Instance structure for the parallel widening of a 16-bit integer vector to a 32-bit
+           integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shift       number of bits to shift the values left, at most 16
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    uint32_t shift;      // number of bits to shift
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_i16_to_i32_instance;
+
+/** -------------------------------------------------------
+    @struct plp_i32_to_i8_instance
+    @brief Instance structure for the parallel narrowing of a 32-bit integer vector to an 8-bit
+           integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shift       number of bits to shift the values right, at most 31
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    uint32_t shift;      // number of bits to shift
+    int8_t *pDst;        // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_i32_to_i8_instance;
+
+/** -------------------------------------------------------
+    @struct plp_i32_to_i16_instance
+    @brief Instance structure for the parallel narrowing of a 32-bit integer vector to a 16-bit
+           integer vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  shift       number of bits to shift the values right, at most 31
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    uint32_t shift;      // number of bits to shift
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_i32_to_i16_instance;
+
+/** -------------------------------------------------------
+    @struct plp_q8_to_f32_instance
+    @brief Instance structure for the parallel conversion of an 8-bit fixed-point vector to a 32-bit
+           floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  deciPoint   number of fractional bits of the input values
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the input vector
+    uint32_t deciPoint; // number of fractional bits
+    float32_t *pDst;    // pointer to the output vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+} plp_q8_to_f32_instance;
+
+/** -------------------------------------------------------
+    @struct plp_q16_to_f32_instance
+    @brief Instance structure for the parallel conversion of a 16-bit fixed-point vector to a 32-bit
+           floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  deciPoint   number of fractional bits of the input values
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    uint32_t deciPoint;  // number of fractional bits
+    float32_t *pDst;     // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_q16_to_f32_instance;
+
+/** -------------------------------------------------------
+    @struct plp_q32_to_f32_instance
+    @brief Instance structure for the parallel conversion of a 32-bit fixed-point vector to a 32-bit
+           floating-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  deciPoint   number of fractional bits of the input values
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    uint32_t deciPoint;  // number of fractional bits
+    float32_t *pDst;     // pointer to the output vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+} plp_q32_to_f32_instance;
+
+/** -------------------------------------------------------
+    @struct plp_f32_to_q8_instance
+    @brief Instance structure for the parallel conversion of a 32-bit floating-point vector to an
+           8-bit fixed-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  deciPoint   number of fractional bits of the output values
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    uint32_t deciPoint;    // number of fractional bits
+    int8_t *pDst;          // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_f32_to_q8_instance;
+
+/** -------------------------------------------------------
+    @struct plp_f32_to_q16_instance
+    @brief Instance structure for the parallel conversion of a 32-bit floating-point vector to a
+           16-bit fixed-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  deciPoint   number of fractional bits of the output values
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    uint32_t deciPoint;    // number of fractional bits
+    int16_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_f32_to_q16_instance;
+
+/** -------------------------------------------------------
+    @struct plp_f32_to_q32_instance
+    @brief Instance structure for the parallel conversion of a 32-bit floating-point vector to a
+           32-bit fixed-point vector.
+    @param[in]  pSrc        points to the input vector
+    @param[in]  deciPoint   number of fractional bits of the output values
+    @param[out] pDst        points to the output vector
+    @param[in]  blockSize   number of samples in each vector
+    @param[in]  nPE         number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    uint32_t deciPoint;    // number of fractional bits
+    int32_t *pDst;         // pointer to the output vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+} plp_f32_to_q32_instance;
+
+/** -------------------------------------------------------
+    @struct plp_deinterleave_instance_i32
+    @brief Instance structure for the parallel deinterleaving of a multi-channel 32-bit integer
+           vector.
+    @param[in]  pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]  numChannels  number of channels
+    @param[in]  numSamples   number of samples in each channel
+    @param[out] pDst         points to the planar output, numChannels x numSamples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc;  // pointer to the input vector
+    uint32_t numChannels; // number of channels
+    uint32_t numSamples;  // number of samples in each channel
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t nPE;         // number of processing units
+} plp_deinterleave_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_deinterleave_instance_i16
+    @brief Instance structure for the parallel deinterleaving of a multi-channel 16-bit integer
+           vector.
+    @param[in]  pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]  numChannels  number of channels
+    @param[in]  numSamples   number of samples in each channel
+    @param[out] pDst         points to the planar output, numChannels x numSamples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc;  // pointer to the input vector
+    uint32_t numChannels; // number of channels
+    uint32_t numSamples;  // number of samples in each channel
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t nPE;         // number of processing units
+} plp_deinterleave_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_deinterleave_instance_f32
+    @brief Instance structure for the parallel deinterleaving of a multi-channel 32-bit float
+           vector.
+    @param[in]  pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]  numChannels  number of channels
+    @param[in]  numSamples   number of samples in each channel
+    @param[out] pDst         points to the planar output, numChannels x numSamples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    uint32_t numChannels;  // number of channels
+    uint32_t numSamples;   // number of samples in each channel
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t nPE;          // number of processing units
+} plp_deinterleave_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_interleave_instance_i32
+    @brief Instance structure for the parallel interleaving of a multi-channel 32-bit integer
+           vector.
+    @param[in]  pSrc         points to the planar input, numChannels x numSamples
+    @param[in]  numChannels  number of channels
+    @param[in]  numSamples   number of samples in each channel
+    @param[out] pDst         points to the interleaved output, numSamples x numChannels
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc;  // pointer to the input vector
+    uint32_t numChannels; // number of channels
+    uint32_t numSamples;  // number of samples in each channel
+    int32_t *pDst;        // pointer to the output vector
+    uint32_t nPE;         // number of processing units
+} plp_interleave_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_interleave_instance_i16
+    @brief Instance structure for the parallel interleaving of a multi-channel 16-bit integer
+           vector.
+    @param[in]  pSrc         points to the planar input, numChannels x numSamples
+    @param[in]  numChannels  number of channels
+    @param[in]  numSamples   number of samples in each channel
+    @param[out] pDst         points to the interleaved output, numSamples x numChannels
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc;  // pointer to the input vector
+    uint32_t numChannels; // number of channels
+    uint32_t numSamples;  // number of samples in each channel
+    int16_t *pDst;        // pointer to the output vector
+    uint32_t nPE;         // number of processing units
+} plp_interleave_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_interleave_instance_f32
+    @brief Instance structure for the parallel interleaving of a multi-channel 32-bit float vector.
+    @param[in]  pSrc         points to the planar input, numChannels x numSamples
+    @param[in]  numChannels  number of channels
+    @param[in]  numSamples   number of samples in each channel
+    @param[out] pDst         points to the interleaved output, numSamples x numChannels
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    uint32_t numChannels;  // number of channels
+    uint32_t numSamples;   // number of samples in each channel
+    float32_t *pDst;       // pointer to the output vector
+    uint32_t nPE;          // number of processing units
+} plp_interleave_instance_f32;
+
+/** Minimum number of elements per core of the parallel sort (plp_sort_i32_parallel) */
+#define PLP_SORT_MIN_CHUNK 16
+
+/** -------------------------------------------------------
+    @struct plp_sort_instance_i32
+    @brief Instance structure for the parallel sort of a 32-bit integer vector.
+    @param[in,out] pSrcDst    points to the vector, which is sorted in place
+    @param[in]     blockSize  number of elements in the vector
+    @param[in]     nPE        number of parallel processing units
+*/
+typedef struct {
+    int32_t *pSrcDst;   // pointer to the vector
+    uint32_t blockSize; // number of elements
+    uint32_t nPE;       // number of processing units
+} plp_sort_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_sort_instance_i16
+    @brief Instance structure for the parallel sort of a 16-bit integer vector.
+    @param[in,out] pSrcDst    points to the vector, which is sorted in place
+    @param[in]     blockSize  number of elements in the vector
+    @param[in]     nPE        number of parallel processing units
+*/
+typedef struct {
+    int16_t *pSrcDst;   // pointer to the vector
+    uint32_t blockSize; // number of elements
+    uint32_t nPE;       // number of processing units
+} plp_sort_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_sort_instance_f32
+    @brief Instance structure for the parallel sort of a 32-bit float vector.
+    @param[in,out] pSrcDst    points to the vector, which is sorted in place
+    @param[in]     blockSize  number of elements in the vector
+    @param[in]     nPE        number of parallel processing units
+*/
+typedef struct {
+    float32_t *pSrcDst; // pointer to the vector
+    uint32_t blockSize; // number of elements
+    uint32_t nPE;       // number of processing units
+} plp_sort_instance_f32;
+
+/** Number of samples of the buffer of a ring buffer which keeps size samples */
+#define PLP_RINGBUF_BUFFER_SIZE(size) (2 * (size))
+
+/** -------------------------------------------------------
+    @struct plp_ringbuf_instance_i32
+    @brief Instance structure for the 32-bit integer ring buffer.
+    @param[in]  pBuf        points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+    @param[in]  size        number of samples which are kept
+    @param[in]  head        position in the buffer of the next sample to write
+*/
+typedef struct {
+    int32_t *pBuf; // pointer to the buffer
+    uint32_t size; // number of samples kept
+    uint32_t head; // position of the next sample
+} plp_ringbuf_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_ringbuf_instance_i16
+    @brief Instance structure for the 16-bit integer ring buffer.
+    @param[in]  pBuf        points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+    @param[in]  size        number of samples which are kept
+    @param[in]  head        position in the buffer of the next sample to write
+*/
+typedef struct {
+    int16_t *pBuf; // pointer to the buffer
+    uint32_t size; // number of samples kept
+    uint32_t head; // position of the next sample
+} plp_ringbuf_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_ringbuf_instance_f32
+    @brief Instance structure for the 32-bit floating-point ring buffer.
+    @param[in]  pBuf        points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+    @param[in]  size        number of samples which are kept
+    @param[in]  head        position in the buffer of the next sample to write
+*/
+typedef struct {
+    float32_t *pBuf; // pointer to the buffer
+    uint32_t size;   // number of samples kept
+    uint32_t head;   // position of the next sample
+} plp_ringbuf_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_udma_stream
+    @brief Double buffer, which a peripheral fills frame by frame through the uDMA, with the
+           history of the consumer in front of every frame.
+    @param[in]  pBuf        points to the two buffers of headSize + frameSize bytes each
+    @param[in]  headSize    number of bytes of history in front of every frame
+    @param[in]  frameSize   number of bytes of a frame
+    @param[in]  count       number of frames taken with plp_udma_stream_take
+*/
+typedef struct {
+    uint8_t *pBuf[2];   // the two buffers
+    uint32_t headSize;  // bytes of history in front of a frame
+    uint32_t frameSize; // bytes of a frame
+    uint32_t count;     // number of frames taken
+} plp_udma_stream;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_split_instance_i32
+    @brief Instance structure for the parallel splitting of a complex 32-bit integer vector into
+           real and imaginary parts.
+    @param[in]  pSrc         points to the interleaved complex input vector
+    @param[out] pRe          points to the real parts
+    @param[out] pIm          points to the imaginary parts
+    @param[in]  numSamples   number of complex samples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the input vector
+    int32_t *pRe;        // pointer to the real parts
+    int32_t *pIm;        // pointer to the imaginary parts
+    uint32_t numSamples; // number of samples in each channel
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_split_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_split_instance_i16
+    @brief Instance structure for the parallel splitting of a complex 16-bit integer vector into
+           real and imaginary parts.
+    @param[in]  pSrc         points to the interleaved complex input vector
+    @param[out] pRe          points to the real parts
+    @param[out] pIm          points to the imaginary parts
+    @param[in]  numSamples   number of complex samples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the input vector
+    int16_t *pRe;        // pointer to the real parts
+    int16_t *pIm;        // pointer to the imaginary parts
+    uint32_t numSamples; // number of samples in each channel
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_split_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_split_instance_f32
+    @brief Instance structure for the parallel splitting of a complex 32-bit float vector into real
+           and imaginary parts.
+    @param[in]  pSrc         points to the interleaved complex input vector
+    @param[out] pRe          points to the real parts
+    @param[out] pIm          points to the imaginary parts
+    @param[in]  numSamples   number of complex samples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pSrc; // pointer to the input vector
+    float32_t *pRe;        // pointer to the real parts
+    float32_t *pIm;        // pointer to the imaginary parts
+    uint32_t numSamples;   // number of samples in each channel
+    uint32_t nPE;          // number of processing units
+} plp_cmplx_split_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_merge_instance_i32
+    @brief Instance structure for the parallel merging of real and imaginary 32-bit integer parts
+           into a complex vector.
+    @param[in]  pRe          points to the real parts
+    @param[in]  pIm          points to the imaginary parts
+    @param[out] pDst         points to the interleaved complex output vector
+    @param[in]  numSamples   number of complex samples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int32_t *pRe;  // pointer to the real parts
+    const int32_t *pIm;  // pointer to the imaginary parts
+    int32_t *pDst;       // pointer to the output vector
+    uint32_t numSamples; // number of samples in each channel
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_merge_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_merge_instance_i16
+    @brief Instance structure for the parallel merging of real and imaginary 16-bit integer parts
+           into a complex vector.
+    @param[in]  pRe          points to the real parts
+    @param[in]  pIm          points to the imaginary parts
+    @param[out] pDst         points to the interleaved complex output vector
+    @param[in]  numSamples   number of complex samples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const int16_t *pRe;  // pointer to the real parts
+    const int16_t *pIm;  // pointer to the imaginary parts
+    int16_t *pDst;       // pointer to the output vector
+    uint32_t numSamples; // number of samples in each channel
+    uint32_t nPE;        // number of processing units
+} plp_cmplx_merge_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_merge_instance_f32
+    @brief Instance structure for the parallel merging of real and imaginary 32-bit float parts into
+           a complex vector.
+    @param[in]  pRe          points to the real parts
+    @param[in]  pIm          points to the imaginary parts
+    @param[out] pDst         points to the interleaved complex output vector
+    @param[in]  numSamples   number of complex samples
+    @param[in]  nPE          number of parallel processing units
+*/
+typedef struct {
+    const float32_t *pRe; // pointer to the real parts
+    const float32_t *pIm; // pointer to the imaginary parts
+    float32_t *pDst;      // pointer to the output vector
+    uint32_t numSamples;  // number of samples in each channel
+    uint32_t nPE;         // number of processing units
+} plp_cmplx_merge_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_team_task
+    @brief Parallel kernel recorded in a team.
+    @param[in]  kernel     parallel kernel, called by every core with args
+    @param[in]  args       points to the instance struct of the kernel
+*/
+typedef struct {
+    void (*kernel)(void *); // parallel kernel
+    void *args;             // instance struct of the kernel
+} plp_team_task;
+
+/** -------------------------------------------------------
+    @struct plp_team_instance
+    @brief Instance structure for a chain of parallel kernels, which run with a single fork.
+    @param[in]  pTasks     points to the recorded tasks
+    @param[in]  maxTasks   number of tasks which fit into pTasks
+    @param[in]  numTasks   number of recorded tasks
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    plp_team_task *pTasks; // recorded tasks
+    uint32_t maxTasks;     // size of the task buffer
+    uint32_t numTasks;     // number of recorded tasks
+    uint32_t nPE;          // number of processing units
+} plp_team_instance;
+
+/** -------------------------------------------------------
+    @struct plp_subteam
+    @brief Parallel kernel, which runs on its own subset of the cluster cores next to others.
+    @param[in]  kernel     parallel kernel, called by every core of the sub-team with args
+    @param[in]  args       points to the instance struct of the kernel
+    @param[in]  nPE        number of cores of the sub-team, which must be the nPE of args
+*/
+typedef struct {
+    void (*kernel)(void *); // parallel kernel
+    void *args;             // instance struct of the kernel
+    uint32_t nPE;           // number of cores of the sub-team
+} plp_subteam;
+
+/** -------------------------------------------------------
+    @struct plp_subteams_instance
+    @brief Instance structure for sub-teams, which run concurrently on disjoint cores.
+    @param[in]  pTeams     points to the sub-teams
+    @param[in]  numTeams   number of sub-teams
+*/
+typedef struct {
+    const plp_subteam *pTeams; // sub-teams
+    uint32_t numTeams;         // number of sub-teams
+} plp_subteams_instance;
+
+/** -------------------------------------------------------
+    @brief Function of a pipeline stage, which processes one frame.
+    @param[in]  args       points to the arguments of the stage
+    @param[in]  frame      number of the frame to process
+    @param[in]  coreId     index of the core within the stage, 0 <= coreId < nPE
+    @param[in]  nPE        number of cores of the stage
+*/
+typedef void (*plp_pipeline_fn)(void *args, uint32_t frame, uint32_t coreId, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @struct plp_pipeline_stage
+    @brief Stage of a pipeline.
+    @param[in]  kernel     function which processes one frame
+    @param[in]  args       points to the arguments of the stage
+    @param[in]  nPE        number of cores of the stage
+*/
+typedef struct {
+    plp_pipeline_fn kernel; // function of the stage
+    void *args;             // arguments of the stage
+    uint32_t nPE;           // number of cores of the stage
+} plp_pipeline_stage;
+
+/** -------------------------------------------------------
+    @struct plp_pipeline_instance
+    @brief Instance structure for running a pipeline.
+    @param[in]  pStages    points to the stages
+    @param[in]  numStages  number of stages
+    @param[in]  numFrames  number of frames to process
+*/
+typedef struct {
+    const plp_pipeline_stage *pStages; // stages of the pipeline
+    uint32_t numStages;                // number of stages
+    uint32_t numFrames;                // number of frames
+} plp_pipeline_instance;
+
+/** -------------------------------------------------------
+    @brief Unary element-wise kernel run by plp_stream_apply_unary, e.g. a serial kernel like
+           plp_abs_i32s_xpulpv2 cast to this type.
+    @param[in]  pSrc       points to the input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of elements
+*/
+typedef void (*plp_stream_unary_fn)(const void *pSrc, void *pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Binary element-wise kernel run by plp_stream_apply_binary, e.g. a serial kernel like
+           plp_add_i32s_xpulpv2 cast to this type.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of elements
+*/
+typedef void (*plp_stream_binary_fn)(const void *pSrcA,
+                                     const void *pSrcB,
+                                     void *pDst,
+                                     uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @struct plp_stream_instance
+    @brief Instance structure for streaming an element-wise kernel over vectors in L2.
+    @param[in]  unary      unary kernel, NULL if binary is used
+    @param[in]  binary     binary kernel, NULL if unary is used
+    @param[in]  pSrcA      points to the (first) input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2, NULL for a unary kernel
+    @param[in]  srcSize    size of an input element in bytes
+    @param[in]  dstSize    size of an output element in bytes
+    @param[in]  blockSize  number of elements
+    @param[in]  chunkSize  number of elements of a chunk, a multiple of 4 or blockSize
+    @param[in]  nPE        number of cores
+    @param[in]  pBufA      ping-pong buffers in L1 for the chunks of pSrcA
+    @param[in]  pBufB      ping-pong buffers in L1 for the chunks of pSrcB
+    @param[in]  pBufDst    ping-pong buffers in L1 for the chunks of pDst
+    @param[out] pDst       points to the output vector in L2
+*/
+typedef struct {
+    plp_stream_unary_fn unary;
+    plp_stream_binary_fn binary;
+    const uint8_t *pSrcA;
+    const uint8_t *pSrcB;
+    uint32_t srcSize;
+    uint32_t dstSize;
+    uint32_t blockSize;
+    uint32_t chunkSize;
+    uint32_t nPE;
+    uint8_t *pBufA[2];
+    uint8_t *pBufB[2];
+    uint8_t *pBufDst[2];
+    uint8_t *pDst;
+} plp_stream_instance;
+
+/** Number of pointer-sized words in plp_async_handle for the arguments of the offloaded function */
+#define PLP_ASYNC_ARGS_SIZE 12
+
+/** -------------------------------------------------------
+    @struct plp_async_handle
+    @brief Handle of a function which runs on the cluster, started by the fabric controller.
+    @param[out] call       cluster call of the runtime
+    @param[out] event      event which is triggered at the end of the call, NULL if there is none
+    @param[out] args       storage for the arguments of the library functions with an _async suffix
+*/
+typedef struct {
+    rt_cluster_call_t call;             // cluster call of the runtime
+    rt_event_t *event;                  // end of the call
+    void *args[PLP_ASYNC_ARGS_SIZE];    // arguments of the offloaded function
+} plp_async_handle;
+
+/** -------------------------------------------------------
+    @struct plp_profile_entry
+    @brief Entry of the profiling table, which accumulates the counters of one function.
+    @param[out] name       name of the function
+    @param[out] calls      number of calls
+    @param[out] cycles     accumulated number of cycles
+    @param[out] instr      accumulated number of instructions
+    @param[out] extra      accumulated number of the extra event given to plp_profile_init
+*/
+typedef struct {
+    const char *name; // name of the function
+    uint32_t calls;   // number of calls
+    uint32_t cycles;  // accumulated cycles
+    uint32_t instr;   // accumulated instructions
+    uint32_t extra;   // accumulated extra event
+} plp_profile_entry;
+
+/** -------------------------------------------------------
+    @struct plp_trace_event
+    @brief Event of the timeline trace, see plp_trace_init.
+    @param[out] time       timestamp in cycles of the cluster timer
+    @param[out] type       event, PLP_TRACE_*
+    @param[out] name       name of the kernel for PLP_TRACE_FORK and PLP_TRACE_START, else NULL
+*/
+typedef struct {
+    uint32_t time;    // timestamp
+    uint32_t type;    // event
+    const char *name; // name of the kernel
+} plp_trace_event;
+
+/** -------------------------------------------------------
+    @struct plp_balance_entry
+    @brief Entry of the load balance table, which accumulates the cycles of one parallel kernel,
+    see plp_balance_init.
+    @param[out] name       name of the kernel
+    @param[out] calls      number of forks
+    @param[out] cycles     accumulated cycles from the fork to the join
+    @param[out] busy       accumulated busy cycles of all cores
+    @param[out] wait       accumulated cycles of all cores at barriers and at the join
+    @param[out] maxBusy    accumulated busy cycles of the slowest core of each fork
+    @param[out] meanBusy   accumulated mean busy cycles of the cores of each fork
+*/
+typedef struct {
+    const char *name;  // name of the kernel
+    uint32_t calls;    // number of forks
+    uint32_t cycles;   // accumulated cycles of the forks
+    uint32_t busy;     // accumulated busy cycles
+    uint32_t wait;     // accumulated waiting cycles
+    uint32_t maxBusy;  // accumulated busy cycles of the slowest core
+    uint32_t meanBusy; // accumulated mean busy cycles
+} plp_balance_entry;
+
+/** -------------------------------------------------------
+    @brief Index of a parallel function in the cost table of PLP_AUTO (plp_auto_table.h).
+*/
+#define PLP_AUTO_ID(fn) PLP_AUTO_ID_##fn
+#define PLP_AUTO_ENUM(fn, min2, min4, min8) PLP_AUTO_ID(fn),
+typedef enum { PLP_AUTO_TABLE(PLP_AUTO_ENUM) PLP_AUTO_NUM_IDS } plp_auto_id;
+
+/** -------------------------------------------------------
+    @brief      Glue code for filling a constant value into a 32-bit integer vector.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the widening of an 8-bit integer vector to a 16-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 8
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i8_to_i16(const int8_t *__restrict__ pSrc,
+                   uint32_t shift,
+                   int16_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the widening of an 8-bit integer vector to a 16-bit integer vector for
+                   RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 8
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i8_to_i16s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t shift,
+                           int16_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the widening of an 8-bit integer vector to a 16-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 8
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i8_to_i16s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel widening of an 8-bit integer vector to a 16-bit
+                   integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 8
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_i8_to_i16_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel widening of an 8-bit integer vector to a 16-bit integer vector kernel
+                   for XPULPV2 extension.
+    @param[in]     args       points to the plp_i8_to_i16_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_i8_to_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the widening of an 8-bit integer vector to a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 24
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i8_to_i32(const int8_t *__restrict__ pSrc,
+                   uint32_t shift,
+                   int32_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the widening of an 8-bit integer vector to a 32-bit integer vector for
+                   RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 24
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i8_to_i32s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t shift,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the widening of an 8-bit integer vector to a 32-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 24
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i8_to_i32s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel widening of an 8-bit integer vector to a 32-bit
+                   integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 24
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_i8_to_i32_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel widening of an 8-bit integer vector to a 32-bit integer vector kernel
+                   for XPULPV2 extension.
+    @param[in]     args       points to the plp_i8_to_i32_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_i8_to_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the narrowing of a 16-bit integer vector to an 8-bit integer
+                   vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 15
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i16_to_i8(const int16_t *__restrict__ pSrc,
+                   uint32_t shift,
+                   int8_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the narrowing of a 16-bit integer vector to an 8-bit integer vector
+                   for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 15
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i16_to_i8s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the narrowing of a 16-bit integer vector to an 8-bit integer vector
+                   for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 15
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i16_to_i8s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel narrowing of a 16-bit integer vector to an 8-bit
+                   integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 15
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_i16_to_i8_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel narrowing of a 16-bit integer vector to an 8-bit integer vector kernel
+                   for XPULPV2 extension.
+    @param[in]     args       points to the plp_i16_to_i8_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_i16_to_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the widening of a 16-bit integer vector to a 32-bit integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 16
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i16_to_i32(const int16_t *__restrict__ pSrc,
+                    uint32_t shift,
+                    int32_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the widening of a 16-bit integer vector to a 32-bit integer vector for
+                   RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 16
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i16_to_i32s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the widening of a 16-bit integer vector to a 32-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 16
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i16_to_i32s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t shift,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel widening of a 16-bit integer vector to a 32-bit
+                   integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values left, at most 16
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_i16_to_i32_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t shift,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel widening of a 16-bit integer vector to a 32-bit integer vector kernel
+                   for XPULPV2 extension.
+    @param[in]     args       points to the plp_i16_to_i32_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_i16_to_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the narrowing of a 32-bit integer vector to an 8-bit integer
+                   vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i32_to_i8(const int32_t *__restrict__ pSrc,
+                   uint32_t shift,
+                   int8_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the narrowing of a 32-bit integer vector to an 8-bit integer vector
+                   for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i32_to_i8s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the narrowing of a 32-bit integer vector to an 8-bit integer vector
+                   for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i32_to_i8s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel narrowing of a 32-bit integer vector to an 8-bit
+                   integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_i32_to_i8_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel narrowing of a 32-bit integer vector to an 8-bit integer vector kernel
+                   for XPULPV2 extension.
+    @param[in]     args       points to the plp_i32_to_i8_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_i32_to_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the narrowing of a 32-bit integer vector to a 16-bit integer
+                   vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i32_to_i16(const int32_t *__restrict__ pSrc,
+                    uint32_t shift,
+                    int16_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the narrowing of a 32-bit integer vector to a 16-bit integer vector
+                   for RV32IM extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i32_to_i16s_rv32im(const int32_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the narrowing of a 32-bit integer vector to a 16-bit integer vector
+                   for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_i32_to_i16s_xpulpv2(const int32_t *__restrict__ pSrc,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel narrowing of a 32-bit integer vector to a 16-bit
+                   integer vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     shift      number of bits to shift the values right, at most 31
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_i32_to_i16_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel narrowing of a 32-bit integer vector to a 16-bit integer vector kernel
+                   for XPULPV2 extension.
+    @param[in]     args       points to the plp_i32_to_i16_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_i32_to_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of an 8-bit fixed-point vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_q8_to_f32(const int8_t *__restrict__ pSrc,
+                   uint32_t deciPoint,
+                   float32_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of an 8-bit fixed-point vector to a 32-bit
+                   floating-point vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_q8_to_f32s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            float32_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel conversion of an 8-bit fixed-point vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_q8_to_f32_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            float32_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel conversion of an 8-bit fixed-point vector to a 32-bit floating-point
+                   vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_q8_to_f32_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_q8_to_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 16-bit fixed-point vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_q16_to_f32(const int16_t *__restrict__ pSrc,
+                    uint32_t deciPoint,
+                    float32_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 16-bit fixed-point vector to a 32-bit
+                   floating-point vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_q16_to_f32s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel conversion of a 16-bit fixed-point vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_q16_to_f32_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel conversion of a 16-bit fixed-point vector to a 32-bit floating-point
+                   vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_q16_to_f32_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_q16_to_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 32-bit fixed-point vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_q32_to_f32(const int32_t *__restrict__ pSrc,
+                    uint32_t deciPoint,
+                    float32_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 32-bit fixed-point vector to a 32-bit
+                   floating-point vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_q32_to_f32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel conversion of a 32-bit fixed-point vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the input values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_q32_to_f32_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel conversion of a 32-bit fixed-point vector to a 32-bit floating-point
+                   vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_q32_to_f32_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_q32_to_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 32-bit floating-point vector to an 8-bit
+                   fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_q8(const float32_t *__restrict__ pSrc,
+                   uint32_t deciPoint,
+                   int8_t *__restrict__ pDst,
+                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 32-bit floating-point vector to an 8-bit
+                   fixed-point vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_q8s_xpulpv2(const float32_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel conversion of a 32-bit floating-point vector to an
+                   8-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_f32_to_q8_parallel(const float32_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel conversion of a 32-bit floating-point vector to an 8-bit fixed-point
+                   vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_f32_to_q8_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_f32_to_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 32-bit floating-point vector to a 16-bit
+                   fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_q16(const float32_t *__restrict__ pSrc,
+                    uint32_t deciPoint,
+                    int16_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 32-bit floating-point vector to a 16-bit
+                   fixed-point vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_q16s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel conversion of a 32-bit floating-point vector to a
+                   16-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_f32_to_q16_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel conversion of a 32-bit floating-point vector to a 16-bit fixed-point
+                   vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_f32_to_q16_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_f32_to_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 32-bit floating-point vector to a 32-bit
+                   fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_q32(const float32_t *__restrict__ pSrc,
+                    uint32_t deciPoint,
+                    int32_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 32-bit floating-point vector to a 32-bit
+                   fixed-point vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_q32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel conversion of a 32-bit floating-point vector to a
+                   32-bit fixed-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[in]     deciPoint  number of fractional bits of the output values
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_f32_to_q32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel conversion of a 32-bit floating-point vector to a 32-bit fixed-point
+                   vector kernel for XPULPV2 extension.
+    @param[in]     args       points to the plp_f32_to_q32_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_f32_to_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a half-precision vector to a 32-bit
+                   floating-point vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f16_to_f32(const float16_t *__restrict__ pSrc,
+                    float32_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a half-precision vector to a 32-bit floating-point
+                   vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f16_to_f32s_xpulpv2(const float16_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 32-bit floating-point vector to a
+                   half-precision vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_f16(const float32_t *__restrict__ pSrc,
+                    float16_t *__restrict__ pDst,
+                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 32-bit floating-point vector to a half-precision
+                   vector for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_f16s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             float16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a bfloat16 vector to a 32-bit floating-point
+                   vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_bf16_to_f32(const bfloat16_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a bfloat16 vector to a 32-bit floating-point vector
+                   for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_bf16_to_f32s_xpulpv2(const bfloat16_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the conversion of a 32-bit floating-point vector to a bfloat16
+                   vector.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_bf16(const float32_t *__restrict__ pSrc,
+                     bfloat16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the conversion of a 32-bit floating-point vector to a bfloat16 vector
+                   for XPULPV2 extension.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_f32_to_bf16s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              bfloat16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit integer vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit float vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** Size in bytes of the L1 staging buffer used by the plp_fill_*_dma functions */
+#define PLP_DMA_FILL_BUFFER_SIZE 1024
+
+/** -------------------------------------------------------
+    @brief         Starts the DMA transfer of a 8-bit integer vector between L2 and L1.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_i8_dma_async(const int8_t *__restrict__ pSrc,
+                           int8_t *__restrict__ pDst,
+                           uint32_t blockSize,
+                           int dir,
+                           rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Copies a 8-bit integer vector between L2 and L1 with the DMA and waits until it
+                   is done.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @return        none
+*/
+
+void plp_copy_i8_dma(const int8_t *__restrict__ pSrc,
+                     int8_t *__restrict__ pDst,
+                     uint32_t blockSize,
+                     int dir);
+
+/** -------------------------------------------------------
+    @brief         Starts the 2D DMA transfer of a 8-bit integer matrix between a strided matrix in
+                   L2 and a dense matrix in L1.
+    @param[in]     pSrc       points to the input matrix
+    @param[out]    pDst       points to the output matrix
+    @param[in]     numRows    number of rows to copy
+    @param[in]     numCols    number of samples in each row
+    @param[in]     stride     number of samples between the starts of two rows of the matrix in L2
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_i8_dma_2d_async(const int8_t *__restrict__ pSrc,
+                              int8_t *__restrict__ pDst,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t stride,
+                              int dir,
+                              rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Fills a constant value into a 8-bit integer vector in L2 with the DMA.
+    @param[in]     value      input value to be filled
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_fill_i8_dma(int8_t value,
+                     int8_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Starts the DMA transfer of a 16-bit integer vector between L2 and L1.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_i16_dma_async(const int16_t *__restrict__ pSrc,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            int dir,
+                            rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Copies a 16-bit integer vector between L2 and L1 with the DMA and waits until it
+                   is done.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @return        none
+*/
+
+void plp_copy_i16_dma(const int16_t *__restrict__ pSrc,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize,
+                      int dir);
+
+/** -------------------------------------------------------
+    @brief         Starts the 2D DMA transfer of a 16-bit integer matrix between a strided matrix in
+                   L2 and a dense matrix in L1.
+    @param[in]     pSrc       points to the input matrix
+    @param[out]    pDst       points to the output matrix
+    @param[in]     numRows    number of rows to copy
+    @param[in]     numCols    number of samples in each row
+    @param[in]     stride     number of samples between the starts of two rows of the matrix in L2
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_i16_dma_2d_async(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               uint32_t stride,
+                               int dir,
+                               rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Fills a constant value into a 16-bit integer vector in L2 with the DMA.
+    @param[in]     value      input value to be filled
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_fill_i16_dma(int16_t value,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Starts the DMA transfer of a 32-bit integer vector between L2 and L1.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_i32_dma_async(const int32_t *__restrict__ pSrc,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            int dir,
+                            rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Copies a 32-bit integer vector between L2 and L1 with the DMA and waits until it
+                   is done.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @return        none
+*/
+
+void plp_copy_i32_dma(const int32_t *__restrict__ pSrc,
+                      int32_t *__restrict__ pDst,
+                      uint32_t blockSize,
+                      int dir);
+
+/** -------------------------------------------------------
+    @brief         Starts the 2D DMA transfer of a 32-bit integer matrix between a strided matrix in
+                   L2 and a dense matrix in L1.
+    @param[in]     pSrc       points to the input matrix
+    @param[out]    pDst       points to the output matrix
+    @param[in]     numRows    number of rows to copy
+    @param[in]     numCols    number of samples in each row
+    @param[in]     stride     number of samples between the starts of two rows of the matrix in L2
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_i32_dma_2d_async(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               uint32_t stride,
+                               int dir,
+                               rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Fills a constant value into a 32-bit integer vector in L2 with the DMA.
+    @param[in]     value      input value to be filled
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_fill_i32_dma(int32_t value,
+                      int32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Starts the DMA transfer of a 32-bit float vector between L2 and L1.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_f32_dma_async(const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            int dir,
+                            rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Copies a 32-bit float vector between L2 and L1 with the DMA and waits until it is
+                   done.
+    @param[in]     pSrc       points to the input vector
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @return        none
+*/
+
+void plp_copy_f32_dma(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize,
+                      int dir);
+
+/** -------------------------------------------------------
+    @brief         Starts the 2D DMA transfer of a 32-bit float matrix between a strided matrix in
+                   L2 and a dense matrix in L1.
+    @param[in]     pSrc       points to the input matrix
+    @param[out]    pDst       points to the output matrix
+    @param[in]     numRows    number of rows to copy
+    @param[in]     numCols    number of samples in each row
+    @param[in]     stride     number of samples between the starts of two rows of the matrix in L2
+    @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+    @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+    @return        none
+*/
+
+void plp_copy_f32_dma_2d_async(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               uint32_t stride,
+                               int dir,
+                               rt_dma_copy_t *copy);
+
+/** -------------------------------------------------------
+    @brief         Fills a constant value into a 32-bit float vector in L2 with the DMA.
+    @param[in]     value      input value to be filled
+    @param[out]    pDst       points to the output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_fill_f32_dma(float32_t value,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the deinterleaving of a multi-channel 32-bit integer vector.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_i32(const int32_t *__restrict__ pSrc,
+                          uint32_t numChannels,
+                          uint32_t numSamples,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the deinterleaving of a multi-channel 32-bit integer vector for RV32IM
+                   extension.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                  uint32_t numChannels,
+                                  uint32_t numSamples,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the deinterleaving of a multi-channel 32-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel deinterleaving of a multi-channel 32-bit integer
+                   vector.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_deinterleave_i32_parallel(const int32_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   int32_t *__restrict__ pDst,
+                                   uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the deinterleaving of a multi-channel 32-bit integer vector
+                   for XPULPV2 extension.
+    @param[in]     args         points to the plp_deinterleave_instance_i32 struct initialized by
+                                the glue code
+    @return        none
+*/
+
+void plp_deinterleave_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the deinterleaving of a multi-channel 16-bit integer vector.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_i16(const int16_t *__restrict__ pSrc,
+                          uint32_t numChannels,
+                          uint32_t numSamples,
+                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the deinterleaving of a multi-channel 16-bit integer vector for RV32IM
+                   extension.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                  uint32_t numChannels,
+                                  uint32_t numSamples,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the deinterleaving of a multi-channel 16-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel deinterleaving of a multi-channel 16-bit integer
+                   vector.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_deinterleave_i16_parallel(const int16_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   int16_t *__restrict__ pDst,
+                                   uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the deinterleaving of a multi-channel 16-bit integer vector
+                   for XPULPV2 extension.
+    @param[in]     args         points to the plp_deinterleave_instance_i16 struct initialized by
+                                the glue code
+    @return        none
+*/
+
+void plp_deinterleave_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the deinterleaving of a multi-channel 32-bit float vector.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_f32(const float32_t *__restrict__ pSrc,
+                          uint32_t numChannels,
+                          uint32_t numSamples,
+                          float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the deinterleaving of a multi-channel 32-bit float vector for XPULPV2
+                   extension.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @return        none
+*/
+
+void plp_deinterleave_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel deinterleaving of a multi-channel 32-bit float vector.
+    @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the planar output, numChannels x numSamples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_deinterleave_f32_parallel(const float32_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   float32_t *__restrict__ pDst,
+                                   uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the deinterleaving of a multi-channel 32-bit float vector for
+                   XPULPV2 extension.
+    @param[in]     args         points to the plp_deinterleave_instance_f32 struct initialized by
+                                the glue code
+    @return        none
+*/
+
+void plp_deinterleave_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the interleaving of a multi-channel 32-bit integer vector.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_i32(const int32_t *__restrict__ pSrc,
+                        uint32_t numChannels,
+                        uint32_t numSamples,
+                        int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the interleaving of a multi-channel 32-bit integer vector for RV32IM
+                   extension.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                uint32_t numChannels,
+                                uint32_t numSamples,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the interleaving of a multi-channel 32-bit integer vector for XPULPV2
+                   extension.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel interleaving of a multi-channel 32-bit integer vector.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_interleave_i32_parallel(const int32_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the interleaving of a multi-channel 32-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     args         points to the plp_interleave_instance_i32 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_interleave_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the interleaving of a multi-channel 16-bit integer vector.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t numChannels,
+                        uint32_t numSamples,
+                        int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the interleaving of a multi-channel 16-bit integer vector for RV32IM
+                   extension.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t numChannels,
+                                uint32_t numSamples,
+                                int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the interleaving of a multi-channel 16-bit integer vector for XPULPV2
+                   extension.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel interleaving of a multi-channel 16-bit integer vector.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_interleave_i16_parallel(const int16_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the interleaving of a multi-channel 16-bit integer vector for
+                   XPULPV2 extension.
+    @param[in]     args         points to the plp_interleave_instance_i16 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_interleave_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the interleaving of a multi-channel 32-bit float vector.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t numChannels,
+                        uint32_t numSamples,
+                        float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the interleaving of a multi-channel 32-bit float vector for XPULPV2
+                   extension.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @return        none
+*/
+
+void plp_interleave_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel interleaving of a multi-channel 32-bit float vector.
+    @param[in]     pSrc         points to the planar input, numChannels x numSamples
+    @param[in]     numChannels  number of channels
+    @param[in]     numSamples   number of samples in each channel
+    @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_interleave_f32_parallel(const float32_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the interleaving of a multi-channel 32-bit float vector for
+                   XPULPV2 extension.
+    @param[in]     args         points to the plp_interleave_instance_f32 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_interleave_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the in-place sort of a 32-bit integer vector in ascending order.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_i32(int32_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         In-place sort of a 32-bit integer vector in ascending order for RV32IM extension.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_i32s_rv32im(int32_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         In-place sort of a 32-bit integer vector in ascending order for XPULPV2
+                   extension.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_i32s_xpulpv2(int32_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel in-place sort of a 32-bit integer vector in ascending
+                   order.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_sort_i32_parallel(int32_t *__restrict__ pSrcDst, uint32_t blockSize, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel in-place sort of a 32-bit integer vector in ascending order for XPULPV2
+                   extension.
+    @param[in]     args         points to the plp_sort_instance_i32 struct initialized by the glue
+                                code
+    @return        none
+*/
+
+void plp_sort_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the in-place sort of a 16-bit integer vector in ascending order.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_i16(int16_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         In-place sort of a 16-bit integer vector in ascending order for RV32IM extension.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_i16s_rv32im(int16_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         In-place sort of a 16-bit integer vector in ascending order for XPULPV2
+                   extension.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel in-place sort of a 16-bit integer vector in ascending
+                   order.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_sort_i16_parallel(int16_t *__restrict__ pSrcDst, uint32_t blockSize, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel in-place sort of a 16-bit integer vector in ascending order for XPULPV2
+                   extension.
+    @param[in]     args         points to the plp_sort_instance_i16 struct initialized by the glue
+                                code
+    @return        none
+*/
+
+void plp_sort_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the in-place sort of a 32-bit floating-point vector in ascending
+                   order.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_f32(float32_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         In-place sort of a 32-bit floating-point vector in ascending order for XPULPV2
+                   extension.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @return        none
+*/
+
+void plp_sort_f32s_xpulpv2(float32_t *__restrict__ pSrcDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel in-place sort of a 32-bit floating-point vector in
+                   ascending order.
+    @param[in,out] pSrcDst      points to the vector, which is sorted in place
+    @param[in]     blockSize    number of elements in the vector
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_sort_f32_parallel(float32_t *__restrict__ pSrcDst, uint32_t blockSize, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel in-place sort of a 32-bit floating-point vector in ascending order for
+                   XPULPV2 extension.
+    @param[in]     args         points to the plp_sort_instance_f32 struct initialized by the glue
+                                code
+    @return        none
+*/
+
+void plp_sort_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the top-k selection of a 32-bit integer vector.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_i32(const int32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t k,
+                  uint8_t largest,
+                  int32_t *__restrict__ pDstVal,
+                  uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Top-k selection of a 32-bit integer vector for RV32IM extension.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t k,
+                          uint8_t largest,
+                          int32_t *__restrict__ pDstVal,
+                          uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Top-k selection of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t k,
+                           uint8_t largest,
+                           int32_t *__restrict__ pDstVal,
+                           uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the top-k selection of a 16-bit integer vector.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_i16(const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t k,
+                  uint8_t largest,
+                  int16_t *__restrict__ pDstVal,
+                  uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Top-k selection of a 16-bit integer vector for RV32IM extension.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t k,
+                          uint8_t largest,
+                          int16_t *__restrict__ pDstVal,
+                          uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Top-k selection of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t k,
+                           uint8_t largest,
+                           int16_t *__restrict__ pDstVal,
+                           uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the top-k selection of a 32-bit floating-point vector.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_f32(const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t k,
+                  uint8_t largest,
+                  float32_t *__restrict__ pDstVal,
+                  uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Top-k selection of a 32-bit floating-point vector for XPULPV2 extension.
+    @param[in]     pSrc         points to the input vector
+    @param[in]     blockSize    number of elements in the input vector
+    @param[in]     k            number of elements to select, at most blockSize
+    @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                                the k smallest elements, in ascending order
+    @param[out]    pDstVal      points to the k selected elements
+    @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+    @return        none
+*/
+
+void plp_topk_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t k,
+                           uint8_t largest,
+                           float32_t *__restrict__ pDstVal,
+                           uint32_t *__restrict__ pDstIdx);
+
+/** -------------------------------------------------------
+    @brief         Initialization function for the 32-bit integer ring buffer. All samples are set
+                   to zero.
+    @param[out]    S            points to the 32-bit integer ring buffer instance
+    @param[in]     pBuf         points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+    @param[in]     size         number of samples which are kept, at least 1
+    @return        none
+*/
+
+void plp_ringbuf_init_i32(plp_ringbuf_instance_i32 *S, int32_t *pBuf, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Returns a contiguous view of the most recent samples of the 32-bit integer ring
+                   buffer.
+    @param[in]     S            points to the 32-bit integer ring buffer instance
+    @param[in]     n            number of samples, at most size
+    @return        pointer to the oldest of the last n samples, which are followed by the newer
+                   ones up to the last sample written. The view is valid until the next write.
+*/
+
+int32_t *plp_ringbuf_view_i32(const plp_ringbuf_instance_i32 *S, uint32_t n);
+
+/** -------------------------------------------------------
+    @brief         Glue code for appending a block of samples to the 32-bit integer ring buffer.
+    @param[in,out] S            points to an initialized 32-bit integer ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_i32(plp_ringbuf_instance_i32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Appends a block of samples to the 32-bit integer ring buffer for RV32IM
+                   extension.
+    @param[in,out] S            points to an initialized 32-bit integer ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_i32s_rv32im(plp_ringbuf_instance_i32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Appends a block of samples to the 32-bit integer ring buffer for XPULPV2
+                   extension.
+    @param[in,out] S            points to an initialized 32-bit integer ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_i32s_xpulpv2(plp_ringbuf_instance_i32 *S,
+                                    const int32_t *__restrict__ pSrc,
+                                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for copying the most recent samples of the 32-bit integer ring buffer.
+    @param[in]     S            points to an initialized 32-bit integer ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_i32(const plp_ringbuf_instance_i32 *S,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Copies the most recent samples of the 32-bit integer ring buffer for RV32IM
+                   extension.
+    @param[in]     S            points to an initialized 32-bit integer ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_i32s_rv32im(const plp_ringbuf_instance_i32 *S,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Copies the most recent samples of the 32-bit integer ring buffer for XPULPV2
+                   extension.
+    @param[in]     S            points to an initialized 32-bit integer ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_i32s_xpulpv2(const plp_ringbuf_instance_i32 *S,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Initialization function for the 16-bit integer ring buffer. All samples are set
+                   to zero.
+    @param[out]    S            points to the 16-bit integer ring buffer instance
+    @param[in]     pBuf         points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+    @param[in]     size         number of samples which are kept, at least 1
+    @return        none
+*/
+
+void plp_ringbuf_init_i16(plp_ringbuf_instance_i16 *S, int16_t *pBuf, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Returns a contiguous view of the most recent samples of the 16-bit integer ring
+                   buffer.
+    @param[in]     S            points to the 16-bit integer ring buffer instance
+    @param[in]     n            number of samples, at most size
+    @return        pointer to the oldest of the last n samples, which are followed by the newer
+                   ones up to the last sample written. The view is valid until the next write.
+*/
+
+int16_t *plp_ringbuf_view_i16(const plp_ringbuf_instance_i16 *S, uint32_t n);
+
+/** -------------------------------------------------------
+    @brief         Glue code for appending a block of samples to the 16-bit integer ring buffer.
+    @param[in,out] S            points to an initialized 16-bit integer ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_i16(plp_ringbuf_instance_i16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Appends a block of samples to the 16-bit integer ring buffer for RV32IM
+                   extension.
+    @param[in,out] S            points to an initialized 16-bit integer ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_i16s_rv32im(plp_ringbuf_instance_i16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Appends a block of samples to the 16-bit integer ring buffer for XPULPV2
+                   extension.
+    @param[in,out] S            points to an initialized 16-bit integer ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_i16s_xpulpv2(plp_ringbuf_instance_i16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for copying the most recent samples of the 16-bit integer ring buffer.
+    @param[in]     S            points to an initialized 16-bit integer ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_i16(const plp_ringbuf_instance_i16 *S,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Copies the most recent samples of the 16-bit integer ring buffer for RV32IM
+                   extension.
+    @param[in]     S            points to an initialized 16-bit integer ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_i16s_rv32im(const plp_ringbuf_instance_i16 *S,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Copies the most recent samples of the 16-bit integer ring buffer for XPULPV2
+                   extension.
+    @param[in]     S            points to an initialized 16-bit integer ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_i16s_xpulpv2(const plp_ringbuf_instance_i16 *S,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Initialization function for the 32-bit floating-point ring buffer. All samples
+                   are set to zero.
+    @param[out]    S            points to the 32-bit floating-point ring buffer instance
+    @param[in]     pBuf         points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+    @param[in]     size         number of samples which are kept, at least 1
+    @return        none
+*/
+
+void plp_ringbuf_init_f32(plp_ringbuf_instance_f32 *S, float32_t *pBuf, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Returns a contiguous view of the most recent samples of the 32-bit floating-point
+                   ring buffer.
+    @param[in]     S            points to the 32-bit floating-point ring buffer instance
+    @param[in]     n            number of samples, at most size
+    @return        pointer to the oldest of the last n samples, which are followed by the newer
+                   ones up to the last sample written. The view is valid until the next write.
+*/
+
+float32_t *plp_ringbuf_view_f32(const plp_ringbuf_instance_f32 *S, uint32_t n);
+
+/** -------------------------------------------------------
+    @brief         Glue code for appending a block of samples to the 32-bit floating-point ring
+                   buffer.
+    @param[in,out] S            points to an initialized 32-bit floating-point ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_f32(plp_ringbuf_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Appends a block of samples to the 32-bit floating-point ring buffer for XPULPV2
+                   extension.
+    @param[in,out] S            points to an initialized 32-bit floating-point ring buffer instance
+    @param[in]     pSrc         points to the block of samples
+    @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                                the last size samples are kept.
+    @return        none
+*/
+
+void plp_ringbuf_write_f32s_xpulpv2(plp_ringbuf_instance_f32 *S,
+                                    const float32_t *__restrict__ pSrc,
+                                    uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief         Glue code for copying the most recent samples of the 32-bit floating-point ring
+                   buffer.
+    @param[in]     S            points to an initialized 32-bit floating-point ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_f32(const plp_ringbuf_instance_f32 *S,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Copies the most recent samples of the 32-bit floating-point ring buffer for
+                   XPULPV2 extension.
+    @param[in]     S            points to an initialized 32-bit floating-point ring buffer instance
+    @param[in]     blockSize    number of samples to copy, at most size
+    @param[out]    pDst         points to the output vector, which receives the last blockSize
+                                samples, oldest first
+    @return        none
+*/
+
+void plp_ringbuf_read_f32s_xpulpv2(const plp_ringbuf_instance_f32 *S,
+                                   uint32_t blockSize,
+                                   float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief         Initialization function for the uDMA stream. The history in front of the first
+                   frame is set to zero.
+    @param[out]    S            points to the uDMA stream instance
+    @param[in]     pBuffer      points to a buffer of 2 * (headSize + frameSize) bytes, word
+                                aligned
+    @param[in]     headSize     number of bytes of history in front of every frame, a multiple of
+                                4
+    @param[in]     frameSize    number of bytes of a frame, a multiple of 4
+    @return        none
+*/
+
+void plp_udma_stream_init(plp_udma_stream *S,
+                          void *pBuffer,
+                          uint32_t headSize,
+                          uint32_t frameSize);
+
+/** -------------------------------------------------------
+    @brief         Returns the address to which the peripheral writes a frame. The frames 0 and 1
+                   are enqueued at the start, frame n + 2 after frame n has been processed.
+    @param[in]     S            points to an initialized uDMA stream instance
+    @param[in]     frame        number of the frame
+    @return        address of frameSize bytes for the uDMA transfer of the frame
+*/
+
+void *plp_udma_stream_dst(const plp_udma_stream *S, uint32_t frame);
+
+/** -------------------------------------------------------
+    @brief         Takes the next frame, after its uDMA transfer has finished, and copies its last
+                   headSize bytes in front of the following frame. The frame itself is not copied.
+    @param[in,out] S            points to an initialized uDMA stream instance
+    @return        pointer to the history of headSize bytes, which is followed by the frame. It is
+                   valid until the transfer of frame count + 2 is enqueued.
+*/
+
+void *plp_udma_stream_take(plp_udma_stream *S);
+
+/** -------------------------------------------------------
+    @brief         Returns a contiguous view of the most recent bytes of the uDMA stream, like
+                   plp_ringbuf_view_i32 for a ring buffer.
+    @param[in]     S            points to a uDMA stream instance, from which a frame has been taken
+    @param[in]     n            number of bytes, at most headSize + frameSize
+    @return        pointer to the oldest of the last n bytes up to the end of the last frame taken
+*/
+
+void *plp_udma_stream_view(const plp_udma_stream *S, uint32_t n);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the splitting of a complex 32-bit integer vector into real and
+                   imaginary parts.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_i32(const int32_t *__restrict__ pSrc,
+                         int32_t *__restrict__ pRe,
+                         int32_t *__restrict__ pIm,
+                         uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the splitting of a complex 32-bit integer vector into real and
+                   imaginary parts for RV32IM extension.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 int32_t *__restrict__ pRe,
+                                 int32_t *__restrict__ pIm,
+                                 uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the splitting of a complex 32-bit integer vector into real and
+                   imaginary parts for XPULPV2 extension.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  int32_t *__restrict__ pRe,
+                                  int32_t *__restrict__ pIm,
+                                  uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel splitting of a complex 32-bit integer vector into real
+                   and imaginary parts.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_cmplx_split_i32_parallel(const int32_t *__restrict__ pSrc,
+                                  int32_t *__restrict__ pRe,
+                                  int32_t *__restrict__ pIm,
+                                  uint32_t numSamples,
+                                  uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the splitting of a complex 32-bit integer vector into real
+                   and imaginary parts for XPULPV2 extension.
+    @param[in]     args         points to the plp_cmplx_split_instance_i32 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_cmplx_split_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the splitting of a complex 16-bit integer vector into real and
+                   imaginary parts.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_i16(const int16_t *__restrict__ pSrc,
+                         int16_t *__restrict__ pRe,
+                         int16_t *__restrict__ pIm,
+                         uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the splitting of a complex 16-bit integer vector into real and
+                   imaginary parts for RV32IM extension.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                 int16_t *__restrict__ pRe,
+                                 int16_t *__restrict__ pIm,
+                                 uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the splitting of a complex 16-bit integer vector into real and
+                   imaginary parts for XPULPV2 extension.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pRe,
+                                  int16_t *__restrict__ pIm,
+                                  uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel splitting of a complex 16-bit integer vector into real
+                   and imaginary parts.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_cmplx_split_i16_parallel(const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pRe,
+                                  int16_t *__restrict__ pIm,
+                                  uint32_t numSamples,
+                                  uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the splitting of a complex 16-bit integer vector into real
+                   and imaginary parts for XPULPV2 extension.
+    @param[in]     args         points to the plp_cmplx_split_instance_i16 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_cmplx_split_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the splitting of a complex 32-bit float vector into real and
+                   imaginary parts.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_f32(const float32_t *__restrict__ pSrc,
+                         float32_t *__restrict__ pRe,
+                         float32_t *__restrict__ pIm,
+                         uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the splitting of a complex 32-bit float vector into real and imaginary
+                   parts for XPULPV2 extension.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_split_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pRe,
+                                  float32_t *__restrict__ pIm,
+                                  uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel splitting of a complex 32-bit float vector into real
+                   and imaginary parts.
+    @param[in]     pSrc         points to the interleaved complex input vector
+    @param[out]    pRe          points to the real parts
+    @param[out]    pIm          points to the imaginary parts
+    @param[in]     numSamples   number of complex samples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_cmplx_split_f32_parallel(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pRe,
+                                  float32_t *__restrict__ pIm,
+                                  uint32_t numSamples,
+                                  uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the splitting of a complex 32-bit float vector into real and
+                   imaginary parts for XPULPV2 extension.
+    @param[in]     args         points to the plp_cmplx_split_instance_f32 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_cmplx_split_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the merging of real and imaginary 32-bit integer parts into a
+                   complex vector.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_i32(const int32_t *__restrict__ pRe,
+                         const int32_t *__restrict__ pIm,
+                         int32_t *__restrict__ pDst,
+                         uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the merging of real and imaginary 32-bit integer parts into a complex
+                   vector for RV32IM extension.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_i32s_rv32im(const int32_t *__restrict__ pRe,
+                                 const int32_t *__restrict__ pIm,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the merging of real and imaginary 32-bit integer parts into a complex
+                   vector for XPULPV2 extension.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_i32s_xpulpv2(const int32_t *__restrict__ pRe,
+                                  const int32_t *__restrict__ pIm,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel merging of real and imaginary 32-bit integer parts
+                   into a complex vector.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_cmplx_merge_i32_parallel(const int32_t *__restrict__ pRe,
+                                  const int32_t *__restrict__ pIm,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t numSamples,
+                                  uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the merging of real and imaginary 32-bit integer parts into a
+                   complex vector for XPULPV2 extension.
+    @param[in]     args         points to the plp_cmplx_merge_instance_i32 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_cmplx_merge_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the merging of real and imaginary 16-bit integer parts into a
+                   complex vector.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_i16(const int16_t *__restrict__ pRe,
+                         const int16_t *__restrict__ pIm,
+                         int16_t *__restrict__ pDst,
+                         uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the merging of real and imaginary 16-bit integer parts into a complex
+                   vector for RV32IM extension.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_i16s_rv32im(const int16_t *__restrict__ pRe,
+                                 const int16_t *__restrict__ pIm,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the merging of real and imaginary 16-bit integer parts into a complex
+                   vector for XPULPV2 extension.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_i16s_xpulpv2(const int16_t *__restrict__ pRe,
+                                  const int16_t *__restrict__ pIm,
+                                  int16_t *__restrict__ pDst,
+                                  uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel merging of real and imaginary 16-bit integer parts
+                   into a complex vector.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_cmplx_merge_i16_parallel(const int16_t *__restrict__ pRe,
+                                  const int16_t *__restrict__ pIm,
+                                  int16_t *__restrict__ pDst,
+                                  uint32_t numSamples,
+                                  uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the merging of real and imaginary 16-bit integer parts into a
+                   complex vector for XPULPV2 extension.
+    @param[in]     args         points to the plp_cmplx_merge_instance_i16 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_cmplx_merge_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the merging of real and imaginary 32-bit float parts into a complex
+                   vector.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_f32(const float32_t *__restrict__ pRe,
+                         const float32_t *__restrict__ pIm,
+                         float32_t *__restrict__ pDst,
+                         uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Kernel for the merging of real and imaginary 32-bit float parts into a complex
+                   vector for XPULPV2 extension.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @return        none
+*/
+
+void plp_cmplx_merge_f32s_xpulpv2(const float32_t *__restrict__ pRe,
+                                  const float32_t *__restrict__ pIm,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t numSamples);
+
+/** -------------------------------------------------------
+    @brief         Glue code for the parallel merging of real and imaginary 32-bit float parts into
+                   a complex vector.
+    @param[in]     pRe          points to the real parts
+    @param[in]     pIm          points to the imaginary parts
+    @param[out]    pDst         points to the interleaved complex output vector
+    @param[in]     numSamples   number of complex samples
+    @param[in]     nPE          number of parallel processing units
+    @return        none
+*/
+
+void plp_cmplx_merge_f32_parallel(const float32_t *__restrict__ pRe,
+                                  const float32_t *__restrict__ pIm,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t numSamples,
+                                  uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Parallel kernel for the merging of real and imaginary 32-bit float parts into a
+                   complex vector for XPULPV2 extension.
+    @param[in]     args         points to the plp_cmplx_merge_instance_f32 struct initialized by the
+                                glue code
+    @return        none
+*/
+
+void plp_cmplx_merge_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Starts recording a chain of parallel kernels, which run with a single fork.
+    @param[out]    team       points to the team instance
+    @param[in]     pTasks     points to the buffer for the recorded tasks
+    @param[in]     maxTasks   number of tasks which fit into pTasks
+    @param[in]     nPE        number of parallel processing units
+    @return        none
+*/
+
+void plp_team_begin(plp_team_instance *team,
+                    plp_team_task *pTasks,
+                    uint32_t maxTasks,
+                    uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief         Adds a parallel kernel to the team. The kernel runs on all cores of the team
+                   after the previously added kernels are finished on all cores.
+    @param[in,out] team       points to the team instance
+    @param[in]     kernel     parallel kernel, called by every core with args
+    @param[in]     args       points to the instance struct of the kernel
+    @return        none
+*/
+
+void plp_team_add(plp_team_instance *team, void (*kernel)(void *), void *args);
+
+/** -------------------------------------------------------
+    @brief         Runs all kernels added to the team with a single fork of the cluster cores and
+                   waits until they are finished.
+    @param[in]     team       points to the team instance
+    @return        none
+*/
+
+void plp_team_end(plp_team_instance *team);
+
+/** -------------------------------------------------------
+    @brief         Runs the recorded kernels of a team on every core for XPULPV2 extension.
+    @param[in]     args       points to the plp_team_instance struct
+    @return        none
+*/
+
+void plp_team_p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Runs parallel kernels concurrently on disjoint subsets of the cluster cores, each
+                   with its own barrier, and waits until all of them are finished.
+    @param[in]     pTeams     points to the sub-teams, which get consecutive cores in this order
+    @param[in]     numTeams   number of sub-teams, at most PLP_SUBTEAMS_MAX
+    @return        none
+*/
+
+void plp_subteams_run(const plp_subteam *pTeams, uint32_t numTeams);
+
+/** -------------------------------------------------------
+    @brief         Runs the kernel of the sub-team of every core for XPULPV2 extension.
+    @param[in]     args       points to the plp_subteams_instance struct
+    @return        none
+*/
+
+void plp_subteams_p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for running numFrames frames through a pipeline of stages.
+    @param[in]     pStages    points to the stages, in the order in which a frame passes them
+    @param[in]     numStages  number of stages
+    @param[in]     numFrames  number of frames to process
+    @return        none
+*/
+
+void plp_pipeline_run(const plp_pipeline_stage *pStages, uint32_t numStages, uint32_t numFrames);
+
+/** -------------------------------------------------------
+    @brief         Runs the stage of this core for every frame of the pipeline for XPULPV2
+                   extension.
+    @param[in]     args       points to the plp_pipeline_instance struct initialized by the glue
+                              code
+    @return        none
+*/
+
+void plp_pipeline_p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Glue code for running a unary element-wise kernel over a vector in L2. The
+                   vector is copied into L1 chunk by chunk with the cluster DMA, while the cores
+                   process the previous chunk.
+    @param[in]     kernel     serial kernel of the cluster, called by every core on its part of a
+                              chunk
+    @param[in]     pSrc       points to the input vector in L2
+    @param[in]     srcSize    size of an input element in bytes
+    @param[in]     dstSize    size of an output element in bytes
+    @param[in]     blockSize  number of elements
+    @param[in]     chunkSize  number of elements per chunk, 0 for the whole vector
+    @param[in]     nPE        number of cores, or PLP_AUTO
+    @param[out]    pDst       points to the output vector in L2
+    @return        none
+*/
+
+void plp_stream_apply_unary(plp_stream_unary_fn kernel,
+                            const void *pSrc,
+                            uint32_t srcSize,
+                            uint32_t dstSize,
+                            uint32_t blockSize,
+                            uint32_t chunkSize,
+                            uint32_t nPE,
+                            void *pDst);
+
+/** -------------------------------------------------------
+    @brief         Glue code for running a binary element-wise kernel over two vectors in L2. The
+                   vectors are copied into L1 chunk by chunk with the cluster DMA, while the cores
+                   process the previous chunk.
+    @param[in]     kernel     serial kernel of the cluster, called by every core on its part of a
+                              chunk
+    @param[in]     pSrcA      points to the first input vector in L2
+    @param[in]     pSrcB      points to the second input vector in L2
+    @param[in]     srcSize    size of an input element in bytes
+    @param[in]     dstSize    size of an output element in bytes
+    @param[in]     blockSize  number of elements
+    @param[in]     chunkSize  number of elements per chunk, 0 for the whole vector
+    @param[in]     nPE        number of cores, or PLP_AUTO
+    @param[out]    pDst       points to the output vector in L2
+    @return        none
+*/
+
+void plp_stream_apply_binary(plp_stream_binary_fn kernel,
+                             const void *pSrcA,
+                             const void *pSrcB,
+                             uint32_t srcSize,
+                             uint32_t dstSize,
+                             uint32_t blockSize,
+                             uint32_t chunkSize,
+                             uint32_t nPE,
+                             void *pDst);
+
+/** -------------------------------------------------------
+    @brief         Streams the chunks through L1 and runs the kernel on the part of every core for
+                   XPULPV2 extension.
+    @param[in]     args       points to the plp_stream_instance struct initialized by the glue code
+    @return        none
+*/
+
+void plp_stream_p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief         Starts a function on the cluster, and returns without waiting for it.
+    @param[in]     entry      function, which is called on the master core of the cluster, and may
+                              fork on all cluster cores
+    @param[in]     args       argument of the function, which must stay valid until the call has
+                              finished
+    @param[out]    handle     handle of the call, wait for it with plp_async_wait
+    @return        none
+*/
+
+void plp_async_call(void (*entry)(void *), void *args, plp_async_handle *handle);
+
+/** -------------------------------------------------------
+    @brief         Starts a function on the given cluster, and returns without waiting for it.
+    @param[in]     cid        id of the cluster, which must be mounted with rt_cluster_mount
+    @param[in]     entry      function, which is called on the master core of the cluster, and may
+                              fork on all cores of that cluster
+    @param[in]     args       argument of the function, which must stay valid until the call has
+                              finished
+    @param[out]    handle     handle of the call, wait for it with plp_async_wait
+    @return        none
+*/
+
+void plp_async_call_cluster(uint32_t cid,
+                            void (*entry)(void *),
+                            void *args,
+                            plp_async_handle *handle);
+
+/** -------------------------------------------------------
+    @brief         Waits until a function started with plp_async_call or a library function with an
+                   _async suffix has finished. Returns immediately if the call has already been
+                   waited for.
+    @param[in,out] handle     handle of the call
+    @return        none
+*/
+
+void plp_async_wait(plp_async_handle *handle);
+
+/** -------------------------------------------------------
+    @brief         Computes the share of the fabric controller from the measured cycles of both
+                   sides, such that both finish at the same time.
+    @param[in]     fcCycles       cycles of the function on the fabric controller
+    @param[in]     clusterCycles  cycles of the parallel function on the cluster, for the same size
+    @return        share of the fabric controller in 1/256, between 0 and 256
+*/
+
+uint32_t plp_hetero_share(uint32_t fcCycles, uint32_t clusterCycles);
+
+/** -------------------------------------------------------
+    @brief         Computes the number of elements which are processed by the cluster, at the
+                   beginning of the vector. The rest is processed by the fabric controller.
+    @param[in]     blockSize  number of elements in the vector
+    @param[in]     fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+    @return        number of elements of the cluster, a multiple of 4 or blockSize
+*/
+
+uint32_t plp_hetero_split(uint32_t blockSize, uint32_t fcShare);
+
+/** -------------------------------------------------------
+    @brief         Uses the given buffer for the temporary buffers of the library. Passing NULL
+                   restores the allocation with rt_alloc.
+    @param[in]     pBuffer    points to the buffer, NULL to disable the arena
+    @param[in]     size       size of the buffer in bytes
+    @return        none
+*/
+
+void plp_scratch_init(void *pBuffer, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Allocates a temporary buffer, with the same arguments as rt_alloc.
+    @param[in]     flags      memory in which the buffer is allocated (RT_ALLOC_*)
+    @param[in]     size       size of the buffer in bytes
+    @return        pointer to the buffer, aligned to 4 bytes, or NULL if there is not enough memory
+*/
+
+void *plp_scratch_alloc(int flags, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Frees a temporary buffer, with the same arguments as rt_free. A buffer of the
+                   arena is released together with all buffers allocated after it.
+    @param[in]     flags      memory in which the buffer was allocated (RT_ALLOC_*)
+    @param[in]     pBuffer    points to the buffer
+    @param[in]     size       size of the buffer in bytes
+    @return        none
+*/
+
+void plp_scratch_free(int flags, void *pBuffer, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Allocates a temporary buffer in L1, like plp_scratch_alloc with
+                   RT_ALLOC_CL_DATA, which starts in the given TCDM bank. Buffers which are
+                   accessed at the same time are given different banks.
+    @param[in]     size       size of the buffer in bytes
+    @param[in]     bankOffset bank of the first word of the buffer, modulo PLP_L1_BANKS
+    @return        pointer to the buffer, or NULL if there is not enough memory
+*/
+
+void *plp_l1_alloc(uint32_t size, uint32_t bankOffset);
+
+/** -------------------------------------------------------
+    @brief         Frees a buffer of plp_l1_alloc.
+    @param[in]     pBuffer    points to the buffer
+    @param[in]     size       size of the buffer in bytes
+    @return        none
+*/
+
+void plp_l1_free(void *pBuffer, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Returns the largest number of bytes of the arena that were in use at the same
+                   time since plp_scratch_init.
+    @return        peak usage of the arena in bytes
+*/
+
+uint32_t plp_scratch_peak(void);
+
+/** -------------------------------------------------------
+    @brief         Starts the profiling of the public functions. The counters of every function are
+                   accumulated into the given table, see plp_profile.h.
+    @param[in]     pTable     points to the table, with one entry per profiled function
+    @param[in]     size       number of entries of the table
+    @param[in]     extraEvent event counted in addition to cycles and instructions (RT_PERF_*),
+                              -1 for none
+    @return        none
+*/
+
+void plp_profile_init(plp_profile_entry *pTable, uint32_t size, int extraEvent);
+
+/** -------------------------------------------------------
+    @brief         Resets and starts the performance counters for a call of a function.
+    @param[in]     name       name of the function
+    @return        index of the entry of the function, passed to plp_profile_stop
+*/
+
+uint32_t plp_profile_start(const char *name);
+
+/** -------------------------------------------------------
+    @brief         Stops the performance counters and adds them to the entry of the function.
+    @param[in]     id         index returned by plp_profile_start
+    @return        none
+*/
+
+void plp_profile_stop(uint32_t id);
+
+/** -------------------------------------------------------
+    @brief         Prints the profiling table, one line per function.
+    @return        none
+*/
+
+void plp_profile_dump(void);
+
+/** -------------------------------------------------------
+    @brief         Starts the timeline trace of the parallel functions. The events of each core are
+                   recorded into its own ring buffer, a part of the given buffer, in which the
+                   newest events replace the oldest ones.
+    @param[in]     pBuffer    points to the buffer in L2, NULL to stop the trace
+    @param[in]     size       number of events which fit into the buffer
+    @return        none
+*/
+
+void plp_trace_init(plp_trace_event *pBuffer, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Prints the recorded events in the Chrome trace event format (JSON), which is
+                   opened by chrome://tracing and the Perfetto UI. Every core is a thread of the
+                   timeline.
+    @return        none
+*/
+
+void plp_trace_dump(void);
+
+/** -------------------------------------------------------
+    @brief         Starts measuring the load balance of the parallel kernels. The busy and waiting
+                   cycles of the cores are accumulated per kernel into the given table.
+    @param[in]     pTable     points to the table, with one entry per kernel, NULL to stop
+    @param[in]     size       number of entries of the table
+    @return        none
+*/
+
+void plp_balance_init(plp_balance_entry *pTable, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Prints the load balance table, one line per kernel.
+    @return        none
+*/
+
+void plp_balance_dump(void);
+
+/** -------------------------------------------------------
+    @brief         Returns the imbalance of a kernel: the busy cycles of the slowest core divided by
+                   the mean busy cycles of all cores, summed over all forks.
+    @param[in]     pEntry     points to the entry of the kernel in the load balance table
+    @return        imbalance times 100, at least 100
+*/
+
+uint32_t plp_balance_imbalance(const plp_balance_entry *pEntry);
+
+/** -------------------------------------------------------
+    @brief         Chooses the number of cores of a parallel function for the given problem size,
+                   used when the function is called with nPE = PLP_AUTO.
+    @param[in]     id         index of the function in the cost table, PLP_AUTO_ID(function)
+    @param[in]     size       problem size, in operations of the function
+    @return        number of cores, 1, 2, 4 or 8, at most rt_nb_pe()
+*/
+
+uint32_t plp_auto_npe(plp_auto_id id, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Copies a table from L2 into L1. On the cluster the copy is done with the DMA.
+    @param[in]     pTable     points to the table in L2
+    @param[in]     size       size of the table in bytes
+    @return        pointer to the copy in L1, or NULL if there is not enough memory
+*/
+
+void *plp_table_to_l1(const void *pTable, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief         Releases a table copied with plp_table_to_l1.
+    @param[in]     pTable     points to the copy in L1
+    @param[in]     size       size of the table in bytes
+    @return        none
+*/
+
+void plp_table_free_l1(void *pTable, uint32_t size);
+
+#endif // __PLP_SUPPORT_H__
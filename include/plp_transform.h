@@ -0,0 +1,2489 @@
+/** ==========================================================================
+ * @file     plp_transform.h
+ * @brief    Transform functions of the PULP DSP Library
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_TRANSFORM_H__
+#define __PLP_TRANSFORM_H__
+
+#include "plp_math_common.h"
+#include "plp_fast_math.h"
+
+/*
+ * The fixed-point CFFT kernels read twiddle factor k of the table of an N-point FFT, the cosine
+ * and sine of 2 * pi * k / N for k < 3N/4, with PLP_TWIDDLE_COS_Q16(pTwiddle, k * step) and
+ * PLP_TWIDDLE_SIN_Q16(pTwiddle, k * step), where step = PLP_TWIDDLE_STEP_Q16(N). The XPULPV2
+ * kernels read both as one vector with PLP_TWIDDLE_V2S_Q16. If the library is built with
+ * PLP_QUARTER_WAVE_TABLES (see plp_fast_math.h), the twiddle factors are derived from
+ * sinTable_quarter_q32 and pTwiddle is not used.
+ */
+#if defined(PLP_QUARTER_WAVE_TABLES)
+#define PLP_TWIDDLE_STEP_Q16(N) (4 * PLP_QUARTER_WAVE_SIZE / (N))
+#define PLP_TWIDDLE_COS_Q16(pTwiddle, k)                                                           \
+    ((int16_t)(plp_quarter_sin_q32((k) + PLP_QUARTER_WAVE_SIZE) >> 16))
+#define PLP_TWIDDLE_SIN_Q16(pTwiddle, k) ((int16_t)(plp_quarter_sin_q32(k) >> 16))
+#define PLP_TWIDDLE_V2S_Q16(pTwiddle, k)                                                           \
+    __PACK2(PLP_TWIDDLE_COS_Q16(pTwiddle, k), PLP_TWIDDLE_SIN_Q16(pTwiddle, k))
+#else
+#define PLP_TWIDDLE_STEP_Q16(N) 1U
+#define PLP_TWIDDLE_COS_Q16(pTwiddle, k) ((pTwiddle)[2 * (k)])
+#define PLP_TWIDDLE_SIN_Q16(pTwiddle, k) ((pTwiddle)[2 * (k) + 1])
+#define PLP_TWIDDLE_V2S_Q16(pTwiddle, k) (*(v2s *)&(pTwiddle)[2 * (k)])
+#endif
+
+/**
+ * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT
+ * @param[in]   pTwiddle            points to the Twiddle factor table (not used with
+ *                                  PLP_QUARTER_WAVE_TABLES)
+ * @param[in]   pBitRevTable        points to the bit reversal table
+ * @param[in]   bitRevTableLength   bit reversal table length
+ */
+typedef struct {
+    uint16_t fftLen;             /*< length of the FFT. */
+    const int16_t *pTwiddle;     /*< points to the Twiddle factor table. */
+    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
+    uint16_t bitRevLength;       /*< bit reversal table length. */
+} plp_cfft_instance_q16;
+
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t nPE;
+} plp_cfft_parallel_arg_q16;
+
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
+    uint32_t nChannels;
+    uint32_t channelStride;
+    uint32_t nPE;
+} plp_cfft_batch_arg_q16;
+
+typedef struct {
+    const plp_cfft_instance_q16 *SRow;
+    const plp_cfft_instance_q16 *SCol;
+    int16_t *p1;
+    uint32_t stride;
+    uint8_t bitReverseFlag;
+    uint32_t nPE;
+} plp_fft2d_arg_q16;
+
+/**
+ * @brief Instance structure for the floating-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT, a power of 2
+ * @param[in]   pTwiddle            points to the twiddle factor table of a length N, which is a
+ *                                  multiple of fftLen. It holds the N/2 complex values
+ *                                  \f$W_N^k = e^{-j \frac{2\pi}{N} k}\f$, like the table of
+ *                                  plp_rfft_instance_f32.
+ * @param[in]   pBitRevLUT          points to the bit reversal table of length N (like
+ *                                  bit_rev_radix2_LUT for N=2048), or NULL to compute the indices
+ * @param[in]   tableStride         N/fftLen, the distance between the used entries of the tables
+ */
+typedef struct {
+    uint32_t fftLen;            /*< length of the FFT. */
+    const float32_t *pTwiddle;  /*< points to the Twiddle factor table. */
+    const uint16_t *pBitRevLUT; /*< points to the bit reversal table, or NULL. */
+    uint32_t tableStride;       /*< distance between the used table entries. */
+} plp_cfft_instance_f32;
+
+typedef struct {
+    const plp_cfft_instance_f32 *S;
+    float32_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t nPE;
+} plp_cfft_parallel_arg_f32;
+
+typedef struct {
+    const plp_cfft_instance_f32 *SRow;
+    const plp_cfft_instance_f32 *SCol;
+    float32_t *p1;
+    uint32_t stride;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t nPE;
+} plp_fft2d_arg_f32;
+
+/** -------------------------------------------------------
+    @brief Algorithms of the floating-point FFT (plp_rfft_instance_f32)
+*/
+#define PLP_RFFT_RADIX2 0 // log2(N) radix-2 stages
+#define PLP_RFFT_RADIX4 1 // radix-4 passes, with a final radix-2 stage if log2(N) is odd, N >= 4
+
+/** -------------------------------------------------------
+    @brief Number of float32_t values of the table buffer of plp_rfft_init_f32
+*/
+#define PLP_RFFT_BUFFER_SIZE_F32(FFTLength) (3 * (FFTLength) / 2)
+
+/** -------------------------------------------------------
+    @struct plp_rfft_instance_f32
+    @brief Instance structure for floating-point FFT
+    @param[in]  length data length of the FFT
+    @param[in]  bitReverseFlag  flag that enables (bitReverseFlagR=1) or disables
+    (bitReverseFlagR=0) bit reversal of output
+    @param[in]  pTwiddleFactors pointer to the twiddle factors.
+    These values must be computed using this formula:
+    \f$W_N^k =   e^{-j \frac{\pi}{N} k}\f$,
+    where \f$N\f$ is the data length and \f$k\f$ is the index.
+    The user must provide \f$\frac{N}{2}\f$ values (\f$k = 0 .. \frac{N}{2}-1\f$).
+    @param[in]  pBitRevTable  pointer to the pair table used for the bit reversal of output, or
+    NULL to compute the bit reversed indices on the fly. The table holds the pairs
+    \f$(k, bitreverse(k))\f$ with \f$k < bitreverse(k)\f$ of the complex outputs to swap, like
+    plpBitRevIndexTable_rfft_2048.
+    @param[in]  algorithm  FFT algorithm of the single core version, PLP_RFFT_RADIX2 (the default
+    of zero-initialized instances) or PLP_RFFT_RADIX4. Both use the same twiddle factors and
+    produce the same output. The parallel version always uses radix-2.
+    @param[in]  bitRevLength  number of entries of pBitRevTable, twice the number of pairs.
+    Consumers which accept the output in bit reversed order, such as fast convolution, should set
+    bitReverseFlag to 0 and skip the reordering entirely.
+*/
+typedef struct {
+    uint32_t FFTLength;
+    uint8_t bitReverseFlag;
+    const float32_t *pTwiddleFactors;
+    const uint16_t *pBitRevTable;
+    uint8_t algorithm;
+    uint16_t bitRevLength;
+} plp_rfft_instance_f32;
+
+typedef struct {
+    plp_rfft_instance_f32 *S;
+    const float32_t *pSrc;
+    const uint32_t nPE;
+    float32_t *pDst;
+} plp_rfft_parallel_arg_f32;
+
+typedef struct {
+    const plp_rfft_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t nChannels;
+    uint32_t channelStride;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_rfft_batch_arg_f32;
+
+/**
+   @brief Instance structure for the 16-bit fixed point real FFT.
+   @param[in]  S         points to the complex FFT instance, its length is half the FFT length
+   @param[in]  pTwiddle  points to the N / 2 complex twiddle factors
+                         \f$W_N^k = e^{-j \frac{2\pi}{N} k}\f$ of the split stage in Q1.15 format
+*/
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    const int16_t *pTwiddle;
+} plp_rfft_instance_q16;
+
+/**
+   @brief Instance structure for the 32-bit fixed point real FFT.
+   @param[in]  FFTLength  length of the FFT, a power of two of at least 4
+   @param[in]  pTwiddle   points to the N / 2 complex twiddle factors
+                          \f$W_N^k = e^{-j \frac{2\pi}{N} k}\f$ in Q1.31 format, the even
+                          entries are the twiddle factors of the half length complex FFT
+*/
+typedef struct {
+    uint32_t FFTLength;
+    const int32_t *pTwiddle;
+} plp_rfft_instance_q32;
+
+/**
+   @brief Instance structure for the 32-bit fixed point complex FFT.
+   @param[in]  fftLen    length of the FFT, a power of two of at least 2
+   @param[in]  pTwiddle  points to the N / 2 complex twiddle factors
+                         \f$W_N^k = e^{-j \frac{2\pi}{N} k}\f$ in Q1.31 format
+*/
+typedef struct {
+    uint32_t fftLen;
+    const int32_t *pTwiddle;
+} plp_cfft_instance_q32;
+
+/** Window types of plp_window_init_q16 and plp_window_init_f32 */
+#define PLP_WINDOW_HANN 0
+#define PLP_WINDOW_HAMMING 1
+#define PLP_WINDOW_BLACKMAN 2
+
+/**
+   @brief Number of values of the coefficient buffer of plp_window_init_q16 and
+          plp_window_init_f32 for a window of length samples
+*/
+#define PLP_WINDOW_COEFFS_SIZE(length) (((length) + 3) / 2)
+
+/**
+   @brief Instance structure for the 32-bit floating-point window.
+   @param[in]  length   number of samples of the window
+   @param[in]  mirror   index m, such that the samples n >= length / 2 are pCoeffs[m - n], or 0 if
+                        pCoeffs holds all length samples
+   @param[in]  pCoeffs  points to the coefficients
+*/
+typedef struct {
+    uint32_t length;
+    uint32_t mirror;
+    const float32_t *pCoeffs;
+} plp_window_instance_f32;
+
+/**
+   @brief Instance structure for the 16-bit fixed point window.
+   @param[in]  length   number of samples of the window
+   @param[in]  mirror   index m, such that the samples n >= length / 2 are pCoeffs[m - n], or 0 if
+                        pCoeffs holds all length samples
+   @param[in]  pCoeffs  points to the coefficients in Q1.15 format
+*/
+typedef struct {
+    uint32_t length;
+    uint32_t mirror;
+    const int16_t *pCoeffs;
+} plp_window_instance_q16;
+
+/**
+   @brief Instance structure for the floating-point short-time Fourier transform.
+   @param[in]  S             points to the real FFT instance, its length is the frame length
+   @param[in]  pWindow       points to the window coefficients
+   @param[in]  hopSize       number of samples between two frames
+   @param[in]  pState        points to the ring buffer of the last FFTLength samples
+   @param[in]  pScratch      points to a scratch buffer of 2 * FFTLength floats
+   @param[in]  writeIndex    position of the next sample in the ring buffer
+   @param[in]  hopCount      number of samples since the last frame
+   @param[in]  windowMirror  mirror index of the window (see plp_window_instance_f32)
+*/
+typedef struct {
+    const plp_rfft_instance_f32 *S;
+    const float32_t *pWindow;
+    uint32_t hopSize;
+    float32_t *pState;
+    float32_t *pScratch;
+    uint32_t writeIndex;
+    uint32_t hopCount;
+    uint32_t windowMirror;
+} plp_stft_instance_f32;
+
+/**
+   @brief Instance structure for the 16-bit fixed point short-time Fourier transform.
+   @param[in]  S             points to the complex FFT instance, its length is the frame length
+   @param[in]  pWindow       points to the window coefficients in Q1.15 format
+   @param[in]  hopSize       number of samples between two frames
+   @param[in]  pState        points to the ring buffer of the last fftLen samples
+   @param[in]  pScratch      points to a scratch buffer of 2 * fftLen samples
+   @param[in]  writeIndex    position of the next sample in the ring buffer
+   @param[in]  hopCount      number of samples since the last frame
+   @param[in]  windowMirror  mirror index of the window (see plp_window_instance_q16)
+*/
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    const int16_t *pWindow;
+    uint32_t hopSize;
+    int16_t *pState;
+    int16_t *pScratch;
+    uint32_t writeIndex;
+    uint32_t hopCount;
+    uint32_t windowMirror;
+} plp_stft_instance_q16;
+
+/**
+   @brief Number of values of the scratch buffer of plp_psd_welch_f32 (nPE = 1) and
+          plp_psd_welch_f32_parallel: an FFT buffer for every core, and a sum of the bins for
+          every core except the first
+*/
+#define PLP_PSD_WELCH_SCRATCH_SIZE_F32(FFTLength, nPE)                                             \
+    ((nPE) * 2 * (FFTLength) + ((nPE) - 1) * ((FFTLength) / 2 + 1))
+
+/**
+   @brief Number of 16-bit values of the scratch buffer of plp_psd_welch_q16 (nPE = 1) and
+          plp_psd_welch_q16_parallel: an FFT buffer for every core, and a 32-bit sum of the bins
+          for every core except the first
+*/
+#define PLP_PSD_WELCH_SCRATCH_SIZE_Q16(fftLen, nPE)                                                \
+    ((nPE) * 2 * (fftLen) + ((nPE) - 1) * ((fftLen) + 2))
+
+/**
+   @brief Instance structure for the floating-point Welch power spectral density estimator.
+   @param[in]  S             points to the real FFT instance, its length is the segment length
+   @param[in]  pWindow       points to the window coefficients
+   @param[in]  windowMirror  mirror index of the window (see plp_window_instance_f32)
+   @param[in]  hopSize       number of samples between two segments
+   @param[in]  scale         1 / (FFTLength * energy of the window)
+*/
+typedef struct {
+    const plp_rfft_instance_f32 *S;
+    const float32_t *pWindow;
+    uint32_t windowMirror;
+    uint32_t hopSize;
+    float32_t scale;
+} plp_psd_welch_instance_f32;
+
+/**
+   @brief Instance structure for the 16-bit fixed point Welch power spectral density estimator.
+   @param[in]  S             points to the complex FFT instance, its length is the segment length
+   @param[in]  pWindow       points to the window coefficients in Q1.15 format
+   @param[in]  windowMirror  mirror index of the window (see plp_window_instance_q16)
+   @param[in]  hopSize       number of samples between two segments
+   @param[in]  invEnergy     fftLen / energy of the window in Q16.16 format
+*/
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    const int16_t *pWindow;
+    uint32_t windowMirror;
+    uint32_t hopSize;
+    uint32_t invEnergy;
+} plp_psd_welch_instance_q16;
+
+typedef struct {
+    const plp_psd_welch_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t numSegments;
+    uint32_t nPE;
+    float32_t *pScratch;
+    float32_t *pDst;
+} plp_psd_welch_arg_f32;
+
+typedef struct {
+    const plp_psd_welch_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t numSegments;
+    uint32_t nPE;
+    int16_t *pScratch;
+    int32_t *pDst;
+} plp_psd_welch_arg_q16;
+
+/**
+   @brief Size of the weight buffer of a mel filterbank for an FFT of length FFTLength. Every bin
+   belongs to at most two bands.
+*/
+#define PLP_MEL_COEFFS_SIZE(FFTLength) ((FFTLength) + 2)
+
+/**
+   @brief Instance structure for the floating-point sparse mel filterbank.
+   @param[in]  numBands     number of mel bands
+   @param[in]  pBandStart   points to the first nonzero bin of every band
+   @param[in]  pBandLength  points to the number of nonzero bins of every band
+   @param[in]  pCoeffs      points to the nonzero weights, packed one band after the other
+*/
+typedef struct {
+    uint32_t numBands;
+    const uint16_t *pBandStart;
+    const uint16_t *pBandLength;
+    const float32_t *pCoeffs;
+} plp_mel_filterbank_instance_f32;
+
+/**
+   @brief Instance structure for the 16-bit fixed point sparse mel filterbank.
+   @param[in]  numBands     number of mel bands
+   @param[in]  pBandStart   points to the first nonzero bin of every band
+   @param[in]  pBandLength  points to the number of nonzero bins of every band
+   @param[in]  pCoeffs      points to the nonzero weights in Q1.15 format, packed one band after the
+                            other
+*/
+typedef struct {
+    uint32_t numBands;
+    const uint16_t *pBandStart;
+    const uint16_t *pBandLength;
+    const int16_t *pCoeffs;
+} plp_mel_filterbank_instance_q16;
+
+/**
+   @brief Instance structure for the floating-point mel frequency cepstral coefficients.
+   @param[in]  pFilterbank  points to the mel filterbank instance
+   @param[in]  numCoeffs    number of coefficients
+   @param[in]  pDctCoeffs   points to the DCT-II matrix of numCoeffs rows and numBands columns
+*/
+typedef struct {
+    const plp_mel_filterbank_instance_f32 *pFilterbank;
+    uint32_t numCoeffs;
+    const float32_t *pDctCoeffs;
+} plp_mfcc_instance_f32;
+
+/**
+   @brief Instance structure for the 16-bit fixed point mel frequency cepstral coefficients.
+   @param[in]  pFilterbank  points to the mel filterbank instance
+   @param[in]  numCoeffs    number of coefficients
+   @param[in]  pDctCoeffs   points to the DCT-II matrix of numCoeffs rows and numBands columns in
+                            Q1.15 format
+*/
+typedef struct {
+    const plp_mel_filterbank_instance_q16 *pFilterbank;
+    uint32_t numCoeffs;
+    const int16_t *pDctCoeffs;
+} plp_mfcc_instance_q16;
+
+/**
+   @brief Number of float32_t values of the table buffer of plp_dct2_init_f32
+*/
+#define PLP_DCT2_BUFFER_SIZE_F32(DCTLength) (2 * (DCTLength))
+
+/**
+   @brief Instance structure for the floating-point DCT-II.
+   @param[in]  S         points to the real FFT instance, its length is the DCT length
+   @param[in]  pTwiddle  points to the DCT length complex post-twiddle factors
+                         \f$e^{-j \frac{\pi}{2N} k}\f$
+*/
+typedef struct {
+    const plp_rfft_instance_f32 *S;
+    const float32_t *pTwiddle;
+} plp_dct2_instance_f32;
+
+/**
+   @brief Number of int16_t values of the table buffer of plp_dct4_init_q16
+*/
+#define PLP_DCT4_BUFFER_SIZE_Q16(DCTLength) (2 * (DCTLength))
+
+/**
+   @brief Instance structure for the 16-bit fixed point DCT-IV.
+   @param[in]  S         points to the complex FFT instance, its length is half the DCT length
+   @param[in]  pTwiddle  points to the N / 2 complex pre-twiddle factors
+                         \f$e^{-j \frac{\pi}{N} (n + \frac{1}{4})}\f$, followed by the N / 2
+                         complex post-twiddle factors \f$e^{-j \frac{\pi}{N} k}\f$, in Q1.15
+                         format
+*/
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    const int16_t *pTwiddle;
+} plp_dct4_instance_q16;
+
+/**
+   @brief Number of values of the coefficient buffer of plp_goertzel_init_q16 and
+          plp_goertzel_init_f32
+*/
+#define PLP_GOERTZEL_BUFFER_SIZE(numBins) (2 * (numBins))
+
+/**
+   @brief Instance structure for the 16-bit fixed point Goertzel algorithm.
+   @param[in]  numBins  number of bins
+   @param[in]  pCoeffs  points to cos(w) and sin(w) of every bin in Q1.30 format
+*/
+typedef struct {
+    uint32_t numBins;
+    const int32_t *pCoeffs;
+} plp_goertzel_instance_q16;
+
+/**
+   @brief Instance structure for the 32-bit floating-point Goertzel algorithm.
+   @param[in]  numBins  number of bins
+   @param[in]  pCoeffs  points to cos(w) and sin(w) of every bin
+*/
+typedef struct {
+    uint32_t numBins;
+    const float32_t *pCoeffs;
+} plp_goertzel_instance_f32;
+
+/**
+   @brief Damping factor r of the twiddle factors of the sliding DFT, which keeps the recursion
+          stable
+*/
+#define PLP_SDFT_DAMPING 0.99999f
+
+/**
+   @brief Instance structure for the 16-bit fixed point sliding DFT.
+   @param[in]  length   length N of the DFT window
+   @param[in]  numBins  number of bins
+   @param[in]  pCoeffs  points to the damped twiddle factors r e^(j 2 pi k / N) of the bins in
+                        Q1.30 format
+   @param[in]  damping  r^N in Q1.30 format
+   @param[in]  pState   points to the complex bins
+   @param[in]  pDelay   points to the circular buffer of the last N input samples
+   @param[in]  index    position of the oldest sample in the delay line
+*/
+typedef struct {
+    uint32_t length;
+    uint32_t numBins;
+    const int32_t *pCoeffs;
+    int32_t damping;
+    int32_t *pState;
+    int16_t *pDelay;
+    uint32_t index;
+} plp_sdft_instance_q16;
+
+/**
+   @brief Instance structure for the 32-bit floating-point sliding DFT.
+   @param[in]  length   length N of the DFT window
+   @param[in]  numBins  number of bins
+   @param[in]  pCoeffs  points to the damped twiddle factors r e^(j 2 pi k / N) of the bins
+   @param[in]  damping  r^N
+   @param[in]  pState   points to the complex bins
+   @param[in]  pDelay   points to the circular buffer of the last N input samples
+   @param[in]  index    position of the oldest sample in the delay line
+*/
+typedef struct {
+    uint32_t length;
+    uint32_t numBins;
+    const float32_t *pCoeffs;
+    float32_t damping;
+    float32_t *pState;
+    float32_t *pDelay;
+    uint32_t index;
+} plp_sdft_instance_f32;
+
+/**
+   @brief Maximum number of stages of the mixed-radix complex FFT
+*/
+#define PLP_CFFT_MR_MAX_STAGES 16
+
+/**
+   @brief Number of values of the twiddle buffer of plp_cfft_mr_init_q16 and plp_cfft_mr_init_f32
+*/
+#define PLP_CFFT_MR_BUFFER_SIZE(fftLen) (2 * (fftLen))
+
+/**
+   @brief Instance structure for the 16-bit fixed point mixed-radix complex FFT.
+   @param[in]  fftLen     length of the FFT, of the form 2^a 3^b 5^c
+   @param[in]  numStages  number of stages
+   @param[in]  radix      radix (2, 3, 4 or 5) of every stage
+   @param[in]  pTwiddle   points to cos(2 pi t / fftLen) and sin(2 pi t / fftLen) for
+                          t = 0 .. fftLen - 1 in Q1.15 format
+*/
+typedef struct {
+    uint32_t fftLen;
+    uint32_t numStages;
+    uint8_t radix[PLP_CFFT_MR_MAX_STAGES];
+    const int16_t *pTwiddle;
+} plp_cfft_mr_instance_q16;
+
+/**
+   @brief Instance structure for the 32-bit floating-point mixed-radix complex FFT.
+   @param[in]  fftLen     length of the FFT, of the form 2^a 3^b 5^c
+   @param[in]  numStages  number of stages
+   @param[in]  radix      radix (2, 3, 4 or 5) of every stage
+   @param[in]  pTwiddle   points to cos(2 pi t / fftLen) and sin(2 pi t / fftLen) for
+                          t = 0 .. fftLen - 1
+*/
+typedef struct {
+    uint32_t fftLen;
+    uint32_t numStages;
+    uint8_t radix[PLP_CFFT_MR_MAX_STAGES];
+    const float32_t *pTwiddle;
+} plp_cfft_mr_instance_f32;
+
+/**
+   @brief Number of values of the table buffer of plp_czt_init_f32, for N input samples, M output
+          points and a CFFT of length L
+*/
+#define PLP_CZT_BUFFER_SIZE(N, M, L) (2 * ((N) + (M) + (L)))
+
+/**
+   @brief Instance structure for the floating-point chirp-z transform.
+   @param[in]  N        number of complex input samples
+   @param[in]  M        number of output points
+   @param[in]  S        points to the mixed-radix CFFT instance of length L >= N + M - 1
+   @param[in]  pPre     points to the N complex input chirp exp(-j pi (2 f0 n + df n^2))
+   @param[in]  pPost    points to the M complex output chirp exp(-j pi df k^2)
+   @param[in]  pFilter  points to the L complex values of the spectrum of the chirp filter
+*/
+typedef struct {
+    uint32_t N;
+    uint32_t M;
+    const plp_cfft_mr_instance_f32 *S;
+    const float32_t *pPre;
+    const float32_t *pPost;
+    const float32_t *pFilter;
+} plp_czt_instance_f32;
+
+/**
+   @brief Number of decimated samples, which the zoom FFT computes per call of the decimators
+*/
+#define PLP_ZOOM_FFT_CHUNK 8
+
+/**
+   @brief Size of each of the two decimator state buffers of the zoom FFT
+*/
+#define PLP_ZOOM_FFT_STATE_SIZE(numTaps, D) ((numTaps) + PLP_ZOOM_FFT_CHUNK * (D) - 1)
+
+/**
+   @brief Size of the scratch buffer of plp_zoom_fft_f32
+*/
+#define PLP_ZOOM_FFT_SCRATCH_SIZE(fftLen, D)                                                       \
+    ((2 * (fftLen) > 2 * PLP_ZOOM_FFT_CHUNK * (D)) ? 2 * (fftLen) : 2 * PLP_ZOOM_FFT_CHUNK * (D))
+
+/**
+   @brief Instance structure for the floating-point zoom FFT. The decimators are described by their
+          fields, since the FIR decimator instance is declared in plp_filtering.h.
+   @param[in]  D        decimation factor
+   @param[in]  numTaps  number of coefficients of the low-pass filter
+   @param[in]  pCoeffs  points to the coefficients of the low-pass filter, in time-reversed order
+   @param[in]  pStateI  points to the state buffer of the in-phase decimator
+   @param[in]  pStateQ  points to the state buffer of the quadrature decimator
+   @param[in]  pMixer   points to exp(-j 2 pi fc i) for i = 0 .. D - 1
+   @param[in]  step     rotation of the mixer phase by one block of D samples
+   @param[in]  phase    current mixer phase at the start of a block
+   @param[in]  S        points to the mixed-radix CFFT instance
+*/
+typedef struct {
+    uint32_t D;
+    uint32_t numTaps;
+    const float32_t *pCoeffs;
+    float32_t *pStateI;
+    float32_t *pStateQ;
+    const float32_t *pMixer;
+    float32_t step[2];
+    float32_t phase[2];
+    const plp_cfft_mr_instance_f32 *S;
+} plp_zoom_fft_instance_f32;
+
+typedef struct {
+    float32_t re;
+    float32_t im;
+} Complex_type_f32;
+
+/**
+  @brief      In-place 16 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
+                                const uint16_t bitRevLen,
+                                const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 16 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16v_xpulpv2(uint16_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.15 -> Q5.11
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16(const plp_cfft_instance_q16 *S,
+                  int16_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag,
+                  uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                          int16_t *p1,
+                          uint8_t ifftFlag,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform of strided data for XPULPV2
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1           points to the first complex sample, sample k is at
+ * <code>p1 + 2*k*stride</code>. Processing occurs in-place.
+ * @param[in]  stride          distance between the complex samples, e.g. the row stride of a
+ * matrix for the transform of a column
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_stride_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint32_t stride,
+                                  uint8_t ifftFlag,
+                                  uint8_t bitReverseFlag,
+                                  uint32_t deciPoint);
+
+/**
+ * @brief         Glue code for quantized 16 bit complex fast fourier transform with block
+ *                floating point scaling
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ *                                in Q1.15 format. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e of the output: the DFT, or the inverse DFT, is the output
+ *                multiplied by 2^e
+ */
+
+int32_t plp_cfft_bfp_q16(const plp_cfft_instance_q16 *S,
+                         int16_t *p1,
+                         uint8_t ifftFlag,
+                         uint8_t bitReverseFlag);
+
+/**
+ * @brief         Quantized 16 bit complex fast fourier transform with block floating point scaling
+ *                for RV32IM
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ *                                in Q1.15 format. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e of the output: the DFT, or the inverse DFT, is the output
+ *                multiplied by 2^e
+ */
+
+int32_t plp_cfft_bfp_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                 int16_t *p1,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag);
+
+/**
+ * @brief         Quantized 16 bit complex fast fourier transform with block floating point scaling
+ *                for XPULPV2
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ *                                in Q1.15 format. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e of the output: the DFT, or the inverse DFT, is the output
+ *                multiplied by 2^e
+ */
+
+int32_t plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint8_t ifftFlag,
+                                  uint8_t bitReverseFlag);
+
+/**
+ * @brief      Glue code for parallel quantized 16 bit complex fast fourier transform
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[in]  nPE             number of parallel processing units
+ */
+
+void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint,
+                           uint32_t nPE);
+
+/**
+ * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to a plp_cfft_parallel_arg_q16 struct
+ */
+
+void plp_cfft_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform of a batch of
+ * channels
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer, channel c starts at
+ * <code>p1 + 2*c*channelStride</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[in]  nChannels       number of channels
+ * @param[in]  channelStride   distance between the channels in complex samples, at least fftLen
+ * @param[in]  nPE             number of parallel processing units
+ */
+
+void plp_cfft_q16_batch(const plp_cfft_instance_q16 *S,
+                        int16_t *p1,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        uint32_t nChannels,
+                        uint32_t channelStride,
+                        uint32_t nPE);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform of a batch of channels for XPULPV2
+ * @param[in]  args  points to a plp_cfft_batch_arg_q16 struct
+ */
+
+void plp_cfft_q16_batch_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform of a batch of
+ * channels, which is split across several clusters
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure, in L2
+ * @param[in,out] p1              points to the complex data buffer in L2, channel c starts at
+ * <code>p1 + 2*c*channelStride</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[in]  nChannels       number of channels
+ * @param[in]  channelStride   distance between the channels in complex samples, at least fftLen
+ * @param[in]  nClusters       number of clusters, which must be mounted
+ * @param[in]  nPE             number of parallel processing units on every cluster
+ */
+
+void plp_cfft_q16_batch_multi(const plp_cfft_instance_q16 *S,
+                              int16_t *p1,
+                              uint8_t ifftFlag,
+                              uint8_t bitReverseFlag,
+                              uint32_t deciPoint,
+                              uint32_t nChannels,
+                              uint32_t channelStride,
+                              uint32_t nClusters,
+                              uint32_t nPE);
+
+/** -------------------------------------------------------
+ * @brief      Glue code for floating-point complex fast fourier transform
+ * @param[in]  S               points to an instance of the floating-point CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform. The inverse transform is scaled by 1/fftLen.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ */
+
+void plp_cfft_f32(const plp_cfft_instance_f32 *S,
+                  float32_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag);
+
+/**
+ * @brief      Glue code for parallel floating-point complex fast fourier transform
+ * @param[in]  S               points to an instance of the floating-point CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform. The inverse transform is scaled by 1/fftLen.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  nPE             number of parallel processing units
+ */
+
+void plp_cfft_f32_parallel(const plp_cfft_instance_f32 *S,
+                           float32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t nPE);
+
+/**
+ * @brief      Floating-point complex fast fourier transform for XPULPV2
+ * @param[in]  S               points to an instance of the floating-point CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ */
+
+void plp_cfft_f32s_xpulpv2(const plp_cfft_instance_f32 *S,
+                           float32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag);
+
+/**
+ * @brief      Floating-point complex fast fourier transform of strided data for XPULPV2
+ * @param[in]  S               points to an instance of the floating-point CFFT structure
+ * @param[in,out] p1           points to the first complex sample, sample k is at
+ * <code>p1 + 2*k*stride</code>. Processing occurs in-place.
+ * @param[in]  stride          distance between the complex samples, e.g. the row stride of a
+ * matrix for the transform of a column
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ */
+
+void plp_cfft_stride_f32s_xpulpv2(const plp_cfft_instance_f32 *S,
+                                  float32_t *p1,
+                                  uint32_t stride,
+                                  uint8_t ifftFlag,
+                                  uint8_t bitReverseFlag);
+
+/**
+ * @brief      Glue code for the FFT-based floating-point analytic signal.
+ * @param[in]   S     points to an instance of the floating-point complex FFT structure, whose
+ *                    length N is the length of the signal
+ * @param[in]   pSrc  points to the N real input samples
+ * @param[out]  pDst  points to the 2 * N values of the analytic signal, real and imaginary part
+ *                    interleaved, where the real part is the input and the imaginary part its
+ *                    Hilbert transform
+ * @return      none
+ */
+
+void plp_analytic_f32(const plp_cfft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst);
+
+/**
+ * @brief      FFT-based floating-point analytic signal for XPULPV2 extension.
+ * @param[in]   S     points to an instance of the floating-point complex FFT structure, whose
+ *                    length N is the length of the signal
+ * @param[in]   pSrc  points to the N real input samples
+ * @param[out]  pDst  points to the 2 * N values of the analytic signal, real and imaginary part
+ *                    interleaved, where the real part is the input and the imaginary part its
+ *                    Hilbert transform
+ * @return      none
+ */
+
+void plp_analytic_f32s_xpulpv2(const plp_cfft_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst);
+
+/**
+ * @brief      Parallel floating-point complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to a plp_cfft_parallel_arg_f32 struct
+ */
+
+void plp_cfft_f32p_xpulpv2(void *args);
+
+/**
+ * @brief         Glue code for the parallel 16-bit fixed point two-dimensional FFT
+ * @param[in]     SRow            points to the CFFT instance of the rows, its length is the number
+ *                                of columns
+ * @param[in]     SCol            points to the CFFT instance of the columns, its length is the
+ *                                number of rows
+ * @param[in,out] p1              points to the complex matrix, row-major with real and imaginary
+ *                                parts interleaved. Processing occurs in-place.
+ * @param[in]     stride          distance between the rows in complex samples, at least the
+ *                                number of columns
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output in both dimensions.
+ * @param[in]     nPE             number of parallel processing units
+ * @return        none
+ */
+
+void plp_fft2d_q16(const plp_cfft_instance_q16 *SRow,
+                   const plp_cfft_instance_q16 *SCol,
+                   int16_t *p1,
+                   uint32_t stride,
+                   uint8_t bitReverseFlag,
+                   uint32_t nPE);
+
+/**
+ * @brief      Parallel 16-bit fixed point two-dimensional FFT for XPULPV2
+ * @param[in]  args  points to a plp_fft2d_arg_q16 struct
+ * @return     none
+ */
+
+void plp_fft2d_q16p_xpulpv2(void *args);
+
+/**
+ * @brief         Glue code for the parallel floating-point two-dimensional FFT
+ * @param[in]     SRow            points to the CFFT instance of the rows, its length is the number
+ *                                of columns
+ * @param[in]     SCol            points to the CFFT instance of the columns, its length is the
+ *                                number of rows
+ * @param[in,out] p1              points to the complex matrix, row-major with real and imaginary
+ *                                parts interleaved. Processing occurs in-place.
+ * @param[in]     stride          distance between the rows in complex samples, at least the
+ *                                number of columns
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform. The inverse transform is scaled by 1/(rows*cols).
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output in both dimensions.
+ * @param[in]     nPE             number of parallel processing units
+ * @return        none
+ */
+
+void plp_fft2d_f32(const plp_cfft_instance_f32 *SRow,
+                   const plp_cfft_instance_f32 *SCol,
+                   float32_t *p1,
+                   uint32_t stride,
+                   uint8_t ifftFlag,
+                   uint8_t bitReverseFlag,
+                   uint32_t nPE);
+
+/**
+ * @brief      Parallel floating-point two-dimensional FFT for XPULPV2
+ * @param[in]  args  points to a plp_fft2d_arg_f32 struct
+ * @return     none
+ */
+
+void plp_fft2d_f32p_xpulpv2(void *args);
+
+/**
+ * @brief         Initialization of the 16-bit fixed-point mixed-radix CFFT instance, which
+ *                factors the length into stages of radix 4, 2, 3 and 5 and computes the twiddle
+ *                factors.
+ * @param[out]    S         points to an instance of the 16-bit mixed-radix CFFT structure
+ * @param[in]     fftLen    length of the transform, of the form 2^a 3^b 5^c
+ * @param[out]    pTwiddle  points to a buffer of PLP_CFFT_MR_BUFFER_SIZE(fftLen) values, which
+ *                          holds cos(2 pi t / fftLen) and sin(2 pi t / fftLen) in Q1.15 format,
+ *                          and must stay valid as long as the instance is used
+ * @return        0: Success, 1: fftLen has a prime factor other than 2, 3 and 5, or needs more
+ *                than PLP_CFFT_MR_MAX_STAGES stages
+ */
+
+int plp_cfft_mr_init_q16(plp_cfft_mr_instance_q16 *S,
+                         uint32_t fftLen,
+                         int16_t *pTwiddle);
+
+/**
+ * @brief         Glue code for the 16-bit fixed-point mixed-radix complex FFT, for any length
+ *                of the form 2^a 3^b 5^c, e.g. 600, 1536, 8192 or 16384
+ * @param[in]     S         points to an instance of the 16-bit mixed-radix CFFT structure,
+ *                          initialized by plp_cfft_mr_init_q16
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen in Q1.15
+ *                          format, which is transformed in place. The output is in natural
+ *                          order.
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform.
+ * @return        none
+ */
+
+void plp_cfft_mr_q16(const plp_cfft_mr_instance_q16 *S,
+                     int16_t *p1,
+                     int16_t *pScratch,
+                     uint8_t ifftFlag);
+
+/**
+ * @brief         Mixed-radix 16-bit fixed-point complex FFT for RV32IM.
+ * @param[in]     S         points to an instance of the 16-bit mixed-radix CFFT structure
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place, in natural order
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform
+ * @return        none
+ */
+
+void plp_cfft_mr_q16s_rv32im(const plp_cfft_mr_instance_q16 *S,
+                             int16_t *p1,
+                             int16_t *pScratch,
+                             uint8_t ifftFlag);
+
+/**
+ * @brief         Mixed-radix 16-bit fixed-point complex FFT for XPULPV2 extension.
+ * @param[in]     S         points to an instance of the 16-bit mixed-radix CFFT structure
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place, in natural order
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform
+ * @return        none
+ */
+
+void plp_cfft_mr_q16s_xpulpv2(const plp_cfft_mr_instance_q16 *S,
+                              int16_t *p1,
+                              int16_t *pScratch,
+                              uint8_t ifftFlag);
+
+/**
+ * @brief         Initialization of the floating-point mixed-radix CFFT instance, which factors the
+ *                length into stages of radix 4, 2, 3 and 5 and computes the twiddle factors.
+ * @param[out]    S         points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in]     fftLen    length of the transform, of the form 2^a 3^b 5^c
+ * @param[out]    pTwiddle  points to a buffer of PLP_CFFT_MR_BUFFER_SIZE(fftLen) values, which
+ *                          holds cos(2 pi t / fftLen) and sin(2 pi t / fftLen),
+ *                          and must stay valid as long as the instance is used
+ * @return        0: Success, 1: fftLen has a prime factor other than 2, 3 and 5, or needs more
+ *                than PLP_CFFT_MR_MAX_STAGES stages
+ */
+
+int plp_cfft_mr_init_f32(plp_cfft_mr_instance_f32 *S,
+                         uint32_t fftLen,
+                         float32_t *pTwiddle);
+
+/**
+ * @brief         Glue code for the floating-point mixed-radix complex FFT, for any length of the
+ *                form 2^a 3^b 5^c, e.g. 600, 1536, 8192 or 16384
+ * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure,
+ *                          initialized by plp_cfft_mr_init_f32
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place. The output is in natural order.
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform. The inverse transform is scaled by 1 / fftLen.
+ * @return        none
+ */
+
+void plp_cfft_mr_f32(const plp_cfft_mr_instance_f32 *S,
+                     float32_t *p1,
+                     float32_t *pScratch,
+                     uint8_t ifftFlag);
+
+/**
+ * @brief         Mixed-radix floating-point complex FFT for XPULPV2 extension.
+ * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place, in natural order
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform. The inverse transform is scaled by 1 / fftLen.
+ * @return        none
+ */
+
+void plp_cfft_mr_f32s_xpulpv2(const plp_cfft_mr_instance_f32 *S,
+                              float32_t *p1,
+                              float32_t *pScratch,
+                              uint8_t ifftFlag);
+
+/**
+ * @brief         Initialization of the floating-point chirp-z transform instance, which computes
+ *                the chirps and the spectrum of the convolution filter.
+ * @param[out]    S         points to an instance of the floating-point CZT structure
+ * @param[in]     N         number of complex input samples
+ * @param[in]     M         number of output points
+ * @param[in]     f0        normalized frequency of the first output point, in cycles per sample
+ * @param[in]     df        normalized frequency step between the output points
+ * @param[in]     pCfft     points to an initialized mixed-radix CFFT instance of length
+ *                          L >= N + M - 1, which must stay valid as long as the instance is used
+ * @param[out]    pBuffer   points to a buffer of PLP_CZT_BUFFER_SIZE(N, M, L) values for the
+ *                          tables, which must stay valid as long as the instance is used
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * L
+ * @return        0: Success, 1: the length of the CFFT is smaller than N + M - 1
+ */
+
+int plp_czt_init_f32(plp_czt_instance_f32 *S,
+                     uint32_t N,
+                     uint32_t M,
+                     float32_t f0,
+                     float32_t df,
+                     const plp_cfft_mr_instance_f32 *pCfft,
+                     float32_t *pBuffer,
+                     float32_t *pScratch);
+
+/**
+ * @brief         Glue code for the floating-point chirp-z transform.
+ * @param[in]     S         points to an instance of the floating-point CZT structure, initialized
+ *                          by plp_czt_init_f32
+ * @param[in]     pSrc      points to the N complex input samples
+ * @param[out]    pDst      points to the M complex output points
+ * @param[out]    pScratch  points to a scratch buffer of size 4 * L
+ * @return        none
+ */
+
+void plp_czt_f32(const plp_czt_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 float32_t *__restrict__ pDst,
+                 float32_t *__restrict__ pScratch);
+
+/**
+ * @brief         Floating-point chirp-z transform for XPULPV2 extension.
+ * @param[in]     S         points to an instance of the floating-point CZT structure
+ * @param[in]     pSrc      points to the N complex input samples
+ * @param[out]    pDst      points to the M complex output points
+ * @param[out]    pScratch  points to a scratch buffer of size 4 * L
+ * @return        none
+ */
+
+void plp_czt_f32s_xpulpv2(const plp_czt_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pDst,
+                          float32_t *__restrict__ pScratch);
+
+/**
+ * @brief         Initialization of the floating-point zoom FFT instance.
+ * @param[out]    S         points to an instance of the floating-point zoom FFT structure
+ * @param[in]     fc        normalized center frequency of the band, in cycles per input sample
+ * @param[in]     D         decimation factor, the band has a width of 1 / D
+ * @param[in]     numTaps   number of coefficients of the low-pass filter
+ * @param[in]     pCoeffs   points to the coefficients of the low-pass filter, in time-reversed
+ *                          order, with a cutoff frequency below 1 / (2 D)
+ * @param[in]     pStateI   points to the state buffer of the in-phase decimator of size
+ *                          PLP_ZOOM_FFT_STATE_SIZE(numTaps, D)
+ * @param[in]     pStateQ   points to the state buffer of the quadrature decimator of size
+ *                          PLP_ZOOM_FFT_STATE_SIZE(numTaps, D)
+ * @param[in]     pCfft     points to an initialized mixed-radix CFFT instance, whose length is
+ *                          the number of output bins
+ * @param[out]    pMixer    points to a buffer of 2 * D values for the mixer table
+ * @return        none
+ */
+
+void plp_zoom_fft_init_f32(plp_zoom_fft_instance_f32 *S,
+                           float32_t fc,
+                           uint32_t D,
+                           uint32_t numTaps,
+                           const float32_t *pCoeffs,
+                           float32_t *pStateI,
+                           float32_t *pStateQ,
+                           const plp_cfft_mr_instance_f32 *pCfft,
+                           float32_t *pMixer);
+
+/**
+ * @brief         Glue code for the floating-point zoom FFT.
+ * @param[in,out] S         points to an instance of the floating-point zoom FFT structure,
+ *                          initialized by plp_zoom_fft_init_f32. The mixer phase and the
+ *                          decimator states are updated, such that consecutive calls process a
+ *                          continuous stream.
+ * @param[in]     pSrc      points to D * fftLen real input samples
+ * @param[out]    pDst      points to the fftLen complex output bins. Bin i is at the normalized
+ *                          frequency fc + (i - fftLen / 2) / (D * fftLen), with fftLen / 2
+ *                          rounded down.
+ * @param[out]    pScratch  points to a scratch buffer of size PLP_ZOOM_FFT_SCRATCH_SIZE(fftLen, D)
+ * @return        none
+ */
+
+void plp_zoom_fft_f32(plp_zoom_fft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      float32_t *__restrict__ pScratch);
+
+/**
+ * @brief         Floating-point zoom FFT for XPULPV2 extension.
+ * @param[in,out] S         points to an instance of the floating-point zoom FFT structure
+ * @param[in]     pSrc      points to D * fftLen real input samples
+ * @param[out]    pDst      points to the fftLen complex output bins, with the center frequency
+ *                          at bin fftLen / 2
+ * @param[out]    pScratch  points to a scratch buffer of size PLP_ZOOM_FFT_SCRATCH_SIZE(fftLen, D)
+ * @return        none
+ */
+
+void plp_zoom_fft_f32s_xpulpv2(plp_zoom_fft_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               float32_t *__restrict__ pScratch);
+
+/** -------------------------------------------------------
+   @brief Initialization of the floating-point real FFT instance, which computes the twiddle
+          factors and the bit reversal table for any power of two length.
+   @param[out] S         points to an instance of the floating-point FFT structure
+   @param[in]  FFTLength Length of the FFT, must be a power of two
+   @param[out] pBuffer   points to a buffer of PLP_RFFT_BUFFER_SIZE_F32(FFTLength) values for the
+                         tables, which must stay valid as long as the instance is used
+   @return     none
+*/
+void plp_rfft_init_f32(plp_rfft_instance_f32 *S, uint32_t FFTLength, float32_t *pBuffer);
+
+/**
+   @brief Floating-point FFT on real input data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32(const plp_rfft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point FFT on real input data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[in]   nPE     number of parallel processing units, at most FFTLength / 2 are used
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32_parallel(const plp_rfft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           const uint32_t nPE,
+                           float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point inverse FFT with real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), the bins 0 to FFTLength / 2 of
+                        the spectrum in natural order
+   @param[out]  pDst    points to the output buffer of FFTLength values (real data), may be equal
+                        to pSrc
+   @return      none
+*/
+void plp_irfft_f32(const plp_rfft_instance_f32 *S, const float32_t *pSrc, float32_t *pDst);
+
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), the bins 0 to FFTLength / 2 of
+                        the spectrum in natural order
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of FFTLength values (real data), may be equal
+                        to pSrc
+   @return      none
+*/
+void plp_irfft_f32_parallel(const plp_rfft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            const uint32_t nPE,
+                            float32_t *pDst);
+
+/**
+   @brief Floating-point FFT of a batch of real input channels.
+   @param[in]   S              points to an instance of the floating-point FFT structure
+   @param[in]   pSrc           points to the input buffer (real data), channel c starts at
+                               pSrc + c * channelStride
+   @param[in]   nChannels      number of channels
+   @param[in]   channelStride  distance between the channels in samples, at least FFTLength
+   @param[in]   nPE            number of parallel processing units
+   @param[out]  pDst           points to the output buffer (complex data), channel c starts at
+                               pDst + 2 * c * channelStride
+   @return      none
+*/
+void plp_rfft_f32_batch(const plp_rfft_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        uint32_t nChannels,
+                        uint32_t channelStride,
+                        uint32_t nPE,
+                        float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point FFT of a batch of real input channels, which is split across several
+          clusters.
+   @param[in]   S              points to an instance of the floating-point FFT structure, in L2
+   @param[in]   pSrc           points to the input buffer (real data) in L2, channel c starts at
+                               pSrc + c * channelStride
+   @param[in]   nChannels      number of channels
+   @param[in]   channelStride  distance between the channels in samples, at least FFTLength
+   @param[in]   nClusters      number of clusters, which must be mounted
+   @param[in]   nPE            number of parallel processing units on every cluster
+   @param[out]  pDst           points to the output buffer (complex data) in L2, channel c starts
+                               at pDst + 2 * c * channelStride
+   @return      none
+*/
+void plp_rfft_f32_batch_multi(const plp_rfft_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              uint32_t nChannels,
+                              uint32_t channelStride,
+                              uint32_t nClusters,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrcA   points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension, radix-4 algorithm.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_radix4_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg);
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the bins 0 to FFTLength / 2 of the spectrum (complex data)
+   @param[out]  pDst    points to the output buffer (real data), may be equal to pSrc
+   @return      none
+*/
+void plp_irfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+           version).
+   @param[in]   arg      points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_irfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg);
+
+/**
+   @brief  Floating-point FFT of a batch of real input channels for XPULPV2 extension.
+   @param[in]   args     points to a plp_rfft_batch_arg_f32 struct
+   @return      none
+*/
+void plp_rfft_f32_batch_xpulpv2(void *args);
+
+/**
+   @brief Initialization of the 16-bit fixed point real FFT instance, which computes the twiddle
+          factors of the split stage.
+   @param[out]  S        points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pFFT     points to an instance of the 16-bit fixed point complex FFT structure, its
+                         length is half the FFT length
+   @param[out]  pBuffer  points to a buffer of FFT length values for the table, which must stay
+                         valid as long as the instance is used
+   @return      none
+*/
+void plp_rfft_init_q16(plp_rfft_instance_q16 *S,
+                       const plp_cfft_instance_q16 *pFFT,
+                       int16_t *pBuffer);
+
+/**
+   @brief Glue code for the 16-bit fixed point FFT on real input data.
+   @param[in]   S     points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.15 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values, the DFT divided by
+                      N in Q1.15 format
+   @return      none
+*/
+void plp_rfft_q16(const plp_rfft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point FFT on real input data for RV32IM extension.
+   @param[in]   S     points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.15 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.15 format
+   @return      none
+*/
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point FFT on real input data for XPULPV2 extension.
+   @param[in]   S     points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.15 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.15 format
+   @return      none
+*/
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 32-bit fixed point real FFT instance, which computes the twiddle
+          factors.
+   @param[out]  S          points to an instance of the 32-bit fixed point real FFT structure
+   @param[in]   FFTLength  length of the FFT, a power of two of at least 4
+   @param[out]  pBuffer    points to a buffer of FFTLength values for the table, which must stay
+                           valid as long as the instance is used
+   @return      none
+*/
+void plp_rfft_init_q32(plp_rfft_instance_q32 *S, uint32_t FFTLength, int32_t *pBuffer);
+
+/**
+   @brief Glue code for the 32-bit fixed point FFT on real input data.
+   @param[in]   S     points to an instance of the 32-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.31 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values, the DFT divided by
+                      N in Q1.31 format
+   @return      none
+*/
+void plp_rfft_q32(const plp_rfft_instance_q32 *S,
+                  const int32_t *__restrict__ pSrc,
+                  int32_t *__restrict__ pDst);
+
+/**
+   @brief 32-bit fixed point FFT on real input data for RV32IM extension.
+   @param[in]   S     points to an instance of the 32-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.31 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.31 format
+   @return      none
+*/
+void plp_rfft_q32s_rv32im(const plp_rfft_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pDst);
+
+/**
+   @brief 32-bit fixed point FFT on real input data for XPULPV2 extension.
+   @param[in]   S     points to an instance of the 32-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.31 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.31 format
+   @return      none
+*/
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 32-bit fixed point complex FFT instance, which computes the twiddle
+          factors.
+   @param[out]  S        points to an instance of the 32-bit fixed point complex FFT structure
+   @param[in]   fftLen   length of the FFT, a power of two of at least 2
+   @param[out]  pBuffer  points to a buffer of fftLen values for the table, which must stay valid
+                         as long as the instance is used
+   @return      none
+*/
+void plp_cfft_init_q32(plp_cfft_instance_q32 *S, uint32_t fftLen, int32_t *pBuffer);
+
+/**
+   @brief Glue code for the 32-bit fixed point complex FFT with block floating point scaling.
+   @param[in]      S               points to an instance of the 32-bit fixed point complex FFT
+                                   structure
+   @param[in,out]  p1              points to the complex data buffer of size 2 * fftLen in Q1.31
+                                   format, which is transformed in place
+   @param[in]      ifftFlag        selects the forward (ifftFlag = 0) or the inverse
+                                   (ifftFlag = 1) transform
+   @param[in]      bitReverseFlag  selects natural (bitReverseFlag = 1) or bit reversed
+                                   (bitReverseFlag = 0) order of the output
+   @return         block exponent e of the output: the DFT, or the inverse DFT, is the output
+                   multiplied by 2^e
+*/
+int32_t plp_cfft_q32(const plp_cfft_instance_q32 *S,
+                     int32_t *p1,
+                     uint8_t ifftFlag,
+                     uint8_t bitReverseFlag);
+
+/**
+   @brief 32-bit fixed point complex FFT with block floating point scaling for RV32IM.
+   @param[in]      S               points to an instance of the 32-bit fixed point complex FFT
+                                   structure
+   @param[in,out]  p1              points to the complex data buffer of size 2 * fftLen in Q1.31
+                                   format, which is transformed in place
+   @param[in]      ifftFlag        selects the forward (ifftFlag = 0) or the inverse
+                                   (ifftFlag = 1) transform
+   @param[in]      bitReverseFlag  selects natural (bitReverseFlag = 1) or bit reversed
+                                   (bitReverseFlag = 0) order of the output
+   @return         block exponent e of the output: the DFT, or the inverse DFT, is the output
+                   multiplied by 2^e
+*/
+int32_t plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
+                             int32_t *p1,
+                             uint8_t ifftFlag,
+                             uint8_t bitReverseFlag);
+
+/**
+   @brief 32-bit fixed point complex FFT with block floating point scaling for XPULPV2 extension.
+   @param[in]      S               points to an instance of the 32-bit fixed point complex FFT
+                                   structure
+   @param[in,out]  p1              points to the complex data buffer of size 2 * fftLen in Q1.31
+                                   format, which is transformed in place
+   @param[in]      ifftFlag        selects the forward (ifftFlag = 0) or the inverse
+                                   (ifftFlag = 1) transform
+   @param[in]      bitReverseFlag  selects natural (bitReverseFlag = 1) or bit reversed
+                                   (bitReverseFlag = 0) order of the output
+   @return         block exponent e of the output: the DFT, or the inverse DFT, is the output
+                   multiplied by 2^e
+*/
+int32_t plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
+                              int32_t *p1,
+                              uint8_t ifftFlag,
+                              uint8_t bitReverseFlag);
+
+/**
+   @brief Initialization function for the floating-point short-time Fourier transform.
+   @param[out]  S         points to an instance of the STFT structure
+   @param[in]   pFFT      points to an instance of the floating-point real FFT structure, its length
+                          is the frame length
+   @param[in]   pWindow   points to an instance of the window structure, its length is the FFT
+                          length (e.g. a periodic window of plp_window_init_f32)
+   @param[in]   hopSize   number of samples between two frames, between 1 and the FFT length
+   @param[in]   pState    points to the ring buffer of FFT length samples
+   @param[in]   pScratch  points to a scratch buffer of 2 * FFT length floats
+   @return      none
+*/
+void plp_stft_init_f32(plp_stft_instance_f32 *S,
+                       const plp_rfft_instance_f32 *pFFT,
+                       const plp_window_instance_f32 *pWindow,
+                       uint32_t hopSize,
+                       float32_t *pState,
+                       float32_t *pScratch);
+
+/**
+   @brief Glue code for the short-time Fourier transform (power spectrogram) of a stream of
+          floating-point samples.
+   @param[in,out] S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_f32
+   @param[in]     pSrc        points to the new input samples
+   @param[in]     blockSize   number of new input samples
+   @param[out]    pDst        points to the output buffer, the frames are stored one after the
+                              other with FFTLength / 2 + 1 bins each
+   @param[out]    pNumFrames  points to the number of frames stored to pDst
+   @return        none
+*/
+void plp_stft_f32(plp_stft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pDst,
+                  uint32_t *__restrict__ pNumFrames);
+
+/**
+   @brief Glue code for the power spectrum of one frame of the short-time Fourier transform, whose
+          FFTLength samples are contiguous in memory, e.g. a frame of plp_udma_stream_take.
+   @param[in]     S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_f32. Its ring buffer and hop counter are not used.
+   @param[in]     pFrame      points to the FFTLength samples of the frame, oldest first
+   @param[out]    pDst        points to the output buffer of FFTLength / 2 + 1 bins
+   @return        none
+*/
+void plp_stft_frame_f32(const plp_stft_instance_f32 *S,
+                        const float32_t *__restrict__ pFrame,
+                        float32_t *__restrict__ pDst);
+
+/**
+   @brief  Power spectrum of one windowed frame of a ring buffer for XPULPV2 extension.
+   @param[in]   S             points to an instance of the floating-point FFT structure
+   @param[in]   pState        points to the ring buffer of FFTLength samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_f32), 0 if
+                              pWindow holds all FFTLength samples
+   @param[in]   pScratch      points to a scratch buffer of 2 * FFTLength floats
+   @param[out]  pDst          points to the output buffer, FFTLength / 2 + 1 bins
+   @return      none
+*/
+void plp_stft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                          const float32_t *__restrict__ pState,
+                          uint32_t start,
+                          const float32_t *__restrict__ pWindow,
+                          uint32_t windowMirror,
+                          float32_t *__restrict__ pScratch,
+                          float32_t *__restrict__ pDst);
+
+/**
+   @brief  Power spectrum of one windowed frame of a ring buffer for XPULPV2 extension, which is
+           added to pDst.
+   @param[in]   S             points to an instance of the floating-point FFT structure
+   @param[in]   pState        points to the ring buffer of FFTLength samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_f32), 0 if
+                              pWindow holds all FFTLength samples
+   @param[in]   pScratch      points to a scratch buffer of 2 * FFTLength floats
+   @param[in,out] pDst        points to the accumulated power, FFTLength / 2 + 1 bins
+   @return      none
+*/
+void plp_stft_acc_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                              const float32_t *__restrict__ pState,
+                              uint32_t start,
+                              const float32_t *__restrict__ pWindow,
+                              uint32_t windowMirror,
+                              float32_t *__restrict__ pScratch,
+                              float32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization function for the 16-bit fixed point short-time Fourier transform.
+   @param[out]  S         points to an instance of the STFT structure
+   @param[in]   pFFT      points to an instance of the 16-bit fixed point complex FFT structure,
+                          its length is the frame length
+   @param[in]   pWindow   points to an instance of the window structure, its length is the FFT
+                          length (e.g. a periodic window of plp_window_init_q16)
+   @param[in]   hopSize   number of samples between two frames, between 1 and the FFT length
+   @param[in]   pState    points to the ring buffer of FFT length samples
+   @param[in]   pScratch  points to a scratch buffer of 2 * FFT length samples
+   @return      none
+*/
+void plp_stft_init_q16(plp_stft_instance_q16 *S,
+                       const plp_cfft_instance_q16 *pFFT,
+                       const plp_window_instance_q16 *pWindow,
+                       uint32_t hopSize,
+                       int16_t *pState,
+                       int16_t *pScratch);
+
+/**
+   @brief Glue code for the short-time Fourier transform (power spectrogram) of a stream of
+          16-bit fixed point samples.
+   @param[in,out] S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_q16
+   @param[in]     pSrc        points to the new input samples in Q1.15 format
+   @param[in]     blockSize   number of new input samples
+   @param[out]    pDst        points to the output buffer, the frames are stored one after the
+                              other with fftLen / 2 + 1 bins each in Q2.30 format
+   @param[out]    pNumFrames  points to the number of frames stored to pDst
+   @return        none
+*/
+void plp_stft_q16(plp_stft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst,
+                  uint32_t *__restrict__ pNumFrames);
+
+/**
+   @brief Glue code for the power spectrum of one frame of the 16-bit fixed point short-time Fourier
+          transform, whose fftLen samples are contiguous in memory, e.g. a frame of
+          plp_udma_stream_take.
+   @param[in]     S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_q16. Its ring buffer and hop counter are not used.
+   @param[in]     pFrame      points to the fftLen samples of the frame in Q1.15 format, oldest
+                              first
+   @param[out]    pDst        points to the output buffer of fftLen / 2 + 1 bins in Q2.30 format
+   @return        none
+*/
+void plp_stft_frame_q16(const plp_stft_instance_q16 *S,
+                        const int16_t *__restrict__ pFrame,
+                        int32_t *__restrict__ pDst);
+
+/**
+   @brief Power spectrum of one windowed frame of a ring buffer of 16-bit fixed point data for
+          RV32IM.
+   @param[in]   S             points to an instance of the 16bit quantized CFFT structure
+   @param[in]   pState        points to the ring buffer of fftLen samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients in Q1.15 format
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_q16), 0 if
+                              pWindow holds all fftLen samples
+   @param[in]   pScratch      points to a scratch buffer of 2 * fftLen samples
+   @param[out]  pDst          points to the output buffer, fftLen / 2 + 1 bins in Q2.30 format
+   @return      none
+*/
+void plp_stft_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                          const int16_t *__restrict__ pState,
+                          uint32_t start,
+                          const int16_t *__restrict__ pWindow,
+                          uint32_t windowMirror,
+                          int16_t *__restrict__ pScratch,
+                          int32_t *__restrict__ pDst);
+
+/**
+   @brief Power spectrum of one windowed frame of a ring buffer of 16-bit fixed point data for
+          RV32IM, which is added to pDst.
+   @param[in]   S             points to an instance of the 16bit quantized CFFT structure
+   @param[in]   pState        points to the ring buffer of fftLen samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients in Q1.15 format
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_q16), 0 if
+                              pWindow holds all fftLen samples
+   @param[in]   shift         right shift of the power before it is added
+   @param[in]   pScratch      points to a scratch buffer of 2 * fftLen samples
+   @param[in,out] pDst        points to the accumulated power, fftLen / 2 + 1 bins in
+                              Q(2 + shift).(30 - shift) format
+   @return      none
+*/
+void plp_stft_acc_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                              const int16_t *__restrict__ pState,
+                              uint32_t start,
+                              const int16_t *__restrict__ pWindow,
+                              uint32_t windowMirror,
+                              uint32_t shift,
+                              int16_t *__restrict__ pScratch,
+                              int32_t *__restrict__ pDst);
+
+/**
+   @brief Power spectrum of one windowed frame of a ring buffer of 16-bit fixed point data for
+          XPULPV2.
+   @param[in]   S             points to an instance of the 16bit quantized CFFT structure
+   @param[in]   pState        points to the ring buffer of fftLen samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients in Q1.15 format
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_q16), 0 if
+                              pWindow holds all fftLen samples
+   @param[in]   pScratch      points to a scratch buffer of 2 * fftLen samples
+   @param[out]  pDst          points to the output buffer, fftLen / 2 + 1 bins in Q2.30 format
+   @return      none
+*/
+void plp_stft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                           const int16_t *__restrict__ pState,
+                           uint32_t start,
+                           const int16_t *__restrict__ pWindow,
+                           uint32_t windowMirror,
+                           int16_t *__restrict__ pScratch,
+                           int32_t *__restrict__ pDst);
+
+/**
+   @brief Power spectrum of one windowed frame of a ring buffer of 16-bit fixed point data for
+          XPULPV2, which is added to pDst.
+   @param[in]   S             points to an instance of the 16bit quantized CFFT structure
+   @param[in]   pState        points to the ring buffer of fftLen samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients in Q1.15 format
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_q16), 0 if
+                              pWindow holds all fftLen samples
+   @param[in]   shift         right shift of the power before it is added
+   @param[in]   pScratch      points to a scratch buffer of 2 * fftLen samples
+   @param[in,out] pDst        points to the accumulated power, fftLen / 2 + 1 bins in
+                              Q(2 + shift).(30 - shift) format
+   @return      none
+*/
+void plp_stft_acc_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                               const int16_t *__restrict__ pState,
+                               uint32_t start,
+                               const int16_t *__restrict__ pWindow,
+                               uint32_t windowMirror,
+                               uint32_t shift,
+                               int16_t *__restrict__ pScratch,
+                               int32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 16-bit fixed point window instance, which computes the first
+          half of a Hann, Hamming or Blackman window.
+   @param[out]  S         points to an instance of the 16-bit fixed point window structure
+   @param[in]   type      PLP_WINDOW_HANN, PLP_WINDOW_HAMMING or PLP_WINDOW_BLACKMAN
+   @param[in]   length    number of samples N of the window, at least 2
+   @param[in]   periodic  0: symmetric window (for filter design), 1: periodic window (for
+                          spectral analysis, e.g. plp_stft_q16)
+   @param[out]  pCoeffs   points to a buffer of PLP_WINDOW_COEFFS_SIZE(length) values, which holds
+                          the coefficients in Q1.15 format, and must stay valid as long as the
+                          instance is used
+   @return      none
+*/
+void plp_window_init_q16(plp_window_instance_q16 *S,
+                         uint32_t type,
+                         uint32_t length,
+                         uint8_t periodic,
+                         int16_t *pCoeffs);
+
+/**
+   @brief Glue code for the multiplication of a 16-bit fixed point frame with a window.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples in Q1.15 format
+   @param[out]  pDst  points to the windowed frame in Q1.15 format, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_q16(const plp_window_instance_q16 *S,
+                          const int16_t *pSrc,
+                          int16_t *pDst);
+
+/**
+   @brief Multiplication of a 16-bit fixed point frame with a window for RV32IM extension.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples in Q1.15 format
+   @param[out]  pDst  points to the windowed frame in Q1.15 format, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_q16s_rv32im(const plp_window_instance_q16 *S,
+                                  const int16_t *pSrc,
+                                  int16_t *pDst);
+
+/**
+   @brief Multiplication of a 16-bit fixed point frame with a window for XPULPV2 extension.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples in Q1.15 format
+   @param[out]  pDst  points to the windowed frame in Q1.15 format, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_q16s_xpulpv2(const plp_window_instance_q16 *S,
+                                   const int16_t *pSrc,
+                                   int16_t *pDst);
+
+/**
+   @brief Initialization of the 32-bit floating-point window instance, which computes the first
+          half of a Hann, Hamming or Blackman window.
+   @param[out]  S         points to an instance of the 32-bit floating-point window structure
+   @param[in]   type      PLP_WINDOW_HANN, PLP_WINDOW_HAMMING or PLP_WINDOW_BLACKMAN
+   @param[in]   length    number of samples N of the window, at least 2
+   @param[in]   periodic  0: symmetric window (for filter design), 1: periodic window (for
+                          spectral analysis, e.g. plp_stft_f32)
+   @param[out]  pCoeffs   points to a buffer of PLP_WINDOW_COEFFS_SIZE(length) values, which holds
+                          the coefficients, and must stay valid as long as the
+                          instance is used
+   @return      none
+*/
+void plp_window_init_f32(plp_window_instance_f32 *S,
+                         uint32_t type,
+                         uint32_t length,
+                         uint8_t periodic,
+                         float32_t *pCoeffs);
+
+/**
+   @brief Glue code for the multiplication of a 32-bit floating-point frame with a window.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples
+   @param[out]  pDst  points to the windowed frame, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_f32(const plp_window_instance_f32 *S,
+                          const float32_t *pSrc,
+                          float32_t *pDst);
+
+/**
+   @brief Multiplication of a 32-bit floating-point frame with a window for XPULPV2 extension.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples
+   @param[out]  pDst  points to the windowed frame, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_f32s_xpulpv2(const plp_window_instance_f32 *S,
+                                   const float32_t *pSrc,
+                                   float32_t *pDst);
+
+/**
+   @brief Initialization function for the 16-bit fixed point Welch power spectral density
+          estimator.
+*/
+void plp_psd_welch_init_q16(plp_psd_welch_instance_q16 *S,
+                            const plp_cfft_instance_q16 *pFFT,
+                            const plp_window_instance_q16 *pWindow,
+                            uint32_t hopSize);
+
+/**
+   @brief Glue code for the 16-bit fixed point Welch power spectral density estimator.
+*/
+void plp_psd_welch_q16(const plp_psd_welch_instance_q16 *S,
+                       const int16_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       int16_t *__restrict__ pScratch,
+                       int32_t *__restrict__ pDst);
+
+/**
+   @brief Glue code for the parallel 16-bit fixed point Welch power spectral density estimator.
+*/
+void plp_psd_welch_q16_parallel(const plp_psd_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pScratch,
+                                int32_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point Welch power spectral density estimator for RV32IM extension.
+*/
+void plp_psd_welch_q16s_rv32im(const plp_psd_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t numSegments,
+                               int16_t *__restrict__ pScratch,
+                               int32_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point Welch power spectral density estimator for XPULPV2 extension.
+*/
+void plp_psd_welch_q16s_xpulpv2(const plp_psd_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t numSegments,
+                                int16_t *__restrict__ pScratch,
+                                int32_t *__restrict__ pDst);
+
+/**
+   @brief Parallel 16-bit fixed point Welch power spectral density estimator for XPULPV2
+          extension.
+*/
+void plp_psd_welch_q16p_xpulpv2(void *args);
+
+/**
+   @brief Initialization function for the floating-point Welch power spectral density estimator.
+*/
+void plp_psd_welch_init_f32(plp_psd_welch_instance_f32 *S,
+                            const plp_rfft_instance_f32 *pFFT,
+                            const plp_window_instance_f32 *pWindow,
+                            uint32_t hopSize);
+
+/**
+   @brief Glue code for the floating-point Welch power spectral density estimator.
+*/
+void plp_psd_welch_f32(const plp_psd_welch_instance_f32 *S,
+                       const float32_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       float32_t *__restrict__ pScratch,
+                       float32_t *__restrict__ pDst);
+
+/**
+   @brief Glue code for the parallel floating-point Welch power spectral density estimator.
+*/
+void plp_psd_welch_f32_parallel(const plp_psd_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pScratch,
+                                float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point Welch power spectral density estimator for XPULPV2 extension.
+*/
+void plp_psd_welch_f32s_xpulpv2(const plp_psd_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t numSegments,
+                                float32_t *__restrict__ pScratch,
+                                float32_t *__restrict__ pDst);
+
+/**
+   @brief Parallel floating-point Welch power spectral density estimator for XPULPV2 extension.
+*/
+void plp_psd_welch_f32p_xpulpv2(void *args);
+
+/**
+   @brief Initialization of the sparse floating-point mel filterbank.
+   @param[out]  S            points to an instance of the mel filterbank structure
+   @param[in]   numBands     number of mel bands
+   @param[in]   FFTLength    length of the FFT, the spectrum has FFTLength / 2 + 1 bins
+   @param[in]   sampleRate   sample rate in Hz
+   @param[in]   fMin         lower edge of the first band in Hz
+   @param[in]   fMax         upper edge of the last band in Hz, at most sampleRate / 2
+   @param[out]  pBandStart   points to the first bin of every band, numBands values
+   @param[out]  pBandLength  points to the number of bins of every band, numBands values
+   @param[out]  pCoeffs      points to the weights, PLP_MEL_COEFFS_SIZE(FFTLength) values
+   @return      none
+*/
+void plp_mel_filterbank_init_f32(plp_mel_filterbank_instance_f32 *S,
+                                 uint32_t numBands,
+                                 uint32_t FFTLength,
+                                 float32_t sampleRate,
+                                 float32_t fMin,
+                                 float32_t fMax,
+                                 uint16_t *pBandStart,
+                                 uint16_t *pBandLength,
+                                 float32_t *pCoeffs);
+
+/**
+   @brief Glue code for the sparse mel filterbank of a floating-point power spectrum.
+   @param[in]   S     points to an instance of the mel filterbank structure
+   @param[in]   pSrc  points to the power spectrum
+   @param[out]  pDst  points to the band energies, numBands values
+   @return      none
+*/
+void plp_mel_filterbank_f32(const plp_mel_filterbank_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the sparse 16-bit fixed point mel filterbank.
+   @param[out]  S            points to an instance of the mel filterbank structure
+   @param[in]   numBands     number of mel bands
+   @param[in]   FFTLength    length of the FFT, the spectrum has FFTLength / 2 + 1 bins
+   @param[in]   sampleRate   sample rate in Hz
+   @param[in]   fMin         lower edge of the first band in Hz
+   @param[in]   fMax         upper edge of the last band in Hz, at most sampleRate / 2
+   @param[out]  pBandStart   points to the first bin of every band, numBands values
+   @param[out]  pBandLength  points to the number of bins of every band, numBands values
+   @param[out]  pCoeffs      points to the weights in Q1.15, PLP_MEL_COEFFS_SIZE(FFTLength) values
+   @return      none
+*/
+void plp_mel_filterbank_init_q16(plp_mel_filterbank_instance_q16 *S,
+                                 uint32_t numBands,
+                                 uint32_t FFTLength,
+                                 float32_t sampleRate,
+                                 float32_t fMin,
+                                 float32_t fMax,
+                                 uint16_t *pBandStart,
+                                 uint16_t *pBandLength,
+                                 int16_t *pCoeffs);
+
+/**
+   @brief Glue code for the sparse mel filterbank of a 16-bit fixed point power spectrum.
+   @param[in]   S          points to an instance of the mel filterbank structure
+   @param[in]   pSrc       points to the power spectrum
+   @param[in]   deciPoint  decimal point for right shift of the products
+   @param[out]  pDst       points to the band energies, numBands values
+   @return      none
+*/
+void plp_mel_filterbank_q16(const plp_mel_filterbank_instance_q16 *S,
+                            const int16_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            int32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the floating-point mel frequency cepstral coefficients.
+   @param[out]  S            points to an instance of the MFCC structure
+   @param[in]   pFilterbank  points to an initialized instance of the mel filterbank structure
+   @param[in]   numCoeffs    number of coefficients, at most numBands
+   @param[out]  pDctCoeffs   points to the DCT-II matrix, numCoeffs * numBands values
+   @return      none
+*/
+void plp_mfcc_init_f32(plp_mfcc_instance_f32 *S,
+                       const plp_mel_filterbank_instance_f32 *pFilterbank,
+                       uint32_t numCoeffs,
+                       float32_t *pDctCoeffs);
+
+/**
+   @brief Glue code for the mel frequency cepstral coefficients of a floating-point power spectrum.
+   @param[in]   S      points to an instance of the MFCC structure
+   @param[in]   pSrc   points to the power spectrum
+   @param[out]  pTmp   points to a temporary buffer of numBands values
+   @param[out]  pDst   points to the coefficients, numCoeffs values
+   @return      none
+*/
+void plp_mfcc_f32(const plp_mfcc_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pTmp,
+                  float32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 16-bit fixed point mel frequency cepstral coefficients.
+   @param[out]  S            points to an instance of the MFCC structure
+   @param[in]   pFilterbank  points to an initialized instance of the mel filterbank structure
+   @param[in]   numCoeffs    number of coefficients, at most numBands
+   @param[out]  pDctCoeffs   points to the DCT-II matrix, numCoeffs * numBands values in Q1.15
+   @return      none
+*/
+void plp_mfcc_init_q16(plp_mfcc_instance_q16 *S,
+                       const plp_mel_filterbank_instance_q16 *pFilterbank,
+                       uint32_t numCoeffs,
+                       int16_t *pDctCoeffs);
+
+/**
+   @brief Glue code for the mel frequency cepstral coefficients of a 16-bit fixed point power
+          spectrum.
+   @param[in]   S          points to an instance of the MFCC structure
+   @param[in]   pSrc       points to the power spectrum
+   @param[in]   deciPoint  decimal point of the spectrum
+   @param[out]  pTmp       points to a temporary buffer of numBands 32 bit values
+   @param[out]  pDst       points to the coefficients in Q5.10 format, numCoeffs values
+   @return      none
+*/
+void plp_mfcc_q16(const plp_mfcc_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int32_t *__restrict__ pTmp,
+                  int32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the floating-point DCT-II instance, which computes the post-twiddle
+          factors.
+   @param[out]  S        points to an instance of the DCT-II structure
+   @param[in]   pFFT     points to an instance of the floating-point FFT structure, its length is
+                         the DCT length
+   @param[out]  pBuffer  points to a buffer of PLP_DCT2_BUFFER_SIZE_F32(DCTLength) values for the
+                         table, which must stay valid as long as the instance is used
+   @return      none
+*/
+void plp_dct2_init_f32(plp_dct2_instance_f32 *S,
+                       const plp_rfft_instance_f32 *pFFT,
+                       float32_t *pBuffer);
+
+/**
+   @brief Glue code for the floating-point DCT-II.
+   @param[in]   S         points to an instance of the DCT-II structure
+   @param[in]   pSrc      points to the input buffer of DCT length values
+   @param[out]  pScratch  points to a scratch buffer of 2 * DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values
+   @return      none
+*/
+void plp_dct2_f32(const plp_dct2_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pScratch,
+                  float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point DCT-II for XPULPV2 extension.
+   @param[in]   S         points to an instance of the DCT-II structure
+   @param[in]   pSrc      points to the input buffer of DCT length values
+   @param[out]  pScratch  points to a scratch buffer of 2 * DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values
+   @return      none
+*/
+void plp_dct2_f32_xpulpv2(const plp_dct2_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pScratch,
+                          float32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 16-bit fixed point DCT-IV instance, which computes the pre- and
+          post-twiddle factors.
+   @param[out]  S        points to an instance of the DCT-IV structure
+   @param[in]   pFFT     points to an instance of the 16-bit fixed point complex FFT structure, its
+                         length is half the DCT length
+   @param[out]  pBuffer  points to a buffer of PLP_DCT4_BUFFER_SIZE_Q16(DCTLength) values for the
+                         tables, which must stay valid as long as the instance is used
+   @return      none
+*/
+void plp_dct4_init_q16(plp_dct4_instance_q16 *S,
+                       const plp_cfft_instance_q16 *pFFT,
+                       int16_t *pBuffer);
+
+/**
+   @brief Glue code for the 16-bit fixed point DCT-IV.
+   @param[in]   S         points to an instance of the DCT-IV structure
+   @param[in]   pSrc      points to the input buffer of DCT length values in Q1.15 format
+   @param[out]  pScratch  points to a scratch buffer of DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values, the DCT-IV divided by
+                          the DCT length in Q1.15 format
+   @return      none
+*/
+void plp_dct4_q16(const plp_dct4_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pScratch,
+                  int16_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point DCT-IV for RV32IM extension.
+   @param[in]   S         points to an instance of the DCT-IV structure
+   @param[in]   pSrc      points to the input buffer of DCT length values in Q1.15 format
+   @param[out]  pScratch  points to a scratch buffer of DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values in Q1.15 format
+   @return      none
+*/
+void plp_dct4_q16s_rv32im(const plp_dct4_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pScratch,
+                          int16_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point DCT-IV for XPULPV2 extension.
+   @param[in]   S         points to an instance of the DCT-IV structure
+   @param[in]   pSrc      points to the input buffer of DCT length values in Q1.15 format
+   @param[out]  pScratch  points to a scratch buffer of DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values in Q1.15 format
+   @return      none
+*/
+void plp_dct4_q16s_xpulpv2(const plp_dct4_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pScratch,
+                           int16_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 16-bit fixed point Goertzel instance, which computes the
+          coefficients of the bins.
+   @param[out]  S        points to an instance of the 16-bit fixed point Goertzel structure
+   @param[in]   numBins  Number of bins
+   @param[in]   pFreqs   points to the normalized frequencies f of the bins, in cycles per sample
+                         (between 0 and 0.5)
+   @param[out]  pCoeffs  points to a buffer of PLP_GOERTZEL_BUFFER_SIZE(numBins) values, which
+                         holds cos(2 pi f) and sin(2 pi f) of every bin in Q1.30 format,
+                         and must stay valid as long as the instance is used
+   @return      none
+*/
+void plp_goertzel_init_q16(plp_goertzel_instance_q16 *S,
+                           uint32_t numBins,
+                           const float32_t *pFreqs,
+                           int32_t *pCoeffs);
+
+/**
+   @brief Glue code for the 16-bit fixed point Goertzel algorithm.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples in Q1.15 format
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) in the Q1.15 format of the input, i.e.
+                           not divided by blockSize
+   @return      none
+*/
+void plp_goertzel_q16(const plp_goertzel_instance_q16 *S,
+                      const int16_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point Goertzel algorithm for RV32IM extension.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples in Q1.15 format
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) in the Q1.15 format of the input, i.e.
+                           not divided by blockSize
+   @return      none
+*/
+void plp_goertzel_q16s_rv32im(const plp_goertzel_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point Goertzel algorithm for XPULPV2 extension.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples in Q1.15 format
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) in the Q1.15 format of the input, i.e.
+                           not divided by blockSize
+   @return      none
+*/
+void plp_goertzel_q16s_xpulpv2(const plp_goertzel_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 32-bit floating-point Goertzel instance, which computes the
+          coefficients of the bins.
+   @param[out]  S        points to an instance of the 32-bit floating-point Goertzel structure
+   @param[in]   numBins  Number of bins
+   @param[in]   pFreqs   points to the normalized frequencies f of the bins, in cycles per sample
+                         (between 0 and 0.5)
+   @param[out]  pCoeffs  points to a buffer of PLP_GOERTZEL_BUFFER_SIZE(numBins) values, which
+                         holds cos(2 pi f) and sin(2 pi f) of every bin,
+                         and must stay valid as long as the instance is used
+   @return      none
+*/
+void plp_goertzel_init_f32(plp_goertzel_instance_f32 *S,
+                           uint32_t numBins,
+                           const float32_t *pFreqs,
+                           float32_t *pCoeffs);
+
+/**
+   @brief Glue code for the 32-bit floating-point Goertzel algorithm.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved)
+   @return      none
+*/
+void plp_goertzel_f32(const plp_goertzel_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pDst);
+
+/**
+   @brief 32-bit floating-point Goertzel algorithm for XPULPV2 extension.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved)
+   @return      none
+*/
+void plp_goertzel_f32s_xpulpv2(const plp_goertzel_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 16-bit fixed point sliding DFT instance, which computes the
+          damped twiddle factors of the bins and clears the bins and the delay line.
+   @param[out]  S        points to an instance of the 16-bit fixed point sliding DFT structure
+   @param[in]   length   Length N of the DFT window
+   @param[in]   numBins  Number of bins
+   @param[in]   pBins    points to the indices k of the bins, between 0 and N - 1
+   @param[out]  pCoeffs  points to a buffer of 2 * numBins values, which holds the damped twiddle
+                         factors r e^(j 2 pi k / N) in Q1.30 format, and must stay valid as
+                         long as the instance is used
+   @param[out]  pState   points to a buffer of 2 * numBins values for the complex bins
+   @param[out]  pDelay   points to a buffer of length values for the last N input samples
+   @return      none
+*/
+void plp_sdft_init_q16(plp_sdft_instance_q16 *S,
+                       uint32_t length,
+                       uint32_t numBins,
+                       const uint32_t *pBins,
+                       int32_t *pCoeffs,
+                       int32_t *pState,
+                       int16_t *pDelay);
+
+/**
+   @brief Glue code for the 16-bit fixed point sliding DFT.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples in Q1.15 format
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block, in
+                           the Q1.15 format of the input, i.e. not divided by N
+   @return      none
+*/
+void plp_sdft_q16(plp_sdft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point sliding DFT for RV32IM extension.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples in Q1.15 format
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block, in
+                           the Q1.15 format of the input, i.e. not divided by N
+   @return      none
+*/
+void plp_sdft_q16s_rv32im(plp_sdft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
+
+/**
+   @brief 16-bit fixed point sliding DFT for XPULPV2 extension.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples in Q1.15 format
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block, in
+                           the Q1.15 format of the input, i.e. not divided by N
+   @return      none
+*/
+void plp_sdft_q16s_xpulpv2(plp_sdft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pDst);
+
+/**
+   @brief Initialization of the 32-bit floating-point sliding DFT instance, which computes the
+          damped twiddle factors of the bins and clears the bins and the delay line.
+   @param[out]  S        points to an instance of the 32-bit floating-point sliding DFT structure
+   @param[in]   length   Length N of the DFT window
+   @param[in]   numBins  Number of bins
+   @param[in]   pBins    points to the indices k of the bins, between 0 and N - 1
+   @param[out]  pCoeffs  points to a buffer of 2 * numBins values, which holds the damped twiddle
+                         factors r e^(j 2 pi k / N), and must stay valid as
+                         long as the instance is used
+   @param[out]  pState   points to a buffer of 2 * numBins values for the complex bins
+   @param[out]  pDelay   points to a buffer of length values for the last N input samples
+   @return      none
+*/
+void plp_sdft_init_f32(plp_sdft_instance_f32 *S,
+                       uint32_t length,
+                       uint32_t numBins,
+                       const uint32_t *pBins,
+                       float32_t *pCoeffs,
+                       float32_t *pState,
+                       float32_t *pDelay);
+
+/**
+   @brief Glue code for the 32-bit floating-point sliding DFT.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block
+   @return      none
+*/
+void plp_sdft_f32(plp_sdft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pDst);
+
+/**
+   @brief 32-bit floating-point sliding DFT for XPULPV2 extension.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block
+   @return      none
+*/
+void plp_sdft_f32s_xpulpv2(plp_sdft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst);
+
+#endif // __PLP_TRANSFORM_H__
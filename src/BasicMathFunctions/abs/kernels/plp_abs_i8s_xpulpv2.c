@@ -51,52 +51,84 @@
   @param[out]    pDst       points to the output vector
   @param[in]     blockSize  number of samples in each vector
   @return        none
+
+  @par Exploiting SIMD instructions
+  The samples are packed four per 32-bit word, and the absolute values are computed with a single
+  SIMD instruction.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of pSrc
+  are computed one by one, such that the SIMD loop reads pSrc with aligned words. pDst is
+  accessed with aligned words as well if it has the same offset within a word as pSrc.
  */
 
-void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
-                         int8_t * pDst,
+void plp_abs_i8s_xpulpv2(const int8_t *pSrc,
+                         int8_t *pDst,
                          uint32_t blockSize) {
+
     uint32_t blkCnt; /* Loop counter */
+    const v4s *pS;
+    v4s *pD;
 
-#if defined(PLP_MATH_LOOPUNROLL)
+    /* Compute the samples before the first word-aligned sample of pSrc */
+    blkCnt = plp_align_head(pSrc, sizeof(int8_t), blockSize);
+    blockSize -= blkCnt;
 
-    /* Loop unrolling: Compute 2 outputs at a time */
-    blkCnt = blockSize >> 1U;
+    while (blkCnt > 0U) {
+        *pDst++ = abs(*pSrc++);
 
-    while (blkCnt > 0U)
-      {
-        /* C = |A| */
+        /* Decrement loop counter */
+        blkCnt--;
+    }
 
-        /* Calculate absolute and store result in destination buffer. */
-        *pDst++ = abs(*pSrc++);
+    pS = (const v4s *)pSrc;
+    pD = (v4s *)pDst;
 
-        *pDst++ = abs(*pSrc++);
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U) {
+        /* C = |A| */
+        *pD++ = __ABS4(*pS++);
+        *pD++ = __ABS4(*pS++);
 
         /* Decrement loop counter */
         blkCnt--;
-      }
+    }
 
-    /* Loop unrolling: Compute remaining outputs */
-    blkCnt = blockSize % 0x2U;
+    /* Loop unrolling: Compute remaining vector */
+    if (blockSize & 0x4U) {
+        *pD++ = __ABS4(*pS++);
+    }
 
 #else // PLP_MATH_LOOPUNROLL
 
-    /* Initialize blkCnt with number of samples */
-    blkCnt = blockSize;
+    /* Initialize blkCnt with number of vectors */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U) {
+        /* C = |A| */
+        *pD++ = __ABS4(*pS++);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
 
 #endif // PLP_MATH_LOOPUNROLL
 
-    while (blkCnt > 0U)
-      {
-        /* C = |A| */
+    /* Compute remaining samples */
+    pSrc = (const int8_t *)pS;
+    pDst = (int8_t *)pD;
+    blkCnt = blockSize & 0x3U;
 
-        /* Calculate absolute and store result in destination buffer. */
+    while (blkCnt > 0U) {
         *pDst++ = abs(*pSrc++);
 
         /* Decrement loop counter */
         blkCnt--;
-      }
-
+    }
 }
 
 /**
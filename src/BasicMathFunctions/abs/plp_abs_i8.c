@@ -51,6 +51,10 @@
   @param[out]    pDst       points to the output vector
   @param[in]     blockSize  number of samples in each vector
   @return        none
+
+  @par Alignment
+  The vectors may have any alignment. On the cluster, the call is fastest if all vectors have the
+  same offset within a 32-bit word, e.g. sub-slices at the same index of word-aligned buffers.
  */
 
 void plp_abs_i8(const int8_t * pSrc,
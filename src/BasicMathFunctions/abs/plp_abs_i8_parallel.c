@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_abs_i8_parallel.c
+ * Description:  Glue code for the parallel i8 absolute value
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAbs
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel element-by-element absolute value of 8-bit integer vectors.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @return        none
+
+  @par Alignment
+  The vectors may have any alignment. On the cluster, the call is fastest if all vectors have the
+  same offset within a 32-bit word, e.g. sub-slices at the same index of word-aligned buffers.
+ */
+
+void plp_abs_i8_parallel(const int8_t *pSrc,
+                         int8_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_abs_i8_parallel), blockSize);
+        }
+
+        plp_abs_instance_i8 S = { .pSrc = pSrc,
+                                  .pDst = pDst,
+                                  .blockSize = blockSize,
+                                  .nPE = nPE };
+
+        rt_team_fork(nPE, plp_abs_i8p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of BasicAbs group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_stride_f32s_xpulpv2.c
+ * Description:  strided addition of 32-bit floating-point vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+  @brief Strided element-by-element addition of 32-bit floating-point vectors kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    stride of the first input vector (elements between two samples)
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    stride of the second input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  strideDst  stride of the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting post-increment loads
+  The pointers advance by the stride after every sample, such that each load is a
+  post-increment load with the stride in a register (e.g. p.lw x, stride(p!)) and needs no
+  address computation. SIMD instructions cannot be used, as the samples are not contiguous.
+ */
+
+void plp_add_stride_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                 uint32_t strideA,
+                                 const float32_t *__restrict__ pSrcB,
+                                 uint32_t strideB,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    float32_t a0, a1, b0, b1;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        a0 = *pSrcA;
+        pSrcA += strideA;
+        b0 = *pSrcB;
+        pSrcB += strideB;
+        a1 = *pSrcA;
+        pSrcA += strideA;
+        b1 = *pSrcB;
+        pSrcB += strideB;
+        *pDst = a0 + b0;
+        pDst += strideDst;
+        *pDst = a1 + b1;
+        pDst += strideDst;
+    }
+
+    if (blockSize & 0x1U) {
+        *pDst = (*pSrcA) + (*pSrcB);
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        a0 = *pSrcA;
+        pSrcA += strideA;
+        b0 = *pSrcB;
+        pSrcB += strideB;
+        *pDst = a0 + b0;
+        pDst += strideDst;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+}
+
+/**
+  @} end of BasicAddKernels group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_stride_i16s_rv32im.c
+ * Description:  strided addition of 16-bit integer vectors kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+  @brief Strided element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    stride of the first input vector (elements between two samples)
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    stride of the second input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  strideDst  stride of the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+
+  @par
+  The samples are addressed with their index times the stride.
+ */
+
+void plp_add_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                uint32_t strideA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t strideB,
+                                int32_t *__restrict__ pDst,
+                                uint32_t strideDst,
+                                uint32_t blockSize) {
+
+    uint32_t i; /* Loop counter */
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i * strideDst] = (int32_t)pSrcA[i * strideA] + pSrcB[i * strideB];
+    }
+}
+
+/**
+  @} end of BasicAddKernels group
+ */
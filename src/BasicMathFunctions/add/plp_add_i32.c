@@ -51,6 +51,10 @@
   pDst[n] = pSrcA[n] + pSrcB[n],   0 <= n < blockSize.
   </pre>
 
+  The fixed-point versions (q8, q16 and q32) round the exact result, shift it right by deciPoint
+  and saturate it to the range of the output type. This makes them suitable for mixing signals
+  without a separate clamping pass.
+
   There are separate functions for floating point, integer, and fixed point 32- 16- 8-bit data
   types. For lower precision integers (16- and 8-bit), functions exploiting SIMD instructions are
   provided.
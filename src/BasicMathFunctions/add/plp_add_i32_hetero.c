@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_i32_hetero.c
+ * Description:  Glue code for the heterogeneous addition of 32-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAdd
+  @{
+ */
+
+/* runs on the master core of the cluster */
+static void plp_add_i32_hetero_entry(void *args) {
+
+    plp_add_instance_i32 *S = (plp_add_instance_i32 *)args;
+
+    plp_add_i32_parallel(S->pSrcA, S->pSrcB, S->pDst, S->blockSize, S->nPE);
+}
+
+/**
+  @brief Glue code for the element-by-element addition of 32-bit integer vectors, which is split
+         between the cluster and the fabric controller.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of cluster cores, or PLP_AUTO
+  @param[in]     fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+  @return        none
+ */
+
+void plp_add_i32_hetero(const int32_t *pSrcA,
+                        const int32_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        uint32_t fcShare) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("heterogeneous execution supported only for fabric controller side\n");
+        return;
+    }
+
+    uint32_t clusterSize = plp_hetero_split(blockSize, fcShare);
+    plp_async_handle handle;
+    handle.event = NULL;
+
+    if (clusterSize > 0) {
+        plp_add_instance_i32 *S = (plp_add_instance_i32 *)handle.args;
+
+        S->pSrcA = pSrcA;
+        S->pSrcB = pSrcB;
+        S->pDst = pDst;
+        S->blockSize = clusterSize;
+        S->nPE = nPE;
+
+        plp_async_call(plp_add_i32_hetero_entry, (void *)S, &handle);
+    }
+
+    if (clusterSize < blockSize) {
+        plp_add_i32s_rv32im(pSrcA + clusterSize,
+                            pSrcB + clusterSize,
+                            pDst + clusterSize,
+                            blockSize - clusterSize);
+    }
+
+    plp_async_wait(&handle);
+}
+
+/**
+  @} end of BasicAdd group
+ */
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_stride_i8.c
+ * Description:  strided addition of 8-bit integer vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAdd
+  @{
+ */
+
+/**
+  @brief Glue code for strided element-by-element addition of 8-bit integer vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    stride of the first input vector (elements between two samples)
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    stride of the second input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  strideDst  stride of the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+
+  @par
+  The samples are taken every stride elements, e.g. along a column of a matrix, such that no copy
+  is needed. If all strides are 1, the contiguous kernels of plp_add_i8 are used instead.
+ */
+
+void plp_add_stride_i8(const int8_t *__restrict__ pSrcA,
+                       uint32_t strideA,
+                       const int8_t *__restrict__ pSrcB,
+                       uint32_t strideB,
+                       int32_t *__restrict__ pDst,
+                       uint32_t strideDst,
+                       uint32_t blockSize) {
+
+    if (strideA == 1 && strideB == 1 && strideDst == 1) {
+        plp_add_i8(pSrcA, pSrcB, pDst, blockSize);
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_add_stride_i8s_rv32im(pSrcA, strideA, pSrcB, strideB, pDst, strideDst, blockSize);
+    } else {
+        plp_add_stride_i8s_xpulpv2(pSrcA, strideA, pSrcB, strideB, pDst, strideDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicAdd group
+ */
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clip_i32s_xpulpv2.c
+ * Description:  32-bit integer clipping kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicClip
+ */
+
+/**
+  @defgroup BasicClipKernels Vector Clip Kernels
+ */
+
+/**
+  @addtogroup BasicClipKernels
+  @{
+ */
+
+/**
+  @brief Clipping of a 32-bit integer vector kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     low        lower bound of the output
+  @param[in]     high       upper bound of the output
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_clip_i32s_xpulpv2(const int32_t *pSrc,
+                           int32_t low,
+                           int32_t high,
+                           int32_t *pDst,
+                           uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t in;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            /* C = min(max(A, low), high) */
+            in = *pSrc++;
+            *pDst++ = __MAX(__MIN(in, high), low);
+            in = *pSrc++;
+            *pDst++ = __MAX(__MIN(in, high), low);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    if (blkCnt > 0U) {
+        do {
+            /* C = min(max(A, low), high) */
+            in = *pSrc++;
+            *pDst++ = __MAX(__MIN(in, high), low);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+}
+
+/**
+  @} end of BasicClipKernels group
+ */
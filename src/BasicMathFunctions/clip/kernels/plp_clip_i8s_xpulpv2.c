@@ -0,0 +1,145 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clip_i8s_xpulpv2.c
+ * Description:  8-bit integer clipping kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicClip
+ */
+
+/**
+  @addtogroup BasicClipKernels
+  @{
+ */
+
+/**
+  @brief Clipping of an 8-bit integer vector kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     low        lower bound of the output
+  @param[in]     high       upper bound of the output
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The samples are packed four per 32-bit word, and the clipped values are computed with a single
+  SIMD instruction.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of pSrc
+  are computed one by one, such that the SIMD loop reads pSrc with aligned words. pDst is
+  accessed with aligned words as well if it has the same offset within a word as pSrc.
+ */
+
+void plp_clip_i8s_xpulpv2(const int8_t *pSrc,
+                          int8_t low,
+                          int8_t high,
+                          int8_t *pDst,
+                          uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const v4s *pS;
+    v4s *pD;
+    v4s lo = (v4s){ low, low, low, low };
+    v4s hi = (v4s){ high, high, high, high };
+    int8_t in;
+
+    /* Compute the samples before the first word-aligned sample of pSrc */
+    blkCnt = plp_align_head(pSrc, sizeof(int8_t), blockSize);
+    blockSize -= blkCnt;
+
+    if (blkCnt > 0U) {
+        do {
+            in = *pSrc++;
+            *pDst++ = __MAX(__MIN(in, high), low);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    pS = (const v4s *)pSrc;
+    pD = (v4s *)pDst;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 3U;
+
+    if (blkCnt > 0U) {
+        do {
+            /* C = min(max(A, low), high) */
+            *pD++ = __MAX4(__MIN4(*pS++, hi), lo);
+            *pD++ = __MAX4(__MIN4(*pS++, hi), lo);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    /* Loop unrolling: Compute remaining vector */
+    if (blockSize & 0x4U) {
+        *pD++ = __MAX4(__MIN4(*pS++, hi), lo);
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of vectors */
+    blkCnt = blockSize >> 2U;
+
+    if (blkCnt > 0U) {
+        do {
+            /* C = min(max(A, low), high) */
+            *pD++ = __MAX4(__MIN4(*pS++, hi), lo);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    /* Compute remaining samples */
+    pSrc = (const int8_t *)pS;
+    pDst = (int8_t *)pD;
+    blkCnt = blockSize & 0x3U;
+
+    if (blkCnt > 0U) {
+        do {
+            in = *pSrc++;
+            *pDst++ = __MAX(__MIN(in, high), low);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+}
+
+/**
+  @} end of BasicClipKernels group
+ */
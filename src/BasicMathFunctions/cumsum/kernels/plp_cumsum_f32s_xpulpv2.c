@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_f32s_xpulpv2.c
+ * Description:  Cumulative sum of a vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCumsum
+ */
+
+/**
+  @addtogroup BasicCumsumKernels
+  @{
+ */
+
+/**
+  @brief Cumulative sum of a 32-bit floating-point vector kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, may be equal to pSrc
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_cumsum_f32s_xpulpv2(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    float32_t sum = 0.0f;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        float32_t a0 = pSrc[0];
+        float32_t a1 = pSrc[1];
+        pSrc += 2;
+
+        /* C[n] = C[n - 1] + A[n] */
+        sum += a0;
+        pDst[0] = sum;
+        sum += a1;
+        pDst[1] = sum;
+        pDst += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining output */
+    blkCnt = blockSize & 0x1U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        /* C[n] = C[n - 1] + A[n] */
+        sum += *pSrc++;
+        *pDst++ = sum;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicCumsumKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i16p_xpulpv2.c
+ * Description:  Parallel cumulative sum of a vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCumsum
+ */
+
+/**
+  @addtogroup BasicCumsumKernels
+  @{
+ */
+
+/**
+  @brief Parallel cumulative sum of a 16-bit integer vector kernel for XPULPV2 extension.
+  @param[in]     args       points to the plp_cumsum_instance_i16 struct initialized by the glue
+                            code
+  @return        none
+ */
+
+void plp_cumsum_i16p_xpulpv2(void *args) {
+
+    plp_cumsum_instance_i16 *S = (plp_cumsum_instance_i16 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    int32_t offset = 0;
+    uint32_t k;
+
+    if (start > S->blockSize) {
+        start = S->blockSize;
+    }
+    if (end > S->blockSize) {
+        end = S->blockSize;
+    }
+
+    /* first pass: cumulative sum of the own block, whose last output is the sum of the block */
+    if (start < end) {
+        plp_cumsum_i16s_xpulpv2(S->pSrc + start, S->pDst + start, end - start);
+        S->pPartial[core_id] = S->pDst[end - 1];
+    } else {
+        S->pPartial[core_id] = 0;
+    }
+
+    plp_team_barrier();
+
+    /* second pass: add the sum of all preceding blocks */
+    for (k = 0; k < core_id; k++) {
+        offset += S->pPartial[k];
+    }
+
+    if (core_id > 0 && start < end) {
+        plp_offset_i32s_xpulpv2(S->pDst + start, offset, S->pDst + start, end - start);
+    }
+}
+
+/**
+  @} end of BasicCumsumKernels group
+ */
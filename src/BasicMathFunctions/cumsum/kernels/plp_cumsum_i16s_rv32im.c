@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i16s_rv32im.c
+ * Description:  Cumulative sum of a vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCumsum
+ */
+
+/**
+  @addtogroup BasicCumsumKernels
+  @{
+ */
+
+/**
+  @brief Cumulative sum of a 16-bit integer vector kernel for RV32IM extension.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, 32-bit
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_cumsum_i16s_rv32im(const int16_t *pSrc,
+                            int32_t *pDst,
+                            uint32_t blockSize) {
+
+    uint32_t blkCnt = blockSize; /* Loop counter */
+    int32_t sum = 0;
+
+    while (blkCnt > 0U) {
+        /* C[n] = C[n - 1] + A[n] */
+        sum += *pSrc++;
+        *pDst++ = sum;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicCumsumKernels group
+ */
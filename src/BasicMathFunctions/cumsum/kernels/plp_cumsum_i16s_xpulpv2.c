@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i16s_xpulpv2.c
+ * Description:  Cumulative sum of a vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCumsum
+ */
+
+/**
+  @addtogroup BasicCumsumKernels
+  @{
+ */
+
+/**
+  @brief Cumulative sum of a 16-bit integer vector kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, 32-bit
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The samples are loaded two per 32-bit word. The first output of a word is the running sum plus
+  its lower sample, the second one is computed directly from the running sum with a single sumdotp
+  of the word and a vector of ones.
+
+  @par Alignment
+  The input vector may have any alignment. The samples before its first word-aligned sample are
+  summed one by one, such that the SIMD loop reads pSrc with aligned words.
+ */
+
+void plp_cumsum_i16s_xpulpv2(const int16_t *pSrc,
+                             int32_t *pDst,
+                             uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const v2s *pS;
+    v2s ones = (v2s){ 1, 1 };
+    int32_t sum = 0;
+
+    /* Sum the samples before the first word-aligned sample of pSrc */
+    blkCnt = plp_align_head(pSrc, sizeof(int16_t), blockSize);
+    blockSize -= blkCnt;
+
+    while (blkCnt > 0U) {
+        sum += *pSrc++;
+        *pDst++ = sum;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    pS = (const v2s *)pSrc;
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        v2s a = *pS++;
+
+        /* C[n] = C[n - 1] + A[n], C[n + 1] = C[n - 1] + A[n] + A[n + 1] */
+        pDst[0] = sum + a[0];
+        sum = __SUMDOTP2(a, ones, sum);
+        pDst[1] = sum;
+        pDst += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Compute the remaining sample */
+    if (blockSize & 0x1U) {
+        sum += *(const int16_t *)pS;
+        *pDst = sum;
+    }
+}
+
+/**
+  @} end of BasicCumsumKernels group
+ */
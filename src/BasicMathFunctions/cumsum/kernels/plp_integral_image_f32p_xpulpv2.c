@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_integral_image_f32p_xpulpv2.c
+ * Description:  Parallel integral image for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicIntegralImage
+ */
+
+/**
+  @addtogroup BasicIntegralImageKernels
+  @{
+ */
+
+/**
+  @brief Parallel integral image of a 32-bit floating-point image kernel for XPULPV2 extension.
+  @param[in]     args       points to the plp_integral_image_instance_f32 struct initialized by the glue
+                            code
+  @return        none
+ */
+
+void plp_integral_image_f32p_xpulpv2(void *args) {
+
+    plp_integral_image_instance_f32 *S =
+        (plp_integral_image_instance_f32 *)args;
+    const float32_t *pSrc = S->pSrc;
+    uint32_t M = S->M;
+    uint32_t N = S->N;
+    uint32_t nPE = S->nPE;
+    float32_t *pDst = S->pDst;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk, start, end;
+    uint32_t m; /* Loop counter */
+
+    /* first pass: cumulative sums of a block of rows */
+    chunk = (M + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > M) {
+        end = M;
+    }
+
+    for (m = start; m < end; m++) {
+        plp_cumsum_f32s_xpulpv2(pSrc + m * N, pDst + m * N, N);
+    }
+
+    plp_team_barrier();
+
+    /* second pass: accumulate the rows from top to bottom within a block of columns */
+    chunk = (N + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > N) {
+        end = N;
+    }
+
+    if (start < end) {
+        for (m = 1; m < M; m++) {
+            float32_t *pD = pDst + m * N + start;
+
+            plp_add_f32s_xpulpv2(pD - N, pD, pD, end - start);
+        }
+    }
+}
+
+/**
+  @} end of BasicIntegralImageKernels group
+ */
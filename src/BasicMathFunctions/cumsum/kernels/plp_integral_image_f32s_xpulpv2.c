@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_integral_image_f32s_xpulpv2.c
+ * Description:  Integral image for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicIntegralImage
+ */
+
+/**
+  @addtogroup BasicIntegralImageKernels
+  @{
+ */
+
+/**
+  @brief Integral image of a 32-bit floating-point image kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input image (M x N)
+  @param[in]     M          number of rows of the image
+  @param[in]     N          number of columns of the image
+  @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+  @return        none
+
+  @par
+  The image is swept once in row-major order. Every output is the running sum of its row plus the
+  output above it, which has just been written by the previous row.
+ */
+
+void plp_integral_image_f32s_xpulpv2(const float32_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     float32_t *pDst) {
+
+    uint32_t m, n; /* Loop counters */
+    float32_t sum;
+
+    if (M == 0U) {
+        return;
+    }
+
+    /* first row: cumulative sum */
+    plp_cumsum_f32s_xpulpv2(pSrc, pDst, N);
+
+    for (m = 1; m < M; m++) {
+        const float32_t *pS = pSrc + m * N;
+        const float32_t *pAbove = pDst + (m - 1) * N;
+        float32_t *pD = pDst + m * N;
+
+        sum = 0.0f;
+
+        for (n = 0; n < N; n++) {
+            /* C[m][n] = C[m - 1][n] + A[m][0] + ... + A[m][n] */
+            sum += pS[n];
+            pD[n] = pAbove[n] + sum;
+        }
+    }
+}
+
+/**
+  @} end of BasicIntegralImageKernels group
+ */
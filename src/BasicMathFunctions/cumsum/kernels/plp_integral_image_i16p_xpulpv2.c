@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_integral_image_i16p_xpulpv2.c
+ * Description:  Parallel integral image for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicIntegralImage
+ */
+
+/**
+  @addtogroup BasicIntegralImageKernels
+  @{
+ */
+
+/**
+  @brief Parallel integral image of a 16-bit integer image kernel for XPULPV2 extension.
+  @param[in]     args       points to the plp_integral_image_instance_i16 struct initialized by the glue
+                            code
+  @return        none
+ */
+
+void plp_integral_image_i16p_xpulpv2(void *args) {
+
+    plp_integral_image_instance_i16 *S =
+        (plp_integral_image_instance_i16 *)args;
+    const int16_t *pSrc = S->pSrc;
+    uint32_t M = S->M;
+    uint32_t N = S->N;
+    uint32_t nPE = S->nPE;
+    int32_t *pDst = S->pDst;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk, start, end;
+    uint32_t m; /* Loop counter */
+
+    /* first pass: cumulative sums of a block of rows */
+    chunk = (M + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > M) {
+        end = M;
+    }
+
+    for (m = start; m < end; m++) {
+        plp_cumsum_i16s_xpulpv2(pSrc + m * N, pDst + m * N, N);
+    }
+
+    plp_team_barrier();
+
+    /* second pass: accumulate the rows from top to bottom within a block of columns */
+    chunk = (N + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > N) {
+        end = N;
+    }
+
+    if (start < end) {
+        for (m = 1; m < M; m++) {
+            int32_t *pD = pDst + m * N + start;
+
+            plp_add_i32s_xpulpv2(pD - N, pD, pD, end - start);
+        }
+    }
+}
+
+/**
+  @} end of BasicIntegralImageKernels group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_f32_parallel.c
+ * Description:  Parallel cumulative sum of a vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicCumsum
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel cumulative sum of a 32-bit floating-point vector.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, may be equal to pSrc
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @return        none
+
+  @par
+  The sums of the preceding blocks are added to the samples of a block at the end, such that the
+  rounding differs slightly from the one of plp_cumsum_f32.
+ */
+
+void plp_cumsum_f32_parallel(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize,
+                             uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_cumsum_f32_parallel), blockSize);
+        }
+
+        float32_t partial[nPE];
+        plp_cumsum_instance_f32 S = { .pSrc = pSrc,
+                                      .pDst = pDst,
+                                      .blockSize = blockSize,
+                                      .nPE = nPE,
+                                      .pPartial = partial };
+
+        rt_team_fork(nPE, plp_cumsum_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of BasicCumsum group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i32.c
+ * Description:  Cumulative sum of a vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicCumsum Vector Cumulative Sum
+  Computes the cumulative sum (inclusive prefix sum) of a vector.
+  <pre>
+      pDst[n] = pSrc[0] + pSrc[1] + ... + pSrc[n],   0 <= n < blockSize.
+  </pre>
+  The 16-bit version accumulates into a 32-bit output vector, the integer versions wrap around on
+  overflow. The parallel versions split the vector into one contiguous block per core and take
+  two passes: every core first computes the cumulative sum of its own block, and after a barrier
+  adds the sum of all preceding blocks to it. Every sample is thus read once and written twice,
+  and all cores stay busy in both passes.
+ */
+
+/**
+  @addtogroup BasicCumsum
+  @{
+ */
+
+/**
+  @brief Glue code for the cumulative sum of a 32-bit integer vector.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, may be equal to pSrc
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_cumsum_i32(const int32_t *pSrc,
+                    int32_t *pDst,
+                    uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cumsum_i32s_rv32im(pSrc, pDst, blockSize);
+    } else {
+        plp_cumsum_i32s_xpulpv2(pSrc, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicCumsum group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_integral_image_i32.c
+ * Description:  Integral image glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicIntegralImage Integral Image
+  Computes the integral image (summed-area table) of a row-major M x N image, i.e. the 2D
+  cumulative sum.
+  <pre>
+      pDst[y][x] = sum of pSrc[i][j] for 0 <= i <= y and 0 <= j <= x.
+  </pre>
+  The sum over any rectangle of the image can then be computed from four values of pDst. The
+  16-bit version accumulates into a 32-bit output image, the integer versions wrap around on
+  overflow. The parallel versions take two passes: the cores first compute the cumulative sums of
+  the rows, every core for a block of rows, and after a barrier accumulate the rows from top to
+  bottom, every core for a block of columns.
+ */
+
+/**
+  @addtogroup BasicIntegralImage
+  @{
+ */
+
+/**
+  @brief Glue code for the integral image of a 32-bit integer image.
+  @param[in]     pSrc       points to the input image (M x N)
+  @param[in]     M          number of rows of the image
+  @param[in]     N          number of columns of the image
+  @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+  @return        none
+ */
+
+void plp_integral_image_i32(const int32_t *pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_integral_image_i32s_rv32im(pSrc, M, N, pDst);
+    } else {
+        plp_integral_image_i32s_xpulpv2(pSrc, M, N, pDst);
+    }
+}
+
+/**
+  @} end of BasicIntegralImage group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_integral_image_i32_parallel.c
+ * Description:  Parallel integral image glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicIntegralImage
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel integral image of a 32-bit integer image.
+  @param[in]     pSrc       points to the input image (M x N)
+  @param[in]     M          number of rows of the image
+  @param[in]     N          number of columns of the image
+  @param[in]     nPE        number of parallel processing units
+  @param[out]    pDst       points to the output integral image (M x N), may be equal to pSrc
+  @return        none
+ */
+
+void plp_integral_image_i32_parallel(const int32_t *pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t nPE,
+                                     int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_integral_image_i32_parallel), M * N);
+        }
+
+        plp_integral_image_instance_i32 S = { .pSrc = pSrc,
+                                              .M = M,
+                                              .N = N,
+                                              .nPE = nPE,
+                                              .pDst = pDst };
+
+        rt_team_fork(nPE, plp_integral_image_i32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of BasicIntegralImage group
+ */
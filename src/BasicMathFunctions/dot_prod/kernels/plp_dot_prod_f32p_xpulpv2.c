@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
  * Title:        plp_dot_prod_i32p_xpulpv2.c
- * Description:  32-bit integer scalar dot product for XPULPV2 with interleaved access
+ * Description:  32-bit integer scalar dot product for XPULPV2 with contiguous chunks
  *
  * $Date:        03. Jun 2019
  * $Revision:    V0
@@ -45,7 +45,7 @@
  */
 
 /**
-  @brief Parallel dot product with interleaved access of 32-bit float vectors kernel for XPULPV2
+  @brief Parallel dot product with contiguous chunks of 32-bit float vectors kernel for XPULPV2
   extension.
   @param[in]  S     points to the instance structure for float parallel dot product
   @return        none
@@ -53,49 +53,28 @@
 
 void plp_dot_prod_f32p_xpulpv2(void *S) {
 
-    float32_t *pSrcA = (float32_t *)(((plp_dot_prod_instance_f32 *)S)->pSrcA) + rt_core_id();
-    float32_t *pSrcB = (float32_t *)(((plp_dot_prod_instance_f32 *)S)->pSrcB) + rt_core_id();
-    uint32_t blkSizePE = ((plp_dot_prod_instance_f32 *)S)->blkSizePE;
-    uint32_t nPE = ((plp_dot_prod_instance_f32 *)S)->nPE;
-    float32_t *resBufferPE = &(((plp_dot_prod_instance_f32 *)S)->resBuffer[rt_core_id()]);
+    plp_dot_prod_instance_f32 *args = (plp_dot_prod_instance_f32 *)S;
+    uint32_t core_id = plp_core_id();
 
-    uint32_t blkCnt, tmpBS; /* Loop counter, temporal BlockSize */
-    // float32_t sum1 = 0, sum2=0;                          /* Temporary return variable */
-    float32_t sum1 = 0; /* Temporary return variable */
+    /* contiguous chunks of whole iterations of the unrolled loop, which every core reads with
+       post-incremented loads */
+    uint32_t chunk = (args->blkSizePE + args->nPE - 1) / args->nPE;
+    chunk = (chunk + PLP_DOTPROD_UNROLL - 1) / PLP_DOTPROD_UNROLL * PLP_DOTPROD_UNROLL;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    float32_t sum = 0;
 
-    // rt_team_barrier();
-
-    /* #if defined(PLP_MATH_LOOPUNROLL) */
-    /* #undef PLP_MATH_LOOPUNROLL */
-    /* #endif */
-
-    /* #if defined(PLP_MATH_LOOPUNROLL) */
-
-    /*         tmpBS = (blkSizePE>>1); */
-    /*         uint32_t tmpIdx = 2*nPE; */
-
-    /*         for (blkCnt=0; blkCnt<tmpBS; blkCnt++){ */
-    /*           //printf("blkCnt %d, tmpIdx*blkCnt %d\n", blkCnt, tmpIdx*blkCnt); */
-    /*           sum1 += pSrcA[tmpIdx*blkCnt] * pSrcB[tmpIdx*blkCnt]; */
-    /*           sum2 += pSrcA[tmpIdx*blkCnt + nPE] * pSrcB[tmpIdx*blkCnt + nPE]; */
-    /*         } */
-
-    /* #else // PLP_MATH_LOOPUNROLL */
-
-    for (blkCnt = 0; blkCnt < blkSizePE; blkCnt++) {
-        sum1 += pSrcA[nPE * blkCnt] * pSrcB[nPE * blkCnt];
+    if (end > args->blkSizePE) {
+        end = args->blkSizePE;
     }
 
-    /* #endif // PLP_MATH_LOOPUNROLL */
-
-    //* resBufferPE = sum1 + sum2;
-    *resBufferPE = sum1;
+    if (start < end) {
+        plp_dot_prod_f32s_xpulpv2(args->pSrcA + start, args->pSrcB + start, end - start, &sum);
+    }
 
-    // printf("resBufferPE %d, core id %d\n", *resBufferPE, rt_core_id());
+    args->resBuffer[core_id] = sum;
 }
 
-/* #define PLP_MATH_LOOPUNROLL */
-
 /**
    @} end of BasicDotProdKernels group
 */
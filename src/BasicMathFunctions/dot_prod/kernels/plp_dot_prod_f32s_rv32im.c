@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f32s_rv32im.c
+ * Description:  32-bit float dot product kernel for the FC, in fixed point
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Dot product of 32-bit float vectors kernel for RV32IM extension, in fixed point.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par
+  Both vectors are converted to fixed point with the exponent of their largest value, with 24
+  significant bits, and multiplied and accumulated with 64 bit integer instructions only, such that
+  the FC does not need soft-float calls (see PLP_FC_FIXED_POINT). The products are shifted to the
+  right for vectors of more than 2^15 values, such that the sum cannot overflow.
+ */
+
+void plp_dot_prod_f32s_rv32im(const float32_t *__restrict__ pSrcA,
+                              const float32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t expA = 1, expB = 1, exp;
+    uint32_t guard = 0;
+    int64_t sum = 0;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        exp = plp_f32_exp_inline(pSrcA[blkCnt]);
+        expA = (exp > expA) ? exp : expA;
+        exp = plp_f32_exp_inline(pSrcB[blkCnt]);
+        expB = (exp > expB) ? exp : expB;
+    }
+
+    while ((blockSize >> (15 + guard)) != 0) {
+        guard++;
+    }
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += ((int64_t)plp_f32_to_fix_inline(pSrcA[blkCnt], expA) *
+                plp_f32_to_fix_inline(pSrcB[blkCnt], expB)) >>
+               guard;
+    }
+
+    *pRes = plp_fix_to_f32_inline(sum, expA + expB - 300 + (int32_t)guard);
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -53,9 +53,47 @@ void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
                                uint32_t blockSize,
                                float32_t *__restrict__ pRes) {
 
-    for (int i = 0; i < blockSize; i++) {
-        *pRes += *(pSrcA++) * (*(pSrcB++));
+    uint32_t blkCnt;    /* Loop counter */
+    float32_t sum1 = 0; /* Temporary return variable */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    float32_t sum[PLP_DOTPROD_UNROLL] = { 0 }; /* independent partial sums */
+    uint32_t u;
+
+    blkCnt = blockSize / PLP_DOTPROD_UNROLL;
+
+    if (blkCnt > 0U) {
+        do {
+            for (u = 0; u < PLP_DOTPROD_UNROLL; u++) {
+                sum[u] += pSrcA[u] * pSrcB[u];
+            }
+            pSrcA += PLP_DOTPROD_UNROLL;
+            pSrcB += PLP_DOTPROD_UNROLL;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
+
+    for (u = 0; u < PLP_DOTPROD_UNROLL; u++) {
+        sum1 += sum[u];
+    }
+
+    blkCnt = blockSize % PLP_DOTPROD_UNROLL;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    if (blkCnt > 0U) {
+        do {
+            sum1 += (*pSrcA++) * (*pSrcB++);
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    *pRes += sum1;
 }
 
 /**
@@ -55,49 +55,66 @@
   @par Exploiting SIMD instructions
   The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
   performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of pSrcA
+  are computed one by one, such that the SIMD loop reads pSrcA with aligned words. pSrcB is read
+  with aligned words as well if it has the same offset within a word as pSrcA.
  */
 
 void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                const int16_t *__restrict__ pSrcB,
                                uint32_t blockSize,
                                int32_t *__restrict__ pRes) {
-    uint32_t blkCnt, tmpBS;     /* Loop counter, temporal BlockSize */
+    uint32_t blkCnt;            /* Loop counter */
     int32_t sum1 = 0, sum2 = 0; /* Temporary return variable */
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    tmpBS = (blockSize >> 2);
-
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
+    /* Compute the samples before the first word-aligned sample of pSrcA */
+    blkCnt = plp_align_head(pSrcA, sizeof(int16_t), blockSize);
+    blockSize -= blkCnt;
 
-        v2s a0 = *((v2s *)((void *)(pSrcA + 4 * blkCnt)));
-        v2s b0 = *((v2s *)((void *)(pSrcB + 4 * blkCnt)));
-        v2s a1 = *((v2s *)((void *)(pSrcA + 4 * blkCnt + 2)));
-        v2s b1 = *((v2s *)((void *)(pSrcB + 4 * blkCnt + 2)));
-        sum1 = __SUMDOTP2(a0, b0, sum1);
-        sum2 = __SUMDOTP2(a1, b1, sum2);
-
-        // sum = __MAC(sum, (*pSrcA++), (*pSrcB++));
-        // sum = __MAC(sum, (*pSrcA++), (*pSrcB++));
+    if (blkCnt > 0U) {
+        do {
+            sum1 += (*pSrcA++) * (*pSrcB++);
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
-    tmpBS = (blockSize % 4U);
-
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
-        int16_t a = *((int16_t *)(pSrcA + 4 * (blockSize / 4) + blkCnt));
-        int16_t b = *((int16_t *)(pSrcB + 4 * (blockSize / 4) + blkCnt));
-        sum1 += a * b;
-        // sum = __MAC(sum, (*pSrcA++), (*pSrcB++));
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 2U;
+
+    if (blkCnt > 0U) {
+        do {
+            v2s a0 = *((v2s *)((void *)pSrcA));
+            v2s b0 = *((v2s *)((void *)pSrcB));
+            v2s a1 = *((v2s *)((void *)(pSrcA + 2)));
+            v2s b1 = *((v2s *)((void *)(pSrcB + 2)));
+            sum1 = __SUMDOTP2(a0, b0, sum1);
+            sum2 = __SUMDOTP2(a1, b1, sum2);
+            pSrcA += 4;
+            pSrcB += 4;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
+    /* Compute remaining samples */
+    blkCnt = blockSize & 0x3U;
+
 #else // PLP_MATH_LOOPUNROLL
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
-    }
+    blkCnt = blockSize;
 
 #endif // PLP_MATH_LOOPUNROLL
 
+    if (blkCnt > 0U) {
+        do {
+            sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
     *pRes = sum1 + sum2;
 }
 
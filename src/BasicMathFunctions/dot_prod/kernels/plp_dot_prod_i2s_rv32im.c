@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i2s_rv32im.c
+ * Description:  2-bit integer dot product kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Scalar dot product of 2-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+  @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par
+  Every byte is loaded once, and its 4 values are sign-extended with shifts.
+ */
+
+void plp_dot_prod_i2s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    uint32_t k;
+    int32_t sum = 0; /* Temporary return variable */
+    int32_t a, b;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
+        a = pSrcA[blkCnt];
+        b = pSrcB[blkCnt];
+        sum += ((int32_t)((uint32_t)a << 30) >> 30) * ((int32_t)((uint32_t)b << 30) >> 30) +
+               ((int32_t)((uint32_t)a << 28) >> 30) * ((int32_t)((uint32_t)b << 28) >> 30) +
+               ((int32_t)((uint32_t)a << 26) >> 30) * ((int32_t)((uint32_t)b << 26) >> 30) +
+               (a >> 6) * (b >> 6);
+    }
+
+    for (k = blockSize & ~0x3U; k < blockSize; k++) {
+        sum += plp_get_i2(pSrcA, k) * plp_get_i2(pSrcB, k);
+    }
+
+    *pRes = sum;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
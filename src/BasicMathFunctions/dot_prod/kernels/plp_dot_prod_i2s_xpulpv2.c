@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i2s_xpulpv2.c
+ * Description:  2-bit integer dot product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Vectorized dot product of 2-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+  @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every word of 16 values is sign-extended to 4 vectors of 4 bytes in registers
+  (plp_unpack_i2), which are multiplied with the 8-bit dot product instructions, with 32 bit
+  accumulators. The vectors must be aligned to 4 bytes.
+ */
+
+void plp_dot_prod_i2s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    uint32_t k;
+    int32_t sum0 = 0, sum1 = 0; /* Temporary return variables */
+    const v4s *pA = (const v4s *)pSrcA;
+    const v4s *pB = (const v4s *)pSrcB;
+    v4s a, b;
+
+    /* Compute 16 samples, one word, at a time */
+    for (blkCnt = 0; blkCnt < (blockSize >> 4); blkCnt++) {
+        a = *pA++;
+        b = *pB++;
+        sum0 = __SUMDOTP4(plp_unpack_i2(a, 0), plp_unpack_i2(b, 0), sum0);
+        sum1 = __SUMDOTP4(plp_unpack_i2(a, 1), plp_unpack_i2(b, 1), sum1);
+        sum0 = __SUMDOTP4(plp_unpack_i2(a, 2), plp_unpack_i2(b, 2), sum0);
+        sum1 = __SUMDOTP4(plp_unpack_i2(a, 3), plp_unpack_i2(b, 3), sum1);
+    }
+
+    /* Compute the remaining samples */
+    for (k = blockSize & ~0xFU; k < blockSize; k++) {
+        sum0 += plp_get_i2(pSrcA, k) * plp_get_i2(pSrcB, k);
+    }
+
+    *pRes = sum0 + sum1;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
  * Title:        plp_dot_prod_i32p_xpulpv2.c
- * Description:  32-bit integer scalar dot product for XPULPV2 with interleaved access
+ * Description:  32-bit integer scalar dot product for XPULPV2 with contiguous chunks
  *
  * $Date:        03. Jun 2019
  * $Revision:    V0
@@ -45,7 +45,7 @@
  */
 
 /**
-  @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
+  @brief Parallel dot product with contiguous chunks of 32-bit integer vectors kernel for XPULPV2
   extension.
   @param[in]  S     points to the instance structure for integer parallel dot product
   @return        none
@@ -53,39 +53,26 @@
 
 void plp_dot_prod_i32p_xpulpv2(void *S) {
 
-    int32_t *pSrcA = (int32_t *)(((plp_dot_prod_instance_i32 *)S)->pSrcA) + rt_core_id();
-    int32_t *pSrcB = (int32_t *)(((plp_dot_prod_instance_i32 *)S)->pSrcB) + rt_core_id();
-    uint32_t blkSizePE = ((plp_dot_prod_instance_i32 *)S)->blkSizePE;
-    uint32_t nPE = ((plp_dot_prod_instance_i32 *)S)->nPE;
-    int32_t *resBufferPE = &(((plp_dot_prod_instance_i32 *)S)->resBuffer[rt_core_id()]);
+    plp_dot_prod_instance_i32 *args = (plp_dot_prod_instance_i32 *)S;
+    uint32_t core_id = plp_core_id();
 
-    uint32_t blkCnt, tmpBS;     /* Loop counter, temporal BlockSize */
-    int32_t sum1 = 0, sum2 = 0; /* Temporary return variable */
+    /* contiguous chunks of whole iterations of the unrolled loop, which every core reads with
+       post-incremented loads */
+    uint32_t chunk = (args->blkSizePE + args->nPE - 1) / args->nPE;
+    chunk = (chunk + PLP_DOTPROD_UNROLL - 1) / PLP_DOTPROD_UNROLL * PLP_DOTPROD_UNROLL;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    int32_t sum = 0;
 
-    // rt_team_barrier();
-
-#if defined(PLP_MATH_LOOPUNROLL)
-
-    tmpBS = (blkSizePE >> 1);
-    uint32_t tmpIdx = 2 * nPE;
-
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
-        // printf("blkCnt %d, tmpIdx*blkCnt %d\n", blkCnt, tmpIdx*blkCnt);
-        sum1 = __MAC(sum1, pSrcA[tmpIdx * blkCnt], pSrcB[tmpIdx * blkCnt]);
-        sum2 = __MAC(sum2, pSrcA[tmpIdx * blkCnt + nPE], pSrcB[tmpIdx * blkCnt + nPE]);
+    if (end > args->blkSizePE) {
+        end = args->blkSizePE;
     }
 
-#else // PLP_MATH_LOOPUNROLL
-
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt = blkCnt + nPE) {
-        sum1 = __MAC(sum1, pSrcA[blkCnt], pSrcB[blkCnt]);
+    if (start < end) {
+        plp_dot_prod_i32s_xpulpv2(args->pSrcA + start, args->pSrcB + start, end - start, &sum);
     }
 
-#endif // PLP_MATH_LOOPUNROLL
-
-    *resBufferPE = sum1 + sum2;
-
-    // printf("resBufferPE %d, core id %d\n", *resBufferPE, rt_core_id());
+    args->resBuffer[core_id] = sum;
 }
 
 /**
@@ -57,33 +57,47 @@ void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
                                const int32_t *__restrict__ pSrcB,
                                uint32_t blockSize,
                                int32_t *__restrict__ pRes) {
-    uint32_t blkCnt, tmpBS;     /* Loop counter, temporal BlockSize */
-    int32_t sum1 = 0, sum2 = 0; /* Temporary return variable */
+    uint32_t blkCnt;  /* Loop counter */
+    int32_t sum1 = 0; /* Temporary return variable */
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    tmpBS = (blockSize >> 1);
+    int32_t sum[PLP_DOTPROD_UNROLL] = { 0 }; /* independent partial sums */
+    uint32_t u;
 
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
-        sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
-        sum2 = __MAC(sum2, (*pSrcA++), (*pSrcB++));
-    }
+    blkCnt = blockSize / PLP_DOTPROD_UNROLL;
 
-    tmpBS = (blockSize % 2U);
+    if (blkCnt > 0U) {
+        do {
+            for (u = 0; u < PLP_DOTPROD_UNROLL; u++) {
+                sum[u] = __MAC(sum[u], pSrcA[u], pSrcB[u]);
+            }
+            pSrcA += PLP_DOTPROD_UNROLL;
+            pSrcB += PLP_DOTPROD_UNROLL;
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
 
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
-        sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
+    for (u = 0; u < PLP_DOTPROD_UNROLL; u++) {
+        sum1 += sum[u];
     }
 
+    blkCnt = blockSize % PLP_DOTPROD_UNROLL;
+
 #else // PLP_MATH_LOOPUNROLL
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
-    }
+    blkCnt = blockSize;
 
 #endif // PLP_MATH_LOOPUNROLL
 
-    *pRes = sum1 + sum2;
+    if (blkCnt > 0U) {
+        do {
+            sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    *pRes = sum1;
 }
 
 /**
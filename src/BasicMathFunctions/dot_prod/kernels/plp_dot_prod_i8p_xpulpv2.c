@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i8p_xpulpv2.c
+ * Description:  8-bit integer parallel dot product for XPULPV2 with contiguous chunks
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Parallel dot product with contiguous chunks of 8-bit integer vectors kernel for
+  XPULPV2 extension.
+  @param[in]  S     points to the instance structure for the parallel dot product
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Every core computes the dot product of its own contiguous chunk of the vectors with the SIMD
+  singlecore kernel into its partial result, which the glue code sums up.
+ */
+
+void plp_dot_prod_i8p_xpulpv2(void *S) {
+
+    plp_dot_prod_instance_i8 *args = (plp_dot_prod_instance_i8 *)S;
+    uint32_t core_id = plp_core_id();
+
+    /* contiguous chunks of whole iterations of the SIMD loop (8 samples), such that every chunk
+       of word-aligned vectors starts at a word-aligned sample */
+    uint32_t chunk = ((args->blockSize + args->nPE - 1) / args->nPE + 7U) & ~7U;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    int32_t sum = 0;
+
+    if (end > args->blockSize) {
+        end = args->blockSize;
+    }
+
+    if (start < end) {
+        plp_dot_prod_i8s_xpulpv2(args->pSrcA + start, args->pSrcB + start, end - start, &sum);
+    }
+
+    args->resBuffer[core_id] = sum;
+}
+
+/**
+   @} end of BasicDotProdKernels group
+*/
@@ -55,49 +55,66 @@
   @par Exploiting SIMD instructions
   The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
   performed on 32 bit vectors, with 32 bit accumulator.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of pSrcA
+  are computed one by one, such that the SIMD loop reads pSrcA with aligned words. pSrcB is read
+  with aligned words as well if it has the same offset within a word as pSrcA.
  */
 
 void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                               const int8_t *__restrict__ pSrcB,
                               uint32_t blockSize,
                               int32_t *__restrict__ pRes) {
-    uint32_t blkCnt, tmpBS;     /* Loop counter, temporal BlockSize */
+    uint32_t blkCnt;            /* Loop counter */
     int32_t sum1 = 0, sum2 = 0; /* Temporary return variable */
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    tmpBS = (blockSize >> 3);
-
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
+    /* Compute the samples before the first word-aligned sample of pSrcA */
+    blkCnt = plp_align_head(pSrcA, sizeof(int8_t), blockSize);
+    blockSize -= blkCnt;
 
-        v4s a0 = *((v4s *)((void *)(pSrcA + 8 * blkCnt)));
-        v4s b0 = *((v4s *)((void *)(pSrcB + 8 * blkCnt)));
-        v4s a1 = *((v4s *)((void *)(pSrcA + 8 * blkCnt + 4)));
-        v4s b1 = *((v4s *)((void *)(pSrcB + 8 * blkCnt + 4)));
-        sum1 = __SUMDOTP4(a0, b0, sum1);
-        sum2 = __SUMDOTP4(a1, b1, sum2);
-
-        // sum = __MAC(sum, (*pSrcA++), (*pSrcB++));
-        // sum = __MAC(sum, (*pSrcA++), (*pSrcB++));
+    if (blkCnt > 0U) {
+        do {
+            sum1 += (*pSrcA++) * (*pSrcB++);
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
-    tmpBS = (blockSize % 8U);
-
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
-        int8_t a = *((int8_t *)(pSrcA + 8 * (blockSize / 8) + blkCnt));
-        int8_t b = *((int8_t *)(pSrcB + 8 * (blockSize / 8) + blkCnt));
-        sum1 += a * b;
-        // sum = __MAC(sum, (*pSrcA++), (*pSrcB++));
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 3U;
+
+    if (blkCnt > 0U) {
+        do {
+            v4s a0 = *((v4s *)((void *)pSrcA));
+            v4s b0 = *((v4s *)((void *)pSrcB));
+            v4s a1 = *((v4s *)((void *)(pSrcA + 4)));
+            v4s b1 = *((v4s *)((void *)(pSrcB + 4)));
+            sum1 = __SUMDOTP4(a0, b0, sum1);
+            sum2 = __SUMDOTP4(a1, b1, sum2);
+            pSrcA += 8;
+            pSrcB += 8;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
+    /* Compute remaining samples */
+    blkCnt = blockSize & 0x7U;
+
 #else // PLP_MATH_LOOPUNROLL
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
-    }
+    blkCnt = blockSize;
 
 #endif // PLP_MATH_LOOPUNROLL
 
+    if (blkCnt > 0U) {
+        do {
+            sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
     *pRes = sum1 + sum2;
 }
 
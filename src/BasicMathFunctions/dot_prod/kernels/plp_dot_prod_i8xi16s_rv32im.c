@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Dot product of 8-bit by 16-bit integer vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Scalar dot product of an 8-bit with a 16-bit integer vector kernel for RV32IM extension.
+  @param[in]  pSrcA      points to the first input vector [8 bit]
+  @param[in]  pSrcB      points to the second input vector [16 bit]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+ */
+
+void plp_dot_prod_i8xi16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                 const int16_t *__restrict__ pSrcB,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pRes) {
+    uint32_t blkCnt; /* Loop counter */
+    int32_t sum = 0; /* Temporary return variable */
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += (int32_t)(*pSrcA++) * (int32_t)(*pSrcB++);
+    }
+
+    *pRes = sum;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
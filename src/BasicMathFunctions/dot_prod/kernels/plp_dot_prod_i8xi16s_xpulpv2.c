@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Dot product of 8-bit by 16-bit integer vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Vectorized dot product of an 8-bit with a 16-bit integer vector kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA      points to the first input vector [8 bit]
+  @param[in]  pSrcB      points to the second input vector [16 bit]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every word of 4 values of pSrcA is sign-extended to 2 vectors of 2 halfwords, the even and the
+  odd elements (plp_unpack_i8), and the 4 values of pSrcB are rearranged the same way with
+  shuffles. The products are computed with the 16-bit dot product instructions, with 32 bit
+  accumulator.
+ */
+
+void plp_dot_prod_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pRes) {
+    uint32_t blkCnt;            /* Loop counter */
+    int32_t sum1 = 0, sum2 = 0; /* Temporary return variable */
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 2U); blkCnt++) {
+        v4s a = *((v4s *)((void *)pSrcA));
+        v2s b0 = *((v2s *)((void *)pSrcB));
+        v2s b1 = *((v2s *)((void *)(pSrcB + 2)));
+        sum1 = __SUMDOTP2(plp_unpack_i8(a, 0), __builtin_shuffle(b0, b1, (v2s){ 0, 2 }), sum1);
+        sum2 = __SUMDOTP2(plp_unpack_i8(a, 1), __builtin_shuffle(b0, b1, (v2s){ 1, 3 }), sum2);
+        pSrcA += 4;
+        pSrcB += 4;
+    }
+
+    for (blkCnt = 0; blkCnt < (blockSize & 0x3U); blkCnt++) {
+        sum1 = __MAC(sum1, (*pSrcA++), (*pSrcB++));
+    }
+
+    *pRes = sum1 + sum2;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
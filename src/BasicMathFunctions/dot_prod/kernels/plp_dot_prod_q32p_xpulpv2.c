@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
  * Title:        plp_dot_prod_q32p_xpulpv2.c
- * Description:  32-bit fixed point scalar dot product for XPULPV2 with interleaved access
+ * Description:  32-bit fixed point scalar dot product for XPULPV2 with contiguous chunks
  *
  * $Date:        04. Jun 2019
  * $Revision:    V0
@@ -45,7 +45,7 @@
  */
 
 /**
-  @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
+  @brief Parallel dot product with contiguous chunks of 32-bit fixed point vectors kernel for
   XPULPV2 extension.
   @param[in]  S     points to the instance structure for fixed point parallel dot product
   @return        none
@@ -53,64 +53,26 @@
 
 void plp_dot_prod_q32p_xpulpv2(void *S) {
 
-    int core_id = rt_core_id();
-
     plp_dot_prod_instance_q32 *args = (plp_dot_prod_instance_q32 *)S;
+    uint32_t core_id = plp_core_id();
 
-    int32_t *pSrcA = (int32_t *)(args->pSrcA);
-    int32_t *pSrcB = (int32_t *)(args->pSrcB);
-    uint32_t blkSizePE = args->blkSizePE;
-    uint32_t deciPoint = args->deciPoint;
-    uint32_t nPE = args->nPE;
-    int32_t *resBufferPE = &(args->resBuffer[core_id]);
-
-    // *NOTICE* here, we can do something better for performance, by splitting it more evenly.
-    // If (blkSizePe / nPE) is odd, then each core will process (blkSizePe / nPE) - 1 elements.
-    // This is due to verification reasons: FOr the non-parallel case, we always sum up two
-    // temporary values, and then execute __ROUNDNORM_REG. To mimik this behavior, every core
-    // (except the last one) will process an even number of elements. This way, the last core will
-    // have to do more work, but the result of this function will identical to the result of the
-    // singlecore implementation.
-    // set the default block size
-    uint32_t blkSize = (blkSizePE / nPE) & 0xFFFFFFFE; // the and makes sure the block size is even
+    /* contiguous chunks of an even number of samples, such that the cores round the same pairs of
+       products as the singlecore kernel and the result is identical */
+    uint32_t chunk = ((args->blkSizePE + args->nPE - 1) / args->nPE + 1U) & ~1U;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    int32_t sum = 0;
 
-    // set pSrcA and pSrcB to the correct location
-    pSrcA += core_id * blkSize;
-    pSrcB += core_id * blkSize;
-
-    // set the block size for the last core
-    if (core_id == nPE - 1) {
-        blkSize = blkSizePE - (nPE - 1) * blkSize;
+    if (end > args->blkSizePE) {
+        end = args->blkSizePE;
     }
 
-    if (blkSize == 0) {
-        *resBufferPE = 0;
-        return;
-    }
-
-    int32_t i, sum = 0;
-
-#if defined(PLP_MATH_LOOPUNROLL)
-
-    for (i = 0; i < blkSize - 1; i += 2) {
-        int32_t x0 = pSrcA[i] * pSrcB[i];
-        int32_t x1 = pSrcA[i + 1] * pSrcB[i + 1];
-        sum += __ADDROUNDNORM_REG(x0, x1, deciPoint);
+    if (start < end) {
+        plp_dot_prod_q32s_xpulpv2(args->pSrcA + start, args->pSrcB + start, end - start,
+                                  args->deciPoint, &sum);
     }
 
-    if (i != blkSize) {
-        sum += __ROUNDNORM_REG(pSrcA[i] * pSrcB[i], deciPoint);
-    }
-
-#else // PLP_MATH_LOOPUNROLL
-
-    for (i = 0; i < blkSize; i++) {
-        sum += __ROUNDNORM_REG(pSrcA[i] * pSrcB[i], deciPoint);
-    }
-
-#endif // PLP_MATH_LOOPUNROLL
-
-    *resBufferPE = sum;
+    args->resBuffer[core_id] = sum;
 }
 
 /**
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_ters_xpulpv2.c
+ * Description:  ternary dot product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Vectorized dot product of ternary vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector [2 bitplanes, packed]
+  @param[in]  pSrcB      points to the second input vector [2 bitplanes, packed]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Exploiting bit operations
+  The set bits are counted with the p.cnt instruction, 32 values at a time.
+ */
+
+void plp_dot_prod_ters_xpulpv2(const uint32_t *__restrict__ pSrcA,
+                               const uint32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes) {
+
+    uint32_t nWords = blockSize >> 5; /* complete words of each bitplane */
+    uint32_t tail = blockSize & 0x1FU; /* elements in the last, incomplete word */
+    uint32_t blkCnt;                   /* Loop counter */
+    uint32_t nonzero = 0;              /* number of nonzero products */
+    uint32_t positive = 0;             /* number of positive products */
+    uint32_t m;
+
+    for (blkCnt = 0; blkCnt < nWords; blkCnt++) {
+        m = pSrcA[2 * blkCnt] & pSrcB[2 * blkCnt];
+        nonzero += __builtin_popcount(m);
+        positive += __builtin_popcount(m & ~(pSrcA[2 * blkCnt + 1] ^ pSrcB[2 * blkCnt + 1]));
+    }
+
+    if (tail > 0) {
+        m = pSrcA[2 * nWords] & pSrcB[2 * nWords] & ((1U << tail) - 1);
+        nonzero += __builtin_popcount(m);
+        positive += __builtin_popcount(m & ~(pSrcA[2 * nWords + 1] ^ pSrcB[2 * nWords + 1]));
+    }
+
+    *pRes = 2 * (int32_t)positive - (int32_t)nonzero;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_bin.c
+ * Description:  binary dot product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of binary vectors.
+  @param[in]  pSrcA      points to the first input vector [1 bit, packed]
+  @param[in]  pSrcB      points to the second input vector [1 bit, packed]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Data layout
+  The values are +1 or -1, one bit each, with a set bit for +1. Element k is the bit k % 32 of
+  the word k / 32. The bits after the last element are ignored.
+
+  @par Exploiting bit operations
+  The dot product of 32 values is computed with an XNOR, which sets the bits of the equal
+  values, and a popcount: it is 2 * popcount(~(a ^ b)) - 32. On the cluster, the popcount is the
+  p.cnt instruction of XPULPV2, i.e. 32 multiply-accumulates take about 3 instructions.
+ */
+
+void plp_dot_prod_bin(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dot_prod_bins_rv32im(pSrcA, pSrcB, blockSize, pRes);
+    } else {
+        plp_dot_prod_bins_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -59,8 +59,12 @@ void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
                       float32_t *__restrict__ pRes) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
+#if defined(PLP_FC_FIXED_POINT)
+        plp_dot_prod_f32s_rv32im(pSrcA, pSrcB, blockSize, pRes);
+#else
         printf("error: FC doesn't have FPU\n");
         return;
+#endif
     } else {
         plp_dot_prod_f32s_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
     }
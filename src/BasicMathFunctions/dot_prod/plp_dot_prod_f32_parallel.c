@@ -64,8 +64,11 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_dot_prod_f32_parallel), blockSize);
+        }
 
-        uint32_t i, tmpblkSizePE = blockSize / nPE;
+        uint32_t i;
         float32_t resBuffer[rt_nb_pe()];
 
         plp_dot_prod_instance_f32 S;
@@ -74,7 +77,7 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
         S.pSrcA = pSrcA;
         // printf("pSrcA[0] %d\n", pSrcA[0]);
         S.pSrcB = pSrcB;
-        S.blkSizePE = tmpblkSizePE;
+        S.blkSizePE = blockSize;
         S.nPE = nPE;
         S.resBuffer = resBuffer;
 
@@ -86,25 +89,7 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
             sum += resBuffer[i];
         }
 
-        /* #if defined(PLP_MATH_LOOPUNROLL) */
-        /* #undef PLP_MATH_LOOPUNROLL */
-        /* #endif */
-
-        /* #if defined(PLP_MATH_LOOPUNROLL) */
-        /*     //uint32_t blkCnt = blockSize/nPE/2 * 2 * nPE; */
-        /*     //printf("blkCnt %d\n", blkCnt); */
-        /*     for (i= ((tmpblkSizePE>>1) <<1) * nPE; i<blockSize; i++){ */
-        /*       sum += pSrcA[i] * pSrcB[i]; */
-        /*     } */
-        /* #else // PLP_MATH_LOOPUNROLL */
-        for (i = (tmpblkSizePE)*nPE; i < blockSize; i++) {
-            sum += pSrcA[i] * pSrcB[i];
-        }
-        /* #endif */
-
         *pRes = sum;
-
-        /* #define PLP_MATH_LOOPUNROLL */
     }
 }
 
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i2.c
+ * Description:  2-bit integer dot product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of 2-bit integer vectors.
+  @param[in]  pSrcA      points to the first input vector [2 bit, packed]
+  @param[in]  pSrcB      points to the second input vector [2 bit, packed]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Data layout
+  The vectors are packed, 4 values per byte in two's complement, element k in the bits
+  2k to 2k+1 of the vector (see plp_get_i2). On the cluster, they must be aligned to 4
+  bytes.
+
+  @par Exploiting SIMD instructions
+  The XPULPV2 kernel sign-extends the 2-bit values of a word to 4 vectors of 4 bytes in
+  registers, and accumulates them with the 8-bit dot product instructions. With PLP_XPULPNN, the
+  XpulpNN kernel multiplies all 16 values of a word with a single pv.sdotsp.c instruction.
+ */
+
+void plp_dot_prod_i2(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dot_prod_i2s_rv32im(pSrcA, pSrcB, blockSize, pRes);
+    } else {
+        PLP_CL_KERNEL(plp_dot_prod_i2s)(pSrcA, pSrcB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -64,8 +64,11 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_dot_prod_i32_parallel), blockSize);
+        }
 
-        uint32_t i, tmpblkSizePE = blockSize / nPE;
+        uint32_t i;
         int32_t resBuffer[rt_nb_pe()];
         // initialize results buffer
         /* not necessary
@@ -82,7 +85,7 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
         S.pSrcA = pSrcA;
         // printf("pSrcA[0] %d\n", pSrcA[0]);
         S.pSrcB = pSrcB;
-        S.blkSizePE = tmpblkSizePE;
+        S.blkSizePE = blockSize;
         S.nPE = nPE;
         S.resBuffer = resBuffer;
 
@@ -93,17 +96,6 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
         for (i = 0; i < nPE; i++) { // not necessary rt_nb_pe()
             sum += resBuffer[i];
         }
-#if defined(PLP_MATH_LOOPUNROLL)
-        // uint32_t blkCnt = blockSize/nPE/2 * 2 * nPE;
-        // printf("blkCnt %d\n", blkCnt);
-        for (i = ((tmpblkSizePE >> 1) << 1) * nPE; i < blockSize; i++) {
-            sum = __MAC(sum, pSrcA[i], pSrcB[i]);
-        }
-#else // PLP_MATH_LOOPUNROLL
-        for (i = (tmpblkSizePE)*nPE; i < blockSize; i++) {
-            sum += pSrcA[i] * pSrcB[i];
-        }
-#endif
 
         *pRes = sum;
     }
@@ -55,6 +55,10 @@
   @par Exploiting SIMD instructions
        When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then
   the four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+
+  @par Alignment
+  The vectors may have any alignment. On the cluster, the call is fastest if all vectors have the
+  same offset within a 32-bit word, e.g. sub-slices at the same index of word-aligned buffers.
  */
 
 void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
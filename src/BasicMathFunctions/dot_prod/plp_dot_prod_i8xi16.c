@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Glue code for the dot product of 8-bit by 16-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of an 8-bit with a 16-bit integer vector, e.g. of 8-bit weights
+         with 16-bit activations.
+  @param[in]  pSrcA      points to the first input vector [8 bit]
+  @param[in]  pSrcB      points to the second input vector [16 bit]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Exploiting SIMD instructions
+  On the cluster, the 8 bit values are sign-extended to vectors of 2 halfwords in registers, such
+  that they are never stored widened, and multiplied with the 16-bit dot product instructions.
+ */
+
+void plp_dot_prod_i8xi16(const int8_t *__restrict__ pSrcA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dot_prod_i8xi16s_rv32im(pSrcA, pSrcB, blockSize, pRes);
+    } else {
+        plp_dot_prod_i8xi16s_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -66,6 +66,9 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_dot_prod_q32_parallel), blockSize);
+        }
 
         uint32_t i;
         int32_t resBuffer[rt_nb_pe()];
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_stride_f32.c
+ * Description:  strided dot product of 32-bit floating-point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for strided dot product of 32-bit floating-point vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    stride of the first input vector (elements between two samples)
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    stride of the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par
+  The samples are taken every stride elements, e.g. along a column of a matrix, such that no copy
+  is needed. If all strides are 1, the contiguous kernels of plp_dot_prod_f32 are used instead.
+ */
+
+void plp_dot_prod_stride_f32(const float32_t *__restrict__ pSrcA,
+                             uint32_t strideA,
+                             const float32_t *__restrict__ pSrcB,
+                             uint32_t strideB,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pRes) {
+
+    if (strideA == 1 && strideB == 1) {
+        plp_dot_prod_f32(pSrcA, pSrcB, blockSize, pRes);
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_dot_prod_stride_f32s_xpulpv2(pSrcA, strideA, pSrcB, strideB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
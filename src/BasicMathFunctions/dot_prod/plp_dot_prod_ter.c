@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_ter.c
+ * Description:  ternary dot product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of ternary vectors.
+  @param[in]  pSrcA      points to the first input vector [2 bitplanes, packed]
+  @param[in]  pSrcB      points to the second input vector [2 bitplanes, packed]
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Data layout
+  The values are -1, 0 or +1, stored in two bitplanes. The words 2i and 2i + 1 of a vector hold
+  the elements 32i to 32i + 31: word 2i has a set bit for every nonzero value, and word 2i + 1 a
+  set bit for every negative one. Element k is the bit k % 32 of these words. The bits after the
+  last element are ignored.
+
+  @par Exploiting bit operations
+  With m = nzA & nzB, the bits of the nonzero products, the dot product of 32 values is
+  2 * popcount(m & ~(signA ^ signB)) - popcount(m). On the cluster, the popcount is the p.cnt
+  instruction of XPULPV2.
+ */
+
+void plp_dot_prod_ter(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dot_prod_ters_rv32im(pSrcA, pSrcB, blockSize, pRes);
+    } else {
+        plp_dot_prod_ters_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_q8s_rv32im.c
+ * Description:  Saturating 8-bit fixed-point multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMult
+ */
+
+/**
+  @addtogroup BasicMultKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element saturating multiplication of 8-bit fixed-point vectors kernel for RV32IM
+         extension.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[in]     deciPoint  decimal point for right shift
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Saturation
+  The result is rounded to the nearest value, shifted right by deciPoint and saturated to the range
+  of the output type.
+ */
+
+void plp_mult_q8s_rv32im(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t rnd = (deciPoint > 0) ? 1 << (deciPoint - 1) : 0;
+    int32_t acc;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* C = sat((A * B) >> deciPoint) */
+        acc = ((*pSrcA++) * (*pSrcB++) + rnd) >> deciPoint;
+        *pDst++ = (acc > 127) ? 127 : ((acc < -128) ? -128 : (int8_t)acc);
+        acc = ((*pSrcA++) * (*pSrcB++) + rnd) >> deciPoint;
+        *pDst++ = (acc > 127) ? 127 : ((acc < -128) ? -128 : (int8_t)acc);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        /* C = sat((A * B) >> deciPoint) */
+        acc = ((*pSrcA++) * (*pSrcB++) + rnd) >> deciPoint;
+        *pDst++ = (acc > 127) ? 127 : ((acc < -128) ? -128 : (int8_t)acc);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicMultKernels group
+ */
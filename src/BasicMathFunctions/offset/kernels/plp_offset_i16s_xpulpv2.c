@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_offset_i16s_xpulpv2.c
+ * Description:  16-bit integer offset kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicOffset
+ */
+
+/**
+  @addtogroup BasicOffsetKernels
+  @{
+ */
+
+/**
+  @brief Offset of a 16-bit integer vector kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     value added to each sample
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The samples are packed two per 32-bit word, and the sums are computed with a single SIMD
+  instruction.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of pSrc
+  are computed one by one, such that the SIMD loop reads pSrc with aligned words. pDst is
+  accessed with aligned words as well if it has the same offset within a word as pSrc.
+ */
+
+void plp_offset_i16s_xpulpv2(const int16_t *pSrc,
+                             int16_t offset,
+                             int16_t *pDst,
+                             uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const v2s *pS;
+    v2s *pD;
+    v2s off = (v2s){ offset, offset };
+
+    /* Compute the samples before the first word-aligned sample of pSrc */
+    blkCnt = plp_align_head(pSrc, sizeof(int16_t), blockSize);
+    blockSize -= blkCnt;
+
+    if (blkCnt > 0U) {
+        do {
+            *pDst++ = (*pSrc++) + offset;
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    pS = (const v2s *)pSrc;
+    pD = (v2s *)pDst;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 2U;
+
+    if (blkCnt > 0U) {
+        do {
+            /* C = A + offset */
+            *pD++ = __ADD2(*pS++, off);
+            *pD++ = __ADD2(*pS++, off);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+    /* Loop unrolling: Compute remaining vector */
+    if (blockSize & 0x2U) {
+        *pD++ = __ADD2(*pS++, off);
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of vectors */
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            /* C = A + offset */
+            *pD++ = __ADD2(*pS++, off);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    /* Compute remaining samples */
+    pSrc = (const int16_t *)pS;
+    pDst = (int16_t *)pD;
+    blkCnt = blockSize & 0x1U;
+
+    if (blkCnt > 0U) {
+        do {
+            *pDst++ = (*pSrc++) + offset;
+
+            /* Decrement loop counter */
+            blkCnt--;
+        } while (blkCnt > 0U);
+    }
+}
+
+/**
+  @} end of BasicOffsetKernels group
+ */
@@ -0,0 +1,125 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point scaling kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicScale
+ */
+
+/**
+  @addtogroup BasicScaleKernels
+  @{
+ */
+
+/**
+  @brief Scaling of a 16-bit fixed-point vector kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor value the input vector is multiplied with
+  @param[in]     deciPoint  decimal point for right shift
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The samples are packed two per 32-bit word. Each product is computed with a dot product against a
+  vector that holds a single non-zero lane, and rounded with a normalization instruction before the
+  results are packed again.
+ */
+
+void plp_scale_q16s_xpulpv2(const int16_t *pSrc,
+                            int16_t scaleFactor,
+                            uint32_t deciPoint,
+                            int16_t *pDst,
+                            uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const v2s *pS = (const v2s *)pSrc;
+    v2s *pD = (v2s *)pDst;
+    v2s s0 = (v2s){ scaleFactor, 0 };
+    v2s s1 = (v2s){ 0, scaleFactor };
+    v2s x;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U) {
+        /* C = A * scaleFactor */
+        x = *pS++;
+        *pD++ = __PACK2(__ROUNDNORM_REG(__DOTP2(x, s0), deciPoint),
+                        __ROUNDNORM_REG(__DOTP2(x, s1), deciPoint));
+        x = *pS++;
+        *pD++ = __PACK2(__ROUNDNORM_REG(__DOTP2(x, s0), deciPoint),
+                        __ROUNDNORM_REG(__DOTP2(x, s1), deciPoint));
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining vector */
+    if (blockSize & 0x2U) {
+        x = *pS++;
+        *pD++ = __PACK2(__ROUNDNORM_REG(__DOTP2(x, s0), deciPoint),
+                        __ROUNDNORM_REG(__DOTP2(x, s1), deciPoint));
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of vectors */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* C = A * scaleFactor */
+        x = *pS++;
+        *pD++ = __PACK2(__ROUNDNORM_REG(__DOTP2(x, s0), deciPoint),
+                        __ROUNDNORM_REG(__DOTP2(x, s1), deciPoint));
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    /* Compute remaining samples */
+    pSrc = (const int16_t *)pS;
+    pDst = (int16_t *)pD;
+    blkCnt = blockSize & 0x1U;
+
+    while (blkCnt > 0U) {
+        *pDst++ = (int16_t)__ROUNDNORM_REG((*pSrc++) * scaleFactor, deciPoint);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicScaleKernels group
+ */
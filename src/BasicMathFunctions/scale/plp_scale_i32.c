@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_i32.c
+ * Description:  Glue code for the i32 scaling
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicScale Vector Scale
+  Multiplies a vector by a scalar value.
+  <pre>
+      pDst[n] = pSrc[n] * scaleFactor,   0 <= n < blockSize.
+  </pre>
+  The integer versions keep the width of the inputs and wrap around on overflow. The fixed-point
+  versions round the exact product to the nearest value before shifting it right by deciPoint.
+ */
+
+/**
+  @addtogroup BasicScale
+  @{
+ */
+
+/**
+  @brief Glue code for scaling of a 32-bit integer vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor value the input vector is multiplied with
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_scale_i32(const int32_t *pSrc,
+                   int32_t scaleFactor,
+                   int32_t *pDst,
+                   uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_scale_i32s_rv32im(pSrc, scaleFactor, pDst, blockSize);
+    } else {
+        plp_scale_i32s_xpulpv2(pSrc, scaleFactor, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicScale group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_shift_i32.c
+ * Description:  Glue code for the i32 shift
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicShift Vector Shift
+  Shifts the elements of an integer vector by a number of bits.
+  <pre>
+      pDst[n] = pSrc[n] << shiftBits,   0 <= n < blockSize.
+  </pre>
+  A positive shiftBits shifts to the left, a negative one shifts arithmetically to the right by
+  -shiftBits. Bits shifted out to the left are lost. The functions work on any fixed-point format,
+  since the shift only changes the scale of the values.
+ */
+
+/**
+  @addtogroup BasicShift
+  @{
+ */
+
+/**
+  @brief Glue code for shift of a 32-bit integer vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     shiftBits  number of bits to shift, left if positive, right if negative
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_shift_i32(const int32_t *pSrc,
+                   int32_t shiftBits,
+                   int32_t *pDst,
+                   uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_shift_i32s_rv32im(pSrc, shiftBits, pDst, blockSize);
+    } else {
+        plp_shift_i32s_xpulpv2(pSrc, shiftBits, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicShift group
+ */
@@ -25,6 +25,8 @@
 #include "plp_common_tables.h"
 #include "plp_math.h"
 
+#if !defined(PLP_QUARTER_WAVE_TABLES)
+
 /**
   @par
   Example code for q15 Twiddle factors Generation::
@@ -2663,6 +2665,8 @@ const int16_t twiddleCoef_4096_q16[6144] = {
     (int16_t)0xFF9B, (int16_t)0x8000, (int16_t)0xFFCD, (int16_t)0x8000
 };
 
+#endif // PLP_QUARTER_WAVE_TABLES
+
 const uint16_t plpBitRevIndexTable_fixed_16[PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] = {
     /* radix 4, size 12 */
     8, 64, 16, 32, 24, 96, 40, 80, 56, 112, 88, 104
@@ -3758,6 +3762,178 @@ short bit_rev_radix2_LUT[2048] = {
     127, 1151, 639, 1663, 383, 1407, 895, 1919, 255, 1279, 767, 1791, 511, 1535, 1023, 2047,
 };
 
+const uint16_t plpBitRevIndexTable_rfft_2048[PLPBITREVINDEXTABLE_RFFT_2048_TABLE_LENGTH] = {
+    /* pairs of complex indices to swap, size 1984 */
+    1, 1024, 2, 512, 3, 1536, 4, 256, 5, 1280, 6, 768,
+    7, 1792, 8, 128, 9, 1152, 10, 640, 11, 1664, 12, 384,
+    13, 1408, 14, 896, 15, 1920, 16, 64, 17, 1088, 18, 576,
+    19, 1600, 20, 320, 21, 1344, 22, 832, 23, 1856, 24, 192,
+    25, 1216, 26, 704, 27, 1728, 28, 448, 29, 1472, 30, 960,
+    31, 1984, 33, 1056, 34, 544, 35, 1568, 36, 288, 37, 1312,
+    38, 800, 39, 1824, 40, 160, 41, 1184, 42, 672, 43, 1696,
+    44, 416, 45, 1440, 46, 928, 47, 1952, 48, 96, 49, 1120,
+    50, 608, 51, 1632, 52, 352, 53, 1376, 54, 864, 55, 1888,
+    56, 224, 57, 1248, 58, 736, 59, 1760, 60, 480, 61, 1504,
+    62, 992, 63, 2016, 65, 1040, 66, 528, 67, 1552, 68, 272,
+    69, 1296, 70, 784, 71, 1808, 72, 144, 73, 1168, 74, 656,
+    75, 1680, 76, 400, 77, 1424, 78, 912, 79, 1936, 81, 1104,
+    82, 592, 83, 1616, 84, 336, 85, 1360, 86, 848, 87, 1872,
+    88, 208, 89, 1232, 90, 720, 91, 1744, 92, 464, 93, 1488,
+    94, 976, 95, 2000, 97, 1072, 98, 560, 99, 1584, 100, 304,
+    101, 1328, 102, 816, 103, 1840, 104, 176, 105, 1200, 106, 688,
+    107, 1712, 108, 432, 109, 1456, 110, 944, 111, 1968, 113, 1136,
+    114, 624, 115, 1648, 116, 368, 117, 1392, 118, 880, 119, 1904,
+    120, 240, 121, 1264, 122, 752, 123, 1776, 124, 496, 125, 1520,
+    126, 1008, 127, 2032, 129, 1032, 130, 520, 131, 1544, 132, 264,
+    133, 1288, 134, 776, 135, 1800, 137, 1160, 138, 648, 139, 1672,
+    140, 392, 141, 1416, 142, 904, 143, 1928, 145, 1096, 146, 584,
+    147, 1608, 148, 328, 149, 1352, 150, 840, 151, 1864, 152, 200,
+    153, 1224, 154, 712, 155, 1736, 156, 456, 157, 1480, 158, 968,
+    159, 1992, 161, 1064, 162, 552, 163, 1576, 164, 296, 165, 1320,
+    166, 808, 167, 1832, 169, 1192, 170, 680, 171, 1704, 172, 424,
+    173, 1448, 174, 936, 175, 1960, 177, 1128, 178, 616, 179, 1640,
+    180, 360, 181, 1384, 182, 872, 183, 1896, 184, 232, 185, 1256,
+    186, 744, 187, 1768, 188, 488, 189, 1512, 190, 1000, 191, 2024,
+    193, 1048, 194, 536, 195, 1560, 196, 280, 197, 1304, 198, 792,
+    199, 1816, 201, 1176, 202, 664, 203, 1688, 204, 408, 205, 1432,
+    206, 920, 207, 1944, 209, 1112, 210, 600, 211, 1624, 212, 344,
+    213, 1368, 214, 856, 215, 1880, 217, 1240, 218, 728, 219, 1752,
+    220, 472, 221, 1496, 222, 984, 223, 2008, 225, 1080, 226, 568,
+    227, 1592, 228, 312, 229, 1336, 230, 824, 231, 1848, 233, 1208,
+    234, 696, 235, 1720, 236, 440, 237, 1464, 238, 952, 239, 1976,
+    241, 1144, 242, 632, 243, 1656, 244, 376, 245, 1400, 246, 888,
+    247, 1912, 249, 1272, 250, 760, 251, 1784, 252, 504, 253, 1528,
+    254, 1016, 255, 2040, 257, 1028, 258, 516, 259, 1540, 261, 1284,
+    262, 772, 263, 1796, 265, 1156, 266, 644, 267, 1668, 268, 388,
+    269, 1412, 270, 900, 271, 1924, 273, 1092, 274, 580, 275, 1604,
+    276, 324, 277, 1348, 278, 836, 279, 1860, 281, 1220, 282, 708,
+    283, 1732, 284, 452, 285, 1476, 286, 964, 287, 1988, 289, 1060,
+    290, 548, 291, 1572, 293, 1316, 294, 804, 295, 1828, 297, 1188,
+    298, 676, 299, 1700, 300, 420, 301, 1444, 302, 932, 303, 1956,
+    305, 1124, 306, 612, 307, 1636, 308, 356, 309, 1380, 310, 868,
+    311, 1892, 313, 1252, 314, 740, 315, 1764, 316, 484, 317, 1508,
+    318, 996, 319, 2020, 321, 1044, 322, 532, 323, 1556, 325, 1300,
+    326, 788, 327, 1812, 329, 1172, 330, 660, 331, 1684, 332, 404,
+    333, 1428, 334, 916, 335, 1940, 337, 1108, 338, 596, 339, 1620,
+    341, 1364, 342, 852, 343, 1876, 345, 1236, 346, 724, 347, 1748,
+    348, 468, 349, 1492, 350, 980, 351, 2004, 353, 1076, 354, 564,
+    355, 1588, 357, 1332, 358, 820, 359, 1844, 361, 1204, 362, 692,
+    363, 1716, 364, 436, 365, 1460, 366, 948, 367, 1972, 369, 1140,
+    370, 628, 371, 1652, 373, 1396, 374, 884, 375, 1908, 377, 1268,
+    378, 756, 379, 1780, 380, 500, 381, 1524, 382, 1012, 383, 2036,
+    385, 1036, 386, 524, 387, 1548, 389, 1292, 390, 780, 391, 1804,
+    393, 1164, 394, 652, 395, 1676, 397, 1420, 398, 908, 399, 1932,
+    401, 1100, 402, 588, 403, 1612, 405, 1356, 406, 844, 407, 1868,
+    409, 1228, 410, 716, 411, 1740, 412, 460, 413, 1484, 414, 972,
+    415, 1996, 417, 1068, 418, 556, 419, 1580, 421, 1324, 422, 812,
+    423, 1836, 425, 1196, 426, 684, 427, 1708, 429, 1452, 430, 940,
+    431, 1964, 433, 1132, 434, 620, 435, 1644, 437, 1388, 438, 876,
+    439, 1900, 441, 1260, 442, 748, 443, 1772, 444, 492, 445, 1516,
+    446, 1004, 447, 2028, 449, 1052, 450, 540, 451, 1564, 453, 1308,
+    454, 796, 455, 1820, 457, 1180, 458, 668, 459, 1692, 461, 1436,
+    462, 924, 463, 1948, 465, 1116, 466, 604, 467, 1628, 469, 1372,
+    470, 860, 471, 1884, 473, 1244, 474, 732, 475, 1756, 477, 1500,
+    478, 988, 479, 2012, 481, 1084, 482, 572, 483, 1596, 485, 1340,
+    486, 828, 487, 1852, 489, 1212, 490, 700, 491, 1724, 493, 1468,
+    494, 956, 495, 1980, 497, 1148, 498, 636, 499, 1660, 501, 1404,
+    502, 892, 503, 1916, 505, 1276, 506, 764, 507, 1788, 509, 1532,
+    510, 1020, 511, 2044, 513, 1026, 515, 1538, 517, 1282, 518, 770,
+    519, 1794, 521, 1154, 522, 642, 523, 1666, 525, 1410, 526, 898,
+    527, 1922, 529, 1090, 530, 578, 531, 1602, 533, 1346, 534, 834,
+    535, 1858, 537, 1218, 538, 706, 539, 1730, 541, 1474, 542, 962,
+    543, 1986, 545, 1058, 547, 1570, 549, 1314, 550, 802, 551, 1826,
+    553, 1186, 554, 674, 555, 1698, 557, 1442, 558, 930, 559, 1954,
+    561, 1122, 562, 610, 563, 1634, 565, 1378, 566, 866, 567, 1890,
+    569, 1250, 570, 738, 571, 1762, 573, 1506, 574, 994, 575, 2018,
+    577, 1042, 579, 1554, 581, 1298, 582, 786, 583, 1810, 585, 1170,
+    586, 658, 587, 1682, 589, 1426, 590, 914, 591, 1938, 593, 1106,
+    595, 1618, 597, 1362, 598, 850, 599, 1874, 601, 1234, 602, 722,
+    603, 1746, 605, 1490, 606, 978, 607, 2002, 609, 1074, 611, 1586,
+    613, 1330, 614, 818, 615, 1842, 617, 1202, 618, 690, 619, 1714,
+    621, 1458, 622, 946, 623, 1970, 625, 1138, 627, 1650, 629, 1394,
+    630, 882, 631, 1906, 633, 1266, 634, 754, 635, 1778, 637, 1522,
+    638, 1010, 639, 2034, 641, 1034, 643, 1546, 645, 1290, 646, 778,
+    647, 1802, 649, 1162, 651, 1674, 653, 1418, 654, 906, 655, 1930,
+    657, 1098, 659, 1610, 661, 1354, 662, 842, 663, 1866, 665, 1226,
+    666, 714, 667, 1738, 669, 1482, 670, 970, 671, 1994, 673, 1066,
+    675, 1578, 677, 1322, 678, 810, 679, 1834, 681, 1194, 683, 1706,
+    685, 1450, 686, 938, 687, 1962, 689, 1130, 691, 1642, 693, 1386,
+    694, 874, 695, 1898, 697, 1258, 698, 746, 699, 1770, 701, 1514,
+    702, 1002, 703, 2026, 705, 1050, 707, 1562, 709, 1306, 710, 794,
+    711, 1818, 713, 1178, 715, 1690, 717, 1434, 718, 922, 719, 1946,
+    721, 1114, 723, 1626, 725, 1370, 726, 858, 727, 1882, 729, 1242,
+    731, 1754, 733, 1498, 734, 986, 735, 2010, 737, 1082, 739, 1594,
+    741, 1338, 742, 826, 743, 1850, 745, 1210, 747, 1722, 749, 1466,
+    750, 954, 751, 1978, 753, 1146, 755, 1658, 757, 1402, 758, 890,
+    759, 1914, 761, 1274, 763, 1786, 765, 1530, 766, 1018, 767, 2042,
+    769, 1030, 771, 1542, 773, 1286, 775, 1798, 777, 1158, 779, 1670,
+    781, 1414, 782, 902, 783, 1926, 785, 1094, 787, 1606, 789, 1350,
+    790, 838, 791, 1862, 793, 1222, 795, 1734, 797, 1478, 798, 966,
+    799, 1990, 801, 1062, 803, 1574, 805, 1318, 807, 1830, 809, 1190,
+    811, 1702, 813, 1446, 814, 934, 815, 1958, 817, 1126, 819, 1638,
+    821, 1382, 822, 870, 823, 1894, 825, 1254, 827, 1766, 829, 1510,
+    830, 998, 831, 2022, 833, 1046, 835, 1558, 837, 1302, 839, 1814,
+    841, 1174, 843, 1686, 845, 1430, 846, 918, 847, 1942, 849, 1110,
+    851, 1622, 853, 1366, 855, 1878, 857, 1238, 859, 1750, 861, 1494,
+    862, 982, 863, 2006, 865, 1078, 867, 1590, 869, 1334, 871, 1846,
+    873, 1206, 875, 1718, 877, 1462, 878, 950, 879, 1974, 881, 1142,
+    883, 1654, 885, 1398, 887, 1910, 889, 1270, 891, 1782, 893, 1526,
+    894, 1014, 895, 2038, 897, 1038, 899, 1550, 901, 1294, 903, 1806,
+    905, 1166, 907, 1678, 909, 1422, 911, 1934, 913, 1102, 915, 1614,
+    917, 1358, 919, 1870, 921, 1230, 923, 1742, 925, 1486, 926, 974,
+    927, 1998, 929, 1070, 931, 1582, 933, 1326, 935, 1838, 937, 1198,
+    939, 1710, 941, 1454, 943, 1966, 945, 1134, 947, 1646, 949, 1390,
+    951, 1902, 953, 1262, 955, 1774, 957, 1518, 958, 1006, 959, 2030,
+    961, 1054, 963, 1566, 965, 1310, 967, 1822, 969, 1182, 971, 1694,
+    973, 1438, 975, 1950, 977, 1118, 979, 1630, 981, 1374, 983, 1886,
+    985, 1246, 987, 1758, 989, 1502, 991, 2014, 993, 1086, 995, 1598,
+    997, 1342, 999, 1854, 1001, 1214, 1003, 1726, 1005, 1470, 1007, 1982,
+    1009, 1150, 1011, 1662, 1013, 1406, 1015, 1918, 1017, 1278, 1019, 1790,
+    1021, 1534, 1023, 2046, 1027, 1537, 1029, 1281, 1031, 1793, 1033, 1153,
+    1035, 1665, 1037, 1409, 1039, 1921, 1041, 1089, 1043, 1601, 1045, 1345,
+    1047, 1857, 1049, 1217, 1051, 1729, 1053, 1473, 1055, 1985, 1059, 1569,
+    1061, 1313, 1063, 1825, 1065, 1185, 1067, 1697, 1069, 1441, 1071, 1953,
+    1073, 1121, 1075, 1633, 1077, 1377, 1079, 1889, 1081, 1249, 1083, 1761,
+    1085, 1505, 1087, 2017, 1091, 1553, 1093, 1297, 1095, 1809, 1097, 1169,
+    1099, 1681, 1101, 1425, 1103, 1937, 1107, 1617, 1109, 1361, 1111, 1873,
+    1113, 1233, 1115, 1745, 1117, 1489, 1119, 2001, 1123, 1585, 1125, 1329,
+    1127, 1841, 1129, 1201, 1131, 1713, 1133, 1457, 1135, 1969, 1139, 1649,
+    1141, 1393, 1143, 1905, 1145, 1265, 1147, 1777, 1149, 1521, 1151, 2033,
+    1155, 1545, 1157, 1289, 1159, 1801, 1163, 1673, 1165, 1417, 1167, 1929,
+    1171, 1609, 1173, 1353, 1175, 1865, 1177, 1225, 1179, 1737, 1181, 1481,
+    1183, 1993, 1187, 1577, 1189, 1321, 1191, 1833, 1195, 1705, 1197, 1449,
+    1199, 1961, 1203, 1641, 1205, 1385, 1207, 1897, 1209, 1257, 1211, 1769,
+    1213, 1513, 1215, 2025, 1219, 1561, 1221, 1305, 1223, 1817, 1227, 1689,
+    1229, 1433, 1231, 1945, 1235, 1625, 1237, 1369, 1239, 1881, 1243, 1753,
+    1245, 1497, 1247, 2009, 1251, 1593, 1253, 1337, 1255, 1849, 1259, 1721,
+    1261, 1465, 1263, 1977, 1267, 1657, 1269, 1401, 1271, 1913, 1275, 1785,
+    1277, 1529, 1279, 2041, 1283, 1541, 1287, 1797, 1291, 1669, 1293, 1413,
+    1295, 1925, 1299, 1605, 1301, 1349, 1303, 1861, 1307, 1733, 1309, 1477,
+    1311, 1989, 1315, 1573, 1319, 1829, 1323, 1701, 1325, 1445, 1327, 1957,
+    1331, 1637, 1333, 1381, 1335, 1893, 1339, 1765, 1341, 1509, 1343, 2021,
+    1347, 1557, 1351, 1813, 1355, 1685, 1357, 1429, 1359, 1941, 1363, 1621,
+    1367, 1877, 1371, 1749, 1373, 1493, 1375, 2005, 1379, 1589, 1383, 1845,
+    1387, 1717, 1389, 1461, 1391, 1973, 1395, 1653, 1399, 1909, 1403, 1781,
+    1405, 1525, 1407, 2037, 1411, 1549, 1415, 1805, 1419, 1677, 1423, 1933,
+    1427, 1613, 1431, 1869, 1435, 1741, 1437, 1485, 1439, 1997, 1443, 1581,
+    1447, 1837, 1451, 1709, 1455, 1965, 1459, 1645, 1463, 1901, 1467, 1773,
+    1469, 1517, 1471, 2029, 1475, 1565, 1479, 1821, 1483, 1693, 1487, 1949,
+    1491, 1629, 1495, 1885, 1499, 1757, 1503, 2013, 1507, 1597, 1511, 1853,
+    1515, 1725, 1519, 1981, 1523, 1661, 1527, 1917, 1531, 1789, 1535, 2045,
+    1543, 1795, 1547, 1667, 1551, 1923, 1555, 1603, 1559, 1859, 1563, 1731,
+    1567, 1987, 1575, 1827, 1579, 1699, 1583, 1955, 1587, 1635, 1591, 1891,
+    1595, 1763, 1599, 2019, 1607, 1811, 1611, 1683, 1615, 1939, 1623, 1875,
+    1627, 1747, 1631, 2003, 1639, 1843, 1643, 1715, 1647, 1971, 1655, 1907,
+    1659, 1779, 1663, 2035, 1671, 1803, 1679, 1931, 1687, 1867, 1691, 1739,
+    1695, 1995, 1703, 1835, 1711, 1963, 1719, 1899, 1723, 1771, 1727, 2027,
+    1735, 1819, 1743, 1947, 1751, 1883, 1759, 2011, 1767, 1851, 1775, 1979,
+    1783, 1915, 1791, 2043, 1807, 1927, 1815, 1863, 1823, 1991, 1839, 1959,
+    1847, 1895, 1855, 2023, 1871, 1943, 1887, 2007, 1903, 1975, 1919, 2039,
+    1951, 1999, 1983, 2031
+};
+
+#if !defined(PLP_QUARTER_WAVE_TABLES)
+
 /**
   @par
   Example code for the generation of the floating-point sine table:
@@ -3770,7 +3946,7 @@ short bit_rev_radix2_LUT[2048] = {
  @par
   where PI value is  3.14159265358979
  */
-const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
+PLP_FAST_MATH_TABLE const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
     0.00000000f,  0.01227154f,  0.02454123f,  0.03680722f,  0.04906767f,  0.06132074f,
     0.07356456f,  0.08579731f,  0.09801714f,  0.11022221f,  0.12241068f,  0.13458071f,
     0.14673047f,  0.15885814f,  0.17096189f,  0.18303989f,  0.19509032f,  0.20711138f,
@@ -3877,7 +4053,7 @@ const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
   Finally, round to the nearest integer value:
     sinTable[i] += (sinTable[i] > 0 ? 0.5 : -0.5);
  */
-const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1] = { 0L,
+PLP_FAST_MATH_TABLE const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1] = { 0L,
                                                          26352928L,
                                                          52701887L,
                                                          79042909L,
@@ -4409,7 +4585,7 @@ const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1] = { 0L,
   Finally, round to the nearest integer value:
     sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);
  */
-const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
+PLP_FAST_MATH_TABLE const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
     0,      402,    804,    1206,   1608,   2009,   2411,   2811,   3212,   3612,   4011,   4410,
     4808,   5205,   5602,   5998,   6393,   6787,   7180,   7571,   7962,   8351,   8740,   9127,
     9512,   9896,   10279,  10660,  11039,  11417,  11793,  12167,  12540,  12910,  13279,  13646,
@@ -4454,3 +4630,563 @@ const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
     -7962,  -7571,  -7180,  -6787,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
     -3212,  -2811,  -2411,  -2009,  -1608,  -1206,  -804,   -402,   0
 };
+
+#else
+
+/**
+  @par
+  Quarter period of the sine for PLP_QUARTER_WAVE_TABLES, from which the sine tables and the
+  twiddle factors of the fixed-point FFTs are derived (see plp_fast_math.h). Table values are in
+  Q31 (1.31 fixed-point format) and generated with:
+  <pre>
+  for (n = 0; n < (PLP_QUARTER_WAVE_SIZE + 1); n++)
+  {
+  sinTable[n] = sin(PI/2*n/PLP_QUARTER_WAVE_SIZE) * pow(2, 31);
+  sinTable[n] = min(round(sinTable[n]), 0x7FFFFFFF);
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const int32_t sinTable_quarter_q32[PLP_QUARTER_WAVE_SIZE + 1] = {
+    0L, 3294197L, 6588387L, 9882561L, 13176712L, 16470832L, 19764913L,
+    23058947L, 26352928L, 29646846L, 32940695L, 36234466L, 39528151L, 42821744L,
+    46115236L, 49408620L, 52701887L, 55995030L, 59288042L, 62580914L, 65873638L,
+    69166208L, 72458615L, 75750851L, 79042909L, 82334782L, 85626460L, 88917937L,
+    92209205L, 95500255L, 98791081L, 102081675L, 105372028L, 108662134L, 111951983L,
+    115241570L, 118530885L, 121819921L, 125108670L, 128397125L, 131685278L, 134973122L,
+    138260647L, 141547847L, 144834714L, 148121241L, 151407418L, 154693240L, 157978697L,
+    161263783L, 164548489L, 167832808L, 171116733L, 174400254L, 177683365L, 180966058L,
+    184248325L, 187530159L, 190811551L, 194092495L, 197372981L, 200653003L, 203932553L,
+    207211624L, 210490206L, 213768293L, 217045878L, 220322951L, 223599506L, 226875535L,
+    230151030L, 233425984L, 236700388L, 239974235L, 243247518L, 246520228L, 249792358L,
+    253063900L, 256334847L, 259605191L, 262874923L, 266144038L, 269412525L, 272680379L,
+    275947592L, 279214155L, 282480061L, 285745302L, 289009871L, 292273760L, 295536961L,
+    298799466L, 302061269L, 305322361L, 308582734L, 311842381L, 315101295L, 318359466L,
+    321616889L, 324873555L, 328129457L, 331384586L, 334638936L, 337892498L, 341145265L,
+    344397230L, 347648383L, 350898719L, 354148230L, 357396906L, 360644742L, 363891730L,
+    367137861L, 370383128L, 373627523L, 376871039L, 380113669L, 383355404L, 386596237L,
+    389836160L, 393075166L, 396313247L, 399550396L, 402786604L, 406021865L, 409256170L,
+    412489512L, 415721883L, 418953276L, 422183684L, 425413098L, 428641511L, 431868915L,
+    435095303L, 438320667L, 441545000L, 444768294L, 447990541L, 451211734L, 454431865L,
+    457650927L, 460868912L, 464085813L, 467301622L, 470516330L, 473729932L, 476942419L,
+    480153784L, 483364019L, 486573117L, 489781069L, 492987869L, 496193509L, 499397982L,
+    502601279L, 505803394L, 509004318L, 512204045L, 515402566L, 518599875L, 521795963L,
+    524990824L, 528184449L, 531376831L, 534567963L, 537757837L, 540946445L, 544133781L,
+    547319836L, 550504604L, 553688076L, 556870245L, 560051104L, 563230645L, 566408860L,
+    569585743L, 572761285L, 575935480L, 579108320L, 582279796L, 585449903L, 588618632L,
+    591785976L, 594951927L, 598116479L, 601279623L, 604441352L, 607601658L, 610760536L,
+    613917975L, 617073971L, 620228514L, 623381598L, 626533215L, 629683357L, 632832018L,
+    635979190L, 639124865L, 642269036L, 645411696L, 648552838L, 651692453L, 654830535L,
+    657967075L, 661102068L, 664235505L, 667367379L, 670497682L, 673626408L, 676753549L,
+    679879097L, 683003045L, 686125387L, 689246113L, 692365218L, 695482694L, 698598533L,
+    701712728L, 704825272L, 707936158L, 711045377L, 714152924L, 717258790L, 720362968L,
+    723465451L, 726566232L, 729665303L, 732762657L, 735858287L, 738952186L, 742044345L,
+    745134758L, 748223418L, 751310318L, 754395449L, 757478806L, 760560380L, 763640164L,
+    766718151L, 769794334L, 772868706L, 775941259L, 779011986L, 782080880L, 785147934L,
+    788213141L, 791276492L, 794337982L, 797397602L, 800455346L, 803511207L, 806565177L,
+    809617249L, 812667415L, 815715670L, 818762005L, 821806413L, 824848888L, 827889422L,
+    830928007L, 833964638L, 836999305L, 840032004L, 843062726L, 846091463L, 849118210L,
+    852142959L, 855165703L, 858186435L, 861205147L, 864221832L, 867236484L, 870249095L,
+    873259659L, 876268167L, 879274614L, 882278992L, 885281293L, 888281512L, 891279640L,
+    894275671L, 897269597L, 900261413L, 903251110L, 906238681L, 909224120L, 912207419L,
+    915188572L, 918167572L, 921144411L, 924119082L, 927091579L, 930061894L, 933030021L,
+    935995952L, 938959681L, 941921200L, 944880503L, 947837582L, 950792431L, 953745043L,
+    956695411L, 959643527L, 962589385L, 965532978L, 968474300L, 971413342L, 974350098L,
+    977284562L, 980216726L, 983146583L, 986074127L, 988999351L, 991922248L, 994842810L,
+    997761031L, 1000676905L, 1003590424L, 1006501581L, 1009410370L, 1012316784L, 1015220816L,
+    1018122458L, 1021021705L, 1023918550L, 1026812985L, 1029705004L, 1032594600L, 1035481766L,
+    1038366495L, 1041248781L, 1044128617L, 1047005996L, 1049880912L, 1052753357L, 1055623324L,
+    1058490808L, 1061355801L, 1064218296L, 1067078288L, 1069935768L, 1072790730L, 1075643169L,
+    1078493076L, 1081340445L, 1084185270L, 1087027544L, 1089867259L, 1092704411L, 1095538991L,
+    1098370993L, 1101200410L, 1104027237L, 1106851465L, 1109673089L, 1112492101L, 1115308496L,
+    1118122267L, 1120933406L, 1123741908L, 1126547765L, 1129350972L, 1132151521L, 1134949406L,
+    1137744621L, 1140537158L, 1143327011L, 1146114174L, 1148898640L, 1151680403L, 1154459456L,
+    1157235792L, 1160009405L, 1162780288L, 1165548435L, 1168313840L, 1171076495L, 1173836395L,
+    1176593533L, 1179347902L, 1182099496L, 1184848308L, 1187594332L, 1190337562L, 1193077991L,
+    1195815612L, 1198550419L, 1201282407L, 1204011567L, 1206737894L, 1209461382L, 1212182024L,
+    1214899813L, 1217614743L, 1220326809L, 1223036002L, 1225742318L, 1228445750L, 1231146291L,
+    1233843935L, 1236538675L, 1239230506L, 1241919421L, 1244605414L, 1247288478L, 1249968606L,
+    1252645794L, 1255320034L, 1257991320L, 1260659646L, 1263325005L, 1265987392L, 1268646800L,
+    1271303222L, 1273956653L, 1276607086L, 1279254516L, 1281898935L, 1284540337L, 1287178717L,
+    1289814068L, 1292446384L, 1295075659L, 1297701886L, 1300325060L, 1302945174L, 1305562222L,
+    1308176198L, 1310787095L, 1313394909L, 1315999631L, 1318601257L, 1321199781L, 1323795195L,
+    1326387494L, 1328976672L, 1331562723L, 1334145641L, 1336725419L, 1339302052L, 1341875533L,
+    1344445857L, 1347013017L, 1349577007L, 1352137822L, 1354695455L, 1357249901L, 1359801152L,
+    1362349204L, 1364894050L, 1367435685L, 1369974101L, 1372509294L, 1375041258L, 1377569986L,
+    1380095472L, 1382617710L, 1385136696L, 1387652422L, 1390164882L, 1392674072L, 1395179984L,
+    1397682613L, 1400181954L, 1402678000L, 1405170745L, 1407660183L, 1410146309L, 1412629117L,
+    1415108601L, 1417584755L, 1420057574L, 1422527051L, 1424993180L, 1427455956L, 1429915374L,
+    1432371426L, 1434824109L, 1437273414L, 1439719338L, 1442161874L, 1444601017L, 1447036760L,
+    1449469098L, 1451898025L, 1454323536L, 1456745625L, 1459164286L, 1461579514L, 1463991302L,
+    1466399645L, 1468804538L, 1471205974L, 1473603949L, 1475998456L, 1478389489L, 1480777044L,
+    1483161115L, 1485541696L, 1487918781L, 1490292364L, 1492662441L, 1495029006L, 1497392053L,
+    1499751576L, 1502107570L, 1504460029L, 1506808949L, 1509154322L, 1511496145L, 1513834411L,
+    1516169114L, 1518500250L, 1520827813L, 1523151797L, 1525472197L, 1527789007L, 1530102222L,
+    1532411837L, 1534717846L, 1537020244L, 1539319024L, 1541614183L, 1543905714L, 1546193612L,
+    1548477872L, 1550758488L, 1553035455L, 1555308768L, 1557578421L, 1559844408L, 1562106725L,
+    1564365367L, 1566620327L, 1568871601L, 1571119183L, 1573363068L, 1575603251L, 1577839726L,
+    1580072489L, 1582301533L, 1584526854L, 1586748447L, 1588966306L, 1591180426L, 1593390801L,
+    1595597428L, 1597800299L, 1599999411L, 1602194758L, 1604386335L, 1606574136L, 1608758157L,
+    1610938393L, 1613114838L, 1615287487L, 1617456335L, 1619621377L, 1621782608L, 1623940023L,
+    1626093616L, 1628243383L, 1630389319L, 1632531418L, 1634669676L, 1636804087L, 1638934646L,
+    1641061349L, 1643184191L, 1645303166L, 1647418269L, 1649529496L, 1651636841L, 1653740300L,
+    1655839867L, 1657935539L, 1660027308L, 1662115172L, 1664199124L, 1666279161L, 1668355276L,
+    1670427466L, 1672495725L, 1674560049L, 1676620432L, 1678676870L, 1680729357L, 1682777890L,
+    1684822463L, 1686863072L, 1688899711L, 1690932376L, 1692961062L, 1694985765L, 1697006479L,
+    1699023199L, 1701035922L, 1703044642L, 1705049355L, 1707050055L, 1709046739L, 1711039401L,
+    1713028037L, 1715012642L, 1716993211L, 1718969740L, 1720942225L, 1722910659L, 1724875040L,
+    1726835361L, 1728791620L, 1730743810L, 1732691928L, 1734635968L, 1736575927L, 1738511799L,
+    1740443581L, 1742371267L, 1744294853L, 1746214334L, 1748129707L, 1750040966L, 1751948107L,
+    1753851126L, 1755750017L, 1757644777L, 1759535401L, 1761421885L, 1763304224L, 1765182414L,
+    1767056450L, 1768926328L, 1770792044L, 1772653593L, 1774510970L, 1776364172L, 1778213194L,
+    1780058032L, 1781898681L, 1783735137L, 1785567396L, 1787395453L, 1789219305L, 1791038946L,
+    1792854372L, 1794665580L, 1796472565L, 1798275323L, 1800073849L, 1801868139L, 1803658189L,
+    1805443995L, 1807225553L, 1809002858L, 1810775906L, 1812544694L, 1814309216L, 1816069469L,
+    1817825449L, 1819577151L, 1821324572L, 1823067707L, 1824806552L, 1826541103L, 1828271356L,
+    1829997307L, 1831718951L, 1833436286L, 1835149306L, 1836858008L, 1838562388L, 1840262441L,
+    1841958164L, 1843649553L, 1845336604L, 1847019312L, 1848697674L, 1850371686L, 1852041343L,
+    1853706643L, 1855367581L, 1857024153L, 1858676355L, 1860324183L, 1861967634L, 1863606704L,
+    1865241388L, 1866871683L, 1868497586L, 1870119091L, 1871736196L, 1873348897L, 1874957189L,
+    1876561070L, 1878160535L, 1879755580L, 1881346202L, 1882932397L, 1884514161L, 1886091491L,
+    1887664383L, 1889232832L, 1890796837L, 1892356392L, 1893911494L, 1895462140L, 1897008325L,
+    1898550047L, 1900087301L, 1901620084L, 1903148392L, 1904672222L, 1906191570L, 1907706433L,
+    1909216806L, 1910722688L, 1912224073L, 1913720958L, 1915213340L, 1916701216L, 1918184581L,
+    1919663432L, 1921137767L, 1922607581L, 1924072871L, 1925533633L, 1926989864L, 1928441561L,
+    1929888720L, 1931331338L, 1932769411L, 1934202936L, 1935631910L, 1937056329L, 1938476190L,
+    1939891490L, 1941302225L, 1942708392L, 1944109987L, 1945507008L, 1946899451L, 1948287312L,
+    1949670589L, 1951049279L, 1952423377L, 1953792881L, 1955157788L, 1956518093L, 1957873796L,
+    1959224890L, 1960571375L, 1961913246L, 1963250501L, 1964583136L, 1965911148L, 1967234535L,
+    1968553292L, 1969867417L, 1971176906L, 1972481757L, 1973781967L, 1975077532L, 1976368450L,
+    1977654717L, 1978936331L, 1980213288L, 1981485585L, 1982753220L, 1984016189L, 1985274489L,
+    1986528118L, 1987777073L, 1989021350L, 1990260946L, 1991495860L, 1992726087L, 1993951625L,
+    1995172471L, 1996388622L, 1997600076L, 1998806829L, 2000008879L, 2001206222L, 2002398857L,
+    2003586779L, 2004769987L, 2005948478L, 2007122248L, 2008291295L, 2009455617L, 2010615210L,
+    2011770073L, 2012920201L, 2014065592L, 2015206245L, 2016342155L, 2017473321L, 2018599739L,
+    2019721407L, 2020838323L, 2021950484L, 2023057887L, 2024160529L, 2025258408L, 2026351522L,
+    2027439867L, 2028523442L, 2029602243L, 2030676269L, 2031745516L, 2032809982L, 2033869665L,
+    2034924562L, 2035974670L, 2037019988L, 2038060512L, 2039096241L, 2040127172L, 2041153301L,
+    2042174628L, 2043191150L, 2044202863L, 2045209767L, 2046211857L, 2047209133L, 2048201592L,
+    2049189231L, 2050172048L, 2051150040L, 2052123207L, 2053091544L, 2054055050L, 2055013723L,
+    2055967560L, 2056916560L, 2057860719L, 2058800036L, 2059734508L, 2060664133L, 2061588910L,
+    2062508835L, 2063423908L, 2064334124L, 2065239484L, 2066139983L, 2067035621L, 2067926394L,
+    2068812302L, 2069693342L, 2070569511L, 2071440808L, 2072307231L, 2073168777L, 2074025446L,
+    2074877233L, 2075724139L, 2076566160L, 2077403294L, 2078235540L, 2079062896L, 2079885360L,
+    2080702930L, 2081515603L, 2082323379L, 2083126254L, 2083924228L, 2084717298L, 2085505463L,
+    2086288720L, 2087067068L, 2087840505L, 2088609029L, 2089372638L, 2090131331L, 2090885105L,
+    2091633960L, 2092377892L, 2093116901L, 2093850985L, 2094580142L, 2095304370L, 2096023667L,
+    2096738032L, 2097447464L, 2098151960L, 2098851519L, 2099546139L, 2100235819L, 2100920556L,
+    2101600350L, 2102275199L, 2102945101L, 2103610054L, 2104270057L, 2104925109L, 2105575208L,
+    2106220352L, 2106860540L, 2107495770L, 2108126041L, 2108751352L, 2109371700L, 2109987085L,
+    2110597505L, 2111202959L, 2111803444L, 2112398960L, 2112989506L, 2113575080L, 2114155680L,
+    2114731305L, 2115301954L, 2115867626L, 2116428319L, 2116984031L, 2117534762L, 2118080511L,
+    2118621275L, 2119157054L, 2119687847L, 2120213651L, 2120734467L, 2121250292L, 2121761126L,
+    2122266967L, 2122767814L, 2123263666L, 2123754522L, 2124240380L, 2124721240L, 2125197100L,
+    2125667960L, 2126133817L, 2126594672L, 2127050522L, 2127501367L, 2127947206L, 2128388038L,
+    2128823862L, 2129254676L, 2129680480L, 2130101272L, 2130517052L, 2130927819L, 2131333572L,
+    2131734309L, 2132130030L, 2132520734L, 2132906420L, 2133287087L, 2133662734L, 2134033361L,
+    2134398966L, 2134759548L, 2135115107L, 2135465642L, 2135811153L, 2136151637L, 2136487095L,
+    2136817525L, 2137142927L, 2137463301L, 2137778644L, 2138088958L, 2138394240L, 2138694490L,
+    2138989708L, 2139279892L, 2139565043L, 2139845159L, 2140120240L, 2140390284L, 2140655293L,
+    2140915264L, 2141170197L, 2141420092L, 2141664948L, 2141904764L, 2142139541L, 2142369276L,
+    2142593971L, 2142813624L, 2143028234L, 2143237802L, 2143442326L, 2143641807L, 2143836244L,
+    2144025635L, 2144209982L, 2144389283L, 2144563539L, 2144732748L, 2144896910L, 2145056025L,
+    2145210092L, 2145359112L, 2145503083L, 2145642006L, 2145775880L, 2145904705L, 2146028480L,
+    2146147205L, 2146260881L, 2146369505L, 2146473080L, 2146571603L, 2146665076L, 2146753497L,
+    2146836866L, 2146915184L, 2146988450L, 2147056664L, 2147119825L, 2147177934L, 2147230991L,
+    2147278995L, 2147321946L, 2147359845L, 2147392690L, 2147420483L, 2147443222L, 2147460908L,
+    2147473542L, 2147481121L, 2147483647L
+};
+
+#endif // PLP_QUARTER_WAVE_TABLES
+
+/**
+  @par
+  Table values are in Q2.14 and hold the inverse square roots of the mantissas in [0.25, 1),
+  sampled at the center of each of the intervals of width 1/32:
+  <pre>
+  for (n = 0; n < FAST_MATH_RSQRT_TABLE_SIZE; n++)
+  {
+  rsqrtTable[n] = round(pow(2, 14) / sqrt((n + 8.5) / 32));
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const int16_t rsqrtTable_q16[FAST_MATH_RSQRT_TABLE_SIZE] = {
+    31790, 30070, 28602, 27330, 26214, 25225, 24339, 23541, 22817, 22155, 21548, 20988,
+    20470, 19988, 19539, 19119, 18725, 18354, 18004, 17674, 17361, 17064, 16782, 16514
+};
+
+/**
+  @par
+  Table values are in Q2.14 and hold the reciprocals of the mantissas in [0.5, 1), sampled at the
+  center of each of the intervals of width 1/64:
+  <pre>
+  for (n = 0; n < FAST_MATH_RECIP_TABLE_SIZE; n++)
+  {
+  recipTable[n] = round(pow(2, 14) / ((n + 32.5) / 64));
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const int16_t recipTable_q16[FAST_MATH_RECIP_TABLE_SIZE] = {
+    32264, 31301, 30394, 29537, 28728, 27962, 27236, 26546, 25891, 25267, 24672, 24105,
+    23564, 23046, 22550, 22075, 21620, 21183, 20764, 20361, 19973, 19600, 19240, 18893,
+    18559, 18236, 17924, 17623, 17332, 17050, 16777, 16513
+};
+
+/**
+  @par
+  Table values hold 2^x for x in [0, 1], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_EXP_TABLE_SIZE + 1); n++)
+  {
+  expTable[n] = pow(2, (double)n / FAST_MATH_EXP_TABLE_SIZE);
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const float32_t expTable_f32[FAST_MATH_EXP_TABLE_SIZE + 1] = {
+    1.00000000f,  1.00542990f,  1.01088929f,  1.01637831f,  1.02189715f,  1.02744595f,
+    1.03302488f,  1.03863410f,  1.04427378f,  1.04994409f,  1.05564518f,  1.06137723f,
+    1.06714040f,  1.07293487f,  1.07876080f,  1.08461836f,  1.09050773f,  1.09642908f,
+    1.10238258f,  1.10836841f,  1.11438674f,  1.12043775f,  1.12652162f,  1.13263852f,
+    1.13878863f,  1.14497214f,  1.15118923f,  1.15744007f,  1.16372486f,  1.17004377f,
+    1.17639699f,  1.18278471f,  1.18920712f,  1.19566439f,  1.20215673f,  1.20868432f,
+    1.21524736f,  1.22184603f,  1.22848054f,  1.23515106f,  1.24185781f,  1.24860098f,
+    1.25538076f,  1.26219735f,  1.26905096f,  1.27594178f,  1.28287002f,  1.28983587f,
+    1.29683955f,  1.30388127f,  1.31096121f,  1.31807960f,  1.32523664f,  1.33243255f,
+    1.33966752f,  1.34694179f,  1.35425555f,  1.36160902f,  1.36900242f,  1.37643597f,
+    1.38390988f,  1.39142438f,  1.39897967f,  1.40657599f,  1.41421356f,  1.42189260f,
+    1.42961334f,  1.43737600f,  1.44518081f,  1.45302800f,  1.46091779f,  1.46885043f,
+    1.47682615f,  1.48484517f,  1.49290773f,  1.50101407f,  1.50916443f,  1.51735904f,
+    1.52559815f,  1.53388200f,  1.54221083f,  1.55058488f,  1.55900440f,  1.56746964f,
+    1.57598085f,  1.58453827f,  1.59314215f,  1.60179276f,  1.61049033f,  1.61923514f,
+    1.62802742f,  1.63686745f,  1.64575548f,  1.65469177f,  1.66367658f,  1.67271018f,
+    1.68179283f,  1.69092480f,  1.70010635f,  1.70933776f,  1.71861930f,  1.72795123f,
+    1.73733384f,  1.74676739f,  1.75625216f,  1.76578844f,  1.77537649f,  1.78501661f,
+    1.79470908f,  1.80445417f,  1.81425218f,  1.82410339f,  1.83400809f,  1.84396657f,
+    1.85397913f,  1.86404605f,  1.87416763f,  1.88434418f,  1.89457598f,  1.90486334f,
+    1.91520656f,  1.92560594f,  1.93606179f,  1.94657442f,  1.95714412f,  1.96777122f,
+    1.97845603f,  1.98919885f,  2.00000000f
+};
+
+/**
+  @par
+  Table values hold 2^x for x in [0, 1], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_EXP_TABLE_SIZE + 1); n++)
+  {
+  expTable[n] = pow(2, (double)n / FAST_MATH_EXP_TABLE_SIZE);
+  } </pre>
+  @par
+  The values are converted to Q2.30 (unsigned) and rounded to the nearest integer:
+    table[n] = round(table[n] * pow(2, 30));
+ */
+PLP_FAST_MATH_TABLE const uint32_t expTable_q32[FAST_MATH_EXP_TABLE_SIZE + 1] = {
+    1073741824U, 1079572136U, 1085434106U, 1091327906U, 1097253708U, 1103211687U,
+    1109202018U, 1115224875U, 1121280436U, 1127368878U, 1133490379U, 1139645120U,
+    1145833280U, 1152055042U, 1158310587U, 1164600099U, 1170923762U, 1177281762U,
+    1183674286U, 1190101520U, 1196563654U, 1203060876U, 1209593378U, 1216161350U,
+    1222764986U, 1229404479U, 1236080024U, 1242791816U, 1249540052U, 1256324931U,
+    1263146652U, 1270005413U, 1276901417U, 1283834865U, 1290805962U, 1297814910U,
+    1304861917U, 1311947188U, 1319070932U, 1326233356U, 1333434672U, 1340675091U,
+    1347954824U, 1355274085U, 1362633090U, 1370032052U, 1377471191U, 1384950723U,
+    1392470869U, 1400031848U, 1407633882U, 1415277195U, 1422962010U, 1430688553U,
+    1438457051U, 1446267730U, 1454120821U, 1462016553U, 1469955159U, 1477936870U,
+    1485961921U, 1494030547U, 1502142985U, 1510299473U, 1518500250U, 1526745556U,
+    1535035634U, 1543370725U, 1551751076U, 1560176931U, 1568648537U, 1577166143U,
+    1585730000U, 1594340357U, 1602997467U, 1611701585U, 1620452965U, 1629251865U,
+    1638098541U, 1646993254U, 1655936265U, 1664927835U, 1673968228U, 1683057710U,
+    1692196547U, 1701385007U, 1710623359U, 1719911875U, 1729250827U, 1738640488U,
+    1748081133U, 1757573041U, 1767116489U, 1776711757U, 1786359126U, 1796058879U,
+    1805811301U, 1815616678U, 1825475297U, 1835387448U, 1845353420U, 1855373507U,
+    1865448001U, 1875577199U, 1885761398U, 1896000896U, 1906295993U, 1916646992U,
+    1927054196U, 1937517909U, 1948038440U, 1958616096U, 1969251188U, 1979944027U,
+    1990694927U, 2001504204U, 2012372174U, 2023299156U, 2034285470U, 2045331439U,
+    2056437387U, 2067603638U, 2078830522U, 2090118366U, 2101467502U, 2112878262U,
+    2124350982U, 2135885998U, 2147483648U
+};
+
+/**
+  @par
+  Table values hold 2^x for x in [0, 1], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_EXP_TABLE_SIZE + 1); n++)
+  {
+  expTable[n] = pow(2, (double)n / FAST_MATH_EXP_TABLE_SIZE);
+  } </pre>
+  @par
+  The values are converted to Q2.14 (unsigned) and rounded to the nearest integer:
+    table[n] = round(table[n] * pow(2, 14));
+ */
+PLP_FAST_MATH_TABLE const uint16_t expTable_q16[FAST_MATH_EXP_TABLE_SIZE + 1] = {
+    16384,   16473,   16562,   16652,   16743,   16834,   16925,   17017,   17109,   17202,   17296,   17390,
+    17484,   17579,   17674,   17770,   17867,   17964,   18061,   18160,   18258,   18357,   18457,   18557,
+    18658,   18759,   18861,   18963,   19066,   19170,   19274,   19379,   19484,   19590,   19696,   19803,
+    19911,   20019,   20127,   20237,   20347,   20457,   20568,   20680,   20792,   20905,   21019,   21133,
+    21247,   21363,   21479,   21595,   21713,   21831,   21949,   22068,   22188,   22309,   22430,   22552,
+    22674,   22797,   22921,   23045,   23170,   23296,   23423,   23550,   23678,   23806,   23936,   24066,
+    24196,   24328,   24460,   24593,   24726,   24860,   24995,   25131,   25268,   25405,   25543,   25681,
+    25821,   25961,   26102,   26244,   26386,   26530,   26674,   26818,   26964,   27110,   27258,   27406,
+    27554,   27704,   27855,   28006,   28158,   28311,   28464,   28619,   28774,   28931,   29088,   29246,
+    29405,   29564,   29725,   29886,   30048,   30212,   30376,   30541,   30706,   30873,   31041,   31209,
+    31379,   31549,   31720,   31893,   32066,   32240,   32415,   32591,   32768
+};
+
+/**
+  @par
+  Table values hold log2(x) for x in [1, 2], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_LOG_TABLE_SIZE + 1); n++)
+  {
+  logTable[n] = log2(1 + (double)n / FAST_MATH_LOG_TABLE_SIZE);
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const float32_t logTable_f32[FAST_MATH_LOG_TABLE_SIZE + 1] = {
+    0.00000000f,  0.01122726f,  0.02236781f,  0.03342300f,  0.04439412f,  0.05528244f,
+    0.06608919f,  0.07681560f,  0.08746284f,  0.09803208f,  0.10852446f,  0.11894107f,
+    0.12928302f,  0.13955135f,  0.14974712f,  0.15987134f,  0.16992500f,  0.17990909f,
+    0.18982456f,  0.19967234f,  0.20945337f,  0.21916852f,  0.22881869f,  0.23840474f,
+    0.24792751f,  0.25738784f,  0.26678654f,  0.27612441f,  0.28540222f,  0.29462075f,
+    0.30378075f,  0.31288296f,  0.32192809f,  0.33091688f,  0.33985000f,  0.34872815f,
+    0.35755200f,  0.36632221f,  0.37503943f,  0.38370429f,  0.39231742f,  0.40087944f,
+    0.40939094f,  0.41785251f,  0.42626475f,  0.43462823f,  0.44294350f,  0.45121111f,
+    0.45943162f,  0.46760555f,  0.47573343f,  0.48381578f,  0.49185310f,  0.49984589f,
+    0.50779464f,  0.51569984f,  0.52356196f,  0.53138146f,  0.53915881f,  0.54689446f,
+    0.55458885f,  0.56224242f,  0.56985561f,  0.57742883f,  0.58496250f,  0.59245704f,
+    0.59991284f,  0.60733031f,  0.61470984f,  0.62205182f,  0.62935662f,  0.63662462f,
+    0.64385619f,  0.65105169f,  0.65821148f,  0.66533592f,  0.67242534f,  0.67948010f,
+    0.68650053f,  0.69348696f,  0.70043972f,  0.70735913f,  0.71424552f,  0.72109919f,
+    0.72792045f,  0.73470962f,  0.74146699f,  0.74819285f,  0.75488750f,  0.76155123f,
+    0.76818432f,  0.77478706f,  0.78135971f,  0.78790256f,  0.79441587f,  0.80089990f,
+    0.80735492f,  0.81378119f,  0.82017896f,  0.82654849f,  0.83289001f,  0.83920379f,
+    0.84549005f,  0.85174904f,  0.85798100f,  0.86418614f,  0.87036472f,  0.87651695f,
+    0.88264305f,  0.88874325f,  0.89481776f,  0.90086681f,  0.90689060f,  0.91288934f,
+    0.91886324f,  0.92481250f,  0.93073734f,  0.93663794f,  0.94251451f,  0.94836723f,
+    0.95419631f,  0.96000193f,  0.96578428f,  0.97154355f,  0.97727992f,  0.98299357f,
+    0.98868469f,  0.99435344f,  1.00000000f
+};
+
+/**
+  @par
+  Table values hold log2(x) for x in [1, 2], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_LOG_TABLE_SIZE + 1); n++)
+  {
+  logTable[n] = log2(1 + (double)n / FAST_MATH_LOG_TABLE_SIZE);
+  } </pre>
+  @par
+  The values are converted to Q1.31 (unsigned) and rounded to the nearest integer:
+    table[n] = round(table[n] * pow(2, 31));
+ */
+PLP_FAST_MATH_TABLE const uint32_t logTable_q32[FAST_MATH_LOG_TABLE_SIZE + 1] = {
+    0U,          24110347U,   48034513U,   71775349U,   95335645U,   118718126U,
+    141925456U,  164960239U,  187825021U,  210522295U,  233054496U,  255424009U,
+    277633165U,  299684247U,  321579490U,  343321082U,  364911162U,  386351829U,
+    407645136U,  428793095U,  449797678U,  470660814U,  491384396U,  511970279U,
+    532420281U,  552736183U,  572919734U,  592972645U,  612896598U,  632693241U,
+    652364189U,  671911030U,  691335320U,  710638585U,  729822324U,  748888009U,
+    767837083U,  786670965U,  805391046U,  823998694U,  842495250U,  860882034U,
+    879160341U,  897331443U,  915396590U,  933357012U,  951213914U,  968968484U,
+    986621888U,  1004175273U, 1021629764U, 1038986470U, 1056246482U, 1073410869U,
+    1090480686U, 1107456970U, 1124340739U, 1141132997U, 1157834731U, 1174446910U,
+    1190970490U, 1207406412U, 1223755601U, 1240018966U, 1256197405U, 1272291800U,
+    1288303019U, 1304231918U, 1320079339U, 1335846110U, 1351533050U, 1367140963U,
+    1382670639U, 1398122861U, 1413498396U, 1428798003U, 1444022426U, 1459172403U,
+    1474248656U, 1489251901U, 1504182841U, 1519042169U, 1533830570U, 1548548716U,
+    1563197273U, 1577776895U, 1592288229U, 1606731910U, 1621108567U, 1635418819U,
+    1649663276U, 1663842541U, 1677957208U, 1692007863U, 1705995083U, 1719919439U,
+    1733781493U, 1747581801U, 1761320910U, 1774999361U, 1788617686U, 1802176412U,
+    1815676059U, 1829117139U, 1842500157U, 1855825614U, 1869094003U, 1882305810U,
+    1895461516U, 1908561594U, 1921606515U, 1934596739U, 1947532725U, 1960414922U,
+    1973243777U, 1986019729U, 1998743213U, 2011414658U, 2024034488U, 2036603122U,
+    2049120974U, 2061588451U, 2074005959U, 2086373895U, 2098692655U, 2110962628U,
+    2123184198U, 2135357746U, 2147483648U
+};
+
+/**
+  @par
+  Table values hold log2(x) for x in [1, 2], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_LOG_TABLE_SIZE + 1); n++)
+  {
+  logTable[n] = log2(1 + (double)n / FAST_MATH_LOG_TABLE_SIZE);
+  } </pre>
+  @par
+  The values are converted to Q1.15 (unsigned) and rounded to the nearest integer:
+    table[n] = round(table[n] * pow(2, 15));
+ */
+PLP_FAST_MATH_TABLE const uint16_t logTable_q16[FAST_MATH_LOG_TABLE_SIZE + 1] = {
+    0,       368,     733,     1095,    1455,    1811,    2166,    2517,    2866,    3212,    3556,    3897,
+    4236,    4573,    4907,    5239,    5568,    5895,    6220,    6543,    6863,    7182,    7498,    7812,
+    8124,    8434,    8742,    9048,    9352,    9654,    9954,    10253,   10549,   10843,   11136,   11427,
+    11716,   12004,   12289,   12573,   12855,   13136,   13415,   13692,   13968,   14242,   14514,   14785,
+    15055,   15322,   15589,   15854,   16117,   16379,   16639,   16898,   17156,   17412,   17667,   17921,
+    18173,   18424,   18673,   18921,   19168,   19414,   19658,   19901,   20143,   20383,   20623,   20861,
+    21098,   21334,   21568,   21802,   22034,   22265,   22495,   22724,   22952,   23179,   23404,   23629,
+    23852,   24075,   24296,   24517,   24736,   24955,   25172,   25388,   25604,   25818,   26031,   26244,
+    26455,   26666,   26876,   27084,   27292,   27499,   27705,   27910,   28114,   28318,   28520,   28722,
+    28922,   29122,   29321,   29520,   29717,   29914,   30109,   30304,   30498,   30692,   30884,   31076,
+    31267,   31457,   31647,   31836,   32024,   32211,   32397,   32583,   32768
+};
+
+/**
+  @par
+  Table values hold tanh(x) for x in [0, 8], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_TANH_TABLE_SIZE + 1); n++)
+  {
+  tanhTable[n] = tanh(8.0 * n / FAST_MATH_TANH_TABLE_SIZE);
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const float32_t tanhTable_f32[FAST_MATH_TANH_TABLE_SIZE + 1] = {
+    0.00000000f,  0.03123983f,  0.06241875f,  0.09347630f,  0.12435300f,  0.15499073f,
+    0.18533320f,  0.21532634f,  0.24491866f,  0.27406159f,  0.30270973f,  0.33082112f,
+    0.35835740f,  0.38528397f,  0.41157006f,  0.43718879f,  0.46211716f,  0.48633602f,
+    0.50982997f,  0.53258729f,  0.55459972f,  0.57586239f,  0.59637356f,  0.61613443f,
+    0.63514895f,  0.65342359f,  0.67096707f,  0.68779021f,  0.70390560f,  0.71932750f,
+    0.73407152f,  0.74815447f,  0.76159416f,  0.77440919f,  0.78661881f,  0.79824275f,
+    0.80930107f,  0.81981401f,  0.82980191f,  0.83928506f,  0.84828364f,  0.85681760f,
+    0.86490662f,  0.87257001f,  0.87982670f,  0.88669515f,  0.89319334f,  0.89933873f,
+    0.90514825f,  0.91063826f,  0.91582454f,  0.92072232f,  0.92534623f,  0.92971031f,
+    0.93382804f,  0.93771234f,  0.94137554f,  0.94482944f,  0.94808529f,  0.95115382f,
+    0.95404526f,  0.95676933f,  0.95933529f,  0.96175193f,  0.96402758f,  0.96617017f,
+    0.96818722f,  0.97008583f,  0.97187275f,  0.97355436f,  0.97513670f,  0.97662548f,
+    0.97802611f,  0.97934369f,  0.98058305f,  0.98174873f,  0.98284503f,  0.98387602f,
+    0.98484552f,  0.98575714f,  0.98661430f,  0.98742020f,  0.98817786f,  0.98889015f,
+    0.98955975f,  0.99018919f,  0.99078086f,  0.99133700f,  0.99185972f,  0.99235103f,
+    0.99281279f,  0.99324678f,  0.99365463f,  0.99403793f,  0.99439815f,  0.99473665f,
+    0.99505475f,  0.99535367f,  0.99563457f,  0.99589851f,  0.99614653f,  0.99637958f,
+    0.99659856f,  0.99680431f,  0.99699764f,  0.99717928f,  0.99734996f,  0.99751031f,
+    0.99766098f,  0.99780254f,  0.99793554f,  0.99806050f,  0.99817790f,  0.99828820f,
+    0.99839183f,  0.99848919f,  0.99858066f,  0.99866660f,  0.99874733f,  0.99882318f,
+    0.99889444f,  0.99896139f,  0.99902429f,  0.99908337f,  0.99913889f,  0.99919104f,
+    0.99924003f,  0.99928606f,  0.99932930f,  0.99936992f,  0.99940809f,  0.99944394f,
+    0.99947762f,  0.99950926f,  0.99953899f,  0.99956691f,  0.99959315f,  0.99961779f,
+    0.99964094f,  0.99966269f,  0.99968313f,  0.99970232f,  0.99972036f,  0.99973730f,
+    0.99975321f,  0.99976816f,  0.99978221f,  0.99979540f,  0.99980780f,  0.99981944f,
+    0.99983038f,  0.99984065f,  0.99985031f,  0.99985938f,  0.99986790f,  0.99987590f,
+    0.99988342f,  0.99989048f,  0.99989712f,  0.99990335f,  0.99990920f,  0.99991471f,
+    0.99991987f,  0.99992473f,  0.99992929f,  0.99993357f,  0.99993760f,  0.99994138f,
+    0.99994493f,  0.99994827f,  0.99995140f,  0.99995434f,  0.99995711f,  0.99995971f,
+    0.99996215f,  0.99996444f,  0.99996660f,  0.99996862f,  0.99997052f,  0.99997231f,
+    0.99997399f,  0.99997556f,  0.99997704f,  0.99997843f,  0.99997974f,  0.99998097f,
+    0.99998212f,  0.99998320f,  0.99998422f,  0.99998518f,  0.99998608f,  0.99998692f,
+    0.99998771f,  0.99998846f,  0.99998916f,  0.99998981f,  0.99999043f,  0.99999101f,
+    0.99999155f,  0.99999207f,  0.99999255f,  0.99999300f,  0.99999342f,  0.99999382f,
+    0.99999420f,  0.99999455f,  0.99999488f,  0.99999519f,  0.99999548f,  0.99999575f,
+    0.99999601f,  0.99999625f,  0.99999648f,  0.99999669f,  0.99999689f,  0.99999708f,
+    0.99999726f,  0.99999742f,  0.99999758f,  0.99999773f,  0.99999786f,  0.99999799f,
+    0.99999812f,  0.99999823f,  0.99999834f,  0.99999844f,  0.99999853f,  0.99999862f,
+    0.99999870f,  0.99999878f,  0.99999886f,  0.99999893f,  0.99999899f,  0.99999905f,
+    0.99999911f,  0.99999916f,  0.99999921f,  0.99999926f,  0.99999931f,  0.99999935f,
+    0.99999939f,  0.99999943f,  0.99999946f,  0.99999949f,  0.99999952f,  0.99999955f,
+    0.99999958f,  0.99999960f,  0.99999963f,  0.99999965f,  0.99999967f,  0.99999969f,
+    0.99999971f,  0.99999973f,  0.99999974f,  0.99999976f,  0.99999977f
+};
+
+/**
+  @par
+  Table values hold tanh(x) for x in [0, 8], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_TANH_TABLE_SIZE + 1); n++)
+  {
+  tanhTable[n] = tanh(8.0 * n / FAST_MATH_TANH_TABLE_SIZE);
+  } </pre>
+  @par
+  The values are converted to Q1.31 and rounded to the nearest integer:
+    table[n] = round(table[n] * pow(2, 31));
+ */
+PLP_FAST_MATH_TABLE const int32_t tanhTable_q32[FAST_MATH_TANH_TABLE_SIZE + 1] = {
+    0L,          67087027L,   134043238L,  200738834L,  267046038L,  332840059L,
+    398000016L,  462409793L,  525958823L,  588542781L,  650064194L,  710432940L,
+    769566653L,  827391017L,  883839965L,  938855767L,  992389039L,  1044398644L,
+    1094851532L, 1143722488L, 1190993835L, 1236655069L, 1280702458L, 1323138607L,
+    1363971989L, 1403216471L, 1440890820L, 1477018219L, 1511625774L, 1544744046L,
+    1576406585L, 1606649491L, 1635510996L, 1663031067L, 1689251036L, 1714213263L,
+    1737960815L, 1760537185L, 1781986033L, 1802350947L, 1821675246L, 1840001788L,
+    1857372819L, 1873829831L, 1889413451L, 1904163334L, 1918118093L, 1931315227L,
+    1943791074L, 1955580771L, 1966718233L, 1977236130L, 1987165888L, 1996537682L,
+    2005380453L, 2013721914L, 2021588576L, 2029005763L, 2035997648L, 2042587275L,
+    2048796596L, 2054646501L, 2060156855L, 2065346536L, 2070233464L, 2074834649L,
+    2079166216L, 2083243450L, 2087080830L, 2090692061L, 2094090114L, 2097287257L,
+    2100295089L, 2103124571L, 2105786059L, 2108289334L, 2110643629L, 2112857658L,
+    2114939645L, 2116897344L, 2118738072L, 2120468724L, 2122095801L, 2123625428L,
+    2125063379L, 2126415091L, 2127685686L, 2128879988L, 2130002540L, 2131057616L,
+    2132049242L, 2132981208L, 2133857079L, 2134680210L, 2135453758L, 2136180694L,
+    2136863812L, 2137505741L, 2138108952L, 2138675772L, 2139208386L, 2139708851L,
+    2140179101L, 2140620954L, 2141036119L, 2141426204L, 2141792720L, 2142137087L,
+    2142460640L, 2142764634L, 2143050249L, 2143318595L, 2143570713L, 2143807583L,
+    2144030125L, 2144239206L, 2144435637L, 2144620183L, 2144793563L, 2144956451L,
+    2145109482L, 2145253251L, 2145388318L, 2145515209L, 2145634419L, 2145746413L,
+    2145851627L, 2145950471L, 2146043330L, 2146130567L, 2146212522L, 2146289514L,
+    2146361844L, 2146429794L, 2146493629L, 2146553598L, 2146609936L, 2146662861L,
+    2146712581L, 2146759290L, 2146803170L, 2146844392L, 2146883117L, 2146919496L,
+    2146953672L, 2146985778L, 2147015939L, 2147044273L, 2147070891L, 2147095897L,
+    2147119387L, 2147141455L, 2147162186L, 2147181661L, 2147199956L, 2147217143L,
+    2147233289L, 2147248457L, 2147262705L, 2147276091L, 2147288666L, 2147300479L,
+    2147311576L, 2147322001L, 2147331794L, 2147340994L, 2147349637L, 2147357756L,
+    2147365383L, 2147372548L, 2147379279L, 2147385602L, 2147391543L, 2147397123L,
+    2147402365L, 2147407290L, 2147411916L, 2147416262L, 2147420345L, 2147424180L,
+    2147427783L, 2147431167L, 2147434347L, 2147437334L, 2147440140L, 2147442776L,
+    2147445252L, 2147447579L, 2147449764L, 2147451817L, 2147453745L, 2147455557L,
+    2147457259L, 2147458858L, 2147460360L, 2147461771L, 2147463096L, 2147464341L,
+    2147465511L, 2147466610L, 2147467642L, 2147468612L, 2147469523L, 2147470379L,
+    2147471183L, 2147471938L, 2147472647L, 2147473314L, 2147473940L, 2147474528L,
+    2147475081L, 2147475600L, 2147476087L, 2147476545L, 2147476976L, 2147477380L,
+    2147477760L, 2147478117L, 2147478452L, 2147478766L, 2147479062L, 2147479340L,
+    2147479601L, 2147479846L, 2147480077L, 2147480293L, 2147480496L, 2147480687L,
+    2147480867L, 2147481035L, 2147481193L, 2147481342L, 2147481482L, 2147481613L,
+    2147481736L, 2147481852L, 2147481961L, 2147482063L, 2147482159L, 2147482249L,
+    2147482334L, 2147482414L, 2147482489L, 2147482559L, 2147482625L, 2147482687L,
+    2147482745L, 2147482800L, 2147482851L, 2147482899L, 2147482945L, 2147482987L,
+    2147483027L, 2147483065L, 2147483100L, 2147483133L, 2147483165L
+};
+
+/**
+  @par
+  Table values hold tanh(x) for x in [0, 8], generated as:
+  <pre>
+  for (n = 0; n < (FAST_MATH_TANH_TABLE_SIZE + 1); n++)
+  {
+  tanhTable[n] = tanh(8.0 * n / FAST_MATH_TANH_TABLE_SIZE);
+  } </pre>
+  @par
+  The values are converted to Q1.15 and rounded to the nearest integer:
+    table[n] = round(table[n] * pow(2, 15));
+  The last entries are saturated to 0x7FFF.
+ */
+PLP_FAST_MATH_TABLE const int16_t tanhTable_q16[FAST_MATH_TANH_TABLE_SIZE + 1] = {
+    0,       1024,    2045,    3063,    4075,    5079,    6073,    7056,    8025,    8980,    9919,    10840,
+    11743,   12625,   13486,   14326,   15143,   15936,   16706,   17452,   18173,   18870,   19542,   20189,
+    20813,   21411,   21986,   22538,   23066,   23571,   24054,   24516,   24956,   25376,   25776,   26157,
+    26519,   26864,   27191,   27502,   27797,   28076,   28341,   28592,   28830,   29055,   29268,   29470,
+    29660,   29840,   30010,   30170,   30322,   30465,   30600,   30727,   30847,   30960,   31067,   31167,
+    31262,   31351,   31435,   31515,   31589,   31659,   31726,   31788,   31846,   31901,   31953,   32002,
+    32048,   32091,   32132,   32170,   32206,   32240,   32271,   32301,   32329,   32356,   32381,   32404,
+    32426,   32447,   32466,   32484,   32501,   32517,   32532,   32547,   32560,   32573,   32584,   32596,
+    32606,   32616,   32625,   32634,   32642,   32649,   32657,   32663,   32670,   32676,   32681,   32686,
+    32691,   32696,   32700,   32704,   32708,   32712,   32715,   32718,   32721,   32724,   32727,   32729,
+    32732,   32734,   32736,   32738,   32740,   32741,   32743,   32745,   32746,   32747,   32749,   32750,
+    32751,   32752,   32753,   32754,   32755,   32755,   32756,   32757,   32758,   32758,   32759,   32759,
+    32760,   32760,   32761,   32761,   32762,   32762,   32762,   32763,   32763,   32763,   32764,   32764,
+    32764,   32764,   32765,   32765,   32765,   32765,   32765,   32766,   32766,   32766,   32766,   32766,
+    32766,   32766,   32766,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,   32767,
+    32767,   32767,   32767,   32767,   32767
+};
+
+/**
+  @par
+  Table values hold the CORDIC rotation angles atan(2^-n), in the format of the q32 sine input
+  (Q1.31, where 2^31 is a full turn):
+  <pre>
+  for (n = 0; n < FAST_MATH_ATAN_TABLE_SIZE; n++)
+  {
+  atanTable[n] = round(atan(pow(2, -n)) / (2 * PI) * pow(2, 31));
+  } </pre>
+ */
+PLP_FAST_MATH_TABLE const int32_t atanTable_q32[FAST_MATH_ATAN_TABLE_SIZE] = {
+    268435456,   158466703,   83729454,    42502378,    21333666,    10677233,
+    5339919,     2670123,     1335082,     667543,      333772,      166886,
+    83443,       41722,       20861,       10430,       5215,        2608,
+    1304,        652,         326,         163,         81,          41,
+    20,          10,          5,           3,           1,           1
+};
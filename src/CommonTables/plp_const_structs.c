@@ -25,44 +25,83 @@
 #include "plp_const_structs.h"
 #include "plp_common_tables.h"
 
-const plp_cfft_instance_q16 plp_cfft_sR_q16_len16 = { 16, twiddleCoef_16_q16,
-                                                      plpBitRevIndexTable_fixed_16,
-                                                      PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH };
+/* with PLP_QUARTER_WAVE_TABLES, the kernels derive the twiddle factors from sinTable_quarter_q32 */
+#if defined(PLP_QUARTER_WAVE_TABLES)
+#define PLP_TWIDDLE_TABLE_Q16(N) NULL
+#else
+#define PLP_TWIDDLE_TABLE_Q16(N) twiddleCoef_##N##_q16
+#endif
 
-const plp_cfft_instance_q16 plp_cfft_sR_q16_len32 = { 32, twiddleCoef_32_q16,
-                                                      plpBitRevIndexTable_fixed_32,
-                                                      PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH };
+const plp_cfft_instance_q16 plp_cfft_sR_q16_len16 = {
+    16, PLP_TWIDDLE_TABLE_Q16(16), (const int16_t *)plpBitRevIndexTable_fixed_16,
+    PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH
+};
+
+const plp_cfft_instance_q16 plp_cfft_sR_q16_len32 = {
+    32, PLP_TWIDDLE_TABLE_Q16(32), (const int16_t *)plpBitRevIndexTable_fixed_32,
+    PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH
+};
 
-const plp_cfft_instance_q16 plp_cfft_sR_q16_len64 = { 64, twiddleCoef_64_q16,
-                                                      plpBitRevIndexTable_fixed_64,
-                                                      PLPBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH };
+const plp_cfft_instance_q16 plp_cfft_sR_q16_len64 = {
+    64, PLP_TWIDDLE_TABLE_Q16(64), (const int16_t *)plpBitRevIndexTable_fixed_64,
+    PLPBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH
+};
 
-const plp_cfft_instance_q16 plp_cfft_sR_q16_len128 = { 128, twiddleCoef_128_q16,
-                                                       plpBitRevIndexTable_fixed_128,
-                                                       PLPBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH };
+const plp_cfft_instance_q16 plp_cfft_sR_q16_len128 = {
+    128, PLP_TWIDDLE_TABLE_Q16(128), (const int16_t *)plpBitRevIndexTable_fixed_128,
+    PLPBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH
+};
 
-const plp_cfft_instance_q16 plp_cfft_sR_q16_len256 = { 256, twiddleCoef_256_q16,
-                                                       plpBitRevIndexTable_fixed_256,
-                                                       PLPBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH };
+const plp_cfft_instance_q16 plp_cfft_sR_q16_len256 = {
+    256, PLP_TWIDDLE_TABLE_Q16(256), (const int16_t *)plpBitRevIndexTable_fixed_256,
+    PLPBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH
+};
 
-const plp_cfft_instance_q16 plp_cfft_sR_q16_len512 = { 512, twiddleCoef_512_q16,
-                                                       plpBitRevIndexTable_fixed_512,
-                                                       PLPBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH };
+const plp_cfft_instance_q16 plp_cfft_sR_q16_len512 = {
+    512, PLP_TWIDDLE_TABLE_Q16(512), (const int16_t *)plpBitRevIndexTable_fixed_512,
+    PLPBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH
+};
 
 const plp_cfft_instance_q16 plp_cfft_sR_q16_len1024 = {
-    1024, twiddleCoef_1024_q16, plpBitRevIndexTable_fixed_1024,
+    1024, PLP_TWIDDLE_TABLE_Q16(1024), (const int16_t *)plpBitRevIndexTable_fixed_1024,
     PLPBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
 
 const plp_cfft_instance_q16 plp_cfft_sR_q16_len2048 = {
-    2048, twiddleCoef_2048_q16, plpBitRevIndexTable_fixed_2048,
+    2048, PLP_TWIDDLE_TABLE_Q16(2048), (const int16_t *)plpBitRevIndexTable_fixed_2048,
     PLPBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
 
 const plp_cfft_instance_q16 plp_cfft_sR_q16_len4096 = {
-    4096, twiddleCoef_4096_q16, plpBitRevIndexTable_fixed_4096,
+    4096, PLP_TWIDDLE_TABLE_Q16(4096), (const int16_t *)plpBitRevIndexTable_fixed_4096,
     PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
 
-const plp_rfft_instance_f32 plp_rfft_sR_f32_len2048 = { 2048, 0, (float32_t *)twiddleCoef_rfft_2048,
-                                                        (uint16_t *)bit_rev_radix2_LUT };
\ No newline at end of file
+const plp_rfft_instance_f32 plp_rfft_sR_f32_len2048 = {
+    2048, 0, (float32_t *)twiddleCoef_rfft_2048, plpBitRevIndexTable_rfft_2048, PLP_RFFT_RADIX2,
+    PLPBITREVINDEXTABLE_RFFT_2048_TABLE_LENGTH
+};
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len16 = { 16, (float32_t *)twiddleCoef_rfft_2048,
+                                                      (uint16_t *)bit_rev_radix2_LUT, 128 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len32 = { 32, (float32_t *)twiddleCoef_rfft_2048,
+                                                      (uint16_t *)bit_rev_radix2_LUT, 64 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len64 = { 64, (float32_t *)twiddleCoef_rfft_2048,
+                                                      (uint16_t *)bit_rev_radix2_LUT, 32 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len128 = { 128, (float32_t *)twiddleCoef_rfft_2048,
+                                                       (uint16_t *)bit_rev_radix2_LUT, 16 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len256 = { 256, (float32_t *)twiddleCoef_rfft_2048,
+                                                       (uint16_t *)bit_rev_radix2_LUT, 8 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len512 = { 512, (float32_t *)twiddleCoef_rfft_2048,
+                                                       (uint16_t *)bit_rev_radix2_LUT, 4 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len1024 = { 1024, (float32_t *)twiddleCoef_rfft_2048,
+                                                        (uint16_t *)bit_rev_radix2_LUT, 2 };
+
+const plp_cfft_instance_f32 plp_cfft_sR_f32_len2048 = { 2048, (float32_t *)twiddleCoef_rfft_2048,
+                                                        (uint16_t *)bit_rev_radix2_LUT, 1 };
@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_arg_f32_xpulpv2.c
+ * Description:  f32 complex argument for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_arg Complex Argument
+  Computes the argument (phase) of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pDst</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[n] = atan2(pSrc[(2*n)+1], pSrc[(2*n)+0]);
+  }
+  </pre>
+  The fixed point versions return the angle in the format of the input of plp_sin_q16 and
+  plp_sin_q32, where +-0.5 is mapped to +-PI, and use CORDIC. The floating point version returns
+  radians and uses a polynomial. See plp_atan2_q16, plp_atan2_q32 and plp_atan2_f32.
+  There are separate functions for floating point, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_arg
+  @{
+ */
+
+/**
+  @brief         32-bit floating-point complex argument kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t numSamples) {
+
+    uint32_t n;
+    float32_t x, y, res;
+    float32_t ax, ay, num, t, t2;
+    union {
+        float32_t f;
+        int32_t i;
+    } den, r;
+
+    for (n = 0; n < numSamples; n++) {
+        x = pSrc[2 * n];
+        y = pSrc[2 * n + 1];
+
+        ax = (x < 0.0f) ? -x : x;
+        ay = (y < 0.0f) ? -y : y;
+        if (ax == 0.0f && ay == 0.0f) {
+            res = 0.0f;
+        } else {
+            /* t = min / max in [0, 1], with the reciprocal refined by Newton iterations */
+            if (ay > ax) {
+                num = ax;
+                den.f = ay;
+            } else {
+                num = ay;
+                den.f = ax;
+            }
+            r.i = 0x7EF311C7 - den.i;
+            r.f = r.f * (2.0f - den.f * r.f);
+            r.f = r.f * (2.0f - den.f * r.f);
+            r.f = r.f * (2.0f - den.f * r.f);
+            t = num * r.f;
+
+            /* atan(t) on [0, 1] (Abramowitz and Stegun 4.4.49, error below 2e-8) */
+            t2 = t * t;
+            res = 0.0028662257f;
+            res = res * t2 - 0.0161657367f;
+            res = res * t2 + 0.0429096138f;
+            res = res * t2 - 0.0752896400f;
+            res = res * t2 + 0.1065626393f;
+            res = res * t2 - 0.1420889944f;
+            res = res * t2 + 0.1999355085f;
+            res = res * t2 - 0.3333314528f;
+            res = (res * t2 + 1.0f) * t;
+
+            /* map back to the octant and the quadrant of (x, y) */
+            if (ay > ax) {
+                res = 1.570796327f - res;
+            }
+            if (x < 0.0f) {
+                res = 3.141592654f - res;
+            }
+            if (y < 0.0f) {
+                res = -res;
+            }
+        }
+        pDst[n] = res;
+    }
+}
+
+/**
+  @} end of cmplx_arg group
+ */
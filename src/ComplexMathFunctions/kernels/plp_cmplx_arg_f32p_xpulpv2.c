@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_arg_f32p_xpulpv2.c
+ * Description:  Parallel f32 complex argument for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_arg Complex Argument
+  Computes the argument (phase) of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pDst</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[n] = atan2(pSrc[(2*n)+1], pSrc[(2*n)+0]);
+  }
+  </pre>
+  The fixed point versions return the angle in the format of the input of plp_sin_q16 and
+  plp_sin_q32, where +-0.5 is mapped to +-PI, and use CORDIC. The floating point version returns
+  radians and uses a polynomial. See plp_atan2_q16, plp_atan2_q32 and plp_atan2_f32.
+  There are separate functions for floating point, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_arg
+  @{
+ */
+
+/**
+  @brief         Parallel 32-bit floating-point complex argument kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_arg_instance_f32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_arg_f32p_xpulpv2(void *args) {
+
+    plp_cmplx_arg_instance_f32 *S = (plp_cmplx_arg_instance_f32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    /* every core processes a contiguous chunk of the samples */
+    if (start < end) {
+        plp_cmplx_arg_f32_xpulpv2(S->pSrc + 2 * start, S->pDst + start, end - start);
+    }
+}
+
+/**
+  @} end of cmplx_arg group
+ */
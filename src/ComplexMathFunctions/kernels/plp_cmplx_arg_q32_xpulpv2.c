@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_arg_q32_xpulpv2.c
+ * Description:  q32 complex argument for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_arg Complex Argument
+  Computes the argument (phase) of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pDst</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[n] = atan2(pSrc[(2*n)+1], pSrc[(2*n)+0]);
+  }
+  </pre>
+  The fixed point versions return the angle in the format of the input of plp_sin_q16 and
+  plp_sin_q32, where +-0.5 is mapped to +-PI, and use CORDIC. The floating point version returns
+  radians and uses a polynomial. See plp_atan2_q16, plp_atan2_q32 and plp_atan2_f32.
+  There are separate functions for floating point, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_arg
+  @{
+ */
+
+/**
+  @brief         32-bit fixed-point complex argument kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_arg_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t numSamples) {
+
+    uint32_t n;
+    int32_t x, y;
+    uint32_t ux, uy;
+    int32_t shift, xr, yr, tmp, angle;
+    uint32_t i;
+    int32_t res;
+
+    for (n = 0; n < numSamples; n++) {
+        x = pSrc[2 * n];
+        y = pSrc[2 * n + 1];
+
+        /* normalize the magnitudes to keep two bits of headroom for the CORDIC gain */
+        ux = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+        uy = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+        if ((ux | uy) == 0) {
+            res = 0;
+        } else {
+            shift = __builtin_clz(ux | uy) - 3;
+            if (shift >= 0) {
+                ux <<= shift;
+                uy <<= shift;
+            } else {
+                ux >>= -shift;
+                uy >>= -shift;
+            }
+
+            /* rotate into the right half plane, the angle is in Q1.31 where 2^31 is a full turn */
+            xr = ux;
+            yr = ((x < 0) != (y < 0)) ? -(int32_t)uy : (int32_t)uy;
+            angle = (x >= 0) ? 0 : (y < 0) ? -0x40000000 : 0x40000000;
+
+            /* CORDIC vectoring: rotate (xr, yr) onto the x axis and sum up the rotation angles */
+            for (i = 0; i < FAST_MATH_ATAN_TABLE_SIZE; i++) {
+                if (yr > 0) {
+                    tmp = xr + (yr >> i);
+                    yr = yr - (xr >> i);
+                    xr = tmp;
+                    angle += atanTable_q32[i];
+                } else {
+                    tmp = xr - (yr >> i);
+                    yr = yr + (xr >> i);
+                    xr = tmp;
+                    angle -= atanTable_q32[i];
+                }
+            }
+            res = angle;
+        }
+        pDst[n] = res;
+    }
+}
+
+/**
+  @} end of cmplx_arg group
+ */
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_f32p_xpulpv2.c
+ * Description:  Parallel f32 complex dot product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_dot_prod Complex Dot Product
+  Computes the dot product of two complex vectors.
+  The vectors are multiplied element-by-element and then summed.
+  The <code>pSrcA</code> points to the first complex input vector and
+  <code>pSrcB</code> points to the second complex input vector.
+  <code>numSamples</code> specifies the number of complex samples
+  and the data in each array is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  Each array has a total of <code>2*numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  realResult = 0;
+  imagResult = 0;
+  for (n = 0; n < numSamples; n++) {
+      realResult += pSrcA[(2*n)+0] * pSrcB[(2*n)+0] - pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      imagResult += pSrcA[(2*n)+0] * pSrcB[(2*n)+1] + pSrcA[(2*n)+1] * pSrcB[(2*n)+0];
+  }
+  </pre>
+  There are separate functions for floating point, integer, and fixed point 32- 16- 8-bit data
+  types.
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief         Parallel 32-bit floating-point complex dot product kernel for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_dot_prod_instance_f32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_f32p_xpulpv2(void *args) {
+
+    plp_cmplx_dot_prod_instance_f32 *S = (plp_cmplx_dot_prod_instance_f32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    float32_t realSum = 0.0f, imagSum = 0.0f;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    /* every core reduces a contiguous chunk of the samples into its own partial result */
+    if (start < end) {
+        plp_cmplx_dot_prod_f32_xpulpv2(S->pSrcA + 2 * start, S->pSrcB + 2 * start, end - start,
+                                       &realSum, &imagSum);
+    }
+
+    S->resBuffer[2 * core_id] = realSum;
+    S->resBuffer[2 * core_id + 1] = imagSum;
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
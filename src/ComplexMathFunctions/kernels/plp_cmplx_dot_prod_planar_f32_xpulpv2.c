@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_planar_f32_xpulpv2.c
+ * Description:  f32 planar complex dot product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxDotProdPlanar Planar Complex Dot Product
+  Computes the dot product of two complex vectors, like plp_cmplx_dot_prod, but with the real and
+  imaginary parts stored in separate arrays (planar or split-complex layout).
+  The parameter <code>numSamples</code> represents the number of complex samples processed, each
+  of the arrays has <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  realResult = 0;
+  imagResult = 0;
+  for (n = 0; n < numSamples; n++) {
+      realResult += pSrcARe[n] * pSrcBRe[n] - pSrcAIm[n] * pSrcBIm[n];
+      imagResult += pSrcARe[n] * pSrcBIm[n] + pSrcAIm[n] * pSrcBRe[n];
+  }
+  </pre>
+  The fixed point version accumulates the exact products in 32 bits and rounds the sums once,
+  i.e. the result is <code>round(sum / 2^deciPoint)</code>. The results wrap around on overflow.
+  There are separate functions for floating point and 16-bit fixed point data types.
+ */
+
+/**
+  @addtogroup CmplxDotProdPlanar
+  @{
+ */
+
+/**
+  @brief         32-bit floating-point planar complex dot product kernel for XPULPV2 extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_f32_xpulpv2(const float32_t *pSrcARe,
+                                           const float32_t *pSrcAIm,
+                                           const float32_t *pSrcBRe,
+                                           const float32_t *pSrcBIm,
+                                           uint32_t numSamples,
+                                           float32_t *realResult,
+                                           float32_t *imagResult) {
+
+    uint32_t blkCnt;                            /* Loop counter */
+    float32_t real_sum = 0.0f, imag_sum = 0.0f; /* Temporary result variables */
+    float32_t a, b, c, d;
+
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        a = *pSrcARe++;
+        b = *pSrcAIm++;
+        c = *pSrcBRe++;
+        d = *pSrcBIm++;
+
+        real_sum += a * c;
+        imag_sum += a * d;
+        real_sum -= b * d;
+        imag_sum += b * c;
+    }
+
+    *realResult = real_sum;
+    *imagResult = imag_sum;
+}
+
+/**
+  @} end of CmplxDotProdPlanar group
+ */
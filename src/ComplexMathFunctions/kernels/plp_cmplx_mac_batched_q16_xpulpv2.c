@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mac_batched_q16_xpulpv2.c
+ * Description:  q16 batched complex multiply-accumulate for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mac Complex Multiply-Accumulate
+  Multiplies two complex vectors element-by-element and accumulates the products into the
+  destination vector, which saves the temporary buffer and the second pass of a multiplication
+  followed by an addition.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed. The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] += pSrcA[(2*n)+0] * pSrcB[(2*n)+0] - pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pDst[(2*n)+1] += pSrcA[(2*n)+0] * pSrcB[(2*n)+1] + pSrcA[(2*n)+1] * pSrcB[(2*n)+0];
+  }
+  </pre>
+  The batched versions accumulate the products of <code>numChannels</code> pairs of vectors, which
+  are stored one after the other in <code>pSrcA</code> and <code>pSrcB</code>, and read and write
+  the destination only once:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      for (k = 0; k < numChannels; k++) {
+          i = 2 * (k * numSamples + n);
+          pDst[(2*n)+0] += pSrcA[i+0] * pSrcB[i+0] - pSrcA[i+1] * pSrcB[i+1];
+          pDst[(2*n)+1] += pSrcA[i+0] * pSrcB[i+1] + pSrcA[i+1] * pSrcB[i+0];
+      }
+  }
+  </pre>
+  The fixed point versions accumulate the exact products on top of the destination scaled by
+  <code>2^deciPoint</code> and round once, i.e. the result is
+  <code>pDst + round(sum / 2^deciPoint)</code>. Like plp_cmplx_mult_cmplx, the results wrap around
+  on overflow.
+  There are separate functions for floating point, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mac
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point batched complex multiply-accumulate kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vectors, stored one after the other
+  @param[in]     pSrcB       points to the second input vectors, stored one after the other
+  @param[in,out] pDst        points to the accumulation vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     numChannels number of vector pairs to accumulate
+  @return        none
+ */
+
+void plp_cmplx_mac_batched_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t numChannels) {
+
+    uint32_t n, k;                                        /* Loop counters */
+    uint32_t stride = 2 * numSamples;                     /* Distance between the channels */
+    int32_t rnd = deciPoint ? 1 << (deciPoint - 1) : 0; /* Rounding offset */
+    v2s conj = (v2s){ 0, -1 };
+    v2s swap = (v2s){ 1, 0 };
+    const int16_t *pA, *pB;
+    v2s x, y;
+    int32_t re, im;
+
+    for (n = 0; n < numSamples; n++) {
+        pA = pSrcA + 2 * n;
+        pB = pSrcB + 2 * n;
+        re = ((int32_t)pDst[0] << deciPoint) + rnd;
+        im = ((int32_t)pDst[1] << deciPoint) + rnd;
+
+        /* accumulate the exact products of all channels and round once */
+        for (k = 0; k < numChannels; k++) {
+            x = *((v2s *)pA);
+            y = *((v2s *)pB);
+            /* a * c + b * ~d + b = a * c - b * d, with ~d = -d - 1 which cannot overflow */
+            re = __SUMDOTP2(x, y ^ conj, re + x[1]);
+            im = __SUMDOTP2(x, __builtin_shuffle(y, swap), im);
+            pA += stride;
+            pB += stride;
+        }
+
+        *pDst++ = (int16_t)(re >> deciPoint);
+        *pDst++ = (int16_t)(im >> deciPoint);
+    }
+}
+
+/**
+  @} end of cmplx_mac group
+ */
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_approx_f32_xpulpv2.c
+ * Description:  Approximate magnitude of 32-bit floating-point complex vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_approx Approximate Complex Magnitude
+  Estimates the magnitude of the elements of a complex data vector with the alpha max plus beta
+  min algorithm, which needs neither a square root nor a division. The samples are stored like for
+  plp_cmplx_mag (real, imag, real, imag, ...). With max and min the larger and the smaller of the
+  magnitudes of the real and the imaginary part, the magnitude is estimated as
+  <pre>
+  pRes[n] = max(alpha0 * max + beta0 * min, alpha1 * max + beta1 * min)
+  </pre>
+  with alpha0 = 0.99035, beta0 = 0.19668, alpha1 = 0.83953 and beta1 = 0.56096, which are
+  chosen for an equiripple error. The relative error is at most about 1%, which is enough for e.g.
+  detection thresholds, at the cost of a few instructions per sample. Magnitudes which cannot be
+  represented are saturated. The 16-bit versions handle -32768 like -32767. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_approx
+  @{
+ */
+
+/**
+  @brief         32-bit floating-point approximate complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                      float32_t *__restrict__ pRes,
+                                      uint32_t numSamples) {
+
+    uint32_t n;
+    float32_t real, imag, max, min, est0, est1;
+
+    for (n = 0; n < numSamples; n++) {
+        real = fabsf(pSrc[2 * n]);
+        imag = fabsf(pSrc[2 * n + 1]);
+
+        max = (real > imag) ? real : imag;
+        min = (real > imag) ? imag : real;
+
+        est0 = 0.990351180f * max + 0.196680205f * min;
+        est1 = 0.839533687f * max + 0.560962143f * min;
+        pRes[n] = (est0 > est1) ? est0 : est1;
+    }
+}
+
+/**
+  @} end of cmplx_mag_approx group
+ */
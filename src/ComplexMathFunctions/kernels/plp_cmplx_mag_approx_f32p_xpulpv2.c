@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_approx_f32p_xpulpv2.c
+ * Description:  Parallel approximate magnitude of 32-bit floating-point complex vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_approx Approximate Complex Magnitude
+  Estimates the magnitude of the elements of a complex data vector with the alpha max plus beta
+  min algorithm, which needs neither a square root nor a division. The samples are stored like for
+  plp_cmplx_mag (real, imag, real, imag, ...). With max and min the larger and the smaller of the
+  magnitudes of the real and the imaginary part, the magnitude is estimated as
+  <pre>
+  pRes[n] = max(alpha0 * max + beta0 * min, alpha1 * max + beta1 * min)
+  </pre>
+  with alpha0 = 0.99035, beta0 = 0.19668, alpha1 = 0.83953 and beta1 = 0.56096, which are
+  chosen for an equiripple error. The relative error is at most about 1%, which is enough for e.g.
+  detection thresholds, at the cost of a few instructions per sample. Magnitudes which cannot be
+  represented are saturated. The 16-bit versions handle -32768 like -32767. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_approx
+  @{
+ */
+
+/**
+  @brief         Parallel 32-bit floating-point approximate complex magnitude kernel for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_mag_instance_f32 struct initialized by the glue code
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_f32p_xpulpv2(void *args) {
+
+    plp_cmplx_mag_instance_f32 *S = (plp_cmplx_mag_instance_f32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    /* every core processes a contiguous chunk of the samples */
+    if (start < end) {
+        plp_cmplx_mag_approx_f32_xpulpv2(S->pSrc + 2 * start, S->pRes + start, end - start);
+    }
+}
+
+/**
+  @} end of cmplx_mag_approx group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_approx_q32_xpulpv2.c
+ * Description:  Approximate magnitude of 32-bit fixed-point complex vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_approx Approximate Complex Magnitude
+  Estimates the magnitude of the elements of a complex data vector with the alpha max plus beta
+  min algorithm, which needs neither a square root nor a division. The samples are stored like for
+  plp_cmplx_mag (real, imag, real, imag, ...). With max and min the larger and the smaller of the
+  magnitudes of the real and the imaginary part, the magnitude is estimated as
+  <pre>
+  pRes[n] = max(alpha0 * max + beta0 * min, alpha1 * max + beta1 * min)
+  </pre>
+  with alpha0 = 0.99035, beta0 = 0.19668, alpha1 = 0.83953 and beta1 = 0.56096, which are
+  chosen for an equiripple error. The relative error is at most about 1%, which is enough for e.g.
+  detection thresholds, at the cost of a few instructions per sample. Magnitudes which cannot be
+  represented are saturated. The 16-bit versions handle -32768 like -32767. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_approx
+  @{
+ */
+
+/**
+  @brief         32-bit fixed-point approximate complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format
+                             Q(32-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_approx_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                      const uint32_t deciPoint,
+                                      int32_t *__restrict__ pRes,
+                                      uint32_t numSamples) {
+
+    uint32_t n;
+    int32_t real, imag;
+    uint32_t absReal, absImag, max, min, est0, est1, mag;
+
+    for (n = 0; n < numSamples; n++) {
+        real = pSrc[2 * n];
+        imag = pSrc[2 * n + 1];
+        absReal = (real < 0) ? -(uint32_t)real : (uint32_t)real;
+        absImag = (imag < 0) ? -(uint32_t)imag : (uint32_t)imag;
+
+        max = (absReal > absImag) ? absReal : absImag;
+        min = (absReal > absImag) ? absImag : absReal;
+
+        /* both estimates with the coefficients in Q0.32, each product is a single mulhu */
+        est0 = (uint32_t)(((uint64_t)max * 4253525931U) >> 32) +
+               (uint32_t)(((uint64_t)min * 844735047U) >> 32);
+        est1 = (uint32_t)(((uint64_t)max * 3605769728U) >> 32) +
+               (uint32_t)(((uint64_t)min * 2409314059U) >> 32);
+        mag = (est0 > est1) ? est0 : est1;
+        pRes[n] = (mag > 0x7FFFFFFF) ? 0x7FFFFFFF : mag;
+    }
+}
+
+/**
+  @} end of cmplx_mag_approx group
+ */
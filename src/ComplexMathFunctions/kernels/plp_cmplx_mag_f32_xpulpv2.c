@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_f32_xpulpv2.c
+ * Description:  f32 complex magnitude for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag Complex Magnitude
+  Computes the magnitude of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pRes</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pRes[n] = sqrt(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+  }
+  </pre>
+  The square root is fused into the kernels: the integer and fixed point versions compute the
+  exact sum of squares (32-bit for 16-bit data, 64-bit for 32-bit data), approximate its square
+  root with the inverse square root table and Newton iterations, and correct the result to the
+  nearest integer. Magnitudes which cannot be represented are saturated. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point, integer, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
+ */
+
+/* inverse square root with the bit pattern approximation and two Newton iterations */
+static inline float32_t plp_cmplx_mag_rsqrt_f32(float32_t x) {
+    union {
+        float32_t f;
+        int32_t i;
+    } y;
+
+    y.f = x;
+    y.i = 0x5F1FFFF9 - (y.i >> 1);
+    y.f = 0.703952253f * y.f * (2.38924456f - x * y.f * y.f);
+    y.f = y.f * (1.5f - 0.5f * x * y.f * y.f);
+    return y.f;
+}
+
+/**
+  @brief         32-bit floating-point complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pRes,
+                               uint32_t numSamples) {
+
+    uint32_t n;
+    float32_t real, imag, sum;
+
+    for (n = 0; n < numSamples; n++) {
+        real = pSrc[2 * n];
+        imag = pSrc[2 * n + 1];
+        sum = real * real + imag * imag;
+        if (sum > 0.0f) {
+#if defined(__riscv_fsqrt)
+            pRes[n] = __builtin_sqrtf(sum);
+#else
+            pRes[n] = sum * plp_cmplx_mag_rsqrt_f32(sum);
+#endif
+        } else {
+            pRes[n] = 0.0f;
+        }
+    }
+}
+
+/**
+  @} end of cmplx_mag group
+ */
@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_i16_xpulpv2.c
+ * Description:  i16 complex magnitude for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag Complex Magnitude
+  Computes the magnitude of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pRes</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pRes[n] = sqrt(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+  }
+  </pre>
+  The square root is fused into the kernels: the integer and fixed point versions compute the
+  exact sum of squares (32-bit for 16-bit data, 64-bit for 32-bit data), approximate its square
+  root with the inverse square root table and Newton iterations, and correct the result to the
+  nearest integer. Magnitudes which cannot be represented are saturated. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point, integer, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
+ */
+
+/* rounded square root of s <= 2^31 */
+static inline uint32_t plp_cmplx_mag_sqrt_u32(uint32_t s) {
+    uint32_t m16, y, t, r;
+    int32_t shift;
+
+    if (s == 0) {
+        return 0;
+    }
+
+    /* s = m * 2^-shift, with the mantissa m in [2^30, 2^32) and an even shift */
+    shift = __builtin_clz(s) & ~1;
+    m16 = (s << shift) >> 16;
+
+    /* inverse square root of the mantissa in Q2.14, refined with two Newton iterations */
+    y = rsqrtTable_q16[(m16 >> 11) - 8];
+    t = (m16 * ((y * y) >> 14)) >> 16;
+    y = (y * (0xC000 - t)) >> 15;
+    t = (m16 * ((y * y) >> 14)) >> 16;
+    y = (y * (0xC000 - t)) >> 15;
+
+    /* sqrt(s) = m * rsqrt(m) * 2^(-shift / 2), corrected to the exact rounded result */
+    r = (m16 * y) >> (14 + shift / 2);
+    while (r * r > s) {
+        r--;
+    }
+    while ((r + 1) * (r + 1) <= s) {
+        r++;
+    }
+    if (s - r * r > r) {
+        r++;
+    }
+    return r;
+}
+
+/**
+  @brief         16-bit integer complex magnitude kernel for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i16_xpulpv2(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pRes,
+                               uint32_t numSamples) {
+
+    uint32_t n;
+    v2s in;
+    uint32_t sum, mag;
+
+    for (n = 0; n < numSamples; n++) {
+        /* real * real + imag * imag with a single dot product, 2^31 fits in the unsigned sum */
+        in = *((v2s *)&pSrc[2 * n]);
+        sum = (uint32_t)__DOTP2(in, in);
+        mag = plp_cmplx_mag_sqrt_u32(sum);
+        pRes[n] = __MIN(mag, 0x7FFF);
+    }
+}
+
+/**
+  @} end of cmplx_mag group
+ */
@@ -0,0 +1,129 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_i32_rv32im.c
+ * Description:  i32 complex magnitude for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag Complex Magnitude
+  Computes the magnitude of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pRes</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pRes[n] = sqrt(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+  }
+  </pre>
+  The square root is fused into the kernels: the integer and fixed point versions compute the
+  exact sum of squares (32-bit for 16-bit data, 64-bit for 32-bit data), approximate its square
+  root with the inverse square root table and Newton iterations, and correct the result to the
+  nearest integer. Magnitudes which cannot be represented are saturated. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point, integer, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
+ */
+
+/* rounded square root of s <= 2^63 */
+static inline uint32_t plp_cmplx_mag_sqrt_u64(uint64_t s) {
+    uint32_t m32, y, y2, t, r;
+    int32_t shift;
+
+    if (s == 0) {
+        return 0;
+    }
+
+    /* s = m * 2^-shift, with the mantissa m in [2^62, 2^64) and an even shift */
+    shift = __builtin_clzll(s) & ~1;
+    m32 = (uint32_t)((s << shift) >> 32);
+
+    /* inverse square root of the mantissa in Q2.30, refined with three Newton iterations */
+    y = (uint32_t)rsqrtTable_q16[(m32 >> 27) - 8] << 16;
+    for (int i = 0; i < 3; i++) {
+        y2 = ((uint64_t)y * y) >> 30;
+        t = ((uint64_t)m32 * y2) >> 32;
+        y = ((uint64_t)y * (0xC0000000U - t)) >> 31;
+    }
+
+    /* sqrt(s) = m * rsqrt(m) * 2^(-shift / 2), corrected to the exact rounded result */
+    r = ((uint64_t)m32 * y) >> (30 + shift / 2);
+    while ((uint64_t)r * r > s) {
+        r--;
+    }
+    while ((uint64_t)(r + 1) * (r + 1) <= s) {
+        r++;
+    }
+    if (s - (uint64_t)r * r > r) {
+        r++;
+    }
+    return r;
+}
+
+/**
+  @brief         32-bit integer complex magnitude kernel for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_i32_rv32im(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pRes,
+                              uint32_t numSamples) {
+
+    uint32_t n;
+    int64_t real, imag;
+    uint64_t sum;
+    uint32_t mag;
+
+    for (n = 0; n < numSamples; n++) {
+        real = pSrc[2 * n];
+        imag = pSrc[2 * n + 1];
+        sum = (uint64_t)(real * real) + (uint64_t)(imag * imag);
+        mag = plp_cmplx_mag_sqrt_u64(sum);
+        pRes[n] = (mag > 0x7FFFFFFF) ? 0x7FFFFFFF : mag;
+    }
+}
+
+/**
+  @} end of cmplx_mag group
+ */
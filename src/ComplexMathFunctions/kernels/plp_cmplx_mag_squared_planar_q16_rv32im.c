@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_planar_q16_rv32im.c
+ * Description:  q16 planar complex magnitude squared for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxMagSquaredPlanar Planar Complex Magnitude Squared
+  Computes the magnitude squared of the elements of a complex vector, like
+  plp_cmplx_mag_squared, but with the real and imaginary parts stored in separate arrays (planar
+  or split-complex layout).
+  The parameter <code>numSamples</code> represents the number of complex samples processed, each
+  of the arrays has <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[n] = pSrcRe[n]^2 + pSrcIm[n]^2;
+  }
+  </pre>
+  The fixed point version computes the exact sums of squares and rounds them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. The results wrap around on overflow.
+  There are separate functions for floating point and 16-bit fixed point data types.
+ */
+
+/**
+  @addtogroup CmplxMagSquaredPlanar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex magnitude squared kernel for RV32IM extension.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q16_rv32im(const int16_t *__restrict__ pSrcRe,
+                                             const int16_t *__restrict__ pSrcIm,
+                                             int16_t *__restrict__ pDst,
+                                             uint32_t deciPoint,
+                                             uint32_t numSamples) {
+
+    uint32_t blkCnt;                                      /* Loop counter */
+    int32_t rnd = deciPoint ? 1 << (deciPoint - 1) : 0; /* Rounding offset */
+    int32_t real, imag;
+
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        real = *pSrcRe++;
+        imag = *pSrcIm++;
+
+        *pDst++ = (int16_t)((real * real + imag * imag + rnd) >> deciPoint);
+    }
+}
+
+/**
+  @} end of CmplxMagSquaredPlanar group
+ */
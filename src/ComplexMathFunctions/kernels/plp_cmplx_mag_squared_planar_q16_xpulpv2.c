@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_planar_q16_xpulpv2.c
+ * Description:  q16 planar complex magnitude squared for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxMagSquaredPlanar Planar Complex Magnitude Squared
+  Computes the magnitude squared of the elements of a complex vector, like
+  plp_cmplx_mag_squared, but with the real and imaginary parts stored in separate arrays (planar
+  or split-complex layout).
+  The parameter <code>numSamples</code> represents the number of complex samples processed, each
+  of the arrays has <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[n] = pSrcRe[n]^2 + pSrcIm[n]^2;
+  }
+  </pre>
+  The fixed point version computes the exact sums of squares and rounds them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. The results wrap around on overflow.
+  There are separate functions for floating point and 16-bit fixed point data types.
+ */
+
+/**
+  @addtogroup CmplxMagSquaredPlanar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex magnitude squared kernel for XPULPV2 extension.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Both arrays are read two samples per word. The real and imaginary parts of a sample are paired
+  with a shuffle, such that each output is a single dot product with 32 bit accumulator.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of
+  pSrcRe are computed one by one, pSrcIm and pDst are accessed with aligned words as well if
+  they have the same offset within a word as pSrcRe.
+ */
+
+void plp_cmplx_mag_squared_planar_q16_xpulpv2(const int16_t *__restrict__ pSrcRe,
+                                              const int16_t *__restrict__ pSrcIm,
+                                              int16_t *__restrict__ pDst,
+                                              uint32_t deciPoint,
+                                              uint32_t numSamples) {
+
+    uint32_t blkCnt;                                      /* Loop counter */
+    int32_t rnd = deciPoint ? 1 << (deciPoint - 1) : 0; /* Rounding offset */
+    v2s lo = (v2s){ 0, 2 };
+    v2s hi = (v2s){ 1, 3 };
+    v2s re, im, x0, x1;
+    int32_t real, imag;
+
+    /* Compute the samples before the first word-aligned sample of pSrcRe */
+    blkCnt = plp_align_head(pSrcRe, sizeof(int16_t), numSamples);
+    numSamples -= blkCnt;
+
+    while (blkCnt > 0U) {
+        real = *pSrcRe++;
+        imag = *pSrcIm++;
+
+        *pDst++ = (int16_t)((real * real + imag * imag + rnd) >> deciPoint);
+        blkCnt--;
+    }
+
+    /* Compute 2 samples at a time */
+    for (blkCnt = numSamples >> 1U; blkCnt > 0U; blkCnt--) {
+        re = *((v2s *)pSrcRe);
+        im = *((v2s *)pSrcIm);
+        pSrcRe += 2;
+        pSrcIm += 2;
+
+        x0 = __builtin_shuffle(re, im, lo);
+        x1 = __builtin_shuffle(re, im, hi);
+
+        *((v2s *)pDst) = __PACK2(__SUMDOTP2(x0, x0, rnd) >> deciPoint,
+                                 __SUMDOTP2(x1, x1, rnd) >> deciPoint);
+        pDst += 2;
+    }
+
+    /* Compute the last sample */
+    if (numSamples & 0x1U) {
+        real = *pSrcRe;
+        imag = *pSrcIm;
+
+        *pDst = (int16_t)((real * real + imag * imag + rnd) >> deciPoint);
+    }
+}
+
+/**
+  @} end of CmplxMagSquaredPlanar group
+ */
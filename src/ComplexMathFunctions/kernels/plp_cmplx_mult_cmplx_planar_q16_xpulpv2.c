@@ -0,0 +1,155 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_planar_q16_xpulpv2.c
+ * Description:  q16 planar complex-by-complex multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByCmplxMultPlanar Planar Complex-by-Complex Multiplication
+  Multiplies a complex vector by another complex vector, like plp_cmplx_mult_cmplx, but with the
+  real and imaginary parts stored in separate arrays (planar or split-complex layout), e.g. as
+  computed by two real matrix multiplications. This spares the interleaving pass and lets the
+  kernels load several real or imaginary parts with one word.
+  The parameter <code>numSamples</code> represents the number of complex samples processed, each
+  of the arrays has <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDstRe[n] = pSrcARe[n] * pSrcBRe[n] - pSrcAIm[n] * pSrcBIm[n];
+      pDstIm[n] = pSrcARe[n] * pSrcBIm[n] + pSrcAIm[n] * pSrcBRe[n];
+  }
+  </pre>
+  The fixed point version computes the exact sums of products and rounds them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. The results wrap around on overflow.
+  There are separate functions for floating point and 16-bit fixed point data types.
+ */
+
+/**
+  @addtogroup CmplxByCmplxMultPlanar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex-by-complex multiplication kernel for XPULPV2
+                extension.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Each array is read two samples per word. The real and imaginary parts of a sample are paired
+  with shuffles, such that each output is a single dot product with 32 bit accumulator.
+
+  @par Alignment
+  The vectors may have any alignment. The samples before the first word-aligned sample of
+  pSrcARe are computed one by one, the other vectors are read with aligned words as well if
+  they have the same offset within a word as pSrcARe.
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16_xpulpv2(const int16_t *__restrict__ pSrcARe,
+                                             const int16_t *__restrict__ pSrcAIm,
+                                             const int16_t *__restrict__ pSrcBRe,
+                                             const int16_t *__restrict__ pSrcBIm,
+                                             int16_t *__restrict__ pDstRe,
+                                             int16_t *__restrict__ pDstIm,
+                                             uint32_t deciPoint,
+                                             uint32_t numSamples) {
+
+    uint32_t blkCnt;                                      /* Loop counter */
+    int32_t rnd = deciPoint ? 1 << (deciPoint - 1) : 0; /* Rounding offset */
+    v2s lo = (v2s){ 0, 2 };
+    v2s hi = (v2s){ 1, 3 };
+    v2s ar, ai, br, bi, nbi, x0, x1;
+    int32_t a, b, c, d;
+
+    /* Compute the samples before the first word-aligned sample of pSrcARe */
+    blkCnt = plp_align_head(pSrcARe, sizeof(int16_t), numSamples);
+    numSamples -= blkCnt;
+
+    while (blkCnt > 0U) {
+        a = *pSrcARe++;
+        b = *pSrcAIm++;
+        c = *pSrcBRe++;
+        d = *pSrcBIm++;
+
+        *pDstRe++ = (int16_t)((a * c - b * d + rnd) >> deciPoint);
+        *pDstIm++ = (int16_t)((a * d + b * c + rnd) >> deciPoint);
+        blkCnt--;
+    }
+
+    /* Compute 2 samples at a time */
+    for (blkCnt = numSamples >> 1U; blkCnt > 0U; blkCnt--) {
+        ar = *((v2s *)pSrcARe);
+        ai = *((v2s *)pSrcAIm);
+        br = *((v2s *)pSrcBRe);
+        bi = *((v2s *)pSrcBIm);
+        pSrcARe += 2;
+        pSrcAIm += 2;
+        pSrcBRe += 2;
+        pSrcBIm += 2;
+
+        /* x = (a, b), with ~d = -d - 1 which cannot overflow: re = a * c + b * ~d + b */
+        x0 = __builtin_shuffle(ar, ai, lo);
+        x1 = __builtin_shuffle(ar, ai, hi);
+        nbi = ~bi;
+
+        *((v2s *)pDstRe) =
+            __PACK2(__SUMDOTP2(x0, __builtin_shuffle(br, nbi, lo), rnd + ai[0]) >> deciPoint,
+                    __SUMDOTP2(x1, __builtin_shuffle(br, nbi, hi), rnd + ai[1]) >> deciPoint);
+        /* im = a * d + b * c */
+        *((v2s *)pDstIm) =
+            __PACK2(__SUMDOTP2(x0, __builtin_shuffle(bi, br, lo), rnd) >> deciPoint,
+                    __SUMDOTP2(x1, __builtin_shuffle(bi, br, hi), rnd) >> deciPoint);
+        pDstRe += 2;
+        pDstIm += 2;
+    }
+
+    /* Compute the last sample */
+    if (numSamples & 0x1U) {
+        a = *pSrcARe;
+        b = *pSrcAIm;
+        c = *pSrcBRe;
+        d = *pSrcBIm;
+
+        *pDstRe = (int16_t)((a * c - b * d + rnd) >> deciPoint);
+        *pDstIm = (int16_t)((a * d + b * c + rnd) >> deciPoint);
+    }
+}
+
+/**
+  @} end of CmplxByCmplxMultPlanar group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_conj_f32p_xpulpv2.c
+ * Description:  Parallel f32 complex-by-conjugate multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByConjMult Complex-by-Conjugate Multiplication
+  Multiplies a complex vector by the complex conjugate of another complex vector, as needed for
+  cross-spectra, in a single pass without a temporary conjugated copy.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed. The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] = pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pDst[(2*n)+1] = pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+  }
+  </pre>
+  The fixed point versions compute the exact sums of products and round them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. Like plp_cmplx_mult_cmplx, the results wrap
+  around on overflow.
+  There are separate functions for floating point, and fixed point 32- 16- 8-bit data types.
+ */
+
+/**
+  @addtogroup CmplxByConjMult
+  @{
+ */
+
+/**
+  @brief         Parallel 32-bit floating-point complex-by-conjugate multiplication kernel for
+                 XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_mult_conj_instance_f32 struct initialized by the glue
+                       code
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_f32p_xpulpv2(void *args) {
+
+    plp_cmplx_mult_conj_instance_f32 *S = (plp_cmplx_mult_conj_instance_f32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    /* every core processes a contiguous chunk of the samples */
+    if (start < end) {
+        plp_cmplx_mult_conj_f32_xpulpv2(S->pSrcA + 2 * start, S->pSrcB + 2 * start,
+                                        S->pDst + 2 * start, end - start);
+    }
+}
+
+/**
+  @} end of CmplxByConjMult group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_conj_q16_xpulpv2.c
+ * Description:  q16 complex-by-conjugate multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByConjMult Complex-by-Conjugate Multiplication
+  Multiplies a complex vector by the complex conjugate of another complex vector, as needed for
+  cross-spectra, in a single pass without a temporary conjugated copy.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed. The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] = pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pDst[(2*n)+1] = pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+  }
+  </pre>
+  The fixed point versions compute the exact sums of products and round them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. Like plp_cmplx_mult_cmplx, the results wrap
+  around on overflow.
+  There are separate functions for floating point, and fixed point 32- 16- 8-bit data types.
+ */
+
+/**
+  @addtogroup CmplxByConjMult
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2
+                 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples) {
+
+    uint32_t blkCnt;                                      /* Loop counter */
+    int32_t rnd = deciPoint ? 1 << (deciPoint - 1) : 0; /* Rounding offset */
+    v2s mask = (v2s){ 0, -1 };
+    v2s swap = (v2s){ 1, 0 };
+    v2s x, y;
+    int32_t re, im;
+
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        x = *((v2s *)pSrcA);
+        y = *((v2s *)pSrcB);
+        pSrcA += 2;
+        pSrcB += 2;
+
+        /* re = a * c + b * d */
+        re = __SUMDOTP2(x, y, rnd);
+        /* im = a * ~d + b * c + a = b * c - a * d, with ~d = -d - 1 which cannot overflow */
+        im = __SUMDOTP2(x, __builtin_shuffle(y ^ mask, swap), rnd + x[0]);
+
+        *pDst++ = (int16_t)(re >> deciPoint);
+        *pDst++ = (int16_t)(im >> deciPoint);
+    }
+}
+
+/**
+  @} end of CmplxByConjMult group
+ */
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_conj_q8_xpulpv2.c
+ * Description:  q8 complex-by-conjugate multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByConjMult Complex-by-Conjugate Multiplication
+  Multiplies a complex vector by the complex conjugate of another complex vector, as needed for
+  cross-spectra, in a single pass without a temporary conjugated copy.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed. The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] = pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pDst[(2*n)+1] = pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+  }
+  </pre>
+  The fixed point versions compute the exact sums of products and round them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. Like plp_cmplx_mult_cmplx, the results wrap
+  around on overflow.
+  There are separate functions for floating point, and fixed point 32- 16- 8-bit data types.
+ */
+
+/**
+  @addtogroup CmplxByConjMult
+  @{
+ */
+
+/**
+  @brief         8-bit fixed-point complex-by-conjugate multiplication kernel for XPULPV2 extension.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector, which is conjugated
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q8_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples) {
+
+    uint32_t blkCnt;                                      /* Loop counter */
+    int32_t rnd = deciPoint ? 1 << (deciPoint - 1) : 0; /* Rounding offset */
+    v4s lo = (v4s){ -1, -1, 0, 0 };
+    v4s hi = (v4s){ 0, 0, -1, -1 };
+    v4s mask = (v4s){ 0, -1, 0, -1 };
+    v4s swap = (v4s){ 1, 0, 3, 2 };
+    v4s x, y, z;
+    int32_t a, b, c, d;
+
+    /* two complex samples per word: the masks select the sample of the dot product */
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        x = *((v4s *)pSrcA);
+        y = *((v4s *)pSrcB);
+        pSrcA += 4;
+        pSrcB += 4;
+
+        /* z = (~d0, c0, ~d1, c1), with ~d = -d - 1 which cannot overflow */
+        z = __builtin_shuffle(y ^ mask, swap);
+
+        *pDst++ = (int8_t)(__SUMDOTP4(x, y & lo, rnd) >> deciPoint);
+        *pDst++ = (int8_t)(__SUMDOTP4(x, z & lo, rnd + x[0]) >> deciPoint);
+        *pDst++ = (int8_t)(__SUMDOTP4(x, y & hi, rnd) >> deciPoint);
+        *pDst++ = (int8_t)(__SUMDOTP4(x, z & hi, rnd + x[2]) >> deciPoint);
+    }
+
+    if (numSamples & 1) {
+        a = pSrcA[0];
+        b = pSrcA[1];
+        c = pSrcB[0];
+        d = pSrcB[1];
+
+        *pDst++ = (int8_t)((a * c + b * d + rnd) >> deciPoint);
+        *pDst++ = (int8_t)((b * c - a * d + rnd) >> deciPoint);
+    }
+}
+
+/**
+  @} end of CmplxByConjMult group
+ */
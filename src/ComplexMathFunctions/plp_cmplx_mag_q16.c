@@ -30,26 +30,60 @@
 #include "plp_math.h"
 
 /**
- * @brief      calculates the complex magnitude.
- *
- * @param[in]  pSrc        The source
- * @param[in]  deciPoint   The decimal point. Fromat: Q(16-deciPoint).deciPoint
- * @param      pRes        The result
- * @param[in]  numSamples  The number of samples
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag Complex Magnitude
+  Computes the magnitude of the elements of a complex data vector.
+  The <code>pSrc</code> points to the source data and
+  <code>pRes</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pRes[n] = sqrt(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+  }
+  </pre>
+  The square root is fused into the kernels: the integer and fixed point versions compute the
+  exact sum of squares (32-bit for 16-bit data, 64-bit for 32-bit data), approximate its square
+  root with the inverse square root table and Newton iterations, and correct the result to the
+  nearest integer. Magnitudes which cannot be represented are saturated. The magnitude has the
+  same format as the input, hence the fixed point versions only take the decimal point for
+  consistency.
+  There are separate functions for floating point, integer, and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
  */
 
-void plp_cmplx_mag_q16(const int16_t *pSrc,
+/**
+  @brief         Glue code for complex magnitude of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     deciPoint   decimal point of the input and the output, format Q(16-deciPoint).deciPoint
+  @param[out]    pRes        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_q16(const int16_t *__restrict__ pSrc,
                        const uint32_t deciPoint,
-                       int16_t *pRes,
+                       int16_t *__restrict__ pRes,
                        uint32_t numSamples) {
 
-    // Initial implementation, needs improvement
-    int16_t real, cmplx, sqr;
-    for (int i = 0; i < numSamples; i++) {
-
-        real = (pSrc[2 * i] * pSrc[2 * i]) >> deciPoint;
-        cmplx = (pSrc[2 * i + 1] * pSrc[2 * i + 1]) >> deciPoint;
-        sqr = __CLIP(real + cmplx, 15);
-        plp_sqrt_q16(&sqr, deciPoint, &pRes[i]);
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mag_q16_rv32im(pSrc, deciPoint, pRes, numSamples);
+    } else {
+        plp_cmplx_mag_q16_xpulpv2(pSrc, deciPoint, pRes, numSamples);
     }
-}
\ No newline at end of file
+}
+
+/**
+  @} end of cmplx_mag group
+ */
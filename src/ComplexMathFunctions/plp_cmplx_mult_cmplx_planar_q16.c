@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_planar_q16.c
+ * Description:  Glue code for the q16 planar complex-by-complex multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByCmplxMultPlanar Planar Complex-by-Complex Multiplication
+  Multiplies a complex vector by another complex vector, like plp_cmplx_mult_cmplx, but with the
+  real and imaginary parts stored in separate arrays (planar or split-complex layout), e.g. as
+  computed by two real matrix multiplications. This spares the interleaving pass and lets the
+  kernels load several real or imaginary parts with one word.
+  The parameter <code>numSamples</code> represents the number of complex samples processed, each
+  of the arrays has <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDstRe[n] = pSrcARe[n] * pSrcBRe[n] - pSrcAIm[n] * pSrcBIm[n];
+      pDstIm[n] = pSrcARe[n] * pSrcBIm[n] + pSrcAIm[n] * pSrcBRe[n];
+  }
+  </pre>
+  The fixed point version computes the exact sums of products and rounds them once, i.e. the
+  result is <code>round(sum / 2^deciPoint)</code>. The results wrap around on overflow.
+  There are separate functions for floating point and 16-bit fixed point data types.
+ */
+
+/**
+  @addtogroup CmplxByCmplxMultPlanar
+  @{
+ */
+
+/**
+  @brief         Glue code for the planar complex-by-complex multiplication of 16-bit fixed-point
+                vectors.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16(const int16_t *__restrict__ pSrcARe,
+                                     const int16_t *__restrict__ pSrcAIm,
+                                     const int16_t *__restrict__ pSrcBRe,
+                                     const int16_t *__restrict__ pSrcBIm,
+                                     int16_t *__restrict__ pDstRe,
+                                     int16_t *__restrict__ pDstIm,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mult_cmplx_planar_q16_rv32im(pSrcARe,
+                                               pSrcAIm,
+                                               pSrcBRe,
+                                               pSrcBIm,
+                                               pDstRe,
+                                               pDstIm,
+                                               deciPoint,
+                                               numSamples);
+    } else {
+        plp_cmplx_mult_cmplx_planar_q16_xpulpv2(pSrcARe,
+                                                pSrcAIm,
+                                                pSrcBRe,
+                                                pSrcBIm,
+                                                pDstRe,
+                                                pDstIm,
+                                                deciPoint,
+                                                numSamples);
+    }
+}
+
+/**
+  @} end of CmplxByCmplxMultPlanar group
+ */
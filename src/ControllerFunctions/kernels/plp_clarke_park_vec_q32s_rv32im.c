@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clarke_park_vec_q32s_rv32im.c
+ * Description:  Clarke and Park transform of several axes for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup MotorTransforms
+ */
+
+/**
+ * @addtogroup MotorTransforms
+ * @{
+ */
+
+/**
+ * @brief      Clarke and Park transform of several axes for RV32IM
+ *
+ * @param[in]  pIa      points to the phase currents a
+ * @param[in]  pIb      points to the phase currents b
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pId      points to the direct components
+ * @param[out] pIq      points to the quadrature components
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_clarke_park_vec_q32s_rv32im(const int32_t *__restrict__ pIa,
+                                     const int32_t *__restrict__ pIb,
+                                     const int32_t *__restrict__ pTheta,
+                                     int32_t *__restrict__ pId,
+                                     int32_t *__restrict__ pIq,
+                                     uint32_t numAxes) {
+
+    uint32_t i;
+    int32_t alpha, beta, s, c;
+
+    for (i = 0; i < numAxes; i++) {
+        plp_clarke_q32(pIa[i], pIb[i], &alpha, &beta);
+        plp_sin_cos_q32(pTheta[i], &s, &c);
+        plp_park_q32(alpha, beta, &pId[i], &pIq[i], s, c);
+    }
+}
+
+/**
+ * @} end of MotorTransforms group
+ */
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_vec_q32s_rv32im.c
+ * Description:  One step of several PID controllers for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup PID
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief      One step of several 32-bit fixed point PID controllers for RV32IM
+ *
+ * @param[in,out] S        points to an array of numAxes PID instances
+ * @param[in]     pIn      points to the errors, one per controller
+ * @param[out]    pOut     points to the outputs, one per controller
+ * @param[in]     numAxes  number of controllers
+ *
+ * @return     none
+ */
+
+void plp_pid_vec_q32s_rv32im(plp_pid_instance_q32 *__restrict__ S,
+                             const int32_t *__restrict__ pIn,
+                             int32_t *__restrict__ pOut,
+                             uint32_t numAxes) {
+
+    uint32_t i;
+
+    for (i = 0; i < numAxes; i++) {
+        pOut[i] = plp_pid_q32(&S[i], pIn[i]);
+    }
+}
+
+/**
+ * @} end of PID group
+ */
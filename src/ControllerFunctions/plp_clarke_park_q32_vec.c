@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clarke_park_q32_vec.c
+ * Description:  Glue code for Clarke and Park transform of several axes
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup MotorTransforms Clarke and Park Transforms
+ * The Clarke transform maps the phase currents a and b of a balanced three-phase system to the
+ * stationary alpha-beta frame, and the Park transform rotates them into the d-q frame of the
+ * rotor angle. A single axis is transformed by the static inline functions plp_clarke_q32,
+ * plp_park_q32 and their inverses, which share the sine and cosine of plp_sin_cos_q32, and
+ * several axes by plp_clarke_park_q32_vec and plp_park_clarke_inv_q32_vec.
+ */
+
+/**
+ * @addtogroup MotorTransforms
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the Clarke and Park transform of several axes
+ *
+ * @param[in]  pIa      points to the phase currents a
+ * @param[in]  pIb      points to the phase currents b
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pId      points to the direct components
+ * @param[out] pIq      points to the quadrature components
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_clarke_park_q32_vec(const int32_t *__restrict__ pIa,
+                             const int32_t *__restrict__ pIb,
+                             const int32_t *__restrict__ pTheta,
+                             int32_t *__restrict__ pId,
+                             int32_t *__restrict__ pIq,
+                             uint32_t numAxes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_clarke_park_vec_q32s_rv32im(pIa, pIb, pTheta, pId, pIq, numAxes);
+    } else {
+        plp_clarke_park_vec_q32s_xpulpv2(pIa, pIb, pTheta, pId, pIq, numAxes);
+    }
+}
+
+/**
+ * @} end of MotorTransforms group
+ */
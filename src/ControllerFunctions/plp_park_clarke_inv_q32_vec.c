@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_park_clarke_inv_q32_vec.c
+ * Description:  Glue code for inverse Park and Clarke transform of several axes
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup MotorTransforms
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the inverse Park and Clarke transform of several axes
+ *
+ * @param[in]  pId      points to the direct components
+ * @param[in]  pIq      points to the quadrature components
+ * @param[in]  pTheta   points to the angles, [-1, 1) is mapped to [-pi, pi)
+ * @param[out] pIa      points to the phase values a
+ * @param[out] pIb      points to the phase values b
+ * @param[in]  numAxes  number of axes
+ *
+ * @return     none
+ */
+
+void plp_park_clarke_inv_q32_vec(const int32_t *__restrict__ pId,
+                                 const int32_t *__restrict__ pIq,
+                                 const int32_t *__restrict__ pTheta,
+                                 int32_t *__restrict__ pIa,
+                                 int32_t *__restrict__ pIb,
+                                 uint32_t numAxes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_park_clarke_inv_vec_q32s_rv32im(pId, pIq, pTheta, pIa, pIb, numAxes);
+    } else {
+        plp_park_clarke_inv_vec_q32s_xpulpv2(pId, pIq, pTheta, pIa, pIb, numAxes);
+    }
+}
+
+/**
+ * @} end of MotorTransforms group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_init_q32.c
+ * Description:  Initialization of the 32-bit fixed point PID controller
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup PID PID Controller
+ * The PID controller is implemented in the incremental form
+ *
+ * y[n] = y[n-1] + A0 * e[n] + A1 * e[n-1] + A2 * e[n-2]
+ *
+ * with A0 = Kp + Ki + Kd, A1 = -(Kp + 2 Kd) and A2 = Kd, where Ki includes the sampling period.
+ * A step is computed by the static inline function plp_pid_q32, and a step of several
+ * controllers by plp_pid_q32_vec.
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief      Initialization of the 32-bit fixed point PID controller.
+ *
+ * @param[out] S       points to an instance of the PID controller
+ * @param[in]  Kp      proportional gain in Q1.31
+ * @param[in]  Ki      integral gain in Q1.31
+ * @param[in]  Kd      derivative gain in Q1.31
+ * @param[in]  outMin  lower limit of the output
+ * @param[in]  outMax  upper limit of the output
+ *
+ * @return     none
+ *
+ * The coefficients A0 and A1 are saturated, the gains must therefore fulfill Kp + Ki + Kd < 1 and
+ * Kp + 2 Kd <= 1. The state is cleared.
+ */
+
+void plp_pid_init_q32(plp_pid_instance_q32 *S,
+                      int32_t Kp,
+                      int32_t Ki,
+                      int32_t Kd,
+                      int32_t outMin,
+                      int32_t outMax) {
+
+    S->A0 = plp_sat_q32_inline((int64_t)Kp + Ki + Kd);
+    S->A1 = plp_sat_q32_inline(-((int64_t)Kp + 2 * (int64_t)Kd));
+    S->A2 = Kd;
+    S->outMin = outMin;
+    S->outMax = outMax;
+
+    plp_pid_reset_q32(S);
+}
+
+/**
+ * @brief      Clears the state of the 32-bit fixed point PID controller.
+ *
+ * @param[in,out] S  points to an instance of the PID controller
+ *
+ * @return     none
+ */
+
+void plp_pid_reset_q32(plp_pid_instance_q32 *S) {
+
+    S->state[0] = 0;
+    S->state[1] = 0;
+    S->state[2] = 0;
+}
+
+/**
+ * @} end of PID group
+ */
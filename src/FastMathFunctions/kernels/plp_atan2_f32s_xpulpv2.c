@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_f32s_xpulpv2.c
+ * Description:  f32 four quadrant arctangent for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      f32 four quadrant arctangent for XPULPV2
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), angle in radians, in range [-PI, PI]
+ *
+ * The ratio of the smaller and the larger magnitude is computed with a Newton refined reciprocal
+ * (no division is needed), and its arctangent with a polynomial. atan2(0, 0) is 0.
+ */
+
+float32_t plp_atan2_f32s_xpulpv2(float32_t y,
+                                 float32_t x) {
+
+    float32_t ax, ay, num, t, t2;
+    union {
+        float32_t f;
+        int32_t i;
+    } den, r;
+    float32_t res;
+
+    ax = (x < 0.0f) ? -x : x;
+    ay = (y < 0.0f) ? -y : y;
+    if (ax == 0.0f && ay == 0.0f) {
+        res = 0.0f;
+    } else {
+        /* t = min / max in [0, 1], with the reciprocal refined by Newton iterations */
+        if (ay > ax) {
+            num = ax;
+            den.f = ay;
+        } else {
+            num = ay;
+            den.f = ax;
+        }
+        r.i = 0x7EF311C7 - den.i;
+        r.f = r.f * (2.0f - den.f * r.f);
+        r.f = r.f * (2.0f - den.f * r.f);
+        r.f = r.f * (2.0f - den.f * r.f);
+        t = num * r.f;
+
+        /* atan(t) on [0, 1] (Abramowitz and Stegun 4.4.49, error below 2e-8) */
+        t2 = t * t;
+        res = 0.0028662257f;
+        res = res * t2 - 0.0161657367f;
+        res = res * t2 + 0.0429096138f;
+        res = res * t2 - 0.0752896400f;
+        res = res * t2 + 0.1065626393f;
+        res = res * t2 - 0.1420889944f;
+        res = res * t2 + 0.1999355085f;
+        res = res * t2 - 0.3333314528f;
+        res = (res * t2 + 1.0f) * t;
+
+        /* map back to the octant and the quadrant of (x, y) */
+        if (ay > ax) {
+            res = 1.570796327f - res;
+        }
+        if (x < 0.0f) {
+            res = 3.141592654f - res;
+        }
+        if (y < 0.0f) {
+            res = -res;
+        }
+    }
+
+    return res;
+}
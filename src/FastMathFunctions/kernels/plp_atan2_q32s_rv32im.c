@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_q32s_rv32im.c
+ * Description:  q32 four quadrant arctangent for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 four quadrant arctangent for RV32IM
+ *
+ * @param[in]  y     imaginary part, or ordinate, of the input
+ * @param[in]  x     real part, or abscissa, of the input
+ *
+ * @return     atan2(y, x), Q1.31 angle in range [-0.5, +0.5], mapped to [-PI, PI] as for the input of plp_sin_q32
+ *
+ * The angle is computed with CORDIC vectoring, which only needs shifts and additions, using the
+ * rotation angles in atanTable_q32. atan2(0, 0) is 0.
+ */
+
+int32_t plp_atan2_q32s_rv32im(int32_t y,
+                              int32_t x) {
+
+    uint32_t ux, uy;
+    int32_t shift, xr, yr, tmp, angle;
+    uint32_t i;
+    int32_t res;
+
+    /* normalize the magnitudes to keep two bits of headroom for the CORDIC gain */
+    ux = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uy = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    if ((ux | uy) == 0) {
+        res = 0;
+    } else {
+        shift = __builtin_clz(ux | uy) - 3;
+        if (shift >= 0) {
+            ux <<= shift;
+            uy <<= shift;
+        } else {
+            ux >>= -shift;
+            uy >>= -shift;
+        }
+
+        /* rotate into the right half plane, the angle is in Q1.31 where 2^31 is a full turn */
+        xr = ux;
+        yr = ((x < 0) != (y < 0)) ? -(int32_t)uy : (int32_t)uy;
+        angle = (x >= 0) ? 0 : (y < 0) ? -0x40000000 : 0x40000000;
+
+        /* CORDIC vectoring: rotate (xr, yr) onto the x axis and sum up the rotation angles */
+        for (i = 0; i < FAST_MATH_ATAN_TABLE_SIZE; i++) {
+            if (yr > 0) {
+                tmp = xr + (yr >> i);
+                yr = yr - (xr >> i);
+                xr = tmp;
+                angle += atanTable_q32[i];
+            } else {
+                tmp = xr - (yr >> i);
+                yr = yr + (xr >> i);
+                xr = tmp;
+                angle -= atanTable_q32[i];
+            }
+        }
+        res = angle;
+    }
+
+    return res;
+}
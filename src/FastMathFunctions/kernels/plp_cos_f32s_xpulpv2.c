@@ -80,8 +80,8 @@ float32_t plp_cos_f32s_xpulpv2(float32_t x) {
     fract = findex - (float32_t)index;
 
     /* Read two nearest values of input value from the cos table */
-    a = sinTable_f32[index];
-    b = sinTable_f32[index + 1];
+    a = PLP_SIN_TABLE_F32(index);
+    b = PLP_SIN_TABLE_F32(index + 1);
 
     /* Linear interpolation process */
     cosVal = (1.0f - fract) * a + fract * b;
@@ -63,8 +63,8 @@ int16_t plp_cos_q16s_rv32im(int16_t x) {
     fract = (x - (index << FAST_MATH_Q16_SHIFT)) << 9;
 
     /* Read two nearest values of input value from the sin table */
-    a = sinTable_q16[index];
-    b = sinTable_q16[index + 1];
+    a = PLP_SIN_TABLE_Q16(index);
+    b = PLP_SIN_TABLE_Q16(index + 1);
 
     /* Linear interpolation process */
     cosVal = (int32_t)(0x8000 - fract) * a >> 16;
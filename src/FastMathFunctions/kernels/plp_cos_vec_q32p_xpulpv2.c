@@ -0,0 +1,56 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q32p_xpulpv2.c
+ * Description:  Calculates the cosine of a q32 vector in parallel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Parallel q32 cosine kernel for XPULPV2
+ *
+ * @param[in]  args  points to the plp_sincos_instance_q32 struct initialized by the glue code
+ *
+ * @return     none
+ *
+ * Every core processes a contiguous chunk of the vectors.
+ */
+
+void plp_cos_vec_q32p_xpulpv2(void *args) {
+
+    plp_sincos_instance_q32 *S = (plp_sincos_instance_q32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > S->blockSize) {
+        end = S->blockSize;
+    }
+
+    if (start < end) {
+        plp_cos_vec_q32s_xpulpv2(S->pSrc + start, S->pCos + start, end - start);
+    }
+}
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q32s_rv32im.c
+ * Description:  Calculates the cosine of a q32 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.31 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x;     /* input mapped to [0, 0x7FFFFFFF] */
+    int32_t index; /* index in the sine table */
+    int32_t fract; /* interpolation weight */
+    int32_t a, b;  /* two nearest table values */
+    int32_t val;
+
+    for (i = 0; i < blockSize; i++) {
+        x = ((uint32_t)pSrc[i] + 0x20000000) & 0x7FFFFFFF;
+        index = (uint32_t)x >> FAST_MATH_Q32_SHIFT;
+        fract = (x - (index << FAST_MATH_Q32_SHIFT)) << 9;
+
+        a = PLP_SIN_TABLE_Q32(index);
+        b = PLP_SIN_TABLE_Q32(index + 1);
+        val = (int64_t)(0x80000000 - fract) * a >> 32;
+        val = (int32_t)((((int64_t)val << 32) + ((int64_t)fract * b)) >> 32);
+        pDst[i] = val << 1;
+    }
+}
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_div_q16s_xpulpv2.c
+ * Description:  q16 division on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+ * @brief      q16 division on vectors for XPULPV2
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcB,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pDst,
+                          uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, z, shift;
+    uint32_t a, b, lz, y, q, num, prod;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrcA[i];
+        z = pSrcB[i];
+        if (z == 0) {
+            pDst[i] = (x > 0) ? INT16_MAX : ((x < 0) ? INT16_MIN : 0);
+            continue;
+        }
+
+        /* |z| = m * 2^(32 - lz) with the mantissa m in [0.5, 1), y = 1 / m in Q2.30 */
+        a = (x < 0) ? -x : x;
+        b = (z < 0) ? -z : z;
+        lz = __builtin_clz(b);
+        y = plp_recip_norm_inline(b << lz, 2);
+
+        /* |x| * 2^fracBits / |z| = |x| * y * 2^-shift, rounded, where shift is at least 16 */
+        shift = 62 - (int32_t)lz - (int32_t)fracBits;
+        q = (uint32_t)(((uint64_t)a * y + (1ULL << (shift - 1))) >> shift);
+
+        /* correct q to (|x| * 2^(fracBits + 1) + |z|) / (2 * |z|), unless it saturates anyway */
+        if (q <= 0x8000) {
+            num = (a << (fracBits + 1)) + b;
+            prod = 2 * b * q;
+            while (prod > num) {
+                q--;
+                prod -= 2 * b;
+            }
+            while (num - prod >= 2 * b) {
+                q++;
+                prod += 2 * b;
+            }
+        }
+
+        if ((x ^ z) < 0) {
+            pDst[i] = (q > 0x8000) ? INT16_MIN : -(int32_t)q;
+        } else {
+            pDst[i] = (q > 0x7FFF) ? INT16_MAX : q;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_div_q32s_rv32im.c
+ * Description:  q32 division on vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+ * @brief      q32 division on vectors for RV32IM
+ *
+ * @param[in]  pSrcA      points to the dividends
+ * @param[in]  pSrcB      points to the divisors
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = pSrcA[n] / pSrcB[n], rounded to nearest with ties away from zero and saturated. A
+ * division by 0 results in the largest value with the sign of the dividend, or 0 for 0 / 0.
+ *
+ * The magnitude of the divisor is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is the product of the dividend and the reciprocal,
+ * corrected with its remainder, such that the results are identical to the ones of a rounded
+ * integer division, but no division is needed.
+ */
+
+void plp_div_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                         const int32_t *__restrict__ pSrcB,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pDst,
+                         uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, z, shift;
+    uint32_t a, b, lz, y;
+    uint64_t p, q, num, prod, d;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrcA[i];
+        z = pSrcB[i];
+        if (z == 0) {
+            pDst[i] = (x > 0) ? INT32_MAX : ((x < 0) ? INT32_MIN : 0);
+            continue;
+        }
+
+        /* |z| = m * 2^(32 - lz) with the mantissa m in [0.5, 1), y = 1 / m in Q2.30 */
+        a = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+        b = (z < 0) ? -(uint32_t)z : (uint32_t)z;
+        lz = __builtin_clz(b);
+        y = plp_recip_norm_inline(b << lz, 3);
+
+        /* |x| * 2^fracBits / |z| = |x| * y * 2^-shift, rounded, where shift is not negative */
+        shift = 62 - (int32_t)lz - (int32_t)fracBits;
+        p = (uint64_t)a * y;
+        q = (shift > 0) ? (p + (1ULL << (shift - 1))) >> shift : p;
+
+        /* correct q to (|x| * 2^(fracBits + 1) + |z|) / (2 * |z|), unless it saturates anyway */
+        if (q <= 0x80000000ULL) {
+            num = ((uint64_t)a << (fracBits + 1)) + b;
+            d = 2 * (uint64_t)b;
+            prod = d * q;
+            while (prod > num) {
+                q--;
+                prod -= d;
+            }
+            while (num - prod >= d) {
+                q++;
+                prod += d;
+            }
+        }
+
+        if ((x ^ z) < 0) {
+            pDst[i] = (q > 0x80000000ULL) ? INT32_MIN : (int32_t)-(int64_t)q;
+        } else {
+            pDst[i] = (q > 0x7FFFFFFFULL) ? INT32_MAX : (int32_t)q;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_q16s_xpulpv2.c
+ * Description:  q16 exponential function for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 exponential function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input and of the output
+ *
+ * @return     exp(x)
+ *
+ * exp(x) is computed as 2^(x * log2(e)), with the fractional power of two interpolated in
+ * expTable and the integer one applied as a shift.
+ * The result is in the format of the input, and saturated if it cannot be represented.
+ */
+
+int16_t plp_exp_q16s_xpulpv2(int16_t x,
+                             uint32_t fracBits) {
+
+    int32_t t, n, shift;
+    uint32_t fr, index;
+    int32_t fract, a, b, val;
+    int16_t y;
+
+    /* exp(x) = 2^(x * log2(e)), with log2(e) in Q1.14 */
+    t = (int32_t)x * 23637;
+    shift = fracBits + 14;
+    n = t >> shift;
+    fr = (uint32_t)(t & ((1 << shift) - 1)) << (31 - shift);
+
+    /* 2^fr by linear interpolation in the table, in Q2.14 */
+    index = fr >> 24;
+    fract = (fr >> 9) & 0x7FFF;
+    a = expTable_q16[index];
+    b = expTable_q16[index + 1];
+    val = a + (((b - a) * fract) >> 15);
+
+    /* scale by 2^n, converted to the output format */
+    shift = n + (int32_t)fracBits - 14;
+    if (shift > 0) {
+        y = 0x7FFF;
+    } else if (shift == 0) {
+        y = __MIN(val, 0x7FFF);
+    } else if (shift >= -16) {
+        y = (val + (1 << (-shift - 1))) >> (-shift);
+    } else {
+        y = 0;
+    }
+
+    return y;
+}
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_f32s_xpulpv2.c
+ * Description:  f32 exponential function on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 exponential function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t i;
+    float32_t x, y;
+    float32_t in, findex, fract, a, b;
+    int32_t n;
+    uint32_t index;
+    union {
+        float32_t f;
+        int32_t i;
+    } scale;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        /* exp(x) = 2^(x * log2(e)) */
+        in = x * 1.442695041f;
+        if (in >= 128.0f) {
+            scale.i = 0x7F800000; /* +inf */
+            y = scale.f;
+        } else if (in < -126.0f) {
+            y = 0.0f;
+        } else {
+            /* in = n + fr, with n rounded towards -infinity */
+            n = (int32_t)in;
+            if (in < (float32_t)n) {
+                n--;
+            }
+
+            /* 2^fr by linear interpolation in the table */
+            findex = (float32_t)FAST_MATH_EXP_TABLE_SIZE * (in - (float32_t)n);
+            index = (uint32_t)findex;
+            if (index >= FAST_MATH_EXP_TABLE_SIZE) {
+                index = FAST_MATH_EXP_TABLE_SIZE - 1;
+            }
+            fract = findex - (float32_t)index;
+            a = expTable_f32[index];
+            b = expTable_f32[index + 1];
+
+            /* scale by 2^n through the exponent bits */
+            scale.i = (n + 127) << 23;
+            y = (a + (b - a) * fract) * scale.f;
+        }
+        pDst[i] = y;
+    }
+}
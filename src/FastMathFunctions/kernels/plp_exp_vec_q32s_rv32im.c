@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_q32s_rv32im.c
+ * Description:  q32 exponential function on vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 exponential function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t fracBits,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, y;
+    int64_t t, n;
+    int32_t shift;
+    uint32_t fr, index, fract, a, b, val;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        /* exp(x) = 2^(x * log2(e)), with log2(e) in Q2.30 */
+        t = (int64_t)x * 1549082005;
+        shift = fracBits + 30;
+        n = t >> shift;
+        t &= ((int64_t)1 << shift) - 1;
+        fr = (shift >= 32) ? (uint32_t)(t >> (shift - 32)) : (uint32_t)t << (32 - shift);
+
+        /* 2^fr by linear interpolation in the table, in Q2.30 */
+        index = fr >> 25;
+        fract = (fr >> 1) & 0xFFFFFF;
+        a = expTable_q32[index];
+        b = expTable_q32[index + 1];
+        val = a + (uint32_t)(((uint64_t)(b - a) * fract) >> 24);
+
+        /* scale by 2^n, converted to the output format */
+        n += (int32_t)fracBits - 30;
+        if (n > 0) {
+            y = 0x7FFFFFFF;
+        } else if (n == 0) {
+            y = (val > 0x7FFFFFFF) ? 0x7FFFFFFF : val;
+        } else if (n >= -31) {
+            y = (val + (1U << (-n - 1))) >> (-n);
+        } else {
+            y = 0;
+        }
+        pDst[i] = y;
+    }
+}
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log2_vec_f32s_xpulpv2.c
+ * Description:  f32 base 2 logarithm on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 base 2 logarithm on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * log2(x) is computed as e + log2(m), with x = m * 2^e read from the exponent and mantissa bits
+ * and log2(m) interpolated in logTable. Non-positive inputs result in -inf.
+ */
+
+void plp_log2_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize) {
+
+    uint32_t i;
+    float32_t x, y;
+    float32_t fract, a, b;
+    int32_t e;
+    uint32_t index;
+    union {
+        float32_t f;
+        int32_t i;
+    } scale;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        if (x <= 0.0f) {
+            scale.i = 0xFF800000; /* -inf */
+            y = scale.f;
+        } else {
+            /* x = m * 2^e, read from the exponent and mantissa bits */
+            scale.f = x;
+            e = (int32_t)(scale.i >> 23) - 127;
+
+            /* log2(m) by linear interpolation in the table */
+            index = (scale.i & 0x7FFFFF) >> 16;
+            fract = (float32_t)(scale.i & 0xFFFF) * 1.52587890625e-5f;
+            a = logTable_f32[index];
+            b = logTable_f32[index + 1];
+
+            /* log2(x) = e + log2(m) */
+            y = (float32_t)e + a + (b - a) * fract;
+        }
+        pDst[i] = y;
+    }
+}
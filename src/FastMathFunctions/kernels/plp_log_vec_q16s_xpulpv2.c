@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_vec_q16s_xpulpv2.c
+ * Description:  q16 natural logarithm function on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 natural logarithm function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input and of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_log_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t i;
+    int16_t x, y;
+    int32_t t, e, shift;
+    uint32_t fr, index;
+    int32_t fract, a, b, val;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        if (x <= 0) {
+            y = INT16_MIN;
+        } else {
+            /* x = m * 2^e, with the mantissa m in [1, 2) as Q1.15 */
+            shift = __builtin_clz(x);
+            fr = ((uint32_t)x << (shift - 16)) - 0x8000;
+            e = 31 - shift - (int32_t)fracBits;
+
+            /* log2(m) by linear interpolation in the table, in Q1.15 */
+            index = fr >> 8;
+            fract = fr & 0xFF;
+            a = logTable_q16[index];
+            b = logTable_q16[index + 1];
+            val = a + (((b - a) * fract) >> 8);
+
+            /* ln(x) = (e + log2(m)) * ln(2), with ln(2) in Q0.15 */
+            t = e * 22713 + ((val * 22713 + 0x4000) >> 15);
+            if (fracBits < 15) {
+                t = (t + (1 << (14 - fracBits))) >> (15 - fracBits);
+            }
+            y = __CLIP(t, 15);
+        }
+        pDst[i] = y;
+    }
+}
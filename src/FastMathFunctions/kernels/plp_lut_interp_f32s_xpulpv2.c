@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_f32s_xpulpv2.c
+ * Description:  f32 piecewise-linear table interpolation for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      f32 piecewise-linear table interpolation for XPULPV2
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries.
+ */
+
+float32_t plp_lut_interp_f32s_xpulpv2(const plp_lut_interp_instance_f32 *S,
+                                      float32_t x) {
+
+    const float32_t *pTable = S->pTable;
+    uint32_t last = S->numPoints - 1;
+    float32_t pos = (x - S->xMin) * S->invStep; /* position in the table */
+    uint32_t index;
+    float32_t a, b;
+
+    if (pos <= 0.0f) {
+        return pTable[0];
+    }
+    if (pos >= (float32_t)last) {
+        return pTable[last];
+    }
+
+    /* Linear interpolation between the two nearest entries */
+    index = (uint32_t)pos;
+    a = pTable[index];
+    b = pTable[index + 1];
+    return a + (pos - (float32_t)index) * (b - a);
+}
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_q16s_rv32im.c
+ * Description:  q16 piecewise-linear table interpolation for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      q16 piecewise-linear table interpolation for RV32IM
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int16_t plp_lut_interp_q16s_rv32im(const plp_lut_interp_instance_q16 *S,
+                                   int16_t x) {
+
+    const int16_t *pTable = S->pTable;
+    uint32_t shift = S->shift;
+    uint32_t last = S->numPoints - 1;
+    int32_t d = (int32_t)x - S->xMin; /* distance to the first entry */
+    uint32_t index;
+    int32_t fract, a, b;
+
+    if (d <= 0) {
+        return pTable[0];
+    }
+
+    index = (uint32_t)d >> shift;
+    if (index >= last) {
+        return pTable[last];
+    }
+    fract = d - (index << shift);
+
+    /* Linear interpolation: weights 2^shift - fract and fract of the two nearest entries */
+    a = pTable[index];
+    b = pTable[index + 1];
+    return (a * ((1 << shift) - fract) + b * fract + ((1 << shift) >> 1)) >> shift;
+}
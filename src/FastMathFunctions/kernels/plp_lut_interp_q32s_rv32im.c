@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_q32s_rv32im.c
+ * Description:  q32 piecewise-linear table interpolation for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      q32 piecewise-linear table interpolation for RV32IM
+ *
+ * @param[in]  S     points to an initialized instance of the table
+ * @param[in]  x     input value
+ *
+ * @return     interpolated value of the table at x
+ *
+ * The input is clamped to the domain of the table, and the output is interpolated between the
+ * two nearest entries and rounded to nearest.
+ */
+
+int32_t plp_lut_interp_q32s_rv32im(const plp_lut_interp_instance_q32 *S,
+                                   int32_t x) {
+
+    const int32_t *pTable = S->pTable;
+    uint32_t shift = S->shift;
+    uint32_t last = S->numPoints - 1;
+    uint32_t d; /* distance to the first entry */
+    uint32_t index;
+    int64_t a, b;
+
+    if (x <= S->xMin) {
+        return pTable[0];
+    }
+
+    d = (uint32_t)x - (uint32_t)S->xMin;
+    index = d >> shift;
+    if (index >= last) {
+        return pTable[last];
+    }
+
+    /* Linear interpolation between the two nearest entries, the difference may need 33 bits */
+    a = pTable[index];
+    b = pTable[index + 1];
+    return (int32_t)(a + (((b - a) * (d & ((1U << shift) - 1)) + ((1LL << shift) >> 1)) >> shift));
+}
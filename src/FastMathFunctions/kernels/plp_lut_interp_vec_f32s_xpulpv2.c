@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_vec_f32s_xpulpv2.c
+ * Description:  f32 table interpolation on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      f32 piecewise-linear table interpolation on vectors for XPULPV2
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_f32s_xpulpv2(const plp_lut_interp_instance_f32 *S,
+                                     const float32_t *__restrict__ pSrc,
+                                     float32_t *__restrict__ pDst,
+                                     uint32_t blockSize) {
+
+    const float32_t *pTable = S->pTable;
+    float32_t xMin = S->xMin;
+    float32_t invStep = S->invStep;
+    float32_t posMax = (float32_t)(S->numPoints - 1);
+    uint32_t i;
+    uint32_t index;
+    float32_t pos, a, b;
+
+    for (i = 0; i < blockSize; i++) {
+        /* position in the table, clamped to the domain of the table */
+        pos = (pSrc[i] - xMin) * invStep;
+        pos = (pos > 0.0f) ? pos : 0.0f;
+
+        if (pos >= posMax) {
+            pDst[i] = pTable[S->numPoints - 1];
+        } else {
+            index = (uint32_t)pos;
+            a = pTable[index];
+            b = pTable[index + 1];
+            pDst[i] = a + (pos - (float32_t)index) * (b - a);
+        }
+    }
+}
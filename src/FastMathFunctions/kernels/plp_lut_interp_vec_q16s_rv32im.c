@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_vec_q16s_rv32im.c
+ * Description:  q16 table interpolation on vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      q16 piecewise-linear table interpolation on vectors for RV32IM
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_q16s_rv32im(const plp_lut_interp_instance_q16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t blockSize) {
+
+    const int16_t *pTable = S->pTable;
+    uint32_t shift = S->shift;
+    uint32_t last = S->numPoints - 1;
+    int32_t xMin = S->xMin;
+    uint32_t i;
+    int32_t d, fract, a, b;
+    uint32_t index;
+
+    for (i = 0; i < blockSize; i++) {
+        d = (int32_t)pSrc[i] - xMin;
+
+        if (d <= 0) {
+            pDst[i] = pTable[0];
+            continue;
+        }
+
+        index = (uint32_t)d >> shift;
+        if (index >= last) {
+            pDst[i] = pTable[last];
+            continue;
+        }
+        fract = d - (index << shift);
+
+        a = pTable[index];
+        b = pTable[index + 1];
+        pDst[i] = (a * ((1 << shift) - fract) + b * fract + ((1 << shift) >> 1)) >> shift;
+    }
+}
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_vec_q16s_xpulpv2.c
+ * Description:  q16 table interpolation on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      q16 piecewise-linear table interpolation on vectors for XPULPV2
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The samples are loaded two per 32-bit word, and both of them are clamped to the domain of
+ * the table and turned into distances to its first entry with one pv.max.h, pv.min.h and
+ * pv.sub.h. Samples before the first word-aligned one of pSrc are interpolated one by one.
+ */
+
+void plp_lut_interp_vec_q16s_xpulpv2(const plp_lut_interp_instance_q16 *S,
+                                     const int16_t *__restrict__ pSrc,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t blockSize) {
+
+    const int16_t *pTable = S->pTable;
+    uint32_t shift = S->shift;
+    uint32_t last = S->numPoints - 1;
+    int32_t one = 1 << shift;
+    int32_t xMin = S->xMin;
+    int32_t xMax = __MIN(xMin + (int32_t)(last << shift), 0x7FFF);
+    v2s lo = (v2s){ xMin, xMin };
+    v2s hi = (v2s){ xMax, xMax };
+    uint32_t blkCnt; /* Loop counter */
+    uint32_t index;
+    int32_t d, fract, a, b;
+    v2s dd;
+
+    /* Interpolate the samples before the first word-aligned sample of pSrc */
+    blkCnt = plp_align_head(pSrc, sizeof(int16_t), blockSize);
+    blockSize -= blkCnt;
+
+    while (blkCnt > 0U) {
+        *pDst++ = plp_lut_interp_q16s_xpulpv2(S, *pSrc++);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* distances of two samples to the first entry, clamped to the domain of the table */
+        dd = __SUB2(__MIN2(__MAX2(*(const v2s *)pSrc, lo), hi), lo);
+        pSrc += 2;
+
+        d = (uint16_t)dd[0];
+        index = __MIN((uint32_t)d >> shift, last - 1);
+        fract = d - (index << shift);
+        a = pTable[index];
+        b = pTable[index + 1];
+        pDst[0] = (a * (one - fract) + b * fract + (one >> 1)) >> shift;
+
+        d = (uint16_t)dd[1];
+        index = __MIN((uint32_t)d >> shift, last - 1);
+        fract = d - (index << shift);
+        a = pTable[index];
+        b = pTable[index + 1];
+        pDst[1] = (a * (one - fract) + b * fract + (one >> 1)) >> shift;
+        pDst += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Interpolate the remaining sample */
+    if (blockSize & 0x1U) {
+        *pDst = plp_lut_interp_q16s_xpulpv2(S, *pSrc);
+    }
+}
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_vec_q32s_xpulpv2.c
+ * Description:  q32 table interpolation on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      q32 piecewise-linear table interpolation on vectors for XPULPV2
+ *
+ * @param[in]  S          points to an initialized instance of the table
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_lut_interp_vec_q32s_xpulpv2(const plp_lut_interp_instance_q32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     int32_t *__restrict__ pDst,
+                                     uint32_t blockSize) {
+
+    const int32_t *pTable = S->pTable;
+    uint32_t shift = S->shift;
+    uint32_t last = S->numPoints - 1;
+    uint32_t mask = (1U << shift) - 1;
+    int64_t half = (1LL << shift) >> 1;
+    int32_t xMin = S->xMin;
+    uint32_t i;
+    uint32_t d, index;
+    int64_t a, b;
+    int32_t x;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        /* distance to the first entry, clamped to the domain of the table */
+        d = (x <= xMin) ? 0U : (uint32_t)x - (uint32_t)xMin;
+        index = d >> shift;
+
+        if (index >= last) {
+            pDst[i] = pTable[last];
+        } else {
+            a = pTable[index];
+            b = pTable[index + 1];
+            pDst[i] = (int32_t)(a + (((b - a) * (d & mask) + half) >> shift));
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pow2_vec_q16s_xpulpv2.c
+ * Description:  q16 power of two on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 power of two on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the output
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is in Q6.10, like the output of plp_log2_q16_vec. 2^x is computed as 2^n * 2^fr,
+ * with the fractional power of two interpolated in expTable and the integer one applied as a
+ * shift. The output is in Q(16-fracBits).fracBits, and saturated if it cannot be represented.
+ */
+
+void plp_pow2_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize) {
+
+    uint32_t i;
+    int16_t x, y;
+    int32_t n, shift;
+    uint32_t fr, index;
+    int32_t fract, a, b, val;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        /* x = n + fr, with n rounded towards -infinity and fr in Q0.10 */
+        n = x >> 10;
+        fr = x & 0x3FF;
+
+        /* 2^fr by linear interpolation in the table, in Q2.14 */
+        index = fr >> 3;
+        fract = fr & 0x7;
+        a = expTable_q16[index];
+        b = expTable_q16[index + 1];
+        val = a + (((b - a) * fract) >> 3);
+
+        /* scale by 2^n, converted to the output format */
+        shift = n + (int32_t)fracBits - 14;
+        if (shift > 0) {
+            y = 0x7FFF;
+        } else if (shift == 0) {
+            y = __MIN(val, 0x7FFF);
+        } else if (shift >= -16) {
+            y = (val + (1 << (-shift - 1))) >> (-shift);
+        } else {
+            y = 0;
+        }
+        pDst[i] = y;
+    }
+}
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_recip_q16s_rv32im.c
+ * Description:  q16 reciprocal on vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+ * @brief      q16 reciprocal on vectors for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 15
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with two Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t fracBits,
+                           int16_t *__restrict__ pDst,
+                           uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, shift;
+    uint32_t a, lz, y, q, num, prod;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+        if (x == 0) {
+            pDst[i] = INT16_MAX;
+            continue;
+        }
+
+        /* |x| = m * 2^(32 - lz) with the mantissa m in [0.5, 1), y = 1 / m in Q2.30 */
+        a = (x < 0) ? -x : x;
+        lz = __builtin_clz(a);
+        y = plp_recip_norm_inline(a << lz, 2);
+
+        /* 2^(2 * fracBits) / |x| = y * 2^-shift, rounded, where shift is at least 1 */
+        shift = 62 - (int32_t)lz - 2 * (int32_t)fracBits;
+        q = (shift < 32) ? (y + (1U << (shift - 1))) >> shift : 0;
+
+        /* correct q to (2^(2 * fracBits + 1) + |x|) / (2 * |x|), unless it saturates anyway */
+        if (q <= 0x8000) {
+            num = (1U << (2 * fracBits + 1)) + a;
+            prod = 2 * a * q;
+            while (prod > num) {
+                q--;
+                prod -= 2 * a;
+            }
+            while (num - prod >= 2 * a) {
+                q++;
+                prod += 2 * a;
+            }
+        }
+
+        if (x < 0) {
+            pDst[i] = (q > 0x8000) ? INT16_MIN : -(int32_t)q;
+        } else {
+            pDst[i] = (q > 0x7FFF) ? INT16_MAX : q;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_recip_q32s_rv32im.c
+ * Description:  q32 reciprocal on vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+ * @brief      q32 reciprocal on vectors for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  fracBits   decimal point of the inputs and of the output, at most 31
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * pDst[n] = 1 / pSrc[n], rounded to nearest with ties away from zero and saturated. An input
+ * of 0 results in the largest positive value.
+ *
+ * The magnitude of the input is normalized to a mantissa in [0.5, 1) with a count of the
+ * leading zeros, and the reciprocal of the mantissa is looked up in recipTable_q16 and refined
+ * with three Newton iterations. The quotient is then corrected with its remainder, such that the
+ * results are identical to the ones of a rounded integer division, but no division is needed.
+ */
+
+void plp_recip_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, shift;
+    uint32_t a, lz, y;
+    uint64_t q, num, prod, d;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+        if (x == 0) {
+            pDst[i] = INT32_MAX;
+            continue;
+        }
+
+        /* |x| = m * 2^(32 - lz) with the mantissa m in [0.5, 1), y = 1 / m in Q2.30 */
+        a = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+        lz = __builtin_clz(a);
+        y = plp_recip_norm_inline(a << lz, 3);
+
+        /* 2^(2 * fracBits) / |x| = y * 2^-shift, rounded, which saturates if shift is negative */
+        shift = 62 - (int32_t)lz - 2 * (int32_t)fracBits;
+        if (shift > 0) {
+            q = ((uint64_t)y + (1ULL << (shift - 1))) >> shift;
+        } else {
+            q = (shift == 0) ? y : 0x80000001ULL;
+        }
+
+        /* correct q to (2^(2 * fracBits + 1) + |x|) / (2 * |x|), unless it saturates anyway */
+        if (q <= 0x80000000ULL) {
+            num = (1ULL << (2 * fracBits + 1)) + a;
+            d = 2 * (uint64_t)a;
+            prod = d * q;
+            while (prod > num) {
+                q--;
+                prod -= d;
+            }
+            while (num - prod >= d) {
+                q++;
+                prod += d;
+            }
+        }
+
+        if (x < 0) {
+            pDst[i] = (q > 0x80000000ULL) ? INT32_MIN : (int32_t)-(int64_t)q;
+        } else {
+            pDst[i] = (q > 0x7FFFFFFFULL) ? INT32_MAX : (int32_t)q;
+        }
+    }
+}
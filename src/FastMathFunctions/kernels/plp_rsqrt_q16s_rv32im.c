@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_q16s_rv32im.c
+ * Description:  Inverse square roots of a 16-bit fixed point vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+/**
+   @brief         Inverse square roots of a 16-bit fixed point vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     fracBits   decimal point of the input and of the output, format Q(16-fracBits).fracBits
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in the vectors
+   @return        none
+
+   @par
+   The input is normalized to a mantissa in [0.25, 1) and an even exponent. The inverse square root
+   of the mantissa is looked up in rsqrtTable_q16 and refined with two Newton iterations in Q2.14,
+   then shifted by half the exponent. Results which cannot be represented are saturated, and
+   non-positive inputs result in 0. The kernel only needs integer operations.
+*/
+
+void plp_rsqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pDst,
+                           uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, e, shift;
+    uint32_t m, y, t;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+        if (x <= 0) {
+            pDst[i] = 0;
+            continue;
+        }
+
+        /* x * 2^-fracBits = m * 2^e, with the mantissa m in Q0.16 and an even exponent e */
+        shift = __builtin_clz(x) - 16;
+        m = (uint32_t)x << shift;
+        e = 16 - shift - (int32_t)fracBits;
+        if (e & 1) {
+            m >>= 1;
+            e += 1;
+        }
+
+        /* initial guess from the table, refined with two Newton iterations in Q2.14 */
+        y = rsqrtTable_q16[(m >> 11) - 8];
+        t = (m * ((y * y) >> 14)) >> 16;
+        y = (y * (0xC000 - t)) >> 15;
+        t = (m * ((y * y) >> 14)) >> 16;
+        y = (y * (0xC000 - t)) >> 15;
+
+        /* rsqrt(x) = y * 2^(-e / 2), converted from Q2.14 to the output format */
+        shift = (int32_t)fracBits - 14 - (e >> 1);
+        if (shift >= 0) {
+            if (shift > 15 || (y << shift) > INT16_MAX) {
+                pDst[i] = INT16_MAX;
+            } else {
+                pDst[i] = (int16_t)(y << shift);
+            }
+        } else if (shift > -16) {
+            pDst[i] = (int16_t)((y + (1U << (-shift - 1))) >> (-shift));
+        } else {
+            pDst[i] = 0;
+        }
+    }
+}
+
+/**
+   @} end of sqrtKernels group
+*/
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sigmoid_q16s_xpulpv2.c
+ * Description:  q16 sigmoid (logistic) function for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 sigmoid (logistic) function for XPULPV2
+ *
+ * @param[in]  x         input value in Q(16-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     1 / (1 + exp(-x))
+ *
+ * The sigmoid is computed as (1 + tanh(x / 2)) / 2, with tanh interpolated in tanhTable.
+ * The result is in Q1.15.
+ */
+
+int16_t plp_sigmoid_q16s_xpulpv2(int16_t x,
+                                 uint32_t fracBits) {
+
+    int32_t ax;
+    uint32_t fr, index;
+    int32_t fract, a, b, val;
+    int16_t y;
+
+    /* |x| / 2 in Q16.16 */
+    ax = (x < 0) ? -(int32_t)x : x;
+    fr = (uint32_t)ax << (15 - fracBits);
+
+    /* tanh by linear interpolation in the table, in Q1.15 */
+    if (fr >= (8 << 16)) {
+        val = 0x7FFF;
+    } else {
+        index = fr >> 11;
+        fract = fr & 0x7FF;
+        a = tanhTable_q16[index];
+        b = tanhTable_q16[index + 1];
+        val = a + (((b - a) * fract) >> 11);
+    }
+
+    /* sigmoid(x) = (1 + tanh(x / 2)) / 2 */
+    y = (x < 0) ? (0x8000 - val) >> 1 : (0x8000 + val) >> 1;
+
+    return y;
+}
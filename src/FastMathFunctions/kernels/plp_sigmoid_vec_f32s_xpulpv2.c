@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sigmoid_vec_f32s_xpulpv2.c
+ * Description:  f32 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t blockSize) {
+
+    uint32_t i;
+    float32_t x, y;
+    float32_t in, findex, fract, a, b, val;
+    uint32_t index;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        in = (x < 0.0f) ? -0.5f * x : 0.5f * x;
+
+        /* tanh by linear interpolation in the table */
+        if (in >= 8.0f) {
+            val = 1.0f;
+        } else {
+            findex = in * (float32_t)(FAST_MATH_TANH_TABLE_SIZE / 8);
+            index = (uint32_t)findex;
+            fract = findex - (float32_t)index;
+            a = tanhTable_f32[index];
+            b = tanhTable_f32[index + 1];
+            val = a + (b - a) * fract;
+        }
+
+        /* sigmoid(x) = (1 + tanh(x / 2)) / 2 */
+        y = (x < 0.0f) ? 0.5f - 0.5f * val : 0.5f + 0.5f * val;
+        pDst[i] = y;
+    }
+}
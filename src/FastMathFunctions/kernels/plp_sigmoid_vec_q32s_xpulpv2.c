@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sigmoid_vec_q32s_xpulpv2.c
+ * Description:  q32 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 sigmoid (logistic) function on vectors for XPULPV2
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t blockSize) {
+
+    uint32_t i;
+    int32_t x, y;
+    uint32_t ax, index, fract;
+    int32_t shift, a, b, val;
+    uint64_t u;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        /* |x| / 2 in Q3.29, 8 is the end of the table */
+        ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+        shift = 28 - (int32_t)fracBits;
+        u = (shift >= 0) ? (uint64_t)ax << shift : (uint64_t)(ax >> (-shift));
+
+        /* tanh by linear interpolation in the table, in Q1.31 */
+        if (u >= ((uint64_t)1 << 32)) {
+            val = 0x7FFFFFFF;
+        } else {
+            index = (uint32_t)u >> 24;
+            fract = (uint32_t)u & 0xFFFFFF;
+            a = tanhTable_q32[index];
+            b = tanhTable_q32[index + 1];
+            val = a + (int32_t)(((int64_t)(b - a) * fract) >> 24);
+        }
+
+        /* sigmoid(x) = (1 + tanh(x / 2)) / 2 */
+        y = (x < 0) ? (0x80000000U - val) >> 1 : (0x80000000U + val) >> 1;
+        pDst[i] = y;
+    }
+}
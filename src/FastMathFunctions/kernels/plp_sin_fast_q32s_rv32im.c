@@ -0,0 +1,56 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_fast_q32s_rv32im.c
+ * Description:  q32 sine function, nearest-entry table lookup, for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 sine function with nearest-entry table lookup for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is the entry of the sine table which is nearest to the input. The error is at most
+ * half a table step, about 7 bits of accuracy, which is enough e.g. for PWM duty cycles.
+ */
+
+int32_t plp_sin_fast_q32s_rv32im(int32_t x) {
+
+    uint32_t index; /* Index variable */
+
+    if (x < 0) { /* convert negative numbers to corresponding positive ones */
+        x = (uint32_t)x + 0x80000000;
+    }
+
+    /* Calculate the nearest index, the last entry of the table equals the first one */
+    index = ((uint32_t)x + (1u << (FAST_MATH_Q32_SHIFT - 1))) >> FAST_MATH_Q32_SHIFT;
+
+    return PLP_SIN_TABLE_Q32(index);
+}
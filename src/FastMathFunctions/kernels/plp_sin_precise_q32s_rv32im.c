@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_precise_q32s_rv32im.c
+ * Description:  q32 sine function, cubic interpolation, for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 sine function with cubic interpolation for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table. The error is a few LSBs, compared to about 16 bits of accuracy of the linear
+ * interpolation of plp_sin_q32.
+ */
+
+int32_t plp_sin_precise_q32s_rv32im(int32_t x) {
+
+    uint32_t index;         /* Index variable */
+    int64_t t;              /* Fractional position between the entries */
+    int64_t p0, p1, p2, p3; /* Four nearest table values */
+    int64_t c1, c2, c3;     /* Six times the coefficients of the polynomial */
+    int64_t acc;
+
+    if (x < 0) { /* convert negative numbers to corresponding positive ones */
+        x = (uint32_t)x + 0x80000000;
+    }
+
+    /* Calculate the nearest index below x and the fractional value */
+    index = (uint32_t)x >> FAST_MATH_Q32_SHIFT;
+    t = (x - (index << FAST_MATH_Q32_SHIFT)) << 9;
+
+    /* Read four nearest values, the table is periodic */
+    p0 = PLP_SIN_TABLE_Q32((index - 1) & (FAST_MATH_TABLE_SIZE - 1));
+    p1 = PLP_SIN_TABLE_Q32(index);
+    p2 = PLP_SIN_TABLE_Q32(index + 1);
+    p3 = PLP_SIN_TABLE_Q32((index + 2) & (FAST_MATH_TABLE_SIZE - 1));
+
+    /* Lagrange interpolation, evaluated with the Horner scheme */
+    c1 = 6 * p2 - 2 * p0 - 3 * p1 - p3;
+    c2 = 3 * (p0 + p2) - 6 * p1;
+    c3 = p3 - p0 + 3 * (p1 - p2);
+
+    acc = (c3 * t) >> 31;
+    acc = ((c2 + acc) * t) >> 31;
+    acc = ((c1 + acc) * t) >> 31;
+
+    /* divide by 6 and round */
+    acc = p1 + ((acc * 0x2AAAAAAB + 0x80000000LL) >> 32);
+
+    return (acc > 0x7FFFFFFF) ? 0x7FFFFFFF : (acc < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : acc;
+}
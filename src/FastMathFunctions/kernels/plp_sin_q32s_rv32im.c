@@ -62,8 +62,8 @@ int32_t plp_sin_q32s_rv32im(int32_t x) {
     fract = (x - (index << FAST_MATH_Q32_SHIFT)) << 9;
 
     /* Read two nearest values of input value from the sin table */
-    a = sinTable_q32[index];
-    b = sinTable_q32[index + 1];
+    a = PLP_SIN_TABLE_Q32(index);
+    b = PLP_SIN_TABLE_Q32(index + 1);
 
     /* Linear interpolation process */
     sinVal = (int64_t)(0x80000000 - fract) * a >> 32;
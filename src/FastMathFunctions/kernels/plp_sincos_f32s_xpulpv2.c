@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_f32s_xpulpv2.c
+ * Description:  Calculates the sine and cosine of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 sine and cosine function for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         input values in radians
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The cosines therefore can differ from plp_cos_f32 in the last bits.
+ */
+
+void plp_sincos_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pSin,
+                             float32_t *__restrict__ pCos,
+                             uint32_t blockSize) {
+
+    uint32_t i;
+    float32_t in, findex, fract;
+    float32_t a, b; /* two nearest table values */
+    uint16_t index; /* index in the sine table */
+    int32_t n;
+
+    for (i = 0; i < blockSize; i++) {
+        in = pSrc[i] * 0.159154943092f;
+        n = (int32_t)in;
+        if (in < 0.0f) {
+            n--;
+        }
+        in = in - (float32_t)n;
+
+        findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+        index = (uint16_t)findex;
+        if (index >= FAST_MATH_TABLE_SIZE) {
+            index = 0;
+            findex -= (float32_t)FAST_MATH_TABLE_SIZE;
+        }
+        fract = findex - (float32_t)index;
+
+        a = PLP_SIN_TABLE_F32(index);
+        b = PLP_SIN_TABLE_F32(index + 1);
+        pSin[i] = (1.0f - fract) * a + fract * b;
+
+        /* the cosine is a quarter period ahead */
+        index = (index + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+        a = PLP_SIN_TABLE_F32(index);
+        b = PLP_SIN_TABLE_F32(index + 1);
+        pCos[i] = (1.0f - fract) * a + fract * b;
+    }
+}
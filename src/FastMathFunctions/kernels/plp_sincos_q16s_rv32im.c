@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_q16s_rv32im.c
+ * Description:  Calculates the sine and cosine of a q16 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 sine and cosine function for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ *                         Q1.15 values in range [0, +0.9999] are mapped to [0, 2*PI)
+ * @param[out] pSin       points to the output vector of the sines
+ * @param[out] pCos       points to the output vector of the cosines
+ * @param[in]  blockSize  number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The sine and the cosine share the table index and the interpolation weight, as the cosine is
+ * read a quarter period (FAST_MATH_TABLE_SIZE / 4 entries) further in the sine table.
+ * The results are identical to the ones of plp_sin_q16 and plp_cos_q16.
+ */
+
+void plp_sincos_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                            int16_t *__restrict__ pSin,
+                            int16_t *__restrict__ pCos,
+                            uint32_t blockSize) {
+
+    uint32_t i;
+    int16_t x;     /* input mapped to [0, 0x7FFF] */
+    int32_t index; /* index in the sine table */
+    int16_t fract; /* interpolation weight */
+    int16_t a, b;  /* two nearest table values */
+    int16_t val;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i] & 0x7FFF;
+        index = (uint32_t)x >> FAST_MATH_Q16_SHIFT;
+        fract = (x - (index << FAST_MATH_Q16_SHIFT)) << 9;
+
+        a = PLP_SIN_TABLE_Q16(index);
+        b = PLP_SIN_TABLE_Q16(index + 1);
+        val = (int32_t)(0x8000 - fract) * a >> 16;
+        val = (int16_t)((((int32_t)val << 16) + ((int32_t)fract * b)) >> 16);
+        pSin[i] = val << 1;
+
+        /* the cosine is a quarter period ahead */
+        index = (index + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+        a = PLP_SIN_TABLE_Q16(index);
+        b = PLP_SIN_TABLE_Q16(index + 1);
+        val = (int32_t)(0x8000 - fract) * a >> 16;
+        val = (int16_t)((((int32_t)val << 16) + ((int32_t)fract * b)) >> 16);
+        pCos[i] = val << 1;
+    }
+}
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sqrt_vec_f32s_xpulpv2.c
+ * Description:  Square roots of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+static inline float32_t plp_rsqrt_newton_f32(float32_t x) {
+    union {
+        float32_t f;
+        int32_t i;
+    } y;
+
+    y.i = 0x5F1FFFF9 - (*(int32_t *)&x >> 1);
+    y.f = 0.703952253f * y.f * (2.38924456f - x * y.f * y.f);
+    y.f = y.f * (1.5f - 0.5f * x * y.f * y.f);
+    return y.f;
+}
+
+/**
+   @brief         Square roots of a 32-bit float vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in the vectors
+   @return        none
+
+   @par
+   If the FPU implements fsqrt (__riscv_fsqrt), the square roots are computed in hardware. Otherwise,
+   the square root is computed as x * rsqrt(x), with the Newton refined inverse square root of
+   plp_rsqrt_f32. Non-positive inputs result in 0.
+*/
+
+void plp_sqrt_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize) {
+
+    uint32_t i;
+    float32_t x;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+        if (x > 0.0f) {
+#if defined(__riscv_fsqrt)
+            pDst[i] = __builtin_sqrtf(x);
+#else
+            pDst[i] = x * plp_rsqrt_newton_f32(x);
+#endif
+        } else {
+            pDst[i] = 0.0f;
+        }
+    }
+}
+
+/**
+   @} end of sqrtKernels group
+*/
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_f32s_xpulpv2.c
+ * Description:  f32 hyperbolic tangent function for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 hyperbolic tangent function for XPULPV2
+ *
+ * @param[in]  x         input value
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ */
+
+float32_t plp_tanh_f32s_xpulpv2(float32_t x) {
+
+    float32_t in, findex, fract, a, b, val;
+    uint32_t index;
+    float32_t y;
+
+    in = (x < 0.0f) ? -x : x;
+
+    /* tanh by linear interpolation in the table */
+    if (in >= 8.0f) {
+        val = 1.0f;
+    } else {
+        findex = in * (float32_t)(FAST_MATH_TANH_TABLE_SIZE / 8);
+        index = (uint32_t)findex;
+        fract = findex - (float32_t)index;
+        a = tanhTable_f32[index];
+        b = tanhTable_f32[index + 1];
+        val = a + (b - a) * fract;
+    }
+    y = (x < 0.0f) ? -val : val;
+
+    return y;
+}
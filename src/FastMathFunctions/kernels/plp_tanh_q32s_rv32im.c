@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_q32s_rv32im.c
+ * Description:  q32 hyperbolic tangent function for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 hyperbolic tangent function for RV32IM
+ *
+ * @param[in]  x         input value in Q(32-fracBits).fracBits
+ * @param[in]  fracBits  decimal point of the input
+ *
+ * @return     tanh(x)
+ *
+ * tanh(x) is interpolated in tanhTable, which covers [0, 8]. Larger magnitudes result in +-1.
+ * The result is in Q1.31.
+ */
+
+int32_t plp_tanh_q32s_rv32im(int32_t x,
+                             uint32_t fracBits) {
+
+    uint32_t ax, index, fract;
+    int32_t shift, a, b, val;
+    uint64_t u;
+    int32_t y;
+
+    /* |x| in Q3.29, 8 is the end of the table */
+    ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    shift = 29 - (int32_t)fracBits;
+    u = (shift >= 0) ? (uint64_t)ax << shift : (uint64_t)(ax >> (-shift));
+
+    /* tanh by linear interpolation in the table, in Q1.31 */
+    if (u >= ((uint64_t)1 << 32)) {
+        val = 0x7FFFFFFF;
+    } else {
+        index = (uint32_t)u >> 24;
+        fract = (uint32_t)u & 0xFFFFFF;
+        a = tanhTable_q32[index];
+        b = tanhTable_q32[index + 1];
+        val = a + (int32_t)(((int64_t)(b - a) * fract) >> 24);
+    }
+    y = (x < 0) ? -val : val;
+
+    return y;
+}
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_vec_q16s_rv32im.c
+ * Description:  q16 hyperbolic tangent function on vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 hyperbolic tangent function on vectors for RV32IM
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t i;
+    int16_t x, y;
+    int32_t ax;
+    uint32_t fr, index;
+    int32_t fract, a, b, val;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+
+        /* |x| in Q16.16 */
+        ax = (x < 0) ? -(int32_t)x : x;
+        fr = (uint32_t)ax << (16 - fracBits);
+
+        /* tanh by linear interpolation in the table, in Q1.15 */
+        if (fr >= (8 << 16)) {
+            val = 0x7FFF;
+        } else {
+            index = fr >> 11;
+            fract = fr & 0x7FF;
+            a = tanhTable_q16[index];
+            b = tanhTable_q16[index + 1];
+            val = a + (((b - a) * fract) >> 11);
+        }
+        y = (x < 0) ? -val : val;
+        pDst[i] = y;
+    }
+}
@@ -0,0 +1,52 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_q32_precise.c
+ * Description:  Calculates cosine of a q32 scaled input, cubic interpolation
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for q32 cosine function with cubic interpolation
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ *
+ * The value is interpolated with the cubic polynomial through the four nearest entries of the
+ * sine table. The error is a few LSBs, compared to about 16 bits of accuracy of the linear
+ * interpolation of plp_cos_q32.
+ */
+
+int32_t plp_cos_q32_precise(int32_t x) {
+
+    /* add 0.25 (pi/2) to read the sine table */
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_sin_precise_q32s_rv32im((int32_t)((uint32_t)x + 0x20000000));
+    } else {
+        return plp_sin_precise_q32s_xpulpv2((int32_t)((uint32_t)x + 0x20000000));
+    }
+}
@@ -0,0 +1,57 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_db_q16_vec.c
+ * Description:  Glue code for the q16 power to decibel conversion on vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for the q16 power to decibel conversion on vectors
+ *
+ * @param[in]  pSrc      points to the input vector
+ * @param[in]  fracBits  decimal point of the input
+ * @param[out] pDst      points to the output vector
+ * @param[in]  blockSize number of samples in the vectors
+ *
+ * @return     none
+ *
+ * The input is a power, e.g. a power spectrum, and the output 10 * log10(x) in Q8.8 dB. It is
+ * computed as (e + log2(m)) * 10 * log10(2), with x = m * 2^e, where e is the position of the
+ * leading one and log2(m) is interpolated in logTable. Non-positive inputs result in the most
+ * negative value.
+ */
+
+void plp_db_q16_vec(const int32_t *__restrict__ pSrc,
+                    uint32_t fracBits,
+                    int16_t *__restrict__ pDst,
+                    uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_db_vec_q16s_rv32im(pSrc, fracBits, pDst, blockSize);
+    } else {
+        plp_db_vec_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize);
+    }
+}
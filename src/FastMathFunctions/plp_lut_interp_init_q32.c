@@ -0,0 +1,57 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_init_q32.c
+ * Description:  Initialization of the q32 piecewise-linear table
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Initialization of the 32-bit fixed point piecewise-linear table instance
+ *
+ * @param[out] S          points to an instance of the 32-bit fixed point table structure
+ * @param[in]  pTable     points to the table of numPoints output values
+ * @param[in]  numPoints  number of entries of the table, at least 2
+ * @param[in]  xMin       input value of the first entry
+ * @param[in]  shift      log2 of the input distance of two neighboring entries, at most 31
+ *
+ * @return     none
+ *
+ * Entry i of the table is the output at the input xMin + (i << shift). The distance of the
+ * entries is a power of two, such that the kernels find the entry and the interpolation weight
+ * with a shift and a mask.
+ */
+
+void plp_lut_interp_init_q32(plp_lut_interp_instance_q32 *S,
+                             const int32_t *pTable,
+                             uint32_t numPoints,
+                             int32_t xMin,
+                             uint32_t shift) {
+
+    S->pTable = pTable;
+    S->numPoints = numPoints;
+    S->xMin = xMin;
+    S->shift = shift;
+}
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_f32.c
+ * Description:  Glue code for the inverse square roots of a 32-bit float vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup sqrt
+   @{
+*/
+
+/**
+   @brief         Glue code for the inverse square roots of a 32-bit float vector.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in the vectors
+   @return        none
+
+   @par
+   The initial approximation is computed from the bit pattern of the input, and refined with two
+   Newton iterations (the first one with the optimized coefficients of Moroz et al.), which results
+   in a relative error below 1e-6. The iterations only need multiplications, which are pipelined
+   in the FPU, and are faster than the fdiv and fsqrt instructions even where those are available.
+   Non-positive inputs result in 0.
+*/
+
+void plp_rsqrt_f32(const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pDst,
+                   uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_rsqrt_f32s_xpulpv2(pSrc, pDst, blockSize);
+    }
+}
+
+/**
+   @} end of sqrt group
+*/
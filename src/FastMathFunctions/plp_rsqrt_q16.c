@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_q16.c
+ * Description:  Glue code for the inverse square roots of a 16-bit fixed point vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup sqrt
+   @{
+*/
+
+/**
+   @brief         Glue code for the inverse square roots of a 16-bit fixed point vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     fracBits   decimal point of the input and of the output, format Q(16-fracBits).fracBits
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in the vectors
+   @return        none
+
+   @par
+   The input is normalized to a mantissa in [0.25, 1) and an even exponent. The inverse square root
+   of the mantissa is looked up in rsqrtTable_q16 and refined with two Newton iterations in Q2.14,
+   then shifted by half the exponent. Results which cannot be represented are saturated, and
+   non-positive inputs result in 0. The kernel only needs integer operations.
+*/
+
+void plp_rsqrt_q16(const int16_t *__restrict__ pSrc,
+                   const uint32_t fracBits,
+                   int16_t *__restrict__ pDst,
+                   uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_rsqrt_q16s_rv32im(pSrc, fracBits, pDst, blockSize);
+    } else {
+        plp_rsqrt_q16s_xpulpv2(pSrc, fracBits, pDst, blockSize);
+    }
+}
+
+/**
+   @} end of sqrt group
+*/
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_f32s_xpulpv2.c
+ * Description:  32-bit floating-point autocorrelation kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Autocorrelation
+*/
+
+/**
+   @addtogroup AutocorrelationKernels
+   @{
+*/
+
+/**
+   @brief Autocorrelation of a 32-bit float vector kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+
+void plp_autocorr_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t numLags,
+                               float32_t *__restrict__ pRes) {
+
+    uint32_t lag, n, len;
+    const float32_t *pLag;
+    float32_t sum1, sum2;
+
+    for (lag = 0; lag < numLags; lag++) {
+        len = (lag < blockSize) ? blockSize - lag : 0;
+        pLag = pSrc + lag;
+        sum1 = 0.0f;
+        sum2 = 0.0f;
+
+        for (n = 0; n < (len >> 1); n++) {
+            sum1 += pSrc[2 * n] * pLag[2 * n];
+            sum2 += pSrc[2 * n + 1] * pLag[2 * n + 1];
+        }
+
+        if (len % 2 == 1) {
+            sum1 += pSrc[len - 1] * pLag[len - 1];
+        }
+
+        pRes[lag] = sum1 + sum2;
+    }
+}
+
+/**
+   @} end of AutocorrelationKernels group
+*/
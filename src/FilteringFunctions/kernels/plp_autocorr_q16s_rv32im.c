@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q16s_rv32im.c
+ * Description:  16-bit fixed-point autocorrelation kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Autocorrelation
+*/
+
+/**
+   @defgroup AutocorrelationKernels Autocorrelation Kernels
+   This module contains the kernel codes of the autocorrelation.
+*/
+
+/**
+   @addtogroup AutocorrelationKernels
+   @{
+*/
+
+/**
+   @brief Autocorrelation of a 16-bit fixed point vector kernel for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+
+   @par Precision
+   The products are summed up exactly in 64 bits and the sum is shifted right by fracBits with
+   rounding to nearest.
+*/
+
+void plp_autocorr_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t numLags,
+                              uint32_t fracBits,
+                              int64_t *__restrict__ pRes) {
+
+    uint32_t lag, n, len;
+    const int16_t *pLag;
+    int64_t sum;
+
+    for (lag = 0; lag < numLags; lag++) {
+        len = (lag < blockSize) ? blockSize - lag : 0;
+        pLag = pSrc + lag;
+        sum = 0;
+
+        // the products of 16-bit samples are exact in 32 bits
+        for (n = 0; n < len; n++) {
+            sum += (int32_t)pSrc[n] * pLag[n];
+        }
+
+        if (fracBits > 0) {
+            sum = (sum + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+        }
+        pRes[lag] = sum;
+    }
+}
+
+/**
+   @} end of AutocorrelationKernels group
+*/
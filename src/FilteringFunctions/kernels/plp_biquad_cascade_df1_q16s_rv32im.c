@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16s_rv32im.c
+ * Description:  16-bit fixed point biquad cascade IIR filter kernel for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point biquad cascade IIR filter (direct form I) kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q16s_rv32im(const plp_biquad_cascade_df1_instance_q16 *S,
+                                        const int16_t *pSrc,
+                                        uint32_t blockSize,
+                                        int16_t *pDst) {
+
+    uint32_t numStages = S->numStages;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    const int16_t *pIn = pSrc; // input of the current stage
+
+    uint32_t stage; // loop counter
+    uint32_t n;     // loop counter
+
+    int32_t round = fracBits ? 1 << (fracBits - 1) : 0;
+
+    for (stage = 0; stage < numStages; stage++) {
+        int32_t b0 = pCoeffs[0];
+        int32_t b1 = pCoeffs[1];
+        int32_t b2 = pCoeffs[2];
+        int32_t a1 = pCoeffs[3];
+        int32_t a2 = pCoeffs[4];
+
+        int32_t x1 = pState[0];
+        int32_t x2 = pState[1];
+        int32_t y1 = pState[2];
+        int32_t y2 = pState[3];
+
+        for (n = 0; n < blockSize; n++) {
+            int32_t x0 = pIn[n];
+            int32_t acc = b0 * x0 + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+            acc = (acc + round) >> fracBits;
+            int32_t y0 = acc > 32767 ? 32767 : acc < -32768 ? -32768 : acc;
+
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            pDst[n] = (int16_t)y0;
+        }
+
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+
+        pCoeffs += 5;
+        pState += 4;
+        pIn = pDst;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
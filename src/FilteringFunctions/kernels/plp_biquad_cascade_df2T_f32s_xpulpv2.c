@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32s_xpulpv2.c
+ * Description:  32-bit floating-point biquad cascade IIR filter kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief 32-bit floating-point biquad cascade IIR filter (transposed direct form II) kernel for
+          XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point biquad
+                         cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df2T_f32s_xpulpv2(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          const float *pSrc,
+                                          uint32_t blockSize,
+                                          float *pDst) {
+
+    uint32_t numStages = S->numStages;
+    const float *pCoeffs = S->pCoeffs;
+    float *pState = S->pState;
+    const float *pIn = pSrc; // input of the current stage
+
+    uint32_t stage; // loop counter
+    uint32_t n;     // loop counter
+
+    for (stage = 0; stage < numStages; stage++) {
+        float b0 = pCoeffs[0];
+        float b1 = pCoeffs[1];
+        float b2 = pCoeffs[2];
+        float a1 = pCoeffs[3];
+        float a2 = pCoeffs[4];
+
+        float d1 = pState[0];
+        float d2 = pState[1];
+
+        for (n = 0; n < blockSize; n++) {
+            float x0 = pIn[n];
+            float y0 = b0 * x0 + d1;
+            d1 = b1 * x0 + a1 * y0 + d2;
+            d2 = b2 * x0 + a2 * y0;
+            pDst[n] = y0;
+        }
+
+        pState[0] = d1;
+        pState[1] = d2;
+
+        pCoeffs += 5;
+        pState += 2;
+        pIn = pDst;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_i32s_rv32im.c
+ * Description:  32-bit integer CIC decimator kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup CICDecimate
+*/
+
+/**
+   @defgroup CICDecimateKernels CIC Decimator Kernels
+   This module contains the kernel codes of the CIC decimators. The integrators run over the M
+   input samples of every output sample, followed by the combs. The XPULPV2 kernels pass four
+   input samples through each integrator at once, such that its register is loaded and stored only
+   once per four samples.
+*/
+
+/**
+   @addtogroup CICDecimateKernels
+   @{
+*/
+
+/**
+   @brief      32-bit integer CIC decimator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_cic_decimate_i32s_rv32im(const plp_cic_decimate_instance_i32 *S,
+                                  const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst) {
+
+    uint32_t order = S->order;
+    uint32_t M = S->M;
+    uint32_t shift = S->shift;
+    uint32_t *pInt = (uint32_t *)S->pState; // integrators
+    uint32_t *pComb = pInt + order;         // delays of the combs
+
+    uint32_t blkCnt, i, k;
+    uint32_t acc = 0, delayed;
+
+    for (blkCnt = blockSize / M; blkCnt > 0; blkCnt--) {
+
+        /* integrators at the input rate */
+        for (i = 0; i < M; i++) {
+            acc = (uint32_t)(*pSrc++);
+            for (k = 0; k < order; k++) {
+                acc += pInt[k];
+                pInt[k] = acc;
+            }
+        }
+
+        /* combs at the output rate */
+        for (k = 0; k < order; k++) {
+            delayed = pComb[k];
+            pComb[k] = acc;
+            acc -= delayed;
+        }
+
+        *pDst++ = (int32_t)acc >> shift;
+    }
+}
+
+/**
+   @} end of CICDecimateKernels group
+*/
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_interpolate_i32s_xpulpv2.c
+ * Description:  32-bit integer CIC interpolator kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup CICInterpolate
+*/
+
+/**
+   @addtogroup CICInterpolateKernels
+   @{
+*/
+
+/**
+   @brief      32-bit integer CIC interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit integer CIC interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_cic_interpolate_i32s_xpulpv2(const plp_cic_interpolate_instance_i32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst) {
+
+    uint32_t order = S->order;
+    uint32_t L = S->L;
+    uint32_t shift = S->shift;
+    uint32_t *pComb = (uint32_t *)S->pState; // delays of the combs
+    uint32_t *pInt = pComb + order;          // integrators
+
+    uint32_t blkCnt, i, k;
+    uint32_t acc, delayed;
+    uint32_t x0, x1, x2, x3;
+
+    for (blkCnt = blockSize; blkCnt > 0; blkCnt--) {
+
+        /* combs at the input rate */
+        acc = (uint32_t)(*pSrc++);
+        for (k = 0; k < order; k++) {
+            delayed = pComb[k];
+            pComb[k] = acc;
+            acc -= delayed;
+        }
+
+        /* integrators at the output rate, four output samples pass each stage at once, such that
+           the register of the stage is loaded and stored once per four samples. The input of the
+           first stage is the comb output followed by L - 1 stuffed zeros. */
+        for (i = L >> 2; i > 0; i--) {
+            x0 = acc;
+            x1 = 0;
+            x2 = 0;
+            x3 = 0;
+            for (k = 0; k < order; k++) {
+                x0 += pInt[k];
+                x1 += x0;
+                x2 += x1;
+                x3 += x2;
+                pInt[k] = x3;
+            }
+            *pDst++ = (int32_t)x0 >> shift;
+            *pDst++ = (int32_t)x1 >> shift;
+            *pDst++ = (int32_t)x2 >> shift;
+            *pDst++ = (int32_t)x3 >> shift;
+            acc = 0;
+        }
+        for (i = L & 0x3; i > 0; i--) {
+            for (k = 0; k < order; k++) {
+                acc += pInt[k];
+                pInt[k] = acc;
+            }
+            *pDst++ = (int32_t)acc >> shift;
+            acc = 0;
+        }
+    }
+}
+
+/**
+   @} end of CICInterpolateKernels group
+*/
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_interpolate_q32p_xpulpv2.c
+ * Description:  32-bit fixed point multi-channel CIC interpolator kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup CICInterpolate
+*/
+
+/**
+   @addtogroup CICInterpolateKernels
+   @{
+*/
+
+/**
+   @brief     Parallel multi-channel 32-bit fixed point CIC interpolator kernel for XPULPV2
+              extension.
+   @param[in] task_args points to the plp_cic_interpolate_parallel_instance_q32 struct initialized
+                        by plp_cic_interpolate_q32_parallel
+   @return    none
+*/
+
+void plp_cic_interpolate_q32p_xpulpv2(void *task_args) {
+
+    plp_cic_interpolate_parallel_instance_q32 *a =
+        (plp_cic_interpolate_parallel_instance_q32 *)task_args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t outSize = blockSize * a->S[0].L;
+    uint32_t c; // channel counter
+
+    for (c = plp_core_id(); c < a->numChannels; c += a->nPE) {
+        plp_cic_interpolate_q32s_xpulpv2(&a->S[c], a->pSrc + c * blockSize, blockSize,
+                                         a->pDst + c * outSize);
+    }
+}
+
+/**
+   @} end of CICInterpolateKernels group
+*/
@@ -0,0 +1,176 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer 2D convolution kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Convolution2D
+*/
+
+/**
+   @addtogroup Convolution2DKernels
+   @{
+*/
+
+/**
+   @brief Parallel 2D convolution of 16-bit integer images kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv2d_instance_i16 struct initialized by
+                          plp_conv2d_i16_parallel
+   @return     none
+
+   @par
+   The output image is split into tiles with plp_mat_partition, and every core computes its own
+   tile. Neighbouring tiles read overlapping regions of the input image, but write disjoint
+   regions of the output image.
+*/
+
+void plp_conv2d_i16p_xpulpv2(void *task_args) {
+
+    plp_conv2d_instance_i16 *a = (plp_conv2d_instance_i16 *)task_args;
+
+    const int16_t *__restrict__ pSrc = a->pSrc;
+    uint32_t srcH = a->srcH;
+    uint32_t srcW = a->srcW;
+    uint32_t strideSrc = a->strideSrc;
+    const int16_t *__restrict__ pKernel = a->pKernel;
+    uint32_t kH = a->kH;
+    uint32_t kW = a->kW;
+    uint32_t padding = a->padding;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t outH, outW; // size of the output image
+    uint32_t offY, offX; // position of the output image in the full convolution
+
+    if (padding == PLP_CONV2D_SAME) {
+        outH = srcH;
+        outW = srcW;
+        offY = kH >> 1;
+        offX = kW >> 1;
+    } else {
+        if (srcH < kH || srcW < kW) {
+            plp_team_barrier();
+            return;
+        }
+        outH = srcH - kH + 1;
+        outW = srcW - kW + 1;
+        offY = kH - 1;
+        offX = kW - 1;
+    }
+
+    plp_mat_tile tile;
+    plp_mat_partition(outH, outW, nPE, plp_core_id(), &tile);
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    uint32_t y, x, r, c; // loop counters
+
+    for (y = tile.mStart; y < tile.mEnd; y++) {
+
+        // rows of the input image which overlap with the kernel
+        uint32_t u = y + offY;
+        uint32_t rMin = (u >= kH - 1) ? u - (kH - 1) : 0;
+        uint32_t rMax = (u < srcH) ? u : srcH - 1;
+
+        for (x = tile.oStart; x < tile.oEnd; x++) {
+
+            // columns of the input image which overlap with the kernel
+            uint32_t v = x + offX;
+            uint32_t cMin = (v >= kW - 1) ? v - (kW - 1) : 0;
+            uint32_t cMax = (v < srcW) ? v : srcW - 1;
+            uint32_t count = cMax - cMin + 1;
+
+            int32_t sum = 0;
+            for (r = rMin; r <= rMax; r++) {
+                // pS[c] is multiplied with pK[-c]
+                const int16_t *pS = pSrc + r * strideSrc + cMin;
+                const int16_t *pK = pKernel + (u - r) * kW + (v - cMin);
+                for (c = 0; c < count; c++) {
+                    sum += (int32_t)pS[c] * (int32_t)pK[-(int32_t)c];
+                }
+            }
+            pDst[y * strideDst + x] = sum;
+        }
+    }
+
+#else
+
+    uint32_t y, x, r; // loop counters
+
+    for (y = tile.mStart; y < tile.mEnd; y++) {
+
+        // rows of the input image which overlap with the kernel
+        uint32_t u = y + offY;
+        uint32_t rMin = (u >= kH - 1) ? u - (kH - 1) : 0;
+        uint32_t rMax = (u < srcH) ? u : srcH - 1;
+
+        for (x = tile.oStart; x < tile.oEnd; x++) {
+
+            // columns of the input image which overlap with the kernel
+            uint32_t v = x + offX;
+            uint32_t cMin = (v >= kW - 1) ? v - (kW - 1) : 0;
+            uint32_t cMax = (v < srcW) ? v : srcW - 1;
+            uint32_t count = cMax - cMin + 1;
+
+            int32_t sum = 0;
+            for (r = rMin; r <= rMax; r++) {
+                // pS[c] is multiplied with pK[-c]
+                const int16_t *pS = pSrc + r * strideSrc + cMin;
+                const int16_t *pK = pKernel + (u - r) * kW + (v - cMin);
+                // the kernel is read backwards, reverse the order of the loaded elements
+                uint32_t k = count >> 1U;
+                while (k > 0U) {
+                    v2s vS = *((v2s *)pS);
+                    v2s vK = __builtin_shuffle(*((v2s *)(pK - 1)), (v2s){ 1, 0 });
+                    sum = __SUMDOTP2(vS, vK, sum);
+                    pS += 2;
+                    pK -= 2;
+                    k--;
+                }
+
+                k = count & 0x1U;
+                while (k > 0U) {
+                    sum += (int32_t)*pS++ * (int32_t)*pK--;
+                    k--;
+                }
+            }
+            pDst[y * strideDst + x] = sum;
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of Convolution2DKernels group
+*/
@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8s_rv32im.c
+ * Description:  8-bit integer 2D convolution kernel for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Convolution2D
+*/
+
+/**
+   @addtogroup Convolution2DKernels
+   @{
+*/
+
+/**
+   @brief 2D convolution of 8-bit integer images kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t srcH,
+                           uint32_t srcW,
+                           uint32_t strideSrc,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kH,
+                           uint32_t kW,
+                           uint32_t padding,
+                           uint32_t strideDst,
+                           int32_t *__restrict__ pDst) {
+
+    uint32_t outH, outW; // size of the output image
+    uint32_t offY, offX; // position of the output image in the full convolution
+
+    if (padding == PLP_CONV2D_SAME) {
+        outH = srcH;
+        outW = srcW;
+        offY = kH >> 1;
+        offX = kW >> 1;
+    } else {
+        if (srcH < kH || srcW < kW) {
+            return;
+        }
+        outH = srcH - kH + 1;
+        outW = srcW - kW + 1;
+        offY = kH - 1;
+        offX = kW - 1;
+    }
+
+    uint32_t y, x, r, c; // loop counters
+
+    for (y = 0; y < outH; y++) {
+
+        // rows of the input image which overlap with the kernel
+        uint32_t u = y + offY;
+        uint32_t rMin = (u >= kH - 1) ? u - (kH - 1) : 0;
+        uint32_t rMax = (u < srcH) ? u : srcH - 1;
+
+        for (x = 0; x < outW; x++) {
+
+            // columns of the input image which overlap with the kernel
+            uint32_t v = x + offX;
+            uint32_t cMin = (v >= kW - 1) ? v - (kW - 1) : 0;
+            uint32_t cMax = (v < srcW) ? v : srcW - 1;
+            uint32_t count = cMax - cMin + 1;
+
+            int32_t sum = 0;
+            for (r = rMin; r <= rMax; r++) {
+                // pS[c] is multiplied with pK[-c]
+                const int8_t *pS = pSrc + r * strideSrc + cMin;
+                const int8_t *pK = pKernel + (u - r) * kW + (v - cMin);
+                for (c = 0; c < count; c++) {
+                    sum += (int32_t)pS[c] * (int32_t)pK[-(int32_t)c];
+                }
+            }
+            pDst[y * strideDst + x] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Convolution2DKernels group
+*/
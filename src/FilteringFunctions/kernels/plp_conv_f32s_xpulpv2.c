@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_f32s_xpulpv2.c
+ * Description:  32-bit floating-point convolution kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Convolution of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA      points to the first input vector
+   @param[in]  srcALen    Length of the first input vector
+   @param[in]  pSrcB      points to the second input vector
+   @param[in]  srcBLen    Length of the second input vector
+   @param[out] pRes       output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+*/
+
+void plp_conv_f32s_xpulpv2(const float32_t *pSrcA,
+                           uint32_t srcALen,
+                           const float32_t *pSrcB,
+                           uint32_t srcBLen,
+                           float32_t *pRes) {
+
+    uint32_t n, k; // loop counters
+
+    for (n = 0; n < srcALen + srcBLen - 1; n++) {
+        uint32_t kStart = n >= srcBLen - 1 ? n - (srcBLen - 1) : 0;
+        uint32_t kEnd = n < srcALen - 1 ? n : srcALen - 1;
+        float32_t sum = 0.0f;
+
+        for (k = kStart; k <= kEnd; k++) {
+            sum += pSrcA[k] * pSrcB[n - k];
+        }
+
+        pRes[n] = sum;
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels group
+*/
@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_fft_OLA_f32.c
+ * Description:  32-bit floating-point overlap-add FFT convolution
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_common_tables.h"
+
+/**
+   @ingroup FFTConvolution
+*/
+
+/**
+   @addtogroup FFTConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Overlap-add convolution of 32-bit floating-point vectors with the real FFT.
+   @param[in]  pSrcA    points to the longer input vector
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  pSrcB    points to the shorter input vector (the filter kernel)
+   @param[in]  srcBLen  Length of the shorter input vector, at most fftLen / 2
+   @param[in]  fftLen   FFT length, power of two between 16 and 2048
+   @param[in]  pScratch points to a scratch buffer of 6 * fftLen elements
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+
+   @par
+   The twiddle factors are taken from the table of the 2048 point real FFT. The spectra are kept
+   in bit-reversed order, which does not matter for the element-wise product. Since the result y
+   is real, its spectrum Y is hermitian, and the inverse transform can be replaced by a forward
+   real FFT: y[n] = (Re(Z[n]) + Im(Z[n])) / fftLen, where Z = FFT(Re(Y) + Im(Y)).
+*/
+
+void plp_conv_fft_OLA_f32(const float32_t *pSrcA,
+                          uint32_t srcALen,
+                          const float32_t *pSrcB,
+                          uint32_t srcBLen,
+                          uint32_t fftLen,
+                          float32_t *pScratch,
+                          float32_t *pRes) {
+
+    Complex_type_f32 *pTwiddle = (Complex_type_f32 *)pScratch;       // fftLen / 2 values
+    float32_t *pIn = pScratch + fftLen;                                 // fftLen values
+    Complex_type_f32 *pB = (Complex_type_f32 *)(pScratch + 2 * fftLen); // spectrum of the kernel
+    Complex_type_f32 *pX = (Complex_type_f32 *)(pScratch + 4 * fftLen); // spectrum of the block
+
+    uint32_t log2Len = 0;
+    while ((1U << log2Len) < fftLen) {
+        log2Len++;
+    }
+
+    uint32_t revShift = 11 - log2Len; // bit_rev_radix2_LUT is for 2048 points
+    uint32_t blockLen = fftLen - srcBLen + 1;
+    uint32_t resLen = srcALen + srcBLen - 1;
+    float32_t scale = 1.0f / fftLen;
+    uint32_t i, off;
+
+    for (i = 0; i < fftLen / 2; i++) {
+        pTwiddle[i] = twiddleCoef_rfft_2048[i << revShift];
+    }
+
+    plp_rfft_instance_f32 S = { fftLen, 0, (float32_t *)pTwiddle, NULL, PLP_RFFT_RADIX4, 0 };
+
+    // spectrum of the kernel
+    for (i = 0; i < fftLen; i++) {
+        pIn[i] = i < srcBLen ? pSrcB[i] : 0.0f;
+    }
+    plp_rfft_f32(&S, pIn, (float32_t *)pB);
+
+    for (i = 0; i < resLen; i++) {
+        pRes[i] = 0.0f;
+    }
+
+    for (off = 0; off < srcALen; off += blockLen) {
+        uint32_t len = srcALen - off < blockLen ? srcALen - off : blockLen;
+        uint32_t outLen = len + srcBLen - 1;
+
+        // spectrum of the block
+        for (i = 0; i < fftLen; i++) {
+            pIn[i] = i < len ? pSrcA[off + i] : 0.0f;
+        }
+        plp_rfft_f32(&S, pIn, (float32_t *)pX);
+
+        // product of the spectra, Re + Im in natural order
+        for (i = 0; i < fftLen; i++) {
+            float32_t re = pX[i].re * pB[i].re - pX[i].im * pB[i].im;
+            float32_t im = pX[i].re * pB[i].im + pX[i].im * pB[i].re;
+            pIn[bit_rev_radix2_LUT[i << revShift]] = re + im;
+        }
+        plp_rfft_f32(&S, pIn, (float32_t *)pX);
+
+        // overlap-add
+        for (i = 0; i < outLen; i++) {
+            Complex_type_f32 z = pX[bit_rev_radix2_LUT[i << revShift]];
+            pRes[off + i] += (z.re + z.im) * scale;
+        }
+    }
+}
+
+/**
+   @} end of FFTConvolutionKernels group
+*/
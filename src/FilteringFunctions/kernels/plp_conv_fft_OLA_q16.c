@@ -0,0 +1,213 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_fft_OLA_q16.c
+ * Description:  16-bit fixed point overlap-add FFT convolution
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_const_structs.h"
+
+static uint32_t plp_conv_fft_headroom_q16(const int16_t *pSrc, uint32_t len);
+
+/**
+   @ingroup FFTConvolution
+*/
+
+/**
+   @defgroup FFTConvolutionKernels FFT Convolution Kernels
+   This module contains the overlap-add kernels of the FFT convolution. They use the transform
+   functions (@ref fft) for the FFT, and work on caller provided scratch buffers.
+*/
+
+/**
+   @addtogroup FFTConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Overlap-add convolution of 16-bit fixed point vectors with the 16-bit fixed point CFFT.
+   @param[in]  pSrcA    points to the longer input vector
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  pSrcB    points to the shorter input vector (the filter kernel)
+   @param[in]  srcBLen  Length of the shorter input vector, at most fftLen / 2
+   @param[in]  fracBits Fixed point position of the result, the result is shifted right by fracBits
+   @param[in]  fftLen   FFT length, power of two between 16 and 4096
+   @param[in]  pScratch points to a scratch buffer of 4 * fftLen elements
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+
+   @par
+   The inverse transform is computed with the forward CFFT as conj(FFT(conj(Y))) / fftLen. Since
+   the result is real, only the real part is needed, and the final conjugation is skipped.
+*/
+
+void plp_conv_fft_OLA_q16(const int16_t *pSrcA,
+                          uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          uint32_t srcBLen,
+                          uint32_t fracBits,
+                          uint32_t fftLen,
+                          int16_t *pScratch,
+                          int32_t *pRes) {
+
+    const plp_cfft_instance_q16 *S;
+
+    switch (fftLen) {
+    case 16:
+        S = &plp_cfft_sR_q16_len16;
+        break;
+    case 32:
+        S = &plp_cfft_sR_q16_len32;
+        break;
+    case 64:
+        S = &plp_cfft_sR_q16_len64;
+        break;
+    case 128:
+        S = &plp_cfft_sR_q16_len128;
+        break;
+    case 256:
+        S = &plp_cfft_sR_q16_len256;
+        break;
+    case 512:
+        S = &plp_cfft_sR_q16_len512;
+        break;
+    case 1024:
+        S = &plp_cfft_sR_q16_len1024;
+        break;
+    case 2048:
+        S = &plp_cfft_sR_q16_len2048;
+        break;
+    case 4096:
+        S = &plp_cfft_sR_q16_len4096;
+        break;
+    default:
+        printf("FFT length not supported\n");
+        return;
+    }
+
+    int16_t *pB = pScratch;              // spectrum of the kernel
+    int16_t *pX = pScratch + 2 * fftLen; // spectrum of the current block
+
+    uint32_t log2Len = 0;
+    while ((1U << log2Len) < fftLen) {
+        log2Len++;
+    }
+
+    uint32_t blockLen = fftLen - srcBLen + 1;
+    uint32_t resLen = srcALen + srcBLen - 1;
+    uint32_t i, off;
+
+    // spectrum of the kernel, normalized to the full 16 bit range
+    uint32_t shiftB = plp_conv_fft_headroom_q16(pSrcB, srcBLen);
+    for (i = 0; i < fftLen; i++) {
+        pB[2 * i] = i < srcBLen ? pSrcB[i] << shiftB : 0;
+        pB[2 * i + 1] = 0;
+    }
+    plp_cfft_q16(S, pB, 0, 1, 15);
+
+    for (i = 0; i < resLen; i++) {
+        pRes[i] = 0;
+    }
+
+    for (off = 0; off < srcALen; off += blockLen) {
+        uint32_t len = srcALen - off < blockLen ? srcALen - off : blockLen;
+        uint32_t outLen = len + srcBLen - 1;
+
+        // spectrum of the block, normalized to the full 16 bit range
+        uint32_t shiftA = plp_conv_fft_headroom_q16(pSrcA + off, len);
+        for (i = 0; i < fftLen; i++) {
+            pX[2 * i] = i < len ? pSrcA[off + i] << shiftA : 0;
+            pX[2 * i + 1] = 0;
+        }
+        plp_cfft_q16(S, pX, 0, 1, 15);
+
+        // find the normalization of the product of the spectra
+        int32_t maxVal = 0;
+        for (i = 0; i < fftLen; i++) {
+            int32_t re = pX[2 * i] * pB[2 * i] - pX[2 * i + 1] * pB[2 * i + 1];
+            int32_t im = pX[2 * i] * pB[2 * i + 1] + pX[2 * i + 1] * pB[2 * i];
+            re = re < 0 ? -re : re;
+            im = im < 0 ? -im : im;
+            maxVal = re > maxVal ? re : maxVal;
+            maxVal = im > maxVal ? im : maxVal;
+        }
+        uint32_t shiftY = 0;
+        while ((maxVal >> shiftY) >= 32767) {
+            shiftY++;
+        }
+
+        // conjugate of the normalized product
+        for (i = 0; i < fftLen; i++) {
+            int32_t re = pX[2 * i] * pB[2 * i] - pX[2 * i + 1] * pB[2 * i + 1];
+            int32_t im = pX[2 * i] * pB[2 * i + 1] + pX[2 * i + 1] * pB[2 * i];
+            pX[2 * i] = (int16_t)(re >> shiftY);
+            pX[2 * i + 1] = (int16_t)(-(im >> shiftY));
+        }
+        plp_cfft_q16(S, pX, 0, 1, 15);
+
+        // undo the normalization and the scaling of the three transforms, and overlap-add
+        int32_t shift = (int32_t)(shiftY + 2 * log2Len) - (int32_t)(shiftA + shiftB + fracBits);
+        for (i = 0; i < outLen; i++) {
+            int32_t val = pX[2 * i];
+            if (shift >= 0) {
+                val = val << shift;
+            } else {
+                val = (val + (1 << (-shift - 1))) >> (-shift);
+            }
+            pRes[off + i] += val;
+        }
+    }
+}
+
+/**
+   @} end of FFTConvolutionKernels group
+*/
+
+/**
+   @brief Number of bits by which the vector can be shifted left without overflow.
+   @param[in]  pSrc points to the input vector
+   @param[in]  len  Length of the input vector
+   @return     headroom in bits
+*/
+static uint32_t plp_conv_fft_headroom_q16(const int16_t *pSrc, uint32_t len) {
+
+    int32_t maxVal = 0;
+    uint32_t shift = 0;
+
+    for (uint32_t i = 0; i < len; i++) {
+        int32_t val = pSrc[i] < 0 ? -pSrc[i] : pSrc[i];
+        maxVal = val > maxVal ? val : maxVal;
+    }
+
+    if (maxVal == 0) {
+        return 0;
+    }
+
+    while ((maxVal << (shift + 1)) <= 32767) {
+        shift++;
+    }
+
+    return shift;
+}
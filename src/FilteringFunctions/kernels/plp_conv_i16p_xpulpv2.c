@@ -30,6 +30,9 @@
 
 #include "plp_math.h"
 
+#define shufflemask1                                                                               \
+    (v2s) { 1, 0 }
+
 /**
    @ingroup BasicConvolution
 */
@@ -41,65 +44,72 @@
 
 /**
    @brief Parallel convolution of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  task_args     pointer to plp_conv_instance_i16 struct initialized by
-   plp_conv_i16_parallel
+   @param[in]  task_args      pointer to plp_conv_instance_i16 struct initialized by
+                              plp_conv_i16_parallel
    @return        none
+
+   @par
+   Every core computes a contiguous range of the output samples directly (owner computes), as
+   given by plp_conv_parallel_range. Hence, the partial results need not be overlap-added
+   afterwards and the kernel only needs a single fork.
 */
 
-// Pre-condition: psrcALen >= psrcBLen, established by calling function plp_conv_i16
 // Pre-condition: pRes has enough allocated memory, i.e. srcALen + srcBLen-1u
-// Pre-condition: srcALen >= 2 and srcBLen >= 2, otherwise use vector dot product
 
 void plp_conv_i16p_xpulpv2(void *task_args) {
 
     plp_conv_instance_i16 *S = (plp_conv_instance_i16 *)task_args;
 
-    uint32_t resultoffset = ((S->srcALen + S->nPE - 1) / S->nPE) + S->srcBLen - 1;
-    uint32_t srcAoffset = ((S->srcALen + S->nPE - 1) / S->nPE);
-
-    int16_t *pSrcA;
-    uint32_t srcALen;
-    int16_t *pSrcB;
-    uint32_t srcBLen;
-    int32_t *pRes;
-
-    int16_t *pIn1;
-    int16_t *pIn2;
-    uint32_t pIn1Len;
-    uint32_t pIn2Len;
-
-    // Unpack partial convolution vectors
-    if (rt_core_id() == (S->nPE - 1)) {
-
-        pSrcA = (int16_t *)((S->pSrcA + srcAoffset * (S->nPE - 1)));
-        srcALen = S->srcALen - (srcAoffset * (S->nPE - 1));
-        pSrcB = (int16_t *)(S->pSrcB);
-        srcBLen = S->srcBLen;
-        pRes = (int32_t *)(S->pRes + resultoffset * (S->nPE - 1));
+    const int16_t *pIn1;
+    const int16_t *pIn2;
+    uint32_t in1Len;
+    uint32_t in2Len;
 
-    } else {
-
-        srcALen = srcAoffset;
-        pSrcA = (int16_t *)(S->pSrcA + (rt_core_id() * srcAoffset));
-        pSrcB = (int16_t *)S->pSrcB;
-        srcBLen = S->srcBLen;
-        pRes = (int32_t *)(S->pRes + resultoffset * (rt_core_id()));
-    }
     // Reorder vectors; longest first
-    if (srcALen >= srcBLen) {
-        pIn1 = pSrcA;
-        pIn1Len = srcALen;
-        pIn2 = pSrcB;
-        pIn2Len = srcBLen;
+    if (S->srcALen >= S->srcBLen) {
+        pIn1 = S->pSrcA;
+        in1Len = S->srcALen;
+        pIn2 = S->pSrcB;
+        in2Len = S->srcBLen;
     } else {
-        pIn1 = pSrcB;
-        pIn1Len = srcBLen;
-        pIn2 = pSrcA;
-        pIn2Len = srcALen;
+        pIn1 = S->pSrcB;
+        in1Len = S->srcBLen;
+        pIn2 = S->pSrcA;
+        in2Len = S->srcALen;
+    }
+
+    uint32_t start, end;
+    plp_conv_parallel_range(in1Len, in2Len, S->nPE, plp_core_id(), &start, &end);
+
+    for (uint32_t n = start; n < end; n++) {
+
+        // res[n] = sum_k x[k] * y[n - k], for all k with valid indices into both vectors
+        uint32_t kMin = (n >= in2Len) ? n - (in2Len - 1) : 0;
+        uint32_t kMax = (n < in1Len) ? n : in1Len - 1;
+        uint32_t count = kMax - kMin + 1;
+
+        const int16_t *px = pIn1 + kMin;
+        const int16_t *py = pIn2 + (n - kMin);
+        int32_t sum = 0;
+
+        uint32_t k = count >> 1U;
+        while (k > 0U) {
+            v2s _x = *((v2s *)px);       // { x[k], x[k + 1] }
+            v2s _y = *((v2s *)(py - 1)); // { y[n - k - 1], y[n - k] }
+            _y = __builtin_shuffle(_y, _y, shufflemask1);
+            sum = __SUMDOTP2(_x, _y, sum);
+            px += 2;
+            py -= 2;
+            k--;
+        }
+
+        if (count & 0x1U) {
+            sum += *px * *py;
+        }
+        S->pRes[n] = sum;
     }
 
-    plp_conv_i16s_xpulpv2(pIn1, pIn1Len, pIn2, pIn2Len, pRes);
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 /**
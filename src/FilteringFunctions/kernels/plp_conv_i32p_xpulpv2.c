@@ -42,66 +42,69 @@
 /**
    @brief Parallel convolution of 32-bit integer vectors kernel for XPULPV2 extension.
    @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
-   plp_conv_i32_parallel
-   @return        none */
+                              plp_conv_i32_parallel
+   @return        none
+
+   @par
+   Every core computes a contiguous range of the output samples directly (owner computes), as
+   given by plp_conv_parallel_range. Hence, the partial results need not be overlap-added
+   afterwards and the kernel only needs a single fork.
+*/
 
-// Pre-condition: psrcALen >= psrcBLen, established by calling function plp_conv_i32
 // Pre-condition: pRes has enough allocated memory, i.e. srcALen + srcBLen-1u
-// Pre-condition: srcALen >= 2 and srcBLen >= 2, otherwise use vector dot product
 
 void plp_conv_i32p_xpulpv2(void *task_args) {
 
     plp_conv_instance_i32 *S = (plp_conv_instance_i32 *)task_args;
 
-    int32_t resultoffset = ((S->srcALen + S->nPE - 1) / S->nPE) + S->srcBLen - 1;
-    int32_t srcAoffset = ((S->srcALen + S->nPE - 1) / S->nPE);
-
-    int32_t *pSrcA;
-    uint32_t srcALen;
-    int32_t *pSrcB;
-    uint32_t srcBLen;
-    int32_t *pRes;
-
-    int32_t *pIn1;
-    int32_t *pIn2;
-    uint32_t pIn1Len;
-    uint32_t pIn2Len;
-
-    // Unpack partial convolution vectors
-
-    if (rt_core_id() == (S->nPE - 1)) {
-
-        pSrcA = (int32_t *)((S->pSrcA + srcAoffset * (S->nPE - 1)));
-        srcALen = S->srcALen - (srcAoffset * (S->nPE - 1));
-        pSrcB = (int32_t *)(S->pSrcB);
-        srcBLen = S->srcBLen;
-        pRes = (int32_t *)(S->pRes + resultoffset * (S->nPE - 1));
+    const int32_t *pIn1;
+    const int32_t *pIn2;
+    uint32_t in1Len;
+    uint32_t in2Len;
 
+    // Reorder vectors; longest first
+    if (S->srcALen >= S->srcBLen) {
+        pIn1 = S->pSrcA;
+        in1Len = S->srcALen;
+        pIn2 = S->pSrcB;
+        in2Len = S->srcBLen;
     } else {
-
-        srcALen = srcAoffset;
-        pSrcA = (int32_t *)(S->pSrcA + (rt_core_id() * srcAoffset));
-        pSrcB = (int32_t *)S->pSrcB;
-        srcBLen = S->srcBLen;
-        pRes = (int32_t *)(S->pRes + resultoffset * (rt_core_id()));
+        pIn1 = S->pSrcB;
+        in1Len = S->srcBLen;
+        pIn2 = S->pSrcA;
+        in2Len = S->srcALen;
     }
 
-    // Reorder vectors; longest first
-
-    if (srcALen >= srcBLen) {
-        pIn1 = pSrcA;
-        pIn1Len = srcALen;
-        pIn2 = pSrcB;
-        pIn2Len = srcBLen;
-    } else {
-        pIn1 = pSrcB;
-        pIn1Len = srcBLen;
-        pIn2 = pSrcA;
-        pIn2Len = srcALen;
+    uint32_t start, end;
+    plp_conv_parallel_range(in1Len, in2Len, S->nPE, plp_core_id(), &start, &end);
+
+    for (uint32_t n = start; n < end; n++) {
+
+        // res[n] = sum_k x[k] * y[n - k], for all k with valid indices into both vectors
+        uint32_t kMin = (n >= in2Len) ? n - (in2Len - 1) : 0;
+        uint32_t kMax = (n < in1Len) ? n : in1Len - 1;
+        uint32_t count = kMax - kMin + 1;
+
+        const int32_t *px = pIn1 + kMin;
+        const int32_t *py = pIn2 + (n - kMin);
+        int32_t sum = 0;
+
+        uint32_t k = count >> 1U;
+        while (k > 0U) {
+            sum += px[0] * py[0];
+            sum += px[1] * py[-1];
+            px += 2;
+            py -= 2;
+            k--;
+        }
+
+        if (count & 0x1U) {
+            sum += *px * *py;
+        }
+        S->pRes[n] = sum;
     }
 
-    plp_conv_i32s_xpulpv2(pIn1, pIn1Len, pIn2, pIn2Len, pRes);
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 /**
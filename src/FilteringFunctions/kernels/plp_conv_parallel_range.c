@@ -0,0 +1,125 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_parallel_range.c
+ * Description:  Partitioning of the convolution output among the cores
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Number of multiply-accumulate operations required to compute the first n outputs of
+          the convolution.
+   @param[in]  n        Number of outputs
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  srcBLen  Length of the shorter input vector
+   @return     Number of multiply-accumulate operations
+*/
+
+static uint32_t plp_conv_work(uint32_t n, uint32_t srcALen, uint32_t srcBLen) {
+
+    uint32_t resLen = srcALen + srcBLen - 1;
+
+    if (n < srcBLen) {
+        // head: output i needs i + 1 MACs
+        return (n * (n + 1)) >> 1;
+    } else if (n <= srcALen) {
+        // middle: every output needs srcBLen MACs
+        return (((srcBLen - 1) * srcBLen) >> 1) + (n - srcBLen + 1) * srcBLen;
+    } else {
+        // tail: symmetric to the head
+        uint32_t m = resLen - n;
+        return srcALen * srcBLen - ((m * (m + 1)) >> 1);
+    }
+}
+
+/**
+   @brief Range of output samples of the convolution, which is computed by one core.
+   @param[in]  srcALen  Length of the longer input vector
+   @param[in]  srcBLen  Length of the shorter input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[in]  coreId   Id of the core
+   @param[out] pStart   First output sample of the core
+   @param[out] pEnd     One after the last output sample of the core
+   @return     none
+
+   @par
+   The output is split such that every core performs the same number of multiply-accumulate
+   operations (up to one output sample), taking into account that the outputs at the beginning
+   and the end of the result need less operations than the ones in the middle. Every output sample
+   is owned by exactly one core, such that the results can be written to the output vector
+   directly, without any reduction among the cores.
+*/
+
+void plp_conv_parallel_range(uint32_t srcALen,
+                             uint32_t srcBLen,
+                             uint32_t nPE,
+                             uint32_t coreId,
+                             uint32_t *pStart,
+                             uint32_t *pEnd) {
+
+    uint32_t resLen = srcALen + srcBLen - 1;
+    uint32_t total = srcALen * srcBLen;
+    uint32_t bounds[2];
+
+    for (uint32_t i = 0; i < 2; i++) {
+        uint32_t part = coreId + i;
+
+        if (part >= nPE) {
+            bounds[i] = resLen;
+            continue;
+        }
+
+        // find the first output for which the work done so far exceeds the share of the previous
+        // cores
+        uint32_t target = (total / nPE) * part + ((total % nPE) * part) / nPE;
+        uint32_t lo = 0;
+        uint32_t hi = resLen;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) >> 1;
+            if (plp_conv_work(mid, srcALen, srcBLen) < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        bounds[i] = lo;
+    }
+
+    *pStart = bounds[0];
+    *pEnd = bounds[1];
+}
+
+/**
+   @} end of BasicConvolutionKernels
+*/
@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_i32s_rv32im.c
+ * Description:  32-bit integer singlecore convolution (valid) for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup BasicConvolution
+ */
+
+/**
+ * @addtogroup BasicConvolutionKernels
+ * @{
+ */
+
+/**
+ * @brief Convolution (valid) of 32-bit integer vectors kernel for RV32IM extension.
+ * @param[in]  pSrcA   points to the first input vector
+ * @param[in]  srcALen Length of the first input vector
+ * @param[in]  pSrcB   points to the second input vector
+ * @param[in]  srcBLen Length of the second input vector
+ * @param[out] pRes    output result returned here, of size srcALen - srcBLen + 1
+ * @return     none
+ *
+ * @par
+ * Only the srcALen - srcBLen + 1 outputs in which both vectors overlap completely are computed.
+ */
+
+// Pre-condition: srcALen >= srcBLen, established by the calling function
+
+void plp_conv_valid_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes) {
+
+    const int32_t *px;                                // intermediate input a pointer
+    const int32_t *py;                                // intermediate input b pointer
+    const int32_t *pSrcBEnd = pSrcB + (srcBLen - 1U); // last element of input b
+    int32_t *pOut = pRes;                             // output pointer
+    uint32_t resLen = srcALen - srcBLen + 1U;         // number of outputs
+    uint32_t count = 0U;                              // index of the current output
+    uint32_t k, blkCnt;                               // loop counters
+    int32_t sum;                                      // accumulator
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    int32_t acc0, acc1, acc2, acc3; // accumulators
+    int32_t x0, x1, x2, x3, c0;     // inputs of the four outputs and the current tap
+
+    // compute 4 outputs at a time, every sample of input b is loaded once for all four outputs
+    blkCnt = resLen >> 2U;
+    while (blkCnt > 0U) {
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        px = pSrcA + count;
+        py = pSrcBEnd;
+
+        x0 = *px++;
+        x1 = *px++;
+        x2 = *px++;
+
+        k = srcBLen;
+        while (k > 0U) {
+            c0 = *py--;
+            x3 = *px++;
+
+            acc0 += x0 * c0;
+            acc1 += x1 * c0;
+            acc2 += x2 * c0;
+            acc3 += x3 * c0;
+
+            // reuse the present samples for the next tap
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            k--;
+        }
+
+        *pOut++ = acc0;
+        *pOut++ = acc1;
+        *pOut++ = acc2;
+        *pOut++ = acc3;
+
+        count += 4U;
+        blkCnt--;
+    }
+
+    // compute the remaining outputs
+    blkCnt = resLen % 0x4U;
+
+#else
+
+    blkCnt = resLen;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        sum = 0;
+
+        px = pSrcA + count;
+        py = pSrcBEnd;
+
+        k = srcBLen;
+        while (k > 0U) {
+            sum += *px++ * *py--;
+            k--;
+        }
+
+        *pOut++ = sum;
+
+        count++;
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels
+*/
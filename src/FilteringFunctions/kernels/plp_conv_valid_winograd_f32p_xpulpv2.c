@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_winograd_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point Winograd convolution kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup WinogradConv
+*/
+
+/**
+   @addtogroup WinogradConvKernels
+   @{
+*/
+
+/**
+   @brief Parallel valid 2D convolution of 32-bit floating-point images with a 3-tap or 3x3 filter
+   kernel with the Winograd algorithm, kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv_valid_winograd_parallel_instance_f32 struct
+                          initialized by plp_conv_valid_winograd_f32_parallel
+   @return     none
+
+   @par
+   The output tiles of the Winograd algorithm (2 or 2x2 pixels) are distributed over the cores
+   with plp_mat_partition, such that only the cores at the border of the image compute an odd
+   row or column. Every core runs the single-core kernel on its part of the image.
+*/
+
+void plp_conv_valid_winograd_f32p_xpulpv2(void *task_args) {
+
+    plp_conv_valid_winograd_parallel_instance_f32 *a =
+        (plp_conv_valid_winograd_parallel_instance_f32 *)task_args;
+
+    const plp_conv_winograd_instance_f32 *S = a->S;
+    uint32_t kH = S->kH;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t outH, outW;                 // size of the output image
+    uint32_t tileH;                      // height of the Winograd tiles
+    uint32_t yStart, yEnd, xStart, xEnd; // part of the output image of this core
+    plp_mat_tile tile;
+
+    if (a->srcH < kH || a->srcW < 3) {
+        plp_team_barrier();
+        return;
+    }
+    outH = a->srcH - kH + 1;
+    outW = a->srcW - 2;
+    tileH = (kH == 1) ? 1 : 2;
+
+    plp_mat_partition((outH + tileH - 1) / tileH, (outW + 1) >> 1, a->nPE, plp_core_id(), &tile);
+    yStart = tile.mStart * tileH;
+    yEnd = (tile.mEnd * tileH < outH) ? tile.mEnd * tileH : outH;
+    xStart = tile.oStart * 2;
+    xEnd = (tile.oEnd * 2 < outW) ? tile.oEnd * 2 : outW;
+
+    if (yEnd > yStart && xEnd > xStart) {
+        plp_conv_valid_winograd_f32s_xpulpv2(S, a->pSrc + yStart * strideSrc + xStart,
+                                             yEnd - yStart + kH - 1, xEnd - xStart + 2, strideSrc,
+                                             strideDst, a->pDst + yStart * strideDst + xStart);
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of WinogradConvKernels group
+*/
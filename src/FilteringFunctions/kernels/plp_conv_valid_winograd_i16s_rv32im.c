@@ -0,0 +1,178 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_winograd_i16s_rv32im.c
+ * Description:  16-bit integer Winograd convolution kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup WinogradConv
+*/
+
+/**
+   @defgroup WinogradConvKernels Winograd Convolution Kernels
+   Kernels of the Winograd convolution. The input tile of F(2x2,3x3) is transformed with
+   B^T d B, multiplied element-wise with the transformed kernel, and transformed back with
+   A^T m A, where B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1] and A^T = [1 1 1 0; 0 1 -1 -1].
+   Every transform is done first along the rows and then along the columns, with additions and
+   subtractions only. F(2,3) uses the same transforms on a single row.
+*/
+
+/**
+   @addtogroup WinogradConvKernels
+   @{
+*/
+
+/**
+   @brief Valid 2D convolution of 16-bit integer images with a 3-tap or 3x3 filter kernel with the
+   Winograd algorithm, kernel for RV32IM extension.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_i16
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+
+   @par
+   Along a row, the last two input samples of a tile are the first two of the next one, and are
+   kept in registers for the 3-tap filter.
+*/
+
+void plp_conv_valid_winograd_i16s_rv32im(const plp_conv_winograd_instance_i16 *S,
+                                         const int16_t *__restrict__ pSrc,
+                                         uint32_t srcH,
+                                         uint32_t srcW,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         int32_t *__restrict__ pDst) {
+
+    uint32_t kH = S->kH;
+    const int16_t *pK = S->pKernel;
+    const int32_t *pU = S->pCoeffs;
+    uint32_t outH, outW; // size of the output image
+    uint32_t y, x, i;    // loop counters
+
+    if (srcH < kH || srcW < 3) {
+        return;
+    }
+    outH = srcH - kH + 1;
+    outW = srcW - 2;
+
+    if (kH == 1) {
+        int32_t u0 = pU[0], u1 = pU[1], u2 = pU[2], u3 = pU[3];
+        int32_t d0, d1, d2, d3, m0, m1, m2, m3;
+
+        for (y = 0; y < outH; y++) {
+            const int16_t *pS = pSrc + y * strideSrc;
+            int32_t *pD = pDst + y * strideDst;
+
+            d2 = pS[0];
+            d3 = pS[1];
+            for (x = 0; x + 1 < outW; x += 2) {
+                d0 = d2;
+                d1 = d3;
+                d2 = pS[x + 2];
+                d3 = pS[x + 3];
+                m0 = u0 * (d0 - d2);
+                m1 = u1 * (d1 + d2);
+                m2 = u2 * (d2 - d1);
+                m3 = u3 * (d1 - d3);
+                pD[x] = (m0 + m1 + m2) >> 1;
+                pD[x + 1] = (m1 - m2 - m3) >> 1;
+            }
+
+            if (x < outW) {
+                pD[x] = (int32_t)pS[x] * pK[2] + (int32_t)pS[x + 1] * pK[1] +
+                        (int32_t)pS[x + 2] * pK[0];
+            }
+        }
+        return;
+    }
+
+    int32_t v[16], p[8], m0, m1, m2, m3;
+
+    for (y = 0; y < outH; y += 2) {
+        const int16_t *pS = pSrc + y * strideSrc;
+        int32_t *pD = pDst + y * strideDst;
+
+        if (y + 1 == outH) {
+            // the last row of an odd output height
+            for (x = 0; x < outW; x++) {
+                int32_t sum = 0;
+                for (i = 0; i < 9; i++) {
+                    sum += (int32_t)pS[(i / 3) * strideSrc + x + i % 3] * pK[8 - i];
+                }
+                pD[x] = sum;
+            }
+            break;
+        }
+
+        for (x = 0; x + 1 < outW; x += 2) {
+            // the rows of the input tile times B
+            for (i = 0; i < 4; i++) {
+                const int16_t *pR = pS + i * strideSrc + x;
+                int32_t d0 = pR[0], d1 = pR[1], d2 = pR[2], d3 = pR[3];
+                v[4 * i] = d0 - d2;
+                v[4 * i + 1] = d1 + d2;
+                v[4 * i + 2] = d2 - d1;
+                v[4 * i + 3] = d1 - d3;
+            }
+
+            // B^T times the columns, times the transformed kernel, and A^T times the columns
+            for (i = 0; i < 4; i++) {
+                m0 = pU[i] * (v[i] - v[8 + i]);
+                m1 = pU[4 + i] * (v[4 + i] + v[8 + i]);
+                m2 = pU[8 + i] * (v[8 + i] - v[4 + i]);
+                m3 = pU[12 + i] * (v[4 + i] - v[12 + i]);
+                p[i] = m0 + m1 + m2;
+                p[4 + i] = m1 - m2 - m3;
+            }
+
+            // the rows times A
+            pD[x] = (p[0] + p[1] + p[2]) >> 2;
+            pD[x + 1] = (p[1] - p[2] - p[3]) >> 2;
+            pD[strideDst + x] = (p[4] + p[5] + p[6]) >> 2;
+            pD[strideDst + x + 1] = (p[5] - p[6] - p[7]) >> 2;
+        }
+
+        if (x < outW) {
+            // the last column of an odd output width, for both rows
+            int32_t sum0 = 0, sum1 = 0;
+            for (i = 0; i < 9; i++) {
+                sum0 += (int32_t)pS[(i / 3) * strideSrc + x + i % 3] * pK[8 - i];
+                sum1 += (int32_t)pS[(i / 3 + 1) * strideSrc + x + i % 3] * pK[8 - i];
+            }
+            pD[x] = sum0;
+            pD[strideDst + x] = sum1;
+        }
+    }
+}
+
+/**
+   @} end of WinogradConvKernels group
+*/
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_i32p_xpulpv2.c
+ * Description:  Parallel 32-bit integer correlation kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+   @brief Parallel correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_i32 struct initialized by
+                          plp_correlate_i32_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous range of lags, as given by plp_conv_parallel_range. Hence,
+   the partial results need not be overlap-added afterwards.
+*/
+
+void plp_correlate_i32p_xpulpv2(void *task_args) {
+
+    plp_correlate_instance_i32 *S = (plp_correlate_instance_i32 *)task_args;
+
+    const int32_t *pIn1;
+    const int32_t *pIn2;
+    uint32_t in1Len;
+    uint32_t in2Len;
+
+    // Reorder vectors; longest first (like plp_correlate_i32s_xpulpv2)
+    if (S->srcALen > S->srcBLen) {
+        pIn1 = S->pSrcA;
+        in1Len = S->srcALen;
+        pIn2 = S->pSrcB;
+        in2Len = S->srcBLen;
+    } else {
+        pIn1 = S->pSrcB;
+        in1Len = S->srcBLen;
+        pIn2 = S->pSrcA;
+        in2Len = S->srcALen;
+    }
+
+    uint32_t start, end;
+    plp_conv_parallel_range(in1Len, in2Len, S->nPE, plp_core_id(), &start, &end);
+
+    for (uint32_t m = start; m < end; m++) {
+
+        // res[m] = sum_j x[j + m - (in2Len - 1)] * y[j], for all j with valid indices
+        uint32_t jMin = (m < in2Len - 1) ? in2Len - 1 - m : 0;
+        uint32_t jMax = (m >= in1Len) ? in1Len + in2Len - 2 - m : in2Len - 1;
+        uint32_t count = jMax - jMin + 1;
+
+        const int32_t *px = pIn1 + (jMin + m - (in2Len - 1));
+        const int32_t *py = pIn2 + jMin;
+        int32_t sum = 0;
+
+        uint32_t k = count >> 1U;
+        while (k > 0U) {
+            sum += px[0] * py[0];
+            sum += px[1] * py[1];
+            px += 2;
+            py += 2;
+            k--;
+        }
+
+        if (count & 0x1U) {
+            sum += *px * *py;
+        }
+
+        S->pRes[m] = sum;
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of BasicCorrelationKernels
+*/
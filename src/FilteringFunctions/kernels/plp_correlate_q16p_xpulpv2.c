@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point correlation kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+   @brief Parallel correlation of 16-bit fixed point vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_correlate_instance_q16 struct initialized by
+                          plp_correlate_q16_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous range of lags, as given by plp_conv_parallel_range. Every
+   product is rounded separately, such that the result is identical to plp_correlate_q16.
+*/
+
+void plp_correlate_q16p_xpulpv2(void *task_args) {
+
+    plp_correlate_instance_q16 *S = (plp_correlate_instance_q16 *)task_args;
+
+    const int16_t *pIn1;
+    const int16_t *pIn2;
+    uint32_t in1Len;
+    uint32_t in2Len;
+    uint32_t fracBits = S->fracBits;
+
+    // Reorder vectors; longest first. If the vectors are swapped, the output is reversed, such
+    // that the result is the correlation of pSrcA with pSrcB in both cases.
+    uint32_t reverse;
+    if (S->srcALen >= S->srcBLen) {
+        pIn1 = S->pSrcA;
+        in1Len = S->srcALen;
+        pIn2 = S->pSrcB;
+        in2Len = S->srcBLen;
+        reverse = 0;
+    } else {
+        pIn1 = S->pSrcB;
+        in1Len = S->srcBLen;
+        pIn2 = S->pSrcA;
+        in2Len = S->srcALen;
+        reverse = 1;
+    }
+
+    uint32_t resLen = in1Len + in2Len - 1;
+    uint32_t start, end;
+    plp_conv_parallel_range(in1Len, in2Len, S->nPE, plp_core_id(), &start, &end);
+
+    for (uint32_t m = start; m < end; m++) {
+
+        // res[m] = sum_j x[j + m - (in2Len - 1)] * y[j], for all j with valid indices
+        uint32_t jMin = (m < in2Len - 1) ? in2Len - 1 - m : 0;
+        uint32_t jMax = (m >= in1Len) ? in1Len + in2Len - 2 - m : in2Len - 1;
+        uint32_t count = jMax - jMin + 1;
+
+        const int16_t *px = pIn1 + (jMin + m - (in2Len - 1));
+        const int16_t *py = pIn2 + jMin;
+        int32_t sum = 0;
+
+        for (uint32_t k = 0; k < count; k++) {
+            sum += __ADDROUNDNORM_REG(px[k] * py[k], 0, fracBits);
+        }
+
+        if (reverse) {
+            S->pRes[resLen - 1 - m] = sum;
+        } else {
+            S->pRes[m] = sum;
+        }
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of BasicCorrelationKernels
+*/
@@ -0,0 +1,125 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q16s_xpulpv2.c
+ * Description:  16-bit fixed point FIR decimator kernel for XPULPV2 extension
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIRDecimate
+*/
+
+/**
+   @addtogroup FIRDecimateKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point FIR decimator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q16s_xpulpv2(const plp_fir_decimate_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst) {
+
+    uint32_t M = S->M;
+    uint32_t numTaps = S->numTaps;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    uint32_t outLen = blockSize / M;
+
+    uint32_t i; // loop counter
+    uint32_t o; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    // output o is the filter output at the last input sample of the o-th group of M samples
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    for (o = 0; o < outLen; o++) {
+        const int16_t *pX = pState + o * M + M - 1;
+        int32_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum += pCoeffs[k] * pX[k];
+        }
+        pDst[o] = (int16_t)__ROUNDNORM_REG(sum, fracBits);
+    }
+
+#else
+
+    for (o = 0; o + 1 < outLen; o += 2) {
+        const int16_t *pX = pState + o * M + M - 1;
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        for (k = 0; k + 1 < numTaps; k += 2) {
+            v2s c = *((v2s *)&pCoeffs[k]);
+            sum0 = __SUMDOTP2(*((v2s *)&pX[k]), c, sum0);
+            sum1 = __SUMDOTP2(*((v2s *)&pX[k + M]), c, sum1);
+        }
+        if (k < numTaps) {
+            sum0 += pCoeffs[k] * pX[k];
+            sum1 += pCoeffs[k] * pX[k + M];
+        }
+        pDst[o] = (int16_t)__ROUNDNORM_REG(sum0, fracBits);
+        pDst[o + 1] = (int16_t)__ROUNDNORM_REG(sum1, fracBits);
+    }
+    if (o < outLen) {
+        const int16_t *pX = pState + o * M + M - 1;
+        int32_t sum = 0;
+        for (k = 0; k + 1 < numTaps; k += 2) {
+            sum = __SUMDOTP2(*((v2s *)&pX[k]), *((v2s *)&pCoeffs[k]), sum);
+        }
+        if (k < numTaps) {
+            sum += pCoeffs[k] * pX[k];
+        }
+        pDst[o] = (int16_t)__ROUNDNORM_REG(sum, fracBits);
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    // keep the last numTaps - 1 samples for the next block
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRDecimateKernels group
+*/
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q32s_rv32im.c
+ * Description:  32-bit fixed point FIR decimator kernel for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIRDecimate
+*/
+
+/**
+   @defgroup FIRDecimateKernels FIR Decimator Kernels
+   This module contains the kernel codes of the FIR decimators. Each kernel appends the new input
+   block to the state buffer, computes only the outputs which are kept after the decimation, and
+   moves the last numTaps - 1 samples to the beginning of the state buffer.
+*/
+
+/**
+   @addtogroup FIRDecimateKernels
+   @{
+*/
+
+/**
+   @brief 32-bit fixed point FIR decimator kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q32s_rv32im(const plp_fir_decimate_instance_q32 *S,
+                                  const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst) {
+
+    uint32_t M = S->M;
+    uint32_t numTaps = S->numTaps;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    int32_t round = fracBits ? 1 << (fracBits - 1) : 0;
+    uint32_t outLen = blockSize / M;
+
+    uint32_t i; // loop counter
+    uint32_t o; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    // output o is the filter output at the last input sample of the o-th group of M samples
+    for (o = 0; o < outLen; o++) {
+        const int32_t *pX = pState + o * M + M - 1;
+        int32_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum += (pCoeffs[k] * pX[k] + round) >> fracBits;
+        }
+        pDst[o] = sum;
+    }
+
+    // keep the last numTaps - 1 samples for the next block
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRDecimateKernels group
+*/
@@ -0,0 +1,136 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q16s_xpulpv2.c
+ * Description:  16-bit fixed point FIR interpolator kernel for XPULPV2 extension
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIRInterpolate
+*/
+
+/**
+   @addtogroup FIRInterpolateKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point FIR interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q16s_xpulpv2(const plp_fir_interpolate_instance_q16 *S,
+                                      const int16_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pDst) {
+
+    uint32_t L = S->L;
+    uint32_t phaseLength = S->phaseLength;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+
+    uint32_t i; // loop counter
+    uint32_t n; // loop counter
+    uint32_t p; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    // phase p of the (time-reversed) coefficients is pCoeffs[L - 1 - p + k * L]
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    for (n = 0; n < blockSize; n++) {
+        const int16_t *pX = pState + n;
+        for (p = 0; p < L; p++) {
+            const int16_t *pC = pCoeffs + (L - 1 - p);
+            int32_t sum = 0;
+            for (k = 0; k < phaseLength; k++) {
+                sum += pC[k * L] * pX[k];
+            }
+            pDst[n * L + p] = (int16_t)__ROUNDNORM_REG(sum, fracBits);
+        }
+    }
+
+#else
+
+    for (n = 0; n + 1 < blockSize; n += 2) {
+        const int16_t *pX = pState + n;
+        for (p = 0; p < L; p++) {
+            const int16_t *pC = pCoeffs + (L - 1 - p);
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            for (k = 0; k + 1 < phaseLength; k += 2) {
+                v2s c = __PACK2(pC[k * L], pC[(k + 1) * L]);
+                sum0 = __SUMDOTP2(*((v2s *)&pX[k]), c, sum0);
+                sum1 = __SUMDOTP2(*((v2s *)&pX[k + 1]), c, sum1);
+            }
+            if (k < phaseLength) {
+                sum0 += pC[k * L] * pX[k];
+                sum1 += pC[k * L] * pX[k + 1];
+            }
+            pDst[n * L + p] = (int16_t)__ROUNDNORM_REG(sum0, fracBits);
+            pDst[(n + 1) * L + p] = (int16_t)__ROUNDNORM_REG(sum1, fracBits);
+        }
+    }
+    if (n < blockSize) {
+        const int16_t *pX = pState + n;
+        for (p = 0; p < L; p++) {
+            const int16_t *pC = pCoeffs + (L - 1 - p);
+            int32_t sum = 0;
+            for (k = 0; k + 1 < phaseLength; k += 2) {
+                v2s c = __PACK2(pC[k * L], pC[(k + 1) * L]);
+                sum = __SUMDOTP2(*((v2s *)&pX[k]), c, sum);
+            }
+            if (k < phaseLength) {
+                sum += pC[k * L] * pX[k];
+            }
+            pDst[n * L + p] = (int16_t)__ROUNDNORM_REG(sum, fracBits);
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    // keep the last phaseLength - 1 samples for the next block
+    for (i = 0; i < phaseLength - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRInterpolateKernels group
+*/
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q32s_xpulpv2.c
+ * Description:  32-bit fixed point FIR interpolator kernel for XPULPV2 extension
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIRInterpolate
+*/
+
+/**
+   @addtogroup FIRInterpolateKernels
+   @{
+*/
+
+/**
+   @brief 32-bit fixed point FIR interpolator kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR
+                         interpolator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the block of blockSize * L output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q32s_xpulpv2(const plp_fir_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst) {
+
+    uint32_t L = S->L;
+    uint32_t phaseLength = S->phaseLength;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+
+    uint32_t i; // loop counter
+    uint32_t n; // loop counter
+    uint32_t p; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    // phase p of the (time-reversed) coefficients is pCoeffs[L - 1 - p + k * L]
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    for (n = 0; n < blockSize; n++) {
+        const int32_t *pX = pState + n;
+        for (p = 0; p < L; p++) {
+            const int32_t *pC = pCoeffs + (L - 1 - p);
+            int32_t sum = 0;
+            for (k = 0; k < phaseLength; k++) {
+                sum += __ROUNDNORM_REG(pC[k * L] * pX[k], fracBits);
+            }
+            pDst[n * L + p] = sum;
+        }
+    }
+
+#else
+
+    for (n = 0; n + 1 < blockSize; n += 2) {
+        const int32_t *pX = pState + n;
+        for (p = 0; p < L; p++) {
+            const int32_t *pC = pCoeffs + (L - 1 - p);
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            for (k = 0; k < phaseLength; k++) {
+                int32_t c = pC[k * L];
+                sum0 += __ROUNDNORM_REG(c * pX[k], fracBits);
+                sum1 += __ROUNDNORM_REG(c * pX[k + 1], fracBits);
+            }
+            pDst[n * L + p] = sum0;
+            pDst[(n + 1) * L + p] = sum1;
+        }
+    }
+    if (n < blockSize) {
+        const int32_t *pX = pState + n;
+        for (p = 0; p < L; p++) {
+            const int32_t *pC = pCoeffs + (L - 1 - p);
+            int32_t sum = 0;
+            for (k = 0; k < phaseLength; k++) {
+                sum += __ROUNDNORM_REG(pC[k * L] * pX[k], fracBits);
+            }
+            pDst[n * L + p] = sum;
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    // keep the last phaseLength - 1 samples for the next block
+    for (i = 0; i < phaseLength - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRInterpolateKernels group
+*/
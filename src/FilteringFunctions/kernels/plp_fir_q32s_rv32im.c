@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q32s_rv32im.c
+ * Description:  32-bit fixed point FIR filter kernel for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @defgroup FIRKernels FIR Filter Kernels
+   This module contains the kernel codes of the stateful FIR filters. Each kernel appends the new
+   input block to the state buffer, computes the filter outputs from the delay line and moves the
+   last numTaps - 1 samples to the beginning of the state buffer.
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/**
+   @brief 32-bit fixed point FIR filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_fir_q32s_rv32im(const plp_fir_instance_q32 *S,
+                         const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst) {
+
+    uint32_t numTaps = S->numTaps;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    int32_t round = fracBits ? 1 << (fracBits - 1) : 0;
+
+    uint32_t i; // loop counter
+    uint32_t n; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line, unless they are already in it (plp_udma_stream)
+    if (pSrc != pState + numTaps - 1) {
+        for (i = 0; i < blockSize; i++) {
+            pState[numTaps - 1 + i] = pSrc[i];
+        }
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const int32_t *pX = pState + n;
+        int32_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum += (pCoeffs[k] * pX[k] + round) >> fracBits;
+        }
+        pDst[n] = sum;
+    }
+
+    // keep the last numTaps - 1 samples for the next block
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
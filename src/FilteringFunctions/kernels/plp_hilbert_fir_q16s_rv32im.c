@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_q16s_rv32im.c
+ * Description:  16-bit fixed point Hilbert FIR filter kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup HilbertFIR
+*/
+
+/**
+   @defgroup HilbertFIRKernels Hilbert FIR Filter Kernels
+   This module contains the kernel codes of the Hilbert FIR filters. Each kernel appends the even
+   and the odd samples of the new input block to the two delay lines, computes the outputs n from
+   the delay line of the phase of n with the nonzero coefficients only, and moves the last
+   (numTaps - 1) / 2 samples of both delay lines to their beginning.
+*/
+
+/**
+   @addtogroup HilbertFIRKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point Hilbert FIR filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point Hilbert FIR
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process, even
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_hilbert_fir_q16s_rv32im(const plp_hilbert_fir_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pDst) {
+
+    uint32_t numCoeffs = (S->numTaps + 1) / 2;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pEven = S->pState;
+    int16_t *pOdd = S->pStateOdd;
+    uint32_t fracBits = S->fracBits;
+    uint32_t half = blockSize / 2;
+
+    uint32_t i; // loop counter
+    uint32_t n; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay lines of the even and the odd samples
+    for (i = 0; i < half; i++) {
+        pEven[numCoeffs - 1 + i] = pSrc[2 * i];
+        pOdd[numCoeffs - 1 + i] = pSrc[2 * i + 1];
+    }
+
+    for (n = 0; n < half; n++) {
+        const int16_t *pXe = pEven + n;
+        const int16_t *pXo = pOdd + n;
+        int32_t sumEven = 0;
+        int32_t sumOdd = 0;
+        for (k = 0; k < numCoeffs; k++) {
+            sumEven += pCoeffs[k] * pXe[k];
+            sumOdd += pCoeffs[k] * pXo[k];
+        }
+        pDst[2 * n] = (int16_t)__ROUNDNORM_REG(sumEven, fracBits);
+        pDst[2 * n + 1] = (int16_t)__ROUNDNORM_REG(sumOdd, fracBits);
+    }
+
+    // keep the last numCoeffs - 1 samples of both phases for the next block
+    for (i = 0; i < numCoeffs - 1; i++) {
+        pEven[i] = pEven[half + i];
+        pOdd[i] = pOdd[half + i];
+    }
+}
+
+/**
+   @} end of HilbertFIRKernels group
+*/
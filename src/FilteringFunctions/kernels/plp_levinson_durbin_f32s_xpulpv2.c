@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_levinson_durbin_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Levinson-Durbin recursion kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LevinsonDurbin
+*/
+
+/**
+   @defgroup LevinsonDurbinKernels Levinson-Durbin Recursion Kernels
+   This module contains the kernel codes of the Levinson-Durbin recursion.
+*/
+
+/**
+   @addtogroup LevinsonDurbinKernels
+   @{
+*/
+
+/**
+   @brief Levinson-Durbin recursion of 32-bit floating-point values kernel for XPULPV2 extension.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+
+int plp_levinson_durbin_f32s_xpulpv2(const float32_t *__restrict__ pPhi,
+                                     uint32_t order,
+                                     float32_t *__restrict__ pA,
+                                     float32_t *__restrict__ pRefl,
+                                     float32_t *__restrict__ pErr) {
+
+    uint32_t n, j;
+    float32_t err = pPhi[0]; // error energy of the predictor of order n
+    float32_t acc, k, t1, t2;
+
+    if (!(err > 0.0f)) {
+        return 1;
+    }
+
+    for (n = 0; n < order; n++) {
+        acc = pPhi[n + 1];
+        for (j = 0; j < n; j++) {
+            acc -= pA[j] * pPhi[n - j];
+        }
+        k = acc / err;
+
+        // coefficients j and n - 1 - j are updated with each other's old value
+        for (j = 0; j < n / 2; j++) {
+            t1 = pA[j];
+            t2 = pA[n - 1 - j];
+            pA[j] = t1 - k * t2;
+            pA[n - 1 - j] = t2 - k * t1;
+        }
+        if (n % 2 == 1) {
+            pA[n / 2] -= k * pA[n / 2];
+        }
+        pA[n] = k;
+        pRefl[n] = k;
+
+        err *= 1.0f - k * k;
+        if (!(err > 0.0f)) {
+            return 1;
+        }
+    }
+
+    *pErr = err;
+
+    return 0;
+}
+
+/**
+   @} end of LevinsonDurbinKernels group
+*/
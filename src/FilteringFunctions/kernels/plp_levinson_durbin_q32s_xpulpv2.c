@@ -0,0 +1,153 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_levinson_durbin_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point Levinson-Durbin recursion kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LevinsonDurbin
+*/
+
+/**
+   @addtogroup LevinsonDurbinKernels
+   @{
+*/
+
+/* x >> shift rounded to nearest, or x << -shift, saturated to 32 bits */
+static inline int32_t plp_levinson_durbin_q32_norm_xpulpv2(int64_t x, int32_t shift) {
+    if (shift > 62) {
+        return 0;
+    } else if (shift > 0) {
+        x = (x + ((int64_t)1 << (shift - 1))) >> shift;
+    } else if (shift < 0) {
+        if (x > (INT32_MAX >> -shift)) {
+            return INT32_MAX;
+        } else if (x < (INT32_MIN >> -shift)) {
+            return INT32_MIN;
+        }
+        x = x * ((int64_t)1 << -shift);
+    }
+    if (x > INT32_MAX) {
+        return INT32_MAX;
+    } else if (x < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)x;
+}
+
+/**
+   @brief Levinson-Durbin recursion of 32-bit fixed point values kernel for XPULPV2 extension.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[in]  fracBits   number of fractional bits of the coefficients, 0 to 31
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy, in the format of pPhi
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+
+   @par Block scaling
+   The autocorrelation is scaled by a power of two, such that phi[0] is in [2^30, 2^31), which
+   keeps the precision independent of the magnitude of the signal. The prediction coefficients are
+   computed in Q27 (they saturate at 16 in magnitude) and the reflection coefficients in Q30.
+*/
+
+int plp_levinson_durbin_q32s_xpulpv2(const int64_t *__restrict__ pPhi,
+                                     uint32_t order,
+                                     uint32_t fracBits,
+                                     int32_t *__restrict__ pA,
+                                     int32_t *__restrict__ pRefl,
+                                     int64_t *__restrict__ pErr) {
+
+    uint32_t n, j;
+    int32_t shift; // block scaling of the autocorrelation
+    int64_t err;   // error energy of the predictor of order n
+    int64_t acc;
+    int32_t k, t1, t2;
+
+    if (fracBits > 31) {
+        return 2;
+    }
+
+    if (pPhi[0] <= 0) {
+        return 1;
+    }
+
+    shift = (63 - (int32_t)__builtin_clzll(pPhi[0])) - 30;
+    err = plp_levinson_durbin_q32_norm_xpulpv2(pPhi[0], shift);
+
+    for (n = 0; n < order; n++) {
+        acc = plp_levinson_durbin_q32_norm_xpulpv2(pPhi[n + 1], shift);
+        for (j = 0; j < n; j++) {
+            int32_t phi = plp_levinson_durbin_q32_norm_xpulpv2(pPhi[n - j], shift);
+            acc -= ((int64_t)pA[j] * phi) >> 27;
+        }
+
+        // the reflection coefficient must be smaller than 1 in magnitude
+        if (acc >= err || -acc >= err) {
+            return 1;
+        }
+        k = (int32_t)(acc * ((int64_t)1 << 30) / err);
+
+        // coefficients j and n - 1 - j are updated with each other's old value, in Q27
+        for (j = 0; j < n / 2; j++) {
+            t1 = pA[j];
+            t2 = pA[n - 1 - j];
+            pA[j] = plp_levinson_durbin_q32_norm_xpulpv2(
+                (int64_t)t1 - (((int64_t)k * t2 + (1 << 29)) >> 30), 0);
+            pA[n - 1 - j] = plp_levinson_durbin_q32_norm_xpulpv2(
+                (int64_t)t2 - (((int64_t)k * t1 + (1 << 29)) >> 30), 0);
+        }
+        if (n % 2 == 1) {
+            t1 = pA[n / 2];
+            pA[n / 2] = plp_levinson_durbin_q32_norm_xpulpv2(
+                (int64_t)t1 - (((int64_t)k * t1 + (1 << 29)) >> 30), 0);
+        }
+        pA[n] = plp_levinson_durbin_q32_norm_xpulpv2(k, 3);
+        pRefl[n] = plp_levinson_durbin_q32_norm_xpulpv2(k, 30 - (int32_t)fracBits);
+
+        err -= (err * plp_levinson_durbin_q32_norm_xpulpv2((int64_t)k * k, 30)) >> 30;
+        if (err <= 0) {
+            return 1;
+        }
+    }
+
+    for (j = 0; j < order; j++) {
+        pA[j] = plp_levinson_durbin_q32_norm_xpulpv2(pA[j], 27 - (int32_t)fracBits);
+    }
+
+    if (shift >= 0) {
+        *pErr = err * ((int64_t)1 << shift);
+    } else {
+        *pErr = (err + ((int64_t)1 << (-shift - 1))) >> -shift;
+    }
+
+    return 0;
+}
+
+/**
+   @} end of LevinsonDurbinKernels group
+*/
@@ -0,0 +1,173 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_f32s_xpulpv2.c
+ * Description:  32-bit floating-point normalized LMS filter kernel for XPULPV2 extension
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define LMS_NORM_DELTA_F32 0.000001f
+
+/**
+   @ingroup LMS
+*/
+
+/**
+   @addtogroup LMSKernels
+   @{
+*/
+
+/**
+   @brief 32-bit floating-point normalized LMS filter kernel for XPULPV2 extension.
+   @param[in]  S         points to an initialized instance of the 32-bit floating-point normalized
+                         LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_norm_f32s_xpulpv2(const plp_lms_norm_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               const float32_t *__restrict__ pRef,
+                               float32_t *__restrict__ pOut,
+                               float32_t *__restrict__ pErr,
+                               uint32_t blockSize) {
+
+    uint32_t numTaps = S->numTaps;
+    float32_t *pCoeffs = S->pCoeffs;
+    float32_t *pState = S->pState;
+    float32_t mu = S->mu;
+
+    uint32_t i; // loop counter
+    uint32_t n; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    float32_t muE = 0; // normalized mu * e of the last processed sample
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    // energy of the input window of the first sample
+    float32_t energy = 0;
+    for (k = 0; k < numTaps; k++) {
+        energy += pState[k] * pState[k];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const float32_t *pX = pState + n;
+        float32_t sum = 0;
+
+        for (k = 0; k < numTaps; k++) {
+            sum += pCoeffs[k] * pX[k];
+        }
+
+        float32_t e = pRef[n] - sum;
+        pOut[n] = sum;
+        pErr[n] = e;
+        muE = mu * e / (energy + LMS_NORM_DELTA_F32);
+
+        for (k = 0; k < numTaps; k++) {
+            float32_t c = pCoeffs[k] + muE * pX[k];
+            pCoeffs[k] = c;
+        }
+
+        // move the energy to the input window of the next sample
+        if (n + 1 < blockSize) {
+            float32_t xIn = pState[n + numTaps];
+            float32_t xOut = pState[n];
+            energy += xIn * xIn - xOut * xOut;
+        }
+    }
+
+#else
+
+    // energy of the input window of the first sample
+    float32_t energy = 0;
+    for (k = 0; k < numTaps; k++) {
+        energy += pState[k] * pState[k];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const float32_t *pX = pState + n;
+        float32_t sum = 0;
+
+        if (n == 0) {
+            // no coefficient update is pending before the first sample
+            for (k = 0; k < numTaps; k++) {
+                sum += pCoeffs[k] * pX[k];
+            }
+        } else {
+            // apply the update of the previous sample (input window pXPrev) and filter the current
+            // sample with the updated coefficients, in the same pass over the coefficients
+            const float32_t *pXPrev = pX - 1;
+            for (k = 0; k < numTaps; k++) {
+                float32_t c = pCoeffs[k] + muE * pXPrev[k];
+                pCoeffs[k] = c;
+                sum += c * pX[k];
+            }
+        }
+
+        float32_t e = pRef[n] - sum;
+        pOut[n] = sum;
+        pErr[n] = e;
+        muE = mu * e / (energy + LMS_NORM_DELTA_F32);
+
+        // move the energy to the input window of the next sample
+        if (n + 1 < blockSize) {
+            float32_t xIn = pState[n + numTaps];
+            float32_t xOut = pState[n];
+            energy += xIn * xIn - xOut * xOut;
+        }
+    }
+
+    // apply the update of the last sample
+    if (blockSize > 0) {
+        const float32_t *pX = pState + blockSize - 1;
+        for (k = 0; k < numTaps; k++) {
+            float32_t c = pCoeffs[k] + muE * pX[k];
+            pCoeffs[k] = c;
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    // keep the last numTaps - 1 samples for the next block
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of LMSKernels group
+*/
@@ -0,0 +1,137 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q16s_rv32im.c
+ * Description:  16-bit fixed point normalized LMS filter kernel for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LMS
+*/
+
+/**
+   @addtogroup LMSKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point normalized LMS filter kernel for RV32IM.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point normalized LMS
+                         filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples
+   @param[in]  blockSize Number of samples to process
+   @return     none
+*/
+
+void plp_lms_norm_q16s_rv32im(const plp_lms_norm_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              const int16_t *__restrict__ pRef,
+                              int16_t *__restrict__ pOut,
+                              int16_t *__restrict__ pErr,
+                              uint32_t blockSize) {
+
+    uint32_t numTaps = S->numTaps;
+    int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    int32_t mu = S->mu;
+    uint32_t fracBits = S->fracBits;
+    int32_t round = fracBits ? 1 << (fracBits - 1) : 0;
+
+    uint32_t i; // loop counter
+    uint32_t n; // loop counter
+    uint32_t k; // loop counter
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    int32_t muE = 0; // normalized mu * e of the last processed sample
+
+    // energy of the input window of the first sample
+    int32_t energy = 0;
+    for (k = 0; k < numTaps; k++) {
+        energy += ((pState[k] * pState[k] + round) >> fracBits);
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const int16_t *pX = pState + n;
+        int32_t sum = 0;
+
+        if (n == 0) {
+            // no coefficient update is pending before the first sample
+            for (k = 0; k < numTaps; k++) {
+                sum += pCoeffs[k] * pX[k];
+            }
+        } else {
+            // apply the update of the previous sample (input window pXPrev) and filter the current
+            // sample with the updated coefficients, in the same pass over the coefficients
+            const int16_t *pXPrev = pX - 1;
+            for (k = 0; k < numTaps; k++) {
+                int32_t c = pCoeffs[k] + ((muE * pXPrev[k] + round) >> fracBits);
+                c = (c > 32767) ? 32767 : ((c < -32768) ? -32768 : c);
+                pCoeffs[k] = c;
+                sum += c * pX[k];
+            }
+        }
+
+        int16_t y = (int16_t)((sum + round) >> fracBits);
+        int32_t e = pRef[n] - y;
+        e = (e > 32767) ? 32767 : ((e < -32768) ? -32768 : e);
+        pOut[n] = y;
+        pErr[n] = (int16_t)e;
+        muE = (mu * e) / (energy + 1);
+
+        // move the energy to the input window of the next sample
+        if (n + 1 < blockSize) {
+            int32_t xIn = pState[n + numTaps];
+            int32_t xOut = pState[n];
+            energy += ((xIn * xIn + round) >> fracBits) - ((xOut * xOut + round) >> fracBits);
+        }
+    }
+
+    // apply the update of the last sample
+    if (blockSize > 0) {
+        const int16_t *pX = pState + blockSize - 1;
+        for (k = 0; k < numTaps; k++) {
+            int32_t c = pCoeffs[k] + ((muE * pX[k] + round) >> fracBits);
+            c = (c > 32767) ? 32767 : ((c < -32768) ? -32768 : c);
+            pCoeffs[k] = c;
+        }
+    }
+
+    // keep the last numTaps - 1 samples for the next block
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of LMSKernels group
+*/
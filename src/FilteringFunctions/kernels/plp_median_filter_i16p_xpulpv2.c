@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16p_xpulpv2.c
+ * Description:  16-bit integer parallel median filter kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MedianFilter
+*/
+
+/**
+   @addtogroup MedianFilterKernels
+   @{
+*/
+
+/**
+   @brief Parallel 16-bit integer median filter kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_median_filter_instance_i16 struct initialized by
+                     plp_median_filter_i16_parallel
+   @return     none
+
+   @par
+   The output is split into one contiguous segment per core, of an even number of samples.
+   The windows at the borders of a segment read the input samples of the neighbouring segments,
+   hence the result is identical to the one of plp_median_filter_i16.
+*/
+void plp_median_filter_i16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_median_filter_instance_i16 *a = (plp_median_filter_instance_i16 *)args;
+
+    const int16_t *pSrc = a->pSrc;
+    uint32_t blockSize = a->blockSize;
+    uint32_t numTaps = a->numTaps;
+    uint32_t nPE = a->nPE;
+    int16_t *pDst = a->pDst;
+
+    /* even segments, such that the SIMD kernel computes pairs of outputs */
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 1) & ~1U;
+    uint32_t start = core_id * chunk;
+    uint32_t end = (start + chunk < blockSize) ? start + chunk : blockSize;
+
+    if (start < end) {
+        plp_median_filter_i16s_xpulpv2(pSrc, blockSize, numTaps, start, end, pDst);
+    }
+}
+
+/**
+   @} end of MedianFilterKernels group
+*/
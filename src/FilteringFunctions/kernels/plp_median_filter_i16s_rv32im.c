@@ -0,0 +1,152 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16s_rv32im.c
+ * Description:  16-bit integer median filter kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MedianFilter
+*/
+
+/**
+   @defgroup MedianFilterKernels Median Filter Kernels
+   This module contains the kernel functions of the median filters. The kernels compute a range of
+   the output samples, such that the parallel kernels can split the output among the cores.
+*/
+
+/* compare and exchange, such that a <= b */
+#define PLP_MEDIAN_SORT(a, b)                                                                      \
+    {                                                                                              \
+        int16_t t = (a);                                                                           \
+        (a) = ((b) < t) ? (b) : t;                                                                 \
+        (b) = ((b) < t) ? t : (b);                                                                 \
+    }
+
+static inline int16_t plp_median_i16(int16_t *w, uint32_t numTaps) {
+
+    switch (numTaps) {
+    case 1:
+        return w[0];
+    case 3:
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        return w[1];
+    case 5:
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        PLP_MEDIAN_SORT(w[3], w[4]);
+        PLP_MEDIAN_SORT(w[0], w[3]);
+        PLP_MEDIAN_SORT(w[1], w[4]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[2], w[3]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        return w[2];
+    case 9:
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[4], w[5]);
+        PLP_MEDIAN_SORT(w[7], w[8]);
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        PLP_MEDIAN_SORT(w[3], w[4]);
+        PLP_MEDIAN_SORT(w[6], w[7]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[4], w[5]);
+        PLP_MEDIAN_SORT(w[7], w[8]);
+        PLP_MEDIAN_SORT(w[0], w[3]);
+        PLP_MEDIAN_SORT(w[5], w[8]);
+        PLP_MEDIAN_SORT(w[4], w[7]);
+        PLP_MEDIAN_SORT(w[3], w[6]);
+        PLP_MEDIAN_SORT(w[1], w[4]);
+        PLP_MEDIAN_SORT(w[2], w[5]);
+        PLP_MEDIAN_SORT(w[4], w[7]);
+        PLP_MEDIAN_SORT(w[4], w[2]);
+        PLP_MEDIAN_SORT(w[6], w[4]);
+        PLP_MEDIAN_SORT(w[4], w[2]);
+        return w[4];
+    default: {
+        /* partial selection sort up to the middle */
+        uint32_t i, j;
+        for (i = 0; i <= numTaps / 2; i++) {
+            for (j = i + 1; j < numTaps; j++) {
+                PLP_MEDIAN_SORT(w[i], w[j]);
+            }
+        }
+        return w[numTaps / 2];
+    }
+    }
+}
+
+/**
+   @addtogroup MedianFilterKernels
+   @{
+*/
+
+/**
+   @brief 16-bit integer median filter kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  start     First output sample to compute
+   @param[in]  end       One after the last output sample to compute
+   @param[out] pDst      points to the output vector, of which pDst[start] to pDst[end - 1] are
+                         written
+   @return     none
+*/
+void plp_median_filter_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t numTaps,
+                                   uint32_t start,
+                                   uint32_t end,
+                                   int16_t *__restrict__ pDst) {
+
+    int16_t w[PLP_MEDIAN_FILTER_MAX_TAPS];
+    uint32_t h = numTaps / 2;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = start; n < end; n++) {
+        if (n >= h && n + h < blockSize) {
+            for (k = 0; k < numTaps; k++) {
+                w[k] = pSrc[n - h + k];
+            }
+        } else {
+            /* replicate the first and the last sample at the edges */
+            for (k = 0; k < numTaps; k++) {
+                int32_t i = (int32_t)(n + k) - (int32_t)h;
+                i = (i < 0) ? 0 : ((i >= (int32_t)blockSize) ? (int32_t)blockSize - 1 : i);
+                w[k] = pSrc[i];
+            }
+        }
+
+        pDst[n] = plp_median_i16(w, numTaps);
+    }
+}
+
+#undef PLP_MEDIAN_SORT
+
+/**
+   @} end of MedianFilterKernels group
+*/
@@ -0,0 +1,216 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16s_xpulpv2.c
+ * Description:  16-bit integer median filter kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MedianFilter
+*/
+
+/* compare and exchange, such that a <= b */
+#define PLP_MEDIAN_SORT(a, b)                                                                      \
+    {                                                                                              \
+        int16_t t = (a);                                                                           \
+        (a) = ((b) < t) ? (b) : t;                                                                 \
+        (b) = ((b) < t) ? t : (b);                                                                 \
+    }
+
+static inline int16_t plp_median_i16(int16_t *w, uint32_t numTaps) {
+
+    switch (numTaps) {
+    case 1:
+        return w[0];
+    case 3:
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        return w[1];
+    case 5:
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        PLP_MEDIAN_SORT(w[3], w[4]);
+        PLP_MEDIAN_SORT(w[0], w[3]);
+        PLP_MEDIAN_SORT(w[1], w[4]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[2], w[3]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        return w[2];
+    case 9:
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[4], w[5]);
+        PLP_MEDIAN_SORT(w[7], w[8]);
+        PLP_MEDIAN_SORT(w[0], w[1]);
+        PLP_MEDIAN_SORT(w[3], w[4]);
+        PLP_MEDIAN_SORT(w[6], w[7]);
+        PLP_MEDIAN_SORT(w[1], w[2]);
+        PLP_MEDIAN_SORT(w[4], w[5]);
+        PLP_MEDIAN_SORT(w[7], w[8]);
+        PLP_MEDIAN_SORT(w[0], w[3]);
+        PLP_MEDIAN_SORT(w[5], w[8]);
+        PLP_MEDIAN_SORT(w[4], w[7]);
+        PLP_MEDIAN_SORT(w[3], w[6]);
+        PLP_MEDIAN_SORT(w[1], w[4]);
+        PLP_MEDIAN_SORT(w[2], w[5]);
+        PLP_MEDIAN_SORT(w[4], w[7]);
+        PLP_MEDIAN_SORT(w[4], w[2]);
+        PLP_MEDIAN_SORT(w[6], w[4]);
+        PLP_MEDIAN_SORT(w[4], w[2]);
+        return w[4];
+    default: {
+        /* partial selection sort up to the middle */
+        uint32_t i, j;
+        for (i = 0; i <= numTaps / 2; i++) {
+            for (j = i + 1; j < numTaps; j++) {
+                PLP_MEDIAN_SORT(w[i], w[j]);
+            }
+        }
+        return w[numTaps / 2];
+    }
+    }
+}
+
+/* compare and exchange of two pairs of samples, such that a <= b element-wise */
+#define PLP_MEDIAN_SORT2(a, b)                                                                     \
+    {                                                                                              \
+        v2s t = (a);                                                                               \
+        (a) = __MIN2(t, (b));                                                                      \
+        (b) = __MAX2(t, (b));                                                                      \
+    }
+
+/**
+   @addtogroup MedianFilterKernels
+   @{
+*/
+
+/**
+   @brief 16-bit integer median filter kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  start     First output sample to compute
+   @param[in]  end       One after the last output sample to compute
+   @param[out] pDst      points to the output vector, of which pDst[start] to pDst[end - 1] are
+                         written
+   @return     none
+
+   @par Exploiting SIMD instructions
+   For 3, 5 and 9 taps, two neighbouring output samples are computed at once. The windows of
+   outputs n and n + 1 are loaded as pairs (x[k], x[k + 1]), packed into 32-bit vectors, and sorted
+   with the same network using the SIMD min and max instructions.
+*/
+void plp_median_filter_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t numTaps,
+                                    uint32_t start,
+                                    uint32_t end,
+                                    int16_t *__restrict__ pDst) {
+
+    int16_t w[PLP_MEDIAN_FILTER_MAX_TAPS];
+    uint32_t h = numTaps / 2;
+    uint32_t simdNet = (numTaps == 3 || numTaps == 5 || numTaps == 9);
+    uint32_t n = start;
+    uint32_t k;
+
+    while (n < end) {
+        if (simdNet && n >= h && n + 1 + h < blockSize && n + 1 < end) {
+            /* two outputs at once in the interior */
+            v2s v[9];
+
+            for (k = 0; k < numTaps; k++) {
+                v[k] = *((v2s *)(pSrc + n - h + k));
+            }
+
+            switch (numTaps) {
+            case 3:
+                PLP_MEDIAN_SORT2(v[0], v[1]);
+                PLP_MEDIAN_SORT2(v[1], v[2]);
+                PLP_MEDIAN_SORT2(v[0], v[1]);
+                v[0] = v[1];
+                break;
+            case 5:
+                PLP_MEDIAN_SORT2(v[0], v[1]);
+                PLP_MEDIAN_SORT2(v[3], v[4]);
+                PLP_MEDIAN_SORT2(v[0], v[3]);
+                PLP_MEDIAN_SORT2(v[1], v[4]);
+                PLP_MEDIAN_SORT2(v[1], v[2]);
+                PLP_MEDIAN_SORT2(v[2], v[3]);
+                PLP_MEDIAN_SORT2(v[1], v[2]);
+                v[0] = v[2];
+                break;
+            default:
+                PLP_MEDIAN_SORT2(v[1], v[2]);
+                PLP_MEDIAN_SORT2(v[4], v[5]);
+                PLP_MEDIAN_SORT2(v[7], v[8]);
+                PLP_MEDIAN_SORT2(v[0], v[1]);
+                PLP_MEDIAN_SORT2(v[3], v[4]);
+                PLP_MEDIAN_SORT2(v[6], v[7]);
+                PLP_MEDIAN_SORT2(v[1], v[2]);
+                PLP_MEDIAN_SORT2(v[4], v[5]);
+                PLP_MEDIAN_SORT2(v[7], v[8]);
+                PLP_MEDIAN_SORT2(v[0], v[3]);
+                PLP_MEDIAN_SORT2(v[5], v[8]);
+                PLP_MEDIAN_SORT2(v[4], v[7]);
+                PLP_MEDIAN_SORT2(v[3], v[6]);
+                PLP_MEDIAN_SORT2(v[1], v[4]);
+                PLP_MEDIAN_SORT2(v[2], v[5]);
+                PLP_MEDIAN_SORT2(v[4], v[7]);
+                PLP_MEDIAN_SORT2(v[4], v[2]);
+                PLP_MEDIAN_SORT2(v[6], v[4]);
+                PLP_MEDIAN_SORT2(v[4], v[2]);
+                v[0] = v[4];
+                break;
+            }
+
+            pDst[n] = v[0][0];
+            pDst[n + 1] = v[0][1];
+            n += 2;
+        } else {
+            if (n >= h && n + h < blockSize) {
+                for (k = 0; k < numTaps; k++) {
+                    w[k] = pSrc[n - h + k];
+                }
+            } else {
+                /* replicate the first and the last sample at the edges */
+                for (k = 0; k < numTaps; k++) {
+                    int32_t i = (int32_t)(n + k) - (int32_t)h;
+                    i = (i < 0) ? 0 : ((i >= (int32_t)blockSize) ? (int32_t)blockSize - 1 : i);
+                    w[k] = pSrc[i];
+                }
+            }
+
+            pDst[n] = plp_median_i16(w, numTaps);
+            n++;
+        }
+    }
+}
+
+#undef PLP_MEDIAN_SORT
+#undef PLP_MEDIAN_SORT2
+
+/**
+   @} end of MedianFilterKernels group
+*/
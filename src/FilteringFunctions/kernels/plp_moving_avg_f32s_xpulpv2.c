@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_f32s_xpulpv2.c
+ * Description:  32-bit floating-point moving-average filter kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MovingAvg
+*/
+
+/**
+   @addtogroup MovingAvgKernels
+   @{
+*/
+
+/**
+   @brief 32-bit floating-point moving-average filter kernel for XPULPV2 extension.
+   @param[in,out] S         points to an initialized instance of the 32-bit floating-point
+                            moving-average filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+
+   @par
+   Whenever the window wraps around the state buffer, the sum is recomputed from the L samples in
+   the state buffer, which costs one more addition per sample on average.
+*/
+void plp_moving_avg_f32s_xpulpv2(plp_moving_avg_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t blockSize) {
+
+    uint32_t length = S->length;
+    float32_t *pState = S->pState;
+    uint32_t index = S->index;
+    float32_t sum = S->sum;
+    float32_t invLength = S->invLength;
+    uint32_t i, k;
+
+    for (i = 0; i < blockSize; i++) {
+        float32_t x = pSrc[i];
+
+        /* replace the oldest sample of the window */
+        sum += x - pState[index];
+        pState[index] = x;
+
+        index++;
+        if (index == length) {
+            index = 0;
+
+            /* discard the accumulated rounding errors */
+            sum = 0.0f;
+            for (k = 0; k < length; k++) {
+                sum += pState[k];
+            }
+        }
+
+        pDst[i] = sum * invLength;
+    }
+
+    S->index = index;
+    S->sum = sum;
+}
+
+/**
+   @} end of MovingAvgKernels group
+*/
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_i16s_rv32im.c
+ * Description:  16-bit integer moving-average filter kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MovingAvg
+*/
+
+/**
+   @defgroup MovingAvgKernels Moving-Average Filter Kernels
+   This module contains the kernel functions of the moving-average filters.
+*/
+
+/**
+   @addtogroup MovingAvgKernels
+   @{
+*/
+
+/**
+   @brief 16-bit integer moving-average filter kernel for RV32IM extension.
+   @param[in,out] S         points to an initialized instance of the 16-bit integer moving-average
+                            filter, whose state is updated
+   @param[in]     pSrc      points to the block of input samples
+   @param[out]    pDst      points to the block of output samples
+   @param[in]     blockSize Number of samples to process
+   @return        none
+*/
+void plp_moving_avg_i16s_rv32im(plp_moving_avg_instance_i16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize) {
+
+    uint32_t length = S->length;
+    int16_t *pState = S->pState;
+    uint32_t index = S->index;
+    int32_t sum = S->sum;
+    int32_t recip = S->recip;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        int16_t x = pSrc[i];
+
+        /* replace the oldest sample of the window */
+        sum += x - pState[index];
+        pState[index] = x;
+
+        index++;
+        if (index == length) {
+            index = 0;
+        }
+
+        /* sum / length, rounded */
+        pDst[i] = (int16_t)(((int64_t)sum * recip + (1 << 29)) >> 30);
+    }
+
+    S->index = index;
+    S->sum = sum;
+}
+
+/**
+   @} end of MovingAvgKernels group
+*/
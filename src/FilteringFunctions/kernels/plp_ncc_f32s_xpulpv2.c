@@ -0,0 +1,125 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ncc_f32s_xpulpv2.c
+ * Description:  32-bit floating-point normalized cross-correlation kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup NCC
+*/
+
+/**
+   @addtogroup NCCKernels
+   @{
+*/
+
+/**
+   @brief Normalized cross-correlation of 32-bit float vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients
+   @return     none
+
+   @par
+   The inverse square roots of the energies are computed with plp_rsqrt_f32s_xpulpv2, which is
+   faster than a division and a square root. The rounding errors of the updated energy of the
+   window grow with the energy, which has left it. Hence, the energy is summed up anew every
+   tmplLen positions (which keeps the cost at O(1) per position) and whenever it has dropped by
+   more than a factor of 256 since. The coefficients are clipped to [-1, 1].
+*/
+
+void plp_ncc_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const float32_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          float32_t *__restrict__ pRes) {
+
+    uint32_t l, m;
+    float32_t eT = 0.0f; // energy of the template
+    float32_t eX = 0.0f; // energy of the window of the signal at position l
+    float32_t eRef;      // energy of the window, when it was last summed up
+    uint32_t age = 0;    // number of updates of the energy since
+    float32_t rT, rX;    // inverse square roots of the energies
+    float32_t corr1, corr2, ncc;
+
+    if (srcLen < tmplLen) {
+        return;
+    }
+
+    for (m = 0; m < tmplLen; m++) {
+        eT += pTmpl[m] * pTmpl[m];
+        eX += pSrc[m] * pSrc[m];
+    }
+
+    plp_rsqrt_f32s_xpulpv2(&eT, &rT, 1);
+    eRef = eX;
+
+    for (l = 0; l <= srcLen - tmplLen; l++) {
+        const float32_t *pX = pSrc + l;
+
+        if (age == tmplLen || eX < eRef * (1.0f / 256.0f)) {
+            eX = 0.0f;
+            for (m = 0; m < tmplLen; m++) {
+                eX += pX[m] * pX[m];
+            }
+            eRef = eX;
+            age = 0;
+        }
+
+        corr1 = 0.0f;
+        corr2 = 0.0f;
+        for (m = 0; m < (tmplLen >> 1); m++) {
+            corr1 += pTmpl[2 * m] * pX[2 * m];
+            corr2 += pTmpl[2 * m + 1] * pX[2 * m + 1];
+        }
+        if (tmplLen % 2 == 1) {
+            corr1 += pTmpl[tmplLen - 1] * pX[tmplLen - 1];
+        }
+
+        if (eT > 0.0f && eX > 0.0f) {
+            plp_rsqrt_f32s_xpulpv2(&eX, &rX, 1);
+            ncc = (corr1 + corr2) * rT * rX;
+            ncc = (ncc > 1.0f) ? 1.0f : ncc;
+            ncc = (ncc < -1.0f) ? -1.0f : ncc;
+            pRes[l] = ncc;
+        } else {
+            pRes[l] = 0.0f;
+        }
+
+        // slide the window by one sample
+        if (l < srcLen - tmplLen) {
+            eX += pX[tmplLen] * pX[tmplLen] - pX[0] * pX[0];
+            age++;
+        }
+    }
+}
+
+/**
+   @} end of NCCKernels group
+*/
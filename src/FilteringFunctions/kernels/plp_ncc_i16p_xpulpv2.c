@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ncc_i16p_xpulpv2.c
+ * Description:  16-bit integer parallel normalized cross-correlation kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup NCC
+*/
+
+/**
+   @addtogroup NCCKernels
+   @{
+*/
+
+/**
+   @brief Parallel normalized cross-correlation of 16-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  args  pointer to plp_ncc_instance_i16 struct initialized by plp_ncc_i16_parallel
+   @return     none
+
+   @par
+   Every core runs plp_ncc_i16s_xpulpv2 on a contiguous range of the positions, with the part of
+   the signal, which its windows cover.
+*/
+
+void plp_ncc_i16p_xpulpv2(void *args) {
+
+    plp_ncc_instance_i16 *a = (plp_ncc_instance_i16 *)args;
+
+    uint32_t numPos = a->srcLen - a->tmplLen + 1;
+    uint32_t chunk = (numPos + a->nPE - 1) / a->nPE;
+    uint32_t start = plp_core_id() * chunk;
+    uint32_t end = (start + chunk < numPos) ? start + chunk : numPos;
+
+    if (start < end) {
+        plp_ncc_i16s_xpulpv2(a->pSrc + start, end - start + a->tmplLen - 1, a->pTmpl, a->tmplLen,
+                             a->pRes + start);
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of NCCKernels group
+*/
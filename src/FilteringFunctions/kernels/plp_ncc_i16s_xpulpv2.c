@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ncc_i16s_xpulpv2.c
+ * Description:  16-bit integer normalized cross-correlation kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup NCC
+*/
+
+/**
+   @addtogroup NCCKernels
+   @{
+*/
+
+/* corr / sqrt(eT * eX) in Q15, for eT, eX > 0 and corr^2 <= eT * eX */
+static inline int16_t plp_ncc_i16_div_xpulpv2(int64_t corr, uint64_t eT, uint64_t eX) {
+    int32_t sT, sX, shift, e, c;
+    uint32_t m32, y, y2, t;
+    uint64_t p;
+    int64_t r;
+
+    /* eT * eX = p * 2^(sT + sX), with both factors of p shifted below 2^32 by even amounts */
+    sT = 32 - (int32_t)__builtin_clzll(eT);
+    sT = (sT > 0) ? (sT + 1) & ~1 : 0;
+    sX = 32 - (int32_t)__builtin_clzll(eX);
+    sX = (sX > 0) ? (sX + 1) & ~1 : 0;
+    p = (eT >> sT) * (eX >> sX);
+
+    /* p = m * 2^(64 - shift), with the mantissa m in [2^30, 2^32) (Q0.32) and an even shift */
+    shift = __builtin_clzll(p) & ~1;
+    m32 = (uint32_t)((p << shift) >> 32);
+    e = 64 - shift + sT + sX;
+
+    /* inverse square root of the mantissa in Q2.30, refined with three Newton iterations */
+    y = (uint32_t)rsqrtTable_q16[(m32 >> 27) - 8] << 16;
+    for (int i = 0; i < 3; i++) {
+        y2 = ((uint64_t)y * y) >> 30;
+        t = ((uint64_t)m32 * y2) >> 32;
+        y = ((uint64_t)y * (0xC0000000U - t)) >> 31;
+    }
+
+    /* corr * y * 2^(-30 - e / 2) in Q15, where |corr| < 2^(e / 2) is first reduced to 31 bits */
+    c = e / 2 - 31;
+    if (c > 0) {
+        corr >>= c;
+    } else {
+        c = 0;
+    }
+    shift = 15 + e / 2 - c;
+    r = (corr * (int64_t)y + ((int64_t)1 << (shift - 1))) >> shift;
+
+    if (r > INT16_MAX) {
+        return INT16_MAX;
+    } else if (r < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)r;
+}
+
+/**
+   @brief Normalized cross-correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients in Q15
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The correlation of every position is computed with dot product instructions on pairs of
+   samples, of which the sums are accumulated in 64 bits.
+
+   @par Precision
+   The correlation and the energies are exact in 64 bits. The quotient is computed with the
+   inverse square root of the product of the energies, normalized to a 32-bit mantissa, and is
+   rounded to Q15 (1.0 saturates to 32767).
+*/
+
+void plp_ncc_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const int16_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          int16_t *__restrict__ pRes) {
+
+    uint32_t l, m;
+    uint64_t eT = 0; // energy of the template
+    uint64_t eX = 0; // energy of the window of the signal at position l
+    int64_t corr;
+
+    if (srcLen < tmplLen) {
+        return;
+    }
+
+    for (m = 0; m < tmplLen; m++) {
+        eT += (int32_t)pTmpl[m] * pTmpl[m];
+        eX += (int32_t)pSrc[m] * pSrc[m];
+    }
+
+    for (l = 0; l <= srcLen - tmplLen; l++) {
+        const int16_t *pX = pSrc + l;
+
+        // pX is not word-aligned for every other position, its words are then loaded with two
+        // accesses
+        corr = 0;
+        for (m = 0; m < (tmplLen >> 2); m++) {
+            v2s t0 = *((v2s *)((void *)(pTmpl + 4 * m)));
+            v2s x0 = *((v2s *)((void *)(pX + 4 * m)));
+            v2s t1 = *((v2s *)((void *)(pTmpl + 4 * m + 2)));
+            v2s x1 = *((v2s *)((void *)(pX + 4 * m + 2)));
+            corr += (int64_t)__DOTP2(t0, x0) + __DOTP2(t1, x1);
+        }
+        for (m = tmplLen & ~0x3U; m < tmplLen; m++) {
+            corr += (int32_t)pTmpl[m] * pX[m];
+        }
+
+        pRes[l] = (eT == 0 || eX == 0) ? 0 : plp_ncc_i16_div_xpulpv2(corr, eT, eX);
+
+        // slide the window by one sample
+        if (l < srcLen - tmplLen) {
+            eX += (int32_t)pX[tmplLen] * pX[tmplLen];
+            eX -= (int32_t)pX[0] * pX[0];
+        }
+    }
+}
+
+/**
+   @} end of NCCKernels group
+*/
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_q16s_xpulpv2.c
+ * Description:  16-bit fixed point NCO mixer kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/* entries i and i + 1 of the sine table, a single word access if the full table is there */
+#if defined(PLP_QUARTER_WAVE_TABLES)
+#define PLP_NCO_SIN_PAIR_Q16(i) __PACK2(PLP_SIN_TABLE_Q16(i), PLP_SIN_TABLE_Q16((i) + 1))
+#else
+#define PLP_NCO_SIN_PAIR_Q16(i) (*((v2s *)&sinTable_q16[i]))
+#endif
+
+/**
+   @ingroup NCO
+*/
+
+/**
+   @addtogroup NCOKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point NCO mixer kernel for XPULPV2 extension.
+   @param[in,out] S         points to an initialized instance of the 16-bit fixed point NCO mixer
+   @param[in]     pSrc      points to the block of input samples
+   @param[in]     blockSize Number of samples to process
+   @param[out]    pDstI     points to the block of in-phase output samples
+   @param[out]    pDstQ     points to the block of quadrature output samples
+   @return        none
+*/
+
+void plp_nco_mix_q16s_xpulpv2(plp_nco_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pDstI,
+                              int16_t *__restrict__ pDstQ) {
+
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    uint32_t i;
+    uint32_t index, cosIndex;
+    int32_t fract, x, s, c;
+    v2s weights;
+
+    for (i = 0; i < blockSize; i++) {
+        /* table index of the sine and interpolation weights in Q2.14 */
+        index = phase >> 23;
+        fract = (phase >> 9) & 0x3FFF;
+        cosIndex = (index + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+        weights = __PACK2(0x4000 - fract, fract);
+
+        /* both neighbors of the table are interpolated with a single dot product */
+        s = __DOTP2(PLP_NCO_SIN_PAIR_Q16(index), weights) >> 14;
+        c = __DOTP2(PLP_NCO_SIN_PAIR_Q16(cosIndex), weights) >> 14;
+
+        /* multiply with exp(-j * phase), rounded and saturated to Q1.15 */
+        x = pSrc[i];
+        pDstI[i] = __CLIP((x * c + 0x4000) >> 15, 15);
+        pDstQ[i] = __CLIP((0x4000 - x * s) >> 15, 15);
+
+        phase += phaseInc;
+    }
+
+    S->phase = phase;
+}
+
+/**
+   @} end of NCOKernels group
+*/
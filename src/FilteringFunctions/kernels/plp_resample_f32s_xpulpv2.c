@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_f32s_xpulpv2.c
+ * Description:  32-bit floating-point polyphase resampler kernel for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Resample
+*/
+
+/**
+   @addtogroup ResampleKernels
+   @{
+*/
+
+/**
+   @brief 32-bit floating-point polyphase resampler kernel for XPULPV2 extension.
+   @param[in,out] S      points to an initialized instance of the 32-bit floating-point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_f32s_xpulpv2(plp_resample_instance_f32 *S,
+                                   const float *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   float *__restrict__ pDst) {
+
+    uint32_t L = S->L;
+    uint32_t M = S->M;
+    uint32_t phaseLength = S->phaseLength;
+    const float *pBank = S->pBank;
+    float *pState = S->pState;
+
+    uint32_t i; // loop counter
+    uint32_t k; // loop counter
+    uint32_t numOut = 0;
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    // the next output is the upsampled sample n * L + p, relative to the start of the block
+    uint32_t n = S->phase / L;
+    uint32_t p = S->phase - n * L;
+
+    while (n < blockSize) {
+        const float *pX = pState + n;
+        const float *pC = pBank + p * phaseLength;
+        float sum = 0;
+        float sum1 = 0;
+
+        for (k = 0; k + 1 < phaseLength; k += 2) {
+            sum += pC[k] * pX[k];
+            sum1 += pC[k + 1] * pX[k + 1];
+        }
+        if (k < phaseLength) {
+            sum += pC[k] * pX[k];
+        }
+        sum += sum1;
+        pDst[numOut++] = sum;
+
+        // advance the phase accumulator by M / L input samples
+        p += M;
+        while (p >= L) {
+            p -= L;
+            n++;
+        }
+    }
+
+    S->phase = (n - blockSize) * L + p;
+
+    // keep the last phaseLength - 1 samples for the next block
+    for (i = 0; i < phaseLength - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+
+    return numOut;
+}
+
+/**
+   @} end of ResampleKernels group
+*/
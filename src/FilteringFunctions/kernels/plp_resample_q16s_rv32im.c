@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_q16s_rv32im.c
+ * Description:  16-bit fixed point polyphase resampler kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Resample
+*/
+
+/**
+   @defgroup ResampleKernels Polyphase Resampler Kernels
+   This module contains the kernel codes of the polyphase resamplers. Each kernel appends the new
+   input block to the state buffer, computes one dot product with the coefficient bank per output
+   sample while advancing the phase accumulator by M, and moves the last phaseLength - 1 samples
+   to the beginning of the state buffer.
+*/
+
+/**
+   @addtogroup ResampleKernels
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point polyphase resampler kernel for RV32IM.
+   @param[in,out] S      points to an initialized instance of the 16-bit fixed point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+
+uint32_t plp_resample_q16s_rv32im(plp_resample_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst) {
+
+    uint32_t L = S->L;
+    uint32_t M = S->M;
+    uint32_t phaseLength = S->phaseLength;
+    const int16_t *pBank = S->pBank;
+    int16_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+
+    uint32_t i; // loop counter
+    uint32_t k; // loop counter
+    uint32_t numOut = 0;
+
+    // append the new samples to the delay line
+    for (i = 0; i < blockSize; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    // the next output is the upsampled sample n * L + p, relative to the start of the block
+    uint32_t n = S->phase / L;
+    uint32_t p = S->phase - n * L;
+
+    while (n < blockSize) {
+        const int16_t *pX = pState + n;
+        const int16_t *pC = pBank + p * phaseLength;
+        int32_t sum = 0;
+
+        for (k = 0; k < phaseLength; k++) {
+            sum += pC[k] * pX[k];
+        }
+        pDst[numOut++] = (int16_t)__ROUNDNORM_REG(sum, fracBits);
+
+        // advance the phase accumulator by M / L input samples
+        p += M;
+        while (p >= L) {
+            p -= L;
+            n++;
+        }
+    }
+
+    S->phase = (n - blockSize) * L + p;
+
+    // keep the last phaseLength - 1 samples for the next block
+    for (i = 0; i < phaseLength - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+
+    return numOut;
+}
+
+/**
+   @} end of ResampleKernels group
+*/
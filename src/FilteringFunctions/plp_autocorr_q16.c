@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q16.c
+ * Description:  16-bit fixed-point autocorrelation glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup Autocorrelation Autocorrelation
+   This module contains the glue code for the autocorrelation. The kernel codes (kernels) are in
+   the Module Autocorrelation Kernels.
+
+   The autocorrelation of a vector x of length N is computed for the lags 0 to numLags - 1 only:
+
+   \f[
+      r[l] = \sum_{n=0}^{N-1-l} x[n] \cdot x[n+l]
+   \f]
+
+   plp_correlate_i16(x, x) computes all 2N - 1 lags, of which the negative ones are the mirror
+   image of the positive ones. For linear prediction, only the first order + 1 lags are needed,
+   which are the input of plp_levinson_durbin_q32 and plp_levinson_durbin_f32.
+
+   The fixed-point functions accumulate in 64 bits and return 64-bit lags, such that the
+   autocorrelation of long blocks does not overflow.
+*/
+
+/**
+   @addtogroup Autocorrelation
+   @{
+*/
+
+/**
+   @brief Glue code for the autocorrelation of a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  numLags    number of lags, which are computed (lag 0 to numLags - 1)
+   @param[in]  fracBits   decimal point for right shift
+   @param[out] pRes       points to the output vector of numLags lags
+   @return     none
+*/
+
+void plp_autocorr_q16(const int16_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t numLags,
+                      uint32_t fracBits,
+                      int64_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_autocorr_q16s_rv32im(pSrc, blockSize, numLags, fracBits, pRes);
+    } else {
+        plp_autocorr_q16s_xpulpv2(pSrc, blockSize, numLags, fracBits, pRes);
+    }
+}
+
+/**
+   @} end of Autocorrelation group
+*/
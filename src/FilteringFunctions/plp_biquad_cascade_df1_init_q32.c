@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_init_q32.c
+ * Description:  32-bit fixed point biquad cascade IIR filter initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup BiquadCascade Biquad Cascade IIR Filters
+   This module contains the glue code for IIR filters, implemented as a cascade of second order
+   sections (biquads). The kernel codes (kernels) are in the Module Biquad Cascade IIR Filter
+   Kernels.
+
+   Each stage computes
+
+       `y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]`
+
+   and its output is the input of the next stage. The coefficients are stored stage by stage as
+   `{b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}`, i.e. 5 * numStages values. Note that
+   the feedback coefficients have the opposite sign compared to the usual notation of the transfer
+   function `H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 - a1 z^-1 - a2 z^-2)`.
+
+   The fix-point filters are implemented in direct form I, with a state of 4 values per stage,
+   `{x[n-1], x[n-2], y[n-1], y[n-2]}`. The products are accumulated with enough precision (32
+   bits for q16 and 64 bits for q32). The sum is shifted right by fracBits (with rounding) and
+   saturated to the output type. The floating-point filter is implemented in transposed direct
+   form II, with a state of 2 values per stage.
+
+   The state is kept in the instance between calls, such that a continuous signal can be filtered
+   block by block. The filters can operate in-place, i.e. pSrc and pDst may point to the same
+   buffer. The parallel functions filter multiple independent channels, each with its own
+   instance, and distribute the channels over the cores.
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed point biquad cascade IIR filter (direct form I)
+          instance.
+   @param[out] S         points to an instance of the 32-bit fixed point biquad cascade structure
+   @param[in]  numStages Number of second order stages
+   @param[in]  pCoeffs   points to the filter coefficients, 5 * numStages values
+   @param[in]  pState    points to the state buffer, 4 * numStages values
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_biquad_cascade_df1_init_q32(plp_biquad_cascade_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t fracBits) {
+
+    uint32_t i;
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < 4 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q32.c
+ * Description:  32-bit fixed point biquad cascade IIR filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief Glue code for the 32-bit fixed point biquad cascade IIR filter (direct form I).
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point biquad cascade
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process
+   @param[out] pDst      points to the block of output samples
+   @return     none
+*/
+
+void plp_biquad_cascade_df1_q32(const plp_biquad_cascade_df1_instance_q32 *S,
+                                const int32_t *pSrc,
+                                uint32_t blockSize,
+                                int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_biquad_cascade_df1_q32s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_biquad_cascade_df1_q32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
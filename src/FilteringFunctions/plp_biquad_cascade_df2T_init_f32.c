@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_init_f32.c
+ * Description:  32-bit floating-point biquad cascade IIR filter initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point biquad cascade IIR filter (transposed direct
+          form II) instance.
+   @param[out] S         points to an instance of the 32-bit floating-point biquad cascade structure
+   @param[in]  numStages Number of second order stages
+   @param[in]  pCoeffs   points to the filter coefficients, 5 * numStages values
+   @param[in]  pState    points to the state buffer, 2 * numStages values
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_cascade_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float *pCoeffs,
+                                      float *pState) {
+
+    uint32_t i;
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    for (i = 0; i < 2 * numStages; i++) {
+        pState[i] = 0.0f;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_init_i32.c
+ * Description:  Initialization of the 32-bit integer CIC decimator
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup CICDecimate CIC Decimators
+   This module contains the glue code for cascaded integrator-comb (CIC) decimators, which reduce
+   the sampling rate by large factors M, e.g. 64 to 256 after a PDM microphone, without any
+   multiplication. The kernel codes (kernels) are in the Module CIC Decimator Kernels.
+
+   A decimator of the given order consists of order integrators at the input rate, followed by
+   the downsampling by M and order combs with a differential delay of one at the output rate:
+
+       `y[n] = sum_{i=0}^{M-1} ... sum_{i=0}^{M-1} x[nM - i]`
+
+   Its transfer function is ((1 - z^-M) / (1 - z^-1))^order, with a gain of M^order at DC. The
+   integrators keep their values from one block to the next, such that a stream can be decimated
+   block by block.
+
+   The registers need log2(M^order) = order * log2(M) bits in addition to the input samples. The
+   integer version has 32-bit registers, which wrap around on overflow. This is harmless as long as
+   the output fits into 32 bits, i.e. the number of bits of the input plus order * log2(M) is at
+   most 32 (e.g. 1-bit PDM samples with M = 64 and order 5). The output is shifted right by the
+   shift of the instance. The fixed point version has 64-bit registers, which allow
+   order * ceil(log2(M)) up to 32 for any 32-bit input, and shifts the output right by
+   order * ceil(log2(M)) with rounding and saturation. Hence, the output has the same format as
+   the input and a gain of one for powers of two.
+
+   The multi-channel versions (_parallel) distribute independent channels over the cores.
+*/
+
+/**
+   @addtogroup CICDecimate
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit integer CIC decimator instance.
+   @param[out] S      points to an instance of the 32-bit integer CIC decimator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  M      Decimation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @param[in]  shift  Right shift of the output samples
+   @return     none
+*/
+void plp_cic_decimate_init_i32(plp_cic_decimate_instance_i32 *S,
+                               uint32_t order,
+                               uint32_t M,
+                               int32_t *pState,
+                               uint32_t shift) {
+
+    uint32_t i;
+
+    S->order = order;
+    S->M = M;
+    S->pState = pState;
+    S->shift = shift;
+
+    for (i = 0; i < 2 * order; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of CICDecimate group
+*/
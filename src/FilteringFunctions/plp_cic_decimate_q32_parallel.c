@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_q32_parallel.c
+ * Description:  32-bit fixed point multi-channel CIC decimator glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup CICDecimate
+   @{
+*/
+
+/**
+   @brief      Glue code for the parallel multi-channel 32-bit fixed point CIC decimator.
+   @param[in]  S           points to an array of numChannels initialized instances, one per channel,
+                           all with the same factor M
+   @param[in]  numChannels Number of independent channels
+   @param[in]  pSrc        points to the input samples, channel c starts at pSrc + c * blockSize
+   @param[in]  blockSize   Number of input samples to process per channel, a multiple of M
+   @param[in]  nPE         Number of cores to use for computation
+   @param[out] pDst        points to the outputs, channel c starts at pDst + c * blockSize / M
+   @return     none
+
+   @par
+   The channels are distributed over the cores, each core filters the channels core_id,
+   core_id + nPE, ..., such that the computation scales with the number of channels.
+*/
+
+void plp_cic_decimate_q32_parallel(const plp_cic_decimate_instance_q32 *S,
+                                   uint32_t numChannels,
+                                   const int32_t *pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cic_decimate_parallel_instance_q32 args = {
+            .S = S, .numChannels = numChannels, .pSrc = pSrc, .blockSize = blockSize, .nPE = nPE,
+            .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_cic_decimate_q32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of CICDecimate group
+*/
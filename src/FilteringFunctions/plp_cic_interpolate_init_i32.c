@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_interpolate_init_i32.c
+ * Description:  Initialization of the 32-bit integer CIC interpolator
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup CICInterpolate CIC Interpolators
+   This module contains the glue code for cascaded integrator-comb (CIC) interpolators, which
+   increase the sampling rate by large factors L without any multiplication. The kernel codes
+   (kernels) are in the Module CIC Interpolator Kernels.
+
+   An interpolator of the given order consists of order combs with a differential delay of one at
+   the input rate, followed by the upsampling by L (L - 1 zeros after every sample) and order
+   integrators at the output rate. Its transfer function is ((1 - z^-L) / (1 - z^-1))^order, with
+   a gain of L^(order - 1) at DC, as only every L-th sample is nonzero. The combs and the
+   integrators keep their values from one block to the next, such that a stream can be
+   interpolated block by block.
+
+   The registers need (order - 1) * log2(L) bits in addition to the input samples. The integer
+   version has 32-bit registers, which wrap around on overflow. This is harmless as long as the
+   output fits into 32 bits, and the output is shifted right by the shift of the instance. The
+   fixed point version has 64-bit registers and shifts the output right by
+   (order - 1) * ceil(log2(L)) with rounding and saturation, such that the output has the same
+   format as the input and a gain of one for powers of two.
+
+   The multi-channel versions (_parallel) distribute independent channels over the cores.
+*/
+
+/**
+   @addtogroup CICInterpolate
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit integer CIC interpolator instance.
+   @param[out] S      points to an instance of the 32-bit integer CIC interpolator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  L      Interpolation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @param[in]  shift  Right shift of the output samples
+   @return     none
+*/
+void plp_cic_interpolate_init_i32(plp_cic_interpolate_instance_i32 *S,
+                                  uint32_t order,
+                                  uint32_t L,
+                                  int32_t *pState,
+                                  uint32_t shift) {
+
+    uint32_t i;
+
+    S->order = order;
+    S->L = L;
+    S->pState = pState;
+    S->shift = shift;
+
+    for (i = 0; i < 2 * order; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of CICInterpolate group
+*/
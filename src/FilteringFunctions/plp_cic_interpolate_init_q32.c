@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_interpolate_init_q32.c
+ * Description:  Initialization of the 32-bit fixed point CIC interpolator
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup CICInterpolate
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit fixed point CIC interpolator instance.
+   @param[out] S      points to an instance of the 32-bit fixed point CIC interpolator structure
+   @param[in]  order  Number of integrator and comb stages
+   @param[in]  L      Interpolation factor
+   @param[in]  pState points to the state buffer of 2 * order values
+   @return     none
+*/
+void plp_cic_interpolate_init_q32(plp_cic_interpolate_instance_q32 *S,
+                                  uint32_t order,
+                                  uint32_t L,
+                                  int64_t *pState) {
+
+    uint32_t i;
+    uint32_t bits = 0; // ceil(log2(L))
+
+    while ((1U << bits) < L) {
+        bits++;
+    }
+
+    S->order = order;
+    S->L = L;
+    S->pState = pState;
+    S->shift = (order - 1) * bits;
+
+    for (i = 0; i < 2 * order; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of CICInterpolate group
+*/
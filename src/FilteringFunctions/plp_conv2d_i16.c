@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16.c
+ * Description:  16-bit integer 2D convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup Convolution2D 2D Convolution
+   This module contains the glue code for the 2D convolution of images or feature maps with a small
+   filter kernel (e.g. 3x3 or 5x5). The kernel codes (kernels) are in the Module 2D Convolution
+   Kernels.
+
+   The result is the 2D convolution of the input image with the kernel, i.e. the kernel is flipped
+   in both directions (like in plp_conv). For a correlation (as used in neural networks), pass
+   the flipped kernel. Two padding modes are supported:
+   - PLP_CONV2D_VALID: Only the output pixels for which the kernel lies entirely inside the input
+     image are computed. The output image has (srcH - kH + 1) x (srcW - kW + 1) pixels. Nothing is
+     computed if the kernel is larger than the image.
+   - PLP_CONV2D_SAME: The input image is zero-padded, and the output image has the same size as
+     the input image. The output is the central part of the full convolution, starting at row
+     kH / 2 and column kW / 2 (like conv2(..., 'same') of Matlab).
+
+   Like in the strided matrix functions, the input and output images are stored in row-major
+   order with a stride (number of elements between the start of two rows), such that a
+   sub-image of a larger image can be processed in place. The filter kernel is dense.
+*/
+
+/**
+   @addtogroup Convolution2D
+   @{
+*/
+
+/**
+   @brief Glue code for 2D convolution of 16-bit integer images.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t srcH,
+                    uint32_t srcW,
+                    uint32_t strideSrc,
+                    const int16_t *__restrict__ pKernel,
+                    uint32_t kH,
+                    uint32_t kW,
+                    uint32_t padding,
+                    uint32_t strideDst,
+                    int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv2d_i16s_rv32im(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst);
+    } else {
+        plp_conv2d_i16s_xpulpv2(pSrc, srcH, srcW, strideSrc, pKernel, kH, kW, padding, strideDst, pDst);
+    }
+}
+
+/**
+   @} end of Convolution2D group
+*/
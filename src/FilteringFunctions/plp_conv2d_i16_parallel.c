@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16_parallel.c
+ * Description:  Parallel 16-bit integer 2D convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Convolution2D
+   @{
+*/
+
+/**
+   @brief Glue code for parallel 2D convolution of 16-bit integer images.
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  pKernel   points to the filter kernel of size kH x kW (dense)
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  padding   PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image
+   @return     none
+*/
+
+void plp_conv2d_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t srcH,
+                             uint32_t srcW,
+                             uint32_t strideSrc,
+                             const int16_t *__restrict__ pKernel,
+                             uint32_t kH,
+                             uint32_t kW,
+                             uint32_t padding,
+                             uint32_t strideDst,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_conv2d_i16_parallel), srcH * srcW * kH * kW);
+        }
+
+        plp_conv2d_instance_i16 args = { .pSrc = pSrc,
+                                         .srcH = srcH,
+                                         .srcW = srcW,
+                                         .strideSrc = strideSrc,
+                                         .pKernel = pKernel,
+                                         .kH = kH,
+                                         .kW = kW,
+                                         .padding = padding,
+                                         .strideDst = strideDst,
+                                         .nPE = nPE,
+                                         .pDst = pDst };
+        rt_team_fork(nPE, plp_conv2d_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Convolution2D group
+*/
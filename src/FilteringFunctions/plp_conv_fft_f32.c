@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_fft_f32.c
+ * Description:  32-bit floating-point FFT convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define CONVFFT_MIN_LEN 128
+#define CONVFFT_MAX_FFT_LEN_F32 1024
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FFTConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for the convolution of 32-bit floating-point vectors, which uses the FFT for
+          long vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     0: Success, 1: Not enough memory for the FFT buffers, 2: operation not supported
+*/
+
+int plp_conv_fft_f32(const float32_t *pSrcA,
+                     uint32_t srcALen,
+                     const float32_t *pSrcB,
+                     uint32_t srcBLen,
+                     float32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    }
+
+    uint32_t in1Len, in2Len;
+    const float32_t *pIn1;
+    const float32_t *pIn2;
+
+    if (srcALen >= srcBLen) {
+        in1Len = srcALen;
+        in2Len = srcBLen;
+        pIn1 = pSrcA;
+        pIn2 = pSrcB;
+    } else {
+        in1Len = srcBLen;
+        in2Len = srcALen;
+        pIn1 = pSrcB;
+        pIn2 = pSrcA;
+    }
+
+    uint32_t resLen = in1Len + in2Len - 1;
+    uint32_t fftLen = 16;
+    while (fftLen < resLen && fftLen < CONVFFT_MAX_FFT_LEN_F32) {
+        fftLen <<= 1;
+    }
+
+    if (in2Len < CONVFFT_MIN_LEN || 2 * in2Len > fftLen) {
+        // short kernel: direct convolution
+        plp_conv_f32s_xpulpv2(pIn1, in1Len, pIn2, in2Len, pRes);
+    } else {
+        uint32_t scratchSize = 6 * fftLen * sizeof(float32_t);
+        // the FFT temporaries start in another bank than the output
+        float32_t *pScratch =
+            (float32_t *)plp_l1_alloc(scratchSize, plp_l1_bank(pRes) + PLP_L1_BANKS / 2);
+
+        if (pScratch == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 1;
+        }
+
+        plp_conv_fft_OLA_f32(pIn1, in1Len, pIn2, in2Len, fftLen, pScratch, pRes);
+
+        plp_l1_free(pScratch, scratchSize);
+    }
+
+    return 0;
+}
+
+/**
+   @} end of FFTConvolution group
+*/
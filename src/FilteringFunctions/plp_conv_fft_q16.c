@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_fft_q16.c
+ * Description:  16-bit fixed point FFT convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define CONVFFT_MIN_LEN 128
+#define CONVFFT_MAX_FFT_LEN_Q16 2048
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FFTConvolution FFT Convolution
+   This module contains the glue code for the convolution of long vectors with the help of the
+   FFT. The kernel codes (kernels) are in the Module FFT Convolution Kernels.
+
+   The shorter vector (the filter kernel) is transformed once. The longer vector is split into
+   blocks, each of which is transformed, multiplied with the spectrum of the kernel and
+   transformed back. The results of the blocks are overlap-added into the output vector. The
+   FFT length is the smallest power of two (at least 16) which holds the full result, limited to
+   2048 points for 16-bit fixed point and 1024 points for floating-point, such that the buffers
+   fit into L1. For 16-bit fixed point, the FFT length is further limited to twice the length of
+   the shorter vector, since every doubling of the FFT length costs one bit of precision.
+
+   The glue code selects between the direct convolution and the FFT based convolution from the
+   lengths of the input vectors: If the shorter vector has less than CONVFFT_MIN_LEN elements, or
+   if it is longer than half of the FFT length, the direct convolution is used. The buffers for
+   the FFT are allocated in L1 (cluster) or in FC memory on every call.
+*/
+
+/**
+   @addtogroup FFTConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for the convolution of 16-bit fixed point vectors, which uses the FFT for long
+          vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  fracBits Fixed point position of the result, the result is shifted right by fracBits
+   @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+   @return     0: Success, 1: Not enough memory for the FFT buffers
+
+   @par Fix-Point
+   The result approximates the 32-bit convolution of plp_conv_i16, shifted right by fracBits (with
+   rounding). The FFT is computed with the 16-bit fixed point CFFT, which scales the data down in
+   every stage. Both inputs and the product of the spectra are therefore normalized to the full 16
+   bit range before each transform. The error of the FFT path is in the order of 1% of the largest
+   output value, and may reach a few percent for FFT lengths of 2048 points.
+*/
+
+int plp_conv_fft_q16(const int16_t *pSrcA,
+                     uint32_t srcALen,
+                     const int16_t *pSrcB,
+                     uint32_t srcBLen,
+                     uint32_t fracBits,
+                     int32_t *pRes) {
+
+    uint32_t in1Len, in2Len;
+    const int16_t *pIn1;
+    const int16_t *pIn2;
+
+    if (srcALen >= srcBLen) {
+        in1Len = srcALen;
+        in2Len = srcBLen;
+        pIn1 = pSrcA;
+        pIn2 = pSrcB;
+    } else {
+        in1Len = srcBLen;
+        in2Len = srcALen;
+        pIn1 = pSrcB;
+        pIn2 = pSrcA;
+    }
+
+    uint32_t resLen = in1Len + in2Len - 1;
+    uint32_t fftLen = 16;
+    while (fftLen < resLen && fftLen < 2 * in2Len && fftLen < CONVFFT_MAX_FFT_LEN_Q16) {
+        fftLen <<= 1;
+    }
+
+    if (in2Len < CONVFFT_MIN_LEN || 2 * in2Len > fftLen) {
+        // short kernel: direct convolution
+        if (rt_cluster_id() == ARCHI_FC_CID) {
+            plp_conv_i16s_rv32im(pIn1, in1Len, pIn2, in2Len, pRes);
+        } else {
+            plp_conv_i16s_xpulpv2(pIn1, in1Len, pIn2, in2Len, pRes);
+        }
+
+        if (fracBits > 0) {
+            int32_t round = 1 << (fracBits - 1);
+            for (uint32_t i = 0; i < resLen; i++) {
+                pRes[i] = (pRes[i] + round) >> fracBits;
+            }
+        }
+    } else {
+        int allocFlag = rt_cluster_id() == ARCHI_FC_CID ? RT_ALLOC_FC_DATA : RT_ALLOC_CL_DATA;
+        uint32_t scratchSize = 4 * fftLen * sizeof(int16_t);
+        int16_t *pScratch = (int16_t *)plp_scratch_alloc(allocFlag, scratchSize);
+
+        if (pScratch == NULL) {
+            printf("Error: insufficient memory!\n");
+            return 1;
+        }
+
+        plp_conv_fft_OLA_q16(pIn1, in1Len, pIn2, in2Len, fracBits, fftLen, pScratch, pRes);
+
+        plp_scratch_free(allocFlag, pScratch, scratchSize);
+    }
+
+    return 0;
+}
+
+/**
+   @} end of FFTConvolution group
+*/
@@ -31,8 +31,6 @@
 #include "plp_math.h"
 #include "rt/rt_api.h"
 
-RT_CL_DATA int32_t *resultsBuffer;
-
 /**
    @ingroup groupFilters
 */
@@ -57,114 +55,25 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
                            const uint32_t srcALen,
                            const int16_t *pSrcB,
                            const uint32_t srcBLen,
-                           const uint8_t nPE,
+                           uint8_t nPE,
                            int32_t *pRes) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
-
-        const int16_t *pIn1;
-        const int16_t *pIn2;
-
-        uint32_t pIn1Len;
-        uint32_t pIn2Len;
-
-        if (srcALen >= srcBLen) {
-            pIn2 = pSrcA;
-            pIn1 = pSrcB;
-            pIn2Len = srcALen;
-            pIn1Len = srcBLen;
-        } else {
-            pIn2 = pSrcB;
-            pIn1 = pSrcA;
-            pIn2Len = srcBLen;
-            pIn1Len = srcALen;
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_conv_i16_parallel), srcALen * srcBLen);
         }
 
-        uint32_t srcAoffset = ((pIn1Len + nPE - 1) / nPE);
-        uint32_t resultsoffset = srcAoffset + pIn2Len - 1;
-        uint32_t resultsLen =
-            resultsoffset * (nPE - 1) + (pIn1Len - (srcAoffset * (nPE - 1))) + pIn2Len - 1;
-
-        int32_t *resBuf;
-
-        if (nPE > 1) {
-            resultsBuffer =
-                (int32_t *)rt_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * resultsoffset * nPE);
-            resBuf = resultsBuffer;
-            // printf("Address of resultsBuffer: 0x%x, End: 0x%x\n", resultsBuffer, resultsBuffer +
-            // sizeof(int32_t)*resultsLen);
-        } else {
-            resultsBuffer = pRes;
-        }
-        plp_conv_instance_i16 S = { .srcALen = pIn1Len,
-                                    .srcBLen = pIn2Len,
-                                    .pSrcA = pIn1,
-                                    .pSrcB = pIn2,
-                                    .pRes = resultsBuffer,
+        plp_conv_instance_i16 S = { .srcALen = srcALen,
+                                    .srcBLen = srcBLen,
+                                    .pSrcA = pSrcA,
+                                    .pSrcB = pSrcB,
+                                    .pRes = pRes,
                                     .nPE = nPE };
 
         rt_team_fork(nPE, plp_conv_i16p_xpulpv2, (void *)&S);
-        if (nPE > 1) {
-
-#if defined(PLP_CONV_SEQUENTIALADDING)
-
-            for (uint32_t i = 0; i < resultsoffset; i++) {
-                pRes[i] = resultsBuffer[i];
-            }
-
-            for (uint32_t i = resultsoffset; i < srcALen + srcBLen - 1; i++) {
-                pRes[i] = 0;
-            }
-
-            for (int32_t i = 1; i < nPE - 1; i++) {
-                for (uint32_t j = 0; j < resultsoffset; j++) {
-                    pRes[i * srcAoffset + j] += resultsBuffer[j + i * resultsoffset];
-                }
-            }
-
-            for (uint32_t j = 0; j < resultsLen - resultsoffset * (nPE - 1); j++) {
-                pRes[(nPE - 1) * srcAoffset + j] += resultsBuffer[(nPE - 1) * resultsoffset + j];
-            }
-
-#else
-
-            /* Parallel overlap-adding */
-            plp_conv_parallel_OLA(nPE, pIn1Len, pIn2Len, resultsBuffer);
-
-#if defined(PLP_MATH_LOOPUNROLL)
-
-            uint32_t k = (srcALen + srcBLen - 1) >> 1U;
-            int32_t temp1, temp2;
-
-            while (k) {
-                temp1 = *resultsBuffer++;
-                temp2 = *resultsBuffer++;
-
-                *pRes++ = temp1;
-                *pRes++ = temp2;
-
-                k--;
-            }
-
-            k = (srcALen + srcBLen - 1) % 0x2U;
-
-            if (k) {
-                *pRes++ = *resultsBuffer++;
-            }
-
-#else
-            for (uint32_t i = 0; i < srcALen + srcBLen - 1; i++) {
-                pRes[i] = resultsBuffer[i];
-            }
-#endif
-            rt_free(RT_ALLOC_CL_DATA, resBuf, sizeof(int32_t) * resultsoffset * nPE);
-#endif
-        }
-
-        return;
     }
 }
 
@@ -87,7 +87,7 @@ void plp_conv_i8(const int8_t *pSrcA,
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
 
-        _pRes1_8 = rt_alloc(RT_ALLOC_FC_DATA, sizeof(int32_t) * (resultsoffset));
+        _pRes1_8 = plp_scratch_alloc(RT_ALLOC_FC_DATA, sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_8;
@@ -142,9 +142,13 @@ void plp_conv_i8(const int8_t *pSrcA,
             *pOut++ += *_pRes++;
         }
 
+        plp_scratch_free(RT_ALLOC_FC_DATA, _pRes1_8, sizeof(int32_t) * (resultsoffset));
+
     } else {
 
-        _pRes1_8 = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * (resultsoffset));
+        /* the partial results are added to pRes in lockstep, so they start in another bank */
+        _pRes1_8 = plp_l1_alloc(sizeof(int32_t) * (resultsoffset),
+                                plp_l1_bank(pRes) + PLP_L1_BANKS / 2);
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_8;
@@ -198,8 +202,9 @@ void plp_conv_i8(const int8_t *pSrcA,
         if (k) {
             *pOut++ += *_pRes++;
         }
+
+        plp_l1_free(_pRes1_8, sizeof(int32_t) * (resultsoffset));
     }
-    rt_free(RT_ALLOC_CL_DATA, _pRes1_8, sizeof(int32_t) * (resultsoffset));
 }
 
 /**
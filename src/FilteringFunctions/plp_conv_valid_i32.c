@@ -72,7 +72,7 @@ void plp_conv_valid_i32(const int32_t *pSrcA,
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
 
-        printf("Errorr: Not Implemented!");
+        plp_conv_valid_i32s_rv32im(pIn1, in1Len, pIn2, in2Len, pRes);
 
     } else {
 
@@ -0,0 +1,180 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_rep_bank_i8.c
+ * Description:  8-bit integer filter bank convolution (valid, DMA pipelined) glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BasicConvolution
+ * @{
+ */
+
+/**
+ * @brief Start the DMA transfer of one input segment into L1, replicated 4 times
+ * @param[in]  pSrc    points to the first input element of the segment, on L2
+ * @param[in]  len     number of elements of the segment
+ * @param[out] pDst    points to the L1 buffer of the segment
+ * @param[in]  mem     number of elements between each replication in the L1 buffer
+ * @param[out] copy    DMA transfer, wait on it before using the buffer
+ * @return     none
+ */
+static void plp_conv_valid_rep_bank_load_i8(const int8_t *pSrc,
+                                            uint32_t len,
+                                            int8_t *pDst,
+                                            uint32_t mem,
+                                            rt_dma_copy_t *copy) {
+    int merge = 0;
+    for (uint32_t i = 0; i < 4 && i < len; i++) {
+        rt_dma_memcpy((uintptr_t)(pSrc + i), (uintptr_t)(pDst + i * mem),
+                      sizeof(int8_t) * (len - i), RT_DMA_DIR_EXT2LOC, merge, copy);
+        merge = 1;
+    }
+}
+
+/**
+ * @brief Glue code for the convolution of a 8-bit integer vector with a bank of filters in valid
+ *        range, with the input streamed through L1.
+ * @param[in]  pSrcA      points to the input vector, must be on L2
+ * @param[in]  srcALen    Length of the input vector
+ * @param[in]  pSrcB      points to the filters, numFilters vectors of srcBLen elements each,
+ *                        stored one after the other, must be on L2
+ * @param[in]  srcBLen    Length of each filter, at least 2 and not larger than srcALen
+ * @param[in]  numFilters Number of filters
+ * @param[in]  blockSize  Number of outputs computed per segment of the input
+ * @param[out] pRes       output result returned here, numFilters vectors of
+ *                        srcALen - srcBLen + 1 elements each (filter f starts at
+ *                        pRes + f * (srcALen - srcBLen + 1))
+ * @return     none
+ *
+ * @par
+ * The input is processed in segments of blockSize + srcBLen - 1 elements, which are copied
+ * (replicated like in plp_conv_valid_rep_i8) into one of two L1 buffers. While all filters are
+ * applied to the current segment, the DMA already copies the next segment into the other buffer.
+ * Hence, the input is read from L2 only once for all filters, and the transfers overlap with the
+ * computation. The filters are copied to L1 once. The required L1 memory is
+ * 2 * 4 * (blockSize + srcBLen - 1) + numFilters * srcBLen elements.
+ * On the FC, which has neither L1 nor a DMA, the filters are applied one after the other to
+ * the input in L2, hence blockSize has no effect and srcBLen may be 1.
+ */
+void plp_conv_valid_rep_bank_i8(const int8_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int8_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint32_t numFilters,
+                                const uint32_t blockSize,
+                                int32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+
+        // without L1 and DMA, the filters are applied to the input in L2 one after the other
+        if (srcALen < srcBLen) {
+            printf("Error: filters must fit into the input!\n");
+            return;
+        }
+
+        uint32_t resLen = srcALen - srcBLen + 1;
+        for (uint32_t f = 0; f < numFilters; f++) {
+            plp_conv_valid_i8s_rv32im(pSrcA, srcALen, pSrcB + f * srcBLen, srcBLen,
+                                      pRes + f * resLen);
+        }
+
+    } else {
+
+        if (srcALen < srcBLen || srcBLen < 2 || blockSize == 0) {
+            printf("Error: filters must have at least 2 elements and fit into the input!\n");
+            return;
+        }
+
+        uint32_t resLen = srcALen - srcBLen + 1;
+        uint32_t outLen = (blockSize < resLen) ? blockSize : resLen; // outputs per segment
+        uint32_t numSeg = (resLen + outLen - 1) / outLen;
+
+        // compute required memory size of one buffer, holding a full segment replicated 4 times
+        uint32_t segLen = outLen + srcBLen - 1;
+        uint32_t len_align = ((segLen + 3) >> 2) << 2; // compute aligned memory size
+        uint32_t mem_size = len_align << 2;            // memory size for all 4 replications
+
+        // the segments and the filters are read together, so they start in other banks
+        int8_t *p_1_loc = plp_l1_alloc(sizeof(int8_t) * 2 * mem_size, 0);
+        int8_t *p_2_loc = plp_l1_alloc(sizeof(int8_t) * numFilters * srcBLen, PLP_L1_BANKS / 2);
+
+        if (p_1_loc == NULL || p_2_loc == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            if (p_1_loc != NULL) {
+                plp_l1_free(p_1_loc, sizeof(int8_t) * 2 * mem_size);
+            }
+            if (p_2_loc != NULL) {
+                plp_l1_free(p_2_loc, sizeof(int8_t) * numFilters * srcBLen);
+            }
+            return;
+        }
+
+        rt_dma_copy_t copy[2];
+        rt_dma_copy_t copy_filters;
+
+        rt_dma_memcpy((uintptr_t)pSrcB, (uintptr_t)p_2_loc,
+                      sizeof(int8_t) * numFilters * srcBLen, RT_DMA_DIR_EXT2LOC, 0, &copy_filters);
+        plp_conv_valid_rep_bank_load_i8(pSrcA, segLen, p_1_loc, len_align, &copy[0]);
+        rt_dma_wait(&copy_filters);
+
+        for (uint32_t s = 0; s < numSeg; s++) {
+
+            uint32_t cur = s & 0x1U;
+            uint32_t start = s * outLen;
+            uint32_t segOut = (resLen - start < outLen) ? resLen - start : outLen;
+            int8_t *pSeg = p_1_loc + cur * mem_size;
+
+            rt_dma_wait(&copy[cur]);
+
+            // prefetch the next segment into the other buffer
+            if (s + 1 < numSeg) {
+                uint32_t nextStart = start + outLen;
+                uint32_t nextOut = (resLen - nextStart < outLen) ? resLen - nextStart : outLen;
+                plp_conv_valid_rep_bank_load_i8(pSrcA + nextStart, nextOut + srcBLen - 1,
+                                                p_1_loc + (cur ^ 0x1U) * mem_size, len_align,
+                                                &copy[cur ^ 0x1U]);
+            }
+
+            for (uint32_t f = 0; f < numFilters; f++) {
+                plp_conv_valid_rep_i8s_xpulpv2(pSeg, segOut + srcBLen - 1, len_align,
+                                               p_2_loc + f * srcBLen, srcBLen,
+                                               pRes + f * resLen + start);
+            }
+        }
+
+        plp_l1_free(p_1_loc, sizeof(int8_t) * 2 * mem_size);
+        plp_l1_free(p_2_loc, sizeof(int8_t) * numFilters * srcBLen);
+    }
+}
+
+/**
+ * @} end of BasicConvolution group
+ */
@@ -74,7 +74,8 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
 
-        printf("Errorr: Not Implemented!");
+        // the FC loads single elements, hence the data needs not be replicated in L1
+        plp_conv_valid_i16s_rv32im(pIn1, in1Len, pIn2, in2Len, pRes);
 
     } else {
 
@@ -88,8 +89,9 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
         uint32_t len_align = ((in1Len + 1) >> 1) << 1; // compute aligned memory size
         uint32_t mem_size = len_align << 1;            // memory size for all 2 replications
 
-        int16_t *p_1_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int16_t) * mem_size);
-        int16_t *p_2_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int16_t) * in2Len);
+        // the replicated input and the kernel are read together, so they start in other banks
+        int16_t *p_1_loc = plp_l1_alloc(sizeof(int16_t) * mem_size, 0);
+        int16_t *p_2_loc = plp_l1_alloc(sizeof(int16_t) * in2Len, PLP_L1_BANKS / 2);
 
         if (p_1_loc == NULL || p_2_loc == NULL) {
             printf("Error: insufficient L1 memory!\n");
@@ -101,20 +103,20 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
         int merge = 0;
 
         for (int i = 0; i < 2; i++) {
-            rt_dma_memcpy((unsigned int)(pIn1 + i), (unsigned int)(p_1_loc + i * len_align),
+            rt_dma_memcpy((uintptr_t)(pIn1 + i), (uintptr_t)(p_1_loc + i * len_align),
                           sizeof(int16_t) * (in1Len - i), RT_DMA_DIR_EXT2LOC, merge, &copy);
             merge = 1;
         }
 
-        rt_dma_memcpy((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int16_t) * in2Len,
+        rt_dma_memcpy((uintptr_t)pIn2, (uintptr_t)p_2_loc, sizeof(int16_t) * in2Len,
                       RT_DMA_DIR_EXT2LOC, merge, &copy);
 
         rt_dma_wait(&copy);
 
         plp_conv_valid_rep_i16s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
 
-        rt_free(RT_ALLOC_CL_DATA, p_1_loc, sizeof(int16_t) * mem_size);
-        rt_free(RT_ALLOC_CL_DATA, p_2_loc, sizeof(int16_t) * in2Len);
+        plp_l1_free(p_1_loc, sizeof(int16_t) * mem_size);
+        plp_l1_free(p_2_loc, sizeof(int16_t) * in2Len);
     }
 }
 
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_winograd_f32_parallel.c
+ * Description:  Parallel 32-bit floating-point Winograd convolution glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup WinogradConv
+   @{
+*/
+
+/**
+   @brief Glue code for parallel valid 2D convolution of 32-bit floating-point images with a
+   3-tap or 3x3 filter kernel with the Winograd algorithm.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_f32
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_f32_parallel(const plp_conv_winograd_instance_f32 *S,
+                                          const float32_t *__restrict__ pSrc,
+                                          uint32_t srcH,
+                                          uint32_t srcW,
+                                          uint32_t strideSrc,
+                                          uint32_t strideDst,
+                                          uint32_t nPE,
+                                          float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_conv_valid_winograd_f32_parallel),
+                               srcH * srcW * 3 * S->kH);
+        }
+
+        plp_conv_valid_winograd_parallel_instance_f32 args = { .S = S,
+                                                               .pSrc = pSrc,
+                                                               .srcH = srcH,
+                                                               .srcW = srcW,
+                                                               .strideSrc = strideSrc,
+                                                               .strideDst = strideDst,
+                                                               .nPE = nPE,
+                                                               .pDst = pDst };
+        rt_team_fork(nPE, plp_conv_valid_winograd_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of WinogradConv group
+*/
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_winograd_i16.c
+ * Description:  16-bit integer Winograd convolution glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup WinogradConv Winograd Convolution
+   This module contains the glue code for the valid 2D convolution of images with 3-tap (1 x 3) and
+   3x3 filter kernels with the minimal filtering algorithms of Winograd. The kernel codes (kernels)
+   are in the Module Winograd Convolution Kernels.
+
+   The result is the same as of plp_conv2d_i16 with PLP_CONV2D_VALID (a 1D convolution of every
+   row for the 3-tap filter, e.g. of a single vector with srcH = 1). The output is computed in
+   tiles of 2 pixels (F(2,3)) or 2x2 pixels (F(2x2,3x3)), which need 4 instead of 6, or 16 instead
+   of 36 multiplications. The filter kernel is transformed once by plp_conv_winograd_init_i16 or
+   plp_conv_winograd_init_f32, and the transformed kernel is reused by all calls. The remaining
+   column (odd output width) and row (odd output height) are computed directly.
+
+   The 16-bit transform is scaled by 2 (or 4 for 3x3), such that all values are integers, and the
+   result is shifted back at the end. The intermediate values are up to 4 (or 16) times larger
+   than the output: the result is exact if its magnitude is below 2^30 (or 2^29). Use
+   plp_conv2d_i16 for larger results. On the cluster, the direct convolution of 16-bit images uses
+   SIMD dot products, so the Winograd version mostly pays off for the floating-point images.
+*/
+
+/**
+   @addtogroup WinogradConv
+   @{
+*/
+
+/**
+   @brief Glue code for valid 2D convolution of 16-bit integer images with a 3-tap or
+   3x3 filter kernel with the Winograd algorithm.
+   @param[in]  S         points to an instance initialized by plp_conv_winograd_init_i16
+   @param[in]  pSrc      points to the input image
+   @param[in]  srcH      height of the input image
+   @param[in]  srcW      width of the input image
+   @param[in]  strideSrc Stride of the input image (elements between each row)
+   @param[in]  strideDst Stride of the output image (elements between each row)
+   @param[out] pDst      points to the output image, (srcH - kH + 1) x (srcW - 2) pixels
+   @return     none
+*/
+
+void plp_conv_valid_winograd_i16(const plp_conv_winograd_instance_i16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t srcH,
+                                 uint32_t srcW,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv_valid_winograd_i16s_rv32im(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst);
+    } else {
+        plp_conv_valid_winograd_i16s_xpulpv2(S, pSrc, srcH, srcW, strideSrc, strideDst, pDst);
+    }
+}
+
+/**
+   @} end of WinogradConv group
+*/
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_winograd_init_i16.c
+ * Description:  Initialization of the 16-bit integer Winograd convolution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup WinogradConv
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit integer Winograd convolution instance.
+   @param[out] S         points to an instance of the Winograd convolution structure
+   @param[in]  pKernel   points to the filter kernel of size kH x 3 (dense), which must stay
+                         valid while the instance is used
+   @param[in]  kH        height of the filter kernel, 1 (3 taps) or 3 (3x3)
+   @param[out] pCoeffs   points to the transformed filter kernel, 4 (kH = 1) or 16 (kH = 3) values
+   @return     none
+
+   @par
+   The kernel is flipped (convolution instead of correlation) and transformed with G g G^T (3x3)
+   or G g (3 taps), where G is the 4x3 filter transform of F(2,3) scaled by 2, i.e.
+   [2 0 0; 1 1 1; 1 -1 1; 0 0 2], such that all values are integers.
+*/
+
+void plp_conv_winograd_init_i16(plp_conv_winograd_instance_i16 *S,
+                                const int16_t *pKernel,
+                                uint32_t kH,
+                                int32_t *pCoeffs) {
+
+    int32_t g[3], t[12];
+    uint32_t r, c; // loop counters
+
+    S->kH = kH;
+    S->pKernel = pKernel;
+    S->pCoeffs = pCoeffs;
+
+    if (kH == 1) {
+        g[0] = pKernel[2];
+        g[1] = pKernel[1];
+        g[2] = pKernel[0];
+        pCoeffs[0] = 2 * g[0];
+        pCoeffs[1] = g[0] + g[1] + g[2];
+        pCoeffs[2] = g[0] - g[1] + g[2];
+        pCoeffs[3] = 2 * g[2];
+        return;
+    }
+
+    // G times the columns of the flipped kernel
+    for (c = 0; c < 3; c++) {
+        g[0] = pKernel[8 - c];
+        g[1] = pKernel[5 - c];
+        g[2] = pKernel[2 - c];
+        t[c] = 2 * g[0];
+        t[3 + c] = g[0] + g[1] + g[2];
+        t[6 + c] = g[0] - g[1] + g[2];
+        t[9 + c] = 2 * g[2];
+    }
+
+    // the rows times G^T
+    for (r = 0; r < 4; r++) {
+        pCoeffs[r * 4] = 2 * t[r * 3];
+        pCoeffs[r * 4 + 1] = t[r * 3] + t[r * 3 + 1] + t[r * 3 + 2];
+        pCoeffs[r * 4 + 2] = t[r * 3] - t[r * 3 + 1] + t[r * 3 + 2];
+        pCoeffs[r * 4 + 3] = 2 * t[r * 3 + 2];
+    }
+}
+
+/**
+   @} end of WinogradConv group
+*/
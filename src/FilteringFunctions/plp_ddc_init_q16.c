@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point digital down-converter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup DDC Digital Down-Converters
+   This module contains digital down-converters (DDC), which move a band of a real signal to the
+   baseband and reduce the sampling rate. A DDC chains an NCO mixer (see NCO), which multiplies
+   the input with exp(-j * phase), with one FIR decimator (see FIRDecimate) for the in-phase and
+   one for the quadrature component. The decimators usually share the coefficients, but need
+   separate state buffers. All stages keep their state across calls, such that a stream can be
+   processed block by block.
+
+   The mixer writes the in-phase and the quadrature samples of a block into a scratch buffer of
+   2 * blockSize samples, from which the decimators compute only the outputs which are kept.
+*/
+
+/**
+   @addtogroup DDC
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point digital down-converter instance.
+   @param[out] S      points to an instance of the 16-bit fixed point DDC structure
+   @param[in]  pNco   points to an initialized NCO mixer, which is advanced by every call
+   @param[in]  pDecI  points to an initialized FIR decimator of the in-phase component
+   @param[in]  pDecQ  points to an initialized FIR decimator of the quadrature component, with the
+                      same decimation factor as pDecI
+   @return     none
+*/
+void plp_ddc_init_q16(plp_ddc_instance_q16 *S,
+                      plp_nco_instance_q16 *pNco,
+                      const plp_fir_decimate_instance_q16 *pDecI,
+                      const plp_fir_decimate_instance_q16 *pDecQ) {
+    S->pNco = pNco;
+    S->pDecI = pDecI;
+    S->pDecQ = pDecQ;
+}
+
+/**
+   @} end of DDC group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_q16.c
+ * Description:  Glue code for the 16-bit fixed point digital down-converter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup DDC
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point digital down-converter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point DDC
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of the decimation factor M
+                         and at most the blockSize passed to the init of the decimators
+   @param[in]  pScratch  points to a scratch buffer of 2 * blockSize samples
+   @param[out] pDstI     points to the block of blockSize / M in-phase output samples
+   @param[out] pDstQ     points to the block of blockSize / M quadrature output samples
+   @return     none
+*/
+void plp_ddc_q16(const plp_ddc_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pScratch,
+                 int16_t *__restrict__ pDstI,
+                 int16_t *__restrict__ pDstQ) {
+
+    int16_t *pMixI = pScratch;
+    int16_t *pMixQ = pScratch + blockSize;
+
+    plp_nco_mix_q16(S->pNco, pSrc, blockSize, pMixI, pMixQ);
+    plp_fir_decimate_q16(S->pDecI, pMixI, blockSize, pDstI);
+    plp_fir_decimate_q16(S->pDecQ, pMixQ, blockSize, pDstQ);
+}
+
+/**
+   @} end of DDC group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_init_f32.c
+ * Description:  32-bit floating-point FIR decimator initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIRDecimate
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point FIR decimator instance.
+   @param[out] S         points to an instance of the 32-bit floating-point FIR decimator structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  M         Decimation factor
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call, a multiple
+                         of M
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_fir_decimate_init_f32(plp_fir_decimate_instance_f32 *S,
+                               uint32_t numTaps,
+                               uint32_t M,
+                               const float *pCoeffs,
+                               float *pState,
+                               uint32_t blockSize) {
+
+    uint32_t i;
+
+    S->M = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of FIRDecimate group
+*/
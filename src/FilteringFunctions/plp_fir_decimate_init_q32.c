@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_init_q32.c
+ * Description:  32-bit fixed point FIR decimator initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FIRDecimate FIR Decimators
+   This module contains the glue code for stateful polyphase FIR decimators. The kernel codes
+   (kernels) are in the Module FIR Decimator Kernels.
+
+   A decimator by the factor M filters the input signal with an anti-aliasing FIR filter and keeps
+   every M-th output sample. Only the outputs which are kept are computed, which saves a factor of
+   M compared to filtering at the full rate and discarding the other outputs:
+
+       `y[m] = b[0] * x[mM+M-1] + b[1] * x[mM+M-2] + ... + b[numTaps-1] * x[mM+M-numTaps]`
+
+   The coefficients are stored in time-reversed order, i.e. `pCoeffs = {b[numTaps-1], ..., b[0]}`,
+   as for the FIR filters. The state buffer has to hold `numTaps + blockSize - 1` samples, where
+   blockSize is the largest number of input samples processed in one call. blockSize has to be a
+   multiple of M, and every call produces blockSize / M output samples.
+*/
+
+/**
+   @addtogroup FIRDecimate
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed point FIR decimator instance.
+   @param[out] S         points to an instance of the 32-bit fixed point FIR decimator structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  M         Decimation factor
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call, a multiple
+                         of M
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_fir_decimate_init_q32(plp_fir_decimate_instance_q32 *S,
+                               uint32_t numTaps,
+                               uint32_t M,
+                               const int32_t *pCoeffs,
+                               int32_t *pState,
+                               uint32_t blockSize,
+                               uint32_t fracBits) {
+
+    uint32_t i;
+
+    S->M = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of FIRDecimate group
+*/
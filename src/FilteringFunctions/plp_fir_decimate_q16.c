@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q16.c
+ * Description:  16-bit fixed point FIR decimator glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIRDecimate
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point FIR decimator.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR decimator
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, a multiple of M and at most the
+                         blockSize passed to the init
+   @param[out] pDst      points to the block of blockSize / M output samples
+   @return     none
+
+   @par Fix-Point
+   The products are accumulated in a 32-bit accumulator, and the sum is shifted right by fracBits
+   (with rounding) and truncated to the output type. The accumulator wraps around on overflow.
+*/
+void plp_fir_decimate_q16(const plp_fir_decimate_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_decimate_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_fir_decimate_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of FIRDecimate group
+*/
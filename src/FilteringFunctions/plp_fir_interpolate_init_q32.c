@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_init_q32.c
+ * Description:  32-bit fixed point FIR interpolator initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FIRInterpolate FIR Interpolators
+   This module contains the glue code for stateful polyphase FIR interpolators. The kernel codes
+   (kernels) are in the Module FIR Interpolator Kernels.
+
+   An interpolator by the factor L inserts L - 1 zeros after every input sample and filters the
+   result with an FIR filter of numTaps coefficients. The multiplications with the inserted zeros
+   are skipped: The filter is split into L phases of phaseLength = numTaps / L coefficients each,
+   and output L * n + p is computed with phase p only:
+
+       `y[nL+p] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+(phaseLength-1)L] * x[n-phaseLength+1]`
+
+   The coefficients are stored in time-reversed order, i.e. `pCoeffs = {b[numTaps-1], ..., b[0]}`,
+   as for the FIR filters. numTaps has to be a multiple of L. The state buffer has to hold
+   `phaseLength + blockSize - 1` samples, where blockSize is the largest number of input samples
+   processed in one call. Every call produces blockSize * L output samples.
+*/
+
+/**
+   @addtogroup FIRInterpolate
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed point FIR interpolator instance.
+   @param[out] S         points to an instance of the 32-bit fixed point FIR interpolator structure
+   @param[in]  L         Interpolation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                  uint32_t L,
+                                  uint32_t numTaps,
+                                  const int32_t *pCoeffs,
+                                  int32_t *pState,
+                                  uint32_t blockSize,
+                                  uint32_t fracBits) {
+
+    uint32_t i;
+
+    S->L = L;
+    S->phaseLength = numTaps / L;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < S->phaseLength + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of FIRInterpolate group
+*/
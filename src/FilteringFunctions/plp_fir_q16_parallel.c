@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q16_parallel.c
+ * Description:  16-bit fixed point parallel FIR filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIR
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel 16-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @param[in]  nPE       Number of cores to use for computation
+   @param[out] pDst      points to the block of output samples
+   @return     none
+
+   @par
+   The output block is split into nPE contiguous chunks, one per core.
+
+   @par Fix-Point
+   The products are accumulated in a 32-bit accumulator, and the sum is shifted right by fracBits
+   (with rounding) and truncated to the output type. The accumulator wraps around on overflow.
+*/
+void plp_fir_q16_parallel(const plp_fir_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_fir_q16_parallel), S->numTaps * blockSize);
+        }
+
+        plp_fir_parallel_instance_q16 args = {
+            .S = S, .pSrc = pSrc, .blockSize = blockSize, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_fir_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of FIR group
+*/
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q32.c
+ * Description:  32-bit fixed point FIR filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIR
+   @{
+*/
+
+/**
+   @brief Glue code for the 32-bit fixed point FIR filter.
+   @param[in]  S         points to an initialized instance of the 32-bit fixed point FIR filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @param[out] pDst      points to the block of output samples
+   @return     none
+
+   @par Fix-Point
+   Every product is shifted right by fracBits (with rounding) before it is accumulated. The
+   accumulation is done in 32 bits and wraps around on overflow.
+*/
+void plp_fir_q32(const plp_fir_instance_q32 *S,
+                 const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_q32s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_fir_q32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of FIR group
+*/
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point Hilbert FIR filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup HilbertFIR Hilbert FIR Filters
+   This module contains the glue code for stateful FIR Hilbert transformers, which shift every
+   frequency component of a signal by -90 degrees, e.g. to generate the quadrature component of
+   an analytic signal for envelope detection. The kernel codes (kernels) are in the Module Hilbert
+   FIR Filter Kernels.
+
+   A Hilbert transformer of odd length numTaps = 2M + 1 is antisymmetric around its center M, and
+   every other coefficient is zero: the ideal response is h[M + m] = 2 / (pi m) for odd m and 0
+   for even m, which is usually multiplied with a window. For numTaps = 3 (mod 4), M is odd and
+   the nonzero coefficients are b[0], b[2], ..., b[numTaps-1], such that
+
+       `y[n] = b[0] * x[n] + b[2] * x[n-2] + ... + b[numTaps-1] * x[n-numTaps+1]`
+
+   Only the (numTaps + 1) / 2 nonzero coefficients are stored, in time-reversed order, i.e.
+   `pCoeffs = {b[numTaps-1], ..., b[2], b[0]}`, which halves the number of multiplications
+   compared with a generic FIR filter. Since even outputs only depend on even inputs and odd outputs
+   on odd inputs, the state buffer keeps the two phases of the input in separate delay lines, on
+   which the nonzero coefficients are contiguous dot products. The output is delayed by M samples,
+   i.e. the in-phase component of the analytic signal is the input delayed by M samples.
+*/
+
+/**
+   @addtogroup HilbertFIR
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point Hilbert FIR filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point Hilbert FIR filter
+                         structure
+   @param[in]  numTaps   Length of the filter, including the zero coefficients, numTaps = 3 (mod 4)
+   @param[in]  pCoeffs   points to the (numTaps + 1) / 2 nonzero filter coefficients, in
+                         time-reversed order
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  blockSize Maximum number of samples that are processed per call, even
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_hilbert_fir_init_q16(plp_hilbert_fir_instance_q16 *S,
+                              uint32_t numTaps,
+                              const int16_t *pCoeffs,
+                              int16_t *pState,
+                              uint32_t blockSize,
+                              uint32_t fracBits) {
+
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->pStateOdd = pState + (numTaps - 1) / 2 + blockSize / 2;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of HilbertFIR group
+*/
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_levinson_durbin_f32.c
+ * Description:  32-bit floating-point Levinson-Durbin recursion glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup LevinsonDurbin Levinson-Durbin Recursion
+   This module contains the glue code for the Levinson-Durbin recursion. The kernel codes
+   (kernels) are in the Module Levinson-Durbin Recursion Kernels.
+
+   The recursion computes the coefficients of the linear prediction of order p from the
+   autocorrelation phi of a signal (e.g. of plp_autocorr_q16), such that
+
+   \f[
+      \hat{x}[n] = \sum_{j=1}^{p} a[j-1] \cdot x[n-j]
+   \f]
+
+   has the smallest error energy. The reflection coefficients are the last coefficients of the
+   predictors of order 1 to p, i.e. refl[i-1] is a[i-1] of the predictor of order i. They are
+   smaller than 1 in magnitude for a positive definite autocorrelation. The error energy is the one
+   of the predictor of order p.
+
+   The recursion needs order divisions and order^2 multiplications, instead of the inversion of
+   the Toeplitz matrix of the autocorrelation.
+*/
+
+/**
+   @addtogroup LevinsonDurbin
+   @{
+*/
+
+/**
+   @brief Glue code for the Levinson-Durbin recursion of 32-bit floating-point values.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+
+int plp_levinson_durbin_f32(const float32_t *__restrict__ pPhi,
+                            uint32_t order,
+                            float32_t *__restrict__ pA,
+                            float32_t *__restrict__ pRefl,
+                            float32_t *__restrict__ pErr) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_levinson_durbin_f32s_xpulpv2(pPhi, order, pA, pRefl, pErr);
+    }
+}
+
+/**
+   @} end of LevinsonDurbin group
+*/
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_levinson_durbin_q32.c
+ * Description:  32-bit fixed-point Levinson-Durbin recursion glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup LevinsonDurbin
+   @{
+*/
+
+/**
+   @brief Glue code for the Levinson-Durbin recursion of 32-bit fixed point values.
+   @param[in]  pPhi       points to the autocorrelation, lags 0 to order
+   @param[in]  order      order of the linear prediction
+   @param[in]  fracBits   number of fractional bits of the coefficients, 0 to 31
+   @param[out] pA         points to the order prediction coefficients
+   @param[out] pRefl      points to the order reflection coefficients
+   @param[out] pErr       prediction error energy, in the format of pPhi
+   @return     0: Success, 1: autocorrelation is not positive definite, 2: operation not supported
+*/
+
+int plp_levinson_durbin_q32(const int64_t *__restrict__ pPhi,
+                            uint32_t order,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pA,
+                            int32_t *__restrict__ pRefl,
+                            int64_t *__restrict__ pErr) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_levinson_durbin_q32s_rv32im(pPhi, order, fracBits, pA, pRefl, pErr);
+    } else {
+        return plp_levinson_durbin_q32s_xpulpv2(pPhi, order, fracBits, pA, pRefl, pErr);
+    }
+}
+
+/**
+   @} end of LevinsonDurbin group
+*/
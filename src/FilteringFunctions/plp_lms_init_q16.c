@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_init_q16.c
+ * Description:  16-bit fixed point LMS filter initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup LMS LMS Filters
+   This module contains the glue code for the least mean square (LMS) and the normalized LMS
+   adaptive filters. The kernel codes (kernels) are in the Module LMS Filter Kernels.
+
+   An LMS filter is a FIR filter, whose coefficients are adapted after every sample such that the
+   output `y[n]` follows the reference signal `d[n]` (e.g. the echo in an echo canceller):
+
+       `y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]`
+
+       `e[n] = d[n] - y[n]`
+
+       `b[k] = b[k] + mu * e[n] * x[n-k]`
+
+   The normalized LMS filter divides the step size mu by the energy of the current input window,
+   `x[n]^2 + ... + x[n-numTaps+1]^2`, which makes the convergence independent of the input level.
+
+   Like for the FIR filters, the coefficients are stored in time-reversed order, i.e. `pCoeffs =
+   {b[numTaps-1], ..., b[0]}`, and the state buffer has to hold `numTaps + blockSize - 1`
+   samples, where blockSize is the largest number of samples processed in one call. The
+   coefficients are updated in place, such that the filter keeps adapting across blocks.
+*/
+
+/**
+   @addtogroup LMS
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point LMS filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point LMS filter structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the initial filter coefficients, in time-reversed order. The
+                         coefficients are adapted in place.
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  mu        Step size of the coefficient update, with fracBits fractional bits
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients, inputs and mu
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint32_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t blockSize,
+                      uint32_t fracBits) {
+
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of LMS group
+*/
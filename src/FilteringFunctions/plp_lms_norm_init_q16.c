@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_init_q16.c
+ * Description:  16-bit fixed point normalized LMS filter initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup LMS
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point normalized LMS filter instance.
+   @param[out] S         points to an instance of the 16-bit fixed point normalized LMS filter
+                         structure
+   @param[in]  numTaps   Number of filter coefficients
+   @param[in]  pCoeffs   points to the initial filter coefficients, in time-reversed order. The
+                         coefficients are adapted in place.
+   @param[in]  pState    points to the state buffer of size numTaps + blockSize - 1
+   @param[in]  mu        Step size of the coefficient update, with fracBits fractional bits
+   @param[in]  blockSize Maximum number of samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients, inputs and mu
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_lms_norm_init_q16(plp_lms_norm_instance_q16 *S,
+                           uint32_t numTaps,
+                           int16_t *pCoeffs,
+                           int16_t *pState,
+                           int16_t mu,
+                           uint32_t blockSize,
+                           uint32_t fracBits) {
+
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of LMS group
+*/
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16.c
+ * Description:  16-bit fixed point LMS filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup LMS
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point LMS filter.
+   @param[in]  S         points to an initialized instance of the 16-bit fixed point LMS filter
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  pRef      points to the block of reference (desired) samples
+   @param[out] pOut      points to the block of output samples
+   @param[out] pErr      points to the block of error samples, pRef - pOut
+   @param[in]  blockSize Number of samples to process, at most the blockSize passed to the init
+   @return     none
+
+   @par Fix-Point
+   The filter output is accumulated in a 32-bit accumulator, shifted right by fracBits (with
+   rounding) and truncated to 16 bits, like for plp_fir_q16. The error is saturated to 16 bits. The
+   coefficient update `mu * e[n] * x[n-k]` is rounded to fracBits after each multiplication, and
+   the updated coefficients are saturated to 16 bits.
+*/
+void plp_lms_q16(const plp_lms_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 const int16_t *__restrict__ pRef,
+                 int16_t *__restrict__ pOut,
+                 int16_t *__restrict__ pErr,
+                 uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_lms_q16s_rv32im(S, pSrc, pRef, pOut, pErr, blockSize);
+    } else {
+        plp_lms_q16s_xpulpv2(S, pSrc, pRef, pOut, pErr, blockSize);
+    }
+}
+
+/**
+   @} end of LMS group
+*/
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16.c
+ * Description:  16-bit integer median filter glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup MedianFilter Median Filters
+   This module contains the glue code for the median filters. The kernel codes (kernels) are in
+   the Module Median Filter Kernels.
+
+   A median filter of numTaps (odd) taps replaces every sample by the median of the numTaps samples
+   centered around it:
+
+       `y[n] = median(x[n - numTaps/2], ..., x[n + numTaps/2])`
+
+   It removes impulsive noise (spikes) while keeping edges, unlike a moving average. The output
+   has the same length as the input. At the borders, the first and the last input samples are
+   replicated. To filter a stream in blocks, the blocks have to overlap by numTaps - 1 samples.
+
+   For 3, 5 and 9 taps, the median is computed with a sorting network of 3, 7 and 19 compare and
+   exchange operations. On the cluster, the 16-bit integer kernel computes two outputs at once with
+   the SIMD min and max instructions. Other odd window lengths up to PLP_MEDIAN_FILTER_MAX_TAPS use
+   a partial selection sort. The parallel functions split the output into contiguous segments.
+*/
+
+/**
+   @addtogroup MedianFilter
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit integer median filter.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[out] pDst      points to the output vector of length blockSize
+   @return     none
+*/
+void plp_median_filter_i16(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t numTaps,
+                           int16_t *__restrict__ pDst) {
+
+    if ((numTaps & 1) == 0 || numTaps > PLP_MEDIAN_FILTER_MAX_TAPS) {
+        printf("Error: numTaps must be odd and at most PLP_MEDIAN_FILTER_MAX_TAPS\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_median_filter_i16s_rv32im(pSrc, blockSize, numTaps, 0, blockSize, pDst);
+    } else {
+        plp_median_filter_i16s_xpulpv2(pSrc, blockSize, numTaps, 0, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of MedianFilter group
+*/
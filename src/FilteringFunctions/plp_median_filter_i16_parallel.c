@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16_parallel.c
+ * Description:  16-bit integer parallel median filter glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup MedianFilter
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel 16-bit integer median filter.
+   @param[in]  pSrc      points to the input vector
+   @param[in]  blockSize Number of input (and output) samples
+   @param[in]  numTaps   Length of the window, odd and at most PLP_MEDIAN_FILTER_MAX_TAPS
+   @param[in]  nPE       Number of cores to compute on
+   @param[out] pDst      points to the output vector of length blockSize
+   @return     none
+*/
+void plp_median_filter_i16_parallel(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t numTaps,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if ((numTaps & 1) == 0 || numTaps > PLP_MEDIAN_FILTER_MAX_TAPS) {
+            printf("Error: numTaps must be odd and at most PLP_MEDIAN_FILTER_MAX_TAPS\n");
+            return;
+        }
+
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_median_filter_i16_parallel), blockSize * numTaps);
+        }
+
+        plp_median_filter_instance_i16 S = { .pSrc = pSrc,
+                                             .blockSize = blockSize,
+                                             .numTaps = numTaps,
+                                             .nPE = nPE,
+                                             .pDst = pDst };
+
+        rt_team_fork(nPE, plp_median_filter_i16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of MedianFilter group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point moving-average filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup MovingAvg
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point moving-average filter instance.
+   @param[out] S       points to an instance of the 32-bit floating-point moving-average filter
+                       structure
+   @param[in]  length  Length L of the averaging window, at least 1
+   @param[in]  pState  points to the state buffer of size length
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_moving_avg_init_f32(plp_moving_avg_instance_f32 *S, uint32_t length, float32_t *pState) {
+
+    uint32_t i;
+
+    S->length = length;
+    S->pState = pState;
+    S->index = 0;
+    S->sum = 0.0f;
+    S->invLength = 1.0f / (float32_t)length;
+
+    for (i = 0; i < length; i++) {
+        pState[i] = 0.0f;
+    }
+}
+
+/**
+   @} end of MovingAvg group
+*/
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_init_i16.c
+ * Description:  Initialization of the 16-bit integer moving-average filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup MovingAvg Moving-Average Filters
+   This module contains the glue code for the moving-average filters. The kernel codes (kernels)
+   are in the Module Moving-Average Filter Kernels.
+
+   A moving-average filter of length L outputs the mean of the last L input samples:
+
+       `y[n] = (x[n] + x[n-1] + ... + x[n-L+1]) / L`
+
+   Instead of computing it as a FIR filter with L equal taps (L multiply-accumulate operations per
+   output), the filters are recursive: they keep the running sum of the window, and update it
+   with one addition and one subtraction per sample, `sum += x[n] - x[n-L]`. The last L input
+   samples are kept in a circular state buffer of length L, together with the running sum, such
+   that a signal can be processed in blocks of any size, with the same result as if it was
+   processed at once.
+
+   The 16-bit integer filter keeps the sum with 32 bits, and divides it by L with a 2^30 / L
+   multiplier, rounded to the nearest integer. The 32-bit floating-point filter recomputes the sum
+   from the state buffer every L samples, such that the rounding errors of the running sum do not
+   accumulate over time.
+*/
+
+/**
+   @addtogroup MovingAvg
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit integer moving-average filter instance.
+   @param[out] S       points to an instance of the 16-bit integer moving-average filter structure
+   @param[in]  length  Length L of the averaging window, at least 1
+   @param[in]  pState  points to the state buffer of size length
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero.
+*/
+void plp_moving_avg_init_i16(plp_moving_avg_instance_i16 *S, uint32_t length, int16_t *pState) {
+
+    uint32_t i;
+
+    S->length = length;
+    S->pState = pState;
+    S->index = 0;
+    S->sum = 0;
+    S->recip = (int32_t)(((1U << 30) + (length >> 1)) / length);
+
+    for (i = 0; i < length; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of MovingAvg group
+*/
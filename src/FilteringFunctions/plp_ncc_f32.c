@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ncc_f32.c
+ * Description:  32-bit floating-point normalized cross-correlation glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup NCC
+   @{
+*/
+
+/**
+   @brief Glue code for the normalized cross-correlation of 32-bit float vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients
+   @return     none
+*/
+
+void plp_ncc_f32(const float32_t *__restrict__ pSrc,
+                 uint32_t srcLen,
+                 const float32_t *__restrict__ pTmpl,
+                 uint32_t tmplLen,
+                 float32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("error: FC doesn't have FPU\n");
+        return;
+    } else {
+        plp_ncc_f32s_xpulpv2(pSrc, srcLen, pTmpl, tmplLen, pRes);
+    }
+}
+
+/**
+   @} end of NCC group
+*/
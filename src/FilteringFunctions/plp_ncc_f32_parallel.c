@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ncc_f32_parallel.c
+ * Description:  32-bit floating-point parallel normalized cross-correlation glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup NCC
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel normalized cross-correlation of 32-bit float vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients
+   @return     none
+
+   @par
+   The positions are partitioned into contiguous ranges, one per core. Every core computes the
+   energy of its first window and updates it from there, the result is identical to the one of
+   plp_ncc_f32.
+*/
+
+void plp_ncc_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t srcLen,
+                          const float32_t *__restrict__ pTmpl,
+                          uint32_t tmplLen,
+                          uint8_t nPE,
+                          float32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (srcLen < tmplLen) {
+            return;
+        }
+
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_ncc_f32_parallel),
+                               (srcLen - tmplLen + 1) * tmplLen);
+        }
+
+        plp_ncc_instance_f32 S = { .pSrc = pSrc,
+                                  .srcLen = srcLen,
+                                  .pTmpl = pTmpl,
+                                  .tmplLen = tmplLen,
+                                  .nPE = nPE,
+                                  .pRes = pRes };
+
+        rt_team_fork(nPE, plp_ncc_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of NCC group
+*/
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ncc_i16.c
+ * Description:  16-bit integer normalized cross-correlation glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup NCC Normalized Cross-Correlation
+   This module contains the glue code for the normalized cross-correlation. The kernel codes
+   (kernels) are in the Module Normalized Cross-Correlation Kernels.
+
+   The template t of length M is matched against every position l = 0 to N - M of the signal x
+   of length N:
+
+   \f[
+      ncc[l] = \frac{\sum_{m=0}^{M-1} t[m] \cdot x[l+m]}
+                    {\sqrt{\sum_{m=0}^{M-1} t[m]^2 \cdot \sum_{m=0}^{M-1} x[l+m]^2}}
+   \f]
+
+   The coefficients are in [-1, 1], where 1 means that the window of the signal is a positive
+   multiple of the template. Positions, where the window or the template has no energy, result in
+   0. The energy of the window is updated with the sample, which enters it, and the one, which
+   leaves it, in the loop over the positions (2 multiplications per position, instead of M). The
+   16-bit version updates it exactly in 64 bits and computes the quotient with the inverse square
+   root table and Newton iterations, without division.
+
+   The parallel versions partition the positions into contiguous ranges, one per core.
+*/
+
+/**
+   @addtogroup NCC
+   @{
+*/
+
+/**
+   @brief Glue code for the normalized cross-correlation of 16-bit integer vectors.
+   @param[in]  pSrc       points to the input signal
+   @param[in]  srcLen     length of the input signal
+   @param[in]  pTmpl      points to the template
+   @param[in]  tmplLen    length of the template, at most srcLen
+   @param[out] pRes       points to the output vector of srcLen - tmplLen + 1 coefficients in Q15
+   @return     none
+*/
+
+void plp_ncc_i16(const int16_t *__restrict__ pSrc,
+                 uint32_t srcLen,
+                 const int16_t *__restrict__ pTmpl,
+                 uint32_t tmplLen,
+                 int16_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_ncc_i16s_rv32im(pSrc, srcLen, pTmpl, tmplLen, pRes);
+    } else {
+        plp_ncc_i16s_xpulpv2(pSrc, srcLen, pTmpl, tmplLen, pRes);
+    }
+}
+
+/**
+   @} end of NCC group
+*/
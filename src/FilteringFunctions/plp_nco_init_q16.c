@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point NCO mixer
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup NCO Numerically Controlled Oscillator Mixers
+   This module contains the glue code for stateful mixers with a numerically controlled oscillator
+   (NCO), which shift a real signal down in frequency, e.g. as the first stage of a digital
+   down-converter (see DDC). The kernel codes (kernels) are in the Module NCO Mixer Kernels.
+
+   The oscillator keeps a 32-bit phase accumulator, in which 2^32 corresponds to 2 * pi. It
+   advances by phaseInc = round(f / fs * 2^32) per sample, where f is the oscillator frequency and
+   fs the sampling rate. Negative frequencies are given as the two's complement of the phase
+   increment. Every input sample is multiplied with the complex exponential exp(-j * phase):
+
+       `I[n] = x[n] * cos(phase[n])`
+       `Q[n] = -x[n] * sin(phase[n])`
+
+   The sine and the cosine are interpolated in the sine table of the fast math functions, with
+   the upper 9 bits of the phase as the table index and the next 14 bits as the weight, and the
+   phase after the last sample is kept in the instance for the next block. Hence, the oscillator,
+   the mixer and the phase update are a single loop without intermediate buffers.
+*/
+
+/**
+   @addtogroup NCO
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point NCO mixer instance.
+   @param[out] S         points to an instance of the 16-bit fixed point NCO mixer structure
+   @param[in]  phaseInc  Phase increment per sample, round(f / fs * 2^32)
+   @param[in]  phase     Initial phase, where 2^32 corresponds to 2 * pi
+   @return     none
+*/
+void plp_nco_init_q16(plp_nco_instance_q16 *S,
+                      uint32_t phaseInc,
+                      uint32_t phase) {
+    S->phaseInc = phaseInc;
+    S->phase = phase;
+}
+
+/**
+   @} end of NCO group
+*/
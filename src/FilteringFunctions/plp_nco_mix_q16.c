@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_q16.c
+ * Description:  Glue code for the 16-bit fixed point NCO mixer
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup NCO
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point NCO mixer.
+   @param[in,out] S         points to an initialized instance of the 16-bit fixed point NCO mixer
+   @param[in]     pSrc      points to the block of input samples
+   @param[in]     blockSize Number of samples to process
+   @param[out]    pDstI     points to the block of in-phase output samples
+   @param[out]    pDstQ     points to the block of quadrature output samples
+   @return        none
+
+   @par Fix-Point
+   The input and the outputs are in Q1.15, or any other format as long as it is the same for all.
+   The products with the sine and the cosine are rounded and saturated.
+*/
+void plp_nco_mix_q16(plp_nco_instance_q16 *S,
+                     const int16_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int16_t *__restrict__ pDstI,
+                     int16_t *__restrict__ pDstQ) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_nco_mix_q16s_rv32im(S, pSrc, blockSize, pDstI, pDstQ);
+    } else {
+        plp_nco_mix_q16s_xpulpv2(S, pSrc, blockSize, pDstI, pDstQ);
+    }
+}
+
+/**
+   @} end of NCO group
+*/
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_f32.c
+ * Description:  32-bit floating-point polyphase resampler glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Glue code for the 32-bit floating-point polyphase resampler.
+   @param[in,out] S      points to an initialized instance of the 32-bit floating-point resampler,
+                         whose phase and state are updated
+   @param[in]  pSrc      points to the block of input samples
+   @param[in]  blockSize Number of input samples to process, at most the blockSize passed to the
+                         init
+   @param[out] pDst      points to the output samples, of size (blockSize * L + M - 1) / M
+   @return     Number of output samples written to pDst
+*/
+uint32_t plp_resample_f32(plp_resample_instance_f32 *S,
+                          const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 0;
+    } else {
+        return plp_resample_f32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of Resample group
+*/
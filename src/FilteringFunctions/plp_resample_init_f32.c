@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point polyphase resampler
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point resampler instance.
+   @param[out] S         points to an instance of the 32-bit floating-point resampler structure
+   @param[in]  L         Interpolation factor
+   @param[in]  M         Decimation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[out] pBank     points to the coefficient bank of size numTaps, which is filled with the
+                         L phases of the filter
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero,
+   and the first output sample is aligned with the first input sample.
+*/
+void plp_resample_init_f32(plp_resample_instance_f32 *S,
+                           uint32_t L,
+                           uint32_t M,
+                           uint32_t numTaps,
+                           const float *pCoeffs,
+                           float *pBank,
+                           float *pState,
+                           uint32_t blockSize) {
+
+    uint32_t phaseLength = numTaps / L;
+    uint32_t i;
+    uint32_t p;
+    uint32_t k;
+
+    S->L = L;
+    S->M = M;
+    S->phaseLength = phaseLength;
+    S->phase = 0;
+    S->pBank = pBank;
+    S->pState = pState;
+
+    // phase p of the (time-reversed) coefficients is pCoeffs[L - 1 - p + k * L]
+    for (p = 0; p < L; p++) {
+        for (k = 0; k < phaseLength; k++) {
+            pBank[p * phaseLength + k] = pCoeffs[L - 1 - p + k * L];
+        }
+    }
+
+    for (i = 0; i < phaseLength + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of Resample group
+*/
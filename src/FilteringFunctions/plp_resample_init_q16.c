@@ -0,0 +1,121 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point polyphase resampler
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup Resample Polyphase Resamplers
+   This module contains the glue code for stateful resamplers by the rational factor L / M, e.g.
+   L = 160 and M = 147 to convert 44.1 kHz into 48 kHz. The kernel codes (kernels) are in the
+   Module Polyphase Resampler Kernels.
+
+   Conceptually, the input is upsampled by L (inserting L - 1 zeros after every input sample),
+   filtered with an FIR filter of numTaps coefficients, and downsampled by M. Only the retained
+   outputs are computed, and the multiplications with the inserted zeros are skipped: Output j is
+   the upsampled sample jM = nL + p, which is computed with phase p of the filter only:
+
+       `y[j] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+(phaseLength-1)L] * x[n-phaseLength+1]`
+
+   The init function rearranges the coefficients into a bank of L phases of phaseLength =
+   numTaps / L contiguous coefficients each, such that every output is a single dot product. The
+   instance keeps the phase accumulator jM - nL (in units of 1 / L input samples) and the last
+   phaseLength - 1 input samples, so that a stream can be processed block by block. As the
+   accumulator is an integer, the phase does not drift.
+
+   The coefficients are passed in time-reversed order, i.e. `pCoeffs = {b[numTaps-1], ..., b[0]}`,
+   as for the FIR filters. numTaps has to be a multiple of L, and the filter should have a gain of L
+   and a cutoff at the lower of the two Nyquist frequencies. The state buffer has to hold
+   `phaseLength + blockSize - 1` samples, where blockSize is the largest number of input samples
+   processed in one call. A call with blockSize input samples produces at most
+   `(blockSize * L + M - 1) / M` output samples, and returns their number.
+*/
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point resampler instance.
+   @param[out] S         points to an instance of the 16-bit fixed point resampler structure
+   @param[in]  L         Interpolation factor
+   @param[in]  M         Decimation factor
+   @param[in]  numTaps   Number of filter coefficients, a multiple of L
+   @param[in]  pCoeffs   points to the filter coefficients, in time-reversed order
+   @param[out] pBank     points to the coefficient bank of size numTaps, which is filled with the
+                         L phases of the filter
+   @param[in]  pState    points to the state buffer of size numTaps / L + blockSize - 1
+   @param[in]  blockSize Maximum number of input samples that are processed per call
+   @param[in]  fracBits  Fixed point position of the coefficients
+   @return     none
+
+   @par
+   The state buffer is cleared, i.e. all samples before the first block are assumed to be zero,
+   and the first output sample is aligned with the first input sample.
+*/
+void plp_resample_init_q16(plp_resample_instance_q16 *S,
+                           uint32_t L,
+                           uint32_t M,
+                           uint32_t numTaps,
+                           const int16_t *pCoeffs,
+                           int16_t *pBank,
+                           int16_t *pState,
+                           uint32_t blockSize,
+                           uint32_t fracBits) {
+
+    uint32_t phaseLength = numTaps / L;
+    uint32_t i;
+    uint32_t p;
+    uint32_t k;
+
+    S->L = L;
+    S->M = M;
+    S->phaseLength = phaseLength;
+    S->phase = 0;
+    S->pBank = pBank;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    // phase p of the (time-reversed) coefficients is pCoeffs[L - 1 - p + k * L]
+    for (p = 0; p < L; p++) {
+        for (k = 0; k < phaseLength; k++) {
+            pBank[p * phaseLength + k] = pCoeffs[L - 1 - p + k * L];
+        }
+    }
+
+    for (i = 0; i < phaseLength + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of Resample group
+*/
@@ -0,0 +1,138 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_predict_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Kalman filter prediction for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Kalman
+ */
+
+/**
+  @defgroup KalmanKernels Kalman Filter Kernels
+  This module contains the kernels of the Kalman filter. State sizes which are common for inertial
+  sensor fusion are computed with a specialized path with constant dimensions, such that the
+  compiler can unroll the inner loops and keep the partial sums in registers.
+ */
+
+/**
+  @addtogroup KalmanKernels
+  @{
+ */
+
+static inline void __attribute__((always_inline))
+plp_kalman_predict_f32_body(float *__restrict__ pX,
+                            float *__restrict__ pP,
+                            const float *__restrict__ pF,
+                            const float *__restrict__ pQ,
+                            float *__restrict__ pTmp,
+                            const uint32_t n) {
+
+    uint32_t i, j, k;
+
+    /* x = F * x, through the temporary buffer */
+    for (i = 0; i < n; i++) {
+        float sum = 0.0f;
+        for (k = 0; k < n; k++) {
+            sum += pF[i * n + k] * pX[k];
+        }
+        pTmp[i] = sum;
+    }
+    for (i = 0; i < n; i++) {
+        pX[i] = pTmp[i];
+    }
+
+    /* T = F * P */
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < n; j++) {
+            float sum = 0.0f;
+            for (k = 0; k < n; k++) {
+                sum += pF[i * n + k] * pP[k * n + j];
+            }
+            pTmp[i * n + j] = sum;
+        }
+    }
+
+    /* P = T * F^T + Q, only the upper triangle is computed and mirrored to keep P symmetric */
+    for (i = 0; i < n; i++) {
+        for (j = i; j < n; j++) {
+            float sum = pQ[i * n + j];
+            for (k = 0; k < n; k++) {
+                sum += pTmp[i * n + k] * pF[j * n + k];
+            }
+            pP[i * n + j] = sum;
+            pP[j * n + i] = sum;
+        }
+    }
+}
+
+/**
+  @brief Prediction step of the 32-bit floating-point Kalman filter for XPULPV2 extension.
+  @param[in,out] S  points to the instance of the Kalman filter, whose state pX and covariance pP
+                    are updated
+  @return        none
+
+  @par The state sizes 3, 4, 6, 9, 12 and 15 are computed with constant dimensions, all other sizes
+       with the same code and variable dimensions.
+ */
+
+void plp_kalman_predict_f32s_xpulpv2(plp_kalman_instance_f32 *S) {
+
+    float *__restrict__ pX = S->pX;
+    float *__restrict__ pP = S->pP;
+    const float *__restrict__ pF = S->pF;
+    const float *__restrict__ pQ = S->pQ;
+    float *__restrict__ pTmp = S->pTmp;
+
+    switch (S->n) {
+    case 3:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, 3);
+        break;
+    case 4:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, 4);
+        break;
+    case 6:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, 6);
+        break;
+    case 9:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, 9);
+        break;
+    case 12:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, 12);
+        break;
+    case 15:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, 15);
+        break;
+    default:
+        plp_kalman_predict_f32_body(pX, pP, pF, pQ, pTmp, S->n);
+        break;
+    }
+}
+
+/**
+  @} end of KalmanKernels group
+ */
@@ -0,0 +1,195 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_update_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Kalman filter update for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Kalman
+ */
+
+/**
+  @addtogroup KalmanKernels
+  @{
+ */
+
+static inline int __attribute__((always_inline))
+plp_kalman_update_f32_body(float *__restrict__ pX,
+                           float *__restrict__ pP,
+                           const float *__restrict__ pH,
+                           const float *__restrict__ pR,
+                           const float *__restrict__ pZ,
+                           float *__restrict__ pTmp,
+                           const uint32_t n,
+                           uint32_t m) {
+
+    float *pPHt = pTmp;       /* P * H^T, nxm */
+    float *pL = pPHt + n * m; /* innovation covariance and its Cholesky factor, mxm */
+    float *pK = pL + m * m;   /* gain, nxm */
+    float *pY = pK + n * m;   /* innovation, m */
+    uint32_t i, j, k;
+
+    /* P * H^T */
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < m; j++) {
+            float sum = 0.0f;
+            for (k = 0; k < n; k++) {
+                sum += pP[i * n + k] * pH[j * n + k];
+            }
+            pPHt[i * m + j] = sum;
+        }
+    }
+
+    /* lower triangle of S = H * P * H^T + R */
+    for (i = 0; i < m; i++) {
+        for (j = 0; j <= i; j++) {
+            float sum = pR[i * m + j];
+            for (k = 0; k < n; k++) {
+                sum += pH[i * n + k] * pPHt[k * m + j];
+            }
+            pL[i * m + j] = sum;
+        }
+    }
+
+    /* S = L * L^T in place */
+    for (j = 0; j < m; j++) {
+        float d = pL[j * m + j];
+        for (k = 0; k < j; k++) {
+            d -= pL[j * m + k] * pL[j * m + k];
+        }
+        if (d <= 0.0f) {
+            return 1;
+        }
+        d = __builtin_sqrtf(d);
+        pL[j * m + j] = d;
+        d = 1.0f / d;
+
+        for (i = j + 1; i < m; i++) {
+            float sum = pL[i * m + j];
+            for (k = 0; k < j; k++) {
+                sum -= pL[i * m + k] * pL[j * m + k];
+            }
+            pL[i * m + j] = sum * d;
+        }
+    }
+
+    /* y = z - H * x */
+    for (i = 0; i < m; i++) {
+        float sum = pZ[i];
+        for (k = 0; k < n; k++) {
+            sum -= pH[i * n + k] * pX[k];
+        }
+        pY[i] = sum;
+    }
+
+    /* row i of K solves S * K[i]^T = (P * H^T)[i]^T, with L * u = b and L^T * K[i]^T = u */
+    for (i = 0; i < n; i++) {
+        float *pKi = pK + i * m;
+
+        for (j = 0; j < m; j++) {
+            float sum = pPHt[i * m + j];
+            for (k = 0; k < j; k++) {
+                sum -= pL[j * m + k] * pKi[k];
+            }
+            pKi[j] = sum / pL[j * m + j];
+        }
+        for (j = m; j-- > 0;) {
+            float sum = pKi[j];
+            for (k = j + 1; k < m; k++) {
+                sum -= pL[k * m + j] * pKi[k];
+            }
+            pKi[j] = sum / pL[j * m + j];
+        }
+    }
+
+    /* x = x + K * y */
+    for (i = 0; i < n; i++) {
+        float sum = pX[i];
+        for (k = 0; k < m; k++) {
+            sum += pK[i * m + k] * pY[k];
+        }
+        pX[i] = sum;
+    }
+
+    /* P = P - K * (P * H^T)^T, only the upper triangle is computed and mirrored */
+    for (i = 0; i < n; i++) {
+        for (j = i; j < n; j++) {
+            float sum = pP[i * n + j];
+            for (k = 0; k < m; k++) {
+                sum -= pK[i * m + k] * pPHt[j * m + k];
+            }
+            pP[i * n + j] = sum;
+            pP[j * n + i] = sum;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @brief Measurement update of the 32-bit floating-point Kalman filter for XPULPV2 extension.
+  @param[in,out] S   points to the instance of the Kalman filter, whose state pX and covariance pP
+                     are updated
+  @param[in]     pZ  points to the measurement vector of size m
+  @return        0: Success, 1: Innovation covariance is not positive definite
+
+  @par The innovation covariance S is not inverted. It is decomposed with the Cholesky
+       decomposition, and the gain is computed with two triangular solves per state. The state
+       sizes 3, 4, 6, 9, 12 and 15 are computed with constant dimensions. If S is not positive
+       definite, the state and the covariance are left unchanged.
+ */
+
+int plp_kalman_update_f32s_xpulpv2(plp_kalman_instance_f32 *S, const float *__restrict__ pZ) {
+
+    float *__restrict__ pX = S->pX;
+    float *__restrict__ pP = S->pP;
+    const float *__restrict__ pH = S->pH;
+    const float *__restrict__ pR = S->pR;
+    float *__restrict__ pTmp = S->pTmp;
+    uint32_t m = S->m;
+
+    switch (S->n) {
+    case 3:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, 3, m);
+    case 4:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, 4, m);
+    case 6:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, 6, m);
+    case 9:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, 9, m);
+    case 12:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, 12, m);
+    case 15:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, 15, m);
+    default:
+        return plp_kalman_update_f32_body(pX, pP, pH, pR, pZ, pTmp, S->n, m);
+    }
+}
+
+/**
+  @} end of KalmanKernels group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_predict_f32.c
+ * Description:  Glue code for the 32-bit floating-point Kalman filter prediction
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup Kalman Kalman Filter
+  This module contains a fused Kalman filter for small state vectors, e.g. up to 16 states. The
+  prediction and the update replace the sequence of matrix multiplications, additions and the
+  inversion of the innovation covariance, and keep the intermediate matrices in the temporary
+  buffer of the instance, which should be placed in L1. The instance holds the state x of size n,
+  the covariance P of shape nxn, the transition F (nxn), the process noise Q (nxn), the
+  observation H (mxn) and the measurement noise R (mxm):
+  <pre>
+      predict: x = F * x,  P = F * P * F^T + Q
+      update:  y = z - H * x,  S = H * P * H^T + R,  K = P * H^T * S^-1,
+               x = x + K * y,  P = P - K * H * P
+  </pre>
+  The matrices are stored in row-major order. The model matrices may be changed between the calls
+  by writing to the memory the instance points to.
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief Glue code for the prediction step of the 32-bit floating-point Kalman filter.
+  @param[in,out] S  points to the instance of the Kalman filter, whose state pX and covariance pP
+                    are updated
+  @return        none
+ */
+
+void plp_kalman_predict_f32(plp_kalman_instance_f32 *S) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_kalman_predict_f32s_xpulpv2(S);
+    }
+}
+
+/**
+  @} end of Kalman group
+ */
@@ -0,0 +1,61 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_update_f32.c
+ * Description:  Glue code for the 32-bit floating-point Kalman filter update
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief Glue code for the measurement update of the 32-bit floating-point Kalman filter.
+  @param[in,out] S   points to the instance of the Kalman filter, whose state pX and covariance pP
+                     are updated
+  @param[in]     pZ  points to the measurement vector of size m
+  @return        0: Success, 1: Innovation covariance is not positive definite, 2: operation not
+                 supported
+ */
+
+int plp_kalman_update_f32(plp_kalman_instance_f32 *S, const float *__restrict__ pZ) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_kalman_update_f32s_xpulpv2(S, pZ);
+    }
+}
+
+/**
+  @} end of Kalman group
+ */
@@ -48,7 +48,7 @@
 
 void plp_mat_add_f32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_add_instance_f32 *a = (plp_mat_add_instance_f32 *)args;
 
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_add_inplace_f32p_xpulpv2.c
+ * Description:  32-bit floating-point parallel in-place matrix addition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAdd
+ */
+
+/**
+  @addtogroup MatAddKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place matrix addition of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_add_inplace_instance_f32 struct initialized by
+                    plp_mat_add_inplace_f32_parallel
+  @return     none
+
+  @par The elements are split into one contiguous range per core, with
+       plp_mat_add_inplace_f32s_xpulpv2 applied to each range.
+ */
+
+void plp_mat_add_inplace_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_add_inplace_instance_f32 *a = (plp_mat_add_inplace_instance_f32 *)args;
+
+    float *__restrict__ pSrcDstA = a->pSrcDstA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t nPE = a->nPE;
+    uint32_t total = a->M * a->N;
+    uint32_t start, end;
+    plp_mat_range range;
+
+    /* contiguous range of elements */
+    plp_mat_split(1, total, nPE, core_id, &range);
+    start = range.nStart;
+    end = range.nEnd;
+
+    if (start < end) {
+        plp_mat_add_inplace_f32s_xpulpv2(pSrcDstA + start, pSrcB + start, 1, end - start);
+    }
+}
+
+/**
+  @} end of MatAddKernels group
+ */
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_add_inplace_i16p_xpulpv2.c
+ * Description:  16-bit integer parallel in-place matrix addition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAdd
+ */
+
+/**
+  @addtogroup MatAddKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place matrix addition of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_add_inplace_instance_i16 struct initialized by
+                    plp_mat_add_inplace_i16_parallel
+  @return     none
+
+  @par The elements are split into contiguous ranges of whole 32-bit words, such that every core can
+       use plp_mat_add_inplace_i16s_xpulpv2 on its range.
+ */
+
+void plp_mat_add_inplace_i16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_add_inplace_instance_i16 *a = (plp_mat_add_inplace_instance_i16 *)args;
+
+    int16_t *__restrict__ pSrcDstA = a->pSrcDstA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t nPE = a->nPE;
+    uint32_t total = a->M * a->N;
+    uint32_t start, end;
+    plp_mat_range range;
+
+    /* contiguous ranges of whole 32-bit words, the last core also takes the remaining samples */
+    plp_mat_split(1, total >> 1U, nPE, core_id, &range);
+
+    if (range.mStart == range.mEnd) {
+        start = end = total & ~0x1U;
+    } else {
+        start = range.nStart << 1U;
+        end = range.nEnd << 1U;
+    }
+
+    if (core_id == nPE - 1) {
+        end = total;
+    }
+
+    if (start < end) {
+        plp_mat_add_inplace_i16s_xpulpv2(pSrcDstA + start, pSrcB + start, 1, end - start);
+    }
+}
+
+/**
+  @} end of MatAddKernels group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_add_inplace_i16s_rv32im.c
+ * Description:  16-bit integer in-place matrix addition kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAdd
+ */
+
+/**
+  @addtogroup MatAddKernels
+  @{
+ */
+
+/**
+  @brief In-place matrix addition of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+ */
+
+void plp_mat_add_inplace_i16s_rv32im(int16_t *__restrict__ pSrcDstA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N) {
+
+    uint32_t blkCnt; /* Loop counter */
+    uint32_t blockSize = M * N;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* A = A + B */
+        *pSrcDstA++ += *pSrcB++;
+        *pSrcDstA++ += *pSrcB++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize & 0x1U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        /* A = A + B */
+        *pSrcDstA++ += *pSrcB++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of MatAddKernels group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_add_inplace_f32_parallel.c
+ * Description:  32-bit floating-point parallel in-place matrix addition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatAdd
+  @{
+ */
+
+/**
+  @brief Glue code for parallel in-place matrix addition of 32-bit floating-point matrices.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the sum
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @param[in]     nPE      Number of cores to use for computation
+  @return        none
+ */
+
+void plp_mat_add_inplace_f32_parallel(float *__restrict__ pSrcDstA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_add_inplace_f32_parallel), M * N);
+        }
+
+        plp_mat_add_inplace_instance_f32 args = { .pSrcDstA = pSrcDstA,
+                                                  .pSrcB = pSrcB,
+                                                  .M = M,
+                                                  .N = N,
+                                                  .nPE = nPE };
+
+        rt_team_fork(nPE, plp_mat_add_inplace_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatAdd group
+ */
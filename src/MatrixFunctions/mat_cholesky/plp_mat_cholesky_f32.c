@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32.c
+ * Description:  32-bit floating-point Cholesky decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatCholesky Cholesky Decomposition
+  This module contains the glue code for the Cholesky decomposition A = L * L^T of a symmetric
+  positive-definite matrix A. The functions are the strided functions (Module strided Cholesky
+  decomposition) with the stride set to N, and use the same kernels.
+
+  A linear system A * x = b is solved with the Cholesky decomposition and two triangular solves:
+  <pre>
+      plp_mat_cholesky_f32(pA, N, pL);                // A = L * L^T
+      plp_mat_solve_tri_lower_f32(pL, pB, N, 1, pY);  // L * y = b
+      plp_mat_trans_f32(pL, N, N, pLT);
+      plp_mat_solve_tri_upper_f32(pLT, pY, N, 1, pX); // L^T * x = y
+  </pre>
+ */
+
+/**
+  @addtogroup MatCholesky
+  @{
+ */
+
+/**
+  @brief Glue code for Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the input matrix, only the lower triangle is read
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+ */
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc,
+                         uint32_t N,
+                         float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_cholesky_stride_f32s_xpulpv2(pSrc, N, N, N, pDst);
+    }
+}
+
+/**
+  @} end of MatCholesky group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_q32_parallel.c
+ * Description:  32-bit fix-point parallel Cholesky decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatCholesky
+  @{
+ */
+
+/**
+  @brief Glue code for parallel Cholesky decomposition of 32-bit fix-point matrices.
+  @param[in]  pSrc     Points to the input matrix, only the lower triangle is read
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of all matrices
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+ */
+
+int plp_mat_cholesky_q32_parallel(const int32_t *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t fracBits,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return 2;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_cholesky_q32_parallel), N * N * N);
+        }
+
+        plp_mat_cholesky_stride_instance_q32 args = { .pSrc = pSrc,
+                                                      .N = N,
+                                                      .strideSrc = N,
+                                                      .strideDst = N,
+                                                      .fracBits = fracBits,
+                                                      .nPE = nPE,
+                                                      .pDst = pDst,
+                                                      .status = 0 };
+
+        rt_team_fork(nPE, plp_mat_cholesky_stride_q32p_xpulpv2, (void *)&args);
+
+        return args.status;
+    }
+}
+
+/**
+  @} end of MatCholesky group
+ */
@@ -0,0 +1,216 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point symmetric eigenvalue decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatEigSym
+ */
+
+/**
+  @addtogroup MatEigSymKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place eigenvalue decomposition of symmetric 32-bit floating-point matrices
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_eig_sym_instance_f32 struct initialized by
+                    plp_mat_eig_sym_f32_parallel. The status field is set to 0 on success, and to
+                    3 if there is no convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps.
+  @return     none
+
+  @par A sweep consists of N - 1 rounds (N rounded up to even), in which the indices are paired
+       like in a round-robin tournament, such that the N / 2 pairs (p, q) of a round are disjoint.
+       The pairs are distributed over the cores. Every core computes the rotations of its pairs
+       and updates their rows p and q, and after a barrier their columns p and q of A and V.
+ */
+
+void plp_mat_eig_sym_f32p_xpulpv2(void *args) {
+
+    plp_mat_eig_sym_instance_f32 *a = (plp_mat_eig_sym_instance_f32 *)args;
+
+    float *__restrict__ pA = a->pA;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pTmp = a->pTmp;
+    float *__restrict__ pEigVal = a->pEigVal;
+    float *__restrict__ pEigVec = a->pEigVec;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t nEven = N + (N & 1);
+    uint32_t nPairs = nEven / 2;
+    float *pC = pTmp;
+    float *pS = pTmp + nPairs;
+    uint32_t sweep, round, pair, i, j, k;
+
+    for (sweep = 0; sweep <= PLP_MAT_EIG_SYM_MAX_SWEEPS; sweep++) {
+
+        /* stop when the off-diagonal part is negligible compared to the norm of A */
+        if (core_id == 0) {
+            float diag = 0.0f;
+            float off = 0.0f;
+
+            for (i = 0; i < N; i++) {
+                diag += pA[i * N + i] * pA[i * N + i];
+
+                for (j = i + 1; j < N; j++) {
+                    off += pA[i * N + j] * pA[i * N + j];
+                }
+            }
+
+            a->status = (off <= PLP_MAT_EIG_SYM_TOL * (diag + 2.0f * off)) ? 0 : 3;
+        }
+
+        plp_team_barrier();
+
+        if (a->status == 0 || sweep == PLP_MAT_EIG_SYM_MAX_SWEEPS) {
+            break;
+        }
+
+        for (round = 0; round + 1 < nEven; round++) {
+
+            /* rotations and rows p and q of the pairs of this core */
+            for (pair = core_id; pair < nPairs; pair += nPE) {
+                uint32_t p = (pair == 0) ? nEven - 1 : (round + nEven - 1 - pair) % (nEven - 1);
+                uint32_t q = (round + pair) % (nEven - 1);
+
+                if (p > q) {
+                    uint32_t tmp = p;
+                    p = q;
+                    q = tmp;
+                }
+
+                float apq = (q < N) ? pA[p * N + q] : 0.0f;
+
+                if (apq == 0.0f) {
+                    pC[pair] = 1.0f;
+                    pS[pair] = 0.0f;
+                    continue;
+                }
+
+                /* rotation [c s; -s c] which sets A[p][q] to zero */
+                float theta = (pA[q * N + q] - pA[p * N + p]) / (2.0f * apq);
+                float t = 1.0f / (fabsf(theta) + __builtin_sqrtf(theta * theta + 1.0f));
+                t = (theta < 0.0f) ? -t : t;
+                float c = 1.0f / __builtin_sqrtf(t * t + 1.0f);
+                float s = t * c;
+
+                pC[pair] = c;
+                pS[pair] = s;
+
+                float *pRowP = pA + p * N;
+                float *pRowQ = pA + q * N;
+                for (k = 0; k < N; k++) {
+                    float x = pRowP[k];
+                    float y = pRowQ[k];
+                    pRowP[k] = c * x - s * y;
+                    pRowQ[k] = s * x + c * y;
+                }
+            }
+
+            plp_team_barrier();
+
+            /* columns p and q of A and V of the pairs of this core */
+            for (pair = core_id; pair < nPairs; pair += nPE) {
+                float c = pC[pair];
+                float s = pS[pair];
+
+                if (s == 0.0f) {
+                    continue;
+                }
+
+                uint32_t p = (pair == 0) ? nEven - 1 : (round + nEven - 1 - pair) % (nEven - 1);
+                uint32_t q = (round + pair) % (nEven - 1);
+
+                if (p > q) {
+                    uint32_t tmp = p;
+                    p = q;
+                    q = tmp;
+                }
+
+                for (k = 0; k < N; k++) {
+                    float x = pA[k * N + p];
+                    float y = pA[k * N + q];
+                    pA[k * N + p] = c * x - s * y;
+                    pA[k * N + q] = s * x + c * y;
+                }
+
+                pA[p * N + q] = 0.0f;
+                pA[q * N + p] = 0.0f;
+
+                if (pEigVec != NULL) {
+                    for (k = 0; k < N; k++) {
+                        float x = pEigVec[k * N + p];
+                        float y = pEigVec[k * N + q];
+                        pEigVec[k * N + p] = c * x - s * y;
+                        pEigVec[k * N + q] = s * x + c * y;
+                    }
+                }
+            }
+
+            plp_team_barrier();
+        }
+    }
+
+    if (core_id == 0) {
+
+        /* selection sort of the diagonal, swapping the columns of V along */
+        for (i = 0; i < N; i++) {
+            pEigVal[i] = pA[i * N + i];
+        }
+
+        for (i = 0; i + 1 < N; i++) {
+            uint32_t iMin = i;
+
+            for (j = i + 1; j < N; j++) {
+                if (pEigVal[j] < pEigVal[iMin]) {
+                    iMin = j;
+                }
+            }
+
+            if (iMin != i) {
+                float tmp = pEigVal[i];
+                pEigVal[i] = pEigVal[iMin];
+                pEigVal[iMin] = tmp;
+
+                if (pEigVec != NULL) {
+                    for (k = 0; k < N; k++) {
+                        tmp = pEigVec[k * N + i];
+                        pEigVec[k * N + i] = pEigVec[k * N + iMin];
+                        pEigVec[k * N + iMin] = tmp;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatEigSymKernels group
+ */
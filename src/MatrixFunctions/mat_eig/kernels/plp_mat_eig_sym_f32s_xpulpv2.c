@@ -0,0 +1,174 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32s_xpulpv2.c
+ * Description:  32-bit floating-point symmetric eigenvalue decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatEigSym
+ */
+
+/**
+  @defgroup MatEigSymKernels Symmetric eigenvalue decomposition kernels
+  This module contains the kernel functions for the eigenvalue decomposition of symmetric
+  matrices. The kernels work in place on a copy of A, which is diagonalized, and multiply V with
+  all rotations. Both kernels return the eigenvalues sorted in ascending order.
+ */
+
+/**
+  @addtogroup MatEigSymKernels
+  @{
+ */
+
+/**
+  @brief In-place eigenvalue decomposition of symmetric 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in,out] pA       Points to the symmetric matrix of shape NxN, which is diagonalized
+  @param[in]     N        Width and height of A
+  @param[out]    pEigVal  Points to the N eigenvalues, in ascending order
+  @param[in,out] pEigVec  Points to the matrix V of shape NxN, which must be initialized to the
+                          identity matrix, or NULL. Column i is replaced by the eigenvector of
+                          pEigVal[i].
+  @return     0: Success, 3: No convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps
+
+  @par The rotations are applied in cyclic row order. Every rotation updates the rows p and q and
+       then the columns p and q of A, and sets A[p][q] to zero.
+ */
+
+int plp_mat_eig_sym_f32s_xpulpv2(float *__restrict__ pA,
+                                 uint32_t N,
+                                 float *__restrict__ pEigVal,
+                                 float *__restrict__ pEigVec) {
+
+    int status = 3;
+    uint32_t sweep, i, j, k, p, q;
+
+    for (sweep = 0; sweep <= PLP_MAT_EIG_SYM_MAX_SWEEPS; sweep++) {
+        float diag = 0.0f;
+        float off = 0.0f;
+
+        /* stop when the off-diagonal part is negligible compared to the norm of A */
+        for (i = 0; i < N; i++) {
+            diag += pA[i * N + i] * pA[i * N + i];
+
+            for (j = i + 1; j < N; j++) {
+                off += pA[i * N + j] * pA[i * N + j];
+            }
+        }
+
+        if (off <= PLP_MAT_EIG_SYM_TOL * (diag + 2.0f * off)) {
+            status = 0;
+            break;
+        }
+
+        if (sweep == PLP_MAT_EIG_SYM_MAX_SWEEPS) {
+            break;
+        }
+
+        for (p = 0; p + 1 < N; p++) {
+            for (q = p + 1; q < N; q++) {
+                float apq = pA[p * N + q];
+
+                if (apq == 0.0f) {
+                    continue;
+                }
+
+                /* rotation [c s; -s c] which sets A[p][q] to zero */
+                float theta = (pA[q * N + q] - pA[p * N + p]) / (2.0f * apq);
+                float t = 1.0f / (fabsf(theta) + __builtin_sqrtf(theta * theta + 1.0f));
+                t = (theta < 0.0f) ? -t : t;
+                float c = 1.0f / __builtin_sqrtf(t * t + 1.0f);
+                float s = t * c;
+
+                /* rows p and q */
+                float *pRowP = pA + p * N;
+                float *pRowQ = pA + q * N;
+                for (k = 0; k < N; k++) {
+                    float x = pRowP[k];
+                    float y = pRowQ[k];
+                    pRowP[k] = c * x - s * y;
+                    pRowQ[k] = s * x + c * y;
+                }
+
+                /* columns p and q */
+                for (k = 0; k < N; k++) {
+                    float x = pA[k * N + p];
+                    float y = pA[k * N + q];
+                    pA[k * N + p] = c * x - s * y;
+                    pA[k * N + q] = s * x + c * y;
+                }
+
+                pA[p * N + q] = 0.0f;
+                pA[q * N + p] = 0.0f;
+
+                if (pEigVec != NULL) {
+                    for (k = 0; k < N; k++) {
+                        float x = pEigVec[k * N + p];
+                        float y = pEigVec[k * N + q];
+                        pEigVec[k * N + p] = c * x - s * y;
+                        pEigVec[k * N + q] = s * x + c * y;
+                    }
+                }
+            }
+        }
+    }
+
+    /* selection sort of the diagonal, swapping the columns of V along */
+    for (i = 0; i < N; i++) {
+        pEigVal[i] = pA[i * N + i];
+    }
+
+    for (i = 0; i + 1 < N; i++) {
+        uint32_t iMin = i;
+
+        for (j = i + 1; j < N; j++) {
+            if (pEigVal[j] < pEigVal[iMin]) {
+                iMin = j;
+            }
+        }
+
+        if (iMin != i) {
+            float tmp = pEigVal[i];
+            pEigVal[i] = pEigVal[iMin];
+            pEigVal[iMin] = tmp;
+
+            if (pEigVec != NULL) {
+                for (k = 0; k < N; k++) {
+                    tmp = pEigVec[k * N + i];
+                    pEigVec[k * N + i] = pEigVec[k * N + iMin];
+                    pEigVec[k * N + iMin] = tmp;
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+  @} end of MatEigSymKernels group
+ */
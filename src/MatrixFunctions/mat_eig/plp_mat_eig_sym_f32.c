@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32.c
+ * Description:  32-bit floating-point symmetric eigenvalue decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatEigSym Symmetric eigenvalue decomposition
+  This module contains the glue code for the eigenvalue decomposition of symmetric matrices. The
+  kernel codes (kernels) are in the Module Symmetric eigenvalue decomposition Kernels.
+
+  A real symmetric matrix A of shape NxN is factored into
+
+      `A = V * diag(pEigVal) * V^T`
+
+  where V is an orthogonal matrix, whose columns are the eigenvectors of A. The eigenvalues are
+  returned in ascending order, such that e.g. the principal components of a covariance matrix are
+  the last columns of V, and the noise subspace used by MUSIC the first ones. Only the upper
+  triangle of A is used for the convergence test, but A must be symmetric.
+
+  The PULP DSP library only supports the eigenvalue decomposition of floating-point matrices, on
+  the cluster side. The functions need a temporary buffer, which is allocated with
+  plp_scratch_alloc. They are meant for small matrices (e.g. 8x8 to 32x32 covariance matrices),
+  since every sweep has a complexity of O(N^3).
+
+  @par Algorithm
+  The decomposition uses cyclic Jacobi rotations. A rotation in the plane (p, q) sets A[p][q] and
+  A[q][p] to zero, by updating the rows p and q and the columns p and q of A, and the columns p and
+  q of V. A sweep applies one rotation for every pair p < q, and the sweeps are repeated until the
+  sum of squares of the off-diagonal elements is smaller than PLP_MAT_EIG_SYM_TOL times the sum of
+  squares of all elements, which typically takes 5 to 10 sweeps. The parallel functions order the
+  pairs like a round-robin tournament, such that each of the N - 1 rounds of a sweep consists of
+  N / 2 disjoint pairs, whose rotations commute and are applied by the cores at the same time. A
+  round needs two barriers, one between the row and the column updates.
+ */
+
+/**
+  @addtogroup MatEigSym
+  @{
+ */
+
+/**
+  @brief Glue code for eigenvalue decomposition of symmetric 32-bit floating-point matrices.
+  @param[in]  pSrc     Points to the symmetric input matrix A of shape NxN
+  @param[in]  N        Width and height of A
+  @param[out] pEigVal  Points to the N eigenvalues, in ascending order
+  @param[out] pEigVec  Points to the output matrix V of shape NxN, whose column i is the
+                       eigenvector of pEigVal[i], or NULL if the eigenvectors are not needed
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported, 3: No convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps
+
+  @par This function will use plp_mat_eig_sym_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_eig_sym_f32(const float *__restrict__ pSrc,
+                        uint32_t N,
+                        float *__restrict__ pEigVal,
+                        float *__restrict__ pEigVec) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        uint32_t tmpSize = N * N * sizeof(float);
+        float *pA = (float *)plp_scratch_alloc(RT_ALLOC_CL_DATA, tmpSize);
+
+        if (pA == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 1;
+        }
+
+        /* the working copy of A is diagonalized, V = I */
+        plp_mat_copy_stride_f32(pSrc, N, N, N, N, pA);
+
+        if (pEigVec != NULL) {
+            plp_mat_fill_I_f32(N, pEigVec);
+        }
+
+        int status = plp_mat_eig_sym_f32s_xpulpv2(pA, N, pEigVal, pEigVec);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pA, tmpSize);
+
+        return status;
+    }
+}
+
+/**
+  @} end of MatEigSym group
+ */
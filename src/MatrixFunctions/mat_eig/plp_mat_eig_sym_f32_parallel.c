@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32_parallel.c
+ * Description:  parallel 32-bit floating-point symmetric eigenvalue decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatEigSym
+  @{
+ */
+
+/**
+  @brief Glue code for parallel eigenvalue decomposition of symmetric 32-bit floating-point
+         matrices.
+  @param[in]  pSrc     Points to the symmetric input matrix A of shape NxN
+  @param[in]  N        Width and height of A
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pEigVal  Points to the N eigenvalues, in ascending order
+  @param[out] pEigVec  Points to the output matrix V of shape NxN, whose column i is the
+                       eigenvector of pEigVal[i], or NULL if the eigenvectors are not needed
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not
+              supported, 3: No convergence within PLP_MAT_EIG_SYM_MAX_SWEEPS sweeps
+
+  @par This function will use plp_mat_eig_sym_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_eig_sym_f32_parallel(const float *__restrict__ pSrc,
+                                 uint32_t N,
+                                 uint32_t nPE,
+                                 float *__restrict__ pEigVal,
+                                 float *__restrict__ pEigVec) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        /* working copy of A, followed by the cosines and sines of the rotations of a round */
+        uint32_t nPairs = (N + 1) / 2;
+        uint32_t tmpSize = (N * N + 2 * nPairs) * sizeof(float);
+        float *pA = (float *)plp_scratch_alloc(RT_ALLOC_CL_DATA, tmpSize);
+
+        if (pA == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 1;
+        }
+
+        plp_mat_copy_stride_f32(pSrc, N, N, N, N, pA);
+
+        if (pEigVec != NULL) {
+            plp_mat_fill_I_f32(N, pEigVec);
+        }
+
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_eig_sym_f32_parallel), N * N * N);
+        }
+
+        plp_mat_eig_sym_instance_f32 args = { .pA = pA,
+                                              .N = N,
+                                              .nPE = nPE,
+                                              .pTmp = pA + N * N,
+                                              .pEigVal = pEigVal,
+                                              .pEigVec = pEigVec,
+                                              .status = 3 };
+
+        rt_team_fork(nPE, plp_mat_eig_sym_f32p_xpulpv2, (void *)&args);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pA, tmpSize);
+
+        return args.status;
+    }
+}
+
+/**
+  @} end of MatEigSym group
+ */
@@ -52,7 +52,7 @@
 
 void plp_mat_fill_I_i16p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_fill_I_instance_i16 *a = (plp_mat_fill_I_instance_i16 *)args;
 
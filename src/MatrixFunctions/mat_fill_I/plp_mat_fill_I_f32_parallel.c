@@ -53,6 +53,10 @@ void plp_mat_fill_I_f32_parallel(uint32_t N, uint32_t nPE, float *__restrict__ p
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_fill_I_f32_parallel), N * N);
+        }
+
         plp_mat_fill_I_instance_f32 args = { .N = N, .nPE = nPE, .pDst = pDst };
 
         rt_team_fork(nPE, plp_mat_fill_I_f32p_xpulpv2, (void *)&args);
@@ -53,6 +53,10 @@ void plp_mat_fill_I_i32_parallel(uint32_t N, uint32_t nPE, int32_t *__restrict__
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_fill_I_i32_parallel), N * N);
+        }
+
         plp_mat_fill_I_instance_i32 args = { .N = N, .nPE = nPE, .pDst = pDst };
 
         rt_team_fork(nPE, plp_mat_fill_I_i32p_xpulpv2, (void *)&args);
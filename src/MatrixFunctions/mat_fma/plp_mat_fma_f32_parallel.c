@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_f32_parallel.c
+ * Description:  parallel 32-bit floating-point matrix fused multiply accumulate glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatFma
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix fused multiply accumulate of 32-bit floating-point matrices.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     alpha     scaling factor of the matrix product
+  @param[in]     beta      scaling factor of the existing output matrix
+  @param[in]     nPE       Number of cores to use
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+
+  @par This function will use plp_mat_fma_stride_f32_parallel for its computation.
+ */
+
+void plp_mat_fma_f32_parallel(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float alpha,
+                              float beta,
+                              uint32_t nPE,
+                              float *__restrict__ pDstC) {
+
+    plp_mat_fma_stride_f32_parallel(pSrcA, pSrcB, M, N, O, N, O, O, alpha, beta, nPE, pDstC);
+}
+
+/**
+  @} end of MatFma group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_q32_parallel.c
+ * Description:  parallel 32-bit fix-point matrix fused multiply accumulate glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatFma
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix fused multiply accumulate of 32-bit fix-point matrices.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     alpha     scaling factor of the matrix product
+  @param[in]     beta      scaling factor of the existing output matrix
+  @param[in]     shift     Amount to shift the result of each multiplication.
+  @param[in]     nPE       Number of cores to use
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+
+  @par Fix-Point and Shifting
+  Every product of two elements of A and B is shifted by the parameter `shift` to the right (with
+  rounding), like in the matrix multiplication. Then, alpha and beta are interpreted as fix-point
+  numbers with `shift` bits after the binary point: Both alpha * (A * B) and beta * C are shifted by
+  `shift` to the right (with rounding) before they are added. Set alpha and beta to `1 << shift` to
+  simply accumulate the product onto C. The output is stored as 32-bit array, set the `shift`
+  parameter such that no overflow ocurrs.
+
+  @par This function will use plp_mat_fma_stride_q32_parallel for its computation.
+ */
+
+void plp_mat_fma_q32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t alpha,
+                              int32_t beta,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC) {
+
+    plp_mat_fma_stride_q32_parallel(pSrcA, pSrcB, M, N, O, N, O, O, alpha, beta, shift, nPE, pDstC);
+}
+
+/**
+  @} end of MatFma group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_det_small_f32s_xpulpv2.c
+ * Description:  Closed-form determinant of small 32-bit floating-point matrices for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatInv
+ */
+
+/**
+  @addtogroup MatInvKernels
+  @{
+ */
+
+/**
+  @brief Closed-form determinant of 32-bit floating-point matrices of size 1x1 to 4x4 kernel for
+         XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix
+  @param[in]  N    Width and height of the matrix, 1 to 4
+  @param[out] pDet Points to the determinant
+  @return     0: Success, 2: operation not supported
+
+  @par Algorithm
+  The determinant is expanded along the first row (for 4x4 matrices with the 2x2 minors of the
+  upper and lower two rows, like plp_mat_inv_small_f32s_xpulpv2).
+ */
+
+int plp_mat_det_small_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                   uint32_t N,
+                                   float *__restrict__ pDet) {
+
+    switch (N) {
+    case 1:
+        *pDet = pSrc[0];
+        break;
+    case 2:
+        *pDet = pSrc[0] * pSrc[3] - pSrc[1] * pSrc[2];
+        break;
+    case 3:
+        *pDet = pSrc[0] * (pSrc[4] * pSrc[8] - pSrc[5] * pSrc[7]) +
+                pSrc[1] * (pSrc[5] * pSrc[6] - pSrc[3] * pSrc[8]) +
+                pSrc[2] * (pSrc[3] * pSrc[7] - pSrc[4] * pSrc[6]);
+        break;
+    case 4: {
+        float s0 = pSrc[0] * pSrc[5] - pSrc[4] * pSrc[1];
+        float s1 = pSrc[0] * pSrc[6] - pSrc[4] * pSrc[2];
+        float s2 = pSrc[0] * pSrc[7] - pSrc[4] * pSrc[3];
+        float s3 = pSrc[1] * pSrc[6] - pSrc[5] * pSrc[2];
+        float s4 = pSrc[1] * pSrc[7] - pSrc[5] * pSrc[3];
+        float s5 = pSrc[2] * pSrc[7] - pSrc[6] * pSrc[3];
+        float c0 = pSrc[8] * pSrc[13] - pSrc[12] * pSrc[9];
+        float c1 = pSrc[8] * pSrc[14] - pSrc[12] * pSrc[10];
+        float c2 = pSrc[8] * pSrc[15] - pSrc[12] * pSrc[11];
+        float c3 = pSrc[9] * pSrc[14] - pSrc[13] * pSrc[10];
+        float c4 = pSrc[9] * pSrc[15] - pSrc[13] * pSrc[11];
+        float c5 = pSrc[10] * pSrc[15] - pSrc[14] * pSrc[11];
+        *pDet = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        break;
+    }
+    default:
+        return 2;
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatInvKernels group
+ */
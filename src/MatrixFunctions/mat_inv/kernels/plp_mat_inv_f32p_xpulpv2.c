@@ -42,17 +42,141 @@
 /**
    @brief Parallel matrix inversion of 32-bit floating-point matrices kernel for XPULPV2 extension.
    @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
-                    plp_mat_inv_f32_parallel
-   @return     0: Success, 1: Matrix is singular
+                    plp_mat_inv_f32_parallel. The status field is set to 0 on success, and to 1 if
+                    the matrix is singular.
+   @return     none
 
-   @warn Not yet implemented
+   @par Algorithm
+   Gauss-Jordan elimination with partial pivoting. For every column l, core 0 selects the row with
+   the largest absolute value in column l (at or below the diagonal) as pivot, swaps it with row l
+   and normalizes the pivot row. After a barrier, every core eliminates column l from the rows
+   i = core_id + k * nPE (except the pivot row) of both the input and the output matrix. A second
+   barrier ensures that the column is fully eliminated before the next pivot is searched.
 */
 
-int plp_mat_inv_f32p_xpulpv2(void *args) {
+void plp_mat_inv_f32p_xpulpv2(void *args) {
 
-    // TODO
+    plp_mat_inv_instance_f32 *a = (plp_mat_inv_instance_f32 *)args;
 
-    return 1;
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = plp_core_id();
+
+    uint32_t i, j, l;
+
+    /* Each core initializes its own rows of the output matrix as identity */
+    for (i = core_id; i < N; i += nPE) {
+        float *pRow = pDst + i * N;
+        for (j = 0; j < N; j++) {
+            pRow[j] = 0.0f;
+        }
+        pRow[i] = 1.0f;
+    }
+
+    if (core_id == 0) {
+        a->status = 0;
+    }
+
+    plp_team_barrier();
+
+    for (l = 0; l < N; l++) {
+
+        float *pPivotSrc = pSrc + l * N;
+        float *pPivotDst = pDst + l * N;
+
+        if (core_id == 0) {
+
+            /* Search for the pivot with the largest magnitude in column l */
+            uint32_t pivot = l;
+            float maxVal = pPivotSrc[l];
+            maxVal = maxVal < 0.0f ? -maxVal : maxVal;
+
+            for (i = l + 1; i < N; i++) {
+                float val = pSrc[i * N + l];
+                val = val < 0.0f ? -val : val;
+                if (val > maxVal) {
+                    maxVal = val;
+                    pivot = i;
+                }
+            }
+
+            if (maxVal == 0.0f) {
+                a->status = 1;
+            } else {
+
+                /* Exchange the pivot row with row l. All elements left of column l are zero in
+                   both rows of the input matrix. With PLP_DETERMINISTIC, row l is also exchanged
+                   with itself, such that the time does not depend on the position of the pivot. */
+#if defined(PLP_DETERMINISTIC)
+                {
+#else
+                if (pivot != l) {
+#endif
+                    float *pSwapSrc = pSrc + pivot * N;
+                    float *pSwapDst = pDst + pivot * N;
+                    float xchg;
+
+                    for (j = l; j < N; j++) {
+                        xchg = pSwapSrc[j];
+                        pSwapSrc[j] = pPivotSrc[j];
+                        pPivotSrc[j] = xchg;
+                    }
+                    for (j = 0; j < N; j++) {
+                        xchg = pSwapDst[j];
+                        pSwapDst[j] = pPivotDst[j];
+                        pPivotDst[j] = xchg;
+                    }
+                }
+
+                /* Normalize the pivot row */
+                float invPivot = 1.0f / pPivotSrc[l];
+
+                pPivotSrc[l] = 1.0f;
+                for (j = l + 1; j < N; j++) {
+                    pPivotSrc[j] *= invPivot;
+                }
+                for (j = 0; j < N; j++) {
+                    pPivotDst[j] *= invPivot;
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        if (a->status != 0) {
+            return;
+        }
+
+        /* Eliminate column l from all rows except the pivot row */
+        for (i = core_id; i < N; i += nPE) {
+            if (i == l) {
+                continue;
+            }
+
+            float *pRowSrc = pSrc + i * N;
+            float *pRowDst = pDst + i * N;
+            float factor = pRowSrc[l];
+
+#if !defined(PLP_DETERMINISTIC)
+            if (factor == 0.0f) {
+                continue;
+            }
+#endif
+
+            pRowSrc[l] = 0.0f;
+            for (j = l + 1; j < N; j++) {
+                pRowSrc[j] -= factor * pPivotSrc[j];
+            }
+            for (j = 0; j < N; j++) {
+                pRowDst[j] -= factor * pPivotDst[j];
+            }
+        }
+
+        plp_team_barrier();
+    }
 }
 
 /**
@@ -53,8 +53,8 @@
   The inverse is defined only if the input matrix is square and non-singular
   (the determinant is non-zero). The function checks that the input and output
   matrices are square and of the same size. Matrix inversion is numerically
-  sensitive and the PULP DSP library only supports matrix inversion of
-  floating-point matrices.
+  sensitive. Fixed-point matrices (plp_mat_inv_q16, plp_mat_inv_q32) are block
+  scaled to the full range of the data type before the elimination.
 
   @par Algorithm
   The Gauss-Jordan method is used to find the inverse. The algorithm performs a
@@ -179,6 +179,49 @@ int plp_mat_inv_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, float *__rest
         /* Destination pointer modifier */
         k = 1U;
 
+#if defined(PLP_DETERMINISTIC)
+
+        /* Search all rows below for the first one with a non-zero element in column l, and
+         * exchange it with row l, or row l with itself if the pivot is not zero. Like this, the
+         * time does not depend on the values of the matrix. */
+        k = 0U;
+
+        for (i = M - 1U - l; i > 0U; i--) {
+            k = (pSrcT1[N * i] != 0.0f) ? i : k;
+        }
+
+        k = (in != 0.0f) ? 0U : k;
+        flag = (k != 0U) ? 1U : flag;
+
+        pSrcT2 = pSrcT1 + (N * k);
+        pDstT2 = pDstT1 + (N * k);
+
+        j = N - l;
+
+        while (j > 0U) {
+            /* Exchange the row elements of the input matrix */
+            Xchg = *pSrcT2;
+            *pSrcT2++ = *pSrcT1;
+            *pSrcT1++ = Xchg;
+
+            /* Decrement the loop counter */
+            j--;
+        }
+
+        j = N;
+
+        while (j > 0U) {
+            /* Exchange the row elements of the destination matrix */
+            Xchg = *pDstT2;
+            *pDstT2++ = *pDstT1;
+            *pDstT1++ = Xchg;
+
+            /* Decrement loop counter */
+            j--;
+        }
+
+#else // PLP_DETERMINISTIC
+
         /* Check if the pivot element is zero */
         if (*pSrcT1 == 0.0f) {
             /* Loop over the number rows present below */
@@ -232,6 +275,8 @@ int plp_mat_inv_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, float *__rest
             }
         }
 
+#endif // PLP_DETERMINISTIC
+
         /* Update the status if the matrix is singular */
         if ((flag != 1U) && (in == 0.0f)) {
             return 1;
@@ -0,0 +1,286 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_q16s_rv32im.c
+ * Description:  16-bit fixed-point matrix inversion kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatInv
+ */
+
+/**
+  @addtogroup MatInvKernels
+  @{
+ */
+
+/* magnitude of x */
+static inline uint32_t plp_mat_inv_q16_abs_rv32im(int16_t x) {
+    return (x < 0) ? -(uint32_t)x : (uint32_t)x;
+}
+
+/* x saturated to 16 bits */
+static inline int16_t plp_mat_inv_q16_sat_rv32im(int32_t x) {
+    if (x > INT16_MAX) {
+        return INT16_MAX;
+    } else if (x < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)x;
+}
+
+/* x >> shift rounded to nearest, or x << -shift, saturated to 16 bits */
+static inline int16_t plp_mat_inv_q16_norm_rv32im(int64_t x, int32_t shift) {
+    if (shift > 62) {
+        return 0;
+    } else if (shift > 0) {
+        x = (x + ((int64_t)1 << (shift - 1))) >> shift;
+    } else if (shift < 0) {
+        if (x > (INT16_MAX >> -shift)) {
+            return INT16_MAX;
+        } else if (x < (INT16_MIN >> -shift)) {
+            return INT16_MIN;
+        }
+        x = x * ((int64_t)1 << -shift);
+    }
+    if (x > INT16_MAX) {
+        return INT16_MAX;
+    } else if (x < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)x;
+}
+
+/* reciprocal 2^29 / m with the sign of p, where |p| = m * 2^e and m is in [2^14, 2^15) */
+static inline int32_t plp_mat_inv_q16_recip_rv32im(int16_t p, int32_t *e) {
+    uint32_t absP = (p < 0) ? -(int32_t)p : p;
+    uint32_t lz = __builtin_clz(absP);
+    uint32_t m = (absP << lz) >> 17;
+    int32_t r = (int32_t)((1U << 29) / m);
+
+    *e = 17 - (int32_t)lz;
+    return (p < 0) ? -r : r;
+}
+
+/**
+  @brief Matrix inversion of 16-bit fixed-point matrices kernel for RV32IM extension.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits of the input and output matrices, 0 to 15
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par Algorithm
+  Gauss-Jordan elimination with partial pivoting, where the pivot rows are not divided by the
+  pivot. Instead, the factors of the row operations are the ratios of the eliminated elements to
+  the pivot, and every row of the inverse is divided by its diagonal element at the end. The
+  ratios are computed with the reciprocal of the pivot, which is normalized to a mantissa and an
+  exponent (a single division per pivot).
+
+  @par Block scaling
+  The input matrix is scaled by a power of two, such that its largest element has 2 guard bits
+  below the sign bit, and the inverse is computed with the same scale (1.0 = 2^12). During the
+  elimination, the matrix and the inverse each have a block exponent: before every step, they are
+  shifted right as far as needed, such that the step cannot overflow, even with the factors of the
+  rows above the pivot, which are not bounded by the pivoting. This keeps the precision
+  independent of the magnitude of the matrix and of fracBits. The matrix is reported as singular,
+  if a pivot vanishes at this precision. The elements, which do not fit into the output format,
+  are saturated.
+ */
+
+int plp_mat_inv_q16s_rv32im(int16_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst) {
+
+    uint32_t i, j, k;  // loop counters
+    uint32_t maxAbs;   // largest magnitude
+    uint32_t pivotRow; // row of the pivot
+    int32_t shift;     // block scaling of the input matrix
+    int32_t expA = 0;  // block exponent of the matrix during the elimination
+    int32_t expE = 0;  // block exponent of the inverse during the elimination
+    uint32_t bitsA;    // bits of the magnitudes of the matrix elements
+    uint32_t bitsE;    // bits of the magnitudes of the inverse elements
+    int32_t shiftA;    // right shift of the matrix before an elimination step
+    int32_t shiftE;    // right shift of the inverse before an elimination step
+    uint32_t growth;   // the factors of an elimination step are smaller than 2^growth
+    int32_t fracF;     // fractional bits of the factors of an elimination step
+    int32_t half;      // 0.5 in the format of the products of the factors
+    int32_t e;         // exponent of the pivot
+    int32_t r;         // reciprocal of the pivot
+    int16_t tmp;
+
+    if (fracBits > 15) {
+        return 2;
+    }
+
+    /* block scaling: the largest element of the input is scaled to [2^12, 2^13) */
+    maxAbs = 0;
+    for (i = 0; i < N * N; i++) {
+        uint32_t a = plp_mat_inv_q16_abs_rv32im(pSrc[i]);
+        maxAbs = (a > maxAbs) ? a : maxAbs;
+    }
+
+    if (maxAbs == 0) {
+        return 1;
+    }
+
+    shift = 12 - (31 - (int32_t)__builtin_clz(maxAbs));
+
+    for (i = 0; i < N * N; i++) {
+        pSrc[i] = plp_mat_inv_q16_norm_rv32im(pSrc[i], -shift);
+    }
+
+    /* the inverse starts as the identity matrix */
+    for (i = 0; i < N * N; i++) {
+        pDst[i] = 0;
+    }
+    for (i = 0; i < N; i++) {
+        pDst[i * N + i] = 1 << 12;
+    }
+
+    for (k = 0; k < N; k++) {
+        int16_t *pRowK = &pSrc[k * N];
+        int16_t *pDstK = &pDst[k * N];
+
+        /* partial pivoting: the largest element of column k in the rows k to N - 1 */
+        pivotRow = k;
+        maxAbs = 0;
+        for (i = k; i < N; i++) {
+            uint32_t a = plp_mat_inv_q16_abs_rv32im(pSrc[i * N + k]);
+            if (a > maxAbs) {
+                maxAbs = a;
+                pivotRow = i;
+            }
+        }
+
+        if (maxAbs == 0) {
+            return 1;
+        }
+
+        if (pivotRow != k) {
+            for (j = k; j < N; j++) {
+                tmp = pRowK[j];
+                pRowK[j] = pSrc[pivotRow * N + j];
+                pSrc[pivotRow * N + j] = tmp;
+            }
+            for (j = 0; j < N; j++) {
+                tmp = pDstK[j];
+                pDstK[j] = pDst[pivotRow * N + j];
+                pDst[pivotRow * N + j] = tmp;
+            }
+        }
+
+        /* the factors of the rows below are at most 1, the ones of the rows above are unbounded */
+        for (i = 0; i < k; i++) {
+            uint32_t a = plp_mat_inv_q16_abs_rv32im(pSrc[i * N + k]);
+            maxAbs = (a > maxAbs) ? a : maxAbs;
+        }
+        growth = 0;
+        while (((uint64_t)plp_mat_inv_q16_abs_rv32im(pRowK[k]) << growth) <= maxAbs) {
+            growth++;
+        }
+        if (growth > 13) {
+            return 1;
+        }
+
+        /* block scaling: |x| + 2^growth * |x| must not overflow for any element x of a side */
+        bitsA = 0;
+        bitsE = 0;
+        for (i = 0; i < N * N; i++) {
+            bitsA |= plp_mat_inv_q16_abs_rv32im(pSrc[i]);
+            bitsE |= plp_mat_inv_q16_abs_rv32im(pDst[i]);
+        }
+        shiftA = (32 - (int32_t)__builtin_clz(bitsA)) + (int32_t)growth - 13;
+        shiftE = (32 - (int32_t)__builtin_clz(bitsE | 1)) + (int32_t)growth - 13;
+        if (shiftA > 0) {
+            for (i = 0; i < N * N; i++) {
+                pSrc[i] = plp_mat_inv_q16_norm_rv32im(pSrc[i], shiftA);
+            }
+            expA += shiftA;
+        }
+        if (shiftE > 0) {
+            for (i = 0; i < N * N; i++) {
+                pDst[i] = plp_mat_inv_q16_norm_rv32im(pDst[i], shiftE);
+            }
+            expE += shiftE;
+        }
+
+        if (pRowK[k] == 0) {
+            return 1;
+        }
+
+        r = plp_mat_inv_q16_recip_rv32im(pRowK[k], &e);
+        fracF = 14 - (int32_t)growth;
+        half = 1 << (fracF - 1);
+
+        /* eliminate column k from all other rows, with the factor a[i][k] / a[k][k] in
+           Q(14 - growth) */
+        for (i = 0; i < N; i++) {
+            int16_t *pRowI = &pSrc[i * N];
+            int16_t *pDstI = &pDst[i * N];
+            int32_t factor;
+
+            if (i == k || pRowI[k] == 0) {
+                continue;
+            }
+
+            factor = plp_mat_inv_q16_norm_rv32im((int32_t)pRowI[k] * r, 15 + e + (int32_t)growth);
+
+            for (j = k + 1; j < N; j++) {
+                pRowI[j] = plp_mat_inv_q16_sat_rv32im(
+                    pRowI[j] - (((int32_t)factor * pRowK[j] + half) >> fracF));
+            }
+            pRowI[k] = 0;
+            for (j = 0; j < N; j++) {
+                pDstI[j] = plp_mat_inv_q16_sat_rv32im(
+                    pDstI[j] - (((int32_t)factor * pDstK[j] + half) >> fracF));
+            }
+        }
+    }
+
+    /* divide every row by its diagonal element and scale it to the output format */
+    for (i = 0; i < N; i++) {
+        int16_t *pDstI = &pDst[i * N];
+
+        if (pSrc[i * N + i] == 0) {
+            return 1;
+        }
+
+        r = plp_mat_inv_q16_recip_rv32im(pSrc[i * N + i], &e);
+        for (j = 0; j < N; j++) {
+            pDstI[j] = plp_mat_inv_q16_norm_rv32im((int64_t)pDstI[j] * r,
+                                                   29 + e + 12 - 2 * (int32_t)fracBits - shift +
+                                                       expA - expE);
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatInvKernels group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_small_batched_f32p_xpulpv2.c
+ * Description:  Parallel closed-form inverse of a batch of small 32-bit floating-point matrices
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatInv
+ */
+
+/**
+  @addtogroup MatInvKernels
+  @{
+ */
+
+/**
+  @brief Parallel closed-form inversion of a batch of 32-bit floating-point matrices of size 1x1 to
+         4x4 kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_inv_small_batched_instance_f32 struct initialized by
+                    plp_mat_inv_small_batched_f32. The status field is set to 1 if a matrix is
+                    singular, and must be 0 before.
+  @return     none
+
+  @par Work distribution
+  The batch is split into nPE contiguous chunks of whole matrices, and each core inverts the
+  matrices of its chunk with plp_mat_inv_small_f32s_xpulpv2.
+ */
+
+void plp_mat_inv_small_batched_f32p_xpulpv2(void *args) {
+
+    plp_mat_inv_small_batched_instance_f32 *a = (plp_mat_inv_small_batched_instance_f32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t size = a->N * a->N;
+    uint32_t bStart = (core_id * a->batchCount) / a->nPE;
+    uint32_t bEnd = ((core_id + 1) * a->batchCount) / a->nPE;
+    uint32_t b; // loop counter for the batch
+
+    for (b = bStart; b < bEnd; b++) {
+        float *pDet = (a->pDet != NULL) ? &a->pDet[b] : NULL;
+
+        if (plp_mat_inv_small_f32s_xpulpv2(&a->pSrc[b * size], a->N, &a->pDst[b * size], pDet)) {
+            a->status = 1;
+        }
+    }
+}
+
+/**
+  @} end of MatInvKernels group
+ */
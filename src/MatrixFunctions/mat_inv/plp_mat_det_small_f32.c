@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_det_small_f32.c
+ * Description:  Glue code for the closed-form determinant of small 32-bit floating-point matrices
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatInv
+  @{
+ */
+
+/**
+  @brief Glue code for the closed-form determinant of 32-bit floating-point matrices of size 1x1 to
+         4x4.
+  @param[in]  pSrc Points to the input matrix
+  @param[in]  N    Width and height of the matrix, 1 to 4
+  @param[out] pDet Points to the determinant
+  @return     0: Success, 2: operation not supported
+
+  @par This function will use plp_mat_det_small_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_det_small_f32(const float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDet) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_det_small_f32s_xpulpv2(pSrc, N, pDet);
+    }
+}
+
+/**
+  @} end of MatInv group
+ */
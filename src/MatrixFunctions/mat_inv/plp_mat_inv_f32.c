@@ -49,14 +49,20 @@
   The inverse is defined only if the input matrix is square and non-singular
   (the determinant is non-zero). The function checks that the input and output
   matrices are square and of the same size. Matrix inversion is numerically
-  sensitive and the PULP DSP library only supports matrix inversion of
-  floating-point matrices.
+  sensitive. Fixed-point matrices (plp_mat_inv_q16, plp_mat_inv_q32) are block
+  scaled to the full range of the data type before the elimination.
 
   @par Algorithm
   The Gauss-Jordan method is used to find the inverse. The algorithm performs a
   sequence of elementary row-operations until it reduces the input matrix to an
   identity matrix. Applying the same sequence of elementary row-operations to an
   identity matrix yields the inverse matrix.
+
+  @par Small matrices
+  Matrices of size 1x1 to 4x4 are inverted faster with plp_mat_inv_small_f32, which divides the
+  adjugate matrix by the determinant with the cofactors written out for every size, and batches
+  of them with plp_mat_inv_small_batched_f32. plp_mat_det_small_f32 computes the determinant of
+  these sizes.
  */
 
 /**
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_small_batched_f32.c
+ * Description:  Glue code for the parallel closed-form inverse of a batch of small f32 matrices
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatInv
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel closed-form inversion of a batch of 32-bit floating-point
+         matrices of size 1x1 to 4x4. Whole matrices of the batch are distributed onto the cores.
+  @param[in]  pSrc       Points to the first matrix of the input batch, which is not modified
+  @param[in]  N          Width and height of every matrix, 1 to 4
+  @param[in]  batchCount Number of matrices, which are stored one after the other
+  @param[in]  nPE        Number of cores to use
+  @param[out] pDst       Points to the first matrix of the output batch, which may be pSrc
+  @param[out] pDet       Points to the batchCount determinants of the input matrices, or NULL
+  @return     0: Success, 1: At least one matrix is singular (see pDet), 2: operation not
+              supported
+
+  @par This function will use plp_mat_inv_small_batched_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_inv_small_batched_f32(const float *pSrc,
+                                  uint32_t N,
+                                  uint32_t batchCount,
+                                  uint32_t nPE,
+                                  float *pDst,
+                                  float *pDet) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else if (N < 1 || N > 4) {
+        return 2;
+    } else {
+        plp_mat_inv_small_batched_instance_f32 args = { .pSrc = pSrc,
+                                                        .N = N,
+                                                        .batchCount = batchCount,
+                                                        .nPE = nPE,
+                                                        .pDst = pDst,
+                                                        .pDet = pDet,
+                                                        .status = 0 };
+
+        rt_team_fork(nPE, plp_mat_inv_small_batched_f32p_xpulpv2, (void *)&args);
+
+        return args.status;
+    }
+}
+
+/**
+  @} end of MatInv group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_kron_i16s_rv32im.c
+ * Description:  16-bit integer Kronecker product for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatKron
+ */
+
+/**
+  @addtogroup MatKronKernels
+  @{
+ */
+
+/**
+  @brief Kronecker product of 16-bit integer matrices with 32-bit output kernel for RV32IM
+         extension, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+
+  @par Streaming
+  Every row of C is written from left to right as N copies of a row of B, scaled with the elements
+  of a row of A, such that the output is written sequentially and every element is computed with a
+  single multiplication.
+ */
+
+void plp_mat_kron_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t P,
+                              uint32_t Q,
+                              int32_t *__restrict__ pDstC) {
+
+    uint32_t r, n, q; // loop counters
+
+    uint32_t Q_blk = Q & ~0x1;
+
+    // every row of C is made of the blocks A[m][n] * B[p][:], with r = m * P + p
+    for (r = 0; r < M * P; r++) {
+        const int16_t *__restrict__ pA = pSrcA + (r / P) * N;
+        const int16_t *__restrict__ pB = pSrcB + (r % P) * Q;
+        int32_t *__restrict__ pC = pDstC + r * N * Q;
+        for (n = 0; n < N; n++) {
+            int32_t a = pA[n];
+            int32_t *__restrict__ pCn = pC + n * Q;
+            for (q = 0; q < Q_blk; q += 2) {
+                pCn[q] = a * pB[q];
+                pCn[q + 1] = a * pB[q + 1];
+            }
+            if (q < Q) {
+                pCn[q] = a * pB[q];
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatKronKernels group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_kron_i32p_xpulpv2.c
+ * Description:  Parallel 32-bit integer Kronecker product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatKron
+ */
+
+/**
+  @addtogroup MatKronKernels
+  @{
+ */
+
+/**
+  @brief Parallel Kronecker product of 32-bit integer matrices kernel for XPULPV2 extension, C = A
+         (x) B.
+  @param[in]  args  pointer to plp_mat_kron_instance_i32 struct initialized by
+                    plp_mat_kron_i32_parallel
+  @return     none
+
+  @par Work distribution
+  The rows of C and the blocks of Q columns are split among the cores with plp_mat_partition.
+ */
+
+void plp_mat_kron_i32p_xpulpv2(void *args) {
+
+    plp_mat_kron_instance_i32 *a = (plp_mat_kron_instance_i32 *)args;
+
+    const int32_t *__restrict__ pSrcA = a->pSrcA;
+    const int32_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t P = a->P;
+    uint32_t Q = a->Q;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M * P, N, nPE, plp_core_id(), &tile);
+
+    uint32_t r, n, q; // loop counters
+
+    uint32_t Q_blk = Q & ~0x1;
+
+    // every row of C is made of the blocks A[m][n] * B[p][:], with r = m * P + p
+    for (r = tile.mStart; r < tile.mEnd; r++) {
+        const int32_t *__restrict__ pA = pSrcA + (r / P) * N;
+        const int32_t *__restrict__ pB = pSrcB + (r % P) * Q;
+        int32_t *__restrict__ pC = pDstC + r * N * Q;
+        for (n = tile.oStart; n < tile.oEnd; n++) {
+            int32_t a = pA[n];
+            int32_t *__restrict__ pCn = pC + n * Q;
+            for (q = 0; q < Q_blk; q += 2) {
+                pCn[q] = a * pB[q];
+                pCn[q + 1] = a * pB[q + 1];
+            }
+            if (q < Q) {
+                pCn[q] = a * pB[q];
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatKronKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_kron_i32.c
+ * Description:  32-bit integer Kronecker product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatKron Kronecker product
+  This module contains the glue code for the Kronecker product of two matrices, C = A (x) B. The
+  kernel codes (kernels) are in the Module Kronecker product Kernels.
+
+  For A of shape MxN and B of shape PxQ, C has shape (M*P)x(N*Q), and
+
+      C[(m * P + p) * N * Q + n * Q + q] = A[m * N + n] * B[p * Q + q]
+
+  The kernels write the rows of C one after the other, each as N scaled copies of a row of B. The
+  parallel functions split the rows of C and the blocks of Q columns among the cores with
+  plp_mat_partition.
+
+  There are functions for 8, 16 and 32-bit integers (with a 32-bit output) and for 32-bit
+  floating-point numbers, which are only supported on the cluster side.
+ */
+
+/**
+  @addtogroup MatKron
+  @{
+ */
+
+/**
+  @brief Glue code for the Kronecker product of 32-bit integer matrices, C = A (x) B.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the input matrix B of shape PxQ
+  @param[in]  M     Height of A
+  @param[in]  N     Width of A
+  @param[in]  P     Height of B
+  @param[in]  Q     Width of B
+  @param[out] pDstC Points to the output matrix C of shape (M*P)x(N*Q)
+  @return     none
+ */
+
+void plp_mat_kron_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t P,
+                      uint32_t Q,
+                      int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_kron_i32s_rv32im(pSrcA, pSrcB, M, N, P, Q, pDstC);
+    } else {
+        plp_mat_kron_i32s_xpulpv2(pSrcA, pSrcB, M, N, P, Q, pDstC);
+    }
+}
+
+/**
+  @} end of MatKron group
+ */
@@ -0,0 +1,126 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32s_xpulpv2.c
+ * Description:  32-bit floating-point LU decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @defgroup MatLUKernels LU decomposition kernels
+  This module contains the kernel functions for the LU decomposition and the solution of linear
+  systems with it.
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief LU decomposition with partial pivoting of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrc  Points to the input matrix A of shape NxN
+  @param[in]  N     Width and height of the matrices
+  @param[out] pLU   Points to the output matrix of shape NxN, with L below and U on and above the
+                    diagonal
+  @param[out] pPerm Points to the output permutation vector of length N
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_lu_f32s_xpulpv2(const float *__restrict__ pSrc,
+                            uint32_t N,
+                            float *__restrict__ pLU,
+                            uint32_t *__restrict__ pPerm) {
+
+    uint32_t i, j, k;
+
+    for (i = 0; i < N * N; i++) {
+        pLU[i] = pSrc[i];
+    }
+
+    for (i = 0; i < N; i++) {
+        pPerm[i] = i;
+    }
+
+    for (k = 0; k < N; k++) {
+        float *pRowK = pLU + k * N;
+
+        /* find the pivot, the largest absolute value in column k on or below the diagonal */
+        uint32_t pivot = k;
+        float maxVal = fabsf(pRowK[k]);
+
+        for (i = k + 1; i < N; i++) {
+            float val = fabsf(pLU[i * N + k]);
+            if (val > maxVal) {
+                maxVal = val;
+                pivot = i;
+            }
+        }
+
+        if (maxVal == 0.0f) {
+            return 1;
+        }
+
+        /* swap the pivot row into row k */
+        if (pivot != k) {
+            float *pRowP = pLU + pivot * N;
+            uint32_t tmpIdx = pPerm[k];
+
+            for (j = 0; j < N; j++) {
+                float tmp = pRowK[j];
+                pRowK[j] = pRowP[j];
+                pRowP[j] = tmp;
+            }
+
+            pPerm[k] = pPerm[pivot];
+            pPerm[pivot] = tmpIdx;
+        }
+
+        float invPivot = 1.0f / pRowK[k];
+
+        /* column k of L, and update of the remaining submatrix */
+        for (i = k + 1; i < N; i++) {
+            float *pRowI = pLU + i * N;
+            float factor = pRowI[k] * invPivot;
+
+            pRowI[k] = factor;
+
+            for (j = k + 1; j < N; j++) {
+                pRowI[j] -= factor * pRowK[j];
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatLUKernels group
+ */
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_solve_f32p_xpulpv2.c
+ * Description:  32-bit floating-point parallel LU solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief Parallel solving of linear systems A * X = B of 32-bit floating-point matrices with the LU
+         decomposition of A kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_lu_solve_instance_f32 struct initialized by
+                    plp_mat_lu_solve_f32_parallel. The status field is set to 1 if the matrix
+                    is singular.
+  @return     none
+
+  @par Every core solves the systems of the columns o = core_id, core_id + nPE, ... of B. The
+       columns are independent, so the cores do not synchronize.
+ */
+
+void plp_mat_lu_solve_f32p_xpulpv2(void *args) {
+
+    plp_mat_lu_solve_instance_f32 *a = (plp_mat_lu_solve_instance_f32 *)args;
+
+    const float *__restrict__ pLU = a->pLU;
+    const uint32_t *__restrict__ pPerm = a->pPerm;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstX = a->pDstX;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t i, k, n, o;
+
+    /* every core checks the diagonal, so that no core starts before the check */
+    for (i = 0; i < N; i++) {
+        if (pLU[i * N + i] == 0.0f) {
+            if (core_id == 0) {
+                a->status = 1;
+            }
+            return;
+        }
+    }
+
+    for (o = core_id; o < O; o += nPE) {
+        /* forward substitution with L, on the permuted column o of B */
+        for (i = 0; i < N; i++) {
+            const float *pRowLU = pLU + i * N;
+            float sum = pSrcB[pPerm[i] * O + o];
+
+            for (k = 0; k < i; k++) {
+                sum -= pRowLU[k] * pDstX[k * O + o];
+            }
+            pDstX[i * O + o] = sum;
+        }
+
+        /* backward substitution with U */
+        for (n = N; n > 0; n--) {
+            i = n - 1;
+            const float *pRowLU = pLU + i * N;
+            float sum = pDstX[i * O + o];
+
+            for (k = i + 1; k < N; k++) {
+                sum -= pRowLU[k] * pDstX[k * O + o];
+            }
+            pDstX[i * O + o] = sum / pRowLU[i];
+        }
+    }
+}
+
+/**
+  @} end of MatLUKernels group
+ */
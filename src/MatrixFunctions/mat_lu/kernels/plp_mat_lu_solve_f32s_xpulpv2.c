@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_solve_f32s_xpulpv2.c
+ * Description:  32-bit floating-point LU solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief Solving linear systems A * X = B of 32-bit floating-point matrices with the LU
+         decomposition of A kernel for XPULPV2 extension.
+  @param[in]  pLU   Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm Points to the permutation vector, computed by plp_mat_lu_f32
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+  @param[in]  N     Width and height of A, height of B and X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_lu_solve_f32s_xpulpv2(const float *__restrict__ pLU,
+                                  const uint32_t *__restrict__ pPerm,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  float *__restrict__ pDstX) {
+
+    uint32_t i, k, n, o;
+
+    for (i = 0; i < N; i++) {
+        if (pLU[i * N + i] == 0.0f) {
+            return 1;
+        }
+    }
+
+    for (o = 0; o < O; o++) {
+        /* forward substitution with L, on the permuted column o of B */
+        for (i = 0; i < N; i++) {
+            const float *pRowLU = pLU + i * N;
+            float sum = pSrcB[pPerm[i] * O + o];
+
+            for (k = 0; k < i; k++) {
+                sum -= pRowLU[k] * pDstX[k * O + o];
+            }
+            pDstX[i * O + o] = sum;
+        }
+
+        /* backward substitution with U */
+        for (n = N; n > 0; n--) {
+            i = n - 1;
+            const float *pRowLU = pLU + i * N;
+            float sum = pDstX[i * O + o];
+
+            for (k = i + 1; k < N; k++) {
+                sum -= pRowLU[k] * pDstX[k * O + o];
+            }
+            pDstX[i * O + o] = sum / pRowLU[i];
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatLUKernels group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32.c
+ * Description:  Glue code for the 32-bit floating-point LU decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatLU LU decomposition
+  This module contains the glue code for the LU decomposition and the solution of linear systems
+  with it. The kernel codes (kernels) are in the Module LU decomposition Kernels.
+
+  The LU decomposition with partial pivoting factors a square matrix A of shape NxN into
+
+      `P * A = L * U`
+
+  where P is a permutation matrix, L a lower triangular matrix with ones on the diagonal, and U an
+  upper triangular matrix. L (without the diagonal) and U are stored together in one NxN matrix,
+  and P is stored as a vector of row indices: row i of P * A is row pPerm[i] of A.
+
+  Once the factors are computed, plp_mat_lu_solve_f32 solves A * X = B for any number O of
+  right-hand sides, with about N * N multiply-accumulates per right-hand side. When the matrix A
+  stays the same for many right-hand sides, this is much cheaper than inverting A
+  (plp_mat_inv_f32) or factoring it again. The parallel solve distributes the right-hand sides
+  (columns of B) to the cores, which then work without synchronization.
+
+  The PULP DSP library only supports the LU decomposition of floating-point matrices, on the
+  cluster side.
+
+  @par Algorithm
+  The factorization is done with Gaussian elimination (Doolittle form). For every column k, the
+  row with the largest absolute value in column k on or below the diagonal is swapped to row k
+  (partial pivoting), the elements below the pivot are divided by it and become column k of L, and
+  the remaining submatrix is updated. The matrix is singular if the largest absolute value is 0.
+  The solve applies the permutation to B, then does a forward substitution with L and a backward
+  substitution with U.
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for LU decomposition with partial pivoting of 32-bit floating-point matrices.
+  @param[in]  pSrc  Points to the input matrix A of shape NxN
+  @param[in]  N     Width and height of the matrices
+  @param[out] pLU   Points to the output matrix of shape NxN, with L below and U on and above the
+                    diagonal
+  @param[out] pPerm Points to the output permutation vector of length N
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_lu_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_lu_f32(const float *__restrict__ pSrc,
+                   uint32_t N,
+                   float *__restrict__ pLU,
+                   uint32_t *__restrict__ pPerm) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_lu_f32s_xpulpv2(pSrc, N, pLU, pPerm);
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_solve_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point LU solve
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for parallel solving of linear systems A * X = B of 32-bit floating-point
+         matrices with the LU decomposition of A.
+  @param[in]  pLU   Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm Points to the permutation vector, computed by plp_mat_lu_f32
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape NxO
+  @param[in]  N     Width and height of A, height of B and X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_lu_solve_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_lu_solve_f32_parallel(const float *__restrict__ pLU,
+                                  const uint32_t *__restrict__ pPerm,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDstX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_lu_solve_f32_parallel), N * N * O);
+        }
+
+        plp_mat_lu_solve_instance_f32 args = { .pLU = pLU,
+                                               .pPerm = pPerm,
+                                               .pSrcB = pSrcB,
+                                               .N = N,
+                                               .O = O,
+                                               .nPE = nPE,
+                                               .pDstX = pDstX,
+                                               .status = 0 };
+
+        rt_team_fork(nPE, plp_mat_lu_solve_f32p_xpulpv2, (void *)&args);
+
+        return args.status;
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
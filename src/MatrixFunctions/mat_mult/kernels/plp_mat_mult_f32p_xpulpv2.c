@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
- * Title:        plp_mat_mult_i32s_xpulpv2.c
- * Description:  32-bit integer matrix multiplication for XPULPV2
+ * Title:        plp_mat_mult_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point matrix multiplication for XPULPV2
  *
  * $Date:        18. July 2019
  * $Revision:    V0
@@ -45,29 +45,50 @@
    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
                      plp_mat_mult_f32_parallel
    @return     none
+
+   @par Register blocking
+   The output is computed in blocks of PLP_MATMUL_BLOCK_M x PLP_MATMUL_BLOCK_O elements (4x4 by
+   default, see plp_math_common.h). For each step in N, one value per row and one value per
+   column of the block are loaded and reused for all multiply-accumulates of the block. Rows and
+   columns which do not fill a block are computed by one-row and one-column micro-kernels.
+
+   @par Work distribution
+   Each core computes one tile of the output matrix, determined by plp_mat_partition or taken
+   from the plan of plp_mat_mult_plan_create. Depending on the shape, the output is split by
+   rows, by columns or in a 2D grid.
 */
 
+#define BLK_M PLP_MATMUL_F32_BLOCK_M
+#define BLK_O PLP_MATMUL_F32_BLOCK_O
+
 void plp_mat_mult_f32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
-    plp_mat_mult_instance_f32 *a = (plp_mat_mult_instance_f32 *)args;
+    plp_mat_mult_instance_f32 *arguments = (plp_mat_mult_instance_f32 *)args;
 
-    const float *__restrict__ pSrcA = a->pSrcA;
-    const float *__restrict__ pSrcB = a->pSrcB;
-    uint32_t M = a->M;
-    uint32_t N = a->N;
-    uint32_t O = a->O;
-    uint32_t nPE = a->nPE;
-    float *__restrict__ pDstC = a->pDstC;
+    const float *__restrict__ pSrcA = arguments->pSrcA;
+    const float *__restrict__ pSrcB = arguments->pSrcB;
+    uint32_t M = arguments->M;
+    uint32_t N = arguments->N;
+    uint32_t O = arguments->O;
+    uint32_t nPE = arguments->nPE;
+    float *__restrict__ pDstC = arguments->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
             float sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * N + n] * pSrcB[n * O + o];
@@ -78,12 +99,113 @@ void plp_mat_mult_f32p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n, o, i, j;
+
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
+
+    uint32_t M_blk = tile.mEnd - (tile.mEnd - tile.mStart) % BLK_M;
+    uint32_t O_blk = tile.oEnd - (tile.oEnd - tile.oStart) % BLK_O;
+
+    for (m = tile.mStart; m < M_blk; m += BLK_M) {
+
+        const float *__restrict__ pA = pSrcA + m * N;
+
+        // BLK_M x BLK_O blocks
+        for (o = tile.oStart; o < O_blk; o += BLK_O) {
+
+            float sum[BLK_M][BLK_O] = { { 0 } };
+            const float *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float a[BLK_M];
+                float b[BLK_O];
+
+                for (i = 0; i < BLK_M; i++) {
+                    a[i] = pA[i * N + n];
+                }
+                for (j = 0; j < BLK_O; j++) {
+                    b[j] = pB[j];
+                }
+                pB += O;
+
+                for (i = 0; i < BLK_M; i++) {
+                    for (j = 0; j < BLK_O; j++) {
+                        sum[i][j] += a[i] * b[j];
+                    }
+                }
+            }
+
+            for (i = 0; i < BLK_M; i++) {
+                for (j = 0; j < BLK_O; j++) {
+                    pDstC[(m + i) * O + o + j] = sum[i][j];
+                }
+            }
+        }
+
+        // column tail: BLK_M x 1 blocks
+        for (o = O_blk; o < tile.oEnd; o++) {
+
+            float sum[BLK_M] = { 0 };
+            const float *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float b = *pB;
+                pB += O;
+                for (i = 0; i < BLK_M; i++) {
+                    sum[i] += pA[i * N + n] * b;
+                }
+            }
+
+            for (i = 0; i < BLK_M; i++) {
+                pDstC[(m + i) * O + o] = sum[i];
+            }
+        }
+    }
+
+    // row tail: 1 x BLK_O blocks and the remaining corner
+    for (m = M_blk; m < tile.mEnd; m++) {
+
+        const float *__restrict__ pA = pSrcA + m * N;
+
+        for (o = tile.oStart; o < O_blk; o += BLK_O) {
+
+            float sum[BLK_O] = { 0 };
+            const float *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float a = pA[n];
+                for (j = 0; j < BLK_O; j++) {
+                    sum[j] += a * pB[j];
+                }
+                pB += O;
+            }
+
+            for (j = 0; j < BLK_O; j++) {
+                pDstC[m * O + o + j] = sum[j];
+            }
+        }
+
+        for (o = O_blk; o < tile.oEnd; o++) {
+            float sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pA[n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
 }
 
+#undef BLK_M
+#undef BLK_O
+
 /**
    @} end of BasicMatMultKernels group
 */
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_f32s_rv32im.c
+ * Description:  32-bit floating-point matrix multiplication kernel for the FC, in fixed point
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 32-bit floating-point matrices kernel for RV32IM extension, in
+  fixed point.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par
+  Both matrices are converted to fixed point with the exponent of their largest value (see
+  plp_dot_prod_f32s_rv32im), on the fly, such that no temporary memory is needed. The FC computes
+  with integer instructions only and does not need soft-float calls (see PLP_FC_FIXED_POINT).
+ */
+
+void plp_mat_mult_f32s_rv32im(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float *__restrict__ pDstC) {
+
+    uint32_t m, n, o; /* Loop counters */
+    int32_t expA = 1, expB = 1, exp;
+    uint32_t guard = 0;
+
+    for (n = 0; n < M * N; n++) {
+        exp = plp_f32_exp_inline(pSrcA[n]);
+        expA = (exp > expA) ? exp : expA;
+    }
+    for (n = 0; n < N * O; n++) {
+        exp = plp_f32_exp_inline(pSrcB[n]);
+        expB = (exp > expB) ? exp : expB;
+    }
+
+    while ((N >> (15 + guard)) != 0) {
+        guard++;
+    }
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int64_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += ((int64_t)plp_f32_to_fix_inline(pSrcA[m * N + n], expA) *
+                        plp_f32_to_fix_inline(pSrcB[n * O + o], expB)) >>
+                       guard;
+            }
+            pDstC[m * O + o] = plp_fix_to_f32_inline(sum, expA + expB - 300 + (int32_t)guard);
+        }
+    }
+}
+
+/**
+  @} end of BasicMatMultKernels group
+ */
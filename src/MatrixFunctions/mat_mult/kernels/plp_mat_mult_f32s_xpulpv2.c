@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
- * Title:        plp_mat_mult_i32s_xpulpv2.c
- * Description:  32-bit integer matrix multiplication for XPULPV2
+ * Title:        plp_mat_mult_f32s_xpulpv2.c
+ * Description:  32-bit floating-point matrix multiplication for XPULPV2
  *
  * $Date:        18. July 2019
  * $Revision:    V0
@@ -48,8 +48,21 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Register blocking
+  The output is computed in blocks of PLP_MATMUL_BLOCK_M x PLP_MATMUL_BLOCK_O elements (4x4 by
+  default, see plp_math_common.h). For each step in N, one value per row and one value per
+  column of the block are loaded and reused for all multiply-accumulates of the block. Rows and
+  columns which do not fill a block are computed by one-row and one-column micro-kernels.
  */
 
+#define BLK_M PLP_MATMUL_F32_BLOCK_M
+#define BLK_O PLP_MATMUL_F32_BLOCK_O
+
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+
+#ifdef BASIC_VERSION
+
 void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
                                const float *__restrict__ pSrcB,
                                uint32_t M,
@@ -57,9 +70,6 @@ void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
                                uint32_t O,
                                float *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
     uint32_t m, n, o;
 
     for (m = 0; m < M; m++) {
@@ -71,14 +81,116 @@ void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
             pDstC[m * O + o] = sum;
         }
     }
+}
 
 #else
 
-    // TODO: Hackathon
+void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float *__restrict__ pDstC) {
+
+    uint32_t m, n, o, i, j;
+
+    uint32_t M_blk = M - M % BLK_M;
+    uint32_t O_blk = O - O % BLK_O;
+
+    for (m = 0; m < M_blk; m += BLK_M) {
+
+        const float *__restrict__ pA = pSrcA + m * N;
+
+        // BLK_M x BLK_O blocks
+        for (o = 0; o < O_blk; o += BLK_O) {
+
+            float sum[BLK_M][BLK_O] = { { 0 } };
+            const float *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float a[BLK_M];
+                float b[BLK_O];
+
+                for (i = 0; i < BLK_M; i++) {
+                    a[i] = pA[i * N + n];
+                }
+                for (j = 0; j < BLK_O; j++) {
+                    b[j] = pB[j];
+                }
+                pB += O;
+
+                for (i = 0; i < BLK_M; i++) {
+                    for (j = 0; j < BLK_O; j++) {
+                        sum[i][j] += a[i] * b[j];
+                    }
+                }
+            }
+
+            for (i = 0; i < BLK_M; i++) {
+                for (j = 0; j < BLK_O; j++) {
+                    pDstC[(m + i) * O + o + j] = sum[i][j];
+                }
+            }
+        }
+
+        // column tail: BLK_M x 1 blocks
+        for (o = O_blk; o < O; o++) {
+
+            float sum[BLK_M] = { 0 };
+            const float *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float b = *pB;
+                pB += O;
+                for (i = 0; i < BLK_M; i++) {
+                    sum[i] += pA[i * N + n] * b;
+                }
+            }
+
+            for (i = 0; i < BLK_M; i++) {
+                pDstC[(m + i) * O + o] = sum[i];
+            }
+        }
+    }
+
+    // row tail: 1 x BLK_O blocks and the remaining corner
+    for (m = M_blk; m < M; m++) {
+
+        const float *__restrict__ pA = pSrcA + m * N;
+
+        for (o = 0; o < O_blk; o += BLK_O) {
+
+            float sum[BLK_O] = { 0 };
+            const float *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float a = pA[n];
+                for (j = 0; j < BLK_O; j++) {
+                    sum[j] += a * pB[j];
+                }
+                pB += O;
+            }
+
+            for (j = 0; j < BLK_O; j++) {
+                pDstC[m * O + o + j] = sum[j];
+            }
+        }
+
+        for (o = O_blk; o < O; o++) {
+            float sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pA[n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
 
 #endif
 #undef BASIC_VERSION
-}
+
+#undef BLK_M
+#undef BLK_O
 
 /**
    @} end of BasicMatMultKernels group
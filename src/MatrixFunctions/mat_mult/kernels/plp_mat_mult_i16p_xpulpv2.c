@@ -48,6 +48,11 @@
    @par Exploiting SIMD instructions
    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
    performed on 32 bit vectors, with 32 bit accumulator.
+
+   @par Work distribution
+   Each core computes one tile of the output matrix, determined by plp_mat_partition or taken
+   from the plan of plp_mat_mult_plan_create. Depending on the shape, the output is split by
+   rows, by columns or in a 2D grid.
 */
 
 // define BASIC_VERSION // if used don't forget to also use the undefine at end of file
@@ -68,11 +73,18 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
     uint32_t j; // loop counter
     uint32_t k; // loop counter
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
+
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
 
-    for (i = core_id; i < M; i += nPE) {
-        for (k = 0; k < O; k++) {
-            int16_t sum = 0;
+    for (i = tile.mStart; i < tile.mEnd; i++) {
+        for (k = tile.oStart; k < tile.oEnd; k++) {
+            int32_t sum = 0;
             for (j = 0; j < N; j++) {
                 sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
@@ -80,7 +92,7 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 #else
@@ -99,10 +111,21 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
     uint32_t j = 0; // loop counter for N
     uint32_t k = 0; // loop counter for O
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
+
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
+
+    uint32_t iEnd = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x3);
+    uint32_t jEnd = N & ~0x1;
+    uint32_t kEnd = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x1);
 
-    for (k = core_id; k < O / 2; k += nPE) {
-        for (i = 0; i < M / 4; i++) {
+    for (i = tile.mStart; i < iEnd; i += 4) {
+        for (k = tile.oStart; k < kEnd; k += 2) {
 
             int32_t sum00 = 0;
             int32_t sum01 = 0;
@@ -113,17 +136,15 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
             int32_t sum30 = 0;
             int32_t sum31 = 0;
 
-            // v2s* Bpoint = (v2s*) &(pSrcB[k]);
-
-            for (j = 0; j < N / 2; j++) {
+            for (j = 0; j < jEnd; j += 2) {
 
-                v2s aVec0 = *((v2s *)&(pSrcA[(i * 4) * N + (j * 2)]));
-                v2s aVec1 = *((v2s *)&(pSrcA[(i * 4 + 1) * N + (j * 2)]));
-                v2s aVec2 = *((v2s *)&(pSrcA[(i * 4 + 2) * N + (j * 2)]));
-                v2s aVec3 = *((v2s *)&(pSrcA[(i * 4 + 3) * N + (j * 2)]));
+                v2s aVec0 = *((v2s *)&(pSrcA[(i + 0) * N + j]));
+                v2s aVec1 = *((v2s *)&(pSrcA[(i + 1) * N + j]));
+                v2s aVec2 = *((v2s *)&(pSrcA[(i + 2) * N + j]));
+                v2s aVec3 = *((v2s *)&(pSrcA[(i + 3) * N + j]));
 
-                v2s bTemp0 = *((v2s *)&(pSrcB[(j * 2) * O + (k * 2)]));
-                v2s bTemp1 = *((v2s *)&(pSrcB[(j * 2 + 1) * O + (k * 2)]));
+                v2s bTemp0 = *((v2s *)&(pSrcB[j * O + k]));
+                v2s bTemp1 = *((v2s *)&(pSrcB[(j + 1) * O + k]));
 
                 v2s bVec0 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 0, 2 });
                 v2s bVec1 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 1, 3 });
@@ -138,72 +159,59 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
                 sum31 = __SUMDOTP2(aVec3, bVec1, sum31);
             }
 
-            pDstC[(i * 4) * O + (k * 2)] = sum00;
-            pDstC[(i * 4) * O + (k * 2 + 1)] = sum01;
-            pDstC[(i * 4 + 1) * O + (k * 2)] = sum10;
-            pDstC[(i * 4 + 1) * O + (k * 2 + 1)] = sum11;
-            pDstC[(i * 4 + 2) * O + (k * 2)] = sum20;
-            pDstC[(i * 4 + 2) * O + (k * 2 + 1)] = sum21;
-            pDstC[(i * 4 + 3) * O + (k * 2)] = sum30;
-            pDstC[(i * 4 + 3) * O + (k * 2 + 1)] = sum31;
-        }
-    }
-
-    // clean up code
-    i = i * 4;
-    j = j * 2;
-    k = k * 2;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (k = core_id * 2; k < kEnd; k += nPE * 2) {
-                for (int step = 0; step < 2; step++) {
-                    for (i = 0; i < iEnd; i++) {
-                        int32_t sum = 0;
-                        for (j = jEnd; j < N; j++) {
-                            sum += sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] += sum;
-                    }
-                }
+            // clean up for j
+            if (j < N) {
+                int32_t BVal0 = pSrcB[j * O + k];
+                int32_t BVal1 = pSrcB[j * O + k + 1];
+                int32_t AVal0 = pSrcA[(i + 0) * N + j];
+                int32_t AVal1 = pSrcA[(i + 1) * N + j];
+                int32_t AVal2 = pSrcA[(i + 2) * N + j];
+                int32_t AVal3 = pSrcA[(i + 3) * N + j];
+
+                sum00 += AVal0 * BVal0;
+                sum01 += AVal0 * BVal1;
+                sum10 += AVal1 * BVal0;
+                sum11 += AVal1 * BVal1;
+                sum20 += AVal2 * BVal0;
+                sum21 += AVal2 * BVal1;
+                sum30 += AVal3 * BVal0;
+                sum31 += AVal3 * BVal1;
             }
+
+            pDstC[(i + 0) * O + k] = sum00;
+            pDstC[(i + 0) * O + k + 1] = sum01;
+            pDstC[(i + 1) * O + k] = sum10;
+            pDstC[(i + 1) * O + k + 1] = sum11;
+            pDstC[(i + 2) * O + k] = sum20;
+            pDstC[(i + 2) * O + k + 1] = sum21;
+            pDstC[(i + 3) * O + k] = sum30;
+            pDstC[(i + 3) * O + k + 1] = sum31;
         }
+    }
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id * 2; k < kEnd; k += nPE * 2) {
-                for (int step = 0; step < 2; step++) {
-                    for (i = iEnd; i < M; i++) {
-                        int32_t sum = 0;
-                        for (j = 0; j < N; j++) {
-                            sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] = sum;
-                    }
-                }
+    // clean up for k
+    for (k = kEnd; k < tile.oEnd; k++) {
+        for (i = tile.mStart; i < iEnd; i++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
+    }
 
-        // clean up for k
-        for (k = kEnd; k < O; k++) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                }
-                pDstC[i * O + k] = sum;
+    // clean up for i
+    for (i = iEnd; i < tile.mEnd; i++) {
+        for (k = tile.oStart; k < tile.oEnd; k++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 #endif
@@ -44,8 +44,22 @@
   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
                     plp_mat_mult_i32_parallel
   @return     none
+
+  @par Register blocking
+  The output is computed in blocks of PLP_MATMUL_BLOCK_M x PLP_MATMUL_BLOCK_O elements (2x2 by
+  default, see plp_math_common.h). For each step in N, one value per row and one value per
+  column of the block are loaded and reused for all multiply-accumulates of the block. Rows and
+  columns which do not fill a block are computed by one-row and one-column micro-kernels.
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition or taken
+  from the plan of plp_mat_mult_plan_create. Depending on the shape, the output is split by
+  rows, by columns or in a 2D grid.
  */
 
+#define BLK_M PLP_MATMUL_I32_BLOCK_M
+#define BLK_O PLP_MATMUL_I32_BLOCK_O
+
 // define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 
 #ifdef BASIC_VERSION
@@ -64,13 +78,17 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
     uint32_t j; // loop counter
     uint32_t k; // loop counter
 
-    int core_id = rt_core_id();
-    int step = (M - 1 + nPE) / nPE;
-    uint32_t START = step * core_id;
-    uint32_t END = (core_id != rt_nb_pe() - 1) ? START + step : M;
-    // printf("core id: %i, start: %i, end: %i\n", core_id, START, END);
-    for (i = START; i < END; i++) {
-        for (k = 0; k < O; k++) {
+    int core_id = plp_core_id();
+
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
+
+    for (i = tile.mStart; i < tile.mEnd; i++) {
+        for (k = tile.oStart; k < tile.oEnd; k++) {
             int32_t sum = 0;
             for (j = 0; j < N; j++) {
                 sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
@@ -79,7 +97,7 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 #else
@@ -94,98 +112,117 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
-    uint32_t i = 0; // loop counter for M
-    uint32_t j = 0; // loop counter for N
-    uint32_t k = 0; // loop counter for O
+    uint32_t m, n, o, i, j;
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
-    // printf("core id: %i, start: %i, end: %i\n", core_id, START, END);
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
 
-    for (k = core_id; k < O / 2; k += nPE) {
-        for (i = 0; i < M / 2; i++) {
+    uint32_t M_blk = tile.mEnd - (tile.mEnd - tile.mStart) % BLK_M;
+    uint32_t O_blk = tile.oEnd - (tile.oEnd - tile.oStart) % BLK_O;
 
-            int32_t sum00 = 0;
-            int32_t sum01 = 0;
-            int32_t sum10 = 0;
-            int32_t sum11 = 0;
+    for (m = tile.mStart; m < M_blk; m += BLK_M) {
 
-            for (j = 0; j < N; j++) {
-                int32_t AVal0 = pSrcA[i * 2 * N + (j)];
-                int32_t AVal1 = pSrcA[i * 2 * N + N + (j)];
+        const int32_t *__restrict__ pA = pSrcA + m * N;
 
-                int32_t BVal0 = pSrcB[j * O + (k * 2)];
-                int32_t BVal1 = pSrcB[j * O + (k * 2 + 1)];
+        // BLK_M x BLK_O blocks
+        for (o = tile.oStart; o < O_blk; o += BLK_O) {
 
-                sum00 = sum00 + AVal0 * BVal0;
-                sum01 = sum01 + AVal0 * BVal1;
-                sum10 = sum10 + AVal1 * BVal0;
-                sum11 = sum11 + AVal1 * BVal1;
-            }
+            int32_t sum[BLK_M][BLK_O] = { { 0 } };
+            const int32_t *__restrict__ pB = pSrcB + o;
 
-            pDstC[(i * 2) * O + k * 2] = sum00;
-            pDstC[(i * 2) * O + k * 2 + 1] = sum01;
-            pDstC[(i * 2 + 1) * O + k * 2] = sum10;
-            pDstC[(i * 2 + 1) * O + k * 2 + 1] = sum11;
-        }
-    }
+            for (n = 0; n < N; n++) {
+                int32_t a[BLK_M];
+                int32_t b[BLK_O];
 
-    // clean up code
-    i = i * 2;
-    j = j;
-    k = k * 2;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
+                for (i = 0; i < BLK_M; i++) {
+                    a[i] = pA[i * N + n];
+                }
+                for (j = 0; j < BLK_O; j++) {
+                    b[j] = pB[j];
+                }
+                pB += O;
 
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (i = 0; i < iEnd; i++) {
-                for (k = 0; k < kEnd; k += nPE) {
-                    int32_t sum = 0;
-                    for (j = jEnd; j < N; j++) {
-                        sum += sum + pSrcA[i * N + j] * pSrcB[j * O + k];
+                for (i = 0; i < BLK_M; i++) {
+                    for (j = 0; j < BLK_O; j++) {
+                        sum[i][j] += a[i] * b[j];
                     }
-                    pDstC[i * O + k] += sum;
+                }
+            }
+
+            for (i = 0; i < BLK_M; i++) {
+                for (j = 0; j < BLK_O; j++) {
+                    pDstC[(m + i) * O + o + j] = sum[i][j];
                 }
             }
         }
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id; k < kEnd; k += nPE) {
-                for (i = iEnd; i < M; i++) {
-                    int32_t sum = 0;
-                    for (j = 0; j < N; j++) {
-                        sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                    }
-                    pDstC[i * O + k] = sum;
+        // column tail: BLK_M x 1 blocks
+        for (o = O_blk; o < tile.oEnd; o++) {
+
+            int32_t sum[BLK_M] = { 0 };
+            const int32_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                int32_t b = *pB;
+                pB += O;
+                for (i = 0; i < BLK_M; i++) {
+                    sum[i] += pA[i * N + n] * b;
                 }
             }
+
+            for (i = 0; i < BLK_M; i++) {
+                pDstC[(m + i) * O + o] = sum[i];
+            }
         }
+    }
+
+    // row tail: 1 x BLK_O blocks and the remaining corner
+    for (m = M_blk; m < tile.mEnd; m++) {
+
+        const int32_t *__restrict__ pA = pSrcA + m * N;
 
-        // clean up for k
-        for (k = kEnd; k < O; k += nPE) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
+        for (o = tile.oStart; o < O_blk; o += BLK_O) {
+
+            int32_t sum[BLK_O] = { 0 };
+            const int32_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                int32_t a = pA[n];
+                for (j = 0; j < BLK_O; j++) {
+                    sum[j] += a * pB[j];
                 }
-                pDstC[i * O + k] = sum;
+                pB += O;
+            }
+
+            for (j = 0; j < BLK_O; j++) {
+                pDstC[m * O + o + j] = sum[j];
             }
         }
+
+        for (o = O_blk; o < tile.oEnd; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pA[n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 #endif
 
 // undefine BASIC_VERSION
+#undef BLK_M
+#undef BLK_O
+
 /**
    @} end of BasicMatMultKernels group
 */
@@ -48,8 +48,17 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Register blocking
+  The output is computed in blocks of PLP_MATMUL_BLOCK_M x PLP_MATMUL_BLOCK_O elements (2x2 by
+  default, see plp_math_common.h). For each step in N, one value per row and one value per
+  column of the block are loaded and reused for all multiply-accumulates of the block. Rows and
+  columns which do not fill a block are computed by one-row and one-column micro-kernels.
  */
 
+#define BLK_M PLP_MATMUL_I32_BLOCK_M
+#define BLK_O PLP_MATMUL_I32_BLOCK_O
+
 // define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 
 #ifdef BASIC_VERSION
@@ -85,77 +94,106 @@ void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
                                uint32_t O,
                                int32_t *__restrict__ pDstC) {
 
-    uint32_t i = 0; // loop counter for M
-    uint32_t j = 0; // loop counter for N
-    uint32_t k = 0; // loop counter for O
+    uint32_t m, n, o, i, j;
 
-    for (i = 0; i < M / 2; i++) {
-        for (k = 0; k < O / 2; k++) {
+    uint32_t M_blk = M - M % BLK_M;
+    uint32_t O_blk = O - O % BLK_O;
 
-            int32_t sum00 = 0;
-            int32_t sum01 = 0;
-            int32_t sum10 = 0;
-            int32_t sum11 = 0;
+    for (m = 0; m < M_blk; m += BLK_M) {
 
-            for (j = 0; j < N; j++) {
-                int32_t AVal0 = pSrcA[i * 2 * N + (j)];
-                int32_t AVal1 = pSrcA[i * 2 * N + N + (j)];
+        const int32_t *__restrict__ pA = pSrcA + m * N;
+
+        // BLK_M x BLK_O blocks
+        for (o = 0; o < O_blk; o += BLK_O) {
 
-                int32_t BVal0 = pSrcB[j * O + (k * 2)];
-                int32_t BVal1 = pSrcB[j * O + (k * 2 + 1)];
+            int32_t sum[BLK_M][BLK_O] = { { 0 } };
+            const int32_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                int32_t a[BLK_M];
+                int32_t b[BLK_O];
+
+                for (i = 0; i < BLK_M; i++) {
+                    a[i] = pA[i * N + n];
+                }
+                for (j = 0; j < BLK_O; j++) {
+                    b[j] = pB[j];
+                }
+                pB += O;
 
-                sum00 = sum00 + AVal0 * BVal0;
-                sum01 = sum01 + AVal0 * BVal1;
-                sum10 = sum10 + AVal1 * BVal0;
-                sum11 = sum11 + AVal1 * BVal1;
+                for (i = 0; i < BLK_M; i++) {
+                    for (j = 0; j < BLK_O; j++) {
+                        sum[i][j] += a[i] * b[j];
+                    }
+                }
             }
 
-            pDstC[(i * 2) * O + k * 2] = sum00;
-            pDstC[(i * 2) * O + k * 2 + 1] = sum01;
-            pDstC[(i * 2 + 1) * O + k * 2] = sum10;
-            pDstC[(i * 2 + 1) * O + k * 2 + 1] = sum11;
+            for (i = 0; i < BLK_M; i++) {
+                for (j = 0; j < BLK_O; j++) {
+                    pDstC[(m + i) * O + o + j] = sum[i][j];
+                }
+            }
         }
-    }
 
-    // clean up code
-    i = i * 2;
-    k = k * 2;
-    // check if every index is nicely finished
-    if (i == M && j == N && k == O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t kEnd = k;
-
-        // clean up for k
-        if (kEnd != O) {
-            for (i = 0; i < iEnd; i++) {
-                for (k = kEnd; k < O; k++) {
-                    int32_t sum = 0;
-                    for (j = 0; j < N; j++) {
-                        sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                    }
-                    pDstC[i * O + k] = sum;
+        // column tail: BLK_M x 1 blocks
+        for (o = O_blk; o < O; o++) {
+
+            int32_t sum[BLK_M] = { 0 };
+            const int32_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                int32_t b = *pB;
+                pB += O;
+                for (i = 0; i < BLK_M; i++) {
+                    sum[i] += pA[i * N + n] * b;
                 }
             }
+
+            for (i = 0; i < BLK_M; i++) {
+                pDstC[(m + i) * O + o] = sum[i];
+            }
         }
+    }
+
+    // row tail: 1 x BLK_O blocks and the remaining corner
+    for (m = M_blk; m < M; m++) {
+
+        const int32_t *__restrict__ pA = pSrcA + m * N;
+
+        for (o = 0; o < O_blk; o += BLK_O) {
+
+            int32_t sum[BLK_O] = { 0 };
+            const int32_t *__restrict__ pB = pSrcB + o;
 
-        // clean up for i
-        for (i = iEnd; i < M; i++) {
-            for (k = 0; k < O; k++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
+            for (n = 0; n < N; n++) {
+                int32_t a = pA[n];
+                for (j = 0; j < BLK_O; j++) {
+                    sum[j] += a * pB[j];
                 }
-                pDstC[i * O + k] = sum;
+                pB += O;
+            }
+
+            for (j = 0; j < BLK_O; j++) {
+                pDstC[m * O + o + j] = sum[j];
             }
         }
+
+        for (o = O_blk; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pA[n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
     }
 }
 
 #endif
 
 // undefine BASIC_VERSION
+#undef BLK_M
+#undef BLK_O
+
 /**
    @} end of BasicMatMultKernels group
 */
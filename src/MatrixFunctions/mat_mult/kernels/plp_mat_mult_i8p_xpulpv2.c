@@ -48,6 +48,11 @@
    @par Exploiting SIMD instructions
    The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
    performed on 32 bit vectors, with 32 bit accumulator.
+
+   @par Work distribution
+   Each core computes one tile of the output matrix, determined by plp_mat_partition or taken
+   from the plan of plp_mat_mult_plan_create. Depending on the shape, the output is split by
+   rows, by columns or in a 2D grid.
 */
 
 // define BASIC_VERSION // if used don't forget to also use the undefine at end of file
@@ -69,8 +74,17 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
     uint32_t j; // loop counter
     uint32_t k; // loop counter
 
-    for (i = 0; i < M; i++) {
-        for (k = 0; k < O; k++) {
+    int core_id = plp_core_id();
+
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
+
+    for (i = tile.mStart; i < tile.mEnd; i++) {
+        for (k = tile.oStart; k < tile.oEnd; k++) {
             int32_t sum = 0;
             for (j = 0; j < N; j++) {
                 sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
@@ -79,7 +93,7 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 #else
@@ -104,10 +118,21 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
     uint32_t j = 0; // loop counter for N
     uint32_t k = 0; // loop counter for O
 
-    uint32_t core_id = rt_core_id();
+    uint32_t core_id = plp_core_id();
 
-    for (k = core_id; k < O / 4; k += nPE) {
-        for (i = 0; i < M / 2; i++) {
+    plp_mat_tile tile;
+    if (arguments->pTiles != NULL) {
+        tile = arguments->pTiles[core_id];
+    } else {
+        plp_mat_partition(M, O, nPE, core_id, &tile);
+    }
+
+    uint32_t iEnd = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x1);
+    uint32_t jEnd = N & ~0x3;
+    uint32_t kEnd = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x3);
+
+    for (i = tile.mStart; i < iEnd; i += 2) {
+        for (k = tile.oStart; k < kEnd; k += 4) {
 
             int32_t sum00 = 0;
             int32_t sum01 = 0;
@@ -118,17 +143,15 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
             int32_t sum12 = 0;
             int32_t sum13 = 0;
 
-            // v2s* Bpoint = (v2s*) &(pSrcB[k]);
-
-            for (j = 0; j < N / 4; j++) {
+            for (j = 0; j < jEnd; j += 4) {
 
-                v4s aVec0 = *((v4s *)&(pSrcA[(i * 2) * N + (j * 4)]));
-                v4s aVec1 = *((v4s *)&(pSrcA[(i * 2 + 1) * N + (j * 4)]));
+                v4s aVec0 = *((v4s *)&(pSrcA[i * N + j]));
+                v4s aVec1 = *((v4s *)&(pSrcA[(i + 1) * N + j]));
 
-                v4s temp0 = *((v4s *)&(pSrcB[(j * 4) * O + (k * 4)]));
-                v4s temp1 = *((v4s *)&(pSrcB[(j * 4 + 1) * O + (k * 4)]));
-                v4s temp2 = *((v4s *)&(pSrcB[(j * 4 + 2) * O + (k * 4)]));
-                v4s temp3 = *((v4s *)&(pSrcB[(j * 4 + 3) * O + (k * 4)]));
+                v4s temp0 = *((v4s *)&(pSrcB[j * O + k]));
+                v4s temp1 = *((v4s *)&(pSrcB[(j + 1) * O + k]));
+                v4s temp2 = *((v4s *)&(pSrcB[(j + 2) * O + k]));
+                v4s temp3 = *((v4s *)&(pSrcB[(j + 3) * O + k]));
 
                 v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
                 v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
@@ -150,72 +173,59 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
                 sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
             }
 
-            pDstC[(i * 2) * O + (k * 4)] = sum00;
-            pDstC[(i * 2) * O + (k * 4 + 1)] = sum01;
-            pDstC[(i * 2) * O + (k * 4 + 2)] = sum02;
-            pDstC[(i * 2) * O + (k * 4 + 3)] = sum03;
-            pDstC[(i * 2 + 1) * O + (k * 4)] = sum10;
-            pDstC[(i * 2 + 1) * O + (k * 4 + 1)] = sum11;
-            pDstC[(i * 2 + 1) * O + (k * 4 + 2)] = sum12;
-            pDstC[(i * 2 + 1) * O + (k * 4 + 3)] = sum13;
-        }
-    }
-
-    // clean up code
-    i = i * 2;
-    j = j * 4;
-    k = k * 4;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (k = core_id * 4; k < kEnd; k += nPE * 4) {
-                for (int step = 0; step < 4; step++) {
-                    for (i = 0; i < iEnd; i++) {
-                        int32_t sum = 0;
-                        for (j = jEnd; j < N; j++) {
-                            sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] += sum;
-                    }
-                }
+            // clean up for j
+            for (; j < N; j++) {
+                int32_t AVal0 = pSrcA[i * N + j];
+                int32_t AVal1 = pSrcA[(i + 1) * N + j];
+                int32_t BVal0 = pSrcB[j * O + k];
+                int32_t BVal1 = pSrcB[j * O + k + 1];
+                int32_t BVal2 = pSrcB[j * O + k + 2];
+                int32_t BVal3 = pSrcB[j * O + k + 3];
+
+                sum00 += AVal0 * BVal0;
+                sum01 += AVal0 * BVal1;
+                sum02 += AVal0 * BVal2;
+                sum03 += AVal0 * BVal3;
+                sum10 += AVal1 * BVal0;
+                sum11 += AVal1 * BVal1;
+                sum12 += AVal1 * BVal2;
+                sum13 += AVal1 * BVal3;
             }
+
+            pDstC[i * O + k] = sum00;
+            pDstC[i * O + k + 1] = sum01;
+            pDstC[i * O + k + 2] = sum02;
+            pDstC[i * O + k + 3] = sum03;
+            pDstC[(i + 1) * O + k] = sum10;
+            pDstC[(i + 1) * O + k + 1] = sum11;
+            pDstC[(i + 1) * O + k + 2] = sum12;
+            pDstC[(i + 1) * O + k + 3] = sum13;
         }
+    }
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id * 4; k < kEnd; k += nPE * 4) {
-                for (int step = 0; step < 4; step++) {
-                    for (i = iEnd; i < M; i++) {
-                        int32_t sum = 0;
-                        for (j = 0; j < N; j++) {
-                            sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] = sum;
-                    }
-                }
+    // clean up for k
+    for (k = kEnd; k < tile.oEnd; k++) {
+        for (i = tile.mStart; i < iEnd; i++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
+    }
 
-        // clean up for k
-        for (k = kEnd; k < O; k++) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                }
-                pDstC[i * O + k] = sum;
+    // clean up for i
+    for (i = iEnd; i < tile.mEnd; i++) {
+        for (k = tile.oStart; k < tile.oEnd; k++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 #endif
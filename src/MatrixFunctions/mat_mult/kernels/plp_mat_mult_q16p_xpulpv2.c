@@ -57,7 +57,7 @@
 
 void plp_mat_mult_q16p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_mult_instance_q16 *a = (plp_mat_mult_instance_q16 *)args;
 
@@ -77,8 +77,11 @@ void plp_mat_mult_q16p_xpulpv2(void *args) {
     uint32_t n; // loop counter
     uint32_t o; // loop counter
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 int32_t valA = (int32_t)pSrcA[m * N + n];
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_execute.c
+ * Description:  Runs a planned matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultPlan
+  @{
+ */
+
+/**
+  @brief      Runs a matrix multiplication planned with plp_mat_mult_plan_create. On the fabric
+              controller, the serial glue code (e.g. plp_mat_mult_i8) is called instead.
+  @param[in]  pPlan  points to the plan
+  @param[in]  pSrcA  points to the first input matrix, of the type of the plan
+  @param[in]  pSrcB  points to the second input matrix, of the type of the plan
+  @param[out] pDstC  Output is written here, int32_t for the integer types
+  @return     none
+ */
+
+void plp_mat_mult_execute(const plp_mat_mult_plan *pPlan,
+                          const void *__restrict__ pSrcA,
+                          const void *__restrict__ pSrcB,
+                          void *__restrict__ pDstC) {
+
+    uint32_t M = pPlan->M;
+    uint32_t N = pPlan->N;
+    uint32_t O = pPlan->O;
+    uint32_t nPE = pPlan->nPE;
+
+    if (rt_cluster_id() == ARCHI_FC_CID || pPlan->kernel == NULL) {
+        switch (pPlan->type) {
+        case PLP_MAT_I8:
+            plp_mat_mult_i8(pSrcA, pSrcB, M, N, O, pDstC);
+            break;
+        case PLP_MAT_I16:
+            plp_mat_mult_i16(pSrcA, pSrcB, M, N, O, pDstC);
+            break;
+        case PLP_MAT_I32:
+            plp_mat_mult_i32(pSrcA, pSrcB, M, N, O, pDstC);
+            break;
+        case PLP_MAT_F32:
+            plp_mat_mult_f32(pSrcA, pSrcB, M, N, O, pDstC);
+            break;
+        }
+        return;
+    }
+
+    switch (pPlan->type) {
+    case PLP_MAT_I8: {
+        plp_mat_mult_instance_i8 args = {
+            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC,
+            .pTiles = pPlan->tiles
+        };
+        rt_team_fork(nPE, pPlan->kernel, (void *)&args);
+        break;
+    }
+    case PLP_MAT_I16: {
+        plp_mat_mult_instance_i16 args = {
+            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC,
+            .pTiles = pPlan->tiles
+        };
+        rt_team_fork(nPE, pPlan->kernel, (void *)&args);
+        break;
+    }
+    case PLP_MAT_I32: {
+        plp_mat_mult_instance_i32 args = {
+            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC,
+            .pTiles = pPlan->tiles
+        };
+        rt_team_fork(nPE, pPlan->kernel, (void *)&args);
+        break;
+    }
+    case PLP_MAT_F32: {
+        plp_mat_mult_instance_f32 args = {
+            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC,
+            .pTiles = pPlan->tiles
+        };
+        rt_team_fork(nPE, pPlan->kernel, (void *)&args);
+        break;
+    }
+    }
+}
+
+/**
+  @} end of MatMultPlan group
+ */
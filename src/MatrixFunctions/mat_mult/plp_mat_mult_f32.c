@@ -58,8 +58,12 @@ void plp_mat_mult_f32(const float *__restrict__ pSrcA,
                       float *__restrict__ pDstC) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
+#if defined(PLP_FC_FIXED_POINT)
+        plp_mat_mult_f32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
+#else
         printf("Floating point is supported only for cluster side\n");
         return;
+#endif
     } else {
         plp_mat_mult_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
     }
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_f32_async.c
+ * Description:  32-bit floating-point matrix multiplication offloaded to the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/* runs on the master core of the cluster */
+static void plp_mat_mult_f32_async_entry(void *args) {
+
+    plp_mat_mult_instance_f32 *S = (plp_mat_mult_instance_f32 *)args;
+
+    plp_mat_mult_f32_parallel(S->pSrcA, S->pSrcB, S->M, S->N, S->O, S->nPE, S->pDstC);
+}
+
+/**
+  @brief Starts the parallel matrix multiplication of 32-bit floating-point matrices on the
+         cluster, and returns without waiting for it.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and height of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix, valid after plp_async_wait
+  @param[out] handle    handle of the call, wait for it with plp_async_wait
+  @return     none
+ */
+
+void plp_mat_mult_f32_async(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t nPE,
+                            float *__restrict__ pDstC,
+                            plp_async_handle *handle) {
+
+    /* the arguments are kept in the handle until the cluster has read them */
+    plp_mat_mult_instance_f32 *S = (plp_mat_mult_instance_f32 *)handle->args;
+
+    S->pSrcA = pSrcA;
+    S->pSrcB = pSrcB;
+    S->M = M;
+    S->N = N;
+    S->O = O;
+    S->nPE = nPE;
+    S->pDstC = pDstC;
+
+    plp_async_call(plp_mat_mult_f32_async_entry, (void *)S, handle);
+}
+
+/**
+  @} end of BasicMatMult group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Glue code for the 8-bit by 16-bit integer matrix product
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of an 8-bit with a 16-bit integer matrix, e.g. of
+         8-bit weights with 16-bit activations.
+  @param[in]  pSrcA     points to the first input matrix [8 bit]
+  @param[in]  pSrcB     points to the second input matrix [16 bit]
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix [32 bit]
+  @return     none
+
+  @par Exploiting SIMD instructions
+  On the cluster, the values of A are sign-extended to 16 bit in registers, such that the matrix is
+  never stored widened, and multiplied with the 16-bit dot product instructions. The kernels are
+  the ones of plp_mat_mult_stride_i8xi16, with the strides of contiguous matrices.
+ */
+
+void plp_mat_mult_i8xi16(const int8_t *__restrict__ pSrcA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t M,
+                         uint32_t N,
+                         uint32_t O,
+                         int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_stride_i8xi16s_rv32im(pSrcA, pSrcB, M, N, O, N, O, O, pDstC);
+    } else {
+        plp_mat_mult_stride_i8xi16s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pDstC);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
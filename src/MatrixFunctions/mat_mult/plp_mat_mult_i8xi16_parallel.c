@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Glue code for the parallel 8-bit by 16-bit integer matrix product
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiplication of an 8-bit with a 16-bit integer matrix.
+  @param[in]  pSrcA     points to the first input matrix [8 bit]
+  @param[in]  pSrcB     points to the second input matrix [16 bit]
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix [32 bit]
+  @return     none
+ */
+
+void plp_mat_mult_i8xi16_parallel(const int8_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_mult_i8xi16_parallel), M * N * O);
+        }
+
+        plp_mat_mult_stride_instance_i8xi16 args = { .pSrcA = pSrcA,
+                                                     .pSrcB = pSrcB,
+                                                     .M = M,
+                                                     .N = N,
+                                                     .O = O,
+                                                     .strideA = N,
+                                                     .strideB = O,
+                                                     .strideC = O,
+                                                     .nPE = nPE,
+                                                     .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_mult_stride_i8xi16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_plan_create.c
+ * Description:  Plan of a matrix multiplication of fixed shape
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultPlan Planned Matrix Multiplication
+  A matrix multiplication of a fixed shape, e.g. a layer called in every frame, can be planned once
+  with plp_mat_mult_plan_create and then run with plp_mat_mult_execute. The plan keeps what
+  plp_mat_mult_<type>_parallel chooses in every call:
+  - the number of cores, PLP_AUTO is resolved with the cost table of plp_auto_npe,
+  - the kernel, the serial kernel of the cluster if a single core is used, without forking a team,
+  - the tile of the output matrix of every core (plp_mat_partition), which the parallel kernels
+    read from the plan instead of computing it.
+
+  The matrix multiplications do not need scratch memory, so the plan has no buffers. It is a plain
+  structure, which can be placed in any memory and used by any number of executions.
+ */
+
+/**
+  @addtogroup MatMultPlan
+  @{
+ */
+
+/**
+  @brief      Creates the plan of a matrix multiplication of fixed shape.
+  @param[in]  M      Height of first matrix
+  @param[in]  N      Width of first and height of second matrix
+  @param[in]  O      Width of second matrix
+  @param[in]  nPE    Number of cores to use, or PLP_AUTO
+  @param[in]  type   Element type of the matrices
+  @param[out] pPlan  The plan is written here
+  @return     none
+ */
+
+void plp_mat_mult_plan_create(
+    uint32_t M, uint32_t N, uint32_t O, uint32_t nPE, plp_mat_type type, plp_mat_mult_plan *pPlan) {
+
+    static const plp_auto_id autoIds[] = { PLP_AUTO_ID(plp_mat_mult_i8_parallel),
+                                           PLP_AUTO_ID(plp_mat_mult_i16_parallel),
+                                           PLP_AUTO_ID(plp_mat_mult_i32_parallel),
+                                           PLP_AUTO_ID(plp_mat_mult_f32_parallel) };
+    static void (*const kernels[])(void *) = { plp_mat_mult_i8p_xpulpv2,
+                                               plp_mat_mult_i16p_xpulpv2,
+                                               plp_mat_mult_i32p_xpulpv2,
+                                               plp_mat_mult_f32p_xpulpv2 };
+    uint32_t i;
+
+    if (nPE == PLP_AUTO) {
+        nPE = plp_auto_npe(autoIds[type], M * N * O);
+    }
+    // the plan has one tile per core of the cluster
+    if (nPE > PLP_MAX_PE) {
+        nPE = PLP_MAX_PE;
+    }
+
+    pPlan->type = type;
+    pPlan->M = M;
+    pPlan->N = N;
+    pPlan->O = O;
+    pPlan->nPE = nPE;
+    pPlan->kernel = (nPE > 1) ? kernels[type] : NULL;
+
+    for (i = 0; i < PLP_MAX_PE; i++) {
+        plp_mat_partition(M, O, nPE, i, &pPlan->tiles[i]);
+    }
+}
+
+/**
+  @} end of MatMultPlan group
+ */
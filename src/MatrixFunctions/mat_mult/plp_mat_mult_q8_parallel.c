@@ -74,6 +74,10 @@ void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_mult_q8_parallel), M * N * O);
+        }
+
         plp_mat_mult_instance_q8 args = { .pSrcA = pSrcA,
                                           .pSrcB = pSrcB,
                                           .M = M,
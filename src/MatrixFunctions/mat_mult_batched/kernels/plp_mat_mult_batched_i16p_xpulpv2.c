@@ -0,0 +1,160 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_batched_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer batched matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBatched
+ */
+
+/**
+  @addtogroup MatMultBatchedKernels
+  @{
+ */
+
+/**
+  @brief Multiply a single small matrix. When inlined with constant dimensions, the compiler
+         unrolls all loops.
+ */
+
+static inline void __attribute__((always_inline))
+plp_mat_mult_batched_i16_block(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               const uint32_t M,
+                               const uint32_t N,
+                               const uint32_t O,
+                               int32_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+  @brief Multiply the matrices [bStart, bEnd) of the batch, all of constant size SxS.
+ */
+
+static inline void __attribute__((always_inline))
+plp_mat_mult_batched_i16_loop(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              const uint32_t S,
+                              uint32_t bStart,
+                              uint32_t bEnd,
+                              uint32_t strideA,
+                              uint32_t strideB,
+                              uint32_t strideC,
+                              int32_t *__restrict__ pDstC) {
+
+    uint32_t b; // loop counter for the batch
+
+    for (b = bStart; b < bEnd; b++) {
+        plp_mat_mult_batched_i16_block(
+            &pSrcA[b * strideA], &pSrcB[b * strideB], S, S, S, &pDstC[b * strideC]);
+    }
+}
+
+/**
+  @brief Parallel batched matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_mult_batched_instance_i16 struct initialized by
+                    plp_mat_mult_batched_i16
+  @return     none
+
+  @par Work distribution
+  The batch is split into nPE contiguous chunks of whole matrices, and each core multiplies the
+  matrices of its chunk. Square matrices of size 2, 3, 4 or 8 are computed with a specialized path
+  with constant dimensions, all other shapes with plp_mat_mult_i16s_xpulpv2.
+ */
+
+void plp_mat_mult_batched_i16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_batched_instance_i16 *a = (plp_mat_mult_batched_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t batchCount = a->batchCount;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t bStart = (core_id * batchCount) / nPE;
+    uint32_t bEnd = ((core_id + 1) * batchCount) / nPE;
+
+    uint32_t b; // loop counter for the batch
+
+    uint32_t size = (M == N && N == O) ? M : 0;
+
+    switch (size) {
+    case 2:
+        plp_mat_mult_batched_i16_loop(
+            pSrcA, pSrcB, 2, bStart, bEnd, strideA, strideB, strideC, pDstC);
+        break;
+    case 3:
+        plp_mat_mult_batched_i16_loop(
+            pSrcA, pSrcB, 3, bStart, bEnd, strideA, strideB, strideC, pDstC);
+        break;
+    case 4:
+        plp_mat_mult_batched_i16_loop(
+            pSrcA, pSrcB, 4, bStart, bEnd, strideA, strideB, strideC, pDstC);
+        break;
+    case 8:
+        plp_mat_mult_batched_i16_loop(
+            pSrcA, pSrcB, 8, bStart, bEnd, strideA, strideB, strideC, pDstC);
+        break;
+    default:
+        for (b = bStart; b < bEnd; b++) {
+            plp_mat_mult_i16s_xpulpv2(&pSrcA[b * strideA],
+                                      &pSrcB[b * strideB],
+                                      M,
+                                      N,
+                                      O,
+                                      &pDstC[b * strideC]);
+        }
+        break;
+    }
+}
+
+/**
+   @} end of MatMultBatchedKernels group
+*/
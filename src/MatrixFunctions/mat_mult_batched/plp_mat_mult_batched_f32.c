@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_batched_f32.c
+ * Description:  32-bit floating-point batched matrix multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultBatched Batched Matrix Matrix Multiplication
+  This module contains the glue code for multiplying a batch of independent, small matrices. The
+  kernel codes (kernels) are in the Module Batched Matrix Multiplication Kernels.
+
+  For every b in [0, batchCount), the function computes
+
+      `pDstC[b * strideC] = pSrcA[b * strideA] * pSrcB[b * strideB]`
+
+  where each product is a regular matrix multiplication of A (MxN) and B (NxO). The strides are
+  given in number of elements, between the first element of two consecutive matrices. Setting
+  strideB to 0 multiplies all matrices of A with the same matrix B.
+
+  Instead of distributing the computation of each single matrix onto the cores, the parallel
+  kernel assigns whole matrices to each core, such that the entire batch is processed with a
+  single rt_team_fork. This avoids paying the cost of the fork for every small matrix.
+
+  Square matrices of size 2x2, 3x3, 4x4 and 8x8 are computed with a specialized path, where the
+  dimensions are known at compile time and the loops are unrolled by the compiler. All other shapes
+  use the single-core matrix multiplication kernels (@ref BasicMatMultKernels).
+ */
+
+/**
+  @addtogroup MatMultBatched
+  @{
+ */
+
+/**
+  @brief Glue code for batched matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA      points to the first matrix of the first input batch
+  @param[in]  pSrcB      points to the first matrix of the second input batch
+  @param[in]  M          height of each matrix of A
+  @param[in]  N          width of each matrix of A and height of each matrix of B
+  @param[in]  O          width of each matrix of B
+  @param[in]  batchCount number of matrix multiplications
+  @param[in]  strideA    number of elements between two consecutive matrices of A
+  @param[in]  strideB    number of elements between two consecutive matrices of B (may be 0)
+  @param[in]  strideC    number of elements between two consecutive matrices of C
+  @param[in]  nPE        Number of cores to use
+  @param[out] pDstC      points to the first matrix of the output batch
+  @return     none
+ */
+
+void plp_mat_mult_batched_f32(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t batchCount,
+                              uint32_t strideA,
+                              uint32_t strideB,
+                              uint32_t strideC,
+                              uint32_t nPE,
+                              float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_batched_instance_f32 args = { .pSrcA = pSrcA,
+                                                   .pSrcB = pSrcB,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .O = O,
+                                                   .batchCount = batchCount,
+                                                   .strideA = strideA,
+                                                   .strideB = strideB,
+                                                   .strideC = strideC,
+                                                   .nPE = nPE,
+                                                   .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_mat_mult_batched_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultBatched group
+ */
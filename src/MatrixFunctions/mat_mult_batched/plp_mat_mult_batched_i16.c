@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_batched_i16.c
+ * Description:  16-bit integer batched matrix multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultBatched
+  @{
+ */
+
+/**
+  @brief Glue code for batched matrix multiplication of 16-bit integer matrices.
+  @param[in]  pSrcA      points to the first matrix of the first input batch
+  @param[in]  pSrcB      points to the first matrix of the second input batch
+  @param[in]  M          height of each matrix of A
+  @param[in]  N          width of each matrix of A and height of each matrix of B
+  @param[in]  O          width of each matrix of B
+  @param[in]  batchCount number of matrix multiplications
+  @param[in]  strideA    number of elements between two consecutive matrices of A
+  @param[in]  strideB    number of elements between two consecutive matrices of B (may be 0)
+  @param[in]  strideC    number of elements between two consecutive matrices of C
+  @param[in]  nPE        Number of cores to use
+  @param[out] pDstC      points to the first matrix of the output batch
+  @return     none
+
+  @par On the fabric controller, the matrices are processed one after the other, using the RV32IM
+  kernels.
+ */
+
+void plp_mat_mult_batched_i16(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t batchCount,
+                              uint32_t strideA,
+                              uint32_t strideB,
+                              uint32_t strideC,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        uint32_t b; // loop counter for the batch
+        for (b = 0; b < batchCount; b++) {
+            plp_mat_mult_i16s_rv32im(&pSrcA[b * strideA],
+                                     &pSrcB[b * strideB],
+                                     M,
+                                     N,
+                                     O,
+                                     &pDstC[b * strideC]);
+        }
+    } else {
+        plp_mat_mult_batched_instance_i16 args = { .pSrcA = pSrcA,
+                                                   .pSrcB = pSrcB,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .O = O,
+                                                   .batchCount = batchCount,
+                                                   .strideA = strideA,
+                                                   .strideB = strideB,
+                                                   .strideC = strideC,
+                                                   .nPE = nPE,
+                                                   .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_mat_mult_batched_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultBatched group
+ */
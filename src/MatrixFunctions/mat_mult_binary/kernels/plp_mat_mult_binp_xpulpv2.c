@@ -0,0 +1,163 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_binp_xpulpv2.c
+ * Description:  parallel binary matrix multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBinary
+ */
+
+/**
+  @addtogroup MatMultBinaryKernels
+  @{
+ */
+
+/* dot product of a row of A and a column of B */
+static inline int32_t plp_mat_mult_bin_dot_xpulpv2(const uint32_t *pA,
+                                                   const uint32_t *pB,
+                                                   uint32_t N) {
+    uint32_t nWords = N >> 5;
+    uint32_t tail = N & 0x1FU;
+    uint32_t n;
+    uint32_t sum = 0;
+
+    for (n = 0; n < nWords; n++) {
+        sum += __builtin_popcount(~(pA[n] ^ pB[n]));
+    }
+
+    if (tail > 0) {
+        sum += __builtin_popcount(~(pA[nWords] ^ pB[nWords]) & ((1U << tail) - 1));
+    }
+
+    return 2 * (int32_t)sum - (int32_t)N;
+}
+
+/**
+  @brief Parallel matrix multiplication of binary matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_instance_bin struct initialized by
+                    plp_mat_mult_bin_parallel
+  @return     none
+
+  @par Exploiting bit operations
+  The values are multiplied 32 at a time with an XNOR and the p.cnt instruction. The output is
+  computed in blocks of 2x2 elements, such that each loaded word is used twice.
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition.
+ */
+
+void plp_mat_mult_binp_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_instance_bin *a = (plp_mat_mult_instance_bin *)args;
+
+    const uint32_t *__restrict__ pSrcA = a->pSrcA;
+    const uint32_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    uint32_t rowWords = (N + 31U) >> 5; // words of a row of A or a column of B
+    uint32_t nWords = N >> 5;           // complete words of a row
+    uint32_t tail = N & 0x1FU;          // values in the last, incomplete word
+    uint32_t mask = (1U << tail) - 1;   // valid bits of the last word
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for the words of a row
+    uint32_t o; // loop counter for O
+
+    for (m = tile.mStart; m + 2 <= tile.mEnd; m += 2) {
+        const uint32_t *pA0 = &pSrcA[m * rowWords];
+        const uint32_t *pA1 = pA0 + rowWords;
+
+        for (o = tile.oStart; o + 2 <= tile.oEnd; o += 2) {
+            const uint32_t *pB0 = &pSrcB[o * rowWords];
+            const uint32_t *pB1 = pB0 + rowWords;
+
+            uint32_t sum00 = 0;
+            uint32_t sum01 = 0;
+            uint32_t sum10 = 0;
+            uint32_t sum11 = 0;
+
+            for (n = 0; n < nWords; n++) {
+                uint32_t a0 = pA0[n];
+                uint32_t a1 = pA1[n];
+                uint32_t b0 = pB0[n];
+                uint32_t b1 = pB1[n];
+
+                sum00 += __builtin_popcount(~(a0 ^ b0));
+                sum01 += __builtin_popcount(~(a0 ^ b1));
+                sum10 += __builtin_popcount(~(a1 ^ b0));
+                sum11 += __builtin_popcount(~(a1 ^ b1));
+            }
+
+            if (tail > 0) {
+                uint32_t a0 = pA0[nWords];
+                uint32_t a1 = pA1[nWords];
+                uint32_t b0 = pB0[nWords];
+                uint32_t b1 = pB1[nWords];
+
+                sum00 += __builtin_popcount(~(a0 ^ b0) & mask);
+                sum01 += __builtin_popcount(~(a0 ^ b1) & mask);
+                sum10 += __builtin_popcount(~(a1 ^ b0) & mask);
+                sum11 += __builtin_popcount(~(a1 ^ b1) & mask);
+            }
+
+            pDstC[m * O + o] = 2 * (int32_t)sum00 - (int32_t)N;
+            pDstC[m * O + o + 1] = 2 * (int32_t)sum01 - (int32_t)N;
+            pDstC[(m + 1) * O + o] = 2 * (int32_t)sum10 - (int32_t)N;
+            pDstC[(m + 1) * O + o + 1] = 2 * (int32_t)sum11 - (int32_t)N;
+        }
+
+        // clean up for o
+        if (o < tile.oEnd) {
+            const uint32_t *pB0 = &pSrcB[o * rowWords];
+            pDstC[m * O + o] = plp_mat_mult_bin_dot_xpulpv2(pA0, pB0, N);
+            pDstC[(m + 1) * O + o] = plp_mat_mult_bin_dot_xpulpv2(pA1, pB0, N);
+        }
+    }
+
+    // clean up for m
+    if (m < tile.mEnd) {
+        const uint32_t *pA0 = &pSrcA[m * rowWords];
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            const uint32_t *pB0 = &pSrcB[o * rowWords];
+            pDstC[m * O + o] = plp_mat_mult_bin_dot_xpulpv2(pA0, pB0, N);
+        }
+    }
+}
+
+/**
+  @} end of MatMultBinaryKernels group
+ */
@@ -0,0 +1,198 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_terp_xpulpv2.c
+ * Description:  parallel ternary matrix multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBinary
+ */
+
+/**
+  @addtogroup MatMultBinaryKernels
+  @{
+ */
+
+/* dot product of a row of A and a column of B */
+static inline int32_t plp_mat_mult_ter_dot_xpulpv2(const uint32_t *pA,
+                                                   const uint32_t *pB,
+                                                   uint32_t N) {
+    uint32_t nWords = N >> 5;
+    uint32_t tail = N & 0x1FU;
+    uint32_t n;
+    uint32_t m;
+    uint32_t sumNz = 0;
+    uint32_t sumPos = 0;
+
+    for (n = 0; n < nWords; n++) {
+        m = pA[2 * n] & pB[2 * n];
+        sumNz += __builtin_popcount(m);
+        sumPos += __builtin_popcount(m & ~(pA[2 * n + 1] ^ pB[2 * n + 1]));
+    }
+
+    if (tail > 0) {
+        m = pA[2 * nWords] & pB[2 * nWords] & ((1U << tail) - 1);
+        sumNz += __builtin_popcount(m);
+        sumPos += __builtin_popcount(m & ~(pA[2 * nWords + 1] ^ pB[2 * nWords + 1]));
+    }
+
+    return 2 * (int32_t)sumPos - (int32_t)sumNz;
+}
+
+/**
+  @brief Parallel matrix multiplication of ternary matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_instance_ter struct initialized by
+                    plp_mat_mult_ter_parallel
+  @return     none
+
+  @par Exploiting bit operations
+  The values are multiplied 32 at a time with an XNOR and the p.cnt instruction. The output is
+  computed in blocks of 2x2 elements, such that each loaded word is used twice.
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition.
+ */
+
+void plp_mat_mult_terp_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_instance_ter *a = (plp_mat_mult_instance_ter *)args;
+
+    const uint32_t *__restrict__ pSrcA = a->pSrcA;
+    const uint32_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    uint32_t rowWords = ((N + 31U) >> 5) << 1; // words of a row of A or a column of B
+    uint32_t nWords = N >> 5;                  // complete words of a row
+    uint32_t tail = N & 0x1FU;                 // values in the last, incomplete word
+    uint32_t mask = (1U << tail) - 1;          // valid bits of the last word
+    uint32_t m0, m1;
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for the words of a row
+    uint32_t o; // loop counter for O
+
+    for (m = tile.mStart; m + 2 <= tile.mEnd; m += 2) {
+        const uint32_t *pA0 = &pSrcA[m * rowWords];
+        const uint32_t *pA1 = pA0 + rowWords;
+
+        for (o = tile.oStart; o + 2 <= tile.oEnd; o += 2) {
+            const uint32_t *pB0 = &pSrcB[o * rowWords];
+            const uint32_t *pB1 = pB0 + rowWords;
+
+            uint32_t sum00Nz = 0;
+            uint32_t sum00Pos = 0;
+            uint32_t sum01Nz = 0;
+            uint32_t sum01Pos = 0;
+            uint32_t sum10Nz = 0;
+            uint32_t sum10Pos = 0;
+            uint32_t sum11Nz = 0;
+            uint32_t sum11Pos = 0;
+
+            for (n = 0; n < nWords; n++) {
+                uint32_t nzA0 = pA0[2 * n];
+                uint32_t nzA1 = pA1[2 * n];
+                uint32_t sA0 = pA0[2 * n + 1];
+                uint32_t sA1 = pA1[2 * n + 1];
+                uint32_t nzB0 = pB0[2 * n];
+                uint32_t nzB1 = pB1[2 * n];
+                uint32_t sB0 = pB0[2 * n + 1];
+                uint32_t sB1 = pB1[2 * n + 1];
+
+                m0 = nzA0 & nzB0;
+                sum00Nz += __builtin_popcount(m0);
+                sum00Pos += __builtin_popcount(m0 & ~(sA0 ^ sB0));
+                m1 = nzA0 & nzB1;
+                sum01Nz += __builtin_popcount(m1);
+                sum01Pos += __builtin_popcount(m1 & ~(sA0 ^ sB1));
+                m0 = nzA1 & nzB0;
+                sum10Nz += __builtin_popcount(m0);
+                sum10Pos += __builtin_popcount(m0 & ~(sA1 ^ sB0));
+                m1 = nzA1 & nzB1;
+                sum11Nz += __builtin_popcount(m1);
+                sum11Pos += __builtin_popcount(m1 & ~(sA1 ^ sB1));
+            }
+
+            if (tail > 0) {
+                uint32_t nzA0 = pA0[2 * nWords] & mask;
+                uint32_t nzA1 = pA1[2 * nWords] & mask;
+                uint32_t sA0 = pA0[2 * nWords + 1];
+                uint32_t sA1 = pA1[2 * nWords + 1];
+                uint32_t nzB0 = pB0[2 * nWords];
+                uint32_t nzB1 = pB1[2 * nWords];
+                uint32_t sB0 = pB0[2 * nWords + 1];
+                uint32_t sB1 = pB1[2 * nWords + 1];
+
+                m0 = nzA0 & nzB0;
+                sum00Nz += __builtin_popcount(m0);
+                sum00Pos += __builtin_popcount(m0 & ~(sA0 ^ sB0));
+                m1 = nzA0 & nzB1;
+                sum01Nz += __builtin_popcount(m1);
+                sum01Pos += __builtin_popcount(m1 & ~(sA0 ^ sB1));
+                m0 = nzA1 & nzB0;
+                sum10Nz += __builtin_popcount(m0);
+                sum10Pos += __builtin_popcount(m0 & ~(sA1 ^ sB0));
+                m1 = nzA1 & nzB1;
+                sum11Nz += __builtin_popcount(m1);
+                sum11Pos += __builtin_popcount(m1 & ~(sA1 ^ sB1));
+            }
+
+            pDstC[m * O + o] = 2 * (int32_t)sum00Pos - (int32_t)sum00Nz;
+            pDstC[m * O + o + 1] = 2 * (int32_t)sum01Pos - (int32_t)sum01Nz;
+            pDstC[(m + 1) * O + o] = 2 * (int32_t)sum10Pos - (int32_t)sum10Nz;
+            pDstC[(m + 1) * O + o + 1] = 2 * (int32_t)sum11Pos - (int32_t)sum11Nz;
+        }
+
+        // clean up for o
+        if (o < tile.oEnd) {
+            const uint32_t *pB0 = &pSrcB[o * rowWords];
+            pDstC[m * O + o] = plp_mat_mult_ter_dot_xpulpv2(pA0, pB0, N);
+            pDstC[(m + 1) * O + o] = plp_mat_mult_ter_dot_xpulpv2(pA1, pB0, N);
+        }
+    }
+
+    // clean up for m
+    if (m < tile.mEnd) {
+        const uint32_t *pA0 = &pSrcA[m * rowWords];
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            const uint32_t *pB0 = &pSrcB[o * rowWords];
+            pDstC[m * O + o] = plp_mat_mult_ter_dot_xpulpv2(pA0, pB0, N);
+        }
+    }
+}
+
+/**
+  @} end of MatMultBinaryKernels group
+ */
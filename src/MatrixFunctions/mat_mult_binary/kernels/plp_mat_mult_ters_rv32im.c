@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_ters_rv32im.c
+ * Description:  ternary matrix multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBinary
+ */
+
+/**
+  @addtogroup MatMultBinaryKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of ternary matrices kernel for RV32IM extension.
+  @param[in]  pSrcA     points to the first input matrix, packed (MxN)
+  @param[in]  pSrcB     points to the second input matrix, transposed and packed (OxN)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par
+  The values are multiplied 32 at a time with an XNOR and a popcount, computed with
+  plp_popcount as RV32IM has no popcount instruction.
+ */
+
+void plp_mat_mult_ters_rv32im(const uint32_t *__restrict__ pSrcA,
+                              const uint32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC) {
+
+    uint32_t rowWords = ((N + 31U) >> 5) << 1; // words of a row of A or a column of B
+    uint32_t nWords = N >> 5;                  // complete words of a row
+    uint32_t tail = N & 0x1FU;                 // values in the last, incomplete word
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for the words of a row
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            const uint32_t *pA = &pSrcA[m * rowWords];
+            const uint32_t *pB = &pSrcB[o * rowWords];
+            uint32_t nz;
+            uint32_t sumNz = 0;
+            uint32_t sumPos = 0;
+
+            for (n = 0; n < nWords; n++) {
+                nz = pA[2 * n] & pB[2 * n];
+                sumNz += plp_popcount(nz);
+                sumPos += plp_popcount(nz & ~(pA[2 * n + 1] ^ pB[2 * n + 1]));
+            }
+
+            if (tail > 0) {
+                nz = pA[2 * nWords] & pB[2 * nWords] & ((1U << tail) - 1);
+                sumNz += plp_popcount(nz);
+                sumPos += plp_popcount(nz & ~(pA[2 * nWords + 1] ^ pB[2 * nWords + 1]));
+            }
+
+            pDstC[m * O + o] = 2 * (int32_t)sumPos - (int32_t)sumNz;
+        }
+    }
+}
+
+/**
+  @} end of MatMultBinaryKernels group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_bin.c
+ * Description:  binary matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultBinary Binary Matrix Multiplication
+  This module contains the glue code for Matrix Matrix Multiplication of binary (+1 or -1) and
+  ternary (-1, 0 or +1) matrices, e.g. of binarized neural networks. The kernel codes (kernels) are
+  in the Module Binary Matrix Multiplication Kernels.
+
+  The values are packed into bits like the vectors of plp_dot_prod_bin and plp_dot_prod_ter: a
+  binary row takes ceil(N / 32) words, a ternary row twice as many, for the two bitplanes. The
+  second matrix is stored transposed, like the packed matrix of plp_mat_mult_i8_packB, such that
+  both the rows of A and the columns of B are contiguous. The bits after the N-th value of a row
+  are ignored. The output is a 32-bit matrix of MxO, as of plp_mat_mult_i8.
+
+  Each output is computed with an XNOR and a popcount per 32 values of the row, the popcount is the
+  p.cnt instruction of XPULPV2 on the cluster.
+ */
+
+/**
+  @addtogroup MatMultBinary
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of binary matrices.
+  @param[in]  pSrcA     points to the first input matrix, packed (MxN)
+  @param[in]  pSrcB     points to the second input matrix, transposed and packed (OxN)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_bin(const uint32_t *__restrict__ pSrcA,
+                      const uint32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_bins_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
+    } else {
+        plp_mat_mult_bins_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultBinary group
+ */
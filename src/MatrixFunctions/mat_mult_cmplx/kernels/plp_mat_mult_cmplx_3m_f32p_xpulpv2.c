@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_cmplx_3m_f32p_xpulpv2.c
+ * Description:  Parallel 3M complex 32-bit float matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultCmplx
+ */
+
+/**
+  @addtogroup MatMultCmplxKernels
+  @{
+ */
+
+/**
+  @brief      parallel matrix matrix multiplication for complex 32-bit floats with the 3M algorithm
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_3m_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_3m_f32_parallel
+  @return     none
+
+  @par Work distribution
+  The sums b_re + b_im are split evenly among the cores, followed by a barrier. Then, every core
+  computes one tile of the output matrix, determined by plp_mat_partition, with its own buffer
+  for the row sums a_re + a_im.
+*/
+
+void plp_mat_mult_cmplx_3m_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_cmplx_3m_instance_f32 *a = (plp_mat_mult_cmplx_3m_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    float *pSumB = a->pTmp;                       // b_re + b_im of every element of B
+    float *pSumA = a->pTmp + N * O + core_id * N; // a_re + a_im of the current row of A
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    uint32_t chunk = (N * O + nPE - 1) / nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > N * O) {
+        end = N * O;
+    }
+
+    for (n = start; n < end; n++) {
+        pSumB[n] = pSrcB[2 * n] + pSrcB[2 * n + 1];
+    }
+
+    plp_team_barrier();
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        const float *pRowA = pSrcA + 2 * m * N;
+
+        for (n = 0; n < N; n++) {
+            pSumA[n] = pRowA[2 * n] + pRowA[2 * n + 1];
+        }
+
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            float sum1 = 0.0f; // sum of a_re * b_re
+            float sum2 = 0.0f; // sum of a_im * b_im
+            float sum3 = 0.0f; // sum of (a_re + a_im) * (b_re + b_im)
+
+            for (n = 0; n < N; n++) {
+                const float *pB = pSrcB + 2 * (n * O + o);
+                sum1 += pRowA[2 * n] * pB[0];
+                sum2 += pRowA[2 * n + 1] * pB[1];
+                sum3 += pSumA[n] * pSumB[n * O + o];
+            }
+            pDstC[2 * (m * O + o)] = sum1 - sum2;
+            pDstC[2 * (m * O + o) + 1] = sum3 - sum1 - sum2;
+        }
+    }
+}
+
+/**
+  @} end of MatMultCmplxKernels group
+ */
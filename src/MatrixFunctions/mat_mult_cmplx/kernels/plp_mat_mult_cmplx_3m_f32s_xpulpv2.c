@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_cmplx_3m_f32s_xpulpv2.c
+ * Description:  3M complex 32-bit float matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultCmplx
+ */
+
+/**
+  @addtogroup MatMultCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Matrix matrix multiplication for complex 32-bit floats with the 3M algorithm on
+         XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  pTmp  Points to a temporary buffer of N * O + N floats
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par 3M algorithm
+  Every complex product is computed with three real multiplications instead of four:
+
+      `c_re = a_re * b_re - a_im * b_im`
+      `c_im = (a_re + a_im) * (b_re + b_im) - a_re * b_re - a_im * b_im`
+
+  The three products are accumulated separately over N, and the sums b_re + b_im (of all of B) and
+  a_re + a_im (of one row of A) are computed once into the temporary buffer. This saves one MAC
+  per complex MAC, at the cost of two more loads, and is faster when the MAC throughput is the
+  bottleneck. The imaginary part is computed as a difference of larger sums, so it can lose a few
+  bits of accuracy compared to plp_mat_mult_cmplx_f32, when its magnitude is much smaller than the
+  one of the real part.
+ */
+
+void plp_mat_mult_cmplx_3m_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                        const float *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        float *__restrict__ pTmp,
+                                        float *__restrict__ pDstC) {
+
+    float *pSumB = pTmp;         // b_re + b_im of every element of B
+    float *pSumA = pTmp + N * O; // a_re + a_im of the current row of A
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (n = 0; n < N * O; n++) {
+        pSumB[n] = pSrcB[2 * n] + pSrcB[2 * n + 1];
+    }
+
+    for (m = 0; m < M; m++) {
+        const float *pRowA = pSrcA + 2 * m * N;
+
+        for (n = 0; n < N; n++) {
+            pSumA[n] = pRowA[2 * n] + pRowA[2 * n + 1];
+        }
+
+        for (o = 0; o < O; o++) {
+            float sum1 = 0.0f; // sum of a_re * b_re
+            float sum2 = 0.0f; // sum of a_im * b_im
+            float sum3 = 0.0f; // sum of (a_re + a_im) * (b_re + b_im)
+
+            for (n = 0; n < N; n++) {
+                const float *pB = pSrcB + 2 * (n * O + o);
+                sum1 += pRowA[2 * n] * pB[0];
+                sum2 += pRowA[2 * n + 1] * pB[1];
+                sum3 += pSumA[n] * pSumB[n * O + o];
+            }
+            pDstC[2 * (m * O + o)] = sum1 - sum2;
+            pDstC[2 * (m * O + o) + 1] = sum3 - sum1 - sum2;
+        }
+    }
+}
+
+/**
+  @} end of MatMultCmplxKernels group
+ */
@@ -48,6 +48,10 @@
   @param[in]  O     Width of matrix SrcB and DstC
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
+
+  @par
+  The matrices are multiplied by plp_mat_mult_cmplx_stride_i16s_xpulpv2, which computes blocks of
+  2x2 elements with packed complex arithmetic.
  */
 
 void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -57,32 +61,7 @@ void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                      uint32_t O,
                                      int32_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = 0; m < M; m++) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * N + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * N + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(n * O + o) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(n * O + o) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
-            }
-            pDstC[(m * O + o) * 2 + 0] = sum_re;
-            pDstC[(m * O + o) * 2 + 1] = sum_im;
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    plp_mat_mult_cmplx_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pDstC);
 }
 /**
    @} end of MatMultCmplxKernels group
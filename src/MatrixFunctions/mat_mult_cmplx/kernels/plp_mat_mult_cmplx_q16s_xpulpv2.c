@@ -58,6 +58,10 @@
   the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
   stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
   occurrs.
+
+  @par
+  The matrices are multiplied by plp_mat_mult_cmplx_stride_q16s_xpulpv2, which computes blocks of
+  2x2 elements with packed complex arithmetic.
  */
 
 void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -68,32 +72,7 @@ void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                      uint32_t shift,
                                      int16_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = 0; m < M; m++) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * N + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * N + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(n * O + o) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(n * O + o) * 2 + 1];
-                sum_re += __ROUNDNORM_REG(a_re * b_re - a_im * b_im, shift);
-                sum_im += __ROUNDNORM_REG(a_re * b_im + a_im * b_re, shift);
-            }
-            pDstC[(m * O + o) * 2 + 0] = (int16_t)sum_re;
-            pDstC[(m * O + o) * 2 + 1] = (int16_t)sum_im;
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    plp_mat_mult_cmplx_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, shift, pDstC);
 }
 /**
    @} end of MatMultCmplxKernels group
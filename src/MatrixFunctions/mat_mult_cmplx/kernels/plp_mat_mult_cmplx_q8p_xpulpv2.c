@@ -61,7 +61,7 @@
 
 void plp_mat_mult_cmplx_q8p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_mult_cmplx_instance_q8 *a = (plp_mat_mult_cmplx_instance_q8 *)args;
 
@@ -77,8 +77,11 @@ void plp_mat_mult_cmplx_q8p_xpulpv2(void *args) {
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    for (int m = tile.mStart; m < tile.mEnd; m++) {
+        for (int o = tile.oStart; o < tile.oEnd; o++) {
             int32_t sum_re = 0;
             int32_t sum_im = 0;
             for (int n = 0; n < N; n++) {
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_cmplx_3m_f32.c
+ * Description:  Glue code for the 3M complex 32-bit float matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultCmplx
+  @{
+ */
+
+/**
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats with the 3M
+              algorithm
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+
+  @par 3M algorithm
+  The result is the same as the one of plp_mat_mult_cmplx_f32, up to
+  rounding, but every complex product is computed with three real multiplications instead of four
+  (see plp_mat_mult_cmplx_3m_f32s_xpulpv2). The temporary buffer for the sums of B and of the rows
+  of A is allocated with plp_scratch_alloc.
+ */
+
+int plp_mat_mult_cmplx_3m_f32(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        uint32_t tmpSize = ((N * O + N) * sizeof(float));
+        float *pTmp = (float *)plp_scratch_alloc(RT_ALLOC_CL_DATA, tmpSize);
+
+        if (pTmp == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 1;
+        }
+
+        plp_mat_mult_cmplx_3m_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pTmp, pDstC);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pTmp, tmpSize);
+
+        return 0;
+    }
+}
+
+/**
+  @} end of MatMultCmplx group
+ */
@@ -0,0 +1,202 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_packed_i16s_xpulpv2.c
+ * Description:  16-bit integer packed matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultPacked
+ */
+
+/**
+  @addtogroup MatMultPackedKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 16-bit integer matrices with packed second matrix kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix, packed with plp_mat_mult_i16_packB
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Both the rows of A and the packed columns of B are loaded as vectors of 2 elements, and
+  multiplied with the dot product instructions, with 32 bit accumulator. The output is computed in
+  blocks of 2x4 elements, such that each loaded vector is used multiple times.
+ */
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+
+void plp_mat_mult_packed_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      int32_t *__restrict__ pDstC) {
+
+#ifdef BASIC_VERSION
+
+    uint32_t nPacked = (N + 1U) & ~1U; // length of each packed column of B
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum = sum + pSrcA[m * N + n] * pSrcB[o * nPacked + n];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+
+#else
+
+    uint32_t nPacked = (N + 1U) & ~1U; // length of each packed column of B
+    uint32_t nVec = N / 2;                     // number of complete SIMD vectors per row of A
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m + 2 <= M; m += 2) {
+        const int16_t *pA0 = &pSrcA[m * N];
+        const int16_t *pA1 = &pSrcA[(m + 1) * N];
+
+        for (o = 0; o + 4 <= O; o += 4) {
+            const int16_t *pB0 = &pSrcB[o * nPacked];
+            const int16_t *pB1 = &pSrcB[(o + 1) * nPacked];
+            const int16_t *pB2 = &pSrcB[(o + 2) * nPacked];
+            const int16_t *pB3 = &pSrcB[(o + 3) * nPacked];
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum12 = 0;
+            int32_t sum13 = 0;
+
+            for (n = 0; n < nVec; n++) {
+                v2s aVec0 = *((v2s *)&pA0[n * 2]);
+                v2s aVec1 = *((v2s *)&pA1[n * 2]);
+
+                v2s bVec0 = *((v2s *)&pB0[n * 2]);
+                v2s bVec1 = *((v2s *)&pB1[n * 2]);
+                v2s bVec2 = *((v2s *)&pB2[n * 2]);
+                v2s bVec3 = *((v2s *)&pB3[n * 2]);
+
+                sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+                sum02 = __SUMDOTP2(aVec0, bVec2, sum02);
+                sum03 = __SUMDOTP2(aVec0, bVec3, sum03);
+                sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+                sum12 = __SUMDOTP2(aVec1, bVec2, sum12);
+                sum13 = __SUMDOTP2(aVec1, bVec3, sum13);
+            }
+
+            // clean up for n
+            for (n = nVec * 2; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                sum00 += a0 * pB0[n];
+                sum01 += a0 * pB1[n];
+                sum02 += a0 * pB2[n];
+                sum03 += a0 * pB3[n];
+                sum10 += a1 * pB0[n];
+                sum11 += a1 * pB1[n];
+                sum12 += a1 * pB2[n];
+                sum13 += a1 * pB3[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[m * O + o + 1] = sum01;
+            pDstC[m * O + o + 2] = sum02;
+            pDstC[m * O + o + 3] = sum03;
+            pDstC[(m + 1) * O + o] = sum10;
+            pDstC[(m + 1) * O + o + 1] = sum11;
+            pDstC[(m + 1) * O + o + 2] = sum12;
+            pDstC[(m + 1) * O + o + 3] = sum13;
+        }
+
+        // clean up for o
+        for (; o < O; o++) {
+            const int16_t *pB0 = &pSrcB[o * nPacked];
+
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+
+            for (n = 0; n < nVec; n++) {
+                v2s bVec0 = *((v2s *)&pB0[n * 2]);
+                sum0 = __SUMDOTP2(*((v2s *)&pA0[n * 2]), bVec0, sum0);
+                sum1 = __SUMDOTP2(*((v2s *)&pA1[n * 2]), bVec0, sum1);
+            }
+            for (n = nVec * 2; n < N; n++) {
+                sum0 += pA0[n] * pB0[n];
+                sum1 += pA1[n] * pB0[n];
+            }
+
+            pDstC[m * O + o] = sum0;
+            pDstC[(m + 1) * O + o] = sum1;
+        }
+    }
+
+    // clean up for m
+    for (; m < M; m++) {
+        const int16_t *pA0 = &pSrcA[m * N];
+
+        for (o = 0; o < O; o++) {
+            const int16_t *pB0 = &pSrcB[o * nPacked];
+
+            int32_t sum = 0;
+
+            for (n = 0; n < nVec; n++) {
+                sum = __SUMDOTP2(*((v2s *)&pA0[n * 2]), *((v2s *)&pB0[n * 2]), sum);
+            }
+            for (n = nVec * 2; n < N; n++) {
+                sum += pA0[n] * pB0[n];
+            }
+
+            pDstC[m * O + o] = sum;
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+}
+
+/**
+   @} end of MatMultPackedKernels group
+*/
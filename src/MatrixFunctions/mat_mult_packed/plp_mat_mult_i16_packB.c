@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i16_packB.c
+ * Description:  16-bit integer matrix packing for packed matrix multiplication
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultPacked Packed Matrix Matrix Multiplication
+  This module contains the glue code for Matrix Matrix Multiplication of 8-bit and 16-bit integer
+  matrices, where the second matrix B has been prepared once with plp_mat_mult_i8_packB or
+  plp_mat_mult_i16_packB. The kernel codes (kernels) are in the Module Packed Matrix Multiplication
+  Kernels.
+
+  The regular matrix multiplication reads B column-wise, such that the elements which are
+  multiplied with one SIMD vector of A are not contiguous in memory and must be shuffled together.
+  The packed layout stores B transposed: each column of B is stored contiguously and zero padded
+  to a multiple of 4 elements (8-bit) or 2 elements (16-bit). Every column therefore starts at a
+  word boundary, and the kernels load it directly into SIMD vectors for the dot product
+  instructions. This is useful when B is constant, like the weights of a neural network layer,
+  such that the packing is done only once.
+
+  The packed matrix requires `O * ceil(N / 4) * 4` elements for 8-bit, and `O * ceil(N / 2) * 2`
+  elements for 16-bit matrices.
+ */
+
+/**
+  @addtogroup MatMultPacked
+  @{
+ */
+
+/**
+  @brief Pack the second 16-bit integer matrix of a matrix multiplication for plp_mat_mult_packed_i16.
+         The matrix is transposed, and each column is zero padded to a multiple of 2 elements.
+  @param[in]  pSrcB     points to the matrix of shape NxO
+  @param[in]  N         height of the matrix
+  @param[in]  O         width of the matrix
+  @param[out] pDstB     points to the packed matrix, of size O * ceil(N / 2) * 2. pDstB must be
+                        aligned to 4 bytes.
+  @return     none
+ */
+
+void plp_mat_mult_i16_packB(const int16_t *__restrict__ pSrcB,
+                            uint32_t N,
+                            uint32_t O,
+                            int16_t *__restrict__ pDstB) {
+
+    uint32_t nPacked = (N + 1U) & ~1U;
+
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (o = 0; o < O; o++) {
+        int16_t *pCol = &pDstB[o * nPacked];
+        for (n = 0; n < N; n++) {
+            pCol[n] = pSrcB[n * O + o];
+        }
+        for (; n < nPacked; n++) {
+            pCol[n] = 0;
+        }
+    }
+}
+
+/**
+  @} end of MatMultPacked group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i8_packB.c
+ * Description:  8-bit integer matrix packing for packed matrix multiplication
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultPacked
+  @{
+ */
+
+/**
+  @brief Pack the second 8-bit integer matrix of a matrix multiplication for plp_mat_mult_packed_i8.
+         The matrix is transposed, and each column is zero padded to a multiple of 4 elements.
+  @param[in]  pSrcB     points to the matrix of shape NxO
+  @param[in]  N         height of the matrix
+  @param[in]  O         width of the matrix
+  @param[out] pDstB     points to the packed matrix, of size O * ceil(N / 4) * 4. pDstB must be
+                        aligned to 4 bytes.
+  @return     none
+ */
+
+void plp_mat_mult_i8_packB(const int8_t *__restrict__ pSrcB,
+                           uint32_t N,
+                           uint32_t O,
+                           int8_t *__restrict__ pDstB) {
+
+    uint32_t nPacked = (N + 3U) & ~3U;
+
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (o = 0; o < O; o++) {
+        int8_t *pCol = &pDstB[o * nPacked];
+        for (n = 0; n < N; n++) {
+            pCol[n] = pSrcB[n * O + o];
+        }
+        for (; n < nPacked; n++) {
+            pCol[n] = 0;
+        }
+    }
+}
+
+/**
+  @} end of MatMultPacked group
+ */
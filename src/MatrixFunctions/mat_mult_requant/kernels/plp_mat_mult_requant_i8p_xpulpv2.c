@@ -0,0 +1,184 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8p_xpulpv2.c
+ * Description:  Parallel 8-bit integer matrix multiplication with requantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+RT_CL_DATA static v4s mask0 = { 0, 1, 4, 5 };
+RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
+RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
+RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
+
+/* requantizes a 32-bit accumulator with a rounding shift and saturates it to 8 bits */
+static inline int32_t plp_requant_i8(int32_t x, int32_t mult, uint32_t shift) {
+    return __CLIP(__ROUNDNORM_REG(x * mult, shift), 7);
+}
+
+/**
+  @brief Parallel matrix multiplication of 8-bit integer matrices with requantization kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_requant_instance_i8 struct initialized by
+                    plp_mat_mult_requant_i8_parallel
+  @return     none
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition, with the
+  2x4 blocks of plp_mat_mult_requant_i8s_xpulpv2.
+ */
+
+void plp_mat_mult_requant_i8p_xpulpv2(void *args) {
+
+    plp_mat_mult_requant_instance_i8 *a = (plp_mat_mult_requant_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    const int32_t *__restrict__ pMult = a->pMult;
+    const uint32_t *__restrict__ pShift = a->pShift;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, plp_core_id(), &tile);
+
+    uint32_t m, n, o; // loop counters
+
+    uint32_t M_blk = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x1);
+    uint32_t O_blk = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x3);
+    uint32_t N_blk = N & ~0x3;
+
+    for (m = tile.mStart; m < M_blk; m += 2) {
+
+        const int8_t *__restrict__ pA0 = pSrcA + m * N;
+        const int8_t *__restrict__ pA1 = pA0 + N;
+
+        // 2x4 blocks
+        for (o = tile.oStart; o < O_blk; o += 4) {
+
+            int32_t sum00 = 0, sum01 = 0, sum02 = 0, sum03 = 0;
+            int32_t sum10 = 0, sum11 = 0, sum12 = 0, sum13 = 0;
+
+            const int8_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N_blk; n += 4) {
+
+                v4s aVec0 = *((v4s *)(pA0 + n));
+                v4s aVec1 = *((v4s *)(pA1 + n));
+
+                v4s temp0 = *((v4s *)pB);
+                v4s temp1 = *((v4s *)(pB + O));
+                v4s temp2 = *((v4s *)(pB + 2 * O));
+                v4s temp3 = *((v4s *)(pB + 3 * O));
+                pB += 4 * O;
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // 2,3,6,7
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 10,11,14,15
+
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // 0,4,8,12
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // 1,5,9,13
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // 2,6,10,14
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // 3,7,11,15
+
+                sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+                sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+                sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+            }
+
+            for (; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                sum00 += a0 * pB[0];
+                sum01 += a0 * pB[1];
+                sum02 += a0 * pB[2];
+                sum03 += a0 * pB[3];
+                sum10 += a1 * pB[0];
+                sum11 += a1 * pB[1];
+                sum12 += a1 * pB[2];
+                sum13 += a1 * pB[3];
+                pB += O;
+            }
+
+            // epilogue: requantize with the parameters of the four columns
+            int32_t mult0 = pMult[o], mult1 = pMult[o + 1];
+            int32_t mult2 = pMult[o + 2], mult3 = pMult[o + 3];
+            uint32_t shift0 = pShift[o], shift1 = pShift[o + 1];
+            uint32_t shift2 = pShift[o + 2], shift3 = pShift[o + 3];
+
+            *((v4s *)(pDstC + m * O + o)) =
+                __PACK4(plp_requant_i8(sum00, mult0, shift0), plp_requant_i8(sum01, mult1, shift1),
+                        plp_requant_i8(sum02, mult2, shift2), plp_requant_i8(sum03, mult3, shift3));
+            *((v4s *)(pDstC + (m + 1) * O + o)) =
+                __PACK4(plp_requant_i8(sum10, mult0, shift0), plp_requant_i8(sum11, mult1, shift1),
+                        plp_requant_i8(sum12, mult2, shift2), plp_requant_i8(sum13, mult3, shift3));
+        }
+
+        // column tail: 2x1 blocks
+        for (o = O_blk; o < tile.oEnd; o++) {
+            int32_t sum0 = 0, sum1 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t b = pSrcB[n * O + o];
+                sum0 += pA0[n] * b;
+                sum1 += pA1[n] * b;
+            }
+            pDstC[m * O + o] = (int8_t)plp_requant_i8(sum0, pMult[o], pShift[o]);
+            pDstC[(m + 1) * O + o] = (int8_t)plp_requant_i8(sum1, pMult[o], pShift[o]);
+        }
+    }
+
+    // row tail
+    for (m = M_blk; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = (int8_t)plp_requant_i8(sum, pMult[o], pShift[o]);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
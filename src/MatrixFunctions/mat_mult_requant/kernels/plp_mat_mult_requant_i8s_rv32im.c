@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8s_rv32im.c
+ * Description:  8-bit integer matrix multiplication with requantization for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @defgroup MatMultRequantKernels Matrix Multiplication with Requantization Kernels
+  Kernels of the matrix multiplication with requantization. The requantization is the epilogue of
+  every output element, while the accumulator is still in a register.
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 8-bit integer matrices with requantization kernel for RV32IM
+         extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  pMult     points to the multipliers, one per column of the output matrix
+  @param[in]  pShift    points to the right shifts, one per column of the output matrix
+  @param[out] pDstC     points to the 8-bit output matrix
+  @return     none
+ */
+
+void plp_mat_mult_requant_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     const int32_t *__restrict__ pMult,
+                                     const uint32_t *__restrict__ pShift,
+                                     int8_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+
+            uint32_t shift = pShift[o];
+            sum *= pMult[o];
+            if (shift > 0) {
+                sum = (sum + (1 << (shift - 1))) >> shift;
+            }
+            if (sum > 127) {
+                sum = 127;
+            } else if (sum < -128) {
+                sum = -128;
+            }
+            pDstC[m * O + o] = (int8_t)sum;
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
@@ -0,0 +1,186 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_q16s_xpulpv2.c
+ * Description:  16-bit fix-point matrix multiplication with requantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 16-bit fix-point matrices with requantization kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  pMult     points to the multipliers, one per column of the output matrix, or NULL
+                        (multiplier 1 for all columns)
+  @param[in]  pShift    points to the right shifts, one per column of the output matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Fix-Point and Rounding
+  The products are accumulated with 32 bits without any shift. Assume that matrix A is
+  represented as pSrcA * 2^-x, and matrix B as pSrcB * 2^-y. Then, the output is represented as
+  pDstC * 2^-(x + y - pShift[o]) / pMult[o]. The accumulator is multiplied with pMult[o], shifted
+  with rounding to the nearest value, and saturated to 16 bits once per output element.
+
+  @par Exploiting SIMD instructions
+  The output is computed in blocks of 4x2 elements. Two rows of B are transposed with a shuffle,
+  such that every pair of elements of A feeds two sumdotp instructions.
+ */
+
+void plp_mat_mult_requant_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const uint32_t *__restrict__ pShift,
+                                       int16_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    uint32_t M_blk = M & ~0x3;
+    uint32_t O_blk = O & ~0x1;
+    uint32_t N_blk = N & ~0x1;
+
+    for (m = 0; m < M_blk; m += 4) {
+
+        const int16_t *__restrict__ pA0 = pSrcA + m * N;
+        const int16_t *__restrict__ pA1 = pA0 + N;
+        const int16_t *__restrict__ pA2 = pA1 + N;
+        const int16_t *__restrict__ pA3 = pA2 + N;
+
+        // 4x2 blocks
+        for (o = 0; o < O_blk; o += 2) {
+
+            int32_t sum00 = 0, sum01 = 0, sum10 = 0, sum11 = 0;
+            int32_t sum20 = 0, sum21 = 0, sum30 = 0, sum31 = 0;
+
+            const int16_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N_blk; n += 2) {
+
+                v2s aVec0 = *((v2s *)(pA0 + n));
+                v2s aVec1 = *((v2s *)(pA1 + n));
+                v2s aVec2 = *((v2s *)(pA2 + n));
+                v2s aVec3 = *((v2s *)(pA3 + n));
+
+                v2s bTemp0 = *((v2s *)pB);
+                v2s bTemp1 = *((v2s *)(pB + O));
+                pB += 2 * O;
+
+                v2s bVec0 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 0, 2 });
+                v2s bVec1 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 1, 3 });
+
+                sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+                sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+                sum20 = __SUMDOTP2(aVec2, bVec0, sum20);
+                sum21 = __SUMDOTP2(aVec2, bVec1, sum21);
+                sum30 = __SUMDOTP2(aVec3, bVec0, sum30);
+                sum31 = __SUMDOTP2(aVec3, bVec1, sum31);
+            }
+
+            if (n < N) {
+                int32_t b0 = pB[0];
+                int32_t b1 = pB[1];
+                sum00 += pA0[n] * b0;
+                sum01 += pA0[n] * b1;
+                sum10 += pA1[n] * b0;
+                sum11 += pA1[n] * b1;
+                sum20 += pA2[n] * b0;
+                sum21 += pA2[n] * b1;
+                sum30 += pA3[n] * b0;
+                sum31 += pA3[n] * b1;
+            }
+
+            // epilogue: requantize with the parameters of the two columns
+            int32_t mult0 = (pMult != NULL) ? pMult[o] : 1;
+            int32_t mult1 = (pMult != NULL) ? pMult[o + 1] : 1;
+            uint32_t shift0 = pShift[o];
+            uint32_t shift1 = pShift[o + 1];
+
+            int16_t *__restrict__ pC = pDstC + m * O + o;
+            pC[0] = plp_requant_q16_inline(sum00, mult0, shift0);
+            pC[1] = plp_requant_q16_inline(sum01, mult1, shift1);
+            pC += O;
+            pC[0] = plp_requant_q16_inline(sum10, mult0, shift0);
+            pC[1] = plp_requant_q16_inline(sum11, mult1, shift1);
+            pC += O;
+            pC[0] = plp_requant_q16_inline(sum20, mult0, shift0);
+            pC[1] = plp_requant_q16_inline(sum21, mult1, shift1);
+            pC += O;
+            pC[0] = plp_requant_q16_inline(sum30, mult0, shift0);
+            pC[1] = plp_requant_q16_inline(sum31, mult1, shift1);
+        }
+
+        // column tail: 4x1 blocks
+        for (o = O_blk; o < O; o++) {
+            int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t b = pSrcB[n * O + o];
+                sum0 += pA0[n] * b;
+                sum1 += pA1[n] * b;
+                sum2 += pA2[n] * b;
+                sum3 += pA3[n] * b;
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q16_inline(sum0, mult, pShift[o]);
+            pDstC[(m + 1) * O + o] = plp_requant_q16_inline(sum1, mult, pShift[o]);
+            pDstC[(m + 2) * O + o] = plp_requant_q16_inline(sum2, mult, pShift[o]);
+            pDstC[(m + 3) * O + o] = plp_requant_q16_inline(sum3, mult, pShift[o]);
+        }
+    }
+
+    // row tail
+    for (m = M_blk; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q16_inline(sum, mult, pShift[o]);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
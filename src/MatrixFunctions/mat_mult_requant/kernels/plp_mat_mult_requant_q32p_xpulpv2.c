@@ -0,0 +1,142 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fix-point matrix multiplication with requantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Parallel matrix multiplication of 32-bit fix-point matrices with requantization
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_requant_instance_q32 struct initialized by
+                    plp_mat_mult_requant_q32_parallel
+  @return     none
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition, with the
+  blocks of plp_mat_mult_requant_q32s_xpulpv2.
+ */
+
+void plp_mat_mult_requant_q32p_xpulpv2(void *args) {
+
+    plp_mat_mult_requant_instance_q32 *a = (plp_mat_mult_requant_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrcA = a->pSrcA;
+    const int32_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    const int32_t *__restrict__ pMult = a->pMult;
+    const uint32_t *__restrict__ pShift = a->pShift;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, plp_core_id(), &tile);
+
+    uint32_t m, n, o; // loop counters
+
+    uint32_t M_blk = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x1);
+    uint32_t O_blk = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x1);
+
+    for (m = tile.mStart; m < M_blk; m += 2) {
+
+        const int32_t *__restrict__ pA0 = pSrcA + m * N;
+        const int32_t *__restrict__ pA1 = pA0 + N;
+
+        // 2x2 blocks
+        for (o = tile.oStart; o < O_blk; o += 2) {
+
+            int64_t sum00 = 0, sum01 = 0, sum10 = 0, sum11 = 0;
+
+            const int32_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                int32_t b0 = pB[0];
+                int32_t b1 = pB[1];
+                pB += O;
+
+                sum00 += (int64_t)a0 * b0;
+                sum01 += (int64_t)a0 * b1;
+                sum10 += (int64_t)a1 * b0;
+                sum11 += (int64_t)a1 * b1;
+            }
+
+            // epilogue: requantize with the parameters of the two columns
+            int32_t mult0 = (pMult != NULL) ? pMult[o] : 1;
+            int32_t mult1 = (pMult != NULL) ? pMult[o + 1] : 1;
+            uint32_t shift0 = pShift[o];
+            uint32_t shift1 = pShift[o + 1];
+
+            int32_t *__restrict__ pC = pDstC + m * O + o;
+            pC[0] = plp_requant_q32_inline(sum00, mult0, shift0);
+            pC[1] = plp_requant_q32_inline(sum01, mult1, shift1);
+            pC[O] = plp_requant_q32_inline(sum10, mult0, shift0);
+            pC[O + 1] = plp_requant_q32_inline(sum11, mult1, shift1);
+        }
+
+        // column tail: 2x1 blocks
+        for (o = O_blk; o < tile.oEnd; o++) {
+            int64_t sum0 = 0, sum1 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t b = pSrcB[n * O + o];
+                sum0 += (int64_t)pA0[n] * b;
+                sum1 += (int64_t)pA1[n] * b;
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q32_inline(sum0, mult, pShift[o]);
+            pDstC[(m + 1) * O + o] = plp_requant_q32_inline(sum1, mult, pShift[o]);
+        }
+    }
+
+    // row tail
+    for (m = M_blk; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            int64_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int64_t)pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q32_inline(sum, mult, pShift[o]);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
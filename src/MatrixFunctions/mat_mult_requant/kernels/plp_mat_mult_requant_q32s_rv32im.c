@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_q32s_rv32im.c
+ * Description:  32-bit fix-point matrix multiplication with requantization for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 32-bit fix-point matrices with requantization kernel for
+         RV32IM extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  pMult     points to the multipliers, one per column of the output matrix, or NULL
+                        (multiplier 1 for all columns)
+  @param[in]  pShift    points to the right shifts, one per column of the output matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Fix-Point and Rounding
+  The products are accumulated with 64 bits without any shift. Assume that matrix A is
+  represented as pSrcA * 2^-x, and matrix B as pSrcB * 2^-y. Then, the output is represented as
+  pDstC * 2^-(x + y - pShift[o]) / pMult[o]. The accumulator is multiplied with pMult[o], shifted
+  with rounding to the nearest value, and saturated to 32 bits once per output element.
+ */
+
+void plp_mat_mult_requant_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int64_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int64_t)pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q32_inline(sum, mult, pShift[o]);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
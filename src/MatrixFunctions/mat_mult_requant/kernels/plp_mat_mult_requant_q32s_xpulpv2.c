@@ -0,0 +1,147 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_q32s_xpulpv2.c
+ * Description:  32-bit fix-point matrix multiplication with requantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 32-bit fix-point matrices with requantization kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  pMult     points to the multipliers, one per column of the output matrix, or NULL
+                        (multiplier 1 for all columns)
+  @param[in]  pShift    points to the right shifts, one per column of the output matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Fix-Point and Rounding
+  The products are accumulated with 64 bits without any shift. Assume that matrix A is
+  represented as pSrcA * 2^-x, and matrix B as pSrcB * 2^-y. Then, the output is represented as
+  pDstC * 2^-(x + y - pShift[o]) / pMult[o]. The accumulator is multiplied with pMult[o], shifted
+  with rounding to the nearest value, and saturated to 32 bits once per output element.
+
+  @par Blocking
+  The output is computed in blocks of 2x2 elements, such that every loaded element is used for two
+  64-bit multiply-accumulates.
+ */
+
+void plp_mat_mult_requant_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const uint32_t *__restrict__ pShift,
+                                       int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    uint32_t M_blk = M & ~0x1;
+    uint32_t O_blk = O & ~0x1;
+
+    for (m = 0; m < M_blk; m += 2) {
+
+        const int32_t *__restrict__ pA0 = pSrcA + m * N;
+        const int32_t *__restrict__ pA1 = pA0 + N;
+
+        // 2x2 blocks
+        for (o = 0; o < O_blk; o += 2) {
+
+            int64_t sum00 = 0, sum01 = 0, sum10 = 0, sum11 = 0;
+
+            const int32_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                int32_t b0 = pB[0];
+                int32_t b1 = pB[1];
+                pB += O;
+
+                sum00 += (int64_t)a0 * b0;
+                sum01 += (int64_t)a0 * b1;
+                sum10 += (int64_t)a1 * b0;
+                sum11 += (int64_t)a1 * b1;
+            }
+
+            // epilogue: requantize with the parameters of the two columns
+            int32_t mult0 = (pMult != NULL) ? pMult[o] : 1;
+            int32_t mult1 = (pMult != NULL) ? pMult[o + 1] : 1;
+            uint32_t shift0 = pShift[o];
+            uint32_t shift1 = pShift[o + 1];
+
+            int32_t *__restrict__ pC = pDstC + m * O + o;
+            pC[0] = plp_requant_q32_inline(sum00, mult0, shift0);
+            pC[1] = plp_requant_q32_inline(sum01, mult1, shift1);
+            pC[O] = plp_requant_q32_inline(sum10, mult0, shift0);
+            pC[O + 1] = plp_requant_q32_inline(sum11, mult1, shift1);
+        }
+
+        // column tail: 2x1 blocks
+        for (o = O_blk; o < O; o++) {
+            int64_t sum0 = 0, sum1 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t b = pSrcB[n * O + o];
+                sum0 += (int64_t)pA0[n] * b;
+                sum1 += (int64_t)pA1[n] * b;
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q32_inline(sum0, mult, pShift[o]);
+            pDstC[(m + 1) * O + o] = plp_requant_q32_inline(sum1, mult, pShift[o]);
+        }
+    }
+
+    // row tail
+    for (m = M_blk; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int64_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int64_t)pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+            int32_t mult = (pMult != NULL) ? pMult[o] : 1;
+            pDstC[m * O + o] = plp_requant_q32_inline(sum, mult, pShift[o]);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8.c
+ * Description:  8-bit integer matrix multiplication with requantization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultRequant Matrix Multiplication with Requantization
+  This module contains the glue code for the matrix multiplication of 8-bit integer matrices with a
+  fused requantization of the output to 8 bits, as used for the fully connected and (after im2col)
+  the convolutional layers of quantized neural networks. The kernel codes (kernels) are in the
+  Module Matrix Multiplication with Requantization Kernels.
+
+  Every column o of the output matrix (i.e. every output channel) has its own multiplier and shift,
+  and the 32-bit accumulators are requantized like plp_requantize_i32_i8 before they are stored:
+
+      pDstC[m * O + o] = clip((sum_n pSrcA[m * N + n] * pSrcB[n * O + o]) * pMult[o] >> pShift[o])
+
+  Hence, the 32-bit output matrix is never written to memory, and no second pass is needed.
+
+  The 16-bit and 32-bit fix-point variants (q16, q32) accumulate with 32 and 64 bits respectively,
+  and round once per output element instead of once per product like plp_mat_mult_q16 and
+  plp_mat_mult_q32. Their pMult may be NULL, in which case only the shift is applied.
+ */
+
+/**
+  @addtogroup MatMultRequant
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of 8-bit integer matrices with requantization of the
+         output.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  pMult     points to the multipliers, one per column of the output matrix
+  @param[in]  pShift    points to the right shifts, one per column of the output matrix
+  @param[out] pDstC     points to the 8-bit output matrix
+  @return     none
+ */
+
+void plp_mat_mult_requant_i8(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             const int32_t *__restrict__ pMult,
+                             const uint32_t *__restrict__ pShift,
+                             int8_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_requant_i8s_rv32im(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC);
+    } else {
+        plp_mat_mult_requant_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pMult, pShift, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultRequant group
+ */
@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i2s_xpulpnn.c
+ * Description:  2-bit integer matrix multiplication kernel for XpulpNN
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#if defined(PLP_XPULPNN)
+
+/**
+  @ingroup MatMultSubByte
+ */
+
+/**
+  @addtogroup MatMultSubByteKernels
+  @{
+ */
+
+/* dot product of a row of A and a column of B, for the rows and columns left over by the blocks */
+static inline int32_t plp_mat_mult_i2_dot_xpulpnn(const v4s *pA, const v4s *pB, uint32_t nWords) {
+    uint32_t n;
+    int32_t sum = 0;
+    v4s a, b;
+
+    for (n = 0; n < nWords; n++) {
+        a = pA[n];
+        b = pB[n];
+        sum = PLP_SUMDOTP16(a, b, sum);
+    }
+
+    return sum;
+}
+
+/**
+  @brief Matrix multiplication of 2-bit integer matrices kernel for XpulpNN extension.
+  @param[in]  pSrcA     points to the first input matrix, packed (MxN)
+  @param[in]  pSrcB     points to the second input matrix, transposed and packed (OxN)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 values of a word are multiplied and accumulated with a single pv.sdotsp.c instruction,
+  with 32 bit accumulators. The output is computed in blocks of 2x2 elements, such that every
+  loaded word is used twice. The kernel is only built with PLP_XPULPNN.
+ */
+
+void plp_mat_mult_i2s_xpulpnn(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC) {
+
+    uint32_t nWords = (N + 15U) >> 4; // words of a row of A or a column of B
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for the words of a row
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m + 2 <= M; m += 2) {
+        const v4s *pA0 = (const v4s *)pSrcA + m * nWords;
+        const v4s *pA1 = pA0 + nWords;
+
+        for (o = 0; o + 2 <= O; o += 2) {
+            const v4s *pB0 = (const v4s *)pSrcB + o * nWords;
+            const v4s *pB1 = pB0 + nWords;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n < nWords; n++) {
+                v4s a0 = pA0[n];
+                v4s a1 = pA1[n];
+                v4s b0 = pB0[n];
+                v4s b1 = pB1[n];
+
+                sum00 = PLP_SUMDOTP16(a0, b0, sum00);
+                sum01 = PLP_SUMDOTP16(a0, b1, sum01);
+                sum10 = PLP_SUMDOTP16(a1, b0, sum10);
+                sum11 = PLP_SUMDOTP16(a1, b1, sum11);
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[m * O + o + 1] = sum01;
+            pDstC[(m + 1) * O + o] = sum10;
+            pDstC[(m + 1) * O + o + 1] = sum11;
+        }
+
+        // clean up for o
+        if (o < O) {
+            const v4s *pB0 = (const v4s *)pSrcB + o * nWords;
+            pDstC[m * O + o] = plp_mat_mult_i2_dot_xpulpnn(pA0, pB0, nWords);
+            pDstC[(m + 1) * O + o] = plp_mat_mult_i2_dot_xpulpnn(pA1, pB0, nWords);
+        }
+    }
+
+    // clean up for m
+    if (m < M) {
+        const v4s *pA0 = (const v4s *)pSrcA + m * nWords;
+        for (o = 0; o < O; o++) {
+            const v4s *pB0 = (const v4s *)pSrcB + o * nWords;
+            pDstC[m * O + o] = plp_mat_mult_i2_dot_xpulpnn(pA0, pB0, nWords);
+        }
+    }
+}
+
+/**
+  @} end of MatMultSubByteKernels group
+ */
+
+#endif // PLP_XPULPNN
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i4s_rv32im.c
+ * Description:  4-bit integer matrix multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultSubByte
+ */
+
+/**
+  @defgroup MatMultSubByteKernels Sub-Byte Matrix Multiplication Kernels
+  This module contains the kernel code for Matrix Matrix Multiplication of 4-bit and 2-bit integer
+  matrices.
+ */
+
+/**
+  @addtogroup MatMultSubByteKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 4-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrcA     points to the first input matrix, packed (MxN)
+  @param[in]  pSrcB     points to the second input matrix, transposed and packed (OxN)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par
+  Every byte is loaded once, and its 2 values are sign-extended with shifts. The zero
+  padding of the rows is multiplied as well.
+ */
+
+void plp_mat_mult_i4s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC) {
+
+    uint32_t rowBytes = ((N + 7U) >> 3) << 2; // bytes of a row of A or a column of B
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for the bytes of a row
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pA = &pSrcA[m * rowBytes];
+
+        for (o = 0; o < O; o++) {
+            const int8_t *pB = &pSrcB[o * rowBytes];
+            int32_t sum = 0;
+
+            for (n = 0; n < rowBytes; n++) {
+                int32_t a = pA[n];
+                int32_t b = pB[n];
+                sum += ((int32_t)((uint32_t)a << 28) >> 28) * ((int32_t)((uint32_t)b << 28) >> 28) +
+                       (a >> 4) * (b >> 4);
+            }
+
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+  @} end of MatMultSubByteKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i4.c
+ * Description:  4-bit integer matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultSubByte Sub-Byte Matrix Multiplication
+  This module contains the glue code for Matrix Matrix Multiplication of 4-bit and 2-bit integer
+  matrices, e.g. with quantized weights of a neural network. The kernel codes (kernels) are in the
+  Module Sub-Byte Matrix Multiplication Kernels.
+
+  The values are packed in two's complement, element k of a row in the bits 4k to 4k+3 (4-bit) or
+  2k to 2k+1 (2-bit) of the row (see plp_get_i4 and plp_get_i2). The second matrix is stored
+  transposed, like the packed matrix of plp_mat_mult_i8_packB, such that both the rows of A and the
+  columns of B are contiguous. Every row of A and every column of B starts at a word boundary: it
+  takes ceil(N / 8) words (4-bit) or ceil(N / 16) words (2-bit), and the values after the N-th one
+  must be zero. The matrices must be aligned to 4 bytes. The output is a 32-bit matrix of MxO, as
+  of plp_mat_mult_i8.
+
+  On the cluster, the XPULPV2 kernels sign-extend the values of a word to vectors of 4 bytes in
+  registers. With PLP_XPULPNN, the XpulpNN kernels multiply all values of a word with a single
+  instruction instead.
+ */
+
+/**
+  @addtogroup MatMultSubByte
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of 4-bit integer matrices.
+  @param[in]  pSrcA     points to the first input matrix, packed (MxN)
+  @param[in]  pSrcB     points to the second input matrix, transposed and packed (OxN)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_i4(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_i4s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
+    } else {
+        PLP_CL_KERNEL(plp_mat_mult_i4s)(pSrcA, pSrcB, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultSubByte group
+ */
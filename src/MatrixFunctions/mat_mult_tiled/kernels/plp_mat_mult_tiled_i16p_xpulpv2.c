@@ -0,0 +1,169 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tiled_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer tiled matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMultTiled
+ */
+
+/**
+  @addtogroup BasicMatMultTiledKernels
+  @{
+ */
+
+/**
+  @brief Parallel tiled matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_tiled_instance_i16 struct initialized by
+                    plp_mat_mult_i16_tiled
+  @return     none
+
+  @par DMA double buffering
+  Core 0 is in charge of all DMA transfers. Before computing one step, it waits until the input
+  tiles of the current step are in L1, and starts the transfer of the input tiles for the next step
+  into the other buffer. After all cores have computed the output tile, core 0 starts its
+  write-back to L2. The output buffer is only reused two steps later, after the write-back is done.
+ */
+
+void plp_mat_mult_tiled_i16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_tiled_instance_i16 *a = (plp_mat_mult_tiled_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t tileM = a->tileM;
+    uint32_t tileO = a->tileO;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t numTilesM = (M + tileM - 1) / tileM;
+    uint32_t numTilesO = (O + tileO - 1) / tileO;
+    uint32_t numSteps = numTilesM * numTilesO;
+
+    rt_dma_copy_t copyIn;
+    rt_dma_copy_t copyOut[2];
+
+    uint32_t step;
+
+    // load the input tiles of the first step
+    if (core_id == 0) {
+        uint32_t sizeO = tileO;
+        rt_dma_memcpy((uintptr_t)pSrcA, (uintptr_t)a->pBufA[0],
+                      sizeof(int16_t) * tileM * N, RT_DMA_DIR_EXT2LOC, 0, &copyIn);
+        rt_dma_memcpy_2d((uintptr_t)pSrcB, (uintptr_t)a->pBufB[0],
+                         sizeof(int16_t) * N * sizeO, sizeof(int16_t) * O, sizeof(int16_t) * sizeO,
+                         RT_DMA_DIR_EXT2LOC, 1, &copyIn);
+    }
+
+    for (step = 0; step < numSteps; step++) {
+
+        uint32_t mi = step / numTilesO;
+        uint32_t oi = step % numTilesO;
+        uint32_t m0 = mi * tileM;
+        uint32_t o0 = oi * tileO;
+        uint32_t sizeM = (m0 + tileM > M) ? M - m0 : tileM;
+        uint32_t sizeO = (o0 + tileO > O) ? O - o0 : tileO;
+
+        int32_t *__restrict__ pBufC = a->pBufC[step & 0x1];
+
+        if (core_id == 0) {
+            // wait until the input tiles of this step are in L1
+            rt_dma_wait(&copyIn);
+
+            // wait until the output buffer is written back (used two steps before)
+            if (step >= 2) {
+                rt_dma_wait(&copyOut[step & 0x1]);
+            }
+
+            // start the transfer of the next input tiles
+            if (step + 1 < numSteps) {
+                uint32_t nextMi = (step + 1) / numTilesO;
+                uint32_t nextOi = (step + 1) % numTilesO;
+                uint32_t nextM0 = nextMi * tileM;
+                uint32_t nextO0 = nextOi * tileO;
+                uint32_t nextSizeM = (nextM0 + tileM > M) ? M - nextM0 : tileM;
+                uint32_t nextSizeO = (nextO0 + tileO > O) ? O - nextO0 : tileO;
+                int merge = 0;
+
+                if (nextMi != mi) {
+                    rt_dma_memcpy((uintptr_t)(pSrcA + nextM0 * N),
+                                  (uintptr_t)a->pBufA[nextMi & 0x1],
+                                  sizeof(int16_t) * nextSizeM * N, RT_DMA_DIR_EXT2LOC, merge, &copyIn);
+                    merge = 1;
+                }
+                rt_dma_memcpy_2d((uintptr_t)(pSrcB + nextO0),
+                                 (uintptr_t)a->pBufB[(step + 1) & 0x1],
+                                 sizeof(int16_t) * N * nextSizeO, sizeof(int16_t) * O,
+                                 sizeof(int16_t) * nextSizeO, RT_DMA_DIR_EXT2LOC, merge, &copyIn);
+            }
+        }
+
+        plp_team_barrier();
+
+        // compute the current output tile
+        plp_mat_mult_stride_instance_i16 tileArgs = { .pSrcA = a->pBufA[mi & 0x1],
+                                                     .pSrcB = a->pBufB[step & 0x1],
+                                                     .M = sizeM,
+                                                     .N = N,
+                                                     .O = sizeO,
+                                                     .strideA = N,
+                                                     .strideB = sizeO,
+                                                     .strideC = sizeO,
+                                                     .nPE = nPE,
+                                                     .pDstC = pBufC };
+        plp_mat_mult_stride_i16p_xpulpv2((void *)&tileArgs);
+
+        plp_team_barrier();
+
+        // write the output tile back to L2
+        if (core_id == 0) {
+            rt_dma_memcpy_2d((uintptr_t)(pDstC + m0 * O + o0), (uintptr_t)pBufC,
+                             sizeof(int32_t) * sizeM * sizeO, sizeof(int32_t) * O,
+                             sizeof(int32_t) * sizeO, RT_DMA_DIR_LOC2EXT, 0, &copyOut[step & 0x1]);
+        }
+    }
+
+    // wait for the last write-backs
+    if (core_id == 0) {
+        if (numSteps >= 2) {
+            rt_dma_wait(&copyOut[numSteps & 0x1]);
+        }
+        rt_dma_wait(&copyOut[(numSteps - 1) & 0x1]);
+    }
+
+    plp_team_barrier();
+}
+
+/**
+  @} end of BasicMatMultTiledKernels group
+ */
@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i32_tiled.c
+ * Description:  32-bit integer tiled matrix multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup BasicMatMultTiled Tiled Matrix Matrix Multiplication
+  This module contains the glue code for Matrix Matrix Multiplication of matrices which are stored
+  in L2 memory. The kernel codes (kernels) are in the Module Tiled Matrix Multiplication Kernels.
+
+  The matrices are split into tiles, which are copied into L1 using the cluster DMA. Each step
+  computes one tile of the output matrix, of size tileM x tileO, for which a block of tileM rows of
+  A and a block of tileO columns of B are required. Both input and output tiles are double
+  buffered (ping-pong), such that the DMA transfers of the next input tiles and the write-back of
+  the previous output tile overlap with the computation of the current tile. The computation itself
+  is done with the parallel strided matrix multiplication kernels (@ref BasicMatMultStride).
+
+  The block of rows of A is only copied again when the step moves to the next row of tiles. The
+  buffers are allocated in L1 by the glue code, and require
+
+      `2 * (tileM * N + N * tileO) * sizeof(input) + 2 * tileM * tileO * sizeof(output)`
+
+  bytes. Choose tileM and tileO such that this fits into L1, and each single transfer is smaller
+  than 64kB.
+ */
+
+/**
+  @addtogroup BasicMatMultTiled
+  @{
+ */
+
+/**
+  @brief Glue code for tiled parallel matrix multiplication of 32-bit integer matrices stored in L2. The
+         tiles are copied into L1 with the cluster DMA using double buffering.
+  @param[in]  pSrcA     points to the first input matrix (in L2)
+  @param[in]  pSrcB     points to the second input matrix (in L2)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  tileM     number of rows of each output tile
+  @param[in]  tileO     number of columns of each output tile
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix (in L2)
+  @return     none
+ */
+
+void plp_mat_mult_i32_tiled(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t tileM,
+                            uint32_t tileO,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("tiled processing supported only for cluster side\n");
+        return;
+    } else {
+
+        if (M == 0 || N == 0 || O == 0) {
+            return;
+        }
+
+        tileM = (tileM == 0 || tileM > M) ? M : tileM;
+        tileO = (tileO == 0 || tileO > O) ? O : tileO;
+
+        uint32_t sizeA = (tileM * N * sizeof(int32_t) + 0x3) & ~0x3;
+        uint32_t sizeB = (N * tileO * sizeof(int32_t) + 0x3) & ~0x3;
+        uint32_t sizeC = tileM * tileO * sizeof(int32_t);
+        uint32_t memSize = 2 * (sizeA + sizeB + sizeC);
+
+        uint8_t *pBuffer = (uint8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, memSize);
+
+        if (pBuffer == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_mat_mult_tiled_instance_i32 args = {
+            .pSrcA = pSrcA,
+            .pSrcB = pSrcB,
+            .M = M,
+            .N = N,
+            .O = O,
+            .tileM = tileM,
+            .tileO = tileO,
+            .nPE = nPE,
+            .pBufA = { (int32_t *)pBuffer, (int32_t *)(pBuffer + sizeA) },
+            .pBufB = { (int32_t *)(pBuffer + 2 * sizeA), (int32_t *)(pBuffer + 2 * sizeA + sizeB) },
+            .pBufC = { (int32_t *)(pBuffer + 2 * (sizeA + sizeB)),
+                       (int32_t *)(pBuffer + 2 * (sizeA + sizeB) + sizeC) },
+            .pDstC = pDstC
+        };
+
+        rt_team_fork(nPE, plp_mat_mult_tiled_i32p_xpulpv2, (void *)&args);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pBuffer, memSize);
+    }
+}
+
+/**
+  @} end of BasicMatMultTiled group
+ */
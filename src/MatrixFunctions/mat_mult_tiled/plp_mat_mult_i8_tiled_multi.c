@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i8_tiled_multi.c
+ * Description:  8-bit integer tiled matrix multiplication split across clusters
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMultTiled
+  @{
+ */
+
+/* runs on the master core of each cluster */
+static void plp_mat_mult_i8_tiled_multi_entry(void *args) {
+
+    plp_mat_mult_tiled_multi_arg_i8 *a = (plp_mat_mult_tiled_multi_arg_i8 *)args;
+
+    plp_mat_mult_i8_tiled(a->pSrcA, a->pSrcB, a->M, a->N, a->O, a->tileM, a->tileO, a->nPE,
+                          a->pDstC);
+}
+
+/**
+  @brief Glue code for the tiled matrix multiplication of 8-bit integer matrices stored in L2,
+         which is split across several clusters. Every cluster computes a contiguous block of
+         rows of the output with plp_mat_mult_i8_tiled, in its own L1.
+  @param[in]  pSrcA     points to the first input matrix (in L2)
+  @param[in]  pSrcB     points to the second input matrix (in L2)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and height of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  tileM     number of rows of each output tile
+  @param[in]  tileO     number of columns of each output tile
+  @param[in]  nClusters number of clusters, which must be mounted
+  @param[in]  nPE       number of cores to use on every cluster
+  @param[out] pDstC     points to the output matrix (in L2)
+  @return     none
+ */
+
+void plp_mat_mult_i8_tiled_multi(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t tileM,
+                                 uint32_t tileO,
+                                 uint32_t nClusters,
+                                 uint32_t nPE,
+                                 int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("multi-cluster execution supported only for fabric controller side\n");
+        return;
+    }
+
+    plp_async_handle handle[nClusters];
+
+    for (uint32_t c = 0; c < nClusters; c++) {
+        uint32_t rowStart = M * c / nClusters;
+        uint32_t rowEnd = M * (c + 1) / nClusters;
+        plp_mat_mult_tiled_multi_arg_i8 *a = (plp_mat_mult_tiled_multi_arg_i8 *)handle[c].args;
+
+        handle[c].event = NULL;
+        if (rowStart == rowEnd) {
+            continue;
+        }
+
+        a->pSrcA = pSrcA + rowStart * N;
+        a->pSrcB = pSrcB;
+        a->M = rowEnd - rowStart;
+        a->N = N;
+        a->O = O;
+        a->tileM = tileM;
+        a->tileO = tileO;
+        a->nPE = nPE;
+        a->pDstC = pDstC + rowStart * O;
+
+        plp_async_call_cluster(c, plp_mat_mult_i8_tiled_multi_entry, (void *)a, &handle[c]);
+    }
+
+    for (uint32_t c = 0; c < nClusters; c++) {
+        plp_async_wait(&handle[c]);
+    }
+}
+
+/**
+  @} end of BasicMatMultTiled group
+ */
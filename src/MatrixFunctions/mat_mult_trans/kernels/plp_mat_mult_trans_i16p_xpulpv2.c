@@ -49,11 +49,13 @@
    @par Exploiting SIMD instructions
    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
    performed on 32 bit vectors, with 32 bit accumulator.
+   The output is computed in blocks of 2x2 elements, such that every vector loaded from A and B
+   is used in two dot products.
 */
 
 void plp_mat_mult_trans_i16p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_mult_instance_i16 *arguments = (plp_mat_mult_instance_i16 *)args;
     const int16_t *__restrict__ pSrcA = arguments->pSrcA;
@@ -64,15 +66,18 @@ void plp_mat_mult_trans_i16p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m; // loop counter for M
     uint32_t n; // loop counter for N
     uint32_t o; // loop counter for O
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * N + n] * pSrcB[o * N + n];
@@ -81,11 +86,105 @@ void plp_mat_mult_trans_i16p_xpulpv2(void *args) {
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 
 #else
 
-    // TODO hackathon
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    uint32_t mEnd = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x1);
+    uint32_t oEnd = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x1);
+    uint32_t nEnd = N & ~0x1;
+
+    /* blocks of 2x2 outputs: every vector loaded from A and B is used in two dot products */
+    for (m = tile.mStart; m < mEnd; m += 2) {
+        const int16_t *pA0 = pSrcA + m * N;
+        const int16_t *pA1 = pA0 + N;
+
+        for (o = tile.oStart; o < oEnd; o += 2) {
+            const int16_t *pB0 = pSrcB + o * N;
+            const int16_t *pB1 = pB0 + N;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n < nEnd; n += 2) {
+                v2s aVec0 = *((v2s *)&(pA0[n]));
+                v2s aVec1 = *((v2s *)&(pA1[n]));
+                v2s bVec0 = *((v2s *)&(pB0[n]));
+                v2s bVec1 = *((v2s *)&(pB1[n]));
+
+                sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+                sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+            }
+
+            // clean up for n
+            for (; n < N; n++) {
+                sum00 += pA0[n] * pB0[n];
+                sum01 += pA0[n] * pB1[n];
+                sum10 += pA1[n] * pB0[n];
+                sum11 += pA1[n] * pB1[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[m * O + o + 1] = sum01;
+            pDstC[(m + 1) * O + o] = sum10;
+            pDstC[(m + 1) * O + o + 1] = sum11;
+        }
+
+        // clean up for o
+        if (o < tile.oEnd) {
+            const int16_t *pB0 = pSrcB + o * N;
+
+            int32_t sum00 = 0;
+            int32_t sum10 = 0;
+
+            for (n = 0; n < nEnd; n += 2) {
+                v2s bVec0 = *((v2s *)&(pB0[n]));
+
+                sum00 = __SUMDOTP2(*((v2s *)&(pA0[n])), bVec0, sum00);
+                sum10 = __SUMDOTP2(*((v2s *)&(pA1[n])), bVec0, sum10);
+            }
+            for (; n < N; n++) {
+                sum00 += pA0[n] * pB0[n];
+                sum10 += pA1[n] * pB0[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[(m + 1) * O + o] = sum10;
+        }
+    }
+
+    // clean up for m
+    if (m < tile.mEnd) {
+        const int16_t *pA0 = pSrcA + m * N;
+
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            const int16_t *pB0 = pSrcB + o * N;
+
+            int32_t sum00 = 0;
+
+            for (n = 0; n < nEnd; n += 2) {
+                sum00 = __SUMDOTP2(*((v2s *)&(pA0[n])), *((v2s *)&(pB0[n])), sum00);
+            }
+            for (; n < N; n++) {
+                sum00 += pA0[n] * pB0[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+        }
+    }
+
+    plp_team_barrier();
 
 #endif
 #undef BASIC_VERSION
@@ -49,7 +49,7 @@
 
 void plp_mat_mult_trans_i32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_mult_instance_i32 *arguments = (plp_mat_mult_instance_i32 *)args;
     const int32_t *__restrict__ pSrcA = arguments->pSrcA;
@@ -67,8 +67,11 @@ void plp_mat_mult_trans_i32p_xpulpv2(void *args) {
     uint32_t n; // loop counter for N
     uint32_t o; // loop counter for O
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * N + n] * pSrcB[o * N + n];
@@ -77,7 +80,7 @@ void plp_mat_mult_trans_i32p_xpulpv2(void *args) {
         }
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 
 #else
 
@@ -48,6 +48,12 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four products of
+  a dot product are performed with one instruction, with 32 bit accumulator.
+  The output is computed in blocks of 2x2 elements, such that every vector loaded from A and B
+  is used in two dot products.
  */
 
 void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
@@ -57,7 +63,7 @@ void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                                     uint32_t O,
                                     int32_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m; // loop counter
@@ -76,7 +82,96 @@ void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
 
 #else
 
-    // TODO Hackathon
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    uint32_t mEnd = M & ~0x1;
+    uint32_t oEnd = O & ~0x1;
+    uint32_t nEnd = N & ~0x3;
+
+    /* blocks of 2x2 outputs: every vector loaded from A and B is used in two dot products */
+    for (m = 0; m < mEnd; m += 2) {
+        const int8_t *pA0 = pSrcA + m * N;
+        const int8_t *pA1 = pA0 + N;
+
+        for (o = 0; o < oEnd; o += 2) {
+            const int8_t *pB0 = pSrcB + o * N;
+            const int8_t *pB1 = pB0 + N;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n < nEnd; n += 4) {
+                v4s aVec0 = *((v4s *)&(pA0[n]));
+                v4s aVec1 = *((v4s *)&(pA1[n]));
+                v4s bVec0 = *((v4s *)&(pB0[n]));
+                v4s bVec1 = *((v4s *)&(pB1[n]));
+
+                sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+            }
+
+            // clean up for n
+            for (; n < N; n++) {
+                sum00 += pA0[n] * pB0[n];
+                sum01 += pA0[n] * pB1[n];
+                sum10 += pA1[n] * pB0[n];
+                sum11 += pA1[n] * pB1[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[m * O + o + 1] = sum01;
+            pDstC[(m + 1) * O + o] = sum10;
+            pDstC[(m + 1) * O + o + 1] = sum11;
+        }
+
+        // clean up for o
+        if (o < O) {
+            const int8_t *pB0 = pSrcB + o * N;
+
+            int32_t sum00 = 0;
+            int32_t sum10 = 0;
+
+            for (n = 0; n < nEnd; n += 4) {
+                v4s bVec0 = *((v4s *)&(pB0[n]));
+
+                sum00 = __SUMDOTP4(*((v4s *)&(pA0[n])), bVec0, sum00);
+                sum10 = __SUMDOTP4(*((v4s *)&(pA1[n])), bVec0, sum10);
+            }
+            for (; n < N; n++) {
+                sum00 += pA0[n] * pB0[n];
+                sum10 += pA1[n] * pB0[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[(m + 1) * O + o] = sum10;
+        }
+    }
+
+    // clean up for m
+    if (m < M) {
+        const int8_t *pA0 = pSrcA + m * N;
+
+        for (o = 0; o < O; o++) {
+            const int8_t *pB0 = pSrcB + o * N;
+
+            int32_t sum00 = 0;
+
+            for (n = 0; n < nEnd; n += 4) {
+                sum00 = __SUMDOTP4(*((v4s *)&(pA0[n])), *((v4s *)&(pB0[n])), sum00);
+            }
+            for (; n < N; n++) {
+                sum00 += pA0[n] * pB0[n];
+            }
+
+            pDstC[m * O + o] = sum00;
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
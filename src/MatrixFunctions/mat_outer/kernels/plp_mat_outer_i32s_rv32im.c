@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_outer_i32s_rv32im.c
+ * Description:  32-bit integer outer product for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatOuter
+ */
+
+/**
+  @defgroup MatOuterKernels Outer product and rank-1 update Kernels
+  Kernels of the outer product and rank-1 update.
+ */
+
+/**
+  @addtogroup MatOuterKernels
+  @{
+ */
+
+/**
+  @brief Outer product of 32-bit integer vectors kernel for RV32IM extension, C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+
+  @par Blocking
+  The output is computed in blocks of 2x2 elements, such that every loaded element of x and y is
+  used for two products.
+ */
+
+void plp_mat_outer_i32s_rv32im(const int32_t *__restrict__ pSrcX,
+                               const int32_t *__restrict__ pSrcY,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n; // loop counters
+
+    uint32_t M_blk = M & ~0x1;
+    uint32_t N_blk = N & ~0x1;
+
+    // 2x2 blocks, every loaded element of x and y is used for two outputs
+    for (m = 0; m < M_blk; m += 2) {
+        int32_t x0 = pSrcX[m];
+        int32_t x1 = pSrcX[m + 1];
+        int32_t *__restrict__ pC0 = pDstC + m * N;
+        int32_t *__restrict__ pC1 = pC0 + N;
+        for (n = 0; n < N_blk; n += 2) {
+            int32_t y0 = pSrcY[n];
+            int32_t y1 = pSrcY[n + 1];
+            pC0[n] = x0 * y0;
+            pC0[n + 1] = x0 * y1;
+            pC1[n] = x1 * y0;
+            pC1[n + 1] = x1 * y1;
+        }
+        if (n < N) {
+            int32_t y0 = pSrcY[n];
+            pC0[n] = x0 * y0;
+            pC1[n] = x1 * y0;
+        }
+    }
+
+    if (m < M) {
+        int32_t x0 = pSrcX[m];
+        int32_t *__restrict__ pC0 = pDstC + m * N;
+        for (n = 0; n < N; n++) {
+            pC0[n] = x0 * pSrcY[n];
+        }
+    }
+}
+
+/**
+  @} end of MatOuterKernels group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_rank1_update_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer rank-1 update for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatOuter
+ */
+
+/**
+  @addtogroup MatOuterKernels
+  @{
+ */
+
+/**
+  @brief Parallel rank-1 update of 16-bit integer vectors with 32-bit output kernel for XPULPV2
+         extension, A += x * y^T.
+  @param[in]  args  pointer to plp_mat_rank1_update_instance_i16 struct initialized by
+                    plp_mat_rank1_update_i16_parallel
+  @return     none
+
+  @par Work distribution
+  The output matrix is split among the cores with plp_mat_partition.
+ */
+
+void plp_mat_rank1_update_i16p_xpulpv2(void *args) {
+
+    plp_mat_rank1_update_instance_i16 *a = (plp_mat_rank1_update_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    const int16_t *__restrict__ pSrcY = a->pSrcY;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pSrcDstA = a->pSrcDstA;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, N, nPE, plp_core_id(), &tile);
+
+    uint32_t m, n; // loop counters
+
+    uint32_t M_blk = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x1);
+    uint32_t N_blk = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x1);
+
+    // 2x2 blocks, every loaded element of x and y is used for two outputs
+    for (m = tile.mStart; m < M_blk; m += 2) {
+        int32_t x0 = pSrcX[m];
+        int32_t x1 = pSrcX[m + 1];
+        int32_t *__restrict__ pC0 = pSrcDstA + m * N;
+        int32_t *__restrict__ pC1 = pC0 + N;
+        for (n = tile.oStart; n < N_blk; n += 2) {
+            int32_t y0 = pSrcY[n];
+            int32_t y1 = pSrcY[n + 1];
+            pC0[n] += x0 * y0;
+            pC0[n + 1] += x0 * y1;
+            pC1[n] += x1 * y0;
+            pC1[n + 1] += x1 * y1;
+        }
+        if (n < tile.oEnd) {
+            int32_t y0 = pSrcY[n];
+            pC0[n] += x0 * y0;
+            pC1[n] += x1 * y0;
+        }
+    }
+
+    if (m < tile.mEnd) {
+        int32_t x0 = pSrcX[m];
+        int32_t *__restrict__ pC0 = pSrcDstA + m * N;
+        for (n = tile.oStart; n < tile.oEnd; n++) {
+            pC0[n] += x0 * pSrcY[n];
+        }
+    }
+}
+
+/**
+  @} end of MatOuterKernels group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_outer_i32.c
+ * Description:  32-bit integer outer product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatOuter Outer product and rank-1 update
+  This module contains the glue code for the outer product of two vectors, C = x * y^T, and for
+  the rank-1 update of a matrix, A += x * y^T. The kernel codes (kernels) are in the Module Outer
+  product and rank-1 update Kernels.
+
+  Compared to plp_mat_mult with N = 1, the kernels stream over the rows of the output and compute
+  every element with a single multiplication, without any inner loop. The rank-1 update works in
+  place, such that no second matrix is needed. The parallel functions split the output matrix
+  among the cores with plp_mat_partition, such that also a single row uses all cores.
+
+  There are functions for 8, 16 and 32-bit integers (with a 32-bit output) and for 32-bit
+  floating-point numbers, which are only supported on the cluster side.
+ */
+
+/**
+  @addtogroup MatOuter
+  @{
+ */
+
+/**
+  @brief Glue code for the outer product of 32-bit integer vectors, C = x * y^T.
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  pSrcY Points to the input vector y of length N
+  @param[in]  M     Length of x, height of C
+  @param[in]  N     Length of y, width of C
+  @param[out] pDstC Points to the output matrix C of shape MxN
+  @return     none
+ */
+
+void plp_mat_outer_i32(const int32_t *__restrict__ pSrcX,
+                       const int32_t *__restrict__ pSrcY,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_outer_i32s_rv32im(pSrcX, pSrcY, M, N, pDstC);
+    } else {
+        plp_mat_outer_i32s_xpulpv2(pSrcX, pSrcY, M, N, pDstC);
+    }
+}
+
+/**
+  @} end of MatOuter group
+ */
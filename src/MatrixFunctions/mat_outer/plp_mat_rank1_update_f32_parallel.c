@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_rank1_update_f32_parallel.c
+ * Description:  Parallel 32-bit floating-point rank-1 update glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatOuter
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel rank-1 update of 32-bit floating-point vectors, A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in]  nPE   Number of cores to use for computation
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+ */
+
+void plp_mat_rank1_update_f32_parallel(const float *__restrict__ pSrcX,
+                                       const float *__restrict__ pSrcY,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t nPE,
+                                       float *__restrict__ pSrcDstA) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_rank1_update_f32_parallel), M * N);
+        }
+
+        plp_mat_rank1_update_instance_f32 args = { .pSrcX = pSrcX,
+                                                   .pSrcY = pSrcY,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .nPE = nPE,
+                                                   .pSrcDstA = pSrcDstA };
+
+        rt_team_fork(nPE, plp_mat_rank1_update_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatOuter group
+ */
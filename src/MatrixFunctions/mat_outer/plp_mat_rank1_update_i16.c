@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_rank1_update_i16.c
+ * Description:  16-bit integer rank-1 update glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatOuter
+  @{
+ */
+
+/**
+  @brief Glue code for the rank-1 update of 16-bit integer vectors with 32-bit output, A += x * y^T.
+  @param[in]  pSrcX    Points to the input vector x of length M
+  @param[in]  pSrcY    Points to the input vector y of length N
+  @param[in]  M        Length of x, height of A
+  @param[in]  N        Length of y, width of A
+  @param[in,out] pSrcDstA Points to the matrix A of shape MxN, which is updated in place
+  @return     none
+ */
+
+void plp_mat_rank1_update_i16(const int16_t *__restrict__ pSrcX,
+                              const int16_t *__restrict__ pSrcY,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pSrcDstA) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_rank1_update_i16s_rv32im(pSrcX, pSrcY, M, N, pSrcDstA);
+    } else {
+        plp_mat_rank1_update_i16s_xpulpv2(pSrcX, pSrcY, M, N, pSrcDstA);
+    }
+}
+
+/**
+  @} end of MatOuter group
+ */
@@ -0,0 +1,174 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_cmplx_f32p_xpulpv2.c
+ * Description:  Parallel complex 32-bit floating-point QR decomposition kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatQR
+ */
+
+/**
+  @addtogroup MatQRKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place QR decomposition of complex 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_qr_instance_f32 struct initialized by
+                    plp_mat_qr_cmplx_f32_parallel
+  @return     none
+
+  @par Core 0 computes the reflection of every column. Then, every core applies it to its block
+       of columns of R and to its block of rows of Q.
+ */
+
+void plp_mat_qr_cmplx_f32p_xpulpv2(void *args) {
+
+    plp_mat_qr_instance_f32 *a = (plp_mat_qr_instance_f32 *)args;
+
+    float *__restrict__ pR = a->pR;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t K = a->K;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pTmp = a->pTmp;
+    float *__restrict__ pQ = a->pQ;
+
+    float *pV = pTmp;
+    float *pVc = pTmp + 2 * M;
+    float *pW = pTmp + 4 * M;
+    float *pU = pTmp + 4 * M + 2 * N;
+    uint32_t core_id = plp_core_id();
+    uint32_t numRefl = (M == 0) ? 0 : ((K < M - 1) ? K : M - 1);
+    uint32_t rowChunk = (M + nPE - 1) / nPE;
+    uint32_t r0 = core_id * rowChunk;
+    uint32_t r1 = (r0 + rowChunk < M) ? r0 + rowChunk : M;
+    uint32_t i, j, k;
+
+    for (k = 0; k < numRefl; k++) {
+        uint32_t len = M - k;
+
+        if (core_id == 0) {
+            float *pSub = pR + 2 * (k * N + k);
+            float norm2 = 0.0f;
+
+            /* v = column k of R from the diagonal down */
+            for (i = 0; i < len; i++) {
+                float re = pSub[2 * i * N];
+                float im = pSub[2 * i * N + 1];
+                pV[2 * i] = re;
+                pV[2 * i + 1] = im;
+                norm2 += re * re + im * im;
+            }
+
+            if (norm2 == 0.0f) {
+                a->beta = 0.0f;
+            } else {
+                float norm = __builtin_sqrtf(norm2);
+                float x0Re = pV[0];
+                float x0Im = pV[1];
+                float absX0 = __builtin_sqrtf(x0Re * x0Re + x0Im * x0Im);
+
+                /* alpha = -x0 / |x0| * norm, with x0 / |x0| = 1 for x0 = 0 */
+                float phaseRe = (absX0 == 0.0f) ? 1.0f : x0Re / absX0;
+                float phaseIm = (absX0 == 0.0f) ? 0.0f : x0Im / absX0;
+                float alphaRe = -phaseRe * norm;
+                float alphaIm = -phaseIm * norm;
+                a->beta = 1.0f / (norm * (norm + absX0));
+
+                pV[0] = x0Re - alphaRe;
+                pV[1] = x0Im - alphaIm;
+
+                /* conj(v), for v^H * R */
+                for (i = 0; i < len; i++) {
+                    pVc[2 * i] = pV[2 * i];
+                    pVc[2 * i + 1] = -pV[2 * i + 1];
+                }
+
+                /* column k becomes alpha * e1 */
+                pSub[0] = alphaRe;
+                pSub[1] = alphaIm;
+                for (i = 1; i < len; i++) {
+                    pSub[2 * i * N] = 0.0f;
+                    pSub[2 * i * N + 1] = 0.0f;
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        float beta = a->beta;
+
+        if (beta != 0.0f) {
+            uint32_t colChunk = (N - k - 1 + nPE - 1) / nPE;
+            uint32_t c0 = k + 1 + core_id * colChunk;
+            uint32_t c1 = (c0 + colChunk < N) ? c0 + colChunk : N;
+
+            /* R(k:M, c0:c1) -= beta * v * (v^H * R(k:M, c0:c1)) */
+            if (c0 < c1) {
+                plp_mat_mult_cmplx_stride_f32s_xpulpv2(pVc, pR + 2 * (k * N + c0), 1, len, c1 - c0,
+                                                       len, N, c1 - c0, pW + 2 * c0);
+
+                for (i = 0; i < len; i++) {
+                    float bvRe = beta * pV[2 * i];
+                    float bvIm = beta * pV[2 * i + 1];
+                    float *pRow = pR + 2 * (k + i) * N;
+
+                    for (j = c0; j < c1; j++) {
+                        pRow[2 * j] -= bvRe * pW[2 * j] - bvIm * pW[2 * j + 1];
+                        pRow[2 * j + 1] -= bvRe * pW[2 * j + 1] + bvIm * pW[2 * j];
+                    }
+                }
+            }
+
+            /* Q(r0:r1, k:M) -= beta * (Q(r0:r1, k:M) * v) * v^H */
+            if (pQ != NULL && r0 < r1) {
+                plp_mat_mult_cmplx_stride_f32s_xpulpv2(pQ + 2 * (r0 * M + k), pV, r1 - r0, len, 1,
+                                                       M, 1, 1, pU + 2 * r0);
+
+                for (j = r0; j < r1; j++) {
+                    float buRe = beta * pU[2 * j];
+                    float buIm = beta * pU[2 * j + 1];
+                    float *pRow = pQ + 2 * (j * M + k);
+
+                    for (i = 0; i < len; i++) {
+                        pRow[2 * i] -= buRe * pVc[2 * i] - buIm * pVc[2 * i + 1];
+                        pRow[2 * i + 1] -= buRe * pVc[2 * i + 1] + buIm * pVc[2 * i];
+                    }
+                }
+            }
+        }
+
+        plp_team_barrier();
+    }
+}
+
+/**
+  @} end of MatQRKernels group
+ */
@@ -0,0 +1,142 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_f32s_xpulpv2.c
+ * Description:  32-bit floating-point QR decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatQR
+ */
+
+/**
+  @defgroup MatQRKernels QR decomposition kernels
+  This module contains the kernel functions for the QR decomposition. The kernels work in place on
+  R, and reflect only the first K columns, so that further columns (e.g. the right-hand sides of a
+  least-squares problem) are transformed together with them.
+ */
+
+/**
+  @addtogroup MatQRKernels
+  @{
+ */
+
+/**
+  @brief In-place QR decomposition of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in,out] pR   Points to the matrix of shape MxN, which is replaced by R
+  @param[in]     M    Height of R, width and height of Q
+  @param[in]     N    Width of R
+  @param[in]     K    Number of columns to reflect (the first K columns of R become upper
+                      triangular)
+  @param[in]     pTmp Points to a temporary buffer of 2 * M + N floats
+  @param[in,out] pQ   Points to the matrix Q of shape MxM, which is multiplied with the
+                      reflections, or NULL
+  @return     none
+ */
+
+void plp_mat_qr_f32s_xpulpv2(float *__restrict__ pR,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t K,
+                             float *__restrict__ pTmp,
+                             float *__restrict__ pQ) {
+
+    float *pV = pTmp;
+    float *pW = pTmp + M;
+    float *pU = pTmp + M + N;
+    uint32_t numRefl = (M == 0) ? 0 : ((K < M - 1) ? K : M - 1);
+    uint32_t i, j, k;
+
+    for (k = 0; k < numRefl; k++) {
+        uint32_t len = M - k;
+        float *pSub = pR + k * N + k;
+        float norm2 = 0.0f;
+
+        /* v = column k of R from the diagonal down */
+        for (i = 0; i < len; i++) {
+            float x = pSub[i * N];
+            pV[i] = x;
+            norm2 += x * x;
+        }
+
+        if (norm2 == 0.0f) {
+            continue;
+        }
+
+        float norm = __builtin_sqrtf(norm2);
+        float x0 = pV[0];
+        float alpha = (x0 > 0.0f) ? -norm : norm;
+        float beta = 1.0f / (norm * (norm + fabsf(x0)));
+
+        pV[0] = x0 - alpha;
+
+        /* column k becomes alpha * e1 */
+        pSub[0] = alpha;
+        for (i = 1; i < len; i++) {
+            pSub[i * N] = 0.0f;
+        }
+
+        uint32_t c0 = k + 1;
+        uint32_t c1 = N;
+        uint32_t r0 = 0;
+        uint32_t r1 = M;
+
+        /* R(k:M, c0:c1) -= beta * v * (v^T * R(k:M, c0:c1)) */
+        if (c0 < c1) {
+            plp_mat_mult_stride_f32s_xpulpv2(pV, pR + k * N + c0, 1, len, c1 - c0, len, N, c1 - c0,
+                                             pW + c0);
+
+            for (i = 0; i < len; i++) {
+                float bv = beta * pV[i];
+                float *pRow = pR + (k + i) * N;
+
+                for (j = c0; j < c1; j++) {
+                    pRow[j] -= bv * pW[j];
+                }
+            }
+        }
+
+        /* Q(r0:r1, k:M) -= beta * (Q(r0:r1, k:M) * v) * v^T */
+        if (pQ != NULL && r0 < r1) {
+            plp_mat_mult_stride_f32s_xpulpv2(pQ + r0 * M + k, pV, r1 - r0, len, 1, M, 1, 1,
+                                             pU + r0);
+
+            for (j = r0; j < r1; j++) {
+                float bu = beta * pU[j];
+                float *pRow = pQ + j * M + k;
+
+                for (i = 0; i < len; i++) {
+                    pRow[i] -= bu * pV[i];
+                }
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatQRKernels group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lstsq_f32.c
+ * Description:  Glue code for the 32-bit floating-point least squares
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatQR
+  @{
+ */
+
+/**
+  @brief Glue code for least-squares solution of A * X = B of 32-bit floating-point matrices.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcB Points to the right-hand side matrix B of shape MxO
+  @param[in]  M     Height of A and B
+  @param[in]  N     Width of A, height of X
+  @param[in]  O     Width of B and X (number of right-hand sides)
+  @param[out] pDstX Points to the output matrix X of shape NxO
+  @return     0: Success, 1: A does not have full column rank or M < N, 2: operation not supported
+              or not enough memory for the temporary buffer
+
+  @par This function will use plp_mat_qr_f32s_xpulpv2 and
+       plp_mat_solve_tri_upper_stride_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_lstsq_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pDstX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        if (M < N) {
+            return 1;
+        }
+
+        /* W = [A B] is triangularized in place, which gives [R Q^T*B] */
+        uint32_t wSize = M * (N + O) * sizeof(float);
+        uint32_t tmpSize = (2 * M + N + O) * sizeof(float);
+        float *pW = (float *)plp_scratch_alloc(RT_ALLOC_CL_DATA, wSize + tmpSize);
+
+        if (pW == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 2;
+        }
+
+        float *pTmp = pW + M * (N + O);
+
+        plp_mat_copy_stride_f32(pSrcA, M, N, N, N + O, pW);
+        plp_mat_copy_stride_f32(pSrcB, M, O, O, N + O, pW + N);
+
+        plp_mat_qr_f32s_xpulpv2(pW, M, N + O, N, pTmp, NULL);
+
+        /* R * X = Q^T * B */
+        int status = plp_mat_solve_tri_upper_stride_f32s_xpulpv2(pW, pW + N, N, O, N + O, N + O, O,
+                                                                 pDstX);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pW, wSize + tmpSize);
+
+        return status;
+    }
+}
+
+/**
+  @} end of MatQR group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_cmplx_f32.c
+ * Description:  Glue code for the complex 32-bit floating-point QR decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatQR
+  @{
+ */
+
+/**
+  @brief Glue code for QR decomposition of complex 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the complex input matrix A of shape MxN
+  @param[in]  M    Height of A, width and height of Q
+  @param[in]  N    Width of A
+  @param[out] pQ   Points to the complex output matrix Q of shape MxM, or NULL if Q is not needed
+  @param[out] pR   Points to the complex output matrix R of shape MxN
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+
+  @par This function will use plp_mat_qr_cmplx_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_qr_cmplx_f32(const float *__restrict__ pSrc,
+                         uint32_t M,
+                         uint32_t N,
+                         float *__restrict__ pQ,
+                         float *__restrict__ pR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        uint32_t tmpSize = (2 * (3 * M + N) * sizeof(float));
+        float *pTmp = (float *)plp_scratch_alloc(RT_ALLOC_CL_DATA, tmpSize);
+
+        if (pTmp == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 1;
+        }
+
+        /* R = A, Q = I */
+        plp_mat_copy_stride_f32(pSrc, M, 2 * N, 2 * N, 2 * N, pR);
+
+        if (pQ != NULL) {
+            uint32_t i;
+
+            for (i = 0; i < 2 * M * M; i++) {
+                pQ[i] = 0.0f;
+            }
+            for (i = 0; i < M; i++) {
+                pQ[2 * (i * M + i)] = 1.0f;
+            }
+        }
+
+        plp_mat_qr_cmplx_f32s_xpulpv2(pR, M, N, N, pTmp, pQ);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pTmp, tmpSize);
+
+        return 0;
+    }
+}
+
+/**
+  @} end of MatQR group
+ */
@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_f32.c
+ * Description:  Glue code for the 32-bit floating-point QR decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatQR QR decomposition
+  This module contains the glue code for the QR decomposition and the least-squares solution of
+  linear systems. The kernel codes (kernels) are in the Module QR decomposition Kernels.
+
+  The QR decomposition factors a matrix A of shape MxN into
+
+      `A = Q * R`
+
+  where Q is an orthogonal (unitary for complex matrices) matrix of shape MxM, and R an upper
+  triangular matrix of shape MxN. There are functions for real (plp_mat_qr_f32) and complex
+  (plp_mat_qr_cmplx_f32) 32-bit floating-point matrices. Complex matrices are stored with the real
+  and imaginary parts interleaved.
+
+  plp_mat_lstsq_f32 computes the least-squares solution X of A * X = B, which minimizes the norm of
+  A * X - B, for M >= N and O right-hand sides. It triangularizes A and B together, without forming
+  Q, and solves R * X = Q^T * B with plp_mat_solve_tri_upper_stride_f32. Compared to solving the
+  normal equations A^T * A * X = A^T * B, it does not square the condition number of A, and needs
+  no matrix inversion.
+
+  The PULP DSP library only supports the QR decomposition of floating-point matrices, on the
+  cluster side. The functions need a temporary buffer, which is allocated with plp_scratch_alloc.
+
+  @par Algorithm
+  The decomposition uses Householder reflections. For every column k, a reflection
+  H = I - beta * v * v^H is chosen which sets the elements of column k below the diagonal to zero,
+  and it is applied to the remaining columns of R and to Q. The products v^H * R and Q * v are
+  computed with the strided matrix multiplication kernels (plp_mat_mult_stride_f32s_xpulpv2 and
+  plp_mat_mult_cmplx_stride_f32s_xpulpv2). The parallel functions split the columns of R and the
+  rows of Q into one block per core, and need two barriers per column.
+ */
+
+/**
+  @addtogroup MatQR
+  @{
+ */
+
+/**
+  @brief Glue code for QR decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the input matrix A of shape MxN
+  @param[in]  M    Height of A, width and height of Q
+  @param[in]  N    Width of A
+  @param[out] pQ   Points to the output matrix Q of shape MxM, or NULL if Q is not needed
+  @param[out] pR   Points to the output matrix R of shape MxN
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+
+  @par This function will use plp_mat_qr_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_qr_f32(const float *__restrict__ pSrc,
+                   uint32_t M,
+                   uint32_t N,
+                   float *__restrict__ pQ,
+                   float *__restrict__ pR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        uint32_t tmpSize = ((2 * M + N) * sizeof(float));
+        float *pTmp = (float *)plp_scratch_alloc(RT_ALLOC_CL_DATA, tmpSize);
+
+        if (pTmp == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return 1;
+        }
+
+        /* R = A, Q = I */
+        plp_mat_copy_stride_f32(pSrc, M, N, N, N, pR);
+
+        if (pQ != NULL) {
+            plp_mat_fill_I_f32(M, pQ);
+        }
+
+        plp_mat_qr_f32s_xpulpv2(pR, M, N, N, pTmp, pQ);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pTmp, tmpSize);
+
+        return 0;
+    }
+}
+
+/**
+  @} end of MatQR group
+ */
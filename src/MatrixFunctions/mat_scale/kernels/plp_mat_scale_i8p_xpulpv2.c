@@ -52,7 +52,7 @@
 
 void plp_mat_scale_i8p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_scale_instance_i8 *a = (plp_mat_scale_instance_i8 *)args;
 
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_scale_inplace_i16s_rv32im.c
+ * Description:  16-bit integer in-place matrix scale kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatScale
+ */
+
+/**
+  @addtogroup MatScaleKernels
+  @{
+ */
+
+/**
+  @brief In-place matrix scale of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @return        none
+ */
+
+void plp_mat_scale_inplace_i16s_rv32im(int16_t *__restrict__ pSrcDst,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       int16_t scaleFactor,
+                                       int32_t shift) {
+
+    uint32_t blkCnt; /* Loop counter */
+    uint32_t blockSize = M * N;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* A = A * scaleFactor */
+        *pSrcDst = (int16_t)(((int32_t)*pSrcDst * (int32_t)scaleFactor) >> shift);
+        pSrcDst++;
+        *pSrcDst = (int16_t)(((int32_t)*pSrcDst * (int32_t)scaleFactor) >> shift);
+        pSrcDst++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize & 0x1U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        /* A = A * scaleFactor */
+        *pSrcDst = (int16_t)(((int32_t)*pSrcDst * (int32_t)scaleFactor) >> shift);
+        pSrcDst++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of MatScaleKernels group
+ */
@@ -47,6 +47,10 @@
   There are functions for integer 32- 16- and 8-bit data types. For lower precision integers (16-
   and 8-bit), functions exploiting SIMD instructions are provided.
 
+  The output matrix must not overlap with the input matrix, since both pointers are declared
+  `__restrict__`. For scaling a matrix in place, `A *= scale`, use plp_mat_scale_inplace_i32 (and
+  the variants for the other data types), which write the result back to pSrcDst.
+
   The naming scheme of the functions follows the following pattern (for example
   `plp_mat_stride_i32`):
 
@@ -63,6 +63,10 @@ void plp_mat_scale_i8_parallel(const int8_t *__restrict__ pSrc,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_scale_i8_parallel), M * N);
+        }
+
         plp_mat_scale_instance_i8 args = { .pSrc = pSrc,
                                            .M = M,
                                            .N = N,
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_scale_inplace_i16_parallel.c
+ * Description:  16-bit integer parallel in-place matrix scale glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatScale
+  @{
+ */
+
+/**
+  @brief Glue code for parallel in-place matrix scale of 16-bit integer matrices.
+  @param[in,out] pSrcDst     Points to the matrix, which is replaced by the scaled matrix
+  @param[in]     M           Height of the matrix
+  @param[in]     N           Width of the matrix
+  @param[in]     scaleFactor Factor to mulitply all elements before shifting
+  @param[in]     shift       Amount to shift each element
+  @param[in]     nPE         Number of cores to use for computation
+  @return        none
+ */
+
+void plp_mat_scale_inplace_i16_parallel(int16_t *__restrict__ pSrcDst,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int16_t scaleFactor,
+                                        int32_t shift,
+                                        uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_scale_inplace_i16_parallel), M * N);
+        }
+
+        plp_mat_scale_inplace_instance_i16 args = { .pSrcDst = pSrcDst,
+                                                    .M = M,
+                                                    .N = N,
+                                                    .scaleFactor = scaleFactor,
+                                                    .shift = shift,
+                                                    .nPE = nPE };
+
+        rt_team_fork(nPE, plp_mat_scale_inplace_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatScale group
+ */
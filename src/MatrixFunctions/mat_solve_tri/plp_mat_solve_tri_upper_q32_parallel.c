@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_upper_q32_parallel.c
+ * Description:  32-bit fix-point parallel upper triangular solve glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolveTri
+  @{
+ */
+
+/**
+  @brief Glue code for parallel upper triangular solve of 32-bit fix-point matrices.
+  @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+  @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+  @param[in]  N        Width and height of A, height of B and X
+  @param[in]  O        Width of B and X (number of right-hand sides)
+  @param[in]  fracBits Number of fractional bits of all matrices
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDstC    Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_tri_upper_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t fracBits,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return 2;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_solve_tri_upper_q32_parallel), N * N * O);
+        }
+
+        plp_mat_solve_tri_stride_instance_q32 args = { .pSrcA = pSrcA,
+                                                       .pSrcB = pSrcB,
+                                                       .N = N,
+                                                       .O = O,
+                                                       .strideA = N,
+                                                       .strideB = O,
+                                                       .strideC = O,
+                                                       .fracBits = fracBits,
+                                                       .nPE = nPE,
+                                                       .pDstC = pDstC,
+                                                       .status = 0 };
+
+        rt_team_fork(nPE, plp_mat_solve_tri_upper_stride_q32p_xpulpv2, (void *)&args);
+
+        return args.status;
+    }
+}
+
+/**
+  @} end of MatSolveTri group
+ */
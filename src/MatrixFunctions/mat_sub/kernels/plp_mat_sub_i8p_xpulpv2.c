@@ -52,15 +52,12 @@
 
 void plp_mat_sub_i8p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
-
     plp_mat_sub_instance_i8 *a = (plp_mat_sub_instance_i8 *)args;
 
     const int8_t *__restrict__ pSrcA = a->pSrcA;
     const int8_t *__restrict__ pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
-    uint32_t nPE = a->nPE;
     int8_t *__restrict__ pDst = a->pDst;
 
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_sub_inplace_i16s_xpulpv2.c
+ * Description:  16-bit integer in-place matrix subtraction kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSub
+ */
+
+/**
+  @addtogroup MatSubKernels
+  @{
+ */
+
+/**
+  @brief In-place matrix subtraction of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDstA Points to the first input matrix, which is replaced by the difference
+  @param[in]     pSrcB    Points to the second input matrix
+  @param[in]     M        Height of both matrices
+  @param[in]     N        Width of both matrices
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors, and the two differences are computed
+  with a single SIMD instruction.
+ */
+
+void plp_mat_sub_inplace_i16s_xpulpv2(int16_t *__restrict__ pSrcDstA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N) {
+
+    uint32_t blkCnt; /* Loop counter */
+    uint32_t blockSize = M * N;
+    v2s *pA = (v2s *)pSrcDstA;
+    const v2s *pB = (const v2s *)pSrcB;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 vectors at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U) {
+        /* A = A - B */
+        *pA = __SUB2(*pA, *pB++);
+        pA++;
+        *pA = __SUB2(*pA, *pB++);
+        pA++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining vector */
+    if (blockSize & 0x2U) {
+        *pA = __SUB2(*pA, *pB++);
+        pA++;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of vectors */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* A = A - B */
+        *pA = __SUB2(*pA, *pB++);
+        pA++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    /* Compute remaining samples */
+    pSrcDstA = (int16_t *)pA;
+    pSrcB = (const int16_t *)pB;
+    blkCnt = blockSize & 0x1U;
+
+    while (blkCnt > 0U) {
+        *pSrcDstA++ -= *pSrcB++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of MatSubKernels group
+ */
@@ -48,6 +48,10 @@
   functions can also be used for fix-point matrices, if they have their fix-point at the same
   location. The outpt matrix will then also have the fix-point at the same location.
 
+  The output matrix must not overlap with the input matrices, since all pointers are declared
+  `__restrict__`. For updating a matrix in place, `A -= B`, use plp_mat_sub_inplace_i32 (and the
+  variants for the other data types), which write the result back to pSrcDstA.
+
   The naming scheme of the functions follows the following pattern (for example
   `plp_mat_sub_i32`):
 
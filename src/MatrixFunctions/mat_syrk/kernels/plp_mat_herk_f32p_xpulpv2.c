@@ -0,0 +1,178 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_f32p_xpulpv2.c
+ * Description:  parallel Hermitian rank-k product of complex 32-bit float matrices kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* writes the output at row i and column j of C and its conjugate at row j and column i */
+static inline void plp_mat_herk_f32_store(float *__restrict__ pDstC,
+                                          uint32_t M,
+                                          uint32_t i,
+                                          uint32_t j,
+                                          float re,
+                                          float im) {
+    if (i == j) {
+        im = 0.0f; // exactly zero, even if the products were contracted to FMAs
+    }
+    pDstC[(j * M + i) * 2 + 0] = (float)re;
+    pDstC[(j * M + i) * 2 + 1] = (float)-im;
+    pDstC[(i * M + j) * 2 + 0] = (float)re;
+    pDstC[(i * M + j) * 2 + 1] = (float)im;
+}
+
+/* computes the tile of 2x2 outputs at row m and column o of C, o >= m, or the part of it inside C
+   and on or above the diagonal */
+static inline void plp_mat_herk_f32_tile(const float *__restrict__ pSrcA,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t m,
+                                         uint32_t o,
+                                         float *__restrict__ pDstC) {
+
+    uint32_t i; // loop counter for the rows
+    uint32_t j; // loop counter for the columns
+    uint32_t n; // loop counter for N
+
+    if (m + 1 < M && o + 1 < M) {
+        const float *pA0 = pSrcA + m * N * 2;
+        const float *pA1 = pA0 + N * 2;
+        const float *pB0 = pSrcA + o * N * 2;
+        const float *pB1 = pB0 + N * 2;
+
+        float re00 = 0.0f, im00 = 0.0f;
+        float re01 = 0.0f, im01 = 0.0f;
+        float re10 = 0.0f, im10 = 0.0f;
+        float re11 = 0.0f, im11 = 0.0f;
+
+        for (n = 0; n < 2 * N; n += 2) {
+            float a0Re = pA0[n], a0Im = pA0[n + 1];
+            float a1Re = pA1[n], a1Im = pA1[n + 1];
+            float b0Re = pB0[n], b0Im = pB0[n + 1];
+            float b1Re = pB1[n], b1Im = pB1[n + 1];
+
+            re00 += a0Re * b0Re + a0Im * b0Im;
+            im00 += a0Im * b0Re - a0Re * b0Im;
+            re01 += a0Re * b1Re + a0Im * b1Im;
+            im01 += a0Im * b1Re - a0Re * b1Im;
+            re10 += a1Re * b0Re + a1Im * b0Im;
+            im10 += a1Im * b0Re - a1Re * b0Im;
+            re11 += a1Re * b1Re + a1Im * b1Im;
+            im11 += a1Im * b1Re - a1Re * b1Im;
+        }
+
+        /* on the diagonal tile, output 10 is the conjugate of output 01 and is overwritten by it */
+        plp_mat_herk_f32_store(pDstC, M, m + 1, o, re10, im10);
+        plp_mat_herk_f32_store(pDstC, M, m, o, re00, im00);
+        plp_mat_herk_f32_store(pDstC, M, m, o + 1, re01, im01);
+        plp_mat_herk_f32_store(pDstC, M, m + 1, o + 1, re11, im11);
+    } else {
+        /* tile at the last row or column of C for odd M: at most three outputs */
+        for (i = m; i < m + 2 && i < M; i++) {
+            for (j = (o > i) ? o : i; j < o + 2 && j < M; j++) {
+                float re = 0.0f;
+                float im = 0.0f;
+                for (n = 0; n < N; n++) {
+                    float aRe = pSrcA[(i * N + n) * 2 + 0];
+                    float aIm = pSrcA[(i * N + n) * 2 + 1];
+                    float bRe = pSrcA[(j * N + n) * 2 + 0];
+                    float bIm = pSrcA[(j * N + n) * 2 + 1];
+                    re += aRe * bRe + aIm * bIm;
+                    im += aIm * bRe - aRe * bIm;
+                }
+                plp_mat_herk_f32_store(pDstC, M, i, j, re, im);
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+   @brief      Parallel Hermitian rank-k product of complex 32-bit floating-point matrices kernel
+               for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_f32 struct initialized by
+                     plp_mat_herk_f32_parallel
+   @return     none
+
+   @par Blocking
+   Only the outputs on and above the diagonal are computed, in tiles of 2x2 outputs, and written
+   to their mirrors below the diagonal as well. Every value loaded from A is used in two
+   multiplications.
+
+   @par Load Balancing
+   The tiles on and above the diagonal are numbered row by row, and each core computes a range of
+   consecutive tiles of the same length. Splitting the rows of C instead would give the cores with
+   the first rows almost twice the average work.
+*/
+
+void plp_mat_herk_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_syrk_instance_f32 *arguments = (plp_mat_syrk_instance_f32 *)args;
+    const float *__restrict__ pSrcA = arguments->pSrcA;
+    uint32_t M = arguments->M;
+    uint32_t N = arguments->N;
+    uint32_t nPE = arguments->nPE;
+    float *__restrict__ pDstC = arguments->pDstC;
+
+    uint32_t nB = (M + 1) >> 1;             // number of tile rows
+    uint32_t numTiles = nB * (nB + 1) >> 1; // number of tiles on and above the diagonal
+    uint32_t tStart = core_id * numTiles / nPE;
+    uint32_t tEnd = (core_id + 1) * numTiles / nPE;
+    uint32_t b = 0;                         // tile row, which has nB - b tiles
+    uint32_t t = tStart;                    // tile in the tile row
+    uint32_t k;                             // loop counter
+
+    while (t >= nB - b) {
+        t -= nB - b;
+        b++;
+    }
+
+    for (k = tStart; k < tEnd; k++) {
+        plp_mat_herk_f32_tile(pSrcA, M, N, 2 * b, 2 * (b + t), pDstC);
+
+        t++;
+        if (t == nB - b) {
+            t = 0;
+            b++;
+        }
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of MatSyrkKernels group
+*/
@@ -0,0 +1,170 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_i16s_xpulpv2.c
+ * Description:  Hermitian rank-k product of complex 16-bit integer matrices kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* writes the output at row i and column j of C and its conjugate at row j and column i */
+static inline void plp_mat_herk_i16_store(int32_t *__restrict__ pDstC,
+                                          uint32_t M,
+                                          uint32_t i,
+                                          uint32_t j,
+                                          int32_t re,
+                                          int32_t im) {
+    pDstC[(j * M + i) * 2 + 0] = (int32_t)re;
+    pDstC[(j * M + i) * 2 + 1] = (int32_t)-im;
+    pDstC[(i * M + j) * 2 + 0] = (int32_t)re;
+    pDstC[(i * M + j) * 2 + 1] = (int32_t)im;
+}
+
+/* computes the tile of 2x2 outputs at row m and column o of C, o >= m, or the part of it inside C
+   and on or above the diagonal */
+static inline void plp_mat_herk_i16_tile(const int16_t *__restrict__ pSrcA,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t m,
+                                         uint32_t o,
+                                         int32_t *__restrict__ pDstC) {
+
+    uint32_t i; // loop counter for the rows
+    uint32_t j; // loop counter for the columns
+    uint32_t n; // loop counter for N
+    v2s mask = (v2s){ 0, -1 };
+    v2s swap = (v2s){ 1, 0 };
+
+    if (m + 1 < M && o + 1 < M) {
+        const int16_t *pA0 = pSrcA + m * N * 2;
+        const int16_t *pA1 = pA0 + N * 2;
+        const int16_t *pB0 = pSrcA + o * N * 2;
+        const int16_t *pB1 = pB0 + N * 2;
+
+        int32_t re00 = 0, im00 = 0;
+        int32_t re01 = 0, im01 = 0;
+        int32_t re10 = 0, im10 = 0;
+        int32_t re11 = 0, im11 = 0;
+        int32_t sumRe0 = 0; // sum of the real parts of row m, see below
+        int32_t sumRe1 = 0; // sum of the real parts of row m + 1
+
+        for (n = 0; n < 2 * N; n += 2) {
+            v2s aVec0 = *((v2s *)&(pA0[n]));
+            v2s aVec1 = *((v2s *)&(pA1[n]));
+            v2s bVec0 = *((v2s *)&(pB0[n]));
+            v2s bVec1 = *((v2s *)&(pB1[n]));
+            v2s bConj0 = __builtin_shuffle(bVec0 ^ mask, swap);
+            v2s bConj1 = __builtin_shuffle(bVec1 ^ mask, swap);
+
+            re00 = __SUMDOTP2(aVec0, bVec0, re00);
+            im00 = __SUMDOTP2(aVec0, bConj0, im00);
+            re01 = __SUMDOTP2(aVec0, bVec1, re01);
+            im01 = __SUMDOTP2(aVec0, bConj1, im01);
+            re10 = __SUMDOTP2(aVec1, bVec0, re10);
+            im10 = __SUMDOTP2(aVec1, bConj0, im10);
+            re11 = __SUMDOTP2(aVec1, bVec1, re11);
+            im11 = __SUMDOTP2(aVec1, bConj1, im11);
+            sumRe0 += aVec0[0];
+            sumRe1 += aVec1[0];
+        }
+
+        /* a * ~d = -a * d - a, add the real parts of A back */
+        im00 += sumRe0;
+        im01 += sumRe0;
+        im10 += sumRe1;
+        im11 += sumRe1;
+
+        /* on the diagonal tile, output 10 is the conjugate of output 01 and is overwritten by it */
+        plp_mat_herk_i16_store(pDstC, M, m + 1, o, re10, im10);
+        plp_mat_herk_i16_store(pDstC, M, m, o, re00, im00);
+        plp_mat_herk_i16_store(pDstC, M, m, o + 1, re01, im01);
+        plp_mat_herk_i16_store(pDstC, M, m + 1, o + 1, re11, im11);
+    } else {
+        /* tile at the last row or column of C for odd M: at most three outputs */
+        for (i = m; i < m + 2 && i < M; i++) {
+            for (j = (o > i) ? o : i; j < o + 2 && j < M; j++) {
+                int32_t re = 0;
+                int32_t im = 0;
+                for (n = 0; n < N; n++) {
+                    int32_t aRe = pSrcA[(i * N + n) * 2 + 0];
+                    int32_t aIm = pSrcA[(i * N + n) * 2 + 1];
+                    int32_t bRe = pSrcA[(j * N + n) * 2 + 0];
+                    int32_t bIm = pSrcA[(j * N + n) * 2 + 1];
+                    re += aRe * bRe + aIm * bIm;
+                    im += aIm * bRe - aRe * bIm;
+                }
+                plp_mat_herk_i16_store(pDstC, M, i, j, re, im);
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+   @brief      Hermitian rank-k product of complex 16-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  pSrcA     points to the input matrix of shape MxN, complex
+   @param[in]  M         height of the input matrix, height and width of the output matrix
+   @param[in]  N         width of the input matrix
+   @param[out] pDstC     points to the output matrix of shape MxM, complex
+   @return     none
+
+   @par Blocking
+   Only the outputs on and above the diagonal are computed, in tiles of 2x2 outputs, and written
+   to their mirrors below the diagonal as well. Every value loaded from A is used in two
+   multiplications.
+
+   @par Exploiting SIMD instructions
+   The real and imaginary part of a complex value are packed into one 32-bit vector. The real part
+   of a * conj(b) is the dot product of the two vectors, the imaginary part the dot product of a
+   with (~b_im, b_re) plus a_re, since a_re * ~b_im = -a_re * b_im - a_re. Each part takes one
+   pv.sdotsp.h instruction.
+*/
+
+void plp_mat_herk_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+    uint32_t o; // loop counter for the columns on and above the diagonal
+
+    for (m = 0; m < M; m += 2) {
+        for (o = m; o < M; o += 2) {
+            plp_mat_herk_i16_tile(pSrcA, M, N, m, o, pDstC);
+        }
+    }
+}
+
+/**
+   @} end of MatSyrkKernels group
+*/
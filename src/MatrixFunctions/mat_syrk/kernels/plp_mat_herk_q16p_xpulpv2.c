@@ -0,0 +1,190 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_q16p_xpulpv2.c
+ * Description:  parallel Hermitian rank-k product of complex 16-bit fixed-point matrices kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* writes the output at row i and column j of C and its conjugate at row j and column i */
+static inline void plp_mat_herk_q16_store(int16_t *__restrict__ pDstC,
+                                          uint32_t M,
+                                          uint32_t i,
+                                          uint32_t j,
+                                          int32_t re,
+                                          int32_t im) {
+    pDstC[(j * M + i) * 2 + 0] = (int16_t)re;
+    pDstC[(j * M + i) * 2 + 1] = (int16_t)-im;
+    pDstC[(i * M + j) * 2 + 0] = (int16_t)re;
+    pDstC[(i * M + j) * 2 + 1] = (int16_t)im;
+}
+
+/* computes the tile of 2x2 outputs at row m and column o of C, o >= m, or the part of it inside C
+   and on or above the diagonal */
+static inline void plp_mat_herk_q16_tile(const int16_t *__restrict__ pSrcA,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         uint32_t m,
+                                         uint32_t o,
+                                         int16_t *__restrict__ pDstC) {
+
+    uint32_t i; // loop counter for the rows
+    uint32_t j; // loop counter for the columns
+    uint32_t n; // loop counter for N
+    v2s mask = (v2s){ 0, -1 };
+    v2s swap = (v2s){ 1, 0 };
+    int32_t rnd = shift ? 1 << (shift - 1) : 0;
+
+    if (m + 1 < M && o + 1 < M) {
+        const int16_t *pA0 = pSrcA + m * N * 2;
+        const int16_t *pA1 = pA0 + N * 2;
+        const int16_t *pB0 = pSrcA + o * N * 2;
+        const int16_t *pB1 = pB0 + N * 2;
+
+        int32_t re00 = 0, im00 = 0;
+        int32_t re01 = 0, im01 = 0;
+        int32_t re10 = 0, im10 = 0;
+        int32_t re11 = 0, im11 = 0;
+
+        for (n = 0; n < 2 * N; n += 2) {
+            v2s aVec0 = *((v2s *)&(pA0[n]));
+            v2s aVec1 = *((v2s *)&(pA1[n]));
+            v2s bVec0 = *((v2s *)&(pB0[n]));
+            v2s bVec1 = *((v2s *)&(pB1[n]));
+            v2s bConj0 = __builtin_shuffle(bVec0 ^ mask, swap);
+            v2s bConj1 = __builtin_shuffle(bVec1 ^ mask, swap);
+            int32_t rnd0 = rnd + aVec0[0]; // a * ~d = -a * d - a, add the real part back
+            int32_t rnd1 = rnd + aVec1[0];
+
+            re00 += __SUMDOTP2(aVec0, bVec0, rnd) >> shift;
+            im00 += __SUMDOTP2(aVec0, bConj0, rnd0) >> shift;
+            re01 += __SUMDOTP2(aVec0, bVec1, rnd) >> shift;
+            im01 += __SUMDOTP2(aVec0, bConj1, rnd0) >> shift;
+            re10 += __SUMDOTP2(aVec1, bVec0, rnd) >> shift;
+            im10 += __SUMDOTP2(aVec1, bConj0, rnd1) >> shift;
+            re11 += __SUMDOTP2(aVec1, bVec1, rnd) >> shift;
+            im11 += __SUMDOTP2(aVec1, bConj1, rnd1) >> shift;
+        }
+
+        /* on the diagonal tile, output 10 is the conjugate of output 01 and is overwritten by it */
+        plp_mat_herk_q16_store(pDstC, M, m + 1, o, re10, im10);
+        plp_mat_herk_q16_store(pDstC, M, m, o, re00, im00);
+        plp_mat_herk_q16_store(pDstC, M, m, o + 1, re01, im01);
+        plp_mat_herk_q16_store(pDstC, M, m + 1, o + 1, re11, im11);
+    } else {
+        /* tile at the last row or column of C for odd M: at most three outputs */
+        for (i = m; i < m + 2 && i < M; i++) {
+            for (j = (o > i) ? o : i; j < o + 2 && j < M; j++) {
+                int32_t re = 0;
+                int32_t im = 0;
+                for (n = 0; n < N; n++) {
+                    int32_t aRe = pSrcA[(i * N + n) * 2 + 0];
+                    int32_t aIm = pSrcA[(i * N + n) * 2 + 1];
+                    int32_t bRe = pSrcA[(j * N + n) * 2 + 0];
+                    int32_t bIm = pSrcA[(j * N + n) * 2 + 1];
+                    re += (aRe * bRe + aIm * bIm + rnd) >> shift;
+                    im += (aIm * bRe - aRe * bIm + rnd) >> shift;
+                }
+                plp_mat_herk_q16_store(pDstC, M, i, j, re, im);
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+   @brief      Parallel Hermitian rank-k product of complex 16-bit fixed-point matrices kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_q16 struct initialized by
+                     plp_mat_herk_q16_parallel
+   @return     none
+
+   @par Blocking
+   Only the outputs on and above the diagonal are computed, in tiles of 2x2 outputs, and written
+   to their mirrors below the diagonal as well. Every value loaded from A is used in two
+   multiplications.
+
+   @par Exploiting SIMD instructions
+   The real and imaginary part of a complex value are packed into one 32-bit vector. The real part
+   of a * conj(b) is the dot product of the two vectors, the imaginary part the dot product of a
+   with (~b_im, b_re) plus a_re, since a_re * ~b_im = -a_re * b_im - a_re. Each part takes one
+   pv.sdotsp.h instruction.
+
+   @par Load Balancing
+   The tiles on and above the diagonal are numbered row by row, and each core computes a range of
+   consecutive tiles of the same length. Splitting the rows of C instead would give the cores with
+   the first rows almost twice the average work.
+*/
+
+void plp_mat_herk_q16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_syrk_instance_q16 *arguments = (plp_mat_syrk_instance_q16 *)args;
+    const int16_t *__restrict__ pSrcA = arguments->pSrcA;
+    uint32_t M = arguments->M;
+    uint32_t N = arguments->N;
+    uint32_t shift = arguments->shift;
+    uint32_t nPE = arguments->nPE;
+    int16_t *__restrict__ pDstC = arguments->pDstC;
+
+    uint32_t nB = (M + 1) >> 1;             // number of tile rows
+    uint32_t numTiles = nB * (nB + 1) >> 1; // number of tiles on and above the diagonal
+    uint32_t tStart = core_id * numTiles / nPE;
+    uint32_t tEnd = (core_id + 1) * numTiles / nPE;
+    uint32_t b = 0;                         // tile row, which has nB - b tiles
+    uint32_t t = tStart;                    // tile in the tile row
+    uint32_t k;                             // loop counter
+
+    while (t >= nB - b) {
+        t -= nB - b;
+        b++;
+    }
+
+    for (k = tStart; k < tEnd; k++) {
+        plp_mat_herk_q16_tile(pSrcA, M, N, shift, 2 * b, 2 * (b + t), pDstC);
+
+        t++;
+        if (t == nB - b) {
+            t = 0;
+            b++;
+        }
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of MatSyrkKernels group
+*/
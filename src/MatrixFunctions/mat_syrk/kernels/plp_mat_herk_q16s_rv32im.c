@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_q16s_rv32im.c
+ * Description:  Hermitian rank-k product of complex 16-bit fixed-point matrices kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+   @brief      Hermitian rank-k product of complex 16-bit fixed-point matrices kernel for RV32IM
+               extension.
+   @param[in]  pSrcA     points to the input matrix of shape MxN, complex
+   @param[in]  M         height of the input matrix, height and width of the output matrix
+   @param[in]  N         width of the input matrix
+   @param[in]  shift     Amount to shift the result of each multiplication
+   @param[out] pDstC     points to the output matrix of shape MxM, complex
+   @return     none
+*/
+
+void plp_mat_herk_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for the columns on and above the diagonal
+    int32_t rnd = shift ? 1 << (shift - 1) : 0;
+
+    for (m = 0; m < M; m++) {
+        for (o = m; o < M; o++) {
+            int32_t sumRe = 0;
+            int32_t sumIm = 0;
+            for (n = 0; n < N; n++) {
+                int32_t aRe = (int32_t)pSrcA[(m * N + n) * 2 + 0];
+                int32_t aIm = (int32_t)pSrcA[(m * N + n) * 2 + 1];
+                int32_t bRe = (int32_t)pSrcA[(o * N + n) * 2 + 0];
+                int32_t bIm = (int32_t)pSrcA[(o * N + n) * 2 + 1];
+                sumRe += (aRe * bRe + aIm * bIm + rnd) >> shift;
+                sumIm += (aIm * bRe - aRe * bIm + rnd) >> shift;
+            }
+            pDstC[(o * M + m) * 2 + 0] = (int16_t)sumRe;
+            pDstC[(o * M + m) * 2 + 1] = (int16_t)-sumIm;
+            pDstC[(m * M + o) * 2 + 0] = (int16_t)sumRe;
+            pDstC[(m * M + o) * 2 + 1] = (int16_t)sumIm;
+        }
+    }
+}
+
+/**
+   @} end of MatSyrkKernels group
+*/
@@ -0,0 +1,149 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_i16s_xpulpv2.c
+ * Description:  symmetric rank-k product of 16-bit integer matrices kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* writes the output at row i and column j of C and its mirror at row j and column i */
+static inline void plp_mat_syrk_i16_store(int32_t *__restrict__ pDstC,
+                                          uint32_t M,
+                                          uint32_t i,
+                                          uint32_t j,
+                                          int32_t sum) {
+    pDstC[j * M + i] = (int32_t)sum;
+    pDstC[i * M + j] = (int32_t)sum;
+}
+
+/* computes the tile of 2x2 outputs at row m and column o of C, o >= m, or the part of it inside C
+   and on or above the diagonal */
+static inline void plp_mat_syrk_i16_tile(const int16_t *__restrict__ pSrcA,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t m,
+                                         uint32_t o,
+                                         int32_t *__restrict__ pDstC) {
+
+    uint32_t i; // loop counter for the rows
+    uint32_t j; // loop counter for the columns
+    uint32_t n; // loop counter for N
+    uint32_t nEnd = N & ~0x1;
+
+    if (m + 1 < M && o + 1 < M) {
+        const int16_t *pA0 = pSrcA + m * N;
+        const int16_t *pA1 = pA0 + N;
+        const int16_t *pB0 = pSrcA + o * N;
+        const int16_t *pB1 = pB0 + N;
+
+        int32_t sum00 = 0;
+        int32_t sum01 = 0;
+        int32_t sum10 = 0;
+        int32_t sum11 = 0;
+
+        for (n = 0; n < nEnd; n += 2) {
+            v2s aVec0 = *((v2s *)&(pA0[n]));
+            v2s aVec1 = *((v2s *)&(pA1[n]));
+            v2s bVec0 = *((v2s *)&(pB0[n]));
+            v2s bVec1 = *((v2s *)&(pB1[n]));
+
+            sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+            sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+            sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+            sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+        }
+
+        // clean up for n
+        for (; n < N; n++) {
+            sum00 += pA0[n] * pB0[n];
+            sum01 += pA0[n] * pB1[n];
+            sum10 += pA1[n] * pB0[n];
+            sum11 += pA1[n] * pB1[n];
+        }
+
+        /* on the diagonal tile, sum10 is the mirror of sum01 and is overwritten by it */
+        plp_mat_syrk_i16_store(pDstC, M, m + 1, o, sum10);
+        plp_mat_syrk_i16_store(pDstC, M, m, o, sum00);
+        plp_mat_syrk_i16_store(pDstC, M, m, o + 1, sum01);
+        plp_mat_syrk_i16_store(pDstC, M, m + 1, o + 1, sum11);
+    } else {
+        /* tile at the last row or column of C for odd M: at most three outputs */
+        for (i = m; i < m + 2 && i < M; i++) {
+            for (j = (o > i) ? o : i; j < o + 2 && j < M; j++) {
+                int32_t sum = 0;
+                for (n = 0; n < N; n++) {
+                    sum += (int32_t)pSrcA[i * N + n] * (int32_t)pSrcA[j * N + n];
+                }
+                plp_mat_syrk_i16_store(pDstC, M, i, j, sum);
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+   @brief      Symmetric rank-k product of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcA     points to the input matrix of shape MxN
+   @param[in]  M         height of the input matrix, height and width of the output matrix
+   @param[in]  N         width of the input matrix
+   @param[out] pDstC     points to the output matrix of shape MxM
+   @return     none
+
+   @par Blocking
+   Only the outputs on and above the diagonal are computed, in tiles of 2x2 outputs, and written
+   to their mirrors below the diagonal as well. Every value loaded from A is used in two
+   multiplications.
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_syrk_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+    uint32_t o; // loop counter for the columns on and above the diagonal
+
+    for (m = 0; m < M; m += 2) {
+        for (o = m; o < M; o += 2) {
+            plp_mat_syrk_i16_tile(pSrcA, M, N, m, o, pDstC);
+        }
+    }
+}
+
+/**
+   @} end of MatSyrkKernels group
+*/
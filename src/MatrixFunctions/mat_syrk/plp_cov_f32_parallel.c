@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cov_f32_parallel.c
+ * Description:  parallel covariance matrix of 32-bit float vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel covariance matrix of 32-bit floating-point vectors.
+  @param[in]  pSrc      points to the M input vectors of length N, as rows of a matrix of MxN
+  @param[in]  M         number of vectors, height and width of the output matrix
+  @param[in]  N         length of the vectors (number of observations), at least 2
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output matrix of shape MxM
+  @return     0: Success, 1: Not enough memory for the temporary buffer, 2: operation not supported
+
+  The output at row i and column j is the sample covariance of the vectors i and j, with the
+  denominator N - 1. The calling core removes the means from a copy of the vectors in a temporary
+  buffer of M * N values (see plp_scratch_init), then the product of the centered matrix with its
+  transpose is computed with plp_mat_syrk_f32_parallel.
+ */
+
+int plp_cov_f32_parallel(const float *__restrict__ pSrc,
+                         uint32_t M,
+                         uint32_t N,
+                         uint32_t nPE,
+                         float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    }
+
+    if (nPE == PLP_AUTO) {
+        nPE = plp_auto_npe(PLP_AUTO_ID(plp_cov_f32_parallel), M * M * N / 2);
+    }
+
+    uint32_t m; // loop counter for the vectors
+    uint32_t scratchSize = M * N * sizeof(float32_t);
+    float32_t *pCentered = (float32_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, scratchSize);
+
+    if (pCentered == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return 1;
+    }
+
+    for (m = 0; m < M; m++) {
+        float32_t mean;
+        plp_mean_f32s_xpulpv2(pSrc + m * N, N, &mean);
+        plp_offset_f32s_xpulpv2(pSrc + m * N, -mean, pCentered + m * N, N);
+    }
+
+    plp_mat_syrk_f32_parallel(pCentered, M, N, nPE, pDst);
+    plp_scale_f32_parallel(pDst, 1.0f / (float32_t)(N - 1), pDst, M * M, nPE);
+
+    plp_scratch_free(RT_ALLOC_CL_DATA, pCentered, scratchSize);
+
+    return 0;
+}
+
+/**
+  @} end of MatSyrk group
+ */
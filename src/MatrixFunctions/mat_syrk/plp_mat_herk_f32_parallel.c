@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_f32_parallel.c
+ * Description:  parallel Hermitian rank-k product of complex 32-bit float matrices glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for parallel Hermitian rank-k product of complex 32-bit floating-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN, complex
+  @param[in]  M         height of the input matrix, height and width of the output matrix
+  @param[in]  N         width of the input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix of shape MxM, complex
+  @return     none
+ */
+
+void plp_mat_herk_f32_parallel(const float *__restrict__ pSrcA,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_herk_f32_parallel), M * M * N / 2);
+        }
+
+        plp_mat_syrk_instance_f32 args = {
+            .pSrcA = pSrcA, .M = M, .N = N, .nPE = nPE, .pDstC = pDstC
+        };
+        rt_team_fork(nPE, plp_mat_herk_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatSyrk group
+ */
@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_i16.c
+ * Description:  Hermitian rank-k product of complex 16-bit integer matrices glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for Hermitian rank-k product of complex 16-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN, complex
+  @param[in]  M         height of the input matrix, height and width of the output matrix
+  @param[in]  N         width of the input matrix
+  @param[out] pDstC     points to the output matrix of shape MxM, complex
+  @return     none
+ */
+
+void plp_mat_herk_i16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_herk_i16s_rv32im(pSrcA, M, N, pDstC);
+    } else {
+        plp_mat_herk_i16s_xpulpv2(pSrcA, M, N, pDstC);
+    }
+}
+
+/**
+  @} end of MatSyrk group
+ */
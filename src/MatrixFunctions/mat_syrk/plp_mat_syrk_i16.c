@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_i16.c
+ * Description:  symmetric rank-k product of 16-bit integer matrices glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSyrk Symmetric Rank-k Product
+  This module contains the glue code for the product of a matrix with its own transpose
+
+      C = A * A^T (plp_mat_syrk)   or   C = A * A^H (plp_mat_herk, complex matrices),
+
+  i.e. the Gram matrix of the rows of A, and for the covariance matrix of the rows of A (plp_cov).
+  A is a matrix of MxN and C of MxM. The outputs are of the same type as those of
+  plp_mat_mult_trans with B = A. The kernel codes (kernels) are in the Module Symmetric Rank-k
+  Product Kernels.
+
+  Since C is symmetric (Hermitian for plp_mat_herk), only the outputs on and above the diagonal are
+  computed, in blocks of 2x2 outputs, and each one is written to its mirror below the diagonal as
+  well (conjugated for plp_mat_herk). This takes about half the multiplications of
+  plp_mat_mult_trans. The parallel kernels split the blocks on and above the diagonal evenly among
+  the cores, and not the rows of C, whose parts on and above the diagonal shrink from M to 1
+  outputs.
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for symmetric rank-k product of 16-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  M         height of the input matrix, height and width of the output matrix
+  @param[in]  N         width of the input matrix
+  @param[out] pDstC     points to the output matrix of shape MxM
+  @return     none
+ */
+
+void plp_mat_syrk_i16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_syrk_i16s_rv32im(pSrcA, M, N, pDstC);
+    } else {
+        plp_mat_syrk_i16s_xpulpv2(pSrcA, M, N, pDstC);
+    }
+}
+
+/**
+  @} end of MatSyrk group
+ */
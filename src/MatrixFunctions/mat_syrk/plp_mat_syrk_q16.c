@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_q16.c
+ * Description:  symmetric rank-k product of 16-bit fixed-point matrices glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for symmetric rank-k product of 16-bit fixed-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  M         height of the input matrix, height and width of the output matrix
+  @param[in]  N         width of the input matrix
+  @param[in]  shift     Amount to shift the result of each multiplication
+  @param[out] pDstC     points to the output matrix of shape MxM
+  @return     none
+
+  @par Fix-Point and Shifting
+  The result of each multiplication is shifted by the parameter `shift` to the right, as in
+  plp_mat_mult_trans_q16. If the input is represented as pSrcA * 2^-x, the output is represented
+  as pDstC * 2^-(2x - shift). Set the `shift` parameter such that no overflow occurs.
+ */
+
+void plp_mat_syrk_q16(const int16_t *__restrict__ pSrcA,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_syrk_q16s_rv32im(pSrcA, M, N, shift, pDstC);
+    } else {
+        plp_mat_syrk_q16s_xpulpv2(pSrcA, M, N, shift, pDstC);
+    }
+}
+
+/**
+  @} end of MatSyrk group
+ */
@@ -30,6 +30,11 @@
 
 #include "plp_math.h"
 
+#define shufflemask1                                                                               \
+    (v2s) { 0, 2 }
+#define shufflemask2                                                                               \
+    (v2s) { 1, 3 }
+
 /**
   @ingroup MatTrans
  */
@@ -46,13 +51,15 @@
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in blocks of 2x2 elements. Two rows of a block are loaded as 16 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word. Each core works on every nPE-th block row of the input, which makes
+  the cores write to neighbouring words (hence to different memory banks) of the output rows.
 */
 
 void plp_mat_trans_i16p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_trans_instance_i16 *a = (plp_mat_trans_instance_i16 *)args;
 
@@ -62,7 +69,7 @@ void plp_mat_trans_i16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int16_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = core_id; m < M; m += nPE) {
@@ -73,7 +80,30 @@ void plp_mat_trans_i16p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    uint32_t M2 = M & ~0x1;
+    uint32_t N2 = N & ~0x1;
+
+    int m, n;
+
+    for (m = core_id * 2; m < M2; m += nPE * 2) {
+        const int16_t *pSrc0 = pSrc + m * N;
+        for (n = 0; n < N2; n += 2) {
+            v2s r0 = *((v2s *)&pSrc0[n]);
+            v2s r1 = *((v2s *)&pSrc0[N + n]);
+            *((v2s *)&pDst[n * M + m]) = __builtin_shuffle(r0, r1, shufflemask1);
+            *((v2s *)&pDst[(n + 1) * M + m]) = __builtin_shuffle(r0, r1, shufflemask2);
+        }
+        for (; n < N; n++) {
+            pDst[n * M + m] = pSrc0[n];
+            pDst[n * M + m + 1] = pSrc0[N + n];
+        }
+    }
+
+    for (m = M2 + core_id; m < M; m += nPE) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
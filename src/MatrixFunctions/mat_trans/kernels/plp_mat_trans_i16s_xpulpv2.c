@@ -30,6 +30,11 @@
 
 #include "plp_math.h"
 
+#define shufflemask1                                                                               \
+    (v2s) { 0, 2 }
+#define shufflemask2                                                                               \
+    (v2s) { 1, 3 }
+
 /**
   @ingroup MatTrans
  */
@@ -46,6 +51,11 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 2x2 elements. Two rows of a block are loaded as 16 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word.
  */
 
 void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
@@ -53,7 +63,7 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                                 uint32_t N,
                                 int16_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,7 +74,30 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t M2 = M & ~0x1;
+    uint32_t N2 = N & ~0x1;
+
+    int m, n;
+
+    for (m = 0; m < M2; m += 2) {
+        const int16_t *pSrc0 = pSrc + m * N;
+        for (n = 0; n < N2; n += 2) {
+            v2s r0 = *((v2s *)&pSrc0[n]);
+            v2s r1 = *((v2s *)&pSrc0[N + n]);
+            *((v2s *)&pDst[n * M + m]) = __builtin_shuffle(r0, r1, shufflemask1);
+            *((v2s *)&pDst[(n + 1) * M + m]) = __builtin_shuffle(r0, r1, shufflemask2);
+        }
+        for (; n < N; n++) {
+            pDst[n * M + m] = pSrc0[n];
+            pDst[n * M + m + 1] = pSrc0[N + n];
+        }
+    }
+
+    for (m = M2; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
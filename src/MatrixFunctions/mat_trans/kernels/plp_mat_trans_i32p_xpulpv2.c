@@ -44,11 +44,16 @@
   @param[in]  args  pointer to plp_mat_trans_instance_i32 struct initialized by
                     plp_mat_trans_i32_parallel
   @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead. Each core
+  works on every nPE-th block row of the input, which makes the cores write to neighbouring words
+  (hence to different memory banks) of the output rows.
  */
 
 void plp_mat_trans_i32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_trans_instance_i32 *a = (plp_mat_trans_instance_i32 *)args;
 
@@ -58,7 +63,7 @@ void plp_mat_trans_i32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = core_id; m < M; m += nPE) {
@@ -69,7 +74,34 @@ void plp_mat_trans_i32p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    uint32_t M2 = M & ~0x1;
+    uint32_t N2 = N & ~0x1;
+
+    int m, n;
+
+    for (m = core_id * 2; m < M2; m += nPE * 2) {
+        const int32_t *pSrc0 = pSrc + m * N;
+        for (n = 0; n < N2; n += 2) {
+            int32_t a00 = pSrc0[n];
+            int32_t a01 = pSrc0[n + 1];
+            int32_t a10 = pSrc0[N + n];
+            int32_t a11 = pSrc0[N + n + 1];
+            pDst[n * M + m] = a00;
+            pDst[n * M + m + 1] = a10;
+            pDst[(n + 1) * M + m] = a01;
+            pDst[(n + 1) * M + m + 1] = a11;
+        }
+        for (; n < N; n++) {
+            pDst[n * M + m] = pSrc0[n];
+            pDst[n * M + m + 1] = pSrc0[N + n];
+        }
+    }
+
+    for (m = M2 + core_id; m < M; m += nPE) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
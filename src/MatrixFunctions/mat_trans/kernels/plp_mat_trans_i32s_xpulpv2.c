@@ -46,6 +46,9 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
  */
 
 void plp_mat_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
@@ -53,7 +56,7 @@ void plp_mat_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
                                 uint32_t N,
                                 int32_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,7 +67,34 @@ void plp_mat_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t M2 = M & ~0x1;
+    uint32_t N2 = N & ~0x1;
+
+    int m, n;
+
+    for (m = 0; m < M2; m += 2) {
+        const int32_t *pSrc0 = pSrc + m * N;
+        for (n = 0; n < N2; n += 2) {
+            int32_t a00 = pSrc0[n];
+            int32_t a01 = pSrc0[n + 1];
+            int32_t a10 = pSrc0[N + n];
+            int32_t a11 = pSrc0[N + n + 1];
+            pDst[n * M + m] = a00;
+            pDst[n * M + m + 1] = a10;
+            pDst[(n + 1) * M + m] = a01;
+            pDst[(n + 1) * M + m + 1] = a11;
+        }
+        for (; n < N; n++) {
+            pDst[n * M + m] = pSrc0[n];
+            pDst[n * M + m + 1] = pSrc0[N + n];
+        }
+    }
+
+    for (m = M2; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -30,6 +30,15 @@
 
 #include "plp_math.h"
 
+#define shufflemask1                                                                               \
+    (v4s) { 0, 4, 1, 5 }
+#define shufflemask2                                                                               \
+    (v4s) { 2, 6, 3, 7 }
+#define shufflemask3                                                                               \
+    (v4s) { 0, 1, 4, 5 }
+#define shufflemask4                                                                               \
+    (v4s) { 2, 3, 6, 7 }
+
 /**
   @ingroup MatTrans
  */
@@ -46,6 +55,11 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 4x4 elements. Four rows of a block are loaded as 8 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word.
  */
 
 void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
@@ -53,7 +67,7 @@ void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                                uint32_t N,
                                int8_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,7 +78,40 @@ void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t M4 = M & ~0x3;
+    uint32_t N4 = N & ~0x3;
+
+    int m, n;
+
+    for (m = 0; m < M4; m += 4) {
+        const int8_t *pSrc0 = pSrc + m * N;
+        for (n = 0; n < N4; n += 4) {
+            v4s r0 = *((v4s *)&pSrc0[n]);
+            v4s r1 = *((v4s *)&pSrc0[N + n]);
+            v4s r2 = *((v4s *)&pSrc0[2 * N + n]);
+            v4s r3 = *((v4s *)&pSrc0[3 * N + n]);
+            v4s t0 = __builtin_shuffle(r0, r1, shufflemask1);
+            v4s t1 = __builtin_shuffle(r2, r3, shufflemask1);
+            v4s t2 = __builtin_shuffle(r0, r1, shufflemask2);
+            v4s t3 = __builtin_shuffle(r2, r3, shufflemask2);
+            *((v4s *)&pDst[n * M + m]) = __builtin_shuffle(t0, t1, shufflemask3);
+            *((v4s *)&pDst[(n + 1) * M + m]) = __builtin_shuffle(t0, t1, shufflemask4);
+            *((v4s *)&pDst[(n + 2) * M + m]) = __builtin_shuffle(t2, t3, shufflemask3);
+            *((v4s *)&pDst[(n + 3) * M + m]) = __builtin_shuffle(t2, t3, shufflemask4);
+        }
+        for (; n < N; n++) {
+            pDst[n * M + m] = pSrc0[n];
+            pDst[n * M + m + 1] = pSrc0[N + n];
+            pDst[n * M + m + 2] = pSrc0[2 * N + n];
+            pDst[n * M + m + 3] = pSrc0[3 * N + n];
+        }
+    }
+
+    for (m = M4; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -61,6 +61,10 @@ void plp_mat_trans_f32_parallel(const float *__restrict__ pSrc,
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_trans_f32_parallel), M * N);
+        }
+
         plp_mat_trans_instance_i32 args = {
             .pSrc = (int32_t *)pSrc, .M = M, .N = N, .nPE = nPE, .pDst = (int32_t *)pDst
         };
@@ -55,6 +55,10 @@ void plp_mat_trans_i32_parallel(const int32_t *__restrict__ pSrc,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_trans_i32_parallel), M * N);
+        }
+
         plp_mat_trans_instance_i32 args = {
             .pSrc = pSrc, .M = M, .N = N, .nPE = nPE, .pDst = pDst
         };
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Parallel transposed matrix vector multiplication of 32-bit floating-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_f32 struct initialized by
+                    plp_mat_trans_vec_mult_f32_parallel
+  @return     none
+
+  @par Work distribution
+  Every core computes a contiguous block of columns of A^T * x.
+ */
+
+void plp_mat_trans_vec_mult_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_vec_mult_instance_f32 *a = (plp_mat_vec_mult_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstY;
+    uint32_t chunk = (N + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > N) {
+        end = N;
+    }
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    for (n = start; n < end; n++) {
+        float sum = 0.0f;
+
+        for (m = 0; m < M; m++) {
+            sum += pSrcA[m * N + n] * pSrcX[m];
+        }
+        pDstY[n] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Parallel transposed matrix vector multiplication of 16-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i16 struct initialized by
+                    plp_mat_trans_vec_mult_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values of a 2x2 block of A are loaded as two 32 bit vectors and transposed with
+  shuffles, such that every vector holds two elements of one column. They are multiplied with two
+  elements of x by one dot product instruction, with 32 bit accumulator.
+
+  @par Work distribution
+  Every core computes a contiguous block of columns of A^T * x, whose width is a multiple of 2.
+ */
+
+void plp_mat_trans_vec_mult_i16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_vec_mult_instance_i16 *a = (plp_mat_vec_mult_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t chunk = (N + nPE - 1) / nPE;
+
+    /* keep the blocks a multiple of 2 columns, for the SIMD loads */
+    chunk = (chunk + 1U) & ~1U;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > N) {
+        end = N;
+    }
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* two columns at a time: the 2x2 blocks of A are transposed with shuffles */
+    for (n = start; n + 1 < end; n += 2) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+
+        for (m = 0; m < (M >> 1); m++) {
+            v2s a0 = *((v2s *)((void *)(pSrcA + 2 * m * N + n)));
+            v2s a1 = *((v2s *)((void *)(pSrcA + (2 * m + 1) * N + n)));
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * m)));
+            v2s c0 = __builtin_shuffle(a0, a1, (v2s){ 0, 2 });
+            v2s c1 = __builtin_shuffle(a0, a1, (v2s){ 1, 3 });
+            sum0 = __SUMDOTP2(c0, x, sum0);
+            sum1 = __SUMDOTP2(c1, x, sum1);
+        }
+        if (M & 1U) {
+            sum0 += pSrcA[(M - 1) * N + n] * pSrcX[M - 1];
+            sum1 += pSrcA[(M - 1) * N + n + 1] * pSrcX[M - 1];
+        }
+        pDstY[n] = sum0;
+        pDstY[n + 1] = sum1;
+    }
+
+    /* remaining column */
+    if (n < end) {
+        int32_t sum = 0;
+
+        for (m = 0; m < M; m++) {
+            sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcX[m];
+        }
+        pDstY[n] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_i16s_xpulpv2.c
+ * Description:  16-bit integer transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix vector multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values of a 2x2 block of A are loaded as two 32 bit vectors and transposed with
+  shuffles, such that every vector holds two elements of one column. They are multiplied with two
+  elements of x by one dot product instruction, with 32 bit accumulator.
+ */
+
+void plp_mat_trans_vec_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         int32_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* two columns at a time: the 2x2 blocks of A are transposed with shuffles */
+    for (n = 0; n + 1 < N; n += 2) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+
+        for (m = 0; m < (M >> 1); m++) {
+            v2s a0 = *((v2s *)((void *)(pSrcA + 2 * m * N + n)));
+            v2s a1 = *((v2s *)((void *)(pSrcA + (2 * m + 1) * N + n)));
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * m)));
+            v2s c0 = __builtin_shuffle(a0, a1, (v2s){ 0, 2 });
+            v2s c1 = __builtin_shuffle(a0, a1, (v2s){ 1, 3 });
+            sum0 = __SUMDOTP2(c0, x, sum0);
+            sum1 = __SUMDOTP2(c1, x, sum1);
+        }
+        if (M & 1U) {
+            sum0 += pSrcA[(M - 1) * N + n] * pSrcX[M - 1];
+            sum1 += pSrcA[(M - 1) * N + n + 1] * pSrcX[M - 1];
+        }
+        pDstY[n] = sum0;
+        pDstY[n + 1] = sum1;
+    }
+
+    /* remaining column */
+    if (n < N) {
+        int32_t sum = 0;
+
+        for (m = 0; m < M; m++) {
+            sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcX[m];
+        }
+        pDstY[n] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
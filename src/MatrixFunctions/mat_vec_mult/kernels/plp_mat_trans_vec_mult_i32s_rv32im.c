@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_i32s_rv32im.c
+ * Description:  32-bit integer transposed matrix-vector product kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix vector multiplication of 32-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+ */
+
+void plp_mat_trans_vec_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                        const int32_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        int32_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    for (n = 0; n < N; n++) {
+        int32_t sum = 0;
+
+        for (m = 0; m < M; m++) {
+            sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcX[m];
+        }
+        pDstY[n] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
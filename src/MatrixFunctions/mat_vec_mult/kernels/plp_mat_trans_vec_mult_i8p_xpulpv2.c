@@ -0,0 +1,138 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_i8p_xpulpv2.c
+ * Description:  Parallel 8-bit integer transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Parallel transposed matrix vector multiplication of 8-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_i8 struct initialized by
+                    plp_mat_trans_vec_mult_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values of a 4x4 block of A are loaded as four 32 bit vectors and transposed with
+  shuffles, such that every vector holds four elements of one column. They are multiplied with four
+  elements of x by one dot product instruction, with 32 bit accumulator.
+
+  @par Work distribution
+  Every core computes a contiguous block of columns of A^T * x, whose width is a multiple of 4.
+ */
+
+void plp_mat_trans_vec_mult_i8p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_vec_mult_instance_i8 *a = (plp_mat_vec_mult_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t chunk = (N + nPE - 1) / nPE;
+
+    /* keep the blocks a multiple of 4 columns, for the SIMD loads */
+    chunk = (chunk + 3U) & ~3U;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > N) {
+        end = N;
+    }
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* four columns at a time: the 4x4 blocks of A are transposed with shuffles */
+    for (n = start; n + 3 < end; n += 4) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+
+        for (m = 0; m < (M >> 2); m++) {
+            v4s r0 = *((v4s *)((void *)(pSrcA + 4 * m * N + n)));
+            v4s r1 = *((v4s *)((void *)(pSrcA + (4 * m + 1) * N + n)));
+            v4s r2 = *((v4s *)((void *)(pSrcA + (4 * m + 2) * N + n)));
+            v4s r3 = *((v4s *)((void *)(pSrcA + (4 * m + 3) * N + n)));
+            v4s x = *((v4s *)((void *)(pSrcX + 4 * m)));
+
+            /* c<k> holds the elements of column n + k of the block */
+            v4s t0 = __builtin_shuffle(r0, r1, (v4s){ 0, 4, 1, 5 });
+            v4s t1 = __builtin_shuffle(r2, r3, (v4s){ 0, 4, 1, 5 });
+            v4s t2 = __builtin_shuffle(r0, r1, (v4s){ 2, 6, 3, 7 });
+            v4s t3 = __builtin_shuffle(r2, r3, (v4s){ 2, 6, 3, 7 });
+            v4s c0 = __builtin_shuffle(t0, t1, (v4s){ 0, 1, 4, 5 });
+            v4s c1 = __builtin_shuffle(t0, t1, (v4s){ 2, 3, 6, 7 });
+            v4s c2 = __builtin_shuffle(t2, t3, (v4s){ 0, 1, 4, 5 });
+            v4s c3 = __builtin_shuffle(t2, t3, (v4s){ 2, 3, 6, 7 });
+
+            sum0 = __SUMDOTP4(c0, x, sum0);
+            sum1 = __SUMDOTP4(c1, x, sum1);
+            sum2 = __SUMDOTP4(c2, x, sum2);
+            sum3 = __SUMDOTP4(c3, x, sum3);
+        }
+        for (m = M & ~3U; m < M; m++) {
+            sum0 += pSrcA[m * N + n] * pSrcX[m];
+            sum1 += pSrcA[m * N + n + 1] * pSrcX[m];
+            sum2 += pSrcA[m * N + n + 2] * pSrcX[m];
+            sum3 += pSrcA[m * N + n + 3] * pSrcX[m];
+        }
+        pDstY[n] = sum0;
+        pDstY[n + 1] = sum1;
+        pDstY[n + 2] = sum2;
+        pDstY[n + 3] = sum3;
+    }
+
+    /* remaining columns */
+    for (; n < end; n++) {
+        int32_t sum = 0;
+
+        for (m = 0; m < M; m++) {
+            sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcX[m];
+        }
+        pDstY[n] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
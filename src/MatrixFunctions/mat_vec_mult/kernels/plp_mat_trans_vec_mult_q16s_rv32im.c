@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_q16s_rv32im.c
+ * Description:  16-bit fix-point transposed matrix-vector product kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix vector multiplication of 16-bit fix-point matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+ */
+
+void plp_mat_trans_vec_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    int32_t rnd = (shift > 0) ? 1 << (shift - 1) : 0;
+
+    for (n = 0; n < N; n++) {
+        int32_t sum = 0;
+
+        for (m = 0; m < (M & ~1U); m += 2) {
+            int32_t tmp = pSrcA[m * N + n] * pSrcX[m] +
+                          pSrcA[(m + 1) * N + n] * pSrcX[m + 1];
+            sum += (tmp + rnd) >> shift;
+        }
+        for (; m < M; m++) {
+            sum += (pSrcA[m * N + n] * pSrcX[m] + rnd) >> shift;
+        }
+        pDstY[n] = (int16_t)sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_vec_mult_q16s_xpulpv2.c
+ * Description:  16-bit fix-point transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix vector multiplication of 16-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length M
+  @param[in]  M     Height of A, length of x
+  @param[in]  N     Width of A, length of y
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length N
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values of a 2x2 block of A are loaded as two 32 bit vectors and transposed with
+  shuffles, such that every vector holds two elements of one column. They are multiplied with two
+  elements of x by one dot product instruction, with 32 bit accumulator.
+ */
+
+void plp_mat_trans_vec_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* two columns at a time: the 2x2 blocks of A are transposed with shuffles */
+    for (n = 0; n + 1 < N; n += 2) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+
+        for (m = 0; m < (M >> 1); m++) {
+            v2s a0 = *((v2s *)((void *)(pSrcA + 2 * m * N + n)));
+            v2s a1 = *((v2s *)((void *)(pSrcA + (2 * m + 1) * N + n)));
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * m)));
+            v2s c0 = __builtin_shuffle(a0, a1, (v2s){ 0, 2 });
+            v2s c1 = __builtin_shuffle(a0, a1, (v2s){ 1, 3 });
+            sum0 += __ROUNDNORM_REG(__DOTP2(c0, x), shift);
+            sum1 += __ROUNDNORM_REG(__DOTP2(c1, x), shift);
+        }
+        if (M & 1U) {
+            sum0 += __ROUNDNORM_REG(pSrcA[(M - 1) * N + n] * pSrcX[M - 1], shift);
+            sum1 += __ROUNDNORM_REG(pSrcA[(M - 1) * N + n + 1] * pSrcX[M - 1], shift);
+        }
+        pDstY[n] = (int16_t)sum0;
+        pDstY[n + 1] = (int16_t)sum1;
+    }
+
+    /* remaining column */
+    if (n < N) {
+        int32_t sum = 0;
+
+        for (m = 0; m < (M & ~1U); m += 2) {
+            int32_t tmp = pSrcA[m * N + n] * pSrcX[m] +
+                          pSrcA[(m + 1) * N + n] * pSrcX[m + 1];
+            sum += __ROUNDNORM_REG(tmp, shift);
+        }
+        for (; m < M; m++) {
+            sum += __ROUNDNORM_REG(pSrcA[m * N + n] * pSrcX[m], shift);
+        }
+        pDstY[n] = (int16_t)sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_batched_f32p_xpulpv2.c
+ * Description:  batched complex 32-bit float matrix vector multiplication kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Parallel batched matrix vector multiplication of complex 32-bit floating-point matrices
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_cmplx_batched_instance_f32 struct initialized by
+                    plp_mat_vec_mult_cmplx_batched_f32
+  @return     none
+
+  @par Work distribution
+  The batch is split into nPE contiguous chunks of whole products, and each core computes the
+  products of its chunk with plp_mat_vec_mult_cmplx_f32s_xpulpv2.
+ */
+
+void plp_mat_vec_mult_cmplx_batched_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_vec_mult_cmplx_batched_instance_f32 *a =
+        (plp_mat_vec_mult_cmplx_batched_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t batchCount = a->batchCount;
+    uint32_t strideA = a->strideA;
+    uint32_t strideX = a->strideX;
+    uint32_t strideY = a->strideY;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstY;
+
+    uint32_t bStart = (core_id * batchCount) / nPE;
+    uint32_t bEnd = ((core_id + 1) * batchCount) / nPE;
+
+    uint32_t b; // loop counter for the batch
+
+    for (b = bStart; b < bEnd; b++) {
+        plp_mat_vec_mult_cmplx_f32s_xpulpv2(&pSrcA[2 * b * strideA],
+                                            &pSrcX[2 * b * strideX],
+                                            M,
+                                            N,
+                                            &pDstY[2 * b * strideY]);
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_f32s_xpulpv2.c
+ * Description:  complex 32-bit float matrix vector multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of complex 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Sweeping several rows
+  The kernel computes four rows at a time, such that every load of x is used for the complex
+  products of four rows. The remaining rows are computed one by one.
+ */
+
+void plp_mat_vec_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         float *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* four rows at a time, which share every load of x */
+    for (m = 0; m + 4 <= M; m += 4) {
+        const float *pRow0 = pSrcA + 2 * m * N;
+        const float *pRow1 = pRow0 + 2 * N;
+        const float *pRow2 = pRow1 + 2 * N;
+        const float *pRow3 = pRow2 + 2 * N;
+        float re0 = 0.0f, re1 = 0.0f, re2 = 0.0f, re3 = 0.0f;
+        float im0 = 0.0f, im1 = 0.0f, im2 = 0.0f, im3 = 0.0f;
+
+        for (n = 0; n < 2 * N; n += 2) {
+            float xRe = pSrcX[n];
+            float xIm = pSrcX[n + 1];
+
+            re0 += pRow0[n] * xRe - pRow0[n + 1] * xIm;
+            im0 += pRow0[n] * xIm + pRow0[n + 1] * xRe;
+            re1 += pRow1[n] * xRe - pRow1[n + 1] * xIm;
+            im1 += pRow1[n] * xIm + pRow1[n + 1] * xRe;
+            re2 += pRow2[n] * xRe - pRow2[n + 1] * xIm;
+            im2 += pRow2[n] * xIm + pRow2[n + 1] * xRe;
+            re3 += pRow3[n] * xRe - pRow3[n + 1] * xIm;
+            im3 += pRow3[n] * xIm + pRow3[n + 1] * xRe;
+        }
+        pDstY[2 * m + 0] = re0;
+        pDstY[2 * m + 1] = im0;
+        pDstY[2 * m + 2] = re1;
+        pDstY[2 * m + 3] = im1;
+        pDstY[2 * m + 4] = re2;
+        pDstY[2 * m + 5] = im2;
+        pDstY[2 * m + 6] = re3;
+        pDstY[2 * m + 7] = im3;
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const float *pRow = pSrcA + 2 * m * N;
+        float re = 0.0f;
+        float im = 0.0f;
+
+        for (n = 0; n < 2 * N; n += 2) {
+            re += pRow[n] * pSrcX[n] - pRow[n + 1] * pSrcX[n + 1];
+            im += pRow[n] * pSrcX[n + 1] + pRow[n + 1] * pSrcX[n];
+        }
+        pDstY[2 * m] = re;
+        pDstY[2 * m + 1] = im;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_q16p_xpulpv2.c
+ * Description:  parallel complex 16-bit fix-point matrix vector multiplication kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Parallel matrix vector multiplication of complex 16-bit fix-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_mult_instance_q16 struct initialized by
+                    plp_mat_vec_mult_cmplx_q16_parallel
+  @return     none
+
+  @par Work distribution
+  Every core computes a contiguous block of rows of y with plp_mat_vec_mult_cmplx_q16s_xpulpv2.
+ */
+
+void plp_mat_vec_mult_cmplx_q16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_vec_mult_instance_q16 *a = (plp_mat_vec_mult_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t chunk = (M + nPE - 1) / nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > M) {
+        end = M;
+    }
+
+    /* every core computes a contiguous block of rows of y */
+    if (start < end) {
+        plp_mat_vec_mult_cmplx_q16s_xpulpv2(pSrcA + 2 * start * N, pSrcX, end - start, N, shift,
+                                            pDstY + 2 * start);
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
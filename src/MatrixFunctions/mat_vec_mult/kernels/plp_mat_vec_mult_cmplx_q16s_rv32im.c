@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_q16s_rv32im.c
+ * Description:  complex 16-bit fix-point matrix vector multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of complex 16-bit fix-point matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+ */
+
+void plp_mat_vec_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    int32_t rnd = (shift > 0) ? 1 << (shift - 1) : 0;
+
+    for (m = 0; m < M; m++) {
+        const int16_t *pRow = pSrcA + 2 * m * N;
+        int32_t sumRe = 0;
+        int32_t sumIm = 0;
+
+        for (n = 0; n < N; n++) {
+            int32_t aRe = pRow[2 * n];
+            int32_t aIm = pRow[2 * n + 1];
+            int32_t xRe = pSrcX[2 * n];
+            int32_t xIm = pSrcX[2 * n + 1];
+            sumRe += (aRe * xRe - aIm * xIm + rnd) >> shift;
+            sumIm += (aRe * xIm + aIm * xRe + rnd) >> shift;
+        }
+        pDstY[2 * m] = (int16_t)sumRe;
+        pDstY[2 * m + 1] = (int16_t)sumIm;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_q16s_xpulpv2.c
+ * Description:  complex 16-bit fix-point matrix vector multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of complex 16-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the complex input matrix A of shape MxN
+  @param[in]  pSrcX Points to the complex input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the complex output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+
+  @par Exploiting SIMD instructions
+  The real and imaginary part of every complex value are packed into one 32-bit vector, and each
+  part of a complex product is computed with one pv.sdotsp.h instruction: the imaginary part as the
+  dot product of a with (x_im, x_re), the real part as the dot product of a with (x_re, ~x_im),
+  which is a_re * x_re - a_im * x_im - a_im, plus a_im as the accumulator. Unlike -x_im, ~x_im
+  cannot overflow.
+
+  @par Sweeping several rows
+  The kernel computes four rows at a time, such that every load of x and its two rearranged copies
+  are used for the complex products of four rows. The remaining rows are computed one by one.
+ */
+
+void plp_mat_vec_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    v2s mask = (v2s){ 0, -1 };
+    v2s swap = (v2s){ 1, 0 };
+
+    /* four rows at a time, which share every load of x */
+    for (m = 0; m + 4 <= M; m += 4) {
+        const v2s *pRow0 = (const v2s *)((void *)(pSrcA + 2 * m * N));
+        const v2s *pRow1 = pRow0 + N;
+        const v2s *pRow2 = pRow1 + N;
+        const v2s *pRow3 = pRow2 + N;
+        int32_t re0 = 0, re1 = 0, re2 = 0, re3 = 0;
+        int32_t im0 = 0, im1 = 0, im2 = 0, im3 = 0;
+
+        for (n = 0; n < N; n++) {
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * n)));
+            v2s xConj = x ^ mask;                   // (x_re, ~x_im)
+            v2s xSwap = __builtin_shuffle(x, swap); // (x_im, x_re)
+            v2s a0 = pRow0[n];
+            v2s a1 = pRow1[n];
+            v2s a2 = pRow2[n];
+            v2s a3 = pRow3[n];
+
+            re0 += __ROUNDNORM_REG(__SUMDOTP2(a0, xConj, a0[1]), shift);
+            im0 += __ROUNDNORM_REG(__DOTP2(a0, xSwap), shift);
+            re1 += __ROUNDNORM_REG(__SUMDOTP2(a1, xConj, a1[1]), shift);
+            im1 += __ROUNDNORM_REG(__DOTP2(a1, xSwap), shift);
+            re2 += __ROUNDNORM_REG(__SUMDOTP2(a2, xConj, a2[1]), shift);
+            im2 += __ROUNDNORM_REG(__DOTP2(a2, xSwap), shift);
+            re3 += __ROUNDNORM_REG(__SUMDOTP2(a3, xConj, a3[1]), shift);
+            im3 += __ROUNDNORM_REG(__DOTP2(a3, xSwap), shift);
+        }
+        pDstY[2 * m + 0] = (int16_t)re0;
+        pDstY[2 * m + 1] = (int16_t)im0;
+        pDstY[2 * m + 2] = (int16_t)re1;
+        pDstY[2 * m + 3] = (int16_t)im1;
+        pDstY[2 * m + 4] = (int16_t)re2;
+        pDstY[2 * m + 5] = (int16_t)im2;
+        pDstY[2 * m + 6] = (int16_t)re3;
+        pDstY[2 * m + 7] = (int16_t)im3;
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const v2s *pRow = (const v2s *)((void *)(pSrcA + 2 * m * N));
+        int32_t re = 0;
+        int32_t im = 0;
+
+        for (n = 0; n < N; n++) {
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * n)));
+            v2s a = pRow[n];
+            re += __ROUNDNORM_REG(__SUMDOTP2(a, x ^ mask, a[1]), shift);
+            im += __ROUNDNORM_REG(__DOTP2(a, __builtin_shuffle(x, swap)), shift);
+        }
+        pDstY[2 * m] = (int16_t)re;
+        pDstY[2 * m + 1] = (int16_t)im;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
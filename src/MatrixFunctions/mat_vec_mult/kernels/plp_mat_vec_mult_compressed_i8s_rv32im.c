@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_compressed_i8s_rv32im.c
+ * Description:  Matrix-vector product with palettized 4-bit weights for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication with a palettized 4-bit matrix kernel for RV32IM extension.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+ */
+
+void plp_mat_vec_mult_compressed_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                            const int8_t *__restrict__ pCodebook,
+                                            const int8_t *__restrict__ pSrcX,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            int32_t *__restrict__ pDstY) {
+
+    uint32_t rowSize = 4 * ((N + 7U) >> 3); // bytes of a row of indices
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    for (m = 0; m < M; m++) {
+        const uint8_t *pRow = (const uint8_t *)pSrcA + m * rowSize;
+        int32_t sum = 0;
+
+        /* two values per byte, the index of the first one in the lower nibble */
+        for (n = 0; n < (N >> 1); n++) {
+            uint32_t b = pRow[n];
+            sum += (int32_t)pCodebook[b & 0xFU] * (int32_t)pSrcX[2 * n];
+            sum += (int32_t)pCodebook[b >> 4] * (int32_t)pSrcX[2 * n + 1];
+        }
+        if (N & 0x1U) {
+            sum += (int32_t)pCodebook[pRow[n] & 0xFU] * (int32_t)pSrcX[2 * n];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
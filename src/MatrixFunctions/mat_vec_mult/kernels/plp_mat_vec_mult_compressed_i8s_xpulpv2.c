@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_compressed_i8s_xpulpv2.c
+ * Description:  Matrix-vector product with palettized 4-bit weights for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/* Values of the elements 2j + r (j = 0..3, r = 0 or 1) of a word of 8 packed indices, looked up in
+   the codebook held in the 4 vectors cb0 to cb3. The lower 3 bits of an index select one of the 8
+   values of (cb0, cb1) and (cb2, cb3) with a shuffle each, and bit 3 chooses between the two. */
+static inline v4s plp_mat_vec_mult_compressed_decode(
+    v4s w, uint32_t r, v4s cb0, v4s cb1, v4s cb2, v4s cb3) {
+    v4s idx = (v4s)(((uint32_t)w >> (4 * r)) & 0x0F0F0F0FU);
+    v4s lo = __builtin_shuffle(cb0, cb1, idx);
+    v4s hi = __builtin_shuffle(cb2, cb3, idx);
+    v4s sel = ((v4s)((uint32_t)idx << 4)) >> 7;
+
+    return (lo & ~sel) | (hi & sel);
+}
+
+/**
+  @brief Matrix vector multiplication with a palettized 4-bit matrix kernel for XPULPV2 extension.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+
+  @par Decoding in registers
+  The codebook is kept in 4 registers. Every word of 8 indices is decoded to 2 vectors of 4 values
+  with shuffle instructions, which are multiplied with the 8-bit dot product instructions, with 32
+  bit accumulator. Like plp_unpack_i4, the vectors hold the even and the odd elements of the word,
+  so the 8 elements of x are rearranged accordingly, once for two rows.
+ */
+
+void plp_mat_vec_mult_compressed_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                             const int8_t *__restrict__ pCodebook,
+                                             const int8_t *__restrict__ pSrcX,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             int32_t *__restrict__ pDstY) {
+
+    uint32_t nWords = (N + 7U) >> 3; // words of a row of indices
+
+    v4s cb0 = ((const v4s *)pCodebook)[0];
+    v4s cb1 = ((const v4s *)pCodebook)[1];
+    v4s cb2 = ((const v4s *)pCodebook)[2];
+    v4s cb3 = ((const v4s *)pCodebook)[3];
+    v4s maskEven = (v4s){ 0, 2, 4, 6 };
+    v4s maskOdd = (v4s){ 1, 3, 5, 7 };
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* two rows at a time, which share the rearranged elements of x */
+    for (m = 0; m < M; m += 2) {
+        const v4s *pRow0 = (const v4s *)pSrcA + m * nWords;
+        const v4s *pRow1 = (m + 1 < M) ? pRow0 + nWords : pRow0;
+        int32_t sum0 = 0, sum1 = 0;
+
+        for (n = 0; n < (N >> 3); n++) {
+            v4s x0 = *((v4s *)((void *)(pSrcX + 8 * n)));
+            v4s x1 = *((v4s *)((void *)(pSrcX + 8 * n + 4)));
+            v4s xEven = __builtin_shuffle(x0, x1, maskEven);
+            v4s xOdd = __builtin_shuffle(x0, x1, maskOdd);
+            v4s w0 = pRow0[n];
+            v4s w1 = pRow1[n];
+
+            sum0 = __SUMDOTP4(plp_mat_vec_mult_compressed_decode(w0, 0, cb0, cb1, cb2, cb3),
+                              xEven, sum0);
+            sum0 = __SUMDOTP4(plp_mat_vec_mult_compressed_decode(w0, 1, cb0, cb1, cb2, cb3),
+                              xOdd, sum0);
+            sum1 = __SUMDOTP4(plp_mat_vec_mult_compressed_decode(w1, 0, cb0, cb1, cb2, cb3),
+                              xEven, sum1);
+            sum1 = __SUMDOTP4(plp_mat_vec_mult_compressed_decode(w1, 1, cb0, cb1, cb2, cb3),
+                              xOdd, sum1);
+        }
+
+        /* the last word of the rows is incomplete */
+        for (n = N & ~7U; n < N; n++) {
+            uint32_t shift = 4 * (n & 0x1U);
+            int8_t x = pSrcX[n];
+            sum0 += pCodebook[(((const uint8_t *)pRow0)[n >> 1] >> shift) & 0xFU] * x;
+            sum1 += pCodebook[(((const uint8_t *)pRow1)[n >> 1] >> shift) & 0xFU] * x;
+        }
+
+        pDstY[m] = sum0;
+        if (m + 1 < M) {
+            pDstY[m + 1] = sum1;
+        }
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_f32s_xpulpv2.c
+ * Description:  32-bit floating-point matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Sweeping several rows
+  The kernel computes four rows at a time, such that every load of x is used for the dot
+  products of four rows. The remaining rows are computed one by one.
+ */
+
+void plp_mat_vec_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   float *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* four rows at a time, which share every load of x */
+    for (m = 0; m + 4 <= M; m += 4) {
+        const float *pRow0 = pSrcA + m * N;
+        const float *pRow1 = pRow0 + N;
+        const float *pRow2 = pRow1 + N;
+        const float *pRow3 = pRow2 + N;
+        float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+
+        for (n = 0; n < N; n++) {
+            float x = pSrcX[n];
+            sum0 += pRow0[n] * x;
+            sum1 += pRow1[n] * x;
+            sum2 += pRow2[n] * x;
+            sum3 += pRow3[n] * x;
+        }
+        pDstY[m + 0] = sum0;
+        pDstY[m + 1] = sum1;
+        pDstY[m + 2] = sum2;
+        pDstY[m + 3] = sum3;
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const float *pRow = pSrcA + m * N;
+        float sum0 = 0.0f;
+        float sum1 = 0.0f;
+
+        for (n = 0; n < (N >> 1); n++) {
+            sum0 += pRow[2 * n] * pSrcX[2 * n];
+            sum1 += pRow[2 * n + 1] * pSrcX[2 * n + 1];
+        }
+        if (N & 1U) {
+            sum0 += pRow[N - 1] * pSrcX[N - 1];
+        }
+        pDstY[m] = sum0 + sum1;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
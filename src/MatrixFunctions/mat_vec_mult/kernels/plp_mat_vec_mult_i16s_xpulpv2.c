@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_i16s_xpulpv2.c
+ * Description:  16-bit integer matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and the dot product of every row with x
+  is computed with two products per instruction, with 32 bit accumulator.
+
+  @par Sweeping several rows
+  The kernel computes four rows at a time, such that every load of x is used for the dot
+  products of four rows. The remaining rows are computed one by one.
+ */
+
+void plp_mat_vec_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* four rows at a time, which share every load of x */
+    for (m = 0; m + 4 <= M; m += 4) {
+        const int16_t *pRow0 = pSrcA + m * N;
+        const int16_t *pRow1 = pRow0 + N;
+        const int16_t *pRow2 = pRow1 + N;
+        const int16_t *pRow3 = pRow2 + N;
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        for (n = 0; n < (N >> 1); n++) {
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * n)));
+            sum0 = __SUMDOTP2(*((v2s *)((void *)(pRow0 + 2 * n))), x, sum0);
+            sum1 = __SUMDOTP2(*((v2s *)((void *)(pRow1 + 2 * n))), x, sum1);
+            sum2 = __SUMDOTP2(*((v2s *)((void *)(pRow2 + 2 * n))), x, sum2);
+            sum3 = __SUMDOTP2(*((v2s *)((void *)(pRow3 + 2 * n))), x, sum3);
+        }
+        for (n = N & ~1U; n < N; n++) {
+            int16_t x = pSrcX[n];
+            sum0 += pRow0[n] * x;
+            sum1 += pRow1[n] * x;
+            sum2 += pRow2[n] * x;
+            sum3 += pRow3[n] * x;
+        }
+        pDstY[m + 0] = sum0;
+        pDstY[m + 1] = sum1;
+        pDstY[m + 2] = sum2;
+        pDstY[m + 3] = sum3;
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const int16_t *pRow = pSrcA + m * N;
+        int32_t sum = 0;
+
+        for (n = 0; n < (N >> 2); n++) {
+            v2s a0 = *((v2s *)((void *)(pRow + 4 * n)));
+            v2s x0 = *((v2s *)((void *)(pSrcX + 4 * n)));
+            v2s a1 = *((v2s *)((void *)(pRow + 4 * n + 2)));
+            v2s x1 = *((v2s *)((void *)(pSrcX + 4 * n + 2)));
+            sum = __SUMDOTP2(a0, x0, sum);
+            sum = __SUMDOTP2(a1, x1, sum);
+        }
+        for (n = N & ~3U; n < N; n++) {
+            sum += pRow[n] * pSrcX[n];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Matrix-vector product of 8-bit matrices with 16-bit vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of an 8-bit integer matrix with a 16-bit integer vector
+         kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN [8 bit]
+  @param[in]  pSrcX Points to the input vector x of length N [16 bit]
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every word of 4 values of a row is sign-extended to 2 vectors of 2 halfwords, the even and the
+  odd elements (plp_unpack_i8), which are multiplied with the 16-bit dot product instructions, with
+  32 bit accumulator. The 4 elements of x are rearranged the same way with shuffles.
+
+  @par Sweeping several rows
+  The kernel computes four rows at a time, such that every rearranged pair of x is used for the
+  dot products of four rows. The remaining rows are computed one by one.
+ */
+
+void plp_mat_vec_mult_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      int32_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* four rows at a time, which share every load of x */
+    for (m = 0; m + 4 <= M; m += 4) {
+        const int8_t *pRow0 = pSrcA + m * N;
+        const int8_t *pRow1 = pRow0 + N;
+        const int8_t *pRow2 = pRow1 + N;
+        const int8_t *pRow3 = pRow2 + N;
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        for (n = 0; n < (N >> 2); n++) {
+            v2s x0 = *((v2s *)((void *)(pSrcX + 4 * n)));
+            v2s x1 = *((v2s *)((void *)(pSrcX + 4 * n + 2)));
+            v2s xEven = __builtin_shuffle(x0, x1, (v2s){ 0, 2 });
+            v2s xOdd = __builtin_shuffle(x0, x1, (v2s){ 1, 3 });
+            v4s a0 = *((v4s *)((void *)(pRow0 + 4 * n)));
+            v4s a1 = *((v4s *)((void *)(pRow1 + 4 * n)));
+            v4s a2 = *((v4s *)((void *)(pRow2 + 4 * n)));
+            v4s a3 = *((v4s *)((void *)(pRow3 + 4 * n)));
+
+            sum0 = __SUMDOTP2(plp_unpack_i8(a0, 0), xEven, sum0);
+            sum0 = __SUMDOTP2(plp_unpack_i8(a0, 1), xOdd, sum0);
+            sum1 = __SUMDOTP2(plp_unpack_i8(a1, 0), xEven, sum1);
+            sum1 = __SUMDOTP2(plp_unpack_i8(a1, 1), xOdd, sum1);
+            sum2 = __SUMDOTP2(plp_unpack_i8(a2, 0), xEven, sum2);
+            sum2 = __SUMDOTP2(plp_unpack_i8(a2, 1), xOdd, sum2);
+            sum3 = __SUMDOTP2(plp_unpack_i8(a3, 0), xEven, sum3);
+            sum3 = __SUMDOTP2(plp_unpack_i8(a3, 1), xOdd, sum3);
+        }
+        for (n = N & ~3U; n < N; n++) {
+            int16_t x = pSrcX[n];
+            sum0 += pRow0[n] * x;
+            sum1 += pRow1[n] * x;
+            sum2 += pRow2[n] * x;
+            sum3 += pRow3[n] * x;
+        }
+        pDstY[m + 0] = sum0;
+        pDstY[m + 1] = sum1;
+        pDstY[m + 2] = sum2;
+        pDstY[m + 3] = sum3;
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const int8_t *pRow = pSrcA + m * N;
+        int32_t sum = 0;
+
+        for (n = 0; n < (N >> 2); n++) {
+            v2s x0 = *((v2s *)((void *)(pSrcX + 4 * n)));
+            v2s x1 = *((v2s *)((void *)(pSrcX + 4 * n + 2)));
+            v4s a = *((v4s *)((void *)(pRow + 4 * n)));
+            sum = __SUMDOTP2(plp_unpack_i8(a, 0), __builtin_shuffle(x0, x1, (v2s){ 0, 2 }), sum);
+            sum = __SUMDOTP2(plp_unpack_i8(a, 1), __builtin_shuffle(x0, x1, (v2s){ 1, 3 }), sum);
+        }
+        for (n = N & ~3U; n < N; n++) {
+            sum += pRow[n] * pSrcX[n];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
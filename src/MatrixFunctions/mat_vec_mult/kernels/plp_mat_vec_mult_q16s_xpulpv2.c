@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_q16s_xpulpv2.c
+ * Description:  16-bit fix-point matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  The products are summed in groups of two, as computed by one SIMD dot product, and every group is
+  rounded and shifted to the right by `shift` before it is accumulated in 32 bit, like in
+  plp_dot_prod_q16. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the
+  output is represented as pDstY * 2^-(a + b - shift). The output is stored with the width of the
+  input, without saturation. Set `shift` such that no overflow occurs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and the dot product of every row with x
+  is computed with two products per instruction, with 32 bit accumulator.
+
+  @par Sweeping several rows
+  The kernel computes four rows at a time, such that every load of x is used for the dot
+  products of four rows. The remaining rows are computed one by one.
+ */
+
+void plp_mat_vec_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    /* four rows at a time, which share every load of x */
+    for (m = 0; m + 4 <= M; m += 4) {
+        const int16_t *pRow0 = pSrcA + m * N;
+        const int16_t *pRow1 = pRow0 + N;
+        const int16_t *pRow2 = pRow1 + N;
+        const int16_t *pRow3 = pRow2 + N;
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        for (n = 0; n < (N >> 1); n++) {
+            v2s x = *((v2s *)((void *)(pSrcX + 2 * n)));
+            sum0 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pRow0 + 2 * n))), x), shift);
+            sum1 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pRow1 + 2 * n))), x), shift);
+            sum2 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pRow2 + 2 * n))), x), shift);
+            sum3 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pRow3 + 2 * n))), x), shift);
+        }
+        for (n = N & ~1U; n < N; n++) {
+            int16_t x = pSrcX[n];
+            sum0 += __ROUNDNORM_REG(pRow0[n] * x, shift);
+            sum1 += __ROUNDNORM_REG(pRow1[n] * x, shift);
+            sum2 += __ROUNDNORM_REG(pRow2[n] * x, shift);
+            sum3 += __ROUNDNORM_REG(pRow3[n] * x, shift);
+        }
+        pDstY[m + 0] = (int16_t)sum0;
+        pDstY[m + 1] = (int16_t)sum1;
+        pDstY[m + 2] = (int16_t)sum2;
+        pDstY[m + 3] = (int16_t)sum3;
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const int16_t *pRow = pSrcA + m * N;
+        int32_t sum = 0;
+
+        for (n = 0; n < (N >> 2); n++) {
+            v2s a0 = *((v2s *)((void *)(pRow + 4 * n)));
+            v2s x0 = *((v2s *)((void *)(pSrcX + 4 * n)));
+            v2s a1 = *((v2s *)((void *)(pRow + 4 * n + 2)));
+            v2s x1 = *((v2s *)((void *)(pSrcX + 4 * n + 2)));
+            sum += __ROUNDNORM_REG(__DOTP2(a0, x0), shift);
+            sum += __ROUNDNORM_REG(__DOTP2(a1, x1), shift);
+        }
+        n = N & ~3U;
+        if (N & 2U) {
+            v2s a0 = *((v2s *)((void *)(pRow + n)));
+            v2s x0 = *((v2s *)((void *)(pSrcX + n)));
+            sum += __ROUNDNORM_REG(__DOTP2(a0, x0), shift);
+            n += 2;
+        }
+        if (N & 1U) {
+            sum += __ROUNDNORM_REG(pRow[n] * pSrcX[n], shift);
+        }
+        pDstY[m] = (int16_t)sum;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
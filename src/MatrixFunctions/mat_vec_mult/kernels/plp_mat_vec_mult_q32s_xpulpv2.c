@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_q32s_xpulpv2.c
+ * Description:  32-bit fix-point matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix vector multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[in]  shift Amount to shift the partial sums to the right
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is rounded and shifted to the right by `shift` before it is accumulated in 32 bit,
+  like in plp_dot_prod_q32. Assume that A is represented as pSrcA * 2^-a and x as pSrcX * 2^-b.
+  Then, the output is represented as pDstY * 2^-(a + b - shift). The output is stored with the
+  width of the input, without saturation. Set `shift` such that no overflow occurs.
+ */
+
+void plp_mat_vec_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int32_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    for (m = 0; m < M; m++) {
+        const int32_t *pRow = pSrcA + m * N;
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+
+        for (n = 0; n < (N >> 1); n++) {
+            sum0 += __ROUNDNORM_REG(pRow[2 * n] * pSrcX[2 * n], shift);
+            sum1 += __ROUNDNORM_REG(pRow[2 * n + 1] * pSrcX[2 * n + 1], shift);
+        }
+        if (N & 1U) {
+            sum0 += __ROUNDNORM_REG(pRow[N - 1] * pSrcX[N - 1], shift);
+        }
+        pDstY[m] = sum0 + sum1;
+    }
+}
+
+/**
+  @} end of MatVecMultKernels group
+ */
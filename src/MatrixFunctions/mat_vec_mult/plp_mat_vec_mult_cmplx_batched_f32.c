@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_batched_f32.c
+ * Description:  batched complex 32-bit float matrix vector multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for batched matrix vector multiplication of complex 32-bit floating-point
+         matrices, y_b = A_b * x_b for b = 0 to batchCount - 1.
+  @param[in]  pSrcA      points to the first matrix of the batch, each of shape MxN
+  @param[in]  pSrcX      points to the first input vector of the batch, each of length N
+  @param[in]  M          Height of each matrix, length of each output vector
+  @param[in]  N          Width of each matrix, length of each input vector
+  @param[in]  batchCount number of matrix vector multiplications
+  @param[in]  strideA    number of complex elements between two matrices (may be 0)
+  @param[in]  strideX    number of complex elements between two input vectors
+  @param[in]  strideY    number of complex elements between two output vectors
+  @param[in]  nPE        Number of cores to use for computation
+  @param[out] pDstY      points to the first output vector of the batch
+  @return     none
+
+  @par Work distribution
+  The batch is split into nPE contiguous chunks of whole products, e.g. the subcarriers of an OFDM
+  symbol when applying beamforming weights, such that a single fork covers the whole batch and
+  every core runs the serial kernel on small matrices without any synchronization. With
+  strideA = 0, the same matrix is applied to all vectors.
+ */
+
+void plp_mat_vec_mult_cmplx_batched_f32(const float *__restrict__ pSrcA,
+                                        const float *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t batchCount,
+                                        uint32_t strideA,
+                                        uint32_t strideX,
+                                        uint32_t strideY,
+                                        uint32_t nPE,
+                                        float *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_vec_mult_cmplx_batched_instance_f32 args = { .pSrcA = pSrcA,
+                                                             .pSrcX = pSrcX,
+                                                             .M = M,
+                                                             .N = N,
+                                                             .batchCount = batchCount,
+                                                             .strideA = strideA,
+                                                             .strideX = strideX,
+                                                             .strideY = strideY,
+                                                             .nPE = nPE,
+                                                             .pDstY = pDstY };
+        rt_team_fork(nPE, plp_mat_vec_mult_cmplx_batched_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
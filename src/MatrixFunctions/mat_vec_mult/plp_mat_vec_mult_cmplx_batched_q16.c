@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_batched_q16.c
+ * Description:  batched complex 16-bit fix-point matrix vector multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for batched matrix vector multiplication of complex 16-bit fix-point matrices,
+         y_b = A_b * x_b for b = 0 to batchCount - 1.
+  @param[in]  pSrcA      points to the first matrix of the batch, each of shape MxN
+  @param[in]  pSrcX      points to the first input vector of the batch, each of length N
+  @param[in]  M          Height of each matrix, length of each output vector
+  @param[in]  N          Width of each matrix, length of each input vector
+  @param[in]  batchCount number of matrix vector multiplications
+  @param[in]  strideA    number of complex elements between two matrices (may be 0)
+  @param[in]  strideX    number of complex elements between two input vectors
+  @param[in]  strideY    number of complex elements between two output vectors
+  @param[in]  shift      Amount to shift the partial sums to the right
+  @param[in]  nPE        Number of cores to use for computation
+  @param[out] pDstY      points to the first output vector of the batch
+  @return     none
+
+  @par Fix-Point and Shifting
+  The real and the imaginary part of every complex product, each the sum of two products as
+  computed by one SIMD dot product, are rounded and shifted to the right by `shift` before they are
+  accumulated in 32 bit, like in plp_mat_vec_mult_q16. Assume that A is represented as
+  pSrcA * 2^-a and x as pSrcX * 2^-b. Then, the output is represented as pDstY * 2^-(a + b - shift).
+  The output is stored with the width of the input, without saturation. Set `shift` such that no
+  overflow occurs.
+
+  @par Work distribution
+  The batch is split into nPE contiguous chunks of whole products, e.g. the subcarriers of an OFDM
+  symbol when applying beamforming weights, such that a single fork covers the whole batch and
+  every core runs the serial kernel on small matrices without any synchronization. With
+  strideA = 0, the same matrix is applied to all vectors.
+
+  @par On the fabric controller, the products are computed one after the other, using the RV32IM
+  kernel.
+ */
+
+void plp_mat_vec_mult_cmplx_batched_q16(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t batchCount,
+                                        uint32_t strideA,
+                                        uint32_t strideX,
+                                        uint32_t strideY,
+                                        uint32_t shift,
+                                        uint32_t nPE,
+                                        int16_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        uint32_t b; // loop counter for the batch
+        for (b = 0; b < batchCount; b++) {
+            plp_mat_vec_mult_cmplx_q16s_rv32im(&pSrcA[2 * b * strideA],
+                                               &pSrcX[2 * b * strideX],
+                                               M,
+                                               N,
+                                               shift,
+                                               &pDstY[2 * b * strideY]);
+        }
+    } else {
+        plp_mat_vec_mult_cmplx_batched_instance_q16 args = { .pSrcA = pSrcA,
+                                                             .pSrcX = pSrcX,
+                                                             .M = M,
+                                                             .N = N,
+                                                             .batchCount = batchCount,
+                                                             .strideA = strideA,
+                                                             .strideX = strideX,
+                                                             .strideY = strideY,
+                                                             .shift = shift,
+                                                             .nPE = nPE,
+                                                             .pDstY = pDstY };
+        rt_team_fork(nPE, plp_mat_vec_mult_cmplx_batched_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
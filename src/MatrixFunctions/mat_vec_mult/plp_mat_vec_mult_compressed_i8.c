@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_compressed_i8.c
+ * Description:  Glue code for the matrix-vector product with palettized 4-bit weights
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix vector multiplication with a palettized 4-bit matrix, y = A * x.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+
+  @par Compressed format
+  Every value of A is one of the 16 entries of the codebook, and the matrix stores its 4-bit
+  index: A[m][n] = pCodebook[i], with i the element n of row m. The indices are packed like the
+  values of the sub-byte matrix multiplication, element k of a row in the bits 4k to 4k+3 of the
+  row, and every row starts at a word boundary: it takes ceil(N / 8) words, the indices after the
+  N-th one are ignored. The matrix and the codebook must be aligned to 4 bytes. This halves the
+  footprint and the memory traffic of the weights with respect to plp_mat_vec_mult_i8, and the
+  values are decoded in registers, such that the decompressed matrix is never stored.
+ */
+
+void plp_mat_vec_mult_compressed_i8(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pCodebook,
+                                    const int8_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_mult_compressed_i8s_rv32im(pSrcA, pCodebook, pSrcX, M, N, pDstY);
+    } else {
+        plp_mat_vec_mult_compressed_i8s_xpulpv2(pSrcA, pCodebook, pSrcX, M, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
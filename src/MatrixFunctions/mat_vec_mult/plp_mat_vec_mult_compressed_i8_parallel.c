@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_compressed_i8_parallel.c
+ * Description:  Glue code for the parallel matrix-vector product with palettized 4-bit weights
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix vector multiplication with a palettized 4-bit matrix,
+         y = A * x. The format is described in plp_mat_vec_mult_compressed_i8.
+  @param[in]  pSrcA     Points to the indices of the matrix A of shape MxN, packed
+  @param[in]  pCodebook Points to the codebook of 16 8-bit values of A
+  @param[in]  pSrcX     Points to the input vector x of length N
+  @param[in]  M         Height of A, length of y
+  @param[in]  N         Width of A, length of x
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDstY     Points to the output vector y of length M
+  @return     none
+ */
+
+void plp_mat_vec_mult_compressed_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                             const int8_t *__restrict__ pCodebook,
+                                             const int8_t *__restrict__ pSrcX,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t nPE,
+                                             int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_vec_mult_compressed_i8_parallel), M * N);
+        }
+
+        plp_mat_vec_mult_compressed_instance_i8 args = { .pSrcA = pSrcA,
+                                                         .pCodebook = pCodebook,
+                                                         .pSrcX = pSrcX,
+                                                         .M = M,
+                                                         .N = N,
+                                                         .nPE = nPE,
+                                                         .pDstY = pDstY };
+
+        rt_team_fork(nPE, plp_mat_vec_mult_compressed_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
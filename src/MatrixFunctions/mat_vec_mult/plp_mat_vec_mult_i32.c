@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_i32.c
+ * Description:  Glue code for the 32-bit integer matrix-vector product
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatVecMult Matrix vector multiplication
+  This module contains the glue code for the multiplication of a matrix with a vector (GEMV). The
+  kernel codes (kernels) are in the Module Matrix vector multiplication Kernels.
+
+  plp_mat_vec_mult computes y = A * x, where A is a matrix of shape MxN and x a vector of length N,
+  and plp_mat_trans_vec_mult computes y = A^T * x, where x has length M, without transposing A.
+  Compared to plp_mat_mult with O = 1, the kernels compute every output with a SIMD dot product
+  over a row (or, for the transposed product, over pairs or quadruples of columns transposed in
+  registers), like plp_dot_prod. The parallel functions split the rows (columns for the transposed
+  product) of A into one contiguous block per core.
+
+  plp_mat_vec_mult is also the dot product of one vector with a bank of vectors, e.g. for template
+  matching, beam steering or fully connected layers: the rows of A are the M stored vectors, and
+  the parallel functions split the stored vectors among the cores.
+
+  There are functions for 8, 16 and 32-bit integers (with a 32-bit output), for 8, 16 and 32-bit
+  fix-point numbers (with the output of the same type as the input) and for 32-bit floating-point
+  numbers, which are only supported on the cluster side.
+
+  plp_mat_vec_mult_cmplx computes y = A * x for complex 16-bit fix-point and 32-bit floating-point
+  numbers, with the real and imaginary parts interleaved, e.g. to apply the beamforming weights of
+  one subcarrier. plp_mat_vec_mult_cmplx_batched computes a batch of such products, e.g. of all
+  subcarriers of a symbol, with a single fork: the batch is split among the cores, and every core
+  runs the serial kernel on its products, which for small matrices is faster than splitting the
+  rows of each product.
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix vector multiplication of 32-bit integer matrices, y = A * x.
+  @param[in]  pSrcA Points to the input matrix A of shape MxN
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[in]  M     Height of A, length of y
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+ */
+
+void plp_mat_vec_mult_i32(const int32_t *__restrict__ pSrcA,
+                          const int32_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_mult_i32s_rv32im(pSrcA, pSrcX, M, N, pDstY);
+    } else {
+        plp_mat_vec_mult_i32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
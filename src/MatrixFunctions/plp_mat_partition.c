@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_partition.c
+ * Description:  Work partitioning of the output matrix for parallel matrix kernels
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatPartition Matrix Work Partitioning
+  Helper used by the parallel matrix kernels to split the output matrix among the cores.
+
+  The output matrix (of size MxO) is split into a grid of rows x cols tiles, with rows * cols =
+  nPE. Out of all grids that are possible with nPE cores, the one with the smallest tile (i.e. the
+  least work for the slowest core) is chosen. If multiple grids lead to the same tile size, the one
+  with more rows is preferred, because it keeps each core on full rows of the output. This way:
+  - a plain row split is used whenever M is large enough,
+  - a column split is used for matrix-vector like shapes (M = 1),
+  - a 2D tiling is used for shapes in between (e.g. M = 3 and O = 3 uses 6 cores).
+
+  The rows and columns are distributed as evenly as possible, such that tiles differ by at most
+  one row or column.
+ */
+
+/**
+  @addtogroup MatPartition
+  @{
+ */
+
+/**
+  @brief      Compute the tile of the output matrix assigned to one core.
+  @param[in]  M      Height of the output matrix
+  @param[in]  O      Width of the output matrix
+  @param[in]  nPE    Number of cores used for the computation
+  @param[in]  coreId Id of the core for which the tile is computed (0 <= coreId < nPE)
+  @param[out] pTile  The tile is written here. The tile is empty (start == end) if the core has no
+                     work assigned to it.
+  @return     none
+ */
+
+void plp_mat_partition(
+    uint32_t M, uint32_t O, uint32_t nPE, uint32_t coreId, plp_mat_tile *__restrict__ pTile) {
+
+    uint32_t rows, cols;
+    uint32_t bestRows = 1;
+    uint32_t bestCost = 0xFFFFFFFF;
+
+    if (nPE == 0 || coreId >= nPE) {
+        pTile->mStart = pTile->mEnd = 0;
+        pTile->oStart = pTile->oEnd = 0;
+        return;
+    }
+
+    // iterate from the pure row split to the pure column split, only accept strictly better splits
+    for (rows = nPE; rows > 0; rows--) {
+        if (nPE % rows != 0) {
+            continue;
+        }
+        cols = nPE / rows;
+        uint32_t tileM = (M + rows - 1) / rows;
+        uint32_t tileO = (O + cols - 1) / cols;
+        uint32_t cost = tileM * tileO;
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestRows = rows;
+        }
+    }
+
+    rows = bestRows;
+    cols = nPE / rows;
+
+    uint32_t rowIdx = coreId / cols;
+    uint32_t colIdx = coreId % cols;
+
+    pTile->mStart = (rowIdx * M) / rows;
+    pTile->mEnd = ((rowIdx + 1) * M) / rows;
+    pTile->oStart = (colIdx * O) / cols;
+    pTile->oEnd = ((colIdx + 1) * O) / cols;
+}
+
+/**
+  @} end of MatPartition group
+ */
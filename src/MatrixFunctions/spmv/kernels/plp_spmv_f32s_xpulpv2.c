@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_f32s_xpulpv2.c
+ * Description:  32-bit floating-point sparse matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+  @brief Sparse matrix vector multiplication of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+
+  @par Loop unrolling
+  Two nonzeros are processed per iteration, with two independent accumulators, such that
+  the loads of the column indices and of x are not stalled by the previous product.
+ */
+
+void plp_spmv_f32s_xpulpv2(const plp_csr_matrix_f32 *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcX,
+                           float *__restrict__ pDstY) {
+
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    const uint16_t *pColIdx = pSrcA->pColIdx;
+    const float *pData = pSrcA->pData;
+
+    uint32_t m; // loop counter
+
+    for (m = 0; m < pSrcA->M; m++) {
+        uint32_t k = pRowPtr[m];
+        uint32_t kEnd = pRowPtr[m + 1];
+        float sum0 = 0.0f;
+        float sum1 = 0.0f;
+
+        /* two nonzeros at a time, with independent accumulators */
+        for (; k + 1 < kEnd; k += 2) {
+            sum0 += pData[k] * pSrcX[pColIdx[k]];
+            sum1 += pData[k + 1] * pSrcX[pColIdx[k + 1]];
+        }
+        if (k < kEnd) {
+            sum0 += pData[k] * pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum0 + sum1;
+    }
+}
+
+/**
+  @} end of MatSpMVKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_i16s_rv32im.c
+ * Description:  16-bit integer sparse matrix-vector product kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+  @brief Sparse matrix vector multiplication of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+ */
+
+void plp_spmv_i16s_rv32im(const plp_csr_matrix_i16 *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcX,
+                          int32_t *__restrict__ pDstY) {
+
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    const uint16_t *pColIdx = pSrcA->pColIdx;
+    const int16_t *pData = pSrcA->pData;
+
+    uint32_t m; // loop counter
+    uint32_t k; // loop counter
+
+    for (m = 0; m < pSrcA->M; m++) {
+        int32_t sum = 0;
+
+        for (k = pRowPtr[m]; k < pRowPtr[m + 1]; k++) {
+            sum += (int32_t)pData[k] * (int32_t)pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @} end of MatSpMVKernels group
+ */
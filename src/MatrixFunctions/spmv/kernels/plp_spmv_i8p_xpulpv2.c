@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_i8p_xpulpv2.c
+ * Description:  Parallel 8-bit integer sparse matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+  @brief Parallel sparse matrix vector multiplication of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_spmv_instance_i8 struct initialized by
+                    plp_spmv_i8_parallel
+  @return     none
+
+  @par Work distribution
+  Every core computes a contiguous block of rows of y, which is chosen by plp_spmv_partition such
+  that all blocks hold about the same number of nonzeros.
+ */
+
+void plp_spmv_i8p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_spmv_instance_i8 *a = (plp_spmv_instance_i8 *)args;
+
+    const plp_csr_matrix_i8 *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    const uint16_t *pColIdx = pSrcA->pColIdx;
+    const int8_t *pData = pSrcA->pData;
+
+    uint32_t start, end;
+
+    plp_spmv_partition(pRowPtr, pSrcA->M, nPE, core_id, &start, &end);
+
+    uint32_t m; // loop counter
+
+    for (m = start; m < end; m++) {
+        uint32_t k = pRowPtr[m];
+        uint32_t kEnd = pRowPtr[m + 1];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+
+        /* two nonzeros at a time, with independent accumulators */
+        for (; k + 1 < kEnd; k += 2) {
+            sum0 += pData[k] * pSrcX[pColIdx[k]];
+            sum1 += pData[k + 1] * pSrcX[pColIdx[k + 1]];
+        }
+        if (k < kEnd) {
+            sum0 += pData[k] * pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum0 + sum1;
+    }
+}
+
+/**
+  @} end of MatSpMVKernels group
+ */
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_i8.c
+ * Description:  Glue code for the 8-bit integer sparse matrix-vector product
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSpMV Sparse matrix vector multiplication
+  This module contains the glue code for the multiplication of a sparse matrix with a dense vector,
+  y = A * x. The kernel codes (kernels) are in the Module Sparse matrix vector multiplication
+  Kernels.
+
+  The sparse matrix A of shape MxN is stored in compressed sparse row (CSR) format, in a
+  plp_csr_matrix_i8, plp_csr_matrix_i16 or plp_csr_matrix_f32 struct: the nonzero values are stored
+  row by row in pData, with their column indices in pColIdx, and the nonzeros of row m are
+  pData[pRowPtr[m]] to pData[pRowPtr[m + 1] - 1]. Only the nonzeros are loaded and multiplied, so
+  the work and the memory traffic are proportional to the number of nonzeros instead of M * N.
+
+  The parallel functions split the rows of A into one contiguous block per core, such that every
+  block holds about the same number of nonzeros (see plp_spmv_partition), since the number of
+  nonzeros per row of pruned weights can vary a lot.
+ */
+
+/**
+  @addtogroup MatSpMV
+  @{
+ */
+
+/**
+  @brief Glue code for sparse matrix vector multiplication of 8-bit integer matrices, y = A * x.
+  @param[in]  pSrcA Points to the sparse input matrix A of shape MxN, in CSR format
+  @param[in]  pSrcX Points to the input vector x of length N
+  @param[out] pDstY Points to the output vector y of length M
+  @return     none
+ */
+
+void plp_spmv_i8(const plp_csr_matrix_i8 *__restrict__ pSrcA,
+                 const int8_t *__restrict__ pSrcX,
+                 int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_spmv_i8s_rv32im(pSrcA, pSrcX, pDstY);
+    } else {
+        plp_spmv_i8s_xpulpv2(pSrcA, pSrcX, pDstY);
+    }
+}
+
+/**
+  @} end of MatSpMV group
+ */
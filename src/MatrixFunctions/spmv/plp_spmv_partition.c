@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_partition.c
+ * Description:  Nonzero balanced row partitioning of CSR matrices
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSpMV
+  @{
+ */
+
+/**
+  @brief      Find the first row of a CSR matrix whose nonzeros start at or after a given index.
+  @param[in]  pRowPtr Row offsets of the CSR matrix (M + 1 entries)
+  @param[in]  M       Number of rows
+  @param[in]  target  Index of a nonzero
+  @return     Smallest row m with pRowPtr[m] >= target, or M if there is none
+ */
+
+static uint32_t plp_spmv_find_row(const uint32_t *__restrict__ pRowPtr,
+                                  uint32_t M,
+                                  uint32_t target) {
+    uint32_t lo = 0;
+    uint32_t hi = M;
+
+    // binary search, pRowPtr is non-decreasing
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if (pRowPtr[mid] < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+  @brief      Compute the rows of a CSR matrix assigned to one core. The rows are split into nPE
+              contiguous blocks, such that every block holds about nnz / nPE nonzeros. Block k
+              starts at the first row whose nonzeros start at or after k * nnz / nPE.
+  @param[in]  pRowPtr Row offsets of the CSR matrix (M + 1 entries)
+  @param[in]  M       Number of rows
+  @param[in]  nPE     Number of cores used for the computation
+  @param[in]  coreId  Id of the core for which the rows are computed (0 <= coreId < nPE)
+  @param[out] pStart  First row of the block is written here
+  @param[out] pEnd    One past the last row of the block is written here (equal to *pStart if the
+                      core has no work assigned to it)
+  @return     none
+ */
+
+void plp_spmv_partition(const uint32_t *__restrict__ pRowPtr,
+                        uint32_t M,
+                        uint32_t nPE,
+                        uint32_t coreId,
+                        uint32_t *__restrict__ pStart,
+                        uint32_t *__restrict__ pEnd) {
+
+    uint32_t nnz = pRowPtr[M];
+
+    if (nPE == 0 || coreId >= nPE) {
+        *pStart = *pEnd = 0;
+        return;
+    }
+
+    *pStart = (coreId == 0) ? 0
+                            : plp_spmv_find_row(pRowPtr, M, (uint64_t)coreId * nnz / nPE);
+    *pEnd = (coreId == nPE - 1) ? M
+                                : plp_spmv_find_row(pRowPtr, M, (uint64_t)(coreId + 1) * nnz / nPE);
+}
+
+/**
+  @} end of MatSpMV group
+ */
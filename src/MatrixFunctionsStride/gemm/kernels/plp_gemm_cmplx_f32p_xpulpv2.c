@@ -0,0 +1,189 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gemm_cmplx_f32p_xpulpv2.c
+ * Description:  parallel general matrix multiplication of complex 32-bit float matrices kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Gemm
+ */
+
+/**
+  @addtogroup GemmKernels
+  @{
+ */
+
+/*
+ * Stores alpha * (re + j im) + beta * C, where re and im are the real and imaginary part of the
+ * dot product, without reading C if beta is zero. The dot product is accumulated as the four real
+ * products rr, ii, ri and ir of the parts of A and B, such that the conjugation of A (cA = -1) or B
+ * (cB = -1) only changes the signs at the end.
+ */
+static inline void plp_gemm_store_cmplx_f32(float *pC,
+                                            float rr,
+                                            float ii,
+                                            float ri,
+                                            float ir,
+                                            float cA,
+                                            float cB,
+                                            float alphaRe,
+                                            float alphaIm,
+                                            float betaRe,
+                                            float betaIm) {
+    float re = rr - cA * cB * ii;
+    float im = cB * ri + cA * ir;
+    float outRe = alphaRe * re - alphaIm * im;
+    float outIm = alphaRe * im + alphaIm * re;
+
+    if (betaRe != 0.0f || betaIm != 0.0f) {
+        float cRe = pC[0];
+        float cIm = pC[1];
+        outRe += betaRe * cRe - betaIm * cIm;
+        outIm += betaRe * cIm + betaIm * cRe;
+    }
+
+    pC[0] = outRe;
+    pC[1] = outIm;
+}
+
+/**
+  @brief Parallel general matrix multiplication of complex 32-bit floating-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_gemm_instance_cmplx_f32 struct initialized by
+                    plp_gemm_cmplx_f32_parallel
+  @return     none
+
+  @par Register blocking
+  The output is computed in blocks of 1x2 elements, such that every loaded element of A is used
+  twice. The elements of op(A) and op(B) are addressed with the strides along their rows and
+  columns, which depend on the transpose flags, with post-increment loads.
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition.
+ */
+
+void plp_gemm_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_gemm_instance_cmplx_f32 *a = (plp_gemm_instance_cmplx_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t transA = a->transA;
+    uint32_t transB = a->transB;
+    float alphaRe = a->alphaRe;
+    float alphaIm = a->alphaIm;
+    float betaRe = a->betaRe;
+    float betaIm = a->betaIm;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    // strides of op(A) and op(B) in floats, i.e. twice the number of complex elements
+    uint32_t sAm = 2 * ((transA == PLP_GEMM_NO_TRANS) ? strideA : 1); // along m
+    uint32_t sAn = 2 * ((transA == PLP_GEMM_NO_TRANS) ? 1 : strideA); // along n
+    uint32_t sBn = 2 * ((transB == PLP_GEMM_NO_TRANS) ? strideB : 1); // along n
+    uint32_t sBo = 2 * ((transB == PLP_GEMM_NO_TRANS) ? 1 : strideB); // along o
+    float cA = (transA == PLP_GEMM_CONJ_TRANS) ? -1.0f : 1.0f;
+    float cB = (transB == PLP_GEMM_CONJ_TRANS) ? -1.0f : 1.0f;
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        float *pC = &pDstC[2 * m * strideC];
+
+        for (o = tile.oStart; o + 2 <= tile.oEnd; o += 2) {
+            const float *pA = &pSrcA[m * sAm];
+            const float *pB0 = &pSrcB[o * sBo];
+            const float *pB1 = pB0 + sBo;
+
+            float rr0 = 0.0f, ii0 = 0.0f, ri0 = 0.0f, ir0 = 0.0f;
+            float rr1 = 0.0f, ii1 = 0.0f, ri1 = 0.0f, ir1 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float aRe = pA[0];
+                float aIm = pA[1];
+                float b0Re = pB0[0];
+                float b0Im = pB0[1];
+                float b1Re = pB1[0];
+                float b1Im = pB1[1];
+                pA += sAn;
+                pB0 += sBn;
+                pB1 += sBn;
+
+                rr0 += aRe * b0Re;
+                ii0 += aIm * b0Im;
+                ri0 += aRe * b0Im;
+                ir0 += aIm * b0Re;
+                rr1 += aRe * b1Re;
+                ii1 += aIm * b1Im;
+                ri1 += aRe * b1Im;
+                ir1 += aIm * b1Re;
+            }
+
+            plp_gemm_store_cmplx_f32(
+                &pC[2 * o], rr0, ii0, ri0, ir0, cA, cB, alphaRe, alphaIm, betaRe, betaIm);
+            plp_gemm_store_cmplx_f32(
+                &pC[2 * o + 2], rr1, ii1, ri1, ir1, cA, cB, alphaRe, alphaIm, betaRe, betaIm);
+        }
+
+        // clean up for o
+        if (o < tile.oEnd) {
+            const float *pA = &pSrcA[m * sAm];
+            const float *pB0 = &pSrcB[o * sBo];
+
+            float rr0 = 0.0f, ii0 = 0.0f, ri0 = 0.0f, ir0 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                rr0 += pA[0] * pB0[0];
+                ii0 += pA[1] * pB0[1];
+                ri0 += pA[0] * pB0[1];
+                ir0 += pA[1] * pB0[0];
+                pA += sAn;
+                pB0 += sBn;
+            }
+
+            plp_gemm_store_cmplx_f32(
+                &pC[2 * o], rr0, ii0, ri0, ir0, cA, cB, alphaRe, alphaIm, betaRe, betaIm);
+        }
+    }
+}
+
+/**
+  @} end of GemmKernels group
+ */
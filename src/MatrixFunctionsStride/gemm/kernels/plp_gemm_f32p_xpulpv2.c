@@ -0,0 +1,172 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gemm_f32p_xpulpv2.c
+ * Description:  parallel general matrix multiplication of 32-bit floating-point matrices kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Gemm
+ */
+
+/**
+  @addtogroup GemmKernels
+  @{
+ */
+
+/* stores alpha * sum + beta * C, without reading C if beta is zero */
+static inline void plp_gemm_store_f32(float *pC, float sum, float alpha, float beta) {
+    if (beta == 0.0f) {
+        *pC = alpha * sum;
+    } else {
+        *pC = alpha * sum + beta * (*pC);
+    }
+}
+
+/* dot product of N elements, which are sA and sB elements apart */
+static inline float plp_gemm_dot_f32(const float *pA, const float *pB, uint32_t N, uint32_t sA,
+                                     uint32_t sB) {
+    uint32_t n;
+    float sum = 0.0f;
+
+    for (n = 0; n < N; n++) {
+        sum += (*pA) * (*pB);
+        pA += sA;
+        pB += sB;
+    }
+
+    return sum;
+}
+
+/**
+  @brief Parallel general matrix multiplication of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_gemm_instance_f32 struct initialized by plp_gemm_f32_parallel
+  @return     none
+
+  @par Register blocking
+  The output is computed in blocks of 2x2 elements, such that every loaded element of A and B is
+  used twice. The elements of op(A) and op(B) are addressed with the strides along their rows and
+  columns, which depend on the transpose flags, with post-increment loads.
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition.
+ */
+
+void plp_gemm_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_gemm_instance_f32 *a = (plp_gemm_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t transA = a->transA;
+    uint32_t transB = a->transB;
+    float alpha = a->alpha;
+    float beta = a->beta;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    uint32_t sAm = (transA == PLP_GEMM_NO_TRANS) ? strideA : 1; // stride of op(A) along m
+    uint32_t sAn = (transA == PLP_GEMM_NO_TRANS) ? 1 : strideA; // stride of op(A) along n
+    uint32_t sBn = (transB == PLP_GEMM_NO_TRANS) ? strideB : 1; // stride of op(B) along n
+    uint32_t sBo = (transB == PLP_GEMM_NO_TRANS) ? 1 : strideB; // stride of op(B) along o
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = tile.mStart; m + 2 <= tile.mEnd; m += 2) {
+        float *pC0 = &pDstC[m * strideC];
+        float *pC1 = &pDstC[(m + 1) * strideC];
+
+        for (o = tile.oStart; o + 2 <= tile.oEnd; o += 2) {
+            const float *pA0 = &pSrcA[m * sAm];
+            const float *pA1 = pA0 + sAm;
+            const float *pB0 = &pSrcB[o * sBo];
+            const float *pB1 = pB0 + sBo;
+
+            float sum00 = 0.0f;
+            float sum01 = 0.0f;
+            float sum10 = 0.0f;
+            float sum11 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float valA0 = *pA0;
+                float valA1 = *pA1;
+                float valB0 = *pB0;
+                float valB1 = *pB1;
+                pA0 += sAn;
+                pA1 += sAn;
+                pB0 += sBn;
+                pB1 += sBn;
+
+                sum00 += valA0 * valB0;
+                sum01 += valA0 * valB1;
+                sum10 += valA1 * valB0;
+                sum11 += valA1 * valB1;
+            }
+
+            plp_gemm_store_f32(&pC0[o], sum00, alpha, beta);
+            plp_gemm_store_f32(&pC0[o + 1], sum01, alpha, beta);
+            plp_gemm_store_f32(&pC1[o], sum10, alpha, beta);
+            plp_gemm_store_f32(&pC1[o + 1], sum11, alpha, beta);
+        }
+
+        // clean up for o
+        if (o < tile.oEnd) {
+            const float *pA0 = &pSrcA[m * sAm];
+            const float *pB0 = &pSrcB[o * sBo];
+            plp_gemm_store_f32(&pC0[o], plp_gemm_dot_f32(pA0, pB0, N, sAn, sBn), alpha, beta);
+            plp_gemm_store_f32(&pC1[o], plp_gemm_dot_f32(pA0 + sAm, pB0, N, sAn, sBn), alpha, beta);
+        }
+    }
+
+    // clean up for m
+    if (m < tile.mEnd) {
+        float *pC0 = &pDstC[m * strideC];
+        const float *pA0 = &pSrcA[m * sAm];
+
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            const float *pB0 = &pSrcB[o * sBo];
+            plp_gemm_store_f32(&pC0[o], plp_gemm_dot_f32(pA0, pB0, N, sAn, sBn), alpha, beta);
+        }
+    }
+}
+
+/**
+  @} end of GemmKernels group
+ */
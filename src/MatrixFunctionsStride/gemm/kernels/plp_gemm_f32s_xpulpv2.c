@@ -0,0 +1,177 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gemm_f32s_xpulpv2.c
+ * Description:  general matrix multiplication of 32-bit floating-point matrices kernel
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Gemm
+ */
+
+/**
+  @defgroup GemmKernels General Matrix Multiplication Kernels
+  This module contains the kernel code for the general matrix multiplication of strided real and
+  complex matrices.
+ */
+
+/**
+  @addtogroup GemmKernels
+  @{
+ */
+
+/* stores alpha * sum + beta * C, without reading C if beta is zero */
+static inline void plp_gemm_store_f32(float *pC, float sum, float alpha, float beta) {
+    if (beta == 0.0f) {
+        *pC = alpha * sum;
+    } else {
+        *pC = alpha * sum + beta * (*pC);
+    }
+}
+
+/* dot product of N elements, which are sA and sB elements apart */
+static inline float plp_gemm_dot_f32(const float *pA, const float *pB, uint32_t N, uint32_t sA,
+                                     uint32_t sB) {
+    uint32_t n;
+    float sum = 0.0f;
+
+    for (n = 0; n < N; n++) {
+        sum += (*pA) * (*pB);
+        pA += sA;
+        pB += sB;
+    }
+
+    return sum;
+}
+
+/**
+  @brief General matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+  @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+  @param[in]     M         height of op(A) and of the output matrix
+  @param[in]     N         width of op(A) and height of op(B)
+  @param[in]     O         width of op(B) and of the output matrix
+  @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+  @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+  @param[in]     strideC   Stride of matrix C (elements between each row)
+  @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+  @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+  @param[in]     alpha     scaling factor of the matrix product
+  @param[in]     beta      scaling factor of the existing output matrix
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+
+  @par Register blocking
+  The output is computed in blocks of 2x2 elements, such that every loaded element of A and B is
+  used twice. The elements of op(A) and op(B) are addressed with the strides along their rows and
+  columns, which depend on the transpose flags, with post-increment loads.
+ */
+
+void plp_gemm_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           uint32_t transA,
+                           uint32_t transB,
+                           float alpha,
+                           float beta,
+                           float *__restrict__ pDstC) {
+
+    uint32_t sAm = (transA == PLP_GEMM_NO_TRANS) ? strideA : 1; // stride of op(A) along m
+    uint32_t sAn = (transA == PLP_GEMM_NO_TRANS) ? 1 : strideA; // stride of op(A) along n
+    uint32_t sBn = (transB == PLP_GEMM_NO_TRANS) ? strideB : 1; // stride of op(B) along n
+    uint32_t sBo = (transB == PLP_GEMM_NO_TRANS) ? 1 : strideB; // stride of op(B) along o
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m + 2 <= M; m += 2) {
+        float *pC0 = &pDstC[m * strideC];
+        float *pC1 = &pDstC[(m + 1) * strideC];
+
+        for (o = 0; o + 2 <= O; o += 2) {
+            const float *pA0 = &pSrcA[m * sAm];
+            const float *pA1 = pA0 + sAm;
+            const float *pB0 = &pSrcB[o * sBo];
+            const float *pB1 = pB0 + sBo;
+
+            float sum00 = 0.0f;
+            float sum01 = 0.0f;
+            float sum10 = 0.0f;
+            float sum11 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float valA0 = *pA0;
+                float valA1 = *pA1;
+                float valB0 = *pB0;
+                float valB1 = *pB1;
+                pA0 += sAn;
+                pA1 += sAn;
+                pB0 += sBn;
+                pB1 += sBn;
+
+                sum00 += valA0 * valB0;
+                sum01 += valA0 * valB1;
+                sum10 += valA1 * valB0;
+                sum11 += valA1 * valB1;
+            }
+
+            plp_gemm_store_f32(&pC0[o], sum00, alpha, beta);
+            plp_gemm_store_f32(&pC0[o + 1], sum01, alpha, beta);
+            plp_gemm_store_f32(&pC1[o], sum10, alpha, beta);
+            plp_gemm_store_f32(&pC1[o + 1], sum11, alpha, beta);
+        }
+
+        // clean up for o
+        if (o < O) {
+            const float *pA0 = &pSrcA[m * sAm];
+            const float *pB0 = &pSrcB[o * sBo];
+            plp_gemm_store_f32(&pC0[o], plp_gemm_dot_f32(pA0, pB0, N, sAn, sBn), alpha, beta);
+            plp_gemm_store_f32(&pC1[o], plp_gemm_dot_f32(pA0 + sAm, pB0, N, sAn, sBn), alpha, beta);
+        }
+    }
+
+    // clean up for m
+    if (m < M) {
+        float *pC0 = &pDstC[m * strideC];
+        const float *pA0 = &pSrcA[m * sAm];
+
+        for (o = 0; o < O; o++) {
+            const float *pB0 = &pSrcB[o * sBo];
+            plp_gemm_store_f32(&pC0[o], plp_gemm_dot_f32(pA0, pB0, N, sAn, sBn), alpha, beta);
+        }
+    }
+}
+
+/**
+  @} end of GemmKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gemm_cmplx_f32.c
+ * Description:  general matrix multiplication of complex 32-bit float matrices glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup Gemm
+  @{
+ */
+
+/**
+  @brief Glue code for general matrix multiplication of complex 32-bit floating-point matrices.
+  @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+  @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+  @param[in]     M         height of op(A) and of the output matrix
+  @param[in]     N         width of op(A) and height of op(B)
+  @param[in]     O         width of op(B) and of the output matrix
+  @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+  @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+  @param[in]     strideC   Stride of matrix C (elements between each row)
+  @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+  @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+  @param[in]     pAlpha    points to the complex scaling factor of the matrix product
+  @param[in]     pBeta     points to the complex scaling factor of the existing output
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+ */
+
+void plp_gemm_cmplx_f32(const float *__restrict__ pSrcA,
+                        const float *__restrict__ pSrcB,
+                        uint32_t M,
+                        uint32_t N,
+                        uint32_t O,
+                        uint32_t strideA,
+                        uint32_t strideB,
+                        uint32_t strideC,
+                        uint32_t transA,
+                        uint32_t transB,
+                        const float *__restrict__ pAlpha,
+                        const float *__restrict__ pBeta,
+                        float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_gemm_cmplx_f32s_xpulpv2(pSrcA,
+                                    pSrcB,
+                                    M,
+                                    N,
+                                    O,
+                                    strideA,
+                                    strideB,
+                                    strideC,
+                                    transA,
+                                    transB,
+                                    pAlpha,
+                                    pBeta,
+                                    pDstC);
+    }
+}
+
+/**
+  @} end of Gemm group
+ */
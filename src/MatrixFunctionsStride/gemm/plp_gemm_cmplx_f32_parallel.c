@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gemm_cmplx_f32_parallel.c
+ * Description:  parallel general matrix multiplication of complex 32-bit float matrices glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup Gemm
+  @{
+ */
+
+/**
+  @brief Glue code for parallel general matrix multiplication of complex 32-bit floating-point
+         matrices.
+  @param[in]     pSrcA     points to the first input matrix, MxN or NxM if transposed
+  @param[in]     pSrcB     points to the second input matrix, NxO or OxN if transposed
+  @param[in]     M         height of op(A) and of the output matrix
+  @param[in]     N         width of op(A) and height of op(B)
+  @param[in]     O         width of op(B) and of the output matrix
+  @param[in]     strideA   Stride of matrix A as stored (elements between each row)
+  @param[in]     strideB   Stride of matrix B as stored (elements between each row)
+  @param[in]     strideC   Stride of matrix C (elements between each row)
+  @param[in]     transA    op(A): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+  @param[in]     transB    op(B): PLP_GEMM_NO_TRANS, PLP_GEMM_TRANS or PLP_GEMM_CONJ_TRANS
+  @param[in]     pAlpha    points to the complex scaling factor of the matrix product
+  @param[in]     pBeta     points to the complex scaling factor of the existing output
+  @param[in]     nPE       Number of cores to use
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+ */
+
+void plp_gemm_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                 const float *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t strideA,
+                                 uint32_t strideB,
+                                 uint32_t strideC,
+                                 uint32_t transA,
+                                 uint32_t transB,
+                                 const float *__restrict__ pAlpha,
+                                 const float *__restrict__ pBeta,
+                                 uint32_t nPE,
+                                 float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_gemm_cmplx_f32_parallel), M * N * O);
+        }
+
+        plp_gemm_instance_cmplx_f32 args = { .pSrcA = pSrcA,
+                                             .pSrcB = pSrcB,
+                                             .M = M,
+                                             .N = N,
+                                             .O = O,
+                                             .strideA = strideA,
+                                             .strideB = strideB,
+                                             .strideC = strideC,
+                                             .transA = transA,
+                                             .transB = transB,
+                                             .alphaRe = pAlpha[0],
+                                             .alphaIm = pAlpha[1],
+                                             .betaRe = pBeta[0],
+                                             .betaIm = pBeta[1],
+                                             .nPE = nPE,
+                                             .pDstC = pDstC };
+        rt_team_fork(nPE, plp_gemm_cmplx_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of Gemm group
+ */
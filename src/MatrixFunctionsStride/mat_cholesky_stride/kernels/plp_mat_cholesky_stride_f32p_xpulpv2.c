@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_f32p_xpulpv2.c
+ * Description:  32-bit floating-point parallel strided Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholeskyStride
+ */
+
+/**
+  @addtogroup MatCholeskyStrideKernels
+  @{
+ */
+
+/**
+   @brief Parallel strided Cholesky decomposition of 32-bit floating-point matrices kernel for
+   XPULPV2 extension.
+   @param[in]  args      pointer to plp_mat_cholesky_stride_instance_f32 struct initialized by
+   plp_mat_cholesky_stride_f32_parallel
+   The status field is set to 1 if the matrix is not positive definite.
+   @return        none
+*/
+
+void plp_mat_cholesky_stride_f32p_xpulpv2(void *args) {
+
+    plp_mat_cholesky_stride_instance_f32 *a = (plp_mat_cholesky_stride_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        float *pRowJ = pDst + j * strideDst;
+
+        /* the core of row j computes the diagonal element of column j */
+        if (j % nPE == core_id) {
+            float sum = pSrc[j * strideSrc + j];
+
+            for (k = 0; k < j; k++) {
+                sum -= pRowJ[k] * pRowJ[k];
+            }
+
+            if (sum <= 0.0f) {
+                a->status = 1;
+            } else {
+                pRowJ[j] = __builtin_sqrtf(sum);
+
+                for (k = j + 1; k < N; k++) {
+                    pRowJ[k] = 0.0f;
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        /* the status is read by all cores before the next column can set it */
+        int status = a->status;
+
+        plp_team_barrier();
+
+        if (status != 0) {
+            return;
+        }
+
+        float invDiag = 1.0f / pRowJ[j];
+
+        /* every core computes the elements of column j in its rows below the diagonal */
+        for (i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE; i < N; i += nPE) {
+            float *pRowI = pDst + i * strideDst;
+            float sum = pSrc[i * strideSrc + j];
+
+            for (k = 0; k < j; k++) {
+                sum -= pRowI[k] * pRowJ[k];
+            }
+            pRowI[j] = sum * invDiag;
+        }
+    }
+}
+
+/**
+  @} end of MatCholeskyStrideKernels group
+ */
@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_f32s_xpulpv2.c
+ * Description:  32-bit floating-point strided Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholeskyStride
+ */
+
+/**
+  @defgroup MatCholeskyStrideKernels Strided Cholesky Decomposition Kernels
+  This module contains the kernel functions for the strided Cholesky decomposition.
+ */
+
+/**
+  @addtogroup MatCholeskyStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+  @param[in]  N         Width and height of both matrices
+  @param[in]  strideSrc Stride of input matrix (elements between each row)
+  @param[in]  strideDst Stride of output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite
+ */
+
+int plp_mat_cholesky_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                         uint32_t N,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         float *__restrict__ pDst) {
+
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        float *pRowJ = pDst + j * strideDst;
+
+        /* diagonal element of column j */
+        float sum = pSrc[j * strideSrc + j];
+
+        for (k = 0; k < j; k++) {
+            sum -= pRowJ[k] * pRowJ[k];
+        }
+
+        if (sum <= 0.0f) {
+            return 1;
+        }
+
+        pRowJ[j] = __builtin_sqrtf(sum);
+
+        for (k = j + 1; k < N; k++) {
+            pRowJ[k] = 0.0f;
+        }
+
+        float invDiag = 1.0f / pRowJ[j];
+
+        /* elements of column j below the diagonal */
+        for (i = j + 1; i < N; i++) {
+            float *pRowI = pDst + i * strideDst;
+            float sum = pSrc[i * strideSrc + j];
+
+            for (k = 0; k < j; k++) {
+                sum -= pRowI[k] * pRowJ[k];
+            }
+            pRowI[j] = sum * invDiag;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatCholeskyStrideKernels group
+ */
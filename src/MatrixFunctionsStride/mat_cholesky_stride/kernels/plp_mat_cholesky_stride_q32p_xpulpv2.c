@@ -0,0 +1,141 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_q32p_xpulpv2.c
+ * Description:  32-bit fix-point parallel strided Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholeskyStride
+ */
+
+/**
+  @addtogroup MatCholeskyStrideKernels
+  @{
+ */
+
+/* integer square root of a 64-bit value, rounded down */
+static uint32_t isqrt64(uint64_t x) {
+
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+/**
+   @brief Parallel strided Cholesky decomposition of 32-bit fix-point matrices kernel for
+   XPULPV2 extension.
+   @param[in]  args      pointer to plp_mat_cholesky_stride_instance_q32 struct initialized by
+   plp_mat_cholesky_stride_q32_parallel
+   The status field is set to 1 if the matrix is not positive definite.
+   @return        none
+*/
+
+void plp_mat_cholesky_stride_q32p_xpulpv2(void *args) {
+
+    plp_mat_cholesky_stride_instance_q32 *a = (plp_mat_cholesky_stride_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t i, j, k;
+    int64_t one = (int64_t)1 << fracBits;
+
+    for (j = 0; j < N; j++) {
+        int32_t *pRowJ = pDst + j * strideDst;
+
+        /* the core of row j computes the diagonal element of column j */
+        if (j % nPE == core_id) {
+            int64_t sum = (int64_t)pSrc[j * strideSrc + j] * one;
+
+            for (k = 0; k < j; k++) {
+                sum -= (int64_t)pRowJ[k] * pRowJ[k];
+            }
+
+            if (sum <= 0) {
+                a->status = 1;
+            } else {
+                uint32_t root = isqrt64((uint64_t)sum);
+                pRowJ[j] = (root > INT32_MAX) ? INT32_MAX : (int32_t)root;
+
+                for (k = j + 1; k < N; k++) {
+                    pRowJ[k] = 0;
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        /* the status is read by all cores before the next column can set it */
+        int status = a->status;
+
+        plp_team_barrier();
+
+        if (status != 0) {
+            return;
+        }
+
+        int32_t diag = pRowJ[j];
+
+        /* every core computes the elements of column j in its rows below the diagonal */
+        for (i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE; i < N; i += nPE) {
+            int32_t *pRowI = pDst + i * strideDst;
+            int64_t sum = (int64_t)pSrc[i * strideSrc + j] * one;
+
+            for (k = 0; k < j; k++) {
+                sum -= (int64_t)pRowI[k] * pRowJ[k];
+            }
+            sum /= diag;
+            pRowI[j] = (sum > INT32_MAX) ? INT32_MAX
+                                         : ((sum < INT32_MIN) ? INT32_MIN : (int32_t)sum);
+        }
+    }
+}
+
+/**
+  @} end of MatCholeskyStrideKernels group
+ */
@@ -0,0 +1,126 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_q32s_rv32im.c
+ * Description:  32-bit fix-point strided Cholesky decomposition kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholeskyStride
+ */
+
+/**
+  @addtogroup MatCholeskyStrideKernels
+  @{
+ */
+
+/* integer square root of a 64-bit value, rounded down */
+static uint32_t isqrt64(uint64_t x) {
+
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+/**
+  @brief Strided Cholesky decomposition of 32-bit fix-point matrices kernel for RV32IM extension.
+  @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+  @param[in]  N         Width and height of both matrices
+  @param[in]  strideSrc Stride of input matrix (elements between each row)
+  @param[in]  strideDst Stride of output matrix (elements between each row)
+  @param[in]  fracBits  Number of fractional bits of all matrices
+  @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite
+ */
+
+int plp_mat_cholesky_stride_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                        uint32_t N,
+                                        uint32_t strideSrc,
+                                        uint32_t strideDst,
+                                        uint32_t fracBits,
+                                        int32_t *__restrict__ pDst) {
+
+    uint32_t i, j, k;
+    int64_t one = (int64_t)1 << fracBits;
+
+    for (j = 0; j < N; j++) {
+        int32_t *pRowJ = pDst + j * strideDst;
+
+        /* diagonal element of column j */
+        int64_t sum = (int64_t)pSrc[j * strideSrc + j] * one;
+
+        for (k = 0; k < j; k++) {
+            sum -= (int64_t)pRowJ[k] * pRowJ[k];
+        }
+
+        if (sum <= 0) {
+            return 1;
+        }
+
+        uint32_t root = isqrt64((uint64_t)sum);
+        pRowJ[j] = (root > INT32_MAX) ? INT32_MAX : (int32_t)root;
+
+        for (k = j + 1; k < N; k++) {
+            pRowJ[k] = 0;
+        }
+
+        int32_t diag = pRowJ[j];
+
+        /* elements of column j below the diagonal */
+        for (i = j + 1; i < N; i++) {
+            int32_t *pRowI = pDst + i * strideDst;
+            int64_t sum = (int64_t)pSrc[i * strideSrc + j] * one;
+
+            for (k = 0; k < j; k++) {
+                sum -= (int64_t)pRowI[k] * pRowJ[k];
+            }
+            sum /= diag;
+            pRowI[j] = (sum > INT32_MAX) ? INT32_MAX
+                                         : ((sum < INT32_MIN) ? INT32_MIN : (int32_t)sum);
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatCholeskyStrideKernels group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_f32.c
+ * Description:  32-bit floating-point strided Cholesky decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatCholeskyStride Strided Cholesky Decomposition
+  This module contains the glue code for the strided Cholesky decomposition. The kernel codes
+  (kernels) are in the Module strided Cholesky decomposition Kernels.
+
+  The Cholesky decomposition factors a symmetric positive-definite matrix A of shape NxN into a
+  lower triangular matrix L, such that
+
+      `A = L * L^T`
+
+  Only the lower triangle of A is read, and the upper triangle of L is set to zero. Together with
+  the triangular solves (Module strided triangular solve), it solves the linear system A * X = B
+  with about a third of the operations of a matrix inversion, and with better accuracy.
+
+  There are functions for 32-bit floating-point and 32-bit fix-point matrices. For the fix-point
+  functions, all matrices have fracBits fractional bits, and the sums are accumulated with 64 bits.
+  The floating-point functions are supported only on the cluster side.
+
+  @par Algorithm
+  The matrix is decomposed column by column (Cholesky-Crout). The diagonal element of column j is
+  the square root of A[j,j] minus the squares of the elements of row j of L. Every element of row
+  i below it is A[i,j] minus the dot product of the rows i and j of L, divided by the diagonal
+  element. The parallel functions distribute the rows cyclically to the cores, and need a single
+  barrier per column. They compute exactly the same result as the single core functions.
+ */
+
+/**
+  @addtogroup MatCholeskyStride
+  @{
+ */
+
+/**
+  @brief Glue code for strided Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+  @param[in]  N         Width and height of both matrices
+  @param[in]  strideSrc Stride of input matrix (elements between each row)
+  @param[in]  strideDst Stride of output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+ */
+
+int plp_mat_cholesky_stride_f32(const float *__restrict__ pSrc,
+                                uint32_t N,
+                                uint32_t strideSrc,
+                                uint32_t strideDst,
+                                float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_cholesky_stride_f32s_xpulpv2(pSrc, N, strideSrc, strideDst, pDst);
+    }
+}
+
+/**
+  @} end of MatCholeskyStride group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_f32_parallel.c
+ * Description:  32-bit floating-point parallel strided Cholesky decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatCholeskyStride
+  @{
+ */
+
+/**
+  @brief Glue code for parallel strided Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+  @param[in]  N         Width and height of both matrices
+  @param[in]  strideSrc Stride of input matrix (elements between each row)
+  @param[in]  strideDst Stride of output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+ */
+
+int plp_mat_cholesky_stride_f32_parallel(const float *__restrict__ pSrc,
+                                         uint32_t N,
+                                         uint32_t strideSrc,
+                                         uint32_t strideDst,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_cholesky_stride_f32_parallel), N * N * N);
+        }
+
+        plp_mat_cholesky_stride_instance_f32 args = { .pSrc = pSrc,
+                                                      .N = N,
+                                                      .strideSrc = strideSrc,
+                                                      .strideDst = strideDst,
+                                                      .nPE = nPE,
+                                                      .pDst = pDst,
+                                                      .status = 0 };
+
+        rt_team_fork(nPE, plp_mat_cholesky_stride_f32p_xpulpv2, (void *)&args);
+
+        return args.status;
+    }
+}
+
+/**
+  @} end of MatCholeskyStride group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_stride_q32.c
+ * Description:  32-bit fix-point strided Cholesky decomposition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatCholeskyStride
+  @{
+ */
+
+/**
+  @brief Glue code for strided Cholesky decomposition of 32-bit fix-point matrices.
+  @param[in]  pSrc      Points to the input matrix, only the lower triangle is read
+  @param[in]  N         Width and height of both matrices
+  @param[in]  strideSrc Stride of input matrix (elements between each row)
+  @param[in]  strideDst Stride of output matrix (elements between each row)
+  @param[in]  fracBits  Number of fractional bits of all matrices
+  @param[out] pDst      Points to the output matrix L, with zeros above the diagonal
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+ */
+
+int plp_mat_cholesky_stride_q32(const int32_t *__restrict__ pSrc,
+                                uint32_t N,
+                                uint32_t strideSrc,
+                                uint32_t strideDst,
+                                uint32_t fracBits,
+                                int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_mat_cholesky_stride_q32s_rv32im(pSrc, N, strideSrc, strideDst, fracBits, pDst);
+    } else {
+        return plp_mat_cholesky_stride_q32s_xpulpv2(pSrc, N, strideSrc, strideDst, fracBits, pDst);
+    }
+}
+
+/**
+  @} end of MatCholeskyStride group
+ */
@@ -52,7 +52,7 @@
 
 void plp_mat_copy_stride_i8p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_copy_stride_instance_i8 *a = (plp_mat_copy_stride_instance_i8 *)args;
 
@@ -67,8 +67,13 @@ void plp_mat_copy_stride_i8p_xpulpv2(void *args) {
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_range range;
+    plp_mat_split(M, N, nPE, core_id, &range);
+
+    for (int m = range.mStart; m < range.mEnd; m++) {
+        uint32_t nStart = (m == range.mStart) ? range.nStart : 0;
+        uint32_t nEnd = (m == range.mEnd - 1) ? range.nEnd : N;
+        for (int n = nStart; n < nEnd; n++) {
             pDst[m * strideDst + n] = pSrc[m * strideSrc + n];
         }
     }
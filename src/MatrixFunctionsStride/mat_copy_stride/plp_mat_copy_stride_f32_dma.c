@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_copy_stride_f32_dma.c
+ * Description:  DMA copy of a strided 32-bit floats matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatCopyStride
+  @{
+ */
+
+/**
+  @brief      Copies an MxN strided 32-bit floats matrix between L2 and L1 with the DMA and waits
+              until it is done
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @return     none
+ */
+
+void plp_mat_copy_stride_f32_dma(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 float *__restrict__ pDst,
+                                 int dir) {
+
+    rt_dma_copy_t copy;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    plp_mat_copy_stride_f32_dma_async(pSrc, M, N, strideSrc, strideDst, pDst, dir, &copy);
+    rt_dma_wait(&copy);
+}
+
+/**
+  @} end of MatCopyStride group
+ */
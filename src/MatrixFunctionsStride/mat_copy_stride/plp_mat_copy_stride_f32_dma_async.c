@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_copy_stride_f32_dma_async.c
+ * Description:  Asynchronous DMA copy of a strided 32-bit floats matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatCopyStride
+  @{
+ */
+
+/**
+  @brief      Starts the DMA transfer of an MxN strided 32-bit floats matrix between L2 and L1
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or RT_DMA_DIR_LOC2EXT
+  @param[out] copy      Handle of the transfer, wait for it with rt_dma_wait
+  @return     none
+
+  @par DMA transfers
+  The cluster DMA can only stride on the L2 side of a transfer. If the matrix in L1 is dense
+  (its stride equals N), the whole matrix is moved with a single 2D transfer (or a single 1D
+  transfer if both matrices are dense). Otherwise, every row is a separate transfer, and all of
+  them are merged into the same handle. The cores are free until rt_dma_wait is called.
+ */
+
+void plp_mat_copy_stride_f32_dma_async(const float *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       float *__restrict__ pDst,
+                                       int dir,
+                                       rt_dma_copy_t *copy) {
+
+    uintptr_t ext, loc;
+    uint32_t strideExt, strideLoc;
+    uint32_t m;
+    int merge = 0;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        ext = (uintptr_t)pSrc;
+        loc = (uintptr_t)pDst;
+        strideExt = strideSrc;
+        strideLoc = strideDst;
+    } else {
+        ext = (uintptr_t)pDst;
+        loc = (uintptr_t)pSrc;
+        strideExt = strideDst;
+        strideLoc = strideSrc;
+    }
+
+    if ((strideExt == N && strideLoc == N) || M <= 1) {
+        rt_dma_memcpy(ext, loc, sizeof(float) * M * N, dir, 0, copy);
+    } else if (strideLoc == N) {
+        rt_dma_memcpy_2d(ext, loc, sizeof(float) * M * N, sizeof(float) * strideExt,
+                         sizeof(float) * N, dir, 0, copy);
+    } else {
+        for (m = 0; m < M; m++) {
+            rt_dma_memcpy(ext + sizeof(float) * m * strideExt,
+                          loc + sizeof(float) * m * strideLoc,
+                          sizeof(float) * N,
+                          dir,
+                          merge,
+                          copy);
+            merge = 1;
+        }
+    }
+}
+
+/**
+  @} end of MatCopyStride group
+ */
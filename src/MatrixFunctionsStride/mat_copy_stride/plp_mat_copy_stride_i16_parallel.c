@@ -63,6 +63,10 @@ void plp_mat_copy_stride_i16_parallel(const int16_t *__restrict__ pSrc,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_copy_stride_i16_parallel), M * N);
+        }
+
         plp_mat_copy_stride_instance_i16 args = { .pSrc = pSrc,
                                                   .M = M,
                                                   .N = N,
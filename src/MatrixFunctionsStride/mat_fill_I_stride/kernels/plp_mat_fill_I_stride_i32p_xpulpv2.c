@@ -48,7 +48,7 @@
 
 void plp_mat_fill_I_stride_i32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_fill_I_stride_instance_i32 *a = (plp_mat_fill_I_stride_instance_i32 *)args;
 
@@ -60,8 +60,13 @@ void plp_mat_fill_I_stride_i32p_xpulpv2(void *args) {
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int i = core_id; i < N; i += nPE) {
-        for (int j = 0; j < N; j++) {
+    plp_mat_range range;
+    plp_mat_split(N, N, nPE, core_id, &range);
+
+    for (int i = range.mStart; i < range.mEnd; i++) {
+        uint32_t nStart = (i == range.mStart) ? range.nStart : 0;
+        uint32_t nEnd = (i == range.mEnd - 1) ? range.nEnd : N;
+        for (int j = nStart; j < nEnd; j++) {
             pDst[i * stride + j] = (int32_t)(i == j);
         }
     }
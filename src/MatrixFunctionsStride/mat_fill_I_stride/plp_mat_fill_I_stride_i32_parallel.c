@@ -57,6 +57,10 @@ void plp_mat_fill_I_stride_i32_parallel(uint32_t N,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_fill_I_stride_i32_parallel), N * N);
+        }
+
         plp_mat_fill_I_stride_instance_i32 args = {
             .N = N, .stride = stride, .nPE = nPE, .pDst = pDst
         };
@@ -59,6 +59,10 @@ void plp_mat_fill_I_stride_q8_parallel(
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_fill_I_stride_q8_parallel), N * N);
+        }
+
         plp_mat_fill_I_stride_instance_q8 args = {
             .N = N, .stride = stride, .fracBits = fracBits, .nPE = nPE, .pDst = pDst
         };
@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fill_stride_i16_dma.c
+ * Description:  DMA fill of a strided 16-bit integers matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatFillStride
+  @{
+ */
+
+/**
+  @brief      Fills an MxN strided 16-bit integers matrix in L2 with the DMA
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  value  Value to fill the matrix with
+  @param[out] pDst   Points to the output matrix in L2
+  @return     none
+
+  @par DMA transfers
+  A staging buffer of PLP_DMA_FILL_BUFFER_SIZE bytes in L1 is filled with as many rows as fit,
+  and is copied over the destination with 2D transfers. Rows longer than the buffer are copied
+  in chunks. All transfers share a single handle.
+ */
+
+void plp_mat_fill_stride_i16_dma(uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 int16_t value,
+                                 int16_t *__restrict__ pDst) {
+
+    uint32_t i, m;
+    uint32_t bufLen = PLP_DMA_FILL_BUFFER_SIZE / sizeof(int16_t);
+    uint32_t rowsPerBuf;
+    int16_t *pBuf;
+    rt_dma_copy_t copy;
+    int merge = 0;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    if (N <= bufLen) {
+        rowsPerBuf = bufLen / N;
+        if (rowsPerBuf > M) {
+            rowsPerBuf = M;
+        }
+        bufLen = rowsPerBuf * N;
+    } else {
+        rowsPerBuf = 0;
+    }
+
+    pBuf = (int16_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, sizeof(int16_t) * bufLen);
+
+    if (pBuf == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    for (i = 0; i < bufLen; i++) {
+        pBuf[i] = value;
+    }
+
+    if (rowsPerBuf > 0) {
+        // copy blocks of whole rows
+        for (m = 0; m < M; m += rowsPerBuf) {
+            uint32_t rows = (M - m < rowsPerBuf) ? M - m : rowsPerBuf;
+            if (stride == N || rows == 1) {
+                rt_dma_memcpy((uintptr_t)(pDst + m * stride), (uintptr_t)pBuf,
+                              sizeof(int16_t) * rows * N, RT_DMA_DIR_LOC2EXT, merge, &copy);
+            } else {
+                rt_dma_memcpy_2d((uintptr_t)(pDst + m * stride), (uintptr_t)pBuf,
+                                 sizeof(int16_t) * rows * N, sizeof(int16_t) * stride,
+                                 sizeof(int16_t) * N, RT_DMA_DIR_LOC2EXT, merge, &copy);
+            }
+            merge = 1;
+        }
+    } else {
+        // copy every row in chunks of the buffer size
+        for (m = 0; m < M; m++) {
+            for (i = 0; i < N; i += bufLen) {
+                uint32_t len = (N - i < bufLen) ? N - i : bufLen;
+                rt_dma_memcpy((uintptr_t)(pDst + m * stride + i), (uintptr_t)pBuf,
+                              sizeof(int16_t) * len, RT_DMA_DIR_LOC2EXT, merge, &copy);
+                merge = 1;
+            }
+        }
+    }
+
+    rt_dma_wait(&copy);
+
+    plp_scratch_free(RT_ALLOC_CL_DATA, pBuf, sizeof(int16_t) * bufLen);
+}
+
+/**
+  @} end of MatFillStride group
+ */
@@ -60,6 +60,10 @@ void plp_mat_fill_stride_i32_parallel(uint32_t M,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_fill_stride_i32_parallel), M * N);
+        }
+
         plp_mat_fill_stride_instance_i32 args = {
             .M = M, .N = N, .stride = stride, .value = value, .nPE = nPE, .pDst = pDst
         };
@@ -0,0 +1,166 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_stride_f32s_xpulpv2.c
+ * Description:  32-bit floating-point strided matrix fused multiply accumulate for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup MatFmaStride
+ */
+
+/**
+  @addtogroup MatFmaStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided matrix fused multiply accumulate of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     strideA   Stride of matrix A (elements between each row)
+  @param[in]     strideB   Stride of matrix B (elements between each row)
+  @param[in]     strideC   Stride of matrix C (elements between each row)
+  @param[in]     alpha     scaling factor of the matrix product
+  @param[in]     beta      scaling factor of the existing output matrix
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+
+  @par Register blocking
+  The output is computed in blocks of 2x2 elements, such that every loaded element of A and B is
+  used twice. Each element of C is loaded and stored only once.
+ */
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+
+void plp_mat_fma_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     float alpha,
+                                     float beta,
+                                     float *__restrict__ pDstC) {
+
+#ifdef BASIC_VERSION
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = 0; m < M; m++) {
+        float *pC = &pDstC[m * strideC];
+        for (o = 0; o < O; o++) {
+            float sum = 0.0f;
+            for (n = 0; n < N; n++) {
+                float valA = pSrcA[m * strideA + n];
+                float valB = pSrcB[n * strideB + o];
+                sum += valA * valB;
+            }
+            pC[o] = alpha * sum + beta * pC[o];
+        }
+    }
+
+#else
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m + 2 <= M; m += 2) {
+        float *pC0 = &pDstC[m * strideC];
+        float *pC1 = &pDstC[(m + 1) * strideC];
+
+        for (o = 0; o + 2 <= O; o += 2) {
+            float sum00 = 0.0f;
+            float sum01 = 0.0f;
+            float sum10 = 0.0f;
+            float sum11 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float valA0 = pSrcA[m * strideA + n];
+                float valA1 = pSrcA[(m + 1) * strideA + n];
+                float valB0 = pSrcB[n * strideB + o];
+                float valB1 = pSrcB[n * strideB + o + 1];
+
+                sum00 += valA0 * valB0;
+                sum01 += valA0 * valB1;
+                sum10 += valA1 * valB0;
+                sum11 += valA1 * valB1;
+            }
+
+            pC0[o] = alpha * sum00 + beta * pC0[o];
+            pC0[o + 1] = alpha * sum01 + beta * pC0[o + 1];
+            pC1[o] = alpha * sum10 + beta * pC1[o];
+            pC1[o + 1] = alpha * sum11 + beta * pC1[o + 1];
+        }
+
+        // clean up for o
+        for (; o < O; o++) {
+            float sum0 = 0.0f;
+            float sum1 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float valB = pSrcB[n * strideB + o];
+                sum0 += pSrcA[m * strideA + n] * valB;
+                sum1 += pSrcA[(m + 1) * strideA + n] * valB;
+            }
+
+            pC0[o] = alpha * sum0 + beta * pC0[o];
+            pC1[o] = alpha * sum1 + beta * pC1[o];
+        }
+    }
+
+    // clean up for m
+    for (; m < M; m++) {
+        float *pC = &pDstC[m * strideC];
+
+        for (o = 0; o < O; o++) {
+            float sum = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float valA = pSrcA[m * strideA + n];
+                float valB = pSrcB[n * strideB + o];
+                sum += valA * valB;
+            }
+
+            pC[o] = alpha * sum + beta * pC[o];
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+}
+
+/**
+   @} end of MatFmaStrideKernels group
+*/
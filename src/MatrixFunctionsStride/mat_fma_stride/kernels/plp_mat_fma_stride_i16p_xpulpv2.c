@@ -0,0 +1,169 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_stride_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer strided matrix fused multiply accumulate for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup MatFmaStride
+ */
+
+/**
+  @addtogroup MatFmaStrideKernels
+  @{
+ */
+
+/**
+  @brief Parallel strided matrix fused multiply accumulate of 16-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_fma_stride_instance_i16 struct initialized by
+                    plp_mat_fma_stride_i16_parallel
+  @return     none
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition, in blocks of
+  2x2 elements.
+ */
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+
+void plp_mat_fma_stride_i16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_fma_stride_instance_i16 *a = (plp_mat_fma_stride_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    int32_t alpha = a->alpha;
+    int32_t beta = a->beta;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+#ifdef BASIC_VERSION
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        int32_t *pC = &pDstC[m * strideC];
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                int32_t valA = (int32_t)pSrcA[m * strideA + n];
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum += valA * valB;
+            }
+            pC[o] = alpha * sum + beta * pC[o];
+        }
+    }
+
+#else
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = tile.mStart; m + 2 <= tile.mEnd; m += 2) {
+        int32_t *pC0 = &pDstC[m * strideC];
+        int32_t *pC1 = &pDstC[(m + 1) * strideC];
+
+        for (o = tile.oStart; o + 2 <= tile.oEnd; o += 2) {
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n < N; n++) {
+                int32_t valA0 = (int32_t)pSrcA[m * strideA + n];
+                int32_t valA1 = (int32_t)pSrcA[(m + 1) * strideA + n];
+                int32_t valB0 = (int32_t)pSrcB[n * strideB + o];
+                int32_t valB1 = (int32_t)pSrcB[n * strideB + o + 1];
+
+                sum00 += valA0 * valB0;
+                sum01 += valA0 * valB1;
+                sum10 += valA1 * valB0;
+                sum11 += valA1 * valB1;
+            }
+
+            pC0[o] = alpha * sum00 + beta * pC0[o];
+            pC0[o + 1] = alpha * sum01 + beta * pC0[o + 1];
+            pC1[o] = alpha * sum10 + beta * pC1[o];
+            pC1[o + 1] = alpha * sum11 + beta * pC1[o + 1];
+        }
+
+        // clean up for o
+        for (; o < tile.oEnd; o++) {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+
+            for (n = 0; n < N; n++) {
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum0 += (int32_t)pSrcA[m * strideA + n] * valB;
+                sum1 += (int32_t)pSrcA[(m + 1) * strideA + n] * valB;
+            }
+
+            pC0[o] = alpha * sum0 + beta * pC0[o];
+            pC1[o] = alpha * sum1 + beta * pC1[o];
+        }
+    }
+
+    // clean up for m
+    for (; m < tile.mEnd; m++) {
+        int32_t *pC = &pDstC[m * strideC];
+
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            int32_t sum = 0;
+
+            for (n = 0; n < N; n++) {
+                int32_t valA = (int32_t)pSrcA[m * strideA + n];
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum += valA * valB;
+            }
+
+            pC[o] = alpha * sum + beta * pC[o];
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of MatFmaStrideKernels group
+*/
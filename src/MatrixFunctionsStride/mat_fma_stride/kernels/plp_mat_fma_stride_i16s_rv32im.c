@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_stride_i16s_rv32im.c
+ * Description:  16-bit integer strided matrix fused multiply accumulate for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup MatFmaStride
+ */
+
+/**
+  @addtogroup MatFmaStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided matrix fused multiply accumulate of 16-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     strideA   Stride of matrix A (elements between each row)
+  @param[in]     strideB   Stride of matrix B (elements between each row)
+  @param[in]     strideC   Stride of matrix C (elements between each row)
+  @param[in]     alpha     scaling factor of the matrix product
+  @param[in]     beta      scaling factor of the existing output matrix
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+ */
+
+void plp_mat_fma_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    int32_t alpha,
+                                    int32_t beta,
+                                    int32_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = 0; m < M; m++) {
+        int32_t *pC = &pDstC[m * strideC];
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                int32_t valA = (int32_t)pSrcA[m * strideA + n];
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum += valA * valB;
+            }
+            pC[o] = alpha * sum + beta * pC[o];
+        }
+    }
+}
+
+/**
+   @} end of MatFmaStrideKernels group
+*/
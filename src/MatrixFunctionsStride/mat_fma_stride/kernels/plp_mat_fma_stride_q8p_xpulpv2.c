@@ -0,0 +1,186 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_stride_q8p_xpulpv2.c
+ * Description:  parallel 8-bit fix-point strided matrix fused multiply accumulate for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup MatFmaStride
+ */
+
+/**
+  @addtogroup MatFmaStrideKernels
+  @{
+ */
+
+/**
+  @brief Parallel strided matrix fused multiply accumulate of 8-bit fix-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_fma_stride_instance_q8 struct initialized by
+                    plp_mat_fma_stride_q8_parallel
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product of two elements of A and B is shifted by the parameter `shift` to the right (with
+  rounding), like in the matrix multiplication. Then, alpha and beta are interpreted as fix-point
+  numbers with `shift` bits after the binary point: Both alpha * (A * B) and beta * C are shifted by
+  `shift` to the right (with rounding) before they are added. Set alpha and beta to `1 << shift` to
+  simply accumulate the product onto C. The output is stored as 8-bit array, set the `shift`
+  parameter such that no overflow ocurrs.
+
+  @par Work distribution
+  Each core computes one tile of the output matrix, determined by plp_mat_partition, in blocks of
+  2x2 elements.
+ */
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+
+void plp_mat_fma_stride_q8p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_fma_stride_instance_q8 *a = (plp_mat_fma_stride_instance_q8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    int32_t alpha = a->alpha;
+    int32_t beta = a->beta;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+#ifdef BASIC_VERSION
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        int8_t *pC = &pDstC[m * strideC];
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                int32_t valA = (int32_t)pSrcA[m * strideA + n];
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum += __ROUNDNORM_REG(valA * valB, shift);
+            }
+            sum = __ROUNDNORM_REG(alpha * sum, shift);
+            pC[o] = (int8_t)(sum + __ROUNDNORM_REG(beta * pC[o], shift));
+        }
+    }
+
+#else
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = tile.mStart; m + 2 <= tile.mEnd; m += 2) {
+        int8_t *pC0 = &pDstC[m * strideC];
+        int8_t *pC1 = &pDstC[(m + 1) * strideC];
+
+        for (o = tile.oStart; o + 2 <= tile.oEnd; o += 2) {
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n < N; n++) {
+                int32_t valA0 = (int32_t)pSrcA[m * strideA + n];
+                int32_t valA1 = (int32_t)pSrcA[(m + 1) * strideA + n];
+                int32_t valB0 = (int32_t)pSrcB[n * strideB + o];
+                int32_t valB1 = (int32_t)pSrcB[n * strideB + o + 1];
+
+                sum00 += __ROUNDNORM_REG(valA0 * valB0, shift);
+                sum01 += __ROUNDNORM_REG(valA0 * valB1, shift);
+                sum10 += __ROUNDNORM_REG(valA1 * valB0, shift);
+                sum11 += __ROUNDNORM_REG(valA1 * valB1, shift);
+            }
+
+            sum00 = __ROUNDNORM_REG(alpha * sum00, shift);
+            pC0[o] = (int8_t)(sum00 + __ROUNDNORM_REG(beta * pC0[o], shift));
+            sum01 = __ROUNDNORM_REG(alpha * sum01, shift);
+            pC0[o + 1] = (int8_t)(sum01 + __ROUNDNORM_REG(beta * pC0[o + 1], shift));
+            sum10 = __ROUNDNORM_REG(alpha * sum10, shift);
+            pC1[o] = (int8_t)(sum10 + __ROUNDNORM_REG(beta * pC1[o], shift));
+            sum11 = __ROUNDNORM_REG(alpha * sum11, shift);
+            pC1[o + 1] = (int8_t)(sum11 + __ROUNDNORM_REG(beta * pC1[o + 1], shift));
+        }
+
+        // clean up for o
+        for (; o < tile.oEnd; o++) {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+
+            for (n = 0; n < N; n++) {
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum0 += __ROUNDNORM_REG((int32_t)pSrcA[m * strideA + n] * valB, shift);
+                sum1 += __ROUNDNORM_REG((int32_t)pSrcA[(m + 1) * strideA + n] * valB, shift);
+            }
+
+            sum0 = __ROUNDNORM_REG(alpha * sum0, shift);
+            pC0[o] = (int8_t)(sum0 + __ROUNDNORM_REG(beta * pC0[o], shift));
+            sum1 = __ROUNDNORM_REG(alpha * sum1, shift);
+            pC1[o] = (int8_t)(sum1 + __ROUNDNORM_REG(beta * pC1[o], shift));
+        }
+    }
+
+    // clean up for m
+    for (; m < tile.mEnd; m++) {
+        int8_t *pC = &pDstC[m * strideC];
+
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            int32_t sum = 0;
+
+            for (n = 0; n < N; n++) {
+                int32_t valA = (int32_t)pSrcA[m * strideA + n];
+                int32_t valB = (int32_t)pSrcB[n * strideB + o];
+                sum += __ROUNDNORM_REG(valA * valB, shift);
+            }
+
+            sum = __ROUNDNORM_REG(alpha * sum, shift);
+            pC[o] = (int8_t)(sum + __ROUNDNORM_REG(beta * pC[o], shift));
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of MatFmaStrideKernels group
+*/
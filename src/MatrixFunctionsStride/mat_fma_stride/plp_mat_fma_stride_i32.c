@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_stride_i32.c
+ * Description:  32-bit integer strided matrix fused multiply accumulate glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatFmaStride Strided Matrix Fused Multiply Accumulate
+  This module contains the glue code for the strided general matrix multiply accumulate (GEMM)
+
+      `pDstC = alpha * pSrcA * pSrcB + beta * pDstC`
+
+  where A is a matrix of shape MxN, B of shape NxO and C of shape MxO. The output matrix C is read
+  and written in the same pass as the matrix product is computed. The kernel codes (kernels) are in
+  the Module Strided Matrix Fused Multiply Accumulate Kernels.
+
+  The `strideX` argument tells how many elements are in between the start of each row of the matrix.
+  In other words, it is the width of the original matrix. @ref groupMatrixStride
+ */
+
+/**
+  @addtogroup MatFmaStride
+  @{
+ */
+
+/**
+  @brief Glue code for strided matrix fused multiply accumulate of 32-bit integer matrices.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     strideA   Stride of matrix A (elements between each row)
+  @param[in]     strideB   Stride of matrix B (elements between each row)
+  @param[in]     strideC   Stride of matrix C (elements between each row)
+  @param[in]     alpha     scaling factor of the matrix product
+  @param[in]     beta      scaling factor of the existing output matrix
+  @param[in,out] pDstC     points to the output matrix, which is updated in place
+  @return        none
+ */
+
+void plp_mat_fma_stride_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            int32_t alpha,
+                            int32_t beta,
+                            int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_fma_stride_i32s_rv32im(pSrcA,
+                                       pSrcB,
+                                       M,
+                                       N,
+                                       O,
+                                       strideA,
+                                       strideB,
+                                       strideC,
+                                       alpha,
+                                       beta,
+                                       pDstC);
+    } else {
+        plp_mat_fma_stride_i32s_xpulpv2(pSrcA,
+                                        pSrcB,
+                                        M,
+                                        N,
+                                        O,
+                                        strideA,
+                                        strideB,
+                                        strideC,
+                                        alpha,
+                                        beta,
+                                        pDstC);
+    }
+}
+
+/**
+  @} end of MatFmaStride group
+ */
@@ -55,13 +55,13 @@
   occurrs.
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The output matrix is partitioned into one tile per core, which is computed by
+  plp_mat_mult_cmplx_stride_q16s_xpulpv2 in blocks of 2x2 elements with packed complex arithmetic.
 */
 
 void plp_mat_mult_cmplx_stride_q16p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_mult_cmplx_stride_instance_q16 *a = (plp_mat_mult_cmplx_stride_instance_q16 *)args;
 
@@ -77,32 +77,18 @@ void plp_mat_mult_cmplx_stride_q16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int16_t *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * strideA + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * strideA + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(n * strideB + o) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(n * strideB + o) * 2 + 1];
-                sum_re += __ROUNDNORM_REG(a_re * b_re - a_im * b_im, shift);
-                sum_im += __ROUNDNORM_REG(a_re * b_im + a_im * b_re, shift);
-            }
-            pDstC[(m * strideC + o) * 2 + 0] = (int16_t)sum_re;
-            pDstC[(m * strideC + o) * 2 + 1] = (int16_t)sum_im;
-        }
-    }
-
-#else
+    if (tile.mStart < tile.mEnd && tile.oStart < tile.oEnd) {
+        const int16_t *pA = pSrcA + 2 * tile.mStart * strideA;
+        const int16_t *pB = pSrcB + 2 * tile.oStart;
+        int16_t *pC = pDstC + 2 * (tile.mStart * strideC + tile.oStart);
 
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+        plp_mat_mult_cmplx_stride_q16s_xpulpv2(pA, pB, tile.mEnd - tile.mStart, N,
+                                               tile.oEnd - tile.oStart, strideA, strideB, strideC,
+                                               shift, pC);
+    }
 }
 
 /**
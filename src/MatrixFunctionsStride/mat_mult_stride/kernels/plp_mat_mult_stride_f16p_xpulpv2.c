@@ -0,0 +1,236 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_stride_f16p_xpulpv2.c
+ * Description:  Parallel half-precision floating-point strided matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup BasicMatMultStride
+ */
+
+/**
+  @addtogroup BasicMatMultStrideKernels
+  @{
+ */
+
+/**
+   @brief Parallel strided matrix multiplication of half-precision floating-point matrices kernel
+          for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_stride_instance_f16 struct initialized by
+                     plp_mat_mult_stride_f16_parallel
+   @return     none
+
+   @par Precision
+   The inputs are converted to single precision when they are loaded, and all products are
+   accumulated in single precision. Only the results are rounded to half precision.
+
+   @par Register blocking
+   The output is computed in blocks of 4x4 elements, such that four converted values of A and four
+   converted values of B are reused for 16 multiply-accumulates.
+
+   @par Work distribution
+   Each core computes one tile of the output matrix, determined by plp_mat_partition.
+*/
+
+void plp_mat_mult_stride_f16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_stride_instance_f16 *a = (plp_mat_mult_stride_instance_f16 *)args;
+
+    const float16_t *__restrict__ pSrcA = a->pSrcA;
+    const float16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t nPE = a->nPE;
+    float16_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    uint32_t m, n, o;
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
+            float sum = 0;
+            for (n = 0; n < N; n++) {
+                sum = sum + plp_f16_to_f32_inline(pSrcA[m * strideA + n]) *
+                                plp_f16_to_f32_inline(pSrcB[n * strideB + o]);
+            }
+            pDstC[m * strideC + o] = plp_f32_to_f16_inline(sum);
+        }
+    }
+
+#else
+
+    uint32_t m, n, o;
+
+    uint32_t M_blk = tile.mStart + ((tile.mEnd - tile.mStart) & ~0x3);
+    uint32_t O_blk = tile.oStart + ((tile.oEnd - tile.oStart) & ~0x3);
+
+    for (m = tile.mStart; m < M_blk; m += 4) {
+
+        const float16_t *__restrict__ pA0 = pSrcA + m * strideA;
+        const float16_t *__restrict__ pA1 = pA0 + strideA;
+        const float16_t *__restrict__ pA2 = pA1 + strideA;
+        const float16_t *__restrict__ pA3 = pA2 + strideA;
+
+        // 4x4 blocks
+        for (o = tile.oStart; o < O_blk; o += 4) {
+
+            float sum00 = 0, sum01 = 0, sum02 = 0, sum03 = 0;
+            float sum10 = 0, sum11 = 0, sum12 = 0, sum13 = 0;
+            float sum20 = 0, sum21 = 0, sum22 = 0, sum23 = 0;
+            float sum30 = 0, sum31 = 0, sum32 = 0, sum33 = 0;
+
+            const float16_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float a0 = plp_f16_to_f32_inline(pA0[n]);
+                float a1 = plp_f16_to_f32_inline(pA1[n]);
+                float a2 = plp_f16_to_f32_inline(pA2[n]);
+                float a3 = plp_f16_to_f32_inline(pA3[n]);
+
+                float b0 = plp_f16_to_f32_inline(pB[0]);
+                float b1 = plp_f16_to_f32_inline(pB[1]);
+                float b2 = plp_f16_to_f32_inline(pB[2]);
+                float b3 = plp_f16_to_f32_inline(pB[3]);
+                pB += strideB;
+
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum02 += a0 * b2;
+                sum03 += a0 * b3;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+                sum12 += a1 * b2;
+                sum13 += a1 * b3;
+                sum20 += a2 * b0;
+                sum21 += a2 * b1;
+                sum22 += a2 * b2;
+                sum23 += a2 * b3;
+                sum30 += a3 * b0;
+                sum31 += a3 * b1;
+                sum32 += a3 * b2;
+                sum33 += a3 * b3;
+            }
+
+            float16_t *__restrict__ pC = pDstC + m * strideC + o;
+            pC[0] = plp_f32_to_f16_inline(sum00);
+            pC[1] = plp_f32_to_f16_inline(sum01);
+            pC[2] = plp_f32_to_f16_inline(sum02);
+            pC[3] = plp_f32_to_f16_inline(sum03);
+            pC += strideC;
+            pC[0] = plp_f32_to_f16_inline(sum10);
+            pC[1] = plp_f32_to_f16_inline(sum11);
+            pC[2] = plp_f32_to_f16_inline(sum12);
+            pC[3] = plp_f32_to_f16_inline(sum13);
+            pC += strideC;
+            pC[0] = plp_f32_to_f16_inline(sum20);
+            pC[1] = plp_f32_to_f16_inline(sum21);
+            pC[2] = plp_f32_to_f16_inline(sum22);
+            pC[3] = plp_f32_to_f16_inline(sum23);
+            pC += strideC;
+            pC[0] = plp_f32_to_f16_inline(sum30);
+            pC[1] = plp_f32_to_f16_inline(sum31);
+            pC[2] = plp_f32_to_f16_inline(sum32);
+            pC[3] = plp_f32_to_f16_inline(sum33);
+        }
+
+        // column tail: 4x1 blocks
+        for (o = O_blk; o < tile.oEnd; o++) {
+
+            float sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+            const float16_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float b = plp_f16_to_f32_inline(*pB);
+                pB += strideB;
+                sum0 += plp_f16_to_f32_inline(pA0[n]) * b;
+                sum1 += plp_f16_to_f32_inline(pA1[n]) * b;
+                sum2 += plp_f16_to_f32_inline(pA2[n]) * b;
+                sum3 += plp_f16_to_f32_inline(pA3[n]) * b;
+            }
+
+            pDstC[(m + 0) * strideC + o] = plp_f32_to_f16_inline(sum0);
+            pDstC[(m + 1) * strideC + o] = plp_f32_to_f16_inline(sum1);
+            pDstC[(m + 2) * strideC + o] = plp_f32_to_f16_inline(sum2);
+            pDstC[(m + 3) * strideC + o] = plp_f32_to_f16_inline(sum3);
+        }
+    }
+
+    // row tail: 1x4 blocks and the remaining corner
+    for (m = M_blk; m < tile.mEnd; m++) {
+
+        const float16_t *__restrict__ pA = pSrcA + m * strideA;
+
+        for (o = tile.oStart; o < O_blk; o += 4) {
+
+            float sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+            const float16_t *__restrict__ pB = pSrcB + o;
+
+            for (n = 0; n < N; n++) {
+                float a = plp_f16_to_f32_inline(pA[n]);
+                sum0 += a * plp_f16_to_f32_inline(pB[0]);
+                sum1 += a * plp_f16_to_f32_inline(pB[1]);
+                sum2 += a * plp_f16_to_f32_inline(pB[2]);
+                sum3 += a * plp_f16_to_f32_inline(pB[3]);
+                pB += strideB;
+            }
+
+            pDstC[m * strideC + o + 0] = plp_f32_to_f16_inline(sum0);
+            pDstC[m * strideC + o + 1] = plp_f32_to_f16_inline(sum1);
+            pDstC[m * strideC + o + 2] = plp_f32_to_f16_inline(sum2);
+            pDstC[m * strideC + o + 3] = plp_f32_to_f16_inline(sum3);
+        }
+
+        for (o = O_blk; o < tile.oEnd; o++) {
+            float sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += plp_f16_to_f32_inline(pA[n]) * plp_f16_to_f32_inline(pSrcB[n * strideB + o]);
+            }
+            pDstC[m * strideC + o] = plp_f32_to_f16_inline(sum);
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+}
+
+/**
+   @} end of BasicMatMultStrideKernels group
+*/
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Parallel strided 8-bit by 16-bit integer matrix product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMultStride
+ */
+
+/**
+  @addtogroup BasicMatMultStrideKernels
+  @{
+ */
+
+/**
+   @brief Parallel strided matrix multiplication of an 8-bit with a 16-bit integer matrix kernel for
+   XPULPV2 extension.
+   @param[in]  args      pointer to plp_mat_mult_stride_instance_i8xi16 struct initialized by
+   plp_mat_mult_stride_i8xi16_parallel
+   @return     none
+
+   @par Work distribution
+   Each core computes the tile of the output matrix determined by plp_mat_partition with
+   plp_mat_mult_stride_i8xi16s_xpulpv2, see there for the sign extension in registers.
+*/
+
+void plp_mat_mult_stride_i8xi16p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_mult_stride_instance_i8xi16 *a = (plp_mat_mult_stride_instance_i8xi16 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    plp_mat_tile tile;
+    plp_mat_partition(a->M, a->O, a->nPE, core_id, &tile);
+
+    if (tile.mStart < tile.mEnd && tile.oStart < tile.oEnd) {
+        plp_mat_mult_stride_i8xi16s_xpulpv2(pSrcA + tile.mStart * strideA, pSrcB + tile.oStart,
+                                            tile.mEnd - tile.mStart, N, tile.oEnd - tile.oStart,
+                                            strideA, strideB, strideC,
+                                            pDstC + tile.mStart * strideC + tile.oStart);
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of BasicMatMultStrideKernels group
+*/
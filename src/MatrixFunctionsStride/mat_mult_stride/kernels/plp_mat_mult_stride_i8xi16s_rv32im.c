@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Strided 8-bit by 16-bit integer matrix product for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMultStride
+ */
+
+/**
+  @addtogroup BasicMatMultStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided matrix multiplication of an 8-bit with a 16-bit integer matrix kernel for RV32IM
+         extension.
+  @param[in]  pSrcA     points to the first input matrix [8 bit]
+  @param[in]  pSrcB     points to the second input matrix [16 bit]
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  strideA   Stride of matrix A (elements between each row)
+  @param[in]  strideB   Stride of matrix B (elements between each row)
+  @param[in]  strideC   Stride of output matrix (elements between each row)
+  @param[out] pDstC     points to the output matrix [32 bit]
+  @return     none
+ */
+
+void plp_mat_mult_stride_i8xi16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        uint32_t strideA,
+                                        uint32_t strideB,
+                                        uint32_t strideC,
+                                        int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int32_t)pSrcA[m * strideA + n] * (int32_t)pSrcB[n * strideB + o];
+            }
+            pDstC[m * strideC + o] = sum;
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultStrideKernels group
+*/
@@ -0,0 +1,155 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        x
+ * Description:  Strided 8-bit by 16-bit integer matrix product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMultStride
+ */
+
+/**
+  @addtogroup BasicMatMultStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided matrix multiplication of an 8-bit with a 16-bit integer matrix kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the first input matrix [8 bit]
+  @param[in]  pSrcB     points to the second input matrix [16 bit]
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  strideA   Stride of matrix A (elements between each row)
+  @param[in]  strideB   Stride of matrix B (elements between each row)
+  @param[in]  strideC   Stride of output matrix (elements between each row)
+  @param[out] pDstC     points to the output matrix [32 bit]
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every word of 4 values of a row of A is sign-extended to 2 vectors of 2 halfwords, the even and
+  the odd elements (plp_unpack_i8), which are multiplied with the 16-bit dot product instructions,
+  with 32 bit accumulators. The matching pairs of a column of B, rows n and n + 2, and rows n + 1
+  and n + 3, are built with shuffles from the words of two neighbouring columns.
+
+  @par Blocking
+  The output is computed in blocks of 2x2 elements, such that every unpacked word of A is used for
+  two columns and every pair of B for two rows. An odd last column packs the pairs of B from single
+  halfwords, and an odd last row is computed as a block with two equal rows.
+ */
+
+void plp_mat_mult_stride_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t strideA,
+                                         uint32_t strideB,
+                                         uint32_t strideC,
+                                         int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    for (m = 0; m < M; m += 2) {
+        const int8_t *pA0 = pSrcA + m * strideA;
+        const int8_t *pA1 = (m + 1 < M) ? pA0 + strideA : pA0;
+        int32_t *pC0 = pDstC + m * strideC;
+        int32_t *pC1 = (m + 1 < M) ? pC0 + strideC : pC0;
+
+        for (o = 0; o < O; o += 2) {
+            const int16_t *pB = pSrcB + o;
+            int32_t sum00 = 0, sum01 = 0, sum10 = 0, sum11 = 0;
+
+            if (o + 1 < O) {
+                for (n = 0; n + 4 <= N; n += 4) {
+                    v4s a0 = *((v4s *)((void *)(pA0 + n)));
+                    v4s a1 = *((v4s *)((void *)(pA1 + n)));
+                    v2s b0 = *((v2s *)((void *)(pB + n * strideB)));
+                    v2s b1 = *((v2s *)((void *)(pB + (n + 1) * strideB)));
+                    v2s b2 = *((v2s *)((void *)(pB + (n + 2) * strideB)));
+                    v2s b3 = *((v2s *)((void *)(pB + (n + 3) * strideB)));
+
+                    v2s a0Even = plp_unpack_i8(a0, 0);
+                    v2s a0Odd = plp_unpack_i8(a0, 1);
+                    v2s a1Even = plp_unpack_i8(a1, 0);
+                    v2s a1Odd = plp_unpack_i8(a1, 1);
+                    v2s bEven0 = __builtin_shuffle(b0, b2, (v2s){ 0, 2 });
+                    v2s bEven1 = __builtin_shuffle(b0, b2, (v2s){ 1, 3 });
+                    v2s bOdd0 = __builtin_shuffle(b1, b3, (v2s){ 0, 2 });
+                    v2s bOdd1 = __builtin_shuffle(b1, b3, (v2s){ 1, 3 });
+
+                    sum00 = __SUMDOTP2(a0Even, bEven0, sum00);
+                    sum00 = __SUMDOTP2(a0Odd, bOdd0, sum00);
+                    sum01 = __SUMDOTP2(a0Even, bEven1, sum01);
+                    sum01 = __SUMDOTP2(a0Odd, bOdd1, sum01);
+                    sum10 = __SUMDOTP2(a1Even, bEven0, sum10);
+                    sum10 = __SUMDOTP2(a1Odd, bOdd0, sum10);
+                    sum11 = __SUMDOTP2(a1Even, bEven1, sum11);
+                    sum11 = __SUMDOTP2(a1Odd, bOdd1, sum11);
+                }
+                for (; n < N; n++) {
+                    int32_t b0 = pB[n * strideB];
+                    int32_t b1 = pB[n * strideB + 1];
+                    sum00 += pA0[n] * b0;
+                    sum01 += pA0[n] * b1;
+                    sum10 += pA1[n] * b0;
+                    sum11 += pA1[n] * b1;
+                }
+            } else {
+                /* last column of an odd width */
+                for (n = 0; n + 4 <= N; n += 4) {
+                    v4s a0 = *((v4s *)((void *)(pA0 + n)));
+                    v4s a1 = *((v4s *)((void *)(pA1 + n)));
+                    v2s bEven = (v2s){ pB[n * strideB], pB[(n + 2) * strideB] };
+                    v2s bOdd = (v2s){ pB[(n + 1) * strideB], pB[(n + 3) * strideB] };
+
+                    sum00 = __SUMDOTP2(plp_unpack_i8(a0, 0), bEven, sum00);
+                    sum00 = __SUMDOTP2(plp_unpack_i8(a0, 1), bOdd, sum00);
+                    sum10 = __SUMDOTP2(plp_unpack_i8(a1, 0), bEven, sum10);
+                    sum10 = __SUMDOTP2(plp_unpack_i8(a1, 1), bOdd, sum10);
+                }
+                for (; n < N; n++) {
+                    int32_t b0 = pB[n * strideB];
+                    sum00 += pA0[n] * b0;
+                    sum10 += pA1[n] * b0;
+                }
+            }
+
+            pC0[o] = sum00;
+            pC1[o] = sum10;
+            if (o + 1 < O) {
+                pC0[o + 1] = sum01;
+                pC1[o + 1] = sum11;
+            }
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultStrideKernels group
+*/
@@ -54,7 +54,7 @@
 
 void plp_mat_mult_stride_q32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_mult_stride_instance_q32 *a = (plp_mat_mult_stride_instance_q32 *)args;
 
@@ -77,8 +77,11 @@ void plp_mat_mult_stride_q32p_xpulpv2(void *args) {
     uint32_t n; // loop counter
     uint32_t o; // loop counter
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, nPE, core_id, &tile);
+
+    for (m = tile.mStart; m < tile.mEnd; m++) {
+        for (o = tile.oStart; o < tile.oEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 int32_t valA = pSrcA[m * strideA + n];
@@ -96,7 +99,7 @@ void plp_mat_mult_stride_q32p_xpulpv2(void *args) {
 #endif
 #undef BASIC_VERSION
 
-    rt_team_barrier();
+    plp_team_barrier();
 }
 
 /**
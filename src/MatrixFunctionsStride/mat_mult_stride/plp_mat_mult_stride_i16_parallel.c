@@ -69,6 +69,10 @@ void plp_mat_mult_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_mult_stride_i16_parallel), M * N * O);
+        }
+
         plp_mat_mult_stride_instance_i16 args = { .pSrcA = pSrcA,
                                                   .pSrcB = pSrcB,
                                                   .M = M,
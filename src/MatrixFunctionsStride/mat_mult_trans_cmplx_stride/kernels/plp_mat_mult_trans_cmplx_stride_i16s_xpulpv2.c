@@ -52,6 +52,19 @@
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
+
+  @par Exploiting SIMD instructions
+  Every complex element is a single word (re, im), such that a complex product takes two dot product
+  instructions. The imaginary part is the dot product of the element of B with the element of A with
+  swapped halves, (im, re). The real part is the dot product with (re, ~im), where ~im = -im - 1,
+  which is corrected by the imaginary part of the element of B. Unlike a negation, the inversion
+  cannot overflow, such that the results are identical to the ones of the RV32IM kernel. The
+  corrections are summed once per column of B and added at the end.
+
+  @par Blocking
+  The output is computed in blocks of 2x2 elements, such that every element of A is swapped and
+  inverted once for two columns and every element of B is used for two rows. An odd last row or
+  column is computed as a block with two equal rows or columns.
  */
 
 void plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -64,32 +77,57 @@ void plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pS
                                                   uint32_t strideC,
                                                   int32_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m, n, o; // loop counters
 
-    for (int m = 0; m < M; m++) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * strideA + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * strideA + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(o * strideB + n) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(o * strideB + n) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
-            }
-            pDstC[(m * strideC + o) * 2 + 0] = sum_re;
-            pDstC[(m * strideC + o) * 2 + 1] = sum_im;
-        }
-    }
+    for (m = 0; m < M; m += 2) {
+        const v2s *pA0 = (const v2s *)((const void *)(pSrcA + 2 * m * strideA));
+        const v2s *pA1 = (m + 1 < M) ? pA0 + strideA : pA0;
+        int32_t *pC0 = pDstC + 2 * m * strideC;
+        int32_t *pC1 = (m + 1 < M) ? pC0 + 2 * strideC : pC0;
+
+        for (o = 0; o < O; o += 2) {
+            const v2s *pB0 = (const v2s *)((const void *)(pSrcB + 2 * o * strideB));
+            const v2s *pB1 = (o + 1 < O) ? pB0 + strideB : pB0;
+            int32_t re00 = 0, im00 = 0, re01 = 0, im01 = 0;
+            int32_t re10 = 0, im10 = 0, re11 = 0, im11 = 0;
+            int32_t bIm0 = 0, bIm1 = 0; // sums of the imaginary parts of the columns of B
 
-#else
+            for (n = 0; n < N; n++) {
+                v2s a0 = pA0[n];
+                v2s a1 = pA1[n];
+                v2s b0 = pB0[n];
+                v2s b1 = pB1[n];
 
-    // TODO: Hackathon
+                /* (re, ~im) and (im, re) of the elements of A */
+                v2s a0Inv = (v2s)((uint32_t)a0 ^ 0xFFFF0000U);
+                v2s a1Inv = (v2s)((uint32_t)a1 ^ 0xFFFF0000U);
+                v2s a0Swap = __builtin_shuffle(a0, (v2s){ 1, 0 });
+                v2s a1Swap = __builtin_shuffle(a1, (v2s){ 1, 0 });
 
-#endif
-#undef BASIC_VERSION
+                re00 = __SUMDOTP2(a0Inv, b0, re00);
+                im00 = __SUMDOTP2(a0Swap, b0, im00);
+                re01 = __SUMDOTP2(a0Inv, b1, re01);
+                im01 = __SUMDOTP2(a0Swap, b1, im01);
+                re10 = __SUMDOTP2(a1Inv, b0, re10);
+                im10 = __SUMDOTP2(a1Swap, b0, im10);
+                re11 = __SUMDOTP2(a1Inv, b1, re11);
+                im11 = __SUMDOTP2(a1Swap, b1, im11);
+                bIm0 += (int32_t)b0 >> 16;
+                bIm1 += (int32_t)b1 >> 16;
+            }
+
+            pC0[2 * o] = re00 + bIm0;
+            pC0[2 * o + 1] = im00;
+            pC1[2 * o] = re10 + bIm0;
+            pC1[2 * o + 1] = im10;
+            if (o + 1 < O) {
+                pC0[2 * o + 2] = re01 + bIm1;
+                pC0[2 * o + 3] = im01;
+                pC1[2 * o + 2] = re11 + bIm1;
+                pC1[2 * o + 3] = im11;
+            }
+        }
+    }
 }
 /**
    @} end of MatMultTransCmplxStrideKernels group
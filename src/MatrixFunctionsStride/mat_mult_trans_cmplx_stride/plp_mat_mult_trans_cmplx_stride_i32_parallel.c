@@ -71,6 +71,11 @@ void plp_mat_mult_trans_cmplx_stride_i32_parallel(const int32_t *__restrict__ pS
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_mult_trans_cmplx_stride_i32_parallel),
+                               M * N * O);
+        }
+
         plp_mat_mult_cmplx_stride_instance_i32 args = { .pSrcA = pSrcA,
                                                         .pSrcB = pSrcB,
                                                         .M = M,
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_fro_stride_f32s_xpulpv2.c
+ * Description:  32-bit floating-point strided matrix Frobenius norm kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @defgroup MatNormStrideKernels Strided Matrix Norms and Trace Kernels
+  This module contains the kernel functions for the norms and the trace of strided matrices.
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided Frobenius norm of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pRes   Points to the Frobenius norm
+  @return     none
+ */
+
+void plp_mat_norm_fro_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          float *__restrict__ pRes) {
+
+    float sum0 = 0.0f;
+    float sum1 = 0.0f;
+    uint32_t m, n;
+
+    for (m = 0; m < M; m++) {
+        const float *pRow = pSrc + m * stride;
+        for (n = 0; n + 1 < N; n += 2) {
+            float x0 = pRow[n];
+            float x1 = pRow[n + 1];
+            sum0 += x0 * x0;
+            sum1 += x1 * x1;
+        }
+        if (n < N) {
+            float x0 = pRow[n];
+            sum0 += x0 * x0;
+        }
+    }
+
+    *pRes = __builtin_sqrtf(sum0 + sum1);
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_fro_stride_i16s_xpulpv2.c
+ * Description:  16-bit integer strided matrix Frobenius norm kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/* sum of squares of n samples, the samples before the first word-aligned sample are computed one
+   by one, such that the SIMD loop reads aligned words. Every dot product of a vector with itself
+   is at most 2^31 and fits into 32 unsigned bits. */
+static inline uint64_t plp_sum_sq_i16(const int16_t *pSrc, uint32_t n) {
+    uint64_t sum = 0;
+    uint32_t blkCnt = plp_align_head(pSrc, sizeof(int16_t), n);
+    const v2s *pV;
+
+    n -= blkCnt;
+    while (blkCnt > 0U) {
+        int32_t x = *pSrc++;
+        sum += (uint32_t)(x * x);
+        blkCnt--;
+    }
+
+    pV = (const v2s *)pSrc;
+    blkCnt = n >> 1U;
+    while (blkCnt > 0U) {
+        v2s x = *pV++;
+        sum += (uint32_t)__DOTP2(x, x);
+        blkCnt--;
+    }
+
+    if (n & 1U) {
+        int32_t x = *(const int16_t *)pV;
+        sum += (uint32_t)(x * x);
+    }
+
+    return sum;
+}
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided Frobenius norm of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pRes   Points to the Frobenius norm
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors, and the sum of squares of a vector is
+  computed with a single dot product. The sum is accumulated with 64 bits.
+ */
+
+void plp_mat_norm_fro_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          int32_t *__restrict__ pRes) {
+
+    uint64_t sum = 0;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        sum += plp_sum_sq_i16(pSrc + m * stride, N);
+    }
+
+    *pRes = (int32_t)plp_isqrt_u64_inline(sum);
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
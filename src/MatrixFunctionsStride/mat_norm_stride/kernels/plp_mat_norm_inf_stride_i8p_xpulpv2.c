@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_inf_stride_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer strided matrix infinity norm kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Parallel strided infinity norm of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args pointer to plp_mat_norm_stride_instance_i8 struct initialized by
+                   plp_mat_norm_inf_stride_i8_parallel
+  @return     none
+ */
+
+void plp_mat_norm_inf_stride_i8p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_norm_stride_instance_i8 *a = (plp_mat_norm_stride_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t stride = a->stride;
+    uint32_t nPE = a->nPE;
+    uint64_t *__restrict__ resBuffer = a->resBuffer;
+
+    /* every core computes the norm of a block of whole rows */
+    uint32_t mStart = (M * core_id) / nPE;
+    uint32_t mEnd = (M * (core_id + 1)) / nPE;
+    int32_t res;
+
+    plp_mat_norm_inf_stride_i8s_xpulpv2(pSrc + mStart * stride, mEnd - mStart, N, stride, &res);
+
+    resBuffer[core_id] = res;
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_inf_stride_i8s_xpulpv2.c
+ * Description:  8-bit integer strided matrix infinity norm kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided infinity norm of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pRes   Points to the infinity norm
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors. The absolute row sum is accumulated
+  with a SIMD absolute value and an unsigned sum of dot products with a vector of ones.
+ */
+
+void plp_mat_norm_inf_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes) {
+
+    const v4u ones = { 1, 1, 1, 1 };
+    int32_t max = 0;
+    uint32_t m, n;
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pRow = pSrc + m * stride;
+        uint32_t blkCnt = plp_align_head(pRow, sizeof(int8_t), N);
+        uint32_t sum = 0;
+
+        for (n = 0; n < blkCnt; n++) {
+            int32_t x = pRow[n];
+            sum += (x < 0) ? -x : x;
+        }
+        /* |-2^7| wraps to 0x80, which is correct as an unsigned lane */
+        for (; n + 3 < N; n += 4) {
+            sum = __SUMDOTUP4((v4u)__ABS4(*(const v4s *)(pRow + n)), ones, sum);
+        }
+        for (; n < N; n++) {
+            int32_t x = pRow[n];
+            sum += (x < 0) ? -x : x;
+        }
+
+        if ((int32_t)sum > max) {
+            max = (int32_t)sum;
+        }
+    }
+
+    *pRes = max;
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_one_stride_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point strided matrix one norm kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Parallel strided one norm of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args pointer to plp_mat_norm_stride_instance_f32 struct initialized by
+                   plp_mat_norm_one_stride_f32_parallel
+  @return     none
+ */
+
+void plp_mat_norm_one_stride_f32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_norm_stride_instance_f32 *a = (plp_mat_norm_stride_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t stride = a->stride;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ resBuffer = a->resBuffer;
+
+    /* every core computes the norm of a block of whole columns */
+    uint32_t nStart = (N * core_id) / nPE;
+    uint32_t nEnd = (N * (core_id + 1)) / nPE;
+    float res;
+
+    plp_mat_norm_one_stride_f32s_xpulpv2(pSrc + nStart, M, nEnd - nStart, stride, &res);
+
+    resBuffer[core_id] = res;
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
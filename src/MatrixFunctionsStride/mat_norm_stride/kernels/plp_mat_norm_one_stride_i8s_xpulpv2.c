@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_one_stride_i8s_xpulpv2.c
+ * Description:  8-bit integer strided matrix one norm kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided one norm of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pRes   Points to the one norm
+  @return     none
+
+  @par
+  The columns are strided in memory, so the absolute column sums are computed for four columns at
+  a time in registers, without SIMD and without a buffer of N partial sums.
+ */
+
+void plp_mat_norm_one_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t stride,
+                                         int32_t *__restrict__ pRes) {
+
+    int32_t max = 0;
+    uint32_t m, n;
+
+    /* four columns at a time, such that every row of the block is read with a single pass */
+    for (n = 0; n + 3 < N; n += 4) {
+        const int8_t *pCol = pSrc + n;
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+        for (m = 0; m < M; m++) {
+            sum0 += abs(pCol[0]);
+            sum1 += abs(pCol[1]);
+            sum2 += abs(pCol[2]);
+            sum3 += abs(pCol[3]);
+            pCol += stride;
+        }
+        sum0 = (sum1 > sum0) ? sum1 : sum0;
+        sum2 = (sum3 > sum2) ? sum3 : sum2;
+        sum0 = (sum2 > sum0) ? sum2 : sum0;
+        if (sum0 > max) {
+            max = sum0;
+        }
+    }
+
+    for (; n < N; n++) {
+        const int8_t *pCol = pSrc + n;
+        int32_t sum = 0;
+        for (m = 0; m < M; m++) {
+            sum += abs(*pCol);
+            pCol += stride;
+        }
+        if (sum > max) {
+            max = sum;
+        }
+    }
+
+    *pRes = max;
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
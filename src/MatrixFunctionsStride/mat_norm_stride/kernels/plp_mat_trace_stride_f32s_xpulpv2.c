@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trace_stride_f32s_xpulpv2.c
+ * Description:  32-bit floating-point strided matrix trace kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatNormStride
+ */
+
+/**
+  @addtogroup MatNormStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided trace of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  N      Width and height of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pRes   Points to the trace
+  @return     none
+ */
+
+void plp_mat_trace_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                       uint32_t N,
+                                       uint32_t stride,
+                                       float *__restrict__ pRes) {
+
+    float sum = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        sum += pSrc[n * (stride + 1)];
+    }
+
+    *pRes = sum;
+}
+
+/**
+  @} end of MatNormStrideKernels group
+ */
@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_fro_stride_f32.c
+ * Description:  32-bit floating-point strided matrix Frobenius norm glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatNormStride Strided Matrix Norms and Trace
+  This module contains the glue code for the norms and the trace of strided matrices. The kernel
+  codes (kernels) are in the Module strided matrix norms and trace Kernels.
+
+  The norms reduce a matrix A of shape MxN to a single non-negative value:
+
+      `fro = sqrt(sum_m sum_n A[m,n]^2)`
+      `inf = max_m sum_n |A[m,n]|`   (maximum absolute row sum)
+      `one = max_n sum_m |A[m,n]|`   (maximum absolute column sum)
+
+  and the trace is the sum of the diagonal elements of a square matrix of shape NxN. They are meant
+  for convergence checks and normalization of sub-matrices, which plp_max and friends on the
+  flattened matrix cannot handle.
+
+  There are functions for 32-bit floating-point, and for 16- and 8-bit integer matrices. The
+  integer functions return 32-bit results. The sum of squares of the Frobenius norm is accumulated
+  with 64 bits and the square root is truncated to an integer. The floating-point functions are
+  supported only on the cluster side.
+
+  The cluster kernels of the integer types compute the Frobenius and the infinity norm on packed
+  SIMD vectors along the rows. The parallel functions split the elements (Frobenius norm), the
+  rows (infinity norm) or the columns (one norm) evenly over the cores, and reduce the partial
+  results of the cores after the fork. The trace reads only N elements and has no parallel
+  function.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_norm_fro_stride_i16`):
+
+      `plp_<function name>_<data type><precision>[_parallel]`
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `mat_norm_{fro,inf,one}_stride` or `mat_trace_stride`
+  data type     | {f, i} respectively for floats and integers
+  precision     | {32, 16, 8} bits
+
+  The `stride` argument tells how many elements are in between the start of each row of the matrix.
+  In other words, it is the width of the original matrix. @ref groupMatrixStride
+ */
+
+/**
+  @addtogroup MatNormStride
+  @{
+ */
+
+/**
+  @brief Glue code for the strided Frobenius norm of 32-bit floating-point matrices.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[out] pRes   Points to the Frobenius norm
+  @return     none
+ */
+
+void plp_mat_norm_fro_stride_f32(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t stride,
+                                 float *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_norm_fro_stride_f32s_xpulpv2(pSrc, M, N, stride, pRes);
+    }
+}
+
+/**
+  @} end of MatNormStride group
+ */
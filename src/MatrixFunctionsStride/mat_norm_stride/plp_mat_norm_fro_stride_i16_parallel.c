@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_fro_stride_i16_parallel.c
+ * Description:  parallel 16-bit integer strided matrix Frobenius norm glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatNormStride
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel strided Frobenius norm of 16-bit integer matrices.
+  @param[in]  pSrc   Points to the input matrix
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  stride Stride of the matrix (elements between each row)
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pRes   Points to the Frobenius norm
+  @return     none
+ */
+
+void plp_mat_norm_fro_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t stride,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_norm_fro_stride_i16_parallel), M * N);
+        }
+
+        uint32_t i;
+        uint64_t resBuffer[nPE];
+        uint64_t sum = 0;
+
+        plp_mat_norm_stride_instance_i16 args = { .pSrc = pSrc,
+                                                  .M = M,
+                                                  .N = N,
+                                                  .stride = stride,
+                                                  .nPE = nPE,
+                                                  .resBuffer = resBuffer };
+
+        rt_team_fork(nPE, plp_mat_norm_fro_stride_i16p_xpulpv2, (void *)&args);
+
+        /* reduce the partial results of the cores */
+        for (i = 0; i < nPE; i++) {
+            sum += resBuffer[i];
+        }
+
+        *pRes = (int32_t)plp_isqrt_u64_inline(sum);
+    }
+}
+
+/**
+  @} end of MatNormStride group
+ */
@@ -65,6 +65,10 @@ void plp_mat_scale_stride_f32_parallel(const float *__restrict__ pSrc,
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_mat_scale_stride_f32_parallel), M * N);
+        }
+
         plp_mat_scale_stride_instance_f32 args = { .pSrc = pSrc,
                                                    .M = M,
                                                    .N = N,
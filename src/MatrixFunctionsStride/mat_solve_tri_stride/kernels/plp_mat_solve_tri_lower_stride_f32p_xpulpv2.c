@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_lower_stride_f32p_xpulpv2.c
+ * Description:  32-bit floating-point parallel strided lower triangular solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriStride
+ */
+
+/**
+  @addtogroup MatSolveTriStrideKernels
+  @{
+ */
+
+/**
+   @brief Parallel strided lower triangular solve of 32-bit floating-point matrices kernel for
+   XPULPV2 extension.
+   @param[in]  args      pointer to plp_mat_solve_tri_stride_instance_f32 struct initialized by
+   plp_mat_solve_tri_lower_stride_f32_parallel
+   The status field is set to 1 if the matrix is singular.
+   @return        none
+*/
+
+void plp_mat_solve_tri_lower_stride_f32p_xpulpv2(void *args) {
+
+    plp_mat_solve_tri_stride_instance_f32 *a = (plp_mat_solve_tri_stride_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t i, j, o;
+
+    /* every core copies its rows of the right-hand side into the output matrix */
+    for (i = core_id; i < N; i += nPE) {
+        for (o = 0; o < O; o++) {
+            pDstC[i * strideC + o] = pSrcB[i * strideB + o];
+        }
+    }
+
+    for (j = 0; j < N; j++) {
+        float *pRowJ = pDstC + j * strideC;
+
+        /* the core of row j computes row j of the solution */
+        if (j % nPE == core_id) {
+            float diag = pSrcA[j * strideA + j];
+
+            if (diag == 0.0f) {
+                a->status = 1;
+            } else {
+                float invDiag = 1.0f / diag;
+
+                for (o = 0; o < O; o++) {
+                    pRowJ[o] *= invDiag;
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        /* the status is read by all cores before the next column can set it */
+        int status = a->status;
+
+        plp_team_barrier();
+
+        if (status != 0) {
+            return;
+        }
+
+        /* every core eliminates row j of the solution from its rows below */
+        for (i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE; i < N; i += nPE) {
+            float factor = pSrcA[i * strideA + j];
+            float *pRowI = pDstC + i * strideC;
+
+            for (o = 0; o < O; o++) {
+                pRowI[o] -= factor * pRowJ[o];
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatSolveTriStrideKernels group
+ */
@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_lower_stride_q32p_xpulpv2.c
+ * Description:  32-bit fix-point parallel strided lower triangular solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriStride
+ */
+
+/**
+  @addtogroup MatSolveTriStrideKernels
+  @{
+ */
+
+/**
+   @brief Parallel strided lower triangular solve of 32-bit fix-point matrices kernel for
+   XPULPV2 extension.
+   @param[in]  args      pointer to plp_mat_solve_tri_stride_instance_q32 struct initialized by
+   plp_mat_solve_tri_lower_stride_q32_parallel
+   The status field is set to 1 if the matrix is singular.
+   @return        none
+*/
+
+void plp_mat_solve_tri_lower_stride_q32p_xpulpv2(void *args) {
+
+    plp_mat_solve_tri_stride_instance_q32 *a = (plp_mat_solve_tri_stride_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrcA = a->pSrcA;
+    const int32_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t i, j, o;
+    int64_t one = (int64_t)1 << fracBits;
+
+    /* every core copies its rows of the right-hand side into the output matrix */
+    for (i = core_id; i < N; i += nPE) {
+        for (o = 0; o < O; o++) {
+            pDstC[i * strideC + o] = pSrcB[i * strideB + o];
+        }
+    }
+
+    for (j = 0; j < N; j++) {
+        int32_t *pRowJ = pDstC + j * strideC;
+
+        /* the core of row j computes row j of the solution */
+        if (j % nPE == core_id) {
+            int32_t diag = pSrcA[j * strideA + j];
+
+            if (diag == 0) {
+                a->status = 1;
+            } else {
+                for (o = 0; o < O; o++) {
+                    int64_t val = (int64_t)pRowJ[o] * one / diag;
+                    pRowJ[o] = (val > INT32_MAX) ? INT32_MAX
+                                                 : ((val < INT32_MIN) ? INT32_MIN : (int32_t)val);
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        /* the status is read by all cores before the next column can set it */
+        int status = a->status;
+
+        plp_team_barrier();
+
+        if (status != 0) {
+            return;
+        }
+
+        /* every core eliminates row j of the solution from its rows below */
+        for (i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE; i < N; i += nPE) {
+            int32_t factor = pSrcA[i * strideA + j];
+            int32_t *pRowI = pDstC + i * strideC;
+
+            for (o = 0; o < O; o++) {
+                pRowI[o] -= (int32_t)(((int64_t)factor * pRowJ[o]) >> fracBits);
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatSolveTriStrideKernels group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_upper_stride_f32s_xpulpv2.c
+ * Description:  32-bit floating-point strided upper triangular solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriStride
+ */
+
+/**
+  @addtogroup MatSolveTriStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided upper triangular solve of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA   Points to the upper triangular matrix A of shape NxN
+  @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+  @param[in]  N       Width and height of A, height of B and X
+  @param[in]  O       Width of B and X (number of right-hand sides)
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideC Stride of the output matrix (elements between each row)
+  @param[out] pDstC   Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_tri_upper_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                float *__restrict__ pDstC) {
+
+    uint32_t i, j, n, o;
+
+    /* copy the right-hand side into the output matrix, where the system is solved in place */
+    for (i = 0; i < N; i++) {
+        for (o = 0; o < O; o++) {
+            pDstC[i * strideC + o] = pSrcB[i * strideB + o];
+        }
+    }
+
+    for (n = N; n > 0; n--) {
+        j = n - 1;
+        float diag = pSrcA[j * strideA + j];
+        float *pRowJ = pDstC + j * strideC;
+
+        if (diag == 0.0f) {
+            return 1;
+        }
+
+        /* row j of the solution */
+        float invDiag = 1.0f / diag;
+
+        for (o = 0; o < O; o++) {
+            pRowJ[o] *= invDiag;
+        }
+
+        /* eliminate row j of the solution from the rows above */
+        for (i = 0; i < j; i++) {
+            float factor = pSrcA[i * strideA + j];
+            float *pRowI = pDstC + i * strideC;
+
+            for (o = 0; o < O; o++) {
+                pRowI[o] -= factor * pRowJ[o];
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatSolveTriStrideKernels group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_upper_stride_q32s_xpulpv2.c
+ * Description:  32-bit fix-point strided upper triangular solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriStride
+ */
+
+/**
+  @addtogroup MatSolveTriStrideKernels
+  @{
+ */
+
+/**
+  @brief Strided upper triangular solve of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrcA    Points to the upper triangular matrix A of shape NxN
+  @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+  @param[in]  N        Width and height of A, height of B and X
+  @param[in]  O        Width of B and X (number of right-hand sides)
+  @param[in]  strideA  Stride of matrix A (elements between each row)
+  @param[in]  strideB  Stride of matrix B (elements between each row)
+  @param[in]  strideC  Stride of the output matrix (elements between each row)
+  @param[in]  fracBits Number of fractional bits of all matrices
+  @param[out] pDstC    Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_tri_upper_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t strideA,
+                                                uint32_t strideB,
+                                                uint32_t strideC,
+                                                uint32_t fracBits,
+                                                int32_t *__restrict__ pDstC) {
+
+    uint32_t i, j, n, o;
+    int64_t one = (int64_t)1 << fracBits;
+
+    /* copy the right-hand side into the output matrix, where the system is solved in place */
+    for (i = 0; i < N; i++) {
+        for (o = 0; o < O; o++) {
+            pDstC[i * strideC + o] = pSrcB[i * strideB + o];
+        }
+    }
+
+    for (n = N; n > 0; n--) {
+        j = n - 1;
+        int32_t diag = pSrcA[j * strideA + j];
+        int32_t *pRowJ = pDstC + j * strideC;
+
+        if (diag == 0) {
+            return 1;
+        }
+
+        /* row j of the solution */
+        for (o = 0; o < O; o++) {
+            int64_t val = (int64_t)pRowJ[o] * one / diag;
+            pRowJ[o] = (val > INT32_MAX) ? INT32_MAX
+                                         : ((val < INT32_MIN) ? INT32_MIN : (int32_t)val);
+        }
+
+        /* eliminate row j of the solution from the rows above */
+        for (i = 0; i < j; i++) {
+            int32_t factor = pSrcA[i * strideA + j];
+            int32_t *pRowI = pDstC + i * strideC;
+
+            for (o = 0; o < O; o++) {
+                pRowI[o] -= (int32_t)(((int64_t)factor * pRowJ[o]) >> fracBits);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatSolveTriStrideKernels group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_lower_stride_f32.c
+ * Description:  32-bit floating-point strided lower triangular solve glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatSolveTriStride Strided Triangular Solve
+  This module contains the glue code for solving strided triangular systems. The kernel codes
+  (kernels) are in the Module strided triangular solve Kernels.
+
+  The functions solve the linear system A * X = B, where A is a lower (plp_mat_solve_tri_lower) or
+  upper (plp_mat_solve_tri_upper) triangular matrix of shape NxN, and B and X have shape NxO, i.e.
+  there are O right-hand sides. Only the triangle of A given by the function is read. Together
+  with the Cholesky decomposition A = L * L^T, the system A * X = B is solved with L * Y = B and
+  L^T * X = Y.
+
+  There are functions for 32-bit floating-point and 32-bit fix-point matrices. For the fix-point
+  functions, all matrices have fracBits fractional bits. The floating-point functions are
+  supported only on the cluster side.
+
+  @par Algorithm
+  B is copied to X, and the system is solved in place by substitution, one row j of X at a time:
+  row j is divided by the diagonal element A[j,j], and A[i,j] times row j is subtracted from the
+  rows i below (lower) or above (upper) it. The parallel functions distribute the rows cyclically
+  to the cores, and need a single barrier per row. They compute exactly the same result as the
+  single core functions.
+ */
+
+/**
+  @addtogroup MatSolveTriStride
+  @{
+ */
+
+/**
+  @brief Glue code for strided lower triangular solve of 32-bit floating-point matrices.
+  @param[in]  pSrcA   Points to the lower triangular matrix A of shape NxN
+  @param[in]  pSrcB   Points to the right-hand side matrix B of shape NxO
+  @param[in]  N       Width and height of A, height of B and X
+  @param[in]  O       Width of B and X (number of right-hand sides)
+  @param[in]  strideA Stride of matrix A (elements between each row)
+  @param[in]  strideB Stride of matrix B (elements between each row)
+  @param[in]  strideC Stride of the output matrix (elements between each row)
+  @param[out] pDstC   Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_tri_lower_stride_f32(const float *__restrict__ pSrcA,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t strideA,
+                                       uint32_t strideB,
+                                       uint32_t strideC,
+                                       float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_tri_lower_stride_f32s_xpulpv2(pSrcA,
+                                                           pSrcB,
+                                                           N,
+                                                           O,
+                                                           strideA,
+                                                           strideB,
+                                                           strideC,
+                                                           pDstC);
+    }
+}
+
+/**
+  @} end of MatSolveTriStride group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_lower_stride_q32.c
+ * Description:  32-bit fix-point strided lower triangular solve glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatSolveTriStride
+  @{
+ */
+
+/**
+  @brief Glue code for strided lower triangular solve of 32-bit fix-point matrices.
+  @param[in]  pSrcA    Points to the lower triangular matrix A of shape NxN
+  @param[in]  pSrcB    Points to the right-hand side matrix B of shape NxO
+  @param[in]  N        Width and height of A, height of B and X
+  @param[in]  O        Width of B and X (number of right-hand sides)
+  @param[in]  strideA  Stride of matrix A (elements between each row)
+  @param[in]  strideB  Stride of matrix B (elements between each row)
+  @param[in]  strideC  Stride of the output matrix (elements between each row)
+  @param[in]  fracBits Number of fractional bits of all matrices
+  @param[out] pDstC    Points to the output matrix X of shape NxO
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_tri_lower_stride_q32(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t strideA,
+                                       uint32_t strideB,
+                                       uint32_t strideC,
+                                       uint32_t fracBits,
+                                       int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_mat_solve_tri_lower_stride_q32s_rv32im(pSrcA,
+                                                          pSrcB,
+                                                          N,
+                                                          O,
+                                                          strideA,
+                                                          strideB,
+                                                          strideC,
+                                                          fracBits,
+                                                          pDstC);
+    } else {
+        return plp_mat_solve_tri_lower_stride_q32s_xpulpv2(pSrcA,
+                                                           pSrcB,
+                                                           N,
+                                                           O,
+                                                           strideA,
+                                                           strideB,
+                                                           strideC,
+                                                           fracBits,
+                                                           pDstC);
+    }
+}
+
+/**
+  @} end of MatSolveTriStride group
+ */
@@ -52,7 +52,7 @@
 
 void plp_mat_sub_stride_i8p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     plp_mat_sub_stride_instance_i8 *a = (plp_mat_sub_stride_instance_i8 *)args;
 
@@ -71,8 +71,13 @@ void plp_mat_sub_stride_i8p_xpulpv2(void *args) {
 
     uint32_t m, n; // loop counters
 
-    for (m = 0; m < M; m++) {
-        for (n = 0; n < N; n++) {
+    plp_mat_range range;
+    plp_mat_split(M, N, nPE, core_id, &range);
+
+    for (m = range.mStart; m < range.mEnd; m++) {
+        uint32_t nStart = (m == range.mStart) ? range.nStart : 0;
+        uint32_t nEnd = (m == range.mEnd - 1) ? range.nEnd : N;
+        for (n = nStart; n < nEnd; n++) {
             pDst[m * strideY + n] = pSrcA[m * strideA + n] - pSrcB[m * strideB + n];
         }
     }
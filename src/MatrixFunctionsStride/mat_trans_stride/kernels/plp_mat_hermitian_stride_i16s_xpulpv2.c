@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_hermitian_stride_i16s_xpulpv2.c
+ * Description:  Strided conjugate transpose of 16-bit complex matrices for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplxStride
+ */
+
+/**
+  @addtogroup MatTransCmplxStrideKernels
+  @{
+ */
+
+/* conjugate of a complex element in a word, the negated imaginary part saturated as in
+   plp_cmplx_conj_i16: ~im = -im - 1 does not overflow, and the maximum of ~im and ~im + 1 is -im,
+   or INT16_MAX for INT16_MIN */
+static inline v2s plp_mat_hermitian_conj_i16(v2s w) {
+    v2s c = (v2s)((uint32_t)w ^ 0xFFFF0000U);
+    return __MAX2(c, __SUB2(c, (v2s){ 0, -1 }));
+}
+
+/**
+  @brief      Conjugate transpose of an MxN strided 16-bit integer complex matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every complex element is moved as a single word, and conjugated in the register with 3 SIMD
+  instructions. The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+ */
+
+void plp_mat_hermitian_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           int16_t *__restrict__ pDst) {
+
+    const v2s *pS = (const v2s *)pSrc;
+    v2s *pD = (v2s *)pDst;
+
+    uint32_t M2 = M & ~0x1U;
+    uint32_t N2 = N & ~0x1U;
+
+    uint32_t m, n; // loop counters
+
+    for (m = 0; m < M2; m += 2) {
+        const v2s *pS0 = pS + m * strideSrc;
+        for (n = 0; n < N2; n += 2) {
+            v2s a00 = pS0[n];
+            v2s a01 = pS0[n + 1];
+            v2s a10 = pS0[strideSrc + n];
+            v2s a11 = pS0[strideSrc + n + 1];
+            pD[n * strideDst + m] = plp_mat_hermitian_conj_i16(a00);
+            pD[n * strideDst + m + 1] = plp_mat_hermitian_conj_i16(a10);
+            pD[(n + 1) * strideDst + m] = plp_mat_hermitian_conj_i16(a01);
+            pD[(n + 1) * strideDst + m + 1] = plp_mat_hermitian_conj_i16(a11);
+        }
+        for (; n < N; n++) {
+            pD[n * strideDst + m] = plp_mat_hermitian_conj_i16(pS0[n]);
+            pD[n * strideDst + m + 1] = plp_mat_hermitian_conj_i16(pS0[strideSrc + n]);
+        }
+    }
+
+    for (m = M2; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pD[n * strideDst + m] = plp_mat_hermitian_conj_i16(pS[m * strideSrc + n]);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxStrideKernels group
+ */
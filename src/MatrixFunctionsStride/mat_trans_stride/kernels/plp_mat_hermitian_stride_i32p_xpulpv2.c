@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_hermitian_stride_i32p_xpulpv2.c
+ * Description:  Parallel strided conjugate transpose of 32-bit complex matrices
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplxStride
+ */
+
+/**
+  @addtogroup MatTransCmplxStrideKernels
+  @{
+ */
+
+/**
+  @brief      Parallel conjugate transpose of an MxN strided 32-bit complex matrix on XpulpV2
+  @param[in]  args  pointer to plp_mat_trans_cmplx_stride_instance_i32 struct initialized by
+                    plp_mat_hermitian_stride_i32_parallel
+  @return     none
+
+  @par Work distribution
+  Every core transposes a contiguous block of rows of the input, or of columns if the matrix is
+  wider than high, with the single-core kernel. This way, also matrices with few rows use all
+  cores.
+ */
+
+void plp_mat_hermitian_stride_i32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_trans_cmplx_stride_instance_i32 *a = (plp_mat_trans_cmplx_stride_instance_i32 *)args;
+
+    const int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t len = (M >= N) ? M : N;
+    uint32_t chunk = (len + nPE - 1) / nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > len) {
+        end = len;
+    }
+
+    if (start < end) {
+        if (M >= N) {
+            plp_mat_hermitian_stride_i32s_xpulpv2(pSrc + 2 * start * strideSrc, end - start, N,
+                                                  strideSrc, strideDst, pDst + 2 * start);
+        } else {
+            plp_mat_hermitian_stride_i32s_xpulpv2(pSrc + 2 * start, M, end - start, strideSrc,
+                                                  strideDst, pDst + 2 * start * strideDst);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxStrideKernels group
+ */
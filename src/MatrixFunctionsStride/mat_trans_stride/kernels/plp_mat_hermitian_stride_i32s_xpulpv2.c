@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_hermitian_stride_i32s_xpulpv2.c
+ * Description:  Strided conjugate transpose of 32-bit complex matrices for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplxStride
+ */
+
+/**
+  @addtogroup MatTransCmplxStrideKernels
+  @{
+ */
+
+/* negated imaginary part, saturated as in plp_cmplx_conj_i32 */
+static inline int32_t plp_mat_hermitian_neg_i32(int32_t x) {
+    return -__MAX(x, -INT32_MAX);
+}
+
+/**
+  @brief      Conjugate transpose of an MxN strided 32-bit integer complex matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead.
+  The imaginary parts are negated on the fly, with saturation (p.max).
+ */
+
+void plp_mat_hermitian_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t strideSrc,
+                                           uint32_t strideDst,
+                                           int32_t *__restrict__ pDst) {
+
+    uint32_t M2 = M & ~0x1U;
+    uint32_t N2 = N & ~0x1U;
+
+    uint32_t m, n; // loop counters
+
+    for (m = 0; m < M2; m += 2) {
+        const int32_t *pS0 = pSrc + 2 * m * strideSrc;
+        const int32_t *pS1 = pS0 + 2 * strideSrc;
+        for (n = 0; n < N2; n += 2) {
+            int32_t re00 = pS0[2 * n], im00 = pS0[2 * n + 1];
+            int32_t re01 = pS0[2 * n + 2], im01 = pS0[2 * n + 3];
+            int32_t re10 = pS1[2 * n], im10 = pS1[2 * n + 1];
+            int32_t re11 = pS1[2 * n + 2], im11 = pS1[2 * n + 3];
+            int32_t *pD0 = pDst + 2 * (n * strideDst + m);
+            int32_t *pD1 = pD0 + 2 * strideDst;
+            pD0[0] = re00;
+            pD0[1] = plp_mat_hermitian_neg_i32(im00);
+            pD0[2] = re10;
+            pD0[3] = plp_mat_hermitian_neg_i32(im10);
+            pD1[0] = re01;
+            pD1[1] = plp_mat_hermitian_neg_i32(im01);
+            pD1[2] = re11;
+            pD1[3] = plp_mat_hermitian_neg_i32(im11);
+        }
+        for (; n < N; n++) {
+            int32_t *pD0 = pDst + 2 * (n * strideDst + m);
+            pD0[0] = pS0[2 * n];
+            pD0[1] = plp_mat_hermitian_neg_i32(pS0[2 * n + 1]);
+            pD0[2] = pS1[2 * n];
+            pD0[3] = plp_mat_hermitian_neg_i32(pS1[2 * n + 1]);
+        }
+    }
+
+    for (m = M2; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            const int32_t *pS = pSrc + 2 * (m * strideSrc + n);
+            int32_t *pD = pDst + 2 * (n * strideDst + m);
+            pD[0] = pS[0];
+            pD[1] = plp_mat_hermitian_neg_i32(pS[1]);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxStrideKernels group
+ */
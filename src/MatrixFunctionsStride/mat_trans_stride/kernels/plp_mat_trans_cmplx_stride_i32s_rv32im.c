@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_cmplx_stride_i32s_rv32im.c
+ * Description:  Strided transpose of 32-bit complex matrices for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplxStride
+ */
+
+/**
+  @defgroup MatTransCmplxStrideKernels Strided Complex Matrix Transpose Kernels
+  This module contains the kernel code for the transpose and the conjugate (Hermitian) transpose of
+  strided complex matrices. The 16-bit complex transpose uses the kernels of
+  @ref MatTransStrideKernels, as a complex element is a 32-bit word.
+ */
+
+/**
+  @addtogroup MatTransCmplxStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 32-bit integer complex matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+ */
+
+void plp_mat_trans_cmplx_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                            uint32_t M,
+                                            uint32_t N,
+                                            uint32_t strideSrc,
+                                            uint32_t strideDst,
+                                            int32_t *__restrict__ pDst) {
+
+    uint32_t m, n; // loop counters
+
+    for (m = 0; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            const int32_t *pS = pSrc + 2 * (m * strideSrc + n);
+            int32_t *pD = pDst + 2 * (n * strideDst + m);
+            pD[0] = pS[0];
+            pD[1] = pS[1];
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxStrideKernels group
+ */
@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i16s_xpulpv2.c
+ * Description:  16-bit integer strided matrix transpose for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define shufflemask1                                                                               \
+    (v2s) { 0, 2 }
+#define shufflemask2                                                                               \
+    (v2s) { 1, 3 }
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 2x2 elements. Two rows of a block are loaded as 16 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word.
+ */
+
+void plp_mat_trans_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t *__restrict__ pDst) {
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    for (int m = 0; m < M; m ++) {
+        for (int n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+
+#else
+
+    uint32_t M2 = M & ~0x1;
+    uint32_t N2 = N & ~0x1;
+
+    int m, n;
+
+    for (m = 0; m < M2; m += 2) {
+        const int16_t *pSrc0 = pSrc + m * strideSrc;
+        for (n = 0; n < N2; n += 2) {
+            v2s r0 = *((v2s *)&pSrc0[n]);
+            v2s r1 = *((v2s *)&pSrc0[strideSrc + n]);
+            *((v2s *)&pDst[n * strideDst + m]) = __builtin_shuffle(r0, r1, shufflemask1);
+            *((v2s *)&pDst[(n + 1) * strideDst + m]) = __builtin_shuffle(r0, r1, shufflemask2);
+        }
+        for (; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc0[n];
+            pDst[n * strideDst + m + 1] = pSrc0[strideSrc + n];
+        }
+    }
+
+    for (m = M2; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+}
+
+/**
+  @} end of MatTransStrideKernels group
+ */
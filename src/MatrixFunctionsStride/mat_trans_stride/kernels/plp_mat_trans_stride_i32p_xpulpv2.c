@@ -0,0 +1,129 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i32p_xpulpv2.c
+ * Description:  parallel 32-bit integer strided matrix transpose for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i32 struct initialized by
+                    plp_mat_trans_stride_i32_parallel
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in blocks of 2x2 elements, which halves the loop overhead. The blocks
+  are split evenly among the cores with plp_mat_split, such that also matrices with few rows use
+  all cores.
+ */
+
+void plp_mat_trans_stride_i32p_xpulpv2(void *args) {
+
+    int core_id = plp_core_id();
+
+    plp_mat_trans_stride_instance_i32 *a = (plp_mat_trans_stride_instance_i32 *)args;
+
+    const int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    for (int m = core_id; m < M; m += nPE) {
+        for (int n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+
+#else
+
+    uint32_t M2 = M & ~0x1;
+    uint32_t nBlk = (N + 1) / 2; // block columns, the last one may be narrower
+
+    uint32_t m, n, b, p;
+    plp_mat_range range;
+
+    // 2x2 blocks
+    plp_mat_split(M2 / 2, nBlk, nPE, core_id, &range);
+
+    for (b = range.mStart; b < range.mEnd; b++) {
+        uint32_t pStart = (b == range.mStart) ? range.nStart : 0;
+        uint32_t pEnd = (b == range.mEnd - 1) ? range.nEnd : nBlk;
+        m = b * 2;
+        const int32_t *pSrc0 = pSrc + m * strideSrc;
+        for (p = pStart; p < pEnd; p++) {
+            n = p * 2;
+            if (n + 2 <= N) {
+                int32_t a00 = pSrc0[n];
+                int32_t a01 = pSrc0[n + 1];
+                int32_t a10 = pSrc0[strideSrc + n];
+                int32_t a11 = pSrc0[strideSrc + n + 1];
+                pDst[n * strideDst + m] = a00;
+                pDst[n * strideDst + m + 1] = a10;
+                pDst[(n + 1) * strideDst + m] = a01;
+                pDst[(n + 1) * strideDst + m + 1] = a11;
+            } else {
+                // last block column, narrower than 2
+                for (; n < N; n++) {
+                    pDst[n * strideDst + m] = pSrc0[n];
+                    pDst[n * strideDst + m + 1] = pSrc0[strideSrc + n];
+                }
+            }
+        }
+    }
+
+    // remaining rows
+    plp_mat_split(M - M2, N, nPE, core_id, &range);
+
+    for (m = range.mStart; m < range.mEnd; m++) {
+        uint32_t nStart = (m == range.mStart) ? range.nStart : 0;
+        uint32_t nEnd = (m == range.mEnd - 1) ? range.nEnd : N;
+        for (n = nStart; n < nEnd; n++) {
+            pDst[n * strideDst + M2 + m] = pSrc[(M2 + m) * strideSrc + n];
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+}
+
+/**
+  @} end of MatTransStrideKernels group
+ */
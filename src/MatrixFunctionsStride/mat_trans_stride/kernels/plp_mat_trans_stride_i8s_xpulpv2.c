@@ -0,0 +1,124 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i8s_xpulpv2.c
+ * Description:  8-bit integer strided matrix transpose for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define shufflemask1                                                                               \
+    (v4s) { 0, 4, 1, 5 }
+#define shufflemask2                                                                               \
+    (v4s) { 2, 6, 3, 7 }
+#define shufflemask3                                                                               \
+    (v4s) { 0, 1, 4, 5 }
+#define shufflemask4                                                                               \
+    (v4s) { 2, 3, 6, 7 }
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 8-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in blocks of 4x4 elements. Four rows of a block are loaded as 8 bit
+  vectors and rearranged with shuffle instructions, such that every column of the block can be
+  stored as a single word.
+ */
+
+void plp_mat_trans_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t *__restrict__ pDst) {
+
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+#ifdef BASIC_VERSION
+
+    for (int m = 0; m < M; m ++) {
+        for (int n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+
+#else
+
+    uint32_t M4 = M & ~0x3;
+    uint32_t N4 = N & ~0x3;
+
+    int m, n;
+
+    for (m = 0; m < M4; m += 4) {
+        const int8_t *pSrc0 = pSrc + m * strideSrc;
+        for (n = 0; n < N4; n += 4) {
+            v4s r0 = *((v4s *)&pSrc0[n]);
+            v4s r1 = *((v4s *)&pSrc0[strideSrc + n]);
+            v4s r2 = *((v4s *)&pSrc0[2 * strideSrc + n]);
+            v4s r3 = *((v4s *)&pSrc0[3 * strideSrc + n]);
+            v4s t0 = __builtin_shuffle(r0, r1, shufflemask1);
+            v4s t1 = __builtin_shuffle(r2, r3, shufflemask1);
+            v4s t2 = __builtin_shuffle(r0, r1, shufflemask2);
+            v4s t3 = __builtin_shuffle(r2, r3, shufflemask2);
+            *((v4s *)&pDst[n * strideDst + m]) = __builtin_shuffle(t0, t1, shufflemask3);
+            *((v4s *)&pDst[(n + 1) * strideDst + m]) = __builtin_shuffle(t0, t1, shufflemask4);
+            *((v4s *)&pDst[(n + 2) * strideDst + m]) = __builtin_shuffle(t2, t3, shufflemask3);
+            *((v4s *)&pDst[(n + 3) * strideDst + m]) = __builtin_shuffle(t2, t3, shufflemask4);
+        }
+        for (; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc0[n];
+            pDst[n * strideDst + m + 1] = pSrc0[strideSrc + n];
+            pDst[n * strideDst + m + 2] = pSrc0[2 * strideSrc + n];
+            pDst[n * strideDst + m + 3] = pSrc0[3 * strideSrc + n];
+        }
+    }
+
+    for (m = M4; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+
+#endif
+#undef BASIC_VERSION
+}
+
+/**
+  @} end of MatTransStrideKernels group
+ */
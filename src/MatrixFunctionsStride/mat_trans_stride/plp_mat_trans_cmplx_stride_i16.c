@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_cmplx_stride_i16.c
+ * Description:  Glue code for the strided transpose of 16-bit complex matrices
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatTransCmplxStride Strided Complex Matrix Transpose
+  This module contains the glue code for the transpose and the conjugate (Hermitian) transpose of
+  strided complex matrices. The kernel codes (kernels) are located in the module
+  @ref MatTransCmplxStrideKernels.
+
+  <pre>
+    plp_mat_trans_cmplx_stride: pDst[n, m] = pSrc[m, n]
+    plp_mat_hermitian_stride:   pDst[n, m] = conj(pSrc[m, n])
+  </pre>
+
+  The elements are stored interleaved (real, imag). The `strideSrc` and `strideDst` arguments tell
+  how many complex elements are in between the start of each row of the matrix. As in
+  @ref cmplx_conj, the negated imaginary parts of integer and fixed-point matrices saturate.
+ */
+
+/**
+  @addtogroup MatTransCmplxStride
+  @{
+ */
+
+/**
+  @brief      Glue code for strided transpose of 16-bit integer complex matrices
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (complex elements between each row)
+  @param[in]  strideDst Stride of the output matrix (complex elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use the kernels of plp_mat_trans_stride_i32 for its computation.
+ */
+
+void plp_mat_trans_cmplx_stride_i16(const int16_t *__restrict__ pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideSrc,
+                                    uint32_t strideDst,
+                                    int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_trans_stride_i32s_rv32im((const int32_t *)pSrc, M, N, strideSrc, strideDst,
+                                         (int32_t *)pDst);
+    } else {
+        plp_mat_trans_stride_i32s_xpulpv2((const int32_t *)pSrc, M, N, strideSrc, strideDst,
+                                          (int32_t *)pDst);
+    }
+}
+
+/**
+  @} end of MatTransCmplxStride group
+ */
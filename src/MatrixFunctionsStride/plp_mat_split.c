@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_split.c
+ * Description:  Balanced split of the elements of a matrix among the cores
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatSplit Strided Matrix Work Splitting
+  Helper used by the parallel strided matrix kernels to split the elements of a matrix among the
+  cores.
+
+  The MxN elements are taken in row-major order and cut into nPE contiguous ranges, whose sizes
+  differ by at most one element. A range may start and end in the middle of a row, such that thin
+  and wide matrices (e.g. M = 1) are split as evenly as tall ones. The kernels iterate over the
+  range as follows:
+
+      plp_mat_split(M, N, nPE, core_id, &range);
+      for (m = range.mStart; m < range.mEnd; m++) {
+          uint32_t nStart = (m == range.mStart) ? range.nStart : 0;
+          uint32_t nEnd = (m == range.mEnd - 1) ? range.nEnd : N;
+          for (n = nStart; n < nEnd; n++) {
+              ...
+          }
+      }
+ */
+
+/**
+  @addtogroup MatSplit
+  @{
+ */
+
+/**
+  @brief      Compute the range of elements of a matrix assigned to one core.
+  @param[in]  M      Height of the matrix
+  @param[in]  N      Width of the matrix
+  @param[in]  nPE    Number of cores used for the computation
+  @param[in]  coreId Id of the core for which the range is computed (0 <= coreId < nPE)
+  @param[out] pRange The range is written here. The range is empty (mStart == mEnd) if the core
+                     has no work assigned to it.
+  @return     none
+ */
+
+void plp_mat_split(
+    uint32_t M, uint32_t N, uint32_t nPE, uint32_t coreId, plp_mat_range *__restrict__ pRange) {
+
+    uint32_t total = M * N;
+    uint32_t base, rem, start, end;
+
+    if (nPE == 0 || coreId >= nPE || total == 0) {
+        pRange->mStart = pRange->mEnd = 0;
+        pRange->nStart = pRange->nEnd = 0;
+        return;
+    }
+
+    base = total / nPE;
+    rem = total % nPE;
+
+    // the first rem cores get one element more
+    start = coreId * base + ((coreId < rem) ? coreId : rem);
+    end = start + base + ((coreId < rem) ? 1 : 0);
+
+    if (start == end) {
+        pRange->mStart = pRange->mEnd = 0;
+        pRange->nStart = pRange->nEnd = 0;
+        return;
+    }
+
+    pRange->mStart = start / N;
+    pRange->nStart = start % N;
+    pRange->mEnd = (end - 1) / N + 1;
+    pRange->nEnd = (end - 1) % N + 1;
+}
+
+/**
+  @} end of MatSplit group
+ */
@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_avgpool_i8p_xpulpv2.c
+ * Description:  Parallel average pooling of an 8-bit image for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AvgPool
+*/
+
+/**
+   @addtogroup AvgPoolKernels
+   @{
+*/
+
+RT_CL_DATA static v4s mask0 = { 0, 1, 4, 5 };
+RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
+RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
+RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
+
+/* average of count values, rounded to the nearest value (half away from zero) */
+static inline int8_t plp_avgpool_round_i8(int32_t sum, int32_t count) {
+    return (int8_t)((sum >= 0) ? (sum + (count >> 1)) / count : -((-sum + (count >> 1)) / count));
+}
+
+/**
+   @brief Parallel average pooling of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_pool_instance_i8 struct initialized by
+                     plp_avgpool_i8_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous block of rows of the output image, like
+   plp_avgpool_i8s_xpulpv2.
+*/
+
+void plp_avgpool_i8p_xpulpv2(void *args) {
+
+    plp_pool_instance_i8 *a = (plp_pool_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrc = a->pSrc;
+    uint32_t H = a->H;
+    uint32_t W = a->W;
+    uint32_t C = a->C;
+    uint32_t kH = a->kH;
+    uint32_t kW = a->kW;
+    uint32_t stride = a->stride;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDst = a->pDst;
+
+    uint32_t outH, outW; // size of the output image
+
+    if (H < kH || W < kW) {
+        return;
+    }
+    outH = (H - kH) / stride + 1;
+    outW = (W - kW) / stride + 1;
+
+    uint32_t chunk = (outH + nPE - 1) / nPE;
+    uint32_t yStart = plp_core_id() * chunk;
+    uint32_t yEnd = (yStart + chunk < outH) ? yStart + chunk : outH;
+
+    uint32_t y, x, c, t; // loop counters
+    uint32_t nTaps = kH * kW;
+    int8_t *__restrict__ pD = pDst + yStart * outW * C;
+    v4s ones = (v4s){ 1, 1, 1, 1 };
+
+    // offsets of the taps of the window, relative to its first pixel
+    int32_t off[kH * kW];
+    for (t = 0; t < nTaps; t++) {
+        off[t] = ((t / kW) * W + (t % kW)) * C;
+    }
+
+    for (y = yStart; y < yEnd; y++) {
+        for (x = 0; x < outW; x++) {
+            const int8_t *pBase = pSrc + (y * stride * W + x * stride) * C;
+
+            for (c = 0; c < (C & ~0x3U); c += 4) {
+
+                int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+                const int8_t *pS = pBase + c;
+
+                for (t = 0; t + 4 <= nTaps; t += 4) {
+                    // four channels of four taps
+                    v4s x0 = *((v4s *)(pS + off[t]));
+                    v4s x1 = *((v4s *)(pS + off[t + 1]));
+                    v4s x2 = *((v4s *)(pS + off[t + 2]));
+                    v4s x3 = *((v4s *)(pS + off[t + 3]));
+
+                    // transpose, such that every vector holds the four taps of one channel
+                    v4s tx0 = __builtin_shuffle(x0, x1, mask0);
+                    v4s tx1 = __builtin_shuffle(x2, x3, mask0);
+                    v4s tx2 = __builtin_shuffle(x0, x1, mask1);
+                    v4s tx3 = __builtin_shuffle(x2, x3, mask1);
+
+                    sum0 = __SUMDOTP4(__builtin_shuffle(tx0, tx1, mask2), ones, sum0);
+                    sum1 = __SUMDOTP4(__builtin_shuffle(tx0, tx1, mask3), ones, sum1);
+                    sum2 = __SUMDOTP4(__builtin_shuffle(tx2, tx3, mask2), ones, sum2);
+                    sum3 = __SUMDOTP4(__builtin_shuffle(tx2, tx3, mask3), ones, sum3);
+                }
+
+                for (; t < nTaps; t++) {
+                    const int8_t *pSt = pS + off[t];
+                    sum0 += pSt[0];
+                    sum1 += pSt[1];
+                    sum2 += pSt[2];
+                    sum3 += pSt[3];
+                }
+
+                *((v4s *)(pD + c)) = __PACK4(plp_avgpool_round_i8(sum0, nTaps),
+                                             plp_avgpool_round_i8(sum1, nTaps),
+                                             plp_avgpool_round_i8(sum2, nTaps),
+                                             plp_avgpool_round_i8(sum3, nTaps));
+            }
+
+            for (; c < C; c++) {
+                int32_t sum = 0;
+                for (t = 0; t < nTaps; t++) {
+                    sum += pBase[off[t] + c];
+                }
+                pD[c] = plp_avgpool_round_i8(sum, nTaps);
+            }
+
+            pD += C;
+        }
+    }
+}
+
+/**
+   @} end of AvgPoolKernels group
+*/
@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_avgpool_i8s_rv32im.c
+ * Description:  Average pooling of an 8-bit image for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AvgPool
+*/
+
+/**
+   @defgroup AvgPoolKernels Average Pooling Kernels
+   Kernels of the average pooling of 8-bit feature maps.
+*/
+
+/**
+   @addtogroup AvgPoolKernels
+   @{
+*/
+
+/* average of count values, rounded to the nearest value (half away from zero) */
+static inline int8_t plp_avgpool_round_i8(int32_t sum, int32_t count) {
+    return (int8_t)((sum >= 0) ? (sum + (count >> 1)) / count : -((-sum + (count >> 1)) / count));
+}
+
+/**
+   @brief Average pooling of an 8-bit image kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_avgpool_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            int8_t *__restrict__ pDst) {
+
+    uint32_t outH, outW; // size of the output image
+
+    if (H < kH || W < kW) {
+        return;
+    }
+    outH = (H - kH) / stride + 1;
+    outW = (W - kW) / stride + 1;
+
+    uint32_t y, x, c, r, s; // loop counters
+    int8_t *__restrict__ pD = pDst + 0 * outW * C;
+
+    for (y = 0; y < outH; y++) {
+        for (x = 0; x < outW; x++) {
+            const int8_t *pBase = pSrc + (y * stride * W + x * stride) * C;
+            for (c = 0; c < C; c++) {
+                int32_t acc = 0;
+                for (r = 0; r < kH; r++) {
+                    const int8_t *pS = pBase + r * W * C + c;
+                    for (s = 0; s < kW; s++) {
+                        acc += *pS;
+                        pS += C;
+                    }
+                }
+                *pD++ = (int8_t)plp_avgpool_round_i8(acc, kH * kW);
+            }
+        }
+    }
+}
+
+/**
+   @} end of AvgPoolKernels group
+*/
@@ -0,0 +1,149 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_f32s_xpulpv2.c
+ * Description:  Dilated 1D convolution of 32-bit floating-point sequences for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv1d
+*/
+
+/**
+   @addtogroup Conv1dKernels
+   @{
+*/
+
+/**
+   @brief Dilated and strided 1D convolution of 32-bit floating-point sequences kernel for XPULPV2
+          extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+
+   @par
+   Four output channels are computed at once, such that every loaded input sample is reused for
+   four multiply-accumulates.
+*/
+
+void plp_conv1d_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t L,
+                             uint32_t Cin,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t Cout,
+                             uint32_t K,
+                             uint32_t dilation,
+                             uint32_t stride,
+                             uint32_t padL,
+                             uint32_t padR,
+                             float32_t *__restrict__ pDst) {
+
+    uint32_t outL; // length of the output sequence
+
+    if (L + padL + padR < dilation * (K - 1) + 1) {
+        return;
+    }
+    outL = (L + padL + padR - dilation * (K - 1) - 1) / stride + 1;
+
+    uint32_t coStart = 0, coEnd = Cout; // output channels
+    uint32_t x, co, t, ci;              // loop counters
+    float32_t *__restrict__ pD = pDst;
+
+    for (x = 0; x < outL; x++) {
+
+        // taps of the kernels which lie inside the input sequence
+        int32_t xs = (int32_t)(x * stride) - (int32_t)padL;
+        int32_t kMin = (xs < 0) ? (-xs + (int32_t)dilation - 1) / (int32_t)dilation : 0;
+        int32_t kMax = ((int32_t)L - xs + (int32_t)dilation - 1) / (int32_t)dilation;
+        if (kMax > (int32_t)K) {
+            kMax = K;
+        }
+        uint32_t nTaps = (kMax > kMin) ? kMax - kMin : 0;
+        const float32_t *pS = pSrc + (xs + kMin * (int32_t)dilation) * (int32_t)Cin;
+        uint32_t stepS = dilation * Cin; // distance of two taps in the input sequence
+        uint32_t stepK = K * Cin;        // distance of two kernels
+
+        for (co = coStart; co + 4 <= coEnd; co += 4) {
+
+            float32_t sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+
+            const float32_t *pSt = pS;
+            const float32_t *pK0 = pKernel + (co * K + kMin) * Cin;
+            const float32_t *pK1 = pK0 + stepK;
+            const float32_t *pK2 = pK1 + stepK;
+            const float32_t *pK3 = pK2 + stepK;
+
+            for (t = 0; t < nTaps; t++) {
+                for (ci = 0; ci < Cin; ci++) {
+                    float32_t a = pSt[ci];
+                    sum0 += a * pK0[ci];
+                    sum1 += a * pK1[ci];
+                    sum2 += a * pK2[ci];
+                    sum3 += a * pK3[ci];
+                }
+                pSt += stepS;
+                pK0 += Cin;
+                pK1 += Cin;
+                pK2 += Cin;
+                pK3 += Cin;
+            }
+
+            pD[co] = sum0;
+            pD[co + 1] = sum1;
+            pD[co + 2] = sum2;
+            pD[co + 3] = sum3;
+        }
+
+        for (; co < coEnd; co++) {
+            float32_t sum = 0.0f;
+            const float32_t *pSt = pS;
+            const float32_t *pKt = pKernel + (co * K + kMin) * Cin;
+            for (t = 0; t < nTaps; t++) {
+                for (ci = 0; ci < Cin; ci++) {
+                    sum += pSt[ci] * pKt[ci];
+                }
+                pSt += stepS;
+                pKt += Cin;
+            }
+            pD[co] = sum;
+        }
+
+        pD += Cout;
+    }
+}
+
+/**
+   @} end of Conv1dKernels group
+*/
@@ -0,0 +1,126 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_i4s_rv32im.c
+ * Description:  1D convolution of 4-bit sequences for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv1dSubByte
+*/
+
+/**
+   @defgroup Conv1dSubByteKernels Sub-Byte 1D Convolution Kernels
+   Kernels of the sub-byte 1D convolution. Like the kernels of Conv1dKernels, they only visit the
+   taps of the kernels which lie inside the input sequence.
+*/
+
+/**
+   @addtogroup Conv1dSubByteKernels
+   @{
+*/
+
+/* dot product of the 2 values of two bytes */
+static inline int32_t plp_conv1d_i4s_byte(int32_t a, int32_t w) {
+    return ((int32_t)((uint32_t)a << 28) >> 28) * ((int32_t)((uint32_t)w << 28) >> 28) +
+           (a >> 4) * (w >> 4);
+}
+
+/**
+   @brief Dilated and strided 1D convolution of 4-bit sequences kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+
+   @par
+   Every byte is loaded once, and its 2 values are sign-extended with shifts.
+*/
+
+void plp_conv1d_i4s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t L,
+                           uint32_t Cin,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t Cout,
+                           uint32_t K,
+                           uint32_t dilation,
+                           uint32_t stride,
+                           uint32_t padL,
+                           uint32_t padR,
+                           int32_t *__restrict__ pDst) {
+
+    uint32_t outL; // length of the output sequence
+
+    if (L + padL + padR < dilation * (K - 1) + 1) {
+        return;
+    }
+    outL = (L + padL + padR - dilation * (K - 1) - 1) / stride + 1;
+
+    uint32_t x, co, t, n; // loop counters
+    uint32_t nBytes = ((Cin + 7) >> 3) << 2; // bytes of a sample or a tap
+    int32_t *__restrict__ pD = pDst;
+
+    for (x = 0; x < outL; x++) {
+
+        // taps of the kernels which lie inside the input sequence
+        int32_t xs = (int32_t)(x * stride) - (int32_t)padL;
+        int32_t kMin = (xs < 0) ? (-xs + (int32_t)dilation - 1) / (int32_t)dilation : 0;
+        int32_t kMax = ((int32_t)L - xs + (int32_t)dilation - 1) / (int32_t)dilation;
+        if (kMax > (int32_t)K) {
+            kMax = K;
+        }
+        uint32_t nTaps = (kMax > kMin) ? kMax - kMin : 0;
+        const int8_t *pS = pSrc + (xs + kMin * (int32_t)dilation) * (int32_t)nBytes;
+
+        for (co = 0; co < Cout; co++) {
+            int32_t sum = 0;
+            const int8_t *pSt = pS;
+            const int8_t *pKt = pKernel + (co * K + kMin) * nBytes;
+            for (t = 0; t < nTaps; t++) {
+                for (n = 0; n < nBytes; n++) {
+                    sum += plp_conv1d_i4s_byte(pSt[n], pKt[n]);
+                }
+                pSt += dilation * nBytes;
+                pKt += nBytes;
+            }
+            pD[co] = sum;
+        }
+
+        pD += Cout;
+    }
+}
+
+/**
+   @} end of Conv1dSubByteKernels group
+*/
@@ -0,0 +1,145 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_i4s_xpulpv2.c
+ * Description:  1D convolution of 4-bit sequences for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv1dSubByte
+*/
+
+/**
+   @addtogroup Conv1dSubByteKernels
+   @{
+*/
+
+/**
+   @brief Dilated and strided 1D convolution of 4-bit sequences kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Every word of 8 values is sign-extended to 2 vectors of 4 bytes in registers
+   (plp_unpack_i4), which are multiplied with the 8-bit dot product instructions, with 32 bit
+   accumulators. Two output channels are computed at once, such that every word of the input
+   sequence is loaded and unpacked once for both of them.
+*/
+
+void plp_conv1d_i4s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst) {
+
+    uint32_t outL; // length of the output sequence
+
+    if (L + padL + padR < dilation * (K - 1) + 1) {
+        return;
+    }
+    outL = (L + padL + padR - dilation * (K - 1) - 1) / stride + 1;
+
+    uint32_t x, co, t, n; // loop counters
+    uint32_t nWords = (Cin + 7) >> 3; // words of a sample or a tap
+    int32_t *__restrict__ pD = pDst;
+    v4s a, a0, a1;
+
+    for (x = 0; x < outL; x++) {
+
+        // taps of the kernels which lie inside the input sequence
+        int32_t xs = (int32_t)(x * stride) - (int32_t)padL;
+        int32_t kMin = (xs < 0) ? (-xs + (int32_t)dilation - 1) / (int32_t)dilation : 0;
+        int32_t kMax = ((int32_t)L - xs + (int32_t)dilation - 1) / (int32_t)dilation;
+        if (kMax > (int32_t)K) {
+            kMax = K;
+        }
+        uint32_t nTaps = (kMax > kMin) ? kMax - kMin : 0;
+        const v4s *pS = (const v4s *)pSrc + (xs + kMin * (int32_t)dilation) * (int32_t)nWords;
+
+        for (co = 0; co + 1 < Cout; co += 2) {
+            int32_t sum0 = 0, sum1 = 0;
+            const v4s *pSt = pS;
+            const v4s *pK0 = (const v4s *)pKernel + (co * K + kMin) * nWords;
+            const v4s *pK1 = pK0 + K * nWords;
+            for (t = 0; t < nTaps; t++) {
+                for (n = 0; n < nWords; n++) {
+                    a = pSt[n];
+                    a0 = plp_unpack_i4(a, 0);
+                    a1 = plp_unpack_i4(a, 1);
+                    sum0 = __SUMDOTP4(a0, plp_unpack_i4(pK0[n], 0), sum0);
+                    sum0 = __SUMDOTP4(a1, plp_unpack_i4(pK0[n], 1), sum0);
+                    sum1 = __SUMDOTP4(a0, plp_unpack_i4(pK1[n], 0), sum1);
+                    sum1 = __SUMDOTP4(a1, plp_unpack_i4(pK1[n], 1), sum1);
+                }
+                pSt += dilation * nWords;
+                pK0 += nWords;
+                pK1 += nWords;
+            }
+            pD[co] = sum0;
+            pD[co + 1] = sum1;
+        }
+
+        if (co < Cout) {
+            int32_t sum0 = 0;
+            const v4s *pSt = pS;
+            const v4s *pK0 = (const v4s *)pKernel + (co * K + kMin) * nWords;
+            for (t = 0; t < nTaps; t++) {
+                for (n = 0; n < nWords; n++) {
+                    a = pSt[n];
+                    a0 = plp_unpack_i4(a, 0);
+                    a1 = plp_unpack_i4(a, 1);
+                    sum0 = __SUMDOTP4(a0, plp_unpack_i4(pK0[n], 0), sum0);
+                    sum0 = __SUMDOTP4(a1, plp_unpack_i4(pK0[n], 1), sum0);
+                }
+                pSt += dilation * nWords;
+                pK0 += nWords;
+            }
+            pD[co] = sum0;
+        }
+
+        pD += Cout;
+    }
+}
+
+/**
+   @} end of Conv1dSubByteKernels group
+*/
@@ -0,0 +1,172 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_i8p_xpulpv2.c
+ * Description:  Parallel dilated 1D convolution of 8-bit sequences for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv1d
+*/
+
+/**
+   @addtogroup Conv1dKernels
+   @{
+*/
+
+/**
+   @brief Parallel dilated and strided 1D convolution of 8-bit sequences kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_conv1d_instance_i8 struct initialized by
+                     plp_conv1d_i8_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous block of output samples, or a contiguous block of output
+   channels if there are fewer output samples than cores (e.g. when a TCN processes one
+   sample at a time), like plp_conv1d_i8s_xpulpv2.
+*/
+
+void plp_conv1d_i8p_xpulpv2(void *args) {
+
+    plp_conv1d_instance_i8 *a = (plp_conv1d_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrc = a->pSrc;
+    uint32_t L = a->L;
+    uint32_t Cin = a->Cin;
+    const int8_t *__restrict__ pKernel = a->pKernel;
+    uint32_t Cout = a->Cout;
+    uint32_t K = a->K;
+    uint32_t dilation = a->dilation;
+    uint32_t stride = a->stride;
+    uint32_t padL = a->padL;
+    uint32_t padR = a->padR;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t outL; // length of the output sequence
+
+    if (L + padL + padR < dilation * (K - 1) + 1) {
+        return;
+    }
+    outL = (L + padL + padR - dilation * (K - 1) - 1) / stride + 1;
+
+    uint32_t xStart, xEnd, coStart, coEnd; // output samples and channels of this core
+
+    if (outL >= nPE) {
+        uint32_t chunk = (outL + nPE - 1) / nPE;
+        xStart = plp_core_id() * chunk;
+        xEnd = (xStart + chunk < outL) ? xStart + chunk : outL;
+        coStart = 0;
+        coEnd = Cout;
+    } else {
+        uint32_t chunk = (Cout + nPE - 1) / nPE;
+        xStart = 0;
+        xEnd = outL;
+        coStart = plp_core_id() * chunk;
+        coEnd = (coStart + chunk < Cout) ? coStart + chunk : Cout;
+    }
+
+    uint32_t x, co, t, ci; // loop counters
+    int32_t *__restrict__ pD = pDst + xStart * Cout;
+
+    for (x = xStart; x < xEnd; x++) {
+
+        // taps of the kernels which lie inside the input sequence
+        int32_t xs = (int32_t)(x * stride) - (int32_t)padL;
+        int32_t kMin = (xs < 0) ? (-xs + (int32_t)dilation - 1) / (int32_t)dilation : 0;
+        int32_t kMax = ((int32_t)L - xs + (int32_t)dilation - 1) / (int32_t)dilation;
+        if (kMax > (int32_t)K) {
+            kMax = K;
+        }
+        uint32_t nTaps = (kMax > kMin) ? kMax - kMin : 0;
+        const int8_t *pS = pSrc + (xs + kMin * (int32_t)dilation) * (int32_t)Cin;
+        uint32_t stepS = dilation * Cin; // distance of two taps in the input sequence
+        uint32_t stepK = K * Cin;        // distance of two kernels
+
+        for (co = coStart; co + 4 <= coEnd; co += 4) {
+
+            int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+            const int8_t *pSt = pS;
+            const int8_t *pK0 = pKernel + (co * K + kMin) * Cin;
+            const int8_t *pK1 = pK0 + stepK;
+            const int8_t *pK2 = pK1 + stepK;
+            const int8_t *pK3 = pK2 + stepK;
+
+            for (t = 0; t < nTaps; t++) {
+                // four input channels of the tap, for four output channels
+                for (ci = 0; ci + 4 <= Cin; ci += 4) {
+                    v4s a = *((v4s *)(pSt + ci));
+                    sum0 = __SUMDOTP4(a, *((v4s *)(pK0 + ci)), sum0);
+                    sum1 = __SUMDOTP4(a, *((v4s *)(pK1 + ci)), sum1);
+                    sum2 = __SUMDOTP4(a, *((v4s *)(pK2 + ci)), sum2);
+                    sum3 = __SUMDOTP4(a, *((v4s *)(pK3 + ci)), sum3);
+                }
+                for (; ci < Cin; ci++) {
+                    int32_t a = pSt[ci];
+                    sum0 += a * (int32_t)pK0[ci];
+                    sum1 += a * (int32_t)pK1[ci];
+                    sum2 += a * (int32_t)pK2[ci];
+                    sum3 += a * (int32_t)pK3[ci];
+                }
+                pSt += stepS;
+                pK0 += Cin;
+                pK1 += Cin;
+                pK2 += Cin;
+                pK3 += Cin;
+            }
+
+            pD[co] = sum0;
+            pD[co + 1] = sum1;
+            pD[co + 2] = sum2;
+            pD[co + 3] = sum3;
+        }
+
+        for (; co < coEnd; co++) {
+            int32_t sum = 0;
+            const int8_t *pSt = pS;
+            const int8_t *pKt = pKernel + (co * K + kMin) * Cin;
+            for (t = 0; t < nTaps; t++) {
+                for (ci = 0; ci + 4 <= Cin; ci += 4) {
+                    sum = __SUMDOTP4(*((v4s *)(pSt + ci)), *((v4s *)(pKt + ci)), sum);
+                }
+                for (; ci < Cin; ci++) {
+                    sum += (int32_t)pSt[ci] * (int32_t)pKt[ci];
+                }
+                pSt += stepS;
+                pKt += Cin;
+            }
+            pD[co] = sum;
+        }
+
+        pD += Cout;
+    }
+}
+
+/**
+   @} end of Conv1dKernels group
+*/
@@ -0,0 +1,159 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_i8s_xpulpv2.c
+ * Description:  Dilated and strided 1D convolution of 8-bit sequences for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv1d
+*/
+
+/**
+   @addtogroup Conv1dKernels
+   @{
+*/
+
+/**
+   @brief Dilated and strided 1D convolution of 8-bit sequences kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Four input channels of a tap are loaded with one word access and multiplied with the kernels of
+   four output channels, such that every loaded input vector is reused for four sumdotp.
+*/
+
+void plp_conv1d_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t L,
+                            uint32_t Cin,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t Cout,
+                            uint32_t K,
+                            uint32_t dilation,
+                            uint32_t stride,
+                            uint32_t padL,
+                            uint32_t padR,
+                            int32_t *__restrict__ pDst) {
+
+    uint32_t outL; // length of the output sequence
+
+    if (L + padL + padR < dilation * (K - 1) + 1) {
+        return;
+    }
+    outL = (L + padL + padR - dilation * (K - 1) - 1) / stride + 1;
+
+    uint32_t coStart = 0, coEnd = Cout; // output channels
+    uint32_t x, co, t, ci;              // loop counters
+    int32_t *__restrict__ pD = pDst;
+
+    for (x = 0; x < outL; x++) {
+
+        // taps of the kernels which lie inside the input sequence
+        int32_t xs = (int32_t)(x * stride) - (int32_t)padL;
+        int32_t kMin = (xs < 0) ? (-xs + (int32_t)dilation - 1) / (int32_t)dilation : 0;
+        int32_t kMax = ((int32_t)L - xs + (int32_t)dilation - 1) / (int32_t)dilation;
+        if (kMax > (int32_t)K) {
+            kMax = K;
+        }
+        uint32_t nTaps = (kMax > kMin) ? kMax - kMin : 0;
+        const int8_t *pS = pSrc + (xs + kMin * (int32_t)dilation) * (int32_t)Cin;
+        uint32_t stepS = dilation * Cin; // distance of two taps in the input sequence
+        uint32_t stepK = K * Cin;        // distance of two kernels
+
+        for (co = coStart; co + 4 <= coEnd; co += 4) {
+
+            int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+            const int8_t *pSt = pS;
+            const int8_t *pK0 = pKernel + (co * K + kMin) * Cin;
+            const int8_t *pK1 = pK0 + stepK;
+            const int8_t *pK2 = pK1 + stepK;
+            const int8_t *pK3 = pK2 + stepK;
+
+            for (t = 0; t < nTaps; t++) {
+                // four input channels of the tap, for four output channels
+                for (ci = 0; ci + 4 <= Cin; ci += 4) {
+                    v4s a = *((v4s *)(pSt + ci));
+                    sum0 = __SUMDOTP4(a, *((v4s *)(pK0 + ci)), sum0);
+                    sum1 = __SUMDOTP4(a, *((v4s *)(pK1 + ci)), sum1);
+                    sum2 = __SUMDOTP4(a, *((v4s *)(pK2 + ci)), sum2);
+                    sum3 = __SUMDOTP4(a, *((v4s *)(pK3 + ci)), sum3);
+                }
+                for (; ci < Cin; ci++) {
+                    int32_t a = pSt[ci];
+                    sum0 += a * (int32_t)pK0[ci];
+                    sum1 += a * (int32_t)pK1[ci];
+                    sum2 += a * (int32_t)pK2[ci];
+                    sum3 += a * (int32_t)pK3[ci];
+                }
+                pSt += stepS;
+                pK0 += Cin;
+                pK1 += Cin;
+                pK2 += Cin;
+                pK3 += Cin;
+            }
+
+            pD[co] = sum0;
+            pD[co + 1] = sum1;
+            pD[co + 2] = sum2;
+            pD[co + 3] = sum3;
+        }
+
+        for (; co < coEnd; co++) {
+            int32_t sum = 0;
+            const int8_t *pSt = pS;
+            const int8_t *pKt = pKernel + (co * K + kMin) * Cin;
+            for (t = 0; t < nTaps; t++) {
+                for (ci = 0; ci + 4 <= Cin; ci += 4) {
+                    sum = __SUMDOTP4(*((v4s *)(pSt + ci)), *((v4s *)(pKt + ci)), sum);
+                }
+                for (; ci < Cin; ci++) {
+                    sum += (int32_t)pSt[ci] * (int32_t)pKt[ci];
+                }
+                pSt += stepS;
+                pKt += Cin;
+            }
+            pD[co] = sum;
+        }
+
+        pD += Cout;
+    }
+}
+
+/**
+   @} end of Conv1dKernels group
+*/
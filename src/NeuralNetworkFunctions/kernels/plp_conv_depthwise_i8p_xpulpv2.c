@@ -0,0 +1,180 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_i8p_xpulpv2.c
+ * Description:  Parallel depthwise 2D convolution of 8-bit images for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup DepthwiseConv
+*/
+
+/**
+   @addtogroup DepthwiseConvKernels
+   @{
+*/
+
+RT_CL_DATA static v4s mask0 = { 0, 1, 4, 5 };
+RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
+RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
+RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
+
+/**
+   @brief Parallel depthwise 2D convolution of 8-bit images kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_conv_depthwise_instance_i8 struct initialized by
+                     plp_conv_depthwise_i8_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous block of rows of the output image, like
+   plp_conv_depthwise_i8s_xpulpv2.
+*/
+
+void plp_conv_depthwise_i8p_xpulpv2(void *args) {
+
+    plp_conv_depthwise_instance_i8 *a = (plp_conv_depthwise_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrc = a->pSrc;
+    uint32_t H = a->H;
+    uint32_t W = a->W;
+    uint32_t C = a->C;
+    const int8_t *__restrict__ pKernel = a->pKernel;
+    uint32_t kH = a->kH;
+    uint32_t kW = a->kW;
+    uint32_t stride = a->stride;
+    uint32_t pad = a->pad;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t outH, outW; // size of the output image
+
+    if (H + 2 * pad < kH || W + 2 * pad < kW) {
+        return;
+    }
+    outH = (H + 2 * pad - kH) / stride + 1;
+    outW = (W + 2 * pad - kW) / stride + 1;
+
+    uint32_t chunk = (outH + nPE - 1) / nPE;
+    uint32_t yStart = plp_core_id() * chunk;
+    uint32_t yEnd = (yStart + chunk < outH) ? yStart + chunk : outH;
+
+    uint32_t y, x, c, t; // loop counters
+    int32_t r, s;        // loop counters
+    int32_t *__restrict__ pD = pDst + yStart * outW * C;
+
+    // offsets of the taps inside the image, in the input image and in the kernels
+    int32_t offS[kH * kW];
+    int32_t offK[kH * kW];
+
+    for (y = yStart; y < yEnd; y++) {
+        for (x = 0; x < outW; x++) {
+
+            // rows and columns of the kernel which lie inside the image
+            int32_t ys = (int32_t)(y * stride) - (int32_t)pad;
+            int32_t xs = (int32_t)(x * stride) - (int32_t)pad;
+            int32_t rMin = (ys < 0) ? -ys : 0;
+            int32_t rMax = ((int32_t)H - ys < (int32_t)kH) ? (int32_t)H - ys : (int32_t)kH;
+            int32_t sMin = (xs < 0) ? -xs : 0;
+            int32_t sMax = ((int32_t)W - xs < (int32_t)kW) ? (int32_t)W - xs : (int32_t)kW;
+
+            uint32_t nTaps = 0;
+            for (r = rMin; r < rMax; r++) {
+                for (s = sMin; s < sMax; s++) {
+                    offS[nTaps] = ((ys + r) * (int32_t)W + xs + s) * C;
+                    offK[nTaps] = (r * kW + s) * C;
+                    nTaps++;
+                }
+            }
+
+            for (c = 0; c < (C & ~0x3U); c += 4) {
+
+                int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+                const int8_t *pS = pSrc + c;
+                const int8_t *pK = pKernel + c;
+
+                for (t = 0; t + 4 <= nTaps; t += 4) {
+                    // four channels of four taps
+                    v4s x0 = *((v4s *)(pS + offS[t]));
+                    v4s x1 = *((v4s *)(pS + offS[t + 1]));
+                    v4s x2 = *((v4s *)(pS + offS[t + 2]));
+                    v4s x3 = *((v4s *)(pS + offS[t + 3]));
+                    v4s w0 = *((v4s *)(pK + offK[t]));
+                    v4s w1 = *((v4s *)(pK + offK[t + 1]));
+                    v4s w2 = *((v4s *)(pK + offK[t + 2]));
+                    v4s w3 = *((v4s *)(pK + offK[t + 3]));
+
+                    // transpose, such that every vector holds the four taps of one channel
+                    v4s tx0 = __builtin_shuffle(x0, x1, mask0);
+                    v4s tx1 = __builtin_shuffle(x2, x3, mask0);
+                    v4s tx2 = __builtin_shuffle(x0, x1, mask1);
+                    v4s tx3 = __builtin_shuffle(x2, x3, mask1);
+                    v4s tw0 = __builtin_shuffle(w0, w1, mask0);
+                    v4s tw1 = __builtin_shuffle(w2, w3, mask0);
+                    v4s tw2 = __builtin_shuffle(w0, w1, mask1);
+                    v4s tw3 = __builtin_shuffle(w2, w3, mask1);
+
+                    sum0 = __SUMDOTP4(__builtin_shuffle(tx0, tx1, mask2),
+                                      __builtin_shuffle(tw0, tw1, mask2), sum0);
+                    sum1 = __SUMDOTP4(__builtin_shuffle(tx0, tx1, mask3),
+                                      __builtin_shuffle(tw0, tw1, mask3), sum1);
+                    sum2 = __SUMDOTP4(__builtin_shuffle(tx2, tx3, mask2),
+                                      __builtin_shuffle(tw2, tw3, mask2), sum2);
+                    sum3 = __SUMDOTP4(__builtin_shuffle(tx2, tx3, mask3),
+                                      __builtin_shuffle(tw2, tw3, mask3), sum3);
+                }
+
+                for (; t < nTaps; t++) {
+                    const int8_t *pSt = pS + offS[t];
+                    const int8_t *pKt = pK + offK[t];
+                    sum0 += (int32_t)pSt[0] * (int32_t)pKt[0];
+                    sum1 += (int32_t)pSt[1] * (int32_t)pKt[1];
+                    sum2 += (int32_t)pSt[2] * (int32_t)pKt[2];
+                    sum3 += (int32_t)pSt[3] * (int32_t)pKt[3];
+                }
+
+                pD[c] = sum0;
+                pD[c + 1] = sum1;
+                pD[c + 2] = sum2;
+                pD[c + 3] = sum3;
+            }
+
+            for (; c < C; c++) {
+                int32_t sum = 0;
+                for (t = 0; t < nTaps; t++) {
+                    sum += (int32_t)pSrc[offS[t] + c] * (int32_t)pKernel[offK[t] + c];
+                }
+                pD[c] = sum;
+            }
+
+            pD += C;
+        }
+    }
+}
+
+/**
+   @} end of DepthwiseConvKernels group
+*/
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_i8s_rv32im.c
+ * Description:  Depthwise 2D convolution of 8-bit images for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup DepthwiseConv
+*/
+
+/**
+   @defgroup DepthwiseConvKernels Depthwise Convolution Kernels
+   Kernels of the depthwise convolution. For every output pixel, only the rows and columns of the
+   kernel which lie inside the image are visited, hence the zero padding is never stored.
+*/
+
+/**
+   @addtogroup DepthwiseConvKernels
+   @{
+*/
+
+/**
+   @brief Depthwise 2D convolution of 8-bit images kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  pKernel   points to the filter kernels (kH x kW x C, channel last)
+   @param[in]  kH        height of the filter kernels
+   @param[in]  kW        width of the filter kernels
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_conv_depthwise_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                   uint32_t H,
+                                   uint32_t W,
+                                   uint32_t C,
+                                   const int8_t *__restrict__ pKernel,
+                                   uint32_t kH,
+                                   uint32_t kW,
+                                   uint32_t stride,
+                                   uint32_t pad,
+                                   int32_t *__restrict__ pDst) {
+
+    uint32_t outH, outW; // size of the output image
+
+    if (H + 2 * pad < kH || W + 2 * pad < kW) {
+        return;
+    }
+    outH = (H + 2 * pad - kH) / stride + 1;
+    outW = (W + 2 * pad - kW) / stride + 1;
+
+    uint32_t y, x, c; // loop counters
+    int32_t r, s;     // loop counters
+    int32_t *__restrict__ pD = pDst + 0 * outW * C;
+
+    for (y = 0; y < outH; y++) {
+        for (x = 0; x < outW; x++) {
+
+            // rows and columns of the kernel which lie inside the image
+            int32_t ys = (int32_t)(y * stride) - (int32_t)pad;
+            int32_t xs = (int32_t)(x * stride) - (int32_t)pad;
+            int32_t rMin = (ys < 0) ? -ys : 0;
+            int32_t rMax = ((int32_t)H - ys < (int32_t)kH) ? (int32_t)H - ys : (int32_t)kH;
+            int32_t sMin = (xs < 0) ? -xs : 0;
+            int32_t sMax = ((int32_t)W - xs < (int32_t)kW) ? (int32_t)W - xs : (int32_t)kW;
+
+            for (c = 0; c < C; c++) {
+                int32_t sum = 0;
+                for (r = rMin; r < rMax; r++) {
+                    const int8_t *pS = pSrc + ((ys + r) * (int32_t)W + xs + sMin) * C + c;
+                    const int8_t *pK = pKernel + (r * kW + sMin) * C + c;
+                    for (s = sMin; s < sMax; s++) {
+                        sum += (int32_t)*pS * (int32_t)*pK;
+                        pS += C;
+                        pK += C;
+                    }
+                }
+                *pD++ = sum;
+            }
+        }
+    }
+}
+
+/**
+   @} end of DepthwiseConvKernels group
+*/
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dequantize_i32_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit integer to floating-point dequantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Quantize
+*/
+
+/**
+   @addtogroup QuantizeKernels
+   @{
+*/
+
+/**
+   @brief Parallel dequantization of a 32-bit integer vector to 32-bit floating-point kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_dequantize_instance_i32_f32 struct initialized by
+                     plp_dequantize_i32_f32_parallel
+   @return     none
+
+   @par
+   Every core dequantizes a contiguous chunk of the vector with plp_dequantize_i32_f32s_xpulpv2.
+*/
+
+void plp_dequantize_i32_f32p_xpulpv2(void *args) {
+
+    plp_dequantize_instance_i32_f32 *a = (plp_dequantize_instance_i32_f32 *)args;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (a->blockSize + a->nPE - 1) / a->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > a->blockSize) {
+        end = a->blockSize;
+    }
+
+    if (start < end) {
+        plp_dequantize_i32_f32s_xpulpv2(a->pSrc + start, end - start, a->scale, a->zeroPoint,
+                                        a->pDst + start);
+    }
+}
+
+/**
+   @} end of QuantizeKernels group
+*/
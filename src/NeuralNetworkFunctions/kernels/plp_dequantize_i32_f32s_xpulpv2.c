@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dequantize_i32_f32s_xpulpv2.c
+ * Description:  32-bit integer to floating-point dequantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Quantize
+*/
+
+/**
+   @addtogroup QuantizeKernels
+   @{
+*/
+
+/**
+   @brief Dequantization of a 32-bit integer vector to 32-bit floating-point kernel for XPULPV2
+          extension.
+   @param[in]  pSrc       points to the input vector, e.g. the accumulators of plp_mat_mult_i8
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  scale      scale of the quantization
+   @param[in]  zeroPoint  zero point of the quantization
+   @param[out] pDst       points to the output vector
+   @return     none
+
+   @par
+   The zero point is subtracted in integer arithmetic, such that the conversion is exact for all
+   differences up to 2^24. Two samples are processed per iteration to hide the latency of the
+   FPU.
+*/
+
+void plp_dequantize_i32_f32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     float32_t scale,
+                                     int32_t zeroPoint,
+                                     float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < (blockSize & ~0x1U); i += 2) {
+        float32_t x0 = (float32_t)(pSrc[i] - zeroPoint);
+        float32_t x1 = (float32_t)(pSrc[i + 1] - zeroPoint);
+        pDst[i] = x0 * scale;
+        pDst[i + 1] = x1 * scale;
+    }
+    if (i < blockSize) {
+        pDst[i] = (float32_t)(pSrc[i] - zeroPoint) * scale;
+    }
+}
+
+/**
+   @} end of QuantizeKernels group
+*/
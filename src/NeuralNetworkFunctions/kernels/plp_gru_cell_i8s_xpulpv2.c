@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_i8s_xpulpv2.c
+ * Description:  One time step of an 8-bit GRU cell for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup RnnCell
+*/
+
+/**
+   @addtogroup RnnCellKernels
+   @{
+*/
+
+/**
+   @brief One time step of an 8-bit GRU cell kernel for XPULPV2 extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Four samples of x and h are loaded with one word access and multiplied with the rows of all gates
+   of the hidden unit with sumdotp4, such that every load of x and h is reused for every gate.
+*/
+
+void plp_gru_cell_i8s_xpulpv2(const int8_t *__restrict__ pSrcX,
+                              const int8_t *__restrict__ pSrcH,
+                              const int8_t *__restrict__ pWeights,
+                              const int16_t *__restrict__ pBias,
+                              uint32_t I,
+                              uint32_t H,
+                              uint32_t shift,
+                              uint32_t fracBits,
+                              int8_t *__restrict__ pDstH) {
+
+    uint32_t N = I + H; // length of a row of the weights
+    uint32_t j, n;      // loop counters
+
+    for (j = 0; j < H; j++) {
+        const int8_t *pW0 = pWeights + j * N; // reset gate
+        const int8_t *pW1 = pW0 + H * N;      // update gate
+        const int8_t *pW2 = pW1 + H * N;      // candidate
+        int32_t sum0 = 0, sum1 = 0, sumX = 0, sumH = 0;
+
+        // the input and the previous hidden state, every load shared by the three gates
+        for (n = 0; n + 4 <= I; n += 4) {
+            v4s v = *((v4s *)((void *)(pSrcX + n)));
+            sum0 = __SUMDOTP4(v, *((v4s *)((void *)(pW0 + n))), sum0);
+            sum1 = __SUMDOTP4(v, *((v4s *)((void *)(pW1 + n))), sum1);
+            sumX = __SUMDOTP4(v, *((v4s *)((void *)(pW2 + n))), sumX);
+        }
+        for (; n < I; n++) {
+            int32_t v = pSrcX[n];
+            sum0 += v * pW0[n];
+            sum1 += v * pW1[n];
+            sumX += v * pW2[n];
+        }
+        pW0 += I;
+        pW1 += I;
+        pW2 += I;
+        for (n = 0; n + 4 <= H; n += 4) {
+            v4s v = *((v4s *)((void *)(pSrcH + n)));
+            sum0 = __SUMDOTP4(v, *((v4s *)((void *)(pW0 + n))), sum0);
+            sum1 = __SUMDOTP4(v, *((v4s *)((void *)(pW1 + n))), sum1);
+            sumH = __SUMDOTP4(v, *((v4s *)((void *)(pW2 + n))), sumH);
+        }
+        for (; n < H; n++) {
+            int32_t v = pSrcH[n];
+            sum0 += v * pW0[n];
+            sum1 += v * pW1[n];
+            sumH += v * pW2[n];
+        }
+
+        // pre-activations of the gates, saturated to 16 bits
+        const int16_t *pB = pBias + j;
+        sum0 = __CLIP(__ROUNDNORM_REG(sum0, shift) + pB[0], 15);
+        sum1 = __CLIP(__ROUNDNORM_REG(sum1, shift) + pB[H], 15);
+        sumH = __CLIP(__ROUNDNORM_REG(sumH, shift) + pB[3 * H], 15);
+
+        int32_t gr = plp_sigmoid_q16s_xpulpv2(sum0, fracBits);
+        int32_t gz = plp_sigmoid_q16s_xpulpv2(sum1, fracBits);
+
+        // n = tanh(W_nx x + b_n + r * (W_nh h + b_hn))
+        sumX = __ROUNDNORM_REG(sumX, shift) + pB[2 * H] + __ROUNDNORM_REG(gr * sumH, 15);
+        int32_t gn = plp_tanh_q16s_xpulpv2(__CLIP(sumX, 15), fracBits);
+
+        // h = (1 - z) * n + z * h
+        int32_t h = gn + __ROUNDNORM_REG(gz * (pSrcH[j] * 256 - gn), 15);
+        pDstH[j] = __CLIP(__ROUNDNORM_REG(h, 8), 7);
+    }
+}
+
+/**
+   @} end of RnnCellKernels group
+*/
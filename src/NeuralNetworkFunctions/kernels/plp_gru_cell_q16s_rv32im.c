@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_q16s_rv32im.c
+ * Description:  One time step of a 16-bit fixed-point GRU cell for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+   @ingroup RnnCell
+*/
+
+/**
+   @addtogroup RnnCellKernels
+   @{
+*/
+
+/* x saturated to the range of a (bits + 1)-bit signed value, like __CLIP */
+static inline int32_t plp_gru_cell_clip(int32_t x, uint32_t bits) {
+    int32_t hi = (1 << bits) - 1;
+    return (x > hi) ? hi : ((x < -hi - 1) ? -hi - 1 : x);
+}
+
+/**
+   @brief One time step of a 16-bit fixed-point GRU cell kernel for RV32IM extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_q16s_rv32im(const int16_t *__restrict__ pSrcX,
+                              const int16_t *__restrict__ pSrcH,
+                              const int16_t *__restrict__ pWeights,
+                              const int16_t *__restrict__ pBias,
+                              uint32_t I,
+                              uint32_t H,
+                              uint32_t shift,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDstH) {
+
+    uint32_t N = I + H; // length of a row of the weights
+    uint32_t j, n;      // loop counters
+    int32_t rnd = (shift > 0) ? 1 << (shift - 1) : 0;
+
+    for (j = 0; j < H; j++) {
+        const int16_t *pW0 = pWeights + j * N; // reset gate
+        const int16_t *pW1 = pW0 + H * N;      // update gate
+        const int16_t *pW2 = pW1 + H * N;      // candidate
+        int32_t sum0 = 0, sum1 = 0, sumX = 0, sumH = 0;
+
+        // the input and the previous hidden state, every load shared by the three gates
+        for (n = 0; n + 2 <= I; n += 2) {
+            sum0 += (pW0[n] * pSrcX[n] + pW0[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcX[n] + pW1[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+            sumX += (pW2[n] * pSrcX[n] + pW2[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+        }
+        if (I & 1U) {
+            sum0 += (pW0[n] * pSrcX[n] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcX[n] + rnd) >> shift;
+            sumX += (pW2[n] * pSrcX[n] + rnd) >> shift;
+        }
+        pW0 += I;
+        pW1 += I;
+        pW2 += I;
+        for (n = 0; n + 2 <= H; n += 2) {
+            sum0 += (pW0[n] * pSrcH[n] + pW0[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcH[n] + pW1[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+            sumH += (pW2[n] * pSrcH[n] + pW2[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+        }
+        if (H & 1U) {
+            sum0 += (pW0[n] * pSrcH[n] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcH[n] + rnd) >> shift;
+            sumH += (pW2[n] * pSrcH[n] + rnd) >> shift;
+        }
+
+        // pre-activations of the gates, saturated to 16 bits
+        const int16_t *pB = pBias + j;
+        sum0 = plp_gru_cell_clip(sum0 + pB[0], 15);
+        sum1 = plp_gru_cell_clip(sum1 + pB[H], 15);
+        sumH = plp_gru_cell_clip(sumH + pB[3 * H], 15);
+
+        int32_t gr = plp_sigmoid_q16s_rv32im(sum0, fracBits);
+        int32_t gz = plp_sigmoid_q16s_rv32im(sum1, fracBits);
+
+        // n = tanh(W_nx x + b_n + r * (W_nh h + b_hn))
+        sumX += pB[2 * H] + plp_roundnorm_inline(gr * sumH, 15);
+        int32_t gn = plp_tanh_q16s_rv32im(plp_gru_cell_clip(sumX, 15), fracBits);
+
+        // h = (1 - z) * n + z * h
+        int32_t h = gn + plp_roundnorm_inline(gz * (pSrcH[j] - gn), 15);
+        pDstH[j] = plp_gru_cell_clip(h, 15);
+    }
+}
+
+/**
+   @} end of RnnCellKernels group
+*/
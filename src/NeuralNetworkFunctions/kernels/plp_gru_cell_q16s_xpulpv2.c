@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_q16s_xpulpv2.c
+ * Description:  One time step of a 16-bit fixed-point GRU cell for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup RnnCell
+*/
+
+/**
+   @addtogroup RnnCellKernels
+   @{
+*/
+
+/**
+   @brief One time step of a 16-bit fixed-point GRU cell kernel for XPULPV2 extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Two samples of x and h are loaded with one word access and multiplied with the rows of all gates
+   of the hidden unit with dotp2, such that every load of x and h is reused for every gate.
+*/
+
+void plp_gru_cell_q16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                               const int16_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDstH) {
+
+    uint32_t N = I + H; // length of a row of the weights
+    uint32_t j, n;      // loop counters
+
+    for (j = 0; j < H; j++) {
+        const int16_t *pW0 = pWeights + j * N; // reset gate
+        const int16_t *pW1 = pW0 + H * N;      // update gate
+        const int16_t *pW2 = pW1 + H * N;      // candidate
+        int32_t sum0 = 0, sum1 = 0, sumX = 0, sumH = 0;
+
+        // the input and the previous hidden state, every load shared by the three gates
+        for (n = 0; n + 2 <= I; n += 2) {
+            v2s v = *((v2s *)((void *)(pSrcX + n)));
+            sum0 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW0 + n))), v), shift);
+            sum1 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW1 + n))), v), shift);
+            sumX += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW2 + n))), v), shift);
+        }
+        if (I & 1U) {
+            int32_t v = pSrcX[n];
+            sum0 += __ROUNDNORM_REG(pW0[n] * v, shift);
+            sum1 += __ROUNDNORM_REG(pW1[n] * v, shift);
+            sumX += __ROUNDNORM_REG(pW2[n] * v, shift);
+        }
+        pW0 += I;
+        pW1 += I;
+        pW2 += I;
+        for (n = 0; n + 2 <= H; n += 2) {
+            v2s v = *((v2s *)((void *)(pSrcH + n)));
+            sum0 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW0 + n))), v), shift);
+            sum1 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW1 + n))), v), shift);
+            sumH += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW2 + n))), v), shift);
+        }
+        if (H & 1U) {
+            int32_t v = pSrcH[n];
+            sum0 += __ROUNDNORM_REG(pW0[n] * v, shift);
+            sum1 += __ROUNDNORM_REG(pW1[n] * v, shift);
+            sumH += __ROUNDNORM_REG(pW2[n] * v, shift);
+        }
+
+        // pre-activations of the gates, saturated to 16 bits
+        const int16_t *pB = pBias + j;
+        sum0 = __CLIP(sum0 + pB[0], 15);
+        sum1 = __CLIP(sum1 + pB[H], 15);
+        sumH = __CLIP(sumH + pB[3 * H], 15);
+
+        int32_t gr = plp_sigmoid_q16s_xpulpv2(sum0, fracBits);
+        int32_t gz = plp_sigmoid_q16s_xpulpv2(sum1, fracBits);
+
+        // n = tanh(W_nx x + b_n + r * (W_nh h + b_hn))
+        sumX += pB[2 * H] + __ROUNDNORM_REG(gr * sumH, 15);
+        int32_t gn = plp_tanh_q16s_xpulpv2(__CLIP(sumX, 15), fracBits);
+
+        // h = (1 - z) * n + z * h
+        int32_t h = gn + __ROUNDNORM_REG(gz * (pSrcH[j] - gn), 15);
+        pDstH[j] = __CLIP(h, 15);
+    }
+}
+
+/**
+   @} end of RnnCellKernels group
+*/
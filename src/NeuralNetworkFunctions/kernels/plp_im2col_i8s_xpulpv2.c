@@ -0,0 +1,136 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_im2col_i8s_xpulpv2.c
+ * Description:  im2col of an 8-bit image for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Im2col
+*/
+
+/**
+   @addtogroup Im2colKernels
+   @{
+*/
+
+/* copies len bytes with word accesses and returns the pointer after the last written byte */
+static inline int8_t *plp_im2col_copy_i8(int8_t *pD, const int8_t *pS, uint32_t len) {
+    uint32_t i;
+    for (i = 0; i < (len >> 2); i++) {
+        *((v4s *)pD) = *((v4s *)pS);
+        pD += 4;
+        pS += 4;
+    }
+    for (i = 0; i < (len & 0x3U); i++) {
+        *pD++ = *pS++;
+    }
+    return pD;
+}
+
+/* writes len zero bytes with word accesses and returns the pointer after the last written byte */
+static inline int8_t *plp_im2col_zero_i8(int8_t *pD, uint32_t len) {
+    uint32_t i;
+    for (i = 0; i < (len >> 2); i++) {
+        *((v4s *)pD) = (v4s){ 0, 0, 0, 0 };
+        pD += 4;
+    }
+    for (i = 0; i < (len & 0x3U); i++) {
+        *pD++ = 0;
+    }
+    return pD;
+}
+
+/**
+   @brief im2col of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The kernel rows and the zero padding are copied with word accesses.
+*/
+
+void plp_im2col_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            uint32_t pad,
+                            int8_t *__restrict__ pDst) {
+
+    uint32_t outH, outW; // size of the output image
+
+    if (H + 2 * pad < kH || W + 2 * pad < kW) {
+        return;
+    }
+    outH = (H + 2 * pad - kH) / stride + 1;
+    outW = (W + 2 * pad - kW) / stride + 1;
+
+    uint32_t y, x, r; // loop counters
+    int8_t *__restrict__ pD = pDst + 0 * outW * kH * kW * C;
+
+    for (y = 0; y < outH; y++) {
+        for (x = 0; x < outW; x++) {
+
+            // columns of the kernel which lie inside the image
+            int32_t xs = (int32_t)(x * stride) - (int32_t)pad;
+            int32_t sMin = (xs < 0) ? -xs : 0;
+            int32_t sMax = ((int32_t)W - xs < (int32_t)kW) ? (int32_t)W - xs : (int32_t)kW;
+            if (sMin > (int32_t)kW) {
+                sMin = kW;
+            }
+            if (sMax < sMin) {
+                sMax = sMin;
+            }
+
+            for (r = 0; r < kH; r++) {
+                int32_t ys = (int32_t)(y * stride + r) - (int32_t)pad;
+                if (ys < 0 || ys >= (int32_t)H) {
+                    pD = plp_im2col_zero_i8(pD, kW * C);
+                    continue;
+                }
+                // the columns of one kernel row are contiguous in the input image
+                pD = plp_im2col_zero_i8(pD, sMin * C);
+                pD = plp_im2col_copy_i8(pD, pSrc + (ys * W + xs + sMin) * C, (sMax - sMin) * C);
+                pD = plp_im2col_zero_i8(pD, (kW - sMax) * C);
+            }
+        }
+    }
+}
+
+/**
+   @} end of Im2colKernels group
+*/
@@ -0,0 +1,121 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_layernorm_f32s_xpulpv2.c
+ * Description:  32-bit floating-point layer normalization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LayerNorm
+*/
+
+/**
+   @defgroup LayerNormKernels Layer Normalization Kernels
+   Kernels of the layer normalization of the rows of a matrix.
+*/
+
+/**
+   @addtogroup LayerNormKernels
+   @{
+*/
+
+/**
+   @brief Layer normalization of the rows of a 32-bit floating-point matrix kernel for
+          XPULPV2 extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, e.g. 1e-5
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+
+   @par
+   The sums of the row and of its squares are accumulated in the same pass, relative to the first
+   element of the row. The shift avoids the cancellation of E[x^2] - E[x]^2 when the mean is large
+   compared to the standard deviation. The inverse standard deviation is computed with
+   plp_rsqrt_f32s_xpulpv2, which is faster than a division and a square root.
+*/
+
+void plp_layernorm_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const float32_t *__restrict__ pGamma,
+                                const float32_t *__restrict__ pBeta,
+                                float32_t eps,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t r, i; // loop counters
+    float32_t x0, d0, d1, sum0, sum1, sq0, sq1, mean, var, invStd;
+    float32_t invLen;
+
+    if (rowLen == 0) {
+        return;
+    }
+
+    invLen = 1.0f / (float32_t)rowLen;
+
+    for (r = 0; r < nRows; r++) {
+
+        // fused mean and variance pass
+        x0 = pSrc[0];
+        sum0 = 0.0f;
+        sum1 = 0.0f;
+        sq0 = 0.0f;
+        sq1 = 0.0f;
+        for (i = 0; i < (rowLen & ~0x1U); i += 2) {
+            d0 = pSrc[i] - x0;
+            d1 = pSrc[i + 1] - x0;
+            sum0 += d0;
+            sum1 += d1;
+            sq0 += d0 * d0;
+            sq1 += d1 * d1;
+        }
+        if (i < rowLen) {
+            d0 = pSrc[i] - x0;
+            sum0 += d0;
+            sq0 += d0 * d0;
+        }
+
+        mean = (sum0 + sum1) * invLen;
+        var = (sq0 + sq1) * invLen - mean * mean + eps;
+        mean += x0;
+        plp_rsqrt_f32s_xpulpv2(&var, &invStd, 1);
+
+        // normalization pass
+        for (i = 0; i < rowLen; i++) {
+            pDst[i] = (pSrc[i] - mean) * invStd * pGamma[i] + pBeta[i];
+        }
+
+        pSrc += rowLen;
+        pDst += rowLen;
+    }
+}
+
+/**
+   @} end of LayerNormKernels group
+*/
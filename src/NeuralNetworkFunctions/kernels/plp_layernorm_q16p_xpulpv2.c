@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_layernorm_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point layer normalization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LayerNorm
+*/
+
+/**
+   @addtogroup LayerNormKernels
+   @{
+*/
+
+/**
+   @brief Parallel layer normalization of the rows of a 16-bit fixed-point matrix
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_layernorm_instance_q16 struct initialized by
+                     plp_layernorm_q16_parallel
+   @return     none
+
+   @par
+   Every core processes a contiguous block of rows with plp_layernorm_q16s_xpulpv2.
+*/
+
+void plp_layernorm_q16p_xpulpv2(void *args) {
+
+    plp_layernorm_instance_q16 *a = (plp_layernorm_instance_q16 *)args;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (a->nRows + a->nPE - 1) / a->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > a->nRows) {
+        end = a->nRows;
+    }
+
+    if (start < end) {
+        plp_layernorm_q16s_xpulpv2(a->pSrc + start * a->rowLen, end - start, a->rowLen,
+                                   a->pGamma, a->pBeta, a->eps, a->fracBits,
+                                   a->pDst + start * a->rowLen);
+    }
+}
+
+/**
+   @} end of LayerNormKernels group
+*/
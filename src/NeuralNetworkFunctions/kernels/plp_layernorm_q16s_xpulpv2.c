@@ -0,0 +1,163 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_layernorm_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point layer normalization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LayerNorm
+*/
+
+/**
+   @addtogroup LayerNormKernels
+   @{
+*/
+
+/* computes 1 / sqrt(var) for the variance var in Q(2*fracBits), as a mantissa below 2^15 and a
+   right shift, such that (x * mantissa) >> shift is x / sqrt(var) in the format of x */
+static inline uint32_t plp_layernorm_inv_std_q16(uint64_t var,
+                                                 uint32_t fracBits,
+                                                 uint32_t *pShift) {
+
+    uint64_t rem = var;
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    uint64_t inv;
+    uint32_t shift = 30;
+
+    // integer square root, the standard deviation in Q(fracBits)
+    while (bit > var) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (rem >= root + bit) {
+            rem -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    if (root == 0) {
+        root = 1;
+    }
+
+    inv = (1ULL << (fracBits + 30)) / root;
+    while (inv >= (1 << 15) && shift > 0) {
+        inv >>= 1;
+        shift--;
+    }
+    if (inv >= (1 << 15)) {
+        inv = 0x7FFF; // the output saturates anyway
+    }
+
+    *pShift = shift;
+    return (uint32_t)inv;
+}
+
+/**
+   @brief Layer normalization of the rows of a 16-bit fixed-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, in Q(32-2*fracBits).(2*fracBits)
+   @param[in]  fracBits  decimal point of the input, the scales, the offsets and the output,
+                         format Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+
+   @par
+   The sums of the row and of its squares are exact integers, and the variance is computed from
+   them with 64-bit integers. Once per row, the inverse standard deviation is converted to a 15-bit
+   mantissa and a shift, such that the normalization of an element needs no division and fits
+   into 32 bits. The normalized values and the outputs are saturated to 16 bits.
+
+   @par Exploiting SIMD instructions
+   The sums are accumulated for two elements at once with sumdotp and dotp, and the rounding
+   shifts and the saturations are single instructions (p.addRN and p.clip).
+*/
+
+void plp_layernorm_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const int16_t *__restrict__ pGamma,
+                                const int16_t *__restrict__ pBeta,
+                                uint32_t eps,
+                                uint32_t fracBits,
+                                int16_t *__restrict__ pDst) {
+
+    uint32_t r, i; // loop counters
+    int32_t x, y, sum, mean;
+    uint64_t sumSq, var;
+    uint32_t mult, shift;
+    v2s ones = (v2s){ 1, 1 };
+
+    if (rowLen == 0) {
+        return;
+    }
+
+    for (r = 0; r < nRows; r++) {
+
+        // fused mean and variance pass
+        sum = 0;
+        sumSq = 0;
+        for (i = 0; i < (rowLen & ~0x1U); i += 2) {
+            v2s xVec = *((v2s *)(pSrc + i));
+            sum = __SUMDOTP2(xVec, ones, sum);
+            sumSq += (uint32_t)__DOTP2(xVec, xVec);
+        }
+        if (i < rowLen) {
+            x = pSrc[i];
+            sum += x;
+            sumSq += (uint32_t)(x * x);
+        }
+
+        // var = (rowLen * sum(x^2) - sum(x)^2) / rowLen^2, in Q(2*fracBits)
+        var = (uint64_t)((int64_t)rowLen * (int64_t)sumSq - (int64_t)sum * sum);
+        var = var / ((uint64_t)rowLen * rowLen) + eps;
+        mean = (sum >= 0) ? (sum + (int32_t)(rowLen >> 1)) / (int32_t)rowLen
+                          : (sum - (int32_t)(rowLen >> 1)) / (int32_t)rowLen;
+        mult = plp_layernorm_inv_std_q16(var, fracBits, &shift);
+
+        // normalization pass
+        for (i = 0; i < rowLen; i++) {
+            y = __CLIP(__ROUNDNORM_REG((pSrc[i] - mean) * (int32_t)mult, shift), 15);
+            y = __ROUNDNORM_REG(y * pGamma[i], fracBits) + pBeta[i];
+            pDst[i] = (int16_t)__CLIP(y, 15);
+        }
+
+        pSrc += rowLen;
+        pDst += rowLen;
+    }
+}
+
+/**
+   @} end of LayerNormKernels group
+*/
@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lstm_cell_q16p_xpulpv2.c
+ * Description:  Parallel time step of a 16-bit fixed-point LSTM cell for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup RnnCell
+*/
+
+/**
+   @addtogroup RnnCellKernels
+   @{
+*/
+
+/**
+   @brief Parallel time step of a 16-bit fixed-point LSTM cell kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_lstm_cell_instance_q16 struct initialized by
+                     plp_lstm_cell_q16_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous block of hidden units, like plp_lstm_cell_q16s_xpulpv2.
+*/
+
+void plp_lstm_cell_q16p_xpulpv2(void *args) {
+
+    plp_lstm_cell_instance_q16 *a = (plp_lstm_cell_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    const int16_t *__restrict__ pSrcH = a->pSrcH;
+    const int16_t *__restrict__ pSrcC = a->pSrcC;
+    const int16_t *__restrict__ pWeights = a->pWeights;
+    const int16_t *__restrict__ pBias = a->pBias;
+    uint32_t I = a->I;
+    uint32_t H = a->H;
+    uint32_t shift = a->shift;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstH = a->pDstH;
+    int16_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t chunk = (H + nPE - 1) / nPE;
+    uint32_t jStart = plp_core_id() * chunk;
+    uint32_t jEnd = (jStart + chunk < H) ? jStart + chunk : H;
+
+    uint32_t N = I + H; // length of a row of the weights
+    uint32_t j, n;      // loop counters
+
+    for (j = jStart; j < jEnd; j++) {
+        const int16_t *pW0 = pWeights + j * N; // input gate
+        const int16_t *pW1 = pW0 + H * N;      // forget gate
+        const int16_t *pW2 = pW1 + H * N;      // cell gate
+        const int16_t *pW3 = pW2 + H * N;      // output gate
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        // the input and the previous hidden state, every load shared by the four gates
+        for (n = 0; n + 2 <= I; n += 2) {
+            v2s v = *((v2s *)((void *)(pSrcX + n)));
+            sum0 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW0 + n))), v), shift);
+            sum1 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW1 + n))), v), shift);
+            sum2 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW2 + n))), v), shift);
+            sum3 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW3 + n))), v), shift);
+        }
+        if (I & 1U) {
+            int32_t v = pSrcX[n];
+            sum0 += __ROUNDNORM_REG(pW0[n] * v, shift);
+            sum1 += __ROUNDNORM_REG(pW1[n] * v, shift);
+            sum2 += __ROUNDNORM_REG(pW2[n] * v, shift);
+            sum3 += __ROUNDNORM_REG(pW3[n] * v, shift);
+        }
+        pW0 += I;
+        pW1 += I;
+        pW2 += I;
+        pW3 += I;
+        for (n = 0; n + 2 <= H; n += 2) {
+            v2s v = *((v2s *)((void *)(pSrcH + n)));
+            sum0 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW0 + n))), v), shift);
+            sum1 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW1 + n))), v), shift);
+            sum2 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW2 + n))), v), shift);
+            sum3 += __ROUNDNORM_REG(__DOTP2(*((v2s *)((void *)(pW3 + n))), v), shift);
+        }
+        if (H & 1U) {
+            int32_t v = pSrcH[n];
+            sum0 += __ROUNDNORM_REG(pW0[n] * v, shift);
+            sum1 += __ROUNDNORM_REG(pW1[n] * v, shift);
+            sum2 += __ROUNDNORM_REG(pW2[n] * v, shift);
+            sum3 += __ROUNDNORM_REG(pW3[n] * v, shift);
+        }
+
+        // pre-activations of the gates, saturated to 16 bits
+        const int16_t *pB = pBias + j;
+        sum0 = __CLIP(sum0 + pB[0], 15);
+        sum1 = __CLIP(sum1 + pB[H], 15);
+        sum2 = __CLIP(sum2 + pB[2 * H], 15);
+        sum3 = __CLIP(sum3 + pB[3 * H], 15);
+
+        int32_t gi = plp_sigmoid_q16s_xpulpv2(sum0, fracBits);
+        int32_t gf = plp_sigmoid_q16s_xpulpv2(sum1, fracBits);
+        int32_t gg = plp_tanh_q16s_xpulpv2(sum2, fracBits);
+        int32_t go = plp_sigmoid_q16s_xpulpv2(sum3, fracBits);
+
+        // c = f * c + i * g and h = o * tanh(c)
+        int32_t cell = __ROUNDNORM_REG(gf * pSrcC[j], 15) +
+                       __ROUNDNORM_REG(gi * gg, 30 - fracBits);
+        cell = __CLIP(cell, 15);
+        pDstC[j] = cell;
+        int32_t h = __ROUNDNORM_REG(go * plp_tanh_q16s_xpulpv2(cell, fracBits), 15);
+        pDstH[j] = h;
+    }
+}
+
+/**
+   @} end of RnnCellKernels group
+*/
@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lstm_cell_q16s_rv32im.c
+ * Description:  One time step of a 16-bit fixed-point LSTM cell for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+   @ingroup RnnCell
+*/
+
+/**
+   @defgroup RnnCellKernels Recurrent Cells Kernels
+   Kernels of the LSTM and GRU cells. Every kernel computes the gates and the new states of a
+   hidden unit at once, hence the pre-activations of the gates are never stored.
+*/
+
+/**
+   @addtogroup RnnCellKernels
+   @{
+*/
+
+/* x saturated to the range of a (bits + 1)-bit signed value, like __CLIP */
+static inline int32_t plp_lstm_cell_clip(int32_t x, uint32_t bits) {
+    int32_t hi = (1 << bits) - 1;
+    return (x > hi) ? hi : ((x < -hi - 1) ? -hi - 1 : x);
+}
+
+/**
+   @brief One time step of a 16-bit fixed-point LSTM cell kernel for RV32IM extension.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_q16s_rv32im(const int16_t *__restrict__ pSrcX,
+                               const int16_t *__restrict__ pSrcH,
+                               const int16_t *__restrict__ pSrcC,
+                               const int16_t *__restrict__ pWeights,
+                               const int16_t *__restrict__ pBias,
+                               uint32_t I,
+                               uint32_t H,
+                               uint32_t shift,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDstH,
+                               int16_t *__restrict__ pDstC) {
+
+    uint32_t N = I + H; // length of a row of the weights
+    uint32_t j, n;      // loop counters
+    int32_t rnd = (shift > 0) ? 1 << (shift - 1) : 0;
+
+    for (j = 0; j < H; j++) {
+        const int16_t *pW0 = pWeights + j * N; // input gate
+        const int16_t *pW1 = pW0 + H * N;      // forget gate
+        const int16_t *pW2 = pW1 + H * N;      // cell gate
+        const int16_t *pW3 = pW2 + H * N;      // output gate
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        // the input and the previous hidden state, every load shared by the four gates
+        for (n = 0; n + 2 <= I; n += 2) {
+            sum0 += (pW0[n] * pSrcX[n] + pW0[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcX[n] + pW1[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+            sum2 += (pW2[n] * pSrcX[n] + pW2[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+            sum3 += (pW3[n] * pSrcX[n] + pW3[n + 1] * pSrcX[n + 1] + rnd) >> shift;
+        }
+        if (I & 1U) {
+            sum0 += (pW0[n] * pSrcX[n] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcX[n] + rnd) >> shift;
+            sum2 += (pW2[n] * pSrcX[n] + rnd) >> shift;
+            sum3 += (pW3[n] * pSrcX[n] + rnd) >> shift;
+        }
+        pW0 += I;
+        pW1 += I;
+        pW2 += I;
+        pW3 += I;
+        for (n = 0; n + 2 <= H; n += 2) {
+            sum0 += (pW0[n] * pSrcH[n] + pW0[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcH[n] + pW1[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+            sum2 += (pW2[n] * pSrcH[n] + pW2[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+            sum3 += (pW3[n] * pSrcH[n] + pW3[n + 1] * pSrcH[n + 1] + rnd) >> shift;
+        }
+        if (H & 1U) {
+            sum0 += (pW0[n] * pSrcH[n] + rnd) >> shift;
+            sum1 += (pW1[n] * pSrcH[n] + rnd) >> shift;
+            sum2 += (pW2[n] * pSrcH[n] + rnd) >> shift;
+            sum3 += (pW3[n] * pSrcH[n] + rnd) >> shift;
+        }
+
+        // pre-activations of the gates, saturated to 16 bits
+        const int16_t *pB = pBias + j;
+        sum0 = plp_lstm_cell_clip(sum0 + pB[0], 15);
+        sum1 = plp_lstm_cell_clip(sum1 + pB[H], 15);
+        sum2 = plp_lstm_cell_clip(sum2 + pB[2 * H], 15);
+        sum3 = plp_lstm_cell_clip(sum3 + pB[3 * H], 15);
+
+        int32_t gi = plp_sigmoid_q16s_rv32im(sum0, fracBits);
+        int32_t gf = plp_sigmoid_q16s_rv32im(sum1, fracBits);
+        int32_t gg = plp_tanh_q16s_rv32im(sum2, fracBits);
+        int32_t go = plp_sigmoid_q16s_rv32im(sum3, fracBits);
+
+        // c = f * c + i * g and h = o * tanh(c)
+        int32_t cell = plp_roundnorm_inline(gf * pSrcC[j], 15) +
+                       plp_roundnorm_inline(gi * gg, 30 - fracBits);
+        cell = plp_lstm_cell_clip(cell, 15);
+        pDstC[j] = cell;
+        int32_t h = plp_roundnorm_inline(go * plp_tanh_q16s_rv32im(cell, fracBits), 15);
+        pDstH[j] = h;
+    }
+}
+
+/**
+   @} end of RnnCellKernels group
+*/
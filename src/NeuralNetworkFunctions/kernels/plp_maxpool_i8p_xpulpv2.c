@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_maxpool_i8p_xpulpv2.c
+ * Description:  Parallel max pooling of an 8-bit image for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MaxPool
+*/
+
+/**
+   @addtogroup MaxPoolKernels
+   @{
+*/
+
+/**
+   @brief Parallel max pooling of an 8-bit image kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_pool_instance_i8 struct initialized by
+                     plp_maxpool_i8_parallel
+   @return     none
+
+   @par
+   Every core computes a contiguous block of rows of the output image, like
+   plp_maxpool_i8s_xpulpv2.
+*/
+
+void plp_maxpool_i8p_xpulpv2(void *args) {
+
+    plp_pool_instance_i8 *a = (plp_pool_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrc = a->pSrc;
+    uint32_t H = a->H;
+    uint32_t W = a->W;
+    uint32_t C = a->C;
+    uint32_t kH = a->kH;
+    uint32_t kW = a->kW;
+    uint32_t stride = a->stride;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDst = a->pDst;
+
+    uint32_t outH, outW; // size of the output image
+
+    if (H < kH || W < kW) {
+        return;
+    }
+    outH = (H - kH) / stride + 1;
+    outW = (W - kW) / stride + 1;
+
+    uint32_t chunk = (outH + nPE - 1) / nPE;
+    uint32_t yStart = plp_core_id() * chunk;
+    uint32_t yEnd = (yStart + chunk < outH) ? yStart + chunk : outH;
+
+    uint32_t y, x, c, r, s; // loop counters
+    int8_t *__restrict__ pD = pDst + yStart * outW * C;
+
+    for (y = yStart; y < yEnd; y++) {
+        for (x = 0; x < outW; x++) {
+            const int8_t *pBase = pSrc + (y * stride * W + x * stride) * C;
+
+            for (c = 0; c < (C & ~0x3U); c += 4) {
+                v4s acc = (v4s){ -128, -128, -128, -128 };
+                for (r = 0; r < kH; r++) {
+                    const int8_t *pS = pBase + r * W * C + c;
+                    for (s = 0; s < kW; s++) {
+                        acc = __MAX4(acc, *((v4s *)pS));
+                        pS += C;
+                    }
+                }
+                *((v4s *)(pD + c)) = acc;
+            }
+
+            for (; c < C; c++) {
+                int32_t acc = -128;
+                for (r = 0; r < kH; r++) {
+                    const int8_t *pS = pBase + r * W * C + c;
+                    for (s = 0; s < kW; s++) {
+                        acc = __MAX(acc, *pS);
+                        pS += C;
+                    }
+                }
+                pD[c] = (int8_t)acc;
+            }
+
+            pD += C;
+        }
+    }
+}
+
+/**
+   @} end of MaxPoolKernels group
+*/
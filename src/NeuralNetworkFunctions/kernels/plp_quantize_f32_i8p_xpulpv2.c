@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_quantize_f32_i8p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point to 8-bit quantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Quantize
+*/
+
+/**
+   @addtogroup QuantizeKernels
+   @{
+*/
+
+/**
+   @brief Parallel quantization of a 32-bit floating-point vector to 8 bits kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_quantize_instance_f32_i8 struct initialized by
+                     plp_quantize_f32_i8_parallel
+   @return     none
+
+   @par
+   Every core finds the range of a contiguous chunk of the vector, and the partial minima and
+   maxima are combined in a tree (see plp_stats_tree_reduce_f32). Then every core computes the
+   same scale and zero point and quantizes its chunk. The result is identical to the one of
+   plp_quantize_f32_i8.
+*/
+
+void plp_quantize_f32_i8p_xpulpv2(void *args) {
+
+    plp_quantize_instance_f32_i8 *S = (plp_quantize_instance_f32_i8 *)args;
+    const float32_t *pSrc = S->pSrc;
+    uint32_t core_id = plp_core_id();
+    uint32_t start, end, i;
+    float32_t min = 0.0f, max = 0.0f;
+    float32_t scale, inv;
+    int32_t zp;
+    v4s *pD;
+
+    /* chunks of whole SIMD words, such that the stores of all cores are aligned */
+    plp_stats_parallel_range(S->blockSize, 4, S->nPE, core_id, &start, &end);
+
+    for (i = start; i < end; i++) {
+        min = (pSrc[i] < min) ? pSrc[i] : min;
+        max = (pSrc[i] > max) ? pSrc[i] : max;
+    }
+
+    S->pMin[core_id] = min;
+    S->pMax[core_id] = max;
+    plp_stats_tree_reduce_f32(S->pMin, S->nPE, core_id, PLP_STATS_MIN);
+    plp_stats_tree_reduce_f32(S->pMax, S->nPE, core_id, PLP_STATS_MAX);
+
+    plp_quantize_params_f32_i8(S->pMin[0], S->pMax[0], &scale, &zp);
+    inv = 1.0f / scale;
+
+    pD = (v4s *)(S->pDst + start);
+    for (i = start; i + 4 <= end; i += 4) {
+        *pD++ = __PACK4(plp_quantize_f32_i8_value(pSrc[i], inv, zp),
+                        plp_quantize_f32_i8_value(pSrc[i + 1], inv, zp),
+                        plp_quantize_f32_i8_value(pSrc[i + 2], inv, zp),
+                        plp_quantize_f32_i8_value(pSrc[i + 3], inv, zp));
+    }
+    for (; i < end; i++) {
+        S->pDst[i] = (int8_t)plp_quantize_f32_i8_value(pSrc[i], inv, zp);
+    }
+
+    if (core_id == 0) {
+        *S->pScale = scale;
+        *S->pZeroPoint = zp;
+    }
+}
+
+/**
+   @} end of QuantizeKernels group
+*/
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_quantize_f32_i8s_xpulpv2.c
+ * Description:  32-bit floating-point to 8-bit quantization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Quantize
+*/
+
+/**
+   @defgroup QuantizeKernels Quantization Kernels
+   Kernels of the quantization of floating-point vectors to 8 bits and of the dequantization.
+*/
+
+/**
+   @addtogroup QuantizeKernels
+   @{
+*/
+
+/**
+   @brief Quantization of a 32-bit floating-point vector to 8 bits kernel for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[out] pDst       points to the output vector
+   @param[out] pScale     scale of the quantization returned here
+   @param[out] pZeroPoint zero point of the quantization returned here
+   @return     none
+
+   @par
+   The minimum and the maximum are found in one pass, two samples at a time with separate
+   comparisons to hide the latency of the FPU. They start at 0, which is always part of the
+   range. The second pass multiplies by the inverse scale and packs four quantized values into a
+   single word store.
+*/
+
+void plp_quantize_f32_i8s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int8_t *__restrict__ pDst,
+                                  float32_t *__restrict__ pScale,
+                                  int32_t *__restrict__ pZeroPoint) {
+
+    uint32_t i; // loop counter
+    float32_t min0 = 0.0f, max0 = 0.0f, min1 = 0.0f, max1 = 0.0f;
+    float32_t scale, inv;
+    int32_t zp;
+    v4s *pD = (v4s *)pDst;
+
+    // range pass
+    for (i = 0; i < (blockSize & ~0x1U); i += 2) {
+        float32_t x0 = pSrc[i];
+        float32_t x1 = pSrc[i + 1];
+        min0 = (x0 < min0) ? x0 : min0;
+        max0 = (x0 > max0) ? x0 : max0;
+        min1 = (x1 < min1) ? x1 : min1;
+        max1 = (x1 > max1) ? x1 : max1;
+    }
+    if (i < blockSize) {
+        min0 = (pSrc[i] < min0) ? pSrc[i] : min0;
+        max0 = (pSrc[i] > max0) ? pSrc[i] : max0;
+    }
+
+    plp_quantize_params_f32_i8((min1 < min0) ? min1 : min0, (max1 > max0) ? max1 : max0, &scale,
+                               &zp);
+    inv = 1.0f / scale;
+
+    // quantization pass
+    for (i = 0; i < (blockSize >> 2); i++) {
+        *pD++ = __PACK4(plp_quantize_f32_i8_value(pSrc[0], inv, zp),
+                        plp_quantize_f32_i8_value(pSrc[1], inv, zp),
+                        plp_quantize_f32_i8_value(pSrc[2], inv, zp),
+                        plp_quantize_f32_i8_value(pSrc[3], inv, zp));
+        pSrc += 4;
+    }
+
+    pDst = (int8_t *)pD;
+
+    for (i = 0; i < (blockSize & 3U); i++) {
+        *pDst++ = (int8_t)plp_quantize_f32_i8_value(*pSrc++, inv, zp);
+    }
+
+    *pScale = scale;
+    *pZeroPoint = zp;
+}
+
+/**
+   @} end of QuantizeKernels group
+*/
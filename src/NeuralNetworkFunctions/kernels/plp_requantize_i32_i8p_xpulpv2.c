@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_requantize_i32_i8p_xpulpv2.c
+ * Description:  Parallel requantization of a 32-bit feature map to 8 bits for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Requantize
+*/
+
+/**
+   @addtogroup RequantizeKernels
+   @{
+*/
+
+/**
+   @brief Parallel requantization of a 32-bit feature map to 8 bits kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_requantize_instance_i32_i8 struct initialized by
+                     plp_requantize_i32_i8_parallel
+   @return     none
+
+   @par
+   Every core requantizes a contiguous block of pixels with plp_requantize_i32_i8s_xpulpv2.
+*/
+
+void plp_requantize_i32_i8p_xpulpv2(void *args) {
+
+    plp_requantize_instance_i32_i8 *a = (plp_requantize_instance_i32_i8 *)args;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (a->nPixels + a->nPE - 1) / a->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > a->nPixels) {
+        end = a->nPixels;
+    }
+
+    if (start < end) {
+        plp_requantize_i32_i8s_xpulpv2(a->pSrc + start * a->nChannels, end - start, a->nChannels,
+                                       a->pMult, a->pShift, a->pDst + start * a->nChannels);
+    }
+}
+
+/**
+   @} end of RequantizeKernels group
+*/
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_requantize_i32_i8s_rv32im.c
+ * Description:  Requantization of a 32-bit feature map to 8 bits for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Requantize
+*/
+
+/**
+   @defgroup RequantizeKernels Requantization Kernels
+   Kernels of the requantization of 32-bit feature maps to 8 bits.
+*/
+
+/**
+   @addtogroup RequantizeKernels
+   @{
+*/
+
+/**
+   @brief Requantization of a 32-bit feature map to 8 bits kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8s_rv32im(const int32_t *__restrict__ pSrc,
+                                   uint32_t nPixels,
+                                   uint32_t nChannels,
+                                   const int32_t *__restrict__ pMult,
+                                   const uint32_t *__restrict__ pShift,
+                                   int8_t *__restrict__ pDst) {
+
+    uint32_t p, c; // loop counters
+
+    for (p = 0; p < nPixels; p++) {
+        for (c = 0; c < nChannels; c++) {
+            int32_t x = *pSrc++ * pMult[c];
+            uint32_t shift = pShift[c];
+            if (shift > 0) {
+                x = (x + (1 << (shift - 1))) >> shift;
+            }
+            if (x > 127) {
+                x = 127;
+            } else if (x < -128) {
+                x = -128;
+            }
+            *pDst++ = (int8_t)x;
+        }
+    }
+}
+
+/**
+   @} end of RequantizeKernels group
+*/
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_requantize_i32_i8s_xpulpv2.c
+ * Description:  Requantization of a 32-bit feature map to 8 bits for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Requantize
+*/
+
+/**
+   @addtogroup RequantizeKernels
+   @{
+*/
+
+/**
+   @brief Requantization of a 32-bit feature map to 8 bits kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[out] pDst      points to the output feature map
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Four channels are processed at once. The rounding shift and the saturation are single
+   instructions (p.addRN and p.clip), and the four results are packed into a single word store.
+*/
+
+void plp_requantize_i32_i8s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                    uint32_t nPixels,
+                                    uint32_t nChannels,
+                                    const int32_t *__restrict__ pMult,
+                                    const uint32_t *__restrict__ pShift,
+                                    int8_t *__restrict__ pDst) {
+
+    uint32_t p, c; // loop counters
+
+    for (p = 0; p < nPixels; p++) {
+        for (c = 0; c < (nChannels & ~0x3U); c += 4) {
+            int32_t x0 = __ROUNDNORM_REG(pSrc[0] * pMult[c], pShift[c]);
+            int32_t x1 = __ROUNDNORM_REG(pSrc[1] * pMult[c + 1], pShift[c + 1]);
+            int32_t x2 = __ROUNDNORM_REG(pSrc[2] * pMult[c + 2], pShift[c + 2]);
+            int32_t x3 = __ROUNDNORM_REG(pSrc[3] * pMult[c + 3], pShift[c + 3]);
+            *((v4s *)pDst) = __PACK4(__CLIP(x0, 7), __CLIP(x1, 7), __CLIP(x2, 7), __CLIP(x3, 7));
+            pSrc += 4;
+            pDst += 4;
+        }
+        for (; c < nChannels; c++) {
+            *pDst++ = (int8_t)__CLIP(__ROUNDNORM_REG(*pSrc++ * pMult[c], pShift[c]), 7);
+        }
+    }
+}
+
+/**
+   @} end of RequantizeKernels group
+*/
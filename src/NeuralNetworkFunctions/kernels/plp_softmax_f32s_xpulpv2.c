@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_f32s_xpulpv2.c
+ * Description:  32-bit floating-point softmax for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Softmax
+*/
+
+/**
+   @defgroup SoftmaxKernels Softmax Kernels
+   Kernels of the softmax of the rows of a matrix.
+*/
+
+/**
+   @addtogroup SoftmaxKernels
+   @{
+*/
+
+/**
+   @brief Softmax of the rows of a 32-bit floating-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+
+   @par
+   The exponentials are computed with plp_exp_f32s_xpulpv2, two at a time with separate sums to
+   hide the latency of the FPU. The division is done once per row.
+*/
+
+void plp_softmax_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t r, i; // loop counters
+    float32_t max, e0, e1, sum0, sum1, inv;
+
+    if (rowLen == 0) {
+        return;
+    }
+
+    for (r = 0; r < nRows; r++) {
+
+        plp_max_f32s_xpulpv2(pSrc, rowLen, &max);
+
+        // fused exponential and sum pass
+        sum0 = 0.0f;
+        sum1 = 0.0f;
+        for (i = 0; i < (rowLen & ~0x1U); i += 2) {
+            e0 = plp_exp_f32s_xpulpv2(pSrc[i] - max);
+            e1 = plp_exp_f32s_xpulpv2(pSrc[i + 1] - max);
+            pDst[i] = e0;
+            pDst[i + 1] = e1;
+            sum0 += e0;
+            sum1 += e1;
+        }
+        if (i < rowLen) {
+            e0 = plp_exp_f32s_xpulpv2(pSrc[i] - max);
+            pDst[i] = e0;
+            sum0 += e0;
+        }
+
+        // normalization pass
+        inv = 1.0f / (sum0 + sum1);
+        for (i = 0; i < rowLen; i++) {
+            pDst[i] *= inv;
+        }
+
+        pSrc += rowLen;
+        pDst += rowLen;
+    }
+}
+
+/**
+   @} end of SoftmaxKernels group
+*/
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point softmax for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Softmax
+*/
+
+/**
+   @addtogroup SoftmaxKernels
+   @{
+*/
+
+/**
+   @brief Parallel softmax of the rows of a 16-bit fixed-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_softmax_instance_q16 struct initialized by
+                     plp_softmax_q16_parallel
+   @return     none
+
+   @par
+   Every core processes a contiguous block of rows with plp_softmax_q16s_xpulpv2.
+*/
+
+void plp_softmax_q16p_xpulpv2(void *args) {
+
+    plp_softmax_instance_q16 *a = (plp_softmax_instance_q16 *)args;
+
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (a->nRows + a->nPE - 1) / a->nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+
+    if (end > a->nRows) {
+        end = a->nRows;
+    }
+
+    if (start < end) {
+        plp_softmax_q16s_xpulpv2(a->pSrc + start * a->rowLen, end - start, a->rowLen,
+                                 a->fracBits, a->pDst + start * a->rowLen);
+    }
+}
+
+/**
+   @} end of SoftmaxKernels group
+*/
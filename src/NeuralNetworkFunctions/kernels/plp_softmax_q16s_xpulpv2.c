@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point softmax for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Softmax
+*/
+
+/**
+   @addtogroup SoftmaxKernels
+   @{
+*/
+
+/**
+   @brief Softmax of the rows of a 16-bit fixed-point matrix kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  fracBits  decimal point of the input and of the output, format
+                         Q(16-fracBits).fracBits
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+
+   @par
+   The reciprocal of the sum is computed once per row as 2^30 / sum, such that the normalization
+   is a multiplication and a rounding shift per element. The exponential of the maximum is 1, hence
+   the sum is at least 2^fracBits and the reciprocal keeps at least 15 significant bits. Results
+   which cannot be represented (1.0 for fracBits = 15) are saturated. The differences to the
+   maximum can exceed the 16-bit range, their exponential is computed as exp(d / 2)^2.
+*/
+
+void plp_softmax_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t r, i; // loop counters
+    int16_t max, e;
+    int32_t d, y, sum, inv;
+    uint32_t shift = 30 - fracBits;
+
+    if (rowLen == 0) {
+        return;
+    }
+
+    for (r = 0; r < nRows; r++) {
+
+        plp_max_i16s_xpulpv2(pSrc, rowLen, &max);
+
+        // fused exponential and sum pass
+        sum = 0;
+        for (i = 0; i < rowLen; i++) {
+            d = pSrc[i] - max;
+            if (d >= -32768) {
+                e = plp_exp_q16s_xpulpv2((int16_t)d, fracBits);
+            } else {
+                // d does not fit into 16 bits, exp(d) = exp(d / 2)^2
+                e = plp_exp_q16s_xpulpv2((int16_t)(d >> 1), fracBits);
+                e = (int16_t)((e * e) >> fracBits);
+            }
+            pDst[i] = e;
+            sum += e;
+        }
+
+        // normalization pass
+        inv = (1 << 30) / sum;
+        for (i = 0; i < rowLen; i++) {
+            y = __ROUNDNORM_REG(pDst[i] * inv, shift);
+            pDst[i] = (int16_t)__MIN(y, 0x7FFF);
+        }
+
+        pSrc += rowLen;
+        pDst += rowLen;
+    }
+}
+
+/**
+   @} end of SoftmaxKernels group
+*/
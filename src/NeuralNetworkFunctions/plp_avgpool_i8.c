@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_avgpool_i8.c
+ * Description:  Average pooling of an 8-bit image glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup AvgPool Average Pooling
+   This module contains the glue code for the average pooling of 8-bit feature maps. The kernel
+   codes (kernels) are in the Module Average Pooling Kernels.
+
+   The input and output images are stored channel last. Every output pixel is the average, rounded
+   to the nearest value, of the kH x kW window of the input image of the same channel. The window is
+   moved by stride pixels, and only windows which lie inside the image are used (no padding). The
+   output image has outH = (H - kH) / stride + 1 rows and outW = (W - kW) / stride + 1 columns.
+*/
+
+/**
+   @addtogroup AvgPool
+   @{
+*/
+
+/**
+   @brief Glue code for average pooling of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  kH        height of the pooling window
+   @param[in]  kW        width of the pooling window
+   @param[in]  stride    stride of the pooling window in both directions
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_avgpool_i8(const int8_t *__restrict__ pSrc,
+                    uint32_t H,
+                    uint32_t W,
+                    uint32_t C,
+                    uint32_t kH,
+                    uint32_t kW,
+                    uint32_t stride,
+                    int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_avgpool_i8s_rv32im(pSrc, H, W, C, kH, kW, stride, pDst);
+    } else {
+        plp_avgpool_i8s_xpulpv2(pSrc, H, W, C, kH, kW, stride, pDst);
+    }
+}
+
+/**
+   @} end of AvgPool group
+*/
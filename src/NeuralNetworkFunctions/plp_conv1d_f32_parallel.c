@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_f32_parallel.c
+ * Description:  Parallel dilated 1D convolution of 32-bit floating-point sequences glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup Conv1d
+   @{
+*/
+
+/**
+   @brief Glue code for parallel dilated and strided 1D convolution of 32-bit floating-point
+          sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t L,
+                             uint32_t Cin,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t Cout,
+                             uint32_t K,
+                             uint32_t dilation,
+                             uint32_t stride,
+                             uint32_t padL,
+                             uint32_t padR,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_conv1d_f32_parallel), L * Cin * Cout * K);
+        }
+
+        plp_conv1d_instance_f32 args = { .pSrc = pSrc,
+                                         .L = L,
+                                         .Cin = Cin,
+                                         .pKernel = pKernel,
+                                         .Cout = Cout,
+                                         .K = K,
+                                         .dilation = dilation,
+                                         .stride = stride,
+                                         .padL = padL,
+                                         .padR = padR,
+                                         .nPE = nPE,
+                                         .pDst = pDst };
+        rt_team_fork(nPE, plp_conv1d_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Conv1d group
+*/
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv1d_i4.c
+ * Description:  Glue code for the 1D convolution of 4-bit sequences
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup Conv1dSubByte Sub-Byte 1D Convolution
+   This module contains the glue code for the dilated and strided 1D convolution of 4-bit and 2-bit
+   sequences, e.g. of a temporal convolutional network with quantized activations and weights. The
+   kernel codes (kernels) are in the Module Sub-Byte 1D Convolution Kernels.
+
+   The convolution is the same as of plp_conv1d_i8 (see Conv1d), with 32-bit outputs. The values
+   are packed in two's complement, channel ci of a sample in the bits 4ci to 4ci+3 (4-bit) or 2ci
+   to 2ci+1 (2-bit) of the sample (see plp_get_i4 and plp_get_i2). Every sample of the input
+   sequence and every tap of the filter kernels starts at a word boundary: it takes ceil(Cin / 8)
+   words (4-bit) or ceil(Cin / 16) words (2-bit), and the values after the Cin-th one must be zero.
+   The sequences and the kernels must be aligned to 4 bytes.
+
+   On the cluster, the XPULPV2 kernels sign-extend the values of a word to vectors of 4 bytes in
+   registers. With the XpulpNN backend (see plp_math_common.h), the XpulpNN kernels multiply all
+   values of a word with a single instruction instead.
+*/
+
+/**
+   @addtogroup Conv1dSubByte
+   @{
+*/
+
+/**
+   @brief Glue code for dilated and strided 1D convolution of 4-bit sequences.
+   @param[in]  pSrc      points to the input sequence (L x Cin, channel last, packed)
+   @param[in]  L         length of the input sequence
+   @param[in]  Cin       number of input channels
+   @param[in]  pKernel   points to the filter kernels (Cout x K x Cin, channel last, packed)
+   @param[in]  Cout      number of output channels
+   @param[in]  K         number of taps of the filter kernels
+   @param[in]  dilation  distance between two taps in the input sequence
+   @param[in]  stride    distance between two output samples in the input sequence
+   @param[in]  padL      number of zero samples added before the input sequence
+   @param[in]  padR      number of zero samples added after the input sequence
+   @param[out] pDst      points to the output sequence (outL x Cout, channel last)
+   @return     none
+*/
+
+void plp_conv1d_i4(const int8_t *__restrict__ pSrc,
+                   uint32_t L,
+                   uint32_t Cin,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t Cout,
+                   uint32_t K,
+                   uint32_t dilation,
+                   uint32_t stride,
+                   uint32_t padL,
+                   uint32_t padR,
+                   int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv1d_i4s_rv32im(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL, padR, pDst);
+    } else {
+        PLP_CL_KERNEL(plp_conv1d_i4s)(pSrc, L, Cin, pKernel, Cout, K, dilation, stride, padL,
+                                       padR, pDst);
+    }
+}
+
+/**
+   @} end of Conv1dSubByte group
+*/
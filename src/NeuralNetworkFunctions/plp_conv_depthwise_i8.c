@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_i8.c
+ * Description:  Depthwise 2D convolution of 8-bit images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup DepthwiseConv Depthwise Convolution
+   This module contains the glue code for the depthwise 2D convolution of 8-bit feature maps, as
+   used in neural networks. The kernel codes (kernels) are in the Module Depthwise Convolution
+   Kernels.
+
+   Every channel of the input image is convolved with its own kH x kW filter kernel. The input
+   image, the kernels and the output image are stored channel last. Like in neural networks, the
+   kernel is not flipped (i.e. this is a correlation). The image is zero-padded with pad rows and
+   columns on each side, and the output image has outH = (H + 2 * pad - kH) / stride + 1 rows and
+   outW = (W + 2 * pad - kW) / stride + 1 columns. The 32-bit outputs can be requantized to 8 bits
+   with plp_requantize_i32_i8.
+*/
+
+/**
+   @addtogroup DepthwiseConv
+   @{
+*/
+
+/**
+   @brief Glue code for depthwise 2D convolution of 8-bit images.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input and output image
+   @param[in]  pKernel   points to the filter kernels (kH x kW x C, channel last)
+   @param[in]  kH        height of the filter kernels
+   @param[in]  kW        width of the filter kernels
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output image (outH x outW x C, channel last)
+   @return     none
+*/
+
+void plp_conv_depthwise_i8(const int8_t *__restrict__ pSrc,
+                           uint32_t H,
+                           uint32_t W,
+                           uint32_t C,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kH,
+                           uint32_t kW,
+                           uint32_t stride,
+                           uint32_t pad,
+                           int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv_depthwise_i8s_rv32im(pSrc, H, W, C, pKernel, kH, kW, stride, pad, pDst);
+    } else {
+        plp_conv_depthwise_i8s_xpulpv2(pSrc, H, W, C, pKernel, kH, kW, stride, pad, pDst);
+    }
+}
+
+/**
+   @} end of DepthwiseConv group
+*/
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dequantize_i32_f32_parallel.c
+ * Description:  32-bit integer to floating-point parallel dequantization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup Quantize
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel dequantization of a 32-bit integer vector to 32-bit
+          floating-point.
+   @param[in]  pSrc       points to the input vector, e.g. the accumulators of plp_mat_mult_i8
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  scale      scale of the quantization, e.g. the product of the scales of both
+                          operands of the matrix multiplication
+   @param[in]  zeroPoint  zero point of the quantization
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_dequantize_i32_f32_parallel(const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     float32_t scale,
+                                     int32_t zeroPoint,
+                                     uint32_t nPE,
+                                     float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_dequantize_i32_f32_parallel), blockSize);
+        }
+
+        plp_dequantize_instance_i32_f32 args = { .pSrc = pSrc,
+                                                 .blockSize = blockSize,
+                                                 .scale = scale,
+                                                 .zeroPoint = zeroPoint,
+                                                 .nPE = nPE,
+                                                 .pDst = pDst };
+        rt_team_fork(nPE, plp_dequantize_i32_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Quantize group
+*/
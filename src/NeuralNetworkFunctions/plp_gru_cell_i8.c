@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_i8.c
+ * Description:  One time step of an 8-bit GRU cell glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup RnnCell
+   @{
+*/
+
+/**
+   @brief Glue code for one time step of an 8-bit GRU cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pWeights  points to the stacked weights (3H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations
+   @param[out] pDstH     points to the new hidden state of length H
+   @return     none
+*/
+
+void plp_gru_cell_i8(const int8_t *__restrict__ pSrcX,
+                     const int8_t *__restrict__ pSrcH,
+                     const int8_t *__restrict__ pWeights,
+                     const int16_t *__restrict__ pBias,
+                     uint32_t I,
+                     uint32_t H,
+                     uint32_t shift,
+                     uint32_t fracBits,
+                     int8_t *__restrict__ pDstH) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_gru_cell_i8s_rv32im(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH);
+    } else {
+        plp_gru_cell_i8s_xpulpv2(pSrcX, pSrcH, pWeights, pBias, I, H, shift, fracBits, pDstH);
+    }
+}
+
+/**
+   @} end of RnnCell group
+*/
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_im2col_i8.c
+ * Description:  im2col of an 8-bit image glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup Im2col Image to Column
+   This module contains the glue code for the im2col transformation, which turns a 2D convolution
+   with many output channels into a single matrix multiplication. The kernel codes (kernels) are in
+   the Module Image to Column Kernels.
+
+   The input image is stored channel last (H x W x C). For every output pixel (y, x), one row of
+   kH * kW * C elements is written, which contains the input pixels under the kernel in the order
+   (row, column, channel). Pixels outside of the image (in the zero padding) are written as 0. The
+   output image has outH = (H + 2 * pad - kH) / stride + 1 rows and outW = (W + 2 * pad - kW) /
+   stride + 1 columns, and the output matrix has outH * outW rows.
+
+   Multiplying the output matrix with the weights (kH * kW * C x outC, e.g. with plp_mat_mult_i8
+   or plp_mat_mult_requant_i8) gives the output feature map in the channel last format.
+*/
+
+/**
+   @addtogroup Im2col
+   @{
+*/
+
+/**
+   @brief Glue code for im2col of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+*/
+
+void plp_im2col_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t H,
+                   uint32_t W,
+                   uint32_t C,
+                   uint32_t kH,
+                   uint32_t kW,
+                   uint32_t stride,
+                   uint32_t pad,
+                   int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_im2col_i8s_rv32im(pSrc, H, W, C, kH, kW, stride, pad, pDst);
+    } else {
+        plp_im2col_i8s_xpulpv2(pSrc, H, W, C, kH, kW, stride, pad, pDst);
+    }
+}
+
+/**
+   @} end of Im2col group
+*/
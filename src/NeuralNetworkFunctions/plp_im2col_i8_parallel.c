@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_im2col_i8_parallel.c
+ * Description:  Parallel im2col of an 8-bit image glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup Im2col
+   @{
+*/
+
+/**
+   @brief Glue code for parallel im2col of an 8-bit image.
+   @param[in]  pSrc      points to the input image (H x W x C, channel last)
+   @param[in]  H         height of the input image
+   @param[in]  W         width of the input image
+   @param[in]  C         number of channels of the input image
+   @param[in]  kH        height of the filter kernel
+   @param[in]  kW        width of the filter kernel
+   @param[in]  stride    stride of the kernel in both directions
+   @param[in]  pad       number of zero rows and columns added on each side of the image
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (outH * outW rows of kH * kW * C elements)
+   @return     none
+*/
+
+void plp_im2col_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t H,
+                            uint32_t W,
+                            uint32_t C,
+                            uint32_t kH,
+                            uint32_t kW,
+                            uint32_t stride,
+                            uint32_t pad,
+                            uint32_t nPE,
+                            int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_im2col_i8_parallel), H * W * C * kH * kW);
+        }
+
+        plp_im2col_instance_i8 args = { .pSrc = pSrc,
+                                        .H = H,
+                                        .W = W,
+                                        .C = C,
+                                        .kH = kH,
+                                        .kW = kW,
+                                        .stride = stride,
+                                        .pad = pad,
+                                        .nPE = nPE,
+                                        .pDst = pDst };
+        rt_team_fork(nPE, plp_im2col_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Im2col group
+*/
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_layernorm_f32.c
+ * Description:  32-bit floating-point layer normalization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup LayerNorm Layer Normalization
+   This module contains the glue code for the layer normalization of the rows of a matrix, as used
+   in transformer blocks. The kernel codes (kernels) are in the Module Layer Normalization Kernels.
+
+   Every row of nRows x rowLen elements is normalized to zero mean and unit variance, and then
+   scaled and shifted element-wise:
+
+       pDst[i] = (pSrc[i] - mean) / sqrt(var + eps) * pGamma[i] + pBeta[i]
+
+   The mean and the variance are computed in a single (fused) pass over the row, and a second pass
+   writes the output. The inverse standard deviation is computed once per row.
+*/
+
+/**
+   @addtogroup LayerNorm
+   @{
+*/
+
+/**
+   @brief Glue code for the layer normalization of the rows of a 32-bit floating-point
+          matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, e.g. 1e-5
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_f32(const float32_t *__restrict__ pSrc,
+                       uint32_t nRows,
+                       uint32_t rowLen,
+                       const float32_t *__restrict__ pGamma,
+                       const float32_t *__restrict__ pBeta,
+                       float32_t eps,
+                       float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_layernorm_f32s_xpulpv2(pSrc, nRows, rowLen, pGamma, pBeta, eps, pDst);
+    }
+}
+
+/**
+   @} end of LayerNorm group
+*/
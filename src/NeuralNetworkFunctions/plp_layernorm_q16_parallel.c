@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_layernorm_q16_parallel.c
+ * Description:  Parallel 16-bit fixed-point layer normalization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup LayerNorm
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel layer normalization of the rows of a 16-bit fixed-point
+          matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  pGamma    points to the scales, one per element of a row
+   @param[in]  pBeta     points to the offsets, one per element of a row
+   @param[in]  eps       added to the variance, in Q(32-2*fracBits).(2*fracBits)
+   @param[in]  fracBits  decimal point of the input, the scales, the offsets and the output,
+                         format Q(16-fracBits).fracBits
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_layernorm_q16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t nRows,
+                                uint32_t rowLen,
+                                const int16_t *__restrict__ pGamma,
+                                const int16_t *__restrict__ pBeta,
+                                uint32_t eps,
+                                uint32_t fracBits,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_layernorm_q16_parallel), nRows * rowLen);
+        }
+
+        plp_layernorm_instance_q16 args = { .pSrc = pSrc,
+                                            .nRows = nRows,
+                                            .rowLen = rowLen,
+                                            .pGamma = pGamma,
+                                            .pBeta = pBeta,
+                                            .eps = eps,
+                                            .fracBits = fracBits,
+                                            .nPE = nPE,
+                                            .pDst = pDst };
+        rt_team_fork(nPE, plp_layernorm_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of LayerNorm group
+*/
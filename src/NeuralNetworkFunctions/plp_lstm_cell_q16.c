@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lstm_cell_q16.c
+ * Description:  One time step of a 16-bit fixed-point LSTM cell glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup RnnCell Recurrent Cells
+   This module contains the glue code for one time step of LSTM and GRU cells, as used in recurrent
+   neural networks which process a stream (e.g. of speech) sample by sample. The kernel codes
+   (kernels) are in the Module Recurrent Cells Kernels.
+
+   The weights of all gates are stacked into one matrix with one row per gate and hidden unit,
+   which holds the weights of the input x followed by the weights of the previous hidden state h.
+   For the LSTM, it has 4H x (I + H) elements with the gates in the order i, f, g, o, and the cell
+   computes
+
+       i = sigmoid(W_i [x, h] + b_i),   f = sigmoid(W_f [x, h] + b_f)
+       g = tanh(W_g [x, h] + b_g),      o = sigmoid(W_o [x, h] + b_o)
+       c' = f * c + i * g,              h' = o * tanh(c')
+
+   For the GRU, it has 3H x (I + H) elements with the gates in the order r, z, n. Like in PyTorch,
+   the candidate n has separate biases for the input (b_n) and the hidden state (b_hn), hence the
+   4H biases are stored in the order b_r, b_z, b_n, b_hn, and the cell computes
+
+       r = sigmoid(W_r [x, h] + b_r),   z = sigmoid(W_z [x, h] + b_z)
+       n = tanh(W_nx x + b_n + r * (W_nh h + b_hn)),   h' = (1 - z) * n + z * h
+
+   The kernels compute all gates of a hidden unit at once: the dot products of its rows share
+   every load of x and h, and the activations (plp_sigmoid_q16 and plp_tanh_q16) and the update of
+   the states follow in registers, without any temporary vectors. The parallel kernels distribute
+   the hidden units across the cores. The new states must not overlap with the previous ones, i.e.
+   the states are double-buffered between the time steps.
+
+   @par Fix-Point and Shifting
+   The hidden states are in Q1.15 (q16) or Q1.7 (i8). The pre-activations of the gates, the biases
+   and the cell state of the LSTM are in Q(16-fracBits).fracBits, with fracBits at most 15. The
+   products of the weights with x and h are rounded and shifted to the right by `shift`, for q16
+   in groups of two as computed by one SIMD dot product (like in plp_mat_vec_mult_q16), for i8 once
+   after summing them in 32 bit. Then, the bias is added and the result is saturated to 16 bits.
+   With the weights in Q(16-w).w (q16) or Q(8-w).w (i8), set shift = 15 + w - fracBits (q16) or
+   shift = 7 + w - fracBits (i8).
+*/
+
+/**
+   @addtogroup RnnCell
+   @{
+*/
+
+/**
+   @brief Glue code for one time step of a 16-bit fixed-point LSTM cell.
+   @param[in]  pSrcX     points to the input vector x of length I
+   @param[in]  pSrcH     points to the previous hidden state h of length H
+   @param[in]  pSrcC     points to the previous cell state c of length H
+   @param[in]  pWeights  points to the stacked weights (4H x (I + H))
+   @param[in]  pBias     points to the biases of the gates (4H)
+   @param[in]  I         length of the input vector
+   @param[in]  H         number of hidden units
+   @param[in]  shift     amount to shift the products to the right
+   @param[in]  fracBits  decimal point of the pre-activations and the cell state
+   @param[out] pDstH     points to the new hidden state of length H
+   @param[out] pDstC     points to the new cell state of length H
+   @return     none
+*/
+
+void plp_lstm_cell_q16(const int16_t *__restrict__ pSrcX,
+                       const int16_t *__restrict__ pSrcH,
+                       const int16_t *__restrict__ pSrcC,
+                       const int16_t *__restrict__ pWeights,
+                       const int16_t *__restrict__ pBias,
+                       uint32_t I,
+                       uint32_t H,
+                       uint32_t shift,
+                       uint32_t fracBits,
+                       int16_t *__restrict__ pDstH,
+                       int16_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_lstm_cell_q16s_rv32im(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits,
+                                  pDstH, pDstC);
+    } else {
+        plp_lstm_cell_q16s_xpulpv2(pSrcX, pSrcH, pSrcC, pWeights, pBias, I, H, shift, fracBits,
+                                   pDstH, pDstC);
+    }
+}
+
+/**
+   @} end of RnnCell group
+*/
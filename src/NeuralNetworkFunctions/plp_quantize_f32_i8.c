@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_quantize_f32_i8.c
+ * Description:  32-bit floating-point to 8-bit quantization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup Quantize Quantization
+   This module contains the glue code for the quantization of 32-bit floating-point vectors to
+   8 bits, e.g. of the activations fed to plp_mat_mult_i8, and for the dequantization of the
+   32-bit results back to floating-point. The kernel codes (kernels) are in the Module
+   Quantization Kernels.
+
+   The quantization is affine, with a scale and a zero point:
+
+       pDst[i] = clip(round(pSrc[i] / scale) + zeroPoint)
+       x       = (q - zeroPoint) * scale
+
+   plp_quantize_f32_i8 computes the scale and the zero point from the range of the vector: the
+   range [min, max], extended to contain 0, is mapped to [-128, 127], and 0 is represented
+   exactly. The minimum and the maximum are found in a single pass, which replaces plp_min_f32
+   and plp_max_f32, and a second pass quantizes the vector. For a vector in L2, the caller can
+   copy it block-wise to L1 for both passes.
+*/
+
+/**
+   @addtogroup Quantize
+   @{
+*/
+
+/**
+   @brief Glue code for the quantization of a 32-bit floating-point vector to 8 bits, with the
+          scale and the zero point computed from the range of the vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[out] pDst       points to the output vector
+   @param[out] pScale     scale of the quantization returned here
+   @param[out] pZeroPoint zero point of the quantization returned here
+   @return     none
+*/
+
+void plp_quantize_f32_i8(const float32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pDst,
+                         float32_t *__restrict__ pScale,
+                         int32_t *__restrict__ pZeroPoint) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_quantize_f32_i8s_xpulpv2(pSrc, blockSize, pDst, pScale, pZeroPoint);
+    }
+}
+
+/**
+   @} end of Quantize group
+*/
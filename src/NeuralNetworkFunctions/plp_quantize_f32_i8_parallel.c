@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_quantize_f32_i8_parallel.c
+ * Description:  32-bit floating-point to 8-bit parallel quantization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup Quantize
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel quantization of a 32-bit floating-point vector to 8 bits,
+          with the scale and the zero point computed from the range of the vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output vector
+   @param[out] pScale     scale of the quantization returned here
+   @param[out] pZeroPoint zero point of the quantization returned here
+   @return     none
+*/
+
+void plp_quantize_f32_i8_parallel(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  uint32_t nPE,
+                                  int8_t *__restrict__ pDst,
+                                  float32_t *__restrict__ pScale,
+                                  int32_t *__restrict__ pZeroPoint) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_quantize_f32_i8_parallel), blockSize);
+        }
+
+        float32_t minBuffer[nPE];
+        float32_t maxBuffer[nPE];
+        plp_quantize_instance_f32_i8 args = { .pSrc = pSrc,
+                                              .blockSize = blockSize,
+                                              .nPE = nPE,
+                                              .pMin = minBuffer,
+                                              .pMax = maxBuffer,
+                                              .pDst = pDst,
+                                              .pScale = pScale,
+                                              .pZeroPoint = pZeroPoint };
+        rt_team_fork(nPE, plp_quantize_f32_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Quantize group
+*/
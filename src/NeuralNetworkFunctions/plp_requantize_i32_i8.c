@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_requantize_i32_i8.c
+ * Description:  Requantization of a 32-bit feature map to 8 bits glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup Requantize Requantization
+   This module contains the glue code for the requantization of the 32-bit accumulators of a
+   convolution or matrix multiplication to 8-bit activations. The kernel codes (kernels) are in the
+   Module Requantization Kernels.
+
+   The feature maps are stored channel last (HWC), such that element c of every pixel belongs to
+   channel c. Every channel has its own multiplier and shift:
+
+       pDst[p * nChannels + c] = clip((pSrc[p * nChannels + c] * pMult[c]) >> pShift[c])
+
+   The shift rounds to the nearest value, and the result is saturated to [-128, 127]. The product
+   is computed with 32 bits, hence the multipliers must be small enough such that it does not
+   overflow (e.g. 16-bit multipliers for 16-bit accumulators).
+*/
+
+/**
+   @addtogroup Requantize
+   @{
+*/
+
+/**
+   @brief Glue code for the requantization of a 32-bit feature map to 8 bits.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8(const int32_t *__restrict__ pSrc,
+                           uint32_t nPixels,
+                           uint32_t nChannels,
+                           const int32_t *__restrict__ pMult,
+                           const uint32_t *__restrict__ pShift,
+                           int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_requantize_i32_i8s_rv32im(pSrc, nPixels, nChannels, pMult, pShift, pDst);
+    } else {
+        plp_requantize_i32_i8s_xpulpv2(pSrc, nPixels, nChannels, pMult, pShift, pDst);
+    }
+}
+
+/**
+   @} end of Requantize group
+*/
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_requantize_i32_i8_parallel.c
+ * Description:  Parallel requantization of a 32-bit feature map to 8 bits glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup Requantize
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel requantization of a 32-bit feature map to 8 bits.
+   @param[in]  pSrc      points to the input feature map (nPixels x nChannels, channel last)
+   @param[in]  nPixels   number of pixels of the feature map
+   @param[in]  nChannels number of channels of the feature map
+   @param[in]  pMult     points to the multipliers, one per channel
+   @param[in]  pShift    points to the right shifts, one per channel
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output feature map
+   @return     none
+*/
+
+void plp_requantize_i32_i8_parallel(const int32_t *__restrict__ pSrc,
+                                    uint32_t nPixels,
+                                    uint32_t nChannels,
+                                    const int32_t *__restrict__ pMult,
+                                    const uint32_t *__restrict__ pShift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_requantize_i32_i8_parallel), nPixels * nChannels);
+        }
+
+        plp_requantize_instance_i32_i8 args = { .pSrc = pSrc,
+                                                .nPixels = nPixels,
+                                                .nChannels = nChannels,
+                                                .pMult = pMult,
+                                                .pShift = pShift,
+                                                .nPE = nPE,
+                                                .pDst = pDst };
+        rt_team_fork(nPE, plp_requantize_i32_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Requantize group
+*/
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_f32.c
+ * Description:  32-bit floating-point softmax glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @defgroup Softmax Softmax
+   This module contains the glue code for the softmax of the rows of a matrix, as used in the
+   classifier head and the attention of neural networks. The kernel codes (kernels) are in the
+   Module Softmax Kernels.
+
+   Every row of nRows x rowLen elements is transformed independently:
+
+       pDst[i] = exp(pSrc[i] - max) / sum_j exp(pSrc[j] - max)
+
+   Subtracting the maximum of the row keeps all exponentials in (0, 1], such that the sum cannot
+   overflow. The maximum is computed with the max kernels of the statistics functions, and the
+   exponentials with the fast exponential functions. The exponentials and their sum are computed in
+   a single (fused) pass, and a last pass multiplies the row with the reciprocal of the sum.
+*/
+
+/**
+   @addtogroup Softmax
+   @{
+*/
+
+/**
+   @brief Glue code for the softmax of the rows of a 32-bit floating-point matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_f32(const float32_t *__restrict__ pSrc,
+                     uint32_t nRows,
+                     uint32_t rowLen,
+                     float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_softmax_f32s_xpulpv2(pSrc, nRows, rowLen, pDst);
+    }
+}
+
+/**
+   @} end of Softmax group
+*/
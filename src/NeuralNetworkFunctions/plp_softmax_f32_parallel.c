@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_f32_parallel.c
+ * Description:  Parallel 32-bit floating-point softmax glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupNN
+*/
+
+/**
+   @addtogroup Softmax
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel softmax of the rows of a 32-bit floating-point matrix.
+   @param[in]  pSrc      points to the input matrix (nRows x rowLen)
+   @param[in]  nRows     number of rows
+   @param[in]  rowLen    number of elements of a row
+   @param[in]  nPE       Number of cores to use
+   @param[out] pDst      points to the output matrix (nRows x rowLen)
+   @return     none
+*/
+
+void plp_softmax_f32_parallel(const float32_t *__restrict__ pSrc,
+                              uint32_t nRows,
+                              uint32_t rowLen,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_softmax_f32_parallel), nRows * rowLen);
+        }
+
+        plp_softmax_instance_f32 args = { .pSrc = pSrc,
+                                          .nRows = nRows,
+                                          .rowLen = rowLen,
+                                          .nPE = nPE,
+                                          .pDst = pDst };
+        rt_team_fork(nPE, plp_softmax_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of Softmax group
+*/
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_q16s_rv32im.c
+ * Description:  Cell averaging CFAR detection kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup cfar
+ */
+
+/**
+  @defgroup cfarKernels CFAR Detection Kernels
+ */
+
+/**
+  @addtogroup cfarKernels
+  @{
+ */
+
+/**
+  @brief Cell averaging CFAR detection of a 16-bit fixed point vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nGuard     number of guard cells on each side of the cell under test
+  @param[in]  nTrain     number of training cells on each side, must be larger than 0
+  @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+  @param[in]  deciPoint  number of fractional bits of scale
+  @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+  @return     none
+
+  @par
+  The sum of the training cells is updated with one addition and one subtraction per window and
+  cell, and compared with the cell under test without division:
+  pSrc[n] * count * 2^deciPoint > scale * sum, in 64 bit.
+ */
+
+void plp_cfar_ca_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nGuard,
+                             uint32_t nTrain,
+                             int32_t scale,
+                             uint32_t deciPoint,
+                             uint8_t *__restrict__ pDst) {
+
+    int32_t N = (int32_t)blockSize;
+    int32_t g = (int32_t)nGuard;
+    int32_t t = (int32_t)nTrain;
+    int64_t one = (int64_t)1 << deciPoint;
+    int32_t sum = 0; // sum of the training cells of both windows
+    int32_t cnt = 0; // number of training cells of both windows
+    int32_t n, k;
+
+    // right window of the first cell, the left window is empty
+    for (k = g + 1; k < N && k <= g + t; k++) {
+        sum += pSrc[k];
+        cnt++;
+    }
+
+    for (n = 0; n < N; n++) {
+        pDst[n] = (cnt > 0) && ((int64_t)pSrc[n] * cnt * one > (int64_t)scale * sum);
+
+        // slide both windows to cell n + 1
+        k = n - g;
+        if (k >= 0) {
+            sum += pSrc[k];
+            cnt++;
+        }
+        k = n - g - t;
+        if (k >= 0) {
+            sum -= pSrc[k];
+            cnt--;
+        }
+        k = n + g + 1;
+        if (k < N) {
+            sum -= pSrc[k];
+            cnt--;
+        }
+        k = n + g + t + 1;
+        if (k < N) {
+            sum += pSrc[k];
+            cnt++;
+        }
+    }
+}
+
+/**
+  @} end of cfarKernels group
+ */
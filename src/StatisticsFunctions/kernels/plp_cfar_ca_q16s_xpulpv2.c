@@ -0,0 +1,138 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_q16s_xpulpv2.c
+ * Description:  Cell averaging CFAR detection kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup cfar
+ */
+
+/**
+  @addtogroup cfarKernels
+  @{
+ */
+
+/* compares cell n with the training cells and slides both windows to cell n + 1, at the borders
+   of the vector */
+static inline void plp_cfar_ca_q16_step(const int16_t *__restrict__ pSrc,
+                                        int32_t N,
+                                        int32_t g,
+                                        int32_t t,
+                                        int32_t scale,
+                                        int64_t one,
+                                        int32_t *sum,
+                                        int32_t *cnt,
+                                        int32_t n,
+                                        uint8_t *__restrict__ pDst) {
+    int32_t k;
+
+    pDst[n] = (*cnt > 0) && ((int64_t)pSrc[n] * *cnt * one > (int64_t)scale * *sum);
+
+    k = n - g;
+    if (k >= 0) {
+        *sum += pSrc[k];
+        (*cnt)++;
+    }
+    k = n - g - t;
+    if (k >= 0) {
+        *sum -= pSrc[k];
+        (*cnt)--;
+    }
+    k = n + g + 1;
+    if (k < N) {
+        *sum -= pSrc[k];
+        (*cnt)--;
+    }
+    k = n + g + t + 1;
+    if (k < N) {
+        *sum += pSrc[k];
+        (*cnt)++;
+    }
+}
+
+/**
+  @brief Cell averaging CFAR detection of a 16-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nGuard     number of guard cells on each side of the cell under test
+  @param[in]  nTrain     number of training cells on each side, must be larger than 0
+  @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+  @param[in]  deciPoint  number of fractional bits of scale
+  @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+  @return     none
+
+  @par
+  Only the cells at the borders, whose windows are cut by the vector, check the window bounds. In
+  between, both windows are full, the number of training cells is constant and the windows slide
+  without any branch.
+ */
+
+void plp_cfar_ca_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              int32_t scale,
+                              uint32_t deciPoint,
+                              uint8_t *__restrict__ pDst) {
+
+    int32_t N = (int32_t)blockSize;
+    int32_t g = (int32_t)nGuard;
+    int32_t t = (int32_t)nTrain;
+    int64_t one = (int64_t)1 << deciPoint;
+    int64_t full = (int64_t)(2 * t) << deciPoint;
+    int32_t sum = 0; // sum of the training cells of both windows
+    int32_t cnt = 0; // number of training cells of both windows
+    int32_t n, k, start, end;
+
+    // right window of the first cell, the left window is empty
+    for (k = g + 1; k < N && k <= g + t; k++) {
+        sum += pSrc[k];
+        cnt++;
+    }
+
+    // cells whose windows end inside the vector after sliding
+    start = __MIN(g + t, N);
+    end = __MAX(start, N - g - t - 1);
+
+    for (n = 0; n < start; n++) {
+        plp_cfar_ca_q16_step(pSrc, N, g, t, scale, one, &sum, &cnt, n, pDst);
+    }
+
+    for (n = start; n < end; n++) {
+        pDst[n] = (int64_t)pSrc[n] * full > (int64_t)scale * sum;
+        sum += pSrc[n - g] - pSrc[n - g - t] - pSrc[n + g + 1] + pSrc[n + g + t + 1];
+    }
+
+    for (n = end; n < N; n++) {
+        plp_cfar_ca_q16_step(pSrc, N, g, t, scale, one, &sum, &cnt, n, pDst);
+    }
+}
+
+/**
+  @} end of cfarKernels group
+ */
@@ -0,0 +1,186 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_os_q16s_xpulpv2.c
+ * Description:  Ordered statistic CFAR detection kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup cfar
+ */
+
+/**
+  @addtogroup cfarKernels
+  @{
+ */
+
+/* index of the first entry of the sorted buffer which is not smaller than x */
+static inline uint32_t plp_cfar_os_q16_find(const int16_t *pBuf, uint32_t cnt, int16_t x) {
+    uint32_t lo = 0, hi = cnt;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if (pBuf[mid] < x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* replaces the entry out of the sorted buffer with in, shifting only the entries in between */
+static inline void plp_cfar_os_q16_replace(int16_t *pBuf,
+                                           uint32_t cnt,
+                                           int16_t out,
+                                           int16_t in) {
+    uint32_t i = plp_cfar_os_q16_find(pBuf, cnt, out);
+
+    if (in > out) {
+        for (; i + 1 < cnt && pBuf[i + 1] < in; i++) {
+            pBuf[i] = pBuf[i + 1];
+        }
+    } else {
+        for (; i > 0 && pBuf[i - 1] > in; i--) {
+            pBuf[i] = pBuf[i - 1];
+        }
+    }
+    pBuf[i] = in;
+}
+
+/* inserts x into the sorted buffer of cnt entries */
+static inline void plp_cfar_os_q16_insert(int16_t *pBuf, uint32_t cnt, int16_t x) {
+    uint32_t i;
+
+    for (i = cnt; i > 0 && pBuf[i - 1] > x; i--) {
+        pBuf[i] = pBuf[i - 1];
+    }
+    pBuf[i] = x;
+}
+
+/* removes x from the sorted buffer of cnt entries */
+static inline void plp_cfar_os_q16_remove(int16_t *pBuf, uint32_t cnt, int16_t x) {
+    uint32_t i;
+
+    for (i = plp_cfar_os_q16_find(pBuf, cnt, x); i + 1 < cnt; i++) {
+        pBuf[i] = pBuf[i + 1];
+    }
+}
+
+/* moves a window by one cell: the cell in enters if inOk, the cell out leaves if outOk */
+static inline void plp_cfar_os_q16_slide(int16_t *pBuf,
+                                         uint32_t *cnt,
+                                         int16_t in,
+                                         int32_t inOk,
+                                         int16_t out,
+                                         int32_t outOk) {
+    if (inOk && outOk) {
+        plp_cfar_os_q16_replace(pBuf, *cnt, out, in);
+    } else if (inOk) {
+        plp_cfar_os_q16_insert(pBuf, *cnt, in);
+        (*cnt)++;
+    } else if (outOk) {
+        plp_cfar_os_q16_remove(pBuf, *cnt, out);
+        (*cnt)--;
+    }
+}
+
+/**
+  @brief Ordered statistic CFAR detection of a 16-bit fixed point vector kernel for XPULPV2
+         extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nGuard     number of guard cells on each side of the cell under test
+  @param[in]  nTrain     number of training cells on each side, must be larger than 0
+  @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                         (smallest) to 2 * nTrain
+  @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+  @param[in]  deciPoint  number of fractional bits of scale
+  @param[out] pTmp       scratch buffer with 2 * nTrain entries
+  @param[out] pDst       points to the output vector, 1 for detected cells, 0 otherwise
+  @return     none
+
+  @par
+  The training cells are kept sorted in pTmp. Sliding a full window replaces one training cell,
+  which is found by binary search, and moves only the training cells between the old and the new
+  value. At the borders, the rank is scaled to the number of training cells inside the vector.
+  Between the borders, both windows are full and the rank is constant.
+ */
+
+void plp_cfar_os_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              uint32_t rank,
+                              int32_t scale,
+                              uint32_t deciPoint,
+                              int16_t *__restrict__ pTmp,
+                              uint8_t *__restrict__ pDst) {
+
+    int32_t N = (int32_t)blockSize;
+    int32_t g = (int32_t)nGuard;
+    int32_t t = (int32_t)nTrain;
+    int64_t one = (int64_t)1 << deciPoint;
+    uint32_t cnt = 0; // number of training cells in pTmp, sorted in ascending order
+    uint32_t r;
+    int32_t n, k, start, end;
+
+    // right window of the first cell, the left window is empty
+    for (k = g + 1; k < N && k <= g + t; k++) {
+        plp_cfar_os_q16_insert(pTmp, cnt, pSrc[k]);
+        cnt++;
+    }
+
+    // cells whose windows end inside the vector after sliding
+    start = __MIN(g + t, N);
+    end = __MAX(start, N - g - t - 1);
+
+    for (n = 0; n < N; n++) {
+        if (n == start) {
+            // both windows are full, every cell replaces one training cell in each window
+            r = rank - 1;
+            for (; n < end; n++) {
+                pDst[n] = (int64_t)pSrc[n] * one > (int64_t)scale * pTmp[r];
+                plp_cfar_os_q16_replace(pTmp, cnt, pSrc[n - g - t], pSrc[n - g]);
+                plp_cfar_os_q16_replace(pTmp, cnt, pSrc[n + g + 1], pSrc[n + g + t + 1]);
+            }
+        }
+
+        // rank among the training cells inside the vector, scaled to their number
+        r = (rank * cnt + nTrain) / (2 * nTrain);
+        r = (r < 1) ? 1 : ((r > cnt) ? cnt : r);
+        pDst[n] = (cnt > 0) && ((int64_t)pSrc[n] * one > (int64_t)scale * pTmp[r - 1]);
+
+        plp_cfar_os_q16_slide(pTmp, &cnt, pSrc[__MAX(n - g, 0)], n - g >= 0,
+                            pSrc[__MAX(n - g - t, 0)], n - g - t >= 0);
+        plp_cfar_os_q16_slide(pTmp, &cnt, pSrc[__MIN(n + g + t + 1, N - 1)], n + g + t + 1 < N,
+                            pSrc[__MIN(n + g + 1, N - 1)], n + g + 1 < N);
+    }
+}
+
+/**
+  @} end of cfarKernels group
+ */
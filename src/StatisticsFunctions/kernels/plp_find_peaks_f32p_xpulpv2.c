@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_f32p_xpulpv2.c
+ * Description:  Parallel row-wise peak finding kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup findPeaks
+ */
+
+/**
+  @addtogroup findPeaksKernels
+  @{
+ */
+
+/**
+  @brief Parallel row-wise peak finding of a 32-bit floating-point matrix kernel for XPULPV2
+         extension.
+  @param[in]  args       points to the plp_find_peaks_instance_f32 struct initialized
+                         by the glue code
+  @return     none
+ */
+
+void plp_find_peaks_f32p_xpulpv2(void *args) {
+
+    plp_find_peaks_instance_f32 *S = (plp_find_peaks_instance_f32 *)args;
+    uint32_t numCols = S->numCols;
+    uint32_t m;
+
+    /* the rows are interleaved over the cores */
+    for (m = plp_core_id(); m < S->numRows; m += S->nPE) {
+        plp_find_peaks_f32s_xpulpv2(S->pSrc + m * numCols, numCols, S->threshold, S->minDist,
+                                    S->pDst + m * numCols);
+    }
+}
+
+/**
+  @} end of findPeaksKernels group
+ */
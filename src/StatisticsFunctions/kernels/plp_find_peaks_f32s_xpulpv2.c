@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_f32s_xpulpv2.c
+ * Description:  Peak finding kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup findPeaks
+ */
+
+/**
+  @addtogroup findPeaksKernels
+  @{
+ */
+
+/**
+  @brief Peak finding in a 32-bit floating-point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  minimum height of a peak
+  @param[in]  minDist    minimum distance between two peaks, in samples
+  @param[out] pDst       points to the output vector, 1 for peaks, 0 otherwise
+  @return     none
+
+  @par
+  The neighbors of a sample and the height of the last peak are kept in registers, such that every
+  sample is loaded once.
+ */
+
+void plp_find_peaks_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 float32_t threshold,
+                                 uint32_t minDist,
+                                 uint8_t *__restrict__ pDst) {
+
+    uint32_t n;
+    uint32_t last = 0; // index of the last peak, 0 if there is none
+    float32_t lastVal = threshold;
+    float32_t prev, x, next;
+
+    if (blockSize < 3) {
+        for (n = 0; n < blockSize; n++) {
+            pDst[n] = 0;
+        }
+        return;
+    }
+
+    pDst[0] = 0;
+    prev = pSrc[0];
+    x = pSrc[1];
+    for (n = 1; n < blockSize - 1; n++) {
+        next = pSrc[n + 1];
+        pDst[n] = 0;
+
+        if (x > threshold && x > prev && x >= next) {
+            if (last == 0 || n - last >= minDist) {
+                pDst[n] = 1;
+                last = n;
+                lastVal = x;
+            } else if (x > lastVal) {
+                // the higher peak replaces the last one
+                pDst[last] = 0;
+                pDst[n] = 1;
+                last = n;
+                lastVal = x;
+            }
+        }
+        prev = x;
+        x = next;
+    }
+    pDst[blockSize - 1] = 0;
+}
+
+/**
+  @} end of findPeaksKernels group
+ */
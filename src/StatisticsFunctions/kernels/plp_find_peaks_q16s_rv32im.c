@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_q16s_rv32im.c
+ * Description:  Peak finding kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup findPeaks
+ */
+
+/**
+  @defgroup findPeaksKernels Peak Finding Kernels
+ */
+
+/**
+  @addtogroup findPeaksKernels
+  @{
+ */
+
+/**
+  @brief Peak finding in a 16-bit fixed point vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  minimum height of a peak
+  @param[in]  minDist    minimum distance between two peaks, in samples
+  @param[out] pDst       points to the output vector, 1 for peaks, 0 otherwise
+  @return     none
+ */
+
+void plp_find_peaks_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int16_t threshold,
+                                uint32_t minDist,
+                                uint8_t *__restrict__ pDst) {
+
+    uint32_t n;
+    int32_t last = -1; // index of the last peak
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    pDst[0] = 0;
+    for (n = 1; n + 1 < blockSize; n++) {
+        int16_t x = pSrc[n];
+        pDst[n] = 0;
+
+        if (x > threshold && x > pSrc[n - 1] && x >= pSrc[n + 1]) {
+            if (last < 0 || n - (uint32_t)last >= minDist) {
+                pDst[n] = 1;
+                last = (int32_t)n;
+            } else if (x > pSrc[last]) {
+                // the higher peak replaces the last one
+                pDst[last] = 0;
+                pDst[n] = 1;
+                last = (int32_t)n;
+            }
+        }
+    }
+    pDst[blockSize - 1] = 0;
+}
+
+/**
+  @} end of findPeaksKernels group
+ */
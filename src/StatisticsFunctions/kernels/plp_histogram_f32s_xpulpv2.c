@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_f32s_xpulpv2.c
+ * Description:  Histogram of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+static inline int32_t plp_histogram_bin_f32(float32_t x,
+                                            float32_t minValue,
+                                            float32_t scale,
+                                            int32_t last) {
+    float32_t pos = (x - minValue) * scale;
+    if (pos < 0.0f) {
+        return 0;
+    }
+    if (pos >= (float32_t)last) {
+        return last;
+    }
+    return (int32_t)pos;
+}
+
+/**
+   @brief      Histogram of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  minValue   lower edge of the first bin
+   @param[in]  binWidth   width of the bins, must be larger than 0
+   @param[in]  nBins      number of bins, must be larger than 0
+   @param[out] pHist      histogram with nBins entries, overwritten
+   @return     none
+
+   @par
+   The bins of two samples are computed before their counts are loaded, and both counts are loaded
+   before they are stored back, which hides the load-use latency of the read-modify-write. If both
+   samples fall into the same bin, the second store writes the count incremented by two.
+*/
+
+void plp_histogram_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                float32_t minValue,
+                                float32_t binWidth,
+                                uint32_t nBins,
+                                uint32_t *__restrict__ pHist) {
+
+    float32_t scale = 1.0f / binWidth;
+    int32_t last = nBins - 1;
+    int32_t b0, b1;
+    uint32_t c0, c1;
+    uint32_t blkCnt, i;
+
+    for (i = 0; i < nBins; i++) {
+        pHist[i] = 0;
+    }
+
+    for (blkCnt = blockSize >> 1; blkCnt > 0; blkCnt--) {
+        b0 = plp_histogram_bin_f32(pSrc[0], minValue, scale, last);
+        b1 = plp_histogram_bin_f32(pSrc[1], minValue, scale, last);
+        pSrc += 2;
+        c0 = pHist[b0];
+        c1 = pHist[b1];
+        pHist[b0] = c0 + 1;
+        pHist[b1] = c1 + 1 + (b0 == b1);
+    }
+
+    if (blockSize & 1) {
+        pHist[plp_histogram_bin_f32(*pSrc, minValue, scale, last)]++;
+    }
+}
+
+/**
+   @} end of histogramKernels group
+*/
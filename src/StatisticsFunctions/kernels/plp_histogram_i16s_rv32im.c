@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i16s_rv32im.c
+ * Description:  Histogram of a 16-bit integer vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief      Histogram of a 16-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  minValue   lower edge of the first bin
+   @param[in]  binShift   width of the bins is 1 << binShift
+   @param[in]  nBins      number of bins, must be larger than 0
+   @param[out] pHist      histogram with nBins entries, overwritten
+   @return     none
+*/
+
+void plp_histogram_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               int16_t minValue,
+                               uint32_t binShift,
+                               uint32_t nBins,
+                               uint32_t *__restrict__ pHist) {
+
+    int32_t last = nBins - 1;
+    int32_t bin;
+    uint32_t i;
+
+    for (i = 0; i < nBins; i++) {
+        pHist[i] = 0;
+    }
+
+    for (i = 0; i < blockSize; i++) {
+        bin = ((int32_t)pSrc[i] - minValue) >> binShift;
+        if (bin < 0) {
+            bin = 0;
+        } else if (bin > last) {
+            bin = last;
+        }
+        pHist[bin]++;
+    }
+}
+
+/**
+   @} end of histogramKernels group
+*/
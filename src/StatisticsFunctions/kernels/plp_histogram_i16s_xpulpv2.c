@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i16s_xpulpv2.c
+ * Description:  Histogram of a 16-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief      Histogram of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  minValue   lower edge of the first bin
+   @param[in]  binShift   width of the bins is 1 << binShift
+   @param[in]  nBins      number of bins, must be larger than 0
+   @param[out] pHist      histogram with nBins entries, overwritten
+   @return     none
+
+   @par
+   The bins of two samples are computed before their counts are loaded, and both counts are loaded
+   before they are stored back, which hides the load-use latency of the read-modify-write. If both
+   samples fall into the same bin, the second store writes the count incremented by two.
+*/
+
+void plp_histogram_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int16_t minValue,
+                                uint32_t binShift,
+                                uint32_t nBins,
+                                uint32_t *__restrict__ pHist) {
+
+    const v2s *pVec = (const v2s *)pSrc;
+    v2s x;
+    int32_t last = nBins - 1;
+    int32_t b0, b1;
+    uint32_t c0, c1;
+    uint32_t blkCnt, i;
+
+    for (i = 0; i < nBins; i++) {
+        pHist[i] = 0;
+    }
+
+    for (blkCnt = blockSize >> 1; blkCnt > 0; blkCnt--) {
+        x = *pVec++;
+        b0 = __MIN(__MAX(((int32_t)x[0] - minValue) >> binShift, 0), last);
+        b1 = __MIN(__MAX(((int32_t)x[1] - minValue) >> binShift, 0), last);
+        c0 = pHist[b0];
+        c1 = pHist[b1];
+        pHist[b0] = c0 + 1;
+        pHist[b1] = c1 + 1 + (b0 == b1);
+    }
+
+    if (blockSize & 1) {
+        b0 = __MIN(__MAX(((int32_t)pSrc[blockSize - 1] - minValue) >> binShift, 0), last);
+        pHist[b0]++;
+    }
+}
+
+/**
+   @} end of histogramKernels group
+*/
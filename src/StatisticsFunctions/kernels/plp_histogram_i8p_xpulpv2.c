@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i8p_xpulpv2.c
+ * Description:  Parallel histogram of a 8-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief      Parallel histogram of a 8-bit integer vector kernel for XPULPV2 extension.
+   @param[in]  args  points to the plp_histogram_instance_i8 struct initialized by the glue code
+   @return     none
+
+   @par
+   Every core counts a contiguous chunk of the vector in private bins: core 0 in pHist, core i in
+   pTmp[(i - 1) * nBins]. After a barrier, every core sums up the private counts of its slice of
+   the bins into pHist.
+*/
+
+void plp_histogram_i8p_xpulpv2(void *args) {
+
+    plp_histogram_instance_i8 *S = (plp_histogram_instance_i8 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t nBins = S->nBins;
+    uint32_t *pTmp = S->pTmp;
+    uint32_t *pHist = S->pHist;
+    uint32_t *pBins = (core_id == 0) ? pHist : pTmp + (core_id - 1) * nBins;
+    uint32_t start, end, sum, i, k;
+
+    plp_stats_parallel_range(S->blockSize, 4, S->nPE, core_id, &start, &end);
+    plp_histogram_i8s_xpulpv2(S->pSrc + start, end - start, S->minValue, S->binShift, nBins, pBins);
+
+    plp_team_barrier();
+
+    plp_stats_parallel_range(nBins, 1, S->nPE, core_id, &start, &end);
+    for (i = start; i < end; i++) {
+        sum = pHist[i];
+        for (k = 0; k < S->nPE - 1; k++) {
+            sum += pTmp[k * nBins + i];
+        }
+        pHist[i] = sum;
+    }
+}
+
+/**
+   @} end of histogramKernels group
+*/
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_f32p_xpulpv2.c
+ * Description:  Parallel maximum value of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup max
+*/
+
+/**
+   @addtogroup maxKernels
+   @{
+*/
+
+/**
+   @brief      Parallel maximum value of a 32-bit float vector kernel for XPULPV2 extension.
+   @param[in]  args  points to the plp_stats_instance_f32 struct initialized by the glue code
+   @return     none
+
+   @par
+   Every core computes the maximum of a contiguous chunk of the vector, and the partial results are
+   combined in a tree with log2(nPE) steps. The result is stored to resBuffer[0].
+*/
+
+void plp_max_f32p_xpulpv2(void *args) {
+
+    plp_stats_instance_f32 *S = (plp_stats_instance_f32 *)args;
+    const float32_t *pSrc = S->pSrc;
+    uint32_t core_id = plp_core_id();
+    uint32_t start, end, i;
+    float32_t acc = -INFINITY;
+
+    plp_stats_parallel_range(S->blockSize, 1, S->nPE, core_id, &start, &end);
+
+    for (i = start; i < end; i++) {
+        if (pSrc[i] > acc) {
+            acc = pSrc[i];
+        }
+    }
+
+    S->resBuffer[core_id] = acc;
+    plp_stats_tree_reduce_f32(S->resBuffer, S->nPE, core_id, PLP_STATS_MAX);
+}
+
+/**
+   @} end of maxKernels group
+*/
@@ -54,24 +54,29 @@ void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                          uint32_t blockSize,
                          int8_t *__restrict__ pRes) {
 
-    uint32_t blkCnt = 0;
+    uint32_t blkCnt;
     int8_t x1, x2;
-    int8_t max = 0xA0;
+    int8_t max = 0x80;
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        if (x1 > max) {
-            if (x2 > x1) {
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            x2 = *pSrc++;
+            if (x1 > max) {
+                if (x2 > x1) {
+                    max = x2;
+                } else {
+                    max = x1;
+                }
+            } else if (x2 > max) {
                 max = x2;
-            } else {
-                max = x1;
             }
-        } else if (x2 > max) {
-            max = x2;
-        }
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
     if (blockSize % 2 == 1) {
@@ -83,11 +88,16 @@ void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
 
 #else
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        x1 = *pSrc++;
-        if (x1 > max) {
-            max = x1;
-        }
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            if (x1 > max) {
+                max = x1;
+            }
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_idx_i32p_xpulpv2.c
+ * Description:  Parallel maximum value and its index of a 32-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup maxIdx
+*/
+
+/**
+   @addtogroup maxIdxKernels
+   @{
+*/
+
+/**
+   @brief      Parallel maximum value and its index of a 32-bit integer vector kernel for XPULPV2 extension.
+   @param[in]  args  points to the plp_stats_idx_instance_i32 struct initialized by the glue code
+   @return     none
+
+   @par
+   Every core searches a contiguous chunk of the vector, and stores the maximum and its index to
+   pValue[core_id] and pIndex[core_id].
+*/
+
+void plp_max_idx_i32p_xpulpv2(void *args) {
+
+    plp_stats_idx_instance_i32 *S = (plp_stats_idx_instance_i32 *)args;
+    const int32_t *pSrc;
+    uint32_t core_id = plp_core_id();
+    uint32_t start, end, n, i;
+    int32_t value = INT32_MIN;
+    uint32_t index = S->blockSize;
+
+    plp_stats_parallel_range(S->blockSize, 1, S->nPE, core_id, &start, &end);
+    pSrc = S->pSrc + start;
+    n = end - start;
+
+    for (i = 0; i < n; i++) {
+        if (pSrc[i] > value) {
+            value = pSrc[i];
+            index = i + start;
+        }
+    }
+
+    S->pValue[core_id] = value;
+    S->pIndex[core_id] = index;
+}
+
+/**
+   @} end of maxIdxKernels group
+*/
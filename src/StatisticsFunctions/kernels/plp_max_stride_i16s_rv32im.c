@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_stride_i16s_rv32im.c
+ * Description:  strided max value of a 16-bit integer vector kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup max
+ */
+
+/**
+  @addtogroup maxKernels
+  @{
+ */
+
+/**
+  @brief Strided max value of a 16-bit integer vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  stride     stride of the input vector (elements between two samples)
+  @param[in]  blockSize  number of samples in input vector
+  @param[out] pRes       max value returned here
+  @return     none
+
+  @par
+  The samples are addressed with their index times the stride.
+ */
+
+void plp_max_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t stride,
+                                uint32_t blockSize,
+                                int16_t *__restrict__ pRes) {
+
+    uint32_t i; /* Loop counter */
+    int16_t x;
+    int16_t max = INT16_MIN;
+
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i * stride];
+        if (x > max) {
+            max = x;
+        }
+    }
+
+    *pRes = max;
+}
+
+/**
+  @} end of maxKernels group
+ */
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_stride_i16s_xpulpv2.c
+ * Description:  strided max value of a 16-bit integer vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup max
+ */
+
+/**
+  @addtogroup maxKernels
+  @{
+ */
+
+/**
+  @brief Strided max value of a 16-bit integer vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  stride     stride of the input vector (elements between two samples)
+  @param[in]  blockSize  number of samples in input vector
+  @param[out] pRes       max value returned here
+  @return     none
+
+  @par Exploiting post-increment loads
+  The pointers advance by the stride after every sample, such that each load is a
+  post-increment load with the stride in a register (e.g. p.lw x, stride(p!)) and needs no
+  address computation. SIMD instructions cannot be used, as the samples are not contiguous.
+ */
+
+void plp_max_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t stride,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int16_t x0, x1;
+    int16_t max0 = INT16_MIN;
+    int16_t max1 = max0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x0 = *pSrc;
+        pSrc += stride;
+        x1 = *pSrc;
+        pSrc += stride;
+        max0 = (x0 > max0) ? x0 : max0;
+        max1 = (x1 > max1) ? x1 : max1;
+    }
+
+    if (blockSize & 0x1U) {
+        x0 = *pSrc;
+        max0 = (x0 > max0) ? x0 : max0;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x0 = *pSrc;
+        pSrc += stride;
+        max0 = (x0 > max0) ? x0 : max0;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    *pRes = (max1 > max0) ? max1 : max0;
+}
+
+/**
+  @} end of maxKernels group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_f32s_rv32im.c
+ * Description:  32-bit float mean kernel for the FC, in fixed point
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup mean
+ */
+
+/**
+  @addtogroup meanKernels
+  @{
+ */
+
+/**
+   @brief         Mean value of a 32-bit float vector for RV32IM extension, in fixed point.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes    mean value returned here
+   @return        none
+
+   @par
+   The values are converted to fixed point with the exponent of the largest one and summed with
+   integer instructions only, such that the FC does not need soft-float calls (see
+   PLP_FC_FIXED_POINT).
+*/
+
+void plp_mean_f32s_rv32im(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t blockExp = 1;
+    int64_t sum = 0;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        int32_t exp = plp_f32_exp_inline(pSrc[blkCnt]);
+        blockExp = (exp > blockExp) ? exp : blockExp;
+    }
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += plp_f32_to_fix_inline(pSrc[blkCnt], blockExp);
+    }
+
+    // the sum has 7 bits of headroom, which keep the precision of the division
+    *pRes = plp_fix_to_f32_inline((sum << 7) / (int32_t)blockSize, blockExp - 157);
+}
+
+/**
+  @} end of meanKernels group
+ */
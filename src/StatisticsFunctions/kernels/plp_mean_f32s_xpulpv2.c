@@ -53,25 +53,38 @@ void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
     uint32_t blkCnt; /* Loop counter, temporal BlockSize */
     float sum = 0;   /* Temporary return variable */
 
-    volatile float x1, x2;
-
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        sum += x1;
-        sum += x2;
+    /* two independent accumulators, such that an addition does not wait for the previous one to
+       leave the FPU pipeline */
+    float sum1 = 0;
+    float sum2 = 0;
+
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            sum1 += *pSrc++;
+            sum2 += *pSrc++;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
     if (blockSize % 2 == 1) {
-        sum += (*pSrc++);
+        sum1 += (*pSrc++);
     }
 
+    sum = sum1 + sum2;
+
 #else // PLP_MATH_LOOPUNROLL
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        sum += *pSrc++;
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            sum += *pSrc++;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif // PLP_MATH_LOOPUNROLL
@@ -57,11 +57,16 @@ void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        sum += x1;
-        sum += x2;
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            x2 = *pSrc++;
+            sum += x1;
+            sum += x2;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
     if (blockSize % 2 == 1) {
         sum += (*pSrc++);
@@ -69,8 +74,13 @@ void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #else // PLP_MATH_LOOPUNROLL
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        sum += *pSrc++;
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            sum += *pSrc++;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif // PLP_MATH_LOOPUNROLL
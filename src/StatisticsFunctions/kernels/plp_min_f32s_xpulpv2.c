@@ -56,24 +56,29 @@ void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
                           uint32_t blockSize,
                           float *__restrict__ pRes) {
 
-    uint32_t blkCnt = 0;
+    uint32_t blkCnt;
     float x1, x2;
     float min = pSrc[0];
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        if (x1 < min) {
-            if (x2 < x1) {
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            x2 = *pSrc++;
+            if (x1 < min) {
+                if (x2 < x1) {
+                    min = x2;
+                } else {
+                    min = x1;
+                }
+            } else if (x2 < min) {
                 min = x2;
-            } else {
-                min = x1;
             }
-        } else if (x2 < min) {
-            min = x2;
-        }
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
     if (blockSize % 2 == 1) {
@@ -85,11 +90,16 @@ void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
 
 #else
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        x1 = *pSrc++;
-        if (x1 < min) {
-            min = x1;
-        }
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            if (x1 < min) {
+                min = x1;
+            }
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif
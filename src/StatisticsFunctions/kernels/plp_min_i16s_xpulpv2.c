@@ -54,24 +54,29 @@ void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                           uint32_t blockSize,
                           int16_t *__restrict__ pRes) {
 
-    uint32_t blkCnt = 0;
+    uint32_t blkCnt;
     int16_t x1, x2;
     int16_t min = 0x7FFF;
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        if (x1 < min) {
-            if (x2 < x1) {
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            x2 = *pSrc++;
+            if (x1 < min) {
+                if (x2 < x1) {
+                    min = x2;
+                } else {
+                    min = x1;
+                }
+            } else if (x2 < min) {
                 min = x2;
-            } else {
-                min = x1;
             }
-        } else if (x2 < min) {
-            min = x2;
-        }
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
     if (blockSize % 2 == 1) {
@@ -83,11 +88,16 @@ void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #else
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        x1 = *pSrc++;
-        if (x1 < min) {
-            min = x1;
-        }
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            if (x1 < min) {
+                min = x1;
+            }
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_idx_i16s_xpulpv2.c
+ * Description:  Minimum value and its index of a 16-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup minIdx
+*/
+
+/**
+   @addtogroup minIdxKernels
+   @{
+*/
+
+/**
+   @brief      Minimum value and its index of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[out] pRes       minimum value returned here
+   @param[out] pIndex     index of the first occurrence of the minimum returned here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The vector is processed in blocks of 8 samples. The minimum of each block is computed with packed
+   pv.min instructions. Only if the block contains a new minimum, the block is searched for its
+   first occurrence. Hence, the index is found without a second pass over the vector.
+*/
+
+void plp_min_idx_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex) {
+
+    const v2s *pVec = (const v2s *)pSrc;
+    v2s x;
+    int32_t blkVal;
+    uint32_t blkCnt, i;
+    int32_t value = pSrc[0];
+    uint32_t index = 0;
+    uint32_t n = blockSize;
+
+    for (blkCnt = 0; blkCnt < (n >> 3); blkCnt++) {
+        x = __MIN2(__MIN2(pVec[0], pVec[1]), __MIN2(pVec[2], pVec[3]));
+        pVec += 4;
+        blkVal = (x[0] < x[1]) ? x[0] : x[1];
+        if (blkVal < value) {
+            value = blkVal;
+            for (i = 8 * blkCnt; pSrc[i] != blkVal; i++)
+                ;
+            index = i;
+        }
+    }
+
+    for (i = n & ~7U; i < n; i++) {
+        if (pSrc[i] < value) {
+            value = pSrc[i];
+            index = i;
+        }
+    }
+
+    *pRes = value;
+    *pIndex = index;
+}
+
+/**
+   @} end of minIdxKernels group
+*/
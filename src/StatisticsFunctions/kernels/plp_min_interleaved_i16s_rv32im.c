@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_interleaved_i16s_rv32im.c
+ * Description:  Min value of every channel of an interleaved buffer for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup min
+ */
+
+/**
+  @addtogroup minKernels
+  @{
+ */
+
+/**
+  @brief Min value of every channel of an interleaved 16-bit integer buffer kernel for RV32IM
+         extension.
+  @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+  @param[in]  nChannels  number of interleaved channels
+  @param[in]  blockSize  number of samples per channel
+  @param[out] pRes       min values of the channels (nChannels) returned here
+  @return     none
+
+  @par
+  The channels are processed one after the other, every one with a pointer which advances by
+  nChannels samples.
+ */
+
+void plp_min_interleaved_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                     uint32_t nChannels,
+                                     uint32_t blockSize,
+                                     int16_t *__restrict__ pRes) {
+
+    uint32_t c, i; /* Loop counters */
+
+    for (c = 0; c < nChannels; c++) {
+        const int16_t *pS = pSrc + c;
+        int16_t min = INT16_MAX;
+
+        for (i = 0; i < blockSize; i++) {
+            int16_t x = *pS;
+            pS += nChannels;
+            min = (x < min) ? x : min;
+        }
+
+        pRes[c] = min;
+    }
+}
+
+/**
+  @} end of minKernels group
+ */
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_interleaved_i16s_xpulpv2.c
+ * Description:  Min value of every channel of an interleaved buffer for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup min
+ */
+
+/**
+  @addtogroup minKernels
+  @{
+ */
+
+/**
+  @brief Min value of every channel of an interleaved 16-bit integer buffer kernel for XPULPV2
+         extension.
+  @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+  @param[in]  nChannels  number of interleaved channels
+  @param[in]  blockSize  number of samples per channel
+  @param[out] pRes       min values of the channels (nChannels) returned here
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two neighboring channels, e.g. the left and right channel of a stereo stream, are processed at
+  once: every frame holds their samples in one word, which is loaded with a single access. The
+  pointer advances by nChannels samples per frame. The minima of the two channels are kept in the
+  two lanes of a vector and updated with one pv.min.h per word. A last odd channel is processed
+  alone.
+ */
+
+void plp_min_interleaved_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t nChannels,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pRes) {
+
+    uint32_t c, i; /* Loop counters */
+
+    /* two channels at a time, which share every word of the buffer */
+    for (c = 0; c + 2 <= nChannels; c += 2) {
+        const int16_t *pS = pSrc + c;
+        v2s min = (v2s){ INT16_MAX, INT16_MAX };
+
+        for (i = 0; i < blockSize; i++) {
+            v2s x = *((v2s *)((void *)pS));
+            pS += nChannels;
+            min = __MIN2(min, x);
+        }
+
+        pRes[c] = min[0];
+        pRes[c + 1] = min[1];
+    }
+
+    /* last channel of an odd number of channels */
+    if (c < nChannels) {
+        const int16_t *pS = pSrc + c;
+        int16_t min = INT16_MAX;
+
+        for (i = 0; i < blockSize; i++) {
+            int16_t x = *pS;
+            pS += nChannels;
+            min = (x < min) ? x : min;
+        }
+
+        pRes[c] = min;
+    }
+}
+
+/**
+  @} end of minKernels group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_f32s_xpulpv2.c
+ * Description:  L2 normalization of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup normalizeL2
+ */
+
+/**
+  @addtogroup normalizeL2Kernels
+  @{
+ */
+
+/**
+  @brief L2 normalization of a 32-bit floating-point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+
+  @par
+  The inverse square root of the sum of squares is computed with plp_rsqrt_f32_inline, i.e. from
+  the bit pattern and two Newton iterations, such that the kernel needs no fdiv and no fsqrt.
+ */
+
+void plp_normalize_l2_f32s_xpulpv2(const float32_t *pSrc,
+                                   uint32_t blockSize,
+                                   float32_t *pDst) {
+
+    uint32_t i;
+    float32_t sum0 = 0.0f, sum1 = 0.0f;
+    float32_t scale;
+
+    /* first pass: sum of squares, with two independent accumulators */
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        sum0 += pSrc[i] * pSrc[i];
+        sum1 += pSrc[i + 1] * pSrc[i + 1];
+    }
+    if (i < blockSize) {
+        sum0 += pSrc[i] * pSrc[i];
+    }
+
+    sum0 += sum1;
+    scale = (sum0 > 0.0f) ? plp_rsqrt_f32_inline(sum0) : 0.0f;
+
+    /* second pass: scaling */
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrc[i] * scale;
+    }
+}
+
+/**
+  @} end of normalizeL2Kernels group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_q16s_rv32im.c
+ * Description:  L2 normalization of a 16-bit vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup normalizeL2
+ */
+
+/**
+  @defgroup normalizeL2Kernels L2 Normalization Kernels
+ */
+
+/**
+  @addtogroup normalizeL2Kernels
+  @{
+ */
+
+/**
+  @brief L2 normalization of a 16-bit fixed point vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, in Q1.15, may be equal to pSrc
+  @return     none
+
+  @par
+  The sum of squares S is normalized to a mantissa in [0.25, 1) and an even exponent k, such that
+  S = m * 2^k. The inverse square root of the mantissa is looked up in rsqrtTable_q16 and refined
+  with two Newton iterations, and every sample is then scaled by it and shifted by k / 2.
+ */
+
+void plp_normalize_l2_q16s_rv32im(const int16_t *pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *pDst) {
+
+    uint32_t i;
+    uint64_t sum = 0;
+    uint32_t m;
+    int32_t k, r, shift, y;
+    int32_t x;
+
+    /* first pass: sum of squares */
+    for (i = 0; i < blockSize; i++) {
+        x = pSrc[i];
+        sum += (uint32_t)(x * x);
+    }
+
+    if (sum == 0) {
+        for (i = 0; i < blockSize; i++) {
+            pDst[i] = 0;
+        }
+        return;
+    }
+
+    /* sum = m * 2^k with the mantissa m in [0.25, 1) in Q0.32 and an even exponent k */
+    k = (64 - (int32_t)__builtin_clzll(sum) + 1) & ~1;
+    m = (k >= 32) ? (uint32_t)(sum >> (k - 32)) : (uint32_t)sum << (32 - k);
+
+    /* 2^15 / sqrt(sum) = r * 2^(-k / 2) with r = 2^15 / sqrt(m) in Q2.15, below 2^16 */
+    r = (int32_t)(plp_rsqrt_norm_inline(m, 2) >> 15);
+    shift = k >> 1;
+
+    /* second pass: scaling, saturated to Q1.15 */
+    for (i = 0; i < blockSize; i++) {
+        /* rounded without adding 2^(shift - 1) first, which could overflow */
+        y = ((pSrc[i] * r >> (shift - 1)) + 1) >> 1;
+        pDst[i] = (y > 0x7FFF) ? 0x7FFF : ((y < -0x8000) ? -0x8000 : y);
+    }
+}
+
+/**
+  @} end of normalizeL2Kernels group
+ */
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_q16s_xpulpv2.c
+ * Description:  L2 normalization of a 16-bit vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup normalizeL2
+ */
+
+/**
+  @addtogroup normalizeL2Kernels
+  @{
+ */
+
+/**
+  @brief L2 normalization of a 16-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, in Q1.15, may be equal to pSrc
+  @return     none
+
+  @par
+  The sum of squares S is normalized to a mantissa in [0.25, 1) and an even exponent k, such that
+  S = m * 2^k. The inverse square root of the mantissa is looked up in rsqrtTable_q16 and refined
+  with two Newton iterations, and every sample is then scaled by it and shifted by k / 2.
+
+  @par Exploiting SIMD instructions
+  The samples are loaded two per 32-bit word, and the two squares of a word are summed with a
+  single dotp, which is accumulated in 64 bit. The scaled samples are saturated with p.clip. The samples before the first word-aligned one of pSrc are processed one
+  by one.
+ */
+
+void plp_normalize_l2_q16s_xpulpv2(const int16_t *pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *pDst) {
+
+    uint32_t i, head, blkCnt;
+    uint64_t sum = 0;
+    uint32_t m;
+    int32_t k, r, shift;
+    int32_t x;
+    const v2s *pS;
+    v2s a;
+
+    /* first pass: sum of squares, two samples per word after the unaligned ones */
+    head = plp_align_head(pSrc, sizeof(int16_t), blockSize);
+    for (i = 0; i < head; i++) {
+        x = pSrc[i];
+        sum += (uint32_t)(x * x);
+    }
+
+    pS = (const v2s *)(pSrc + head);
+    for (blkCnt = (blockSize - head) >> 1; blkCnt > 0U; blkCnt--) {
+        a = *pS++;
+        /* the two squares fit into 32 bits if they are taken as unsigned */
+        sum += (uint32_t)__DOTP2(a, a);
+    }
+
+    if ((blockSize - head) & 0x1U) {
+        x = pSrc[blockSize - 1];
+        sum += (uint32_t)(x * x);
+    }
+
+    if (sum == 0) {
+        for (i = 0; i < blockSize; i++) {
+            pDst[i] = 0;
+        }
+        return;
+    }
+
+    /* sum = m * 2^k with the mantissa m in [0.25, 1) in Q0.32 and an even exponent k */
+    k = (64 - (int32_t)__builtin_clzll(sum) + 1) & ~1;
+    m = (k >= 32) ? (uint32_t)(sum >> (k - 32)) : (uint32_t)sum << (32 - k);
+
+    /* 2^15 / sqrt(sum) = r * 2^(-k / 2) with r = 2^15 / sqrt(m) in Q2.15, below 2^16 */
+    r = (int32_t)(plp_rsqrt_norm_inline(m, 2) >> 15);
+    shift = k >> 1;
+
+    /* second pass: scaling, saturated to Q1.15 */
+    for (i = 0; i < blockSize; i++) {
+        /* rounded without adding 2^(shift - 1) first, which could overflow */
+        pDst[i] = __CLIP(((pSrc[i] * r >> (shift - 1)) + 1) >> 1, 15);
+    }
+}
+
+/**
+  @} end of normalizeL2Kernels group
+ */
@@ -0,0 +1,62 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_rows_q16p_xpulpv2.c
+ * Description:  Parallel row-wise L2 normalization for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup normalizeL2
+ */
+
+/**
+  @addtogroup normalizeL2Kernels
+  @{
+ */
+
+/**
+  @brief Parallel row-wise L2 normalization of a 16-bit fixed point matrix kernel for XPULPV2
+         extension.
+  @param[in]  args       points to the plp_normalize_l2_rows_instance_q16 struct initialized
+                         by the glue code
+  @return     none
+ */
+
+void plp_normalize_l2_rows_q16p_xpulpv2(void *args) {
+
+    plp_normalize_l2_rows_instance_q16 *S = (plp_normalize_l2_rows_instance_q16 *)args;
+    uint32_t numCols = S->numCols;
+    uint32_t m;
+
+    /* the rows are interleaved over the cores */
+    for (m = plp_core_id(); m < S->numRows; m += S->nPE) {
+        plp_normalize_l2_q16s_xpulpv2(S->pSrc + m * numCols, numCols, S->pDst + m * numCols);
+    }
+}
+
+/**
+  @} end of normalizeL2Kernels group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_power64_i32s_xpulpv2.c
+ * Description:  64-bit sum of squares of a 32-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup power
+*/
+
+/**
+   @addtogroup powerKernels
+   @{
+*/
+
+/**
+   @brief         64-bit sum of squares of a 32-bit integer vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       sum of squares returned here
+   @return        none
+*/
+
+void plp_power64_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int64_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int32_t x1, x2;
+    int64_t sum1 = 0;
+    int64_t sum2 = 0;
+
+    // two independent accumulators, such that the carry of one addition does not stall the next
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x1 = *pSrc++;
+        x2 = *pSrc++;
+        sum1 += (int64_t)x1 * x1;
+        sum2 += (int64_t)x2 * x2;
+    }
+
+    if (blockSize % 2 == 1) {
+        x1 = *pSrc++;
+        sum1 += (int64_t)x1 * x1;
+    }
+
+    *pRes = sum1 + sum2;
+}
+
+/**
+   @} end of powerKernels group
+*/
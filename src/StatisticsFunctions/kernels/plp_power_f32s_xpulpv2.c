@@ -73,29 +73,46 @@ void plp_power_f32s_xpulpv2(const float *__restrict__ pSrc,
                             uint32_t blockSize,
                             float *__restrict__ pRes) {
 
-    uint32_t blkCnt = 0;
+    uint32_t blkCnt;
     float x1, x2;
     float sum = 0;
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        sum += x1 * x1;
-        sum += x2 * x2;
+    /* two independent accumulators, such that a fused multiply-add does not wait for the previous
+       one to leave the FPU pipeline */
+    float sum1 = 0;
+    float sum2 = 0;
+
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            x2 = *pSrc++;
+            sum1 += x1 * x1;
+            sum2 += x2 * x2;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
     if (blockSize % 2 == 1) {
         x1 = *pSrc++;
-        sum += x1 * x1;
+        sum1 += x1 * x1;
     }
 
+    sum = sum1 + sum2;
+
 #else
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        x1 = *pSrc++;
-        sum += x1 * x1;
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            sum += x1 * x1;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif
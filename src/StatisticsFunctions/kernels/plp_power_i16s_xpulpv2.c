@@ -73,17 +73,22 @@ void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                             uint32_t blockSize,
                             int32_t *__restrict__ pRes) {
 
-    uint32_t blkCnt = 0;
+    uint32_t blkCnt;
     int16_t x1, x2;
     int32_t sum = 0;
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
-        x1 = *pSrc++;
-        x2 = *pSrc++;
-        sum += x1 * x1;
-        sum += x2 * x2;
+    blkCnt = blockSize >> 1U;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            x2 = *pSrc++;
+            sum += x1 * x1;
+            sum += x2 * x2;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
     if (blockSize % 2 == 1) {
@@ -93,9 +98,14 @@ void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #else
 
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
-        x1 = *pSrc++;
-        sum += x1 * x1;
+    blkCnt = blockSize;
+
+    if (blkCnt > 0U) {
+        do {
+            x1 = *pSrc++;
+            sum += x1 * x1;
+            blkCnt--;
+        } while (blkCnt > 0U);
     }
 
 #endif
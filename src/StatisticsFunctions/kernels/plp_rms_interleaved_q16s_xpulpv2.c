@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rms_interleaved_q16s_xpulpv2.c
+ * Description:  RMS value of every channel of an interleaved buffer for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup power
+ */
+
+/**
+  @addtogroup RMSkernels
+  @{
+ */
+
+/**
+  @brief RMS value of every channel of an interleaved 16-bit fixed point buffer kernel for XPULPV2
+         extension.
+  @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+  @param[in]  nChannels  number of interleaved channels
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  fracBits   decimal point of the input
+  @param[out] pRes       RMS values of the channels (nChannels) returned here
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two neighboring channels, e.g. the left and right channel of a stereo stream, are processed at
+  once: every frame holds their samples in one word, which is loaded with a single access. The
+  pointer advances by nChannels samples per frame. The squares of the two channels are taken from
+  the two lanes of the word. A last odd channel is processed alone.
+ */
+
+void plp_rms_interleaved_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t nChannels,
+                                      uint32_t blockSize,
+                                      uint32_t fracBits,
+                                      int16_t *__restrict__ pRes) {
+
+    uint32_t c, i; /* Loop counters */
+
+    /* two channels at a time, which share every word of the buffer */
+    for (c = 0; c + 2 <= nChannels; c += 2) {
+        const int16_t *pS = pSrc + c;
+        int32_t sum0 = 0, sum1 = 0;
+
+        for (i = 0; i < blockSize; i++) {
+            v2s x = *((v2s *)((void *)pS));
+            pS += nChannels;
+            sum0 += (x[0] * x[0]) >> fracBits;
+            sum1 += (x[1] * x[1]) >> fracBits;
+        }
+
+        pRes[c] = sum0 / blockSize;
+        pRes[c + 1] = sum1 / blockSize;
+    }
+
+    /* last channel of an odd number of channels */
+    if (c < nChannels) {
+        const int16_t *pS = pSrc + c;
+        int32_t sum = 0;
+
+        for (i = 0; i < blockSize; i++) {
+            int32_t x = *pS;
+            pS += nChannels;
+            sum += (x * x) >> fracBits;
+        }
+
+        pRes[c] = sum / blockSize;
+    }
+}
+
+/**
+  @} end of RMSkernels group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sliding_stats_update_q16s_rv32im.c
+ * Description:  Hop update of the fixed point sliding statistics for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static void plp_sliding_stats_sums_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                               uint32_t blockSize,
+                                               uint32_t fracBits,
+                                               int32_t *pSum,
+                                               int32_t *pSumSq);
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @defgroup runningStatsKernels Running Statistics Kernels
+   Kernels for the running and sliding statistics.
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief      Adds a hop of samples to the 16-bit fixed point sliding statistics, and removes the
+               samples leaving the window, for RV32IM extension.
+   @param[in,out] S        points to the sliding statistics instance
+   @param[in]     pNew     points to the samples entering the window
+   @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+   @param[in]     hopSize  number of samples in pNew (and pOld)
+   @return        none
+*/
+
+void plp_sliding_stats_update_q16s_rv32im(plp_sliding_stats_instance_q16 *S,
+                                          const int16_t *__restrict__ pNew,
+                                          const int16_t *__restrict__ pOld,
+                                          uint32_t hopSize) {
+
+    int32_t sum, sumSq;
+
+    plp_sliding_stats_sums_q16s_rv32im(pNew, hopSize, S->fracBits, &sum, &sumSq);
+    S->sum += sum;
+    S->sumSq += sumSq;
+    S->count += hopSize;
+
+    if (pOld != NULL) {
+        plp_sliding_stats_sums_q16s_rv32im(pOld, hopSize, S->fracBits, &sum, &sumSq);
+        S->sum -= sum;
+        S->sumSq -= sumSq;
+        S->count -= hopSize;
+    }
+}
+
+/**
+   @} end of runningStatsKernels group
+*/
+
+static void plp_sliding_stats_sums_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                               uint32_t blockSize,
+                                               uint32_t fracBits,
+                                               int32_t *pSum,
+                                               int32_t *pSumSq) {
+
+    uint32_t i;
+    int32_t sum = 0;
+    int32_t sumSq = 0;
+
+    for (i = 0; i < blockSize; i++) {
+        sum += pSrc[i];
+        sumSq += (pSrc[i] * pSrc[i]) >> fracBits;
+    }
+
+    *pSum = sum;
+    *pSumSq = sumSq;
+}
@@ -0,0 +1,231 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_parallel.c
+ * Description:  Helpers for splitting and reducing parallel statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup statsParallel Parallel statistics helpers
+   Helper functions shared by the parallel statistics kernels. The input vector is split into nPE
+   contiguous chunks, and the partial results of the cores are combined in a tree with log2(nPE)
+   steps, each one separated by a team barrier.
+   @{
+*/
+
+/**
+   @brief      Computes the chunk of the input vector processed by a core.
+   @param[in]  blockSize  number of samples in the input vector
+   @param[in]  align      number of samples packed in one SIMD word (1, 2 or 4)
+   @param[in]  nPE        number of parallel processing units
+   @param[in]  coreId     id of the current core
+   @param[out] pStart     first sample of the chunk
+   @param[out] pEnd       one past the last sample of the chunk
+   @return     none
+
+   @par
+   The chunk size is rounded up to a multiple of align, such that every chunk (except for the
+   last one) starts on a word boundary. Trailing cores may get an empty chunk.
+*/
+
+void plp_stats_parallel_range(uint32_t blockSize,
+                              uint32_t align,
+                              uint32_t nPE,
+                              uint32_t coreId,
+                              uint32_t *pStart,
+                              uint32_t *pEnd) {
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start, end;
+
+    chunk = (chunk + align - 1) & ~(align - 1);
+    start = coreId * chunk;
+    end = start + chunk;
+
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    *pStart = start;
+    *pEnd = end;
+}
+
+/**
+   @brief      Combines the partial integer results of all cores in a tree.
+   @param[in,out] pBuffer  buffer with one partial result per core, result stored to pBuffer[0]
+   @param[in]     nPE      number of parallel processing units
+   @param[in]     coreId   id of the current core
+   @param[in]     op       PLP_STATS_SUM, PLP_STATS_MIN or PLP_STATS_MAX
+   @return        none
+*/
+
+void plp_stats_tree_reduce_i32(int32_t *pBuffer, uint32_t nPE, uint32_t coreId, uint32_t op) {
+
+    uint32_t step;
+
+    for (step = 1; step < nPE; step <<= 1) {
+        plp_team_barrier();
+        if ((coreId & (2 * step - 1)) == 0 && coreId + step < nPE) {
+            int32_t a = pBuffer[coreId];
+            int32_t b = pBuffer[coreId + step];
+            if (op == PLP_STATS_SUM) {
+                a += b;
+            } else if (op == PLP_STATS_MIN) {
+                a = (b < a) ? b : a;
+            } else {
+                a = (b > a) ? b : a;
+            }
+            pBuffer[coreId] = a;
+        }
+    }
+    plp_team_barrier();
+}
+
+/**
+   @brief      Combines the partial float results of all cores in a tree.
+   @param[in,out] pBuffer  buffer with one partial result per core, result stored to pBuffer[0]
+   @param[in]     nPE      number of parallel processing units
+   @param[in]     coreId   id of the current core
+   @param[in]     op       PLP_STATS_SUM, PLP_STATS_MIN or PLP_STATS_MAX
+   @return        none
+*/
+
+void plp_stats_tree_reduce_f32(float32_t *pBuffer, uint32_t nPE, uint32_t coreId, uint32_t op) {
+
+    uint32_t step;
+
+    for (step = 1; step < nPE; step <<= 1) {
+        plp_team_barrier();
+        if ((coreId & (2 * step - 1)) == 0 && coreId + step < nPE) {
+            float32_t a = pBuffer[coreId];
+            float32_t b = pBuffer[coreId + step];
+            if (op == PLP_STATS_SUM) {
+                a += b;
+            } else if (op == PLP_STATS_MIN) {
+                a = (b < a) ? b : a;
+            } else {
+                a = (b > a) ? b : a;
+            }
+            pBuffer[coreId] = a;
+        }
+    }
+    plp_team_barrier();
+}
+
+/**
+   @brief      Combines the partial integer summaries of all cores.
+   @param[in]  pPartial   partial summaries, one per core
+   @param[in]  nPE        number of parallel processing units
+   @param[in]  blockSize  number of samples in the input vector, must be larger than 0
+   @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+   @return     none
+
+   @par
+   The partial results are visited in the order of the cores, such that the index of the first
+   occurrence of the minimum and maximum is returned.
+*/
+
+void plp_stats_summary_combine_i32(const plp_stats_partial_i32 *pPartial,
+                                   uint32_t nPE,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_i32 *pRes) {
+
+    int32_t sum = pPartial[0].sum;
+    int32_t sumSq = pPartial[0].sumSq;
+    uint32_t i;
+
+    pRes->min = pPartial[0].min;
+    pRes->max = pPartial[0].max;
+    pRes->argmin = pPartial[0].argmin;
+    pRes->argmax = pPartial[0].argmax;
+
+    for (i = 1; i < nPE; i++) {
+        sum += pPartial[i].sum;
+        sumSq += pPartial[i].sumSq;
+        if (pPartial[i].min < pRes->min) {
+            pRes->min = pPartial[i].min;
+            pRes->argmin = pPartial[i].argmin;
+        }
+        if (pPartial[i].max > pRes->max) {
+            pRes->max = pPartial[i].max;
+            pRes->argmax = pPartial[i].argmax;
+        }
+    }
+
+    pRes->mean = sum / (int32_t)blockSize;
+    pRes->var = sumSq / (int32_t)blockSize - pRes->mean * pRes->mean;
+}
+
+/**
+   @brief      Combines the partial float summaries of all cores.
+   @param[in]  pPartial   partial summaries, one per core
+   @param[in]  nPE        number of parallel processing units
+   @param[in]  blockSize  number of samples in the input vector, must be larger than 0
+   @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+   @return     none
+*/
+
+void plp_stats_summary_combine_f32(const plp_stats_partial_f32 *pPartial,
+                                   uint32_t nPE,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_f32 *pRes) {
+
+    float32_t sum = pPartial[0].sum;
+    float32_t sumSq = pPartial[0].sumSq;
+    uint32_t i;
+
+    pRes->min = pPartial[0].min;
+    pRes->max = pPartial[0].max;
+    pRes->argmin = pPartial[0].argmin;
+    pRes->argmax = pPartial[0].argmax;
+
+    for (i = 1; i < nPE; i++) {
+        sum += pPartial[i].sum;
+        sumSq += pPartial[i].sumSq;
+        if (pPartial[i].min < pRes->min) {
+            pRes->min = pPartial[i].min;
+            pRes->argmin = pPartial[i].argmin;
+        }
+        if (pPartial[i].max > pRes->max) {
+            pRes->max = pPartial[i].max;
+            pRes->argmax = pPartial[i].argmax;
+        }
+    }
+
+    pRes->mean = sum / blockSize;
+    pRes->var = sumSq / blockSize - pRes->mean * pRes->mean;
+}
+
+/**
+   @} end of statsParallel group
+*/
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_summary_i32p_xpulpv2.c
+ * Description:  Parallel single pass summary statistics of a 32-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup statsSummary
+*/
+
+/**
+   @addtogroup statsSummaryKernels
+   @{
+*/
+
+/**
+   @brief      Parallel summary statistics of a 32-bit integer vector kernel for XPULPV2 extension.
+   @param[in]  args  points to the plp_stats_summary_instance_i32 struct initialized by the glue code
+   @return     none
+
+   @par
+   Every core computes the sum, the sum of squares, the minimum and the maximum of a contiguous
+   chunk of the vector, and stores them to pPartial[core_id]. Cores with an empty chunk store the
+   neutral elements.
+*/
+
+void plp_stats_summary_i32p_xpulpv2(void *args) {
+
+    plp_stats_summary_instance_i32 *S = (plp_stats_summary_instance_i32 *)args;
+    const int32_t *pSrc;
+    plp_stats_partial_i32 *pPartial;
+    uint32_t core_id = plp_core_id();
+    uint32_t i;
+    int32_t sum = 0;
+    int32_t sumSq = 0;
+    int32_t min = INT32_MAX;
+    int32_t max = INT32_MIN;
+    uint32_t argmin = 0;
+    uint32_t argmax = 0;
+    uint32_t start, end, n;
+
+    plp_stats_parallel_range(S->blockSize, 1, S->nPE, core_id, &start, &end);
+    pSrc = S->pSrc + start;
+    n = end - start;
+
+    for (i = 0; i < n; i++) {
+        sum += pSrc[i];
+        sumSq += pSrc[i] * pSrc[i];
+        if (pSrc[i] < min) {
+            min = pSrc[i];
+            argmin = i + start;
+        }
+        if (pSrc[i] > max) {
+            max = pSrc[i];
+            argmax = i + start;
+        }
+    }
+
+    pPartial = &S->pPartial[core_id];
+    pPartial->sum = sum;
+    pPartial->sumSq = sumSq;
+    pPartial->min = min;
+    pPartial->max = max;
+    pPartial->argmin = argmin;
+    pPartial->argmax = argmax;
+}
+
+/**
+   @} end of statsSummaryKernels group
+*/
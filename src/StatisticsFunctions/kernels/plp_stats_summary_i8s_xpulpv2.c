@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_summary_i8s_xpulpv2.c
+ * Description:  Single pass summary statistics of a 8-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup statsSummary
+*/
+
+/**
+   @addtogroup statsSummaryKernels
+   @{
+*/
+
+/**
+   @brief      Summary statistics of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Four samples are loaded at once. The sum and the sum of squares are accumulated with dot products
+   (pv.sdotsp.b), while the minimum and maximum are tracked on the individual lanes.
+*/
+
+void plp_stats_summary_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   plp_stats_summary_result_i32 *__restrict__ pRes) {
+
+    const v4s *pVec;
+    v4s x;
+    uint32_t blkCnt, i;
+    int32_t sum = 0;
+    int32_t sumSq = 0;
+    int32_t min = pSrc[0];
+    int32_t max = pSrc[0];
+    uint32_t argmin = 0;
+    uint32_t argmax = 0;
+    uint32_t n = blockSize;
+
+    pVec = (const v4s *)pSrc;
+
+    for (blkCnt = 0; blkCnt < (n >> 2); blkCnt++) {
+        x = pVec[blkCnt];
+        sum = __SUMDOTP4(x, ((v4s){ 1, 1, 1, 1 }), sum);
+        sumSq = __SUMDOTP4(x, x, sumSq);
+        for (i = 0; i < 4; i++) {
+            if (x[i] < min) {
+                min = x[i];
+                argmin = 4 * blkCnt + i;
+            }
+            if (x[i] > max) {
+                max = x[i];
+                argmax = 4 * blkCnt + i;
+            }
+        }
+    }
+
+    for (i = n & ~3U; i < n; i++) {
+        sum += pSrc[i];
+        sumSq += pSrc[i] * pSrc[i];
+        if (pSrc[i] < min) {
+            min = pSrc[i];
+            argmin = i;
+        }
+        if (pSrc[i] > max) {
+            max = pSrc[i];
+            argmax = i;
+        }
+    }
+
+    pRes->min = min;
+    pRes->max = max;
+    pRes->argmin = argmin;
+    pRes->argmax = argmax;
+    pRes->mean = sum / (int32_t)blockSize;
+    pRes->var = sumSq / (int32_t)blockSize - pRes->mean * pRes->mean;
+}
+
+/**
+   @} end of statsSummaryKernels group
+*/
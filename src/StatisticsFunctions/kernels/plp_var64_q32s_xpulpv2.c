@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var64_q32s_xpulpv2.c
+ * Description:  Variance of a 32-bit fixed point vector with 64-bit accumulation for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup var
+*/
+
+/**
+   @addtogroup varKernels
+   @{
+*/
+
+/**
+   @brief         Variance of a 32-bit fixed point vector with 64-bit accumulation for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   decimal point for right shift
+   @param[out]    pRes       variance returned here, saturated to 32 bits
+   @return        none
+*/
+
+void plp_var64_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int32_t x1, x2;
+    int64_t sum = 0;
+    int64_t sumSq = 0;
+    int64_t mean, var;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x1 = *pSrc++;
+        x2 = *pSrc++;
+        sum += x1;
+        sumSq += ((int64_t)x1 * x1) >> fracBits;
+        sum += x2;
+        sumSq += ((int64_t)x2 * x2) >> fracBits;
+    }
+
+    if (blockSize % 2 == 1) {
+        x1 = *pSrc++;
+        sum += x1;
+        sumSq += ((int64_t)x1 * x1) >> fracBits;
+    }
+
+    mean = sum / (int64_t)blockSize;
+    var = sumSq / (int64_t)blockSize - ((mean * mean) >> fracBits);
+
+    if (var > INT32_MAX) {
+        var = INT32_MAX;
+    }
+    *pRes = (int32_t)var;
+}
+
+/**
+   @} end of varKernels group
+*/
@@ -55,13 +55,33 @@ void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
                           uint32_t blockSize,
                           float *__restrict__ pRes) {
 
+    uint32_t blkCnt;
+    float x1, x2;
+    float sum1 = 0, sum2 = 0;
+    float sumSq1 = 0, sumSq2 = 0;
     float square_of_mean;
     float square_of_values;
 
-    plp_mean_f32(pSrc, blockSize, &square_of_mean);
-    square_of_mean *= square_of_mean;
+    /* sum and sum of squares in a single pass, with two independent accumulators each, such that
+       consecutive floating point operations do not depend on each other */
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x1 = *pSrc++;
+        x2 = *pSrc++;
+        sum1 += x1;
+        sumSq1 += x1 * x1;
+        sum2 += x2;
+        sumSq2 += x2 * x2;
+    }
+
+    if (blockSize % 2 == 1) {
+        x1 = *pSrc++;
+        sum1 += x1;
+        sumSq1 += x1 * x1;
+    }
 
-    plp_power_f32(pSrc, blockSize, &square_of_values);
+    square_of_mean = (sum1 + sum2) / (float)blockSize;
+    square_of_mean *= square_of_mean;
+    square_of_values = sumSq1 + sumSq2;
 
     *pRes = (square_of_values / blockSize - square_of_mean);
 }
@@ -0,0 +1,170 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vq_nearest_f32s_xpulpv2.c
+ * Description:  32-bit float nearest centroid search for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include <float.h>
+/**
+   @ingroup vq
+*/
+
+/**
+   @addtogroup vqKernels
+   @{
+*/
+
+/* dot products of the query vectors a0 and a1 with the centroids b0 and b1 */
+static inline void plp_vq_dot2x2_f32s_xpulpv2(const float32_t *pA0,
+                                              const float32_t *pA1,
+                                              const float32_t *pB0,
+                                              const float32_t *pB1,
+                                              uint32_t dim,
+                                              float32_t *pDot) {
+
+    float32_t s00 = 0.0f, s01 = 0.0f, s10 = 0.0f, s11 = 0.0f;
+    uint32_t d;
+
+    for (d = 0; d < dim; d++) {
+        float32_t a0 = pA0[d];
+        float32_t a1 = pA1[d];
+        float32_t b0 = pB0[d];
+        float32_t b1 = pB1[d];
+        s00 += a0 * b0;
+        s01 += a0 * b1;
+        s10 += a1 * b0;
+        s11 += a1 * b1;
+    }
+
+    pDot[0] = s00;
+    pDot[1] = s01;
+    pDot[2] = s10;
+    pDot[3] = s11;
+}
+
+/* squared norm of the vector a */
+static inline float32_t plp_vq_norm_f32s_xpulpv2(const float32_t *pA, uint32_t dim) {
+
+    float32_t sum = 0.0f;
+    uint32_t d;
+
+    for (d = 0; d < dim; d++) {
+        float32_t a = pA[d];
+        sum += a * a;
+    }
+
+    return sum;
+}
+
+/**
+   @brief      Nearest centroid search of 32-bit float vectors for XPULPV2 extension.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_f32)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+
+   @par
+   The queries and centroids are processed in pairs. An odd query or centroid at the end is paired
+   with itself, and the duplicate result is discarded.
+*/
+
+void plp_vq_nearest_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t numVectors,
+                                 const float32_t *__restrict__ pCodebook,
+                                 uint32_t numCentroids,
+                                 uint32_t dim,
+                                 const float32_t *__restrict__ pNorms,
+                                 uint32_t *__restrict__ pIdx,
+                                 float32_t *__restrict__ pDist) {
+
+    float32_t dot[4];
+    uint32_t n, k;
+
+    for (n = 0; n < numVectors; n += 2) {
+        const float32_t *pA0 = pSrc + n * dim;
+        const float32_t *pA1 = (n + 1 < numVectors) ? pA0 + dim : pA0;
+        float32_t best0 = FLT_MAX;
+        float32_t best1 = FLT_MAX;
+        uint32_t idx0 = 0;
+        uint32_t idx1 = 0;
+
+        for (k = 0; k < numCentroids; k += 2) {
+            uint32_t k1 = (k + 1 < numCentroids) ? k + 1 : k;
+            float32_t e00, e01, e10, e11;
+
+            plp_vq_dot2x2_f32s_xpulpv2(pA0,
+                                       pA1,
+                                       pCodebook + k * dim,
+                                       pCodebook + k1 * dim,
+                                       dim,
+                                       dot);
+
+            /* ||b||^2 - 2 a.b, the distance without the constant ||a||^2 */
+            e00 = pNorms[k] - 2 * dot[0];
+            e01 = pNorms[k1] - 2 * dot[1];
+            e10 = pNorms[k] - 2 * dot[2];
+            e11 = pNorms[k1] - 2 * dot[3];
+
+            if (e00 < best0) {
+                best0 = e00;
+                idx0 = k;
+            }
+            if (e01 < best0) {
+                best0 = e01;
+                idx0 = k1;
+            }
+            if (e10 < best1) {
+                best1 = e10;
+                idx1 = k;
+            }
+            if (e11 < best1) {
+                best1 = e11;
+                idx1 = k1;
+            }
+        }
+
+        pIdx[n] = idx0;
+        if (pDist != NULL) {
+            pDist[n] = best0 + plp_vq_norm_f32s_xpulpv2(pA0, dim);
+        }
+        if (n + 1 < numVectors) {
+            pIdx[n + 1] = idx1;
+            if (pDist != NULL) {
+                pDist[n + 1] = best1 + plp_vq_norm_f32s_xpulpv2(pA1, dim);
+            }
+        }
+    }
+}
+
+/**
+   @} end of vqKernels group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vq_nearest_i16p_xpulpv2.c
+ * Description:  16-bit integer parallel nearest centroid search for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup vq
+*/
+
+/**
+   @addtogroup vqKernels
+   @{
+*/
+
+/**
+   @brief      Parallel nearest centroid search of 16-bit integer vectors kernel for XPULPV2
+               extension.
+   @param[in]  args  points to the plp_vq_nearest_instance_i16 struct initialized by the glue code
+   @return     none
+
+   @par
+   Every core searches the nearest centroids of a contiguous chunk of the query vectors. The cores
+   only read the shared codebook, so they need no synchronization.
+*/
+
+void plp_vq_nearest_i16p_xpulpv2(void *args) {
+
+    plp_vq_nearest_instance_i16 *S = (plp_vq_nearest_instance_i16 *)args;
+    uint32_t dim = S->dim;
+    uint32_t start, end;
+
+    plp_stats_parallel_range(S->numVectors, 2, S->nPE, plp_core_id(), &start, &end);
+
+    if (start < end) {
+        plp_vq_nearest_i16s_xpulpv2(S->pSrc + start * dim,
+                                   end - start,
+                                   S->pCodebook,
+                                   S->numCentroids,
+                                   dim,
+                                   S->pNorms,
+                                   S->pIdx + start,
+                                   (S->pDist != NULL) ? S->pDist + start : NULL);
+    }
+}
+
+/**
+   @} end of vqKernels group
+*/
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_f32_parallel.c
+ * Description:  Parallel row-wise cell averaging CFAR detection glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup cfar
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel row-wise cell averaging CFAR detection of a 32-bit
+         floating-point matrix.
+  @param[in]  pSrc       points to the input matrix, one vector per row
+  @param[in]  numRows    number of rows of the matrix
+  @param[in]  numCols    number of columns of the matrix
+  @param[in]  nGuard     number of guard cells on each side of the cell under test
+  @param[in]  nTrain     number of training cells on each side, must be larger than 0
+  @param[in]  scale      threshold factor
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                         0 otherwise
+  @return     none
+ */
+
+void plp_cfar_ca_f32_parallel(const float32_t *pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t nGuard,
+                              uint32_t nTrain,
+                              float32_t scale,
+                              uint32_t nPE,
+                              uint8_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_cfar_ca_f32_parallel), numRows * numCols);
+        }
+
+        plp_cfar_ca_instance_f32 S = { .pSrc = pSrc,
+                                       .numRows = numRows,
+                                       .numCols = numCols,
+                                       .nGuard = nGuard,
+                                       .nTrain = nTrain,
+                                       .scale = scale,
+                                       .nPE = nPE,
+                                       .pDst = pDst };
+
+        rt_team_fork(nPE, plp_cfar_ca_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of cfar group
+ */
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_q16.c
+ * Description:  Row-wise cell averaging CFAR detection glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup cfar CFAR Detection
+  Constant false alarm rate (CFAR) detection compares every cell of a vector, e.g. the range cells
+  of one Doppler bin of a radar range-Doppler map, with a threshold which follows the local noise
+  level:
+  <pre>
+      pDst[n] = pSrc[n] > scale * Z[n]
+  </pre>
+  The noise estimate Z[n] is computed from the nTrain training cells on either side of the cell
+  under test, separated from it by nGuard guard cells, such that a target does not raise its own
+  threshold. Cell averaging (CA) CFAR uses the mean of the training cells, ordered statistic (OS)
+  CFAR the rank-th smallest training cell, which is robust against other targets in the training
+  cells. At the borders, only the training cells inside the vector are used.
+
+  The training windows slide along the vector: every cell adds one training cell to each window
+  and removes one, such that the cost per cell does not depend on the window length for CA-CFAR,
+  and the training cells of OS-CFAR are kept sorted instead of being sorted for every cell. The
+  functions process every row of a matrix, the parallel versions distribute the rows over the
+  cores.
+ */
+
+/**
+  @addtogroup cfar
+  @{
+ */
+
+/**
+  @brief Glue code for the row-wise cell averaging CFAR detection of a 16-bit fixed point matrix.
+  @param[in]  pSrc       points to the input matrix, one vector per row
+  @param[in]  numRows    number of rows of the matrix
+  @param[in]  numCols    number of columns of the matrix
+  @param[in]  nGuard     number of guard cells on each side of the cell under test
+  @param[in]  nTrain     number of training cells on each side, must be larger than 0
+  @param[in]  scale      threshold factor, in Q(32-deciPoint).deciPoint
+  @param[in]  deciPoint  number of fractional bits of scale
+  @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                         0 otherwise
+  @return     none
+ */
+
+void plp_cfar_ca_q16(const int16_t *pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t nGuard,
+                     uint32_t nTrain,
+                     int32_t scale,
+                     uint32_t deciPoint,
+                     uint8_t *pDst) {
+
+    uint32_t m;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (m = 0; m < numRows; m++) {
+            plp_cfar_ca_q16s_rv32im(pSrc + m * numCols, numCols, nGuard, nTrain, scale, deciPoint,
+                                    pDst + m * numCols);
+        }
+    } else {
+        for (m = 0; m < numRows; m++) {
+            plp_cfar_ca_q16s_xpulpv2(pSrc + m * numCols, numCols, nGuard, nTrain, scale, deciPoint,
+                                     pDst + m * numCols);
+        }
+    }
+}
+
+/**
+  @} end of cfar group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_os_f32.c
+ * Description:  Row-wise ordered statistic CFAR detection glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup cfar
+  @{
+ */
+
+/**
+  @brief Glue code for the row-wise ordered statistic CFAR detection of a 32-bit floating-point
+         matrix.
+  @param[in]  pSrc       points to the input matrix, one vector per row
+  @param[in]  numRows    number of rows of the matrix
+  @param[in]  numCols    number of columns of the matrix
+  @param[in]  nGuard     number of guard cells on each side of the cell under test
+  @param[in]  nTrain     number of training cells on each side, must be larger than 0
+  @param[in]  rank       rank of the noise estimate among the 2 * nTrain training cells, from 1
+                         (smallest) to 2 * nTrain
+  @param[in]  scale      threshold factor
+  @param[out] pTmp       scratch buffer with 2 * nTrain entries
+  @param[out] pDst       points to the output map of shape numRows x numCols, 1 for detected cells,
+                         0 otherwise
+  @return     none
+
+  @par
+  The same scratch buffer is used for all rows.
+ */
+
+void plp_cfar_os_f32(const float32_t *pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t nGuard,
+                     uint32_t nTrain,
+                     uint32_t rank,
+                     float32_t scale,
+                     float32_t *pTmp,
+                     uint8_t *pDst) {
+
+    uint32_t m;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        for (m = 0; m < numRows; m++) {
+            plp_cfar_os_f32s_xpulpv2(pSrc + m * numCols, numCols, nGuard, nTrain, rank, scale, pTmp,
+                                     pDst + m * numCols);
+        }
+    }
+}
+
+/**
+  @} end of cfar group
+ */
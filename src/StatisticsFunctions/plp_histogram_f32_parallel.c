@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_f32_parallel.c
+ * Description:  Parallel histogram of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup histogram
+   @{
+*/
+
+/**
+   @brief      Glue code for the parallel histogram of a 32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  minValue   lower edge of the first bin
+   @param[in]  binWidth   width of the bins, must be larger than 0
+   @param[in]  nBins      number of bins, must be larger than 0
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pTmp       scratch buffer for the private bins of the cores, (nPE - 1) * nBins entries
+   @param[out] pHist      histogram with nBins entries, overwritten
+   @return     none
+
+   @par
+   Core 0 counts its chunk directly in pHist, all other cores count their chunk in their own slice
+   of pTmp. After a barrier, every core sums up the private counts of a slice of the bins.
+*/
+
+void plp_histogram_f32_parallel(const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                float32_t minValue,
+                                float32_t binWidth,
+                                uint32_t nBins,
+                                uint32_t nPE,
+                                uint32_t *__restrict__ pTmp,
+                                uint32_t *__restrict__ pHist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_histogram_f32_parallel), blockSize);
+        }
+
+        plp_histogram_instance_f32 S = { .pSrc = pSrc,
+                                         .blockSize = blockSize,
+                                         .minValue = minValue,
+                                         .binWidth = binWidth,
+                                         .nBins = nBins,
+                                         .nPE = nPE,
+                                         .pTmp = pTmp,
+                                         .pHist = pHist };
+
+        rt_team_fork(nPE, plp_histogram_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of histogram group
+*/
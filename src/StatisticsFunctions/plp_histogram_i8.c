@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i8.c
+ * Description:  Histogram of a 8-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup histogram Histogram
+   Counts the samples of a vector in nBins bins of equal width. Bin i counts the samples in
+   [minValue + i * width, minValue + (i + 1) * width). For the integer versions, the bin width is
+   a power of two (1 << binShift), such that the bin of a sample is found with a shift instead of a
+   division. Samples below minValue are counted in the first bin, and samples beyond the last bin
+   are counted in the last bin. Hence, the histogram always accounts for all samples, and its
+   cumulative sum is the number of samples smaller than the upper edge of each bin (see
+   plp_percentile).
+
+   The parallel versions let every core count its chunk of the vector in private bins, which avoids
+   contended read-modify-write accesses to shared bins. The private histograms are merged at the
+   end, with every core summing up a slice of the bins.
+*/
+
+/**
+   @addtogroup histogram
+   @{
+*/
+
+/**
+   @brief      Glue code for the histogram of a 8-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  minValue   lower edge of the first bin
+   @param[in]  binShift   width of the bins is 1 << binShift
+   @param[in]  nBins      number of bins, must be larger than 0
+   @param[out] pHist      histogram with nBins entries, overwritten
+   @return     none
+*/
+
+void plp_histogram_i8(const int8_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      int8_t minValue,
+                      uint32_t binShift,
+                      uint32_t nBins,
+                      uint32_t *__restrict__ pHist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_histogram_i8s_rv32im(pSrc, blockSize, minValue, binShift, nBins, pHist);
+    } else {
+        plp_histogram_i8s_xpulpv2(pSrc, blockSize, minValue, binShift, nBins, pHist);
+    }
+}
+
+/**
+   @} end of histogram group
+*/
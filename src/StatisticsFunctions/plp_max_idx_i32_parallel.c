@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_idx_i32_parallel.c
+ * Description:  Glue code for the parallel maximum value and its index of a 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup maxIdx
+   @{
+*/
+
+/**
+   @brief      Glue code for the parallel maximum value and its index of a 32-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pRes       maximum value returned here
+   @param[out] pIndex     index of the first occurrence of the maximum returned here
+   @return     none
+
+   @par
+   Every core searches a contiguous chunk of the vector. The results of the cores are combined in
+   the order of the cores, such that the first occurrence of the maximum is returned.
+*/
+
+void plp_max_idx_i32_parallel(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes,
+                              uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_max_idx_i32_parallel), blockSize);
+        }
+
+        int32_t valueBuffer[nPE];
+        uint32_t indexBuffer[nPE];
+        uint32_t i;
+        plp_stats_idx_instance_i32 S = { .pSrc = pSrc,
+                                         .blockSize = blockSize,
+                                         .nPE = nPE,
+                                         .pValue = valueBuffer,
+                                         .pIndex = indexBuffer };
+
+        rt_team_fork(nPE, plp_max_idx_i32p_xpulpv2, (void *)&S);
+
+        *pRes = valueBuffer[0];
+        *pIndex = indexBuffer[0];
+        for (i = 1; i < nPE; i++) {
+            if (valueBuffer[i] > *pRes) {
+                *pRes = valueBuffer[i];
+                *pIndex = indexBuffer[i];
+            }
+        }
+    }
+}
+
+/**
+   @} end of maxIdx group
+*/
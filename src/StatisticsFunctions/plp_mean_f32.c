@@ -54,7 +54,11 @@
 void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
+#if defined(PLP_FC_FIXED_POINT)
+        plp_mean_f32s_rv32im(pSrc, blockSize, pRes);
+#else
         *pRes = -1;
+#endif
     } else {
         plp_mean_f32s_xpulpv2(pSrc, blockSize, pRes);
     }
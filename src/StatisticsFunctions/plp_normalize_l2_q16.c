@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_q16.c
+ * Description:  L2 normalization of a vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup normalizeL2 L2 Normalization
+  Scales a vector to unit Euclidean length:
+  <pre>
+      pDst[n] = pSrc[n] / sqrt(pSrc[0]^2 + ... + pSrc[blockSize - 1]^2),   0 <= n < blockSize.
+  </pre>
+  The sum of squares, the inverse square root and the scaling are fused into one call, which reads
+  the vector twice and needs no division and no temporary buffer. The row-wise versions normalize
+  every row of a matrix, e.g. a batch of embeddings. A vector of zeros results in zeros.
+ */
+
+/**
+  @addtogroup normalizeL2
+  @{
+ */
+
+/**
+  @brief Glue code for the L2 normalization of a 16-bit fixed point vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, in Q1.15, may be equal to pSrc
+  @return     none
+
+  @par
+  The input may be in any fixed point format, the output is the unit vector in Q1.15, accurate to
+  one least significant bit. The sum of squares is accumulated in 64 bit, such that it cannot
+  overflow.
+ */
+
+void plp_normalize_l2_q16(const int16_t *pSrc,
+                          uint32_t blockSize,
+                          int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_normalize_l2_q16s_rv32im(pSrc, blockSize, pDst);
+    } else {
+        plp_normalize_l2_q16s_xpulpv2(pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of normalizeL2 group
+ */
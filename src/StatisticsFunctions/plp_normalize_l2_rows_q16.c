@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_rows_q16.c
+ * Description:  Row-wise L2 normalization of a matrix glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup normalizeL2
+  @{
+ */
+
+/**
+  @brief Glue code for the row-wise L2 normalization of a 16-bit fixed point matrix.
+  @param[in]  pSrc       points to the input matrix, one vector per row
+  @param[in]  numRows    number of rows of the matrix
+  @param[in]  numCols    number of columns of the matrix
+  @param[out] pDst       points to the output matrix, in Q1.15, may be equal to pSrc
+  @return     none
+
+  @par
+  Every row is normalized like with plp_normalize_l2_q16, but the FC/cluster dispatch happens once
+  per matrix.
+ */
+
+void plp_normalize_l2_rows_q16(const int16_t *pSrc,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               int16_t *pDst) {
+
+    uint32_t m;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (m = 0; m < numRows; m++) {
+            plp_normalize_l2_q16s_rv32im(pSrc + m * numCols, numCols, pDst + m * numCols);
+        }
+    } else {
+        for (m = 0; m < numRows; m++) {
+            plp_normalize_l2_q16s_xpulpv2(pSrc + m * numCols, numCols, pDst + m * numCols);
+        }
+    }
+}
+
+/**
+  @} end of normalizeL2 group
+ */
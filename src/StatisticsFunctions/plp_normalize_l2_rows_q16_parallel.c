@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_rows_q16_parallel.c
+ * Description:  Parallel row-wise L2 normalization glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup normalizeL2
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel row-wise L2 normalization of a 16-bit fixed point matrix.
+  @param[in]  pSrc       points to the input matrix, one vector per row
+  @param[in]  numRows    number of rows of the matrix
+  @param[in]  numCols    number of columns of the matrix
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output matrix, in Q1.15, may be equal to pSrc
+  @return     none
+
+  @par
+  The rows are distributed over the cores, such that every row is normalized by a single core and
+  stays in its registers and the L1 memory. The results are identical to the ones of
+  plp_normalize_l2_rows_q16.
+ */
+
+void plp_normalize_l2_rows_q16_parallel(const int16_t *pSrc,
+                                        uint32_t numRows,
+                                        uint32_t numCols,
+                                        uint32_t nPE,
+                                        int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_normalize_l2_rows_q16_parallel), numRows * numCols);
+        }
+
+        plp_normalize_l2_rows_instance_q16 S = { .pSrc = pSrc,
+                                                 .numRows = numRows,
+                                                 .numCols = numCols,
+                                                 .nPE = nPE,
+                                                 .pDst = pDst };
+
+        rt_team_fork(nPE, plp_normalize_l2_rows_q16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of normalizeL2 group
+ */
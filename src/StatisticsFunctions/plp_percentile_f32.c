@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_f32.c
+ * Description:  Percentile of a 32-bit float vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief      Percentile of a 32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[in]  percent    percentile to compute, between 0 and 100
+   @param[out] pTmp       scratch buffer with PLP_PERCENTILE_BINS entries
+   @param[out] pRes       percentile returned here
+   @return     none
+*/
+
+void plp_percentile_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t percent,
+                        uint32_t *__restrict__ pTmp,
+                        float32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t rank = (percent * (blockSize - 1)) / 100;
+        uint32_t count, bin, pass, i;
+        float32_t lower, upper, width, res;
+
+        plp_min_f32(pSrc, blockSize, &lower);
+        plp_max_f32(pSrc, blockSize, &upper);
+        res = upper;
+
+        for (pass = 0; pass < 3; pass++) {
+            width = (upper - lower) * (1.0f / PLP_PERCENTILE_BINS);
+            if (width <= 0.0f) {
+                break;
+            }
+            // samples below lower are counted in the first bin, hence the cumulative sum is the
+            // rank in the whole vector.
+            plp_histogram_f32(pSrc, blockSize, lower, width, PLP_PERCENTILE_BINS, pTmp);
+            count = 0;
+            for (bin = 0; bin < PLP_PERCENTILE_BINS - 1; bin++) {
+                count += pTmp[bin];
+                if (count > rank) {
+                    break;
+                }
+            }
+            lower = lower + (float32_t)bin * width;
+            upper = lower + width;
+        }
+
+        for (i = 0; i < blockSize; i++) {
+            if (pSrc[i] >= lower && pSrc[i] < res) {
+                res = pSrc[i];
+            }
+        }
+
+        *pRes = res;
+    }
+}
+
+/**
+   @} end of percentile group
+*/
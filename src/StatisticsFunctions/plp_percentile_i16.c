@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i16.c
+ * Description:  Percentile of a 16-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief      Percentile of a 16-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[in]  percent    percentile to compute, between 0 and 100
+   @param[out] pTmp       scratch buffer with PLP_PERCENTILE_BINS entries
+   @param[out] pRes       percentile returned here
+   @return     none
+*/
+
+void plp_percentile_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t percent,
+                        uint32_t *__restrict__ pTmp,
+                        int16_t *__restrict__ pRes) {
+
+    uint32_t rank = (percent * (blockSize - 1)) / 100;
+    uint32_t count, bin;
+    int32_t lower;
+
+    // count the samples per upper byte
+    plp_histogram_i16(pSrc, blockSize, INT16_MIN, 8, PLP_PERCENTILE_BINS, pTmp);
+    count = 0;
+    for (bin = 0; bin < PLP_PERCENTILE_BINS - 1; bin++) {
+        count += pTmp[bin];
+        if (count > rank) {
+            break;
+        }
+    }
+
+    // count the samples of the selected upper byte per value. All samples below are counted in the
+    // first bin, hence the cumulative sum is again the rank in the whole vector.
+    lower = INT16_MIN + (int32_t)(bin << 8);
+    plp_histogram_i16(pSrc, blockSize, (int16_t)lower, 0, PLP_PERCENTILE_BINS, pTmp);
+    count = 0;
+    for (bin = 0; bin < PLP_PERCENTILE_BINS - 1; bin++) {
+        count += pTmp[bin];
+        if (count > rank) {
+            break;
+        }
+    }
+
+    *pRes = (int16_t)(lower + (int32_t)bin);
+}
+
+/**
+   @} end of percentile group
+*/
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i8.c
+ * Description:  Percentile of a 8-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup percentile Percentile
+   Computes the p-th percentile of a vector without sorting it. The result is the sample with rank
+   (p * (blockSize - 1)) / 100 (rounded down) in ascending order, e.g. p = 50 returns the (lower)
+   median and p = 100 returns the maximum.
+
+   The rank is located in the cumulative sum of a histogram with PLP_PERCENTILE_BINS bins. The 8-bit
+   version needs a single histogram with one bin per value. The 16-bit version first counts the
+   samples per upper byte, and then counts the samples of the selected upper byte per value. Both
+   results are exact. The floating point version refines the range between the minimum and the
+   maximum of the vector three times by a factor of PLP_PERCENTILE_BINS, and returns the smallest
+   sample in the final range, which is accurate to (max - min) / 2^24.
+
+   The caller provides a scratch buffer with PLP_PERCENTILE_BINS entries for the histogram.
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief      Percentile of a 8-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[in]  percent    percentile to compute, between 0 and 100
+   @param[out] pTmp       scratch buffer with PLP_PERCENTILE_BINS entries
+   @param[out] pRes       percentile returned here
+   @return     none
+*/
+
+void plp_percentile_i8(const int8_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       uint32_t percent,
+                       uint32_t *__restrict__ pTmp,
+                       int8_t *__restrict__ pRes) {
+
+    uint32_t rank = (percent * (blockSize - 1)) / 100;
+    uint32_t count, bin;
+
+    plp_histogram_i8(pSrc, blockSize, INT8_MIN, 0, PLP_PERCENTILE_BINS, pTmp);
+    count = 0;
+    for (bin = 0; bin < PLP_PERCENTILE_BINS - 1; bin++) {
+        count += pTmp[bin];
+        if (count > rank) {
+            break;
+        }
+    }
+
+    *pRes = (int8_t)(INT8_MIN + (int32_t)bin);
+}
+
+/**
+   @} end of percentile group
+*/
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_power64_i32.c
+ * Description:  Glue code for the 64-bit sum of squares of a 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup power
+   @{
+*/
+
+/**
+   @brief         Glue code for the 64-bit sum of squares of a 32-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       sum of squares returned here
+   @return        none
+
+   @par
+   Every square is accumulated in 64 bits (mul and mulh), such that long vectors can be processed in a
+   single call. The sum is only limited by the magnitude of the samples: with
+   samples below 2^b in magnitude, up to 2^(63 - 2b) samples can be accumulated.
+*/
+
+void plp_power64_i32(const int32_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int64_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_power64_i32s_rv32im(pSrc, blockSize, pRes);
+    } else {
+        plp_power64_i32s_xpulpv2(pSrc, blockSize, pRes);
+    }
+}
+
+/**
+   @} end of power group
+*/
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_power_i16_hetero.c
+ * Description:  Glue code for the heterogeneous sum of squares of a 16-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup power
+   @{
+*/
+
+/* runs on the master core of the cluster */
+static void plp_power_i16_hetero_entry(void *args) {
+
+    plp_stats_instance_i16 *S = (plp_stats_instance_i16 *)args;
+
+    plp_power_i16_parallel(S->pSrc, S->blockSize, S->nPE, S->resBuffer);
+}
+
+/**
+   @brief      Glue code for the sum of squares of a 16-bit integer vector, which is split
+               between the cluster and the fabric controller.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of cluster cores, or PLP_AUTO
+   @param[in]  fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+   @param[out] pRes       sum of squares returned here
+   @return     none
+
+   @par
+   The result is identical to the one of plp_power_i16.
+*/
+
+void plp_power_i16_hetero(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          uint32_t fcShare,
+                          int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("heterogeneous execution supported only for fabric controller side\n");
+        return;
+    }
+
+    uint32_t clusterSize = plp_hetero_split(blockSize, fcShare);
+    int32_t clusterRes = 0;
+    int32_t fcRes = 0;
+    plp_async_handle handle;
+    handle.event = NULL;
+
+    if (clusterSize > 0) {
+        plp_stats_instance_i16 *S = (plp_stats_instance_i16 *)handle.args;
+
+        S->pSrc = pSrc;
+        S->blockSize = clusterSize;
+        S->fracBits = 0;
+        S->nPE = nPE;
+        S->resBuffer = &clusterRes;
+
+        plp_async_call(plp_power_i16_hetero_entry, (void *)S, &handle);
+    }
+
+    if (clusterSize < blockSize) {
+        plp_power_i16s_rv32im(pSrc + clusterSize, blockSize - clusterSize, &fcRes);
+    }
+
+    plp_async_wait(&handle);
+
+    *pRes = clusterRes + fcRes;
+}
+
+/**
+   @} end of power group
+*/
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rms_interleaved_q16.c
+ * Description:  RMS value of every channel of an interleaved buffer glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup power
+  @{
+ */
+
+/**
+  @brief Glue code for RMS value of every channel of an interleaved 16-bit fixed point buffer.
+  @param[in]  pSrc       points to the interleaved input buffer (blockSize x nChannels)
+  @param[in]  nChannels  number of interleaved channels
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  fracBits   decimal point of the input
+  @param[out] pRes       RMS values of the channels (nChannels) returned here
+  @return     none
+
+  @par
+  Sample n of channel c is pSrc[n * nChannels + c], e.g. a stream of multi-channel audio frames.
+  The results of all channels are computed in one call without deinterleaving the buffer, and are
+  identical to the ones of plp_rms_q16 on every deinterleaved channel. With one channel, the
+  contiguous kernels of plp_rms_q16 are used instead.
+ */
+
+void plp_rms_interleaved_q16(const int16_t *__restrict__ pSrc,
+                             uint32_t nChannels,
+                             uint32_t blockSize,
+                             uint32_t fracBits,
+                             int16_t *__restrict__ pRes) {
+
+    if (nChannels == 1) {
+        plp_rms_q16(pSrc, blockSize, fracBits, pRes);
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_rms_interleaved_q16s_rv32im(pSrc, nChannels, blockSize, fracBits, pRes);
+    } else {
+        plp_rms_interleaved_q16s_xpulpv2(pSrc, nChannels, blockSize, fracBits, pRes);
+    }
+}
+
+/**
+  @} end of power group
+ */
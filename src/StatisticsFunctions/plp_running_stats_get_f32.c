@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_get_f32.c
+ * Description:  Results of the floating point running statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Reads the mean and the variance from the floating point running statistics.
+   @param[in]  S      points to the running statistics instance
+   @param[out] pMean  mean of all samples seen so far, may be NULL
+   @param[out] pVar   variance of all samples seen so far, may be NULL
+   @return     none
+
+   @par
+   The variance is the population variance (divided by the number of samples), like plp_var_f32.
+   Both results are 0 if no sample was seen yet.
+*/
+
+void plp_running_stats_get_f32(const plp_running_stats_instance_f32 *S,
+                               float32_t *pMean,
+                               float32_t *pVar) {
+
+    if (pMean != NULL) {
+        *pMean = S->mean;
+    }
+    if (pVar != NULL) {
+        *pVar = (S->count > 0) ? S->m2 / S->count : 0.0f;
+    }
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_init_f32.c
+ * Description:  Initialization of the floating point running statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup runningStats Running Statistics
+   Stateful statistics, which are updated block by block instead of recomputing them over the
+   whole signal.
+
+   The running statistics (plp_running_stats_*) accumulate the mean and the variance of all samples
+   seen so far. Every block is summarized with plp_mean and plp_power, and merged into the state
+   with the pairwise update of Welford's algorithm (Chan et al.), such that the state never holds
+   large sums that cancel.
+
+   The sliding statistics (plp_sliding_stats_*) keep the sum and the sum of squares of a sliding
+   window. Every update adds the samples of the new hop and removes the samples leaving the window,
+   hence the cost of an update only depends on the hop size, not on the window size. The caller
+   keeps the window in its own buffer and passes the samples that leave the window (or NULL while
+   the window is still being filled). The fixed point sums are exact, while the floating point sums
+   can accumulate rounding errors over very long streams; call plp_sliding_stats_init_f32 and feed
+   the current window again to resynchronize.
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Resets the floating point running statistics.
+   @param[out] S  points to the running statistics instance
+   @return     none
+*/
+
+void plp_running_stats_init_f32(plp_running_stats_instance_f32 *S) {
+    S->count = 0;
+    S->mean = 0.0f;
+    S->m2 = 0.0f;
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_update_f32.c
+ * Description:  Block update of the floating point running statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Merges a block of samples into the floating point running statistics.
+   @param[in,out] S          points to the running statistics instance
+   @param[in]     pSrc       points to the new block of samples
+   @param[in]     blockSize  number of samples in the new block
+   @return        none
+
+   @par
+   The mean and the sum of squares of the block are computed with plp_mean_f32 and plp_power_f32.
+   The block is then merged into the state with:
+   <pre>
+   delta = meanB - mean
+   mean  = mean + delta * nB / (n + nB)
+   m2    = m2 + (powerB - nB * meanB^2) + delta^2 * n * nB / (n + nB)
+   n     = n + nB
+   </pre>
+*/
+
+void plp_running_stats_update_f32(plp_running_stats_instance_f32 *S,
+                                  const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+
+        float32_t meanB, powerB, delta;
+        float32_t nA = (float32_t)S->count;
+        float32_t nB = (float32_t)blockSize;
+        float32_t n = nA + nB;
+
+        if (blockSize == 0) {
+            return;
+        }
+
+        plp_mean_f32(pSrc, blockSize, &meanB);
+        plp_power_f32(pSrc, blockSize, &powerB);
+
+        delta = meanB - S->mean;
+        S->mean += delta * nB / n;
+        S->m2 += (powerB - nB * meanB * meanB) + delta * delta * nA * nB / n;
+        S->count += blockSize;
+    }
+}
+
+/**
+   @} end of runningStats group
+*/
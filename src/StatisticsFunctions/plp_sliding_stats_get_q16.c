@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sliding_stats_get_q16.c
+ * Description:  Results of the fixed point sliding statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Reads the mean, the variance and the rms value of the current window.
+   @param[in]  S      points to the sliding statistics instance
+   @param[out] pMean  mean value of the window, may be NULL
+   @param[out] pVar   variance of the window, may be NULL
+   @param[out] pRms   rms value of the window, may be NULL
+   @return     none
+
+   @par
+   The results are computed like plp_mean_i16, plp_var_q16 and plp_rms_q16 of the samples in the window. All results
+   are 0 for an empty window.
+*/
+
+void plp_sliding_stats_get_q16(const plp_sliding_stats_instance_q16 *S,
+                               int16_t *pMean,
+                               int16_t *pVar,
+                               int16_t *pRms) {
+
+    int32_t mean = 0;
+    int32_t power = 0;
+
+    if (S->count > 0) {
+        mean = S->sum / (int32_t)S->count;
+        power = S->sumSq / (int32_t)S->count;
+    }
+
+    if (pMean != NULL) {
+        *pMean = mean;
+    }
+    if (pVar != NULL) {
+        *pVar = power - ((mean * mean) >> S->fracBits);
+    }
+    if (pRms != NULL) {
+        *pRms = power;
+    }
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,57 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sliding_stats_init_q16.c
+ * Description:  Initialization of the fixed point sliding statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Resets the 16-bit fixed point sliding statistics to an empty window.
+   @param[out] S         points to the sliding statistics instance
+   @param[in]  fracBits  decimal point of the samples
+   @return     none
+*/
+
+void plp_sliding_stats_init_q16(plp_sliding_stats_instance_q16 *S,
+                                uint32_t fracBits) {
+    S->count = 0;
+    S->fracBits = fracBits;
+    S->sum = 0;
+    S->sumSq = 0;
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sliding_stats_update_f32.c
+ * Description:  Hop update of the floating point sliding statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Adds a hop of samples to the floating point sliding statistics, and removes the samples
+               leaving the window.
+   @param[in,out] S        points to the sliding statistics instance
+   @param[in]     pNew     points to the samples entering the window
+   @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+   @param[in]     hopSize  number of samples in pNew (and pOld)
+   @return        none
+
+   @par
+   The hops are summarized with plp_mean_f32 and plp_power_f32.
+*/
+
+void plp_sliding_stats_update_f32(plp_sliding_stats_instance_f32 *S,
+                                  const float32_t *__restrict__ pNew,
+                                  const float32_t *__restrict__ pOld,
+                                  uint32_t hopSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+
+        float32_t mean, power;
+
+        if (hopSize == 0) {
+            return;
+        }
+
+        plp_mean_f32(pNew, hopSize, &mean);
+        plp_power_f32(pNew, hopSize, &power);
+        S->sum += mean * hopSize;
+        S->sumSq += power;
+        S->count += hopSize;
+
+        if (pOld != NULL) {
+            plp_mean_f32(pOld, hopSize, &mean);
+            plp_power_f32(pOld, hopSize, &power);
+            S->sum -= mean * hopSize;
+            S->sumSq -= power;
+            S->count -= hopSize;
+        }
+    }
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sliding_stats_update_q16.c
+ * Description:  Hop update of the fixed point sliding statistics glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief      Glue code for adding a hop of samples to the 16-bit fixed point sliding statistics, and
+               removing the samples leaving the window.
+   @param[in,out] S        points to the sliding statistics instance
+   @param[in]     pNew     points to the samples entering the window
+   @param[in]     pOld     points to the samples leaving the window, or NULL if the window grows
+   @param[in]     hopSize  number of samples in pNew (and pOld)
+   @return        none
+
+   @par
+   The square of every sample is shifted right by fracBits before accumulating it, like in
+   plp_power_q16, such that the state matches plp_power_q16 of the window.
+*/
+
+void plp_sliding_stats_update_q16(plp_sliding_stats_instance_q16 *S,
+                                  const int16_t *__restrict__ pNew,
+                                  const int16_t *__restrict__ pOld,
+                                  uint32_t hopSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sliding_stats_update_q16s_rv32im(S, pNew, pOld, hopSize);
+    } else {
+        plp_sliding_stats_update_q16s_xpulpv2(S, pNew, pOld, hopSize);
+    }
+}
+
+/**
+   @} end of runningStats group
+*/
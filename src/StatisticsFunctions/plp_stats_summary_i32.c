@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_summary_i32.c
+ * Description:  Single pass summary statistics of a 32-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup statsSummary Statistics Summary
+   Computes the mean, the variance, the minimum and the maximum (including their index) of a vector
+   in a single pass over the data, instead of calling plp_mean, plp_var, plp_min and plp_max one
+   after another.
+
+   The variance is computed as E[x^2] - E[x]^2. For integer vectors, the mean is truncated towards
+   zero, and the variance is computed from the truncated mean. The sum of squares is accumulated
+   into 32 bits, like in plp_power. For fixed point inputs, the mean is in the format of the input,
+   while the variance is in the format of the squared input (2 * fracBits), and can be shifted by
+   the caller. If the minimum or maximum occurs multiple times, the index of the first occurrence is
+   returned.
+*/
+
+/**
+   @addtogroup statsSummary
+   @{
+*/
+
+/**
+   @brief      Glue code for the summary statistics of a 32-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+   @return     none
+*/
+
+void plp_stats_summary_i32(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_summary_result_i32 *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_stats_summary_i32s_rv32im(pSrc, blockSize, pRes);
+    } else {
+        plp_stats_summary_i32s_xpulpv2(pSrc, blockSize, pRes);
+    }
+}
+
+/**
+   @} end of statsSummary group
+*/
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_summary_i32_parallel.c
+ * Description:  Parallel single pass summary statistics of a 32-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup statsSummary
+   @{
+*/
+
+/**
+   @brief      Glue code for the parallel summary statistics of a 32-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector, must be larger than 0
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pRes       mean, variance, minimum and maximum with their index returned here
+   @return     none
+
+   @par
+   Every core sweeps a contiguous chunk of the vector once, and the partial results are combined
+   by plp_stats_summary_combine_i32.
+*/
+
+void plp_stats_summary_i32_parallel(const int32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t nPE,
+                                    plp_stats_summary_result_i32 *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_stats_summary_i32_parallel), blockSize);
+        }
+
+        plp_stats_partial_i32 partial[nPE];
+        plp_stats_summary_instance_i32 S = { .pSrc = pSrc,
+                                             .blockSize = blockSize,
+                                             .nPE = nPE,
+                                             .pPartial = partial };
+
+        rt_team_fork(nPE, plp_stats_summary_i32p_xpulpv2, (void *)&S);
+
+        plp_stats_summary_combine_i32(partial, nPE, blockSize, pRes);
+    }
+}
+
+/**
+   @} end of statsSummary group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var64_q32.c
+ * Description:  Glue code for the variance of a 32-bit fixed point vector with 64-bit accumulation
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup var
+   @{
+*/
+
+/**
+   @brief         Glue code for the variance of a 32-bit fixed point vector with 64-bit accumulation.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   decimal point for right shift
+   @param[out]    pRes       variance returned here, saturated to 32 bits
+   @return        none
+
+   @par
+   The sum and the sum of squares are accumulated in 64 bits in a single pass, hence the result is
+   not limited by the block size. It is equal to the result of plp_var_q32, as long as the 32-bit
+   sums of plp_var_q32 do not overflow.
+*/
+
+void plp_var64_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_var64_q32s_rv32im(pSrc, blockSize, fracBits, pRes);
+    } else {
+        plp_var64_q32s_xpulpv2(pSrc, blockSize, fracBits, pRes);
+    }
+}
+
+/**
+   @} end of var group
+*/
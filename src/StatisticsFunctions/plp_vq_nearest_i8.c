@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vq_nearest_i8.c
+ * Description:  8-bit integer nearest centroid search glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup vq
+   @{
+*/
+
+/**
+   @brief      Glue code for the nearest centroid search of 8-bit integer vectors.
+   @param[in]  pSrc          points to the query vectors, numVectors x dim, row-major
+   @param[in]  numVectors    number of query vectors
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids, must be larger than 0
+   @param[in]  dim           number of elements of every vector
+   @param[in]  pNorms        points to the squared norms of the centroids (plp_vq_norms_i8)
+   @param[out] pIdx          index of the nearest centroid of every query vector
+   @param[out] pDist         squared distance to the nearest centroid of every query vector, or
+                             NULL
+   @return     none
+*/
+
+void plp_vq_nearest_i8(const int8_t *__restrict__ pSrc,
+                       uint32_t numVectors,
+                       const int8_t *__restrict__ pCodebook,
+                       uint32_t numCentroids,
+                       uint32_t dim,
+                       const int32_t *__restrict__ pNorms,
+                       uint32_t *__restrict__ pIdx,
+                       int32_t *__restrict__ pDist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_vq_nearest_i8s_rv32im(pSrc,
+                                  numVectors,
+                                  pCodebook,
+                                  numCentroids,
+                                  dim,
+                                  pNorms,
+                                  pIdx,
+                                  pDist);
+    } else {
+        plp_vq_nearest_i8s_xpulpv2(pSrc,
+                                   numVectors,
+                                   pCodebook,
+                                   numCentroids,
+                                   dim,
+                                   pNorms,
+                                   pIdx,
+                                   pDist);
+    }
+}
+
+/**
+   @} end of vq group
+*/
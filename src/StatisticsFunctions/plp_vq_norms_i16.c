@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vq_norms_i16.c
+ * Description:  16-bit integer codebook norms for vector quantization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup vq
+   @{
+*/
+
+/**
+   @brief      Squared norms of the centroids of a 16-bit integer codebook.
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids
+   @param[in]  dim           number of elements of every centroid
+   @param[out] pNorms        squared norm of every centroid
+   @return     none
+*/
+
+void plp_vq_norms_i16(const int16_t *__restrict__ pCodebook,
+                      uint32_t numCentroids,
+                      uint32_t dim,
+                      int32_t *__restrict__ pNorms) {
+
+    uint32_t k;
+
+    for (k = 0; k < numCentroids; k++) {
+        plp_power_i16(pCodebook + k * dim, dim, pNorms + k);
+    }
+}
+
+/**
+   @} end of vq group
+*/
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vq_norms_i8.c
+ * Description:  8-bit integer codebook norms for vector quantization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup vq Vector Quantization
+   Finds the nearest centroid of a codebook for every query vector, e.g. to assign samples to
+   clusters or to encode vectors with a codebook. The squared L2 distance is expanded as
+   <pre>
+       ||a - b||^2 = ||a||^2 - 2 a.b + ||b||^2
+   </pre>
+   and the centroid which minimizes ||b||^2 - 2 a.b is selected, since ||a||^2 does not depend on
+   the centroid. The squared norms of the centroids are computed once with plp_vq_norms, and the
+   search reduces to the matrix product of the queries with the transposed codebook. The kernels
+   compute it in blocks of two queries and two centroids, such that every loaded element is used
+   twice, and keep the running minimum of both queries in registers instead of storing the
+   distance matrix.
+
+   The integer versions accumulate the dot products and distances in 32 bits, like
+   plp_dot_prod_i8 and plp_dot_prod_i16. For 16-bit inputs, the values must be small enough for
+   ||b||^2 to fit into 31 bits. Ties are resolved in favour of the centroid with the lower index.
+   The parallel versions distribute the query vectors over the cores.
+*/
+
+/**
+   @addtogroup vq
+   @{
+*/
+
+/**
+   @brief      Squared norms of the centroids of a 8-bit integer codebook.
+   @param[in]  pCodebook     points to the centroids, numCentroids x dim, row-major
+   @param[in]  numCentroids  number of centroids
+   @param[in]  dim           number of elements of every centroid
+   @param[out] pNorms        squared norm of every centroid
+   @return     none
+*/
+
+void plp_vq_norms_i8(const int8_t *__restrict__ pCodebook,
+                     uint32_t numCentroids,
+                     uint32_t dim,
+                     int32_t *__restrict__ pNorms) {
+
+    uint32_t k;
+
+    for (k = 0; k < numCentroids; k++) {
+        plp_power_i8(pCodebook + k * dim, dim, pNorms + k);
+    }
+}
+
+/**
+   @} end of vq group
+*/
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_bf16_to_f32s_xpulpv2.c
+ * Description:  Conversion of a bfloat16 to a 32-bit floating-point vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the conversion of a bfloat16 vector to a 32-bit floating-point vector
+                 for XPULPV2 extension. The conversion is exact.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Memory accesses
+  Two input values are loaded with a single word access.
+ */
+
+void plp_bf16_to_f32s_xpulpv2(const bfloat16_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const uint32_t *pS = (const uint32_t *)pSrc;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        uint32_t x = *pS++;
+        pDst[0] = plp_bf16_to_f32_inline((bfloat16_t)(x & 0xffffU));
+        pDst[1] = plp_bf16_to_f32_inline((bfloat16_t)(x >> 16));
+        pDst += 2;
+    }
+
+    pSrc = (const bfloat16_t *)pS;
+
+    for (blkCnt = 0; blkCnt < (blockSize & 1U); blkCnt++) {
+        *pDst++ = plp_bf16_to_f32_inline(*pSrc++);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_merge_f32s_xpulpv2.c
+ * Description:  Merging of real and imaginary 32-bit float parts into a complex vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the merging of real and imaginary 32-bit float parts into a complex
+                 vector for XPULPV2 extension.
+  @param[in]     pRe          points to the real parts
+  @param[in]     pIm          points to the imaginary parts
+  @param[out]    pDst         points to the interleaved complex output vector
+  @param[in]     numSamples   number of complex samples
+  @return        none
+ */
+
+void plp_cmplx_merge_f32s_xpulpv2(const float32_t *__restrict__ pRe,
+                                  const float32_t *__restrict__ pIm,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t numSamples) {
+
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        *pDst++ = *pRe++;
+        *pDst++ = *pIm++;
+        *pDst++ = *pRe++;
+        *pDst++ = *pIm++;
+    }
+
+    if (numSamples & 0x1U) {
+        *pDst++ = *pRe++;
+        *pDst++ = *pIm++;
+    }
+#else
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        *pDst++ = *pRe++;
+        *pDst++ = *pIm++;
+    }
+#endif // PLP_MATH_LOOPUNROLL
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_f32p_xpulpv2.c
+ * Description:  Parallel splitting of a complex 32-bit float vector into real and imaginary parts for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Parallel kernel for the splitting of a complex 32-bit float vector into real and
+                 imaginary parts for XPULPV2 extension.
+  @param[in]     args         points to the plp_cmplx_split_instance_f32 struct initialized by the
+                              glue code
+  @return        none
+ */
+
+void plp_cmplx_split_f32p_xpulpv2(void *args) {
+
+    plp_cmplx_split_instance_f32 *S = (plp_cmplx_split_instance_f32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start, end;
+
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    /* every core processes a contiguous chunk of the complex samples */
+    if (start < end) {
+        plp_cmplx_split_f32s_xpulpv2(S->pSrc + 2 * start, S->pRe + start, S->pIm + start,
+                                     end - start);
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
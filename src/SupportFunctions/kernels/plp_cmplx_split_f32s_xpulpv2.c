@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_f32s_xpulpv2.c
+ * Description:  Splitting of a complex 32-bit float vector into real and imaginary parts for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the splitting of a complex 32-bit float vector into real and imaginary
+                 parts for XPULPV2 extension.
+  @param[in]     pSrc         points to the interleaved complex input vector
+  @param[out]    pRe          points to the real parts
+  @param[out]    pIm          points to the imaginary parts
+  @param[in]     numSamples   number of complex samples
+  @return        none
+ */
+
+void plp_cmplx_split_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pRe,
+                                  float32_t *__restrict__ pIm,
+                                  uint32_t numSamples) {
+
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        *pRe++ = *pSrc++;
+        *pIm++ = *pSrc++;
+        *pRe++ = *pSrc++;
+        *pIm++ = *pSrc++;
+    }
+
+    if (numSamples & 0x1U) {
+        *pRe++ = *pSrc++;
+        *pIm++ = *pSrc++;
+    }
+#else
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        *pRe++ = *pSrc++;
+        *pIm++ = *pSrc++;
+    }
+#endif // PLP_MATH_LOOPUNROLL
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_i16s_xpulpv2.c
+ * Description:  Splitting of a complex 16-bit integer vector into real and imaginary parts for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the splitting of a complex 16-bit integer vector into real and imaginary
+                 parts for XPULPV2 extension.
+  @param[in]     pSrc         points to the interleaved complex input vector
+  @param[out]    pRe          points to the real parts
+  @param[out]    pIm          points to the imaginary parts
+  @param[in]     numSamples   number of complex samples
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Two complex samples are loaded at once and separated into two real and two imaginary parts with
+  two shuffles.
+ */
+
+void plp_cmplx_split_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pRe,
+                                  int16_t *__restrict__ pIm,
+                                  uint32_t numSamples) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const v2s *pS = (const v2s *)pSrc;
+    v2s *pR = (v2s *)pRe;
+    v2s *pI = (v2s *)pIm;
+    v2s x0, x1;
+
+    /* separate two complex samples into two real and two imaginary parts with two shuffles */
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        x0 = *pS++;
+        x1 = *pS++;
+        *pR++ = __builtin_shuffle(x0, x1, (v2s){ 0, 2 });
+        *pI++ = __builtin_shuffle(x0, x1, (v2s){ 1, 3 });
+    }
+
+    pSrc = (const int16_t *)pS;
+    pRe = (int16_t *)pR;
+    pIm = (int16_t *)pI;
+
+    if (numSamples & 0x1U) {
+        *pRe++ = *pSrc++;
+        *pIm++ = *pSrc++;
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
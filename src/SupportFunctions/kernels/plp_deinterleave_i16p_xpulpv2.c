@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i16p_xpulpv2.c
+ * Description:  Parallel deinterleaving of a multi-channel 16-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Parallel kernel for the deinterleaving of a multi-channel 16-bit integer vector for
+                 XPULPV2 extension.
+  @param[in]     args         points to the plp_deinterleave_instance_i16 struct initialized by the
+                              glue code
+  @return        none
+ */
+
+void plp_deinterleave_i16p_xpulpv2(void *args) {
+
+    plp_deinterleave_instance_i16 *S = (plp_deinterleave_instance_i16 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start, end;
+    uint32_t c, n;
+    const int16_t *pS;
+    int16_t *pD;
+
+    /* round the chunks up to an even number of samples, such that the SIMD path stays aligned */
+    chunk = (chunk + 1U) & ~1U;
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    if ((S->numChannels == 2) && ((S->numSamples & 0x1U) == 0)) {
+        /* two channels: the SIMD kernel is applied on the chunk of both channels */
+        const v2s *pS2 = (const v2s *)(S->pSrc + 2 * start);
+        v2s *pD0 = (v2s *)(S->pDst + start);
+        v2s *pD1 = (v2s *)(S->pDst + S->numSamples + start);
+        v2s x0, x1;
+
+        for (n = start; n < end; n += 2) {
+            x0 = *pS2++;
+            x1 = *pS2++;
+            *pD0++ = __builtin_shuffle(x0, x1, (v2s){ 0, 2 });
+            *pD1++ = __builtin_shuffle(x0, x1, (v2s){ 1, 3 });
+        }
+        return;
+    }
+
+    /* every core processes a contiguous chunk of the samples of all channels */
+    for (c = 0; c < S->numChannels; c++) {
+        pS = S->pSrc + start * S->numChannels + c;
+        pD = S->pDst + c * S->numSamples + start;
+        for (n = start; n < end; n++) {
+            *pD++ = *pS;
+            pS += S->numChannels;
+        }
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
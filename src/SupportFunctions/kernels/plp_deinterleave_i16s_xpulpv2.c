@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i16s_xpulpv2.c
+ * Description:  Deinterleaving of a multi-channel 16-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the deinterleaving of a multi-channel 16-bit integer vector for XPULPV2
+                 extension.
+  @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+  @param[in]     numChannels  number of channels
+  @param[in]     numSamples   number of samples in each channel
+  @param[out]    pDst         points to the planar output, numChannels x numSamples
+  @return        none
+
+  @par Exploiting SIMD instructions
+  For two channels (stereo or complex data) and an even number of samples, two samples of both
+  channels are loaded at once and separated with two shuffles.
+ */
+
+void plp_deinterleave_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   int16_t *__restrict__ pDst) {
+
+    uint32_t c, n;
+    const int16_t *pS;
+    int16_t *pD;
+
+    if ((numChannels == 2) && ((numSamples & 0x1U) == 0)) {
+        const v2s *pS2 = (const v2s *)pSrc;
+        v2s *pD0 = (v2s *)pDst;
+        v2s *pD1 = (v2s *)(pDst + numSamples);
+        v2s x0, x1;
+
+        /* two channels: separate two samples of both channels with two shuffles */
+        for (n = 0; n < (numSamples >> 1); n++) {
+            x0 = *pS2++;
+            x1 = *pS2++;
+            *pD0++ = __builtin_shuffle(x0, x1, (v2s){ 0, 2 });
+            *pD1++ = __builtin_shuffle(x0, x1, (v2s){ 1, 3 });
+        }
+        return;
+    }
+
+    /* read every channel with a stride of numChannels from the interleaved input */
+    for (c = 0; c < numChannels; c++) {
+        pS = pSrc + c;
+        pD = pDst + c * numSamples;
+#if defined(PLP_MATH_LOOPUNROLL)
+        for (n = 0; n < (numSamples >> 1); n++) {
+            *pD++ = *pS;
+            pS += numChannels;
+            *pD++ = *pS;
+            pS += numChannels;
+        }
+
+        if (numSamples & 0x1U) {
+            *pD++ = *pS;
+            pS += numChannels;
+        }
+#else
+        for (n = 0; n < numSamples; n++) {
+            *pD++ = *pS;
+            pS += numChannels;
+        }
+#endif // PLP_MATH_LOOPUNROLL
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
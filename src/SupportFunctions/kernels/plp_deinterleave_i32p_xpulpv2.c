@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i32p_xpulpv2.c
+ * Description:  Parallel deinterleaving of a multi-channel 32-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Parallel kernel for the deinterleaving of a multi-channel 32-bit integer vector for
+                 XPULPV2 extension.
+  @param[in]     args         points to the plp_deinterleave_instance_i32 struct initialized by the
+                              glue code
+  @return        none
+ */
+
+void plp_deinterleave_i32p_xpulpv2(void *args) {
+
+    plp_deinterleave_instance_i32 *S = (plp_deinterleave_instance_i32 *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start, end;
+    uint32_t c, n;
+    const int32_t *pS;
+    int32_t *pD;
+
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > S->numSamples) {
+        end = S->numSamples;
+    }
+
+    /* every core processes a contiguous chunk of the samples of all channels */
+    for (c = 0; c < S->numChannels; c++) {
+        pS = S->pSrc + start * S->numChannels + c;
+        pD = S->pDst + c * S->numSamples + start;
+        for (n = start; n < end; n++) {
+            *pD++ = *pS;
+            pS += S->numChannels;
+        }
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
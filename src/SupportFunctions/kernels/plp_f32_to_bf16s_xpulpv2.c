@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_f32_to_bf16s_xpulpv2.c
+ * Description:  Conversion of a 32-bit floating-point to a bfloat16 vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_math_inline.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the conversion of a 32-bit floating-point vector to a bfloat16 vector
+                 for XPULPV2 extension. The values are rounded to the nearest even value.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Two converted values are packed into a single word before they are stored.
+ */
+
+void plp_f32_to_bf16s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              bfloat16_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    v2s *pD = (v2s *)pDst;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        *pD++ = __PACK2(plp_f32_to_bf16_inline(pSrc[0]), plp_f32_to_bf16_inline(pSrc[1]));
+        pSrc += 2;
+    }
+
+    pDst = (bfloat16_t *)pD;
+
+    for (blkCnt = 0; blkCnt < (blockSize & 1U); blkCnt++) {
+        *pDst++ = plp_f32_to_bf16_inline(*pSrc++);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
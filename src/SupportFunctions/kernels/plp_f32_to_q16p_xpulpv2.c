@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_f32_to_q16p_xpulpv2.c
+ * Description:  Parallel conversion of a 32-bit floating-point to a 16-bit fixed-point kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Parallel conversion of a 32-bit floating-point vector to a 16-bit fixed-point
+                 vector kernel for XPULPV2 extension.
+  @param[in]     args       points to the plp_f32_to_q16_instance struct initialized by the glue
+                            code
+  @return        none
+ */
+
+void plp_f32_to_q16p_xpulpv2(void *args) {
+
+    plp_f32_to_q16_instance *S = (plp_f32_to_q16_instance *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start, end;
+
+    /* round the chunks up to whole SIMD words, such that all cores work on aligned data */
+    chunk = (chunk + 1U) & ~1U;
+    start = core_id * chunk;
+    end = start + chunk;
+
+    if (end > S->blockSize) {
+        end = S->blockSize;
+    }
+
+    /* every core converts a contiguous chunk of the samples */
+    if (start < end) {
+        plp_f32_to_q16s_xpulpv2(S->pSrc + start, S->deciPoint, S->pDst + start, end - start);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
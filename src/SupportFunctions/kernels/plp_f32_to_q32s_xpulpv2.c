@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_f32_to_q32s_xpulpv2.c
+ * Description:  Conversion of a 32-bit floating-point to a 32-bit fixed-point kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/* rounds to the nearest integer (half away from zero) and saturates to the q32 range */
+static inline int32_t plp_f32_to_q32_sat(float32_t x) {
+    x += (x < 0.0f) ? -0.5f : 0.5f;
+    if (x >= 2147483648.0f) {
+        return INT32_MAX;
+    } else if (x <= -2147483648.0f) {
+        return INT32_MIN;
+    }
+    return (int32_t)x;
+}
+
+/**
+  @brief         Kernel for the conversion of a 32-bit floating-point vector to a 32-bit fixed-point
+                 vector for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     deciPoint  number of fractional bits of the output values
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_f32_to_q32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    float32_t scale = (float32_t)(1U << deciPoint);
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        *pDst++ = (int32_t)plp_f32_to_q32_sat((*pSrc++) * scale);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
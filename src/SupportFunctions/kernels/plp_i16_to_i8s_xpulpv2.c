@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_i16_to_i8s_xpulpv2.c
+ * Description:  Narrowing of a 16-bit integer to an 8-bit integer kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the narrowing of a 16-bit integer vector to an 8-bit integer vector for
+                 XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     shift      number of bits to shift the values right, at most 15
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Two 16-bit values are shifted and saturated at once with packed shift, min and max instructions. A
+  shuffle packs the lower bytes of two words into one output word.
+ */
+
+void plp_i16_to_i8s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDst,
+                            uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t x;
+    const v2s *pS = (const v2s *)pSrc;
+    v4s *pD = (v4s *)pDst;
+    v2s sh = (v2s){ shift, shift };
+    v2s lo = (v2s){ -128, -128 };
+    v2s hi = (v2s){ 127, 127 };
+    v2s y0, y1;
+
+    /* shift and saturate two 16-bit lanes at a time, then pack the lower bytes */
+    for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
+        y0 = __MAX2(__MIN2(__SRA2(*pS++, sh), hi), lo);
+        y1 = __MAX2(__MIN2(__SRA2(*pS++, sh), hi), lo);
+        *pD++ = __builtin_shuffle((v4s)y0, (v4s)y1, (v4s){ 0, 2, 4, 6 });
+    }
+
+    pSrc = (const int16_t *)pS;
+    pDst = (int8_t *)pD;
+
+    for (blkCnt = 0; blkCnt < (blockSize & 3U); blkCnt++) {
+        x = (*pSrc++) >> shift;
+        *pDst++ = (int8_t)__CLIP(x, 7);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
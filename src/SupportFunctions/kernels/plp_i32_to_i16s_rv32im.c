@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_i32_to_i16s_rv32im.c
+ * Description:  Narrowing of a 32-bit integer to a 16-bit integer kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the narrowing of a 32-bit integer vector to a 16-bit integer vector for
+                 RV32IM extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     shift      number of bits to shift the values right, at most 31
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_i32_to_i16s_rv32im(const int32_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDst,
+                            uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t x;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = (*pSrc++) >> shift;
+        *pDst++ = (x > 32767) ? 32767 : ((x < -32768) ? -32768 : (int16_t)x);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_i8_to_i32s_xpulpv2.c
+ * Description:  Widening of an 8-bit integer to a 32-bit integer kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the widening of an 8-bit integer vector to a 32-bit integer vector for
+                 XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     shift      number of bits to shift the values left, at most 24
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Four values are loaded with a single word access and extracted from the packed vector.
+ */
+
+void plp_i8_to_i32s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    const v4s *pS = (const v4s *)pSrc;
+    v4s x;
+
+    /* load four values at once and extract them */
+    for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
+        x = *pS++;
+        *pDst++ = (int32_t)x[0] << shift;
+        *pDst++ = (int32_t)x[1] << shift;
+        *pDst++ = (int32_t)x[2] << shift;
+        *pDst++ = (int32_t)x[3] << shift;
+    }
+
+    pSrc = (const int8_t *)pS;
+
+    for (blkCnt = 0; blkCnt < (blockSize & 3U); blkCnt++) {
+        *pDst++ = (int32_t)(*pSrc++) << shift;
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interleave_i32s_xpulpv2.c
+ * Description:  Interleaving of a multi-channel 32-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the interleaving of a multi-channel 32-bit integer vector for XPULPV2
+                 extension.
+  @param[in]     pSrc         points to the planar input, numChannels x numSamples
+  @param[in]     numChannels  number of channels
+  @param[in]     numSamples   number of samples in each channel
+  @param[out]    pDst         points to the interleaved output, numSamples x numChannels
+  @return        none
+ */
+
+void plp_interleave_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                 uint32_t numChannels,
+                                 uint32_t numSamples,
+                                 int32_t *__restrict__ pDst) {
+
+    uint32_t c, n;
+    const int32_t *pS;
+    int32_t *pD;
+
+    /* write every channel with a stride of numChannels into the interleaved output */
+    for (c = 0; c < numChannels; c++) {
+        pS = pSrc + c * numSamples;
+        pD = pDst + c;
+#if defined(PLP_MATH_LOOPUNROLL)
+        for (n = 0; n < (numSamples >> 1); n++) {
+            *pD = *pS++;
+            pD += numChannels;
+            *pD = *pS++;
+            pD += numChannels;
+        }
+
+        if (numSamples & 0x1U) {
+            *pD = *pS++;
+            pD += numChannels;
+        }
+#else
+        for (n = 0; n < numSamples; n++) {
+            *pD = *pS++;
+            pD += numChannels;
+        }
+#endif // PLP_MATH_LOOPUNROLL
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
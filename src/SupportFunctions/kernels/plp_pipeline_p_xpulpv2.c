@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_p_xpulpv2.c
+ * Description:  Runs the stages of a pipeline on the cluster cores
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Pipeline
+ */
+
+/**
+  @defgroup PipelineKernels Pipeline Kernels
+ */
+
+/**
+  @addtogroup PipelineKernels
+  @{
+ */
+
+/**
+  @brief         Runs the stage of this core for every frame of the pipeline for XPULPV2 extension.
+  @param[in]     args       points to the plp_pipeline_instance struct initialized by the glue code
+  @return        none
+ */
+
+void plp_pipeline_p_xpulpv2(void *args) {
+
+    plp_pipeline_instance *S = (plp_pipeline_instance *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t stage = 0;
+    uint32_t first = 0;
+    uint32_t numSteps = S->numFrames + S->numStages - 1;
+    uint32_t step, frame;
+
+    /* find the stage of this core, the cores are assigned to the stages in order */
+    while (stage < S->numStages && core_id >= first + S->pStages[stage].nPE) {
+        first += S->pStages[stage].nPE;
+        stage++;
+    }
+
+    for (step = 0; step < numSteps; step++) {
+        /* stage s works on frame step - s */
+        frame = step - stage;
+        if (stage < S->numStages && step >= stage && frame < S->numFrames) {
+            S->pStages[stage].kernel(S->pStages[stage].args, frame, core_id - first,
+                                     S->pStages[stage].nPE);
+        }
+
+        /* hand over the frames to the next stages */
+        plp_team_barrier();
+    }
+}
+
+/**
+  @} end of PipelineKernels group
+ */
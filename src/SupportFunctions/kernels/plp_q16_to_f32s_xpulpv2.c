@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_q16_to_f32s_xpulpv2.c
+ * Description:  Conversion of a 16-bit fixed-point to a 32-bit floating-point kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Kernel for the conversion of a 16-bit fixed-point vector to a 32-bit floating-point
+                 vector for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     deciPoint  number of fractional bits of the input values
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Two values are loaded with a single word access and extracted from the packed vector before they
+  are converted.
+ */
+
+void plp_q16_to_f32s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             float32_t *__restrict__ pDst,
+                             uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    float32_t scale = 1.0f / (float32_t)(1U << deciPoint);
+    const v2s *pS = (const v2s *)pSrc;
+    v2s x;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x = *pS++;
+        *pDst++ = (float32_t)x[0] * scale;
+        *pDst++ = (float32_t)x[1] * scale;
+    }
+
+    pSrc = (const int16_t *)pS;
+
+    for (blkCnt = 0; blkCnt < (blockSize & 1U); blkCnt++) {
+        *pDst++ = (float32_t)(*pSrc++) * scale;
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ringbuf_read_f32s_xpulpv2.c
+ * Description:  32-bit floating-point ring buffer read for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RingBuf
+ */
+
+/**
+  @addtogroup RingBufKernels
+  @{
+ */
+
+/**
+  @brief         Copies the most recent samples of the 32-bit floating-point ring buffer for XPULPV2
+                 extension.
+  @param[in]     S            points to an initialized 32-bit floating-point ring buffer instance
+  @param[in]     blockSize    number of samples to copy, at most size
+  @param[out]    pDst         points to the output vector, which receives the last blockSize
+                              samples, oldest first
+  @return        none
+ */
+
+void plp_ringbuf_read_f32s_xpulpv2(const plp_ringbuf_instance_f32 *S,
+                                   uint32_t blockSize,
+                                   float32_t *__restrict__ pDst) {
+
+    /* the samples are contiguous in the mirrored buffer */
+    const float32_t *pSrc = S->pBuf + S->head + S->size - blockSize;
+    uint32_t k;
+
+    for (k = 0; k + 1 < blockSize; k += 2) {
+        float32_t x0 = pSrc[k];
+        float32_t x1 = pSrc[k + 1];
+        pDst[k] = x0;
+        pDst[k + 1] = x1;
+    }
+    if (k < blockSize) {
+        pDst[k] = pSrc[k];
+    }
+}
+
+/**
+  @} end of RingBufKernels group
+ */
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ringbuf_read_i16s_rv32im.c
+ * Description:  16-bit integer ring buffer read for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RingBuf
+ */
+
+/**
+  @addtogroup RingBufKernels
+  @{
+ */
+
+/**
+  @brief         Copies the most recent samples of the 16-bit integer ring buffer for RV32IM
+                 extension.
+  @param[in]     S            points to an initialized 16-bit integer ring buffer instance
+  @param[in]     blockSize    number of samples to copy, at most size
+  @param[out]    pDst         points to the output vector, which receives the last blockSize
+                              samples, oldest first
+  @return        none
+ */
+
+void plp_ringbuf_read_i16s_rv32im(const plp_ringbuf_instance_i16 *S,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst) {
+
+    /* the samples are contiguous in the mirrored buffer */
+    const int16_t *pSrc = S->pBuf + S->head + S->size - blockSize;
+    uint32_t k;
+
+    for (k = 0; k < blockSize; k++) {
+        pDst[k] = pSrc[k];
+    }
+}
+
+/**
+  @} end of RingBufKernels group
+ */
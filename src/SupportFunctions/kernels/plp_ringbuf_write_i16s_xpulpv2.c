@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ringbuf_write_i16s_xpulpv2.c
+ * Description:  16-bit integer ring buffer write for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RingBuf
+ */
+
+/**
+  @addtogroup RingBufKernels
+  @{
+ */
+
+/**
+  @brief         Appends a block of samples to the 16-bit integer ring buffer for XPULPV2 extension.
+  @param[in,out] S            points to an initialized 16-bit integer ring buffer instance
+  @param[in]     pSrc         points to the block of samples
+  @param[in]     blockSize    number of samples in the block. If it is larger than size, only
+                              the last size samples are kept.
+  @return        none
+
+  @par Wrap-around
+  The block is written in at most two parts, up to the end of the buffer and from its start on,
+  each into both halves of the buffer.
+
+  @par Exploiting SIMD instructions
+  Two samples are moved with one 32-bit load and store, also if the addresses are not aligned to
+  4 bytes.
+ */
+
+void plp_ringbuf_write_i16s_xpulpv2(plp_ringbuf_instance_i16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize) {
+
+    int16_t *pBuf = S->pBuf;
+    uint32_t size = S->size;
+    uint32_t head = S->head;
+    uint32_t n, k;
+
+    /* older samples would be overwritten in the same block */
+    if (blockSize > size) {
+        pSrc += blockSize - size;
+        blockSize = size;
+    }
+
+    while (blockSize > 0) {
+        int16_t *pDst = pBuf + head;
+        int16_t *pMirror = pBuf + head + size;
+
+        n = (blockSize < size - head) ? blockSize : size - head;
+
+        for (k = 0; k + 1 < n; k += 2) {
+            v2s x = *((v2s *)(pSrc + k));
+            *((v2s *)(pDst + k)) = x;
+            *((v2s *)(pMirror + k)) = x;
+        }
+        if (k < n) {
+            pDst[k] = pSrc[k];
+            pMirror[k] = pSrc[k];
+        }
+
+        pSrc += n;
+        blockSize -= n;
+        head += n;
+        if (head == size) {
+            head = 0;
+        }
+    }
+
+    S->head = head;
+}
+
+/**
+  @} end of RingBufKernels group
+ */
@@ -0,0 +1,179 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_i16p_xpulpv2.c
+ * Description:  Parallel sort of a 16-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Sort
+ */
+
+/**
+  @addtogroup SortKernels
+  @{
+ */
+
+/* compare and exchange, such that a[i] <= a[j] */
+static inline void plp_sort_cx_i16(int16_t *a, uint32_t i, uint32_t j) {
+    int16_t x = a[i];
+    int16_t y = a[j];
+    a[i] = __MIN(x, y);
+    a[j] = __MAX(x, y);
+}
+
+/* flip step of the pairs (base + i, base + size - 1 - i), i in [i0, half), two pairs at once */
+static inline void plp_sort_flip_i16(int16_t *a, uint32_t base, uint32_t size, uint32_t i0) {
+    uint32_t half = size >> 1;
+    uint32_t i = i0;
+
+    if ((i & 1) && i < half) {
+        plp_sort_cx_i16(a, base + i, base + size - 1 - i);
+        i++;
+    }
+    for (; i + 1 < half; i += 2) {
+        v2s *pX = (v2s *)(a + base + i);
+        v2s *pY = (v2s *)(a + base + size - 2 - i);
+        v2s x = *pX;
+        v2s y = __builtin_shuffle(*pY, (v2s){ 1, 0 });
+        *pX = __MIN2(x, y);
+        *pY = __builtin_shuffle(__MAX2(x, y), (v2s){ 1, 0 });
+    }
+    if (i < half) {
+        plp_sort_cx_i16(a, base + i, base + size - 1 - i);
+    }
+}
+
+/* half-cleaner step of the pairs (i, i + j) of the block [base, base + 2 j) */
+static inline void plp_sort_half_i16(int16_t *a, uint32_t base, uint32_t j, uint32_t n) {
+    uint32_t i = base;
+
+    if (j > 1) {
+        for (; i + 1 < base + j && i + j + 1 < n; i += 2) {
+            v2s *pX = (v2s *)(a + i);
+            v2s *pY = (v2s *)(a + i + j);
+            v2s x = *pX;
+            v2s y = *pY;
+            *pX = __MIN2(x, y);
+            *pY = __MAX2(x, y);
+        }
+    }
+    for (; i < base + j && i + j < n; i++) {
+        plp_sort_cx_i16(a, i, i + j);
+    }
+}
+
+/**
+  @brief         Parallel in-place sort of a 16-bit integer vector in ascending order for XPULPV2
+                 extension.
+  @param[in]     args         points to the plp_sort_instance_i16 struct initialized by the glue
+                              code
+  @return        none
+
+  @par Work distribution
+  The padded length L (the next power of two of blockSize) is split into P chunks of L / P
+  elements, where P is the number of cores rounded down to a power of two, reduced such that the
+  chunks have at least PLP_SORT_MIN_CHUNK elements. Every core sorts its chunk with
+  plp_sort_i16s_xpulpv2. The chunks are then merged with the bitonic network: the steps whose
+  pairs cross the chunks are distributed over the cores with a barrier after every step, and the
+  remaining steps of a merge stay within the chunk of a core and need no barrier.
+
+  @par Exploiting SIMD instructions
+  Within the chunk of a core, the compare-exchange steps process two pairs with one SIMD minimum
+  and maximum. The flip steps swap the two halves of the mirrored pair with a shuffle.
+ */
+
+void plp_sort_i16p_xpulpv2(void *args) {
+
+    plp_sort_instance_i16 *S = (plp_sort_instance_i16 *)args;
+    int16_t *pSrcDst = S->pSrcDst;
+    uint32_t n = S->blockSize;
+    uint32_t core_id = plp_core_id();
+    uint32_t L = 1;
+    uint32_t P = 1;
+    uint32_t chunk, lo, size, half, j, t, base;
+
+    while (L < n) {
+        L <<= 1;
+    }
+    while (2 * P <= S->nPE && L / (2 * P) >= PLP_SORT_MIN_CHUNK) {
+        P <<= 1;
+    }
+    chunk = L / P;
+    lo = core_id * chunk;
+
+    if (core_id < P && lo < n) {
+        plp_sort_i16s_xpulpv2(pSrcDst + lo, (lo + chunk < n) ? chunk : n - lo);
+    }
+
+    plp_team_barrier();
+
+    for (size = 2 * chunk; size <= L; size <<= 1) {
+        half = size >> 1;
+
+        /* flip step, chunk / 2 pairs per core */
+        if (core_id < P) {
+            for (t = core_id * (chunk >> 1); t < (core_id + 1) * (chunk >> 1); t++) {
+                uint32_t i = (t / half) * size + t % half;
+                uint32_t k = (t / half) * size + size - 1 - t % half;
+                if (k < n) {
+                    plp_sort_cx_i16(pSrcDst, i, k);
+                }
+            }
+        }
+
+        plp_team_barrier();
+
+        /* half-cleaner steps across the chunks */
+        for (j = half >> 1; j >= chunk; j >>= 1) {
+            if (core_id < P) {
+                for (t = core_id * (chunk >> 1); t < (core_id + 1) * (chunk >> 1); t++) {
+                    uint32_t i = (t / j) * 2 * j + t % j;
+                    if (i + j < n) {
+                        plp_sort_cx_i16(pSrcDst, i, i + j);
+                    }
+                }
+            }
+
+            plp_team_barrier();
+        }
+
+        /* half-cleaner steps within the chunk of this core */
+        if (core_id < P) {
+            for (j = ((half >> 1) < chunk ? (half >> 1) : (chunk >> 1)); j > 0; j >>= 1) {
+                for (base = lo; base < lo + chunk && base < n; base += 2 * j) {
+                    plp_sort_half_i16(pSrcDst, base, j, n);
+                }
+            }
+        }
+
+        plp_team_barrier();
+    }
+}
+
+/**
+  @} end of SortKernels group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_i32s_xpulpv2.c
+ * Description:  Sort of a 32-bit integer vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Sort
+ */
+
+/**
+  @addtogroup SortKernels
+  @{
+ */
+
+/* compare and exchange, such that a[i] <= a[j] */
+static inline void plp_sort_cx_i32(int32_t *a, uint32_t i, uint32_t j) {
+    int32_t x = a[i];
+    int32_t y = a[j];
+    a[i] = __MIN(x, y);
+    a[j] = __MAX(x, y);
+}
+
+/* flip step of the pairs (base + i, base + size - 1 - i), i in [i0, half) */
+static inline void plp_sort_flip_i32(int32_t *a, uint32_t base, uint32_t size, uint32_t i0) {
+    uint32_t i;
+
+    for (i = i0; i < (size >> 1); i++) {
+        plp_sort_cx_i32(a, base + i, base + size - 1 - i);
+    }
+}
+
+/* half-cleaner step of the pairs (i, i + j) of the block [base, base + 2 j) */
+static inline void plp_sort_half_i32(int32_t *a, uint32_t base, uint32_t j, uint32_t n) {
+    uint32_t i;
+
+    for (i = base; i < base + j && i + j < n; i++) {
+        plp_sort_cx_i32(a, i, i + j);
+    }
+}
+
+/**
+  @brief         In-place sort of a 32-bit integer vector in ascending order for XPULPV2 extension.
+  @param[in,out] pSrcDst      points to the vector, which is sorted in place
+  @param[in]     blockSize    number of elements in the vector
+  @return        none
+
+  @par Bitonic sort
+  The sort is a bitonic network, in which every block of size 2^s is merged from its two sorted
+  halves by a flip step, which compares the elements i and 2^s - 1 - i, followed by half-cleaner
+  steps. All compare-exchanges put the smaller element first, such that a length which is not a
+  power of two can be handled as if it was padded with +inf, by skipping the pairs beyond
+  blockSize.
+ */
+
+void plp_sort_i32s_xpulpv2(int32_t *__restrict__ pSrcDst, uint32_t blockSize) {
+
+    uint32_t size, base, j;
+
+    for (size = 2; size < 2 * blockSize; size <<= 1) {
+        /* merge the sorted halves of every block, the elements from blockSize on are +inf */
+        for (base = 0; base < blockSize; base += size) {
+            plp_sort_flip_i32(
+                pSrcDst, base, size, (base + size > blockSize) ? base + size - blockSize : 0);
+        }
+        for (j = size >> 2; j > 0; j >>= 1) {
+            for (base = 0; base < blockSize; base += 2 * j) {
+                plp_sort_half_i32(pSrcDst, base, j, blockSize);
+            }
+        }
+    }
+}
+
+/**
+  @} end of SortKernels group
+ */
@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_p_xpulpv2.c
+ * Description:  Streams element-wise kernels over L2 vectors through L1
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @defgroup StreamKernels Streaming Kernels
+ */
+
+/**
+  @addtogroup StreamKernels
+  @{
+ */
+
+/* starts the copy of chunk c of the inputs into the ping-pong buffers (c & 1) */
+static void plp_stream_load(const plp_stream_instance *S, uint32_t c, rt_dma_copy_t *copy) {
+
+    uint32_t offset = c * S->chunkSize;
+    uint32_t size = S->blockSize - offset;
+
+    if (size > S->chunkSize) {
+        size = S->chunkSize;
+    }
+
+    rt_dma_memcpy((uintptr_t)(S->pSrcA + offset * S->srcSize), (uintptr_t)S->pBufA[c & 0x1],
+                  size * S->srcSize, RT_DMA_DIR_EXT2LOC, 0, copy);
+    if (S->pSrcB != NULL) {
+        rt_dma_memcpy((uintptr_t)(S->pSrcB + offset * S->srcSize), (uintptr_t)S->pBufB[c & 0x1],
+                      size * S->srcSize, RT_DMA_DIR_EXT2LOC, 1, copy);
+    }
+}
+
+/**
+  @brief         Streams the chunks through L1 and runs the kernel on the part of every core for
+                 XPULPV2 extension.
+  @param[in]     args       points to the plp_stream_instance struct initialized by the glue code
+  @return        none
+
+  @par DMA double buffering
+  Core 0 is in charge of all DMA transfers. Before a chunk is processed, it waits until the chunk
+  is in L1, and starts the transfer of the next chunk into the other buffers. Every core then runs
+  the kernel on its part of the chunk, a multiple of 4 elements, such that the parts start at word
+  boundaries. After all cores are done, core 0 starts the write-back of the chunk to L2. The output
+  buffer is only reused two chunks later, after the write-back is done.
+ */
+
+void plp_stream_p_xpulpv2(void *args) {
+
+    plp_stream_instance *S = (plp_stream_instance *)args;
+    uint32_t core_id = plp_core_id();
+    uint32_t chunkSize = S->chunkSize;
+    uint32_t numChunks = (S->blockSize + chunkSize - 1) / chunkSize;
+    uint32_t srcSize = S->srcSize;
+    uint32_t dstSize = S->dstSize;
+
+    rt_dma_copy_t copyIn;
+    rt_dma_copy_t copyOut[2];
+
+    uint32_t c;
+
+    // load the first chunk
+    if (core_id == 0) {
+        plp_stream_load(S, 0, &copyIn);
+    }
+
+    for (c = 0; c < numChunks; c++) {
+
+        uint32_t offset = c * chunkSize;
+        uint32_t size = (offset + chunkSize > S->blockSize) ? S->blockSize - offset : chunkSize;
+
+        if (core_id == 0) {
+            // wait until this chunk is in L1
+            rt_dma_wait(&copyIn);
+
+            // wait until the output buffer is written back (used two chunks before)
+            if (c >= 2) {
+                rt_dma_wait(&copyOut[c & 0x1]);
+            }
+
+            // start the transfer of the next chunk
+            if (c + 1 < numChunks) {
+                plp_stream_load(S, c + 1, &copyIn);
+            }
+        }
+
+        plp_team_barrier();
+
+        // process the part of this core
+        uint32_t part = (((size + S->nPE - 1) / S->nPE) + 0x3) & ~0x3;
+        uint32_t start = core_id * part;
+        uint32_t end = (start + part > size) ? size : start + part;
+
+        if (start < end) {
+            if (S->binary != NULL) {
+                S->binary(S->pBufA[c & 0x1] + start * srcSize, S->pBufB[c & 0x1] + start * srcSize,
+                          S->pBufDst[c & 0x1] + start * dstSize, end - start);
+            } else {
+                S->unary(S->pBufA[c & 0x1] + start * srcSize,
+                         S->pBufDst[c & 0x1] + start * dstSize, end - start);
+            }
+        }
+
+        plp_team_barrier();
+
+        // write the chunk back to L2
+        if (core_id == 0) {
+            rt_dma_memcpy((uintptr_t)(S->pDst + offset * dstSize), (uintptr_t)S->pBufDst[c & 0x1],
+                          size * dstSize, RT_DMA_DIR_LOC2EXT, 0, &copyOut[c & 0x1]);
+        }
+    }
+
+    // wait for the last write-backs
+    if (core_id == 0) {
+        if (numChunks >= 2) {
+            rt_dma_wait(&copyOut[numChunks & 0x1]);
+        }
+        rt_dma_wait(&copyOut[(numChunks - 1) & 0x1]);
+    }
+
+    plp_team_barrier();
+}
+
+/**
+  @} end of StreamKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_subteams_p_xpulpv2.c
+ * Description:  Runs the kernel of the sub-team of every core
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SubTeams
+ */
+
+/**
+  @defgroup SubTeamsKernels Sub-Teams Kernels
+ */
+
+/**
+  @addtogroup SubTeamsKernels
+  @{
+ */
+
+/** Sub-team of every cluster core, all cores are in the whole team outside of plp_subteams_run */
+PLP_L1_DATA plp_subteam_core plp_subteam_cores[PLP_MAX_PE];
+
+/**
+  @brief         Runs the kernel of the sub-team of every core for XPULPV2 extension.
+  @param[in]     args       points to the plp_subteams_instance struct
+  @return        none
+ */
+
+void plp_subteams_p_xpulpv2(void *args) {
+
+    plp_subteams_instance *S = (plp_subteams_instance *)args;
+    uint32_t firstCore = plp_subteam_cores[rt_core_id()].firstCore;
+    uint32_t t = 0;
+    uint32_t nPE = 0;
+
+    /* the sub-teams are placed on consecutive cores, in the order of pTeams */
+    while (nPE < firstCore) {
+        nPE += S->pTeams[t].nPE;
+        t++;
+    }
+
+    S->pTeams[t].kernel(S->pTeams[t].args);
+}
+
+/**
+  @} end of SubTeamsKernels group
+ */
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_team_p_xpulpv2.c
+ * Description:  Runs the recorded kernels of a team on all cores
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Team
+ */
+
+/**
+  @defgroup TeamKernels Parallel Team Kernels
+ */
+
+/**
+  @addtogroup TeamKernels
+  @{
+ */
+
+/**
+  @brief         Runs the recorded kernels of a team on every core for XPULPV2 extension.
+  @param[in]     args       points to the plp_team_instance struct
+  @return        none
+ */
+
+void plp_team_p_xpulpv2(void *args) {
+
+    plp_team_instance *team = (plp_team_instance *)args;
+    uint32_t i;
+
+    for (i = 0; i < team->numTasks; i++) {
+        /* the next kernel may read the results of this one, so all cores have to finish it */
+        if (i > 0) {
+            plp_team_barrier();
+        }
+        team->pTasks[i].kernel(team->pTasks[i].args);
+    }
+}
+
+/**
+  @} end of TeamKernels group
+ */
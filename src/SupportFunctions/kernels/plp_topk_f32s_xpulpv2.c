@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_f32s_xpulpv2.c
+ * Description:  Top-k selection of a 32-bit floating-point vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup TopK
+ */
+
+/**
+  @addtogroup TopKKernels
+  @{
+ */
+
+/**
+  @brief         Top-k selection of a 32-bit floating-point vector for XPULPV2 extension.
+  @param[in]     pSrc         points to the input vector
+  @param[in]     blockSize    number of elements in the input vector
+  @param[in]     k            number of elements to select, at most blockSize
+  @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                              the k smallest elements, in ascending order
+  @param[out]    pDstVal      points to the k selected elements
+  @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+  @return        none
+
+  @par
+  Of equal elements, the one with the lower index is selected first.
+ */
+
+void plp_topk_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t k,
+                           uint8_t largest,
+                           float32_t *__restrict__ pDstVal,
+                           uint32_t *__restrict__ pDstIdx) {
+
+    uint32_t cnt = 0;
+    uint32_t i, pos;
+
+    if (k > blockSize) {
+        k = blockSize;
+    }
+    if (k == 0) {
+        return;
+    }
+
+    for (i = 0; i < blockSize; i++) {
+        float32_t v = pSrc[i];
+
+        if (cnt == k) {
+            /* most elements are rejected here */
+            if (largest ? !(v > pDstVal[k - 1]) : !(v < pDstVal[k - 1])) {
+                continue;
+            }
+            pos = k - 1;
+        } else {
+            pos = cnt++;
+        }
+
+        /* insert v into the sorted list */
+        while (pos > 0 && (largest ? (v > pDstVal[pos - 1]) : (v < pDstVal[pos - 1]))) {
+            pDstVal[pos] = pDstVal[pos - 1];
+            if (pDstIdx != NULL) {
+                pDstIdx[pos] = pDstIdx[pos - 1];
+            }
+            pos--;
+        }
+        pDstVal[pos] = v;
+        if (pDstIdx != NULL) {
+            pDstIdx[pos] = i;
+        }
+    }
+}
+
+/**
+  @} end of TopKKernels group
+ */
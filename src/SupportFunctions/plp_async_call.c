@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_async_call.c
+ * Description:  offload of a function from the fabric controller to the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Async Asynchronous Offload
+  Runs functions on the cluster without blocking the fabric controller.
+
+  A cluster function is usually called from the fabric controller with a synchronous
+  rt_cluster_call, during which the fabric controller is idle. The asynchronous calls instead
+  return as soon as the call is queued, with a handle which is passed to plp_async_wait when the
+  result is needed:
+  <pre>
+      plp_async_handle h;
+
+      rt_event_alloc(NULL, 2);                            // once, an event per pending call
+      plp_mat_mult_f32_async(pA, pB, M, N, O, 8, &h);     // returns immediately
+      ...                                                 // I/O, prepare the next frame
+      plp_async_wait(&h);                                 // pC is ready
+  </pre>
+  Calls which are issued while another one is running are queued by the runtime and executed by
+  the cluster one after the other, in the order in which they were issued. The fabric controller
+  can therefore prepare and issue the next call while the current one is computing, such that the
+  cluster does not idle between two calls.
+
+  The library functions with an _async suffix store their arguments in the handle. The handle and
+  all buffers must stay valid and must not be modified until plp_async_wait returned. Every pending
+  call needs a free event of the default scheduler, which are reserved with rt_event_alloc.
+
+  On platforms with several clusters, plp_async_call_cluster starts a function on any of them. The
+  library functions with a _multi suffix use it to split the heaviest workloads (tiled matrix
+  multiplications and batches of FFTs) across nClusters clusters, each of which runs the single
+  cluster parallel function on its part with nPE cores. The clusters 0 to nClusters - 1 must be
+  mounted. The operands, results and FFT instances are shared by all clusters and should reside
+  in L2, while every cluster works in its own L1.
+ */
+
+/**
+  @addtogroup Async
+  @{
+ */
+
+/**
+  @brief         Starts a function on the cluster, and returns without waiting for it.
+  @param[in]     entry      function, which is called on the master core of the cluster, and may
+                            fork on all cluster cores
+  @param[in]     args       argument of the function, which must stay valid until the call has
+                            finished
+  @param[out]    handle     handle of the call, wait for it with plp_async_wait
+  @return        none
+ */
+
+void plp_async_call(void (*entry)(void *), void *args, plp_async_handle *handle) {
+
+    plp_async_call_cluster(0, entry, args, handle);
+}
+
+/**
+  @} end of Async group
+ */
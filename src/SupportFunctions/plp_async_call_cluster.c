@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_async_call_cluster.c
+ * Description:  offload of a function from the fabric controller to a given cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Async
+  @{
+ */
+
+/**
+  @brief         Starts a function on the given cluster, and returns without waiting for it.
+  @param[in]     cid        id of the cluster, which must be mounted with rt_cluster_mount
+  @param[in]     entry      function, which is called on the master core of the cluster, and may
+                            fork on all cores of that cluster
+  @param[in]     args       argument of the function, which must stay valid until the call has
+                            finished
+  @param[out]    handle     handle of the call, wait for it with plp_async_wait
+  @return        none
+ */
+
+void plp_async_call_cluster(uint32_t cid,
+                            void (*entry)(void *),
+                            void *args,
+                            plp_async_handle *handle) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("offloading supported only for fabric controller side\n");
+        handle->event = NULL;
+        return;
+    }
+
+    handle->event = rt_event_get_blocking(NULL);
+    rt_cluster_call(&handle->call, cid, entry, args, NULL, 0, 0, 0, handle->event);
+}
+
+/**
+  @} end of Async group
+ */
@@ -0,0 +1,58 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_async_wait.c
+ * Description:  wait for a function offloaded to the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Async
+  @{
+ */
+
+/**
+  @brief         Waits until a function started with plp_async_call or a library function with an
+                 _async suffix has finished. Returns immediately if the call has already been
+                 waited for.
+  @param[in,out] handle     handle of the call
+  @return        none
+ */
+
+void plp_async_wait(plp_async_handle *handle) {
+
+    if (handle->event != NULL) {
+        rt_event_wait(handle->event);
+        handle->event = NULL;
+    }
+}
+
+/**
+  @} end of Async group
+ */
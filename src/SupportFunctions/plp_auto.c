@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_auto.c
+ * Description:  Choice of the number of cores for nPE = PLP_AUTO
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Auto Automatic Number of Cores
+  Most parallel functions accept nPE = PLP_AUTO, in which case they choose the number of cores
+  from the problem size. Forking the team and the final reduction or barrier cost a fixed number of
+  cycles, so small problems run faster on fewer cores, down to a single one.
+
+  The choice is made with the cost table in plp_auto_table.h, which contains for every function the
+  smallest problem size from which 2, 4 and 8 cores are used. The problem size is the number of
+  operations, e.g. blockSize for vector functions, M * N * O for matrix multiplications and
+  srcALen * srcBLen for convolutions. The table is regenerated for a platform with a benchmark
+  sweep of the test framework:
+  <pre>
+      cd test/mrWolf
+      PULP_DSP_BENCH=1 plptest
+      ./bench.py autotune
+  </pre>
+  With PLP_DETERMINISTIC, PLP_AUTO always uses all cores of the cluster, such that the same team is
+  forked for every problem size and the cycle bound of a function grows with the size only through
+  its kernel.
+
+  The functions which take an instance structure (e.g. the FFTs and the biquad filters) and
+  plp_mat_inv_f32_parallel do not support PLP_AUTO.
+
+  plp_mat_mult_plan_create resolves PLP_AUTO once with the entry of plp_mat_mult_<type>_parallel,
+  such that the planned matrix multiplications do not look up the table in every call.
+ */
+
+/**
+  @addtogroup Auto
+  @{
+ */
+
+#define PLP_AUTO_ENTRY(fn, min2, min4, min8) { min2, min4, min8 },
+
+static const uint32_t plp_auto_table[PLP_AUTO_NUM_IDS][3] = { PLP_AUTO_TABLE(PLP_AUTO_ENTRY) };
+
+/**
+  @brief         Chooses the number of cores of a parallel function for the given problem size,
+                 used when the function is called with nPE = PLP_AUTO.
+  @param[in]     id         index of the function in the cost table, PLP_AUTO_ID(function)
+  @param[in]     size       problem size, in operations of the function
+  @return        number of cores, 1, 2, 4 or 8, at most rt_nb_pe()
+ */
+
+uint32_t plp_auto_npe(plp_auto_id id, uint32_t size) {
+
+    const uint32_t *pMinSize = plp_auto_table[id];
+    uint32_t maxPE = rt_nb_pe();
+    uint32_t nPE = 1;
+    uint32_t i;
+
+#if defined(PLP_DETERMINISTIC)
+    /* the largest size reaches every threshold, even 0xFFFFFFFF (never) */
+    size = 0xFFFFFFFF;
+#endif
+
+    for (i = 0; i < 3; i++) {
+        if (size < pMinSize[i] || 2 * nPE > maxPE) {
+            break;
+        }
+        nPE *= 2;
+    }
+
+    return nPE;
+}
+
+/**
+  @} end of Auto group
+ */
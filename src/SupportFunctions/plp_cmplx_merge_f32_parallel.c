@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_merge_f32_parallel.c
+ * Description:  Glue code for the parallel merging of real and imaginary 32-bit float parts into a complex vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Interleave
+  @{
+ */
+
+/**
+  @brief         Glue code for the parallel merging of real and imaginary 32-bit float parts into a
+                 complex vector.
+  @param[in]     pRe          points to the real parts
+  @param[in]     pIm          points to the imaginary parts
+  @param[out]    pDst         points to the interleaved complex output vector
+  @param[in]     numSamples   number of complex samples
+  @param[in]     nPE          number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_merge_f32_parallel(const float32_t *__restrict__ pRe,
+                                  const float32_t *__restrict__ pIm,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t numSamples,
+                                  uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_cmplx_merge_f32_parallel), numSamples);
+        }
+
+        plp_cmplx_merge_instance_f32 S = { .pRe = pRe,
+                                           .pIm = pIm,
+                                           .pDst = pDst,
+                                           .numSamples = numSamples,
+                                           .nPE = nPE };
+
+        rt_team_fork(nPE, plp_cmplx_merge_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of Interleave group
+ */
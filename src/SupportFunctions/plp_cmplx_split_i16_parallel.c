@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_i16_parallel.c
+ * Description:  Glue code for the parallel splitting of a complex 16-bit integer vector into real and imaginary parts
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Interleave
+  @{
+ */
+
+/**
+  @brief         Glue code for the parallel splitting of a complex 16-bit integer vector into real
+                 and imaginary parts.
+  @param[in]     pSrc         points to the interleaved complex input vector
+  @param[out]    pRe          points to the real parts
+  @param[out]    pIm          points to the imaginary parts
+  @param[in]     numSamples   number of complex samples
+  @param[in]     nPE          number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_split_i16_parallel(const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pRe,
+                                  int16_t *__restrict__ pIm,
+                                  uint32_t numSamples,
+                                  uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_cmplx_split_i16_parallel), numSamples);
+        }
+
+        plp_cmplx_split_instance_i16 S = { .pSrc = pSrc,
+                                           .pRe = pRe,
+                                           .pIm = pIm,
+                                           .numSamples = numSamples,
+                                           .nPE = nPE };
+
+        rt_team_fork(nPE, plp_cmplx_split_i16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of Interleave group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_i16_dma.c
+ * Description:  DMA copy of a 16-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup DmaCopy
+  @{
+ */
+
+/**
+  @brief         Copies a 16-bit integer vector between L2 and L1 with the DMA and waits until it is
+                 done.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+  @return        none
+ */
+
+void plp_copy_i16_dma(const int16_t *__restrict__ pSrc,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize,
+                      int dir) {
+
+    rt_dma_copy_t copy;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    plp_copy_i16_dma_async(pSrc, pDst, blockSize, dir, &copy);
+    rt_dma_wait(&copy);
+}
+
+/**
+  @} end of DmaCopy group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_i32_dma_2d_async.c
+ * Description:  Starts the 2D DMA copy of a 32-bit integer matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup DmaCopy
+  @{
+ */
+
+/**
+  @brief         Starts the 2D DMA transfer of a 32-bit integer matrix between a strided matrix in
+                 L2 and a dense matrix in L1.
+  @param[in]     pSrc       points to the input matrix
+  @param[out]    pDst       points to the output matrix
+  @param[in]     numRows    number of rows to copy
+  @param[in]     numCols    number of samples in each row
+  @param[in]     stride     number of samples between the starts of two rows of the matrix in L2
+  @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+  @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+  @return        none
+ */
+
+void plp_copy_i32_dma_2d_async(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t numRows,
+                               uint32_t numCols,
+                               uint32_t stride,
+                               int dir,
+                               rt_dma_copy_t *copy) {
+
+    uintptr_t ext, loc;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        ext = (uintptr_t)pSrc;
+        loc = (uintptr_t)pDst;
+    } else {
+        ext = (uintptr_t)pDst;
+        loc = (uintptr_t)pSrc;
+    }
+
+    rt_dma_memcpy_2d(ext, loc, sizeof(int32_t) * numRows * numCols, sizeof(int32_t) * stride,
+                     sizeof(int32_t) * numCols, dir, 0, copy);
+}
+
+/**
+  @} end of DmaCopy group
+ */
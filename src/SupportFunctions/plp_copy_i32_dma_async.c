@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_i32_dma_async.c
+ * Description:  Starts the DMA copy of a 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup DmaCopy DMA Copy and Fill
+  Moves vectors between L2 and the cluster L1 memory with the cluster DMA instead of the cores.
+  <pre>
+      pDst[n] = pSrc[n];   0 <= n < blockSize
+  </pre>
+  The direction of a transfer is given with RT_DMA_DIR_EXT2LOC (pSrc in L2, pDst in L1) or
+  RT_DMA_DIR_LOC2EXT (pSrc in L1, pDst in L2). The cores are free while the DMA transfers the data,
+  so the _async functions only enqueue the transfer and return. The transfer is finished after
+  rt_dma_wait was called on the same rt_dma_copy_t handle, which lets a pipeline compute on one
+  buffer while the next one is loaded. Several transfers can share one handle, and the handle must
+  stay valid until it was waited on.
+
+  The 2D transfers copy numRows rows of numCols samples between a strided matrix in L2 and a dense
+  matrix in L1, for example to move a tile of a larger matrix.
+
+  The fill functions write a constant into a vector in L2. The value is written into a small
+  staging buffer of PLP_DMA_FILL_BUFFER_SIZE bytes in L1, which is copied repeatedly by the DMA.
+
+  The DMA is only available on the cluster side.
+ */
+
+/**
+  @addtogroup DmaCopy
+  @{
+ */
+
+/**
+  @brief         Starts the DMA transfer of a 32-bit integer vector between L2 and L1.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     dir        RT_DMA_DIR_EXT2LOC or RT_DMA_DIR_LOC2EXT
+  @param[out]    copy       handle of the transfer, wait for it with rt_dma_wait
+  @return        none
+ */
+
+void plp_copy_i32_dma_async(const int32_t *__restrict__ pSrc,
+                            int32_t *__restrict__ pDst,
+                            uint32_t blockSize,
+                            int dir,
+                            rt_dma_copy_t *copy) {
+
+    uintptr_t ext, loc;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        ext = (uintptr_t)pSrc;
+        loc = (uintptr_t)pDst;
+    } else {
+        ext = (uintptr_t)pDst;
+        loc = (uintptr_t)pSrc;
+    }
+
+    rt_dma_memcpy(ext, loc, sizeof(int32_t) * blockSize, dir, 0, copy);
+}
+
+/**
+  @} end of DmaCopy group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_f32_parallel.c
+ * Description:  Glue code for the parallel deinterleaving of a multi-channel 32-bit float vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Interleave
+  @{
+ */
+
+/**
+  @brief         Glue code for the parallel deinterleaving of a multi-channel 32-bit float vector.
+  @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+  @param[in]     numChannels  number of channels
+  @param[in]     numSamples   number of samples in each channel
+  @param[out]    pDst         points to the planar output, numChannels x numSamples
+  @param[in]     nPE          number of parallel processing units
+  @return        none
+ */
+
+void plp_deinterleave_f32_parallel(const float32_t *__restrict__ pSrc,
+                                   uint32_t numChannels,
+                                   uint32_t numSamples,
+                                   float32_t *__restrict__ pDst,
+                                   uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_deinterleave_f32_parallel),
+                               numChannels * numSamples);
+        }
+
+        plp_deinterleave_instance_f32 S = { .pSrc = pSrc,
+                                            .numChannels = numChannels,
+                                            .numSamples = numSamples,
+                                            .pDst = pDst,
+                                            .nPE = nPE };
+
+        rt_team_fork(nPE, plp_deinterleave_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of Interleave group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i32.c
+ * Description:  Glue code for the deinterleaving of a multi-channel 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Interleave Interleave and Deinterleave
+  Converts multi-channel data between the interleaved layout, as it is delivered by audio
+  interfaces like I2S, and the planar layout, in which every channel is stored in its own vector.
+  <pre>
+      deinterleave:  pDst[c * numSamples + n] = pSrc[n * numChannels + c]
+      interleave:    pDst[n * numChannels + c] = pSrc[c * numSamples + n]
+  </pre>
+  The complex split and merge functions do the same for complex vectors, stored as interleaved real
+  and imaginary parts (which is also the layout of Complex_type_f32), and two separate vectors.
+
+  On the cluster, two channels (stereo or complex data) of 16-bit samples are reordered with packed
+  loads and shuffles. The parallel versions split the samples into contiguous chunks, such that all
+  cores are used for any number of channels.
+ */
+
+/**
+  @addtogroup Interleave
+  @{
+ */
+
+/**
+  @brief         Glue code for the deinterleaving of a multi-channel 32-bit integer vector.
+  @param[in]     pSrc         points to the interleaved input, numSamples x numChannels
+  @param[in]     numChannels  number of channels
+  @param[in]     numSamples   number of samples in each channel
+  @param[out]    pDst         points to the planar output, numChannels x numSamples
+  @return        none
+ */
+
+void plp_deinterleave_i32(const int32_t *__restrict__ pSrc,
+                          uint32_t numChannels,
+                          uint32_t numSamples,
+                          int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_deinterleave_i32s_rv32im(pSrc, numChannels, numSamples, pDst);
+    } else {
+        plp_deinterleave_i32s_xpulpv2(pSrc, numChannels, numSamples, pDst);
+    }
+}
+
+/**
+  @} end of Interleave group
+ */
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fill_i8_dma.c
+ * Description:  DMA fill of a 8-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup DmaCopy
+  @{
+ */
+
+/**
+  @brief         Fills a constant value into a 8-bit integer vector in L2 with the DMA.
+  @param[in]     value      input value to be filled
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_fill_i8_dma(int8_t value,
+                     int8_t *__restrict__ pDst,
+                     uint32_t blockSize) {
+
+    uint32_t i;
+    uint32_t bufLen = PLP_DMA_FILL_BUFFER_SIZE / sizeof(int8_t);
+    int8_t *pBuf;
+    rt_dma_copy_t copy;
+    int merge = 0;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers are supported only for cluster side\n");
+        return;
+    }
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    if (bufLen > blockSize) {
+        bufLen = blockSize;
+    }
+
+    pBuf = (int8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * bufLen);
+
+    if (pBuf == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    for (i = 0; i < bufLen; i++) {
+        pBuf[i] = value;
+    }
+
+    // copy the staging buffer over the destination, all transfers share one handle
+    for (i = 0; i < blockSize; i += bufLen) {
+        uint32_t len = (blockSize - i < bufLen) ? blockSize - i : bufLen;
+        rt_dma_memcpy((uintptr_t)(pDst + i), (uintptr_t)pBuf, sizeof(int8_t) * len,
+                      RT_DMA_DIR_LOC2EXT, merge, &copy);
+        merge = 1;
+    }
+
+    rt_dma_wait(&copy);
+
+    plp_scratch_free(RT_ALLOC_CL_DATA, pBuf, sizeof(int8_t) * bufLen);
+}
+
+/**
+  @} end of DmaCopy group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hetero_share.c
+ * Description:  share of the fabric controller in a heterogeneous execution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Hetero Heterogeneous Execution
+  Splits element-wise functions between the cluster and the fabric controller.
+
+  While the cluster cores execute a parallel function, the fabric controller usually waits for the
+  cluster call to return. The functions with a _hetero suffix are called from the fabric controller
+  instead. They offload the beginning of the vector to the cluster with plp_async_call, process the
+  end of the vector on the fabric controller with its RV32IM kernel, and wait for the cluster.
+
+  The vector is split in proportion to the throughput of both sides, given by the share of the
+  fabric controller in 1/256. The share depends on the function, the data type and the platform,
+  and is computed once from two measurements of the same problem size:
+  <pre>
+      // cycles of plp_add_i16 on the fabric controller, and of
+      // plp_add_i16_parallel on the cluster (e.g. with the performance counters)
+      uint32_t fcShare = plp_hetero_share(fcCycles, clusterCycles);
+      ...
+      plp_add_i16_hetero(pSrcA, pSrcB, pDst, blockSize, 8, fcShare);
+  </pre>
+  A share of 0 runs everything on the cluster. Like plp_async_call, every call needs a free event
+  of the default scheduler.
+ */
+
+/**
+  @addtogroup Hetero
+  @{
+ */
+
+/**
+  @brief         Computes the share of the fabric controller from the measured cycles of both sides,
+                 such that both finish at the same time.
+  @param[in]     fcCycles       cycles of the function on the fabric controller
+  @param[in]     clusterCycles  cycles of the parallel function on the cluster, for the same size
+  @return        share of the fabric controller in 1/256, between 0 and 256
+ */
+
+uint32_t plp_hetero_share(uint32_t fcCycles, uint32_t clusterCycles) {
+
+    uint64_t total = (uint64_t)fcCycles + clusterCycles;
+
+    if (total == 0) {
+        return 0;
+    }
+
+    /* the throughput of each side is inversely proportional to its cycles */
+    return (uint32_t)(((uint64_t)clusterCycles << 8) / total);
+}
+
+/**
+  @} end of Hetero group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hetero_split.c
+ * Description:  split of a vector between the cluster and the fabric controller
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Hetero
+  @{
+ */
+
+/**
+  @brief         Computes the number of elements which are processed by the cluster, at the
+                 beginning of the vector. The rest is processed by the fabric controller.
+  @param[in]     blockSize  number of elements in the vector
+  @param[in]     fcShare    share of the fabric controller in 1/256, see plp_hetero_share
+  @return        number of elements of the cluster, a multiple of 4 or blockSize
+ */
+
+uint32_t plp_hetero_split(uint32_t blockSize, uint32_t fcShare) {
+
+    uint32_t fcSize;
+    uint32_t clusterSize;
+
+    if (fcShare >= 256) {
+        return 0;
+    }
+
+    fcSize = (uint32_t)(((uint64_t)blockSize * fcShare) >> 8);
+
+    /* keep the SIMD loops of the cluster free of leftovers */
+    clusterSize = (blockSize - fcSize + 3) & ~3u;
+
+    return (clusterSize > blockSize) ? blockSize : clusterSize;
+}
+
+/**
+  @} end of Hetero group
+ */
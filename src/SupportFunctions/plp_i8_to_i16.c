@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_i8_to_i16.c
+ * Description:  Glue code for the widening of an 8-bit integer to a 16-bit integer
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Convert Type Conversion
+  Converts vectors between the integer, fixed-point and floating-point data types.
+
+  The integer conversions change the width of the values:
+  <pre>
+      widening:   pDst[n] = pSrc[n] << shift
+      narrowing:  pDst[n] = sat(pSrc[n] >> shift)
+  </pre>
+  Narrowing shifts arithmetically (rounding towards minus infinity) and saturates to the range of
+  the output type. Converting a Q7 into a Q15 vector, for example, is plp_i8_to_i16 with a shift of
+  8, and the opposite direction is plp_i16_to_i8 with a shift of 8.
+
+  The floating-point conversions interpret the fixed-point values with deciPoint fractional bits:
+  <pre>
+      fixed to float:  pDst[n] = pSrc[n] / 2^deciPoint
+      float to fixed:  pDst[n] = sat(round(pSrc[n] * 2^deciPoint))
+  </pre>
+  The floating-point conversions are only available on the cluster.
+ */
+
+/**
+  @addtogroup Convert
+  @{
+ */
+
+/**
+  @brief         Glue code for the widening of an 8-bit integer vector to a 16-bit integer vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     shift      number of bits to shift the values left, at most 8
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_i8_to_i16(const int8_t *__restrict__ pSrc,
+                   uint32_t shift,
+                   int16_t *__restrict__ pDst,
+                   uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_i8_to_i16s_rv32im(pSrc, shift, pDst, blockSize);
+    } else {
+        plp_i8_to_i16s_xpulpv2(pSrc, shift, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of Convert group
+ */
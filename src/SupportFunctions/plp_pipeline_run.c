@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_run.c
+ * Description:  Glue code for running a pipeline of stages on the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Pipeline Pipeline
+  Runs a chain of processing stages as a software pipeline, in which every stage has its own cores.
+
+  A chain like deinterleave, FIR, window, FFT and magnitude is usually computed by calling every
+  function with all cores, one after the other. The pipeline instead assigns nPE cores to every
+  stage and processes different frames in the stages at the same time:
+  <pre>
+      step           0    1    2    3    ...
+      stage 0        f0   f1   f2   f3
+      stage 1             f0   f1   f2
+      stage 2                  f0   f1
+  </pre>
+  After every step, all cores meet at a barrier, and frame f moves on to the next stage. The stages
+  are synchronized only by this barrier, so it is enough to double buffer the data between two
+  stages: stage s writes frame f to buffer (f & 1), while stage s + 1 reads frame f - 1 from the
+  other buffer.
+
+  A stage is a function with the arguments of the stage, the frame number, and the index and number
+  of the cores of the stage. It usually selects the buffers of the frame and calls a serial kernel,
+  or splits the work between its cores like the parallel kernels do. The number of cores of all
+  stages must not exceed the number of cluster cores, and the throughput is given by the slowest
+  stage, so the cores should be distributed accordingly.
+ */
+
+/**
+  @addtogroup Pipeline
+  @{
+ */
+
+/**
+  @brief         Glue code for running numFrames frames through a pipeline of stages.
+  @param[in]     pStages    points to the stages, in the order in which a frame passes them
+  @param[in]     numStages  number of stages
+  @param[in]     numFrames  number of frames to process
+  @return        none
+ */
+
+void plp_pipeline_run(const plp_pipeline_stage *pStages, uint32_t numStages, uint32_t numFrames) {
+
+    uint32_t s;
+    uint32_t nPE = 0;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        for (s = 0; s < numStages; s++) {
+            nPE += pStages[s].nPE;
+        }
+
+        if (nPE == 0 || numFrames == 0) {
+            return;
+        }
+
+        plp_pipeline_instance S = { .pStages = pStages,
+                                    .numStages = numStages,
+                                    .numFrames = numFrames };
+
+        rt_team_fork(nPE, plp_pipeline_p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of Pipeline group
+ */
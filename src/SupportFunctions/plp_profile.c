@@ -0,0 +1,185 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.c
+ * Description:  Performance counters of the public functions
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include <string.h>
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Profile Profiling
+  Measures every call of the public functions with the hardware performance counters. The
+  application includes plp_profile.h after plp_math.h and is built with PLP_PROFILE defined, which
+  wraps every call of a public function with plp_profile_start and plp_profile_stop:
+  <pre>
+      plp_profile_entry table[16];
+
+      plp_profile_init(table, 16, RT_PERF_LD_STALL);
+      plp_dot_prod_i16(...);                 // measured
+      plp_profile_dump();                    // prints calls, cycles, instructions and stalls
+  </pre>
+  Without PLP_PROFILE, plp_profile.h defines nothing and the calls are not changed. The library
+  itself is always built without it, so calls inside the library are counted in the calling
+  function.
+
+  The counters of the core which calls the function are used. For a parallel function, this is the
+  master core of the team, including the time it waits for the other cores. Besides cycles and
+  instructions, only one extra event is counted, since the hardware counts a single configurable
+  event at a time. Functions which do not fit into the table are not counted.
+ */
+
+/**
+  @addtogroup Profile
+  @{
+ */
+
+static struct {
+    plp_profile_entry *pTable; // profiling table
+    uint32_t size;             // number of entries of the table
+    uint32_t numEntries;       // number of used entries
+    int extraEvent;            // extra event, -1 for none
+    rt_perf_t perf;            // performance counter configuration
+} plp_profile_state = { NULL, 0, 0, -1, { 0 } };
+
+/**
+  @brief         Starts the profiling of the public functions. The counters of every function are
+                 accumulated into the given table, see plp_profile.h.
+  @param[in]     pTable     points to the table, with one entry per profiled function
+  @param[in]     size       number of entries of the table
+  @param[in]     extraEvent event counted in addition to cycles and instructions (RT_PERF_*), -1
+                            for none
+  @return        none
+ */
+
+void plp_profile_init(plp_profile_entry *pTable, uint32_t size, int extraEvent) {
+
+    int events = (1 << RT_PERF_CYCLES) | (1 << RT_PERF_INSTR);
+
+    if (extraEvent >= 0) {
+        events |= 1 << extraEvent;
+    }
+
+    plp_profile_state.pTable = pTable;
+    plp_profile_state.size = (pTable == NULL) ? 0 : size;
+    plp_profile_state.numEntries = 0;
+    plp_profile_state.extraEvent = extraEvent;
+
+    rt_perf_init(&plp_profile_state.perf);
+    rt_perf_conf(&plp_profile_state.perf, events);
+}
+
+/**
+  @brief         Resets and starts the performance counters for a call of a function.
+  @param[in]     name       name of the function
+  @return        index of the entry of the function, passed to plp_profile_stop
+ */
+
+uint32_t plp_profile_start(const char *name) {
+
+    plp_profile_entry *pTable = plp_profile_state.pTable;
+    uint32_t id;
+
+    /* functions are identified by the address of their name first, which is the same for all calls
+     * from the same translation unit */
+    for (id = 0; id < plp_profile_state.numEntries; id++) {
+        if (pTable[id].name == name || strcmp(pTable[id].name, name) == 0) {
+            break;
+        }
+    }
+
+    if (id == plp_profile_state.numEntries) {
+        if (id == plp_profile_state.size) {
+            return id;
+        }
+
+        pTable[id].name = name;
+        pTable[id].calls = 0;
+        pTable[id].cycles = 0;
+        pTable[id].instr = 0;
+        pTable[id].extra = 0;
+        plp_profile_state.numEntries++;
+    }
+
+    rt_perf_reset(&plp_profile_state.perf);
+    rt_perf_start(&plp_profile_state.perf);
+
+    return id;
+}
+
+/**
+  @brief         Stops the performance counters and adds them to the entry of the function.
+  @param[in]     id         index returned by plp_profile_start
+  @return        none
+ */
+
+void plp_profile_stop(uint32_t id) {
+
+    plp_profile_entry *pEntry;
+
+    rt_perf_stop(&plp_profile_state.perf);
+
+    /* the table was full when the function was started */
+    if (id >= plp_profile_state.numEntries) {
+        return;
+    }
+
+    pEntry = &plp_profile_state.pTable[id];
+    pEntry->calls++;
+    pEntry->cycles += rt_perf_read(RT_PERF_CYCLES);
+    pEntry->instr += rt_perf_read(RT_PERF_INSTR);
+
+    if (plp_profile_state.extraEvent >= 0) {
+        pEntry->extra += rt_perf_read(plp_profile_state.extraEvent);
+    }
+}
+
+/**
+  @brief         Prints the profiling table, one line per function.
+  @return        none
+ */
+
+void plp_profile_dump(void) {
+
+    plp_profile_entry *pEntry;
+    uint32_t id;
+
+    printf("%-40s %8s %10s %10s %10s\n", "function", "calls", "cycles", "instr", "extra");
+
+    for (id = 0; id < plp_profile_state.numEntries; id++) {
+        pEntry = &plp_profile_state.pTable[id];
+        printf("%-40s %8u %10u %10u %10u\n", pEntry->name, (unsigned int)pEntry->calls,
+               (unsigned int)pEntry->cycles, (unsigned int)pEntry->instr,
+               (unsigned int)pEntry->extra);
+    }
+}
+
+/**
+  @} end of Profile group
+ */
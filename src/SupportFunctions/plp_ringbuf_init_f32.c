@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ringbuf_init_f32.c
+ * Description:  32-bit floating-point ring buffer initialization and view
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup RingBuf
+  @{
+ */
+
+/**
+  @brief         Initialization function for the 32-bit floating-point ring buffer. All samples are
+                 set to zero.
+  @param[out]    S            points to the 32-bit floating-point ring buffer instance
+  @param[in]     pBuf         points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+  @param[in]     size         number of samples which are kept, at least 1
+  @return        none
+ */
+
+void plp_ringbuf_init_f32(plp_ringbuf_instance_f32 *S, float32_t *pBuf, uint32_t size) {
+
+    uint32_t i;
+
+    S->pBuf = pBuf;
+    S->size = size;
+    S->head = 0;
+
+    for (i = 0; i < 2 * size; i++) {
+        pBuf[i] = 0;
+    }
+}
+
+/**
+  @brief         Returns a contiguous view of the most recent samples of the 32-bit floating-point
+                 ring buffer.
+  @param[in]     S            points to the 32-bit floating-point ring buffer instance
+  @param[in]     n            number of samples, at most size
+  @return        pointer to the oldest of the last n samples, which are followed by the newer
+                 ones up to the last sample written. The view is valid until the next write.
+ */
+
+float32_t *plp_ringbuf_view_f32(const plp_ringbuf_instance_f32 *S, uint32_t n) {
+
+    return S->pBuf + S->head + S->size - n;
+}
+
+/**
+  @} end of RingBuf group
+ */
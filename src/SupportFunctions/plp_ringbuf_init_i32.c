@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ringbuf_init_i32.c
+ * Description:  32-bit integer ring buffer initialization and view
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup RingBuf Ring Buffer
+  This module contains a ring buffer for the delay lines of streaming filters, which keeps the
+  last size samples written to it. The buffer stores every sample twice, at position i and at
+  position i + size, such that the last n samples (n <= size) are always contiguous in memory:
+  <pre>
+      plp_ringbuf_init_i32(&S, pBuf, size);      // pBuf holds PLP_RINGBUF_BUFFER_SIZE(size)
+      plp_ringbuf_write_i32(&S, pSrc, blockSize); // append the new block
+      pX = plp_ringbuf_view_i32(&S, n);          // x[t - n + 1], ..., x[t]
+  </pre>
+  Writing a block costs two stores per sample, independent of the length of the delay line, while
+  shifting a linear delay line costs one load and store per sample of the history. Reading never
+  has to wrap around, and a filter can work on the view directly instead of a copy.
+ */
+
+/**
+  @addtogroup RingBuf
+  @{
+ */
+
+/**
+  @brief         Initialization function for the 32-bit integer ring buffer. All samples are set to
+                 zero.
+  @param[out]    S            points to the 32-bit integer ring buffer instance
+  @param[in]     pBuf         points to the buffer of PLP_RINGBUF_BUFFER_SIZE(size) samples
+  @param[in]     size         number of samples which are kept, at least 1
+  @return        none
+ */
+
+void plp_ringbuf_init_i32(plp_ringbuf_instance_i32 *S, int32_t *pBuf, uint32_t size) {
+
+    uint32_t i;
+
+    S->pBuf = pBuf;
+    S->size = size;
+    S->head = 0;
+
+    for (i = 0; i < 2 * size; i++) {
+        pBuf[i] = 0;
+    }
+}
+
+/**
+  @brief         Returns a contiguous view of the most recent samples of the 32-bit integer ring
+                 buffer.
+  @param[in]     S            points to the 32-bit integer ring buffer instance
+  @param[in]     n            number of samples, at most size
+  @return        pointer to the oldest of the last n samples, which are followed by the newer
+                 ones up to the last sample written. The view is valid until the next write.
+ */
+
+int32_t *plp_ringbuf_view_i32(const plp_ringbuf_instance_i32 *S, uint32_t n) {
+
+    return S->pBuf + S->head + S->size - n;
+}
+
+/**
+  @} end of RingBuf group
+ */
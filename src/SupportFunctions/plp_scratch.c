@@ -0,0 +1,235 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scratch.c
+ * Description:  Scratch arena for the temporary buffers of the library
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Scratch Scratch Arena
+  Provides the temporary buffers which some functions need internally (e.g. plp_conv_i16,
+  plp_conv_valid_rep_i16 or plp_mat_mult_f32_tiled) from a buffer given by the application.
+
+  By default, the temporary buffers are allocated with rt_alloc. After plp_scratch_init, they are
+  taken from the given buffer instead, with a simple bump pointer:
+  <pre>
+      plp_scratch_init(pBuffer, size);   // pBuffer is usually a static buffer in L1
+      plp_conv_valid_rep_i16(...);        // temporaries are taken from pBuffer
+  </pre>
+  Freeing a buffer releases it together with all buffers allocated after it. The library frees its
+  temporaries before returning, so the arena is empty again after every top-level call, and there
+  is neither allocator latency nor fragmentation. plp_scratch_peak returns the largest number of
+  bytes that were in use at the same time, which is the worst-case memory use of the calls so far.
+
+  Only cluster data (RT_ALLOC_CL_DATA) is taken from the arena, all other requests still use
+  rt_alloc. If the arena is too small, plp_scratch_alloc returns NULL. The arena is not thread
+  safe, it must only be used by the core which calls the library functions.
+
+  With PLP_DETERMINISTIC, the library never calls rt_alloc or rt_free: all temporary buffers,
+  including the ones in FC memory, are taken from the arena, and plp_scratch_alloc returns NULL
+  if no arena is given. The size of the arena is then found with plp_scratch_peak in a test run.
+
+  The L1 memory is split into PLP_L1_BANKS banks, word by word. Cores which access the same bank
+  in the same cycle stall, and buffers of the same size, which are allocated one after the other,
+  often start in the same bank and are then accessed in lockstep. plp_l1_alloc allocates a buffer
+  which starts in a given bank, such that the operands of a kernel can be staggered over the
+  banks:
+  <pre>
+      pA = plp_l1_alloc(size, 0);                    // starts in bank 0
+      pB = plp_l1_alloc(size, PLP_L1_BANKS / 2);     // starts in bank 8
+  </pre>
+  Each buffer takes up to 4 * PLP_L1_BANKS bytes more than its size, and is freed with
+  plp_l1_free.
+ */
+
+/**
+  @addtogroup Scratch
+  @{
+ */
+
+static struct {
+    uint8_t *pStart; // start of the arena
+    uint8_t *pEnd;   // end of the arena
+    uint8_t *pTop;   // first free byte
+    uint32_t peak;   // largest number of bytes in use
+} plp_scratch_state = { NULL, NULL, NULL, 0 };
+
+/**
+  @brief         Uses the given buffer for the temporary buffers of the library. Passing NULL
+                 restores the allocation with rt_alloc.
+  @param[in]     pBuffer    points to the buffer, NULL to disable the arena
+  @param[in]     size       size of the buffer in bytes
+  @return        none
+ */
+
+void plp_scratch_init(void *pBuffer, uint32_t size) {
+
+    uint8_t *pStart = (uint8_t *)pBuffer;
+
+    if (pStart == NULL) {
+        size = 0;
+    }
+
+    plp_scratch_state.pStart = pStart;
+    plp_scratch_state.pEnd = pStart + size;
+    plp_scratch_state.pTop = pStart;
+    plp_scratch_state.peak = 0;
+}
+
+/**
+  @brief         Allocates a temporary buffer, with the same arguments as rt_alloc.
+  @param[in]     flags      memory in which the buffer is allocated (RT_ALLOC_*)
+  @param[in]     size       size of the buffer in bytes
+  @return        pointer to the buffer, aligned to 4 bytes, or NULL if there is not enough memory
+ */
+
+void *plp_scratch_alloc(int flags, uint32_t size) {
+
+    uint8_t *p = plp_scratch_state.pTop;
+    uint32_t used;
+
+#if defined(PLP_DETERMINISTIC)
+    if (plp_scratch_state.pStart == NULL) {
+        return NULL;
+    }
+#else
+    if (plp_scratch_state.pStart == NULL || flags != RT_ALLOC_CL_DATA) {
+        return rt_alloc(flags, size);
+    }
+#endif
+
+    /* keep the buffers word aligned */
+    size = (size + 3U) & ~3U;
+
+    if (size > (uint32_t)(plp_scratch_state.pEnd - p)) {
+        return NULL;
+    }
+
+    plp_scratch_state.pTop = p + size;
+
+    used = (uint32_t)(plp_scratch_state.pTop - plp_scratch_state.pStart);
+    if (used > plp_scratch_state.peak) {
+        plp_scratch_state.peak = used;
+    }
+
+    return (void *)p;
+}
+
+/**
+  @brief         Frees a temporary buffer, with the same arguments as rt_free. A buffer of the arena
+                 is released together with all buffers allocated after it.
+  @param[in]     flags      memory in which the buffer was allocated (RT_ALLOC_*)
+  @param[in]     pBuffer    points to the buffer
+  @param[in]     size       size of the buffer in bytes
+  @return        none
+ */
+
+void plp_scratch_free(int flags, void *pBuffer, uint32_t size) {
+
+    uint8_t *p = (uint8_t *)pBuffer;
+
+    if (p == NULL) {
+        return;
+    }
+
+    if (p < plp_scratch_state.pStart || p >= plp_scratch_state.pEnd) {
+#if !defined(PLP_DETERMINISTIC)
+        rt_free(flags, pBuffer, size);
+#endif
+        return;
+    }
+
+    if (p < plp_scratch_state.pTop) {
+        plp_scratch_state.pTop = p;
+    }
+}
+
+/* bytes in front of a buffer of plp_l1_alloc: the pointer to free, and the words which move the
+   buffer to its bank */
+#define PLP_L1_ALLOC_EXTRA (sizeof(void *) + sizeof(uint32_t) * (PLP_L1_BANKS - 1))
+
+/**
+  @brief         Allocates a temporary buffer in L1, like plp_scratch_alloc with RT_ALLOC_CL_DATA,
+                 which starts in the given TCDM bank. Buffers which are accessed at the same time
+                 are given different banks.
+  @param[in]     size       size of the buffer in bytes
+  @param[in]     bankOffset bank of the first word of the buffer, modulo PLP_L1_BANKS
+  @return        pointer to the buffer, or NULL if there is not enough memory
+ */
+
+void *plp_l1_alloc(uint32_t size, uint32_t bankOffset) {
+
+    uint8_t *pRaw = (uint8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, size + PLP_L1_ALLOC_EXTRA);
+    uint8_t *pBuffer;
+    uint32_t words;
+
+    if (pRaw == NULL) {
+        return NULL;
+    }
+
+    /* the first word after the pointer to free, moved forward to the bank */
+    pBuffer = pRaw + sizeof(void *);
+    words = (bankOffset - ((uintptr_t)pBuffer >> 2)) & (PLP_L1_BANKS - 1);
+    pBuffer += words * sizeof(uint32_t);
+
+    ((void **)pBuffer)[-1] = pRaw;
+
+    return (void *)pBuffer;
+}
+
+/**
+  @brief         Frees a buffer of plp_l1_alloc.
+  @param[in]     pBuffer    points to the buffer
+  @param[in]     size       size of the buffer in bytes
+  @return        none
+ */
+
+void plp_l1_free(void *pBuffer, uint32_t size) {
+
+    if (pBuffer == NULL) {
+        return;
+    }
+
+    plp_scratch_free(RT_ALLOC_CL_DATA, ((void **)pBuffer)[-1], size + PLP_L1_ALLOC_EXTRA);
+}
+
+/**
+  @brief         Returns the largest number of bytes of the arena that were in use at the same time
+                 since plp_scratch_init.
+  @return        peak usage of the arena in bytes
+ */
+
+uint32_t plp_scratch_peak(void) {
+    return plp_scratch_state.peak;
+}
+
+/**
+  @} end of Scratch group
+ */
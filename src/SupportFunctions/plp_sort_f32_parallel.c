@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_f32_parallel.c
+ * Description:  Glue code for the parallel sort of a 32-bit floating-point vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sort
+  @{
+ */
+
+/**
+  @brief         Glue code for the parallel in-place sort of a 32-bit floating-point vector in
+                 ascending order.
+  @param[in,out] pSrcDst      points to the vector, which is sorted in place
+  @param[in]     blockSize    number of elements in the vector
+  @param[in]     nPE          number of parallel processing units
+  @return        none
+ */
+
+void plp_sort_f32_parallel(float32_t *__restrict__ pSrcDst, uint32_t blockSize, uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_sort_f32_parallel), blockSize);
+        }
+
+        plp_sort_instance_f32 S = { .pSrcDst = pSrcDst, .blockSize = blockSize, .nPE = nPE };
+
+        rt_team_fork(nPE, plp_sort_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of Sort group
+ */
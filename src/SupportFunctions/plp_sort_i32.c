@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_i32.c
+ * Description:  Glue code for the sort of a 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Sort Sort
+  This module contains the in-place sort of a vector in ascending order, and the parallel sort,
+  which merges the sorted chunks of the cores with a bitonic network.
+ */
+
+/**
+  @addtogroup Sort
+  @{
+ */
+
+/**
+  @brief         Glue code for the in-place sort of a 32-bit integer vector in ascending order.
+  @param[in,out] pSrcDst      points to the vector, which is sorted in place
+  @param[in]     blockSize    number of elements in the vector
+  @return        none
+ */
+
+void plp_sort_i32(int32_t *__restrict__ pSrcDst, uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sort_i32s_rv32im(pSrcDst, blockSize);
+    } else {
+        plp_sort_i32s_xpulpv2(pSrcDst, blockSize);
+    }
+}
+
+/**
+  @} end of Sort group
+ */
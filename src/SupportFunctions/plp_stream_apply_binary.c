@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_apply_binary.c
+ * Description:  Glue code for streaming a binary element-wise kernel over L2 vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+/**
+  @brief         Glue code for running a binary element-wise kernel over two vectors in L2.
+  @param[in]     kernel     serial kernel of the cluster, called by every core on its part of a
+                            chunk
+  @param[in]     pSrcA      points to the first input vector in L2
+  @param[in]     pSrcB      points to the second input vector in L2
+  @param[in]     srcSize    size of an input element in bytes
+  @param[in]     dstSize    size of an output element in bytes
+  @param[in]     blockSize  number of elements
+  @param[in]     chunkSize  number of elements per chunk, 0 for the whole vector
+  @param[in]     nPE        number of cores, or PLP_AUTO
+  @param[out]    pDst       points to the output vector in L2
+  @return        none
+ */
+
+void plp_stream_apply_binary(plp_stream_binary_fn kernel,
+                             const void *pSrcA,
+                             const void *pSrcB,
+                             uint32_t srcSize,
+                             uint32_t dstSize,
+                             uint32_t blockSize,
+                             uint32_t chunkSize,
+                             uint32_t nPE,
+                             void *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (blockSize == 0) {
+            return;
+        }
+
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_stream_apply_binary), blockSize);
+        }
+
+        // the parts of the cores start at word boundaries
+        if (chunkSize == 0 || chunkSize >= blockSize) {
+            chunkSize = blockSize;
+        } else {
+            chunkSize = (chunkSize + 0x3) & ~0x3;
+        }
+
+        uint32_t sizeA = (chunkSize * srcSize + 0x3) & ~0x3;
+        uint32_t sizeDst = (chunkSize * dstSize + 0x3) & ~0x3;
+        uint32_t memSize = 2 * (2 * sizeA + sizeDst);
+
+        uint8_t *pBuffer = (uint8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, memSize);
+
+        if (pBuffer == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_stream_instance args = {
+            .unary = NULL,
+            .binary = kernel,
+            .pSrcA = (const uint8_t *)pSrcA,
+            .pSrcB = (const uint8_t *)pSrcB,
+            .srcSize = srcSize,
+            .dstSize = dstSize,
+            .blockSize = blockSize,
+            .chunkSize = chunkSize,
+            .nPE = nPE,
+            .pBufA = { pBuffer, pBuffer + sizeA },
+            .pBufB = { pBuffer + 2 * sizeA, pBuffer + 3 * sizeA },
+            .pBufDst = { pBuffer + 4 * sizeA, pBuffer + 4 * sizeA + sizeDst },
+            .pDst = (uint8_t *)pDst
+        };
+
+        rt_team_fork(nPE, plp_stream_p_xpulpv2, (void *)&args);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pBuffer, memSize);
+    }
+}
+
+/**
+  @} end of Stream group
+ */
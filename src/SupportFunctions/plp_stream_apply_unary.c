@@ -0,0 +1,143 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_apply_unary.c
+ * Description:  Glue code for streaming a unary element-wise kernel over L2 vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Stream Streaming of Element-Wise Kernels
+  Runs an element-wise kernel over vectors in L2, which are copied into L1 chunk by chunk with the
+  cluster DMA.
+
+  The element-wise functions, e.g. plp_add_i32 or plp_abs_i16, load every element from the memory
+  they are given. If the vectors are in L2, every load waits for the interconnect. The streaming
+  functions instead copy a chunk of chunkSize elements of the inputs into L1, while the cores run
+  the kernel on the previous chunk, and write the results back to L2 in the same way. Both copies
+  and the output are double buffered (ping-pong), so the DMA transfers overlap with the
+  computation. The buffers are allocated in L1 by the glue code, and require
+
+      `2 * chunkSize * (numInputs * srcSize + dstSize)` bytes
+
+  Any serial kernel of the cluster with the arguments (pSrc, pDst, blockSize) or (pSrcA, pSrcB,
+  pDst, blockSize) can be streamed, by casting it to plp_stream_unary_fn or plp_stream_binary_fn:
+  <pre>
+      plp_stream_apply_binary((plp_stream_binary_fn)plp_add_i32s_xpulpv2, pA, pB, sizeof(int32_t),
+                              sizeof(int32_t), blockSize, 1024, PLP_AUTO, pDst);
+  </pre>
+  The element sizes of the input and the output may differ, e.g. for the conversions. A kernel with
+  further arguments (e.g. the fixed-point functions with deciPoint) is wrapped by a small function
+  with these arguments, which reads the further ones from global variables. Every core calls the
+  kernel on its part of the chunk, so the kernel must not depend on the position in the vector.
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+/**
+  @brief         Glue code for running a unary element-wise kernel over a vector in L2.
+  @param[in]     kernel     serial kernel of the cluster, called by every core on its part of a
+                            chunk
+  @param[in]     pSrc       points to the input vector in L2
+  @param[in]     srcSize    size of an input element in bytes
+  @param[in]     dstSize    size of an output element in bytes
+  @param[in]     blockSize  number of elements
+  @param[in]     chunkSize  number of elements per chunk, 0 for the whole vector
+  @param[in]     nPE        number of cores, or PLP_AUTO
+  @param[out]    pDst       points to the output vector in L2
+  @return        none
+ */
+
+void plp_stream_apply_unary(plp_stream_unary_fn kernel,
+                            const void *pSrc,
+                            uint32_t srcSize,
+                            uint32_t dstSize,
+                            uint32_t blockSize,
+                            uint32_t chunkSize,
+                            uint32_t nPE,
+                            void *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (blockSize == 0) {
+            return;
+        }
+
+        if (nPE == PLP_AUTO) {
+            nPE = plp_auto_npe(PLP_AUTO_ID(plp_stream_apply_unary), blockSize);
+        }
+
+        // the parts of the cores start at word boundaries
+        if (chunkSize == 0 || chunkSize >= blockSize) {
+            chunkSize = blockSize;
+        } else {
+            chunkSize = (chunkSize + 0x3) & ~0x3;
+        }
+
+        uint32_t sizeA = (chunkSize * srcSize + 0x3) & ~0x3;
+        uint32_t sizeDst = (chunkSize * dstSize + 0x3) & ~0x3;
+        uint32_t memSize = 2 * (sizeA + sizeDst);
+
+        uint8_t *pBuffer = (uint8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, memSize);
+
+        if (pBuffer == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_stream_instance args = {
+            .unary = kernel,
+            .binary = NULL,
+            .pSrcA = (const uint8_t *)pSrc,
+            .pSrcB = NULL,
+            .srcSize = srcSize,
+            .dstSize = dstSize,
+            .blockSize = blockSize,
+            .chunkSize = chunkSize,
+            .nPE = nPE,
+            .pBufA = { pBuffer, pBuffer + sizeA },
+            .pBufB = { NULL, NULL },
+            .pBufDst = { pBuffer + 2 * sizeA, pBuffer + 2 * sizeA + sizeDst },
+            .pDst = (uint8_t *)pDst
+        };
+
+        rt_team_fork(nPE, plp_stream_p_xpulpv2, (void *)&args);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pBuffer, memSize);
+    }
+}
+
+/**
+  @} end of Stream group
+ */
@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_subteams_run.c
+ * Description:  Runs parallel kernels concurrently on disjoint subsets of the cores
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Team
+ */
+
+/**
+  @defgroup SubTeams Sub-Teams
+  Runs independent parallel kernels at the same time on disjoint subsets of the cluster cores.
+
+  A _parallel glue function forks all of its cores for one kernel, so two small parallel
+  functions run one after the other, even if neither of them scales to all cores. With sub-teams,
+  e.g. a 4-core FIR filter and a 4-core FFT run next to each other with a single fork:
+  <pre>
+      plp_subteam teams[2] = { { plp_fir_i16p_xpulpv2, &firArgs, 4 },
+                               { plp_cfft_q16p_xpulpv2, &fftArgs, 4 } };
+
+      plp_subteams_run(teams, 2);
+  </pre>
+  The sub-teams get consecutive cores in the given order. Every sub-team has its own event unit
+  barrier, and within a sub-team, plp_core_id() counts the cores from 0, so any parallel kernel
+  (*p_xpulpv2) runs unchanged, with nPE of its instance struct equal to nPE of the sub-team. A
+  chain of kernels runs in a sub-team with plp_team_p_xpulpv2 and a plp_team_instance as args.
+
+  The sub-teams must not share buffers which any of them writes, and must not use more than
+  rt_nb_pe() cores together. At most PLP_SUBTEAMS_MAX sub-teams run at the same time.
+ */
+
+/**
+  @addtogroup SubTeams
+  @{
+ */
+
+/**
+  @brief         Runs parallel kernels concurrently on disjoint subsets of the cluster cores, each
+                 with its own barrier, and waits until all of them are finished.
+  @param[in]     pTeams     points to the sub-teams, which get consecutive cores in this order
+  @param[in]     numTeams   number of sub-teams, at most PLP_SUBTEAMS_MAX
+  @return        none
+ */
+
+void plp_subteams_run(const plp_subteam *pTeams, uint32_t numTeams) {
+
+    plp_subteams_instance args = { .pTeams = pTeams, .numTeams = numTeams };
+    uint32_t nPE = 0;
+    uint32_t t, i;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    for (t = 0; t < numTeams; t++) {
+        nPE += pTeams[t].nPE;
+    }
+
+    if (numTeams == 0 || numTeams > PLP_SUBTEAMS_MAX || nPE > (uint32_t)rt_nb_pe()) {
+        printf("the sub-teams need more cores or barriers than the cluster has\n");
+        return;
+    }
+
+    /* barrier 0 belongs to the whole team, the sub-teams use the barriers 1 to numTeams */
+    nPE = 0;
+    for (t = 0; t < numTeams; t++) {
+        eu_bar_setup(eu_bar_addr(t + 1), ((1U << pTeams[t].nPE) - 1U) << nPE);
+        for (i = nPE; i < nPE + pTeams[t].nPE; i++) {
+            plp_subteam_cores[i].firstCore = nPE;
+            plp_subteam_cores[i].barrier = t + 1;
+        }
+        nPE += pTeams[t].nPE;
+    }
+
+    rt_team_fork(nPE, plp_subteams_p_xpulpv2, (void *)&args);
+
+    for (i = 0; i < nPE; i++) {
+        plp_subteam_cores[i].firstCore = 0;
+        plp_subteam_cores[i].barrier = 0;
+    }
+}
+
+/**
+  @} end of SubTeams group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_table_to_l1.c
+ * Description:  Copies constant tables into the L1 memory of the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup TableToL1 Tables in L1
+  Copies a constant table from L2 into the L1 memory of the cluster, so that the kernels which use
+  it do not pay the L2 latency on every access. This is useful for the tables which are accessed
+  through a pointer of an instance struct, e.g. the twiddle factors and the bit reversal table of
+  the FFTs:
+  <pre>
+      plp_cfft_instance_q16 S = plp_cfft_sR_q16_len256;
+
+      S.pTwiddle = plp_table_to_l1(S.pTwiddle, 3 * 256 / 2 * sizeof(int16_t));
+      S.pBitRevTable = plp_table_to_l1(S.pBitRevTable, S.bitRevLength * sizeof(uint16_t));
+      plp_cfft_q16_parallel(&S, pSrc, 0, 1, 0, nPE); // reads the tables from L1
+  </pre>
+  The copy stays allocated until it is released with plp_table_free_l1. The tables of the fast
+  math functions are accessed directly, they can be placed into L1 when the library is built, see
+  PLP_L1_FAST_MATH_TABLES in plp_common_tables.h. With PLP_QUARTER_WAVE_TABLES, the fixed-point
+  FFTs have no twiddle factor table to copy, they read the quarter-wave table of the fast math
+  functions.
+ */
+
+/**
+  @addtogroup TableToL1
+  @{
+ */
+
+/**
+  @brief         Copies a table from L2 into L1. On the cluster the copy is done with the DMA.
+  @param[in]     pTable     points to the table in L2
+  @param[in]     size       size of the table in bytes
+  @return        pointer to the copy in L1, or NULL if there is not enough memory
+ */
+
+void *plp_table_to_l1(const void *pTable, uint32_t size) {
+
+    uint8_t *pL1 = (uint8_t *)rt_alloc(RT_ALLOC_CL_DATA, size);
+    const uint8_t *pSrc = (const uint8_t *)pTable;
+    uint32_t i;
+
+    if (pL1 == NULL) {
+        return NULL;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (i = 0; i < size; i++) {
+            pL1[i] = pSrc[i];
+        }
+    } else {
+        plp_copy_i8_dma((const int8_t *)pSrc, (int8_t *)pL1, size, RT_DMA_DIR_EXT2LOC);
+    }
+
+    return pL1;
+}
+
+/**
+  @brief         Releases a table copied with plp_table_to_l1.
+  @param[in]     pTable     points to the copy in L1
+  @param[in]     size       size of the table in bytes
+  @return        none
+ */
+
+void plp_table_free_l1(void *pTable, uint32_t size) { rt_free(RT_ALLOC_CL_DATA, pTable, size); }
+
+/**
+  @} end of TableToL1 group
+ */
@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_team_add.c
+ * Description:  Adds a parallel kernel to a team
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Team
+  @{
+ */
+
+/**
+  @brief         Adds a parallel kernel to the team. The kernel runs on all cores of the team after
+                 the previously added kernels are finished on all cores.
+  @param[in,out] team       points to the team instance
+  @param[in]     kernel     parallel kernel, called by every core with args
+  @param[in]     args       points to the instance struct of the kernel
+  @return        none
+ */
+
+void plp_team_add(plp_team_instance *team, void (*kernel)(void *), void *args) {
+
+    if (team->numTasks >= team->maxTasks) {
+        printf("Error: too many tasks for the team!\n");
+        return;
+    }
+
+    team->pTasks[team->numTasks].kernel = kernel;
+    team->pTasks[team->numTasks].args = args;
+    team->numTasks++;
+}
+
+/**
+  @} end of Team group
+ */
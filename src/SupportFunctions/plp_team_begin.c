@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_team_begin.c
+ * Description:  Starts recording a chain of parallel kernels
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Team Parallel Team
+  Runs a chain of parallel kernels with a single fork of the cluster cores.
+
+  Every _parallel glue function forks the cores with rt_team_fork and joins them again, which is
+  a large overhead for short kernels. With a team, the kernels are recorded first and executed by
+  one fork, separated only by a barrier:
+  <pre>
+      plp_team_instance team;
+      plp_team_task tasks[3];
+
+      plp_team_begin(&team, tasks, 3, nPE);
+      plp_team_add(&team, plp_mult_i16p_xpulpv2, &multArgs);
+      plp_team_add(&team, plp_clip_i16p_xpulpv2, &clipArgs);
+      plp_team_add(&team, plp_scale_i16p_xpulpv2, &scaleArgs);
+      plp_team_end(&team);
+  </pre>
+  Any parallel kernel (*p_xpulpv2), which takes its instance struct as argument, can be added, so
+  the same kernels can be used with the team and with the forking _parallel glue functions. The
+  instance structs must stay valid until plp_team_end returns, and their nPE must be the nPE of
+  the team. Work that the glue functions do after the fork (e.g. the reduction of partial results)
+  can be added as a task, which only does its work on core 0.
+ */
+
+/**
+  @addtogroup Team
+  @{
+ */
+
+/**
+  @brief         Starts recording a chain of parallel kernels, which run with a single fork.
+  @param[out]    team       points to the team instance
+  @param[in]     pTasks     points to the buffer for the recorded tasks
+  @param[in]     maxTasks   number of tasks which fit into pTasks
+  @param[in]     nPE        number of parallel processing units
+  @return        none
+ */
+
+void plp_team_begin(plp_team_instance *team,
+                    plp_team_task *pTasks,
+                    uint32_t maxTasks,
+                    uint32_t nPE) {
+
+    team->pTasks = pTasks;
+    team->maxTasks = maxTasks;
+    team->numTasks = 0;
+    team->nPE = nPE;
+}
+
+/**
+  @} end of Team group
+ */
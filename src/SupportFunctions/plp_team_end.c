@@ -0,0 +1,62 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_team_end.c
+ * Description:  Runs the recorded chain of parallel kernels
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Team
+  @{
+ */
+
+/**
+  @brief         Runs all kernels added to the team with a single fork of the cluster cores and
+                 waits until they are finished.
+  @param[in]     team       points to the team instance
+  @return        none
+ */
+
+void plp_team_end(plp_team_instance *team) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (team->numTasks > 0) {
+            rt_team_fork(team->nPE, plp_team_p_xpulpv2, (void *)team);
+        }
+        team->numTasks = 0;
+    }
+}
+
+/**
+  @} end of Team group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i16.c
+ * Description:  Glue code for the top-k selection of a 16-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup TopK
+  @{
+ */
+
+/**
+  @brief         Glue code for the top-k selection of a 16-bit integer vector.
+  @param[in]     pSrc         points to the input vector
+  @param[in]     blockSize    number of elements in the input vector
+  @param[in]     k            number of elements to select, at most blockSize
+  @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                              the k smallest elements, in ascending order
+  @param[out]    pDstVal      points to the k selected elements
+  @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+  @return        none
+ */
+
+void plp_topk_i16(const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t k,
+                  uint8_t largest,
+                  int16_t *__restrict__ pDstVal,
+                  uint32_t *__restrict__ pDstIdx) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_topk_i16s_rv32im(pSrc, blockSize, k, largest, pDstVal, pDstIdx);
+    } else {
+        plp_topk_i16s_xpulpv2(pSrc, blockSize, k, largest, pDstVal, pDstIdx);
+    }
+}
+
+/**
+  @} end of TopK group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i32.c
+ * Description:  Glue code for the top-k selection of a 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup TopK Top-k Selection
+  This module contains the selection of the k largest or smallest elements of a vector, e.g. the
+  best detection scores or the nearest neighbours. The selection keeps a sorted list of the k best
+  elements so far and inserts an element only if it is better than the last one of the list, which
+  needs about blockSize comparisons when k is small compared to blockSize, instead of a full sort.
+ */
+
+/**
+  @addtogroup TopK
+  @{
+ */
+
+/**
+  @brief         Glue code for the top-k selection of a 32-bit integer vector.
+  @param[in]     pSrc         points to the input vector
+  @param[in]     blockSize    number of elements in the input vector
+  @param[in]     k            number of elements to select, at most blockSize
+  @param[in]     largest      1: select the k largest elements, in descending order, 0: select
+                              the k smallest elements, in ascending order
+  @param[out]    pDstVal      points to the k selected elements
+  @param[out]    pDstIdx      points to the indices of the k selected elements in pSrc, or NULL
+  @return        none
+ */
+
+void plp_topk_i32(const int32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t k,
+                  uint8_t largest,
+                  int32_t *__restrict__ pDstVal,
+                  uint32_t *__restrict__ pDstIdx) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_topk_i32s_rv32im(pSrc, blockSize, k, largest, pDstVal, pDstIdx);
+    } else {
+        plp_topk_i32s_xpulpv2(pSrc, blockSize, k, largest, pDstVal, pDstIdx);
+    }
+}
+
+/**
+  @} end of TopK group
+ */
@@ -0,0 +1,439 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_trace.c
+ * Description:  Timeline trace and load balance of the parallel functions
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include <string.h>
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Trace Timeline Trace
+  Records when each core runs the kernel of a parallel function, to show load imbalance and idle
+  cores on a timeline. The library is built with PLP_TRACE=1, which makes every rt_team_fork of
+  the library (e.g. of the _parallel functions and of plp_conv_parallel_OLA) record the fork and
+  the join on the calling core, and the start and the end of the kernel and the arrival at and the
+  release from every barrier on each core. If the application is built with PLP_TRACE as well, its
+  own forks are recorded too:
+  <pre>
+      plp_trace_event trace[512];            // in L2
+
+      plp_trace_init(trace, 512);
+      plp_dot_prod_i16_parallel(...);        // recorded
+      plp_trace_dump();                      // prints the trace as JSON
+  </pre>
+  The printed JSON is saved to a file and opened with chrome://tracing or https://ui.perfetto.dev.
+  Each core is a thread of the timeline, with a slice for the fork (on the calling core), the
+  kernel and the waiting time at each barrier, so the stages of a kernel are separated by its
+  barriers.
+
+  The timestamps are read from the cluster timer, which is shared by all cores and counts cycles
+  from plp_trace_init; another time source can be given with PLP_TRACE_TIME when building the
+  library. The timer wraps around after 2^32 cycles. Every event costs a few cycles and an L2
+  access on its core, which the timeline includes. Without PLP_TRACE, nothing is recorded.
+
+  The same events also measure the load balance of every parallel kernel, without a ring buffer:
+  <pre>
+      plp_balance_entry table[16];
+
+      plp_balance_init(table, 16);
+      plp_mat_mult_i16_parallel(...);        // measured
+      plp_balance_dump();                    // prints busy and waiting cycles per kernel
+  </pre>
+  The busy cycles of a core are the cycles from the start to the end of the kernel, without the
+  cycles it waits at barriers. Its waiting cycles are the cycles at barriers and from its end to
+  the end of the last core of the fork. The imbalance of a kernel is the busy cycles of the slowest
+  core divided by the mean busy cycles of all cores, summed over all forks: 1.00 is a perfect
+  split, nPE means that one core does all the work.
+ */
+
+/**
+  @addtogroup Trace
+  @{
+ */
+
+/** Timestamp of an event in cycles, the same time base on all cores, and the start of its clock */
+#ifndef PLP_TRACE_TIME
+#define PLP_TRACE_TIME() timer_count_get(timer_base_cl(0, 0, 0))
+#define PLP_TRACE_TIME_START()                                                                     \
+    do {                                                                                           \
+        timer_reset(timer_base_cl(0, 0, 0));                                                       \
+        timer_start(timer_base_cl(0, 0, 0));                                                       \
+    } while (0)
+#else
+#define PLP_TRACE_TIME_START()
+#endif
+
+/** Largest nesting of slices on one core: fork, kernel and barrier */
+#define PLP_TRACE_DEPTH 4
+
+static struct {
+    plp_trace_event *pBuffer;     // ring buffers of all cores
+    uint32_t perCore;             // number of events per core, 0 if not tracing
+    uint32_t origin;              // time of plp_trace_init
+    uint32_t next[PLP_MAX_PE];    // next event of each core
+    uint8_t wrapped[PLP_MAX_PE];  // whether the ring of the core is full
+    void (*kernel)(void *);       // kernel of the current fork
+    void *arg;                    // its argument
+    const char *name;             // and its name
+    uint32_t nPE;                 // and its number of cores
+    uint32_t fork;                // time of the fork
+    uint32_t start[PLP_MAX_PE];   // start of the kernel on each core
+    uint32_t end[PLP_MAX_PE];     // end of the kernel on each core
+    uint32_t arrival[PLP_MAX_PE]; // arrival at the current barrier
+    uint32_t waited[PLP_MAX_PE];  // cycles at the barriers of the kernel
+    plp_balance_entry *pBalance;  // load balance table, NULL if not measured
+    uint32_t balanceSize;         // number of entries of the table
+    uint32_t numBalance;          // number of used entries
+    uint32_t clock;               // whether the clock of the timestamps runs
+} plp_trace_state;
+
+/* starts the clock of the timestamps, once for the trace and the load balance */
+static void plp_trace_clock(void) {
+
+    if (!plp_trace_state.clock) {
+        PLP_TRACE_TIME_START();
+        plp_trace_state.clock = 1;
+    }
+}
+
+/**
+  @brief         Starts the timeline trace of the parallel functions. The events of each core are
+                 recorded into its own ring buffer, a part of the given buffer, in which the newest
+                 events replace the oldest ones.
+  @param[in]     pBuffer    points to the buffer in L2, NULL to stop the trace
+  @param[in]     size       number of events which fit into the buffer
+  @return        none
+ */
+
+void plp_trace_init(plp_trace_event *pBuffer, uint32_t size) {
+
+    uint32_t i;
+
+    plp_trace_state.perCore = 0;
+
+    plp_trace_clock();
+
+    for (i = 0; i < PLP_MAX_PE; i++) {
+        plp_trace_state.next[i] = 0;
+        plp_trace_state.wrapped[i] = 0;
+    }
+
+    plp_trace_state.pBuffer = pBuffer;
+    plp_trace_state.origin = PLP_TRACE_TIME();
+    plp_trace_state.perCore = (pBuffer == NULL) ? 0 : size / PLP_MAX_PE;
+}
+
+/**
+  @brief         Records an event on the calling core.
+  @param[in]     type       event, PLP_TRACE_*
+  @param[in]     name       name of the kernel, or NULL
+  @return        none
+ */
+
+void plp_trace_record(uint32_t type, const char *name) {
+
+    uint32_t core = rt_core_id();
+    uint32_t time = PLP_TRACE_TIME();
+    plp_trace_event *pEvent;
+
+    if (core >= PLP_MAX_PE) {
+        return;
+    }
+
+    /* the load balance of the kernel */
+    switch (type) {
+    case PLP_TRACE_FORK:
+        plp_trace_state.fork = time;
+        break;
+    case PLP_TRACE_START:
+        plp_trace_state.start[core] = time;
+        plp_trace_state.waited[core] = 0;
+        break;
+    case PLP_TRACE_END:
+        plp_trace_state.end[core] = time;
+        break;
+    case PLP_TRACE_BARRIER:
+        plp_trace_state.arrival[core] = time;
+        break;
+    case PLP_TRACE_RELEASE:
+        plp_trace_state.waited[core] += time - plp_trace_state.arrival[core];
+        break;
+    default:
+        break;
+    }
+
+    if (plp_trace_state.perCore == 0) {
+        return;
+    }
+
+    pEvent = plp_trace_state.pBuffer + core * plp_trace_state.perCore + plp_trace_state.next[core];
+    pEvent->time = time - plp_trace_state.origin;
+    pEvent->type = type;
+    pEvent->name = name;
+
+    if (++plp_trace_state.next[core] == plp_trace_state.perCore) {
+        plp_trace_state.next[core] = 0;
+        plp_trace_state.wrapped[core] = 1;
+    }
+}
+
+/* adds the busy and waiting cycles of the cores of the last fork to the entry of its kernel */
+static void plp_trace_balance(const char *name) {
+
+    plp_balance_entry *pTable = plp_trace_state.pBalance;
+    uint32_t nPE = plp_trace_state.nPE;
+    uint32_t lastEnd, busy, maxBusy, sumBusy, sumWait, id, i;
+
+    for (id = 0; id < plp_trace_state.numBalance; id++) {
+        if (pTable[id].name == name || strcmp(pTable[id].name, name) == 0) {
+            break;
+        }
+    }
+
+    if (id == plp_trace_state.numBalance) {
+        if (id == plp_trace_state.balanceSize) {
+            return;
+        }
+
+        memset(&pTable[id], 0, sizeof(plp_balance_entry));
+        pTable[id].name = name;
+        plp_trace_state.numBalance++;
+    }
+
+    /* the times are relative to the fork, such that the timer may wrap around during the kernel */
+    lastEnd = 0;
+    for (i = 0; i < nPE; i++) {
+        if (plp_trace_state.end[i] - plp_trace_state.fork > lastEnd) {
+            lastEnd = plp_trace_state.end[i] - plp_trace_state.fork;
+        }
+    }
+
+    maxBusy = 0;
+    sumBusy = 0;
+    sumWait = 0;
+    for (i = 0; i < nPE; i++) {
+        busy = plp_trace_state.end[i] - plp_trace_state.start[i] - plp_trace_state.waited[i];
+        if (busy > maxBusy) {
+            maxBusy = busy;
+        }
+        sumBusy += busy;
+        sumWait += plp_trace_state.waited[i] + lastEnd -
+                   (plp_trace_state.end[i] - plp_trace_state.fork);
+    }
+
+    pTable[id].calls++;
+    pTable[id].cycles += PLP_TRACE_TIME() - plp_trace_state.fork;
+    pTable[id].busy += sumBusy;
+    pTable[id].wait += sumWait;
+    pTable[id].maxBusy += maxBusy;
+    pTable[id].meanBusy += sumBusy / nPE;
+}
+
+/* entry of every core of a traced fork */
+static void plp_trace_kernel(void *args) {
+
+    plp_trace_record(PLP_TRACE_START, plp_trace_state.name);
+    plp_trace_state.kernel(plp_trace_state.arg);
+    plp_trace_record(PLP_TRACE_END, NULL);
+}
+
+/**
+  @brief         Forks the cores like rt_team_fork and records the fork, the join and the start and
+                 the end of the kernel on every core. With PLP_TRACE, rt_team_fork is replaced by
+                 this function.
+  @param[in]     nPE        number of cores
+  @param[in]     kernel     kernel which runs on every core
+  @param[in]     arg        argument of the kernel
+  @param[in]     name       name of the kernel
+  @return        none
+ */
+
+void plp_trace_fork(int nPE, void (*kernel)(void *), void *arg, const char *name) {
+
+    /* not tracing, or a fork inside a traced fork (which the runtime does not support anyway) */
+    if ((plp_trace_state.perCore == 0 && plp_trace_state.pBalance == NULL) ||
+        plp_trace_state.kernel != NULL) {
+        (rt_team_fork)(nPE, kernel, arg);
+        return;
+    }
+
+    plp_trace_record(PLP_TRACE_FORK, name);
+
+    plp_trace_state.kernel = kernel;
+    plp_trace_state.arg = arg;
+    plp_trace_state.name = name;
+    plp_trace_state.nPE = (nPE <= 0 || nPE > PLP_MAX_PE) ? rt_nb_pe() : nPE;
+    (rt_team_fork)(nPE, plp_trace_kernel, NULL);
+    plp_trace_state.kernel = NULL;
+
+    if (plp_trace_state.pBalance != NULL) {
+        plp_trace_balance(name);
+    }
+
+    plp_trace_record(PLP_TRACE_JOIN, NULL);
+}
+
+/* prints a slice of the timeline, the time is converted from cycles to microseconds */
+static void plp_trace_slice(uint32_t core, const char *name, const char *category,
+                            uint32_t begin, uint32_t end, uint32_t freq) {
+
+    uint64_t ts = (uint64_t)begin * 1000000000 / freq;
+    uint64_t dur = (uint64_t)(end - begin) * 1000000000 / freq;
+
+    printf(",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %u, "
+           "\"ts\": %u.%03u, \"dur\": %u.%03u}",
+           name, category, (unsigned int)core, (unsigned int)(ts / 1000),
+           (unsigned int)(ts % 1000), (unsigned int)(dur / 1000), (unsigned int)(dur % 1000));
+}
+
+/**
+  @brief         Prints the recorded events in the Chrome trace event format (JSON), which is opened
+                 by chrome://tracing and the Perfetto UI. Every core is a thread of the timeline.
+  @return        none
+ */
+
+void plp_trace_dump(void) {
+
+    static const char *const categories[3] = { "fork", "kernel", "barrier" };
+    uint32_t freq = rt_freq_get(RT_FREQ_DOMAIN_CL);
+    uint32_t perCore = plp_trace_state.perCore;
+    uint32_t core, i;
+    int first = 1;
+
+    printf("{\"displayTimeUnit\": \"ns\", \"traceEvents\": [");
+
+    for (core = 0; core < PLP_MAX_PE; core++) {
+        const plp_trace_event *pRing = plp_trace_state.pBuffer + core * perCore;
+        uint32_t count = plp_trace_state.wrapped[core] ? perCore : plp_trace_state.next[core];
+        uint32_t oldest = plp_trace_state.wrapped[core] ? plp_trace_state.next[core] : 0;
+        const plp_trace_event *pOpen[PLP_TRACE_DEPTH];
+        uint32_t depth = 0;
+
+        if (count == 0) {
+            continue;
+        }
+
+        printf("%s\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %u, "
+               "\"args\": {\"name\": \"core %u\"}}",
+               first ? "" : ",", (unsigned int)core, (unsigned int)core);
+        first = 0;
+
+        /* the events of a core are nested, each end event closes the last begin event; the end
+         * events of begin events which were replaced in the ring are skipped */
+        for (i = 0; i < count; i++) {
+            const plp_trace_event *pEvent = pRing + (oldest + i) % perCore;
+            const plp_trace_event *pBegin;
+
+            if ((pEvent->type & 0x1U) == 0) {
+                if (depth < PLP_TRACE_DEPTH) {
+                    pOpen[depth] = pEvent;
+                }
+                depth++;
+                continue;
+            }
+
+            if (depth == 0) {
+                continue;
+            }
+            depth--;
+            if (depth >= PLP_TRACE_DEPTH) {
+                continue;
+            }
+
+            pBegin = pOpen[depth];
+            plp_trace_slice(core, (pBegin->name != NULL) ? pBegin->name : "barrier",
+                            categories[pBegin->type >> 1], pBegin->time, pEvent->time, freq);
+        }
+    }
+
+    printf("\n]}\n");
+}
+
+/**
+  @brief         Starts measuring the load balance of the parallel kernels. The busy and waiting
+                 cycles of the cores are accumulated per kernel into the given table.
+  @param[in]     pTable     points to the table, with one entry per kernel, NULL to stop
+  @param[in]     size       number of entries of the table
+  @return        none
+ */
+
+void plp_balance_init(plp_balance_entry *pTable, uint32_t size) {
+
+    plp_trace_state.pBalance = NULL;
+
+    plp_trace_clock();
+
+    plp_trace_state.balanceSize = (pTable == NULL) ? 0 : size;
+    plp_trace_state.numBalance = 0;
+    plp_trace_state.pBalance = pTable;
+}
+
+/**
+  @brief         Prints the load balance table, one line per kernel.
+  @return        none
+ */
+
+void plp_balance_dump(void) {
+
+    plp_balance_entry *pEntry;
+    uint32_t id, imbalance;
+
+    printf("%-40s %8s %10s %10s %10s %9s\n", "kernel", "calls", "cycles", "busy", "wait",
+           "imbalance");
+
+    for (id = 0; id < plp_trace_state.numBalance; id++) {
+        pEntry = &plp_trace_state.pBalance[id];
+        imbalance = plp_balance_imbalance(pEntry);
+        printf("%-40s %8u %10u %10u %10u %6u.%02u\n", pEntry->name, (unsigned int)pEntry->calls,
+               (unsigned int)pEntry->cycles, (unsigned int)pEntry->busy,
+               (unsigned int)pEntry->wait, (unsigned int)(imbalance / 100),
+               (unsigned int)(imbalance % 100));
+    }
+}
+
+/**
+  @brief         Returns the imbalance of a kernel: the busy cycles of the slowest core divided by
+                 the mean busy cycles of all cores, summed over all forks.
+  @param[in]     pEntry     points to the entry of the kernel in the load balance table
+  @return        imbalance times 100, at least 100
+ */
+
+uint32_t plp_balance_imbalance(const plp_balance_entry *pEntry) {
+
+    if (pEntry->meanBusy == 0) {
+        return 100;
+    }
+
+    return (uint32_t)((uint64_t)pEntry->maxBusy * 100 / pEntry->meanBusy);
+}
+
+/**
+  @} end of Trace group
+ */
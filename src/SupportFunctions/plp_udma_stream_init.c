@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_udma_stream_init.c
+ * Description:  Double buffer for frames delivered by the uDMA of a peripheral
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup UdmaStream uDMA Stream
+  Double buffer for frames, which a peripheral (e.g. I2S or SPI) writes through the uDMA directly
+  into the memory from which the library functions read them.
+
+  Many stateful functions need the last samples of the previous frame in front of the new one: the
+  FIR filters the last numTaps - 1 samples, the STFT the last FFTLength - hopSize samples. Usually
+  the frame is first received into a buffer of the application and then copied into the state of
+  the function. With the uDMA stream, every buffer has room for this history (headSize bytes) in
+  front of the frame, and the uDMA writes the frame right behind it. When a frame is taken, its last
+  headSize bytes are copied in front of the other buffer, into which the uDMA is writing the next
+  frame meanwhile. The frame itself is never copied, only the history, which the stateful functions
+  move in every call anyway.
+  <pre>
+      plp_udma_stream_init(&stream, pBuffer, headSize, frameSize);
+      enqueue(plp_udma_stream_dst(&stream, 0), frameSize);
+      enqueue(plp_udma_stream_dst(&stream, 1), frameSize);
+      for (n = 0;; n++) {
+          wait for the transfer of frame n;
+          pFrame = plp_udma_stream_take(&stream);
+          process pFrame;
+          enqueue(plp_udma_stream_dst(&stream, n + 2), frameSize);
+      }
+  </pre>
+  where enqueue is the capture function of the peripheral driver, e.g. rt_i2s_capture or
+  rt_spim_receive.
+
+  The taken buffer is used as follows:
+  - FIR filters: with headSize = (numTaps - 1) * sizeof(sample), a copy of the FIR instance with
+    pState = pFrame, and pSrc = pFrame + numTaps - 1. The FIR kernels do not copy the samples if
+    they are already in the delay line.
+  - STFT: with headSize = (FFTLength - hopSize) * sizeof(sample) and frameSize = hopSize *
+    sizeof(sample), plp_stft_frame_f32 or plp_stft_frame_q16 transform pFrame directly.
+  - ring buffers: plp_udma_stream_view returns the last samples like plp_ringbuf_view_i32, up to
+    headSize + frameSize bytes.
+ */
+
+/**
+  @addtogroup UdmaStream
+  @{
+ */
+
+/**
+  @brief         Initialization function for the uDMA stream. The history in front of the first
+                 frame is set to zero.
+  @param[out]    S            points to the uDMA stream instance
+  @param[in]     pBuffer      points to a buffer of 2 * (headSize + frameSize) bytes, word aligned
+  @param[in]     headSize     number of bytes of history in front of every frame, a multiple of 4
+  @param[in]     frameSize    number of bytes of a frame, a multiple of 4
+  @return        none
+ */
+
+void plp_udma_stream_init(plp_udma_stream *S,
+                          void *pBuffer,
+                          uint32_t headSize,
+                          uint32_t frameSize) {
+
+    uint32_t *pHead = (uint32_t *)pBuffer;
+    uint32_t i;
+
+    S->pBuf[0] = (uint8_t *)pBuffer;
+    S->pBuf[1] = (uint8_t *)pBuffer + headSize + frameSize;
+    S->headSize = headSize;
+    S->frameSize = frameSize;
+    S->count = 0;
+
+    for (i = 0; i < headSize / 4; i++) {
+        pHead[i] = 0;
+    }
+}
+
+/**
+  @brief         Returns the address to which the peripheral writes a frame. The frames 0 and 1
+                 are enqueued at the start, frame n + 2 after frame n has been processed.
+  @param[in]     S            points to an initialized uDMA stream instance
+  @param[in]     frame        number of the frame
+  @return        address of frameSize bytes for the uDMA transfer of the frame
+ */
+
+void *plp_udma_stream_dst(const plp_udma_stream *S, uint32_t frame) {
+
+    return S->pBuf[frame & 0x1] + S->headSize;
+}
+
+/**
+  @brief         Returns a contiguous view of the most recent bytes of the uDMA stream.
+  @param[in]     S            points to a uDMA stream instance, from which a frame has been taken
+  @param[in]     n            number of bytes, at most headSize + frameSize
+  @return        pointer to the oldest of the last n bytes up to the end of the last frame taken
+ */
+
+void *plp_udma_stream_view(const plp_udma_stream *S, uint32_t n) {
+
+    return S->pBuf[(S->count - 1) & 0x1] + S->headSize + S->frameSize - n;
+}
+
+/**
+  @} end of UdmaStream group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_udma_stream_take.c
+ * Description:  Takes a frame delivered by the uDMA of a peripheral
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup UdmaStream
+  @{
+ */
+
+/**
+  @brief         Takes the next frame, after its uDMA transfer has finished, and copies its last
+                 headSize bytes in front of the following frame. The frame itself is not copied.
+  @param[in,out] S            points to an initialized uDMA stream instance
+  @return        pointer to the history of headSize bytes, which is followed by the frame. It is
+                 valid until the transfer of frame count + 2 is enqueued.
+
+  @par
+  The uDMA writes the following frame into the other buffer while the history is copied, behind
+  the history, so both do not overlap.
+ */
+
+void *plp_udma_stream_take(plp_udma_stream *S) {
+
+    uint8_t *pCur = S->pBuf[S->count & 0x1];
+    uint32_t *pHead = (uint32_t *)S->pBuf[(S->count + 1) & 0x1];
+    const uint32_t *pTail = (const uint32_t *)(pCur + S->frameSize);
+    uint32_t i;
+
+    for (i = 0; i < S->headSize / 4; i++) {
+        pHead[i] = pTail[i];
+    }
+
+    S->count++;
+
+    return pCur;
+}
+
+/**
+  @} end of UdmaStream group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_analytic_f32s_xpulpv2.c
+ * Description:  Floating-point analytic signal for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief FFT-based floating-point analytic signal for XPULPV2 extension.
+ * @param[in]   S     points to an instance of the floating-point complex FFT structure, whose
+ *                    length N is the length of the signal
+ * @param[in]   pSrc  points to the N real input samples
+ * @param[out]  pDst  points to the 2 * N values of the analytic signal, real and imaginary part
+ *                    interleaved, where the real part is the input and the imaginary part its
+ *                    Hilbert transform
+ * @return      none
+ */
+void plp_analytic_f32s_xpulpv2(const plp_cfft_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst) {
+
+    uint32_t N = S->fftLen;
+    uint32_t k;
+
+    for (k = 0; k < N; k++) {
+        pDst[2 * k] = pSrc[k];
+        pDst[2 * k + 1] = 0.0f;
+    }
+
+    plp_cfft_f32s_xpulpv2(S, pDst, 0, 1);
+
+    // keep the bins 0 and N / 2, double the positive and clear the negative frequencies
+    for (k = 1; k < N / 2; k++) {
+        pDst[2 * k] *= 2.0f;
+        pDst[2 * k + 1] *= 2.0f;
+    }
+    for (k = N / 2 + 1; k < N; k++) {
+        pDst[2 * k] = 0.0f;
+        pDst[2 * k + 1] = 0.0f;
+    }
+
+    plp_cfft_f32s_xpulpv2(S, pDst, 1, 1);
+}
+
+/**
+ * @} end of FFT group
+ */
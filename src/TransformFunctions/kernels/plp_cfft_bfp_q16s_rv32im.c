@@ -0,0 +1,135 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16s_rv32im.c
+ * Description:  Quantized 16-bit complex FFT with block floating point scaling for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Quantized 16 bit complex fast fourier transform with block floating point scaling
+ *                for RV32IM
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ *                                in Q1.15 format. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e of the output: the DFT, or the inverse DFT, is the output
+ *                multiplied by 2^e
+ *
+ * @par
+ * Radix-2 decimation in frequency with a = x[n] and b = x[n + span]:
+ * x[n] = (a + b) / 2^s and x[n + span] = (a - b) W^(j fftLen / (2 span)) / 2^s, where s is the
+ * shift of the stage. The magnitudes for the next shift are collected while the outputs of a
+ * stage are stored, such that the scaling needs no additional pass over the data.
+ */
+
+int32_t plp_cfft_bfp_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                 int16_t *p1,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag) {
+
+    uint32_t N = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    int32_t exponent = 0;
+    uint32_t bits = 0; // OR of the magnitudes of the block
+    uint32_t n, j, m, span, step, shift;
+    int32_t ar, ai, br, bi, dr, di, wr, wi;
+
+    for (n = 0; n < 2 * N; n++) {
+        bits |= p1[n] ^ (p1[n] >> 15);
+    }
+
+    // normalize small signals to 13 significant bits
+    if (bits != 0 && bits < (1u << 12)) {
+        shift = __builtin_clz(bits) - 19;
+        exponent -= shift;
+        bits <<= shift;
+        for (n = 0; n < 2 * N; n++) {
+            p1[n] = p1[n] << shift;
+        }
+    }
+
+    for (span = N / 2, step = PLP_TWIDDLE_STEP_Q16(N); span > 0; span >>= 1, step <<= 1) {
+
+        // least shift for which |a + b| and |(a - b) W| stay below 2^15
+        shift = (bits < (1u << 13)) ? 0 : ((bits < (1u << 14)) ? 1 : 2);
+        exponent += shift;
+        bits = 0;
+
+        for (j = 0; j < span; j++) {
+            // W^k = cos(2 pi k / N) - j sin(2 pi k / N)
+            wr = PLP_TWIDDLE_COS_Q16(pCoef, j * step);
+            wi = PLP_TWIDDLE_SIN_Q16(pCoef, j * step);
+            wi = ifftFlag ? -wi : wi;
+            for (n = j; n < N; n += 2 * span) {
+                ar = p1[2 * n] >> shift;
+                ai = p1[2 * n + 1] >> shift;
+                br = p1[2 * (n + span)] >> shift;
+                bi = p1[2 * (n + span) + 1] >> shift;
+                dr = ar - br;
+                di = ai - bi;
+                ar = ar + br;
+                ai = ai + bi;
+                br = (dr * wr + di * wi) >> 15;
+                bi = (di * wr - dr * wi) >> 15;
+                p1[2 * n] = ar;
+                p1[2 * n + 1] = ai;
+                p1[2 * (n + span)] = br;
+                p1[2 * (n + span) + 1] = bi;
+                bits |= (ar ^ (ar >> 31)) | (ai ^ (ai >> 31));
+                bits |= (br ^ (br >> 31)) | (bi ^ (bi >> 31));
+            }
+        }
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_rv32im((uint16_t *)p1, S->bitRevLength,
+                                   (const uint16_t *)S->pBitRevTable);
+
+    // the inverse DFT is scaled by 1 / N
+    if (ifftFlag) {
+        for (m = N; m > 1; m >>= 1) {
+            exponent--;
+        }
+    }
+
+    return exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,143 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16s_xpulpv2.c
+ * Description:  Quantized 16-bit complex FFT with block floating point scaling for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/* number of significant bits of the largest magnitude in the two halves of v */
+static inline uint32_t plp_cfft_bfp_bits_q16(v2s v) {
+
+    int32_t m = v[0] | v[1];
+    return 31 - __builtin_clrsb(m); // count leading bits, p.clb
+}
+
+/**
+ * @brief         Quantized 16 bit complex fast fourier transform with block floating point scaling
+ *                for XPULPV2
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ *                                in Q1.15 format. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e of the output: the DFT, or the inverse DFT, is the output
+ *                multiplied by 2^e
+ *
+ * @par Exploiting SIMD instructions
+ * Every complex sample is one packed vector, so the shifts, sums and differences of a butterfly
+ * take one SIMD instruction each, and the twiddle rotation takes two dot products. The
+ * magnitudes x ^ (x >> 15) of the outputs of a stage are ORed together as vectors, and the count
+ * leading bits instruction turns their OR into the number of significant bits of the block.
+ */
+
+int32_t plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint8_t ifftFlag,
+                                  uint8_t bitReverseFlag) {
+
+    uint32_t N = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    int32_t exponent = 0;
+    v2s mag = (v2s){ 0, 0 }; // OR of the magnitudes of the block
+    v2s sign = (v2s){ 15, 15 };
+    v2s a, b, t, w1, w2, sh;
+    uint32_t n, j, m, span, step, shift, bits;
+
+    for (n = 0; n < N; n++) {
+        a = *(v2s *)&p1[2 * n];
+        mag = mag | (a ^ __SRA2(a, sign));
+    }
+    bits = plp_cfft_bfp_bits_q16(mag);
+
+    // normalize small signals to 13 significant bits
+    if (bits > 0 && bits < 13) {
+        shift = 13 - bits;
+        exponent -= shift;
+        bits = 13;
+        sh = (v2s){ shift, shift };
+        for (n = 0; n < N; n++) {
+            *(v2s *)&p1[2 * n] = __SLL2(*(v2s *)&p1[2 * n], sh);
+        }
+    }
+
+    for (span = N / 2, step = PLP_TWIDDLE_STEP_Q16(N); span > 0; span >>= 1, step <<= 1) {
+
+        // least shift for which |a + b| and |(a - b) W| stay below 2^15
+        shift = (bits > 13) ? bits - 13 : 0;
+        exponent += shift;
+        sh = (v2s){ shift, shift };
+        mag = (v2s){ 0, 0 };
+
+        for (j = 0; j < span; j++) {
+            // (a - b) W^k = (dr cos + di sin) + j (di cos - dr sin), the inverse negates sin
+            w1 = PLP_TWIDDLE_V2S_Q16(pCoef, j * step);
+            if (ifftFlag) {
+                w1 = __PACK2(w1[0], -w1[1]);
+            }
+            w2 = __PACK2(-w1[1], w1[0]);
+            for (n = j; n < N; n += 2 * span) {
+                a = __SRA2(*(v2s *)&p1[2 * n], sh);
+                b = __SRA2(*(v2s *)&p1[2 * (n + span)], sh);
+                t = __SUB2(a, b);
+                a = __ADD2(a, b);
+                b = __PACK2(__DOTP2(t, w1) >> 15, __DOTP2(t, w2) >> 15);
+                *(v2s *)&p1[2 * n] = a;
+                *(v2s *)&p1[2 * (n + span)] = b;
+                mag = mag | (a ^ __SRA2(a, sign)) | (b ^ __SRA2(b, sign));
+            }
+        }
+
+        bits = plp_cfft_bfp_bits_q16(mag);
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16v_xpulpv2((uint16_t *)p1, S->bitRevLength,
+                                    (const uint16_t *)S->pBitRevTable);
+
+    // the inverse DFT is scaled by 1 / N
+    if (ifftFlag) {
+        for (m = N; m > 1; m >>= 1) {
+            exponent--;
+        }
+    }
+
+    return exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,289 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_f32p_xpulpv2.c
+ * Description:  Parallel floating-point complex FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+int bit_rev_radix2(int index, int log2FFTLen);
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
+static inline Complex_type_f32
+twiddle_cfft(const Complex_type_f32 *twiddle_ptr, int twiddle_index, int half_length, int conj);
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int distance,
+                                            int offset1,
+                                            int offset3,
+                                            Complex_type_f32 tw1,
+                                            Complex_type_f32 tw2,
+                                            Complex_type_f32 tw3);
+static inline void process_butterfly_last_radix4(Complex_type_f32 *input, int offset1, int offset3);
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input);
+static inline void
+swap_bit_reversed(const plp_cfft_instance_f32 *S, Complex_type_f32 *data, int index, int log2Len);
+
+/**
+ * @ingroup fft
+ */
+
+/**
+ * @addtogroup cfftKernelsF32
+ * @{
+ */
+
+/**
+ * @brief         Parallel floating-point complex fast fourier transform for XPULPV2
+ * @param[in]     args  points to a plp_cfft_parallel_arg_f32 struct
+ * @return        none
+ *
+ * @par
+ * In every pass, the butterflies with different twiddle factors are distributed over the cores.
+ * In the last passes, where there are less twiddle factors than cores, the groups of butterflies
+ * are distributed instead. The cores synchronize after every pass.
+ */
+
+void plp_cfft_f32p_xpulpv2(void *args) {
+
+    plp_cfft_parallel_arg_f32 *a = (plp_cfft_parallel_arg_f32 *)args;
+    const plp_cfft_instance_f32 *S = a->S;
+    float32_t *p1 = a->p1;
+    uint8_t ifftFlag = a->ifftFlag;
+    uint8_t bitReverseFlag = a->bitReverseFlag;
+    int nPE = a->nPE;
+
+    int d, g, j;
+
+    int core_id = plp_core_id();
+    int length = S->fftLen;
+    int stride = S->tableStride;
+    int half = (length >> 1) * stride; // twiddle index of W^(N/2)
+    int dist = length;                 // distance between the four inputs of a butterfly
+    int offset1, offset3;              // offsets of the second and fourth input
+    int ngroup;                        // number of butterfly groups in the same pass
+    int log2Len = 0;
+
+    Complex_type_f32 *data = (Complex_type_f32 *)p1;
+    Complex_type_f32 *_in_ptr;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddle;
+    Complex_type_f32 tw1, tw2, tw3;
+
+    while ((1 << log2Len) < length) {
+        log2Len++;
+    }
+
+    // RADIX-4 PASSES
+    while (dist > 4) {
+        dist = dist >> 2;
+        ngroup = length / (4 * dist);
+        offset1 = ifftFlag ? 3 * dist : dist;
+        offset3 = ifftFlag ? dist : 3 * dist;
+
+        // distribute the twiddle factors if possible, else the groups
+        int dStart = dist >= nPE ? core_id : 0;
+        int dStep = dist >= nPE ? nPE : 1;
+        int gStart = dist >= nPE ? 0 : core_id;
+        int gStep = dist >= nPE ? 1 : nPE;
+
+        for (d = dStart; d < dist; d += dStep) {
+            int twiddle_index = d * ngroup * stride;
+            tw1 = twiddle_cfft(_tw_ptr, twiddle_index, half, ifftFlag);
+            tw2 = twiddle_cfft(_tw_ptr, 2 * twiddle_index, half, ifftFlag);
+            tw3 = twiddle_cfft(_tw_ptr, 3 * twiddle_index, half, ifftFlag);
+            _in_ptr = data + d + 4 * dist * gStart;
+            for (g = gStart; g < ngroup; g += gStep) {
+                process_butterfly_radix4(_in_ptr, dist, offset1, offset3, tw1, tw2, tw3);
+                _in_ptr += 4 * dist * gStep;
+            } // g
+        }     // d
+        plp_team_barrier();
+    }
+
+    // LAST PASS, twiddle factors are all 1
+    if (dist == 4) {
+        offset1 = ifftFlag ? 3 : 1;
+        offset3 = ifftFlag ? 1 : 3;
+        for (j = 4 * core_id; j < length; j += 4 * nPE) {
+            process_butterfly_last_radix4(&data[j], offset1, offset3);
+        } // j
+    } else if (dist == 2) {
+        for (j = 2 * core_id; j < length; j += 2 * nPE) {
+            process_butterfly_last_radix2(&data[j]);
+        } // j
+    }
+
+    plp_team_barrier();
+
+    // SCALE THE INVERSE TRANSFORM
+    if (ifftFlag) {
+        float32_t scale = 1.0f / length;
+        for (j = 2 * core_id; j < 2 * length; j += 2 * nPE) {
+            p1[j] *= scale;
+            p1[j + 1] *= scale;
+        }
+        plp_team_barrier();
+    }
+
+    // ORDER VALUES
+    if (bitReverseFlag) {
+        for (j = core_id; j < length; j += nPE) {
+            swap_bit_reversed(S, data, j, log2Len);
+        }
+        plp_team_barrier();
+    }
+}
+
+/**
+ * @} end of cfftKernelsF32 group
+ */
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+
+    Complex_type_f32 result;
+    result.re = A.re * B.re - A.im * B.im;
+    result.im = A.re * B.im + A.im * B.re;
+    return result;
+}
+
+static inline Complex_type_f32
+twiddle_cfft(const Complex_type_f32 *twiddle_ptr, int twiddle_index, int half_length, int conj) {
+
+    Complex_type_f32 result;
+
+    // only W^k for k < N/2 is stored, W^k = -W^(k - N/2) otherwise
+    if (twiddle_index < half_length) {
+        result = twiddle_ptr[twiddle_index];
+    } else {
+        result = twiddle_ptr[twiddle_index - half_length];
+        result.re = -result.re;
+        result.im = -result.im;
+    }
+
+    // the inverse transform uses W^-k
+    if (conj) {
+        result.im = -result.im;
+    }
+    return result;
+}
+
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int distance,
+                                            int offset1,
+                                            int offset3,
+                                            Complex_type_f32 tw1,
+                                            Complex_type_f32 tw2,
+                                            Complex_type_f32 tw3) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[offset1];
+    Complex_type_f32 x2 = input[2 * distance];
+    Complex_type_f32 x3 = input[offset3];
+
+    Complex_type_f32 r0, r1, r2, r3;
+
+    float32_t a_re = x0.re + x2.re;
+    float32_t a_im = x0.im + x2.im;
+    float32_t b_re = x1.re + x3.re;
+    float32_t b_im = x1.im + x3.im;
+    float32_t c_re = x0.re - x2.re;
+    float32_t c_im = x0.im - x2.im;
+    float32_t e_re = x1.re - x3.re;
+    float32_t e_im = x1.im - x3.im;
+
+    r0.re = a_re + b_re;
+    r0.im = a_im + b_im;
+    r1.re = a_re - b_re;
+    r1.im = a_im - b_im;
+
+    // c - j*e and c + j*e
+    r2.re = c_re + e_im;
+    r2.im = c_im - e_re;
+    r3.re = c_re - e_im;
+    r3.im = c_im + e_re;
+
+    input[0] = r0;
+    input[distance] = complex_mul(tw2, r1);
+    input[2 * distance] = complex_mul(tw1, r2);
+    input[3 * distance] = complex_mul(tw3, r3);
+}
+
+static inline void
+process_butterfly_last_radix4(Complex_type_f32 *input, int offset1, int offset3) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[offset1];
+    Complex_type_f32 x2 = input[2];
+    Complex_type_f32 x3 = input[offset3];
+
+    float32_t a_re = x0.re + x2.re;
+    float32_t a_im = x0.im + x2.im;
+    float32_t b_re = x1.re + x3.re;
+    float32_t b_im = x1.im + x3.im;
+    float32_t c_re = x0.re - x2.re;
+    float32_t c_im = x0.im - x2.im;
+    float32_t e_re = x1.re - x3.re;
+    float32_t e_im = x1.im - x3.im;
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[0].re = a_re + b_re;
+    input[0].im = a_im + b_im;
+    input[1].re = a_re - b_re;
+    input[1].im = a_im - b_im;
+    input[2].re = c_re + e_im;
+    input[2].im = c_im - e_re;
+    input[3].re = c_re - e_im;
+    input[3].im = c_im + e_re;
+}
+
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[1];
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[0].re = x0.re + x1.re;
+    input[0].im = x0.im + x1.im;
+    input[1].re = x0.re - x1.re;
+    input[1].im = x0.im - x1.im;
+}
+
+static inline void
+swap_bit_reversed(const plp_cfft_instance_f32 *S, Complex_type_f32 *data, int index, int log2Len) {
+
+    int rev;
+    if (S->pBitRevLUT) {
+        rev = S->pBitRevLUT[index * S->tableStride];
+    } else {
+        rev = bit_rev_radix2(index, log2Len);
+    }
+
+    // every pair is swapped once, from its smaller index
+    if (rev > index) {
+        Complex_type_f32 temp = data[index];
+        data[index] = data[rev];
+        data[rev] = temp;
+    }
+}
@@ -0,0 +1,331 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_f32s_xpulpv2.c
+ * Description:  Floating-point complex FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+int bit_rev_radix2(int index, int log2FFTLen);
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
+static inline Complex_type_f32
+twiddle_cfft(const Complex_type_f32 *twiddle_ptr, int twiddle_index, int half_length, int conj);
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int distance,
+                                            int offset1,
+                                            int offset3,
+                                            Complex_type_f32 tw1,
+                                            Complex_type_f32 tw2,
+                                            Complex_type_f32 tw3);
+static inline void
+process_butterfly_last_radix4(Complex_type_f32 *input, int distance, int offset1, int offset3);
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input, int distance);
+static inline void swap_bit_reversed(const plp_cfft_instance_f32 *S,
+                                     Complex_type_f32 *data,
+                                     int index,
+                                     int log2Len,
+                                     int stride);
+static inline void cfft_f32_strided(const plp_cfft_instance_f32 *S,
+                                    float32_t *p1,
+                                    int dataStride,
+                                    uint8_t ifftFlag,
+                                    uint8_t bitReverseFlag);
+
+/**
+ * @ingroup fft
+ */
+
+/**
+ * @defgroup cfftKernelsF32 Floating-point CFFT Kernels
+ * These kernels compute the in-place complex FFT and inverse FFT of floating-point data. The
+ * decimation in frequency is computed with radix-4 (radix-2^2) passes, each of which merges two
+ * radix-2 stages, and a final radix-2 stage if log2 of the length is odd. The output of the passes
+ * is in bit reversed order, like the one of the floating-point real FFT. The three twiddle factors
+ * of a butterfly are loaded once per pass. The inverse transform swaps the second and fourth input
+ * of each butterfly (which turns the rotation by -j into +j) and uses conjugated twiddle factors,
+ * its output is scaled by 1/fftLen. The strided kernel transforms samples which are a constant
+ * distance apart, such as the columns of a matrix, in place without copying them.
+ */
+
+/**
+ * @addtogroup cfftKernelsF32
+ * @{
+ */
+
+/**
+ * @brief         Floating-point complex fast fourier transform for XPULPV2
+ * @param[in]     S               points to an instance of the floating-point CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        none
+ */
+
+void plp_cfft_f32s_xpulpv2(const plp_cfft_instance_f32 *S,
+                           float32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag) {
+
+    cfft_f32_strided(S, p1, 1, ifftFlag, bitReverseFlag);
+}
+
+/**
+ * @brief         Floating-point complex fast fourier transform of strided data for XPULPV2
+ * @param[in]     S               points to an instance of the floating-point CFFT structure
+ * @param[in,out] p1              points to the first complex sample, sample k is at
+ * <code>p1 + 2*k*stride</code>. Processing occurs in-place.
+ * @param[in]     stride          distance between the complex samples, e.g. the row stride of a
+ * matrix for the transform of a column
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        none
+ */
+
+void plp_cfft_stride_f32s_xpulpv2(const plp_cfft_instance_f32 *S,
+                                  float32_t *p1,
+                                  uint32_t stride,
+                                  uint8_t ifftFlag,
+                                  uint8_t bitReverseFlag) {
+
+    cfft_f32_strided(S, p1, stride, ifftFlag, bitReverseFlag);
+}
+
+/**
+ * @} end of cfftKernelsF32 group
+ */
+
+static inline void cfft_f32_strided(const plp_cfft_instance_f32 *S,
+                                    float32_t *p1,
+                                    int dataStride,
+                                    uint8_t ifftFlag,
+                                    uint8_t bitReverseFlag) {
+
+    int d, g, j;
+
+    int length = S->fftLen;
+    int stride = S->tableStride;
+    int half = (length >> 1) * stride; // twiddle index of W^(N/2)
+    int dist = length;                 // distance between the four inputs of a butterfly
+    int offset1, offset3;              // offsets of the second and fourth input
+    int ngroup;                        // number of butterfly groups in the same pass
+    int log2Len = 0;
+
+    Complex_type_f32 *data = (Complex_type_f32 *)p1;
+    Complex_type_f32 *_in_ptr;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddle;
+    Complex_type_f32 tw1, tw2, tw3;
+
+    while ((1 << log2Len) < length) {
+        log2Len++;
+    }
+
+    // RADIX-4 PASSES
+    while (dist > 4) {
+        dist = dist >> 2;
+        ngroup = length / (4 * dist);
+        offset1 = ifftFlag ? 3 * dist : dist;
+        offset3 = ifftFlag ? dist : 3 * dist;
+        for (d = 0; d < dist; d++) {
+            int twiddle_index = d * ngroup * stride;
+            tw1 = twiddle_cfft(_tw_ptr, twiddle_index, half, ifftFlag);
+            tw2 = twiddle_cfft(_tw_ptr, 2 * twiddle_index, half, ifftFlag);
+            tw3 = twiddle_cfft(_tw_ptr, 3 * twiddle_index, half, ifftFlag);
+            _in_ptr = data + d * dataStride;
+            for (g = 0; g < ngroup; g++) {
+                process_butterfly_radix4(_in_ptr, dist * dataStride, offset1 * dataStride,
+                                         offset3 * dataStride, tw1, tw2, tw3);
+                _in_ptr += 4 * dist * dataStride;
+            } // g
+        }     // d
+    }
+
+    // LAST PASS, twiddle factors are all 1
+    if (dist == 4) {
+        offset1 = ifftFlag ? 3 : 1;
+        offset3 = ifftFlag ? 1 : 3;
+        for (j = 0; j < length; j += 4) {
+            process_butterfly_last_radix4(&data[j * dataStride], dataStride,
+                                          offset1 * dataStride, offset3 * dataStride);
+        } // j
+    } else if (dist == 2) {
+        for (j = 0; j < length; j += 2) {
+            process_butterfly_last_radix2(&data[j * dataStride], dataStride);
+        } // j
+    }
+
+    // SCALE THE INVERSE TRANSFORM
+    if (ifftFlag) {
+        float32_t scale = 1.0f / length;
+        for (j = 0; j < length; j++) {
+            data[j * dataStride].re *= scale;
+            data[j * dataStride].im *= scale;
+        }
+    }
+
+    // ORDER VALUES
+    if (bitReverseFlag) {
+        for (j = 0; j < length; j++) {
+            swap_bit_reversed(S, data, j, log2Len, dataStride);
+        }
+    }
+}
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+
+    Complex_type_f32 result;
+    result.re = A.re * B.re - A.im * B.im;
+    result.im = A.re * B.im + A.im * B.re;
+    return result;
+}
+
+static inline Complex_type_f32
+twiddle_cfft(const Complex_type_f32 *twiddle_ptr, int twiddle_index, int half_length, int conj) {
+
+    Complex_type_f32 result;
+
+    // only W^k for k < N/2 is stored, W^k = -W^(k - N/2) otherwise
+    if (twiddle_index < half_length) {
+        result = twiddle_ptr[twiddle_index];
+    } else {
+        result = twiddle_ptr[twiddle_index - half_length];
+        result.re = -result.re;
+        result.im = -result.im;
+    }
+
+    // the inverse transform uses W^-k
+    if (conj) {
+        result.im = -result.im;
+    }
+    return result;
+}
+
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int distance,
+                                            int offset1,
+                                            int offset3,
+                                            Complex_type_f32 tw1,
+                                            Complex_type_f32 tw2,
+                                            Complex_type_f32 tw3) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[offset1];
+    Complex_type_f32 x2 = input[2 * distance];
+    Complex_type_f32 x3 = input[offset3];
+
+    Complex_type_f32 r0, r1, r2, r3;
+
+    float32_t a_re = x0.re + x2.re;
+    float32_t a_im = x0.im + x2.im;
+    float32_t b_re = x1.re + x3.re;
+    float32_t b_im = x1.im + x3.im;
+    float32_t c_re = x0.re - x2.re;
+    float32_t c_im = x0.im - x2.im;
+    float32_t e_re = x1.re - x3.re;
+    float32_t e_im = x1.im - x3.im;
+
+    r0.re = a_re + b_re;
+    r0.im = a_im + b_im;
+    r1.re = a_re - b_re;
+    r1.im = a_im - b_im;
+
+    // c - j*e and c + j*e
+    r2.re = c_re + e_im;
+    r2.im = c_im - e_re;
+    r3.re = c_re - e_im;
+    r3.im = c_im + e_re;
+
+    input[0] = r0;
+    input[distance] = complex_mul(tw2, r1);
+    input[2 * distance] = complex_mul(tw1, r2);
+    input[3 * distance] = complex_mul(tw3, r3);
+}
+
+static inline void
+process_butterfly_last_radix4(Complex_type_f32 *input, int distance, int offset1, int offset3) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[offset1];
+    Complex_type_f32 x2 = input[2 * distance];
+    Complex_type_f32 x3 = input[offset3];
+
+    float32_t a_re = x0.re + x2.re;
+    float32_t a_im = x0.im + x2.im;
+    float32_t b_re = x1.re + x3.re;
+    float32_t b_im = x1.im + x3.im;
+    float32_t c_re = x0.re - x2.re;
+    float32_t c_im = x0.im - x2.im;
+    float32_t e_re = x1.re - x3.re;
+    float32_t e_im = x1.im - x3.im;
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[0].re = a_re + b_re;
+    input[0].im = a_im + b_im;
+    input[distance].re = a_re - b_re;
+    input[distance].im = a_im - b_im;
+    input[2 * distance].re = c_re + e_im;
+    input[2 * distance].im = c_im - e_re;
+    input[3 * distance].re = c_re - e_im;
+    input[3 * distance].im = c_im + e_re;
+}
+
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input, int distance) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[distance];
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[0].re = x0.re + x1.re;
+    input[0].im = x0.im + x1.im;
+    input[distance].re = x0.re - x1.re;
+    input[distance].im = x0.im - x1.im;
+}
+
+static inline void swap_bit_reversed(const plp_cfft_instance_f32 *S,
+                                     Complex_type_f32 *data,
+                                     int index,
+                                     int log2Len,
+                                     int stride) {
+
+    int rev;
+    if (S->pBitRevLUT) {
+        rev = S->pBitRevLUT[index * S->tableStride];
+    } else {
+        rev = bit_rev_radix2(index, log2Len);
+    }
+
+    // every pair is swapped once, from its smaller index
+    if (rev > index) {
+        Complex_type_f32 temp = data[index * stride];
+        data[index * stride] = data[rev * stride];
+        data[rev * stride] = temp;
+    }
+}
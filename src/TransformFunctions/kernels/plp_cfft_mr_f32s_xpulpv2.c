@@ -0,0 +1,314 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mr_f32s_xpulpv2.c
+ * Description:  32-bit floating-point mixed-radix complex FFT for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+static void plp_cfft_mr_radix2_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle);
+static void plp_cfft_mr_radix3_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle);
+static void plp_cfft_mr_radix4_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle);
+static void plp_cfft_mr_radix5_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle);
+
+/* x * e^(-j 2 pi t / N), where the table holds cos and sin of 2 pi t / N */
+#define PLP_CFFT_MR_ROT(xr, xi, pX, pTwiddle, t)                                                   \
+    {                                                                                              \
+        float32_t c = (pTwiddle)[2 * (t)];                                                         \
+        float32_t s = (pTwiddle)[2 * (t) + 1];                                                     \
+        xr = (pX)[0] * c + (pX)[1] * s;                                                            \
+        xi = (pX)[1] * c - (pX)[0] * s;                                                            \
+    }
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Mixed-radix floating-point complex FFT for XPULPV2 extension.
+ * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place, in natural order
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform. The inverse transform is scaled by 1 / fftLen.
+ * @return        none
+ *
+ * @par
+ * Every stage of radix p is a Stockham autosort pass: the p inputs of a butterfly are fftLen / p
+ * apart, they are rotated by the twiddle factors, transformed with a DFT of length p, and written
+ * such that the output of the last stage is in natural order. The stages alternate between p1
+ * and pScratch. The inverse transform is computed as the conjugate of the forward transform of the
+ * conjugated input.
+ */
+void plp_cfft_mr_f32s_xpulpv2(const plp_cfft_mr_instance_f32 *S,
+                              float32_t *p1,
+                              float32_t *pScratch,
+                              uint8_t ifftFlag) {
+
+    uint32_t N = S->fftLen;
+    const float32_t *pTwiddle = S->pTwiddle;
+    float32_t *pIn = p1;
+    float32_t *pOut = pScratch;
+    uint32_t Ns = 1; // product of the radices of the previous stages
+    uint32_t stage;
+    uint32_t i;
+
+    if (ifftFlag) {
+        for (i = 0; i < N; i++) {
+            p1[2 * i + 1] = -p1[2 * i + 1];
+        }
+    }
+
+    for (stage = 0; stage < S->numStages; stage++) {
+        uint32_t radix = S->radix[stage];
+
+        switch (radix) {
+        case 2:
+            plp_cfft_mr_radix2_f32(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        case 3:
+            plp_cfft_mr_radix3_f32(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        case 4:
+            plp_cfft_mr_radix4_f32(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        default:
+            plp_cfft_mr_radix5_f32(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        }
+
+        Ns *= radix;
+        float32_t *pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+    }
+
+    // the result is in pIn, conjugate and scale it for the inverse transform
+    if (ifftFlag) {
+        float32_t scale = 1.0f / N;
+        for (i = 0; i < N; i++) {
+            p1[2 * i] = pIn[2 * i] * scale;
+            p1[2 * i + 1] = -pIn[2 * i + 1] * scale;
+        }
+    } else if (pIn != p1) {
+        for (i = 0; i < 2 * N; i++) {
+            p1[i] = pIn[i];
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+static void plp_cfft_mr_radix2_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle) {
+
+    uint32_t m = N / 2;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const float32_t *pX = pIn + 2 * (j + k);
+            float32_t *pY = pOut + 2 * (2 * j + k);
+            float32_t br, bi;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+
+            pY[0] = pX[0] + br;
+            pY[1] = pX[1] + bi;
+            pY[2 * Ns] = pX[0] - br;
+            pY[2 * Ns + 1] = pX[1] - bi;
+        }
+    }
+}
+
+static void plp_cfft_mr_radix3_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle) {
+
+    const float32_t s60 = 0.86602540378443865f; // sin(2 pi / 3)
+    uint32_t m = N / 3;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const float32_t *pX = pIn + 2 * (j + k);
+            float32_t *pY = pOut + 2 * (3 * j + k);
+            float32_t br, bi, cr, ci;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+            PLP_CFFT_MR_ROT(cr, ci, pX + 4 * m, pTwiddle, 2 * k * step);
+
+            // y1 = a - (b + c) / 2 - j sin(2 pi / 3) (b - c), y2 = conjugate rotation
+            float32_t tr = br + cr;
+            float32_t ti = bi + ci;
+            float32_t ur = pX[0] - 0.5f * tr;
+            float32_t ui = pX[1] - 0.5f * ti;
+            float32_t vr = s60 * (bi - ci);
+            float32_t vi = -s60 * (br - cr);
+
+            pY[0] = pX[0] + tr;
+            pY[1] = pX[1] + ti;
+            pY[2 * Ns] = ur + vr;
+            pY[2 * Ns + 1] = ui + vi;
+            pY[4 * Ns] = ur - vr;
+            pY[4 * Ns + 1] = ui - vi;
+        }
+    }
+}
+
+static void plp_cfft_mr_radix4_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle) {
+
+    uint32_t m = N / 4;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const float32_t *pX = pIn + 2 * (j + k);
+            float32_t *pY = pOut + 2 * (4 * j + k);
+            float32_t br, bi, cr, ci, dr, di;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+            PLP_CFFT_MR_ROT(cr, ci, pX + 4 * m, pTwiddle, 2 * k * step);
+            PLP_CFFT_MR_ROT(dr, di, pX + 6 * m, pTwiddle, 3 * k * step);
+
+            float32_t s0r = pX[0] + cr;
+            float32_t s0i = pX[1] + ci;
+            float32_t d0r = pX[0] - cr;
+            float32_t d0i = pX[1] - ci;
+            float32_t s1r = br + dr;
+            float32_t s1i = bi + di;
+            float32_t d1r = br - dr;
+            float32_t d1i = bi - di;
+
+            // y1 = a - j b - c + j d, y3 = a + j b - c - j d
+            pY[0] = s0r + s1r;
+            pY[1] = s0i + s1i;
+            pY[2 * Ns] = d0r + d1i;
+            pY[2 * Ns + 1] = d0i - d1r;
+            pY[4 * Ns] = s0r - s1r;
+            pY[4 * Ns + 1] = s0i - s1i;
+            pY[6 * Ns] = d0r - d1i;
+            pY[6 * Ns + 1] = d0i + d1r;
+        }
+    }
+}
+
+static void plp_cfft_mr_radix5_f32(const float32_t *pIn,
+                                   float32_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const float32_t *pTwiddle) {
+
+    const float32_t c1 = 0.30901699437494742f;  // cos(2 pi / 5)
+    const float32_t c2 = -0.80901699437494742f; // cos(4 pi / 5)
+    const float32_t s1 = 0.95105651629515357f;  // sin(2 pi / 5)
+    const float32_t s2 = 0.58778525229247313f;  // sin(4 pi / 5)
+    uint32_t m = N / 5;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const float32_t *pX = pIn + 2 * (j + k);
+            float32_t *pY = pOut + 2 * (5 * j + k);
+            float32_t br, bi, cr, ci, dr, di, er, ei;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+            PLP_CFFT_MR_ROT(cr, ci, pX + 4 * m, pTwiddle, 2 * k * step);
+            PLP_CFFT_MR_ROT(dr, di, pX + 6 * m, pTwiddle, 3 * k * step);
+            PLP_CFFT_MR_ROT(er, ei, pX + 8 * m, pTwiddle, 4 * k * step);
+
+            float32_t t1r = br + er;
+            float32_t t1i = bi + ei;
+            float32_t t2r = cr + dr;
+            float32_t t2i = ci + di;
+            float32_t t3r = br - er;
+            float32_t t3i = bi - ei;
+            float32_t t4r = cr - dr;
+            float32_t t4i = ci - di;
+
+            float32_t m1r = pX[0] + c1 * t1r + c2 * t2r;
+            float32_t m1i = pX[1] + c1 * t1i + c2 * t2i;
+            float32_t m2r = pX[0] + c2 * t1r + c1 * t2r;
+            float32_t m2i = pX[1] + c2 * t1i + c1 * t2i;
+            float32_t n1r = s1 * t3r + s2 * t4r;
+            float32_t n1i = s1 * t3i + s2 * t4i;
+            float32_t n2r = s2 * t3r - s1 * t4r;
+            float32_t n2i = s2 * t3i - s1 * t4i;
+
+            // y1 = m1 - j n1, y4 = m1 + j n1, y2 = m2 - j n2, y3 = m2 + j n2
+            pY[0] = pX[0] + t1r + t2r;
+            pY[1] = pX[1] + t1i + t2i;
+            pY[2 * Ns] = m1r + n1i;
+            pY[2 * Ns + 1] = m1i - n1r;
+            pY[4 * Ns] = m2r + n2i;
+            pY[4 * Ns + 1] = m2i - n2r;
+            pY[6 * Ns] = m2r - n2i;
+            pY[6 * Ns + 1] = m2i + n2r;
+            pY[8 * Ns] = m1r - n1i;
+            pY[8 * Ns + 1] = m1i + n1r;
+        }
+    }
+}
+
+#undef PLP_CFFT_MR_ROT
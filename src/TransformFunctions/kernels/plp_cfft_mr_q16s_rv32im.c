@@ -0,0 +1,324 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mr_q16s_rv32im.c
+ * Description:  16-bit fixed-point mixed-radix complex FFT for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+static void plp_cfft_mr_radix2_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle);
+static void plp_cfft_mr_radix3_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle);
+static void plp_cfft_mr_radix4_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle);
+static void plp_cfft_mr_radix5_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle);
+
+/* x * e^(-j 2 pi t / N) in Q15, where the table holds cos and sin of 2 pi t / N */
+#define PLP_CFFT_MR_ROT(xr, xi, pX, pTwiddle, t)                                                   \
+    {                                                                                              \
+        int32_t c = (pTwiddle)[2 * (t)];                                                           \
+        int32_t s = (pTwiddle)[2 * (t) + 1];                                                       \
+        xr = ((pX)[0] * c + (pX)[1] * s) >> 15;                                                    \
+        xi = ((pX)[1] * c - (pX)[0] * s) >> 15;                                                    \
+    }
+
+static inline int16_t plp_cfft_mr_clip(int32_t x) {
+    return (x > 32767) ? 32767 : ((x < -32768) ? -32768 : x);
+}
+
+#define PLP_CFFT_MR_CLIP(x) plp_cfft_mr_clip(x)
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Mixed-radix 16-bit fixed-point complex FFT for RV32IM.
+ * @param[in]     S         points to an instance of the 16-bit mixed-radix CFFT structure
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place, in natural order
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform
+ * @return        none
+ *
+ * @par
+ * Every stage of radix p is a Stockham autosort pass: the p inputs of a butterfly are fftLen / p
+ * apart, they are rotated by the twiddle factors, transformed with a DFT of length p and scaled by
+ * 1 / p, and written such that the output of the last stage is in natural order. The stages
+ * alternate between p1 and pScratch. Both the forward transform and the inverse transform,
+ * which is computed as the conjugate of the forward transform of the conjugated input, are thus
+ * scaled by 1 / fftLen.
+ */
+void plp_cfft_mr_q16s_rv32im(const plp_cfft_mr_instance_q16 *S,
+                             int16_t *p1,
+                             int16_t *pScratch,
+                             uint8_t ifftFlag) {
+
+    uint32_t N = S->fftLen;
+    const int16_t *pTwiddle = S->pTwiddle;
+    int16_t *pIn = p1;
+    int16_t *pOut = pScratch;
+    uint32_t Ns = 1; // product of the radices of the previous stages
+    uint32_t stage;
+    uint32_t i;
+
+    if (ifftFlag) {
+        for (i = 0; i < N; i++) {
+            p1[2 * i + 1] = PLP_CFFT_MR_CLIP(-p1[2 * i + 1]);
+        }
+    }
+
+    for (stage = 0; stage < S->numStages; stage++) {
+        uint32_t radix = S->radix[stage];
+
+        switch (radix) {
+        case 2:
+            plp_cfft_mr_radix2_q16(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        case 3:
+            plp_cfft_mr_radix3_q16(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        case 4:
+            plp_cfft_mr_radix4_q16(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        default:
+            plp_cfft_mr_radix5_q16(pIn, pOut, N, Ns, pTwiddle);
+            break;
+        }
+
+        Ns *= radix;
+        int16_t *pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+    }
+
+    // the result is in pIn, conjugate it for the inverse transform
+    if (ifftFlag) {
+        for (i = 0; i < N; i++) {
+            p1[2 * i] = pIn[2 * i];
+            p1[2 * i + 1] = PLP_CFFT_MR_CLIP(-pIn[2 * i + 1]);
+        }
+    } else if (pIn != p1) {
+        for (i = 0; i < 2 * N; i++) {
+            p1[i] = pIn[i];
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+static void plp_cfft_mr_radix2_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle) {
+
+    uint32_t m = N / 2;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const int16_t *pX = pIn + 2 * (j + k);
+            int16_t *pY = pOut + 2 * (2 * j + k);
+            int32_t br, bi;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+
+            pY[0] = PLP_CFFT_MR_CLIP((pX[0] + br) >> 1);
+            pY[1] = PLP_CFFT_MR_CLIP((pX[1] + bi) >> 1);
+            pY[2 * Ns] = PLP_CFFT_MR_CLIP((pX[0] - br) >> 1);
+            pY[2 * Ns + 1] = PLP_CFFT_MR_CLIP((pX[1] - bi) >> 1);
+        }
+    }
+}
+
+static void plp_cfft_mr_radix3_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle) {
+
+    const int32_t s60 = 28378;   // sin(2 pi / 3) in Q15
+    const int32_t third = 10923; // 1 / 3 in Q15
+    uint32_t m = N / 3;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const int16_t *pX = pIn + 2 * (j + k);
+            int16_t *pY = pOut + 2 * (3 * j + k);
+            int32_t br, bi, cr, ci;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+            PLP_CFFT_MR_ROT(cr, ci, pX + 4 * m, pTwiddle, 2 * k * step);
+
+            // y1 = a - (b + c) / 2 - j sin(2 pi / 3) (b - c), y2 = conjugate rotation
+            int32_t tr = br + cr;
+            int32_t ti = bi + ci;
+            int32_t ur = pX[0] - (tr >> 1);
+            int32_t ui = pX[1] - (ti >> 1);
+            int32_t vr = (s60 * (bi - ci)) >> 15;
+            int32_t vi = (s60 * (cr - br)) >> 15;
+
+            pY[0] = PLP_CFFT_MR_CLIP(((pX[0] + tr) * third) >> 15);
+            pY[1] = PLP_CFFT_MR_CLIP(((pX[1] + ti) * third) >> 15);
+            pY[2 * Ns] = PLP_CFFT_MR_CLIP(((ur + vr) * third) >> 15);
+            pY[2 * Ns + 1] = PLP_CFFT_MR_CLIP(((ui + vi) * third) >> 15);
+            pY[4 * Ns] = PLP_CFFT_MR_CLIP(((ur - vr) * third) >> 15);
+            pY[4 * Ns + 1] = PLP_CFFT_MR_CLIP(((ui - vi) * third) >> 15);
+        }
+    }
+}
+
+static void plp_cfft_mr_radix4_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle) {
+
+    uint32_t m = N / 4;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const int16_t *pX = pIn + 2 * (j + k);
+            int16_t *pY = pOut + 2 * (4 * j + k);
+            int32_t br, bi, cr, ci, dr, di;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+            PLP_CFFT_MR_ROT(cr, ci, pX + 4 * m, pTwiddle, 2 * k * step);
+            PLP_CFFT_MR_ROT(dr, di, pX + 6 * m, pTwiddle, 3 * k * step);
+
+            int32_t s0r = pX[0] + cr;
+            int32_t s0i = pX[1] + ci;
+            int32_t d0r = pX[0] - cr;
+            int32_t d0i = pX[1] - ci;
+            int32_t s1r = br + dr;
+            int32_t s1i = bi + di;
+            int32_t d1r = br - dr;
+            int32_t d1i = bi - di;
+
+            // y1 = a - j b - c + j d, y3 = a + j b - c - j d
+            pY[0] = PLP_CFFT_MR_CLIP((s0r + s1r) >> 2);
+            pY[1] = PLP_CFFT_MR_CLIP((s0i + s1i) >> 2);
+            pY[2 * Ns] = PLP_CFFT_MR_CLIP((d0r + d1i) >> 2);
+            pY[2 * Ns + 1] = PLP_CFFT_MR_CLIP((d0i - d1r) >> 2);
+            pY[4 * Ns] = PLP_CFFT_MR_CLIP((s0r - s1r) >> 2);
+            pY[4 * Ns + 1] = PLP_CFFT_MR_CLIP((s0i - s1i) >> 2);
+            pY[6 * Ns] = PLP_CFFT_MR_CLIP((d0r - d1i) >> 2);
+            pY[6 * Ns + 1] = PLP_CFFT_MR_CLIP((d0i + d1r) >> 2);
+        }
+    }
+}
+
+static void plp_cfft_mr_radix5_q16(const int16_t *pIn,
+                                   int16_t *pOut,
+                                   uint32_t N,
+                                   uint32_t Ns,
+                                   const int16_t *pTwiddle) {
+
+    const int32_t c1 = 10126;    // cos(2 pi / 5) in Q15
+    const int32_t c2 = -26510;   // cos(4 pi / 5) in Q15
+    const int32_t s1 = 31164;    // sin(2 pi / 5) in Q15
+    const int32_t s2 = 19261;    // sin(4 pi / 5) in Q15
+    const int32_t fifth = 6554;  // 1 / 5 in Q15
+    uint32_t m = N / 5;
+    uint32_t step = m / Ns;
+    uint32_t j, k;
+
+    for (j = 0; j < m; j += Ns) {
+        for (k = 0; k < Ns; k++) {
+            const int16_t *pX = pIn + 2 * (j + k);
+            int16_t *pY = pOut + 2 * (5 * j + k);
+            int32_t br, bi, cr, ci, dr, di, er, ei;
+
+            PLP_CFFT_MR_ROT(br, bi, pX + 2 * m, pTwiddle, k * step);
+            PLP_CFFT_MR_ROT(cr, ci, pX + 4 * m, pTwiddle, 2 * k * step);
+            PLP_CFFT_MR_ROT(dr, di, pX + 6 * m, pTwiddle, 3 * k * step);
+            PLP_CFFT_MR_ROT(er, ei, pX + 8 * m, pTwiddle, 4 * k * step);
+
+            int32_t t1r = br + er;
+            int32_t t1i = bi + ei;
+            int32_t t2r = cr + dr;
+            int32_t t2i = ci + di;
+            int32_t t3r = br - er;
+            int32_t t3i = bi - ei;
+            int32_t t4r = cr - dr;
+            int32_t t4i = ci - di;
+
+            // every product is shifted on its own, such that the sums cannot overflow
+            int32_t m1r = pX[0] + ((c1 * t1r) >> 15) + ((c2 * t2r) >> 15);
+            int32_t m1i = pX[1] + ((c1 * t1i) >> 15) + ((c2 * t2i) >> 15);
+            int32_t m2r = pX[0] + ((c2 * t1r) >> 15) + ((c1 * t2r) >> 15);
+            int32_t m2i = pX[1] + ((c2 * t1i) >> 15) + ((c1 * t2i) >> 15);
+            int32_t n1r = ((s1 * t3r) >> 15) + ((s2 * t4r) >> 15);
+            int32_t n1i = ((s1 * t3i) >> 15) + ((s2 * t4i) >> 15);
+            int32_t n2r = ((s2 * t3r) >> 15) - ((s1 * t4r) >> 15);
+            int32_t n2i = ((s2 * t3i) >> 15) - ((s1 * t4i) >> 15);
+
+            // y1 = m1 - j n1, y4 = m1 + j n1, y2 = m2 - j n2, y3 = m2 + j n2
+            pY[0] = PLP_CFFT_MR_CLIP(((pX[0] + t1r + t2r) * fifth) >> 15);
+            pY[1] = PLP_CFFT_MR_CLIP(((pX[1] + t1i + t2i) * fifth) >> 15);
+            pY[2 * Ns] = PLP_CFFT_MR_CLIP(((m1r + n1i) * fifth) >> 15);
+            pY[2 * Ns + 1] = PLP_CFFT_MR_CLIP(((m1i - n1r) * fifth) >> 15);
+            pY[4 * Ns] = PLP_CFFT_MR_CLIP(((m2r + n2i) * fifth) >> 15);
+            pY[4 * Ns + 1] = PLP_CFFT_MR_CLIP(((m2i - n2r) * fifth) >> 15);
+            pY[6 * Ns] = PLP_CFFT_MR_CLIP(((m2r - n2i) * fifth) >> 15);
+            pY[6 * Ns + 1] = PLP_CFFT_MR_CLIP(((m2i + n2r) * fifth) >> 15);
+            pY[8 * Ns] = PLP_CFFT_MR_CLIP(((m1r - n1i) * fifth) >> 15);
+            pY[8 * Ns + 1] = PLP_CFFT_MR_CLIP(((m1i + n1r) * fifth) >> 15);
+        }
+    }
+}
+
+#undef PLP_CFFT_MR_ROT
+#undef PLP_CFFT_MR_CLIP
@@ -0,0 +1,60 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16_batch_xpulpv2.c
+ * Description:  Batched 16-bit fixed point complex FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform of a batch of channels for XPULPV2.
+ * Every core transforms whole channels.
+ * @param[in]  args  points to a plp_cfft_batch_arg_q16 struct
+ * @return     none
+ */
+
+void plp_cfft_q16_batch_xpulpv2(void *args) {
+
+    plp_cfft_batch_arg_q16 *a = (plp_cfft_batch_arg_q16 *)args;
+    uint32_t c;
+
+    for (c = plp_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_cfft_q16s_xpulpv2(a->S, a->p1 + 2 * c * a->channelStride, a->ifftFlag,
+                              a->bitReverseFlag, a->deciPoint);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
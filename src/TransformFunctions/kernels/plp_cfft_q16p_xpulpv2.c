@@ -0,0 +1,571 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/* rotated twiddle factor (-si, co) of (co, si), negated and swapped with a single shuffle */
+static inline v2s plp_cfft_twiddle_rot_q16(v2s CoSi) {
+    return __builtin_shuffle(CoSi, __SUB2((v2s){ 0, 0 }, CoSi), (v2s){ 3, 0 });
+}
+
+/* complex Q15 value X multiplied with the conjugate of the twiddle factor (co, si). The real and
+   imaginary parts are the upper halves of two dot products, which are packed with one shuffle. */
+static inline v2s plp_cfft_twiddle_mult_q16(v2s X, v2s CoSi, v2s SiCo) {
+    return __builtin_shuffle((v2s)__DOTP2(CoSi, X), (v2s)__DOTP2(SiCo, X), (v2s){ 1, 3 });
+}
+
+static void plp_cfft_radix4by2_q16p(int16_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int16_t *pCoef,
+                                    uint32_t twidCoefModifier,
+                                    uint32_t nPE,
+                                    uint32_t core_id);
+
+static void plp_radix4_butterfly_q16p(int16_t *pSrc16,
+                                      uint32_t fftLen,
+                                      int16_t *pCoef16,
+                                      uint32_t twidCoefModifier,
+                                      uint32_t nPE,
+                                      uint32_t core_id);
+
+/**
+ * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to a plp_cfft_parallel_arg_q16 struct
+ * @return     none
+ *
+ * @par
+ * The butterflies of every stage are distributed over the cores, which synchronize between the
+ * stages. The computation (and hence the result) is the same as in plp_cfft_q16s_xpulpv2.
+ */
+
+void plp_cfft_q16p_xpulpv2(void *args) {
+
+    plp_cfft_parallel_arg_q16 *a = (plp_cfft_parallel_arg_q16 *)args;
+    const plp_cfft_instance_q16 *S = a->S;
+    int16_t *p1 = a->p1;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = plp_core_id();
+
+    uint32_t L = S->fftLen;
+
+    if (a->ifftFlag == 0) {
+        switch (L) {
+        case 16:
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            plp_radix4_butterfly_q16p(p1, L, (int16_t *)S->pTwiddle, PLP_TWIDDLE_STEP_Q16(L), nPE,
+                                      core_id);
+            break;
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            plp_cfft_radix4by2_q16p(p1, L, (int16_t *)S->pTwiddle, PLP_TWIDDLE_STEP_Q16(L), nPE,
+                                    core_id);
+            break;
+        }
+    }
+
+    if (a->bitReverseFlag) {
+        // every entry pair of the table swaps two independent elements
+        uint16_t *pSrc = (uint16_t *)p1;
+        const uint16_t *pBitRevTab = (const uint16_t *)S->pBitRevTable;
+        uint16_t tmp;
+        v2s c;
+
+        for (uint32_t i = 2 * core_id; i < S->bitRevLength; i += 2 * nPE) {
+            c = __SRA2(*(v2s *)&pBitRevTab[i], ((v2s){ 2, 2 }));
+
+            // real
+            tmp = pSrc[c[0]];
+            pSrc[c[0]] = pSrc[c[1]];
+            pSrc[c[1]] = tmp;
+
+            // complex
+            tmp = pSrc[c[0] + 1];
+            pSrc[c[0] + 1] = pSrc[c[1] + 1];
+            pSrc[c[1] + 1] = tmp;
+        }
+
+        plp_team_barrier();
+    }
+}
+
+static void plp_cfft_radix4by2_q16p(int16_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int16_t *pCoef,
+                                    uint32_t twidCoefModifier,
+                                    uint32_t nPE,
+                                    uint32_t core_id) {
+
+    uint32_t i;
+    uint32_t n2;
+    v2s pa, pb;
+
+    uint32_t l;
+    v2s CoSi;
+    v2s a, b, t;
+
+    n2 = fftLen >> 1;
+
+    // radix-2 stage, the butterflies are distributed over the cores
+    for (i = core_id; i < n2; i += nPE) {
+        CoSi = PLP_TWIDDLE_V2S_Q16(pCoef, i * twidCoefModifier);
+
+        l = i + n2;
+
+        a = __SRA2(*(v2s *)&pSrc[2 * i], ((v2s){ 1, 1 }));
+        b = __SRA2(*(v2s *)&pSrc[2 * l], ((v2s){ 1, 1 }));
+        t = __SUB2(a, b);
+        *((v2s *)&pSrc[i * 2]) = __SRA2(__ADD2(a, b), ((v2s){ 1, 1 }));
+
+        *((v2s *)&pSrc[l * 2]) = plp_cfft_twiddle_mult_q16(t, CoSi, plp_cfft_twiddle_rot_q16(CoSi));
+    }
+
+    plp_team_barrier();
+
+    // first col
+    plp_radix4_butterfly_q16p(pSrc, n2, (int16_t *)pCoef, 2U * twidCoefModifier, nPE, core_id);
+    // second col
+    plp_radix4_butterfly_q16p(pSrc + fftLen, n2, (int16_t *)pCoef, 2U * twidCoefModifier, nPE,
+                              core_id);
+
+    for (i = core_id; i < (fftLen >> 1); i += nPE) {
+        pa = *(v2s *)&pSrc[4 * i];
+        pb = *(v2s *)&pSrc[4 * i + 2];
+
+        pa = __SLL2(pa, ((v2s){ 1, 1 }));
+        pb = __SLL2(pb, ((v2s){ 1, 1 }));
+
+        *((v2s *)&pSrc[4 * i]) = pa;
+        *((v2s *)&pSrc[4 * i + 2]) = pb;
+    }
+
+    plp_team_barrier();
+}
+
+/*
+* Radix-4 FFT algorithm used is :
+*
+* Input real and imaginary data:
+* x(n) = xa + j * ya
+* x(n+N/4 ) = xb + j * yb
+* x(n+N/2 ) = xc + j * yc
+* x(n+3N 4) = xd + j * yd
+*
+*
+* Output real and imaginary data:
+* x(4r) = xa'+ j * ya'
+* x(4r+1) = xb'+ j * yb'
+* x(4r+2) = xc'+ j * yc'
+* x(4r+3) = xd'+ j * yd'
+*
+*
+* Twiddle factors for radix-4 FFT:
+* Wn = co1 + j * (- si1)
+* W2n = co2 + j * (- si2)
+* W3n = co3 + j * (- si3)
+
+* The real and imaginary output values for the radix-4 butterfly are
+* xa' = xa + xb + xc + xd
+* ya' = ya + yb + yc + yd
+* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1)
+* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1)
+* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2)
+* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2)
+* xd' = (xa-yb-xc+yd)* co3 + (ya+xb-yc-xd)* (si3)
+* yd' = (ya+xb-yc-xd)* co3 - (xa-yb-xc+yd)* (si3)
+*
+*/
+
+/**
+ * @brief  Core function for the parallel Q15 CFFT butterfly process.
+ * @param[in, out] *pSrc16          points to the in-place buffer of Q15 data type.
+ * @param[in]      fftLen           length of the FFT.
+ * @param[in]      *pCoef16         points to twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs
+ * with the same twiddle factor table.
+ * @param[in]      nPE              number of parallel processing units
+ * @param[in]      core_id          id of the calling core
+ * @return none.
+ */
+
+static void plp_radix4_butterfly_q16p(int16_t *pSrc16,
+                                      uint32_t fftLen,
+                                      int16_t *pCoef16,
+                                      uint32_t twidCoefModifier,
+                                      uint32_t nPE,
+                                      uint32_t core_id) {
+    v2s R, S, T, U, V;
+    v2s CoSi1, CoSi2, CoSi3, SiCo1, SiCo2, SiCo3, Tn;
+    uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
+    uint32_t jStart, jStep, gStart, gStep;
+
+    /* Total process is divided into three stages */
+
+    /* process first stage, middle stages, & last stage */
+
+    /* Initializations for the first stage */
+    n2 = fftLen;
+    n1 = n2;
+
+    /* n2 = fftLen/4 */
+    n2 >>= 2U;
+
+    /* Input is in 1.15(q15) format */
+
+    /* start of first stage process, the butterflies are distributed over the cores */
+    for (i0 = core_id; i0 < n2; i0 += nPE) {
+        /*Index for twiddle coefficient */
+        ic = i0 * twidCoefModifier;
+
+        /* Butterfly implementation */
+
+        /* index calculation for the input as, */
+        /* pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /* Reading i0, i0+fftLen/2 inputs */
+
+        /* input is down scale by 4 to avoid overflow */
+        /* Read ya (real), xa (imag) input */
+        T = __SRA2(*(v2s *)&pSrc16[i0 * 2U], ((v2s){ 2, 2 }));
+
+        /* input is down scale by 4 to avoid overflow */
+        /* Read yc (real), xc(imag) input */
+        S = __SRA2(*(v2s *)&pSrc16[i2 * 2U], ((v2s){ 2, 2 }));
+
+        /* R0 = (ya + yc) */
+        /* R1 = (xa + xc) */
+        R = __ADD2(T, S);
+
+        /* S0 = (ya - yc) */
+        /* S1 = (xa - xc) */
+        S = __SUB2(T, S);
+
+        /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
+        /* input is down scale by 4 to avoid overflow */
+        /* Read yb (real), xb(imag) input */
+        T = __SRA2(*(v2s *)&pSrc16[i1 * 2U], ((v2s){ 2, 2 }));
+
+        /* input is down scale by 4 to avoid overflow */
+        /* Read yd (real), xd(imag) input */
+        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+
+        /* T0 = (yb + yd) */
+        /* T1 = (xb + xd) */
+        V = __ADD2(T, U);
+
+        /*  writing the butterfly processed i0 sample */
+        /* ya' = ya + yb + yc + yd */
+        /* xa' = xa + xb + xc + xd */
+        *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 })));
+
+        /* R0 = (ya + yc) - (yb + yd) */
+        /* R1 = (xa + xc) - (xb + xd) */
+        R = __SUB2(R, V);
+
+        /* co2 & si2 are read from Coefficient pointer */
+        CoSi2 = PLP_TWIDDLE_V2S_Q16(pCoef16, 2U * ic);
+        SiCo2 = plp_cfft_twiddle_rot_q16(CoSi2);
+
+        /*  Reading i0+fftLen/4 */
+        /* input is down scale by 4 to avoid overflow */
+        /* T0 = yb, T1 =  xb */
+        // T = __SRA2(*(v2s *) &pSrc16[i1 *2U], ((v2s){2,2}));
+
+        /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
+        /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
+        /* writing the butterfly processed i0 + fftLen/4 sample */
+        /* writing output(xc', yc') in little endian format */
+        *((v2s *)&pSrc16[i1 * 2U]) = plp_cfft_twiddle_mult_q16(R, CoSi2, SiCo2);
+
+        /*  Butterfly calculations */
+        /* input is down scale by 4 to avoid overflow */
+        /* U0 = yd, U1 = xd */
+        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+
+        /* T0 = yb-yd */
+        /* T1 = xb-xd */
+        T = __SUB2(T, U);
+        Tn = __SUB2((v2s){ 0, 0 }, T);
+
+        /* R1 = (ya-yc) + (xb- xd),  R0 = (xa-xc) - (yb-yd)) */
+        R = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 3, 0 }));
+
+        /* S1 = (ya-yc) - (xb- xd), S0 = (xa-xc) + (yb-yd)) */
+        S = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 1, 2 }));
+
+        /* co1 & si1 are read from Coefficient pointer */
+        CoSi1 = PLP_TWIDDLE_V2S_Q16(pCoef16, ic);
+        SiCo1 = plp_cfft_twiddle_rot_q16(CoSi1);
+
+        /*  Butterfly process for the i0+fftLen/2 sample */
+        /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
+        /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
+        /* writing output(xb', yb') in little endian format */
+        *((v2s *)&pSrc16[i2 * 2U]) = plp_cfft_twiddle_mult_q16(S, CoSi1, SiCo1);
+
+        /* Co3 & si3 are read from Coefficient pointer */
+        CoSi3 = PLP_TWIDDLE_V2S_Q16(pCoef16, 3U * ic);
+        SiCo3 = plp_cfft_twiddle_rot_q16(CoSi3);
+
+        /*  Butterfly process for the i0+3fftLen/4 sample */
+        /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
+        /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
+        /* writing output(xd', yd') in little endian format */
+        *((v2s *)&pSrc16[i3 * 2U]) = plp_cfft_twiddle_mult_q16(R, CoSi3, SiCo3);
+
+    }
+    /* data is in 4.11(q11) format */
+
+    /* end of first stage process */
+
+    /* start of middle stage process */
+
+    /*  Twiddle coefficients index modifier */
+    twidCoefModifier <<= 2U;
+
+    /*  Calculation of Middle stage */
+    for (k = fftLen / 4U; k > 4U; k >>= 2U) {
+        /*  Initializations for the middle stage */
+        n1 = n2;
+        n2 >>= 2U;
+
+        /* distribute the twiddle factors over the cores, or the groups if there are less
+           twiddle factors than cores */
+        jStart = n2 >= nPE ? core_id : 0U;
+        jStep = n2 >= nPE ? nPE : 1U;
+        gStart = n2 >= nPE ? 0U : core_id;
+        gStep = n2 >= nPE ? 1U : nPE;
+
+        /* wait for the previous stage */
+        plp_team_barrier();
+
+        for (j = jStart; j < n2; j += jStep) {
+            /*  index calculation for the coefficients */
+            ic = j * twidCoefModifier;
+            CoSi1 = PLP_TWIDDLE_V2S_Q16(pCoef16, ic);
+            SiCo1 = plp_cfft_twiddle_rot_q16(CoSi1);
+            CoSi2 = PLP_TWIDDLE_V2S_Q16(pCoef16, 2U * ic);
+            SiCo2 = plp_cfft_twiddle_rot_q16(CoSi2);
+            CoSi3 = PLP_TWIDDLE_V2S_Q16(pCoef16, 3U * ic);
+            SiCo3 = plp_cfft_twiddle_rot_q16(CoSi3);
+
+            /*  Butterfly implementation */
+            for (i0 = j + gStart * n1; i0 < fftLen; i0 += gStep * n1) {
+                /*  index calculation for the input as, */
+                /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 +
+                 * 3fftLen/4] */
+                i1 = i0 + n2;
+                i2 = i1 + n2;
+                i3 = i2 + n2;
+
+                /*  Reading i0, i0+fftLen/2 inputs */
+                /* Read ya (real), xa(imag) input */
+                T = *(v2s *)&pSrc16[i0 * 2U];
+
+                /* Read yc (real), xc(imag) input */
+                S = *(v2s *)&pSrc16[i2 * 2U];
+
+                /* R0 = (ya + yc), R1 = (xa + xc) */
+                R = __ADD2(T, S);
+
+                /* S0 = (ya - yc), S1 =(xa - xc) */
+                S = __SUB2(T, S);
+
+                /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
+                /* Read yb (real), xb(imag) input */
+                T = *(v2s *)&pSrc16[i1 * 2U];
+
+                /* Read yd (real), xd(imag) input */
+                U = *(v2s *)&pSrc16[i3 * 2U];
+
+                /* T0 = (yb + yd), T1 = (xb + xd) */
+                V = __ADD2(T, U);
+
+                /*  writing the butterfly processed i0 sample */
+
+                /* xa' = xa + xb + xc + xd */
+                /* ya' = ya + yb + yc + yd */
+                *((v2s *)&pSrc16[i0 * 2U]) =
+                    __SRA2(__ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 }))),
+                           ((v2s){ 1, 1 }));
+
+                /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
+                R = __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 })));
+
+                /*  Reading i0+3fftLen/4 */
+                /* Read yb (real), xb(imag) input */
+                // T = *(v2s *) &pSrc16[i1 * 2U];
+
+                /* (ya-yb+yc-yd)* (si2) + (xa-xb+xc-xd)* co2 */
+                /* (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
+                /*  writing the butterfly processed i0 + fftLen/4 sample */
+                /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
+                /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
+                *((v2s *)&pSrc16[i1 * 2U]) = plp_cfft_twiddle_mult_q16(R, CoSi2, SiCo2);
+
+                /*  Butterfly calculations */
+
+                /* Read yd (real), xd(imag) input */
+                U = *(v2s *)&pSrc16[i3 * 2U];
+
+                /* T0 = yb-yd, T1 = xb-xd */
+                T = __SRA2(__SUB2(T, U), ((v2s){ 1, 1 }));
+                Tn = __SUB2((v2s){ 0, 0 }, T);
+
+                /* R0 = (ya-yc) + (xb- xd), R1 = (xa-xc) - (yb-yd)) */
+                R = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __builtin_shuffle(T, Tn, (v2s){ 3, 0 }));
+
+                /* S0 = (ya-yc) - (xb- xd), S1 = (xa-xc) + (yb-yd)) */
+                S = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __builtin_shuffle(T, Tn, (v2s){ 1, 2 }));
+
+                /*  Butterfly process for the i0+fftLen/2 sample */
+                /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
+                /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
+                *((v2s *)&pSrc16[i2 * 2U]) = plp_cfft_twiddle_mult_q16(S, CoSi1, SiCo1);
+
+                /*  Butterfly process for the i0+3fftLen/4 sample */
+                /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
+                /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
+                *((v2s *)&pSrc16[i3 * 2U]) = plp_cfft_twiddle_mult_q16(R, CoSi3, SiCo3);
+            }
+        }
+        /*  Twiddle coefficients index modifier */
+        twidCoefModifier <<= 2U;
+    }
+    /* end of middle stage process */
+
+    /* data is in 10.6(q6) format for the 1024 point */
+    /* data is in 8.8(q8) format for the 256 point */
+    /* data is in 6.10(q10) format for the 64 point */
+    /* data is in 4.12(q12) format for the 16 point */
+
+    /*  Initializations for the last stage */
+    n1 = n2;
+    n2 >>= 2U;
+
+    /* start of last stage process, the groups are distributed over the cores */
+
+    /* wait for the previous stage */
+    plp_team_barrier();
+
+    /*  Butterfly implementation */
+    for (i0 = core_id * n1; i0 <= (fftLen - n1); i0 += nPE * n1) {
+        /*  index calculation for the input as, */
+        /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /*  Reading i0, i0+fftLen/2 inputs */
+        /* Read ya (real), xa(imag) input */
+        T = *(v2s *)&pSrc16[i0 * 2U];
+
+        /* Read yc (real), xc(imag) input */
+        S = *(v2s *)&pSrc16[i2 * 2U];
+
+        /* R0 = (ya + yc), R1 = (xa + xc) */
+        R = __ADD2(T, S);
+
+        /* S0 = (ya - yc), S1 = (xa - xc) */
+        S = __SUB2(T, S);
+
+        /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
+        /* Read yb (real), xb(imag) input */
+        T = *(v2s *)&pSrc16[i1 * 2U];
+        /* Read yd (real), xd(imag) input */
+        U = *(v2s *)&pSrc16[i3 * 2U];
+
+        /* T0 = (yb + yd), T1 = (xb + xd)) */
+        T = __ADD2(T, U);
+
+        /*  writing the butterfly processed i0 sample */
+        /* xa' = xa + xb + xc + xd */
+        /* ya' = ya + yb + yc + yd */
+        *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
+
+        /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
+        R = __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
+
+        /* Read yb (real), xb(imag) input */
+        T = *(v2s *)&pSrc16[i1 * 2U];
+
+        /*  writing the butterfly processed i0 + fftLen/4 sample */
+        /* xc' = (xa-xb+xc-xd) */
+        /* yc' = (ya-yb+yc-yd) */
+        *((v2s *)&pSrc16[i1 * 2U]) = R;
+
+        /* Read yd (real), xd(imag) input */
+        U = *(v2s *)&pSrc16[i3 * 2U];
+
+        /* T0 = (yb - yd), T1 = (xb - xd)  */
+        T = __SUB2(T, U);
+
+        T = __SRA2(T, ((v2s){ 1, 1 }));
+        Tn = __SUB2((v2s){ 0, 0 }, T);
+        S = __SRA2(S, ((v2s){ 1, 1 }));
+
+        /*  writing the butterfly processed i0 + fftLen/2 sample */
+        /* xb' = (xa+yb-xc-yd) */
+        /* yb' = (ya-xb-yc+xd) */
+        *((v2s *)&pSrc16[i2 * 2U]) = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 1, 2 }));
+
+        /*  writing the butterfly processed i0 + 3fftLen/4 sample */
+        /* xd' = (xa-yb-xc+yd) */
+        /* yd' = (ya+xb-yc-xd) */
+        *((v2s *)&pSrc16[i3 * 2U]) = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 3, 0 }));
+    }
+
+    /* end of last stage process */
+
+    plp_team_barrier();
+
+    /* output is in 11.5(q5) format for the 1024 point */
+    /* output is in 9.7(q7) format for the 256 point   */
+    /* output is in 7.9(q9) format for the 64 point  */
+    /* output is in 5.11(q11) format for the 16 point  */
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -39,7 +39,10 @@
  * @{
  */
 
-static void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef);
+static void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                                   uint32_t fftLen,
+                                   const int16_t *pCoef,
+                                   uint32_t twidCoefModifier);
 
 static void plp_radix4_butterfly_q16(int16_t *pSrc16,
                                      uint32_t fftLen,
@@ -61,13 +64,13 @@ void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
         case 256:
         case 1024:
         case 4096:
-            plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, 1);
+            plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, PLP_TWIDDLE_STEP_Q16(L));
             break;
         case 32:
         case 128:
         case 512:
         case 2048:
-            plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle);
+            plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle, PLP_TWIDDLE_STEP_Q16(L));
             break;
         }
     }
@@ -76,7 +79,10 @@ void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
         plp_bitreversal_16s_rv32im((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
 }
 
-void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef) {
+void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                            uint32_t fftLen,
+                            const int16_t *pCoef,
+                            uint32_t twidCoefModifier) {
 
     uint32_t i;
     uint32_t n2;
@@ -89,9 +95,9 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
 
     ia = 0;
     for (i = 0; i < n2; i++) {
-        cosVal = pCoef[ia * 2];
-        sinVal = pCoef[(ia * 2) + 1];
-        ia++;
+        cosVal = PLP_TWIDDLE_COS_Q16(pCoef, ia);
+        sinVal = PLP_TWIDDLE_SIN_Q16(pCoef, ia);
+        ia += twidCoefModifier;
 
         l = i + n2;
 
@@ -109,9 +115,9 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
     }
 
     // first col
-    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U * twidCoefModifier);
     // second col
-    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U * twidCoefModifier);
 
     for (i = 0; i < (fftLen >> 1); i++) {
         p0 = pSrc[4 * i + 0];
@@ -263,8 +269,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         R1 = __CLIP(R1 - T1, 15);
 
         /* co2 & si2 are read from Coefficient pointer */
-        Co2 = pCoef16[2U * ic * 2U];
-        Si2 = pCoef16[(2U * ic * 2U) + 1];
+        Co2 = PLP_TWIDDLE_COS_Q16(pCoef16, 2U * ic);
+        Si2 = PLP_TWIDDLE_SIN_Q16(pCoef16, 2U * ic);
 
         /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
         out1 = (int16_t)((Co2 * R0 + Si2 * R1) >> 16U);
@@ -301,8 +307,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         S1 = (int16_t)__CLIP(((int32_t)S1 - T0), 15);
 
         /* co1 & si1 are read from Coefficient pointer */
-        Co1 = pCoef16[ic * 2U];
-        Si1 = pCoef16[(ic * 2U) + 1];
+        Co1 = PLP_TWIDDLE_COS_Q16(pCoef16, ic);
+        Si1 = PLP_TWIDDLE_SIN_Q16(pCoef16, ic);
         /*  Butterfly process for the i0+fftLen/2 sample */
         /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
         out1 = (int16_t)((Si1 * S1 + Co1 * S0) >> 16);
@@ -314,8 +320,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         pSrc16[(i2 * 2U) + 1] = out2;
 
         /* Co3 & si3 are read from Coefficient pointer */
-        Co3 = pCoef16[3U * (ic * 2U)];
-        Si3 = pCoef16[(3U * (ic * 2U)) + 1];
+        Co3 = PLP_TWIDDLE_COS_Q16(pCoef16, 3U * ic);
+        Si3 = PLP_TWIDDLE_SIN_Q16(pCoef16, 3U * ic);
         /*  Butterfly process for the i0+3fftLen/4 sample */
         /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
         out1 = (int16_t)((Si3 * R1 + Co3 * R0) >> 16U);
@@ -350,12 +356,12 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         for (j = 0U; j <= (n2 - 1U); j++) {
             /*  index calculation for the coefficients */
-            Co1 = pCoef16[ic * 2U];
-            Si1 = pCoef16[(ic * 2U) + 1U];
-            Co2 = pCoef16[2U * (ic * 2U)];
-            Si2 = pCoef16[(2U * (ic * 2U)) + 1U];
-            Co3 = pCoef16[3U * (ic * 2U)];
-            Si3 = pCoef16[(3U * (ic * 2U)) + 1U];
+            Co1 = PLP_TWIDDLE_COS_Q16(pCoef16, ic);
+            Si1 = PLP_TWIDDLE_SIN_Q16(pCoef16, ic);
+            Co2 = PLP_TWIDDLE_COS_Q16(pCoef16, 2U * ic);
+            Si2 = PLP_TWIDDLE_SIN_Q16(pCoef16, 2U * ic);
+            Co3 = PLP_TWIDDLE_COS_Q16(pCoef16, 3U * ic);
+            Si3 = PLP_TWIDDLE_SIN_Q16(pCoef16, 3U * ic);
 
             /*  Twiddle coefficients index modifier */
             ic = ic + twidCoefModifier;
@@ -39,20 +39,38 @@
  * @{
  */
 
-static void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef);
+/* rotated twiddle factor (-si, co) of (co, si), negated and swapped with a single shuffle */
+static inline v2s plp_cfft_twiddle_rot_q16(v2s CoSi) {
+    return __builtin_shuffle(CoSi, __SUB2((v2s){ 0, 0 }, CoSi), (v2s){ 3, 0 });
+}
+
+/* complex Q15 value X multiplied with the conjugate of the twiddle factor (co, si). The real and
+   imaginary parts are the upper halves of two dot products, which are packed with one shuffle. */
+static inline v2s plp_cfft_twiddle_mult_q16(v2s X, v2s CoSi, v2s SiCo) {
+    return __builtin_shuffle((v2s)__DOTP2(CoSi, X), (v2s)__DOTP2(SiCo, X), (v2s){ 1, 3 });
+}
+
+static void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                                   uint32_t fftLen,
+                                   const int16_t *pCoef,
+                                   uint32_t twidCoefModifier,
+                                   uint32_t stride);
 
 static void plp_radix4_butterfly_q16(int16_t *pSrc16,
                                      uint32_t fftLen,
                                      int16_t *pCoef16,
-                                     uint32_t twidCoefModifier);
+                                     uint32_t twidCoefModifier,
+                                     uint32_t stride);
 
-void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
-                           int16_t *p1,
-                           uint8_t ifftFlag,
-                           uint8_t bitReverseFlag,
-                           uint32_t deciPoint) {
+static inline void plp_cfft_q16_stride(const plp_cfft_instance_q16 *S,
+                                       int16_t *p1,
+                                       uint32_t stride,
+                                       uint8_t ifftFlag,
+                                       uint8_t bitReverseFlag) {
 
     uint32_t L = S->fftLen;
+    uint32_t i, a, b;
+    v2s tmp;
 
     if (ifftFlag == 0) {
         switch (L) {
@@ -61,22 +79,74 @@ void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
         case 256:
         case 1024:
         case 4096:
-            plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, 1);
+            plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, PLP_TWIDDLE_STEP_Q16(L),
+                                     stride);
             break;
         case 32:
         case 128:
         case 512:
         case 2048:
-            plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle);
+            plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle, PLP_TWIDDLE_STEP_Q16(L), stride);
             break;
         }
     }
 
-    if (bitReverseFlag)
-        plp_bitreversal_16v_xpulpv2((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
+    if (bitReverseFlag) {
+        if (stride == 1) {
+            plp_bitreversal_16v_xpulpv2((uint16_t *)p1, S->bitRevLength,
+                                        (const uint16_t *)S->pBitRevTable);
+        } else {
+            // the table holds 4 times the offsets of the unstrided samples in int16_t
+            for (i = 0; i < S->bitRevLength; i += 2) {
+                a = ((uint16_t)S->pBitRevTable[i] >> 2) * stride;
+                b = ((uint16_t)S->pBitRevTable[i + 1] >> 2) * stride;
+                tmp = *(v2s *)&p1[a];
+                *(v2s *)&p1[a] = *(v2s *)&p1[b];
+                *(v2s *)&p1[b] = tmp;
+            }
+        }
+    }
+}
+
+void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint) {
+
+    plp_cfft_q16_stride(S, p1, 1, ifftFlag, bitReverseFlag);
+}
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform of strided data for XPULPV2
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1           points to the first complex sample, sample k is at
+ * <code>p1 + 2*k*stride</code>. Processing occurs in-place.
+ * @param[in]  stride          distance between the complex samples, e.g. the row stride of a
+ * matrix for the transform of a column
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @return     none
+ */
+
+void plp_cfft_stride_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint32_t stride,
+                                  uint8_t ifftFlag,
+                                  uint8_t bitReverseFlag,
+                                  uint32_t deciPoint) {
+
+    plp_cfft_q16_stride(S, p1, stride, ifftFlag, bitReverseFlag);
 }
 
-void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef) {
+void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                            uint32_t fftLen,
+                            const int16_t *pCoef,
+                            uint32_t twidCoefModifier,
+                            uint32_t stride) {
 
     uint32_t i;
     uint32_t n2;
@@ -86,22 +156,23 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
     int16_t xt, yt, cosVal, sinVal;
     v2s CoSi;
     v2s a, b, t;
-    int16_t testa, testb;
+
+    uint32_t s2 = 2 * stride; // distance between the complex samples in int16_t
 
     n2 = fftLen >> 1;
 
     ia = 0;
     for (i = 0; i < n2; i++) {
-        CoSi = *(v2s *)&pCoef[ia * 2];
+        CoSi = PLP_TWIDDLE_V2S_Q16(pCoef, ia);
 
-        ia++;
+        ia += twidCoefModifier;
 
         l = i + n2;
 
-        a = __SRA2(*(v2s *)&pSrc[2 * i], ((v2s){ 1, 1 }));
-        b = __SRA2(*(v2s *)&pSrc[2 * l], ((v2s){ 1, 1 }));
+        a = __SRA2(*(v2s *)&pSrc[s2 * i], ((v2s){ 1, 1 }));
+        b = __SRA2(*(v2s *)&pSrc[s2 * l], ((v2s){ 1, 1 }));
         t = __SUB2(a, b);
-        *((v2s *)&pSrc[i * 2]) = __SRA2(__ADD2(a, b), ((v2s){ 1, 1 }));
+        *((v2s *)&pSrc[i * s2]) = __SRA2(__ADD2(a, b), ((v2s){ 1, 1 }));
 
         // xt = t[0];
         // yt = t[1];
@@ -114,26 +185,25 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
         // pSrc[2U * l + 1U] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) -
         //                ((int16_t) (((q31_t) xt * sinVal) >> 16)));
 
-        testa = (int16_t)(__DOTP2(t, CoSi) >> 16);
-        testb = (int16_t)(__DOTP2(t, __PACK2(-CoSi[1], CoSi[0])) >> 16);
-
-        *((v2s *)&pSrc[l * 2]) = __PACK2(testa, testb);
+        *((v2s *)&pSrc[l * s2]) =
+            plp_cfft_twiddle_mult_q16(t, CoSi, plp_cfft_twiddle_rot_q16(CoSi));
     }
 
     // first col
-    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U * twidCoefModifier, stride);
     // second col
-    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc + fftLen * stride, n2, (int16_t *)pCoef, 2U * twidCoefModifier,
+                             stride);
 
     for (i = 0; i < (fftLen >> 1); i++) {
-        pa = *(v2s *)&pSrc[4 * i];
-        pb = *(v2s *)&pSrc[4 * i + 2];
+        pa = *(v2s *)&pSrc[2 * i * s2];
+        pb = *(v2s *)&pSrc[(2 * i + 1) * s2];
 
         pa = __SLL2(pa, ((v2s){ 1, 1 }));
         pb = __SLL2(pb, ((v2s){ 1, 1 }));
 
-        *((v2s *)&pSrc[4 * i]) = pa;
-        *((v2s *)&pSrc[4 * i + 2]) = pb;
+        *((v2s *)&pSrc[2 * i * s2]) = pa;
+        *((v2s *)&pSrc[(2 * i + 1) * s2]) = pb;
     }
 }
 
@@ -178,15 +248,18 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
  * @param[in]      *pCoef16         points to twiddle coefficient buffer.
  * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs
  * with the same twiddle factor table.
+ * @param[in]      stride           distance between the complex samples of the buffer.
  * @return none.
  */
 
 void plp_radix4_butterfly_q16(int16_t *pSrc16,
                               uint32_t fftLen,
                               int16_t *pCoef16,
-                              uint32_t twidCoefModifier) {
+                              uint32_t twidCoefModifier,
+                              uint32_t stride) {
+    uint32_t s2 = 2 * stride; // distance between the complex samples in int16_t
     v2s R, S, T, U, V;
-    v2s CoSi1, CoSi2, CoSi3, out;
+    v2s CoSi1, CoSi2, CoSi3, SiCo1, SiCo2, SiCo3, Tn;
     uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
 
     /* Total process is divided into three stages */
@@ -224,11 +297,11 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         /* input is down scale by 4 to avoid overflow */
         /* Read ya (real), xa (imag) input */
-        T = __SRA2(*(v2s *)&pSrc16[i0 * 2U], ((v2s){ 2, 2 }));
+        T = __SRA2(*(v2s *)&pSrc16[i0 * s2], ((v2s){ 2, 2 }));
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yc (real), xc(imag) input */
-        S = __SRA2(*(v2s *)&pSrc16[i2 * 2U], ((v2s){ 2, 2 }));
+        S = __SRA2(*(v2s *)&pSrc16[i2 * s2], ((v2s){ 2, 2 }));
 
         /* R0 = (ya + yc) */
         /* R1 = (xa + xc) */
@@ -241,11 +314,11 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
         /* input is down scale by 4 to avoid overflow */
         /* Read yb (real), xb(imag) input */
-        T = __SRA2(*(v2s *)&pSrc16[i1 * 2U], ((v2s){ 2, 2 }));
+        T = __SRA2(*(v2s *)&pSrc16[i1 * s2], ((v2s){ 2, 2 }));
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yd (real), xd(imag) input */
-        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+        U = __SRA2(*(v2s *)&pSrc16[i3 * s2], ((v2s){ 2, 2 }));
 
         /* T0 = (yb + yd) */
         /* T1 = (xb + xd) */
@@ -254,14 +327,15 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 sample */
         /* ya' = ya + yb + yc + yd */
         /* xa' = xa + xb + xc + xd */
-        *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 })));
+        *((v2s *)&pSrc16[i0 * s2]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 })));
 
         /* R0 = (ya + yc) - (yb + yd) */
         /* R1 = (xa + xc) - (xb + xd) */
         R = __SUB2(R, V);
 
         /* co2 & si2 are read from Coefficient pointer */
-        CoSi2 = *(v2s *)&pCoef16[2U * ic * 2U];
+        CoSi2 = PLP_TWIDDLE_V2S_Q16(pCoef16, 2U * ic);
+        SiCo2 = plp_cfft_twiddle_rot_q16(CoSi2);
 
         /*  Reading i0+fftLen/4 */
         /* input is down scale by 4 to avoid overflow */
@@ -272,46 +346,43 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
         /* writing the butterfly processed i0 + fftLen/4 sample */
         /* writing output(xc', yc') in little endian format */
-        *((v2s *)&pSrc16[i1 * 2U]) =
-            __PACK2((int16_t)(__DOTP2(CoSi2, R) >> 16U),
-                    (int16_t)(__DOTP2(__PACK2(-CoSi2[1], CoSi2[0]), R) >> 16U));
+        *((v2s *)&pSrc16[i1 * s2]) = plp_cfft_twiddle_mult_q16(R, CoSi2, SiCo2);
 
         /*  Butterfly calculations */
         /* input is down scale by 4 to avoid overflow */
         /* U0 = yd, U1 = xd */
-        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+        U = __SRA2(*(v2s *)&pSrc16[i3 * s2], ((v2s){ 2, 2 }));
 
         /* T0 = yb-yd */
         /* T1 = xb-xd */
         T = __SUB2(T, U);
+        Tn = __SUB2((v2s){ 0, 0 }, T);
 
         /* R1 = (ya-yc) + (xb- xd),  R0 = (xa-xc) - (yb-yd)) */
-        R = __ADD2(S, __PACK2(-T[1], T[0]));
+        R = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 3, 0 }));
 
         /* S1 = (ya-yc) - (xb- xd), S0 = (xa-xc) + (yb-yd)) */
-        S = __ADD2(S, __PACK2(T[1], -T[0]));
+        S = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 1, 2 }));
 
         /* co1 & si1 are read from Coefficient pointer */
-        CoSi1 = *(v2s *)&pCoef16[ic * 2U];
+        CoSi1 = PLP_TWIDDLE_V2S_Q16(pCoef16, ic);
+        SiCo1 = plp_cfft_twiddle_rot_q16(CoSi1);
 
         /*  Butterfly process for the i0+fftLen/2 sample */
         /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
         /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
         /* writing output(xb', yb') in little endian format */
-        *((v2s *)&pSrc16[i2 * 2U]) =
-            __PACK2((int16_t)(__DOTP2(CoSi1, S) >> 16U),
-                    (int16_t)(__DOTP2(__PACK2(-CoSi1[1], CoSi1[0]), S) >> 16U));
+        *((v2s *)&pSrc16[i2 * s2]) = plp_cfft_twiddle_mult_q16(S, CoSi1, SiCo1);
 
         /* Co3 & si3 are read from Coefficient pointer */
-        CoSi3 = *(v2s *)&pCoef16[3U * (ic * 2U)];
+        CoSi3 = PLP_TWIDDLE_V2S_Q16(pCoef16, 3U * ic);
+        SiCo3 = plp_cfft_twiddle_rot_q16(CoSi3);
 
         /*  Butterfly process for the i0+3fftLen/4 sample */
         /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
         /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3)
         /* writing output(xd', yd') in little endian format */
-        *((v2s *)&pSrc16[i3 * 2U]) =
-            __PACK2((int16_t)(__DOTP2(CoSi3, R) >> 16U),
-                    (int16_t)(__DOTP2(__PACK2(-CoSi3[1], CoSi3[0]), R) >> 16U));
+        *((v2s *)&pSrc16[i3 * s2]) = plp_cfft_twiddle_mult_q16(R, CoSi3, SiCo3);
 
         /*  Twiddle coefficients index modifier */
         ic = ic + twidCoefModifier;
@@ -340,9 +411,12 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
             /*  index calculation for the coefficients */
 
             /*  index calculation for the coefficients */
-            CoSi1 = *(v2s *)&pCoef16[ic * 2U];
-            CoSi2 = *(v2s *)&pCoef16[2U * (ic * 2U)];
-            CoSi3 = *(v2s *)&pCoef16[3U * (ic * 2U)];
+            CoSi1 = PLP_TWIDDLE_V2S_Q16(pCoef16, ic);
+            SiCo1 = plp_cfft_twiddle_rot_q16(CoSi1);
+            CoSi2 = PLP_TWIDDLE_V2S_Q16(pCoef16, 2U * ic);
+            SiCo2 = plp_cfft_twiddle_rot_q16(CoSi2);
+            CoSi3 = PLP_TWIDDLE_V2S_Q16(pCoef16, 3U * ic);
+            SiCo3 = plp_cfft_twiddle_rot_q16(CoSi3);
 
             /*  Twiddle coefficients index modifier */
             ic = ic + twidCoefModifier;
@@ -358,10 +432,10 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
                 /*  Reading i0, i0+fftLen/2 inputs */
                 /* Read ya (real), xa(imag) input */
-                T = *(v2s *)&pSrc16[i0 * 2U];
+                T = *(v2s *)&pSrc16[i0 * s2];
 
                 /* Read yc (real), xc(imag) input */
-                S = *(v2s *)&pSrc16[i2 * 2U];
+                S = *(v2s *)&pSrc16[i2 * s2];
 
                 /* R0 = (ya + yc), R1 = (xa + xc) */
                 R = __ADD2(T, S);
@@ -371,10 +445,10 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
                 /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
                 /* Read yb (real), xb(imag) input */
-                T = *(v2s *)&pSrc16[i1 * 2U];
+                T = *(v2s *)&pSrc16[i1 * s2];
 
                 /* Read yd (real), xd(imag) input */
-                U = *(v2s *)&pSrc16[i3 * 2U];
+                U = *(v2s *)&pSrc16[i3 * s2];
 
                 /* T0 = (yb + yd), T1 = (xb + xd) */
                 V = __ADD2(T, U);
@@ -383,7 +457,7 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
                 /* xa' = xa + xb + xc + xd */
                 /* ya' = ya + yb + yc + yd */
-                *((v2s *)&pSrc16[i0 * 2U]) =
+                *((v2s *)&pSrc16[i0 * s2]) =
                     __SRA2(__ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 }))),
                            ((v2s){ 1, 1 }));
 
@@ -392,44 +466,39 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
                 /*  Reading i0+3fftLen/4 */
                 /* Read yb (real), xb(imag) input */
-                // T = *(v2s *) &pSrc16[i1 * 2U];
+                // T = *(v2s *) &pSrc16[i1 * s2];
 
                 /* (ya-yb+yc-yd)* (si2) + (xa-xb+xc-xd)* co2 */
                 /* (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
                 /*  writing the butterfly processed i0 + fftLen/4 sample */
                 /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
                 /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
-                *((v2s *)&pSrc16[i1 * 2U]) =
-                    __PACK2((int16_t)(__DOTP2(CoSi2, R) >> 16U),
-                            (int16_t)(__DOTP2(__PACK2(-CoSi2[1], CoSi2[0]), R) >> 16U));
+                *((v2s *)&pSrc16[i1 * s2]) = plp_cfft_twiddle_mult_q16(R, CoSi2, SiCo2);
 
                 /*  Butterfly calculations */
 
                 /* Read yd (real), xd(imag) input */
-                U = *(v2s *)&pSrc16[i3 * 2U];
+                U = *(v2s *)&pSrc16[i3 * s2];
 
                 /* T0 = yb-yd, T1 = xb-xd */
                 T = __SRA2(__SUB2(T, U), ((v2s){ 1, 1 }));
+                Tn = __SUB2((v2s){ 0, 0 }, T);
 
                 /* R0 = (ya-yc) + (xb- xd), R1 = (xa-xc) - (yb-yd)) */
-                R = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __PACK2(-T[1], T[0]));
+                R = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __builtin_shuffle(T, Tn, (v2s){ 3, 0 }));
 
                 /* S0 = (ya-yc) - (xb- xd), S1 = (xa-xc) + (yb-yd)) */
-                S = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __PACK2(T[1], -T[0]));
+                S = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __builtin_shuffle(T, Tn, (v2s){ 1, 2 }));
 
                 /*  Butterfly process for the i0+fftLen/2 sample */
                 /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
                 /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
-                *((v2s *)&pSrc16[i2 * 2U]) =
-                    __PACK2((int16_t)(__DOTP2(CoSi1, S) >> 16U),
-                            (int16_t)(__DOTP2(__PACK2(-CoSi1[1], CoSi1[0]), S) >> 16U));
+                *((v2s *)&pSrc16[i2 * s2]) = plp_cfft_twiddle_mult_q16(S, CoSi1, SiCo1);
 
                 /*  Butterfly process for the i0+3fftLen/4 sample */
                 /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
                 /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
-                *((v2s *)&pSrc16[i3 * 2U]) =
-                    __PACK2((int16_t)(__DOTP2(CoSi3, R) >> 16U),
-                            (int16_t)(__DOTP2(__PACK2(-CoSi3[1], CoSi3[0]), R) >> 16U));
+                *((v2s *)&pSrc16[i3 * s2]) = plp_cfft_twiddle_mult_q16(R, CoSi3, SiCo3);
             }
         }
         /*  Twiddle coefficients index modifier */
@@ -458,10 +527,10 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         /*  Reading i0, i0+fftLen/2 inputs */
         /* Read ya (real), xa(imag) input */
-        T = *(v2s *)&pSrc16[i0 * 2U];
+        T = *(v2s *)&pSrc16[i0 * s2];
 
         /* Read yc (real), xc(imag) input */
-        S = *(v2s *)&pSrc16[i2 * 2U];
+        S = *(v2s *)&pSrc16[i2 * s2];
 
         /* R0 = (ya + yc), R1 = (xa + xc) */
         R = __ADD2(T, S);
@@ -471,9 +540,9 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
         /* Read yb (real), xb(imag) input */
-        T = *(v2s *)&pSrc16[i1 * 2U];
+        T = *(v2s *)&pSrc16[i1 * s2];
         /* Read yd (real), xd(imag) input */
-        U = *(v2s *)&pSrc16[i3 * 2U];
+        U = *(v2s *)&pSrc16[i3 * s2];
 
         /* T0 = (yb + yd), T1 = (xb + xd)) */
         T = __ADD2(T, U);
@@ -481,37 +550,38 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 sample */
         /* xa' = xa + xb + xc + xd */
         /* ya' = ya + yb + yc + yd */
-        *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
+        *((v2s *)&pSrc16[i0 * s2]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
 
         /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
         R = __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
 
         /* Read yb (real), xb(imag) input */
-        T = *(v2s *)&pSrc16[i1 * 2U];
+        T = *(v2s *)&pSrc16[i1 * s2];
 
         /*  writing the butterfly processed i0 + fftLen/4 sample */
         /* xc' = (xa-xb+xc-xd) */
         /* yc' = (ya-yb+yc-yd) */
-        *((v2s *)&pSrc16[i1 * 2U]) = R;
+        *((v2s *)&pSrc16[i1 * s2]) = R;
 
         /* Read yd (real), xd(imag) input */
-        U = *(v2s *)&pSrc16[i3 * 2U];
+        U = *(v2s *)&pSrc16[i3 * s2];
 
         /* T0 = (yb - yd), T1 = (xb - xd)  */
         T = __SUB2(T, U);
 
         T = __SRA2(T, ((v2s){ 1, 1 }));
+        Tn = __SUB2((v2s){ 0, 0 }, T);
         S = __SRA2(S, ((v2s){ 1, 1 }));
 
         /*  writing the butterfly processed i0 + fftLen/2 sample */
         /* xb' = (xa+yb-xc-yd) */
         /* yb' = (ya-xb-yc+xd) */
-        *((v2s *)&pSrc16[i2 * 2U]) = __ADD2(S, __PACK2(T[1], -T[0]));
+        *((v2s *)&pSrc16[i2 * s2]) = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 1, 2 }));
 
         /*  writing the butterfly processed i0 + 3fftLen/4 sample */
         /* xd' = (xa-yb-xc+yd) */
         /* yd' = (ya+xb-yc-xd) */
-        *((v2s *)&pSrc16[i3 * 2U]) = __ADD2(S, __PACK2(-T[1], T[0]));
+        *((v2s *)&pSrc16[i3 * s2]) = __ADD2(S, __builtin_shuffle(T, Tn, (v2s){ 3, 0 }));
     }
 
     /* end of last stage process */
@@ -0,0 +1,147 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32s_xpulpv2.c
+ * Description:  32-bit fixed point complex FFT with block floating point scaling for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 32-bit fixed point complex FFT with block floating point scaling for XPULPV2 extension.
+   @param[in]      S               points to an instance of the 32-bit fixed point complex FFT
+                                   structure
+   @param[in,out]  p1              points to the complex data buffer of size 2 * fftLen in Q1.31
+                                   format, which is transformed in place
+   @param[in]      ifftFlag        selects the forward (ifftFlag = 0) or the inverse
+                                   (ifftFlag = 1) transform
+   @param[in]      bitReverseFlag  selects natural (bitReverseFlag = 1) or bit reversed
+                                   (bitReverseFlag = 0) order of the output
+   @return         block exponent e of the output: the DFT, or the inverse DFT, is the output
+                   multiplied by 2^e
+
+   @par
+   The Q1.31 products need 64-bit intermediates, which have no packed SIMD equivalent, so the
+   kernel follows the RV32IM one and relies on the hardware loops of the cluster cores. The
+   magnitudes for the block exponent are collected while the outputs of a stage are stored, such
+   that the scaling needs no additional pass over the data.
+*/
+int32_t plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
+                              int32_t *p1,
+                              uint8_t ifftFlag,
+                              uint8_t bitReverseFlag) {
+
+    uint32_t N = S->fftLen;
+    const int32_t *pTwiddle = S->pTwiddle;
+    int32_t exponent = 0;
+    uint32_t bits = 0; // OR of the magnitudes of the block
+    uint32_t n, j, m, span, step, shift;
+    int32_t ar, ai, br, bi, dr, di, wr, wi;
+
+    for (n = 0; n < 2 * N; n++) {
+        bits |= p1[n] ^ (p1[n] >> 31);
+    }
+
+    // normalize small signals, such that the largest magnitude is between 2^28 and 2^29
+    if (bits != 0 && bits < (1u << 28)) {
+        shift = __builtin_clz(bits) - 3;
+        exponent -= shift;
+        bits <<= shift;
+        for (n = 0; n < 2 * N; n++) {
+            p1[n] <<= shift;
+        }
+    }
+
+    for (span = N / 2, step = 1; span > 0; span >>= 1, step <<= 1) {
+
+        // least shift for which |a + b| and |(a - b) W| stay below 2^31
+        shift = (bits < (1u << 29)) ? 0 : ((bits < (1u << 30)) ? 1 : 2);
+        exponent += shift;
+        bits = 0;
+
+        for (j = 0; j < span; j++) {
+            wr = pTwiddle[2 * j * step];
+            wi = ifftFlag ? -pTwiddle[2 * j * step + 1] : pTwiddle[2 * j * step + 1];
+            for (n = j; n < N; n += 2 * span) {
+                ar = p1[2 * n] >> shift;
+                ai = p1[2 * n + 1] >> shift;
+                br = p1[2 * (n + span)] >> shift;
+                bi = p1[2 * (n + span) + 1] >> shift;
+                dr = ar - br;
+                di = ai - bi;
+                ar = ar + br;
+                ai = ai + bi;
+                br = ((int64_t)wr * dr - (int64_t)wi * di) >> 31;
+                bi = ((int64_t)wr * di + (int64_t)wi * dr) >> 31;
+                p1[2 * n] = ar;
+                p1[2 * n + 1] = ai;
+                p1[2 * (n + span)] = br;
+                p1[2 * (n + span) + 1] = bi;
+                bits |= (ar ^ (ar >> 31)) | (ai ^ (ai >> 31));
+                bits |= (br ^ (br >> 31)) | (bi ^ (bi >> 31));
+            }
+        }
+    }
+
+    // the output of the decimation in frequency is in bit reversed order
+    if (bitReverseFlag) {
+        uint32_t rev = 0; // bit reversed n
+        for (n = 0; n < N; n++) {
+            if (n < rev) {
+                ar = p1[2 * n];
+                ai = p1[2 * n + 1];
+                p1[2 * n] = p1[2 * rev];
+                p1[2 * n + 1] = p1[2 * rev + 1];
+                p1[2 * rev] = ar;
+                p1[2 * rev + 1] = ai;
+            }
+            for (m = N >> 1; rev & m; m >>= 1) {
+                rev ^= m;
+            }
+            rev |= m;
+        }
+    }
+
+    // the inverse DFT is scaled by 1 / N
+    if (ifftFlag) {
+        for (m = N; m > 1; m >>= 1) {
+            exponent--;
+        }
+    }
+
+    return exponent;
+}
+
+/**
+   @} end of fft group
+*/
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_f32s_xpulpv2.c
+ * Description:  Floating-point chirp-z transform for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup czt
+ */
+
+/**
+ * @addtogroup cztKernels
+ * @{
+ */
+
+/**
+ * @brief         Floating-point chirp-z transform for XPULPV2 extension.
+ * @param[in]     S         points to an instance of the floating-point CZT structure
+ * @param[in]     pSrc      points to the N complex input samples
+ * @param[out]    pDst      points to the M complex output points
+ * @param[out]    pScratch  points to a scratch buffer of size 4 * L
+ * @return        none
+ *
+ * @par
+ * The input is multiplied with the first chirp and zero-padded to L, convolved circularly with
+ * the chirp filter by a forward FFT, a multiplication with the precomputed filter spectrum and an
+ * inverse FFT, and the first M outputs are multiplied with the second chirp.
+ */
+void plp_czt_f32s_xpulpv2(const plp_czt_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pDst,
+                          float32_t *__restrict__ pScratch) {
+
+    uint32_t N = S->N;
+    uint32_t M = S->M;
+    uint32_t L = S->S->fftLen;
+    const float32_t *pPre = S->pPre;
+    const float32_t *pPost = S->pPost;
+    const float32_t *pFilter = S->pFilter;
+    float32_t *pY = pScratch;
+    float32_t *pTmp = pScratch + 2 * L;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        float32_t xr = pSrc[2 * n];
+        float32_t xi = pSrc[2 * n + 1];
+        float32_t wr = pPre[2 * n];
+        float32_t wi = pPre[2 * n + 1];
+        pY[2 * n] = xr * wr - xi * wi;
+        pY[2 * n + 1] = xr * wi + xi * wr;
+    }
+    for (n = 2 * N; n < 2 * L; n++) {
+        pY[n] = 0.0f;
+    }
+
+    plp_cfft_mr_f32s_xpulpv2(S->S, pY, pTmp, 0);
+
+    for (n = 0; n < L; n++) {
+        float32_t yr = pY[2 * n];
+        float32_t yi = pY[2 * n + 1];
+        float32_t hr = pFilter[2 * n];
+        float32_t hi = pFilter[2 * n + 1];
+        pY[2 * n] = yr * hr - yi * hi;
+        pY[2 * n + 1] = yr * hi + yi * hr;
+    }
+
+    /* the inverse transform is scaled by 1 / L, which completes the circular convolution */
+    plp_cfft_mr_f32s_xpulpv2(S->S, pY, pTmp, 1);
+
+    for (n = 0; n < M; n++) {
+        float32_t yr = pY[2 * n];
+        float32_t yi = pY[2 * n + 1];
+        float32_t wr = pPost[2 * n];
+        float32_t wi = pPost[2 * n + 1];
+        pDst[2 * n] = yr * wr - yi * wi;
+        pDst[2 * n + 1] = yr * wi + yi * wr;
+    }
+}
+
+/**
+ * @} end of cztKernels group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_f32_xpulpv2.c
+ * Description:  Floating-point DCT-II for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup dct
+   @{
+*/
+
+/**
+   @brief Floating-point DCT-II for XPULPV2 extension.
+   @param[in]   S         points to an instance of the DCT-II structure
+   @param[in]   pSrc      points to the input buffer of DCT length values
+   @param[out]  pScratch  points to a scratch buffer of 2 * DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values
+   @return      none
+*/
+void plp_dct2_f32_xpulpv2(const plp_dct2_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pScratch,
+                          float32_t *__restrict__ pDst) {
+
+    plp_rfft_instance_f32 fft = *S->S;
+    uint32_t length = fft.FFTLength;
+    uint32_t n, k, m;
+    uint32_t rev = 0; // bit reversed k
+    const Complex_type_f32 *pTwiddle = (const Complex_type_f32 *)S->pTwiddle;
+    const Complex_type_f32 *pBins = (const Complex_type_f32 *)pScratch;
+
+    // even samples in ascending, odd samples in descending order
+    for (n = 0; n < (length >> 1); n++) {
+        pDst[n] = pSrc[2 * n];
+        pDst[length - 1 - n] = pSrc[2 * n + 1];
+    }
+
+    fft.bitReverseFlag = 0;
+    if (fft.algorithm == PLP_RFFT_RADIX4 && length >= 4) {
+        plp_rfft_radix4_f32_xpulpv2(&fft, pDst, pScratch);
+    } else {
+        plp_rfft_f32_xpulpv2(&fft, pDst, pScratch);
+    }
+
+    // the FFT output is in bit reversed order, read bin k from position rev
+    for (k = 0; k < length; k++) {
+        pDst[k] = pBins[rev].re * pTwiddle[k].re - pBins[rev].im * pTwiddle[k].im;
+        for (m = length >> 1; rev & m; m >>= 1) {
+            rev ^= m;
+        }
+        rev |= m;
+    }
+}
+
+/**
+   @} end of dct group
+*/
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16s_rv32im.c
+ * Description:  16-bit fixed point DCT-IV for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup dct
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point DCT-IV for RV32IM extension.
+   @param[in]   S         points to an instance of the DCT-IV structure
+   @param[in]   pSrc      points to the input buffer of DCT length values in Q1.15 format
+   @param[out]  pScratch  points to a scratch buffer of DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values in Q1.15 format
+   @return      none
+*/
+void plp_dct4_q16s_rv32im(const plp_dct4_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pScratch,
+                          int16_t *__restrict__ pDst) {
+
+    uint32_t half = S->S->fftLen;
+    uint32_t length = 2 * half;
+    const int16_t *pPre = S->pTwiddle;
+    const int16_t *pPost = S->pTwiddle + length;
+    uint32_t n, k, m;
+    uint32_t rev = 0; // bit reversed k
+    int32_t re, im, wr, wi;
+
+    // z[n] = (x[2n] + j x[N - 1 - 2n]) * e^(-j pi (n + 1/4) / N) / 2
+    for (n = 0; n < half; n++) {
+        re = pSrc[2 * n];
+        im = pSrc[length - 1 - 2 * n];
+        wr = pPre[2 * n];
+        wi = pPre[2 * n + 1];
+        pScratch[2 * n] = (re * wr - im * wi) >> 16;
+        pScratch[2 * n + 1] = (re * wi + im * wr) >> 16;
+    }
+
+    plp_cfft_q16s_rv32im(S->S, pScratch, 0, 0, 15);
+
+    // w[k] = Z[k] * e^(-j pi k / N), the FFT output is in bit reversed order
+    for (k = 0; k < half; k++) {
+        re = pScratch[2 * rev];
+        im = pScratch[2 * rev + 1];
+        wr = pPost[2 * k];
+        wi = pPost[2 * k + 1];
+        pDst[2 * k] = (re * wr - im * wi) >> 15;
+        pDst[length - 1 - 2 * k] = -((re * wi + im * wr) >> 15);
+        for (m = half >> 1; rev & m; m >>= 1) {
+            rev ^= m;
+        }
+        rev |= m;
+    }
+}
+
+/**
+   @} end of dct group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fft2d_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point two-dimensional FFT kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel 16-bit fixed point two-dimensional FFT for XPULPV2
+ * @param[in]  args  points to a plp_fft2d_arg_q16 struct
+ * @return     none
+ */
+
+void plp_fft2d_q16p_xpulpv2(void *args) {
+
+    plp_fft2d_arg_q16 *a = (plp_fft2d_arg_q16 *)args;
+    uint32_t nRows = a->SCol->fftLen;
+    uint32_t nCols = a->SRow->fftLen;
+    uint32_t r, c;
+
+    // ROW PASS, every core transforms whole rows
+    for (r = plp_core_id(); r < nRows; r += a->nPE) {
+        plp_cfft_q16s_xpulpv2(a->SRow, a->p1 + 2 * r * a->stride, 0, a->bitReverseFlag, 0);
+    }
+
+    plp_team_barrier();
+
+    // COLUMN PASS, the samples of neighbouring columns are in neighbouring banks
+    for (c = plp_core_id(); c < nCols; c += a->nPE) {
+        plp_cfft_stride_q16s_xpulpv2(a->SCol, a->p1 + 2 * c, a->stride, 0, a->bitReverseFlag, 0);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q16s_rv32im.c
+ * Description:  16-bit fixed point Goertzel algorithm for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup goertzel
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point Goertzel algorithm for RV32IM extension.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples in Q1.15 format
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) in the Q1.15 format of the input, i.e.
+                           not divided by blockSize
+   @return      none
+*/
+void plp_goertzel_q16s_rv32im(const plp_goertzel_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pDst) {
+
+    uint32_t numBins = S->numBins;
+    const int32_t *pCoeffs = S->pCoeffs;
+    uint32_t k;
+    uint32_t n;
+
+    k = 0;
+    for (; k < numBins; k++) {
+        int32_t c = pCoeffs[2 * k];
+        int32_t s = pCoeffs[2 * k + 1];
+        int32_t s1 = 0;
+        int32_t s2 = 0;
+
+        for (n = 0; n < blockSize; n++) {
+            int32_t s0 = pSrc[n] + (int32_t)(((int64_t)c * s1 + (1 << 28)) >> 29) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        pDst[2 * k] = (int32_t)(((int64_t)c * s1 + (1 << 29)) >> 30) - s2;
+        pDst[2 * k + 1] = (int32_t)(((int64_t)s * s1 + (1 << 29)) >> 30);
+    }
+}
+
+/**
+   @} end of goertzel group
+*/
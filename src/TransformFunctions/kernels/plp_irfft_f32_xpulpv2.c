@@ -0,0 +1,192 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_irfft_f32_xpulpv2.c
+ * Description:  Floating-point inverse FFT with real output data for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+static inline void irfft_split_f32(const Complex_type_f32 *pSpectrum,
+                                   const Complex_type_f32 *twiddle_ptr,
+                                   Complex_type_f32 *pHalf,
+                                   int k,
+                                   int half_length);
+static inline void irfft_split_dc_f32(const Complex_type_f32 *pSpectrum,
+                                      Complex_type_f32 *pHalf,
+                                      int half_length);
+static inline void irfft_half_instance_f32(const plp_rfft_instance_f32 *S,
+                                           plp_cfft_instance_f32 *pHalf);
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @addtogroup fftKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the bins 0 to FFTLength / 2 of the spectrum (complex data)
+   @param[out]  pDst    points to the output buffer (real data), may be equal to pSrc
+   @return      none
+
+   @par
+   The spectrum of a real signal x of length N is conjugate symmetric, such that the bins 0 to
+   N / 2 determine it. They are merged into the spectrum Z of the complex signal
+   z[n] = x[2n] + j x[2n + 1] of length N / 2, which is the split stage of the real FFT in
+   reverse:
+
+       `Z[k] = E[k] + j O[k]`, with
+       `E[k] = (X[k] + conj(X[N/2 - k])) / 2` and
+       `O[k] = (X[k] - conj(X[N/2 - k])) W^-k / 2`
+
+   The bins k and N / 2 - k are computed together, such that every pair of input bins is read and
+   every twiddle factor is applied once. The half length inverse complex FFT of Z then yields the
+   output samples in their natural order, even and odd samples interleaved. It uses every second
+   twiddle factor of S, and computes the bit reversal on the fly.
+*/
+void plp_irfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+
+    int k;
+    int half = S->FFTLength >> 1;
+
+    const Complex_type_f32 *_in_ptr = (const Complex_type_f32 *)pSrc;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)pDst;
+    plp_cfft_instance_f32 halfFFT;
+
+    // SPLIT STAGE, bin N/2 is only read by the DC bin, so it may be overwritten in place
+    irfft_split_dc_f32(_in_ptr, _out_ptr, half);
+    for (k = 1; k <= (half >> 1); k++) {
+        irfft_split_f32(_in_ptr, _tw_ptr, _out_ptr, k, half);
+    } // k
+
+    // HALF LENGTH INVERSE FFT, scaled by 2 / N
+    irfft_half_instance_f32(S, &halfFFT);
+    plp_cfft_f32s_xpulpv2(&halfFFT, pDst, 1, 1);
+}
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+           version).
+   @param[in]   arg      points to an instance of the floating-point FFT structure
+   @return      none
+
+   @par
+   The pairs of bins of the split stage are distributed over the cores, followed by the parallel
+   half length inverse complex FFT.
+*/
+void plp_irfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
+
+    int k;
+
+    const plp_rfft_instance_f32 *S = arg->S;
+    const uint32_t nPE = arg->nPE;
+    int half = S->FFTLength >> 1;
+    int core_id = plp_core_id();
+
+    const Complex_type_f32 *_in_ptr = (const Complex_type_f32 *)arg->pSrc;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)arg->pDst;
+    plp_cfft_instance_f32 halfFFT;
+
+    // SPLIT STAGE
+    if (core_id == 0) {
+        irfft_split_dc_f32(_in_ptr, _out_ptr, half);
+    }
+    for (k = 1 + core_id; k <= (half >> 1); k += nPE) {
+        irfft_split_f32(_in_ptr, _tw_ptr, _out_ptr, k, half);
+    } // k
+
+    plp_team_barrier();
+
+    // HALF LENGTH INVERSE FFT, every core passes the same instance
+    irfft_half_instance_f32(S, &halfFFT);
+    plp_cfft_parallel_arg_f32 cfftArg = { &halfFFT, arg->pDst, 1, 1, nPE };
+    plp_cfft_f32p_xpulpv2((void *)&cfftArg);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void irfft_split_f32(const Complex_type_f32 *pSpectrum,
+                                   const Complex_type_f32 *twiddle_ptr,
+                                   Complex_type_f32 *pHalf,
+                                   int k,
+                                   int half_length) {
+
+    Complex_type_f32 a = pSpectrum[k];
+    Complex_type_f32 b = pSpectrum[half_length - k];
+    Complex_type_f32 tw = twiddle_ptr[k];
+    Complex_type_f32 r0, r1;
+
+    // E = (a + conj(b)) / 2 and D = (a - conj(b)) / 2
+    float32_t e_re = 0.5f * (a.re + b.re);
+    float32_t e_im = 0.5f * (a.im - b.im);
+    float32_t d_re = 0.5f * (a.re - b.re);
+    float32_t d_im = 0.5f * (a.im + b.im);
+
+    // O = conj(W^k) * D
+    float32_t o_re = tw.re * d_re + tw.im * d_im;
+    float32_t o_im = tw.re * d_im - tw.im * d_re;
+
+    // Z[k] = E + j O and Z[N/2 - k] = conj(E) + j conj(O), as W^-(N/2 - k) = -W^k
+    r0.re = e_re - o_im;
+    r0.im = e_im + o_re;
+    r1.re = e_re + o_im;
+    r1.im = o_re - e_im;
+
+    pHalf[k] = r0;
+    pHalf[half_length - k] = r1;
+}
+
+static inline void irfft_split_dc_f32(const Complex_type_f32 *pSpectrum,
+                                      Complex_type_f32 *pHalf,
+                                      int half_length) {
+
+    // the bins 0 and N/2 are real
+    float32_t x0 = pSpectrum[0].re;
+    float32_t x1 = pSpectrum[half_length].re;
+
+    pHalf[0].re = 0.5f * (x0 + x1);
+    pHalf[0].im = 0.5f * (x0 - x1);
+}
+
+static inline void irfft_half_instance_f32(const plp_rfft_instance_f32 *S,
+                                           plp_cfft_instance_f32 *pHalf) {
+
+    pHalf->fftLen = S->FFTLength >> 1;
+    pHalf->pTwiddle = S->pTwiddleFactors;
+    pHalf->pBitRevLUT = NULL;
+    pHalf->tableStride = 2;
+}
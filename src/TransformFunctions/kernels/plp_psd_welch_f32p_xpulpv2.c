@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32p_xpulpv2.c
+ * Description:  32-bit floating-point parallel Welch power spectral density kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Parallel floating-point Welch power spectral density estimator for XPULPV2 extension.
+   @param[in]  args  points to a plp_psd_welch_arg_f32 struct initialized by
+                     plp_psd_welch_f32_parallel
+   @return     none
+*/
+void plp_psd_welch_f32p_xpulpv2(void *args) {
+
+    plp_psd_welch_arg_f32 *a = (plp_psd_welch_arg_f32 *)args;
+    const plp_psd_welch_instance_f32 *S = a->S;
+    uint32_t length = S->S->FFTLength;
+    uint32_t numBins = (length >> 1) + 1;
+    uint32_t numSegments = a->numSegments;
+    uint32_t nPE = a->nPE;
+    uint32_t core = plp_core_id();
+    float32_t *pSums = a->pScratch + nPE * 2 * length;
+    float32_t *pAcc = (core == 0) ? a->pDst : pSums + (core - 1) * numBins;
+    float32_t scale = S->scale / (float32_t)numSegments;
+    float32_t sum;
+    uint32_t s, k, c;
+
+    for (k = 0; k < numBins; k++) {
+        pAcc[k] = 0.0f;
+    }
+
+    for (s = core; s < numSegments; s += nPE) {
+        plp_stft_acc_f32_xpulpv2(S->S, a->pSrc + s * S->hopSize, 0, S->pWindow, S->windowMirror,
+                                 a->pScratch + core * 2 * length, pAcc);
+    }
+
+    plp_team_barrier();
+
+    // the cores add the sums of neighbouring bins, which are in different banks
+    for (k = core; k < numBins; k += nPE) {
+        sum = a->pDst[k];
+        for (c = 1; c < nPE; c++) {
+            sum += pSums[(c - 1) * numBins + k];
+        }
+        a->pDst[k] = sum * scale;
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of psdWelch group
+*/
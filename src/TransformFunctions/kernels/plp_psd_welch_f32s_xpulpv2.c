@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Welch power spectral density kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Floating-point Welch power spectral density estimator for XPULPV2 extension.
+   @param[in]   S            points to an instance of the Welch structure
+   @param[in]   pSrc         points to the input samples
+   @param[in]   numSegments  number of segments K, at least 1
+   @param[in]   pScratch     points to a scratch buffer of 2 * FFTLength floats
+   @param[out]  pDst         points to the output buffer of FFTLength / 2 + 1 bins
+   @return      none
+*/
+void plp_psd_welch_f32s_xpulpv2(const plp_psd_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t numSegments,
+                                float32_t *__restrict__ pScratch,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t numBins = (S->S->FFTLength >> 1) + 1;
+    float32_t scale = S->scale / (float32_t)numSegments;
+    uint32_t s, k;
+
+    for (k = 0; k < numBins; k++) {
+        pDst[k] = 0.0f;
+    }
+
+    for (s = 0; s < numSegments; s++) {
+        plp_stft_acc_f32_xpulpv2(S->S, pSrc + s * S->hopSize, 0, S->pWindow, S->windowMirror,
+                                 pScratch, pDst);
+    }
+
+    for (k = 0; k < numBins; k++) {
+        pDst[k] *= scale;
+    }
+}
+
+/**
+   @} end of psdWelch group
+*/
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16p_xpulpv2.c
+ * Description:  16-bit fixed point parallel Welch power spectral density kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline uint32_t plp_psd_welch_scale_q16(uint32_t invEnergy,
+                                               uint32_t numSegments,
+                                               uint32_t shift);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Parallel 16-bit fixed point Welch power spectral density estimator for XPULPV2
+          extension.
+   @param[in]  args  points to a plp_psd_welch_arg_q16 struct initialized by
+                     plp_psd_welch_q16_parallel
+   @return     none
+*/
+void plp_psd_welch_q16p_xpulpv2(void *args) {
+
+    plp_psd_welch_arg_q16 *a = (plp_psd_welch_arg_q16 *)args;
+    const plp_psd_welch_instance_q16 *S = a->S;
+    uint32_t length = S->S->fftLen;
+    uint32_t numBins = (length >> 1) + 1;
+    uint32_t numSegments = a->numSegments;
+    uint32_t nPE = a->nPE;
+    uint32_t core = plp_core_id();
+    uint32_t shift = 32 - __builtin_clz((numSegments - 1) | 1);
+    int32_t *pSums = (int32_t *)(a->pScratch + nPE * 2 * length);
+    int32_t *pAcc = (core == 0) ? a->pDst : pSums + (core - 1) * numBins;
+    uint32_t scale;
+    uint32_t s, k, c;
+    int64_t p;
+
+    if (numSegments == 1) {
+        shift = 0;
+    }
+
+    for (k = 0; k < numBins; k++) {
+        pAcc[k] = 0;
+    }
+
+    for (s = core; s < numSegments; s += nPE) {
+        plp_stft_acc_q16s_xpulpv2(S->S, a->pSrc + s * S->hopSize, 0, S->pWindow, S->windowMirror,
+                                  shift, a->pScratch + core * 2 * length, pAcc);
+    }
+
+    plp_team_barrier();
+
+    // the cores add the sums of neighbouring bins, which are in different banks
+    scale = plp_psd_welch_scale_q16(S->invEnergy, numSegments, shift);
+    for (k = core; k < numBins; k += nPE) {
+        p = a->pDst[k];
+        for (c = 1; c < nPE; c++) {
+            p += pSums[(c - 1) * numBins + k];
+        }
+        p = (p * scale + (1 << 15)) >> 16;
+        a->pDst[k] = p > 0x7FFFFFFF ? 0x7FFFFFFF : p;
+    }
+
+    plp_team_barrier();
+}
+
+/**
+   @} end of psdWelch group
+*/
+
+/* Scale factor of the sum of numSegments powers, shifted right by shift, in Q16.16 format */
+static inline uint32_t plp_psd_welch_scale_q16(uint32_t invEnergy,
+                                               uint32_t numSegments,
+                                               uint32_t shift) {
+
+    // 2^shift / numSegments is in [1, 2)
+    uint32_t ratio = (1U << (shift + 15)) / numSegments;
+    return (uint32_t)(((uint64_t)invEnergy * ratio) >> 15);
+}
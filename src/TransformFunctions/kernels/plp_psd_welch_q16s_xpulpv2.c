@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16s_xpulpv2.c
+ * Description:  16-bit fixed point Welch power spectral density kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline uint32_t plp_psd_welch_scale_q16(uint32_t invEnergy,
+                                               uint32_t numSegments,
+                                               uint32_t shift);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point Welch power spectral density estimator for XPULPV2 extension.
+   @param[in]   S            points to an instance of the Welch structure
+   @param[in]   pSrc         points to the input samples in Q1.15 format
+   @param[in]   numSegments  number of segments K, at least 1
+   @param[in]   pScratch     points to a scratch buffer of 2 * fftLen samples
+   @param[out]  pDst         points to the output buffer of fftLen / 2 + 1 bins in Q2.30 format
+   @return      none
+*/
+void plp_psd_welch_q16s_xpulpv2(const plp_psd_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t numSegments,
+                                int16_t *__restrict__ pScratch,
+                                int32_t *__restrict__ pDst) {
+
+    uint32_t numBins = (S->S->fftLen >> 1) + 1;
+    uint32_t shift = 32 - __builtin_clz((numSegments - 1) | 1);
+    uint32_t scale;
+    uint32_t s, k;
+    int64_t p;
+
+    if (numSegments == 1) {
+        shift = 0;
+    }
+
+    for (k = 0; k < numBins; k++) {
+        pDst[k] = 0;
+    }
+
+    for (s = 0; s < numSegments; s++) {
+        plp_stft_acc_q16s_xpulpv2(S->S, pSrc + s * S->hopSize, 0, S->pWindow, S->windowMirror,
+                                  shift, pScratch, pDst);
+    }
+
+    scale = plp_psd_welch_scale_q16(S->invEnergy, numSegments, shift);
+    for (k = 0; k < numBins; k++) {
+        p = ((int64_t)pDst[k] * scale + (1 << 15)) >> 16;
+        pDst[k] = p > 0x7FFFFFFF ? 0x7FFFFFFF : p;
+    }
+}
+
+/**
+   @} end of psdWelch group
+*/
+
+/* Scale factor of the sum of numSegments powers, shifted right by shift, in Q16.16 format */
+static inline uint32_t plp_psd_welch_scale_q16(uint32_t invEnergy,
+                                               uint32_t numSegments,
+                                               uint32_t shift) {
+
+    // 2^shift / numSegments is in [1, 2)
+    uint32_t ratio = (1U << (shift + 15)) / numSegments;
+    return (uint32_t)(((uint64_t)invEnergy * ratio) >> 15);
+}
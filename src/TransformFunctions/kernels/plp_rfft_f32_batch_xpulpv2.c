@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_f32_batch_xpulpv2.c
+ * Description:  Batched floating-point FFT on real input data for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @addtogroup fftKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point FFT of a batch of real input channels for XPULPV2 extension. Every core
+           transforms whole channels.
+   @param[in]   args     points to a plp_rfft_batch_arg_f32 struct
+   @return      none
+*/
+void plp_rfft_f32_batch_xpulpv2(void *args) {
+
+    plp_rfft_batch_arg_f32 *a = (plp_rfft_batch_arg_f32 *)args;
+    const plp_rfft_instance_f32 *S = a->S;
+    uint32_t stride = a->channelStride;
+    uint32_t c;
+
+    for (c = plp_core_id(); c < a->nChannels; c += a->nPE) {
+        if (S->algorithm == PLP_RFFT_RADIX4 && S->FFTLength >= 4) {
+            plp_rfft_radix4_f32_xpulpv2(S, a->pSrc + c * stride, a->pDst + 2 * c * stride);
+        } else {
+            plp_rfft_f32_xpulpv2(S, a->pSrc + c * stride, a->pDst + 2 * c * stride);
+        }
+    }
+}
+
+/**
+   @} end of fftKernels group
+*/
@@ -45,8 +45,41 @@ static inline void process_butterfly_radix2(Complex_type_f32 *input,
                                             int index,
                                             int distance,
                                             Complex_type_f32 *twiddle_ptr);
+static inline void process_butterfly_radix2_tw(Complex_type_f32 *input,
+                                               Complex_type_f32 tw0,
+                                               int index,
+                                               int distance);
 static inline void
 process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex);
+static inline Complex_type_f32
+twiddle_radix4(const Complex_type_f32 *twiddle_ptr, int twiddle_index, int half_length);
+static inline void process_butterfly_real_radix4(float32_t x0,
+                                                 float32_t x1,
+                                                 float32_t x2,
+                                                 float32_t x3,
+                                                 Complex_type_f32 *output,
+                                                 int distance,
+                                                 Complex_type_f32 tw1,
+                                                 Complex_type_f32 tw2,
+                                                 Complex_type_f32 tw3);
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int distance,
+                                            Complex_type_f32 tw1,
+                                            Complex_type_f32 tw2,
+                                            Complex_type_f32 tw3);
+static inline void process_butterfly_last_radix4(Complex_type_f32 *input);
+static inline void reorder_values(const plp_rfft_instance_f32 *S, Complex_type_f32 *_out_ptr);
+static inline float32_t complex_mag_squared(Complex_type_f32 A);
+static inline uint32_t bit_rev_increment(uint32_t rev, uint32_t half_range);
+static inline void stft_power_f32(const plp_rfft_instance_f32 *S,
+                                  const float32_t *__restrict__ pState,
+                                  uint32_t start,
+                                  const float32_t *__restrict__ pWindow,
+                                  uint32_t windowMirror,
+                                  float32_t *__restrict__ pScratch,
+                                  float32_t *__restrict__ pDst,
+                                  uint8_t accumulate);
+static inline void store_power(float32_t *pDst, uint32_t k, float32_t power, uint8_t accumulate);
 
 /**
   @ingroup fft
@@ -55,7 +88,9 @@ process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output,
 /**
   @defgroup fftKernels FFT Kernels
   These kernels calculate the FFT transform on the input data.
-  Supported algorithms: radix-2
+  Supported algorithms: radix-2 and radix-4 (radix-2^2, with a final radix-2 stage when log2 of
+  the length is odd). Both compute the decimation in frequency in place and produce the output
+  in the same (bit reversed) order, hence they share the twiddle factors and the bit reversal.
 */
 
 /**
@@ -76,14 +111,12 @@ void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
 
     int k, j, stage, step, d, index;
 
-    Complex_type_f32 temp;
     int dist = S->FFTLength >> 1;
     int nbutterfly = S->FFTLength >> 1;
     int butt = 2; // number of butterflies in the same group
 
     const float32_t *_in_ptr_real;
     Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
     Complex_type_f32 *_tw_ptr;
 
     // FIRST STAGE, input is real, stage=1
@@ -128,47 +161,142 @@ void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
 
     // ORDER VALUES
     if (S->bitReverseFlag) {
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 0; j < S->FFTLength; j += 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
+        reorder_values(S, (Complex_type_f32 *)pDst);
     }
 }
 
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension, radix-4 algorithm.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+
+   @par
+   Every pass merges two radix-2 stages into one radix-4 (radix-2^2) butterfly, which keeps the
+   bit reversed output order of plp_rfft_f32_xpulpv2. The number of passes over pDst is halved,
+   and the butterflies need 3 instead of 4 complex multiplications. The three twiddle factors of
+   a butterfly are loaded once and used for all groups of the pass. The last pass is either a
+   radix-4 pass or a radix-2 stage, both without multiplications. FFTLength must be at least 4.
+*/
+void plp_rfft_radix4_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst) {
+
+    int j, d, g;
+
+    int length = S->FFTLength;
+    int half = length >> 1;
+    int dist = length >> 2; // distance between the four inputs of a butterfly
+    int ngroup = 1;         // number of butterfly groups in the same pass
+
+    Complex_type_f32 *_in_ptr;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 tw1, tw2, tw3;
+
+    // FIRST PASS, input is real
+    _in_ptr = (Complex_type_f32 *)pDst;
+    for (d = 0; d < dist; d++) {
+        tw1 = _tw_ptr[d];
+        tw2 = _tw_ptr[2 * d];
+        tw3 = twiddle_radix4(_tw_ptr, 3 * d, half);
+        process_butterfly_real_radix4(pSrc[d], pSrc[d + dist], pSrc[d + 2 * dist],
+                                      pSrc[d + 3 * dist], &_in_ptr[d], dist, tw1, tw2, tw3);
+    } // d
+
+    // PASSES 2 -> n-1
+    while (dist > 4) {
+        dist = dist >> 2;
+        ngroup = ngroup << 2;
+        for (d = 0; d < dist; d++) {
+            tw1 = _tw_ptr[d * ngroup];
+            tw2 = _tw_ptr[2 * d * ngroup];
+            tw3 = twiddle_radix4(_tw_ptr, 3 * d * ngroup, half);
+            _in_ptr = (Complex_type_f32 *)pDst + d;
+            for (g = 0; g < ngroup; g++) {
+                process_butterfly_radix4(_in_ptr, dist, tw1, tw2, tw3);
+                _in_ptr += 4 * dist;
+            } // g
+        }     // d
+    }
+
+    // LAST PASS, twiddle factors are all 1
+    _in_ptr = (Complex_type_f32 *)pDst;
+    if (dist == 4) {
+        for (j = 0; j < length; j += 4) {
+            process_butterfly_last_radix4(&_in_ptr[j]);
+        } // j
+    } else if (dist == 2) {
+        for (j = 0; j < length; j += 2) {
+            process_butterfly_last_radix2(&_in_ptr[j], (Complex_type_f32 *)pDst, j);
+        } // j
+    }
+
+    // ORDER VALUES
+    if (S->bitReverseFlag) {
+        reorder_values(S, (Complex_type_f32 *)pDst);
+    }
+}
+
+/**
+   @brief  Power spectrum of one windowed frame of a ring buffer for XPULPV2 extension, used by
+           plp_stft_f32.
+   @param[in]   S             points to an instance of the floating-point FFT structure
+   @param[in]   pState        points to the ring buffer of FFTLength samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_f32), 0 if
+                              pWindow holds all FFTLength samples
+   @param[in]   pScratch      points to a scratch buffer of 2 * FFTLength floats
+   @param[out]  pDst          points to the output buffer, FFTLength / 2 + 1 bins
+   @return      none
+
+   @par
+   This is the radix-4 algorithm of plp_rfft_radix4_f32_xpulpv2. The first pass reads the frame
+   from the ring buffer and multiplies it with the window. Its inputs d and d + N / 4 are in the
+   first half of the window, and d + N / 2 and d + 3N / 4 in the second half, which is read
+   backwards from the mirror index of a symmetric window. The last pass computes the squared
+   magnitude of its results and stores it in natural order to pDst, which replaces the bit
+   reversal. bitReverseFlag of S is ignored, and FFTLength must be at least 4.
+*/
+void plp_stft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                          const float32_t *__restrict__ pState,
+                          uint32_t start,
+                          const float32_t *__restrict__ pWindow,
+                          uint32_t windowMirror,
+                          float32_t *__restrict__ pScratch,
+                          float32_t *__restrict__ pDst) {
+
+    stft_power_f32(S, pState, start, pWindow, windowMirror, pScratch, pDst, 0);
+}
+
+/**
+   @brief  Power spectrum of one windowed frame of a ring buffer for XPULPV2 extension, which is
+           added to pDst, used by plp_psd_welch_f32.
+   @param[in]   S             points to an instance of the floating-point FFT structure
+   @param[in]   pState        points to the ring buffer of FFTLength samples
+   @param[in]   start         index of the first sample of the frame in the ring buffer
+   @param[in]   pWindow       points to the window coefficients
+   @param[in]   windowMirror  mirror index of the window (see plp_window_instance_f32), 0 if
+                              pWindow holds all FFTLength samples
+   @param[in]   pScratch      points to a scratch buffer of 2 * FFTLength floats
+   @param[in,out] pDst        points to the accumulated power, FFTLength / 2 + 1 bins
+   @return      none
+
+   @par
+   This is plp_stft_f32_xpulpv2, but the last pass adds the squared magnitude to pDst.
+*/
+void plp_stft_acc_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                              const float32_t *__restrict__ pState,
+                              uint32_t start,
+                              const float32_t *__restrict__ pWindow,
+                              uint32_t windowMirror,
+                              float32_t *__restrict__ pScratch,
+                              float32_t *__restrict__ pDst) {
+
+    stft_power_f32(S, pState, start, pWindow, windowMirror, pScratch, pDst, 1);
+}
+
 /**
    @brief  Floating-point FFT on real input data for XPULPV2 extension.
    @param[in]   arg      points to an instance of the floating-point FFT structure
@@ -193,7 +321,7 @@ void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
     Complex_type_f32 *_out_ptr;
     Complex_type_f32 *_tw_ptr;
 
-    int core_id = rt_core_id();
+    int core_id = plp_core_id();
 
     // FIRST STAGE, input is real, stage=1
     stage = 1;
@@ -211,40 +339,45 @@ void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
     dist = dist >> 1;
 
     // STAGES 2 -> n-1
-    while (dist > nPE / 2) {
-        rt_team_barrier();
+    // The cores take neighbouring butterflies d of a group, so their data accesses fall into
+    // different banks. All butterflies d of the groups j share the twiddle factor W^(d butt),
+    // which every core loads once and applies to all groups. The twiddle factors of a stage are
+    // butt entries apart and mostly in the same bank, so this avoids the contention of reloading
+    // them for every group.
+    while (dist > nPE / 2 && dist > 1) {
+        plp_team_barrier();
         step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-            for (d = 0; d < dist / nPE; d++) {
-                process_butterfly_radix2(_in_ptr, (d * nPE + core_id) * butt, j * step, dist,
-                                         _tw_ptr);
-                _in_ptr += nPE;
-            } // d
-        }     // j
+        for (d = 0; d < dist / nPE; d++) {
+            Complex_type_f32 tw0 = _tw_ptr[(d * nPE + core_id) * butt];
+            _in_ptr = (Complex_type_f32 *)&pDst[2 * (d * nPE + core_id)];
+            for (j = 0; j < butt; j++) {
+                process_butterfly_radix2_tw(_in_ptr, tw0, j * step, dist);
+            } // j
+        }     // d
         stage = stage + 1;
         dist = dist >> 1;
         butt = butt << 1;
     }
 
+    // Once a group has fewer butterflies than there are cores, nPE / dist cores share the groups
+    // and every core keeps the butterfly d = core_id % dist, i.e. a single twiddle factor for the
+    // stage. The concurrent accesses of the cores are then at most dist apart, instead of a whole
+    // group, which would map all of them to the same bank.
     while (dist > 1) {
-        rt_team_barrier();
+        plp_team_barrier();
         step = dist << 1;
-        for (j = 0; j < butt / nPE; j++) {
-            _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
-            ;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, butt * d, (j * nPE + core_id) * step, dist,
-                                         _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
+        d = core_id & (dist - 1);
+        Complex_type_f32 tw0 = _tw_ptr[butt * d];
+        _in_ptr = (Complex_type_f32 *)pDst + d;
+        for (j = core_id / dist; j < butt; j += nPE / dist) {
+            process_butterfly_radix2_tw(_in_ptr, tw0, j * step, dist);
+        } // j
         stage = stage + 1;
         dist = dist >> 1;
         butt = butt << 1;
     }
 
-    rt_team_barrier();
+    plp_team_barrier();
 
     // LAST STAGE
     _in_ptr = (Complex_type_f32 *)&pDst[4 * core_id];
@@ -255,50 +388,34 @@ void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
         index += 2 * nPE;
     } // j
 
-    rt_team_barrier();
+    plp_team_barrier();
 
     // ORDER VALUES
     if (S->bitReverseFlag) {
 
-        int index1, index2, index3, index4;
         _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 4 * core_id; j < S->FFTLength; j += nPE * 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
+        if (S->pBitRevTable) {
+            // the pairs are distributed over the cores, every pair is swapped once
+            for (j = 2 * core_id; j < S->bitRevLength; j += 2 * nPE) {
+                unsigned int pair = *((unsigned int *)(&S->pBitRevTable[j]));
+                index = pair & 0x0000FFFF;
+                d = pair >> 16;
+                temp = _out_ptr[index];
+                _out_ptr[index] = _out_ptr[d];
+                _out_ptr[d] = temp;
             }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
+        } else {
+            int log2FFTLen = log2(S->FFTLength);
+            for (j = core_id; j < S->FFTLength; j += nPE) {
+                index = bit_rev_radix2(j, log2FFTLen);
+                if (index > j) {
+                    temp = _out_ptr[j];
+                    _out_ptr[j] = _out_ptr[index];
+                    _out_ptr[index] = temp;
+                }
             }
         }
-        rt_team_barrier();
+        plp_team_barrier();
     }
 }
 
@@ -366,6 +483,14 @@ static inline void process_butterfly_radix2(Complex_type_f32 *input,
                                             int distance,
                                             Complex_type_f32 *twiddle_ptr) {
 
+    process_butterfly_radix2_tw(input, twiddle_ptr[twiddle_index], index, distance);
+}
+
+static inline void process_butterfly_radix2_tw(Complex_type_f32 *input,
+                                               Complex_type_f32 tw0,
+                                               int index,
+                                               int distance) {
+
     Complex_type_f32 r0, r1;
 
     float32_t d0 = input[index].re;
@@ -383,8 +508,6 @@ static inline void process_butterfly_radix2(Complex_type_f32 *input,
     r0.im = e0 + e1;
     r1.im = e0 - e1;
 
-    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
-
     input[index] = r0;
     input[index + distance] = complex_mul(tw0, r1);
 }
@@ -411,3 +534,252 @@ process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output,
     output[outindex] = r0;
     output[outindex + 1] = r1;
 }
+
+static inline Complex_type_f32
+twiddle_radix4(const Complex_type_f32 *twiddle_ptr, int twiddle_index, int half_length) {
+
+    // only W^k for k < N/2 is stored, W^k = -W^(k - N/2) otherwise
+    if (twiddle_index < half_length) {
+        return twiddle_ptr[twiddle_index];
+    }
+
+    Complex_type_f32 result = twiddle_ptr[twiddle_index - half_length];
+    result.re = -result.re;
+    result.im = -result.im;
+    return result;
+}
+
+static inline void process_butterfly_real_radix4(float32_t x0,
+                                                 float32_t x1,
+                                                 float32_t x2,
+                                                 float32_t x3,
+                                                 Complex_type_f32 *output,
+                                                 int distance,
+                                                 Complex_type_f32 tw1,
+                                                 Complex_type_f32 tw2,
+                                                 Complex_type_f32 tw3) {
+
+    float32_t a = x0 + x2;
+    float32_t b = x1 + x3;
+    float32_t c = x0 - x2;
+    float32_t e = x1 - x3;
+
+    Complex_type_f32 r0, r2, r3;
+
+    r0.re = a + b;
+    r0.im = 0.0f;
+
+    // c - j*e and c + j*e
+    r2.re = c;
+    r2.im = -e;
+    r3.re = c;
+    r3.im = e;
+
+    output[0] = r0;
+    output[distance] = complex_mul_real(a - b, tw2);
+    output[2 * distance] = complex_mul(tw1, r2);
+    output[3 * distance] = complex_mul(tw3, r3);
+}
+
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int distance,
+                                            Complex_type_f32 tw1,
+                                            Complex_type_f32 tw2,
+                                            Complex_type_f32 tw3) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[distance];
+    Complex_type_f32 x2 = input[2 * distance];
+    Complex_type_f32 x3 = input[3 * distance];
+
+    Complex_type_f32 r0, r1, r2, r3;
+
+    float32_t a_re = x0.re + x2.re;
+    float32_t a_im = x0.im + x2.im;
+    float32_t b_re = x1.re + x3.re;
+    float32_t b_im = x1.im + x3.im;
+    float32_t c_re = x0.re - x2.re;
+    float32_t c_im = x0.im - x2.im;
+    float32_t e_re = x1.re - x3.re;
+    float32_t e_im = x1.im - x3.im;
+
+    r0.re = a_re + b_re;
+    r0.im = a_im + b_im;
+    r1.re = a_re - b_re;
+    r1.im = a_im - b_im;
+
+    // c - j*e and c + j*e
+    r2.re = c_re + e_im;
+    r2.im = c_im - e_re;
+    r3.re = c_re - e_im;
+    r3.im = c_im + e_re;
+
+    input[0] = r0;
+    input[distance] = complex_mul(tw2, r1);
+    input[2 * distance] = complex_mul(tw1, r2);
+    input[3 * distance] = complex_mul(tw3, r3);
+}
+
+static inline void process_butterfly_last_radix4(Complex_type_f32 *input) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[1];
+    Complex_type_f32 x2 = input[2];
+    Complex_type_f32 x3 = input[3];
+
+    float32_t a_re = x0.re + x2.re;
+    float32_t a_im = x0.im + x2.im;
+    float32_t b_re = x1.re + x3.re;
+    float32_t b_im = x1.im + x3.im;
+    float32_t c_re = x0.re - x2.re;
+    float32_t c_im = x0.im - x2.im;
+    float32_t e_re = x1.re - x3.re;
+    float32_t e_im = x1.im - x3.im;
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[0].re = a_re + b_re;
+    input[0].im = a_im + b_im;
+    input[1].re = a_re - b_re;
+    input[1].im = a_im - b_im;
+    input[2].re = c_re + e_im;
+    input[2].im = c_im - e_re;
+    input[3].re = c_re - e_im;
+    input[3].im = c_im + e_re;
+}
+
+static inline float32_t complex_mag_squared(Complex_type_f32 A) {
+
+    return A.re * A.re + A.im * A.im;
+}
+
+static inline uint32_t bit_rev_increment(uint32_t rev, uint32_t half_range) {
+
+    // add one at the most significant bit of the range, and propagate the carry downwards
+    while (rev & half_range) {
+        rev ^= half_range;
+        half_range >>= 1;
+    }
+    return rev | half_range;
+}
+
+static inline void reorder_values(const plp_rfft_instance_f32 *S, Complex_type_f32 *_out_ptr) {
+
+    int i, j, index1, index2;
+    uint32_t rev = 0;
+    Complex_type_f32 temp;
+
+    if (S->pBitRevTable) {
+        // both indices of a pair are loaded at once, and the pair is swapped without a test
+        for (i = 0; i < S->bitRevLength; i += 2) {
+            unsigned int pair = *((unsigned int *)(&S->pBitRevTable[i]));
+            index1 = pair & 0x0000FFFF;
+            index2 = pair >> 16;
+            temp = _out_ptr[index1];
+            _out_ptr[index1] = _out_ptr[index2];
+            _out_ptr[index2] = temp;
+        }
+    } else {
+        for (j = 0; j < S->FFTLength; j++) {
+            if (rev > j) {
+                temp = _out_ptr[j];
+                _out_ptr[j] = _out_ptr[rev];
+                _out_ptr[rev] = temp;
+            }
+            rev = bit_rev_increment(rev, S->FFTLength >> 1);
+        }
+    }
+}
+
+static inline void stft_power_f32(const plp_rfft_instance_f32 *S,
+                                  const float32_t *__restrict__ pState,
+                                  uint32_t start,
+                                  const float32_t *__restrict__ pWindow,
+                                  uint32_t windowMirror,
+                                  float32_t *__restrict__ pScratch,
+                                  float32_t *__restrict__ pDst,
+                                  uint8_t accumulate) {
+
+    int j, d, g;
+
+    int length = S->FFTLength;
+    int half = length >> 1;
+    int mask = length - 1;
+    int dist = length >> 2; // distance between the four inputs of a butterfly
+    int ngroup = 1;         // number of butterfly groups in the same pass
+    uint32_t rev = 0;       // bit reversed index of the current group of the last pass
+
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)pScratch;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 tw1, tw2, tw3;
+
+    // second half of the window, the sample half + i is pWindow2[step * i]
+    const float32_t *pWindow2 = pWindow + half;
+    int step = 1;
+    if (windowMirror != 0) {
+        pWindow2 = pWindow + windowMirror - half;
+        step = -1;
+    }
+
+    // FIRST PASS, input is the windowed frame
+    for (d = 0; d < dist; d++) {
+        tw1 = _tw_ptr[d];
+        tw2 = _tw_ptr[2 * d];
+        tw3 = twiddle_radix4(_tw_ptr, 3 * d, half);
+        process_butterfly_real_radix4(pState[(start + d) & mask] * pWindow[d],
+                                      pState[(start + d + dist) & mask] * pWindow[d + dist],
+                                      pState[(start + d + 2 * dist) & mask] * pWindow2[step * d],
+                                      pState[(start + d + 3 * dist) & mask] *
+                                          pWindow2[step * (d + dist)],
+                                      &_in_ptr[d], dist, tw1, tw2, tw3);
+    } // d
+
+    // PASSES 2 -> n-1
+    while (dist > 4) {
+        dist = dist >> 2;
+        ngroup = ngroup << 2;
+        for (d = 0; d < dist; d++) {
+            tw1 = _tw_ptr[d * ngroup];
+            tw2 = _tw_ptr[2 * d * ngroup];
+            tw3 = twiddle_radix4(_tw_ptr, 3 * d * ngroup, half);
+            _in_ptr = (Complex_type_f32 *)pScratch + d;
+            for (g = 0; g < ngroup; g++) {
+                process_butterfly_radix4(_in_ptr, dist, tw1, tw2, tw3);
+                _in_ptr += 4 * dist;
+            } // g
+        }     // d
+    }
+
+    // LAST PASS, the outputs at j + 1, j + 2 and j + 3 belong to the bins rev + N/2, rev + N/4
+    // and rev + 3N/4, where rev is the bit reversed j. Only the bins up to N/2 are stored.
+    _in_ptr = (Complex_type_f32 *)pScratch;
+    if (dist == 4) {
+        for (j = 0; j < length; j += 4) {
+            process_butterfly_last_radix4(&_in_ptr[j]);
+            store_power(pDst, rev, complex_mag_squared(_in_ptr[j]), accumulate);
+            store_power(pDst, rev + (length >> 2), complex_mag_squared(_in_ptr[j + 2]),
+                        accumulate);
+            rev = bit_rev_increment(rev, length >> 3);
+        } // j
+        store_power(pDst, half, complex_mag_squared(_in_ptr[1]), accumulate);
+    } else if (dist == 2) {
+        for (j = 0; j < length; j += 2) {
+            process_butterfly_last_radix2(&_in_ptr[j], _in_ptr, j);
+            store_power(pDst, rev, complex_mag_squared(_in_ptr[j]), accumulate);
+            rev = bit_rev_increment(rev, length >> 2);
+        } // j
+        store_power(pDst, half, complex_mag_squared(_in_ptr[1]), accumulate);
+    } else {
+        // FFTLength = 4, the first pass already computed the whole transform
+        store_power(pDst, 0, complex_mag_squared(_in_ptr[0]), accumulate);
+        store_power(pDst, 1, complex_mag_squared(_in_ptr[2]), accumulate);
+        store_power(pDst, 2, complex_mag_squared(_in_ptr[1]), accumulate);
+    }
+}
+
+static inline void store_power(float32_t *pDst, uint32_t k, float32_t power, uint8_t accumulate) {
+    if (accumulate) {
+        pDst[k] += power;
+    } else {
+        pDst[k] = power;
+    }
+}
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_rv32im.c
+ * Description:  16-bit fixed point real FFT for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point FFT on real input data for RV32IM extension.
+   @param[in]   S     points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.15 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.15 format
+   @return      none
+*/
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pDst) {
+
+    uint32_t half = S->S->fftLen;
+    const int16_t *pTwiddle = S->pTwiddle;
+    uint32_t n, k;
+    int32_t ar, ai, br, bi, er, ei, dr, di, pr, pi, wr, wi;
+
+    for (n = 0; n < 2 * half; n++) {
+        pDst[n] = pSrc[n];
+    }
+
+    // Z / (N / 2) in natural order
+    plp_cfft_q16s_rv32im(S->S, pDst, 0, 1, 15);
+
+    // X[0] = Re(Z[0]) + Im(Z[0]) and X[N/2] = Re(Z[0]) - Im(Z[0])
+    ar = pDst[0];
+    ai = pDst[1];
+    pDst[0] = (ar + ai) >> 1;
+    pDst[1] = 0;
+    pDst[2 * half] = (ar - ai) >> 1;
+    pDst[2 * half + 1] = 0;
+
+    for (k = 1; k <= half / 2; k++) {
+        ar = pDst[2 * k];
+        ai = pDst[2 * k + 1];
+        br = pDst[2 * (half - k)];
+        bi = -pDst[2 * (half - k) + 1];
+        wr = pTwiddle[2 * k];
+        wi = pTwiddle[2 * k + 1];
+
+        // E = Z[k] + Z*[N/2 - k], D = Z[k] - Z*[N/2 - k], P = W^k D
+        er = ar + br;
+        ei = ai + bi;
+        dr = ar - br;
+        di = ai - bi;
+        pr = ((wr * dr) >> 15) - ((wi * di) >> 15);
+        pi = ((wr * di) >> 15) + ((wi * dr) >> 15);
+
+        // X[k] = (E - j P) / 4 and X[N/2 - k] = (E* - j P*) / 4
+        pDst[2 * k] = (er + pi) >> 2;
+        pDst[2 * k + 1] = (ei - pr) >> 2;
+        pDst[2 * (half - k)] = (er - pi) >> 2;
+        pDst[2 * (half - k) + 1] = (-ei - pr) >> 2;
+    }
+}
+
+/**
+   @} end of fft group
+*/
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_xpulpv2.c
+ * Description:  16-bit fixed point real FFT for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point FFT on real input data for XPULPV2 extension.
+   @param[in]   S     points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.15 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.15 format
+   @return      none
+
+   @par Exploiting SIMD instructions
+   The input is copied with packed loads and stores. In the split stage, the halved sums and
+   differences of the bins are computed on packed values, and the twiddle rotation is computed
+   with two dot products.
+*/
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pDst) {
+
+    uint32_t half = S->S->fftLen;
+    const v2s *pTwiddle = (const v2s *)S->pTwiddle;
+    const v2s *pIn = (const v2s *)pSrc;
+    v2s *pBuf = (v2s *)pDst;
+    uint32_t n, k;
+    int32_t ar, ai, pr, pi;
+    v2s a, b, e, d, w;
+
+    for (n = 0; n < half; n++) {
+        pBuf[n] = pIn[n];
+    }
+
+    // Z / (N / 2) in natural order
+    plp_cfft_q16s_xpulpv2(S->S, pDst, 0, 1, 15);
+
+    // X[0] = Re(Z[0]) + Im(Z[0]) and X[N/2] = Re(Z[0]) - Im(Z[0])
+    ar = pDst[0];
+    ai = pDst[1];
+    pBuf[0] = __PACK2((ar + ai) >> 1, 0);
+    pBuf[half] = __PACK2((ar - ai) >> 1, 0);
+
+    for (k = 1; k <= half / 2; k++) {
+        a = __SRA2(pBuf[k], ((v2s){ 1, 1 }));
+        b = __SRA2(pBuf[half - k], ((v2s){ 1, 1 }));
+        b = __PACK2(b[0], -b[1]);
+        w = pTwiddle[k];
+
+        // E / 2 = (Z[k] + Z*[N/2 - k]) / 2, D / 2 = (Z[k] - Z*[N/2 - k]) / 2, P / 2 = W^k D / 2
+        e = __ADD2(a, b);
+        d = __SUB2(a, b);
+        pr = __DOTP2(d, __PACK2(w[0], -w[1])) >> 15;
+        pi = __DOTP2(d, __PACK2(w[1], w[0])) >> 15;
+
+        // X[k] = (E - j P) / 4 and X[N/2 - k] = (E* - j P*) / 4
+        pBuf[k] = __PACK2((e[0] + pi) >> 1, (e[1] - pr) >> 1);
+        pBuf[half - k] = __PACK2((e[0] - pi) >> 1, (-e[1] - pr) >> 1);
+    }
+}
+
+/**
+   @} end of fft group
+*/
@@ -0,0 +1,125 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32s_xpulpv2.c
+ * Description:  32-bit fixed point real FFT for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 32-bit fixed point FFT on real input data for XPULPV2 extension.
+   @param[in]   S     points to an instance of the 32-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.31 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values in Q1.31 format
+   @return      none
+
+   @par
+   The Q1.31 products need 64-bit intermediates, which have no packed SIMD equivalent, so the
+   kernel follows the RV32IM one and relies on the hardware loops of the cluster cores.
+*/
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst) {
+
+    uint32_t half = S->FFTLength / 2;
+    const int32_t *pTwiddle = S->pTwiddle;
+    uint32_t n, k, m, j, span, step;
+    uint32_t rev = 0; // bit reversed n
+    int32_t ar, ai, br, bi, er, ei, dr, di, pr, pi, wr, wi;
+
+    // z[n] = x[2n] + j x[2n + 1], stored in bit reversed order
+    for (n = 0; n < half; n++) {
+        pDst[2 * rev] = pSrc[2 * n];
+        pDst[2 * rev + 1] = pSrc[2 * n + 1];
+        for (m = half >> 1; rev & m; m >>= 1) {
+            rev ^= m;
+        }
+        rev |= m;
+    }
+
+    // radix-2 butterflies with the twiddle factors W_{2 span}^j = W_N^(j N / (2 span))
+    for (span = 1, step = half; span < half; span <<= 1, step >>= 1) {
+        for (j = 0; j < span; j++) {
+            wr = pTwiddle[2 * j * step];
+            wi = pTwiddle[2 * j * step + 1];
+            for (n = j; n < half; n += 2 * span) {
+                ar = pDst[2 * n] >> 1;
+                ai = pDst[2 * n + 1] >> 1;
+                br = pDst[2 * (n + span)];
+                bi = pDst[2 * (n + span) + 1];
+                pr = ((int64_t)wr * br - (int64_t)wi * bi) >> 32;
+                pi = ((int64_t)wr * bi + (int64_t)wi * br) >> 32;
+                pDst[2 * n] = ar + pr;
+                pDst[2 * n + 1] = ai + pi;
+                pDst[2 * (n + span)] = ar - pr;
+                pDst[2 * (n + span) + 1] = ai - pi;
+            }
+        }
+    }
+
+    // X[0] = Re(Z[0]) + Im(Z[0]) and X[N/2] = Re(Z[0]) - Im(Z[0])
+    ar = pDst[0];
+    ai = pDst[1];
+    pDst[0] = ((int64_t)ar + ai) >> 1;
+    pDst[1] = 0;
+    pDst[2 * half] = ((int64_t)ar - ai) >> 1;
+    pDst[2 * half + 1] = 0;
+
+    for (k = 1; k <= half / 2; k++) {
+        ar = pDst[2 * k] >> 1;
+        ai = pDst[2 * k + 1] >> 1;
+        br = pDst[2 * (half - k)] >> 1;
+        bi = -(pDst[2 * (half - k) + 1] >> 1);
+        wr = pTwiddle[2 * k];
+        wi = pTwiddle[2 * k + 1];
+
+        // E / 2 = (Z[k] + Z*[N/2 - k]) / 2, D / 2 = (Z[k] - Z*[N/2 - k]) / 2, P / 2 = W^k D / 2
+        er = ar + br;
+        ei = ai + bi;
+        dr = ar - br;
+        di = ai - bi;
+        pr = ((int64_t)wr * dr - (int64_t)wi * di) >> 31;
+        pi = ((int64_t)wr * di + (int64_t)wi * dr) >> 31;
+
+        // X[k] = (E - j P) / 4 and X[N/2 - k] = (E* - j P*) / 4
+        pDst[2 * k] = ((int64_t)er + pi) >> 1;
+        pDst[2 * k + 1] = ((int64_t)ei - pr) >> 1;
+        pDst[2 * (half - k)] = ((int64_t)er - pi) >> 1;
+        pDst[2 * (half - k) + 1] = (-(int64_t)ei - pr) >> 1;
+    }
+}
+
+/**
+   @} end of fft group
+*/
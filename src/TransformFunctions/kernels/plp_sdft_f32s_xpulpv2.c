@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_f32s_xpulpv2.c
+ * Description:  32-bit floating-point sliding DFT for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup goertzel
+   @{
+*/
+
+/**
+   @brief 32-bit floating-point sliding DFT for XPULPV2 extension.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block
+   @return      none
+*/
+void plp_sdft_f32s_xpulpv2(plp_sdft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t length = S->length;
+    uint32_t numBins = S->numBins;
+    const float32_t *pCoeffs = S->pCoeffs;
+    float32_t damping = S->damping;
+    float32_t *pState = S->pState;
+    float32_t *pDelay = S->pDelay;
+    uint32_t index = S->index;
+    uint32_t k;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        float32_t x = pSrc[n];
+
+        // x[n] - r^N x[n - N], where x[n - N] is replaced by x[n] in the delay line
+        float32_t d = x - damping * pDelay[index];
+        pDelay[index] = x;
+        index = (index + 1 == length) ? 0 : index + 1;
+
+        // two bins at once
+        for (k = 0; k + 1 < numBins; k += 2) {
+            float32_t a0 = pState[2 * k] + d;
+            float32_t b0 = pState[2 * k + 1];
+            float32_t wr0 = pCoeffs[2 * k];
+            float32_t wi0 = pCoeffs[2 * k + 1];
+            pState[2 * k] = wr0 * a0 - wi0 * b0;
+            pState[2 * k + 1] = wr0 * b0 + wi0 * a0;
+            float32_t a1 = pState[2 * k + 2] + d;
+            float32_t b1 = pState[2 * k + 3];
+            float32_t wr1 = pCoeffs[2 * k + 2];
+            float32_t wi1 = pCoeffs[2 * k + 3];
+            pState[2 * k + 2] = wr1 * a1 - wi1 * b1;
+            pState[2 * k + 3] = wr1 * b1 + wi1 * a1;
+        }
+        if (k < numBins) {
+            float32_t a = pState[2 * k] + d;
+            float32_t b = pState[2 * k + 1];
+            float32_t wr = pCoeffs[2 * k];
+            float32_t wi = pCoeffs[2 * k + 1];
+            pState[2 * k] = wr * a - wi * b;
+            pState[2 * k + 1] = wr * b + wi * a;
+        }
+    }
+
+    S->index = index;
+
+    for (k = 0; k < 2 * numBins; k++) {
+        pDst[k] = pState[k];
+    }
+}
+
+/**
+   @} end of goertzel group
+*/
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_q16s_rv32im.c
+ * Description:  16-bit fixed point sliding DFT for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup goertzel
+   @{
+*/
+
+/**
+   @brief 16-bit fixed point sliding DFT for RV32IM extension.
+   @param[in,out] S        points to an instance of the sliding DFT structure, whose bins and
+                           delay line are updated
+   @param[in]   pSrc       points to the block of new input samples in Q1.15 format
+   @param[in]   blockSize  Number of new input samples
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) of the last N samples after the block, in
+                           the Q1.15 format of the input, i.e. not divided by N
+   @return      none
+*/
+void plp_sdft_q16s_rv32im(plp_sdft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst) {
+
+    uint32_t length = S->length;
+    uint32_t numBins = S->numBins;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t damping = S->damping;
+    int32_t *pState = S->pState;
+    int16_t *pDelay = S->pDelay;
+    uint32_t index = S->index;
+    uint32_t k;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        int16_t x = pSrc[n];
+
+        // x[n] - r^N x[n - N], where x[n - N] is replaced by x[n] in the delay line
+        int32_t d = x - (int32_t)(((int64_t)damping * pDelay[index] + (1 << 29)) >> 30);
+        pDelay[index] = x;
+        index = (index + 1 == length) ? 0 : index + 1;
+
+        for (k = 0; k < numBins; k++) {
+            int32_t a = pState[2 * k] + d;
+            int32_t b = pState[2 * k + 1];
+            int32_t wr = pCoeffs[2 * k];
+            int32_t wi = pCoeffs[2 * k + 1];
+            pState[2 * k] = (int32_t)(((int64_t)wr * a - (int64_t)wi * b + (1 << 29)) >> 30);
+            pState[2 * k + 1] = (int32_t)(((int64_t)wr * b + (int64_t)wi * a + (1 << 29)) >> 30);
+        }
+    }
+
+    S->index = index;
+
+    for (k = 0; k < 2 * numBins; k++) {
+        pDst[k] = pState[k];
+    }
+}
+
+/**
+   @} end of goertzel group
+*/
@@ -0,0 +1,162 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16s_rv32im.c
+ * Description:  Power spectrum of a windowed frame of 16-bit fixed point data for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_stft_power_q16_rv32im(const plp_cfft_instance_q16 *S,
+                                             const int16_t *__restrict__ pState,
+                                             uint32_t start,
+                                             const int16_t *__restrict__ pWindow,
+                                             uint32_t windowMirror,
+                                             int16_t *__restrict__ pScratch,
+                                             int32_t *__restrict__ pDst,
+                                             uint8_t accumulate,
+                                             uint32_t shift);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Power spectrum of one windowed frame of a ring buffer of 16-bit fixed point data for
+ * RV32IM, used by plp_stft_q16.
+ * @param[in]  S             points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pState        points to the ring buffer of fftLen samples
+ * @param[in]  start         index of the first sample of the frame in the ring buffer
+ * @param[in]  pWindow       points to the window coefficients in Q1.15 format
+ * @param[in]  windowMirror  mirror index of the window (see plp_window_instance_q16), 0 if
+ *                           pWindow holds all fftLen samples
+ * @param[in]  pScratch      points to a scratch buffer of 2 * fftLen samples
+ * @param[out] pDst          points to the output buffer, fftLen / 2 + 1 bins in Q2.30 format
+ * @return     none
+ */
+
+void plp_stft_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                          const int16_t *__restrict__ pState,
+                          uint32_t start,
+                          const int16_t *__restrict__ pWindow,
+                          uint32_t windowMirror,
+                          int16_t *__restrict__ pScratch,
+                          int32_t *__restrict__ pDst) {
+
+    plp_stft_power_q16_rv32im(S, pState, start, pWindow, windowMirror, pScratch, pDst, 0, 0);
+}
+
+/**
+ * @brief      Power spectrum of one windowed frame of 16-bit fixed point data for RV32IM, which is
+ * added to pDst, used by plp_psd_welch_q16.
+ * @param[in]  S             points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pState        points to the ring buffer of fftLen samples
+ * @param[in]  start         index of the first sample of the frame in the ring buffer
+ * @param[in]  pWindow       points to the window coefficients in Q1.15 format
+ * @param[in]  windowMirror  mirror index of the window (see plp_window_instance_q16), 0 if
+ *                           pWindow holds all fftLen samples
+ * @param[in]  shift         right shift of the power before it is added
+ * @param[in]  pScratch      points to a scratch buffer of 2 * fftLen samples
+ * @param[in,out] pDst       points to the accumulated power, fftLen / 2 + 1 bins in
+ *                           Q(2 + shift).(30 - shift) format
+ * @return     none
+ */
+
+void plp_stft_acc_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                              const int16_t *__restrict__ pState,
+                              uint32_t start,
+                              const int16_t *__restrict__ pWindow,
+                              uint32_t windowMirror,
+                              uint32_t shift,
+                              int16_t *__restrict__ pScratch,
+                              int32_t *__restrict__ pDst) {
+
+    plp_stft_power_q16_rv32im(S, pState, start, pWindow, windowMirror, pScratch, pDst, 1, shift);
+}
+
+/**
+ * @} end of FFT group
+ */
+
+static inline void plp_stft_power_q16_rv32im(const plp_cfft_instance_q16 *S,
+                                             const int16_t *__restrict__ pState,
+                                             uint32_t start,
+                                             const int16_t *__restrict__ pWindow,
+                                             uint32_t windowMirror,
+                                             int16_t *__restrict__ pScratch,
+                                             int32_t *__restrict__ pDst,
+                                             uint8_t accumulate,
+                                             uint32_t shift) {
+
+    uint32_t length = S->fftLen;
+    uint32_t half = length >> 1;
+    uint32_t mask = length - 1;
+    uint32_t i, k, m;
+    const int16_t *pW = pWindow;
+    int32_t step = 1;
+    uint32_t rev = 0; // bit reversed k
+    int32_t x;
+    int32_t re, im;
+
+    // windowed frame, the imaginary part is zero. The second half of a symmetric window is read
+    // backwards from the mirror index.
+    for (i = 0; i < half; i++) {
+        x = (pState[(start + i) & mask] * (*pW) + (1 << 14)) >> 15;
+        pScratch[2 * i] = x > 32767 ? 32767 : x;
+        pScratch[2 * i + 1] = 0;
+        pW++;
+    }
+    if (windowMirror != 0) {
+        pW = pWindow + windowMirror - half;
+        step = -1;
+    }
+    for (i = half; i < length; i++) {
+        x = (pState[(start + i) & mask] * (*pW) + (1 << 14)) >> 15;
+        pScratch[2 * i] = x > 32767 ? 32767 : x;
+        pScratch[2 * i + 1] = 0;
+        pW += step;
+    }
+
+    plp_cfft_q16s_rv32im(S, pScratch, 0, 0, 15);
+
+    // the FFT output is in bit reversed order, read bin k from position rev
+    for (k = 0; k <= (length >> 1); k++) {
+        re = pScratch[2 * rev];
+        im = pScratch[2 * rev + 1];
+        if (accumulate) {
+            pDst[k] += (re * re + im * im) >> shift;
+        } else {
+            pDst[k] = re * re + im * im;
+        }
+        for (m = length >> 1; rev & m; m >>= 1) {
+            rev ^= m;
+        }
+        rev |= m;
+    }
+}
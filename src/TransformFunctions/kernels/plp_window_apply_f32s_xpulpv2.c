@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_apply_f32s_xpulpv2.c
+ * Description:  32-bit floating-point window kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup window
+   @{
+*/
+
+/**
+   @brief Multiplication of a 32-bit floating-point frame with a window for XPULPV2 extension.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples
+   @param[out]  pDst  points to the windowed frame, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_f32s_xpulpv2(const plp_window_instance_f32 *S,
+                                   const float32_t *pSrc,
+                                   float32_t *pDst) {
+
+    uint32_t length = S->length;
+    uint32_t half = length >> 1;
+    const float32_t *pW = S->pCoeffs;
+    int32_t step = 1;
+    uint32_t n;
+
+    for (n = 0; n < half; n++) {
+        pDst[n] = pSrc[n] * (*pW++);
+    }
+
+    // second half, read backwards from the mirror index
+    if (S->mirror != 0) {
+        pW = S->pCoeffs + S->mirror - half;
+        step = -1;
+    }
+
+    for (n = half; n < length; n++) {
+        pDst[n] = pSrc[n] * (*pW);
+        pW += step;
+    }
+}
+
+/**
+   @} end of window group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_apply_q16s_rv32im.c
+ * Description:  16-bit fixed point window kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup window
+   @{
+*/
+
+/**
+   @brief Multiplication of a 16-bit fixed point frame with a window for RV32IM extension.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples in Q1.15 format
+   @param[out]  pDst  points to the windowed frame in Q1.15 format, may be equal to pSrc
+   @return      none
+*/
+void plp_window_apply_q16s_rv32im(const plp_window_instance_q16 *S,
+                                  const int16_t *pSrc,
+                                  int16_t *pDst) {
+
+    uint32_t length = S->length;
+    uint32_t half = length >> 1;
+    const int16_t *pW = S->pCoeffs;
+    int32_t step = 1;
+    uint32_t n;
+
+    for (n = 0; n < half; n++) {
+        pDst[n] = (pSrc[n] * (*pW++) + (1 << 14)) >> 15;
+    }
+
+    // second half, read backwards from the mirror index
+    if (S->mirror != 0) {
+        pW = S->pCoeffs + S->mirror - half;
+        step = -1;
+    }
+
+    for (n = half; n < length; n++) {
+        pDst[n] = (pSrc[n] * (*pW) + (1 << 14)) >> 15;
+        pW += step;
+    }
+}
+
+/**
+   @} end of window group
+*/
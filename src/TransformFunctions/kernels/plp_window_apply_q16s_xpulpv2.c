@@ -0,0 +1,120 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_apply_q16s_xpulpv2.c
+ * Description:  16-bit fixed point window kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_window_apply_q16_xpulpv2(const int16_t *pSrc,
+                                                const int16_t *pW,
+                                                int32_t step,
+                                                int16_t *pDst,
+                                                uint32_t blockSize);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup window
+   @{
+*/
+
+/**
+   @brief Multiplication of a 16-bit fixed point frame with a window for XPULPV2 extension.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples in Q1.15 format
+   @param[out]  pDst  points to the windowed frame in Q1.15 format, may be equal to pSrc
+   @return      none
+
+   @par Exploiting SIMD instructions
+   The frame is loaded and stored two samples per 32-bit word. Each product is computed with a dot
+   product against a vector, which holds the coefficient in a single lane, and the coefficients
+   are loaded with post-incrementing (or, in the second half, post-decrementing) loads. The
+   samples before the first word-aligned sample of each half of pSrc are computed one by one.
+*/
+void plp_window_apply_q16s_xpulpv2(const plp_window_instance_q16 *S,
+                                   const int16_t *pSrc,
+                                   int16_t *pDst) {
+
+    uint32_t length = S->length;
+    uint32_t half = length >> 1;
+
+    plp_window_apply_q16_xpulpv2(pSrc, S->pCoeffs, 1, pDst, half);
+
+    // second half, read backwards from the mirror index
+    if (S->mirror != 0) {
+        plp_window_apply_q16_xpulpv2(pSrc + half, S->pCoeffs + S->mirror - half, -1, pDst + half,
+                                     length - half);
+    } else {
+        plp_window_apply_q16_xpulpv2(pSrc + half, S->pCoeffs + half, 1, pDst + half,
+                                     length - half);
+    }
+}
+
+/**
+   @} end of window group
+*/
+
+static inline void plp_window_apply_q16_xpulpv2(const int16_t *pSrc,
+                                                const int16_t *pW,
+                                                int32_t step,
+                                                int16_t *pDst,
+                                                uint32_t blockSize) {
+
+    uint32_t blkCnt;
+    const v2s *pS;
+    v2s *pD;
+    v2s x;
+    int32_t w0, w1;
+
+    // samples before the first word-aligned sample of pSrc
+    blkCnt = plp_align_head(pSrc, sizeof(int16_t), blockSize);
+    blockSize -= blkCnt;
+
+    while (blkCnt > 0U) {
+        *pDst++ = __ROUNDNORM_REG((*pSrc++) * (*pW), 15);
+        pW += step;
+        blkCnt--;
+    }
+
+    pS = (const v2s *)pSrc;
+    pD = (v2s *)pDst;
+
+    for (blkCnt = blockSize >> 1; blkCnt > 0U; blkCnt--) {
+        x = *pS++;
+        w0 = *pW;
+        pW += step;
+        w1 = *pW;
+        pW += step;
+        *pD++ = __PACK2(__ROUNDNORM_REG(__DOTP2(x, __PACK2(w0, 0)), 15),
+                        __ROUNDNORM_REG(__DOTP2(x, __PACK2(0, w1)), 15));
+    }
+
+    if (blockSize & 0x1U) {
+        *(int16_t *)pD = __ROUNDNORM_REG((*(const int16_t *)pS) * (*pW), 15);
+    }
+}
@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_zoom_fft_f32s_xpulpv2.c
+ * Description:  Floating-point zoom FFT for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup czt
+ */
+
+/**
+ * @defgroup cztKernels Chirp-Z Transform and Zoom FFT Kernels
+ */
+
+/**
+ * @addtogroup cztKernels
+ * @{
+ */
+
+/**
+ * @brief         Floating-point zoom FFT for XPULPV2 extension.
+ * @param[in,out] S         points to an instance of the floating-point zoom FFT structure
+ * @param[in]     pSrc      points to D * fftLen real input samples
+ * @param[out]    pDst      points to the fftLen complex output bins, with the center frequency
+ *                          at bin fftLen / 2
+ * @param[out]    pScratch  points to a scratch buffer of size PLP_ZOOM_FFT_SCRATCH_SIZE(fftLen, D)
+ * @return        none
+ *
+ * @par
+ * The input is processed in chunks of PLP_ZOOM_FFT_CHUNK * D samples. Every chunk is mixed down
+ * into an in-phase and a quadrature buffer, and both are decimated with the FIR decimator. The
+ * mixer uses the table within a block of D samples and a phasor, which advances by one block and
+ * is renormalized at the end of every call, to stay coherent over a long stream.
+ */
+void plp_zoom_fft_f32s_xpulpv2(plp_zoom_fft_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               float32_t *__restrict__ pScratch) {
+
+    uint32_t D = S->D;
+    uint32_t fftLen = S->S->fftLen;
+    const float32_t *pMixer = S->pMixer;
+    float32_t *pI = pScratch;
+    float32_t *pQ = pScratch + PLP_ZOOM_FFT_CHUNK * D;
+    float32_t outI[PLP_ZOOM_FFT_CHUNK];
+    float32_t outQ[PLP_ZOOM_FFT_CHUNK];
+    float32_t pr = S->phase[0];
+    float32_t pi = S->phase[1];
+    float32_t sr = S->step[0];
+    float32_t si = S->step[1];
+    uint32_t o, m, i;
+
+    plp_fir_decimate_instance_f32 decI = { D, S->numTaps, S->pStateI, S->pCoeffs };
+    plp_fir_decimate_instance_f32 decQ = { D, S->numTaps, S->pStateQ, S->pCoeffs };
+
+    for (o = 0; o < fftLen; o += PLP_ZOOM_FFT_CHUNK) {
+        uint32_t c = (fftLen - o < PLP_ZOOM_FFT_CHUNK) ? fftLen - o : PLP_ZOOM_FFT_CHUNK;
+
+        for (m = 0; m < c; m++) {
+            const float32_t *pX = pSrc + (o + m) * D;
+            float32_t *pMI = pI + m * D;
+            float32_t *pMQ = pQ + m * D;
+
+            for (i = 0; i < D; i++) {
+                float32_t wr = pr * pMixer[2 * i] - pi * pMixer[2 * i + 1];
+                float32_t wi = pr * pMixer[2 * i + 1] + pi * pMixer[2 * i];
+                pMI[i] = pX[i] * wr;
+                pMQ[i] = pX[i] * wi;
+            }
+
+            float32_t t = pr * sr - pi * si;
+            pi = pr * si + pi * sr;
+            pr = t;
+        }
+
+        plp_fir_decimate_f32s_xpulpv2(&decI, pI, c * D, outI);
+        plp_fir_decimate_f32s_xpulpv2(&decQ, pQ, c * D, outQ);
+
+        for (m = 0; m < c; m++) {
+            pDst[2 * (o + m)] = outI[m];
+            pDst[2 * (o + m) + 1] = outQ[m];
+        }
+    }
+
+    /* keep the phasor on the unit circle */
+    float32_t g = 1.0f / __builtin_sqrtf(pr * pr + pi * pi);
+    S->phase[0] = pr * g;
+    S->phase[1] = pi * g;
+
+    plp_cfft_mr_f32s_xpulpv2(S->S, pDst, pScratch, 0);
+
+    /* move the center frequency from bin 0 to bin fftLen / 2 */
+    uint32_t shift = fftLen - fftLen / 2;
+    for (i = 0; i < 2 * fftLen; i++) {
+        pScratch[i] = pDst[i];
+    }
+    for (i = 0; i < fftLen; i++) {
+        uint32_t k = (i + shift < fftLen) ? i + shift : i + shift - fftLen;
+        pDst[2 * i] = pScratch[2 * k];
+        pDst[2 * i + 1] = pScratch[2 * k + 1];
+    }
+}
+
+/**
+ * @} end of cztKernels group
+ */
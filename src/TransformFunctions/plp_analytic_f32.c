@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_analytic_f32.c
+ * Description:  Floating-point analytic signal glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the FFT-based floating-point analytic signal.
+ * @param[in]   S     points to an instance of the floating-point complex FFT structure, whose
+ *                    length N is the length of the signal
+ * @param[in]   pSrc  points to the N real input samples
+ * @param[out]  pDst  points to the 2 * N values of the analytic signal, real and imaginary part
+ *                    interleaved, where the real part is the input and the imaginary part its
+ *                    Hilbert transform
+ * @return      none
+ *
+ * @par
+ * The input is transformed with the complex FFT, the bins of the negative frequencies are set to
+ * zero, the bins of the positive frequencies are doubled, and the result is transformed back.
+ * The signal is treated as periodic with period N. For a continuous stream, use the Hilbert FIR
+ * filters instead.
+ */
+void plp_analytic_f32(const plp_cfft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_analytic_f32s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
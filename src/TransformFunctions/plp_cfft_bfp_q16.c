@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16.c
+ * Description:  Glue code for the 16-bit complex FFT with block floating point scaling
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for quantized 16 bit complex fast fourier transform with block
+ *                floating point scaling
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ *                                in Q1.15 format. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e of the output: the DFT, or the inverse DFT, is the output
+ *                multiplied by 2^e
+ *
+ * @par Block floating point
+ * plp_cfft_q16 halves the data at every stage, such that a signal far below full scale ends up
+ * with only a few significant bits. This variant first shifts the input left until its largest
+ * real or imaginary part has 13 significant bits. Before every radix-2 stage, the number of
+ * significant bits of the largest part of the whole block, computed with count leading bits,
+ * decides how far the stage shifts right: not at all up to 13 bits, and by one or two bits
+ * above. This is the least shift for which the butterflies cannot overflow. All shifts are summed
+ * up to the block exponent, from which log2(fftLen) is subtracted for the inverse transform.
+ * The same instances and tables as for plp_cfft_q16 are used.
+ */
+
+int32_t plp_cfft_bfp_q16(const plp_cfft_instance_q16 *S,
+                         int16_t *p1,
+                         uint8_t ifftFlag,
+                         uint8_t bitReverseFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_cfft_bfp_q16s_rv32im(S, p1, ifftFlag, bitReverseFlag);
+    } else {
+        return plp_cfft_bfp_q16s_xpulpv2(S, p1, ifftFlag, bitReverseFlag);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_init_q32.c
+ * Description:  32-bit fixed point complex FFT initialization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define CFFT_TWO_PI_F64 6.28318530717958647692
+
+static inline int32_t cfft_q31(double x);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed point complex FFT instance, which computes the twiddle
+          factors.
+   @param[out]  S        points to an instance of the 32-bit fixed point complex FFT structure
+   @param[in]   fftLen   length of the FFT, a power of two of at least 2
+   @param[out]  pBuffer  points to a buffer of fftLen values for the table, which must stay valid
+                         as long as the instance is used
+   @return      none
+
+   @par
+   This function uses double precision floating point math, since single precision does not
+   resolve Q1.31 values, and is intended to run once at startup.
+*/
+void plp_cfft_init_q32(plp_cfft_instance_q32 *S, uint32_t fftLen, int32_t *pBuffer) {
+
+    uint32_t k;
+
+    // W^k = e^(-j 2 pi k / N)
+    for (k = 0; k < fftLen / 2; k++) {
+        double phi = -CFFT_TWO_PI_F64 * k / fftLen;
+        pBuffer[2 * k] = cfft_q31(cos(phi));
+        pBuffer[2 * k + 1] = cfft_q31(sin(phi));
+    }
+
+    S->fftLen = fftLen;
+    S->pTwiddle = pBuffer;
+}
+
+/**
+   @} end of fft group
+*/
+
+static inline int32_t cfft_q31(double x) {
+
+    int64_t q = llround(x * 2147483648.0);
+    return q > INT32_MAX ? INT32_MAX : (q < -INT32_MAX ? -INT32_MAX : q);
+}
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mr_f32.c
+ * Description:  floating-point mixed-radix complex FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the floating-point mixed-radix complex FFT, for any length of the
+ *                form 2^a 3^b 5^c, e.g. 600, 1536, 8192 or 16384
+ * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure,
+ *                          initialized by plp_cfft_mr_init_f32
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen, which is
+ *                          transformed in place. The output is in natural order.
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform. The inverse transform is scaled by 1 / fftLen.
+ * @return        none
+ */
+void plp_cfft_mr_f32(const plp_cfft_mr_instance_f32 *S,
+                     float32_t *p1,
+                     float32_t *pScratch,
+                     uint8_t ifftFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_cfft_mr_f32s_xpulpv2(S, p1, pScratch, ifftFlag);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
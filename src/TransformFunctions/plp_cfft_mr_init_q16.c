@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mr_init_q16.c
+ * Description:  16-bit fixed-point mixed-radix complex FFT initialization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define CFFT_MR_PI_F32 3.14159265358979323846f
+
+static inline int16_t cfft_mr_q15(float32_t x);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Initialization of the 16-bit fixed-point mixed-radix CFFT instance, which
+ *                factors the length into stages of radix 4, 2, 3 and 5 and computes the twiddle
+ *                factors.
+ * @param[out]    S         points to an instance of the 16-bit mixed-radix CFFT structure
+ * @param[in]     fftLen    length of the transform, of the form 2^a 3^b 5^c
+ * @param[out]    pTwiddle  points to a buffer of PLP_CFFT_MR_BUFFER_SIZE(fftLen) values, which
+ *                          holds cos(2 pi t / fftLen) and sin(2 pi t / fftLen) in Q1.15 format,
+ *                          and must stay valid as long as the instance is used
+ * @return        0: Success, 1: fftLen has a prime factor other than 2, 3 and 5, or needs more
+ *                than PLP_CFFT_MR_MAX_STAGES stages
+ *
+ * @par
+ * The powers of two are split into stages of radix 4 and at most one stage of radix 2, followed
+ * by the stages of radix 3 and 5. This function uses single precision floating point math and is
+ * intended to run once at startup.
+ */
+int plp_cfft_mr_init_q16(plp_cfft_mr_instance_q16 *S,
+                         uint32_t fftLen,
+                         int16_t *pTwiddle) {
+
+    uint32_t n = fftLen;
+    uint32_t numStages = 0;
+    uint32_t t;
+
+    if (fftLen < 2) {
+        return 1;
+    }
+
+    while (n % 4 == 0 && numStages < PLP_CFFT_MR_MAX_STAGES) {
+        S->radix[numStages++] = 4;
+        n /= 4;
+    }
+    if (n % 2 == 0 && numStages < PLP_CFFT_MR_MAX_STAGES) {
+        S->radix[numStages++] = 2;
+        n /= 2;
+    }
+    while (n % 3 == 0 && numStages < PLP_CFFT_MR_MAX_STAGES) {
+        S->radix[numStages++] = 3;
+        n /= 3;
+    }
+    while (n % 5 == 0 && numStages < PLP_CFFT_MR_MAX_STAGES) {
+        S->radix[numStages++] = 5;
+        n /= 5;
+    }
+
+    if (n != 1) {
+        return 1;
+    }
+
+    for (t = 0; t < fftLen; t++) {
+        float32_t w = 2.0f * CFFT_MR_PI_F32 * t / fftLen;
+        pTwiddle[2 * t] = cfft_mr_q15(cosf(w));
+        pTwiddle[2 * t + 1] = cfft_mr_q15(sinf(w));
+    }
+
+    S->fftLen = fftLen;
+    S->numStages = numStages;
+    S->pTwiddle = pTwiddle;
+
+    return 0;
+}
+
+/**
+ * @} end of FFT group
+ */
+
+static inline int16_t cfft_mr_q15(float32_t x) {
+
+    int32_t q = lroundf(x * 32768.0f);
+    return q > 32767 ? 32767 : (q < -32767 ? -32767 : q);
+}
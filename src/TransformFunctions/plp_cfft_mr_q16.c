@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mr_q16.c
+ * Description:  16-bit fixed-point mixed-radix complex FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the 16-bit fixed-point mixed-radix complex FFT, for any length
+ *                of the form 2^a 3^b 5^c, e.g. 600, 1536, 8192 or 16384
+ * @param[in]     S         points to an instance of the 16-bit mixed-radix CFFT structure,
+ *                          initialized by plp_cfft_mr_init_q16
+ * @param[in,out] p1        points to the complex data buffer of size 2 * fftLen in Q1.15
+ *                          format, which is transformed in place. The output is in natural
+ *                          order.
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * fftLen
+ * @param[in]     ifftFlag  selects the forward (ifftFlag = 0) or the inverse (ifftFlag = 1)
+ *                          transform.
+ * @return        none
+ *
+ * @par Fix-Point
+ * Every stage is scaled by 1 / p, such that both the forward and the inverse transform are
+ * scaled by 1 / fftLen, like the inverse floating-point transform. The output does not overflow if
+ * the magnitude of every complex input sample is below 1. The rounding noise grows with the
+ * number of stages, by roughly one LSB per stage.
+ */
+void plp_cfft_mr_q16(const plp_cfft_mr_instance_q16 *S,
+                     int16_t *p1,
+                     int16_t *pScratch,
+                     uint8_t ifftFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_mr_q16s_rv32im(S, p1, pScratch, ifftFlag);
+    } else {
+        plp_cfft_mr_q16s_xpulpv2(S, p1, pScratch, ifftFlag);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16_batch.c
+ * Description:  Batched 16-bit fixed point complex FFT glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for quantized 16 bit complex fast fourier transform of a batch of
+ * channels
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure, which
+ * is used for all channels
+ * @param[in,out] p1              points to the complex data buffer, channel c starts at
+ * <code>p1 + 2*c*channelStride</code>. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     deciPoint       decimal point for right shift
+ * @param[in]     nChannels       number of channels
+ * @param[in]     channelStride   distance between the channels in complex samples, at least fftLen
+ * @param[in]     nPE             number of parallel processing units
+ *
+ * @par
+ * On the cluster, the team is forked once for the whole batch, and every core computes whole
+ * transforms with the single core kernel (channel c on core c % nPE). On the FC, the channels are
+ * transformed one after the other.
+ */
+
+void plp_cfft_q16_batch(const plp_cfft_instance_q16 *S,
+                        int16_t *p1,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        uint32_t nChannels,
+                        uint32_t channelStride,
+                        uint32_t nPE) {
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (uint32_t c = 0; c < nChannels; c++) {
+            plp_cfft_q16s_rv32im(S, p1 + 2 * c * channelStride, ifftFlag, bitReverseFlag,
+                                 deciPoint);
+        }
+    } else {
+        plp_cfft_batch_arg_q16 arg = { S,         p1,        ifftFlag,      bitReverseFlag,
+                                       deciPoint, nChannels, channelStride, nPE };
+
+        rt_team_fork(nPE, plp_cfft_q16_batch_xpulpv2, (void *)&arg);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16_batch_multi.c
+ * Description:  Glue code for a batch of 16-bit quantized CFFTs split across clusters
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/* runs on the master core of each cluster */
+static void plp_cfft_q16_batch_multi_entry(void *args) {
+
+    plp_cfft_batch_arg_q16 *a = (plp_cfft_batch_arg_q16 *)args;
+
+    plp_cfft_q16_batch(a->S, a->p1, a->ifftFlag, a->bitReverseFlag, a->deciPoint, a->nChannels,
+                       a->channelStride, a->nPE);
+}
+
+/**
+ * @brief         Glue code for quantized 16 bit complex fast fourier transform of a batch of
+ * channels, which is split across several clusters
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure, which
+ * is used for all channels. The instance and its tables must reside in L2.
+ * @param[in,out] p1              points to the complex data buffer in L2, channel c starts at
+ * <code>p1 + 2*c*channelStride</code>. Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     deciPoint       decimal point for right shift
+ * @param[in]     nChannels       number of channels
+ * @param[in]     channelStride   distance between the channels in complex samples, at least fftLen
+ * @param[in]     nClusters       number of clusters, which must be mounted
+ * @param[in]     nPE             number of parallel processing units on every cluster
+ *
+ * @par
+ * Every cluster transforms a contiguous range of channels with plp_cfft_q16_batch.
+ */
+
+void plp_cfft_q16_batch_multi(const plp_cfft_instance_q16 *S,
+                              int16_t *p1,
+                              uint8_t ifftFlag,
+                              uint8_t bitReverseFlag,
+                              uint32_t deciPoint,
+                              uint32_t nChannels,
+                              uint32_t channelStride,
+                              uint32_t nClusters,
+                              uint32_t nPE) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("multi-cluster execution supported only for fabric controller side\n");
+        return;
+    }
+
+    plp_async_handle handle[nClusters];
+
+    for (uint32_t c = 0; c < nClusters; c++) {
+        uint32_t chStart = nChannels * c / nClusters;
+        uint32_t chEnd = nChannels * (c + 1) / nClusters;
+        plp_cfft_batch_arg_q16 *a = (plp_cfft_batch_arg_q16 *)handle[c].args;
+
+        handle[c].event = NULL;
+        if (chStart == chEnd) {
+            continue;
+        }
+
+        a->S = S;
+        a->p1 = p1 + 2 * chStart * channelStride;
+        a->ifftFlag = ifftFlag;
+        a->bitReverseFlag = bitReverseFlag;
+        a->deciPoint = deciPoint;
+        a->nChannels = chEnd - chStart;
+        a->channelStride = channelStride;
+        a->nPE = nPE;
+
+        plp_async_call_cluster(c, plp_cfft_q16_batch_multi_entry, (void *)a, &handle[c]);
+    }
+
+    for (uint32_t c = 0; c < nClusters; c++) {
+        plp_async_wait(&handle[c]);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32.c
+ * Description:  32-bit fixed point complex FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the 32-bit fixed point complex FFT with block floating point scaling.
+   @param[in]      S               points to an instance of the 32-bit fixed point complex FFT
+                                   structure
+   @param[in,out]  p1              points to the complex data buffer of size 2 * fftLen in Q1.31
+                                   format, which is transformed in place
+   @param[in]      ifftFlag        selects the forward (ifftFlag = 0) or the inverse
+                                   (ifftFlag = 1) transform
+   @param[in]      bitReverseFlag  selects natural (bitReverseFlag = 1) or bit reversed
+                                   (bitReverseFlag = 0) order of the output
+   @return         block exponent e of the output: the DFT, or the inverse DFT, is the output
+                   multiplied by 2^e
+
+   @par Block floating point
+   A small input block is first shifted left until its largest magnitude is at least 2^28. Before
+   every radix-2 stage, the largest magnitude of the real and imaginary parts of the whole block
+   decides how many bits the stage shifts right: none below 2^29, one below 2^30, and two
+   otherwise. This is the least shift for which the butterflies cannot overflow, so the data keeps
+   between 1 and 3 bits of headroom, and small signals are not scaled down by the N of a fixed
+   scaling. All shifts are summed up to the block exponent, from which log2(N) is subtracted for
+   the inverse transform.
+*/
+int32_t plp_cfft_q32(const plp_cfft_instance_q32 *S,
+                     int32_t *p1,
+                     uint8_t ifftFlag,
+                     uint8_t bitReverseFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_cfft_q32s_rv32im(S, p1, ifftFlag, bitReverseFlag);
+    } else {
+        return plp_cfft_q32s_xpulpv2(S, p1, ifftFlag, bitReverseFlag);
+    }
+}
+
+/**
+   @} end of fft group
+*/
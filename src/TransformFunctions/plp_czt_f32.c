@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_f32.c
+ * Description:  Floating-point chirp-z transform glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup czt Chirp-Z Transform and Zoom FFT
+ * The chirp-z transform evaluates M points of the spectrum of N complex samples on an arbitrary
+ * frequency grid
+ *
+ * X[k] = sum_n x[n] exp(-j 2 pi (f0 + k df) n),  k = 0 .. M - 1,
+ *
+ * e.g. a narrow band with a resolution much finer than 1 / N. It is computed with Bluestein's
+ * algorithm as a convolution with a chirp, using two mixed-radix FFTs of length L >= N + M - 1.
+ *
+ * The zoom FFT analyzes a stream of real samples in a narrow band around fc. The signal is mixed
+ * down by fc, low-pass filtered and decimated by D, and transformed with a small FFT. A band of
+ * width 1 / D is thus resolved with the resolution of a D times longer FFT, e.g. a 256 point zoom
+ * FFT with D = 64 instead of a 16384 point FFT.
+ */
+
+/**
+ * @addtogroup czt
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the floating-point chirp-z transform.
+ * @param[in]     S         points to an instance of the floating-point CZT structure, initialized
+ *                          by plp_czt_init_f32
+ * @param[in]     pSrc      points to the N complex input samples
+ * @param[out]    pDst      points to the M complex output points
+ * @param[out]    pScratch  points to a scratch buffer of size 4 * L
+ * @return        none
+ */
+void plp_czt_f32(const plp_czt_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 float32_t *__restrict__ pDst,
+                 float32_t *__restrict__ pScratch) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_czt_f32s_xpulpv2(S, pSrc, pDst, pScratch);
+    }
+}
+
+/**
+ * @} end of czt group
+ */
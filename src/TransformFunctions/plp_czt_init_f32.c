@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_init_f32.c
+ * Description:  Initialization of the floating-point chirp-z transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define CZT_PI 3.14159265358979323846
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup czt
+ * @{
+ */
+
+/* phase pi * (a + b t^2) reduced to [0, 2 pi) before the float conversion */
+static inline double czt_phase(double a, double b, double t) {
+    double r = fmod(a * t + b * t * t, 2.0);
+    return CZT_PI * r;
+}
+
+/**
+ * @brief         Initialization of the floating-point chirp-z transform instance, which computes
+ *                the chirps and the spectrum of the convolution filter.
+ * @param[out]    S         points to an instance of the floating-point CZT structure
+ * @param[in]     N         number of complex input samples
+ * @param[in]     M         number of output points
+ * @param[in]     f0        normalized frequency of the first output point, in cycles per sample
+ * @param[in]     df        normalized frequency step between the output points
+ * @param[in]     pCfft     points to an initialized mixed-radix CFFT instance of length
+ *                          L >= N + M - 1, which must stay valid as long as the instance is used
+ * @param[out]    pBuffer   points to a buffer of PLP_CZT_BUFFER_SIZE(N, M, L) values for the
+ *                          tables, which must stay valid as long as the instance is used
+ * @param[out]    pScratch  points to a scratch buffer of size 2 * L
+ * @return        0: Success, 1: the length of the CFFT is smaller than N + M - 1
+ *
+ * @par
+ * The chirp phases grow quadratically, they are therefore computed in double precision and
+ * reduced modulo 2 pi before they are converted. This function is intended to run once at startup.
+ */
+int plp_czt_init_f32(plp_czt_instance_f32 *S,
+                     uint32_t N,
+                     uint32_t M,
+                     float32_t f0,
+                     float32_t df,
+                     const plp_cfft_mr_instance_f32 *pCfft,
+                     float32_t *pBuffer,
+                     float32_t *pScratch) {
+
+    uint32_t L = pCfft->fftLen;
+    float32_t *pPre = pBuffer;
+    float32_t *pPost = pBuffer + 2 * N;
+    float32_t *pFilter = pBuffer + 2 * (N + M);
+    uint32_t n;
+
+    if (L < N + M - 1) {
+        return 1;
+    }
+
+    /* x[n] is multiplied with exp(-j pi (2 f0 n + df n^2)) */
+    for (n = 0; n < N; n++) {
+        double p = czt_phase(2.0 * f0, df, n);
+        pPre[2 * n] = (float32_t)cos(p);
+        pPre[2 * n + 1] = (float32_t)-sin(p);
+    }
+
+    /* the convolution output k is multiplied with exp(-j pi df k^2) */
+    for (n = 0; n < M; n++) {
+        double p = czt_phase(0.0, df, n);
+        pPost[2 * n] = (float32_t)cos(p);
+        pPost[2 * n + 1] = (float32_t)-sin(p);
+    }
+
+    /* h[m] = exp(j pi df m^2) for m = -(N - 1) .. M - 1, stored circularly modulo L */
+    for (n = 0; n < L; n++) {
+        pFilter[2 * n] = 0.0f;
+        pFilter[2 * n + 1] = 0.0f;
+    }
+    for (n = 0; n < M; n++) {
+        double p = czt_phase(0.0, df, n);
+        pFilter[2 * n] = (float32_t)cos(p);
+        pFilter[2 * n + 1] = (float32_t)sin(p);
+    }
+    for (n = 1; n < N; n++) {
+        double p = czt_phase(0.0, df, n);
+        pFilter[2 * (L - n)] = (float32_t)cos(p);
+        pFilter[2 * (L - n) + 1] = (float32_t)sin(p);
+    }
+
+    plp_cfft_mr_f32(pCfft, pFilter, pScratch, 0);
+
+    S->N = N;
+    S->M = M;
+    S->S = pCfft;
+    S->pPre = pPre;
+    S->pPost = pPost;
+    S->pFilter = pFilter;
+
+    return 0;
+}
+
+/**
+ * @} end of czt group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_f32.c
+ * Description:  Floating-point DCT-II glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup dct  DCT transforms
+  This module contains the discrete cosine transforms. They are computed with the FFT kernels
+  and a pre- and post-processing step of O(N), hence in O(N log N) instead of the O(N^2) of a
+  multiplication with a cosine matrix.
+
+  The DCT-II of length N is
+  \f[
+      X[k] = \sum_{n=0}^{N-1} x[n] \cos\left(\frac{\pi}{N} \left(n + \frac{1}{2}\right) k\right)
+  \f]
+  and the DCT-IV is
+  \f[
+      X[k] = \sum_{n=0}^{N-1} x[n] \cos\left(\frac{\pi}{N} \left(n + \frac{1}{2}\right)
+             \left(k + \frac{1}{2}\right)\right)
+  \f]
+  Both are not normalized. The orthonormal DCT-II is obtained by scaling X[0] with sqrt(1 / N) and
+  the other coefficients with sqrt(2 / N).
+ */
+
+/**
+   @addtogroup dct
+   @{
+*/
+
+/**
+   @brief Glue code for the floating-point DCT-II.
+   @param[in]   S         points to an instance of the DCT-II structure
+   @param[in]   pSrc      points to the input buffer of DCT length values
+   @param[out]  pScratch  points to a scratch buffer of 2 * DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values
+   @return      none
+
+   @par
+   The input is reordered to v[n] = x[2n], v[N - 1 - n] = x[2n + 1] in pDst and transformed with
+   the real FFT of S into pScratch. The DCT coefficients are the real parts of the FFT bins
+   rotated by the post-twiddle factors, X[k] = Re(e^(-j pi k / (2 N)) V[k]). The FFT uses the
+   algorithm of S, but never the bit reversal pass, since the post-processing reads the bins in
+   bit reversed order directly. The DCT length must be at least 4.
+*/
+void plp_dct2_f32(const plp_dct2_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pScratch,
+                  float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_dct2_f32_xpulpv2(S, pSrc, pScratch, pDst);
+}
+
+/**
+   @} end of dct group
+*/
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_init_f32.c
+ * Description:  Initialization of the floating-point DCT-II
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define DCT2_PI_F32 3.14159265358979323846f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup dct
+   @{
+*/
+
+/**
+   @brief Initialization of the floating-point DCT-II instance, which computes the post-twiddle
+          factors.
+   @param[out]  S        points to an instance of the DCT-II structure
+   @param[in]   pFFT     points to an instance of the floating-point FFT structure, its length is
+                         the DCT length
+   @param[out]  pBuffer  points to a buffer of PLP_DCT2_BUFFER_SIZE_F32(DCTLength) = 2 * DCTLength
+                         values, which holds the DCTLength complex post-twiddle factors and must
+                         stay valid as long as the instance is used
+   @return      none
+*/
+void plp_dct2_init_f32(plp_dct2_instance_f32 *S,
+                       const plp_rfft_instance_f32 *pFFT,
+                       float32_t *pBuffer) {
+
+    Complex_type_f32 *pTwiddle = (Complex_type_f32 *)pBuffer;
+    uint32_t length = pFFT->FFTLength;
+    uint32_t k;
+
+    // W^k = e^(-j pi k / (2 N))
+    for (k = 0; k < length; k++) {
+        float32_t phi = -DCT2_PI_F32 * k / (2 * length);
+        pTwiddle[k].re = cosf(phi);
+        pTwiddle[k].im = sinf(phi);
+    }
+
+    S->S = pFFT;
+    S->pTwiddle = pBuffer;
+}
+
+/**
+   @} end of dct group
+*/
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point DCT-IV
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define DCT4_PI_F32 3.14159265358979323846f
+
+static inline int16_t dct4_q15(float32_t x);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup dct
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point DCT-IV instance, which computes the pre- and
+          post-twiddle factors.
+   @param[out]  S        points to an instance of the DCT-IV structure
+   @param[in]   pFFT     points to an instance of the 16-bit fixed point complex FFT structure, its
+                         length is half the DCT length
+   @param[out]  pBuffer  points to a buffer of PLP_DCT4_BUFFER_SIZE_Q16(DCTLength) = 2 * DCTLength
+                         values, which holds the DCTLength / 2 complex pre-twiddle factors followed
+                         by the DCTLength / 2 complex post-twiddle factors, and must stay valid as
+                         long as the instance is used
+   @return      none
+
+   @par
+   This function uses single precision floating point math and is intended to run once at startup.
+*/
+void plp_dct4_init_q16(plp_dct4_instance_q16 *S,
+                       const plp_cfft_instance_q16 *pFFT,
+                       int16_t *pBuffer) {
+
+    uint32_t half = pFFT->fftLen;
+    uint32_t length = 2 * half;
+    int16_t *pPost = pBuffer + 2 * half;
+    uint32_t k;
+
+    for (k = 0; k < half; k++) {
+        // pre-twiddle e^(-j pi (k + 1/4) / N)
+        float32_t phi = -DCT4_PI_F32 * (k + 0.25f) / length;
+        pBuffer[2 * k] = dct4_q15(cosf(phi));
+        pBuffer[2 * k + 1] = dct4_q15(sinf(phi));
+
+        // post-twiddle e^(-j pi k / N)
+        phi = -DCT4_PI_F32 * k / length;
+        pPost[2 * k] = dct4_q15(cosf(phi));
+        pPost[2 * k + 1] = dct4_q15(sinf(phi));
+    }
+
+    S->S = pFFT;
+    S->pTwiddle = pBuffer;
+}
+
+/**
+   @} end of dct group
+*/
+
+static inline int16_t dct4_q15(float32_t x) {
+
+    int32_t q = lroundf(x * 32768.0f);
+    return q > 32767 ? 32767 : (q < -32767 ? -32767 : q);
+}
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16.c
+ * Description:  16-bit fixed point DCT-IV glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup dct
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point DCT-IV.
+   @param[in]   S         points to an instance of the DCT-IV structure
+   @param[in]   pSrc      points to the input buffer of DCT length values in Q1.15 format
+   @param[out]  pScratch  points to a scratch buffer of DCT length values
+   @param[out]  pDst      points to the output buffer of DCT length values, the DCT-IV divided by
+                          the DCT length in Q1.15 format
+   @return      none
+
+   @par
+   The N real inputs are folded into N / 2 complex values z[n] = (x[2n] + j x[N - 1 - 2n]) / 2,
+   which are rotated by the pre-twiddle factors and transformed with the complex FFT of S, which
+   has length N / 2. The bins are rotated by the post-twiddle factors, and yield the coefficients
+   X[2k] = Re(w[k]) and X[N - 1 - 2k] = -Im(w[k]). The halving of the inputs and the scaling of
+   the FFT keep all intermediate values in range, and the result is X / N. The supported DCT
+   lengths are the doubled lengths of plp_cfft_q16, 32 to 8192.
+*/
+void plp_dct4_q16(const plp_dct4_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pScratch,
+                  int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dct4_q16s_rv32im(S, pSrc, pScratch, pDst);
+    } else {
+        plp_dct4_q16s_xpulpv2(S, pSrc, pScratch, pDst);
+    }
+}
+
+/**
+   @} end of dct group
+*/
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fft2d_f32.c
+ * Description:  Parallel floating-point two-dimensional FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the parallel floating-point two-dimensional FFT
+ * @param[in]     SRow            points to the CFFT instance of the rows, its length is the number
+ *                                of columns
+ * @param[in]     SCol            points to the CFFT instance of the columns, its length is the
+ *                                number of rows
+ * @param[in,out] p1              points to the complex matrix, row-major with real and imaginary
+ *                                parts interleaved. Processing occurs in-place.
+ * @param[in]     stride          distance between the rows in complex samples, at least the
+ *                                number of columns
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                transform. The inverse transform is scaled by 1/(rows*cols).
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables
+ *                                (bitReverseFlag=0) bit reversal of output in both dimensions.
+ * @param[in]     nPE             number of parallel processing units
+ * @return        none
+ *
+ * @par
+ * The rows are transformed first, each core transforms whole rows. After a barrier, the columns
+ * are transformed in place with the strided kernel, each core takes the columns core_id,
+ * core_id + nPE, ..., such that the cores access neighbouring words in different banks. The
+ * matrix is never transposed.
+ */
+
+void plp_fft2d_f32(const plp_cfft_instance_f32 *SRow,
+                   const plp_cfft_instance_f32 *SCol,
+                   float32_t *p1,
+                   uint32_t stride,
+                   uint8_t ifftFlag,
+                   uint8_t bitReverseFlag,
+                   uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_fft2d_arg_f32 arg = { SRow, SCol, p1, stride, ifftFlag, bitReverseFlag, nPE };
+
+    rt_team_fork(nPE, plp_fft2d_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point Goertzel algorithm
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define GOERTZEL_PI_F32 3.14159265358979323846f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup goertzel
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point Goertzel instance, which computes the
+          coefficients of the bins.
+   @param[out]  S        points to an instance of the 32-bit floating-point Goertzel structure
+   @param[in]   numBins  Number of bins
+   @param[in]   pFreqs   points to the normalized frequencies f of the bins, in cycles per sample
+                         (between 0 and 0.5)
+   @param[out]  pCoeffs  points to a buffer of PLP_GOERTZEL_BUFFER_SIZE(numBins) values, which
+                         holds cos(2 pi f) and sin(2 pi f) of every bin,
+                         and must stay valid as long as the instance is used
+   @return      none
+
+   @par
+   This function uses single precision floating point math and is intended to run once at startup.
+*/
+void plp_goertzel_init_f32(plp_goertzel_instance_f32 *S,
+                           uint32_t numBins,
+                           const float32_t *pFreqs,
+                           float32_t *pCoeffs) {
+
+    uint32_t k;
+
+    for (k = 0; k < numBins; k++) {
+        float32_t w = 2.0f * GOERTZEL_PI_F32 * pFreqs[k];
+        pCoeffs[2 * k] = cosf(w);
+        pCoeffs[2 * k + 1] = sinf(w);
+    }
+
+    S->numBins = numBins;
+    S->pCoeffs = pCoeffs;
+}
+
+/**
+   @} end of goertzel group
+*/
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q16.c
+ * Description:  16-bit fixed point Goertzel algorithm glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @defgroup goertzel Goertzel and sliding DFT
+   The Goertzel algorithm and the sliding DFT compute a few bins of a spectrum, e.g. the 8 to 16
+   tones of a DTMF detector, for a fraction of the cost of an FFT over the whole block.
+
+   The Goertzel filter of the normalized frequency f (in cycles per sample) runs the resonator
+   s[n] = x[n] + 2 cos(w) s[n - 1] - s[n - 2], w = 2 pi f, over the N samples of the block, and
+   computes the bin from the last two states as
+   y = (cos(w) s[N - 1] - s[N - 2]) + j sin(w) s[N - 1]. This is the DTFT X(w) of the block rotated
+   by e^(j w N), i.e. |y| = |X(w)|, and y is equal to the DFT bin k if f = k / N. The cost is one
+   multiplication per sample and bin, and f does not have to be a multiple of 1 / N.
+
+   The sliding DFT keeps the DFT bins k of the last N samples, and updates them with every new
+   sample as X_k = e^(j 2 pi k / N) (X_k + x[n] - x[n - N]), which costs one complex
+   multiplication per sample and bin. To keep the recursion stable despite rounding, the twiddle
+   factors are damped by r = PLP_SDFT_DAMPING, and x[n - N] is weighted by r^N. The bins are then
+   the DFT of the last N samples weighted by r^(N - i), which is 1 within 0.3% for N up to 256.
+*/
+
+/**
+   @addtogroup goertzel
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point Goertzel algorithm.
+   @param[in]   S          points to an instance of the Goertzel structure
+   @param[in]   pSrc       points to the block of input samples in Q1.15 format
+   @param[in]   blockSize  Number of input samples N
+   @param[out]  pDst       points to the output buffer of 2 * numBins values, the complex bins (real
+                           and imaginary part interleaved) in the Q1.15 format of the input, i.e.
+                           not divided by blockSize
+   @return      none
+
+   @par Fix-Point
+   The states are 32-bit integers in the format of the input, and the products with the Q1.30
+   coefficients are rounded. At the frequency of a tone of amplitude A, the states grow up to about
+   A N / (2 sin(2 pi f)), which has to stay below 2^31.
+*/
+void plp_goertzel_q16(const plp_goertzel_instance_q16 *S,
+                      const int16_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_goertzel_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_goertzel_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of goertzel group
+*/
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_irfft_f32.c
+ * Description:  Floating-point inverse FFT with real output data glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point inverse FFT with real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), the bins 0 to FFTLength / 2 of
+                        the spectrum in natural order, e.g. the output of plp_rfft_f32 with
+                        bitReverseFlag set. The remaining bins are their complex conjugates and
+                        are not read.
+   @param[out]  pDst    points to the output buffer of FFTLength values (real data), may be equal
+                        to pSrc
+   @return      none
+
+   @par
+   This is the inverse of plp_rfft_f32, including the scaling by 1 / FFTLength, and uses the
+   twiddle factors of the same instance. Instead of a complex inverse FFT of the full length, it
+   computes one of half the length, which is preceded by the split stage of the real FFT in
+   reverse. FFTLength must be a power of two of at least 4.
+*/
+void plp_irfft_f32(const plp_rfft_instance_f32 *S, const float32_t *pSrc, float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_irfft_f32_xpulpv2(S, pSrc, pDst);
+}
+
+/**
+   @} end of FFT group
+*/
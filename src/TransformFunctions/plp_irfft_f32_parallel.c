@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_irfft_f32_parallel.c
+ * Description:  Parallel floating-point inverse FFT with real output data glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), the bins 0 to FFTLength / 2 of
+                        the spectrum in natural order
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of FFTLength values (real data), may be equal
+                        to pSrc
+   @return      none
+*/
+void plp_irfft_f32_parallel(const plp_rfft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            const uint32_t nPE,
+                            float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_parallel_arg_f32 arg = (plp_rfft_parallel_arg_f32){
+        (plp_rfft_instance_f32 *)S, (const float32_t *)pSrc, nPE, pDst
+    };
+
+    rt_team_fork(nPE, (void (*)(void *))plp_irfft_f32_xpulpv2_parallel, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
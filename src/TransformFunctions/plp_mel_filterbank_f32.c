@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_filterbank_f32.c
+ * Description:  Sparse mel filterbank of floating-point spectra glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @defgroup mfcc Mel filterbank and MFCC
+   The mel filterbank sums the bins of a power spectrum with triangular weights. Since each band
+   covers only a few bins, only the nonzero weights are stored: for every band the first bin, the
+   number of bins and the weights, which are packed one band after the other. Every band is then a
+   single dot product of length pBandLength[m]. The MFCC are the DCT-II of the logarithm of the
+   band energies.
+*/
+
+/**
+   @addtogroup mfcc
+   @{
+*/
+
+/**
+   @brief Glue code for the sparse mel filterbank of a floating-point power spectrum.
+   @param[in]   S     points to an instance of the mel filterbank structure
+   @param[in]   pSrc  points to the power spectrum
+   @param[out]  pDst  points to the band energies, numBands values
+   @return      none
+*/
+void plp_mel_filterbank_f32(const plp_mel_filterbank_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    }
+
+    const float32_t *pCoeffs = S->pCoeffs;
+    uint32_t m;
+
+    for (m = 0; m < S->numBands; m++) {
+        pDst[m] = 0.0f;
+        plp_dot_prod_f32s_xpulpv2(pSrc + S->pBandStart[m], pCoeffs, S->pBandLength[m], &pDst[m]);
+        pCoeffs += S->pBandLength[m];
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_filterbank_init_q16.c
+ * Description:  Initialization of the sparse mel filterbank for 16-bit fixed point spectra
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline float32_t mel_to_bin(float32_t mel, float32_t binsPerHz);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup mfcc
+   @{
+*/
+
+/**
+   @brief Initialization of the sparse 16-bit fixed point mel filterbank.
+   @param[out]  S            points to an instance of the mel filterbank structure
+   @param[in]   numBands     number of mel bands
+   @param[in]   FFTLength    length of the FFT, the spectrum has FFTLength / 2 + 1 bins
+   @param[in]   sampleRate   sample rate in Hz
+   @param[in]   fMin         lower edge of the first band in Hz
+   @param[in]   fMax         upper edge of the last band in Hz, at most sampleRate / 2
+   @param[out]  pBandStart   points to the first bin of every band, numBands values
+   @param[out]  pBandLength  points to the number of bins of every band, numBands values
+   @param[out]  pCoeffs      points to the weights, PLP_MEL_COEFFS_SIZE(FFTLength) values
+   @return      none
+
+   @par
+   The band edges are equally spaced on the mel scale mel(f) = 2595 log10(1 + f / 700). Band m is
+   the triangle rising from edge m to edge m + 1 and falling to edge m + 2, with a peak weight of
+   one (32767 in Q1.15 format). Only the bins with nonzero weight are stored. This function uses
+   single precision floating point math and is intended to run once at startup.
+*/
+void plp_mel_filterbank_init_q16(plp_mel_filterbank_instance_q16 *S,
+                                uint32_t numBands,
+                                uint32_t FFTLength,
+                                float32_t sampleRate,
+                                float32_t fMin,
+                                float32_t fMax,
+                                uint16_t *pBandStart,
+                                uint16_t *pBandLength,
+                                int16_t *pCoeffs) {
+
+    uint32_t numBins = (FFTLength >> 1) + 1;
+    float32_t melMin = 2595.0f * log10f(1.0f + fMin / 700.0f);
+    float32_t melMax = 2595.0f * log10f(1.0f + fMax / 700.0f);
+    float32_t melStep = (melMax - melMin) / (numBands + 1);
+    float32_t binsPerHz = FFTLength / sampleRate;
+    float32_t left, center, right, w;
+    uint32_t m, k, n = 0;
+
+    S->numBands = numBands;
+    S->pBandStart = pBandStart;
+    S->pBandLength = pBandLength;
+    S->pCoeffs = pCoeffs;
+
+    // band m spans from edge m to edge m + 2, the edges are fractional bins
+    center = mel_to_bin(melMin, binsPerHz);
+    right = mel_to_bin(melMin + melStep, binsPerHz);
+
+    for (m = 0; m < numBands; m++) {
+        left = center;
+        center = right;
+        right = mel_to_bin(melMin + (m + 2) * melStep, binsPerHz);
+
+        pBandStart[m] = (uint32_t)left + 1;
+        pBandLength[m] = 0;
+        for (k = pBandStart[m]; k < numBins && k < right; k++) {
+            w = k <= center ? (k - left) / (center - left) : (right - k) / (right - center);
+            pCoeffs[n++] = (int16_t)(w * 32767.0f + 0.5f);
+            pBandLength[m]++;
+        }
+        if (pBandLength[m] == 0) {
+            pBandStart[m] = 0;
+        }
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
+
+static inline float32_t mel_to_bin(float32_t mel, float32_t binsPerHz) {
+
+    return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f) * binsPerHz;
+}
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_filterbank_q16.c
+ * Description:  Sparse mel filterbank of 16-bit fixed point spectra glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup mfcc
+   @{
+*/
+
+/**
+   @brief Glue code for the sparse mel filterbank of a 16-bit fixed point power spectrum.
+   @param[in]   S          points to an instance of the mel filterbank structure, the weights are
+                           in Q1.15 format
+   @param[in]   pSrc       points to the power spectrum
+   @param[in]   deciPoint  decimal point for right shift of the products
+   @param[out]  pDst       points to the band energies, numBands values
+   @return      none
+
+   @par Exploiting SIMD instructions
+   On the cluster, the bands are computed with plp_dot_prod_q16s_xpulpv2, which multiplies two
+   bins at once.
+
+   @par Fixed point range
+   The SIMD kernel sums the products of two bins before shifting, so the spectrum should be kept
+   below half scale to avoid an overflow of the intermediate sum.
+*/
+void plp_mel_filterbank_q16(const plp_mel_filterbank_instance_q16 *S,
+                            const int16_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            int32_t *__restrict__ pDst) {
+
+    const int16_t *pCoeffs = S->pCoeffs;
+    uint32_t m;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (m = 0; m < S->numBands; m++) {
+            plp_dot_prod_q16s_rv32im(pSrc + S->pBandStart[m], pCoeffs, S->pBandLength[m],
+                                     deciPoint, &pDst[m]);
+            pCoeffs += S->pBandLength[m];
+        }
+    } else {
+        for (m = 0; m < S->numBands; m++) {
+            plp_dot_prod_q16s_xpulpv2(pSrc + S->pBandStart[m], pCoeffs, S->pBandLength[m],
+                                      deciPoint, &pDst[m]);
+            pCoeffs += S->pBandLength[m];
+        }
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32.c
+ * Description:  Mel frequency cepstral coefficients of floating-point spectra glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MFCC_LOG_FLOOR_F32 1e-10f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup mfcc
+   @{
+*/
+
+/**
+   @brief Glue code for the mel frequency cepstral coefficients of a floating-point power spectrum.
+   @param[in]   S      points to an instance of the MFCC structure
+   @param[in]   pSrc   points to the power spectrum
+   @param[out]  pTmp   points to a temporary buffer of numBands values, holds the logarithm of the
+                       band energies afterwards
+   @param[out]  pDst   points to the coefficients, numCoeffs values
+   @return      none
+
+   @par
+   The band energies of the mel filterbank are floored at 1e-10 before the natural logarithm.
+   Every coefficient is the dot product of a row of the DCT-II matrix with the log energies.
+*/
+void plp_mfcc_f32(const plp_mfcc_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pTmp,
+                  float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    }
+
+    uint32_t numBands = S->pFilterbank->numBands;
+    uint32_t i;
+
+    plp_mel_filterbank_f32(S->pFilterbank, pSrc, pTmp);
+
+    for (i = 0; i < numBands; i++) {
+        pTmp[i] = logf(pTmp[i] > MFCC_LOG_FLOOR_F32 ? pTmp[i] : MFCC_LOG_FLOOR_F32);
+    }
+
+    for (i = 0; i < S->numCoeffs; i++) {
+        pDst[i] = 0.0f;
+        plp_dot_prod_f32s_xpulpv2(&S->pDctCoeffs[i * numBands], pTmp, numBands, &pDst[i]);
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_init_f32.c
+ * Description:  Initialization of the floating-point mel frequency cepstral coefficients
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MFCC_PI_F32 3.14159265358979f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup mfcc
+   @{
+*/
+
+/**
+   @brief Initialization of the floating-point mel frequency cepstral coefficients.
+   @param[out]  S            points to an instance of the MFCC structure
+   @param[in]   pFilterbank  points to an initialized instance of the mel filterbank structure
+   @param[in]   numCoeffs    number of coefficients, at most numBands
+   @param[out]  pDctCoeffs   points to the DCT-II matrix, numCoeffs * numBands values
+   @return      none
+
+   @par
+   Row i of the matrix is the orthonormal DCT-II basis function
+   sqrt((i == 0 ? 1 : 2) / numBands) * cos(pi * i * (m + 0.5) / numBands), for the bands m.
+*/
+void plp_mfcc_init_f32(plp_mfcc_instance_f32 *S,
+                      const plp_mel_filterbank_instance_f32 *pFilterbank,
+                      uint32_t numCoeffs,
+                      float32_t *pDctCoeffs) {
+
+    uint32_t numBands = pFilterbank->numBands;
+    float32_t scale, c;
+    uint32_t i, m;
+
+    S->pFilterbank = pFilterbank;
+    S->numCoeffs = numCoeffs;
+    S->pDctCoeffs = pDctCoeffs;
+
+    for (i = 0; i < numCoeffs; i++) {
+        scale = sqrtf((i == 0 ? 1.0f : 2.0f) / numBands);
+        for (m = 0; m < numBands; m++) {
+            c = scale * cosf(MFCC_PI_F32 * i * (m + 0.5f) / numBands);
+            pDctCoeffs[i * numBands + m] = c;
+        }
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
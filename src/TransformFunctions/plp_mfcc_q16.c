@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16.c
+ * Description:  Mel frequency cepstral coefficients of 16-bit fixed point spectra glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* ln(2) in Q1.15 format */
+#define MFCC_LN2_Q15 22713
+
+static inline int16_t mfcc_log_q16(int32_t x, uint32_t deciPoint);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup mfcc
+   @{
+*/
+
+/**
+   @brief Glue code for the mel frequency cepstral coefficients of a 16-bit fixed point power
+          spectrum.
+   @param[in]   S          points to an instance of the MFCC structure, the weights and the DCT
+                           coefficients are in Q1.15 format
+   @param[in]   pSrc       points to the power spectrum
+   @param[in]   deciPoint  decimal point of the spectrum
+   @param[out]  pTmp       points to a temporary buffer of numBands 32 bit values. Afterwards, its
+                           first numBands 16 bit values hold the natural logarithm of the band
+                           energies in Q5.10 format.
+   @param[out]  pDst       points to the coefficients in Q5.10 format, numCoeffs values
+   @return      none
+
+   @par
+   The band energies keep the decimal point of the spectrum. The logarithm is computed from the
+   position of the leading one and a third order polynomial of the following bits (error below
+   1e-3). Energies below one LSB are treated as one LSB. Every coefficient is the dot product of a
+   row of the DCT-II matrix with the log energies, two bands at a time on the cluster.
+*/
+void plp_mfcc_q16(const plp_mfcc_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int32_t *__restrict__ pTmp,
+                  int32_t *__restrict__ pDst) {
+
+    uint32_t numBands = S->pFilterbank->numBands;
+    int16_t *pLog = (int16_t *)pTmp;
+    uint32_t i;
+
+    plp_mel_filterbank_q16(S->pFilterbank, pSrc, 15, pTmp);
+
+    // in place, the 16 bit value i overlaps the 32 bit value i / 2, which is already consumed
+    for (i = 0; i < numBands; i++) {
+        pLog[i] = mfcc_log_q16(pTmp[i], deciPoint);
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (i = 0; i < S->numCoeffs; i++) {
+            plp_dot_prod_q16s_rv32im(&S->pDctCoeffs[i * numBands], pLog, numBands, 15, &pDst[i]);
+        }
+    } else {
+        for (i = 0; i < S->numCoeffs; i++) {
+            plp_dot_prod_q16s_xpulpv2(&S->pDctCoeffs[i * numBands], pLog, numBands, 15, &pDst[i]);
+        }
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
+
+static inline int16_t mfcc_log_q16(int32_t x, uint32_t deciPoint) {
+
+    int32_t n, frac, p;
+
+    if (x < 1) {
+        x = 1;
+    }
+
+    // x = 2^n * (1 + frac), with frac in Q1.15 format
+    n = 31 - __builtin_clz(x);
+    frac = n > 15 ? (x >> (n - 15)) & 0x7FFF : (x << (15 - n)) & 0x7FFF;
+
+    // log2(1 + frac) = frac * (1.42086 + frac * (-0.57725 + frac * 0.15639))
+    p = (5124 * frac) >> 15;
+    p = ((p - 18915) * frac) >> 15;
+    p = ((p + 46559) * frac) >> 15;
+
+    // ln(x / 2^deciPoint) = ln(2) * (n - deciPoint + log2(1 + frac)), in Q5.10 format
+    p = (((n - (int32_t)deciPoint) << 10) + (p >> 5)) * MFCC_LN2_Q15;
+    return (int16_t)(p >> 15);
+}
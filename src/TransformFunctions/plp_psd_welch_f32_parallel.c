@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32_parallel.c
+ * Description:  32-bit floating-point parallel Welch power spectral density glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel floating-point Welch power spectral density estimator.
+   @param[in]   S          points to an instance of the Welch structure, initialized by
+                           plp_psd_welch_init_f32
+   @param[in]   pSrc       points to the input samples
+   @param[in]   blockSize  number of input samples, at least FFTLength
+   @param[in]   nPE        number of cores to compute on
+   @param[in]   pScratch   points to a scratch buffer of
+                           PLP_PSD_WELCH_SCRATCH_SIZE_F32(FFTLength, nPE) floats
+   @param[out]  pDst       points to the output buffer of FFTLength / 2 + 1 bins
+   @return      none
+
+   @par
+   Segment s is transformed by core s % nPE. Every core needs its own FFT buffer and, except for
+   core 0, which accumulates into pDst, its own sum of the bins. The result is the same as the one
+   of plp_psd_welch_f32 (up to the rounding of the additions).
+*/
+void plp_psd_welch_f32_parallel(const plp_psd_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pScratch,
+                                float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (blockSize < S->S->FFTLength) {
+        return;
+    }
+
+    uint32_t numSegments = (blockSize - S->S->FFTLength) / S->hopSize + 1;
+    plp_psd_welch_arg_f32 arg = { S, pSrc, numSegments, nPE, pScratch, pDst };
+
+    rt_team_fork(nPE, plp_psd_welch_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+   @} end of psdWelch group
+*/
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_init_q16.c
+ * Description:  16-bit fixed point Welch power spectral density initialization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Initialization function for the 16-bit fixed point Welch power spectral density
+          estimator.
+   @param[out]  S         points to an instance of the Welch structure
+   @param[in]   pFFT      points to an instance of the 16-bit fixed point complex FFT structure,
+                          its length is the segment length
+   @param[in]   pWindow   points to an instance of the window structure, its length is the FFT
+                          length (e.g. a periodic Hann window of plp_window_init_q16)
+   @param[in]   hopSize   number of samples between two segments, at least 1
+   @return      none
+
+   @par
+   The energy of the window is computed once, its coefficients must stay valid as long as the
+   instance is used. This function uses single precision floating point math and is intended to
+   run once at startup.
+*/
+void plp_psd_welch_init_q16(plp_psd_welch_instance_q16 *S,
+                            const plp_cfft_instance_q16 *pFFT,
+                            const plp_window_instance_q16 *pWindow,
+                            uint32_t hopSize) {
+
+    uint32_t length = pFFT->fftLen;
+    uint32_t half = length >> 1;
+    const int16_t *pW = pWindow->pCoeffs;
+    float32_t energy = 0.0f;
+    float32_t w;
+    uint32_t n;
+
+    for (n = 0; n < length; n++) {
+        w = (n < half || pWindow->mirror == 0) ? pW[n] : pW[pWindow->mirror - n];
+        energy += w * w;
+    }
+
+    // length / energy of the window in Q1.15, in Q16.16 format
+    S->S = pFFT;
+    S->pWindow = pW;
+    S->windowMirror = pWindow->mirror;
+    S->hopSize = hopSize;
+    S->invEnergy = (uint32_t)lroundf(65536.0f * 1073741824.0f * (float32_t)length / energy);
+}
+
+/**
+   @} end of psdWelch group
+*/
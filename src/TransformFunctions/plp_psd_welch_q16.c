@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16.c
+ * Description:  16-bit fixed point Welch power spectral density glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @defgroup psdWelch Welch power spectral density
+   The Welch method estimates the power spectral density of a block of samples by averaging the
+   periodograms of K overlapping segments. Segment s starts at sample s * hopSize, it is multiplied
+   with the window w of N samples and transformed, and the power of bin k is
+
+   \f[
+      P[k] = \frac{1}{K N \sum_{n=0}^{N-1} w[n]^2} \sum_{s=0}^{K-1} |X_s[k]|^2
+   \f]
+
+   for k = 0 to N / 2. The sum of P over all N bins of the two-sided spectrum is the mean power of
+   the signal, i.e. a sinusoid of amplitude A results in a peak of about A^2 / 4 at its bin (and
+   its mirror), and white noise of variance \f$\sigma^2\f$ in \f$\sigma^2 / N\f$ per bin.
+
+   The window multiplication is done while the segment is copied into the FFT buffer, and the
+   squared magnitude of the bins is added to the running sum directly from the last stage of the
+   FFT (see plp_stft_q16 and plp_stft_f32), without a buffer for the spectrum of a segment. The
+   parallel versions distribute the segments over the cores, every core accumulates into its own
+   sum, and the sums are added and scaled in the end.
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point Welch power spectral density estimator.
+   @param[in]   S          points to an instance of the Welch structure, initialized by
+                           plp_psd_welch_init_q16
+   @param[in]   pSrc       points to the input samples in Q1.15 format
+   @param[in]   blockSize  number of input samples, at least fftLen
+   @param[in]   pScratch   points to a scratch buffer of PLP_PSD_WELCH_SCRATCH_SIZE_Q16(fftLen, 1)
+                           samples
+   @param[out]  pDst       points to the output buffer of fftLen / 2 + 1 bins in Q2.30 format
+   @return      none
+
+   @par Fix-Point
+   The power of a segment is |X[k] / N|^2 in Q2.30 format (see plp_stft_q16). It is shifted right
+   by ceil(log2(K)) before it is added to the sum, such that the sum does not overflow, and the
+   sum is scaled with the energy of the window in the end. The result saturates at 2.0, which is
+   not reached by input samples in [-1, 1).
+*/
+void plp_psd_welch_q16(const plp_psd_welch_instance_q16 *S,
+                       const int16_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       int16_t *__restrict__ pScratch,
+                       int32_t *__restrict__ pDst) {
+
+    uint32_t length = S->S->fftLen;
+
+    if (blockSize < length) {
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_psd_welch_q16s_rv32im(S, pSrc, (blockSize - length) / S->hopSize + 1, pScratch, pDst);
+    } else {
+        plp_psd_welch_q16s_xpulpv2(S, pSrc, (blockSize - length) / S->hopSize + 1, pScratch, pDst);
+    }
+}
+
+/**
+   @} end of psdWelch group
+*/
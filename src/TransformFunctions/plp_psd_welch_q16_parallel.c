@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16_parallel.c
+ * Description:  16-bit fixed point parallel Welch power spectral density glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup psdWelch
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel 16-bit fixed point Welch power spectral density estimator.
+   @param[in]   S          points to an instance of the Welch structure, initialized by
+                           plp_psd_welch_init_q16
+   @param[in]   pSrc       points to the input samples in Q1.15 format
+   @param[in]   blockSize  number of input samples, at least fftLen
+   @param[in]   nPE        number of cores to compute on
+   @param[in]   pScratch   points to a scratch buffer of
+                           PLP_PSD_WELCH_SCRATCH_SIZE_Q16(fftLen, nPE) samples
+   @param[out]  pDst       points to the output buffer of fftLen / 2 + 1 bins in Q2.30 format
+   @return      none
+
+   @par
+   Segment s is transformed by core s % nPE. Every core needs its own FFT buffer and, except for
+   core 0, which accumulates into pDst, its own sum of the bins. The result is the same as the one
+   of plp_psd_welch_q16.
+*/
+void plp_psd_welch_q16_parallel(const plp_psd_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pScratch,
+                                int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (blockSize < S->S->fftLen) {
+        return;
+    }
+
+    uint32_t numSegments = (blockSize - S->S->fftLen) / S->hopSize + 1;
+    plp_psd_welch_arg_q16 arg = { S, pSrc, numSegments, nPE, pScratch, pDst };
+
+    rt_team_fork(nPE, plp_psd_welch_q16p_xpulpv2, (void *)&arg);
+}
+
+/**
+   @} end of psdWelch group
+*/
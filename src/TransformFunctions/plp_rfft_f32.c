@@ -38,7 +38,15 @@
   @defgroup fft  FFT transforms
   This module contains the code to perform FFT transforms.
 
+  The single core version uses the algorithm selected by the algorithm field of the instance:
+  PLP_RFFT_RADIX2 computes log2(N) radix-2 stages, PLP_RFFT_RADIX4 merges pairs of stages into
+  radix-4 passes, which halves the passes over the output and saves a quarter of the complex
+  multiplications. Lengths below 4 always use radix-2.
 
+  Both algorithms produce the output in bit reversed order. With bitReverseFlag set, it is
+  reordered in-place with the pair table pBitRevTable, which swaps every pair of bins once, or
+  with indices computed on the fly if the table is NULL. Consumers which read the bins in bit
+  reversed order directly clear bitReverseFlag and skip the reordering.
  */
 
 /**
@@ -62,7 +70,11 @@ void plp_rfft_f32(const plp_rfft_instance_f32 *S,
         return;
     }
 
-    plp_rfft_f32_xpulpv2(S, pSrc, pDst);
+    if (S->algorithm == PLP_RFFT_RADIX4 && S->FFTLength >= 4) {
+        plp_rfft_radix4_f32_xpulpv2(S, pSrc, pDst);
+    } else {
+        plp_rfft_f32_xpulpv2(S, pSrc, pDst);
+    }
 }
 
 /**
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_f32_batch.c
+ * Description:  Batched floating-point FFT on real input data glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the floating-point FFT of a batch of real input channels.
+   @param[in]   S              points to an instance of the floating-point FFT structure, which is
+                               used for all channels
+   @param[in]   pSrc           points to the input buffer (real data), channel c starts at
+                               pSrc + c * channelStride
+   @param[in]   nChannels      number of channels
+   @param[in]   channelStride  distance between the channels in samples, at least FFTLength
+   @param[in]   nPE            number of parallel processing units
+   @param[out]  pDst           points to the output buffer (complex data), channel c starts at
+                               pDst + 2 * c * channelStride
+   @return      none
+
+   @par
+   The team is forked once for the whole batch, and every core computes whole transforms with the
+   single core kernel (channel c on core c % nPE). This avoids the synchronization of the parallel
+   FFT within a single transform, but needs at least nPE channels to use all cores.
+*/
+void plp_rfft_f32_batch(const plp_rfft_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        uint32_t nChannels,
+                        uint32_t channelStride,
+                        uint32_t nPE,
+                        float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_batch_arg_f32 arg = { S, pSrc, nChannels, channelStride, nPE, pDst };
+
+    rt_team_fork(nPE, plp_rfft_f32_batch_xpulpv2, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_f32_batch_multi.c
+ * Description:  Glue code for a batch of floating-point RFFTs split across clusters
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/* runs on the master core of each cluster */
+static void plp_rfft_f32_batch_multi_entry(void *args) {
+
+    plp_rfft_batch_arg_f32 *a = (plp_rfft_batch_arg_f32 *)args;
+
+    plp_rfft_f32_batch(a->S, a->pSrc, a->nChannels, a->channelStride, a->nPE, a->pDst);
+}
+
+/**
+   @brief Glue code for the floating-point FFT of a batch of real input channels, which is split
+          across several clusters.
+   @param[in]   S              points to an instance of the floating-point FFT structure, which is
+                               used for all channels. The instance and its tables must reside in L2.
+   @param[in]   pSrc           points to the input buffer (real data) in L2, channel c starts at
+                               pSrc + c * channelStride
+   @param[in]   nChannels      number of channels
+   @param[in]   channelStride  distance between the channels in samples, at least FFTLength
+   @param[in]   nClusters      number of clusters, which must be mounted
+   @param[in]   nPE            number of parallel processing units on every cluster
+   @param[out]  pDst           points to the output buffer (complex data) in L2, channel c starts
+                               at pDst + 2 * c * channelStride
+   @return      none
+
+   @par
+   Every cluster transforms a contiguous range of channels with plp_rfft_f32_batch.
+*/
+void plp_rfft_f32_batch_multi(const plp_rfft_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              uint32_t nChannels,
+                              uint32_t channelStride,
+                              uint32_t nClusters,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("multi-cluster execution supported only for fabric controller side\n");
+        return;
+    }
+
+    plp_async_handle handle[nClusters];
+
+    for (uint32_t c = 0; c < nClusters; c++) {
+        uint32_t chStart = nChannels * c / nClusters;
+        uint32_t chEnd = nChannels * (c + 1) / nClusters;
+        plp_rfft_batch_arg_f32 *a = (plp_rfft_batch_arg_f32 *)handle[c].args;
+
+        handle[c].event = NULL;
+        if (chStart == chEnd) {
+            continue;
+        }
+
+        a->S = S;
+        a->pSrc = pSrc + chStart * channelStride;
+        a->nChannels = chEnd - chStart;
+        a->channelStride = channelStride;
+        a->nPE = nPE;
+        a->pDst = pDst + 2 * chStart * channelStride;
+
+        plp_async_call_cluster(c, plp_rfft_f32_batch_multi_entry, (void *)a, &handle[c]);
+    }
+
+    for (uint32_t c = 0; c < nClusters; c++) {
+        plp_async_wait(&handle[c]);
+    }
+}
+
+/**
+   @} end of FFT group
+*/
@@ -50,7 +50,7 @@
    @brief Floating-point FFT on real input data (parallel version).
    @param[in]   S       points to an instance of the floating-point FFT structure
    @param[in]   pSrc    points to the input buffer (real data)
-   @param[in]   nPE     number of parallel processing units
+   @param[in]   nPE     number of parallel processing units, at most FFTLength / 2 are used
    @param[out]  pDst    points to the output buffer (complex data)
    @return      none
 */
@@ -64,9 +64,12 @@ void plp_rfft_f32_parallel(const plp_rfft_instance_f32 *S,
         return;
     }
 
-    plp_rfft_parallel_arg_f32 arg = (plp_rfft_parallel_arg_f32){ S, pSrc, nPE, pDst };
+    // every core needs a butterfly of the first and of the last stage
+    uint32_t nCores = __MAX(1, __MIN(nPE, S->FFTLength / 2));
 
-    rt_team_fork(nPE, plp_rfft_f32_xpulpv2_parallel, (void *)&arg);
+    plp_rfft_parallel_arg_f32 arg = (plp_rfft_parallel_arg_f32){ S, pSrc, nCores, pDst };
+
+    rt_team_fork(nCores, plp_rfft_f32_xpulpv2_parallel, (void *)&arg);
 }
 
 /**
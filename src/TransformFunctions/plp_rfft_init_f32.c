@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_init_f32.c
+ * Description:  Initialization of the floating-point real FFT instance
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define RFFT_TWO_PI_F32 6.28318530717958647692f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Initialization of the floating-point real FFT instance, which computes the twiddle
+          factors and the bit reversal table for any power of two length.
+   @param[out] S         points to an instance of the floating-point FFT structure
+   @param[in]  FFTLength Length of the FFT, must be a power of two
+   @param[out] pBuffer   points to a buffer of PLP_RFFT_BUFFER_SIZE_F32(FFTLength) = 3 *
+                         FFTLength / 2 values. It holds the FFTLength / 2 complex twiddle factors,
+                         followed by the pair table of the bit reversal, which has less than
+                         FFTLength entries, and must stay valid as long as the instance is used.
+   @return     none
+
+   @par
+   The tables are computed once, such that the FFT neither needs the tables of
+   plp_const_structs.h nor computes the bit reversal of the output indices on every call. The
+   instance is set up for the radix-4 algorithm with bit reversal of the output; both can be
+   changed afterwards with the fields algorithm and bitReverseFlag.
+*/
+void plp_rfft_init_f32(plp_rfft_instance_f32 *S, uint32_t FFTLength, float32_t *pBuffer) {
+
+    Complex_type_f32 *pTwiddle = (Complex_type_f32 *)pBuffer;
+    uint16_t *pTable = (uint16_t *)(pBuffer + FFTLength);
+    uint32_t log2Len = 0;
+    uint32_t length = 0;
+    uint32_t k, b;
+
+    while ((1U << log2Len) < FFTLength) {
+        log2Len++;
+    }
+
+    // W^k = e^(-j 2 pi k / N)
+    for (k = 0; k < FFTLength / 2; k++) {
+        float32_t phi = -RFFT_TWO_PI_F32 * k / FFTLength;
+        pTwiddle[k].re = cosf(phi);
+        pTwiddle[k].im = sinf(phi);
+    }
+
+    for (k = 0; k < FFTLength; k++) {
+        uint32_t rev = 0;
+        for (b = 0; b < log2Len; b++) {
+            rev |= ((k >> b) & 1) << (log2Len - 1 - b);
+        }
+        // every pair is stored once, the fixed points of the bit reversal are skipped
+        if (rev > k) {
+            pTable[length++] = k;
+            pTable[length++] = rev;
+        }
+    }
+
+    S->FFTLength = FFTLength;
+    S->bitReverseFlag = 1;
+    S->pTwiddleFactors = (float32_t *)pTwiddle;
+    S->pBitRevTable = pTable;
+    S->algorithm = PLP_RFFT_RADIX4;
+    S->bitRevLength = length;
+}
+
+/**
+   @} end of FFT group
+*/
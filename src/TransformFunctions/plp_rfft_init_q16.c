@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point real FFT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define RFFT_TWO_PI_F32 6.28318530717958647692f
+
+static inline int16_t rfft_q15(float32_t x);
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point real FFT instance, which computes the twiddle
+          factors of the split stage.
+   @param[out]  S        points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pFFT     points to an instance of the 16-bit fixed point complex FFT structure, its
+                         length is half the FFT length
+   @param[out]  pBuffer  points to a buffer of FFT length values for the table, which must stay
+                         valid as long as the instance is used
+   @return      none
+
+   @par
+   This function uses single precision floating point math and is intended to run once at startup.
+*/
+void plp_rfft_init_q16(plp_rfft_instance_q16 *S,
+                       const plp_cfft_instance_q16 *pFFT,
+                       int16_t *pBuffer) {
+
+    uint32_t length = 2 * pFFT->fftLen;
+    uint32_t k;
+
+    // W^k = e^(-j 2 pi k / N)
+    for (k = 0; k < length / 2; k++) {
+        float32_t phi = -RFFT_TWO_PI_F32 * k / length;
+        pBuffer[2 * k] = rfft_q15(cosf(phi));
+        pBuffer[2 * k + 1] = rfft_q15(sinf(phi));
+    }
+
+    S->S = pFFT;
+    S->pTwiddle = pBuffer;
+}
+
+/**
+   @} end of fft group
+*/
+
+static inline int16_t rfft_q15(float32_t x) {
+
+    int32_t q = lroundf(x * 32768.0f);
+    return q > 32767 ? 32767 : (q < -32767 ? -32767 : q);
+}
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16.c
+ * Description:  16-bit fixed point real FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed point FFT on real input data.
+   @param[in]   S     points to an instance of the 16-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.15 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values, the DFT divided by
+                      N in Q1.15 format
+   @return      none
+
+   @par
+   The N real inputs are read as N / 2 complex values z[n] = x[2n] + j x[2n + 1], which are
+   copied to pDst and transformed in-place with the complex FFT of S. The split stage separates
+   the spectra of the even and odd samples, Xe[k] = (Z[k] + Z*[N/2 - k]) / 2 and
+   Xo[k] = (Z[k] - Z*[N/2 - k]) / 2j, and combines them to X[k] = Xe[k] + W^k Xo[k]. The bins k
+   and N / 2 - k are computed together, such that the split stage works in-place as well. This
+   needs half the work of a complex FFT on zero-padded data. The supported FFT lengths are the
+   doubled lengths of plp_cfft_q16, 32 to 8192.
+*/
+void plp_rfft_q16(const plp_rfft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_rfft_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_rfft_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+   @} end of fft group
+*/
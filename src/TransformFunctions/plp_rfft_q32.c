@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32.c
+ * Description:  32-bit fixed point real FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the 32-bit fixed point FFT on real input data.
+   @param[in]   S     points to an instance of the 32-bit fixed point real FFT structure
+   @param[in]   pSrc  points to the input buffer of N values in Q1.31 format
+   @param[out]  pDst  points to the output buffer of N / 2 + 1 complex values, the DFT divided by
+                      N in Q1.31 format
+   @return      none
+
+   @par
+   The N real inputs are read as N / 2 complex values z[n] = x[2n] + j x[2n + 1], which are
+   stored to pDst in bit reversed order and transformed in-place with a radix-2 complex FFT of
+   length N / 2. Every stage halves its outputs, which keeps the values in range and yields
+   Z / (N / 2). The split stage is the same as in plp_rfft_q16, and computes the bins k and
+   N / 2 - k together from X[k] = (Z[k] + Z*[N/2 - k]) / 2 + W^k (Z[k] - Z*[N/2 - k]) / 2j.
+*/
+void plp_rfft_q32(const plp_rfft_instance_q32 *S,
+                  const int32_t *__restrict__ pSrc,
+                  int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_rfft_q32s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_rfft_q32s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+   @} end of fft group
+*/
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point sliding DFT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define SDFT_PI_F32 3.14159265358979323846f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup goertzel
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point sliding DFT instance, which computes the
+          damped twiddle factors of the bins and clears the bins and the delay line.
+   @param[out]  S        points to an instance of the 32-bit floating-point sliding DFT structure
+   @param[in]   length   Length N of the DFT window
+   @param[in]   numBins  Number of bins
+   @param[in]   pBins    points to the indices k of the bins, between 0 and N - 1
+   @param[out]  pCoeffs  points to a buffer of 2 * numBins values, which holds the damped twiddle
+                         factors r e^(j 2 pi k / N), and must stay valid as
+                         long as the instance is used
+   @param[out]  pState   points to a buffer of 2 * numBins values for the complex bins
+   @param[out]  pDelay   points to a buffer of length values for the last N input samples
+   @return      none
+
+   @par
+   This function uses single precision floating point math and is intended to run once at startup.
+*/
+void plp_sdft_init_f32(plp_sdft_instance_f32 *S,
+                       uint32_t length,
+                       uint32_t numBins,
+                       const uint32_t *pBins,
+                       float32_t *pCoeffs,
+                       float32_t *pState,
+                       float32_t *pDelay) {
+
+    float32_t r = PLP_SDFT_DAMPING;
+    uint32_t k;
+    uint32_t n;
+
+    for (k = 0; k < numBins; k++) {
+        float32_t w = 2.0f * SDFT_PI_F32 * pBins[k] / length;
+        pCoeffs[2 * k] = r * cosf(w);
+        pCoeffs[2 * k + 1] = r * sinf(w);
+        pState[2 * k] = 0;
+        pState[2 * k + 1] = 0;
+    }
+
+    for (n = 0; n < length; n++) {
+        pDelay[n] = 0;
+    }
+
+    S->length = length;
+    S->numBins = numBins;
+    S->pCoeffs = pCoeffs;
+    S->damping = powf(r, length);
+    S->pState = pState;
+    S->pDelay = pDelay;
+    S->index = 0;
+}
+
+/**
+   @} end of goertzel group
+*/
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_frame_f32.c
+ * Description:  Power spectrum of a contiguous frame of floating-point data glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the power spectrum of one frame of the short-time Fourier transform, whose
+          FFTLength samples are contiguous in memory, e.g. a frame of plp_udma_stream_take.
+   @param[in]     S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_f32. Its ring buffer and hop counter are not used.
+   @param[in]     pFrame      points to the FFTLength samples of the frame, oldest first
+   @param[out]    pDst        points to the output buffer of FFTLength / 2 + 1 bins
+   @return        none
+
+   @par
+   Unlike plp_stft_f32, the samples are not copied into the ring buffer of the instance. The result
+   is the same as the frame of plp_stft_f32 which ends with the last sample of pFrame.
+*/
+void plp_stft_frame_f32(const plp_stft_instance_f32 *S,
+                        const float32_t *__restrict__ pFrame,
+                        float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_stft_f32_xpulpv2(S->S, pFrame, 0, S->pWindow, S->windowMirror, S->pScratch, pDst);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_frame_q16.c
+ * Description:  Power spectrum of a contiguous frame of 16-bit fixed point data glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the power spectrum of one frame of the 16-bit fixed point short-time Fourier
+          transform, whose fftLen samples are contiguous in memory, e.g. a frame of
+          plp_udma_stream_take.
+   @param[in]     S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_q16. Its ring buffer and hop counter are not used.
+   @param[in]     pFrame      points to the fftLen samples of the frame in Q1.15 format, oldest
+                              first
+   @param[out]    pDst        points to the output buffer of fftLen / 2 + 1 bins in Q2.30 format
+   @return        none
+
+   @par
+   Unlike plp_stft_q16, the samples are not copied into the ring buffer of the instance. The result
+   is the same as the frame of plp_stft_q16 which ends with the last sample of pFrame.
+*/
+void plp_stft_frame_q16(const plp_stft_instance_q16 *S,
+                        const int16_t *__restrict__ pFrame,
+                        int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_stft_q16s_rv32im(S->S, pFrame, 0, S->pWindow, S->windowMirror, S->pScratch, pDst);
+    } else {
+        plp_stft_q16s_xpulpv2(S->S, pFrame, 0, S->pWindow, S->windowMirror, S->pScratch, pDst);
+    }
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_init_f32.c
+ * Description:  Initialization function for the floating-point short-time Fourier transform
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Initialization function for the floating-point short-time Fourier transform.
+   @param[out]  S         points to an instance of the STFT structure
+   @param[in]   pFFT      points to an instance of the floating-point real FFT structure, its length
+                          is the frame length
+   @param[in]   pWindow   points to an instance of the window structure, its length is the FFT
+                          length (e.g. a periodic window of plp_window_init_f32)
+   @param[in]   hopSize   number of samples between two frames, between 1 and the FFT length
+   @param[in]   pState    points to the ring buffer of FFT length samples
+   @param[in]   pScratch  points to a scratch buffer of 2 * FFT length floats
+   @return      none
+
+   @par
+   The ring buffer is cleared, and the first frame is computed after hopSize samples. The FFT length
+   must be at least 4.
+*/
+void plp_stft_init_f32(plp_stft_instance_f32 *S,
+                       const plp_rfft_instance_f32 *pFFT,
+                       const plp_window_instance_f32 *pWindow,
+                       uint32_t hopSize,
+                       float32_t *pState,
+                       float32_t *pScratch) {
+
+    uint32_t i;
+
+    S->S = pFFT;
+    S->pWindow = pWindow->pCoeffs;
+    S->windowMirror = pWindow->mirror;
+    S->hopSize = hopSize;
+    S->pState = pState;
+    S->pScratch = pScratch;
+    S->writeIndex = 0;
+    S->hopCount = 0;
+
+    for (i = 0; i < pFFT->FFTLength; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of FFT group
+*/
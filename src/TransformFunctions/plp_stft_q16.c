@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16.c
+ * Description:  Short-time Fourier transform of 16-bit fixed point data glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Glue code for the short-time Fourier transform (power spectrogram) of a stream of
+          16-bit fixed point samples.
+   @param[in,out] S           points to an instance of the STFT structure, initialized by
+                              plp_stft_init_q16
+   @param[in]     pSrc        points to the new input samples
+   @param[in]     blockSize   number of new input samples
+   @param[out]    pDst        points to the output buffer, the frames are stored one after the
+                              other with FFTLength / 2 + 1 bins each
+   @param[out]    pNumFrames  points to the number of frames stored to pDst
+   @return        none
+
+   @par
+   The samples are appended to the ring buffer of the last FFTLength samples. Every hopSize
+   samples, the last FFTLength samples are multiplied with the window and transformed, and the
+   squared magnitude of the bins 0 to FFTLength / 2 is stored. pDst must have room for
+   (hopCount + blockSize) / hopSize frames, where hopCount is the number of samples left over from
+   the previous calls. The ring buffer is zero-initialized, hence the first frames contain zeros
+   before the start of the stream.
+
+   @par
+   The input and the window are in Q1.15 format. The power of bin k is |X[k] / N|^2 in Q2.30
+   format, where X is the DFT of the windowed frame and N is the FFT length.
+
+   The window multiplication is done while the frame is copied into the FFT buffer, and the squared
+   magnitude is computed directly from the bit reversed FFT output, without the bit reversal pass.
+*/
+void plp_stft_q16(plp_stft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst,
+                  uint32_t *__restrict__ pNumFrames) {
+
+    uint32_t length = S->S->fftLen;
+    uint32_t mask = length - 1;
+    uint32_t nFrames = 0;
+    uint32_t i, n;
+
+    while (blockSize > 0) {
+        // append the samples up to the next frame to the ring buffer
+        n = S->hopSize - S->hopCount;
+        if (n > blockSize) {
+            n = blockSize;
+        }
+        for (i = 0; i < n; i++) {
+            S->pState[S->writeIndex] = *pSrc++;
+            S->writeIndex = (S->writeIndex + 1) & mask;
+        }
+        S->hopCount += n;
+        blockSize -= n;
+
+        // the oldest sample of the frame is at the write position
+        if (S->hopCount == S->hopSize) {
+            if (rt_cluster_id() == ARCHI_FC_CID) {
+                plp_stft_q16s_rv32im(S->S, S->pState, S->writeIndex, S->pWindow, S->windowMirror,
+                                     S->pScratch, pDst);
+            } else {
+                plp_stft_q16s_xpulpv2(S->S, S->pState, S->writeIndex, S->pWindow,
+                                      S->windowMirror, S->pScratch, pDst);
+            }
+            pDst += (length >> 1) + 1;
+            S->hopCount = 0;
+            nFrames++;
+        }
+    }
+
+    *pNumFrames = nFrames;
+}
+
+/**
+   @} end of FFT group
+*/
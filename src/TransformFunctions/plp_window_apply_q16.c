@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_apply_q16.c
+ * Description:  16-bit fixed point window glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @defgroup window Window functions
+   The window functions taper a frame before a spectral transform. plp_window_init_q16 and
+   plp_window_init_f32 compute a Hann, Hamming or Blackman window once, and plp_window_apply_q16
+   and plp_window_apply_f32 multiply a frame with it.
+
+   These windows are symmetric, w[n] = w[M - n], where M = N - 1 for a symmetric and M = N for a
+   periodic window of N samples. The instance stores only the first half of the window and the
+   mirror index M, and the second half of the frame is multiplied with the coefficients read
+   backwards. This halves the memory of the table, e.g. for a window of 512 samples in L1.
+
+   The instance can also hold a window of any shape, if all N coefficients are stored and the
+   mirror index is 0. plp_stft_init_q16 and plp_stft_init_f32 take a window instance as well, and
+   multiply the frame with it while it is copied into the FFT buffer.
+*/
+
+/**
+   @addtogroup window
+   @{
+*/
+
+/**
+   @brief Glue code for the multiplication of a 16-bit fixed point frame with a window.
+   @param[in]   S     points to an instance of the window structure
+   @param[in]   pSrc  points to the frame of S->length samples in Q1.15 format
+   @param[out]  pDst  points to the windowed frame in Q1.15 format, may be equal to pSrc
+   @return      none
+
+   @par Fix-Point
+   The products are rounded to the nearest value, which is equal to plp_mult_q16 with deciPoint 15.
+*/
+void plp_window_apply_q16(const plp_window_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_window_apply_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_window_apply_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+   @} end of window group
+*/
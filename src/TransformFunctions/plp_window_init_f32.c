@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_init_f32.c
+ * Description:  32-bit floating-point window initialization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define WINDOW_PI_F32 3.14159265358979323846f
+
+/**
+   @ingroup groupTransforms
+*/
+
+/**
+   @addtogroup window
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit floating-point window instance, which computes the first
+          half of a Hann, Hamming or Blackman window.
+   @param[out]  S         points to an instance of the 32-bit floating-point window structure
+   @param[in]   type      PLP_WINDOW_HANN, PLP_WINDOW_HAMMING or PLP_WINDOW_BLACKMAN
+   @param[in]   length    number of samples N of the window, at least 2
+   @param[in]   periodic  0: symmetric window (for filter design), 1: periodic window (for
+                          spectral analysis, e.g. plp_stft_f32)
+   @param[out]  pCoeffs   points to a buffer of PLP_WINDOW_COEFFS_SIZE(length) values, which holds
+                          the coefficients, and must stay valid as long as the
+                          instance is used
+   @return      none
+
+   @par
+   The window is \f$w[n] = a_0 - a_1 \cos(2 \pi n / M) + a_2 \cos(4 \pi n / M)\f$ with
+   M = N - 1 for the symmetric and M = N for the periodic window. Since w[n] = w[M - n], only the
+   coefficients up to n = M - N / 2 are computed and stored, and the samples n >= N / 2 are read
+   backwards from M - n.
+*/
+void plp_window_init_f32(plp_window_instance_f32 *S,
+                         uint32_t type,
+                         uint32_t length,
+                         uint8_t periodic,
+                         float32_t *pCoeffs) {
+
+    uint32_t mirror = periodic ? length : length - 1;
+    float32_t a0, a1, a2;
+    float32_t w;
+    uint32_t n;
+
+    switch (type) {
+    case PLP_WINDOW_HAMMING:
+        a0 = 0.54f;
+        a1 = 0.46f;
+        a2 = 0.0f;
+        break;
+    case PLP_WINDOW_BLACKMAN:
+        a0 = 0.42f;
+        a1 = 0.5f;
+        a2 = 0.08f;
+        break;
+    default: // PLP_WINDOW_HANN
+        a0 = 0.5f;
+        a1 = 0.5f;
+        a2 = 0.0f;
+        break;
+    }
+
+    for (n = 0; n <= mirror - length / 2; n++) {
+        w = 2.0f * WINDOW_PI_F32 * (float32_t)n / (float32_t)mirror;
+        pCoeffs[n] = a0 - a1 * cosf(w) + a2 * cosf(2.0f * w);
+    }
+
+    S->length = length;
+    S->mirror = mirror;
+    S->pCoeffs = pCoeffs;
+}
+
+/**
+   @} end of window group
+*/
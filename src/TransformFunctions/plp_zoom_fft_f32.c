@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_zoom_fft_f32.c
+ * Description:  Floating-point zoom FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup czt
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the floating-point zoom FFT.
+ * @param[in,out] S         points to an instance of the floating-point zoom FFT structure,
+ *                          initialized by plp_zoom_fft_init_f32. The mixer phase and the
+ *                          decimator states are updated, such that consecutive calls process a
+ *                          continuous stream.
+ * @param[in]     pSrc      points to D * fftLen real input samples
+ * @param[out]    pDst      points to the fftLen complex output bins. Bin i is at the normalized
+ *                          frequency fc + (i - fftLen / 2) / (D * fftLen), with fftLen / 2
+ *                          rounded down.
+ * @param[out]    pScratch  points to a scratch buffer of size PLP_ZOOM_FFT_SCRATCH_SIZE(fftLen, D)
+ * @return        none
+ */
+void plp_zoom_fft_f32(plp_zoom_fft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      float32_t *__restrict__ pScratch) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_zoom_fft_f32s_xpulpv2(S, pSrc, pDst, pScratch);
+    }
+}
+
+/**
+ * @} end of czt group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_zoom_fft_init_f32.c
+ * Description:  Initialization of the floating-point zoom FFT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define ZOOM_FFT_PI 3.14159265358979323846
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup czt
+ * @{
+ */
+
+/**
+ * @brief         Initialization of the floating-point zoom FFT instance.
+ * @param[out]    S         points to an instance of the floating-point zoom FFT structure
+ * @param[in]     fc        normalized center frequency of the band, in cycles per input sample
+ * @param[in]     D         decimation factor, the band has a width of 1 / D
+ * @param[in]     numTaps   number of coefficients of the low-pass filter
+ * @param[in]     pCoeffs   points to the coefficients of the low-pass filter, in time-reversed
+ *                          order, with a cutoff frequency below 1 / (2 D)
+ * @param[in]     pStateI   points to the state buffer of the in-phase decimator of size
+ *                          PLP_ZOOM_FFT_STATE_SIZE(numTaps, D)
+ * @param[in]     pStateQ   points to the state buffer of the quadrature decimator of size
+ *                          PLP_ZOOM_FFT_STATE_SIZE(numTaps, D)
+ * @param[in]     pCfft     points to an initialized mixed-radix CFFT instance, whose length is
+ *                          the number of output bins
+ * @param[out]    pMixer    points to a buffer of 2 * D values for the mixer table
+ * @return        none
+ *
+ * @par
+ * The mixer phases are computed in double precision. The state of the decimators is cleared.
+ */
+void plp_zoom_fft_init_f32(plp_zoom_fft_instance_f32 *S,
+                           float32_t fc,
+                           uint32_t D,
+                           uint32_t numTaps,
+                           const float32_t *pCoeffs,
+                           float32_t *pStateI,
+                           float32_t *pStateQ,
+                           const plp_cfft_mr_instance_f32 *pCfft,
+                           float32_t *pMixer) {
+
+    uint32_t i;
+    double step = fmod((double)fc * D, 1.0);
+
+    /* exp(-j 2 pi fc i) within a block of D samples */
+    for (i = 0; i < D; i++) {
+        double p = 2.0 * ZOOM_FFT_PI * fmod((double)fc * i, 1.0);
+        pMixer[2 * i] = (float32_t)cos(p);
+        pMixer[2 * i + 1] = (float32_t)-sin(p);
+    }
+
+    for (i = 0; i < PLP_ZOOM_FFT_STATE_SIZE(numTaps, D); i++) {
+        pStateI[i] = 0.0f;
+        pStateQ[i] = 0.0f;
+    }
+
+    S->D = D;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pStateI = pStateI;
+    S->pStateQ = pStateQ;
+    S->pMixer = pMixer;
+    S->step[0] = (float32_t)cos(2.0 * ZOOM_FFT_PI * step);
+    S->step[1] = (float32_t)-sin(2.0 * ZOOM_FFT_PI * step);
+    S->phase[0] = 1.0f;
+    S->phase[1] = 0.0f;
+    S->S = pCfft;
+}
+
+/**
+ * @} end of czt group
+ */
@@ -0,0 +1,494 @@
+#!/usr/bin/env python3
+"""
+Generates the kernels of the element-wise basic math functions (sub, scale, negate, offset, shift
+and clip) for all their data types from one parameterized source, such that a change of the loop
+structure applies to every type and ISA variant at once. The glue code, the instance structs and
+the declarations in plp_basic_math.h are written by hand and are not touched.
+
+The kernels are written in place, to src/BasicMathFunctions/<function>/kernels/. Run it after
+changing a template or an operation below, and commit the regenerated kernels:
+
+    python3 src/gen_kernels.py
+    python3 src/gen_kernels.py --check
+    python3 src/gen_kernels.py --unroll 4 --simd-unroll 4 negate offset
+
+--unroll sets the number of samples per iteration of the scalar kernels, --simd-unroll the number
+of SIMD words per iteration of the 8-bit and 16-bit XPULPV2 kernels, both with
+PLP_MATH_LOOPUNROLL. The number of samples per SIMD word follows from the data type. --check
+writes nothing and fails if a kernel in the tree differs from the generated one.
+"""
+
+import argparse
+import os
+import sys
+import textwrap
+
+HERE = os.path.dirname(os.path.realpath(__file__))
+DST = os.path.join(HERE, 'BasicMathFunctions')
+
+WIDTH = 100
+
+LICENSE = """\
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        {title}
+ * Description:  {description}
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""
+
+
+class Type:
+    """Data type of a kernel; lanes is the number of samples per SIMD word (1 without SIMD)"""
+
+    def __init__(self, name, ctype, desc, article, lanes, vtype=None):
+        self.name = name
+        self.ctype = ctype
+        self.desc = desc
+        self.article = article
+        self.lanes = lanes
+        self.vtype = vtype
+
+
+TYPES = {
+    'i8': Type('i8', 'int8_t', '8-bit integer', 'an', 4, 'v4s'),
+    'i16': Type('i16', 'int16_t', '16-bit integer', 'a', 2, 'v2s'),
+    'i32': Type('i32', 'int32_t', '32-bit integer', 'a', 1),
+    'f32': Type('f32', 'float32_t', '32-bit floating-point', 'a', 1),
+}
+
+# short names of the SIMD pointers of the vector arguments
+VPTR = {'pSrc': 'pS', 'pSrcA': 'pA', 'pSrcB': 'pB', 'pDst': 'pD'}
+
+SRC = ('const {t} *', 'pSrc', 'in', 'points to the input vector')
+DSTV = ('{t} *', 'pDst', 'out', 'points to the output vector')
+BLK = ('uint32_t', 'blockSize', 'in', 'number of samples in each vector')
+
+
+class Op:
+    """
+    One element-wise operation. The statements are written for one sample and may use {t} for the
+    C type; the SIMD statements compute one word from the vector pointers of VPTR and may use {n}
+    for the number of lanes. scalar is used in the RV32IM kernels and for floats, xpscalar in the
+    integer XPULPV2 kernels.
+    """
+
+    def __init__(self, name, title, noun, formula, params, scalar, types, simd=None,
+                 simd_decls=(), simd_doc='', xpscalar=None, local=None, plural=False):
+        self.name = name
+        self.group = 'Basic' + name.capitalize()
+        self.title = title
+        self.noun = noun
+        self.formula = formula
+        self.params = params
+        self.scalar = scalar
+        self.xpscalar = xpscalar or scalar
+        self.types = types
+        self.simd = simd
+        self.simd_decls = simd_decls
+        self.simd_doc = simd_doc
+        self.local = local
+        self.plural = plural
+
+
+OPS = [
+    Op('sub', 'Vector Subtraction Kernels', 'subtraction', 'C = A - B',
+       [('const {t} *', 'pSrcA', 'in', 'points to first input vector'),
+        ('const {t} *', 'pSrcB', 'in', 'points to second input vector'), DSTV, BLK],
+       ['*pDst++ = (*pSrcA++) - (*pSrcB++);'], ['i8', 'i16', 'i32', 'f32'],
+       simd=['*pD++ = __SUB{n}(*pA++, *pB++);'],
+       simd_doc='the differences are computed with a single SIMD instruction.', plural=True),
+    Op('scale', 'Vector Scale Kernels', 'scaling', 'C = A * scaleFactor',
+       [SRC, ('{t}', 'scaleFactor', 'in', 'value the input vector is multiplied with'), DSTV, BLK],
+       ['*pDst++ = (*pSrc++) * scaleFactor;'], ['i8', 'i16', 'i32', 'f32'],
+       simd=['x = *pS++;', '*pD++ = __PACK{n}({dotp});'],
+       simd_decls=['{v} s{k} = (v{n}s){{ {lane} }};', '{v} x;'],
+       simd_doc='Each product is computed with a dot product against a vector that holds a single '
+       'non-zero lane, and the results are packed again.'),
+    Op('negate', 'Vector Negate Kernels', 'negation', 'C = -A', [SRC, DSTV, BLK],
+       ['*pDst++ = -(*pSrc++);'], ['i8', 'i16', 'i32', 'f32'],
+       simd=['*pD++ = __SUB{n}(zero, *pS++);'], simd_decls=['{v} zero = (v{n}s){{ {zero} }};'],
+       simd_doc='the negations are computed with a single SIMD instruction.'),
+    Op('offset', 'Vector Offset Kernels', 'offset', 'C = A + offset',
+       [SRC, ('{t}', 'offset', 'in', 'value added to each sample'), DSTV, BLK],
+       ['*pDst++ = (*pSrc++) + offset;'], ['i8', 'i16', 'i32', 'f32'],
+       simd=['*pD++ = __ADD{n}(*pS++, off);'],
+       simd_decls=['{v} off = (v{n}s){{ {offset} }};'],
+       simd_doc='the sums are computed with a single SIMD instruction.'),
+    Op('shift', 'Vector Shift Kernels', 'shift', 'C = A << shiftBits',
+       [SRC, ('int32_t', 'shiftBits', 'in',
+              'number of bits to shift, left if positive, right if negative'), DSTV, BLK],
+       ['*pDst++ = (shiftBits >= 0) ? (*pSrc++) << shiftBits : (*pSrc++) >> -shiftBits;'],
+       ['i8', 'i16', 'i32'],
+       simd=['*pD++ = (shiftBits >= 0) ? __SLL{n}(*pS++, sl) : __SRA{n}(*pS++, sr);'],
+       simd_decls=['{v} sl = (v{n}s){{ {shiftBits} }};', '{v} sr = (v{n}s){{ {-shiftBits} }};'],
+       simd_doc='shifted with a single SIMD instruction. The direction of the shift is the same '
+       'for the whole vector.'),
+    Op('clip', 'Vector Clip Kernels', 'clipping', 'C = min(max(A, low), high)',
+       [SRC, ('{t}', 'low', 'in', 'lower bound of the output'),
+        ('{t}', 'high', 'in', 'upper bound of the output'), DSTV, BLK],
+       ['in = *pSrc++;', '*pDst++ = (in < low) ? low : ((in > high) ? high : in);'],
+       ['i8', 'i16', 'i32', 'f32'],
+       xpscalar=['in = *pSrc++;', '*pDst++ = __MAX(__MIN(in, high), low);'],
+       simd=['*pD++ = __MAX{n}(__MIN{n}(*pS++, hi), lo);'],
+       simd_decls=['{v} lo = (v{n}s){{ {low} }};', '{v} hi = (v{n}s){{ {high} }};'],
+       simd_doc='the clipped values are computed with a single SIMD instruction.',
+       local='{t} in;'),
+]
+
+LANE_WORDS = {2: 'two', 4: 'four'}
+
+
+def log2(n):
+    return n.bit_length() - 1
+
+
+def wrap_brief(text):
+    lines = textwrap.wrap(text, WIDTH, initial_indent='  @brief ',
+                          subsequent_indent=' ' * 9, break_on_hyphens=False)
+    return '\n'.join(lines)
+
+
+def wrap_par(text, width=WIDTH):
+    return '\n'.join(textwrap.wrap(text, width, initial_indent='  ', subsequent_indent='  ',
+                                   break_on_hyphens=False))
+
+
+def param_doc(direction, name, text):
+    head = '  @param[{}]'.format(direction).ljust(17) + name.ljust(10) + ' '
+    lines = textwrap.wrap(text, WIDTH - len(head), break_on_hyphens=False)
+    return '\n'.join([head + lines[0]] + [' ' * 28 + l for l in lines[1:]])
+
+
+def indent(lines, n):
+    return [l if l == '' or l.startswith('#') else ' ' * n + l for l in lines]
+
+
+class Kernel:
+
+    def __init__(self, op, t, variant, unroll, simd_unroll):
+        self.op = op
+        self.t = t
+        self.variant = variant
+        self.unroll = unroll
+        self.simd_unroll = simd_unroll
+        self.isa = 'rv32im' if variant == 's_rv32im' else 'xpulpv2'
+        self.fname = 'plp_{}_{}{}'.format(op.name, t.name, variant)
+
+    def path(self):
+        return os.path.join(DST, self.op.name, 'kernels', self.fname + '.c')
+
+    def fmt(self, s, **kw):
+        return s.format(t=self.t.ctype, **kw)
+
+    # --- documentation
+
+    def brief(self):
+        op, t = self.op, self.t
+        if op.plural:
+            text = 'element-by-element {} of {} vectors'.format(op.noun, t.desc)
+        else:
+            text = '{} of {} {} vector'.format(op.noun, t.article, t.desc)
+        if self.variant == 'p_xpulpv2':
+            text = 'parallel ' + text
+        text = text[0].upper() + text[1:]
+        return wrap_brief('{} kernel for {} extension.'.format(text, self.isa.upper()))
+
+    def description(self):
+        text = '{} {} kernel for {}'.format(self.t.desc, self.op.noun, self.isa.upper())
+        return 'Parallel ' + text if self.variant == 'p_xpulpv2' else text
+
+    def simd_par(self):
+        t, op = self.t, self.op
+        text = 'The samples are packed {} per 32-bit word'.format(LANE_WORDS[t.lanes])
+        if op.simd_doc.startswith('the '):
+            text += ', and ' + op.simd_doc
+        elif op.simd_doc.startswith('Each'):
+            text += '. ' + op.simd_doc
+        else:
+            text += ' and ' + op.simd_doc
+        vecs = [p[1] for p in op.params if p[1] in VPTR]
+        first, others = vecs[0], vecs[1:]
+        align = ('The vectors may have any alignment. The samples before the first word-aligned '
+                 'sample of {0} are computed one by one, such that the SIMD loop reads {0} with '
+                 'aligned words. '.format(first))
+        if len(others) == 1:
+            align += ('{} is accessed with aligned words as well if it has the same offset within '
+                      'a word as {}.'.format(others[0], first))
+        else:
+            align += ('{} are accessed with aligned words as well if they have the same offset '
+                      'within a word as {}.'.format(' and '.join(others), first))
+        return ['', '  @par Exploiting SIMD instructions', wrap_par(text), '',
+                '  @par Alignment', wrap_par(align, WIDTH - 3)]
+
+    def doc(self):
+        lines = ['/**', self.brief()]
+        if self.variant == 'p_xpulpv2':
+            lines.append(param_doc('in', 'args', 'points to the plp_{}_instance_{} struct '
+                                   'initialized by the glue code'.format(self.op.name,
+                                                                         self.t.name)))
+        else:
+            lines += [param_doc(d, n, s) for _, n, d, s in self.op.params]
+        lines.append('  @return        none')
+        if self.variant == 's_xpulpv2' and self.t.lanes > 1:
+            lines += self.simd_par()
+        lines.append(' */')
+        return lines
+
+    def signature(self):
+        head = 'void {}('.format(self.fname)
+        args = [self.fmt(c) + ('' if c.endswith('*') else ' ') + n for c, n, _, _ in self.op.params]
+        lines = [head + args[0] + ',']
+        lines += [' ' * len(head) + a + ',' for a in args[1:-1]]
+        lines.append(' ' * len(head) + args[-1] + ') {')
+        return lines
+
+    # --- loops
+
+    def loop(self, body, comment=None):
+        lines = []
+        if comment:
+            lines.append('/* {} */'.format(comment))
+        lines += body
+        lines += ['', '/* Decrement loop counter */', 'blkCnt--;']
+        if self.isa == 'rv32im':
+            return ['while (blkCnt > 0U) {'] + indent(lines, 4) + ['}']
+        # XPULPV2: the trip count is checked once in front of the loop, such that the do-while
+        # loop maps to a hardware loop without a branch around it
+        return (['if (blkCnt > 0U) {', '    do {'] + indent(lines, 8) +
+                ['    } while (blkCnt > 0U);', '}'])
+
+    def scalar_body(self):
+        use_xp = self.isa == 'xpulpv2' and self.t.name != 'f32'
+        return [self.fmt(s) for s in (self.op.xpscalar if use_xp else self.op.scalar)]
+
+    def scalar_kernel(self):
+        u = self.unroll
+        body = self.scalar_body()
+        lines = []
+        if u > 1:
+            lines += ['#if defined(PLP_MATH_LOOPUNROLL)', '',
+                      '/* Loop unrolling: Compute {} outputs at a time */'.format(u),
+                      'blkCnt = blockSize >> {}U;'.format(log2(u)), '']
+            lines += self.loop(body * u, self.op.formula)
+            lines += ['', '/* Loop unrolling: Compute remaining outputs */',
+                      'blkCnt = blockSize % 0x{:X}U;'.format(u), '',
+                      '#else // PLP_MATH_LOOPUNROLL', '',
+                      '/* Initialize blkCnt with number of samples */', 'blkCnt = blockSize;', '',
+                      '#endif // PLP_MATH_LOOPUNROLL', '']
+        else:
+            lines += ['/* Initialize blkCnt with number of samples */', 'blkCnt = blockSize;', '']
+        lines += self.loop(body, self.op.formula)
+        return lines
+
+    def simd_word(self):
+        n = self.t.lanes
+        lines = []
+        for s in self.op.simd:
+            if '{dotp}' in s:
+                pre = s.split('{dotp}')[0].format(n=n)
+                pad = ' ' * len(pre)
+                dots = ['__DOTP{}(x, s{})'.format(n, k) for k in range(n)]
+                s = pre + (',\n' + pad).join(dots) + ');'
+                lines += s.split('\n')
+            else:
+                lines.append(s.format(n=n))
+        return lines
+
+    def simd_decls(self):
+        t = self.t
+        n = t.lanes
+        v = t.vtype
+        lines = []
+        for d in self.op.simd_decls:
+            if '{k}' in d:
+                for k in range(n):
+                    lane = ', '.join('scaleFactor' if i == k else '0' for i in range(n))
+                    lines.append(d.format(v=v, n=n, k=k, lane=lane))
+                continue
+            fields = {}
+            for key in ('zero', 'offset', 'shiftBits', '-shiftBits', 'low', 'high'):
+                fields[key] = ', '.join(['0' if key == 'zero' else key] * n)
+            lines.append(d.format(v=v, n=n, **fields))
+        return lines
+
+    def simd_kernel(self):
+        t, op = self.t, self.op
+        n, v, u = t.lanes, t.vtype, self.simd_unroll
+        vecs = [p for p in op.params if p[1] in VPTR]
+        first = vecs[0][1]
+        lines = ['uint32_t blkCnt; /* Loop counter */']
+        for c, name, _, _ in vecs:
+            lines.append(('const ' if c.startswith('const') else '') + v + ' *' + VPTR[name] + ';')
+        lines += self.simd_decls()
+        if op.local:
+            lines.append(self.fmt(op.local))
+        tail = self.scalar_body()
+        lines += ['', '/* Compute the samples before the first word-aligned sample of {} */'.format(
+            first), 'blkCnt = plp_align_head({}, sizeof({}), blockSize);'.format(first, t.ctype),
+            'blockSize -= blkCnt;', '']
+        lines += self.loop(tail)
+        lines.append('')
+        for c, name, _, _ in vecs:
+            lines.append('{} = ({}{} *){};'.format(VPTR[name], 'const ' if c.startswith('const')
+                                                   else '', v, name))
+        word = self.simd_word()
+        lines += ['', '#if defined(PLP_MATH_LOOPUNROLL)', '',
+                  '/* Loop unrolling: Compute {} vectors at a time */'.format(u),
+                  'blkCnt = blockSize >> {}U;'.format(log2(n * u)), '']
+        lines += self.loop(word * u, op.formula)
+        lines.append('')
+        if u == 2:
+            lines += ['/* Loop unrolling: Compute remaining vector */',
+                      'if (blockSize & 0x{:X}U) {{'.format(n)]
+            lines += indent(word, 4) + ['}']
+        else:
+            lines += ['/* Loop unrolling: Compute remaining vectors */',
+                      'blkCnt = (blockSize >> {}U) % 0x{:X}U;'.format(log2(n), u), '']
+            lines += self.loop(word)
+        lines += ['', '#else // PLP_MATH_LOOPUNROLL', '',
+                  '/* Initialize blkCnt with number of vectors */',
+                  'blkCnt = blockSize >> {}U;'.format(log2(n)), '']
+        lines += self.loop(word, op.formula)
+        lines += ['', '#endif // PLP_MATH_LOOPUNROLL', '', '/* Compute remaining samples */']
+        for c, name, _, _ in vecs:
+            lines.append('{} = ({}{} *){};'.format(name, 'const ' if c.startswith('const')
+                                                   else '', t.ctype, VPTR[name]))
+        lines += ['blkCnt = blockSize & 0x{:X}U;'.format(n - 1), '']
+        lines += self.loop(tail)
+        return lines
+
+    def parallel_kernel(self):
+        t, op = self.t, self.op
+        inst = 'plp_{}_instance_{}'.format(op.name, t.name)
+        lines = ['{0} *S = ({0} *)args;'.format(inst), 'uint32_t core_id = plp_core_id();',
+                 'uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;']
+        if t.lanes > 1:
+            lines += ['uint32_t start, end;', '',
+                      '/* round the chunks up to whole SIMD words, such that all cores work on '
+                      'aligned data */',
+                      'chunk = (chunk + {0}U) & ~{0}U;'.format(t.lanes - 1),
+                      'start = core_id * chunk;', 'end = start + chunk;']
+        else:
+            lines += ['uint32_t start = core_id * chunk;', 'uint32_t end = start + chunk;']
+        args = []
+        for _, name, _, _ in op.params:
+            if name in VPTR:
+                args.append('S->{} + start'.format(name))
+            elif name == 'blockSize':
+                args.append('end - start')
+            else:
+                args.append('S->' + name)
+        lines += ['', 'if (end > S->blockSize) {', '    end = S->blockSize;', '}', '',
+                  '/* every core processes a contiguous chunk of the samples */',
+                  'if (start < end) {',
+                  '    plp_{}_{}s_xpulpv2({});'.format(op.name, t.name, ', '.join(args)), '}']
+        return lines
+
+    def render(self):
+        op = self.op
+        out = LICENSE.format(title=self.fname + '.c', description=self.description()).split('\n')
+        out += ['#include "plp_math.h"', '', '/**', '  @ingroup {}'.format(op.group), ' */', '']
+        if self.variant != 'p_xpulpv2' and self.t.name == 'i32':
+            out += ['/**', '  @defgroup {}Kernels {}'.format(op.group, op.title), ' */', '']
+        out += ['/**', '  @addtogroup {}Kernels'.format(op.group), '  @{', ' */', '']
+        out += self.doc()
+        out.append('')
+        if self.variant == 'p_xpulpv2':
+            out += ['void {}(void *args) {{'.format(self.fname), '']
+            out += indent(self.parallel_kernel(), 4)
+        else:
+            out += self.signature()
+            out.append('')
+            if self.variant == 's_xpulpv2' and self.t.lanes > 1:
+                out += indent(self.simd_kernel(), 4)
+            else:
+                out.append('    uint32_t blkCnt; /* Loop counter */')
+                if op.local:
+                    out.append('    ' + self.fmt(op.local))
+                out.append('')
+                out += indent(self.scalar_kernel(), 4)
+        out += ['}', '', '/**', '  @}} end of {}Kernels group'.format(op.group), ' */', '']
+        return '\n'.join(out)
+
+
+def kernels(ops, unroll, simd_unroll):
+    for op in ops:
+        for name in op.types:
+            t = TYPES[name]
+            variants = ['s_xpulpv2', 'p_xpulpv2']
+            if name != 'f32':
+                variants.insert(0, 's_rv32im')
+            for variant in variants:
+                yield Kernel(op, t, variant, unroll, simd_unroll)
+
+
+def power_of_two(text):
+    n = int(text)
+    if n < 1 or n & (n - 1):
+        raise argparse.ArgumentTypeError('must be a power of two')
+    return n
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('ops', nargs='*', metavar='function',
+                        help='functions to generate (default: all of ' +
+                        ', '.join(op.name for op in OPS) + ')')
+    parser.add_argument('--unroll', type=power_of_two, default=2,
+                        help='samples per iteration of the scalar kernels (default: 2)')
+    parser.add_argument('--simd-unroll', type=power_of_two, default=2,
+                        help='SIMD words per iteration of the SIMD kernels (default: 2)')
+    parser.add_argument('--check', action='store_true',
+                        help='only compare the kernels in the tree with the generated ones')
+    args = parser.parse_args()
+
+    names = {op.name: op for op in OPS}
+    for name in args.ops:
+        if name not in names:
+            parser.error('unknown function ' + name)
+    ops = [names[n] for n in args.ops] if args.ops else OPS
+
+    differ = []
+    for k in kernels(ops, args.unroll, args.simd_unroll):
+        text = k.render()
+        old = None
+        if os.path.exists(k.path()):
+            with open(k.path()) as f:
+                old = f.read()
+        if old == text:
+            continue
+        differ.append(os.path.relpath(k.path(), os.path.join(HERE, '..')))
+        if not args.check:
+            with open(k.path(), 'w') as f:
+                f.write(text)
+
+    for path in differ:
+        print(('differs: ' if args.check else 'wrote: ') + path)
+    if args.check and differ:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['len']
+    a = samples(inputs['pSrcA'], env['strideA'], n)
+    b = samples(inputs['pSrcB'], env['strideB'], n)
+    dst = inputs['pDst'].value.copy()
+    for k in range(n):
+        dst[k * env['strideDst']] = a[k] + b[k]
+    return dst
+
+
+####################
+# Helper Functions #
+####################
+
+
+def samples(arg, stride, n):
+    conv = float if arg.value.dtype == np.float32 else int
+    return [conv(arg.value[k * stride]) for k in range(n)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # keep the bins 0 and N / 2, double the positive and clear the negative frequencies
+    N = env['len']
+    X = fft([complex(float(x)) for x in inputs['pSrc'].value])
+    X = [X[k] * (1 if k in (0, N // 2) else 2 if k < N // 2 else 0) for k in range(N)]
+    y = [v.conjugate() / N for v in fft([v.conjugate() for v in X])]
+    return np.array([p for v in y for p in (v.real, v.imag)]).astype(np.float32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def fft(x):
+    # radix-2 decimation in time, in double precision
+    n = len(x)
+    if n == 1:
+        return x
+    even = fft(x[0::2])
+    odd = fft(x[1::2])
+    w = [cmath.exp(-2j * math.pi * k / n) * odd[k] for k in range(n // 2)]
+    return [even[k] + w[k] for k in range(n // 2)] + [even[k] - w[k] for k in range(n // 2)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
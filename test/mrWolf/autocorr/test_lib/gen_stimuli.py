@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src = inputs['pSrc'].value
+    N = env['len']
+    if src.dtype == np.float32:
+        x = [float(v) for v in src]
+        res = [sum(x[n] * x[n + l] for n in range(N - l)) for l in range(env['lags'])]
+        return np.array(res).astype(np.float32)
+
+    x = [int(v) for v in src]
+    res = []
+    for l in range(env['lags']):
+        if src.dtype == np.int16:
+            # the products are summed up exactly, and the sum is rounded
+            s = sum(x[n] * x[n + l] for n in range(N - l))
+            res.append((s + (1 << fix_point >> 1)) >> fix_point)
+        else:
+            # every product is shifted right
+            res.append(sum((x[n] * x[n + l]) >> fix_point for n in range(N - l)))
+    return words(res)
+
+
+def words(values):
+    # 64-bit values as pairs of 32-bit words, least significant first
+    return np.array([w for v in values for w in (v & 0xffffffff, (v >> 32) & 0xffffffff)]).astype(
+        np.uint32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
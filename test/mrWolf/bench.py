@@ -2,8 +2,10 @@
 
 import os
 import re
+import sys
 import argparse
-from collections import namedtuple
+import json
+from collections import namedtuple, OrderedDict
 
 
 def main():
@@ -21,6 +23,33 @@ def main():
     parser_cmp.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
     parser_cmp.add_argument('-f', '--function', type=str, help='Regex to only show the specified function')
     parser_cmp.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_cmp.add_argument('-t', '--threshold', type=float, help='Flag runs whose cycles increased by more than THRESHOLD percent, and exit with an error if there are any.')
+
+    parser_sweep = subparsers.add_parser('sweep', help='Show the derived metrics of a benchmark sweep and the best nPE per shape')
+    parser_sweep.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_sweep.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_sweep.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_sweep.add_argument('-O', '--objective', choices=['cycles', 'energy'], default='cycles', help='Mark the number of cores with the fewest cycles or the least energy as best (default: cycles)')
+    parser_sweep.add_argument('-p', '--power-model', type=str, help='JSON file with the power model per device, see POWER_MODELS')
+
+    parser_auto = subparsers.add_parser('autotune', help='Regenerate the cost table of PLP_AUTO from a benchmark sweep')
+    parser_auto.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file (PULP_DSP_BENCH=1) to be read. If unspecified, take the most recent.')
+    parser_auto.add_argument('-d', '--device', type=str, default='riscy', help='Device, for which the table is generated (default: riscy)')
+    parser_auto.add_argument('-O', '--objective', choices=['cycles', 'energy'], default='cycles', help='Choose the number of cores with the fewest cycles or the least energy (default: cycles)')
+    parser_auto.add_argument('-p', '--power-model', type=str, help='JSON file with the power model per device, see POWER_MODELS')
+
+    parser_wcet = subparsers.add_parser('wcet', help='Derive cycle bounds per function and dimension from benchmark runs (e.g. of a PLP_DETERMINISTIC build)')
+    parser_wcet.add_argument('-b', '--bench-file', type=str, nargs='+', help='Benchmark CSV files to be read, e.g. repeated runs with different stimuli. If unspecified, take the most recent.')
+    parser_wcet.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_wcet.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_wcet.add_argument('-m', '--margin', type=float, default=10.0, help='Margin in percent, which is added to the largest measured cycles (default: 10)')
+    parser_wcet.add_argument('-o', '--output', type=str, help='Markdown file to write the bounds to. If unspecified, print them.')
+
+    parser_balance = subparsers.add_parser('balance', help='Show the load balance of the parallel functions (PULP_DSP_BALANCE=1), the most imbalanced first')
+    parser_balance.add_argument('-b', '--balance-file', type=str, help='Balance CSV file to be read. If unspecified, take the most recent.')
+    parser_balance.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_balance.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_balance.add_argument('-m', '--min-imbalance', type=float, default=1.0, help='Only show runs with at least this imbalance (default: 1.0, all runs)')
 
     parser_score = subparsers.add_parser('score', help='compute a socre based on the imporvement of the benchmark')
     parser_score.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
@@ -34,6 +63,14 @@ def main():
         compare(args)
     elif args.command == "score":
         score(args)
+    elif args.command == "sweep":
+        sweep(args)
+    elif args.command == "autotune":
+        autotune(args)
+    elif args.command == "wcet":
+        wcet(args)
+    elif args.command == "balance":
+        balance(args)
 
 
 def view(args):
@@ -76,6 +113,131 @@ def compare(args):
     # print comparison
     print_comparison(new_runs, old_runs)
 
+    # flag regressions
+    if args.threshold is not None:
+        regressions = find_regressions(new_runs, old_runs, args.threshold)
+        for run_new, run_old in regressions:
+            print("REGRESSION: {} {} {}: {} -> {} cycles ({:+.1f}%)".format(
+                run_new.name, run_new.device, run_new.dimension, run_old.cycles, run_new.cycles,
+                relative_change(run_new.cycles, run_old.cycles)))
+        if regressions:
+            sys.exit(1)
+
+
+def find_regressions(new_runs, old_runs, threshold):
+    """ returns the list of (new, old) runs, where the cycles increased by more than threshold % """
+    return [(run_new, run_old) for run_new, run_old in zip(new_runs, old_runs)
+            if relative_change(run_new.cycles, run_old.cycles) > threshold]
+
+
+def relative_change(new, old):
+    """ returns the change from old to new in percent """
+    if old == 0:
+        return 0.0
+    return (new - old) / old * 100
+
+
+def sweep(args):
+    """ Sweep subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+    models = read_power_models(args.power_model)
+    cost = objective_fun(args.objective, models)
+
+    # the number of cores with the fewest cycles or the least energy for every function, device
+    # and shape
+    best = {}
+    for run in runs:
+        key = sweep_key(run)
+        if key not in best or cost(run) < cost(best[key]):
+            best[key] = run
+
+    runs_str = [format_sweep_to_str_list(r, best[sweep_key(r)] is r, models) for r in runs]
+    column_width = tuple(get_column_width(runs_str, c, h) for c, h in enumerate(SWEEP_HEADER))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | {:<%d} | {:<%d} | {:>%d} | {:>%d} | {:>%d} | {:>%d} | {:>%d} | {:>%d} | {:>%d} | {:>%d} | {:<%d} |" % column_width
+    print(hline)
+    print(fmt.format(*SWEEP_HEADER))
+    print(hline)
+    for run_str in runs_str:
+        print(fmt.format(*run_str))
+    print(hline)
+
+
+SWEEP_HEADER = ["function", "device", "dimension", "nPE", "cycles", "cycles/op", "ops/c",
+                "ld_stall/c", "tcdm_cont/c", "energy", "energy/op", "best"]
+N_PE_RE = re.compile(r"(; )?nPE=(\d+)")
+
+
+def run_n_pe(run):
+    """ returns the number of cores of the run, 1 for the single-core versions """
+    n_pe = N_PE_RE.search(run.dimension)
+    return int(n_pe.group(2)) if n_pe else 1
+
+
+def sweep_key(run):
+    """ returns the function, device and dimension without the number of cores """
+    return (run.name, run.device, N_PE_RE.sub("", run.dimension))
+
+
+def format_sweep_to_str_list(run, is_best, models):
+    """ returns a list of 12 strings """
+    run_energy = energy(run, models)
+    return [run.name,
+            run.device,
+            N_PE_RE.sub("", run.dimension),
+            str(run_n_pe(run)),
+            str(run.cycles),
+            format_float(run.cycles / run.ops) if run.ops else "-",
+            format_float(run.mpc),
+            format_float(run.ld_stall / run.cycles),
+            format_float(run.tcdm_cont / run.cycles),
+            format_float(run_energy, 1),
+            format_float(run_energy / run.ops) if run.ops else "-",
+            "*" if is_best else ""]
+
+
+# Energy of a core per cycle while it computes (active) and while it waits at the barrier or is not
+# used by the function (idle), for a cluster of the given number of cores. The default models
+# count the energy in core-cycles of an active core, and assume that a clock-gated idle core needs
+# a tenth of it. Pass measured values of a platform (e.g. in pJ per cycle) with --power-model, as
+# a JSON file of the same structure: {"riscy": {"cores": 8, "active": 1.0, "idle": 0.1}}.
+PowerModel = namedtuple("PowerModel", ["cores", "active", "idle"])
+POWER_MODELS = {
+    "riscy": PowerModel(cores=8, active=1.0, idle=0.1),
+    "ibex": PowerModel(cores=1, active=1.0, idle=0.0),
+}
+
+
+def read_power_models(model_file):
+    """ returns the power model per device, from the given JSON file or the default ones """
+    if model_file is None:
+        return POWER_MODELS
+    with open(model_file, "r") as f:
+        models = json.load(f)
+    return {device: PowerModel(**m) for device, m in models.items()}
+
+
+def energy(run, models):
+    """ returns the energy of the run: the cycles of the active cores plus the idle time of the
+    remaining cores of the cluster """
+    model = models.get(run.device, PowerModel(cores=1, active=1.0, idle=0.0))
+    n_pe = run_n_pe(run)
+    idle_cores = max(model.cores - n_pe, 0)
+    return run.cycles * (n_pe * model.active + idle_cores * model.idle)
+
+
+def objective_fun(objective, models):
+    """ returns the function, which maps a run to the value to minimize """
+    if objective == "energy":
+        return lambda run: energy(run, models)
+    return lambda run: run.cycles
+
 
 def score(args):
     """ score the benchmark files """
@@ -118,9 +280,224 @@ def clamp(x, min_val, max_val):
     return x
 
 
-def get_most_recent_bench_filename():
-    """ search for the most recent bench file in the location of this file, matching bench_*.csv """
-    bench_re = re.compile("^bench_.*\.csv$")
+def wcet(args):
+    """ WCET subcommand """
+    if args.bench_file is None:
+        bench_files = [get_most_recent_bench_filename()]
+    else:
+        bench_files = args.bench_file
+
+    runs = []
+    for bench_file in bench_files:
+        runs += read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    # all measurements of every function, device and dimension
+    cycles = OrderedDict()
+    for run in sorted(runs, key=run_sort_key):
+        cycles.setdefault((run.name, run.device, run.dimension), []).append(run.cycles)
+
+    rows = [list(key) + wcet_bound(c, args.margin) for key, c in cycles.items()]
+    lines = ["Cycle bounds measured with `bench.py wcet` from {}, with a margin of {}%.".format(
+                 ", ".join(os.path.basename(f) for f in bench_files), format_float(args.margin, 1)),
+             "",
+             "The bounds only hold for the measured dimensions and for a library built like the",
+             "measured one, preferably with `PLP_DETERMINISTIC=1`. A spread above 0% means that",
+             "the cycles depend on the data or on the memory contention.",
+             ""]
+    lines += markdown_table(WCET_HEADER, rows)
+
+    if args.output is None:
+        print("\n".join(lines))
+    else:
+        with open(args.output, "w") as f:
+            f.write("\n".join(lines) + "\n")
+        print("wrote {} bounds to {}".format(len(rows), args.output))
+
+
+WCET_HEADER = ["function", "device", "dimension", "runs", "min", "max", "spread", "bound"]
+
+
+def wcet_bound(cycles, margin):
+    """ returns the number of runs, min, max, spread and the bound with the margin as strings """
+    low = min(cycles)
+    high = max(cycles)
+    bound = -(-high * (100 + margin) // 100)
+    return [str(len(cycles)), str(low), str(high),
+            format_float(relative_change(high, low), 1) + "%", str(int(bound))]
+
+
+def balance(args):
+    """ Balance subcommand """
+    if args.balance_file is None:
+        balance_file = get_most_recent_bench_filename("balance")
+    else:
+        balance_file = args.balance_file
+
+    with open(balance_file, "r") as f:
+        lines = iter(f.readlines())
+        header = next(lines).strip().split(",")
+        assert(header == BALANCE_HEADER)
+        runs = [BalanceRun(*line.strip().split(",")) for line in lines]
+    runs = filter_runs(runs, args.function, args.device)
+    runs = [r for r in runs if float(r.imbalance) >= args.min_imbalance]
+
+    # the most imbalanced runs first, these gain the most from a better split of the work
+    rows = [[r.name, r.device, r.dimension, r.cycles, r.wait_cycles,
+             format_float(100 * int(r.wait_cycles) / int(r.cycles) / n_pe_of(r), 1) + "%",
+             format_float(float(r.imbalance), 2)]
+            for r in sorted(runs, key=lambda r: float(r.imbalance), reverse=True)]
+    print("\n".join(markdown_table(BALANCE_TABLE_HEADER, rows)))
+
+
+BALANCE_HEADER = ["name", "device", "dimension", "cycles", "wait_cycles", "imbalance"]
+BalanceRun = namedtuple("BalanceRun", BALANCE_HEADER)
+BALANCE_TABLE_HEADER = ["function", "device", "dimension", "cycles", "wait", "idle", "imbalance"]
+
+
+def n_pe_of(run):
+    """ returns the number of cores of a parallel run, from its dimension, 8 if not given """
+    match = N_PE_RE.search(run.dimension)
+    return int(match.group(2)) if match else 8
+
+
+def markdown_table(header, rows):
+    """ returns the lines of a markdown table, with the numbers aligned to the right """
+    width = [max([len(h)] + [len(r[c]) for r in rows]) for c, h in enumerate(header)]
+    right = [c >= 3 for c in range(len(header))]
+    def line(cells):
+        return "| " + " | ".join(s.rjust(w) if r else s.ljust(w)
+                                 for s, w, r in zip(cells, width, right)) + " |"
+    rule = "|" + "|".join("-" * (w + 1) + ":" if r else "-" * (w + 2)
+                          for w, r in zip(width, right)) + "|"
+    return [line(header), rule] + [line(r) for r in rows]
+
+
+AUTO_TABLE_FILE = os.path.normpath(os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                                                "../../include/plp_auto_table.h"))
+AUTO_N_PE = [2, 4, 8]
+AUTO_NEVER = 0xFFFFFFFF
+AUTO_ENTRY_RE = re.compile(r"^\s*X\((\w+), (\w+), (\w+), (\w+)\)")
+
+
+def autotune(args):
+    """ Autotune subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = [r for r in runs if r.device == args.device]
+    cost = objective_fun(args.objective, read_power_models(args.power_model))
+
+    table = read_auto_table(AUTO_TABLE_FILE)
+    updated = 0
+    for name in table:
+        thresholds = auto_thresholds([r for r in runs if r.name == name], cost)
+        if thresholds is not None:
+            table[name] = thresholds
+            updated += 1
+
+    write_auto_table(AUTO_TABLE_FILE, table)
+    print("updated {} of {} functions in {}".format(updated, len(table), AUTO_TABLE_FILE))
+
+
+def auto_thresholds(runs, cost):
+    """ returns the smallest number of operations from which 2, 4 and 8 cores are used, or None if
+    the sweep contains no run with more than one core """
+    # best number of cores, according to cost, and number of operations for every shape
+    shapes = {}
+    for run in runs:
+        key = sweep_key(run)
+        if key not in shapes or cost(run) < shapes[key][1]:
+            shapes[key] = (run_n_pe(run), cost(run), run.ops)
+    if not any(n_pe > 1 for n_pe, _, _ in shapes.values()):
+        return None
+
+    # use k cores from the smallest size, above which k or more cores are always the fastest
+    shapes = sorted(shapes.values(), key=lambda s: s[2])
+    thresholds = []
+    for k in AUTO_N_PE:
+        threshold = AUTO_NEVER
+        for n_pe, _, ops in reversed(shapes):
+            if n_pe < k:
+                break
+            threshold = ops
+        thresholds.append(max([threshold] + thresholds))
+    return thresholds
+
+
+def read_auto_table(table_file):
+    """ returns an ordered dict, mapping the function name to the list of thresholds """
+    table = OrderedDict()
+    with open(table_file, "r") as f:
+        for line in f:
+            match = AUTO_ENTRY_RE.search(line)
+            if match:
+                table[match.group(1)] = [int(match.group(i), 0) for i in range(2, 5)]
+    return table
+
+
+def write_auto_table(table_file, table):
+    """ writes the cost table of PLP_AUTO """
+    entries = []
+    for name, thresholds in table.items():
+        values = ["0xFFFFFFFF" if t == AUTO_NEVER else str(t) for t in thresholds]
+        entries.append("    X({}, {})".format(name, ", ".join(values)))
+    width = max(len(e) for e in entries)
+    with open(table_file, "w") as f:
+        f.write(AUTO_TABLE_HEADER)
+        f.write("".join(e.ljust(width) + " \\\n" for e in entries[:-1]) + entries[-1])
+        f.write("\n\n#endif // __PLP_AUTO_TABLE_H__\n")
+
+
+AUTO_TABLE_HEADER = """\
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_auto_table.h
+ * Description:  Cost table for choosing the number of cores with PLP_AUTO
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Generated by test/mrWolf/bench.py autotune from a benchmark sweep (PULP_DSP_BENCH=1). For every
+ * function, the table contains the smallest problem size (the number of operations, as n_ops in
+ * the testset) from which 2, 4 and 8 cores are used. 0xFFFFFFFF means never.
+ */
+
+#ifndef __PLP_AUTO_TABLE_H__
+#define __PLP_AUTO_TABLE_H__
+
+#define PLP_AUTO_TABLE(X) \\
+"""
+
+
+def get_most_recent_bench_filename(prefix="bench"):
+    """ search for the most recent bench file in the location of this file, matching bench_*.csv
+    (or <prefix>_*.csv) """
+    bench_re = re.compile("^%s_.*\.csv$" % prefix)
     cwd = os.path.dirname(os.path.realpath(__file__))
     bench_files = [f for f in os.listdir(cwd) if bench_re.search(f)]
     bench_files = sorted(bench_files, reverse=True)
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    num_stages = env['num_stages']
+    coeffs = inputs['pCoeffs'].value
+    state = inputs['pState'].value
+    x = [int(v) for v in inputs['pSrc'].value]
+
+    ctype = result_parameter.ctype
+    if fix_point is None:
+        raise RuntimeError("Only fix-point is implemented")
+    dtype = np.int16 if ctype == "int16_t" else np.int32
+    bits = 16 if ctype == "int16_t" else 32
+
+    # direct form I, one stage after another, starting from the given state
+    for s in range(num_stages):
+        b0, b1, b2, a1, a2 = [int(c) for c in coeffs[5 * s:5 * s + 5]]
+        x1, x2, y1, y2 = [int(v) for v in state[4 * s:4 * s + 4]]
+        y = []
+        for x0 in x:
+            acc = b0 * x0 + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2
+            y0 = q_sat(q_roundnorm(acc, fix_point), bits)
+            x2, x1, y2, y1 = x1, x0, y1, y0
+            y.append(y0)
+        x = y
+
+    return np.array(x, dtype=dtype)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return (a + rounding) >> p
+
+
+def q_sat(x, bits):
+    max_value = (1 << (bits - 1)) - 1
+    min_value = -(1 << (bits - 1))
+    return max(min_value, min(max_value, x))
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    num_stages = env['num_stages']
+    coeffs = inputs['pCoeffs'].value.astype(np.float32)
+    state = inputs['pState'].value.astype(np.float32)
+    x = inputs['pSrc'].value.astype(np.float32)
+
+    if result_parameter.ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # transposed direct form II, one stage after another, starting from the given state
+    for s in range(num_stages):
+        b0, b1, b2, a1, a2 = coeffs[5 * s:5 * s + 5]
+        d1, d2 = state[2 * s:2 * s + 2]
+        y = np.zeros(len(x), dtype=np.float32)
+        for n in range(len(x)):
+            y[n] = b0 * x[n] + d1
+            d1 = b1 * x[n] + a1 * y[n] + d2
+            d2 = b2 * x[n] + a2 * y[n]
+        x = y
+
+    return x
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N, g, t = env['cols'], env['guard'], env['train']
+    is_float = inputs['pSrc'].value.dtype == np.float32
+    x = [int(v) for v in inputs['pSrc'].value]
+    one = 1 if is_float else 1 << fix_point
+    scale = env['scale'] if is_float else int(env['scale'] * one)
+    dst = []
+    for row in range(env['rows']):
+        r = x[row * N:][:N]
+        for n in range(N):
+            # the training cells outside the row are left out
+            cells = [r[k] for k in range(n - g - t, n - g) if k >= 0]
+            cells += [r[k] for k in range(n + g + 1, n + g + t + 1) if k < N]
+            dst.append(int(len(cells) > 0 and r[n] * len(cells) * one > scale * sum(cells)))
+    return np.array(dst).astype(np.uint8)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # Q1.15 input, the output of a len-point transform is scaled down by len (see cfft)
+    bit_shift_dict = {16:11, 32:10, 64: 9, 128: 8, 256: 7, 512: 6, 1024: 5, 2048: 4, 4096: 3}
+
+    if fix_point is None or fix_point == 0:
+        raise RuntimeError("no fixpoint not implemented")
+
+    length = env['len']
+    stride = env['stride']
+    a = inputs['p1'].value.astype(np.int16)
+
+    # the samples between the channels (padding) are not modified
+    result = a.copy()
+    for c in range(env['channels']):
+        ch = a[2 * c * stride:2 * (c * stride + length)].astype(np.float64) / 2**fix_point
+        y = np.fft.fft(ch[0::2] + 1j * ch[1::2]) * 2**bit_shift_dict[length]
+        result[2 * c * stride:2 * (c * stride + length):2] = np.real(y).astype(np.int16)
+        result[2 * c * stride + 1:2 * (c * stride + length):2] = np.imag(y).astype(np.int16)
+
+    return result
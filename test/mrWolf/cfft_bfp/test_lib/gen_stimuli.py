@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = [int(v) for v in inputs['p1'].value]
+    x, exponent = cfft_bfp(x, env['ifft'], env['bit_rev'])
+    if "return_value" in result_parameter.name:
+        return exponent
+    return np.array(x).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def magnitude(v):
+    # v ^ (v >> 15) of the kernel, which is |v| for positive and |v| - 1 for negative values
+    return ~v if v < 0 else v
+
+
+def q15(x):
+    # the Q1.15 twiddle tables are rounded down
+    return min(2**15 - 1, int(math.floor(x * 2**15)))
+
+
+def cfft_bfp(x, ifft, bit_rev):
+    # bit exact model of the block floating point radix-2 decimation in frequency
+    n = len(x) // 2
+    exponent = 0
+    bits = 0
+    for v in x:
+        bits |= magnitude(v)
+    if bits != 0 and bits < 2**12:
+        shift = 0
+        while bits << (shift + 1) < 2**13:
+            shift += 1
+        exponent -= shift
+        bits <<= shift
+        x = [v << shift for v in x]
+
+    span, step = n // 2, 1
+    while span > 0:
+        shift = 0 if bits < 2**13 else (1 if bits < 2**14 else 2)
+        exponent += shift
+        bits = 0
+        for j in range(span):
+            wr = q15(math.cos(2 * math.pi * j * step / n))
+            wi = q15(math.sin(2 * math.pi * j * step / n))
+            wi = -wi if ifft else wi
+            for i in range(j, n, 2 * span):
+                ar, ai = x[2 * i] >> shift, x[2 * i + 1] >> shift
+                br, bi = x[2 * (i + span)] >> shift, x[2 * (i + span) + 1] >> shift
+                dr, di = ar - br, ai - bi
+                x[2 * i], x[2 * i + 1] = ar + br, ai + bi
+                x[2 * (i + span)] = (dr * wr + di * wi) >> 15
+                x[2 * (i + span) + 1] = (di * wr - dr * wi) >> 15
+                for v in x[2 * i:2 * i + 2] + x[2 * (i + span):2 * (i + span) + 2]:
+                    bits |= magnitude(v)
+        span, step = span // 2, step * 2
+
+    if bit_rev:
+        b = n.bit_length() - 1
+        y = list(x)
+        for i in range(n):
+            r = int(format(i, '0{}b'.format(b))[::-1], 2)
+            y[2 * i], y[2 * i + 1] = x[2 * r], x[2 * r + 1]
+        x = y
+
+    if ifft:
+        exponent -= n.bit_length() - 1
+    return x, exponent
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
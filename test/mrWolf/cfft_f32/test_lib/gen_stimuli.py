@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    length = env['len']
+    a = inputs['p1'].value.astype(np.float32)
+    x = a[0::2].astype(np.complex128) + 1j * a[1::2].astype(np.complex128)
+
+    # the inverse transform is scaled by 1/len, like np.fft.ifft
+    if env['ifft']:
+        y = np.fft.ifft(x)
+    else:
+        y = np.fft.fft(x)
+
+    # without bit reversal, the output is in bit reversed order
+    if not env['bit_reverse']:
+        bits = length.bit_length() - 1
+        rev = [int(format(k, '0{}b'.format(bits))[::-1], 2) for k in range(length)]
+        y = y[rev]
+
+    result = np.zeros(2 * length, dtype=np.float32)
+    result[0::2] = np.real(y)
+    result[1::2] = np.imag(y)
+    return result
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len']
+    x = inputs['p1'].value
+    X = dft([complex(float(x[2 * i]), float(x[2 * i + 1])) for i in range(N)], env['ifft'])
+    if result_parameter.ctype == 'float':
+        # the inverse float transform is scaled by 1 / N
+        scale = 1 / N if env['ifft'] else 1
+        return np.array([p * scale for v in X for p in (v.real, v.imag)]).astype(np.float32)
+    # both q16 transforms are scaled by 1 / N
+    return np.array([int(round(p / N)) for v in X for p in (v.real, v.imag)]).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def dft(x, inverse):
+    # direct DFT in double precision, with the twiddles taken from one table
+    n = len(x)
+    sign = 1 if inverse else -1
+    w = [cmath.exp(sign * 2j * math.pi * t / n) for t in range(n)]
+    return [sum(x[i] * w[(i * k) % n] for i in range(n)) for k in range(n)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
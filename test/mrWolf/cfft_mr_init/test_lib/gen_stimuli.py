@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return env['status']
+
+    is_float = result_parameter.ctype == 'float'
+    if env['status']:
+        # the twiddle buffer is not touched
+        return np.zeros(env['len_cmplx'], dtype=np.float32 if is_float else np.int16)
+
+    N = env['len']
+    tw = []
+    for t in range(N):
+        # w = 2 pi t / N in single precision, like the init
+        w = f32(f32(f32(2 * f32(math.pi)) * t) / N)
+        tw += [f32(math.cos(w)), f32(math.sin(w))]
+    if is_float:
+        return np.array(tw).astype(np.float32)
+    tw = [max(-32767, min(32767, round_half_away(x * 32768))) for x in tw]
+    return np.array(tw).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def f32(x):
+    return float(np.float32(x))
+
+
+def round_half_away(x):
+    q = int(math.floor(abs(x) + 0.5))
+    return -q if x < 0 else q
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len']
+    tw = []
+    for k in range(N // 2):
+        # W^k = e^(-j 2 pi k / N) in Q1.31 format
+        phi = -2 * math.pi * k / N
+        tw += [q31(math.cos(phi)), q31(math.sin(phi))]
+    return np.array(tw).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def q31(x):
+    # x * 2^31, rounded half away from zero like llround, and saturated to +-(2^31 - 1)
+    q = int(math.floor(abs(x) * 2**31 + 0.5))
+    return max(1 - 2**31, min(2**31 - 1, -q if x < 0 else q))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
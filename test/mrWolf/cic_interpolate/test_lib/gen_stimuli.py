@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # only the q32 versions have a fixed point
+    is_q32 = fix_point is not None
+    acc_bits = 64 if is_q32 else 32
+    order = env['order']
+    state = load_state(inputs, is_q32)
+    src = [int(v) for v in inputs['pSrc'].value]
+    dst = []
+    for c in range(env['channels']):
+        # delays of the combs followed by the integrators
+        comb = state[c * 2 * order:][:order]
+        integ = state[c * 2 * order + order:][:order]
+        for x in src[c * env['len']:][:env['len']]:
+            acc = x
+            for k in range(order):
+                comb[k], acc = acc, wrap(acc - comb[k], acc_bits)
+            # the input is followed by L - 1 zeros
+            for i in range(env['factor']):
+                for k in range(order):
+                    acc = wrap(acc + integ[k], acc_bits)
+                    integ[k] = acc
+                dst.append(output(acc, env['shift'], is_q32))
+                acc = 0
+        state[c * 2 * order:(c + 1) * 2 * order] = comb + integ
+    if result_parameter.general_name() == 'pState':
+        return store_state(state, is_q32)
+    return np.array(dst).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, bits):
+    # two's complement arithmetic on the given number of bits
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def load_state(inputs, is_q32):
+    value = [int(v) for v in inputs['pState'].value]
+    if not is_q32:
+        return value
+    return [wrap((value[2 * i] & 0xFFFFFFFF) | (value[2 * i + 1] << 32), 64)
+            for i in range(len(value) // 2)]
+
+
+def store_state(state, is_q32):
+    if not is_q32:
+        return np.array(state).astype(np.int32)
+    words = [w for v in state for w in (v & 0xFFFFFFFF, (v >> 32) & 0xFFFFFFFF)]
+    return np.array(words, dtype=np.uint32).astype(np.int32)
+
+
+def output(acc, shift, is_q32):
+    # q32 is rounded and saturated, i32 truncated
+    if not is_q32:
+        return wrap(acc, 32) >> shift
+    y = (acc + ((1 << shift) >> 1)) >> shift
+    return min(2**31 - 1, max(-2**31, y))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
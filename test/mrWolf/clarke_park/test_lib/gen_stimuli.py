@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    result = []
+    for ia, ib, theta in zip(inputs['pIa'].value, inputs['pIb'].value, inputs['pTheta'].value):
+        # Clarke transform, with 1 / sqrt(3) in Q1.31
+        alpha, beta = int(ia), sat(((int(ia) + 2 * int(ib)) * 0x49E69D16) >> 31)
+        s, c = sin_cos(int(theta))
+        # Park transform
+        if result_parameter.general_name() == 'pId':
+            result.append(sat((alpha * c + beta * s) >> 31))
+        else:
+            result.append(sat((beta * c - alpha * s) >> 31))
+    return np.array(result).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def sat(x):
+    return max(-2**31, min(2**31 - 1, x))
+
+
+def wrap(x):
+    return (x + 2**31) % 2**32 - 2**31
+
+
+# sinTable_q32, sin(2 pi k / 512) in Q1.31, rounded and saturated
+SIN_TABLE = [sat(int(round(math.sin(2 * math.pi * k / 512) * 2**31))) for k in range(513)]
+
+
+def interp(index, fract):
+    a, b = SIN_TABLE[index], SIN_TABLE[index + 1]
+    val = ((2**31 - fract) * a) >> 32
+    return wrap((((val << 32) + fract * b) >> 32) << 1)
+
+
+def sin_cos(theta):
+    # plp_sin_cos_q32: one index and weight for the sine and the cosine a quarter period later
+    x = theta % 2**32
+    index = x >> 23
+    fract = (x - (index << 23)) << 8
+    return interp(index, fract), interp((index + 128) & 511, fract)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
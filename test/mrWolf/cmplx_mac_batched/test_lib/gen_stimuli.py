@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        my_type = np.int32
+        my_bits = 32
+    elif result_parameter.ctype == 'int16_t':
+        my_type = np.int16
+        my_bits = 16
+    elif result_parameter.ctype == 'float':
+        my_type = np.float32
+        my_bits = 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    srcA = inputs['srcA'].value
+    srcB = inputs['srcB'].value
+    dst = inputs['dst'].value
+    num_samples = inputs['num_samples'].value
+    num_channels = inputs['num_channels'].value
+    result = np.zeros(2*num_samples, dtype=my_type)
+
+    if result_parameter.ctype == 'float':
+        a = srcA.astype(np.float64).reshape(num_channels, num_samples, 2)
+        b = srcB.astype(np.float64).reshape(num_channels, num_samples, 2)
+        re = np.sum(a[:, :, 0] * b[:, :, 0] - a[:, :, 1] * b[:, :, 1], axis=0)
+        im = np.sum(a[:, :, 0] * b[:, :, 1] + a[:, :, 1] * b[:, :, 0], axis=0)
+        result[0::2] = dst[0::2] + re
+        result[1::2] = dst[1::2] + im
+        return result
+
+    # the exact products are accumulated on the scaled destination and rounded once
+    p = 0 if fix_point is None else fix_point
+    rounding = (1 << (p - 1)) if p > 0 else 0
+    for n in range(num_samples):
+        re = (int(dst[2*n]) << p) + rounding
+        im = (int(dst[2*n+1]) << p) + rounding
+        for k in range(num_channels):
+            i = 2 * (k * num_samples + n)
+            a, b = int(srcA[i]), int(srcA[i+1])
+            c, d = int(srcB[i]), int(srcB[i+1])
+            re += a * c - b * d
+            im += a * d + b * c
+        result[2*n] = q_wrap(re >> p, my_bits)
+        result[2*n+1] = q_wrap(im >> p, my_bits)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_wrap(x, bits=32):
+    return ((x + 2**(bits-1)) % 2**bits) - 2**(bits-1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
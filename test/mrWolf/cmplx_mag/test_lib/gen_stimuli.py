@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 
+import math
 import numpy as np
 
 
@@ -42,25 +43,23 @@ def compute_result(result_parameter, inputs, env, fix_point):
     fix_point: None (if no fixpoint is used) or decimal point
     """
 
-    ctype = inputs['pSrc'].ctype;
-    if ctype == 'int32_t':
-        my_type = np.int32
-    elif ctype == 'int16_t':
-        my_type = np.int16
-    elif ctype == 'int8_t':
-        my_type = np.int8
-    elif ctype == 'float':
-        my_type = np.float32
-    else:
-        raise RuntimeError("Unrecognized result type: %s" % ctype)
-
-    a = inputs['pSrc'].value.astype(my_type)
-    cmplx_a = np.zeros(int(len(a)/2), dtype=np.csingle)
-    for i in range(len(a)>>1):
-        cmplx_a[i] = a[2*i].astype(np.csingle)/(2**(inputs['deciPoint'].value)) + (a[2*i + 1].astype(np.csingle)/(2**(inputs['deciPoint'].value)))*1j
-    result = np.clip((np.absolute(cmplx_a)*(2**(inputs['deciPoint'].value))), np.iinfo(my_type).min, np.iinfo(my_type).max).astype(my_type)
-    return result
-
+    # the magnitude has the format of the input, integer results are rounded and saturated
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'float':
+        src = inputs['pSrc'].value.astype(np.float64)
+        mag = np.sqrt(src[0::2]**2 + src[1::2]**2)
+        return mag.astype(np.float32)
+    my_type = np.int32 if ctype == 'int32_t' else np.int16
+    src = inputs['pSrc'].value
+    mag = np.zeros(len(src) // 2, dtype=my_type)
+    for n in range(len(mag)):
+        # exactly rounded square root of the 64-bit sum of squares
+        s = int(src[2 * n])**2 + int(src[2 * n + 1])**2
+        r = math.isqrt(s)
+        if s - r * r > r:
+            r += 1
+        mag[n] = min(r, np.iinfo(my_type).max)
+    return mag
 
 ######################
 # Fixpoint Functions #
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src = [int(x) if result_parameter.ctype != 'float' else float(x) for x in inputs['pSrc'].value]
+    res = []
+    for re, im in zip(src[0::2], src[1::2]):
+        big, small = max(abs(re), abs(im)), min(abs(re), abs(im))
+        if result_parameter.ctype == 'float':
+            mag = max(0.990351180 * big + 0.196680205 * small,
+                      0.839533687 * big + 0.560962143 * small)
+        elif result_parameter.ctype == 'int16_t':
+            # -32768 is handled like -32767, the coefficients are in Q1.15
+            big, small = big - (big >> 15), small - (small >> 15)
+            est = max(32452 * big + 6445 * small, 27510 * big + 18382 * small)
+            mag = min(0x7FFF, (est + 0x4000) >> 15)
+        else:
+            # the coefficients are in Q0.32 and every product is truncated
+            est0 = ((big * 4253525931) >> 32) + ((small * 844735047) >> 32)
+            est1 = ((big * 3605769728) >> 32) + ((small * 2409314059) >> 32)
+            mag = min(0x7FFFFFFF, max(est0, est1))
+        res.append(mag)
+    dtype = {'float': np.float32, 'int16_t': np.int16, 'int32_t': np.int32}[result_parameter.ctype]
+    return np.array(res).astype(dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    off = env['offset']
+    is_float = inputs['pSrcAIm'].value.dtype == np.float32
+    conv = float if is_float else int
+    a = [conv(v) for v in inputs['srcARe'].value[off:]]
+    b = [conv(v) for v in inputs['pSrcAIm'].value]
+    c = [conv(v) for v in inputs['pSrcBRe'].value]
+    d = [conv(v) for v in inputs['pSrcBIm'].value]
+
+    if result_parameter.general_name() == 'pDstRe':
+        dst = [a[n] * c[n] - b[n] * d[n] for n in range(env['len'])]
+    else:
+        dst = [a[n] * d[n] + b[n] * c[n] for n in range(env['len'])]
+    if is_float:
+        return np.array(dst).astype(np.float32)
+    return np.array([round_q16(v, fix_point) for v in dst]).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, bits):
+    # the sums are rounded once and truncated to the output width
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def round_q16(x, deci_point):
+    rnd = 1 << (deci_point - 1) if deci_point else 0
+    return wrap(wrap(x + rnd, 32) >> deci_point, 16)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        my_type = np.int32
+        my_bits = 32
+    elif result_parameter.ctype == 'int16_t':
+        my_type = np.int16
+        my_bits = 16
+    elif result_parameter.ctype == 'int8_t':
+        my_type = np.int8
+        my_bits = 8
+    elif result_parameter.ctype == 'float':
+        my_type = np.float32
+        my_bits = 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    srcA = inputs['srcA'].value
+    srcB = inputs['srcB'].value
+    num_samples = inputs['num_samples'].value
+    result = np.zeros(2*num_samples, dtype=my_type)
+
+    if result_parameter.ctype == 'float':
+        a = srcA.astype(np.float64)
+        b = srcB.astype(np.float64)
+        result[0::2] = a[0::2] * b[0::2] + a[1::2] * b[1::2]
+        result[1::2] = a[1::2] * b[0::2] - a[0::2] * b[1::2]
+        return result
+
+    # the exact sums of products are rounded once
+    p = 0 if fix_point is None else fix_point
+    rounding = (1 << (p - 1)) if p > 0 else 0
+    for n in range(num_samples):
+        a, b = int(srcA[2*n]), int(srcA[2*n+1])
+        c, d = int(srcB[2*n]), int(srcB[2*n+1])
+        result[2*n] = q_wrap((a * c + b * d + rounding) >> p, my_bits)
+        result[2*n+1] = q_wrap((b * c - a * d + rounding) >> p, my_bits)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_wrap(x, bits=32):
+    return ((x + 2**(bits-1)) % 2**bits) - 2**(bits-1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
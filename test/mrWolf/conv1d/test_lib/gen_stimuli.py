@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    L, Cin, Cout, K = env['L'], env['Cin'], env['Cout'], env['K']
+    is_float = inputs['pSrc'].value.dtype == np.float32
+    conv = float if is_float else int
+    src = [conv(v) for v in inputs['pSrc'].value]
+    kernel = [conv(v) for v in inputs['pKernel'].value]
+    dst = []
+    for x in range(env['outL']):
+        for co in range(Cout):
+            acc = 0
+            for k in range(K):
+                # position in the input sequence, the padding is zero
+                t = x * env['stride'] + k * env['dilation'] - env['padL']
+                if 0 <= t < L:
+                    w = kernel[(co * K + k) * Cin:(co * K + k + 1) * Cin]
+                    acc += sum(s * c for s, c in zip(src[t * Cin:(t + 1) * Cin], w))
+            dst.append(acc)
+    return np.array(dst).astype(np.float32 if is_float else np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
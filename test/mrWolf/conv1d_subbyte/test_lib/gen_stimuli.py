@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    L, Cin, Cout, K = env['L'], env['Cin'], env['Cout'], env['K']
+    b = int(inputs['bits'].value)
+    # bytes of a sample or a tap
+    n_bytes = (Cin * b + 31) // 32 * 4
+    src = inputs['pSrc'].value
+    src = [unpack(src[t * n_bytes:][:n_bytes], b, Cin) for t in range(L)]
+    kernel = inputs['pKernel'].value
+    kernel = [unpack(kernel[k * n_bytes:][:n_bytes], b, Cin) for k in range(Cout * K)]
+    dst = []
+    for x in range(env['outL']):
+        for co in range(Cout):
+            acc = 0
+            for k in range(K):
+                # position in the input sequence, the padding is zero
+                t = x * env['stride'] + k * env['dilation'] - env['padL']
+                if 0 <= t < L:
+                    acc += sum(s * c for s, c in zip(src[t], kernel[co * K + k]))
+            dst.append(acc)
+    return np.array(dst).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def unpack(data, bits, n):
+    # the first n values, starting with the least significant bits of the first byte
+    per_byte = 8 // bits
+    out = []
+    for k in range(n):
+        v = (int(data[k // per_byte]) >> (bits * (k % per_byte))) & ((1 << bits) - 1)
+        out.append(v - (1 << bits) if v >> (bits - 1) else v)
+    return out
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src_h = env['src_h']
+    src_w = env['src_w']
+    k_h = env['k_h']
+    k_w = env['k_w']
+    out_h = env['out_h']
+    out_w = env['out_w']
+
+    if result_parameter.ctype != 'int32_t' or fix_point is not None:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    src = inputs['pSrc'].value.reshape((src_h, env['strideSrc']))[:, :src_w].astype(np.int64)
+    kernel = inputs['pKernel'].value.reshape((k_h, k_w)).astype(np.int64)
+
+    # full 2D convolution, the valid and same outputs are cut out of it
+    full = np.zeros((src_h + k_h - 1, src_w + k_w - 1), dtype=np.int64)
+    for i in range(k_h):
+        for j in range(k_w):
+            full[i:i + src_h, j:j + src_w] += kernel[i, j] * src
+
+    off_y, off_x = (k_h // 2, k_w // 2) if env['padding'] else (k_h - 1, k_w - 1)
+
+    result = np.zeros((max(out_h, 1), env['strideDst']), dtype=np.int32)
+    result[:out_h, :out_w] = full[off_y:off_y + out_h, off_x:off_x + out_w].astype(np.int32)
+    return result.reshape((env['len_dst'], ))
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    img = inputs['pSrc'].value
+    kernel = inputs['pKernel'].value
+    stride = env['stride']
+    pad = env['pad']
+
+    # every channel is convolved with its own kernel, zero outside of the image
+    result = []
+    for y in range(env['out_h']):
+        for x in range(env['out_w']):
+            for c in range(env['C']):
+                s = 0
+                for r in range(env['kH']):
+                    for q in range(env['kW']):
+                        s += (pixel(img, env, y * stride + r - pad, x * stride + q - pad, c) *
+                              int(kernel[(r * env['kW'] + q) * env['C'] + c]))
+                result.append(s)
+    return np.array(result, dtype=np.int32)
+
+
+###################
+# Image Functions #
+###################
+
+
+def pixel(img, env, y, x, c):
+    # zero outside of the image, the image is stored channel last
+    if y < 0 or y >= env['H'] or x < 0 or x >= env['W']:
+        return 0
+    return int(img[(y * env['W'] + x) * env['C'] + c])
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
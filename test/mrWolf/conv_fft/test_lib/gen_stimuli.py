@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 0
+
+    ctype = result_parameter.ctype
+    if ctype == 'int32_t':
+        a = inputs['srcA'].value.astype(np.int64)
+        b = inputs['srcB'].value.astype(np.int64)
+        result = np.convolve(a, b, mode='full')
+        if fix_point is not None and fix_point > 0:
+            result = (result + (1 << (fix_point - 1))) >> fix_point
+        return result.astype(np.int32)
+    elif ctype == 'float':
+        a = inputs['srcA'].value.astype(np.float64)
+        b = inputs['srcB'].value.astype(np.float64)
+        return np.convolve(a, b, mode='full').astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src = inputs['pSrc'].value
+    is_float = src.dtype == np.float32
+    conv = float if is_float else int
+    x = [conv(v) for v in src]
+    k = [conv(v) for v in inputs['kernel'].value]
+    kH, W = env['kH'], env['src_w']
+    dst = inputs['pDst'].value.copy()
+    # the kernel is flipped, like in plp_conv2d with PLP_CONV2D_VALID
+    for i in range(env['extra_rows'] + 1):
+        for j in range(W - 2):
+            window = [x[(i + a) * env['stride_src'] + j + b] for a in range(kH) for b in range(3)]
+            dst[i * env['stride_dst'] + j] = sum(p * q for p, q in zip(window, reversed(k)))
+    return dst
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
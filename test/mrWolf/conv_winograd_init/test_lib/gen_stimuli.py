@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    kernel = inputs['pKernel'].value
+    is_float = kernel.dtype == np.float32
+    c = winograd_coeffs(kernel, env['kH'], is_float)
+    return np.array(c).astype(np.float32 if is_float else np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+def winograd_coeffs(kernel, kH, is_float):
+    """ G g G^T of the flipped kernel g, G scaled by 2 for integers """
+    h = 0.5 if is_float else 1
+    one = 1 if is_float else 2
+    G = [[one, 0, 0], [h, h, h], [h, -h, h], [0, 0, one]]
+    k = [float(v) if is_float else int(v) for v in kernel]
+    flipped = [[k[(kH - 1 - a) * 3 + 2 - b] for b in range(3)] for a in range(kH)]
+    if kH == 1:
+        return [sum(G[r][c] * flipped[0][c] for c in range(3)) for r in range(4)]
+    t = [[sum(G[r][a] * flipped[a][c] for a in range(3)) for c in range(3)] for r in range(4)]
+    return [sum(t[r][c] * G[q][c] for c in range(3)) for r in range(4) for q in range(4)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
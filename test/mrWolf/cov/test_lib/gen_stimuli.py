@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 0
+
+    M, N = env['M'], env['N']
+    x = [float(v) for v in inputs['pSrc'].value]
+    rows = [x[m * N:(m + 1) * N] for m in range(M)]
+    rows = [[v - sum(r) / N for v in r] for r in rows]
+    dst = [sum(p * q for p, q in zip(rows[m], rows[o])) / (N - 1)
+           for m in range(M) for o in range(M)]
+    return np.array(dst).astype(np.float32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = to_complex(inputs['pSrc'].value)
+    return to_array(czt(x, env['f0'], env['df'], env['M']))
+
+
+####################
+# Helper Functions #
+####################
+
+
+def czt(x, f0, df, m):
+    # direct evaluation of the spectrum at f0 + k df in double precision
+    n = len(x)
+    w = [f0 + k * df for k in range(m)]
+    return [sum(x[i] * cmath.exp(-2j * math.pi * wk * i) for i in range(n)) for wk in w]
+
+
+def to_complex(a):
+    return [complex(float(a[2 * i]), float(a[2 * i + 1])) for i in range(len(a) // 2)]
+
+
+def to_array(c):
+    return np.array([p for v in c for p in (v.real, v.imag)]).astype(np.float32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return env['status']
+
+    n, m, l = env['N'], env['M'], env['L']
+    if env['status']:
+        # the buffer is not touched
+        return np.zeros(2 * (n + m + l), dtype=np.float32)
+
+    f0, df = float(env['f0']), float(env['df'])
+    pre = [chirp(t, 2 * f0, df).conjugate() for t in range(n)]
+    post = [chirp(t, 0, df).conjugate() for t in range(m)]
+    h = [0j] * l
+    for t in range(m):
+        h[t] = chirp(t, 0, df)
+    for t in range(1, n):
+        h[l - t] = chirp(t, 0, df)
+    spec = [sum(h[i] * cmath.exp(-2j * math.pi * i * k / l) for i in range(l)) for k in range(l)]
+    return to_array(pre + post + spec)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def chirp(t, a, b):
+    # exp(j pi (a t + b t^2))
+    return cmath.exp(1j * math.pi * math.fmod(a * t + b * t * t, 2.0))
+
+
+def to_array(c):
+    return np.array([p for v in c for p in (v.real, v.imag)]).astype(np.float32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    length = env['len']
+    a = inputs['pSrc'].value.astype(np.float64)
+    n = np.arange(length)
+    k = n[:, None]
+    result = np.dot(np.cos(np.pi / length * (n + 0.5) * k), a)
+    return result.astype(np.float32)
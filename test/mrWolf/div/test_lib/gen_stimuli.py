@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a, b = inputs['pSrcA'].value, inputs['pSrcB'].value
+    bits = 16 if a.dtype == np.int16 else 32
+    dst = [div_round(int(x) << fix_point, int(y), bits) for x, y in zip(a, b)]
+    return np.array(dst).astype(a.dtype)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def div_round(a, b, bits):
+    """ a / b rounded to nearest with ties away from zero, saturated to bits """
+    lo, hi = -(1 << (bits - 1)), (1 << (bits - 1)) - 1
+    if b == 0:
+        return 0 if a == 0 else hi if a > 0 else lo
+    q = (2 * abs(a) + abs(b)) // (2 * abs(b))
+    q = q if (a < 0) == (b < 0) else -q
+    return max(lo, min(hi, q))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['len']
+    ternary = len(inputs['pSrcA'].value) > (n + 31) // 32
+    a = values(inputs['pSrcA'].value, n, ternary)
+    b = values(inputs['pSrcB'].value, n, ternary)
+    return np.array([sum(x * y for x, y in zip(a, b))]).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def values(words, n, ternary):
+    # a set sign bit is -1, a cleared nonzero bit of a ternary value is 0
+    out = []
+    for k in range(n):
+        if ternary:
+            nz, sign = int(words[2 * (k // 32)]), int(words[2 * (k // 32) + 1])
+        else:
+            nz, sign = 0xFFFFFFFF, int(words[k // 32])
+        bit = k % 32
+        out.append(0 if not (nz >> bit) & 1 else -1 if (sign >> bit) & 1 else 1)
+    return out
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    b = int(inputs['bits'].value)
+    a = unpack(inputs['pSrcA'].value, b, env['len'])
+    c = unpack(inputs['pSrcB'].value, b, env['len'])
+    return np.array([sum(x * y for x, y in zip(a, c))]).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def unpack(data, bits, n):
+    # the first n values, starting with the least significant bits of the first byte
+    per_byte = 8 // bits
+    out = []
+    for k in range(n):
+        v = (int(data[k // per_byte]) >> (bits * (k % per_byte))) & ((1 << bits) - 1)
+        out.append(v - (1 << bits) if v >> (bits - 1) else v)
+    return out
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+import numpy as np
+import struct
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'float16_t':
+        return np.array([f32_to_f16(x) for x in inputs['pSrc'].value], dtype=np.uint16)
+    if result_parameter.ctype == 'bfloat16_t':
+        return np.array([f32_to_bf16(x) for x in inputs['pSrc'].value], dtype=np.uint16)
+
+    my_type, my_bits = {'int8_t': (np.int8, 8), 'int16_t': (np.int16, 16),
+                        'int32_t': (np.int32, 32)}[result_parameter.ctype]
+
+    # scale, round half away from zero and saturate to the width of the output
+    a = inputs['pSrc'].value.astype(np.float32) * np.float32(2**fix_point)
+    return np.array([q_sat_bits(int(np.trunc(x + (0.5 if x >= 0 else -0.5))), my_bits) for x in a],
+                    dtype=my_type)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat_bits(x, bits=32):
+    return max(-2**(bits-1), min(2**(bits-1) - 1, x))
+
+
+##########################
+# Half-Precision Helpers #
+##########################
+
+
+def f32_to_f16(x):
+    # round to the nearest even value, values beyond the half-precision range become infinity
+    x = float(x)
+    if abs(x) >= 65520.0:
+        return 0xfc00 if x < 0 else 0x7c00
+    return struct.unpack('<H', struct.pack('<e', x))[0]
+
+
+def f32_to_bf16(x):
+    # round the upper half of the single-precision value to the nearest even value
+    u = struct.unpack('<I', struct.pack('<f', float(x)))[0]
+    return ((u + 0x7fff + ((u >> 16) & 1)) >> 16) & 0xffff
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -5,7 +5,7 @@
 #include "cluster.h"
 #include "data_signal.h"
 #include "twiddle_factors.h"
-#include "bit_reverse.h"
+#include "plp_common_tables.h"
 
 static int cores_events;
 
@@ -19,7 +19,9 @@ static void do_bench_0(rt_perf_t *perf, int events)
   S.FFTLength = FFT_LEN;
   S.bitReverseFlag = 1;
   S.pTwiddleFactors = (float32_t *) twiddle_factors;
-  S.pBitReverseLUT = bit_rev_radix2_LUT;
+  S.pBitRevTable = plpBitRevIndexTable_rfft_2048;
+  S.bitRevLength = PLPBITREVINDEXTABLE_RFFT_2048_TABLE_LENGTH;
+  S.algorithm = PLP_RFFT_RADIX2;
 
 
   // Activate specified events
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    rows, cols, stride = env['rows'], env['cols'], env['stride']
+    a = [float(v) for v in inputs['p1'].value]
+    is_float = result_parameter.ctype == 'float'
+    one = 1.0 if is_float else 32768.0
+    x = [[complex(a[2 * (r * stride + c)], a[2 * (r * stride + c) + 1]) / one for c in range(cols)]
+         for r in range(rows)]
+
+    # rows, then columns
+    inverse = env.get('ifft', 0)
+    x = [transform(row, inverse) for row in x]
+    x = [list(col) for col in zip(*[transform(list(col), inverse) for col in zip(*x)])]
+
+    # the q16 transform scales by 1 / N in both dimensions, like plp_cfft_q16
+    if not is_float:
+        x = [[v / (rows * cols) for v in row] for row in x]
+
+    # without bit reversal, the rows and the columns are in bit reversed order
+    if not env['bit_reverse']:
+        x = [[x[bit_reverse(r, rows)][bit_reverse(c, cols)] for c in range(cols)]
+             for r in range(rows)]
+
+    res = list(a)
+    for r in range(rows):
+        for c in range(cols):
+            res[2 * (r * stride + c)] = x[r][c].real * one
+            res[2 * (r * stride + c) + 1] = x[r][c].imag * one
+    if is_float:
+        return np.array(res).astype(np.float32)
+    return np.array([int(round(v)) for v in res]).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def fft(x):
+    # radix-2 decimation in time, in double precision
+    n = len(x)
+    if n == 1:
+        return x
+    even = fft(x[0::2])
+    odd = fft(x[1::2])
+    w = [cmath.exp(-2j * math.pi * k / n) * odd[k] for k in range(n // 2)]
+    return [even[k] + w[k] for k in range(n // 2)] + [even[k] - w[k] for k in range(n // 2)]
+
+
+def transform(x, inverse):
+    # the inverse transform is scaled by 1 / N
+    if not inverse:
+        return fft(x)
+    return [v.conjugate() / len(x) for v in fft([v.conjugate() for v in x])]
+
+
+def bit_reverse(k, n):
+    bits = n.bit_length() - 1
+    return int(format(k, '0{}b'.format(bits))[::-1], 2)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['cols']
+    x = [int(v) for v in inputs['pSrc'].value]
+    dst = []
+    for row in range(env['rows']):
+        r = x[row * N:][:N]
+        peaks = [0] * N
+        last = -1
+        for n in range(1, N - 1):
+            if r[n] > env['threshold'] and r[n] > r[n - 1] and r[n] >= r[n + 1]:
+                if last < 0 or n - last >= env['min_dist']:
+                    peaks[n], last = 1, n
+                elif r[n] > r[last]:
+                    # the higher peak replaces the last one
+                    peaks[last], peaks[n], last = 0, 1, n
+        dst += peaks
+    return np.array(dst).astype(np.uint8)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
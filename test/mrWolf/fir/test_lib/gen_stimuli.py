@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    num_taps = env['num_taps']
+    block_size = env['len']
+
+    # The first num_taps - 1 samples of the state are the history of the previous blocks. The
+    # coefficients are stored in time-reversed order.
+    coeffs = inputs['pCoeffs'].value
+    x = np.concatenate((inputs['pState'].value[:num_taps - 1], inputs['pSrc'].value))
+
+    ctype = result_parameter.ctype
+    if fix_point is not None:
+        dtype = np.int8 if ctype == "int8_t" else np.int16 if ctype == "int16_t" else np.int32
+        result = np.zeros(block_size, dtype=dtype)
+        for n in range(block_size):
+            s = 0
+            for k in range(num_taps):
+                if ctype == 'int32_t':
+                    s = q_add(s, q_roundnorm(int(coeffs[k]) * int(x[n + k]), fix_point))
+                else:
+                    s = q_add(s, int(coeffs[k]) * int(x[n + k]))
+            if ctype != 'int32_t':
+                s = q_roundnorm(s, fix_point)
+            result[n] = dtype(q_trunc(s, ctype))
+    elif ctype == 'float':
+        result = np.zeros(block_size, dtype=np.float32)
+        for n in range(block_size):
+            s = np.float32(0)
+            for k in range(num_taps):
+                s = np.float32(s + np.float32(coeffs[k]) * np.float32(x[n + k]))
+            result[n] = s
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
+
+
+def q_trunc(x, ctype):
+    bits = 8 if ctype == "int8_t" else 16 if ctype == "int16_t" else 32
+    x = x & ((1 << bits) - 1)
+    return x - (1 << bits) if x >= (1 << (bits - 1)) else x
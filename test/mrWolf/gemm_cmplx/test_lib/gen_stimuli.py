@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    alpha = complex(*[float(v) for v in inputs['pAlpha'].value])
+    beta = complex(*[float(v) for v in inputs['pBeta'].value])
+    M, N, O = env['M'], env['N'], env['O']
+    a = matrix(inputs['pSrcA'].value, env['strideA'], True)
+    b = matrix(inputs['pSrcB'].value, env['strideB'], True)
+    dst = inputs['pDstC'].value.copy()
+    for m in range(M):
+        for o in range(O):
+            acc = sum(op(a, env['transA'], m, n) * op(b, env['transB'], n, o) for n in range(N))
+            k = m * env['strideC'] + o
+            if beta != 0:
+                acc = alpha * acc + beta * complex(float(dst[2 * k]), float(dst[2 * k + 1]))
+            else:
+                acc = alpha * acc
+            dst[2 * k:2 * k + 2] = [acc.real, acc.imag]
+    return dst
+
+
+####################
+# Helper Functions #
+####################
+
+
+def matrix(values, stride, cmplx):
+    """ returns a function which reads the element (row, col) of the stored matrix """
+    if cmplx:
+        return lambda r, c: complex(float(values[2 * (r * stride + c)]),
+                                    float(values[2 * (r * stride + c) + 1]))
+    return lambda r, c: float(values[r * stride + c])
+
+
+def op(x, trans, r, c):
+    """ element (r, c) of op(X): X, its transpose or its conjugate transpose """
+    if trans == 0:
+        return x(r, c)
+    if trans == 1:
+        return x(c, r)
+    return x(c, r).conjugate()
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    coeffs = inputs['pCoeffs'].value
+    src = inputs['pSrc'].value
+    dst = []
+    for k in range(env['num_bins']):
+        c = coeffs[2 * k]
+        s = coeffs[2 * k + 1]
+        if result_parameter.ctype == 'float':
+            dst += goertzel_f32(float(c), float(s), src)
+        else:
+            dst += goertzel_q16(int(c), int(s), src)
+    return np.array(dst).astype(np.float32 if result_parameter.ctype == 'float' else np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def f32(x):
+    return float(np.float32(x))
+
+
+def goertzel_q16(c, s, src):
+    # the products with the Q1.30 coefficients are rounded, 2 c is applied by the shift by 29
+    s1 = 0
+    s2 = 0
+    for x in src:
+        s1, s2 = int(x) + ((c * s1 + (1 << 28)) >> 29) - s2, s1
+    return [((c * s1 + (1 << 29)) >> 30) - s2, (s * s1 + (1 << 29)) >> 30]
+
+
+def goertzel_f32(c, s, src):
+    s1 = 0.0
+    s2 = 0.0
+    for x in src:
+        s1, s2 = f32(f32(float(x) + f32(2 * c * s1)) - s2), s1
+    return [f32(f32(c * s1) - s2), f32(s * s1)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    coeffs = []
+    for f in inputs['pFreqs'].value:
+        # w = 2 pi f in single precision, like the init
+        w = f32(f32(2 * f32(math.pi)) * float(f))
+        coeffs += [f32(math.cos(w)), f32(math.sin(w))]
+    if result_parameter.ctype == 'float':
+        return np.array(coeffs).astype(np.float32)
+    return np.array([q30(x) for x in coeffs]).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def f32(x):
+    return float(np.float32(x))
+
+
+def q30(x):
+    # x * 2^30, rounded half away from zero like lroundf, and saturated to +-1
+    q = int(math.floor(abs(x) * 2**30 + 0.5))
+    return max(-2**30, min(2**30, -q if x < 0 else q))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
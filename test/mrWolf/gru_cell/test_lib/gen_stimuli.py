@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    I, H = env['I'], env['H']
+    N = I + H
+    fb = env['frac_bits']
+    shift = inputs['shift'].value
+    is_q16 = inputs['pSrcX'].value.dtype == np.int16
+    x = [int(v) for v in inputs['pSrcX'].value]
+    h = [int(v) for v in inputs['pSrcH'].value]
+    w = [int(v) for v in inputs['pWeights'].value]
+    b = [int(v) for v in inputs['pBias'].value]
+
+
+    def dot(row, v):
+        if not is_q16:
+            # the 8-bit products are summed exactly and rounded once
+            return sum(a * c for a, c in zip(row, v))
+        # the 16-bit products are rounded pairwise, an odd last product on its own
+        rnd = 1 << (shift - 1) if shift else 0
+        return sum((sum(a * c for a, c in zip(row[n:n + 2], v[n:n + 2])) + rnd) >> shift
+                   for n in range(0, len(v), 2))
+
+
+    def preact(g, j):
+        # the sums over the input and over the hidden state of row j of gate g
+        row = w[(g * H + j) * N:][:N]
+        sx, sh = dot(row[:I], x), dot(row[I:], h)
+        if is_q16:
+            return sx, sh
+        return sx, sh, roundnorm(sx + sh, shift)
+
+
+    dst_h = []
+    for j in range(H):
+        r, z, n = preact(0, j), preact(1, j), preact(2, j)
+        if is_q16:
+            s_r, s_z, s_x, s_h = r[0] + r[1], z[0] + z[1], n[0], n[1]
+        else:
+            s_r, s_z, s_x, s_h = r[2], z[2], roundnorm(n[0], shift), roundnorm(n[1], shift)
+        gr = sigmoid(clip(s_r + b[j], 15), fb)
+        gz = sigmoid(clip(s_z + b[H + j], 15), fb)
+        s_h = clip(s_h + b[3 * H + j], 15)
+        gn = tanh(clip(s_x + b[2 * H + j] + roundnorm(gr * s_h, 15), 15), fb)
+        if is_q16:
+            dst_h.append(clip(gn + roundnorm(gz * (h[j] - gn), 15), 15))
+        else:
+            dst_h.append(clip(roundnorm(gn + roundnorm(gz * (h[j] * 256 - gn), 15), 8), 7))
+    return np.array(dst_h).astype(np.int16 if is_q16 else np.int8)
+
+
+####################
+# Helper Functions #
+####################
+
+# tanhTable_q16, tanh(x) for x in [0, 8] in Q1.15
+TANH_TABLE = [min(0x7FFF, int(math.floor(math.tanh(n / 32) * 32768 + 0.5)))
+              for n in range(257)]
+
+
+def roundnorm(x, bits):
+    return (x + (1 << (bits - 1))) >> bits if bits > 0 else x
+
+
+def clip(x, bits):
+    # saturated to a (bits + 1)-bit signed value
+    return max(-(1 << bits), min((1 << bits) - 1, x))
+
+
+def tanh_abs(fr):
+    # the table interpolation of plp_tanh_q16, with fr = |x| in Q16.16
+    if fr >= 8 << 16:
+        return 0x7FFF
+    a, b = TANH_TABLE[fr >> 11], TANH_TABLE[(fr >> 11) + 1]
+    return a + (((b - a) * (fr & 0x7FF)) >> 11)
+
+
+def tanh(x, frac_bits):
+    val = tanh_abs(abs(x) << (16 - frac_bits))
+    return -val if x < 0 else val
+
+
+def sigmoid(x, frac_bits):
+    # (1 + tanh(x / 2)) / 2, like plp_sigmoid_q16
+    val = tanh_abs(abs(x) << (15 - frac_bits))
+    return (0x8000 - val) >> 1 if x < 0 else (0x8000 + val) >> 1
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
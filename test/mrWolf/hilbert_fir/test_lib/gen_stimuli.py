@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n_coeffs = env['num_coeffs']
+    half = env['len'] // 2
+    coeffs = [int(x) for x in inputs['pCoeffs'].value]
+    state = [int(x) for x in inputs['pState'].value]
+    src = [int(x) for x in inputs['pSrc'].value]
+
+    # the even and the odd samples are filtered separately with the nonzero coefficients
+    lines = [state[p * env['len_phase']:][:n_coeffs - 1] + src[p::2] for p in range(2)]
+
+    if result_parameter.general_name() == 'pState':
+        # the last n_coeffs - 1 samples of both phases are kept, the new samples stay behind them
+        kept = [line[half:half + n_coeffs - 1] + line[n_coeffs - 1:] for line in lines]
+        return np.array(kept[0] + kept[1]).astype(np.int16)
+
+    dst = []
+    for n in range(half):
+        for line in lines:
+            acc = wrap(sum(c * x for c, x in zip(coeffs, line[n:n + n_coeffs])), 32)
+            dst.append(wrap((acc + (1 << (fix_point - 1))) >> fix_point, 16))
+    return np.array(dst).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, bits):
+    # the accumulator wraps around and the output is truncated
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # integer bins have a width of 1 << binShift (passed as binWidth), floating point bins are
+    # found by multiplying with the inverse of the width, like the library
+    x = inputs['pSrc'].value
+    n_bins = env['nBins']
+    if inputs['pSrc'].ctype == 'float':
+        pos = (x.astype(np.float32) - np.float32(inputs['minValue'].value)) * \
+            (np.float32(1) / np.float32(inputs['binWidth'].value))
+        bins = np.where(pos < 0, 0, np.where(pos >= n_bins - 1, n_bins - 1, pos)).astype(np.int64)
+    else:
+        bins = (x.astype(np.int64) - inputs['minValue'].value) >> inputs['binWidth'].value
+        bins = np.clip(bins, 0, n_bins - 1)
+    return np.bincount(bins, minlength=n_bins).astype(np.uint32)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
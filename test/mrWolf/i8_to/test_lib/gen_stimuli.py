@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    my_type, my_bits = {'int8_t': (np.int8, 8), 'int16_t': (np.int16, 16),
+                        'int32_t': (np.int32, 32)}[result_parameter.ctype]
+
+    a = inputs['pSrc'].value.astype(np.int64)
+    s = int(inputs['shift'].value)
+
+    if my_bits > 8:
+        # widening: shift left into the wider type
+        return (a << s).astype(my_type)
+    # narrowing: arithmetic shift right and saturate to the narrower type
+    return np.array([q_sat_bits(int(x) >> s, my_bits) for x in a], dtype=my_type)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat_bits(x, bits=32):
+    return max(-2**(bits-1), min(2**(bits-1) - 1, x))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.general_name() == 'buf' and not env['inplace']:
+        return inputs['buf'].value.copy()
+    x = inputs['buf' if env['inplace'] else 'src'].value
+    is_float = x.dtype == np.float32
+    x = [float(v) if is_float else int(v) for v in x]
+
+    M, N = env['M'], env['N']
+    y = list(x)
+    for m in range(M):
+        for n in range(N):
+            # the sum of all samples above and to the left, including the sample itself
+            left = y[m * N + n - 1] if n else 0
+            up = y[(m - 1) * N + n] if m else 0
+            diag = y[(m - 1) * N + n - 1] if m and n else 0
+            y[m * N + n] = x[m * N + n] + left + up - diag
+
+    if is_float:
+        return np.array(y).astype(np.float32)
+    return np.array([wrap(v, 32) for v in y]).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, bits):
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
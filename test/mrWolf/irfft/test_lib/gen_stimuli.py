@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len']
+    bins = [float(v) for v in inputs['src'].value]
+    if result_parameter.general_name() == 'buf' and not env['inplace']:
+        return np.array(bins).astype(np.float32)
+
+    # extend the conjugate symmetric spectrum and transform it back, scaled by 1 / N
+    X = [complex(bins[2 * k], bins[2 * k + 1]) for k in range(N // 2 + 1)]
+    X = X + [X[N - k].conjugate() for k in range(N // 2 + 1, N)]
+    x = [v.conjugate().real / N for v in fft([v.conjugate() for v in X])]
+    if result_parameter.general_name() == 'buf':
+        x = x + bins[N:]
+    return np.array(x).astype(np.float32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def fft(x):
+    # radix-2 decimation in time, in double precision
+    n = len(x)
+    if n == 1:
+        return x
+    even = fft(x[0::2])
+    odd = fft(x[1::2])
+    w = [cmath.exp(-2j * math.pi * k / n) * odd[k] for k in range(n // 2)]
+    return [even[k] + w[k] for k in range(n // 2)] + [even[k] - w[k] for k in range(n // 2)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['n']
+    f = to_mat(inputs['pF'].value, n, n)
+    if result_parameter.general_name() == 'pX':
+        # x = F x
+        return flat(trans(mul(f, to_mat(inputs['pX'].value, n, 1))))
+
+    # P = F P F^T + Q, the upper triangle is mirrored
+    p = mul(mul(f, to_mat(inputs['pP'].value, n, n)), trans(f))
+    q = to_mat(inputs['pQ'].value, n, n)
+    return flat([[p[min(i, j)][max(i, j)] + q[min(i, j)][max(i, j)] for j in range(n)]
+                 for i in range(n)])
+
+
+####################
+# Helper Functions #
+####################
+
+
+def to_mat(a, rows, cols):
+    return [[float(a[i * cols + j]) for j in range(cols)] for i in range(rows)]
+
+
+def mul(a, b):
+    cols = range(len(b[0]))
+    return [[sum(a_ik * b_k[j] for a_ik, b_k in zip(a_i, b)) for j in cols] for a_i in a]
+
+
+def trans(a):
+    return [list(col) for col in zip(*a)]
+
+
+def flat(mat):
+    return np.array([v for row in mat for v in row]).astype(np.float32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
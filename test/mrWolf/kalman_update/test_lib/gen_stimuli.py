@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return env['singular']
+
+    n, m = env['n'], env['m']
+    x = to_mat(inputs['pX'].value, n, 1)
+    p = to_mat(inputs['pP'].value, n, n)
+    if env['singular']:
+        # the state and covariance are not touched
+        return flat(trans(x)) if result_parameter.general_name() == 'pX' else flat(p)
+
+    h = to_mat(inputs['pH'].value, m, n)
+    pht = mul(p, trans(h))
+    s = mul(h, pht)
+    r = to_mat(inputs['pR'].value, m, m)
+    s = [[s[i][j] + r[i][j] for j in range(m)] for i in range(m)]
+    # K = P H^T S^-1, as the solution of S K^T = (P H^T)^T
+    k = trans(solve(s, trans(pht)))
+    z = to_mat(inputs['pZ'].value, m, 1)
+    hx = mul(h, x)
+    y = [[z[i][0] - hx[i][0]] for i in range(m)]
+    if result_parameter.general_name() == 'pX':
+        ky = mul(k, y)
+        return flat([[x[i][0] + ky[i][0] for i in range(n)]])
+
+    # P = P - K (P H^T)^T, the upper triangle is mirrored
+    kp = mul(k, trans(pht))
+    return flat([[p[min(i, j)][max(i, j)] - kp[min(i, j)][max(i, j)] for j in range(n)]
+                 for i in range(n)])
+
+
+####################
+# Helper Functions #
+####################
+
+
+def to_mat(a, rows, cols):
+    return [[float(a[i * cols + j]) for j in range(cols)] for i in range(rows)]
+
+
+def mul(a, b):
+    cols = range(len(b[0]))
+    return [[sum(a_ik * b_k[j] for a_ik, b_k in zip(a_i, b)) for j in cols] for a_i in a]
+
+
+def trans(a):
+    return [list(col) for col in zip(*a)]
+
+
+def flat(mat):
+    return np.array([v for row in mat for v in row]).astype(np.float32)
+
+
+def solve(a, b):
+    # Gauss-Jordan elimination with partial pivoting in double precision
+    n = len(a)
+    aug = [list(a[i]) + list(b[i]) for i in range(n)]
+    for c in range(n):
+        piv = max(range(c, n), key=lambda i: abs(aug[i][c]))
+        aug[c], aug[piv] = aug[piv], aug[c]
+        for i in range(n):
+            if i != c:
+                f = aug[i][c] / aug[c][c]
+                aug[i] = [vi - f * vc for vi, vc in zip(aug[i], aug[c])]
+    return [[v / aug[i][i] for v in aug[i][n:]] for i in range(n)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
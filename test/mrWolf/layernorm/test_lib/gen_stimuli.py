@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    L = env['row_len']
+    x = [inputs['pSrc'].value[i] for i in range(env['len'])]
+    gamma = inputs['pGamma'].value
+    beta = inputs['pBeta'].value
+    eps = inputs['eps'].value
+
+    result = []
+    for r in range(env['n_rows']):
+        row = x[r * L:(r + 1) * L]
+        if fix_point is None:
+            mean = sum([float(v) for v in row]) / L
+            var = sum([(float(v) - mean)**2 for v in row]) / L + eps
+            result += [(float(v) - mean) / np.sqrt(var) * float(gamma[i]) + float(beta[i])
+                       for (i, v) in enumerate(row)]
+        else:
+            result += layernorm_q16([int(v) for v in row], gamma, beta, int(eps), fix_point)
+
+    if fix_point is None:
+        return np.array(result, dtype=np.float32)
+    return np.array(result, dtype=np.int16)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    return max(-32768, min(32767, x))
+
+
+def round_shift(x, s):
+    return (x + (1 << (s - 1))) >> s if s > 0 else x
+
+
+def isqrt(x):
+    # floor of the square root
+    r = int(np.sqrt(float(x)))
+    while r * r > x:
+        r -= 1
+    while (r + 1) * (r + 1) <= x:
+        r += 1
+    return r
+
+
+def inv_std(var, fix_point):
+    # 1 / sqrt(var) as a mantissa below 2^15 and a right shift
+    inv = (1 << (fix_point + 30)) // max(1, isqrt(var))
+    shift = 30
+    while inv >= 1 << 15 and shift > 0:
+        inv >>= 1
+        shift -= 1
+    return min(inv, 0x7fff), shift
+
+
+def layernorm_q16(row, gamma, beta, eps, fix_point):
+    L = len(row)
+    s = sum(row)
+    # the variance is truncated, the mean rounded half away from zero
+    var = (L * sum([v * v for v in row]) - s * s) // (L * L) + eps
+    mean = (s + L // 2) // L if s >= 0 else -((-s + L // 2) // L)
+    mult, shift = inv_std(var, fix_point)
+    y = [q_sat(round_shift((v - mean) * mult, shift)) for v in row]
+    return [q_sat(round_shift(v * int(gamma[i]), fix_point) + int(beta[i]))
+            for (i, v) in enumerate(y)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    phi = inputs['phi'].value
+    if phi.dtype == np.float32:
+        status, a, refl, err = levinson_f32([float(v) for v in phi], env['order'])
+    else:
+        # the pairs of 32-bit words as signed 64-bit values
+        w = [int(v) for v in phi]
+        phi = [w[i] + (w[i + 1] << 32) - ((w[i + 1] >> 31) << 64) for i in range(0, len(w), 2)]
+        status, a, refl, err = levinson_q32(phi, env['order'], fix_point)
+
+    name = result_parameter.general_name()
+    if "return_value" in result_parameter.name:
+        return status
+    if name == 'pA':
+        return np.array(a).astype(result_parameter.value.dtype)
+    if name == 'pRefl':
+        return np.array(refl).astype(result_parameter.value.dtype)
+    if phi_is_float(inputs):
+        return np.array([err]).astype(np.float32)
+    return words([err])
+
+
+####################
+# Helper Functions #
+####################
+
+def words(values):
+    # 64-bit values as pairs of 32-bit words, least significant first
+    return np.array([w for v in values for w in (v & 0xffffffff, (v >> 32) & 0xffffffff)]).astype(
+        np.uint32)
+
+
+def phi_is_float(inputs):
+    return inputs['phi'].value.dtype == np.float32
+
+
+def levinson_f32(phi, order):
+    if not phi[0] > 0:
+        return 1, None, None, None
+    err = phi[0]
+    a = [0.0] * order
+    refl = [0.0] * order
+    for n in range(order):
+        k = (phi[n + 1] - sum(a[j] * phi[n - j] for j in range(n))) / err
+        a[:n] = [a[j] - k * a[n - 1 - j] for j in range(n)]
+        a[n] = k
+        refl[n] = k
+        err *= 1 - k * k
+        if not err > 0:
+            return 1, None, None, None
+    return 0, a, refl, err
+
+
+def sat32(x):
+    return max(-2 ** 31, min(2 ** 31 - 1, x))
+
+
+def norm(x, shift):
+    # x >> shift rounded to nearest, or x << -shift, saturated to 32 bits
+    if shift > 62:
+        return 0
+    if shift > 0:
+        return sat32((x + (1 << (shift - 1))) >> shift)
+    return sat32(x << -shift)
+
+
+def div_trunc(a, b):
+    # integer division of C
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def levinson_q32(phi, order, frac_bits):
+    # bit-exact model of plp_levinson_durbin_q32
+    if frac_bits > 31:
+        return 2, None, None, None
+    if phi[0] <= 0:
+        return 1, None, None, None
+    shift = phi[0].bit_length() - 1 - 30
+    err = norm(phi[0], shift)
+    a = [0] * order
+    refl = [0] * order
+    for n in range(order):
+        acc = norm(phi[n + 1], shift)
+        for j in range(n):
+            acc -= (a[j] * norm(phi[n - j], shift)) >> 27
+        if acc >= err or -acc >= err:
+            return 1, None, None, None
+        k = div_trunc(acc << 30, err)
+        old = a[:n]
+        a[:n] = [norm(old[j] - ((k * old[n - 1 - j] + (1 << 29)) >> 30), 0) for j in range(n)]
+        a[n] = norm(k, 3)
+        refl[n] = norm(k, 30 - frac_bits)
+        err -= (err * norm(k * k, 30)) >> 30
+        if err <= 0:
+            return 1, None, None, None
+    a = [norm(x, 27 - frac_bits) for x in a]
+    err = err << shift if shift >= 0 else (err + (1 << (-shift - 1))) >> -shift
+    return 0, a, refl, err
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
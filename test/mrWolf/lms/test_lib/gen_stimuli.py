@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+MU_Q16 = 205
+MU_F32 = np.float32(0.05)
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    num_taps = env['num_taps']
+    length = env['len']
+
+    # The first num_taps - 1 samples of the state are the history of the previous blocks. The
+    # output and the error of every sample are computed with the coefficients of the previous
+    # sample, and the coefficients are updated afterwards.
+    x = np.concatenate((inputs['pState'].value[:num_taps - 1], inputs['pSrc'].value))
+    ref = inputs['pRef'].value
+
+    if fix_point is not None:
+        coeffs = [int(c) for c in inputs['pCoeffs'].value]
+        out = np.zeros(length, dtype=np.int16)
+        err = np.zeros(length, dtype=np.int16)
+        for n in range(length):
+            w = x[n:n + num_taps]
+            s = 0
+            for k in range(num_taps):
+                s = q_add(s, coeffs[k] * int(w[k]))
+            y = q_trunc(q_roundnorm(s, fix_point), 'int16_t')
+            e = q_sat16(int(ref[n]) - y)
+            out[n] = y
+            err[n] = e
+            mu_e = q_roundnorm(MU_Q16 * e, fix_point)
+            coeffs = [q_sat16(coeffs[k] + q_roundnorm(mu_e * int(w[k]), fix_point))
+                      for k in range(num_taps)]
+        coeffs = np.array(coeffs, dtype=np.int16)
+    else:
+        coeffs = inputs['pCoeffs'].value.astype(np.float32)
+        out = np.zeros(length, dtype=np.float32)
+        err = np.zeros(length, dtype=np.float32)
+        for n in range(length):
+            w = x[n:n + num_taps].astype(np.float32)
+            y = np.float32(np.sum(coeffs * w))
+            e = np.float32(ref[n] - y)
+            out[n] = y
+            err[n] = e
+            mu_e = np.float32(MU_F32 * e)
+            coeffs = (coeffs + mu_e * w).astype(np.float32)
+
+    name = result_parameter.general_name()
+    if name == 'pOut':
+        return out
+    elif name == 'pErr':
+        return err
+    elif name == 'pCoeffs':
+        return coeffs
+    else:
+        raise RuntimeError("Unknown result: %s" % name)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
+
+
+def q_trunc(x, ctype):
+    bits = 8 if ctype == "int8_t" else 16 if ctype == "int16_t" else 32
+    x = x & ((1 << bits) - 1)
+    return x - (1 << bits) if x >= (1 << (bits - 1)) else x
+
+
+def q_sat16(x):
+    return max(-2**15, min(2**15 - 1, x))
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    table = inputs['table'].value
+    is_float = table.dtype == np.float32
+    conv = float if is_float else int
+    t = [conv(v) for v in table]
+    last = len(t) - 1
+    x_min = conv(inputs['xMin'].value)
+    src = [conv(v) for v in [inputs['x'].value]]
+    dst = []
+    for x in src:
+        if is_float:
+            pos = (x - x_min) / env['step']
+            if pos <= 0 or pos >= last:
+                dst.append(t[0] if pos <= 0 else t[last])
+                continue
+            k = int(pos)
+            dst.append(t[k] + (pos - k) * (t[k + 1] - t[k]))
+            continue
+        s = fix_point
+        d = x - x_min
+        # inputs outside the table are clamped, the interpolation is rounded to nearest
+        if d <= 0 or d >> s >= last:
+            dst.append(t[0] if d <= 0 else t[last])
+            continue
+        k, f = d >> s, d & ((1 << s) - 1)
+        dst.append((t[k] * ((1 << s) - f) + t[k + 1] * f + ((1 << s) >> 1)) >> s)
+    return np.float32(dst[0]) if is_float else dst[0]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
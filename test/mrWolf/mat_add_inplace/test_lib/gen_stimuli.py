@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    a = inputs['pSrcDstA'].value
+    b = inputs['pSrcB'].value
+    if ctype == 'float':
+        return np.array([np.float32(float(x) + float(y)) for x, y in zip(a, b)], dtype=np.float32)
+    return np.array([wrap(int(x) + int(y), ctype) for x, y in zip(a, b)], dtype=dtype(ctype))
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, ctype):
+    # the integer kernels wrap around like the SIMD instructions
+    bits = {'int8_t': 8, 'int16_t': 16, 'int32_t': 32}[ctype]
+    x = int(x) & ((1 << bits) - 1)
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def dtype(ctype):
+    return {'int8_t': np.int8, 'int16_t': np.int16, 'int32_t': np.int32, 'float': np.float32}[ctype]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
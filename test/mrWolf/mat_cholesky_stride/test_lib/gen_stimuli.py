@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len_n']
+    strideSrc = env['strideSrc']
+    strideDst = env['strideDst']
+    A = inputs['pSrc'].value.reshape((N, strideSrc))
+
+    if "return_value" in result_parameter.name:
+        return 0 if env['pos_def'] else 1
+
+    # only the lower triangle of L is computed, the padding of the output is not written
+    if fix_point is None:
+        L = cholesky_f64(A, N)
+        C = np.zeros((N, strideDst)).astype(np.float32)
+    else:
+        L = cholesky_q32(A, N, fix_point)
+        C = np.zeros((N, strideDst)).astype(np.int32)
+    for i in range(N):
+        for j in range(N):
+            C[i, j] = L[i][j]
+    return C.reshape((env['len_dst'], ))
+
+
+def cholesky_f64(A, N):
+    L = [[0.0] * N for _ in range(N)]
+    for j in range(N):
+        s = float(A[j, j]) - sum(L[j][k]**2 for k in range(j))
+        L[j][j] = math.sqrt(s)
+        for i in range(j + 1, N):
+            s = float(A[i, j]) - sum(L[i][k] * L[j][k] for k in range(j))
+            L[i][j] = s / L[j][j]
+    return L
+
+
+def cholesky_q32(A, N, p):
+    # bit-exact model of the kernel: 64-bit sums, square root rounded down, division truncated
+    L = [[0] * N for _ in range(N)]
+    for j in range(N):
+        s = int(A[j, j]) * (1 << p) - sum(L[j][k]**2 for k in range(j))
+        L[j][j] = min(math.isqrt(s), 2**31 - 1)
+        for i in range(j + 1, N):
+            s = int(A[i, j]) * (1 << p) - sum(L[i][k] * L[j][k] for k in range(j))
+            q = abs(s) // L[j][j]
+            L[i][j] = q_sat(q if s >= 0 else -q)
+    return L
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    return min(max(x, -2**31), 2**31 - 1)
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return env['status']
+
+    N = env['len_n']
+    A = [[float(x) for x in inputs['pSrc'].value[i * N:(i + 1) * N]] for i in range(N)]
+    V = [[1.0 if i == j else 0.0 for j in range(N)] for i in range(N)]
+    jacobi(A, V, N, 'nPE' in inputs)
+
+    # ascending eigenvalues, with the columns of V in the same order
+    order = sorted(range(N), key=lambda i: A[i][i])
+    if result_parameter.general_name() == 'pEigVal':
+        return np.array([A[i][i] for i in order]).astype(np.float32)
+    return np.array([V[k][i] for k in range(N) for i in order]).astype(np.float32)
+
+
+####################
+# Helper Functions #
+####################
+
+MAX_SWEEPS = 20
+TOL = 1e-12
+
+
+def f32(x):
+    return float(np.float32(x))
+
+
+def rotation(A, p, q):
+    # rotation [c s; -s c] which sets A[p][q] to zero, rounded like the kernel
+    theta = f32(f32(A[q][q] - A[p][p]) / f32(2 * A[p][q]))
+    t = f32(1 / f32(abs(theta) + f32(math.sqrt(f32(f32(theta * theta) + 1)))))
+    t = -t if theta < 0 else t
+    c = f32(1 / f32(math.sqrt(f32(f32(t * t) + 1))))
+    return c, f32(t * c)
+
+
+def rotate(x, y, c, s):
+    return f32(f32(c * x) - f32(s * y)), f32(f32(s * x) + f32(c * y))
+
+
+def rotate_rows(M, p, q, c, s, N):
+    for k in range(N):
+        M[p][k], M[q][k] = rotate(M[p][k], M[q][k], c, s)
+
+
+def rotate_cols(M, p, q, c, s, N):
+    for k in range(N):
+        M[k][p], M[k][q] = rotate(M[k][p], M[k][q], c, s)
+
+
+def converged(A, N):
+    diag = 0.0
+    off = 0.0
+    for i in range(N):
+        diag = f32(diag + f32(A[i][i] * A[i][i]))
+        for j in range(i + 1, N):
+            off = f32(off + f32(A[i][j] * A[i][j]))
+    return off <= f32(f32(TOL) * f32(diag + f32(2 * off)))
+
+
+def round_robin_pairs(N, rnd):
+    # disjoint pairs of a round of the parallel kernel, None if the pair is padding
+    n_even = N + (N & 1)
+    pairs = []
+    for pair in range(n_even // 2):
+        p = n_even - 1 if pair == 0 else (rnd + n_even - 1 - pair) % (n_even - 1)
+        q = (rnd + pair) % (n_even - 1)
+        p, q = min(p, q), max(p, q)
+        pairs.append((p, q) if q < N else None)
+    return pairs
+
+
+def jacobi(A, V, N, parallel):
+    # cyclic order for the serial kernel, round-robin rounds with all row updates before all
+    # column updates for the parallel kernel
+    for sweep in range(MAX_SWEEPS):
+        if converged(A, N):
+            return
+        if not parallel:
+            for p in range(N - 1):
+                for q in range(p + 1, N):
+                    if A[p][q] == 0:
+                        continue
+                    c, s = rotation(A, p, q)
+                    rotate_rows(A, p, q, c, s, N)
+                    rotate_cols(A, p, q, c, s, N)
+                    A[p][q] = A[q][p] = 0.0
+                    rotate_cols(V, p, q, c, s, N)
+            continue
+        for rnd in range(N + (N & 1) - 1):
+            rotations = []
+            for pq in round_robin_pairs(N, rnd):
+                if pq is None or A[pq[0]][pq[1]] == 0:
+                    continue
+                c, s = rotation(A, *pq)
+                rotate_rows(A, pq[0], pq[1], c, s, N)
+                rotations.append((pq[0], pq[1], c, s))
+            for p, q, c, s in rotations:
+                if s == 0:
+                    continue
+                rotate_cols(A, p, q, c, s, N)
+                A[p][q] = A[q][p] = 0.0
+                rotate_cols(V, p, q, c, s, N)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 2 if env['unsupported'] else 1 if env['singular'] else 0
+
+    N = env['len_n']
+    bits = 16 if inputs['pSrc'].value.dtype == np.int16 else 32
+    src = [int(x) / 2 ** fix_point for x in inputs['pSrc'].value]
+    inv = inverse([src[i * N:(i + 1) * N] for i in range(N)])
+    # rounded to the output format and saturated
+    out = [max(-2 ** (bits - 1), min(2 ** (bits - 1) - 1, int(round(x * 2 ** fix_point))))
+           for row in inv for x in row]
+    return np.array(out).astype(np.int16 if bits == 16 else np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def inverse(A):
+    # Gauss-Jordan elimination with partial pivoting
+    N = len(A)
+    M = [row[:] + [1.0 if i == j else 0.0 for j in range(N)] for i, row in enumerate(A)]
+    for c in range(N):
+        p = max(range(c, N), key=lambda r: abs(M[r][c]))
+        M[p], M[c] = M[c], M[p]
+        M[c] = [x / M[c][c] for x in M[c]]
+        for r in range(N):
+            if r != c:
+                M[r] = [x - M[r][c] * y for x, y in zip(M[r], M[c])]
+    return [row[N:] for row in M]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
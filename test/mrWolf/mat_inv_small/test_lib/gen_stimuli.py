@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return env['status']
+
+    inv, det = inverse(matrices(inputs, env, 1)[0])
+    if result_parameter.general_name() == 'det':
+        return np.array([det]).astype(np.float32)
+    return np.array([x for row in inv for x in row]).astype(np.float32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def matrices(inputs, env, count):
+    N = env['len_n']
+    src = [float(x) for x in inputs['pSrc'].value]
+    return [[src[b * N * N + i * N:b * N * N + (i + 1) * N] for i in range(N)]
+            for b in range(count)]
+
+
+def inverse(A):
+    # Gauss-Jordan elimination with partial pivoting, returns the inverse and the determinant
+    N = len(A)
+    M = [row[:] + [1.0 if i == j else 0.0 for j in range(N)] for i, row in enumerate(A)]
+    det = 1.0
+    for c in range(N):
+        p = max(range(c, N), key=lambda r: abs(M[r][c]))
+        if M[p][c] == 0:
+            return None, 0.0
+        if p != c:
+            M[p], M[c] = M[c], M[p]
+            det = -det
+        det *= M[c][c]
+        M[c] = [x / M[c][c] for x in M[c]]
+        for r in range(N):
+            if r != c:
+                M[r] = [x - M[r][c] * y for x, y in zip(M[r], M[c])]
+    return [row[N:] for row in M], det
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
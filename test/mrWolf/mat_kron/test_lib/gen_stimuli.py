@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrcA'].value
+    b = inputs['pSrcB'].value
+    ctype = result_parameter.ctype
+    N = env['len_n']
+    P = env['len_p']
+    Q = env['len_q']
+
+    # C[m * P + p, n * Q + q] = A[m, n] * B[p, q], C has N * Q columns
+    result = []
+    for m in range(env['len_m']):
+        for p in range(P):
+            for n in range(N):
+                result += [mul(a[m * N + n], b[p * Q + q], ctype) for q in range(Q)]
+    return np.array(result, dtype=out_dtype(ctype))
+
+
+####################
+# Helper Functions #
+####################
+
+
+def mul(a, b, ctype):
+    # integer products are widened to 32 bits, float products are rounded to single precision
+    if ctype == 'float':
+        return np.float32(float(a) * float(b))
+    return int(a) * int(b)
+
+
+def out_dtype(ctype):
+    return np.float32 if ctype == 'float' else np.int32
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return env['status']
+
+    M = env['len_m']
+    N = env['len_n']
+    O = env['len_o']
+    A = inputs['pSrcA'].value
+    B = inputs['pSrcB'].value
+
+    # [A B] is triangularized to [R Q^T*B], then R * X = Q^T * B is solved
+    W = [[float(A[i * N + j]) for j in range(N)] + [float(B[i * O + o]) for o in range(O)]
+         for i in range(M)]
+    householder_triangularize(W, M, N + O, N)
+    X = [[0.0] * O for _ in range(N)]
+    for o in range(O):
+        for i in reversed(range(N)):
+            s = W[i][N + o] - sum(W[i][k] * X[k][o] for k in range(i + 1, N))
+            X[i][o] = s / W[i][i]
+    return np.array([v for row in X for v in row]).astype(np.float32)
+
+
+def householder_triangularize(R, M, N, K):
+    # reflections of the first K columns, with alpha = -sign(x0) * |x|
+    for k in range(min(K, M - 1)):
+        v = [R[i][k] for i in range(k, M)]
+        norm2 = sum(x * x for x in v)
+        if norm2 == 0:
+            continue
+        norm = math.sqrt(norm2)
+        alpha = -norm if v[0] > 0 else norm
+        beta = 1 / (norm * (norm + abs(v[0])))
+        v[0] = v[0] - alpha
+        R[k][k] = alpha
+        for i in range(k + 1, M):
+            R[i][k] = 0.0
+        for j in range(k + 1, N):
+            w = sum(v[i] * R[k + i][j] for i in range(len(v)))
+            for i in range(len(v)):
+                R[k + i][j] -= beta * v[i] * w
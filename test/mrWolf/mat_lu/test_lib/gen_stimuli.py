@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 1 if env['singular'] else 0
+
+    LU, perm = lu_decomposition(inputs['pSrc'].value.astype(np.float64), env['len_n'])
+    if 'pPerm' in result_parameter.name:
+        return np.array(perm, dtype=np.uint32)
+    return LU.reshape((env['len_mat'], )).astype(np.float32)
+
+
+def lu_decomposition(A, N):
+    # partial pivoting on the largest absolute value, L and U packed into one matrix
+    LU = A.reshape((N, N)).copy()
+    perm = list(range(N))
+    for k in range(N):
+        pivot = k
+        for i in range(k + 1, N):
+            if abs(LU[i, k]) > abs(LU[pivot, k]):
+                pivot = i
+        if pivot != k:
+            for j in range(N):
+                LU[k, j], LU[pivot, j] = LU[pivot, j], LU[k, j]
+            perm[k], perm[pivot] = perm[pivot], perm[k]
+        for i in range(k + 1, N):
+            LU[i, k] = LU[i, k] / LU[k, k]
+            for j in range(k + 1, N):
+                LU[i, j] = LU[i, j] - LU[i, k] * LU[k, j]
+    return LU, perm
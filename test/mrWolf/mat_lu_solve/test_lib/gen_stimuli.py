@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 1 if env['singular'] else 0
+
+    N = env['len_n']
+    O = env['len_o']
+    LU = inputs['pLU'].value.astype(np.float64).reshape((N, N))
+    perm = inputs['pPerm'].value
+    B = inputs['pSrcB'].value.astype(np.float64).reshape((N, O))
+
+    # forward substitution with the unit lower triangle on the permuted rows of B, then backward
+    # substitution with the upper triangle
+    X = np.zeros((N, O))
+    for o in range(O):
+        for i in range(N):
+            X[i, o] = B[int(perm[i]), o] - sum(LU[i, k] * X[k, o] for k in range(i))
+        for i in reversed(range(N)):
+            X[i, o] = (X[i, o] - sum(LU[i, k] * X[k, o] for k in range(i + 1, N))) / LU[i, i]
+    return X.reshape((env['len_rhs'], )).astype(np.float32)
@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 0
+
+    M = env['len_m']
+    N = env['len_n']
+    O = env['len_o']
+
+    # the 3M products only change the rounding, the reference is the complex product in double
+    A = inputs['pSrcA'].value.astype(np.float64).reshape((M, N, 2))
+    B = inputs['pSrcB'].value.astype(np.float64).reshape((N, O, 2))
+    C = np.zeros((M, O, 2))
+    for m in range(M):
+        for o in range(O):
+            C[m, o, 0] = sum(A[m, n, 0] * B[n, o, 0] - A[m, n, 1] * B[n, o, 1] for n in range(N))
+            C[m, o, 1] = sum(A[m, n, 0] * B[n, o, 1] + A[m, n, 1] * B[n, o, 0] for n in range(N))
+    return C.reshape((M * O * 2, )).astype(np.float32)
@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N, O = env['M'], env['N'], env['O']
+    is_float = inputs['pSrcA'].value.dtype == np.float32
+    conv = float if is_float else int
+    a = [conv(v) for v in inputs['pSrcA'].value]
+    b = [conv(v) for v in inputs['pSrcB'].value]
+    c = [sum(a[m * N + n] * b[n * O + o] for n in range(N)) for m in range(M) for o in range(O)]
+    if is_float:
+        return np.array(c).astype(np.float32)
+    # the 32-bit accumulator wraps around
+    return np.array([(v + (1 << 31)) % (1 << 32) - (1 << 31) for v in c]).astype(np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
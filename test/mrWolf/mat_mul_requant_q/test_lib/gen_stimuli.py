@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['srcA'].value
+    b = inputs['srcB'].value
+    mult = inputs['mult'].value
+    shift = inputs['pShift'].value
+    N = env['len_n']
+    O = env['len_o']
+    bits = 16 if result_parameter.ctype == 'int16_t' else 32
+    dtype = np.int16 if bits == 16 else np.int32
+
+    # the accumulators are exact, they are requantized once per output element
+    result = []
+    for m in range(env['len_m']):
+        for o in range(O):
+            s = sum([int(a[m * N + n]) * int(b[n * O + o]) for n in range(N)])
+            s *= 1 if env['no_mult'] else int(mult[o])
+            result.append(q_sat_bits(round_shift(s, int(shift[o])), bits))
+    return np.array(result, dtype=dtype)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def round_shift(x, s):
+    # round to the nearest value
+    return (x + (1 << (s - 1))) >> s if s > 0 else x
+
+
+def q_sat_bits(x, bits=32):
+    return max(-2**(bits-1), min(2**(bits-1) - 1, x))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
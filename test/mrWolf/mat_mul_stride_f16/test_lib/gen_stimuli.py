@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+import numpy as np
+import struct
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    stride_a = env['strideA']
+    stride_b = env['strideB']
+    stride_c = env['strideC']
+    a = [f16_to_f32(x) for x in inputs['srcA'].value]
+    b = [f16_to_f32(x) for x in inputs['srcB'].value]
+    M = env['len_m']
+    N = env['len_n']
+    O = env['len_o']
+
+    # the kernels accumulate in single precision and round only the result to half precision.
+    # The padding of the output is not written.
+    result = np.zeros(M * stride_c, dtype=np.uint16)
+    for m in range(M):
+        for o in range(O):
+            s = np.float32(0)
+            for n in range(N):
+                s = np.float32(s + np.float32(a[m * stride_a + n] * b[n * stride_b + o]))
+            result[m * stride_c + o] = f32_to_f16(s)
+
+    return result
+
+
+##########################
+# Half-Precision Helpers #
+##########################
+
+
+def f16_to_f32(x):
+    return np.float32(struct.unpack('<e', struct.pack('<H', int(x)))[0])
+
+
+def f32_to_f16(x):
+    # round to the nearest even value, values beyond the half-precision range become infinity
+    x = float(x)
+    if abs(x) >= 65520.0:
+        return 0xfc00 if x < 0 else 0x7c00
+    return struct.unpack('<H', struct.pack('<e', x))[0]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N, O = env['M'], env['N'], env['O']
+    sa, sb, sc = env['stride_a'], env['stride_b'], env['stride_c']
+    a = [int(v) for v in inputs['pSrcA'].value]
+    b = [int(v) for v in inputs['pSrcB'].value]
+    # the elements between the rows of C stay unchanged
+    dst = inputs['pDstC'].value.copy()
+    for m in range(M):
+        for o in range(O):
+            dst[m * sc + o] = sum(a[m * sa + n] * b[n * sb + o] for n in range(N))
+    return dst
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
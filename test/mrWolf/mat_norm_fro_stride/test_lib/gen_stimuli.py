@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src = inputs['pSrc'].value
+    is_float = src.dtype == np.float32
+    conv = float if is_float else int
+    stride, N = env['stride'], env['N']
+    rows = [[conv(v) for v in src[m * stride:m * stride + N]] for m in range(env['M'])]
+    # the Frobenius norm of the rows, ignoring the elements between them
+
+    squares = sum(v * v for row in rows for v in row)
+    # the integer square root is truncated
+    res = math.sqrt(squares) if is_float else math.isqrt(squares)
+    return np.array([res]).astype(np.float32 if is_float else np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
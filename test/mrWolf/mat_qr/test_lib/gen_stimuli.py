@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 0
+
+    M = env['len_m']
+    N = env['len_n']
+    A = inputs['pSrc'].value
+    R = [[float(A[i * N + j]) for j in range(N)] for i in range(M)]
+    Q = householder_qr(R, M, N)
+
+    res = Q if 'pQ' in result_parameter.name else R
+    return np.array([v for row in res for v in row]).astype(np.float32)
+
+
+def householder_qr(R, M, N):
+    # the reflections of the kernel, with alpha = -sign(x0) * |x|, R is triangularized in place
+    Q = [[1.0 if i == j else 0.0 for j in range(M)] for i in range(M)]
+    for k in range(min(N, M - 1)):
+        v = [R[i][k] for i in range(k, M)]
+        norm2 = sum(x * x for x in v)
+        if norm2 == 0:
+            continue
+        norm = math.sqrt(norm2)
+        alpha = -norm if v[0] > 0 else norm
+        beta = 1 / (norm * (norm + abs(v[0])))
+        v[0] = v[0] - alpha
+        R[k][k] = alpha
+        for i in range(k + 1, M):
+            R[i][k] = 0.0
+        for j in range(k + 1, N):
+            w = sum(v[i] * R[k + i][j] for i in range(len(v)))
+            for i in range(len(v)):
+                R[k + i][j] -= beta * v[i] * w
+        for r in range(M):
+            u = sum(Q[r][k + i] * v[i] for i in range(len(v)))
+            for i in range(len(v)):
+                Q[r][k + i] -= beta * u * v[i]
+    return Q
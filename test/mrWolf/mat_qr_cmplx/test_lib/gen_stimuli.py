@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 0
+
+    M = env['len_m']
+    N = env['len_n']
+    A = inputs['pSrc'].value
+    R = [[complex(float(A[2 * (i * N + j)]), float(A[2 * (i * N + j) + 1])) for j in range(N)]
+         for i in range(M)]
+    Q = householder_qr_cmplx(R, M, N)
+
+    res = Q if 'pQ' in result_parameter.name else R
+    return np.array([p for row in res for v in row for p in (v.real, v.imag)]).astype(np.float32)
+
+
+def householder_qr_cmplx(R, M, N):
+    # the reflections of the kernel, with alpha = -x0 / |x0| * |x| (and x0 / |x0| = 1 for x0 = 0),
+    # R is triangularized in place
+    Q = [[1.0 + 0j if i == j else 0j for j in range(M)] for i in range(M)]
+    for k in range(min(N, M - 1)):
+        v = [R[i][k] for i in range(k, M)]
+        norm2 = sum(abs(x)**2 for x in v)
+        if norm2 == 0:
+            continue
+        norm = math.sqrt(norm2)
+        abs_x0 = abs(v[0])
+        alpha = -(v[0] / abs_x0 if abs_x0 != 0 else 1) * norm
+        beta = 1 / (norm * (norm + abs_x0))
+        v[0] = v[0] - alpha
+        R[k][k] = alpha
+        for i in range(k + 1, M):
+            R[i][k] = 0j
+        for j in range(k + 1, N):
+            w = sum(v[i].conjugate() * R[k + i][j] for i in range(len(v)))
+            for i in range(len(v)):
+                R[k + i][j] -= beta * v[i] * w
+        for r in range(M):
+            u = sum(Q[r][k + i] * v[i] for i in range(len(v)))
+            for i in range(len(v)):
+                Q[r][k + i] -= beta * u * v[i].conjugate()
+    return Q
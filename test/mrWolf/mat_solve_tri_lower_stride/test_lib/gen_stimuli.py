@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len_n']
+    O = env['len_o']
+    strideC = env['strideC']
+    A = inputs['pSrcA'].value.reshape((N, env['strideA']))
+    B = inputs['pSrcB'].value.reshape((N, env['strideB']))
+
+    if "return_value" in result_parameter.name:
+        return 1 if env['singular'] else 0
+
+    # forward substitution, the fix-point model is bit-exact with the kernel
+    X = [[B[i, o].item() for o in range(O)] for i in range(N)]
+    for j in range(N):
+        diag = A[j, j].item()
+        for o in range(O):
+            X[j][o] = q_div(X[j][o], diag, fix_point)
+        for i in range(j + 1, N):
+            for o in range(O):
+                X[i][o] = q_sub(X[i][o], q_mul(A[i, j].item(), X[j][o], fix_point))
+
+    C = np.zeros((N, strideC)).astype(result_parameter.get_dtype())
+    for i in range(N):
+        for o in range(O):
+            C[i, o] = X[i][o]
+    return C.reshape((env['len_res'], ))
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    return min(max(x, -2**31), 2**31 - 1)
+
+
+def q_wrap(x):
+    return (x + 2**31) % 2**32 - 2**31
+
+
+def q_div(a, b, p):
+    # (a << p) / b, truncated towards zero and saturated
+    if p is None:
+        return a / b
+    q = abs(a << p) // abs(b)
+    return q_sat(q if (a < 0) == (b < 0) else -q)
+
+
+def q_mul(a, b, p):
+    # product shifted down by p, rounded towards minus infinity
+    if p is None:
+        return a * b
+    return (a * b) >> p
+
+
+def q_sub(a, b):
+    if isinstance(a, float):
+        return a - b
+    return q_wrap(a - b)
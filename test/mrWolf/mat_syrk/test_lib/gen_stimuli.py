@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N = env['M'], env['N']
+    is_float = inputs['pSrcA'].value.dtype == np.float32
+    conv = float if is_float else int
+    a = [conv(v) for v in inputs['pSrcA'].value]
+    cmplx = len(a) == 2 * M * N
+    if cmplx:
+        a = [complex(a[2 * k], a[2 * k + 1]) for k in range(M * N)]
+    dst = []
+    for m in range(M):
+        for o in range(M):
+            # on and above the diagonal, the outputs below it are their (conjugated) mirrors
+            i, j = min(m, o), max(m, o)
+            acc = sum(product(a[i * N + n], a[j * N + n], fix_point) for n in range(N))
+            if m > o:
+                acc = acc.conjugate()
+            dst += [acc.real, acc.imag] if cmplx else [acc]
+    if is_float:
+        return np.array(dst).astype(np.float32)
+    if fix_point is None:
+        return np.array([wrap(int(v), 32) for v in dst]).astype(np.int32)
+    return np.array([wrap(int(v), 16) for v in dst]).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, bits):
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def product(a, b, shift):
+    """ a * b for syrk and a * conj(b) for herk, the fixed-point parts are rounded separately """
+    p = a * b.conjugate()
+    if shift is None:
+        return p
+    rnd = 1 << (shift - 1) if shift else 0
+    if isinstance(p, complex):
+        return complex((int(p.real) + rnd) >> shift, (int(p.imag) + rnd) >> shift)
+    return (p + rnd) >> shift
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N = env['len_m'], env['len_n']
+    src = inputs['pSrc'].value
+    is_float = src.dtype == np.float32
+    if 'strideSrc' in env:
+        ss, sd = env['strideSrc'], env['strideDst']
+        dst = [float(v) if is_float else int(v) for v in inputs['pDst'].value]
+    else:
+        ss, sd = N, M
+        dst = [0] * env['len_src']
+    hi = 0 if is_float else np.iinfo(src.dtype).max
+    for m in range(M):
+        for n in range(N):
+            re, im = (float(v) if is_float else int(v) for v in src[2 * (m * ss + n):][:2])
+            # the negation saturates, like plp_cmplx_conj
+            if False:
+                im = -im if is_float else min(hi, -im)
+            dst[2 * (n * sd + m)] = re
+            dst[2 * (n * sd + m) + 1] = im
+    return np.array(dst).astype(src.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
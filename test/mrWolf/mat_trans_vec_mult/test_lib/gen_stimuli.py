@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M = env['len_m']
+    N = env['len_n']
+    A = inputs['pSrcA'].value
+    x = inputs['pSrcX'].value
+    ctype = inputs['pSrcA'].ctype
+
+    # y = A^T * x, every element is the dot product of a column of A with x
+    cols = [[(A[m * N + n].item(), x[m].item()) for m in range(M)] for n in range(N)]
+    if ctype == 'float':
+        return np.array([sum(np.float32(a) * np.float32(b) for a, b in col) for col in cols],
+                        dtype=np.float32)
+    bits = 8 if ctype == 'int8_t' else 16 if ctype == 'int16_t' else 32
+    y = [dot_prod(col, bits, fix_point) for col in cols]
+    if fix_point is None:
+        return np.array(y, dtype=np.int32)
+    return np.array([q_wrap(v, bits) for v in y], dtype=result_parameter.get_dtype())
+
+
+def dot_prod(pairs, bits, shift):
+    # the fix-point kernels round and shift the sum of every SIMD group of 32 / bits products
+    if shift is None:
+        return q_wrap(sum(a * b for a, b in pairs), 32)
+    group = 32 // bits
+    full = len(pairs) // group * group
+    groups = [pairs[i:i + group] for i in range(0, full, group)] + [[p] for p in pairs[full:]]
+    res = 0
+    for g in groups:
+        tmp = q_wrap(sum(a * b for a, b in g), 32)
+        res = q_wrap(res + q_roundnorm(tmp, shift), 32)
+    return res
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_wrap(x, bits):
+    return (x + 2**(bits - 1)) % 2**bits - 2**(bits - 1)
+
+
+def q_roundnorm(a, p):
+    rounding = (1 << p) >> 1
+    return q_wrap(a + rounding, 32) >> p
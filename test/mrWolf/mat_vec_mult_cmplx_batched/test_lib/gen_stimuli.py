@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N = env['M'], env['N']
+    dst = inputs['pDstY'].value.copy()
+    for b in range(env['batch']):
+        a = cmplx_values(inputs['pSrcA'], b * env['strideA'], M * N)
+        x = cmplx_values(inputs['pSrcX'], b * env['strideX'], N)
+        offset = 2 * b * env['strideY']
+        dst[offset:offset + 2 * M] = gemv(a, x, M, N, fix_point)
+    return dst
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap(x, bits):
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def gemv(a, x, M, N, shift):
+    """ y = A * x, the fixed-point parts of every product are rounded and shifted separately """
+    y = []
+    for m in range(M):
+        acc = 0
+        for n in range(N):
+            p = a[m * N + n] * x[n]
+            if shift is not None:
+                rnd = 1 << (shift - 1) if shift else 0
+                p = complex((int(p.real) + rnd) >> shift, (int(p.imag) + rnd) >> shift)
+            acc += p
+        if shift is None:
+            y += [acc.real, acc.imag]
+        else:
+            y += [wrap(int(acc.real), 16), wrap(int(acc.imag), 16)]
+    return y
+
+
+def cmplx_values(arg, offset, length):
+    conv = float if arg.value.dtype == np.float32 else int
+    v = [conv(s) for s in arg.value[2 * offset:2 * (offset + length)]]
+    return [complex(v[2 * k], v[2 * k + 1]) for k in range(length)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
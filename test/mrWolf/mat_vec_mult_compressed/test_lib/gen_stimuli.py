@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N = env['M'], env['N']
+    row_size = 4 * ((N + 7) // 8)
+    a = [int(v) & 0xFF for v in inputs['pSrcA'].value]
+    codebook = [int(v) for v in inputs['pCodebook'].value]
+    x = [int(v) for v in inputs['pSrcX'].value]
+    dst = []
+    for m in range(M):
+        row = a[m * row_size:(m + 1) * row_size]
+        # two indices per byte, the one of the first value in the lower nibble
+        idx = [(row[n // 2] >> (4 * (n % 2))) & 0xF for n in range(N)]
+        dst.append(sum(codebook[i] * v for i, v in zip(idx, x)))
+    return np.array(dst).astype(np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    dtype = np.float32 if result_parameter.ctype == 'float' else np.int16
+    src = inputs['pSrc'].value
+    n = len(src)
+    taps = env['num_taps']
+    if taps % 2 == 0 or taps > 25:
+        return np.zeros(n, dtype=dtype)
+
+    # same-length median, the edge samples are replicated
+    h = taps // 2
+    dst = [sorted(src[min(max(j, 0), n - 1)] for j in range(i - h, i + h + 1))[h] for i in range(n)]
+    return np.array(dst).astype(dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrc'].value.astype(np.float64)
+    coeffs = inputs['coeffs'].value.astype(np.float64)
+    if fix_point is not None:
+        a = a / 2**fix_point
+        coeffs = coeffs / 2**15
+
+    # dense filterbank from the sparse bands
+    energies = np.zeros(env['bands'])
+    offset = 0
+    for m in range(env['bands']):
+        start = int(inputs['bandStart'].value[m])
+        length = int(inputs['bandLength'].value[m])
+        energies[m] = np.dot(a[start:start + length], coeffs[offset:offset + length])
+        offset += length
+
+    # the q16 version treats energies below one LSB as one LSB
+    if fix_point is not None:
+        log_energies = np.log(np.maximum(energies, 2.0**-fix_point))
+        dct = inputs['dct'].value.astype(np.float64) / 2**15
+    else:
+        log_energies = np.log(np.maximum(energies, 1e-10))
+        dct = inputs['dct'].value.astype(np.float64)
+    result = np.dot(dct.reshape(env['mfcc'], env['bands']), log_energies)
+
+    if fix_point is not None:
+        # Q5.10
+        return np.round(result * 2**10).astype(np.int32)
+    return result.astype(np.float32)
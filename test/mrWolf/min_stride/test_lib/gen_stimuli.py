@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = samples(inputs['pSrc'], env['stride'], env['len'])
+    res = min(x)
+    dtype = {'float': np.float32, 'int32_t': np.int32, 'int16_t': np.int16, 'int8_t': np.int8}
+    return np.array([res]).astype(dtype[result_parameter.ctype])
+
+
+####################
+# Helper Functions #
+####################
+
+
+def samples(arg, stride, n):
+    conv = float if arg.value.dtype == np.float32 else int
+    return [conv(arg.value[k * stride]) for k in range(n)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
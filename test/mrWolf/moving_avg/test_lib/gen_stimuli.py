@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    L = env['len_window']
+    state = list(inputs['pState'].value)
+    index = env['index']
+    src = inputs['pSrc'].value
+    is_float = result_parameter.ctype == 'float'
+    if is_float:
+        acc = f32_sum(state)
+        inv_length = np.float32(1 / L)
+    else:
+        acc = sum(int(x) for x in state)
+        recip = ((1 << 30) + (L >> 1)) // L
+
+    dst = []
+    for x in src:
+        if is_float:
+            acc = np.float32(acc + np.float32(x - state[index]))
+        else:
+            acc += int(x) - int(state[index])
+        state[index] = x
+        index = (index + 1) % L
+        if is_float:
+            # the float kernel recomputes the sum whenever the window wraps around
+            acc = f32_sum(state) if index == 0 else acc
+            dst.append(np.float32(acc * inv_length))
+        else:
+            dst.append((acc * recip + (1 << 29)) >> 30)
+
+    if result_parameter.general_name() == 'pState':
+        return np.array(state).astype(np.float32 if is_float else np.int16)
+    return np.array(dst).astype(np.float32 if is_float else np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def f32_sum(values):
+    acc = np.float32(0)
+    for x in values:
+        acc = np.float32(acc + x)
+    return acc
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -20,7 +20,14 @@ def compute_result(result_parameter, inputs, env, fix_point):
     fix_point: None (if no fixpoint is used) or decimal point
     """
     if fix_point is not None:
-        raise RuntimeError("FixPoint is not supported")
+        # the exact result is rounded, shifted and saturated to the width of the output
+        my_type, bits = {'int8_t': (np.int8, 8), 'int16_t': (np.int16, 16),
+                         'int32_t': (np.int32, 32)}[result_parameter.ctype]
+        rounding = (1 << (fix_point - 1)) if fix_point > 0 else 0
+        a = inputs['pSrcA'].value
+        b = inputs['pSrcB'].value
+        result = np.array([q_sat_bits((int(x) * int(y) + rounding) >> fix_point, bits)
+                           for x, y in zip(a, b)], dtype=my_type)
     elif result_parameter.ctype == 'int8_t':
         a = inputs['pSrcA'].value.astype(np.int8)
         b = inputs['pSrcB'].value.astype(np.int8)
@@ -48,6 +55,10 @@ def compute_result(result_parameter, inputs, env, fix_point):
 ######################
 
 
+def q_sat_bits(x, bits=32):
+    return max(-2**(bits-1), min(2**(bits-1) - 1, x))
+
+
 def q_sat(x):
     if x > 2**31 - 1:
         return x - 2**32
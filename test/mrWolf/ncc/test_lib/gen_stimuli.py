@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    is_float = inputs['pSrc'].value.dtype == np.float32
+    x = [float(v) for v in inputs['pSrc'].value]
+    t = [float(v) for v in inputs['pTmpl'].value]
+    M = env['tmpl_len']
+    eT = sum(v * v for v in t)
+    res = []
+    for l in range(env['res_len']):
+        w = x[l:l + M]
+        eX = sum(v * v for v in w)
+        r = 0.0 if eT == 0 or eX == 0 else sum(a * b for a, b in zip(t, w)) / math.sqrt(eT * eX)
+        # Q15, where 1.0 saturates
+        res.append(r if is_float else max(-32768, min(32767, int(round(r * 32768)))))
+    return np.array(res).astype(np.float32 if is_float else np.int16)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
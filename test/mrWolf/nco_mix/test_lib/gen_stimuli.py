@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.general_name() == 'nco':
+        return nco_after(env, inputs)
+    inc, phase = [int(v) % 2**32 for v in inputs['nco'].value]
+    res_i, res_q = mix([int(x) for x in inputs['pSrc'].value], inc, phase)
+    return np.array(res_i if result_parameter.general_name() == 'pDstI' else res_q).astype(np.int16)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def mix(src, phase_inc, phase):
+    # multiplication with exp(-j * phase), rounded and saturated to Q1.15
+    res_i, res_q = [], []
+    for n, x in enumerate(src):
+        theta = 2 * math.pi * ((phase + n * phase_inc) % 2**32) / 2**32
+        res_i.append(min(32767, max(-32768, int(round(x * math.cos(theta))))))
+        res_q.append(min(32767, max(-32768, int(round(-x * math.sin(theta))))))
+    return res_i, res_q
+
+
+def nco_after(env, inputs):
+    # the phase accumulator is advanced by every sample and wraps around
+    inc, phase = [int(v) % 2**32 for v in inputs['nco'].value]
+    phase = (phase + env['len'] * inc) % 2**32
+    return np.array([inc, phase], dtype=np.uint32).astype(np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        my_type = np.int32
+        my_bits = 32
+    elif result_parameter.ctype == 'int16_t':
+        my_type = np.int16
+        my_bits = 16
+    elif result_parameter.ctype == 'int8_t':
+        my_type = np.int8
+        my_bits = 8
+    elif result_parameter.ctype == 'float':
+        my_type = np.float32
+        my_bits = 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    if result_parameter.ctype == 'float':
+        calc_type = np.float32
+    else:
+        # compute exactly on 64 bit and wrap around to the width of the output
+        calc_type = np.int64
+
+    a = inputs['pSrc'].value.astype(calc_type)
+    r = -a
+
+    if result_parameter.ctype == 'float':
+        return r.astype(my_type)
+    return np.array([q_wrap(int(x), my_bits) for x in r], dtype=my_type)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_wrap(x, bits=32):
+    return ((x + 2**(bits-1)) % 2**bits) - 2**(bits-1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src = inputs['pSrc'].value
+    is_float = src.dtype == np.float32
+
+    x = [float(v) for v in src]
+    cols = len(x)
+    dst = []
+    for r in range(len(x) // cols):
+        row = x[r * cols:(r + 1) * cols]
+        norm = math.sqrt(sum(v * v for v in row))
+        if norm == 0:
+            dst += [0] * cols
+        elif is_float:
+            dst += [v / norm for v in row]
+        else:
+            # in Q1.15, a single sample saturates to +-1
+            dst += [max(-32768, min(32767, int(round(v / norm * 32768)))) for v in row]
+    return np.array(dst).astype(src.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    s = [int(v) for v in inputs['pS'].value]
+    out = []
+    for i, e in enumerate(inputs['pIn'].value):
+        a0, a1, a2, e1, e2, y1, out_min, out_max = s[8 * i:8 * i + 8]
+        acc = (y1 << 31) + a0 * int(e) + a1 * e1 + a2 * e2
+        y = max(out_min, min(out_max, sat(acc >> 31)))
+        s[8 * i + 3:8 * i + 6] = [int(e), e1, y]
+        out.append(y)
+    if result_parameter.general_name() == 'pOut':
+        return np.array(out).astype(np.int32)
+    return np.array(s).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def sat(x):
+    return max(-2**31, min(2**31 - 1, x))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
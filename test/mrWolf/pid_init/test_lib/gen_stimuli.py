@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    kp, ki, kd = env['Kp'], env['Ki'], env['Kd']
+    # A0 = Kp + Ki + Kd, A1 = -(Kp + 2 Kd) and A2 = Kd, and a cleared state
+    s = [sat(kp + ki + kd), sat(-(kp + 2 * kd)), kd, 0, 0, 0, env['out_min'], env['out_max']]
+    return np.array(s).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def sat(x):
+    return max(-2**31, min(2**31 - 1, x))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
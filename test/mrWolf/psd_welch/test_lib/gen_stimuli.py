@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len']
+    is_float = inputs['pSrc'].value.dtype == np.float32
+    one = 1.0 if is_float else 32768.0
+    x = [float(v) / one for v in inputs['pSrc'].value]
+    half = [float(v) / one for v in inputs['window'].value]
+    w = [half[n] if n < N // 2 else half[N - n] for n in range(N)]
+    K = env['segments']
+    psd = [0.0] * env['num_bins']
+    for s in range(K):
+        X = fft([w[n] * x[s * env['hop'] + n] for n in range(N)])
+        psd = [p + abs(X[k]) ** 2 for k, p in enumerate(psd)]
+    psd = [p / (K * N * sum(v * v for v in w)) for p in psd]
+    if is_float:
+        return np.array(psd).astype(np.float32)
+    # Q2.30
+    return np.array([int(round(p * 2 ** 30)) for p in psd]).astype(np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def fft(x):
+    # radix-2 decimation in time, in double precision
+    n = len(x)
+    if n == 1:
+        return x
+    even = fft(x[0::2])
+    odd = fft(x[1::2])
+    w = [cmath.exp(-2j * math.pi * k / n) * odd[k] for k in range(n // 2)]
+    return [even[k] + w[k] for k in range(n // 2)] + [even[k] - w[k] for k in range(n // 2)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -14,6 +14,18 @@ import traceback
 
 GENERATE_STIMULI = "gen_stimuli"
 
+# Benchmark mode, enabled with the environment variable PULP_DSP_BENCH=1. In this mode, every
+# SweepVariable uses its bench_values (if given), and the parallel versions are run with every
+# number of cores in BENCH_N_PE.
+BENCH_MODE = os.environ.get("PULP_DSP_BENCH", "0") not in ["", "0"]
+BENCH_N_PE = [1, 2, 4, 8]
+
+# Load balance mode, enabled with the environment variable PULP_DSP_BALANCE=1. In this mode, every
+# test case runs the function once more and measures the load balance of its parallel kernels
+# (see plp_balance_init), which is written to the balance file. The library must be built with
+# PLP_TRACE=1.
+BALANCE_MODE = os.environ.get("PULP_DSP_BALANCE", "0") not in ["", "0"]
+
 
 class Variable(object):
     """Variable"""
@@ -29,13 +41,22 @@ class Variable(object):
 
 class SweepVariable(Variable):
     """sweep variable"""
-    def __init__(self, name, values, visible=True, active=None):
+    def __init__(self, name, values, visible=True, active=None, bench_values=None):
         """
         name: name for the sweep variable
         values: iterable over all possible values for this variable
+        bench_values: iterable over the values used in benchmark mode (PULP_DSP_BENCH=1). If None,
+                      values is used in benchmark mode as well.
         """
         super(SweepVariable, self).__init__(name, visible, active)
         self.values = values
+        self.bench_values = bench_values
+
+    def sweep_values(self):
+        """ returns the values to sweep over, depending on the benchmark mode """
+        if BENCH_MODE and self.bench_values is not None:
+            return self.bench_values
+        return self.values
 
 
 class DynamicVariable(Variable):
@@ -129,6 +150,15 @@ class Argument(object):
             return np.int16
         if self.ctype == "int32_t":
             return np.int32
+        if self.ctype == "uint8_t":
+            return np.uint8
+        if self.ctype == "uint16_t":
+            return np.uint16
+        if self.ctype == "uint32_t":
+            return np.uint32
+        if self.ctype in ["float16_t", "bfloat16_t"]:
+            # half-precision values are stored as their bit pattern
+            return np.uint16
         if self.ctype == "float":
             return np.float32
         raise RuntimeError("Unknown type: %s" % self.ctype)
@@ -344,7 +374,8 @@ class OutputArgument(ArrayArgument):
                    env, version, device, var_type.
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
-        skip_check: Boolean, if True, the output is not checked.
+        skip_check: Boolean or function returning a boolean, if True, the output is not checked.
+                    The function can take the arguments: env, version, device, var_type.
         """
         super(OutputArgument, self).__init__(name, ctype, length, 0, use_l1, in_function)
         self.tolerance = tolerance
@@ -360,11 +391,13 @@ class OutputArgument(ArrayArgument):
         - Apply the version (var_type or ret_type)
         - Apply use_l1 flag
         - Interpret the length of the variable
-        - Apply the tolerance
+        - Apply the tolerance and the skip_check flag
         - Alter the name to contain the test id
         """
         if callable(self.tolerance):
             self.tolerance = call_dynamic_function(self.tolerance, env, version, device)
+        if callable(self.skip_check):
+            self.skip_check = call_dynamic_function(self.skip_check, env, version, device)
         return super(OutputArgument, self).apply(env, var_type, version, use_l1, idx, device)
 
     def check_str(self, target):
@@ -432,7 +465,7 @@ class InplaceArgument(OutputArgument):
                    as absolute.
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
-        skip_check: Boolean, if True, the output is not checked.
+        skip_check: Boolean or function returning a boolean, if True, the output is not checked.
         """
         super(InplaceArgument, self).__init__(name, ctype, length, use_l1, tolerance, in_function,
                                               skip_check)
@@ -732,7 +765,7 @@ class AggregatedTestCase(object):
                 // run 4: count TCDM contentions
                 t{idx}__do_bench(&perf, 1<<RT_PERF_TCDM_CONT, 0);
                 printf("    tcdm_cont: %d\\n", rt_perf_read(RT_PERF_TCDM_CONT));
-
+            {balance}
                 // free up all memory
             {free}
 
@@ -747,7 +780,30 @@ class AggregatedTestCase(object):
                  free=indent("".join([arg.run_test_free_str()
                                       for arg in self.arguments
                                       if arg.run_test_free_str() is not None]),
-                             "    "))
+                             "    "),
+                 balance=indent(self.get_balance_run() if BALANCE_MODE else "", "    "))
+
+    def get_balance_run(self):
+        """ returns the run which measures the load balance of the parallel kernels """
+        return dedent(
+            """
+            // run 5: load balance of the parallel kernels of the function
+            plp_balance_entry balance[4] = {{{{0}}}};
+            plp_balance_entry total = {{0}};
+            plp_balance_init(balance, 4);
+            t{idx}__do_bench(&perf, 1<<RT_PERF_CYCLES, 0);
+            plp_balance_init(NULL, 0);
+            for (int k = 0; k < 4 && balance[k].name != NULL; k++) {{
+                total.wait += balance[k].wait;
+                total.maxBusy += balance[k].maxBusy;
+                total.meanBusy += balance[k].meanBusy;
+            }}
+            if (balance[0].name != NULL) {{
+                printf("    wait_cycles: %d\\n", total.wait);
+                printf("    imbalance: %d\\n", plp_balance_imbalance(&total));
+            }}
+            """
+        ).format(idx=self.idx)
 
     def get_header_filename(self):
         """ returns the name of the header file """
@@ -866,7 +922,7 @@ class AggregatedTest(object):
                             Shell('run', 'make run %s %s' % (platform_str, flags)),
                             Check('check', check_output, test_obj=self)
                         ],
-                        timeout=40)
+                        timeout=400 if BENCH_MODE else 40)
 
     def get_common_header_str(self):
         return dedent(
@@ -1106,6 +1162,8 @@ def parse_output(output):
                           'load_stalls': 0,
                           'icache_miss': 0,
                           'tcdm_cont': 0,
+                          'wait_cycles': 0,
+                          'imbalance': None,
                           'mismatches': []})
         elif line.startswith('passed:'):
             cases[current_case]['passed'] = line.find('1') != -1
@@ -1119,6 +1177,10 @@ def parse_output(output):
             cases[current_case]['icache_miss'] = int(line.split(": ")[1])
         elif line.startswith('tcdm_cont'):
             cases[current_case]['tcdm_cont'] = int(line.split(": ")[1])
+        elif line.startswith('wait_cycles'):
+            cases[current_case]['wait_cycles'] = int(line.split(": ")[1])
+        elif line.startswith('imbalance'):
+            cases[current_case]['imbalance'] = int(line.split(": ")[1]) / 100
         elif line.startswith('<Mismatch>'):
             cases[current_case]['mismatches'].append("Mismatch: %s" % line[11:])
     return cases
@@ -1126,6 +1188,8 @@ def parse_output(output):
 
 BENCHMARK_FILE = os.path.join(os.path.dirname(os.path.realpath(__file__)),
                               "bench_{}.csv".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
+BALANCE_FILE = os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                            "balance_{}.csv".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
 
 
 def bench_output(performance, test_obj, test_case):
@@ -1156,12 +1220,27 @@ def bench_output(performance, test_obj, test_case):
                           str(ops_per_cycle)]))
         f.write("\n")
 
+    # the load balance, only for functions which forked in balance mode
+    if performance['imbalance'] is None:
+        return
+    if not os.path.isfile(BALANCE_FILE):
+        with open(BALANCE_FILE, "w") as f:
+            f.write("name,device,dimension,cycles,wait_cycles,imbalance\n")
+    with open(BALANCE_FILE, "a") as f:
+        f.write(",".join([test_obj.function_name,
+                          test_obj.device_name,
+                          dimension,
+                          str(performance['cycles']),
+                          str(performance['wait_cycles']),
+                          str(performance['imbalance'])]))
+        f.write("\n")
+
 
 class Sweep:
     """ Iterator over all variables and returns the environment"""
     def __init__(self, variables, version):
         self.variables = variables
-        self.prod_iter = product(*[v.values if v.active(version) else [v.values[0]]
+        self.prod_iter = product(*[v.sweep_values() if v.active(version) else [v.sweep_values()[0]]
                                    for v in self.variables
                                    if isinstance(v, SweepVariable)])
 
@@ -1246,7 +1325,7 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
         # In case of float: add a tiny absolute offset of 0.0001
         return dedent(
             """\
-            {indent}float __tol = ABS({tol:E} * (float){exp} + 0.0001);
+            {indent}float __tol = {tol:E} * ABS((float){exp}) + 0.0001;
             {indent}if (!({acq} >= ({ty})({exp} - __tol) &&
             {indent}      {acq} <= ({ty})({exp} + __tol))) {{\
             """
@@ -1335,6 +1414,9 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
 def generate_test(function_name, arguments, variables, implemented, use_l1=False,
                   extended_output=True, n_ops=None, arg_ret_type=None):
     """ Entry-Point of the phase 1 """
+    if BENCH_MODE:
+        variables, arguments = bench_sweep_n_pe(variables, arguments)
+
     testsets = [
         Testset(
             name=device_name,
@@ -1358,6 +1440,20 @@ def generate_test(function_name, arguments, variables, implemented, use_l1=False
     return {'testsets': testsets}
 
 
+def bench_sweep_n_pe(variables, arguments):
+    """ returns variables and arguments, where every constant ParallelArgument is replaced by a sweep
+    over BENCH_N_PE for the parallel versions """
+    if not any(isinstance(arg, ParallelArgument) and isinstance(arg.value, int)
+               for arg in arguments):
+        return variables, arguments
+    variables = variables + [SweepVariable('nPE', BENCH_N_PE,
+                                           active=lambda v: v.endswith('parallel'))]
+    arguments = [ParallelArgument(arg.name, 'nPE', arg.use_l1, arg.in_function)
+                 if isinstance(arg, ParallelArgument) and isinstance(arg.value, int) else arg
+                 for arg in arguments]
+    return variables, arguments
+
+
 def call_dynamic_function(f, env, version, device, arg_name=None, argument=None, use_l1=None):
     """ Calls the funciton f and passes env, version, device or var_types, based on the arguments of
     the function """
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = [float(v) for v in inputs['pSrc'].value]
+    lo = min(x + [0.0])
+    hi = max(x + [0.0])
+    if hi == lo:
+        scale, zero_point = 1.0, 0
+    else:
+        scale = (hi - lo) / 255
+        zero_point = min(127, round_away(-128 - lo / scale))
+
+    name = result_parameter.general_name()
+    if name == 'pScale':
+        return np.array([scale]).astype(np.float32)
+    if name == 'pZeroPoint':
+        return np.array([zero_point]).astype(np.int32)
+    dst = [max(-128, min(127, round_away(v / scale + zero_point))) for v in x]
+    return np.array(dst).astype(np.int8)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def round_away(x):
+    # rounds half away from zero
+    return int(x + 0.5) if x >= 0 else -int(-x + 0.5)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
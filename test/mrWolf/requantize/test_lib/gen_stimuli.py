@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    C = env['n_channels']
+    mult = inputs['pMult'].value
+    shift = inputs['pShift'].value
+    return np.array([requant(int(x), int(mult[i % C]), int(shift[i % C]))
+                     for (i, x) in enumerate(inputs['pSrc'].value)], dtype=np.int8)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def requant(x, mult, shift):
+    # round to the nearest value and saturate to 8 bits
+    x = (x * mult + (1 << (shift - 1))) >> shift
+    return max(-128, min(127, x))
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    L = env['L']
+    M = env['M']
+    taps = env['phase_len']
+    block_size = env['len']
+    is_float = inputs['pSrc'].ctype == 'float'
+    bank = inputs['pBank'].value
+    state = list(inputs['pState'].value[:taps - 1]) + list(inputs['pSrc'].value)
+
+    # the next output is the upsampled sample n * L + p, relative to the start of the block
+    n, p = divmod(env['phase'], L)
+    dst = []
+    while n < block_size:
+        x = state[n:n + taps]
+        c = bank[p * taps:(p + 1) * taps]
+        if is_float:
+            dst.append(float(sum(float(a) * float(b) for a, b in zip(c, x))))
+        else:
+            acc = sum(int(a) * int(b) for a, b in zip(c, x))
+            dst.append(wrap16((acc + (1 << (fix_point - 1))) >> fix_point))
+        n, p = n + (p + M) // L, (p + M) % L
+
+    if "return_value" in result_parameter.name:
+        return len(dst)
+    dtype = np.float32 if is_float else np.int16
+    if result_parameter.general_name() == 'pState':
+        # the last taps - 1 samples are moved to the front, the new block stays behind them
+        return np.array(state[block_size:block_size + taps - 1] + state[taps - 1:]).astype(dtype)
+    return np.array(dst + [0] * (env['len_dst'] - len(dst))).astype(dtype)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def wrap16(x):
+    # the sum is truncated to the output type
+    x &= 0xffff
+    return x - 0x10000 if x & 0x8000 else x
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    dtype = np.float32 if result_parameter.ctype == 'float' else np.int16
+    if result_parameter.general_name() == 'pState':
+        return np.zeros(env['len_state'], dtype=dtype)
+
+    # phase p of the time-reversed coefficients is pCoeffs[L - 1 - p + k * L]
+    L = env['L']
+    coeffs = inputs['pCoeffs'].value
+    bank = [coeffs[L - 1 - p + k * L] for p in range(L) for k in range(env['phase_len'])]
+    return np.array(bank).astype(dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -1,5 +1,7 @@
 #!/usr/bin/env python3
 
+import cmath
+import math
 import numpy as np
 
 
@@ -27,14 +29,30 @@ def compute_result(result_parameter, inputs, env, fix_point):
         # else:
             
     elif result_parameter.ctype == 'float':
-        a = inputs['pSrc'].value.astype(np.float32)
-        result = np.array(np.fft.rfft(a), dtype=np.float32)
+        # the full complex spectrum
+        y = fft([complex(float(x)) for x in inputs['pSrc'].value])
+        result = np.array([p for v in y for p in (v.real, v.imag)], dtype=np.float32)
     else:
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
     return result
 
 
+####################
+# Helper Functions #
+####################
+
+
+def fft(x):
+    # recursive radix-2 FFT in double precision
+    n = len(x)
+    if n == 1:
+        return x
+    even, odd = fft(x[0::2]), fft(x[1::2])
+    t = [cmath.exp(-2j * math.pi * k / n) * odd[k] for k in range(n // 2)]
+    return [even[k] + t[k] for k in range(n // 2)] + [even[k] - t[k] for k in range(n // 2)]
+
+
 ######################
 # Fixpoint Functions #
 ######################
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    length = env['len']
+    stride = env['stride']
+    a = inputs['pSrc'].value.astype(np.float32)
+
+    # the full complex spectrum of every channel, the padding is not written (left at zero)
+    result = np.zeros(2 * stride * env['channels'], dtype=np.float32)
+    for c in range(env['channels']):
+        y = np.fft.fft(a[c * stride:c * stride + length].astype(np.float64))
+        result[2 * c * stride:2 * (c * stride + length):2] = np.real(y)
+        result[2 * c * stride + 1:2 * (c * stride + length):2] = np.imag(y)
+
+    return result
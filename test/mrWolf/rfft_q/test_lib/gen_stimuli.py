@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    length = env['len']
+    a = inputs['pSrc'].value.astype(np.float64) / 2**fix_point
+    spectrum = np.fft.rfft(a) / length
+    result = np.stack([np.real(spectrum), np.imag(spectrum)], axis=1).flatten()
+
+    # Q1.15 or Q1.31 of X / N
+    if result_parameter.ctype == 'int16_t':
+        return np.round(result * 2**fix_point).astype(np.int16)
+    return np.round(result * 2**fix_point).astype(np.int32)
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # non-positive inputs result in 0, fixed point outputs use the format of the input
+    x = inputs['pSrc'].value
+    if result_parameter.ctype == 'float':
+        x = x.astype(np.float32)
+        return np.where(x > 0, 1 / np.sqrt(np.maximum(x, 1e-30)), 0).astype(np.float32)
+    scale = 2.0 ** fix_point
+    x = x.astype(np.float64) / scale
+    result = np.round(scale / np.sqrt(np.maximum(x, 1e-30)))
+    return np.where(x > 0, np.minimum(result, 2**15 - 1), 0).astype(np.int16)
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
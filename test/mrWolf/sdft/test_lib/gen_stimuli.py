@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    is_float = inputs['pSrc'].ctype == 'float'
+    N = env['len_window']
+    r = 0.99999 ** N
+    coeffs = [float(x) if is_float else int(x) for x in inputs['pCoeffs'].value]
+    state = [float(x) if is_float else int(x) for x in inputs['pState'].value]
+    delay = [float(x) if is_float else int(x) for x in inputs['pDelay'].value]
+    damping = f32(r) if is_float else int(np.round(r * 2**30))
+    index = env['index']
+
+    for x in inputs['pSrc'].value:
+        x = float(x) if is_float else int(x)
+        # x[n] - r^N x[n - N], where x[n - N] is replaced by x[n] in the delay line
+        d = f32(x - f32(damping * delay[index])) if is_float else x - q30_mul(damping, delay[index])
+        delay[index] = x
+        index = (index + 1) % N
+        for k in range(env['num_bins']):
+            wr, wi = coeffs[2 * k], coeffs[2 * k + 1]
+            if is_float:
+                a = f32(state[2 * k] + d)
+                b = state[2 * k + 1]
+                state[2 * k] = f32(f32(wr * a) - f32(wi * b))
+                state[2 * k + 1] = f32(f32(wr * b) + f32(wi * a))
+            else:
+                a = state[2 * k] + d
+                b = state[2 * k + 1]
+                state[2 * k] = (wr * a - wi * b + (1 << 29)) >> 30
+                state[2 * k + 1] = (wr * b + wi * a + (1 << 29)) >> 30
+
+    name = result_parameter.general_name()
+    if name == 'pDelay':
+        return np.array(delay).astype(np.float32 if is_float else np.int16)
+    return np.array(state).astype(np.float32 if is_float else np.int32)
+
+
+####################
+# Helper Functions #
+####################
+
+
+def f32(x):
+    return float(np.float32(x))
+
+
+def q30_mul(a, b):
+    return (a * b + (1 << 29)) >> 30
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # fixed point inputs map [0, 1) to [0, 2*pi), floating point inputs are radians
+    x = inputs['pSrc'].value
+    fun = np.sin if result_parameter.general_name() == 'pSin' else np.cos
+    if result_parameter.ctype == 'float':
+        return fun(x.astype(np.float32)).astype(np.float32)
+    bits = 16 if result_parameter.ctype == 'int16_t' else 32
+    dtype = np.int16 if bits == 16 else np.int32
+    scale = 2.0 ** (bits - 1)
+    result = np.round(scale * fun(2 * np.pi * x.astype(np.float64) / scale))
+    return np.clip(result, -scale, scale - 1).astype(dtype)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
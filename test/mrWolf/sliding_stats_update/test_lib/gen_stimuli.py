@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    new = inputs['pNew'].value
+    old = inputs['pOld'].value
+    state = inputs['state'].value
+    if fix_point is not None:
+        new = new.astype(np.int64)
+        old = old.astype(np.int64)
+        result = state.astype(np.int64)
+        result[2] += np.sum(new) - np.sum(old)
+        result[3] += np.sum((new * new) >> fix_point) - np.sum((old * old) >> fix_point)
+        return result.astype(np.int32)
+    else:
+        # the count (stored as uint32_t) does not change, since the window is full
+        result = state.copy()
+        result[1] = state[1] + np.sum(new.astype(np.float64)) - np.sum(old.astype(np.float64))
+        result[2] = state[2] + np.sum(new.astype(np.float64)**2) - np.sum(old.astype(np.float64)**2)
+        return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    L = env['row_len']
+    x = [float(v) for v in inputs['pSrc'].value]
+    if fix_point is not None:
+        x = [v / 2**fix_point for v in x]
+
+    result = []
+    for r in range(env['n_rows']):
+        e = [np.exp(v - max(x[r * L:(r + 1) * L])) for v in x[r * L:(r + 1) * L]]
+        result += [v / sum(e) for v in e]
+
+    if fix_point is None:
+        return np.array(result, dtype=np.float32)
+    return np.array([min(32767, int(np.round(v * 2**fix_point))) for v in result], dtype=np.int16)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    rowptr = inputs['pRowPtr'].value
+    colidx = inputs['pColIdx'].value
+    data = inputs['pData'].value
+    x = inputs['pSrcX'].value
+
+    # y[m] is the sum over the nonzeros of row m, in the order in which they are stored
+    dtype = result_parameter.get_dtype()
+    y = np.zeros(env['len_m']).astype(dtype)
+    for m in range(env['len_m']):
+        acc = dtype(0)
+        for k in range(int(rowptr[m]), int(rowptr[m + 1])):
+            acc += dtype(data[k]) * dtype(x[int(colidx[k])])
+        y[m] = acc
+    return y
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+
+    The output is laid out like plp_stats_summary_result: mean, var, min, max, argmin, argmax
+    """
+    n = env['len']
+    if result_parameter.ctype == 'int32_t':
+        p = inputs['pSrc'].value.astype(np.int64)
+        # C division truncates towards zero
+        mean = int(np.sum(p) / n)
+        var = int(np.sum(p * p)) // n - mean * mean
+        result = np.array([mean, var, np.min(p), np.max(p), np.argmin(p), np.argmax(p)],
+                          dtype=np.int32)
+    elif result_parameter.ctype == 'float':
+        p = inputs['pSrc'].value.astype(np.float32)
+        mean = np.mean(p)
+        result = np.zeros(6, dtype=np.float32)
+        result[0:4] = [mean, np.mean(p * p) - mean * mean, np.min(p), np.max(p)]
+        # the indices are stored as uint32_t
+        result[4:6] = np.array([np.argmin(p), np.argmax(p)], dtype=np.uint32).view(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    length = env['len']
+    hop = env['hop']
+    n_frames = env['block_len'] // hop
+
+    if 'pNumFrames' in result_parameter.name:
+        return np.array([n_frames], dtype=np.uint32)
+
+    a = inputs['pSrc'].value.astype(np.float64)
+    w = inputs['window'].value.astype(np.float64)
+    if fix_point is not None:
+        a = a / 2**fix_point
+        w = w / 2**fix_point
+
+    # the ring buffer is zero-initialized, a frame is computed after every hop samples
+    a = np.concatenate([np.zeros(length), a])
+    result = []
+    for f in range(n_frames):
+        end = length + (f + 1) * hop
+        y = np.fft.rfft(a[end - length:end] * w)
+        result.append(np.real(y)**2 + np.imag(y)**2)
+    result = np.concatenate(result)
+
+    if fix_point is not None:
+        # Q2.30 of |X / N|^2
+        return np.round(result / length**2 * 2**30).astype(np.int32)
+    return result.astype(np.float32)
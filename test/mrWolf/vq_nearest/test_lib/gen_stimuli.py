@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    dim = env['dim']
+    is_float = inputs['pSrc'].value.dtype == np.float32
+    src = [float(x) if is_float else int(x) for x in inputs['pSrc'].value]
+    book = [float(x) if is_float else int(x) for x in inputs['pCodebook'].value]
+    idx, dist = [], []
+    for n in range(env['num_vectors']):
+        a = src[n * dim:(n + 1) * dim]
+        d = [sum((x - y) ** 2 for x, y in zip(a, book[k * dim:(k + 1) * dim]))
+             for k in range(env['num_centroids'])]
+        # of equal distances, the lowest index is selected
+        idx.append(min(range(len(d)), key=lambda k: (d[k], k)))
+        dist.append(d[idx[-1]])
+    if result_parameter.general_name() == 'pIdx':
+        return np.array(idx).astype(np.uint32)
+    return np.array(dist).astype(np.float32 if is_float else np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
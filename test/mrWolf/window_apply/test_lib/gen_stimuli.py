@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len']
+    src = inputs['src'].value[env['offset']:]
+    w = inputs['coeffs'].value
+    half = N // 2
+    # the second half is read backwards from the mirror index
+    idx = [n if n < half or env['mirror'] == 0 else env['mirror_index'] - n for n in range(N)]
+    if result_parameter.ctype == 'float':
+        return np.array([float(src[n]) * float(w[idx[n]]) for n in range(N)]).astype(np.float32)
+    res = [(int(src[n]) * int(w[idx[n]]) + (1 << 14)) >> 15 for n in range(N)]
+    return np.array(res).astype(np.int16)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    w = window(env)
+    if result_parameter.ctype == 'float':
+        return np.array(w).astype(np.float32)
+    # the maximum of 1.0 is saturated
+    return np.array([min(32767, int(round(x * 32768))) for x in w]).astype(np.int16)
+
+
+def window(env):
+    # Hann, Hamming or Blackman window, with M = N - 1 (symmetric) or M = N (periodic)
+    a0, a1, a2 = [(0.5, 0.5, 0.0), (0.54, 0.46, 0.0), (0.42, 0.5, 0.08)][env['type']]
+    M = env['len'] if env['periodic'] else env['len'] - 1
+    return [a0 - a1 * math.cos(2 * math.pi * n / M) + a2 * math.cos(4 * math.pi * n / M)
+            for n in range(M - env['len'] // 2 + 1)]
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
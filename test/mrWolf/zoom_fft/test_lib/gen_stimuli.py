@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import cmath
+import math
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = [float(v) for v in inputs['pSrc'].value]
+    c = [float(v) for v in inputs['pCoeffs'].value]
+    fc, d, n, taps = env['fc'], env['D'], env['fft_len'], env['num_taps']
+
+    # mix down by fc, starting at phase zero
+    z = [x[i] * cmath.exp(-2j * math.pi * fc * i) for i in range(len(x))]
+
+    # decimate with the time reversed coefficients, the delay line starts at zero
+    y = []
+    for o in range(n):
+        first = o * d + d - taps
+        y.append(sum(c[k] * z[first + k] for k in range(taps) if first + k >= 0))
+
+    # transform and move the center frequency from bin 0 to bin n / 2
+    spec = [sum(y[i] * cmath.exp(-2j * math.pi * i * k / n) for i in range(n)) for k in range(n)]
+    shift = n - n // 2
+    spec = [spec[(i + shift) % n] for i in range(n)]
+    return np.array([p for v in spec for p in (v.real, v.imag)]).astype(np.float32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
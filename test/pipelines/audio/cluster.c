@@ -0,0 +1,123 @@
+/*
+ * Audio effect chain: a block of stereo samples is copied from L2 to L1, equalized with a cascade
+ * of biquads per channel (high-pass, two peaking filters and a low-pass), amplified and limited,
+ * and copied back to L2. One frame is one block.
+ */
+
+#include "rt/rt_api.h"
+#include "stdio.h"
+#include "plp_math.h"
+#include "pipeline.h"
+
+#define AUDIO_SAMPLE_RATE 48000.0f
+#define AUDIO_CHANNELS 2
+#define AUDIO_BLOCK 256 // samples per channel and frame
+#define AUDIO_BLOCKS 8  // blocks of the input stream in L2, which are processed round robin
+#define AUDIO_STAGES 4
+#define AUDIO_GAIN 1.5f
+
+#define AUDIO_LOWPASS 0
+#define AUDIO_HIGHPASS 1
+#define AUDIO_PEAKING 2
+
+float32_t audio_in[AUDIO_BLOCKS * AUDIO_CHANNELS * AUDIO_BLOCK];
+float32_t audio_out[AUDIO_BLOCKS * AUDIO_CHANNELS * AUDIO_BLOCK];
+
+RT_L1_DATA float32_t audio_coeffs[5 * AUDIO_STAGES];
+RT_L1_DATA float32_t audio_state[AUDIO_CHANNELS * 2 * AUDIO_STAGES];
+RT_L1_DATA float32_t audio_src[AUDIO_CHANNELS * AUDIO_BLOCK];
+RT_L1_DATA float32_t audio_dst[AUDIO_CHANNELS * AUDIO_BLOCK];
+
+static plp_biquad_cascade_df2T_instance_f32 audio_eq[AUDIO_CHANNELS];
+
+/* coefficients {b0, b1, b2, -a1, -a2} of an RBJ cookbook biquad, normalized to a0 = 1 */
+static void audio_biquad(float32_t *pCoeffs, uint32_t type, float32_t f0, float32_t Q,
+                         float32_t gainDb) {
+    float32_t w0 = 6.28318531f * f0 / AUDIO_SAMPLE_RATE;
+    float32_t cw = cosf(w0);
+    float32_t alpha = sinf(w0) / (2.0f * Q);
+    float32_t A = powf(10.0f, gainDb / 40.0f);
+    float32_t b0, b1, b2, a0, a1, a2;
+
+    if (type == AUDIO_PEAKING) {
+        b0 = 1.0f + alpha * A;
+        b1 = -2.0f * cw;
+        b2 = 1.0f - alpha * A;
+        a0 = 1.0f + alpha / A;
+        a1 = -2.0f * cw;
+        a2 = 1.0f - alpha / A;
+    } else {
+        b1 = (type == AUDIO_LOWPASS) ? 1.0f - cw : -(1.0f + cw);
+        b0 = b1 * ((type == AUDIO_LOWPASS) ? 0.5f : -0.5f);
+        b2 = b0;
+        a0 = 1.0f + alpha;
+        a1 = -2.0f * cw;
+        a2 = 1.0f - alpha;
+    }
+
+    pCoeffs[0] = b0 / a0;
+    pCoeffs[1] = b1 / a0;
+    pCoeffs[2] = b2 / a0;
+    pCoeffs[3] = -a1 / a0;
+    pCoeffs[4] = -a2 / a0;
+}
+
+static void audio_setup(void) {
+    uint32_t seed = 1;
+    uint32_t i, c;
+
+    // a tone in noise, louder on the left channel
+    for (i = 0; i < AUDIO_BLOCKS * AUDIO_BLOCK; i++) {
+        float32_t tone = sinf(6.28318531f * 440.0f * i / AUDIO_SAMPLE_RATE);
+        for (c = 0; c < AUDIO_CHANNELS; c++) {
+            audio_in[((i / AUDIO_BLOCK) * AUDIO_CHANNELS + c) * AUDIO_BLOCK + i % AUDIO_BLOCK] =
+                tone * (c == 0 ? 0.8f : 0.4f) + pipeline_rand_f32(&seed, 0.1f);
+        }
+    }
+
+    audio_biquad(audio_coeffs, AUDIO_HIGHPASS, 40.0f, 0.707f, 0.0f);
+    audio_biquad(audio_coeffs + 5, AUDIO_PEAKING, 300.0f, 1.0f, -3.0f);
+    audio_biquad(audio_coeffs + 10, AUDIO_PEAKING, 3000.0f, 2.0f, 4.0f);
+    audio_biquad(audio_coeffs + 15, AUDIO_LOWPASS, 16000.0f, 0.707f, 0.0f);
+
+    for (c = 0; c < AUDIO_CHANNELS; c++) {
+        plp_biquad_cascade_df2T_init_f32(&audio_eq[c], AUDIO_STAGES, audio_coeffs,
+                                         audio_state + c * 2 * AUDIO_STAGES);
+    }
+}
+
+static uint32_t audio_frame(uint32_t frame) {
+    uint32_t offset = (frame % AUDIO_BLOCKS) * AUDIO_CHANNELS * AUDIO_BLOCK;
+    rt_dma_copy_t copy;
+    uint32_t clipped = 0;
+    uint32_t i;
+
+    rt_dma_memcpy((uintptr_t)(audio_in + offset), (uintptr_t)audio_src, sizeof(audio_src),
+                  RT_DMA_DIR_EXT2LOC, 0, &copy);
+    rt_dma_wait(&copy);
+
+    // the channels are filtered in parallel, then the samples of both channels at once
+    plp_biquad_cascade_df2T_f32_parallel(audio_eq, AUDIO_CHANNELS, audio_src, AUDIO_BLOCK,
+                                         NUM_CORES, audio_dst);
+    plp_scale_f32_parallel(audio_dst, AUDIO_GAIN, audio_dst, AUDIO_CHANNELS * AUDIO_BLOCK,
+                           NUM_CORES);
+    plp_clip_f32_parallel(audio_dst, -1.0f, 1.0f, audio_dst, AUDIO_CHANNELS * AUDIO_BLOCK,
+                          NUM_CORES);
+
+    rt_dma_memcpy((uintptr_t)(audio_out + offset), (uintptr_t)audio_dst, sizeof(audio_dst),
+                  RT_DMA_DIR_LOC2EXT, 0, &copy);
+    rt_dma_wait(&copy);
+
+    // the number of limited samples
+    for (i = 0; i < AUDIO_CHANNELS * AUDIO_BLOCK; i++) {
+        if (audio_dst[i] == 1.0f || audio_dst[i] == -1.0f) {
+            clipped++;
+        }
+    }
+    return clipped;
+}
+
+void cluster_entry(void *arg) {
+    audio_setup();
+    pipeline_bench("audio", audio_frame, NUM_FRAMES);
+}
@@ -0,0 +1,115 @@
+/*
+ * Keyword spotting: the power spectrogram (STFT) of one second of audio, a log-mel filterbank and
+ * a small CNN of two 1D convolutions over time and a dense layer with softmax. One frame is one
+ * inference, the spectrogram is streamed hop by hop like in a real-time application. The audio and
+ * the weights are in L2, all other buffers in L1.
+ */
+
+#include "rt/rt_api.h"
+#include "stdio.h"
+#include "float.h"
+#include "plp_math.h"
+#include "pipeline.h"
+
+#define KWS_SAMPLE_RATE 16000
+#define KWS_CLIP_LEN 16000 // one second of audio per inference
+#define KWS_FFT_LEN 512
+#define KWS_HOP 320
+#define KWS_FRAMES (KWS_CLIP_LEN / KWS_HOP)
+#define KWS_BINS (KWS_FFT_LEN / 2 + 1)
+#define KWS_BANDS 40
+#define KWS_K 3 // taps of both convolutions
+#define KWS_C1 16
+#define KWS_C2 16
+#define KWS_L1 (KWS_FRAMES - KWS_K + 1)   // output length of the first convolution
+#define KWS_L2 ((KWS_L1 - KWS_K) / 2 + 1) // output length of the second one, with stride 2
+#define KWS_CLASSES 12
+
+float32_t kws_audio[KWS_CLIP_LEN];
+float32_t kws_conv1[KWS_C1 * KWS_K * KWS_BANDS];
+float32_t kws_conv2[KWS_C2 * KWS_K * KWS_C1];
+float32_t kws_dense[KWS_CLASSES * KWS_L2 * KWS_C2];
+
+RT_L1_DATA float32_t kws_fft_buffer[PLP_RFFT_BUFFER_SIZE_F32(KWS_FFT_LEN)];
+RT_L1_DATA float32_t kws_window_coeffs[PLP_WINDOW_COEFFS_SIZE(KWS_FFT_LEN)];
+RT_L1_DATA float32_t kws_state[KWS_FFT_LEN];
+RT_L1_DATA float32_t kws_scratch[2 * KWS_FFT_LEN];
+RT_L1_DATA float32_t kws_spectrum[KWS_BINS];
+RT_L1_DATA uint16_t kws_band_start[KWS_BANDS];
+RT_L1_DATA uint16_t kws_band_length[KWS_BANDS];
+RT_L1_DATA float32_t kws_mel_coeffs[PLP_MEL_COEFFS_SIZE(KWS_FFT_LEN)];
+RT_L1_DATA float32_t kws_mel[KWS_BANDS];
+RT_L1_DATA float32_t kws_features[KWS_FRAMES * KWS_BANDS];
+RT_L1_DATA float32_t kws_act1[KWS_L1 * KWS_C1];
+RT_L1_DATA float32_t kws_act2[KWS_L2 * KWS_C2];
+RT_L1_DATA float32_t kws_logits[KWS_CLASSES];
+RT_L1_DATA float32_t kws_probs[KWS_CLASSES];
+
+static plp_rfft_instance_f32 kws_fft;
+static plp_window_instance_f32 kws_window;
+static plp_stft_instance_f32 kws_stft;
+static plp_mel_filterbank_instance_f32 kws_filterbank;
+
+static void kws_setup(void) {
+    uint32_t seed = 1;
+    uint32_t i;
+
+    // a chirp with noise as audio, random weights
+    for (i = 0; i < KWS_CLIP_LEN; i++) {
+        float32_t t = (float32_t)i / KWS_SAMPLE_RATE;
+        kws_audio[i] = 0.5f * sinf(6.28318531f * (200.0f + 1500.0f * t) * t) +
+                       pipeline_rand_f32(&seed, 0.05f);
+    }
+    for (i = 0; i < KWS_C1 * KWS_K * KWS_BANDS; i++) {
+        kws_conv1[i] = pipeline_rand_f32(&seed, 0.1f);
+    }
+    for (i = 0; i < KWS_C2 * KWS_K * KWS_C1; i++) {
+        kws_conv2[i] = pipeline_rand_f32(&seed, 0.1f);
+    }
+    for (i = 0; i < KWS_CLASSES * KWS_L2 * KWS_C2; i++) {
+        kws_dense[i] = pipeline_rand_f32(&seed, 0.05f);
+    }
+
+    plp_rfft_init_f32(&kws_fft, KWS_FFT_LEN, kws_fft_buffer);
+    plp_window_init_f32(&kws_window, PLP_WINDOW_HANN, KWS_FFT_LEN, 1, kws_window_coeffs);
+    plp_stft_init_f32(&kws_stft, &kws_fft, &kws_window, KWS_HOP, kws_state, kws_scratch);
+    plp_mel_filterbank_init_f32(&kws_filterbank, KWS_BANDS, KWS_FFT_LEN, KWS_SAMPLE_RATE, 20.0f,
+                                KWS_SAMPLE_RATE / 2, kws_band_start, kws_band_length,
+                                kws_mel_coeffs);
+}
+
+static uint32_t kws_frame(uint32_t frame) {
+    uint32_t t, numFrames, i, best = 0;
+
+    // log-mel features, one spectrum per hop (the STFT state continues from the last inference)
+    for (t = 0; t < KWS_FRAMES; t++) {
+        plp_stft_f32(&kws_stft, kws_audio + t * KWS_HOP, KWS_HOP, kws_spectrum, &numFrames);
+        plp_mel_filterbank_f32(&kws_filterbank, kws_spectrum, kws_mel);
+        plp_offset_f32(kws_mel, 1e-6f, kws_mel, KWS_BANDS);
+        plp_log_f32_vec(kws_mel, kws_features + t * KWS_BANDS, KWS_BANDS);
+    }
+
+    // CNN over time, with the mel bands as input channels
+    plp_conv1d_f32_parallel(kws_features, KWS_FRAMES, KWS_BANDS, kws_conv1, KWS_C1, KWS_K, 1, 1, 0,
+                            0, NUM_CORES, kws_act1);
+    plp_clip_f32_parallel(kws_act1, 0.0f, FLT_MAX, kws_act1, KWS_L1 * KWS_C1, NUM_CORES);
+    plp_conv1d_f32_parallel(kws_act1, KWS_L1, KWS_C1, kws_conv2, KWS_C2, KWS_K, 1, 2, 0, 0,
+                            NUM_CORES, kws_act2);
+    plp_clip_f32_parallel(kws_act2, 0.0f, FLT_MAX, kws_act2, KWS_L2 * KWS_C2, NUM_CORES);
+    plp_mat_vec_mult_f32_parallel(kws_dense, kws_act2, KWS_CLASSES, KWS_L2 * KWS_C2, NUM_CORES,
+                                  kws_logits);
+    plp_softmax_f32(kws_logits, 1, KWS_CLASSES, kws_probs);
+
+    // the detected keyword
+    for (i = 1; i < KWS_CLASSES; i++) {
+        if (kws_probs[i] > kws_probs[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+void cluster_entry(void *arg) {
+    kws_setup();
+    pipeline_bench("kws", kws_frame, NUM_FRAMES);
+}
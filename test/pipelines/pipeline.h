@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline.h
+ * Description:  Harness of the end-to-end pipeline benchmarks
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_H__
+#define __PIPELINE_H__
+
+#include "rt/rt_api.h"
+#include "stdio.h"
+#include "plp_math.h"
+
+/* number of cores of the parallel functions, set with make NUM_CORES=... */
+#ifndef NUM_CORES
+#define NUM_CORES 8
+#endif
+
+/* number of measured frames, set with make NUM_FRAMES=... */
+#ifndef NUM_FRAMES
+#define NUM_FRAMES 16
+#endif
+
+/* entry point of the cluster, called by main on the fabric controller */
+void cluster_entry(void *arg);
+
+/* processes frame number frame of a pipeline, and returns a result to check that it did work (e.g.
+   the number of detections) */
+typedef uint32_t (*pipeline_frame_fct)(uint32_t frame);
+
+/* uniformly distributed pseudo-random value in [-scale, scale), for weights and test signals */
+static inline float32_t pipeline_rand_f32(uint32_t *seed, float32_t scale) {
+    *seed = *seed * 1664525U + 1013904223U;
+    return scale * ((float32_t)(int32_t)*seed * (1.0f / 2147483648.0f));
+}
+
+/* number of parallel kernels of a pipeline, whose load balance is measured with PLP_TRACE */
+#define PIPELINE_KERNELS 16
+
+/* runs one frame to warm up the instruction cache, then measures numFrames frames, and prints the
+   cycles per frame and the frames per second at the current cluster frequency. With PLP_TRACE (in
+   the library and the pipeline), it also prints the load balance of the parallel kernels. */
+static inline void pipeline_bench(const char *name, pipeline_frame_fct frame, uint32_t numFrames) {
+    rt_perf_t perf;
+    uint32_t f, cycles, instr, freq, fps100;
+    uint32_t result = 0;
+#if defined(PLP_TRACE)
+    static plp_balance_entry balance[PIPELINE_KERNELS];
+#endif
+
+    rt_perf_init(&perf);
+
+    frame(0);
+
+#if defined(PLP_TRACE)
+    plp_balance_init(balance, PIPELINE_KERNELS);
+#endif
+
+    rt_perf_conf(&perf, (1 << RT_PERF_CYCLES) | (1 << RT_PERF_INSTR));
+    rt_perf_reset(&perf);
+    rt_perf_start(&perf);
+
+    for (f = 1; f <= numFrames; f++) {
+        result = frame(f);
+    }
+
+    rt_perf_stop(&perf);
+
+    cycles = rt_perf_read(RT_PERF_CYCLES);
+    instr = rt_perf_read(RT_PERF_INSTR);
+    freq = rt_freq_get(RT_FREQ_DOMAIN_CL);
+    fps100 = (uint32_t)((uint64_t)freq * 100 * numFrames / cycles);
+
+    printf("\npipeline %s {\n", name);
+    printf("    cores: %d\n", NUM_CORES);
+    printf("    frames: %d\n", numFrames);
+    printf("    cycles_per_frame: %d\n", cycles / numFrames);
+    printf("    instructions_per_frame: %d\n", instr / numFrames);
+    printf("    frequency: %d\n", freq);
+    printf("    fps: %d.%02d\n", fps100 / 100, fps100 % 100);
+    printf("    result: %d\n", result);
+    printf("}\n");
+
+#if defined(PLP_TRACE)
+    printf("\nbalance %s {\n", name);
+    plp_balance_dump();
+    printf("}\n");
+#endif
+}
+
+#endif // __PIPELINE_H__
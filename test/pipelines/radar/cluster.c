@@ -0,0 +1,102 @@
+/*
+ * Range-Doppler radar: the ADC samples of the chirps of one radar frame are copied from L2 to L1,
+ * transformed with a 2D FFT (range over the samples of a chirp, Doppler over the chirps), and the
+ * power of every cell is compared to its neighbors in range with a cell-averaging CFAR detector.
+ * One frame is one radar frame.
+ */
+
+#include "rt/rt_api.h"
+#include "stdio.h"
+#include "plp_math.h"
+#include "plp_const_structs.h"
+#include "pipeline.h"
+
+#define RADAR_CHIRPS 32
+#define RADAR_SAMPLES 64
+#define RADAR_CELLS (RADAR_CHIRPS * RADAR_SAMPLES)
+#define RADAR_GUARD 2     // guard cells on each side of the cell under test
+#define RADAR_TRAIN 8     // training cells on each side, which estimate the noise
+#define RADAR_ALPHA 12.0f // threshold over the average noise power
+#define RADAR_TARGETS 3
+
+float32_t radar_adc[2 * RADAR_CELLS];
+
+RT_L1_DATA float32_t radar_cube[2 * RADAR_CELLS];
+RT_L1_DATA float32_t radar_power[RADAR_CELLS];
+RT_L1_DATA float32_t radar_sums[NUM_CORES * (RADAR_SAMPLES + 1)];
+RT_L1_DATA uint32_t radar_detections[NUM_CORES];
+
+static void radar_setup(void) {
+    uint32_t seed = 1;
+    uint32_t c, n, k;
+
+    // a few targets with different range and velocity in complex noise
+    const float32_t range[RADAR_TARGETS] = { 0.09f, 0.23f, 0.41f };
+    const float32_t doppler[RADAR_TARGETS] = { 0.05f, -0.17f, 0.30f };
+    for (c = 0; c < RADAR_CHIRPS; c++) {
+        for (n = 0; n < RADAR_SAMPLES; n++) {
+            float32_t re = pipeline_rand_f32(&seed, 0.1f);
+            float32_t im = pipeline_rand_f32(&seed, 0.1f);
+            for (k = 0; k < RADAR_TARGETS; k++) {
+                float32_t phase = 6.28318531f * (range[k] * n + doppler[k] * c);
+                re += cosf(phase);
+                im += sinf(phase);
+            }
+            radar_adc[2 * (c * RADAR_SAMPLES + n)] = re;
+            radar_adc[2 * (c * RADAR_SAMPLES + n) + 1] = im;
+        }
+    }
+}
+
+/* CA-CFAR along range, the Doppler rows are distributed over the cores. The windows of training
+   cells are summed with the cumulative sum of the row. */
+static void radar_cfar(void *args) {
+    uint32_t core = rt_core_id();
+    float32_t *pSum = radar_sums + core * (RADAR_SAMPLES + 1);
+    uint32_t count = 0;
+    uint32_t r, i;
+
+    for (r = core; r < RADAR_CHIRPS; r += NUM_CORES) {
+        const float32_t *pRow = radar_power + r * RADAR_SAMPLES;
+
+        // pSum[i] is the sum of the cells 0 to i - 1
+        pSum[0] = 0.0f;
+        plp_cumsum_f32s_xpulpv2(pRow, pSum + 1, RADAR_SAMPLES);
+
+        for (i = RADAR_GUARD + RADAR_TRAIN; i < RADAR_SAMPLES - RADAR_GUARD - RADAR_TRAIN; i++) {
+            float32_t noise = (pSum[i - RADAR_GUARD] - pSum[i - RADAR_GUARD - RADAR_TRAIN]) +
+                              (pSum[i + RADAR_GUARD + RADAR_TRAIN + 1] - pSum[i + RADAR_GUARD + 1]);
+            if (pRow[i] * (2 * RADAR_TRAIN) > RADAR_ALPHA * noise) {
+                count++;
+            }
+        }
+    }
+
+    radar_detections[core] = count;
+}
+
+static uint32_t radar_frame(uint32_t frame) {
+    rt_dma_copy_t copy;
+    uint32_t count = 0;
+    uint32_t i;
+
+    rt_dma_memcpy((uintptr_t)radar_adc, (uintptr_t)radar_cube, sizeof(radar_cube),
+                  RT_DMA_DIR_EXT2LOC, 0, &copy);
+    rt_dma_wait(&copy);
+
+    plp_fft2d_f32(&plp_cfft_sR_f32_len64, &plp_cfft_sR_f32_len32, radar_cube, RADAR_SAMPLES, 0, 1,
+                  NUM_CORES);
+    plp_cmplx_mag_squared_f32_parallel(radar_cube, radar_power, RADAR_CELLS, NUM_CORES);
+
+    rt_team_fork(NUM_CORES, radar_cfar, NULL);
+
+    for (i = 0; i < NUM_CORES; i++) {
+        count += radar_detections[i];
+    }
+    return count;
+}
+
+void cluster_entry(void *arg) {
+    radar_setup();
+    pipeline_bench("radar", radar_frame, NUM_FRAMES);
+}